@@ -1049,7 +1049,6 @@ SRes LzmaDec_DecodeToBuf(CLzmaDec *p, Byte *dest, SizeT *destLen, const Byte *sr
 //    printf("outSizeCur %d \n", outSizeCur);
 
     res = LzmaDec_DecodeToDic(p, outSizeCur, src, &inSizeCur, curFinishMode, status);
-    printf("LzmaDec_DecodeToDic res %d status %d \n", res, *status);
 
     src += inSizeCur;
     inSize -= inSizeCur;
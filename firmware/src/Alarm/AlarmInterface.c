@@ -5,8 +5,97 @@
  */
 /* ************************************************************************** */
 
+#include <stddef.h>
+#include <string.h>
+
 #include "AlarmInterface.h"
 #include "GuiInterface.h"
+#include "AlarmEventHandler.h"
+
+/** @brief Change sets shared with GUI task and Device task */
+static ALARM_CHANGE_SET_t s_changeSet[ALARM_CHANGE_SET_SLOTS];
+
+/** @brief Next change set slot to use */
+static uint8_t s_changeSetNext = 0;
+
+/** @brief Latency counters of all alarms */
+static ALARM_LATENCY_t s_alarmLatency[eNoOfAlarmId];
+
+/** @brief Definition of a field of ALARM_MONITOR_t and its dependency group */
+typedef struct {
+    uint16_t offset;    /**<offset of field */
+    uint16_t size;      /**<size of field */
+    uint32_t dep;       /**<ALARM_DEP_xxx group of field */
+} ALARM_MONITOR_FIELD_t;
+
+#define ALARM_MONITOR_FIELD(field, dep) { offsetof(ALARM_MONITOR_t, field), sizeof(((ALARM_MONITOR_t *)0)->field), dep }
+
+/** @brief All fields of ALARM_MONITOR_t checked for changes */
+static const ALARM_MONITOR_FIELD_t s_alarmMonitorField[] = {
+    ALARM_MONITOR_FIELD(BME280SensorErr, ALARM_DEP_SENSOR_ERROR),
+    ALARM_MONITOR_FIELD(ADXL345SensorErr, ALARM_DEP_SENSOR_ERROR),
+    ALARM_MONITOR_FIELD(AirFlowSensorErr, ALARM_DEP_SENSOR_ERROR),
+    ALARM_MONITOR_FIELD(O2FlowSensorErr, ALARM_DEP_SENSOR_ERROR),
+    ALARM_MONITOR_FIELD(BreathingCircuitType, ALARM_DEP_BREATHING_CIRCUIT),
+    ALARM_MONITOR_FIELD(setFlow, ALARM_DEP_FLOW_SETTING),
+    ALARM_MONITOR_FIELD(currentFlow, ALARM_DEP_AIR_FLOW),
+    ALARM_MONITOR_FIELD(currentO2Flow, ALARM_DEP_O2_FLOW),
+    ALARM_MONITOR_FIELD(currentIHPower, ALARM_DEP_IH_POWER),
+    ALARM_MONITOR_FIELD(setTargetPower, ALARM_DEP_IH_POWER),
+    ALARM_MONITOR_FIELD(currentBlowerRotationSpeed, ALARM_DEP_BLOWER),
+    ALARM_MONITOR_FIELD(currentMouthTemperature, ALARM_DEP_MOUTH_TEMPERATURE),
+    ALARM_MONITOR_FIELD(setTemperature, ALARM_DEP_TEMPERATURE_SETTING),
+    ALARM_MONITOR_FIELD(setMouthTemperature, ALARM_DEP_TEMPERATURE_SETTING),
+    ALARM_MONITOR_FIELD(currenAmbientTemperature, ALARM_DEP_AMBIENT_TEMPERATURE),
+    ALARM_MONITOR_FIELD(breathingCode, ALARM_DEP_BREATHING_CIRCUIT),
+    ALARM_MONITOR_FIELD(o2Info_struct, ALARM_DEP_O2_CONCENTRATION),
+    ALARM_MONITOR_FIELD(xAngleDirection, ALARM_DEP_POSTURE),
+    ALARM_MONITOR_FIELD(yAngleDirection, ALARM_DEP_POSTURE),
+    ALARM_MONITOR_FIELD(dateManufactureBreathingCircuit, ALARM_DEP_BREATHING_CIRCUIT),
+    ALARM_MONITOR_FIELD(dateCurrentBreathingCircuit, ALARM_DEP_BREATHING_CIRCUIT),
+    ALARM_MONITOR_FIELD(batteryInfo_struct, ALARM_DEP_POWER),
+    ALARM_MONITOR_FIELD(isACConnected, ALARM_DEP_POWER),
+    ALARM_MONITOR_FIELD(isChamberConnected, ALARM_DEP_CHAMBER),
+    ALARM_MONITOR_FIELD(spo2Info_struct, ALARM_DEP_SPO2),
+    ALARM_MONITOR_FIELD(coilTemperatureSensorTemp, ALARM_DEP_COIL_TEMPERATURE),
+    ALARM_MONITOR_FIELD(breathingCircuitTemperatureSensorTemp, ALARM_DEP_BREATHING_CIRCUIT_TEMPERATURE),
+    ALARM_MONITOR_FIELD(self_check, ALARM_DEP_SELF_CHECK),
+    ALARM_MONITOR_FIELD(log_BreathingCircuitType, ALARM_DEP_BREATHING_CIRCUIT),
+    ALARM_MONITOR_FIELD(curent_BreathingCircuitType, ALARM_DEP_BREATHING_CIRCUIT),
+    ALARM_MONITOR_FIELD(waterTankStatus, ALARM_DEP_WATER_TANK),
+    ALARM_MONITOR_FIELD(isBreathingCircuitHeaterWireBroken, ALARM_DEP_BREATHING_CIRCUIT),
+    ALARM_MONITOR_FIELD(isCradleConnected, ALARM_DEP_CRADLE),
+    ALARM_MONITOR_FIELD(isFailureBlower, ALARM_DEP_BLOWER),
+    ALARM_MONITOR_FIELD(isFailureWaterLevelSensor, ALARM_DEP_WATER_TANK),
+    ALARM_MONITOR_FIELD(isFailureExternalFlashMemory, ALARM_DEP_DEVICE_FAILURE),
+    ALARM_MONITOR_FIELD(isFailureLightSensorAlarmId, ALARM_DEP_DEVICE_FAILURE),
+    ALARM_MONITOR_FIELD(isFailureMainUnitBatteryCommunication, ALARM_DEP_MAIN_BATTERY),
+    ALARM_MONITOR_FIELD(isFailureCradleBatteryCommunication, ALARM_DEP_CRADLE),
+    ALARM_MONITOR_FIELD(isFailureMainRunOutofControl, ALARM_DEP_DEVICE_FAILURE),
+    ALARM_MONITOR_FIELD(isESP32Failed, ALARM_DEP_DEVICE_FAILURE),
+    ALARM_MONITOR_FIELD(isFailureAccelerationSensor, ALARM_DEP_DEVICE_FAILURE),
+    ALARM_MONITOR_FIELD(failureBlower, ALARM_DEP_BLOWER),
+    ALARM_MONITOR_FIELD(isFailureCradleCommunicationError, ALARM_DEP_CRADLE),
+    ALARM_MONITOR_FIELD(chamberTemperatureSensorTemp, ALARM_DEP_CHAMBER_TEMPERATURE),
+    ALARM_MONITOR_FIELD(currentSensor1Volt, ALARM_DEP_CURRENT_SENSOR),
+    ALARM_MONITOR_FIELD(currentSensor2Volt, ALARM_DEP_CURRENT_SENSOR),
+    ALARM_MONITOR_FIELD(blowerControlValue, ALARM_DEP_BLOWER),
+    ALARM_MONITOR_FIELD(breathingCircuitPowerControl, ALARM_DEP_BREATHING_CIRCUIT_TEMPERATURE),
+    ALARM_MONITOR_FIELD(machineMode, ALARM_DEP_MACHINE_MODE),
+    ALARM_MONITOR_FIELD(isIHOperating, ALARM_DEP_IH_POWER),
+    ALARM_MONITOR_FIELD(isMainUnitBatteryConnected, ALARM_DEP_MAIN_BATTERY),
+    ALARM_MONITOR_FIELD(isCradleBatteryConnected, ALARM_DEP_CRADLE),
+    ALARM_MONITOR_FIELD(isCradleBattConnected, ALARM_DEP_CRADLE),
+    ALARM_MONITOR_FIELD(batteryRemainingTimeInMin, ALARM_DEP_POWER),
+    ALARM_MONITOR_FIELD(warmingUpStatus, ALARM_DEP_MACHINE_MODE),
+    ALARM_MONITOR_FIELD(isSpeakerBrokenOrDisconnected, ALARM_DEP_DEVICE_FAILURE),
+    ALARM_MONITOR_FIELD(isBreathingCircuitConnected, ALARM_DEP_BREATHING_CIRCUIT),
+    ALARM_MONITOR_FIELD(isSpo2ModuleFailure, ALARM_DEP_SPO2),
+    ALARM_MONITOR_FIELD(isRTCModuleFailure, ALARM_DEP_DEVICE_FAILURE),
+    ALARM_MONITOR_FIELD(isLCDTouchModuleFailure, ALARM_DEP_DEVICE_FAILURE),
+    ALARM_MONITOR_FIELD(piezoControlFreq, ALARM_DEP_PIEZO),
+    ALARM_MONITOR_FIELD(piezoControlFreqUpperLimit, ALARM_DEP_PIEZO),
+};
 
 /** @brief Send the alarm message to GUI task  
  *  @param [in] E_AlarmId id : alarm id
@@ -54,6 +143,129 @@ inline bool alarmInterface_SendEvent(E_AlarmId id, E_AlarmStatus status, E_Alarm
     return rtn;
 }
 
+/** @brief Get a free change set to fill. A set still pending after
+ *  ALARM_CHANGE_SET_TIMEOUT is reused, its event was dropped by a queue reset
+ *  @param [in] None
+ *  @param [out] None
+ *  @return ALARM_CHANGE_SET_t* : free change set, NULL if all are being processed
+ */
+ALARM_CHANGE_SET_t* alarmInterface_GetFreeChangeSet(void)
+{
+    uint32_t tick = xTaskGetTickCount();
+    int i;
+    for (i = 0; i < ALARM_CHANGE_SET_SLOTS; i++)
+    {
+        ALARM_CHANGE_SET_t *set = &s_changeSet[s_changeSetNext];
+        s_changeSetNext = (s_changeSetNext + 1) % ALARM_CHANGE_SET_SLOTS;
+        if ((!set->guiPending && !set->devicePending)
+            || (tick - set->sendTick) * portTICK_PERIOD_MS > ALARM_CHANGE_SET_TIMEOUT)
+        {
+            set->guiPending = false;
+            set->devicePending = false;
+            set->count = 0;
+            return set;
+        }
+    }
+    return NULL;
+}
+
+/** @brief Send a change set to GUI task and Device task as one event
+ *  @param [in] ALARM_CHANGE_SET_t *set : change set got by alarmInterface_GetFreeChangeSet
+ *  @param [out] None
+ *  @return bool : true if event was sent successful, false is event was sent failed
+ */
+bool alarmInterface_SendChangeSet(ALARM_CHANGE_SET_t *set)
+{
+    bool rtn = true;
+    uint8_t slot = set - s_changeSet;
+    
+    set->sendTick = xTaskGetTickCount();
+    set->guiPending = true;
+    set->devicePending = true;
+    if (guiInterface_SendEvent(eGuiAlarmChangeSetEventId, slot) == false)
+    {
+        set->guiPending = false;
+        rtn = false;
+    }
+    if (alarmEvenHandlerInterface_SendEventAlarmChangeSet(slot) == false)
+    {
+        set->devicePending = false;
+        rtn = false;
+    }
+    return rtn;
+}
+
+/** @brief Get a change set from its slot, the slot is sent as event data
+ *  @param [in] uint8_t slot : slot of change set
+ *  @param [out] None
+ *  @return ALARM_CHANGE_SET_t* : change set
+ */
+ALARM_CHANGE_SET_t* alarmInterface_GetChangeSet(uint8_t slot)
+{
+    return &s_changeSet[slot % ALARM_CHANGE_SET_SLOTS];
+}
+
+/** @brief Record latency of an alarm change when it is displayed
+ *  @param [in] E_AlarmId id : alarm id
+ *  @param [in] uint32_t detectTick : tick when the change was detected
+ *  @param [out] None
+ *  @return None
+ */
+void alarmInterface_RecordLatency(E_AlarmId id, uint32_t detectTick)
+{
+    if (id >= eNoOfAlarmId)
+        return;
+    ALARM_LATENCY_t *latency = &s_alarmLatency[id];
+    latency->last = (xTaskGetTickCount() - detectTick) * portTICK_PERIOD_MS;
+    if (latency->last > latency->max)
+    {
+        latency->max = latency->last;
+    }
+    latency->total += latency->last;
+    latency->count++;
+}
+
+/** @brief Get latency counters of an alarm
+ *  @param [in] E_AlarmId id : alarm id
+ *  @param [out] ALARM_LATENCY_t *latency : latency counters
+ *  @return bool : true if id is valid
+ */
+bool alarmInterface_GetLatency(E_AlarmId id, ALARM_LATENCY_t *latency)
+{
+    if (id >= eNoOfAlarmId)
+        return false;
+    *latency = s_alarmLatency[id];
+    return true;
+}
+
+/** @brief Get groups of ALARM_MONITOR_t fields which differ between two updates.
+ *  Fields are compared as bytes, a field of a group already changed is skipped
+ *  @param [in] const ALARM_MONITOR_t *previous : previous update
+ *  @param [in] const ALARM_MONITOR_t *current : current update
+ *  @param [out] None
+ *  @return uint32_t : ALARM_DEP_xxx bits of changed groups
+ */
+uint32_t alarmInterface_GetMonitorChanges(const ALARM_MONITOR_t *previous, const ALARM_MONITOR_t *current)
+{
+    const uint8_t *prev = (const uint8_t *)previous;
+    const uint8_t *cur = (const uint8_t *)current;
+    uint32_t changes = 0;
+    int i;
+    for (i = 0; i < sizeof(s_alarmMonitorField) / sizeof(s_alarmMonitorField[0]); i++)
+    {
+        const ALARM_MONITOR_FIELD_t *field = &s_alarmMonitorField[i];
+        if ((changes & field->dep) != 0)
+        {
+            continue;
+        }
+        if (memcmp(prev + field->offset, cur + field->offset, field->size) != 0)
+        {
+            changes |= field->dep;
+        }
+    }
+    return changes;
+}
+
 /* *****************************************************************************
  End of File
  */
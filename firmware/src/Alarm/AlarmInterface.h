@@ -359,6 +359,116 @@ enum E_AlarmDataIndex{
     eResetButtonStatusDataIdx = 2,
 };
 
+/** @brief Define groups of ALARM_MONITOR_t fields an alarm checker depends on. Device
+ *  task sets the bit of a group when one of its fields changes */
+#define ALARM_DEP_SENSOR_ERROR                          (1u << 0)   /**<BME280SensorErr, ADXL345SensorErr, AirFlowSensorErr, O2FlowSensorErr */
+#define ALARM_DEP_BREATHING_CIRCUIT                     (1u << 1)   /**<type, code, dates, connection, heater wire of breathing circuit */
+#define ALARM_DEP_FLOW_SETTING                          (1u << 2)   /**<setFlow */
+#define ALARM_DEP_AIR_FLOW                              (1u << 3)   /**<currentFlow */
+#define ALARM_DEP_O2_FLOW                               (1u << 4)   /**<currentO2Flow */
+#define ALARM_DEP_IH_POWER                              (1u << 5)   /**<currentIHPower, setTargetPower, isIHOperating */
+#define ALARM_DEP_BLOWER                                (1u << 6)   /**<blower speed, control value and failure */
+#define ALARM_DEP_TEMPERATURE_SETTING                   (1u << 7)   /**<setTemperature, setMouthTemperature */
+#define ALARM_DEP_MOUTH_TEMPERATURE                     (1u << 8)   /**<currentMouthTemperature */
+#define ALARM_DEP_AMBIENT_TEMPERATURE                   (1u << 9)   /**<currenAmbientTemperature */
+#define ALARM_DEP_O2_CONCENTRATION                      (1u << 10)  /**<o2Info_struct */
+#define ALARM_DEP_POSTURE                               (1u << 11)  /**<xAngleDirection, yAngleDirection */
+#define ALARM_DEP_POWER                                 (1u << 12)  /**<batteryInfo_struct, isACConnected, batteryRemainingTimeInMin */
+#define ALARM_DEP_CHAMBER                               (1u << 13)  /**<isChamberConnected */
+#define ALARM_DEP_SPO2                                  (1u << 14)  /**<spo2Info_struct, isSpo2ModuleFailure */
+#define ALARM_DEP_COIL_TEMPERATURE                      (1u << 15)  /**<coilTemperatureSensorTemp */
+#define ALARM_DEP_BREATHING_CIRCUIT_TEMPERATURE         (1u << 16)  /**<breathingCircuitTemperatureSensorTemp, breathingCircuitPowerControl */
+#define ALARM_DEP_CHAMBER_TEMPERATURE                   (1u << 17)  /**<chamberTemperatureSensorTemp */
+#define ALARM_DEP_SELF_CHECK                            (1u << 18)  /**<self_check */
+#define ALARM_DEP_WATER_TANK                            (1u << 19)  /**<waterTankStatus, isFailureWaterLevelSensor */
+#define ALARM_DEP_CRADLE                                (1u << 20)  /**<cradle and cradle battery connection and failure */
+#define ALARM_DEP_MAIN_BATTERY                          (1u << 21)  /**<isMainUnitBatteryConnected, isFailureMainUnitBatteryCommunication */
+#define ALARM_DEP_DEVICE_FAILURE                        (1u << 22)  /**<failure flags of flash, light sensor, MCU, ESP32, accelerometer, speaker, RTC, LCD touch */
+#define ALARM_DEP_CURRENT_SENSOR                        (1u << 23)  /**<currentSensor1Volt, currentSensor2Volt */
+#define ALARM_DEP_MACHINE_MODE                          (1u << 24)  /**<machineMode, warmingUpStatus */
+#define ALARM_DEP_PIEZO                                 (1u << 25)  /**<piezoControlFreq, piezoControlFreqUpperLimit */
+/** @brief Checker keeps counters or samples over time, it is run every cycle */
+#define ALARM_DEP_EVERY_CYCLE                           (1u << 31)
+/** @brief All groups changed, used before first update */
+#define ALARM_DEP_ALL                                   (0xFFFFFFFFu)
+
+/** @brief Get groups of ALARM_MONITOR_t fields which differ between two updates
+ *  @param [in] const ALARM_MONITOR_t *previous : previous update
+ *  @param [in] const ALARM_MONITOR_t *current : current update
+ *  @param [out] None
+ *  @return uint32_t : ALARM_DEP_xxx bits of changed groups
+ */
+uint32_t alarmInterface_GetMonitorChanges(const ALARM_MONITOR_t *previous, const ALARM_MONITOR_t *current);
+
+/** @brief Define number of change set slots shared with GUI and Device task */
+#define ALARM_CHANGE_SET_SLOTS                          (4)
+
+/** @brief Define time a change set may wait for its consumers before the slot is
+ *  reused, the event to consumer is considered lost (ms) */
+#define ALARM_CHANGE_SET_TIMEOUT                        (1000)
+
+/** @brief Definition of one alarm change in a change set */
+typedef struct {
+    uint8_t id;             /**<E_AlarmId */
+    uint8_t status;         /**<E_AlarmStatus */
+    uint8_t priority;       /**<E_AlarmPriority */
+    uint8_t data[5];        /**<alarm data, same as alarmInterface_SendEvent */
+    uint32_t detectTick;    /**<tick when alarm task detected the change */
+} ALARM_CHANGE_t;
+
+/** @brief Definition of all alarm changes found in one scan of alarm list */
+typedef struct {
+    uint8_t count;                  /**<number of changes */
+    volatile bool guiPending;       /**<true until GUI task processed the set */
+    volatile bool devicePending;    /**<true until Device task processed the set */
+    uint32_t sendTick;              /**<tick when the set was sent */
+    ALARM_CHANGE_t changes[eNoOfAlarmId];
+} ALARM_CHANGE_SET_t;
+
+/** @brief Definition of latency counters of an alarm, from detection to display (ms) */
+typedef struct {
+    uint32_t count;     /**<number of changes displayed */
+    uint32_t last;      /**<latency of last change */
+    uint32_t max;       /**<max latency */
+    uint32_t total;     /**<sum of latency, average is total / count */
+} ALARM_LATENCY_t;
+
+/** @brief Get a free change set to fill
+ *  @param [in] None
+ *  @param [out] None
+ *  @return ALARM_CHANGE_SET_t* : free change set, NULL if all are being processed
+ */
+ALARM_CHANGE_SET_t* alarmInterface_GetFreeChangeSet(void);
+
+/** @brief Send a change set to GUI task and Device task as one event
+ *  @param [in] ALARM_CHANGE_SET_t *set : change set got by alarmInterface_GetFreeChangeSet
+ *  @param [out] None
+ *  @return bool : true if event was sent successful, false is event was sent failed
+ */
+bool alarmInterface_SendChangeSet(ALARM_CHANGE_SET_t *set);
+
+/** @brief Get a change set from its slot, the slot is sent as event data
+ *  @param [in] uint8_t slot : slot of change set
+ *  @param [out] None
+ *  @return ALARM_CHANGE_SET_t* : change set
+ */
+ALARM_CHANGE_SET_t* alarmInterface_GetChangeSet(uint8_t slot);
+
+/** @brief Record latency of an alarm change when it is displayed
+ *  @param [in] E_AlarmId id : alarm id
+ *  @param [in] uint32_t detectTick : tick when the change was detected
+ *  @param [out] None
+ *  @return None
+ */
+void alarmInterface_RecordLatency(E_AlarmId id, uint32_t detectTick);
+
+/** @brief Get latency counters of an alarm
+ *  @param [in] E_AlarmId id : alarm id
+ *  @param [out] ALARM_LATENCY_t *latency : latency counters
+ *  @return bool : true if id is valid
+ */
+bool alarmInterface_GetLatency(E_AlarmId id, ALARM_LATENCY_t *latency);
+
 /** @brief Send the alarm message to GUI task  
  *  @param [in] ALARM_STAT_t alarm: alarm struct
  *  @param [out] None
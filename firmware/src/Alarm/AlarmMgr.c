@@ -39,6 +39,10 @@
 #include "system_config.h"
 #include "Setting.h"
 #include "AlarmExpression.h"
+#include "Trace.h"
+#ifdef ALARM_MONITOR_TRACE
+#include <stdio.h>
+#endif
 
 
 /** @brief Counter for Alarm functions  */
@@ -104,6 +108,17 @@ static ALARM_MONITOR_t s_currentAlarmMonitor;
 /** @brief Alarm Monitors which are updated immediately. After the circle, this value is update to s_currentAlarmMonitor*/
 volatile ALARM_MONITOR_t stAlarmMonitor;
 
+/** @brief Groups of s_currentAlarmMonitor fields changed since last check of all alarms */
+static uint32_t s_alarmMonitorChanges = ALARM_DEP_ALL;
+
+/** @brief Flag is raised if inputs of an alarm changed and its checker has not run since */
+static bool s_alarmStale[eNoOfAlarmId];
+
+#ifdef ALARM_MONITOR_TRACE
+/** @brief Alarm monitor as printed by last trace, to print changed bytes only */
+static ALARM_MONITOR_t s_tracedAlarmMonitor;
+#endif
+
 ///** @brief Flag is raised if the time changing temp or flow is under 5 minutes */
 //volatile bool timeSettingChange_Flag = Flag_On;                
 
@@ -125,6 +140,7 @@ void alarmMgr_ClearAllAlarm(void)
     {
         s_alarmList[i].previousStatus = eInactive;
         s_alarmList[i].currentStatus = eInactive;
+        s_alarmStale[i] = true;
     }
     static uint32_t s_OxygenConcentrationIsHigherCounter = 0;
 static uint32_t s_OxygenConcentrationIsLowerCounter = 0;
@@ -149,6 +165,60 @@ static uint32_t s_AirFlowAbnormalCounter = 0;
     return;
 }
 
+#ifdef ALARM_MONITOR_TRACE
+/** @brief Print bytes of s_currentAlarmMonitor changed since last print, one line
+ * per run of at most ALARM_MONITOR_TRACE_RUN bytes:
+ *   am <tick> <offset> <hex bytes>
+ * A cycle without change prints "am <tick>" only, so the log keeps all cycles.
+ * Size of ALARM_MONITOR_t is printed once as "am size <bytes>"
+ *  @param [in] None
+ *  @param [out] : None
+ *  @return None
+ */
+static void alarmMgr_TraceAlarmMonitor(void)
+{
+    static bool s_sizePrinted = false;
+    const uint8_t *cur = (const uint8_t*)&s_currentAlarmMonitor;
+    uint8_t *last = (uint8_t*)&s_tracedAlarmMonitor;
+    unsigned int tick = (unsigned int)xTaskGetTickCount();
+    bool printed = false;
+    char line[32 + 2 * ALARM_MONITOR_TRACE_RUN];
+    uint32_t i = 0;
+    uint32_t j;
+    uint32_t end;
+    int pos;
+
+    if (!s_sizePrinted)
+    {
+        SYS_PRINT("\nam size %u", (unsigned int)sizeof(ALARM_MONITOR_t));
+        s_sizePrinted = true;
+    }
+    while (i < sizeof(ALARM_MONITOR_t))
+    {
+        if (cur[i] == last[i])
+        {
+            i++;
+            continue;
+        }
+        end = i + 1;
+        for (j = i + 1; j < sizeof(ALARM_MONITOR_t) && j < i + ALARM_MONITOR_TRACE_RUN; j++)
+        {
+            if (cur[j] != last[j])
+                end = j + 1;
+        }
+        pos = sprintf(line, "\nam %u %u ", tick, (unsigned int)i);
+        for (j = i; j < end; j++)
+            pos += sprintf(&line[pos], "%02x", cur[j]);
+        SYS_PRINT("%s", line);
+        memcpy(&last[i], &cur[i], end - i);
+        printed = true;
+        i = end;
+    }
+    if (!printed)
+        SYS_PRINT("\nam %u", tick);
+}
+#endif
+
 /** @brief Update current  value of all alarm monitor for device task
  *  @param [in] None
  *  @param [out] : None
@@ -161,7 +231,12 @@ void alarmMgr_UpdateAlarmMonitor(void)
 	// = stAlarmMonitor;
 	//xSemaphoreGive(s_alarmMonitorMutex);
     //}
-    DeviceTask_GetAlarmMonitorStruct(&s_currentAlarmMonitor);
+    uint32_t changes;
+    DeviceTask_GetAlarmMonitorChanges(&s_currentAlarmMonitor, &changes);
+    s_alarmMonitorChanges |= changes;
+#ifdef ALARM_MONITOR_TRACE
+    alarmMgr_TraceAlarmMonitor();
+#endif
     return;
 }
 
@@ -3921,6 +3996,7 @@ void alarmMgr_InitAlarm(void)
         s_alarmList[i].data[2] = 0;
         s_alarmList[i].data[3] = 0;
         s_alarmList[i].data[4] = 0;
+        s_alarmStale[i] = true;
 #ifdef FUNCTION_DISABLE_ALARM
         s_alarmList[i].mode = (E_AlarmOperationMode)setting_Get(i+eFirsAlarmOperationModeSettingId);
         //FIXME cannot get setting at here due to setting have not been initialized yet
@@ -4241,6 +4317,95 @@ void alarmMgr_InitAlarm(void)
     
     return;
 }
+/** @brief Groups of s_currentAlarmMonitor fields each checker depends on. A checker
+ *  which keeps counters, samples or ticks, or reads status of other alarms, is marked
+ *  ALARM_DEP_EVERY_CYCLE and runs every cycle. Other checkers only depend on these
+ *  fields and their own alarm, they run when one of the groups changed. Alarm
+ *  without entry runs every cycle */
+static const uint32_t s_alarmDependency[eNoOfAlarmId] = {
+    [eBreathingCircuitNotConnectedAlarmId] = ALARM_DEP_BREATHING_CIRCUIT | ALARM_DEP_O2_FLOW | ALARM_DEP_CHAMBER | ALARM_DEP_EVERY_CYCLE, //E001
+    [eCheckBlockageAlarmId] = ALARM_DEP_BREATHING_CIRCUIT | ALARM_DEP_FLOW_SETTING | ALARM_DEP_AIR_FLOW | ALARM_DEP_BLOWER | ALARM_DEP_POWER | ALARM_DEP_CHAMBER | ALARM_DEP_MACHINE_MODE | ALARM_DEP_EVERY_CYCLE, //E003
+    [eNonGenuineCircuitAlarmId] = ALARM_DEP_BREATHING_CIRCUIT | ALARM_DEP_O2_FLOW | ALARM_DEP_CHAMBER | ALARM_DEP_EVERY_CYCLE, //E004
+    [eBreathingCircuitChangedAlarmId] = ALARM_DEP_BREATHING_CIRCUIT | ALARM_DEP_CHAMBER | ALARM_DEP_SELF_CHECK | ALARM_DEP_MACHINE_MODE, //E005
+    [eExpiredCircuitAlarmId] = ALARM_DEP_BREATHING_CIRCUIT, //E006
+    [eCheckConnectionChamberAlarmId] = ALARM_DEP_O2_FLOW | ALARM_DEP_CHAMBER | ALARM_DEP_EVERY_CYCLE, //E007
+    [eNoMoreWaterInChamberAlarmId] = ALARM_DEP_FLOW_SETTING | ALARM_DEP_IH_POWER | ALARM_DEP_TEMPERATURE_SETTING | ALARM_DEP_MACHINE_MODE | ALARM_DEP_EVERY_CYCLE, //E008
+    [eLowTemperatureAlarmId] = ALARM_DEP_FLOW_SETTING | ALARM_DEP_O2_FLOW | ALARM_DEP_MOUTH_TEMPERATURE | ALARM_DEP_TEMPERATURE_SETTING | ALARM_DEP_AMBIENT_TEMPERATURE | ALARM_DEP_MACHINE_MODE | ALARM_DEP_EVERY_CYCLE, //E010
+    [eHighTemperatureAlarmId] = ALARM_DEP_FLOW_SETTING | ALARM_DEP_O2_FLOW | ALARM_DEP_MOUTH_TEMPERATURE | ALARM_DEP_TEMPERATURE_SETTING | ALARM_DEP_AMBIENT_TEMPERATURE | ALARM_DEP_MACHINE_MODE | ALARM_DEP_EVERY_CYCLE, //E011
+    [eHighTemperatureAbnormalityAlarmId] = ALARM_DEP_FLOW_SETTING | ALARM_DEP_O2_FLOW | ALARM_DEP_MOUTH_TEMPERATURE | ALARM_DEP_TEMPERATURE_SETTING | ALARM_DEP_AMBIENT_TEMPERATURE | ALARM_DEP_MACHINE_MODE | ALARM_DEP_EVERY_CYCLE, //E012
+    [eRoomTemperatureLowToAchieveTargetTemperatureAlarmId] = ALARM_DEP_MOUTH_TEMPERATURE | ALARM_DEP_TEMPERATURE_SETTING | ALARM_DEP_AMBIENT_TEMPERATURE | ALARM_DEP_MACHINE_MODE | ALARM_DEP_EVERY_CYCLE, //E013
+    [eCheckOperatingConditionsAlarmID] = ALARM_DEP_O2_FLOW | ALARM_DEP_TEMPERATURE_SETTING | ALARM_DEP_AMBIENT_TEMPERATURE | ALARM_DEP_MACHINE_MODE | ALARM_DEP_EVERY_CYCLE, //E014
+    [eDeviceErrorToAchieveTargetTemperatureAlarmId] = ALARM_DEP_O2_FLOW | ALARM_DEP_MOUTH_TEMPERATURE | ALARM_DEP_TEMPERATURE_SETTING | ALARM_DEP_AMBIENT_TEMPERATURE | ALARM_DEP_EVERY_CYCLE, //E015
+    [eOxygenHighAlarmId] = ALARM_DEP_O2_CONCENTRATION | ALARM_DEP_EVERY_CYCLE, //E016
+    [eOxygenLowAlarmId] = ALARM_DEP_AIR_FLOW | ALARM_DEP_O2_CONCENTRATION | ALARM_DEP_EVERY_CYCLE, //E017
+    [eDevicePostureAbnormalAlarmId] = ALARM_DEP_POSTURE | ALARM_DEP_EVERY_CYCLE, //E018-E019
+    [eSwitchToBatteryModeAlarmId] = ALARM_DEP_POWER, //E020
+    [eBatteryLowAlarmId] = ALARM_DEP_POWER, //E021
+    [eBatteryGetsRunOutAlarmId] = ALARM_DEP_POWER, //E022
+    [eStopFunctionAlarmId] = ALARM_DEP_O2_FLOW | ALARM_DEP_POWER, //E023
+    [ePowerNotEnoughAlarmId] = ALARM_DEP_POWER | ALARM_DEP_SELF_CHECK, //E024
+    [eSpO2FailedAlarmId] = ALARM_DEP_SPO2 | ALARM_DEP_EVERY_CYCLE, //E025
+    [eSpO2LowAlarmId] = ALARM_DEP_SPO2, //E026
+    [eSpO2SignalLossAlarmId] = ALARM_DEP_SPO2 | ALARM_DEP_EVERY_CYCLE, //E028
+    [eWaterSupplyCheckAlarmId] = ALARM_DEP_WATER_TANK | ALARM_DEP_CRADLE | ALARM_DEP_EVERY_CYCLE, //E030
+    [eWaterTankConnectionCheckAlarmId] = ALARM_DEP_WATER_TANK, //E031
+    [eAirFlowAbnormalAlarmId] = ALARM_DEP_FLOW_SETTING | ALARM_DEP_AIR_FLOW | ALARM_DEP_BLOWER | ALARM_DEP_MACHINE_MODE | ALARM_DEP_EVERY_CYCLE, //E032
+    [eMainUnitBatteryDisconnectedAlarmId] = ALARM_DEP_O2_FLOW | ALARM_DEP_SELF_CHECK | ALARM_DEP_CRADLE | ALARM_DEP_MAIN_BATTERY | ALARM_DEP_EVERY_CYCLE, //E033
+    [eFailureOxygenFlowMeasurementFlowSensorAlarmId] = ALARM_DEP_SENSOR_ERROR | ALARM_DEP_O2_FLOW, //E100
+    [eFailureAirFlowMeasurementFlowSensorAlarmId] = ALARM_DEP_SENSOR_ERROR | ALARM_DEP_O2_FLOW | ALARM_DEP_EVERY_CYCLE, //E101
+    [eFailureChamberTemperatureSensorAlarmId] = ALARM_DEP_CHAMBER | ALARM_DEP_CHAMBER_TEMPERATURE | ALARM_DEP_EVERY_CYCLE, //E102
+    [eFailureCoilTemperatureSendorAlarmId] = ALARM_DEP_O2_FLOW | ALARM_DEP_CHAMBER | ALARM_DEP_COIL_TEMPERATURE | ALARM_DEP_EVERY_CYCLE, //E103
+    [eFailureBreathingCircuitOutTemperatureSensorAlarmId] = ALARM_DEP_BREATHING_CIRCUIT | ALARM_DEP_O2_FLOW | ALARM_DEP_CHAMBER | ALARM_DEP_BREATHING_CIRCUIT_TEMPERATURE | ALARM_DEP_EVERY_CYCLE, //E104
+    [eFailureEnvironmentSensorAlarmId] = ALARM_DEP_SENSOR_ERROR | ALARM_DEP_O2_FLOW, //E105
+    [eFailureCurrentSensorAlarmId] = ALARM_DEP_O2_FLOW | ALARM_DEP_CURRENT_SENSOR | ALARM_DEP_EVERY_CYCLE, //E106
+    [eFailureBlowerAlarmId] = ALARM_DEP_O2_FLOW | ALARM_DEP_BLOWER | ALARM_DEP_EVERY_CYCLE, //E107
+    [eSpeakerDisconnectedAlarmId] = ALARM_DEP_DEVICE_FAILURE | ALARM_DEP_EVERY_CYCLE, //E108
+    [eFailureWaterLevelSensorAlarmId] = ALARM_DEP_WATER_TANK, //E109
+    [eFailureExternalFlashMemoryAlarmId] = ALARM_DEP_O2_FLOW | ALARM_DEP_DEVICE_FAILURE | ALARM_DEP_EVERY_CYCLE, //E110
+    [eFailureAccelerationSensorAlarmId] = ALARM_DEP_DEVICE_FAILURE | ALARM_DEP_EVERY_CYCLE, //E111
+    [eMainUnitBatteryCommunicationErrorAlarmId] = ALARM_DEP_MAIN_BATTERY | ALARM_DEP_EVERY_CYCLE, //E113
+    [eCradleBatteryCommunicationErrorAlarmId] = ALARM_DEP_POWER | ALARM_DEP_CRADLE | ALARM_DEP_EVERY_CYCLE, //E114
+    [eCradleCommunicationErrorAlarmId] = ALARM_DEP_CRADLE | ALARM_DEP_EVERY_CYCLE, //E115
+    [eMainMCUFailedOrOutOfControlAlarmId] = ALARM_DEP_DEVICE_FAILURE, //E116
+    [eESP32FailedAlarmId] = ALARM_DEP_DEVICE_FAILURE, //E117
+    [eBreathingCircuitHeaterWireBrokenAlarmId] = ALARM_DEP_BREATHING_CIRCUIT | ALARM_DEP_O2_FLOW | ALARM_DEP_BREATHING_CIRCUIT_TEMPERATURE | ALARM_DEP_MACHINE_MODE | ALARM_DEP_EVERY_CYCLE, //E118
+    [eFailureSpo2ModuleAlarmId] = ALARM_DEP_SPO2, //E119
+    [eFailureRTCModuleAlarmId] = ALARM_DEP_DEVICE_FAILURE, //E120
+    [eFailureLCDTouchModuleAlarmId] = ALARM_DEP_DEVICE_FAILURE, //E121
+    [eChamberTemperatureAbnormalAlarmId] = ALARM_DEP_COIL_TEMPERATURE | ALARM_DEP_CHAMBER_TEMPERATURE | ALARM_DEP_EVERY_CYCLE, //E124
+    [eTooMuchWaterInTheChamberAlarmId] = ALARM_DEP_IH_POWER | ALARM_DEP_PIEZO | ALARM_DEP_EVERY_CYCLE, //E125
+};
+
+/** @brief Run checker of an alarm if it is enabled and, with ALARM_DEPENDENCY_EVAL,
+ *  if its inputs changed. A checker which changed its alarm runs again in next
+ *  cycle until its alarm is stable with the same inputs
+ *  @param [in] int id : alarm id
+ *  @param [out] : None
+ *  @return None
+ */
+static void alarmMgr_RunChecker(int id)
+{
+    if ((s_alarmList[id].mode != eAlarmEnable) 
+        || (s_alarmList[id].checkAlarmFnc == NULL))
+    {
+        return;
+    }
+#if ALARM_DEPENDENCY_EVAL
+    uint32_t dep = s_alarmDependency[id];
+    ALARM_STAT_t before;
+    if ((dep != 0) && ((dep & ALARM_DEP_EVERY_CYCLE) == 0) && (s_alarmStale[id] == false))
+    {
+        return;
+    }
+    before = s_alarmList[id];
+    s_alarmList[id].checkAlarmFnc();
+    s_alarmStale[id] = (memcmp(&before, &s_alarmList[id], sizeof(ALARM_STAT_t)) != 0);
+#else
+    s_alarmList[id].checkAlarmFnc();
+#endif
+    return;
+}
+
 /** @brief Check status for all of alarm depend on operation mode
  *  @param [in] None
  *  @param [out] : None
@@ -4249,7 +4414,9 @@ void alarmMgr_InitAlarm(void)
 
 void alarmMgr_CheckAllAlarm(void)
 #define U_TEST
+#ifndef UNIT_TEST
 #undef U_TEST
+#endif
 #ifndef U_TEST
 {
 //    s_alarmList[eDeviceErrorToAchieveTargetTemperatureAlarmId].currentStatus = eActive;
@@ -4269,6 +4436,21 @@ void alarmMgr_CheckAllAlarm(void)
 #else
 {
 //    s_alarmList[eFailureLCDTouchModuleAlarmId].currentStatus = eActive;
+    int i;
+#if ALARM_DEPENDENCY_EVAL
+    //changes stay pending for checkers which do not run in this cycle
+    if (s_alarmMonitorChanges != 0)
+    {
+        for (i = eFirsAlarmId; i < eLastAlarmId; i++)
+        {
+            if ((s_alarmDependency[i] & s_alarmMonitorChanges) != 0)
+            {
+                s_alarmStale[i] = true;
+            }
+        }
+        s_alarmMonitorChanges = 0;
+    }
+#endif
     if(s_currentAlarmMonitor.self_check == true)
     {
             
@@ -4276,11 +4458,7 @@ void alarmMgr_CheckAllAlarm(void)
                                             s_currentAlarmMonitor.isACConnected,
                                             s_currentAlarmMonitor.self_check);// E024*/
         
-        if((s_alarmList[ePowerNotEnoughAlarmId].mode == eAlarmEnable) 
-            &&(s_alarmList[ePowerNotEnoughAlarmId].checkAlarmFnc != NULL))
-            {
-                s_alarmList[ePowerNotEnoughAlarmId].checkAlarmFnc();//E024
-            }
+        alarmMgr_RunChecker(ePowerNotEnoughAlarmId);//E024
     }
     else
     {           
@@ -4289,21 +4467,10 @@ void alarmMgr_CheckAllAlarm(void)
         /*alarmMgr_CheckStopFunctionAlarmStatus( s_currentAlarmMonitor.isACConnected,
                             s_currentAlarmMonitor.batteryRemainingTimeInMin);//E023*/
         
-        if((s_alarmList[eRunOutOfWaterAlarmId].mode == eAlarmEnable) 
-            &&(s_alarmList[eRunOutOfWaterAlarmId].checkAlarmFnc != NULL))
-            {
-                s_alarmList[eRunOutOfWaterAlarmId].checkAlarmFnc();//E009
-            }
-        
-        if((s_alarmList[eStopFunctionAlarmId].mode == eAlarmEnable) 
-            &&(s_alarmList[eStopFunctionAlarmId].checkAlarmFnc != NULL))
-            {
-                s_alarmList[eStopFunctionAlarmId].checkAlarmFnc();//E023
-            }
-        
+        alarmMgr_RunChecker(eRunOutOfWaterAlarmId);//E009
+        alarmMgr_RunChecker(eStopFunctionAlarmId);//E023
     }
-    int i;
-    for(i == eBreathingCircuitNotConnectedAlarmId; i < eLastAlarmId; i++ )
+    for(i = eBreathingCircuitNotConnectedAlarmId; i < eLastAlarmId; i++ )
     {
         if((i == ePowerNotEnoughAlarmId)
             ||(i == eRunOutOfWaterAlarmId)
@@ -4312,12 +4479,7 @@ void alarmMgr_CheckAllAlarm(void)
             continue;
         }
         
-        if((s_alarmList[i].mode == eAlarmEnable) 
-        &&(s_alarmList[i].checkAlarmFnc != NULL))
-        {
-            s_alarmList[i].checkAlarmFnc();
-        }
-        
+        alarmMgr_RunChecker(i);
     }
     /*alarmMgr_CheckBreathingCircuitNotConnectedAlarmStatus(s_currentAlarmMonitor.BreathingCircuitType, 
                                               s_currentAlarmMonitor.isChamberConnected);//E001
@@ -4471,39 +4633,50 @@ void alarmMgr_CheckAllAlarm(void)
 void alarmMgr_UpdateAllAlarm(void)
 {
     int i;
+    ALARM_CHANGE_SET_t *set = alarmInterface_GetFreeChangeSet();
+    uint32_t tick = xTaskGetTickCount();
+    
+    if (set == NULL)
+    {
+        //consumers are busy, changes are sent in next cycle
+        TRACE(eTraceAlarmNoChangeSetId);
+        return;
+    }
+    
+    //collect all status and priority changes in one scan
     for (i = eFirsAlarmId; i < eLastAlarmId; i++)
     {
-        if (s_alarmList[i].previousStatus != s_alarmList[i].currentStatus)
+        if ((s_alarmList[i].previousStatus != s_alarmList[i].currentStatus)
+            || (s_alarmList[i].previousPriority != s_alarmList[i].currentPriority))
         {
-            if (alarmInterface_SendEvent(s_alarmList[i].ID, s_alarmList[i].currentStatus, s_alarmList[i].currentPriority, s_alarmList[i].data))
-            {
-                s_alarmList[i].previousStatus = s_alarmList[i].currentStatus;
-            }
-            else
-            {
-                SYS_PRINT("\n\nCan not send event");
-            }
-            //SYS_PRINT("\nAlarm change: [%d] -- Alarm Test: [%d] -- current state: [%d]", i, eBreathingCircuitNotConnectedAlarmId, s_alarmList[i].currentStatus);
-            SYS_PRINT("\nAlarm change: [%d] -- current state: [%d]\n", i, /*eBreathingCircuitNotConnectedAlarmId,*/ s_alarmList[i].currentStatus);
-            //SYS_PRINT("\nDraft");
-            return;
+            ALARM_CHANGE_t *change = &set->changes[set->count++];
+            change->id = s_alarmList[i].ID;
+            change->status = s_alarmList[i].currentStatus;
+            change->priority = s_alarmList[i].currentPriority;
+            memcpy(change->data, s_alarmList[i].data, sizeof(change->data));
+            change->detectTick = tick;
+            TRACE(eTraceAlarmChangeId, i, s_alarmList[i].currentStatus, s_alarmList[i].currentPriority);
         }
-        
-        if (s_alarmList[i].previousPriority != s_alarmList[i].currentPriority)
+    }
+    
+    if (set->count == 0)
+    {
+        return;
+    }
+    
+    if (alarmInterface_SendChangeSet(set))
+    {
+        for (i = 0; i < set->count; i++)
         {
-            if (alarmInterface_SendEvent(s_alarmList[i].ID, s_alarmList[i].currentStatus, s_alarmList[i].currentPriority, s_alarmList[i].data))
-            {
-                s_alarmList[i].previousPriority = s_alarmList[i].currentPriority;
-                SYS_PRINT("\nPriority Change: [%d] -- [%d] -- [%d]\n\n\n",i, s_alarmList[i].previousPriority, eOxygenHighAlarmId);
-            }
-            else
-            {
-                SYS_PRINT("\n\nCan not send event");
-            }
-            return;
+            E_AlarmId id = (E_AlarmId)set->changes[i].id;
+            s_alarmList[id].previousStatus = (E_AlarmStatus)set->changes[i].status;
+            s_alarmList[id].previousPriority = (E_AlarmPriority)set->changes[i].priority;
         }
     }
-//    SYS_PRINT("\nE008 current is : [%d]", s_alarmList[eCheckConnectionChamberAlarmId].currentStatus);
+    else
+    {
+        TRACE(eTraceAlarmSendFailedId);
+    }
     return;
 }
 
@@ -48,6 +48,15 @@
 #define EVT_TEMP_NUM_SAMPLE_IN_1SECOND                                                  (1000/50)
 #define CHAMBER_OUT_TEMP_NUM_SAMPLE_IN_10SECOND                                         (10000/50)
 #define IH_POWER_NUM_SAMPLE_IN_1MINS                                                    (1 * 60)
+/** @brief Define 1 to run only checkers whose inputs changed, 0 to run all checkers every cycle */
+#ifndef ALARM_DEPENDENCY_EVAL
+#define ALARM_DEPENDENCY_EVAL                                                           1
+#endif
+/** @brief Define to print alarm monitor of every cycle to console, the log can be
+ * replayed on host by tools/AlarmReplay */
+//#define ALARM_MONITOR_TRACE
+/** @brief Define max number of bytes in one line of alarm monitor trace */
+#define ALARM_MONITOR_TRACE_RUN                                                         32
 //Initial Alarm
 void alarmMgr_InitAlarm(void);
 
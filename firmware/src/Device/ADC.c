@@ -2,8 +2,8 @@
 /** @file [ADC.c]
  *  @brief {set up ADC module 7 to scan multiple channels, register channel AN14,
  * AN16, AN18, AN20, AN21, AN39 to ADC7. 
- * Set up interrupt for ADC conversion complete and automatically post conversion 
- * result to ADC queue. 
+ * Set up interrupt for ADC conversion complete and accumulate conversion 
+ * result (sum, count, min, max) of each channel in double buffered banks. 
  * Support interface to get value of each ADC channel, protect share resource by 
  * MUTEX }
  *  @author {bui phuoc}
@@ -19,11 +19,11 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include <math.h>
 
 #include "FreeRTOS.h"
 #include "task.h"
-#include "queue.h"
 #include "semphr.h"
 #include "portmacro.h"
 
@@ -33,71 +33,97 @@
 #include "ADC.h"
 
 
-/** @brief size of buffer that store ADC samples data sent from ADC interrupt */
-#define     ADC_DATA_QUEUE_SIZE       (200)
-
 /** @brief maximum time in MS a task can wait to get/set ADC data */
 #define     ADC_MUTEX_MAX_WAIT_MS       (20)
 
-/** @brief structure of an ADC data send from ADC interrupt, include channel
- * ID and channel data */
+/** @brief number of accumulator banks, ADC interrupt fills one bank while
+ * ADC_HandleData reads the other one */
+#define     ADC_NUMBER_OF_BANK          (2)
+
+/** @brief List of channels scanned by ADC7, index of accumulators */
+typedef enum {
+    eADCCurrentSensor1Slot,
+    eADCCurrentSensor2Slot,
+    eADCLightSensorSlot,
+    eADCVoltIHSensorSlot,
+    eADCVoltNiMhMonitorSlot,
+    eADCVoltInputMonitorSlot,
+    eADCNumberOfSlot
+} E_ADCSlot;
+
+/** @brief samples of a channel accumulated by ADC interrupt */
 typedef struct {
-    uint8_t channel; /**< analog channel id */
-    uint16_t data; /**< data of corresponding channel */
-} ADC_DATA_ITEM_t;
+    uint32_t sum; /**< sum of samples */
+    uint16_t count; /**< number of samples */
+    uint16_t min; /**< min of samples */
+    uint16_t max; /**< max of samples */
+} ADC_ACCUMULATOR_t;
+
+/** @brief accumulators of all channels, double buffered. Only ADC interrupt
+ * writes the active bank, only ADC_HandleData reads and clears the other one */
+static ADC_ACCUMULATOR_t s_ADCAccumulator[ADC_NUMBER_OF_BANK][eADCNumberOfSlot];
 
-/** @brief a queue to store ADC samples data sent from ADC interrupt */
-static QueueHandle_t s_ADCDataQueue = NULL;
+/** @brief index of bank filled by ADC interrupt */
+static volatile uint8_t s_ADCActiveBank = 0;
 
 /** @brief MUTEX to protect accessing ADC set of values */
 static SemaphoreHandle_t s_ADCMutex = NULL;
 
-/** @brief variables to hold latest ADC value of current sensor # 1,  any task 
- can access this value at anytime */
-static float s_CurrentSensor1;
-
-/** @brief variables to hold latest ADC value of current sensor # 2,  any task 
- can access this value at anytime */
-static float s_CurrentSensor2;
-
-/** @brief variables to hold latest ADC value of light sensor,  any task 
- can access this value at anytime */
-static float s_LightSensor;
-
-/** @brief variables to hold latest ADC value of temperature sensor # 1,  any task 
- can access this value at anytime */
-static float s_TemperaturSensor1;
-
-/** @brief variables to hold latest ADC value of temperature sensor # 2,  any task 
- can access this value at anytime */
-static float s_TemperaturSensor2;
-
-/** @brief variables to hold latest ADC value of temperature sensor # 3,  any task 
- can access this value at anytime */
-static float s_TemperaturSensor3;
-
-/** @brief variables to hold latest ADC value of voltage sensor ,  any task 
- can access this value at anytime */
-static float s_VoltageSensor;
-
-/** @brief variables to hold latest ADC value of NiMh battery ,  any task 
- can access this value at anytime */
-static float s_VoltageNiMh;
-
-/** @brief variables to hold latest ADC value of voltage input ,  any task 
- can access this value at anytime */
-static float s_VoltageInput;
+/** @brief latest average (in count) of each channel, any task can access
+ * these values at anytime */
+static float s_ADCAverage[eADCNumberOfSlot];
 
+/** @brief latest window (count, min, max) of each channel */
+static ADC_WINDOW_t s_ADCWindow[eADCNumberOfSlot];
 
 
 /** @brief internal functions declaration */
 void ADC_ReportError();
 
+/** @brief clear accumulators of a bank
+ *  @param [in]  uint8_t bank index of bank
+ *  @param [out]  None
+ *  @return None
+ */
+static void ADC_ClearBank(uint8_t bank) {
+    uint8_t i;
+    for (i = 0; i < eADCNumberOfSlot; i++) {
+        s_ADCAccumulator[bank][i].sum = 0;
+        s_ADCAccumulator[bank][i].count = 0;
+        s_ADCAccumulator[bank][i].min = UINT16_MAX;
+        s_ADCAccumulator[bank][i].max = 0;
+    }
+}
+
+/** @brief get accumulator slot of an analog channel
+ *  @param [in]  uint8_t channelID analog channel ID
+ *  @param [out]  None
+ *  @return E_ADCSlot slot of channel, eADCNumberOfSlot if channel is not scanned
+ */
+static inline E_ADCSlot ADC_GetSlot(uint8_t channelID) {
+    switch (channelID) {
+        case ADC_CURRENT_SENSOR_1:
+            return eADCCurrentSensor1Slot;
+        case ADC_CURRENT_SENSOR_2:
+            return eADCCurrentSensor2Slot;
+        case ADC_LIGHT_SENSOR:
+            return eADCLightSensorSlot;
+        case ADC_VOLT_IH_SENSOR:
+            return eADCVoltIHSensorSlot;
+        case ADC_VOLT_NIMH_MONITOR:
+            return eADCVoltNiMhMonitorSlot;
+        case ADC_VOLT_INPUT_MONITOR:
+            return eADCVoltInputMonitorSlot;
+        default:
+            return eADCNumberOfSlot;
+    }
+}
+
 /** @brief Function to initialize ADC7 module (module scan for multiple channels)
  * responsible to scan all ADC channels in the project. The ADC module is setting 
  * up to be triggered by TIMER 5 every 5 ms, automatically interrupt when ADC conversion
- * is finished. Interrupt ISR function will send and event to s_ADCDataQueue to 
- * update value for each channel ADC. A MUTEX is also created to protect multiple
+ * is finished. Interrupt ISR function accumulates samples of each channel to
+ * s_ADCAccumulator. A MUTEX is also created to protect multiple
  * task access to ADC channels value.
  * This function should be called 1 time at start up
  *  @param [in]  None   
@@ -108,22 +134,17 @@ void ADC_Initialize ( ) {
     //prepare for ADC7 (ADC number 0)
     DRV_ADC0_Open();
 
-    //Create a queue capable of containing 64 item of ADC_DATA_ITEM_t structures.  
-    s_ADCDataQueue = xQueueCreate(ADC_DATA_QUEUE_SIZE, sizeof ( ADC_DATA_ITEM_t));
-    if (s_ADCDataQueue == NULL) {
-        //Queue was not created and must not be used.
+    s_ADCMutex = xSemaphoreCreateMutex();
+    if (s_ADCMutex == NULL) {
         ADC_ReportError();
     }
 
-    s_ADCMutex = xSemaphoreCreateMutex();
-
-    //reset values
-    s_CurrentSensor1 = 0;
-    s_CurrentSensor2 = 0;
-    s_LightSensor = 0;
-    s_VoltageSensor = 0;
-    s_VoltageNiMh = 0;
-    s_VoltageInput = 0;
+    //reset values, conversion is not started yet
+    s_ADCActiveBank = 0;
+    ADC_ClearBank(0);
+    ADC_ClearBank(1);
+    memset(s_ADCAverage, 0, sizeof (s_ADCAverage));
+    memset(s_ADCWindow, 0, sizeof (s_ADCWindow));
 }
 
 /** @brief start ADC conversion by starting TIMER 5, the timer trigger for ADC 7
@@ -150,121 +171,83 @@ void ADC_Stop ( ) {
 }
 
 
-/** @brief update ADC value of each channel. Each packet data has channel ID and
- * its data corresponding
+/** @brief update ADC value of each channel. The sample is added to sum,
+ * count, min and max of its channel in the active bank, no RTOS call is done
  * This function is call from ADC interrupt every time a channel is finished conversion 
  *  @param [in]  uint8_t channelID analog channel ID, can be:
  * - ADC_CURRENT_SENSOR_1
  * - ADC_CURRENT_SENSOR_2
  * - ADC_LIGHT_SENSOR
- * - ADC_TEMPERATURE_SENSOR_1
- * - ADC_TEMPERATURE_SENSOR_2
- * - ADC_TEMPERATURE_SENSOR_3
+ * - ADC_VOLT_IH_SENSOR
+ * - ADC_VOLT_NIMH_MONITOR
+ * - ADC_VOLT_INPUT_MONITOR
  * 
  *                 uint16_t channelData raw data (12 bit) after ADC conversion
  *  @param [out]  None
  *  @return None
- *  @retval true ADC data is posted successful to queue
- *  @retval false ADC data is posted to queue failed
+ *  @retval true ADC data is accumulated
+ *  @retval false channel is not scanned or its accumulator is full
  */
 inline bool ADC_UpdateData(uint8_t channelID, uint16_t channelData) {
+    E_ADCSlot slot = ADC_GetSlot(channelID);
+    ADC_ACCUMULATOR_t *acc;
 
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-
-    ADC_DATA_ITEM_t data;
-    data.channel = channelID;
-    data.data = channelData;
+    if (slot >= eADCNumberOfSlot) {
+        return false;
+    }
 
-    if (xQueueSendToBackFromISR(s_ADCDataQueue, &data, &xHigherPriorityTaskWoken) != pdPASS) {
-        xQueueReset(s_ADCDataQueue);
+    acc = &s_ADCAccumulator[s_ADCActiveBank][slot];
+    //keep the samples already taken if consumer is stopped for a long time
+    if (acc->count == UINT16_MAX) {
         return false;
     }
+    acc->sum += channelData;
+    acc->count++;
+    if (channelData < acc->min) {
+        acc->min = channelData;
+    }
+    if (channelData > acc->max) {
+        acc->max = channelData;
+    }
 
     return true;
 }
 
-/** @brief handle ADC data from ADC queue. each ADC channel value is automatically
- * updated to ADC queue after its conversion if done.
- * This operation get average of each ADC channel, then bypass them to a low pass
- * filter to reduce noise. The output of the low pass filter is used to calculate/
- * display by any tasks
+/** @brief handle ADC data accumulated by ADC interrupt. Accumulator banks are
+ * swapped, then average, min and max of each channel are taken from the bank
+ * filled since previous call. No sample is lost between 2 calls, each average
+ * covers exactly the samples converted in this period
  *  @param [in]  None   
  *  @param [out]  None
  *  @return None
  */
 void ADC_HandleData() {
-    uint8_t countCurr1 = 0;
-    uint8_t countCurr2 = 0;
-    uint8_t countLight = 0;
-    uint8_t countVolt = 0;
-    uint8_t countVoltNiMh = 0;
-    uint8_t countVoltInput = 0;
-
-    uint32_t sumCurr1 = 0;
-    uint32_t sumCurr2 = 0;
-    uint32_t sumLight = 0;
-    uint32_t sumVolt = 0;
-    uint32_t sumVoltNiMh = 0;
-    uint32_t sumVoltInput = 0;
-
-    ADC_DATA_ITEM_t dataEvent;
-    while (xQueueReceive(s_ADCDataQueue, &dataEvent, 0) == pdTRUE) {
-        uint8_t sensorID = dataEvent.channel;
-        uint16_t sensorData = dataEvent.data;
-
-        switch (sensorID) {
-            case ADC_CURRENT_SENSOR_1:
-                sumCurr1 += sensorData;
-                countCurr1++;
-                break;
-            case ADC_CURRENT_SENSOR_2:
-                sumCurr2 += sensorData;
-                countCurr2++;
-                break;
-            case ADC_LIGHT_SENSOR:
-                sumLight += sensorData;
-                countLight++;
-                break;
-            case ADC_VOLT_IH_SENSOR:
-                sumVolt += sensorData;
-                countVolt++;
-                break;
-            case ADC_VOLT_NIMH_MONITOR:
-                sumVoltNiMh += sensorData;
-                countVoltNiMh++;
-                break;
-            case ADC_VOLT_INPUT_MONITOR:
-                sumVoltInput += sensorData;
-                countVoltInput++;
-                break;               
-            default:
-                break;
-        }
-    }
+    ADC_ACCUMULATOR_t acc[eADCNumberOfSlot];
+    uint8_t bank;
+    uint8_t i;
+
+    //ADC interrupt is masked, the bank is not being filled when swapped
+    taskENTER_CRITICAL();
+    bank = s_ADCActiveBank;
+    s_ADCActiveBank = bank ^ 1;
+    taskEXIT_CRITICAL();
+
+    memcpy(acc, s_ADCAccumulator[bank], sizeof (acc));
+    ADC_ClearBank(bank);
 
     //calculate average output
     if (xSemaphoreTake(s_ADCMutex, ADC_MUTEX_MAX_WAIT_MS) == pdTRUE) {
-        if (countCurr1 != 0) {
-            s_CurrentSensor1 = (float) sumCurr1 / (float) countCurr1;
-        }
-        if (countCurr2 != 0) {
-            s_CurrentSensor2 = (float) sumCurr2 / (float) countCurr2;
+        for (i = 0; i < eADCNumberOfSlot; i++) {
+            //keep previous value if no conversion in this period
+            if (acc[i].count != 0) {
+                s_ADCAverage[i] = (float) acc[i].sum / (float) acc[i].count;
+                s_ADCWindow[i].count = acc[i].count;
+                s_ADCWindow[i].min = acc[i].min;
+                s_ADCWindow[i].max = acc[i].max;
+                s_ADCWindow[i].average = s_ADCAverage[i];
+            }
         }
-        if (countLight != 0) {
-            s_LightSensor = (float) sumLight / (float) countLight;
-        }
-        if (countVolt != 0) {
-            s_VoltageSensor = (float) sumVolt / (float) countVolt;
-        }
-        if (countVoltNiMh != 0) {
-            s_VoltageNiMh = (float) sumVoltNiMh / (float) countVoltNiMh;
-        }
-        if (countVoltInput != 0) {
-            s_VoltageInput= (float) sumVoltInput / (float) countVoltInput;
-        }
-      
         xSemaphoreGive(s_ADCMutex);
-        //SYS_PRINT("%d, %d, %d, %d, %d, %d\n", countCurr1, countCurr2, countVolt, countLight, countVoltNiMh, countVoltInput);
     }
 
 }
@@ -290,27 +273,9 @@ bool ADC_GetCount(uint8_t channelID, float* channelCount) {
     }
 
     float sensorCount = 0;
-    switch (channelID) {
-        case ADC_CURRENT_SENSOR_1:
-            sensorCount = s_CurrentSensor1;
-            break;
-        case ADC_CURRENT_SENSOR_2:
-            sensorCount = s_CurrentSensor2;
-            break;
-        case ADC_LIGHT_SENSOR:
-            sensorCount = s_LightSensor;
-            break;
-        case ADC_VOLT_IH_SENSOR:
-            sensorCount = s_VoltageSensor;
-            break;
-        case ADC_VOLT_NIMH_MONITOR:
-            sensorCount = s_VoltageNiMh;
-            break;
-        case ADC_VOLT_INPUT_MONITOR:
-            sensorCount = s_VoltageInput;
-            break;          
-        default:
-            break;
+    E_ADCSlot slot = ADC_GetSlot(channelID);
+    if (slot < eADCNumberOfSlot) {
+        sensorCount = s_ADCAverage[slot];
     }
     *channelCount = sensorCount;
     xSemaphoreGive(s_ADCMutex);
@@ -339,28 +304,9 @@ bool ADC_GetVoltage(uint8_t channelID, float* channelVoltage) {
     }
 
     float sensorCount = 0;
-    switch (channelID) {
-        case ADC_CURRENT_SENSOR_1:
-            sensorCount = s_CurrentSensor1;
-            break;
-        case ADC_CURRENT_SENSOR_2:
-            sensorCount = s_CurrentSensor2;
-            break;
-        case ADC_LIGHT_SENSOR:
-            sensorCount = s_LightSensor;
-            break;
-        case ADC_VOLT_IH_SENSOR:
-            sensorCount = s_VoltageSensor;
-            break; 
-        case ADC_VOLT_NIMH_MONITOR:
-            sensorCount = s_VoltageNiMh;
-            break;
-        case ADC_VOLT_INPUT_MONITOR:
-            sensorCount = s_VoltageInput;
-            break;
-
-        default:
-            break;
+    E_ADCSlot slot = ADC_GetSlot(channelID);
+    if (slot < eADCNumberOfSlot) {
+        sensorCount = s_ADCAverage[slot];
     }
     
     *channelVoltage = sensorCount / 4096.0 * 3.3; //(12bit ADC, 3.3V voltage supply)
@@ -369,6 +315,28 @@ bool ADC_GetVoltage(uint8_t channelID, float* channelVoltage) {
 }
 
 
+/** @brief get count, min, max and average (in count) of indicated channel
+ * over the latest period handled by ADC_HandleData
+ *  @param [in]  uint8_t channelID analog channel ID, see ADC_GetCount
+ *  @param [out]  ADC_WINDOW_t* window storage of window
+ *  @return None
+ *  @retval true getting data successful
+ *  @retval false channel is not scanned or getting data failed
+ */
+bool ADC_GetWindow(uint8_t channelID, ADC_WINDOW_t* window) {
+    E_ADCSlot slot = ADC_GetSlot(channelID);
+    if (slot >= eADCNumberOfSlot) {
+        return false;
+    }
+    if (xSemaphoreTake(s_ADCMutex, ADC_MUTEX_MAX_WAIT_MS) == pdFALSE) {
+        return false;
+    }
+    *window = s_ADCWindow[slot];
+    xSemaphoreGive(s_ADCMutex);
+    return true;
+}
+
+
 /** @brief report error if occur in ADC 7 module, may be send event
  * to Alarm task
  *  @param [in]  None 
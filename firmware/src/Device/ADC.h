@@ -2,8 +2,8 @@
 /** @file [ADC.h]
  *  @brief {set up ADC module 7 to scan multiple channels, register channel AN14,
  * AN16, AN18, AN20, AN21, AN39 to ADC7. 
- * Set up interrupt for ADC conversion complete and automatically post conversion 
- * result to ADC queue. 
+ * Set up interrupt for ADC conversion complete and accumulate conversion 
+ * result (sum, count, min, max) of each channel in double buffered banks. 
  * Support interface to get value of each ADC channel, protect share resource by 
  * MUTEX }
  *  @author {bui phuoc}
@@ -55,12 +55,19 @@ extern "C" {
     /** @brief ADC channel connect with input voltage (AN24) */
 #define ADC_VOLT_INPUT_MONITOR   24
     
+    /** @brief samples of a channel over the latest period handled by ADC_HandleData */
+    typedef struct {
+        uint16_t count; /**< number of samples */
+        uint16_t min; /**< min of samples (in count) */
+        uint16_t max; /**< max of samples (in count) */
+        float average; /**< average of samples (in count) */
+    } ADC_WINDOW_t;
 
     /** @brief Function to initialize ADC7 module (module scan for multiple channels)
      * responsible to scan all ADC channels in the project. The ADC module is setting 
      * up to be triggered by TIMER 5 every 5 ms, automatically interrupt when ADC conversion
-     * is finished. Interrupt ISR function will send and event to s_ADCDataQueue to 
-     * update value for each channel ADC. A MUTEX is also created to protect multiple
+     * is finished. Interrupt ISR function accumulates samples of each channel to
+     * s_ADCAccumulator. A MUTEX is also created to protect multiple
      * task access to ADC channels value.
      * This function should be called 1 time at start up
      *  @param [in]  None   
@@ -81,30 +88,29 @@ extern "C" {
     
     void ADC_Stop();
 
-    /** @brief update ADC value of each channel. Each packet data has channel ID and
-     * its data corresponding
+    /** @brief update ADC value of each channel. The sample is added to sum,
+     * count, min and max of its channel in the active bank, no RTOS call is done
      * This function is call from ADC interrupt every time a channel is finished conversion 
      *  @param [in]  uint8_t channelID analog channel ID, can be:
      * - ADC_CURRENT_SENSOR_1
      * - ADC_CURRENT_SENSOR_2
      * - ADC_LIGHT_SENSOR
-     * - ADC_TEMPERATURE_SENSOR_1
-     * - ADC_TEMPERATURE_SENSOR_2
-     * - ADC_TEMPERATURE_SENSOR_3
+     * - ADC_VOLT_IH_SENSOR
+     * - ADC_VOLT_NIMH_MONITOR
+     * - ADC_VOLT_INPUT_MONITOR
      * 
      *                 uint16_t channelData raw data (12 bit) after ADC conversion
      *  @param [out]  None
      *  @return None
-     *  @retval true ADC data is posted successful to queue
-     *  @retval false ADC data is posted to queue failed
+     *  @retval true ADC data is accumulated
+     *  @retval false channel is not scanned or its accumulator is full
      */
     inline bool ADC_UpdateData(uint8_t channelID, uint16_t channelData);
 
-    /** @brief handle ADC data from ADC queue. each ADC channel value is automatically
-     * updated to ADC queue after its conversion if done.
-     * This operation get average of each ADC channel, then bypass them to a low pass
-     * filter to reduce noise. The output of the low pass filter is used to calculate/
-     * display by any tasks
+    /** @brief handle ADC data accumulated by ADC interrupt. Accumulator banks are
+     * swapped, then average, min and max of each channel are taken from the bank
+     * filled since previous call. No sample is lost between 2 calls, each average
+     * covers exactly the samples converted in this period
      *  @param [in]  None   
      *  @param [out]  None
      *  @return None
@@ -147,6 +153,16 @@ extern "C" {
     bool ADC_GetVoltage(uint8_t channelID, float* channelVoltage);
 
 
+    /** @brief get count, min, max and average (in count) of indicated channel
+     * over the latest period handled by ADC_HandleData
+     *  @param [in]  uint8_t channelID analog channel ID, see ADC_GetCount
+     *  @param [out]  ADC_WINDOW_t* window storage of window
+     *  @return None
+     *  @retval true getting data successful
+     *  @retval false channel is not scanned or getting data failed
+     */
+    bool ADC_GetWindow(uint8_t channelID, ADC_WINDOW_t* window);
+
     /* Provide C++ Compatibility */
 #ifdef __cplusplus
 }
@@ -42,6 +42,25 @@ inline bool alarmEvenHandlerInterface_SendEventAlarm(uint8_t alarmId, uint8_t st
     return rtn;
 }
 
+/** @brief This operation send alarm change set event to alarmEventQueue to communicate with DEVICE task
+ *  @param [in] uint8_t slot: slot of change set, see alarmInterface_GetChangeSet
+ *  @param [out] None
+ *  @return bool : true if event was sent successful, false is event was sent failed
+ */
+bool alarmEvenHandlerInterface_SendEventAlarmChangeSet(uint8_t slot) {
+    //event to send
+    DEVICE_TASK_ALARM_EVENT_t event;
+    event.id = eNoOfAlarmId;
+    event.status = eInactive;
+    memset(event.data, 0, 5);
+    event.data[0] = slot;
+    //send event, do not reset the queue: events of pending change sets are in it
+    if (xQueueSendToBack(g_alarmEventQueue, &event, 2) != pdPASS) {
+        return false;
+    }
+    return true;
+}
+
 static bool alarmEvenHandler_CheckStartCondition()
 {
     if(gs_AlarmStatus[eBreathingCircuitNotConnectedAlarmId] == eActive)//E001
@@ -195,67 +214,62 @@ static void alarmEvenHandler_HandleBreathingCircuitChangedAlarm(E_AlarmStatus st
 }
 
 
-/** @brief This operation check alarm event from alarm event queue and process them
- *  @param [in] None
+/** @brief This operation process one alarm event
+ *  @param [in] DEVICE_TASK_ALARM_EVENT_t event: alarm event
  *  @param [out] None
  *  @return None
  */
-void alarmEvenHandler_HandleEvent(void)
+static void alarmEvenHandler_ProcessEvent(DEVICE_TASK_ALARM_EVENT_t event)
 {
-    DEVICE_TASK_ALARM_EVENT_t event;
-    //wait for queue event
-    if (xQueueReceive(g_alarmEventQueue, &event, 0) == pdTRUE) //wait 0 tick (do not wait)
+    gs_AlarmStatus[event.id] = event.status;
+    
+    switch (event.id)
     {
-      
-        gs_AlarmStatus[event.id] = event.status;
-        
-        switch (event.id)
-        {
-        //Respiratory circuit abnormality 
-        case eBreathingCircuitNotConnectedAlarmId://E001
+    //Respiratory circuit abnormality 
+    case eBreathingCircuitNotConnectedAlarmId://E001
+    {
+        alarmEvenHandler_HandleBreathingCircuitNotConnectedAlarm(event.status);  
+        break;
+    }
+    
+    case eCheckLeakAlarmId://E002
+    {  
+        //do nothing
+        break;
+    }
+    
+    case eCheckBlockageAlarmId://E003
+    {  
+        //do nothing
+        break;
+    }
+   
+    case eNonGenuineCircuitAlarmId://E004
+    {  
+        /*
+        ?If it occurs at startup
+            Do not turn on IH, water pump, blower, tube heater
+        ? If this occurs when the device is operating 
+            Turn off IH, water pump, blower and tube heater
+       */
+        waterSupplyCtrl_TurnOffAndDisablePump();
+        MotorTask_DisableMotor();
+        if(event.status == eActive)
         {
-            alarmEvenHandler_HandleBreathingCircuitNotConnectedAlarm(event.status);  
-            break;
-        }
-        
-        case eCheckLeakAlarmId://E002
-        {  
-            //do nothing
-            break;
-        }
-        
-        case eCheckBlockageAlarmId://E003
-        {  
-            //do nothing
-            break;
-        }
-       
-        case eNonGenuineCircuitAlarmId://E004
-        {  
-            /*
-            ?If it occurs at startup
-                Do not turn on IH, water pump, blower, tube heater
-            ? If this occurs when the device is operating 
-                Turn off IH, water pump, blower and tube heater
-           */
-            waterSupplyCtrl_TurnOffAndDisablePump();
-            MotorTask_DisableMotor();
-            if(event.status == eActive)
-            {
-                HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
-                HeaterTask_SendEvent(hEvent);
+            HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
+            HeaterTask_SendEvent(hEvent);
 
-                MOTOR_CTRL_EVENT_t mEvent = {.id = eMotorStopId, .iData = 0};
-                MotorTask_SendEvent(mEvent);
-            }
-            break;
-        }
-        
-        case eBreathingCircuitChangedAlarmId://E005
-        {  
-            alarmEvenHandler_HandleBreathingCircuitChangedAlarm(event.status);
-            break;
+            MOTOR_CTRL_EVENT_t mEvent = {.id = eMotorStopId, .iData = 0};
+            MotorTask_SendEvent(mEvent);
         }
+        break;
+    }
+    
+    case eBreathingCircuitChangedAlarmId://E005
+    {  
+        alarmEvenHandler_HandleBreathingCircuitChangedAlarm(event.status);
+        break;
+    }
 //        
 //        case eExpiredCircuitAlarmId://E006
 //        {  
@@ -263,30 +277,30 @@ void alarmEvenHandler_HandleEvent(void)
 //            //do nothing
 //            break;
 //        }
-        
-        //Chamber abnormality
-        case eCheckConnectionChamberAlarmId://E007
-        {  
-            /*
-            ?If it occurs at startup
-                Do not turn on IH, water pump, blower, tube heater
-            ? If this occurs when the device is operating 
-                Turn off IH, water pump, blower and tube heater
-           */
-            waterSupplyCtrl_TurnOffAndDisablePump();
-            MotorTask_DisableMotor();
-            if(event.status == eActive)
-            {
-                HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
-                HeaterTask_SendEvent(hEvent);
+    
+    //Chamber abnormality
+    case eCheckConnectionChamberAlarmId://E007
+    {  
+        /*
+        ?If it occurs at startup
+            Do not turn on IH, water pump, blower, tube heater
+        ? If this occurs when the device is operating 
+            Turn off IH, water pump, blower and tube heater
+       */
+        waterSupplyCtrl_TurnOffAndDisablePump();
+        MotorTask_DisableMotor();
+        if(event.status == eActive)
+        {
+            HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
+            HeaterTask_SendEvent(hEvent);
 
-                MOTOR_CTRL_EVENT_t mEvent = {.id = eMotorStopId, .iData = 0};
-                MotorTask_SendEvent(mEvent);
-            }
-            
-            break;
+            MOTOR_CTRL_EVENT_t mEvent = {.id = eMotorStopId, .iData = 0};
+            MotorTask_SendEvent(mEvent);
         }
         
+        break;
+    }
+    
 //        case eNoMoreWaterInChamberAlarmId://E008
 //        {  
 //            //Continue operating normally
@@ -300,181 +314,214 @@ void alarmEvenHandler_HandleEvent(void)
 //            break;
 //        }
 //        
-        //temperature abnormality
-        case eLowTemperatureAlarmId://E010
-        {  
-            //if environmentTemp > 18.0
-            if(event.data[eMessageTypeDataIdx] == eE010AmbientTempEqualOrOverThan18CelsiusDegree)
-            {
-                HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
-                HeaterTask_SendEvent(hEvent);
-
-                MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
-                MotorTask_SendEvent(event);
-                
-                waterSupplyCtrl_TurnOffAndDisablePump();
-            }
-            //Continue operating normally if environment temperature < 18 C (it is not error)
-            break;
-        }
-        case eHighTemperatureAlarmId://E011
-        {  
-            //if(environmentTemp < setTemp)
-            if(event.data[eMessageTypeDataIdx] == eE011AmbientTempLowerThanSettingTemp)
-            {
-                HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
-                HeaterTask_SendEvent(hEvent);
-
-                MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
-                MotorTask_SendEvent(event);
-                
-                waterSupplyCtrl_TurnOffAndDisablePump();
-            }
-            //Continue operating normally if environment temperature < 18 C (it is not error)
-            break;
-        }
-        case eHighTemperatureAbnormalityAlarmId://E012
-        {  
-
-            //if(warmingup = false) && (settingChange == false)
-            {
-                HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
-                HeaterTask_SendEvent(hEvent);
-
-                MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
-                MotorTask_SendEvent(event);
-                
-                waterSupplyCtrl_TurnOffAndDisablePump();
-            }
-
-            break;
-        }
-        case eRoomTemperatureLowToAchieveTargetTemperatureAlarmId://E013
+    //temperature abnormality
+    case eLowTemperatureAlarmId://E010
+    {  
+        //if environmentTemp > 18.0
+        if(event.data[eMessageTypeDataIdx] == eE010AmbientTempEqualOrOverThan18CelsiusDegree)
         {
-            //do nothing
-            break;
-        }
-        
-        case eCheckOperatingConditionsAlarmID://E014
-        {
-            //turn off heater control
             HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
             HeaterTask_SendEvent(hEvent);
-                
-            //if(environmentTemp >= 42.0)
-            if (event.data[eMessageTypeDataIdx] == eE011AmbientTempEqualOrOverThan42CelsiusDegree)
-            {
-                //turn off motor control
-                MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
-                MotorTask_SendEvent(event);
-            }
+
+            MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
+            MotorTask_SendEvent(event);
             
             waterSupplyCtrl_TurnOffAndDisablePump();
-                
-            break;
         }
-        
-        case eDeviceErrorToAchieveTargetTemperatureAlarmId://E015
+        //Continue operating normally if environment temperature < 18 C (it is not error)
+        break;
+    }
+    case eHighTemperatureAlarmId://E011
+    {  
+        //if(environmentTemp < setTemp)
+        if(event.data[eMessageTypeDataIdx] == eE011AmbientTempLowerThanSettingTemp)
         {
             HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
             HeaterTask_SendEvent(hEvent);
 
             MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
-            MotorTask_SendEvent(event);     
-            
-            waterSupplyCtrl_TurnOffAndDisablePump();
-            
-            break;
-        }
-        
-        //Abnormal oxygen concentration
-        case eOxygenHighAlarmId://E016
-        case eOxygenLowAlarmId://E017
-            //do nothing
-            break;
-            
-        //Abnormal device position
-        case eDevicePostureAbnormalAlarmId://E018     
-        case eDevicePostureBadAlarmId://E019
-            waterSupplyCtrl_TurnOffAndDisablePump();
-            break;
-            
-       // abnormal Battery
-        case eSwitchToBatteryModeAlarmId://E020
-        case eBatteryLowAlarmId://E021
-            //do nothing
-            break;
+            MotorTask_SendEvent(event);
             
-        case eBatteryGetsRunOutAlarmId://E022
-        {
-
             waterSupplyCtrl_TurnOffAndDisablePump();
-            break;
         }
+        //Continue operating normally if environment temperature < 18 C (it is not error)
+        break;
+    }
+    case eHighTemperatureAbnormalityAlarmId://E012
+    {  
 
-        case ePowerNotEnoughAlarmId://E024
-            MotorTask_DisableMotor();
-        case eStopFunctionAlarmId://E023  
+        //if(warmingup = false) && (settingChange == false)
         {
-            waterSupplyCtrl_TurnOffAndDisablePump();//do nothing
-                       
             HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
             HeaterTask_SendEvent(hEvent);
 
             MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
-            MotorTask_SendEvent(event);                           
-            break;
+            MotorTask_SendEvent(event);
+            
+            waterSupplyCtrl_TurnOffAndDisablePump();
         }
-        
-        //SpO2
-        case eSpO2FailedAlarmId://E025
-        case eSpO2LowAlarmId://E026
-        case eSpO2SensorProbeAlarmId://E027
-        case eSpO2SignalLossAlarmId://E028
-        case eSpO2SensorUnpluggedAlarmId://E029
-            //do nothing
-            break;
+
+        break;
+    }
+    case eRoomTemperatureLowToAchieveTargetTemperatureAlarmId://E013
+    {
+        //do nothing
+        break;
+    }
+    
+    case eCheckOperatingConditionsAlarmID://E014
+    {
+        //turn off heater control
+        HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
+        HeaterTask_SendEvent(hEvent);
             
-        case eWaterSupplyCheckAlarmId://E030
-        case eWaterTankConnectionCheckAlarmId://E031
-        case eMainUnitBatteryDisconnectedAlarmId://E034
+        //if(environmentTemp >= 42.0)
+        if (event.data[eMessageTypeDataIdx] == eE011AmbientTempEqualOrOverThan42CelsiusDegree)
         {
-            waterSupplyCtrl_TurnOffAndDisablePump();
-            break;
+            //turn off motor control
+            MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
+            MotorTask_SendEvent(event);
         }
         
-        case eFailureOxygenFlowMeasurementFlowSensorAlarmId://E100
-        case eFailureAirFlowMeasurementFlowSensorAlarmId://E101
-        case eFailureChamberTemperatureSensorAlarmId://E102
-        case eFailureCoilTemperatureSendorAlarmId://E103
-        case eFailureBreathingCircuitOutTemperatureSensorAlarmId://E104
-        case eFailureEnvironmentSensorAlarmId://E105
-        case eFailureCurrentSensorAlarmId://E106
-        case eFailureBlowerAlarmId://E107
-        case eFailureWaterLevelSensorAlarmId://E109
-        case eFailureExternalFlashMemoryAlarmId://E110
-        {
-            MotorTask_DisableMotor();
-            HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
-            HeaterTask_SendEvent(hEvent);
+        waterSupplyCtrl_TurnOffAndDisablePump();
+            
+        break;
+    }
+    
+    case eDeviceErrorToAchieveTargetTemperatureAlarmId://E015
+    {
+        HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
+        HeaterTask_SendEvent(hEvent);
 
-            MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
-            MotorTask_SendEvent(event);   
-            break;
-            waterSupplyCtrl_TurnOffAndDisablePump();
+        MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
+        MotorTask_SendEvent(event);     
+        
+        waterSupplyCtrl_TurnOffAndDisablePump();
+        
+        break;
+    }
+    
+    //Abnormal oxygen concentration
+    case eOxygenHighAlarmId://E016
+    case eOxygenLowAlarmId://E017
+        //do nothing
+        break;
+        
+    //Abnormal device position
+    case eDevicePostureAbnormalAlarmId://E018     
+    case eDevicePostureBadAlarmId://E019
+        waterSupplyCtrl_TurnOffAndDisablePump();
+        break;
+        
+   // abnormal Battery
+    case eSwitchToBatteryModeAlarmId://E020
+    case eBatteryLowAlarmId://E021
+        //do nothing
+        break;
+        
+    case eBatteryGetsRunOutAlarmId://E022
+    {
+
+        waterSupplyCtrl_TurnOffAndDisablePump();
+        break;
+    }
+
+    case ePowerNotEnoughAlarmId://E024
+        MotorTask_DisableMotor();
+    case eStopFunctionAlarmId://E023  
+    {
+        waterSupplyCtrl_TurnOffAndDisablePump();//do nothing
+                   
+        HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
+        HeaterTask_SendEvent(hEvent);
+
+        MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
+        MotorTask_SendEvent(event);                           
+        break;
+    }
+    
+    //SpO2
+    case eSpO2FailedAlarmId://E025
+    case eSpO2LowAlarmId://E026
+    case eSpO2SensorProbeAlarmId://E027
+    case eSpO2SignalLossAlarmId://E028
+    case eSpO2SensorUnpluggedAlarmId://E029
+        //do nothing
+        break;
+        
+    case eWaterSupplyCheckAlarmId://E030
+    case eWaterTankConnectionCheckAlarmId://E031
+    case eMainUnitBatteryDisconnectedAlarmId://E034
+    {
+        waterSupplyCtrl_TurnOffAndDisablePump();
+        break;
+    }
+    
+    case eFailureOxygenFlowMeasurementFlowSensorAlarmId://E100
+    case eFailureAirFlowMeasurementFlowSensorAlarmId://E101
+    case eFailureChamberTemperatureSensorAlarmId://E102
+    case eFailureCoilTemperatureSendorAlarmId://E103
+    case eFailureBreathingCircuitOutTemperatureSensorAlarmId://E104
+    case eFailureEnvironmentSensorAlarmId://E105
+    case eFailureCurrentSensorAlarmId://E106
+    case eFailureBlowerAlarmId://E107
+    case eFailureWaterLevelSensorAlarmId://E109
+    case eFailureExternalFlashMemoryAlarmId://E110
+    {
+        MotorTask_DisableMotor();
+        HEATER_CTRL_EVENT_t hEvent = {.id = eHeaterStopId, .iData = 0};
+        HeaterTask_SendEvent(hEvent);
+
+        MOTOR_CTRL_EVENT_t event = {.id = eMotorStopId, .iData = 0};
+        MotorTask_SendEvent(event);   
+        break;
+        waterSupplyCtrl_TurnOffAndDisablePump();
+    }
+    case eFailureAccelerationSensorAlarmId://E111
+    case eMainUnitBatteryCommunicationErrorAlarmId://E113
+    case eCradleBatteryCommunicationErrorAlarmId://E114
+    case eCradleCommunicationErrorAlarmId://E115
+    case eMainMCUFailedOrOutOfControlAlarmId://E116
+    case eESP32FailedAlarmId://E117
+    case eBreathingCircuitHeaterWireBrokenAlarmId://E118
+        waterSupplyCtrl_TurnOffAndDisablePump();
+        break;
+            
+    default:
+        break;
+    }
+    return;
+}
+
+/** @brief This operation check alarm event from alarm event queue and process them
+ *  @param [in] None
+ *  @param [out] None
+ *  @return None
+ */
+void alarmEvenHandler_HandleEvent(void)
+{
+    DEVICE_TASK_ALARM_EVENT_t event;
+    //wait for queue event
+    if (xQueueReceive(g_alarmEventQueue, &event, 0) == pdTRUE) //wait 0 tick (do not wait)
+    {
+        if (event.id == eNoOfAlarmId)
+        {
+            //change set: all alarms changed in one cycle of alarm task
+            ALARM_CHANGE_SET_t *set = alarmInterface_GetChangeSet(event.data[0]);
+            int i;
+            for (i = 0; i < set->count; i++)
+            {
+                DEVICE_TASK_ALARM_EVENT_t change;
+                change.id = set->changes[i].id;
+                change.status = set->changes[i].status;
+                memcpy(change.data, set->changes[i].data, 5);
+                alarmEvenHandler_ProcessEvent(change);
+            }
+            set->devicePending = false;
         }
-        case eFailureAccelerationSensorAlarmId://E111
-        case eMainUnitBatteryCommunicationErrorAlarmId://E113
-        case eCradleBatteryCommunicationErrorAlarmId://E114
-        case eCradleCommunicationErrorAlarmId://E115
-        case eMainMCUFailedOrOutOfControlAlarmId://E116
-        case eESP32FailedAlarmId://E117
-        case eBreathingCircuitHeaterWireBrokenAlarmId://E118
-            waterSupplyCtrl_TurnOffAndDisablePump();
-            break;
-                
-        default:
-            break;
+        else
+        {
+            alarmEvenHandler_ProcessEvent(event);
         }
         
         //update alarm status
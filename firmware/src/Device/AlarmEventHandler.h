@@ -23,6 +23,13 @@ extern QueueHandle_t g_alarmEventQueue;
  */
 inline bool alarmEvenHandlerInterface_SendEventAlarm(uint8_t alarmId, uint8_t status, uint8_t *data);
 
+/** @brief This operation send alarm change set event to alarmEventQueue to communicate with DEVICE task
+ *  @param [in] uint8_t slot: slot of change set, see alarmInterface_GetChangeSet
+ *  @param [out] None
+ *  @return bool : true if event was sent successful, false is event was sent failed
+ */
+bool alarmEvenHandlerInterface_SendEventAlarmChangeSet(uint8_t slot);
+
 /** @brief This operation check alarm event from alarm event queue and process them
  *  @param [in] None
  *  @param [out] None
@@ -27,7 +27,7 @@
 #include "task.h"
 #include "queue.h"
 #include "GuiInterface.h"
-#include "AudioDefine.h"
+#include "ToneSynth.h"
 
 /** @brief define state machine for Play alarm sound */
 typedef enum {
@@ -160,13 +160,26 @@ typedef enum {
 /** @brief Declare gain offset for high priority alarm*/
 #define GAIN_OFFSET_FOR_HIGH_ALARM      (-20)
 
-extern unsigned char audioSquareWave260ms_Medium[];
-extern unsigned char audioSquareWave260ms_Low[];
-extern unsigned char audioSquareWave210ms_High[];
+/** @brief amplitude of each harmonic of alarm pulses, measured on the former
+ * Audio_*_CRC.bin sounds (peaks 2813, 1410 and 890). Priorities are told apart
+ * by level as well as by pattern, volume is set by Audio_SetVolume on the codec */
+#define ALARM_TONE_LEVEL_HIGH           (710)
+#define ALARM_TONE_LEVEL_MEDIUM         (356)
+#define ALARM_TONE_LEVEL_LOW            (225)
+
+/** @brief high priority alarm pulse: 800 Hz with 5 harmonics up to 4 kHz,
+ * 210 ms including 30 ms rise and fall */
+static const TONE_PARAM_t s_HighAlarmTone = {800, 5, 210, 30, 30, ALARM_TONE_LEVEL_HIGH};
+
+/** @brief medium priority alarm pulse: 800 Hz with 5 harmonics up to 4 kHz,
+ * 260 ms including 30 ms rise and fall */
+static const TONE_PARAM_t s_MediumAlarmTone = {800, 5, 260, 30, 30, ALARM_TONE_LEVEL_MEDIUM};
+
+/** @brief low priority alarm pulse: 800 Hz with 5 harmonics up to 4 kHz,
+ * 260 ms including 30 ms rise and fall */
+static const TONE_PARAM_t s_LowAlarmTone = {800, 5, 260, 30, 30, ALARM_TONE_LEVEL_LOW};
 
 extern unsigned char audioSquareWave100ms[];
-extern unsigned char audioVoiceSync[];
-//extern unsigned char audioVoiceStart[];
 
 
 /** @brief Variable to hole play alarm sound status, useful for state machine of 
@@ -235,10 +248,12 @@ void i2s_TLV320StatusCallback (DRV_I2S_BUFFER_EVENT event,
         case DRV_I2S_BUFFER_EVENT_COMPLETE:
             //tlv320_audioConstDataSend();
             //BSP_LED_3Toggle();
+            ToneSynth_BufferComplete(bufferHandle);
             break;
         case DRV_I2S_BUFFER_EVENT_ERROR:
-            break;
         case DRV_I2S_BUFFER_EVENT_ABORT:
+            //buffer is given back, synthesizer must not wait for it
+            ToneSynth_BufferComplete(bufferHandle);
             break;
         default:
             break;
@@ -277,6 +292,7 @@ bool _i2s_TLV320Init (void) {
     
     /// Setup i2c driver callback when handle valid
     _i2s_TLV320Setup();
+    ToneSynth_Initialize(s_TLV320HandleI2S);
     return true;
 }
 
@@ -489,17 +505,17 @@ static void Audio_SetVolume(E_AudioCommand cmdId, uint16_t value)
 
 void Audio_PlaySquareWaveHigh()
 {
-    _i2s_TLV320DataTransmit(audioSquareWave210ms_High, SIZE_SOUND_800HZ_210MS_HIGH);
+    ToneSynth_Play(&s_HighAlarmTone);
 }
 
 void Audio_PlaySquareWaveMedium()
 {
-    _i2s_TLV320DataTransmit(audioSquareWave260ms_Medium, SIZE_SOUND_800HZ_260MS_MEDIUM);
+    ToneSynth_Play(&s_MediumAlarmTone);
 }
 
 void Audio_PlaySquareWaveLow()
 {
-    _i2s_TLV320DataTransmit(audioSquareWave260ms_Low, SIZE_SOUND_800HZ_260MS_LOW);
+    ToneSynth_Play(&s_LowAlarmTone);
 }
 
 
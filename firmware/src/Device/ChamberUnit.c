@@ -16,6 +16,7 @@
 #include <math.h>
 
 #include "FreeRTOS.h"
+#include "task.h"
 #include "semphr.h"
 #include "queue.h"
 
@@ -127,6 +128,55 @@ static QueueHandle_t gs_ChamberCommandQueue = NULL;
      
 static void Chamber_PrepareCommand(uint8_t command, uint8_t* data, uint8_t size);
 
+/** @brief Define polling of a chamber register by "get data" commands */
+typedef struct {
+    uint8_t command;            /**<GET command of the register */
+    uint16_t periodMs;          /**<target refresh period, 0 if read once per connection */
+    bool isCircuitData;         /**<data of breathing circuit, read again when circuit changes */
+    bool isRead;                /**<register read once since connection (periodMs is 0) */
+    uint16_t retryMs;           /**<delay before identity register not read yet is polled again */
+    uint32_t lastPollTick;      /**<tick of last command sent */
+    uint32_t lastReadTick;      /**<tick of last valid read */
+    uint16_t actualPeriodMs;    /**<average period between valid reads */
+    uint32_t readCount;         /**<number of valid reads */
+} CHAMBER_POLL_t;
+
+/** @brief Polling table of chamber registers. The register whose time since last
+ * poll is the longest compared to its period is polled next, so every slot of
+ * the bus is used and temperatures get most of them. Identity data is read
+ * once after chamber connects or breathing circuit changes, a failed read is
+ * retried after a delay doubled at each try so it can not take all slots */
+static CHAMBER_POLL_t gs_chamberPoll[] = {
+    {GET_CHAMBER_SN_CMD,                        0,      false},
+    {GET_CHAMBER_FW_VERSION_CMD,                0,      false},
+    {GET_BREATHING_CIRCUIT_MANUF_CODE_CMD,      0,      true},
+    {GET_BREATHING_CIRCUIT_SN_CMD,              0,      true},
+    {GET_BREATHING_CIRCUIT_MANUF_DATE_CMD,      0,      true},
+    {GET_BREATHING_CIRCUIT_FACTORY_CODE_CMD,    0,      true},
+    {GET_BREATHING_CIRCUIT_START_USED_DAY_CMD,  0,      true},
+    {GET_CHAMBER_OUT_TEMP_CMD,                  100,    false},
+    {GET_BREATHING_CIRCUIT_OUT_TEMP_CMD,        100,    false},
+    {GET_CHAMBER_EVT_TEMP_CMD,                  500,    false},
+    {GET_TANK_WATER_LEVEL_CMD,                  500,    false},
+    {GET_BREATHING_CIRCUIT_CONNECTION_CMD,      500,    false},
+    {GET_BREATHING_CIRCUIT_TYPE_CMD,            1000,   false},
+    {GET_CHAMBER_USED_TIME_CMD,                 10000,  false},
+    {GET_BREATHING_CIRCUIT_CYCLE_COUNT_CMD,     10000,  false},
+    {GET_BREATHING_CIRCUIT_USED_TIME_CMD,       10000,  false},
+};
+
+/** @brief Delay before first retry of an identity register whose read failed */
+#define CHAMBER_IDENTITY_RETRY_MIN_MS   (200)
+
+/** @brief Max delay between retries of an identity register whose read failed */
+#define CHAMBER_IDENTITY_RETRY_MAX_MS   (10000)
+
+/** @brief Number of polled chamber registers */
+#define CHAMBER_POLL_NUM            (sizeof(gs_chamberPoll) / sizeof(gs_chamberPoll[0]))
+
+/** @brief Flag is raised if CRC of last data read from chamber is correct */
+static bool gs_IsLastReadValid = false;
+
 bool tooMuchWaterFag = 0;
 /** @brief current command to chamber */
 static gs_currentCommand = GET_CHAMBER_SN_CMD;
@@ -238,101 +288,156 @@ void Chamber_Initialize()
     }
 }
 
+/** @brief Mark identity data of chamber or breathing circuit to be read again
+ *  @param [in]  bool isCircuitData: true for breathing circuit, false for chamber
+ *  @param [out]  None
+ *  @return None
+ */
+static void Chamber_InvalidateIdentity(bool isCircuitData)
+{
+    uint8_t i;
+    for (i = 0; i < CHAMBER_POLL_NUM; i++)
+    {
+        if (gs_chamberPoll[i].isCircuitData == isCircuitData)
+        {
+            gs_chamberPoll[i].isRead = false;
+            gs_chamberPoll[i].retryMs = 0;
+        }
+    }
+}
+
 /** @brief Function to get next command write to chamber
+ * "Set data" commands in the queue are sent first, then identity data not read
+ * yet whose retry delay is over, then the register of gs_chamberPoll which is
+ * the most late compared to its period
  *  @param [in]  None   
  *  @param [out]  None
- *  @return None
+ *  @return uint8_t command to write
  */
 uint8_t Chamber_GetNextCommand()
 {
     uint8_t cmd;
+    uint32_t now = xTaskGetTickCount();
+    int best = -1;
+    uint8_t i;
     //check there are any "set data" command in the queue
     if (xQueueReceive(gs_ChamberCommandQueue, &cmd, 0) == pdTRUE) //wait 0 tick (do not wait)
     {
+        //identity data is written, read it back
+        if ((cmd == SET_CHAMBER_SN_CMD) || (cmd == RESET_CHAMBER_ALL_CMD))
+        {
+            Chamber_InvalidateIdentity(false);
+        }
+        else if (cmd >= SET_BREATHING_CIRCUIT_MANUF_CODE_CMD)
+        {
+            Chamber_InvalidateIdentity(true);
+        }
         return cmd;
     }
     //if there is no command in the queue, get next command get data
-    switch (gs_currentCommand)
+    for (i = 0; i < CHAMBER_POLL_NUM; i++)
     {
-        case GET_CHAMBER_SN_CMD:
-            gs_currentCommand = GET_CHAMBER_OUT_TEMP_CMD;
-            break;
-            
-        case GET_CHAMBER_OUT_TEMP_CMD:
-            gs_currentCommand = GET_CHAMBER_EVT_TEMP_CMD;
-            break;
-            
-        case GET_CHAMBER_EVT_TEMP_CMD:
-            //gs_currentCommand = GET_CHAMBER_WATER_LEVEL_CMD;
-            gs_currentCommand = GET_CHAMBER_USED_TIME_CMD;
-            break;
-            
-        case GET_CHAMBER_WATER_LEVEL_CMD:
-            gs_currentCommand = GET_CHAMBER_USED_TIME_CMD;
-            break;
-            
-        case GET_CHAMBER_USED_TIME_CMD:
-            gs_currentCommand = GET_CHAMBER_FW_VERSION_CMD;
-            break;
-            
-        case GET_CHAMBER_FW_VERSION_CMD:
-            gs_currentCommand = GET_TANK_WATER_LEVEL_CMD;
-            break;
-            
-        case GET_TANK_WATER_LEVEL_CMD:
-            gs_currentCommand = GET_BREATHING_CIRCUIT_MANUF_CODE_CMD;
-            break;
-            
-        case GET_BREATHING_CIRCUIT_MANUF_CODE_CMD:
-            gs_currentCommand = GET_BREATHING_CIRCUIT_SN_CMD;
-            break;
-            
-        case GET_BREATHING_CIRCUIT_SN_CMD:
-            gs_currentCommand = GET_BREATHING_CIRCUIT_MANUF_DATE_CMD;
-            break;
-            
-        case GET_BREATHING_CIRCUIT_MANUF_DATE_CMD: 
-            gs_currentCommand = GET_BREATHING_CIRCUIT_FACTORY_CODE_CMD;
-            break;
-            
-        case GET_BREATHING_CIRCUIT_FACTORY_CODE_CMD:
-            gs_currentCommand = GET_BREATHING_CIRCUIT_START_USED_DAY_CMD;
-            break;
-            
-        case GET_BREATHING_CIRCUIT_START_USED_DAY_CMD: 
-           gs_currentCommand = GET_BREATHING_CIRCUIT_CYCLE_COUNT_CMD;
-            break;
-            
-        case GET_BREATHING_CIRCUIT_CYCLE_COUNT_CMD:  
-            gs_currentCommand = GET_BREATHING_CIRCUIT_USED_TIME_CMD;
-            break;
-            
-        case GET_BREATHING_CIRCUIT_USED_TIME_CMD:   
-            gs_currentCommand = GET_BREATHING_CIRCUIT_OUT_TEMP_CMD;
-            break; 
-            
-        case GET_BREATHING_CIRCUIT_OUT_TEMP_CMD:  
-            gs_currentCommand = GET_BREATHING_CIRCUIT_TYPE_CMD;
-            break;
-            
-        case GET_BREATHING_CIRCUIT_TYPE_CMD:    
-            gs_currentCommand = GET_BREATHING_CIRCUIT_CONNECTION_CMD;
-            break;
-            
-        case GET_BREATHING_CIRCUIT_CONNECTION_CMD:   
-            gs_currentCommand = GET_CHAMBER_SN_CMD;//GET_CHAMBER_OUT_TEMP_CMD;
-            break;   
-               
-        case SET_WATER_PUMP_FREQ_CMD:
-            gs_currentCommand = GET_CHAMBER_OUT_TEMP_CMD;
-            break;           
-        default:
-            gs_currentCommand = GET_CHAMBER_OUT_TEMP_CMD;
-            break;
+        CHAMBER_POLL_t *poll = &gs_chamberPoll[i];
+        if (poll->periodMs == 0)
+        {
+            //data of breathing circuit is read only when circuit is connected
+            if ((poll->isRead == false)
+                && ((poll->isCircuitData == false) || (chamber_GetBreathingCircuitConnection() == true))
+                && ((now - poll->lastPollTick) * portTICK_PERIOD_MS >= poll->retryMs))
+            {
+                best = i;
+                break;
+            }
+        }
+        else if ((best < 0)
+                || ((uint64_t)(now - poll->lastPollTick) * gs_chamberPoll[best].periodMs
+                    > (uint64_t)(now - gs_chamberPoll[best].lastPollTick) * poll->periodMs))
+        {
+            best = i;
+        }
     }
+    gs_chamberPoll[best].lastPollTick = now;
+    if (gs_chamberPoll[best].periodMs == 0)
+    {
+        //next try if this read fails, register stays unread until CRC is correct
+        gs_chamberPoll[best].retryMs = (gs_chamberPoll[best].retryMs == 0) ? CHAMBER_IDENTITY_RETRY_MIN_MS
+            : ((gs_chamberPoll[best].retryMs >= CHAMBER_IDENTITY_RETRY_MAX_MS / 2) ? CHAMBER_IDENTITY_RETRY_MAX_MS
+            : gs_chamberPoll[best].retryMs * 2);
+    }
+    gs_currentCommand = gs_chamberPoll[best].command;
     return gs_currentCommand;                
 }
 
+/** @brief Update polling table after data of a command was read
+ *  @param [in]  uint8_t command: command read
+ *  @param [out]  None
+ *  @return None
+ */
+static void Chamber_UpdatePoll(uint8_t command)
+{
+    uint32_t now = xTaskGetTickCount();
+    uint8_t i;
+    if (gs_IsLastReadValid == false)
+    {
+        return;
+    }
+    for (i = 0; i < CHAMBER_POLL_NUM; i++)
+    {
+        CHAMBER_POLL_t *poll = &gs_chamberPoll[i];
+        if (poll->command == command)
+        {
+            if (poll->readCount == 0)
+            {
+                poll->actualPeriodMs = poll->periodMs;
+            }
+            else
+            {
+                //average on about 8 reads
+                int32_t period = (int32_t)((now - poll->lastReadTick) * portTICK_PERIOD_MS);
+                if (period > UINT16_MAX)
+                {
+                    period = UINT16_MAX;
+                }
+                poll->actualPeriodMs += (period - (int32_t)poll->actualPeriodMs) / 8;
+            }
+            poll->lastReadTick = now;
+            poll->readCount++;
+            poll->isRead = true;
+            break;
+        }
+    }
+}
+
+/** @brief Get refresh statistics of polled chamber registers
+ *  @param [out]  CHAMBER_POLL_STAT_t *stat: storage of statistics
+ *  @param [in]  uint8_t maxCount: max number of registers stored
+ *  @return uint8_t number of registers stored
+ */
+uint8_t Chamber_GetPollStatistics(CHAMBER_POLL_STAT_t *stat, uint8_t maxCount)
+{
+    uint8_t i;
+    for (i = 0; (i < CHAMBER_POLL_NUM) && (i < maxCount); i++)
+    {
+        stat[i].command = gs_chamberPoll[i].command;
+        stat[i].targetPeriodMs = gs_chamberPoll[i].periodMs;
+        stat[i].actualPeriodMs = gs_chamberPoll[i].actualPeriodMs;
+        stat[i].readCount = gs_chamberPoll[i].readCount;
+    }
+    return i;
+}
+
+/** @brief Check CRC of data read from chamber, result is kept for polling table
+ *  @param [in]  uint8_t *buffRead: data followed by CRC
+ *  @param [in]  uint8_t size: size of data
+ *  @retval true CRC is correct
+ *  @retval false CRC is wrong
+ */
+static bool Chamber_CheckReadData(uint8_t *buffRead, uint8_t size)
+{
+    gs_IsLastReadValid = crcChamber_Check(buffRead, size, buffRead[size]);
+    return gs_IsLastReadValid;
+}
+
 /** @brief Function to wite command to chamber
  *  @param [in]  uint8_t command: command to chamber
  *  @retval true write data success
@@ -612,6 +717,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
     uint8_t size = 0;
     bool rtn = true;
     
+    gs_IsLastReadValid = false;
     switch (command)
     {
         case GET_CHAMBER_SN_CMD: 
@@ -625,7 +731,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     uint8_t i;
                     for(i = 0; i < size; i++ )
@@ -664,7 +770,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     int32_t temperature = 0;
                     int i;
@@ -709,7 +815,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     
                 }
@@ -731,7 +837,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     uint32_t usedTime = 0;
                     int i;
@@ -768,7 +874,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     gs_ChamberFwVersion[0] = buffRead[0];
                     gs_ChamberFwVersion[1] = buffRead[1];
@@ -801,7 +907,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     E_TankWaterLevel waterLevel = 0;
                     int i;
@@ -830,7 +936,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     gs_BreathCircuitManufacturerCode[0] = buffRead[0];
                     gs_BreathCircuitManufacturerCode[1] = buffRead[1];
@@ -853,7 +959,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     uint8_t i;
                     for(i = 0; i < size; i++ )
@@ -889,7 +995,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     gs_BreathCircuitManufactureDate[0] = buffRead[0];
                     gs_BreathCircuitManufactureDate[1] = buffRead[1];
@@ -914,7 +1020,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     gs_BreathCircuitFactoryCode = buffRead[0];
                     
@@ -957,7 +1063,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     gs_BreathCircuitStartUsedDate[0] = buffRead[0];
                     gs_BreathCircuitStartUsedDate[1] = buffRead[1];
@@ -994,7 +1100,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     gs_BreathCircuitCnt[0] = buffRead[0];
                     gs_BreathCircuitCnt[1] = buffRead[1];
@@ -1016,7 +1122,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     memcpy(gs_BreathCircuitUsedTime, buffRead, size);
                     
@@ -1049,7 +1155,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     char* str;
                     if(buffRead[0] == 'P'){
@@ -1095,7 +1201,7 @@ bool Chamber_ReadAndProcessReadData(uint8_t command)
             else
             {
                 //check CRC
-                if (crcChamber_Check(buffRead, size, buffRead[size])) 
+                if (Chamber_CheckReadData(buffRead, size)) 
                 {   
                     gs_BreathCircuitConnectStt = buffRead[0];
                 }
@@ -1145,6 +1251,8 @@ void Chamber_Run()
     static uint16_t command = 0;
     static E_ChamberRequestState state = eChamberWriteRqst;
     static uint16_t s_ErrorCounter = 0;
+    static bool s_IsCircuitConnected = false;
+    static E_BreathingCircuitType s_CircuitType = eTypeOther;
     
     Chamber_CheckChamberConnection();
     if(gs_ChamberConnection == eChamberConnected)
@@ -1169,6 +1277,7 @@ void Chamber_Run()
 
             case eChamberReadRqst:
                 if (Chamber_ReadAndProcessReadData(command) == true){
+                    Chamber_UpdatePoll(command);
                     state = eChamberWriteRqst;
                     s_ErrorCounter = 0;
                 }
@@ -1200,6 +1309,14 @@ void Chamber_Run()
         gs_IsUpdateChamberSNToGUIInfo = true;
         gs_IsUpdateChamberVerToGUIInfo = true;
         gs_IsUpdateChamberUsageTimeToGUIInfo = true;
+        Chamber_InvalidateIdentity(false);
+    }
+    //read identity of breathing circuit again when it changes
+    if((chamber_GetBreathingCircuitConnection() != s_IsCircuitConnected) || (gs_BreathCircuitType != s_CircuitType))
+    {
+        s_IsCircuitConnected = chamber_GetBreathingCircuitConnection();
+        s_CircuitType = gs_BreathCircuitType;
+        Chamber_InvalidateIdentity(true);
     }
     if(chamber_GetBreathingCircuitConnection() == false)
     {
@@ -49,6 +49,15 @@ typedef enum
     eChamberConnected,
 }E_ChamberConnectState;
 
+/** @brief Refresh statistics of a polled chamber register */
+typedef struct
+{
+    uint8_t command;            /**<GET command of the register */
+    uint16_t targetPeriodMs;    /**<target refresh period, 0 if read once per connection */
+    uint16_t actualPeriodMs;    /**<average period between valid reads */
+    uint32_t readCount;         /**<number of valid reads */
+} CHAMBER_POLL_STAT_t;
+
 
 void Chamber_Initialize();
 
@@ -293,6 +302,13 @@ bool Chamber_UpgradeFirmware(uint8_t* data, uint32_t datalen);
 
 void Chamber_Run();
 
+/** @brief Get refresh statistics of polled chamber registers
+ *  @param [out]  CHAMBER_POLL_STAT_t *stat: storage of statistics
+ *  @param [in]  uint8_t maxCount: max number of registers stored
+ *  @return uint8_t number of registers stored
+ */
+uint8_t Chamber_GetPollStatistics(CHAMBER_POLL_STAT_t *stat, uint8_t maxCount);
+
 /** @brief Function to get status update (success or failed)
  *  @param [in]  None
  *  @param [out]  None
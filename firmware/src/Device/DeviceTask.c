@@ -89,6 +89,9 @@ static SemaphoreHandle_t gs_PCMonitorMutex = NULL;
 
 static ALARM_MONITOR_t gs_stAlarmMonitor;
 
+/** @brief Groups of gs_stAlarmMonitor fields changed since alarm task took it */
+static uint32_t gs_alarmMonitorChanges = ALARM_DEP_ALL;
+
 static PC_MONITORING_t gs_stPCMonitor;
 
 //inline bool DeviceTask_SendEvent(uint8_t id, uint32_t data) {
@@ -461,6 +464,7 @@ static void DeviceTask_UpdateAlarmMonitorStruct(void)
     static MOTOR_PUBLIC_DATA_t s_motorData;
     static SP02_DATA_t s_spO2Data;
     static uint32_t s_counter = 0;
+    static ALARM_MONITOR_t s_lastAlarmMonitor;
     
     rtc_GetTime(&time);
     uint32_t currentDate = 20*1000000 + time.YEAR*10000 + time.MONTH*100 + time.DATE;
@@ -608,6 +612,10 @@ static void DeviceTask_UpdateAlarmMonitorStruct(void)
         //
         //}
         //count++;
+        
+        //publish changed groups, alarm task only runs checkers depending on them
+        gs_alarmMonitorChanges |= alarmInterface_GetMonitorChanges(&s_lastAlarmMonitor, &gs_stAlarmMonitor);
+        s_lastAlarmMonitor = gs_stAlarmMonitor;
                
         xSemaphoreGive(gs_AlarmMonitorMutex);          
     }
@@ -669,6 +677,28 @@ void DeviceTask_GetAlarmMonitorStruct(ALARM_MONITOR_t *storagePlace)
 }
 
 
+/** @brief Function to get current Alarm monitor structure and groups of fields
+ *  changed since last call, changes are cleared
+ *  @param [in] None
+ *  @param [out] ALARM_MONITOR_t *storagePlace : current Alarm monitor structure
+ *  @param [out] uint32_t *changes : ALARM_DEP_xxx bits of changed groups, 0 if
+ *  structure could not be taken
+ *  @return None
+ */
+void DeviceTask_GetAlarmMonitorChanges(ALARM_MONITOR_t *storagePlace, uint32_t *changes)
+{
+    *changes = 0;
+    //take resource 
+    if (xSemaphoreTake(gs_AlarmMonitorMutex, ALARM_MONITOR_DATA_MUTEX_MAX_WAIT) == pdTRUE) {
+        //copy data
+        *storagePlace = gs_stAlarmMonitor;
+        *changes = gs_alarmMonitorChanges;
+        gs_alarmMonitorChanges = 0;
+        //release semaphore
+        xSemaphoreGive(gs_AlarmMonitorMutex);
+    }
+}
+
 /** @brief Function to current PC monitor structure
  *  @param [in] PC_MONITORING_t storagePlace
  *  @param [out] None
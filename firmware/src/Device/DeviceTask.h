@@ -26,7 +26,8 @@ typedef struct {
     long data;
 } DEVICE_TASK_EVENT_t;
 
-/** @brief Struct of Alarm Informations which are received to use for alarm process*/
+/** @brief Struct of Alarm Informations which are received to use for alarm process,
+ *  id eNoOfAlarmId is a change set event, data[0] is slot of the change set */
 typedef struct {
     E_AlarmId id;
     E_AlarmStatus status;
@@ -68,6 +69,15 @@ extern "C" {
     *  @return None
     */
     void DeviceTask_GetAlarmMonitorStruct(ALARM_MONITOR_t *storagePlace);
+
+    /** @brief Function to get current Alarm monitor structure and groups of fields
+    *  changed since last call, changes are cleared
+    *  @param [in] None
+    *  @param [out] ALARM_MONITOR_t *storagePlace : current Alarm monitor structure
+    *  @param [out] uint32_t *changes : ALARM_DEP_xxx bits of changed groups
+    *  @return None
+    */
+    void DeviceTask_GetAlarmMonitorChanges(ALARM_MONITOR_t *storagePlace, uint32_t *changes);
     
     /** @brief Function to current PC monitor structure
     *  @param [in] PC_MONITORING_t storagePlace
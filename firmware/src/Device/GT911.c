@@ -16,6 +16,8 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "GT911.h"
+#include "I2C_Engine.h"
+#include "Trace.h"
 #include "Delay.h"
 #include "ApplicationDefinition.h"
 
@@ -34,8 +36,29 @@
  read address = base address << 1 + read bit(1))*/
 #define GT911_READ_ADDR       ((GT911_BASE_ADDR << 1)+1)
 
-/** @brief Size of 1 frame data for each time reading coordinate */
-#define GT911_FRAME_SIZE         (10)
+/** @brief Max number of touch points reported by GT911 */
+#define GT911_MAX_POINTS         (5)
+
+/** @brief Size of 1 point: track id, x, y, size (2 bytes each, LSB first), reserved */
+#define GT911_POINT_SIZE         (8)
+
+/** @brief Size of 1 frame data for each time reading coordinate: status and all points */
+#define GT911_FRAME_SIZE         (1 + GT911_MAX_POINTS * GT911_POINT_SIZE)
+
+/** @brief Number of frames waiting for GUI task, 1 slot is kept free */
+#define GT911_FRAME_QUEUE_SIZE   (8)
+
+/** @brief Max time of read and confirm, the pipeline is restarted after it */
+#define GT911_PIPELINE_TIMEOUT_MS   (50 / portTICK_PERIOD_MS)
+
+/** @brief core timer counts per us */
+#define GT911_US_SCALE           (SYS_CLK_FREQ / 2000000)
+
+/** @brief weight of new latency in average latency (1 / 2^n) */
+#define GT911_LATENCY_SHIFT      (4)
+
+/** @brief Keep compiler from moving queue accesses across index update */
+#define GT911_BARRIER()          __asm__ volatile ("" ::: "memory")
 
 /** @brief Pull down reset line of Touch screen controller to make it reset*/
 #define GT9111_RESET            TOUCH_RESETOff()
@@ -58,6 +81,32 @@ typedef enum {
     eTouchReleased
 } E_GT911TouchEventID;
 
+/** @brief structure for a point read from GT911 */
+typedef struct {
+    uint8_t trackId; /**< id of finger */
+    uint16_t xpos; /**< x coordinate */
+    uint16_t ypos; /**< y coordinate */
+    uint16_t size; /**< touch size */
+} GT911_POINT_t;
+
+/** @brief structure for a frame read from GT911 */
+typedef struct {
+    uint8_t status; /**< status register: ready flag and number of points */
+    uint8_t count; /**< number of points */
+    uint32_t intTime; /**< core timer at interrupt of this frame */
+    GT911_POINT_t points[GT911_MAX_POINTS]; /**< points */
+} GT911_FRAME_t;
+
+/** @brief Statistics of touch pipeline, traced at each touch down */
+typedef struct {
+    uint32_t frameCount;        /**< frames handled by GUI task */
+    volatile uint32_t lostFrameCount; /**< frames lost as queue was full, changed by I2C completion */
+    uint8_t maxPointCount;      /**< max number of points in a frame */
+    uint32_t pressCount;        /**< touch down events injected */
+    uint32_t averageLatencyUs;  /**< average time from interrupt to touch down injected */
+    uint32_t maxLatencyUs;      /**< max time from interrupt to touch down injected */
+} GT911_STAT_t;
+
 /** @brief structure for a GT911 touch event data */
 typedef struct {
     E_GT911TouchEventID id; /**< touch panel event id */
@@ -79,11 +128,11 @@ static E_DeviceErrorState s_GT911Error = eDeviceNoError;
 static GT911_TOUCH_DATA_t s_TouchLastStatus = {eTouchReleased, 0, 0};
 
 /** @brief Flag indicate a read request. This flag is set when an interrupt from 
- * Touch Controller is occurred */
-static bool s_GT911RequestRead = false;
+ * Touch Controller is occurred while a read is in progress */
+static volatile bool s_GT911RequestRead = false;
 
 /** @brief State machine perform reading coordinate sequence */
-E_GT911StateID s_GT911OperationState = eTouchInitStateID;
+volatile E_GT911StateID s_GT911OperationState = eTouchInitStateID;
 
 /** @brief buffer to store raw data while reading from GT911 touch controller */
 static uint8_t s_CoordinateRawData[GT911_FRAME_SIZE];   //__attribute__ ((aligned (16)))
@@ -94,9 +143,58 @@ const uint8_t GT911ReadCmd[] = {0x81, 0x4e};
 /** @brief command send to GT911 to confirm coordinate has been read */
 const uint8_t GT911ConfirmCmd[] = {0x81, 0x4e, 0x00};
 
+/** @brief core timer at interrupt of the read in progress and of the read requested */
+static uint32_t s_GT911ReadIntTime = 0;
+static uint32_t s_GT911PendingIntTime = 0;
+
+/** @brief tick when the read in progress started */
+static volatile TickType_t s_GT911StartTick = 0;
+
+/** @brief frames read by I2C completion, waiting for GUI task. Head is only
+ * changed by I2C completion, tail only by GUI task */
+static GT911_FRAME_t s_GT911FrameQueue[GT911_FRAME_QUEUE_SIZE];
+static volatile uint8_t s_GT911FrameHead = 0;
+static volatile uint8_t s_GT911FrameTail = 0;
+
+/** @brief Flag indicate frames were handled at last GT911_Task */
+static bool s_isTouchActive = false;
+
+/** @brief statistics of touch pipeline */
+static GT911_STAT_t s_GT911Stat;
+
+/** @brief local functions */
+static void GT911_ReadDone(E_I2CTransactionStatus status, uintptr_t context);
+static void GT911_ConfirmDone(E_I2CTransactionStatus status, uintptr_t context);
+
+/** @brief I2C transaction reading status and points: write register address
+ * then read with repeated start. Address is the write address, driver sets
+ * read bit after repeated start */
+static I2C_TRANSACTION_t s_GT911ReadTransaction = {
+    .address = GT911_WRITE_ADDR,
+    .writeBuffer = (void*) &GT911ReadCmd[0],
+    .writeSize = sizeof (GT911ReadCmd),
+    .readBuffer = (void*) &s_CoordinateRawData[0],
+    .readSize = GT911_FRAME_SIZE,
+    .callback = GT911_ReadDone,
+    .context = 0,
+    .notifyTask = NULL
+};
+
+/** @brief I2C transaction confirming coordinate has been read */
+static I2C_TRANSACTION_t s_GT911ConfirmTransaction = {
+    .address = GT911_WRITE_ADDR,
+    .writeBuffer = (void*) &GT911ConfirmCmd[0],
+    .writeSize = sizeof (GT911ConfirmCmd),
+    .readBuffer = NULL,
+    .readSize = 0,
+    .callback = GT911_ConfirmDone,
+    .context = 0,
+    .notifyTask = NULL
+};
+
 /** @brief local functions */
 static void GT911_UpdateCoordinate(GT911_TOUCH_DATA_t event);
-static void GT911_HandleMessage(uint8_t status, uint16_t x, uint16_t y);
+static bool GT911_HandleMessage(const GT911_FRAME_t *frame);
 
 
 /** @brief Initialize GT911 Touch controller, including pull up reset line, open
@@ -138,27 +236,234 @@ void GT911_Reset() {
     GT9111_UN_RESET;
 }
 
-/** @brief Request a read. This function is called when GT911 interrupt, indicate 
- * new data are available on GT911 and host should perform a read to update that data
+/** @brief read core timer, 1 count each 2 system clocks
+ *  @param [in]  None
+ *  @param [out]  None
+ *  @return uint32_t core timer
+ */
+static uint32_t GT911_ReadCoreTimer(void)
+{
+    volatile uint32_t timer;
+
+    // get the count reg
+    asm volatile("mfc0   %0, $9" : "=r"(timer));
+
+    return(timer);
+}
+
+/** @brief Start reading status and points. Called from interrupt or I2C
+ * completion, with interrupts masked
+ *  @param [in]  uint32_t intTime: core timer at interrupt of this read
+ *  @param [out]  BaseType_t *woken: set if a higher priority task is woken
+ *  @return None
+ */
+static void GT911_StartRead(uint32_t intTime, BaseType_t *woken)
+{
+    s_GT911ReadIntTime = intTime;
+    s_GT911StartTick = xTaskGetTickCountFromISR();
+    s_GT911OperationState = eTouchReadStateID;
+    if (I2CEngine_SubmitFromISR(eI2C4Bus, &s_GT911ReadTransaction, woken) == false)
+    {
+        s_GT911OperationState = eTouchErrorStateID;
+    }
+}
+
+/** @brief Put the frame just read in queue of GUI task. Called from I2C
+ * completion. Frame is lost if queue is full
+ *  @param [in]  None   
+ *  @param [out]  None
+ *  @return None
+ */
+static void GT911_PushFrame(void)
+{
+    uint8_t head = s_GT911FrameHead;
+    GT911_FRAME_t *frame;
+    const uint8_t *point;
+    uint8_t i;
+
+    //check MSB bit of status indicate touch driver is ready or not
+    if ((s_CoordinateRawData[0] & 0x80) == 0)
+        return;
+
+    if ((head + 1) % GT911_FRAME_QUEUE_SIZE == s_GT911FrameTail)
+    {
+        s_GT911Stat.lostFrameCount++;
+        return;
+    }
+
+    frame = &s_GT911FrameQueue[head];
+    frame->status = s_CoordinateRawData[0];
+    frame->count = s_CoordinateRawData[0] & 0x0F;
+    if (frame->count > GT911_MAX_POINTS)
+        frame->count = GT911_MAX_POINTS;
+    frame->intTime = s_GT911ReadIntTime;
+    for (i = 0; i < frame->count; i++)
+    {
+        point = &s_CoordinateRawData[1 + i * GT911_POINT_SIZE];
+        frame->points[i].trackId = point[0];
+        frame->points[i].xpos = 256 * point[2] + point[1];
+        frame->points[i].ypos = 256 * point[4] + point[3];
+        frame->points[i].size = 256 * point[6] + point[5];
+    }
+
+    //frame is complete before GUI task can see it
+    GT911_BARRIER();
+    s_GT911FrameHead = (head + 1) % GT911_FRAME_QUEUE_SIZE;
+}
+
+/** @brief Completion of read: queue the frame and chain the confirm. Called
+ * from I2C interrupt or from a critical section
+ *  @param [in]  E_I2CTransactionStatus status: result of read
+ *              uintptr_t context: not used
+ *  @param [out]  None
+ *  @return None
+ */
+static void GT911_ReadDone(E_I2CTransactionStatus status, uintptr_t context)
+{
+    BaseType_t woken = pdFALSE; //task woken runs at next tick
+    UBaseType_t savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+
+    //ignore read given up by GT911_Task
+    if (s_GT911OperationState == eTouchReadStateID)
+    {
+        if (status != eI2CTransactionDone)
+        {
+            s_GT911OperationState = eTouchErrorStateID;
+        }
+        else
+        {
+            GT911_PushFrame();
+            s_GT911OperationState = eTouchConfirmStateID;
+            if (I2CEngine_SubmitFromISR(eI2C4Bus, &s_GT911ConfirmTransaction, &woken) == false)
+            {
+                s_GT911OperationState = eTouchErrorStateID;
+            }
+        }
+    }
+    taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+}
+
+/** @brief Completion of confirm: start the read requested meanwhile or wait
+ * for next interrupt. Called from I2C interrupt or from a critical section
+ *  @param [in]  E_I2CTransactionStatus status: result of confirm
+ *              uintptr_t context: not used
+ *  @param [out]  None
+ *  @return None
+ */
+static void GT911_ConfirmDone(E_I2CTransactionStatus status, uintptr_t context)
+{
+    BaseType_t woken = pdFALSE; //task woken runs at next tick
+    UBaseType_t savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+
+    //ignore confirm given up by GT911_Task
+    if (s_GT911OperationState == eTouchConfirmStateID)
+    {
+        if (status != eI2CTransactionDone)
+        {
+            s_GT911OperationState = eTouchErrorStateID;
+        }
+        else if (s_GT911RequestRead == true)
+        {
+            s_GT911RequestRead = false;
+            GT911_StartRead(s_GT911PendingIntTime, &woken);
+        }
+        else
+        {
+            s_GT911OperationState = eTouchIdleStateID;
+        }
+    }
+    taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+}
+
+/** @brief Request a read. This function is called from GT911 interrupt,
+ * indicate new data are available on GT911: the read starts at once, or after
+ * the confirm of the read in progress. INT3 must stay at the priority of the
+ * I2C4 master interrupt, so that it cannot nest inside the I2C completion
  *  @param [in]  None   
  *  @param [out]  None
  *  @return None
  */
 void GT911_RequestRead() {
-    s_GT911RequestRead = true;
+    BaseType_t woken = pdFALSE;
+    uint32_t intTime = GT911_ReadCoreTimer();
+    UBaseType_t savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+
+    if (s_GT911OperationState == eTouchIdleStateID) {
+        GT911_StartRead(intTime, &woken);
+    } else if (s_GT911RequestRead == false) {
+        s_GT911RequestRead = true;
+        s_GT911PendingIntTime = intTime;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+    portEND_SWITCHING_ISR(woken);
 }
 
-/** @brief Read state of GT911
+/** @brief Read state of GT911. State is reported as reading while frames were
+ * handled at last GT911_Task, so that screens see touch activity although the
+ * read itself is done within 1 ms
  *  @param [in]  None   
  *  @param [out]  None
  *  @return E_GT911StateID state of touch screen
  */
 E_GT911StateID GT911_GetTouchScreenState()
 {
-    return s_GT911OperationState;
+    E_GT911StateID state = s_GT911OperationState;
+
+    if ((state == eTouchIdleStateID) && (s_isTouchActive == true))
+    {
+        state = eTouchReadStateID;
+    }
+    return state;
 }
 
-/** @brief Maintain state machine to check data ready, read data from GT911
+/** @brief Handle frames queued by I2C completion. Time from interrupt to
+ * touch down injected is measured on frames of a new press only (move and
+ * release frames wait in queue behind them) and traced with statistics
+ *  @param [in]  None   
+ *  @param [out]  None
+ *  @return None
+ */
+static void GT911_HandleFrames(void)
+{
+    uint8_t tail = s_GT911FrameTail;
+    bool isActive = false;
+
+    while (tail != s_GT911FrameHead)
+    {
+        GT911_FRAME_t *frame = &s_GT911FrameQueue[tail];
+        uint32_t latency;
+
+        s_GT911Stat.frameCount++;
+        if (frame->count > s_GT911Stat.maxPointCount)
+            s_GT911Stat.maxPointCount = frame->count;
+        if (GT911_HandleMessage(frame) == true)
+        {
+            latency = (GT911_ReadCoreTimer() - frame->intTime) / GT911_US_SCALE;
+            s_GT911Stat.pressCount++;
+            if (latency > s_GT911Stat.maxLatencyUs)
+                s_GT911Stat.maxLatencyUs = latency;
+            if (s_GT911Stat.pressCount == 1)
+                s_GT911Stat.averageLatencyUs = latency;
+            else
+                s_GT911Stat.averageLatencyUs += ((int32_t)latency - (int32_t)s_GT911Stat.averageLatencyUs)
+                        >> GT911_LATENCY_SHIFT;
+            TRACE(eTraceTouchPressLatencyId, latency, s_GT911Stat.averageLatencyUs, s_GT911Stat.maxLatencyUs,
+                  s_GT911Stat.pressCount, s_GT911Stat.frameCount, s_GT911Stat.lostFrameCount);
+        }
+
+        //frame is used before I2C completion can write it again
+        GT911_BARRIER();
+        tail = (tail + 1) % GT911_FRAME_QUEUE_SIZE;
+        s_GT911FrameTail = tail;
+        isActive = true;
+    }
+    s_isTouchActive = isActive;
+}
+
+/** @brief Maintain state machine, recover from errors and update touch events
+ * read from GT911 to Graphic library. Read and confirm are started from
+ * interrupt and I2C completion, this function gives them up if they are not
+ * done in GT911_PIPELINE_TIMEOUT_MS
  * This function should call forever inside a task
  *  @param [in]  None   
  *  @param [out]  None
@@ -167,71 +472,40 @@ E_GT911StateID GT911_GetTouchScreenState()
 void GT911_Task() {
 
     static uint16_t s_counterErr = 0;
-    uint16_t x = 0;
-    uint16_t y = 0;
-    uint8_t status = 0;
+    bool isTimeout = false;
 //    SYS_PRINT("\nTouch state: [%d]", s_GT911OperationState);
     switch (s_GT911OperationState) {
         case eTouchInitStateID:
             GT911_Initialize();
+            taskENTER_CRITICAL();
+            s_GT911RequestRead = false;
             s_GT911OperationState = eTouchIdleStateID;
+            taskEXIT_CRITICAL();
             break;
         case eTouchIdleStateID:
-            if (s_GT911RequestRead == true) {
-                s_GT911OperationState = eTouchWriteStateID;
-                s_GT911RequestRead = false;
-                //SYS_PRINT("INT3interupt\n");
-            }
-            break;
-        case eTouchWriteStateID:
-            
-            if( I2C4_Write(GT911_WRITE_ADDR, (void*) &GT911ReadCmd[0], sizeof (GT911ReadCmd), 10) == false)
-            {
-                s_GT911OperationState = eTouchErrorStateID;
-            }
-            else
-            {
-                s_GT911OperationState = eTouchReadStateID;
-                s_counterErr = 0;
-            }
             break;
-            
         case eTouchReadStateID:
-            
-            if(I2C4_Read(GT911_READ_ADDR, (void*) &s_CoordinateRawData[0], 7, 10) == false)
-            {
-                s_GT911OperationState = eTouchErrorStateID;
-            }
-            else{
-                s_GT911OperationState = eTouchParseStateID;
-                s_counterErr = 0;
-            }
-            break;
-            
-        case eTouchParseStateID:
-            
-            x = 256 * s_CoordinateRawData[3] + s_CoordinateRawData[2];
-            y = 256 * s_CoordinateRawData[5] + s_CoordinateRawData[4];
-            status = s_CoordinateRawData[0];
-            GT911_HandleMessage(status, x, y);
-
-            //next do confirm read
-            s_GT911OperationState = eTouchConfirmStateID;
-            break;
         case eTouchConfirmStateID:
-
-            if(I2C4_Write(GT911_WRITE_ADDR, (void*) &GT911ConfirmCmd[0], sizeof (GT911ConfirmCmd), 10) == false)
+            taskENTER_CRITICAL();
+            if (((s_GT911OperationState == eTouchReadStateID) || (s_GT911OperationState == eTouchConfirmStateID))
+                && (xTaskGetTickCount() - s_GT911StartTick >= GT911_PIPELINE_TIMEOUT_MS))
             {
+                //completions do not chain anymore
                 s_GT911OperationState = eTouchErrorStateID;
+                isTimeout = true;
             }
-            else
+            taskEXIT_CRITICAL();
+            if (isTimeout)
             {
-                s_GT911OperationState = eTouchIdleStateID;
-                s_counterErr = 0;
+                I2CEngine_Cancel(eI2C4Bus, &s_GT911ReadTransaction);
+                I2CEngine_Cancel(eI2C4Bus, &s_GT911ConfirmTransaction);
             }
             break;
             
         default:
+            //a read refused by the engine leaves I2C4 waiting for recovery,
+            //which is only done in task context
+            I2CEngine_Recover(eI2C4Bus);
             //handle error: try again if 
             s_counterErr++;
             if(s_GT911Error >= 3){
@@ -240,6 +514,12 @@ void GT911_Task() {
             s_GT911OperationState = eTouchInitStateID;
             break;
     }
+
+    GT911_HandleFrames();
+    if (s_isTouchActive)
+    {
+        s_counterErr = 0;
+    }
 }
 
 
@@ -273,58 +553,54 @@ void GT911_UpdateCoordinate(GT911_TOUCH_DATA_t event) {
     s_TouchLastStatus = event;
 }
 
-/** @brief Handle message data has just read from GT911
- *  @param [in]  uint8_t status     status of GT911 device
+/** @brief Handle a frame has just read from GT911. Graphic library takes a
+ * single touch, the first point of the frame is used
+ *  @param [in]  const GT911_FRAME_t *frame     frame read from GT911
  *                              status[7] = 0 -> data not ready
  *                              status[7] = 1 -> data ready
  *                              status[3:0] = 0 -> release event
- *                              status[3:0] = 1 -> press event
- *              uint16_t x      x position
- *              uint16_t y      y position
+ *                              status[3:0] > 0 -> press event, number of points
  *  @param [out]  None
- *  @return None
+ *  @return bool true if a touch down is injected
  */
-void GT911_HandleMessage(uint8_t status, uint16_t x, uint16_t y) {
+bool GT911_HandleMessage(const GT911_FRAME_t *frame) {
     //check MSB bit of status indicate touch driver is ready or not
-    if ((status & 0x80) == 0) {
-        return; //return if driver is not ready
+    if ((frame->status & 0x80) == 0) {
+        return false; //return if driver is not ready
     }
 
-    //SYS_PRINT("\n GT911_HandleMessage (%d,%d)", x, y);
+    //SYS_PRINT("\n GT911_HandleMessage (%d,%d)", frame->points[0].xpos, frame->points[0].ypos);
     
-    uint8_t event = status & 0x0F; //get signal pressed/released by 4 LSB bit
     GT911_TOUCH_DATA_t currentData;
-    currentData.xpos = x;
-    currentData.ypos = y;
-    switch (event) {
-        case 0x01: // touch down / pressed
-            if (s_TouchLastStatus.id != eTouchReleased) { //touch hold
-                if ((s_TouchLastStatus.xpos != currentData.xpos) ||
-                        (s_TouchLastStatus.ypos != currentData.ypos)) {
-                    //set event type
-                    currentData.id = eTouchMove;
-                    //update coordinate
-                    GT911_UpdateCoordinate(currentData);
-                }
-            } else {
-                //touch pressed
-                currentData.id = eTouchPressed;
-                //update coordinate
-                GT911_UpdateCoordinate(currentData);
-            }
-            break;
-        case 0x00: // touch up / released
-            if (s_TouchLastStatus.id != eTouchReleased) {
+    if (frame->count > 0) { // touch down / pressed
+        currentData.xpos = frame->points[0].xpos;
+        currentData.ypos = frame->points[0].ypos;
+        if (s_TouchLastStatus.id != eTouchReleased) { //touch hold
+            if ((s_TouchLastStatus.xpos != currentData.xpos) ||
+                    (s_TouchLastStatus.ypos != currentData.ypos)) {
                 //set event type
-                currentData.id = eTouchReleased;
+                currentData.id = eTouchMove;
                 //update coordinate
                 GT911_UpdateCoordinate(currentData);
             }
-            break;
-
-        default:
-            break;
+        } else {
+            //touch pressed
+            currentData.id = eTouchPressed;
+            //update coordinate
+            GT911_UpdateCoordinate(currentData);
+            return true;
+        }
+    } else { // touch up / released, at last position
+        if (s_TouchLastStatus.id != eTouchReleased) {
+            //set event type
+            currentData.id = eTouchReleased;
+            currentData.xpos = s_TouchLastStatus.xpos;
+            currentData.ypos = s_TouchLastStatus.ypos;
+            //update coordinate
+            GT911_UpdateCoordinate(currentData);
+        }
     }
+    return false;
 }
 
 /** @brief Query any error happen with Touch module
@@ -24,32 +24,28 @@
 extern "C" {
 #endif
 
-    /** @brief State machine for reading coordinate from GT911 driver */
+    /** @brief State machine for reading coordinate from GT911 driver. Read and
+     * confirm are I2C transactions started from interrupt and chained from I2C
+     * completion, without waiting for GUI task */
     typedef enum {
         /**< initialize state: falling this state at start up or error detected */
         eTouchInitStateID,
         /**< idle state: ready for next reading, this state accept interrupt signal
          * from GT911, then start reading coordinate via I2C */
         eTouchIdleStateID,
-        /**< write state: write command to access register internal GT911 to read 
-         * coordinate */
-        eTouchWriteStateID,
-        /**< read state: read data from internal GT911 addrress already selected by
-         * write command above */
+        /**< read state: write address of coordinate register then read status
+         * and all points, with repeated start */
         eTouchReadStateID,
-        /**< parse state: parse raw data has been read, transfer them to coordinate and handle */
-        eTouchParseStateID,
         /**< confirm state: send command to GT911 to confirm the coordinate has been 
          * read, then the GT911 will stop generating interrupt and wait for next change
          * on the touch surface */
         eTouchConfirmStateID,
-        /**< wait state: wait for confirmation above are done */
-        eTouchWaitStateID,
         /**< error state: handle error if occur*/
         eTouchErrorStateID
 
     } E_GT911StateID;
 
+
     /** @brief Initialize GT911 Touch controller, including pull up reset line, open
      * I2C port and ready for communication, reset internal variables
      * This function should call 1 time at start up
@@ -60,8 +56,9 @@ extern "C" {
     void GT911_Initialize();
 
 
-    /** @brief Request a read. This function is called when GT911 interrupt, indicate 
-     * new data are available on GT911 and host should perform a read to update that data
+    /** @brief Request a read. This function is called from GT911 interrupt,
+     * indicate new data are available on GT911: the read starts at once, or
+     * after the confirm of the read in progress
      *  @param [in]  None   
      *  @param [out]  None
      *  @return None
@@ -69,7 +66,8 @@ extern "C" {
     void GT911_RequestRead();
 
 
-    /** @brief Maintain state machine to check data ready, read data from GT911
+    /** @brief Maintain state machine, recover from errors and update touch
+     * events read from GT911 to Graphic library
      * This function should call forever inside a task
      *  @param [in]  None   
      *  @param [out]  None
@@ -17,13 +17,14 @@
 #include <float.h>
 
 #include "FreeRTOS.h"
-#include "semphr.h"
 
 #include "system_config.h"
 #include "system_definitions.h"
 #include "driver/i2c/drv_i2c.h"
 
 #include "I2C_2.h"
+#include "Trace.h"
+#include "I2C_Engine.h"
 #include "AlarmInterface.h"
 #include "ApplicationDefinition.h"
 
@@ -46,19 +47,6 @@ extern DRV_I2C_INIT drvI2C1InitData;
 /** @brief I2C handle */
 static DRV_HANDLE s_I2C2Handle = DRV_HANDLE_INVALID;
 
-/** @brief I2C buffer handle*/
-static DRV_I2C_BUFFER_HANDLE s_I2C2BufferHandle;
-
-/** @brief I2C buffer communication status*/
-static DRV_I2C_BUFFER_EVENT s_I2C2CommStatus;
-
-/** @brief task notification flag, used for synchronization communication when a 
- * I2C transaction completed*/
-static TaskHandle_t s_I2C2NotityFlag = NULL;
-
-/** @brief MUTEX to protect I2C2 sharing */
-static SemaphoreHandle_t s_I2C2Mutex = NULL;
-
 /** @brief Flag indicate I2C2 has error
  * true mean error happened
  * false mean no error */
@@ -68,12 +56,13 @@ static uint8_t s_I2C2ErrCount = 0;
 
 /** @brief internal functions declaration */
 static void I2C2_ReportError();
+static void I2C2_ResetComunicate();
 
 /** @brief I2C2 recovery counter*/
 static uint8_t s_I2C2RecoverCounter = 0;
 
 /** @brief Function to initialize I2C2, used to read data from Air Flow Sensor 
- * and O2 Flow Sensor, including open I2C port, setting callback function, 
+ * and O2 Flow Sensor, including open I2C port, attaching it to I2C engine, 
  * initializing memories before operation
  * This function should be called 1 time at start up
  *  @param [in]  None   
@@ -83,14 +72,8 @@ static uint8_t s_I2C2RecoverCounter = 0;
 void I2C2_Init() {
     if (s_I2C2Handle == DRV_HANDLE_INVALID) {
         s_I2C2Handle = DRV_I2C_Open(I2C_2_INDEX, DRV_IO_INTENT_EXCLUSIVE/*DRV_IO_INTENT_READWRITE*/);
-        /* event-handler set up receive callback from DRV_I2C_Tasks */
-        //DRV_I2C_BufferEventHandlerSet(s_I2C2Handle, I2C2_StatusCallback, s_I2C2CommStatus);
-    }
-
-    //create MUTEX
-    if(s_I2C2Mutex == NULL){
-      s_I2C2Mutex = xSemaphoreCreateMutex();
-      xSemaphoreGive(s_I2C2Mutex);
+        /* transactions are chained by I2C engine from DRV_I2C_Tasks */
+        I2CEngine_Initialize(eI2C2Bus, s_I2C2Handle, I2C2_ResetComunicate);
     }
     
     //reset variables
@@ -116,14 +99,15 @@ static void DelayUs(unsigned long int usDelay )
       while( ReadCoreTimer() - startCnt < waitCnt );
 }
 
-/** @brief This function reset I2C communicate by Flushing Queue
+/** @brief This function recover I2C2 bus by clocking SCL until slave release SDA.
+ * Called by I2C engine, which flushes the driver queue after it
  *  @param [in]  None   
  *  @param [out]  None
  *  @return None
   */
-void I2C2_ResetComunicate() 
+static void I2C2_ResetComunicate() 
 {
-    SYS_PRINT("\nI2C2 error >>> Reset I2C2\n");
+    TRACE(eTraceI2CResetId, 2, 2);
     I2C2STATbits.IWCOL = 0;
     I2C2STATbits.BCL = 0;
     I2C2STATbits.I2COV = 0;
@@ -156,21 +140,46 @@ void I2C2_ResetComunicate()
     
     s_I2C2RecoverCounter = 0;
     I2C2CONbits.I2CEN = 1;
-    I2C2_Init();
-    DRV_I2C_QueueFlush(s_I2C2Handle);
 }
 
-
-bool I2C2_CheckTransferStatus(DRV_I2C_BUFFER_HANDLE drvBufferHandle)
+/** @brief do a transaction via I2C2 and wait for it done. The alarm is raised
+ * after 5 consecutive transactions refused by driver
+ *  @param [in]  uint16_t address: I2C Address need to communicate  
+ *              void *writeBuffer: data to write, NULL if none
+ *              size_t writeSize: size of data to write
+ *              size_t readSize: size of data to read
+ *              uint32_t maxWait: maximum time (in ms) wait for transaction done
+ *  @param [out]  void *readBuffer: storage of read data, NULL if none
+ *  @return None
+ *  @retval true transaction success
+ *  @retval false transaction failed
+ */
+static bool I2C2_Transfer(uint16_t address, void *writeBuffer, size_t writeSize,
+        void *readBuffer, size_t readSize, uint32_t maxWait)
 {
-    if (DRV_I2C_BUFFER_EVENT_COMPLETE == DRV_I2C_TransferStatusGet(s_I2C2Handle, drvBufferHandle))
-    {
-        return true; //ok
+    //check error
+    if (s_I2C2Error != eDeviceNoError) {
+        //report error
+        I2C2_ReportError();
     }
-    else
-    {
-        return false; //fail
+
+    E_I2CTransactionStatus status = I2CEngine_Transfer(eI2C2Bus, address,
+            writeBuffer, writeSize, readBuffer, readSize, maxWait);
+
+    //check result
+    if (status == eI2CTransactionRefused) {
+        s_I2C2ErrCount++;// increase count
+        if (s_I2C2ErrCount >= 5)
+        {
+            //set error flag
+            s_I2C2Error = eDeviceErrorDetected;
+        }
+        TRACE(eTraceI2CRefusedId, 2);
+        return false;
     }
+    
+    s_I2C2ErrCount = 0; //clear count
+    return (status == eI2CTransactionDone);
 }
 
 
@@ -186,63 +195,26 @@ bool I2C2_CheckTransferStatus(DRV_I2C_BUFFER_HANDLE drvBufferHandle)
  *  @retval false write data failed
  */
 bool I2C2_Write(uint16_t address, void *writeBuffer, size_t size, uint32_t maxWait) {
-    
-    // DEBUG
-//    int i;
-//    SYS_PRINT("\nAddress...: %d", address);
-//    for ( i = 0; i < size; i++)
-//    {
-//        SYS_PRINT("   %d   ", (int)writeBuffer[i]);
-//    }
-//    SYS_PRINT("\n\n");
-    //check error
-    if (s_I2C2Error != eDeviceNoError) {
-        //report error
-        //SYS_PRINT("report error\n");
-        I2C2_ReportError();
-        //return false;
-    }
-    static uint8_t s_errCnt = 0;
-  
-    uint32_t maxWaitTime = maxWait;
-    DRV_I2C_BUFFER_HANDLE s_I2C2BufferHandle; 
-    s_I2C2BufferHandle = DRV_I2C_Transmit(s_I2C2Handle,
-                address,
-                (void*) writeBuffer,
-                size,
-                NULL);
+    return I2C2_Transfer(address, writeBuffer, size, NULL, 0, maxWait);
+}
 
-    //check result
-    if (s_I2C2BufferHandle == DRV_I2C_BUFFER_HANDLE_INVALID) {
-        
-        s_I2C2ErrCount++;// increase count
-        if (s_I2C2ErrCount >= 5)
-        {
-            //set error flag
-            s_I2C2Error = eDeviceErrorDetected;
-        }
-        SYS_PRINT("I2C2: DRV_I2C_BUFF_Transmit_INVALID\n");
-        I2C2_ResetComunicate();
-        return false; //error
-    } 
-    else {
-      s_I2C2ErrCount = 0; //clear count
-      vTaskDelay(1);
-      while (!I2C2_CheckTransferStatus(s_I2C2BufferHandle))
-      {
-          vTaskDelay(1);
-          maxWaitTime--;
-          if(maxWaitTime == 0)
-          {
-              //I2C2_ResetComunicate();
-              //s_errCnt++; if(s_errCnt >= 5){I2C2_ResetComunicate(); s_errCnt = 0;} 
-              return false;
-          }
-      }
-      //SYS_PRINT("I2C2timeoutW_%d\n", /*maxWait - */maxWaitTime);
-      return true;
-    }
-    
+
+/** @brief write a packet data then read data via I2C2 with repeated start, and
+ * wait for it done
+ *  @param [in]  uint16_t address: I2C Address need to communicate  
+ *              void *writeBuffer: pointer to data packet
+ *              size_t writeSize: size of data packet 
+ *              size_t readSize: size of data expect to read 
+ *              uint32_t maxWait: maximum time (in ms) wait for transaction done. 
+ * If over time, return error
+ *  @param [out]  void *readBuffer: pointer to store buffer
+ *  @return None
+ *  @retval true write then read data success
+ *  @retval false write then read data failed
+ */
+bool I2C2_WriteThenRead(uint16_t address, void *writeBuffer, size_t writeSize,
+                        void *readBuffer, size_t readSize, uint32_t maxWait) {
+    return I2C2_Transfer(address, writeBuffer, writeSize, readBuffer, readSize, maxWait);
 }
 
 
@@ -258,57 +230,7 @@ bool I2C2_Write(uint16_t address, void *writeBuffer, size_t size, uint32_t maxWa
  */
 bool I2C2_Read(uint16_t address, void *readBuffer, size_t size, uint32_t maxWait)
 {
-    //check error
-    if (s_I2C2Error != eDeviceNoError) {
-        //report error
-        I2C2_ReportError();
-        //return false;
-    }
-  
-    uint32_t maxWaitTime = maxWait;
-    DRV_I2C_BUFFER_HANDLE s_I2C2BufferHandle; 
-    s_I2C2BufferHandle = DRV_I2C_Receive(s_I2C2Handle,
-            address,
-            (void*) readBuffer,
-            size,
-            NULL
-            );
-
-    //check result
-    if (s_I2C2BufferHandle == DRV_I2C_BUFFER_HANDLE_INVALID) {
-        s_I2C2ErrCount++;// increase count
-        if (s_I2C2ErrCount >= 5)
-        {
-            //set error flag
-            s_I2C2Error = eDeviceErrorDetected;
-        }
-        SYS_PRINT("I2C2: DRV_I2C_BUFF_Receive_INVALID\n");
-        //SYS_PRINT("%X\n", s_I2C2Handle);
-        I2C2_ResetComunicate();
-        return false;
-    } 
-    else {
-        s_I2C2ErrCount = 0; //clear count
-        vTaskDelay(1);
-        while (!I2C2_CheckTransferStatus(s_I2C2BufferHandle))
-        {
-            vTaskDelay(1);
-            maxWaitTime--;
-            if(maxWaitTime == 0)
-            {            
-                //Disable I2C and then Enable to reset I2C module
-                //I2C2_ResetComunicate();
-                DRV_I2C_BUFFER_EVENT i2cstatus;
-                i2cstatus = DRV_I2C_TransferStatusGet(s_I2C2Handle, s_I2C2BufferHandle);
-                SYS_PRINT("I2C_2 StatusGet %d\n", i2cstatus);
-                return false;
-            }
-        }
-        //SYS_PRINT("I2C2timeoutR_%d\n", /*maxWait - */maxWaitTime);
-        return true;
-    }
-    
-    
+    return I2C2_Transfer(address, NULL, 0, readBuffer, size, maxWait);
 }
 
 
@@ -56,6 +56,19 @@ extern "C" {
             uint32_t maxWait);
 
 
+    /** @brief write a packet data then read data via I2C2 with repeated start, and
+     * wait for it done
+     *  @param [in]  uint16_t address: I2C Address need to communicate  
+     *              void *writeBuffer: pointer to data packet
+     *              size_t writeSize: size of data packet 
+     *              size_t readSize: size of data expect to read 
+     *              uint32_t maxWait: maximum time (in ms) wait for transaction done. 
+     * If over time, return error
+     *  @param [out]  void *readBuffer: pointer to store buffer
+     *  @return None
+     *  @retval true write then read data success
+     *  @retval false write then read data failed
+     */
     bool I2C2_WriteThenRead(uint16_t address,void *writeBuffer, size_t writeSize,
                               void *readBuffer, size_t readSize, uint32_t maxWait);
     
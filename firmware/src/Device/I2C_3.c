@@ -20,7 +20,6 @@
 #include <float.h>
 
 #include "FreeRTOS.h"
-#include "semphr.h"
 
 #include "system_config.h"
 #include "system_definitions.h"
@@ -28,6 +27,8 @@
 
 
 #include "I2C_3.h"
+#include "Trace.h"
+#include "I2C_Engine.h"
 #include "AlarmInterface.h"
 #include "ApplicationDefinition.h"
 
@@ -46,19 +47,6 @@ extern const DRV_I2C_INIT drvI2C3InitData;
 /** @brief I2C flow sensor handle */
 static DRV_HANDLE s_I2C3Handle = DRV_HANDLE_INVALID;
 
-/** @brief I2C flow sensor buffer handle*/
-static DRV_I2C_BUFFER_HANDLE s_I2C3BufferHandle;
-
-/** @brief I2C buffer communication status*/
-static DRV_I2C_BUFFER_EVENT s_I2C3CommStatus;
-
-/** @brief task notification flag, used for synchronization communication when a 
- * I2C transaction completed*/
-static TaskHandle_t s_I2C3NotityFlag = NULL;
-
-/** @brief mutex to protect I2C 4 sharing */
-//static SemaphoreHandle_t s_I2C3Mutex = NULL;
-
 /** @brief Flag indicate I2C3 has error
  * true mean error happened
  * false mean no error */
@@ -68,6 +56,7 @@ static uint8_t s_I2C3RecoverCounter = 0;
 
 /** @brief internal functions declaration */
 static void I2C3_ReportError();
+static void I2C3_ResetComunicate();
 
 
 static uint32_t ReadCoreTimer()
@@ -89,21 +78,9 @@ static void DelayUs(unsigned long int usDelay )
       while( ReadCoreTimer() - startCnt < waitCnt );
 }
 
-bool I2C3_CheckTransferStatus(DRV_I2C_BUFFER_HANDLE drvBufferHandle)
-{
-    if (DRV_I2C_BUFFER_EVENT_COMPLETE == DRV_I2C_TransferStatusGet(s_I2C3Handle, drvBufferHandle))
-    {
-        return true; //ok
-    }
-    else
-    {
-        return false; //fail
-    }
-}
-
 /** @brief Function to initialize I2C3, used to communicate with multiple devices\
- * such as: BME280, ADXL345, and Audio Codec. including open I2C port, setting 
- * callback function, initializing memories before operation
+ * such as: BME280, ADXL345, and Audio Codec. including open I2C port, 
+ * attaching it to I2C engine, initializing memories before operation
  * This function should be called 1 time at start up
  *  @param [in]  None   
  *  @param [out]  None
@@ -112,25 +89,23 @@ bool I2C3_CheckTransferStatus(DRV_I2C_BUFFER_HANDLE drvBufferHandle)
 void I2C3_Initialize() {
     if (s_I2C3Handle == DRV_HANDLE_INVALID) {
         s_I2C3Handle = DRV_I2C_Open(I2C_3_INDEX, DRV_IO_INTENT_EXCLUSIVE);
-        /* event-handler set up receive callback from DRV_I2C_Tasks */
+        /* transactions are chained by I2C engine from DRV_I2C_Tasks */
+        I2CEngine_Initialize(eI2C3Bus, s_I2C3Handle, I2C3_ResetComunicate);
     }
-
-    //create Mutex
-    //s_I2C3Mutex = xSemaphoreCreateMutex();
-    //xSemaphoreGive(s_I2C3Mutex);
     
     //reset variables
     s_I2C3Error = eDeviceNoError;
 }
 
-/** @brief This function reset I2C communicate by Flushing Queue
+/** @brief This function recover I2C3 bus by clocking SCL until slave release SDA.
+ * Called by I2C engine, which flushes the driver queue after it
  *  @param [in]  None   
  *  @param [out]  None
  *  @return None
   */
 static void I2C3_ResetComunicate() 
 {
-    SYS_PRINT("\nI2C3 error >>> Reset I2C3\n");
+    TRACE(eTraceI2CResetId, 3, 3);
     I2C3STATbits.IWCOL = 0;
     I2C3STATbits.BCL = 0;
     I2C3STATbits.I2COV = 0;
@@ -163,8 +138,6 @@ static void I2C3_ResetComunicate()
     
     s_I2C3RecoverCounter = 0;
     I2C3CONbits.I2CEN = 1;
-    I2C3_Initialize();
-    DRV_I2C_QueueFlush(s_I2C3Handle);
 }
 
 
@@ -181,41 +154,8 @@ static void I2C3_ResetComunicate()
  */
 bool I2C3_Write(uint16_t address, void *writeBuffer, size_t size, uint32_t maxWait) 
 {
-    //check error and report
-    //    if (s_I2C3Error != eDeviceNoError) {
-    //        //report error
-    //        I2C3_ReportError();
-    //        return false;
-    //    }
-    
-    s_I2C3BufferHandle = DRV_I2C_Transmit(s_I2C3Handle, address,(void*)  writeBuffer, size, NULL);
-    uint8_t timeout = 0;
-    if (s_I2C3BufferHandle == DRV_I2C_BUFFER_HANDLE_INVALID)
-    {
-        SYS_PRINT("I2C3: DRV_I2C_BUFF_Transmit_INVALID\n");
-        I2C3_ResetComunicate();
-        return false; //error
-    } 
-    else 
-    {
-        //vTaskDelay(1);
-        DelayUs(100);
-        while (!I2C3_CheckTransferStatus(s_I2C3BufferHandle))
-        {
-            vTaskDelay(1);
-            timeout++;
-            if(timeout >= maxWait){
-                //I2C3_ResetComunicate();
-//                static uint8_t s_errCnt = 0;
-//                s_errCnt++; if(s_errCnt >= 2){I2C3_ResetComunicate(); s_errCnt = 0;} 
-                return false;
-            }
-        }
-        //SYS_PRINT("timeout_%d\n", timeout);
-        //return true;
-    }  
-    
-    return true;
+    return (I2CEngine_Transfer(eI2C3Bus, address, writeBuffer, size, NULL, 0, maxWait)
+            == eI2CTransactionDone);
 }
 
 /** @brief read data via I2C3 and wait for it done
@@ -230,45 +170,10 @@ bool I2C3_Write(uint16_t address, void *writeBuffer, size_t size, uint32_t maxWa
  */
 bool I2C3_Read(uint16_t address, void *readBuffer, size_t size, uint32_t maxWait) 
 {
-    //check error
-//    if (s_I2C3Error != eDeviceNoError) {
-//        //report error
-//        I2C3_ReportError();
-//        return false;
-//    }
-    
-    
-    s_I2C3BufferHandle = DRV_I2C_Receive(s_I2C3Handle, address,(void*)  readBuffer, size, NULL);
-    uint8_t timeout = 0;
-    if (s_I2C3BufferHandle == DRV_I2C_BUFFER_HANDLE_INVALID) {
-
-        SYS_PRINT("I2C3: DRV_I2C_BUFF_Receive_INVALID\n");
-        I2C3_ResetComunicate();
-        return false; //error
-    } 
-    else {
-        //vTaskDelay(1);//2
-        DelayUs(300);
-        while (!I2C3_CheckTransferStatus(s_I2C3BufferHandle))
-        {
-            vTaskDelay(1);
-            timeout++;
-            if(timeout >= maxWait){
-                //I2C3_ResetComunicate();
-//                static uint8_t s_errCnt = 0;
-//                s_errCnt++; if(s_errCnt >= 2){I2C3_ResetComunicate(); s_errCnt = 0;} 
-                return false;
-            }
-        }
-        //SYS_PRINT("timeoutRd_%d\n", timeout);
-        //return true;
-    } 
-   
-    return true;
+    return (I2CEngine_Transfer(eI2C3Bus, address, NULL, 0, readBuffer, size, maxWait)
+            == eI2CTransactionDone);
 }
 
-
-
 /** @brief report error if occur during communication via I2C3, may be send event
  * to Alarm task
  *  @param [in]  None 
@@ -280,7 +185,7 @@ void I2C3_ReportError() {
     if (s_I2C3Error == eDeviceErrorDetected) {
         //send event to alarm task
         alarmInterface_SendEvent(eI2C3ErrorAlarm, eActive, eHighPriority, 0);
-        SYS_PRINT("\n error at: I2C3_ReportError");
+        TRACE(eTraceI2CReportErrorId, 3);
         //change state
         s_I2C3Error = eDeviceErrorReported;
     }
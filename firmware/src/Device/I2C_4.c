@@ -18,13 +18,14 @@
 #include <float.h>
 
 #include "FreeRTOS.h"
-#include "semphr.h"
 
 #include "system_config.h"
 #include "system_definitions.h"
 #include "driver/i2c/drv_i2c.h"
 
 #include "I2C_4.h"
+#include "Trace.h"
+#include "I2C_Engine.h"
 #include "AlarmInterface.h"
 #include "ApplicationDefinition.h"
 
@@ -42,19 +43,6 @@ DRV_HANDLE s_I2C4Handle = DRV_HANDLE_INVALID;
 /** @brief delay to create clock for recovery */
 #define I2C_RECOVER_CLOCK_DELAY_US  (1000000U / (2U * I2C_RECOVER_CLOCK_FREQ))
 
-/** @brief I2C flow sensor buffer handle*/
-static DRV_I2C_BUFFER_HANDLE s_I2C4BufferHandle;
-
-/** @brief I2C buffer communication status*/
-static DRV_I2C_BUFFER_EVENT s_I2C4CommStatus;
-
-/** @brief task notification flag, used for synchronization communication when a 
- * I2C transaction completed*/
-static TaskHandle_t s_I2C4NotityFlag = NULL;
-
-/** @brief mutex to protect I2C 4 sharing */
-static SemaphoreHandle_t s_I2C4Mutex = NULL;
-
 /** @brief Flag indicate I2C4 has error
  * true mean error happened
  * false mean no error */
@@ -65,6 +53,7 @@ static uint8_t s_I2C4RecoverCounter = 0;
 
 /** @brief internal functions declaration */
 static void I2C4_ReportError();
+static void I2C4_ResetComunicate();
 
 static uint32_t ReadCoreTimer()
 {
@@ -85,21 +74,9 @@ static void DelayUs(unsigned long int usDelay )
       while( ReadCoreTimer() - startCnt < waitCnt );
 }
 
-bool I2C4_CheckTransferStatus(DRV_I2C_BUFFER_HANDLE drvBufferHandle)
-{
-    if (DRV_I2C_BUFFER_EVENT_COMPLETE == DRV_I2C_TransferStatusGet(s_I2C4Handle, drvBufferHandle))
-    {
-        return true; //ok
-    }
-    else
-    {
-        return false; //fail
-    }
-}
-
 /** @brief Function to initialize I2C4, used to communicate with multiple devices\
- * such as: BME280, ADXL345, and Audio Codec. including open I2C port, setting 
- * callback function, initializing memories before operation
+ * such as: BME280, ADXL345, and Audio Codec. including open I2C port, 
+ * attaching it to I2C engine, initializing memories before operation
  * This function should be called 1 time at start up
  *  @param [in]  None   
  *  @param [out]  None
@@ -110,26 +87,23 @@ void I2C4_Initialize() {
 //    DRV_I2C_Bus_Clear(sysObj.drvI2C3);
     if (s_I2C4Handle == DRV_HANDLE_INVALID) {
         s_I2C4Handle = DRV_I2C_Open(I2C_4_INDEX, DRV_IO_INTENT_READWRITE);
-        /* event-handler set up receive callback from DRV_I2C_Tasks */
-        //DRV_I2C_BufferEventHandlerSet(s_I2C4Handle, I2C4_StatusCallback, s_I2C4CommStatus);
+        /* transactions are chained by I2C engine from DRV_I2C_Tasks */
+        I2CEngine_Initialize(eI2C4Bus, s_I2C4Handle, I2C4_ResetComunicate);
     }
-
-    //create Mutex
-    s_I2C4Mutex = xSemaphoreCreateMutex();
-    xSemaphoreGive(s_I2C4Mutex);
     
     //reset variables
     s_I2C4Error = eDeviceNoError;
 }
 
-/** @brief This function reset I2C communicate by Flushing Queue
+/** @brief This function recover I2C4 bus by clocking SCL until slave release SDA.
+ * Called by I2C engine, which flushes the driver queue after it
  *  @param [in]  None   
  *  @param [out]  None
  *  @return None
   */
-void I2C4_ResetComunicate() 
+static void I2C4_ResetComunicate() 
 {
-    SYS_PRINT("\nI2C4 error >>> Reset I2C4\n");
+    TRACE(eTraceI2CResetId, 4, 4);
 
     I2C4STATbits.IWCOL = 0;
     I2C4STATbits.BCL = 0;
@@ -160,8 +134,6 @@ void I2C4_ResetComunicate()
     
     s_I2C4RecoverCounter = 0;
     I2C4CONbits.I2CEN = 1;
-    I2C4_Initialize();
-    DRV_I2C_QueueFlush(s_I2C4Handle); 
 }
 
 
@@ -178,45 +150,8 @@ void I2C4_ResetComunicate()
  */
 bool I2C4_Write(uint16_t address, void *writeBuffer, size_t size, uint32_t maxWait) 
 {
-    //check error
-    //    if (s_I2C4Error != eDeviceNoError) {
-    //        //report error
-    //        I2C4_ReportError();
-    //        return false;
-    //    }
-    
-    //take resource 
-    if (xSemaphoreTake(s_I2C4Mutex, maxWait) == pdFALSE) {
-        //report error
-        //I2C4_ReportError();
-        return false;
-    }
-
-    s_I2C4BufferHandle = DRV_I2C_Transmit(s_I2C4Handle, address,(void*)  writeBuffer, size, NULL);
-    uint8_t timeout = 0;
-    if (s_I2C4BufferHandle == DRV_I2C_BUFFER_HANDLE_INVALID) 
-    {
-        xSemaphoreGive(s_I2C4Mutex);
-        I2C4_ResetComunicate();
-        return false; //error
-    } 
-    else 
-    {
-        //vTaskDelay(1);
-        DelayUs(100);
-        while (!I2C4_CheckTransferStatus(s_I2C4BufferHandle))
-        {
-            vTaskDelay(1);
-            timeout++;
-            if(timeout >= maxWait){
-                xSemaphoreGive(s_I2C4Mutex);
-                //I2C4_ResetComunicate();
-                return false;
-            }
-        }
-    }  
-    xSemaphoreGive(s_I2C4Mutex);
-    return true;
+    return (I2CEngine_Transfer(eI2C4Bus, address, writeBuffer, size, NULL, 0, maxWait)
+            == eI2CTransactionDone);
 }
 
 /** @brief read data via I2C4 and wait for it done
@@ -231,50 +166,10 @@ bool I2C4_Write(uint16_t address, void *writeBuffer, size_t size, uint32_t maxWa
  */
 bool I2C4_Read(uint16_t address, void *readBuffer, size_t size, uint32_t maxWait) 
 {
-    //check error
-//    if (s_I2C4Error != eDeviceNoError) {
-//        //report error
-//        I2C4_ReportError();
-//        return false;
-//    }
-    
-    //take resource 
-    if (xSemaphoreTake(s_I2C4Mutex, maxWait) == pdFALSE) {
-        //report error
-        //I2C4_ReportError();
-        return false;
-    }
-    
-    s_I2C4BufferHandle = DRV_I2C_Receive(s_I2C4Handle, address,(void*)  readBuffer, size, NULL);
-    uint8_t timeout = 0;
-    if (s_I2C4BufferHandle == DRV_I2C_BUFFER_HANDLE_INVALID)
-    {
-        xSemaphoreGive(s_I2C4Mutex);
-        I2C4_ResetComunicate();
-        return false; //error
-    } 
-    else 
-    {
-        //vTaskDelay(1);
-        DelayUs(300);
-        while (!I2C4_CheckTransferStatus(s_I2C4BufferHandle))
-        {
-            vTaskDelay(1);
-            timeout++;
-            if(timeout >= maxWait)
-            {
-                xSemaphoreGive(s_I2C4Mutex);
-                //I2C4_ResetComunicate();
-                return false;
-            }
-        }
-    } 
-     
-    xSemaphoreGive(s_I2C4Mutex);
-    return true;
+    return (I2CEngine_Transfer(eI2C4Bus, address, NULL, 0, readBuffer, size, maxWait)
+            == eI2CTransactionDone);
 }
 
-
 /** @brief report error if occur during communication via I2C4, may be send event
  * to Alarm task
  *  @param [in]  None 
@@ -286,7 +181,7 @@ void I2C4_ReportError() {
     if (s_I2C4Error == eDeviceErrorDetected) {
         //send event to alarm task
         alarmInterface_SendEvent(eI2C4ErrorAlarm, eActive, eHighPriority, 0);
-        SYS_PRINT("\n error at: I2C4_ReportError");
+        TRACE(eTraceI2CReportErrorId, 4);
         //change state
         s_I2C4Error = eDeviceErrorReported;
     }
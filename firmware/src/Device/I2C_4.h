@@ -72,8 +72,6 @@ extern "C" {
             void *readBuffer,
             size_t size,
             uint32_t maxWait);
-
-    void I2C4_ResetComunicate();
     
     /* Provide C++ Compatibility */
 #ifdef __cplusplus
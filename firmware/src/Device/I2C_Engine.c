@@ -0,0 +1,496 @@
+/* ************************************************************************** */
+/** @file [I2C_Engine.c]
+ *  @brief {queue of I2C transactions shared by I2C1..I2C4. Only one transaction
+ * is given to the Harmony driver at a time, the next one is started from the
+ * driver event handler (I2C interrupt) so that back to back transactions are
+ * chained without polling}
+ */
+/* ************************************************************************** */
+
+
+
+/* This section lists the other files that are included in this file.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "system_config.h"
+#include "system_definitions.h"
+#include "driver/i2c/drv_i2c.h"
+
+#include "I2C_Engine.h"
+#include "Trace.h"
+
+/** @brief core timer counts per us */
+#define I2C_ENGINE_US_SCALE         (SYS_CLK_FREQ / 2000000)
+
+/** @brief weight of new latency in average latency (1 / 2^n) */
+#define I2C_ENGINE_LATENCY_SHIFT    (4)
+
+/** @brief state of a bus */
+typedef struct
+{
+    DRV_HANDLE handle;                  /**<handle of Harmony driver */
+    I2C_RECOVER_FNC recover;            /**<bus recovery by the pins of the port */
+    I2C_TRANSACTION_t *queue[I2C_ENGINE_QUEUE_SIZE]; /**<waiting transactions */
+    uint8_t head;                       /**<index of first waiting transaction */
+    uint8_t count;                      /**<number of waiting transactions */
+    I2C_TRANSACTION_t *active;          /**<transaction on the bus */
+    DRV_I2C_BUFFER_HANDLE bufferHandle; /**<driver buffer of active transaction */
+    bool isRecoverRequired;             /**<bus must be recovered before next transaction */
+    bool isRecovering;                  /**<a task is recovering the bus */
+    I2C_BUS_STAT_t stat;                /**<statistics */
+} I2C_BUS_t;
+
+/** @brief state of all buses */
+static I2C_BUS_t s_i2cBus[eNumberOfI2CBus] = {
+    [0 ... eNumberOfI2CBus - 1] = {
+        .handle = DRV_HANDLE_INVALID,
+        .bufferHandle = DRV_I2C_BUFFER_HANDLE_INVALID
+    }
+};
+
+/** @brief read core timer, 1 count each 2 system clocks
+ *  @param [in]  None
+ *  @param [out]  None
+ *  @return uint32_t core timer
+ */
+static uint32_t I2CEngine_ReadCoreTimer(void)
+{
+    volatile uint32_t timer;
+
+    // get the count reg
+    asm volatile("mfc0   %0, $9" : "=r"(timer));
+
+    return(timer);
+}
+
+/** @brief finish active transaction: update statistics, notify the owner and
+ * release the bus. Must be called with interrupts of the bus masked (critical
+ * section or I2C interrupt)
+ *  @param [in]  I2C_BUS_t *bus: bus
+ *              I2C_TRANSACTION_t *t: finished transaction
+ *              E_I2CTransactionStatus status: result of transaction
+ *  @param [out]  BaseType_t *woken: set if a higher priority task is woken,
+ * NULL in task context
+ *  @return None
+ */
+static void I2CEngine_Finish(I2C_BUS_t *bus, I2C_TRANSACTION_t *t,
+        E_I2CTransactionStatus status, BaseType_t *woken)
+{
+    uint32_t latency = (I2CEngine_ReadCoreTimer() - t->startTime) / I2C_ENGINE_US_SCALE;
+
+    bus->stat.transactionCount++;
+    if (status == eI2CTransactionError)
+        bus->stat.errorCount++;
+    else if (status == eI2CTransactionRefused)
+        bus->stat.refusedCount++;
+    if (bus->stat.queueDepth > 0)
+        bus->stat.queueDepth--;
+
+    if (latency > bus->stat.maxLatencyUs)
+        bus->stat.maxLatencyUs = latency;
+    bus->stat.averageLatencyUs += ((int32_t)latency - (int32_t)bus->stat.averageLatencyUs)
+            >> I2C_ENGINE_LATENCY_SHIFT;
+
+    if (t->callback != NULL)
+        t->callback(status, t->context);
+
+    //status is set last, after it the descriptor belongs to the caller
+    TaskHandle_t task = t->notifyTask;
+    t->status = status;
+    if (task != NULL)
+    {
+        if (woken != NULL)
+            xTaskNotifyFromISR(task, I2C_ENGINE_NOTIFY_BIT, eSetBits, woken);
+        else
+            xTaskNotify(task, I2C_ENGINE_NOTIFY_BIT, eSetBits);
+    }
+}
+
+/** @brief give the first waiting transaction to the driver if bus is free.
+ * Must be called with interrupts of the bus masked (critical section or I2C
+ * interrupt)
+ *  @param [in]  E_I2CBusId id: bus
+ *  @param [out]  BaseType_t *woken: set if a higher priority task is woken,
+ * NULL in task context
+ *  @return None
+ */
+static void I2CEngine_StartNext(E_I2CBusId id, BaseType_t *woken)
+{
+    I2C_BUS_t *bus = &s_i2cBus[id];
+
+    while ((bus->active == NULL) && (bus->count > 0) && !bus->isRecoverRequired)
+    {
+        I2C_TRANSACTION_t *t = bus->queue[bus->head];
+        bus->head = (bus->head + 1) % I2C_ENGINE_QUEUE_SIZE;
+        bus->count--;
+
+        bus->active = t;
+        if ((t->writeSize > 0) && (t->readSize > 0))
+        {
+            bus->bufferHandle = DRV_I2C_TransmitThenReceive(bus->handle, t->address,
+                    t->writeBuffer, t->writeSize, t->readBuffer, t->readSize, (void*)(uintptr_t)id);
+        }
+        else if (t->readSize > 0)
+        {
+            bus->bufferHandle = DRV_I2C_Receive(bus->handle, t->address,
+                    t->readBuffer, t->readSize, (void*)(uintptr_t)id);
+        }
+        else
+        {
+            bus->bufferHandle = DRV_I2C_Transmit(bus->handle, t->address,
+                    t->writeBuffer, t->writeSize, (void*)(uintptr_t)id);
+        }
+
+        if (bus->bufferHandle == DRV_I2C_BUFFER_HANDLE_INVALID)
+        {
+            //driver refused, bus is recovered by next caller in task context
+            bus->active = NULL;
+            bus->isRecoverRequired = true;
+            I2CEngine_Finish(bus, t, eI2CTransactionRefused, woken);
+        }
+    }
+}
+
+/** @brief Callback from DRV_I2C_Tasks when a transaction is completed. This
+ * function is called in ISR, should not put any debug here
+ *  @param [in]  DRV_I2C_BUFFER_EVENT event: status of the transaction (complete, failed, ...)
+ *              DRV_I2C_BUFFER_HANDLE bufferHandle: buffer of the transaction
+ *              uintptr_t context: bus id
+ *  @param [out]  None
+ *  @return None
+ */
+static void I2CEngine_EventHandler(DRV_I2C_BUFFER_EVENT event,
+        DRV_I2C_BUFFER_HANDLE bufferHandle,
+        uintptr_t context)
+{
+    E_I2CBusId id = (E_I2CBusId)context;
+    I2C_BUS_t *bus;
+    I2C_TRANSACTION_t *t;
+    BaseType_t woken = pdFALSE;
+
+    if (id >= eNumberOfI2CBus)
+        return;
+    bus = &s_i2cBus[id];
+
+    //ignore buffer removed by timeout and intermediate events
+    if ((bus->active == NULL) || (bufferHandle != bus->bufferHandle))
+        return;
+    if ((event != DRV_I2C_BUFFER_EVENT_COMPLETE) && (event != DRV_I2C_BUFFER_EVENT_ERROR))
+        return;
+
+    t = bus->active;
+    bus->active = NULL;
+    bus->bufferHandle = DRV_I2C_BUFFER_HANDLE_INVALID;
+    I2CEngine_Finish(bus, t, (event == DRV_I2C_BUFFER_EVENT_COMPLETE)
+            ? eI2CTransactionDone : eI2CTransactionError, &woken);
+
+    I2CEngine_StartNext(id, &woken);
+    portEND_SWITCHING_ISR(woken);
+}
+
+/** @brief recover a bus after a refused or timed out transaction and start
+ * waiting transactions again. If another task is recovering the bus, wait
+ * for it, so that on return the driver queue is flushed. Called from task context
+ *  @param [in]  E_I2CBusId id: bus
+ *  @param [out]  None
+ *  @return None
+ */
+void I2CEngine_Recover(E_I2CBusId id)
+{
+    I2C_BUS_t *bus;
+    bool isOwner = false;
+    bool isRecovering;
+
+    if (id >= eNumberOfI2CBus)
+        return;
+    bus = &s_i2cBus[id];
+
+    //only 1 task drives the pins
+    do
+    {
+        taskENTER_CRITICAL();
+        isRecovering = bus->isRecovering;
+        if (bus->isRecoverRequired && !isRecovering)
+        {
+            bus->isRecovering = true;
+            isOwner = true;
+        }
+        taskEXIT_CRITICAL();
+        if (isRecovering)
+            vTaskDelay(1);
+    } while (isRecovering);
+    if (!isOwner)
+        return;
+
+    if (bus->recover != NULL)
+        bus->recover();
+    DRV_I2C_QueueFlush(bus->handle);
+
+    taskENTER_CRITICAL();
+    bus->stat.recoverCount++;
+    bus->isRecoverRequired = false;
+    bus->isRecovering = false;
+    bus->bufferHandle = DRV_I2C_BUFFER_HANDLE_INVALID;
+    I2CEngine_StartNext(id, NULL);
+    taskEXIT_CRITICAL();
+}
+
+/** @brief Attach an opened Harmony I2C driver to a bus of the engine
+ * This function should be called 1 time at start up, by I2Cx_Initialize
+ *  @param [in]  E_I2CBusId id: bus
+ *              DRV_HANDLE handle: handle of the opened driver
+ *              I2C_RECOVER_FNC recover: bus recovery of the port
+ *  @param [out]  None
+ *  @return None
+ */
+void I2CEngine_Initialize(E_I2CBusId id, DRV_HANDLE handle, I2C_RECOVER_FNC recover)
+{
+    I2C_BUS_t *bus;
+
+    if (id >= eNumberOfI2CBus)
+        return;
+    bus = &s_i2cBus[id];
+
+    bus->handle = handle;
+    bus->recover = recover;
+    if (handle != DRV_HANDLE_INVALID)
+    {
+        /* event-handler set up receive callback from DRV_I2C_Tasks */
+        DRV_I2C_BufferEventHandlerSet(handle, I2CEngine_EventHandler, (uintptr_t)id);
+    }
+}
+
+/** @brief Queue a transaction on a bus and return at once. Completion is
+ * notified by callback and/or task notification of the descriptor
+ *  @param [in]  E_I2CBusId id: bus
+ *              I2C_TRANSACTION_t *transaction: descriptor, kept by the caller until done
+ *  @param [out]  None
+ *  @retval true transaction is queued or already finished (see its status)
+ *  @retval false queue is full or bus is not initialized
+ */
+bool I2CEngine_Submit(E_I2CBusId id, I2C_TRANSACTION_t *transaction)
+{
+    I2C_BUS_t *bus;
+    bool isQueued = false;
+
+    if ((id >= eNumberOfI2CBus) || (transaction == NULL))
+        return false;
+    bus = &s_i2cBus[id];
+    if (bus->handle == DRV_HANDLE_INVALID)
+        return false;
+
+    if (bus->isRecoverRequired)
+        I2CEngine_Recover(id);
+
+    transaction->status = eI2CTransactionPending;
+    transaction->startTime = I2CEngine_ReadCoreTimer();
+
+    taskENTER_CRITICAL();
+    if (bus->count < I2C_ENGINE_QUEUE_SIZE)
+    {
+        bus->queue[(bus->head + bus->count) % I2C_ENGINE_QUEUE_SIZE] = transaction;
+        bus->count++;
+        bus->stat.queueDepth++;
+        if (bus->stat.queueDepth > bus->stat.maxQueueDepth)
+            bus->stat.maxQueueDepth = bus->stat.queueDepth;
+        I2CEngine_StartNext(id, NULL);
+        isQueued = true;
+    }
+    else
+    {
+        bus->stat.refusedCount++;
+    }
+    taskEXIT_CRITICAL();
+
+    if (!isQueued)
+        transaction->status = eI2CTransactionRefused;
+    return isQueued;
+}
+
+/** @brief Queue a transaction on a bus from interrupt, or from the callback of
+ * another transaction to chain them, and return at once. A bus waiting for
+ * recovery refuses the transaction, as recovery is done in task context
+ *  @param [in]  E_I2CBusId id: bus
+ *              I2C_TRANSACTION_t *transaction: descriptor, kept by the caller until done
+ *  @param [out]  BaseType_t *woken: set if a higher priority task is woken
+ *  @retval true transaction is queued or already finished (see its status)
+ *  @retval false queue is full, bus is not initialized or waits for recovery
+ */
+bool I2CEngine_SubmitFromISR(E_I2CBusId id, I2C_TRANSACTION_t *transaction, BaseType_t *woken)
+{
+    I2C_BUS_t *bus;
+    bool isQueued = false;
+    UBaseType_t savedInterruptStatus;
+
+    if ((id >= eNumberOfI2CBus) || (transaction == NULL))
+        return false;
+    bus = &s_i2cBus[id];
+    if (bus->handle == DRV_HANDLE_INVALID)
+        return false;
+
+    transaction->status = eI2CTransactionPending;
+    transaction->startTime = I2CEngine_ReadCoreTimer();
+
+    savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    if (!bus->isRecoverRequired && (bus->count < I2C_ENGINE_QUEUE_SIZE))
+    {
+        bus->queue[(bus->head + bus->count) % I2C_ENGINE_QUEUE_SIZE] = transaction;
+        bus->count++;
+        bus->stat.queueDepth++;
+        if (bus->stat.queueDepth > bus->stat.maxQueueDepth)
+            bus->stat.maxQueueDepth = bus->stat.queueDepth;
+        I2CEngine_StartNext(id, woken);
+        isQueued = true;
+    }
+    else
+    {
+        bus->stat.refusedCount++;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+
+    if (!isQueued)
+        transaction->status = eI2CTransactionRefused;
+    return isQueued;
+}
+
+/** @brief Remove a pending transaction from a bus, its status becomes
+ * timeout and its callback is not called. A transaction stuck on the bus is
+ * dropped and the bus is recovered. Called from task context
+ *  @param [in]  E_I2CBusId id: bus
+ *              I2C_TRANSACTION_t *transaction: pending descriptor
+ *  @param [out]  None
+ *  @return None
+ */
+void I2CEngine_Cancel(E_I2CBusId id, I2C_TRANSACTION_t *transaction)
+{
+    I2C_BUS_t *bus;
+    bool isRecoverRequired = false;
+    uint8_t i;
+
+    if ((id >= eNumberOfI2CBus) || (transaction == NULL))
+        return;
+    bus = &s_i2cBus[id];
+
+    taskENTER_CRITICAL();
+    if (transaction->status == eI2CTransactionPending)
+    {
+        if (bus->active == transaction)
+        {
+            //stuck on the bus, late event of this buffer is ignored
+            bus->active = NULL;
+            bus->bufferHandle = DRV_I2C_BUFFER_HANDLE_INVALID;
+            bus->isRecoverRequired = true;
+            isRecoverRequired = true;
+        }
+        else
+        {
+            //still waiting behind a stuck transaction, remove from queue
+            for (i = 0; i < bus->count; i++)
+            {
+                uint8_t k = (bus->head + i) % I2C_ENGINE_QUEUE_SIZE;
+                if (bus->queue[k] == transaction)
+                {
+                    for (; i + 1 < bus->count; i++)
+                    {
+                        bus->queue[(bus->head + i) % I2C_ENGINE_QUEUE_SIZE] =
+                                bus->queue[(bus->head + i + 1) % I2C_ENGINE_QUEUE_SIZE];
+                    }
+                    bus->count--;
+                    break;
+                }
+            }
+        }
+        if (bus->stat.queueDepth > 0)
+            bus->stat.queueDepth--;
+        bus->stat.timeoutCount++;
+        transaction->notifyTask = NULL;
+        transaction->status = eI2CTransactionTimeout;
+    }
+    taskEXIT_CRITICAL();
+
+    if (isRecoverRequired)
+    {
+        TRACE(eTraceI2CTimeoutId, id + 1);
+        I2CEngine_Recover(id);
+    }
+}
+
+/** @brief Do a transaction and wait for it done, the calling task is blocked
+ * without polling. A transaction not done in time is removed from the bus
+ * and the bus is recovered
+ *  @param [in]  E_I2CBusId id: bus
+ *              uint16_t address: I2C address
+ *              void *writeBuffer: data to write, NULL if none
+ *              size_t writeSize: size of data to write
+ *              size_t readSize: size of data to read
+ *              uint32_t maxWait: maximum time (in ms) wait for transaction done
+ *  @param [out]  void *readBuffer: storage of read data, NULL if none
+ *  @return E_I2CTransactionStatus status of the transaction
+ */
+E_I2CTransactionStatus I2CEngine_Transfer(E_I2CBusId id, uint16_t address,
+        void *writeBuffer, size_t writeSize,
+        void *readBuffer, size_t readSize,
+        uint32_t maxWait)
+{
+    I2C_TRANSACTION_t t = {
+        .address = address,
+        .writeBuffer = writeBuffer,
+        .writeSize = (writeBuffer != NULL) ? writeSize : 0,
+        .readBuffer = readBuffer,
+        .readSize = (readBuffer != NULL) ? readSize : 0,
+        .callback = NULL,
+        .context = 0,
+        .notifyTask = xTaskGetCurrentTaskHandle()
+    };
+    TickType_t start = xTaskGetTickCount();
+    TickType_t wait = pdMS_TO_TICKS(maxWait);
+
+    if (!I2CEngine_Submit(id, &t))
+        return eI2CTransactionRefused;
+
+    //only the engine bit is cleared, other notifications of the task are kept
+    while (t.status == eI2CTransactionPending)
+    {
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        if (elapsed >= wait)
+            break;
+        xTaskNotifyWait(0, I2C_ENGINE_NOTIFY_BIT, NULL, wait - elapsed);
+    }
+
+    //not done in time
+    if (t.status == eI2CTransactionPending)
+        I2CEngine_Cancel(id, &t);
+
+    //clear the bit of a transaction finished before the wait
+    xTaskNotifyWait(0, I2C_ENGINE_NOTIFY_BIT, NULL, 0);
+    return t.status;
+}
+
+/** @brief Get statistics of a bus
+ *  @param [in]  E_I2CBusId id: bus
+ *  @param [out]  I2C_BUS_STAT_t *stat: storage of statistics
+ *  @return None
+ */
+void I2CEngine_GetStatistics(E_I2CBusId id, I2C_BUS_STAT_t *stat)
+{
+    if ((id >= eNumberOfI2CBus) || (stat == NULL))
+        return;
+
+    taskENTER_CRITICAL();
+    *stat = s_i2cBus[id].stat;
+    taskEXIT_CRITICAL();
+}
+
+
+
+/* *****************************************************************************
+ End of File
+ */
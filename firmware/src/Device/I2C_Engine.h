@@ -0,0 +1,184 @@
+/* ************************************************************************** */
+/** @file [I2C_Engine.h]
+ *  @brief {queue of I2C transactions shared by I2C1..I2C4. Transactions are
+ * chained from the Harmony driver event handler, the caller is notified by
+ * callback or task notification when a transaction is done}
+ */
+/* ************************************************************************** */
+
+
+#ifndef _I2C_ENGINE_H    /* Guard against multiple inclusion */
+#define _I2C_ENGINE_H
+
+
+/* This section lists the other files that are included in this file.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "driver/i2c/drv_i2c.h"
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief max number of transactions waiting on a bus */
+#define I2C_ENGINE_QUEUE_SIZE           (8)
+
+/** @brief bit of task notification value set when a transaction is done.
+ * Kernel has no notification index, other bits are left to the task */
+#define I2C_ENGINE_NOTIFY_BIT           (0x80000000UL)
+
+/** @brief List of I2C buses */
+typedef enum
+{
+    eI2C1Bus,
+    eI2C2Bus,
+    eI2C3Bus,
+    eI2C4Bus,
+    eNumberOfI2CBus
+} E_I2CBusId;
+
+/** @brief Status of an I2C transaction */
+typedef enum
+{
+    eI2CTransactionPending,     /**<waiting in queue or on the bus */
+    eI2CTransactionDone,        /**<done without error */
+    eI2CTransactionError,       /**<slave did not acknowledge or bus error */
+    eI2CTransactionTimeout,     /**<not done in time, removed from the bus */
+    eI2CTransactionRefused,     /**<queue full or refused by driver */
+} E_I2CTransactionStatus;
+
+/** @brief Function recovering a bus by the pins of the port (clock out a stuck
+ * slave and enable the module again), called from task context */
+typedef void (*I2C_RECOVER_FNC)(void);
+
+/** @brief Function called when a transaction is done. It is called from I2C
+ * interrupt or from a critical section and should only use FreeRTOS ISR API */
+typedef void (*I2C_COMPLETE_FNC)(E_I2CTransactionStatus status, uintptr_t context);
+
+/** @brief Descriptor of an I2C transaction. The descriptor and its buffers
+ * belong to the engine until the transaction is not pending anymore.
+ * A transaction with write and read data is a write then read with repeated start */
+typedef struct
+{
+    uint16_t address;           /**<I2C address as given to DRV_I2C_Transmit/Receive */
+    void *writeBuffer;          /**<data to write, NULL if none */
+    size_t writeSize;           /**<size of data to write */
+    void *readBuffer;           /**<storage of read data, NULL if none */
+    size_t readSize;            /**<size of data to read */
+    I2C_COMPLETE_FNC callback;  /**<function called when done, NULL if none */
+    uintptr_t context;          /**<context given to callback */
+    TaskHandle_t notifyTask;    /**<task notified (I2C_ENGINE_NOTIFY_BIT) when done, NULL if none */
+    volatile E_I2CTransactionStatus status; /**<status, set by engine */
+    uint32_t startTime;         /**<core timer at submit, set by engine */
+} I2C_TRANSACTION_t;
+
+/** @brief Statistics of an I2C bus */
+typedef struct
+{
+    uint32_t transactionCount;  /**<number of finished transactions */
+    uint32_t errorCount;        /**<transactions not acknowledged or bus error */
+    uint32_t timeoutCount;      /**<transactions timed out */
+    uint32_t refusedCount;      /**<transactions refused by full queue or driver */
+    uint32_t recoverCount;      /**<number of bus recoveries */
+    uint8_t queueDepth;         /**<transactions waiting or on the bus */
+    uint8_t maxQueueDepth;      /**<max of queueDepth */
+    uint32_t averageLatencyUs;  /**<average time from submit to done */
+    uint32_t maxLatencyUs;      /**<max time from submit to done */
+} I2C_BUS_STAT_t;
+
+
+    /** @brief Attach an opened Harmony I2C driver to a bus of the engine
+     * This function should be called 1 time at start up, by I2Cx_Initialize
+     *  @param [in]  E_I2CBusId id: bus
+     *              DRV_HANDLE handle: handle of the opened driver
+     *              I2C_RECOVER_FNC recover: bus recovery of the port
+     *  @param [out]  None
+     *  @return None
+     */
+    void I2CEngine_Initialize(E_I2CBusId id, DRV_HANDLE handle, I2C_RECOVER_FNC recover);
+
+    /** @brief Queue a transaction on a bus and return at once. Completion is
+     * notified by callback and/or task notification of the descriptor
+     *  @param [in]  E_I2CBusId id: bus
+     *              I2C_TRANSACTION_t *transaction: descriptor, kept by the caller until done
+     *  @param [out]  None
+     *  @retval true transaction is queued or already finished (see its status)
+     *  @retval false queue is full or bus is not initialized
+     */
+    bool I2CEngine_Submit(E_I2CBusId id, I2C_TRANSACTION_t *transaction);
+
+    /** @brief Queue a transaction on a bus from interrupt, or from the callback
+     * of another transaction to chain them, and return at once. A bus waiting
+     * for recovery refuses the transaction
+     *  @param [in]  E_I2CBusId id: bus
+     *              I2C_TRANSACTION_t *transaction: descriptor, kept by the caller until done
+     *  @param [out]  BaseType_t *woken: set if a higher priority task is woken
+     *  @retval true transaction is queued or already finished (see its status)
+     *  @retval false queue is full, bus is not initialized or waits for recovery
+     */
+    bool I2CEngine_SubmitFromISR(E_I2CBusId id, I2C_TRANSACTION_t *transaction, BaseType_t *woken);
+
+    /** @brief Remove a pending transaction from a bus, its status becomes
+     * timeout and its callback is not called. The bus is recovered if the
+     * transaction was stuck on it, on return the driver does not use the
+     * buffers of the transaction any more. Called from task context
+     *  @param [in]  E_I2CBusId id: bus
+     *              I2C_TRANSACTION_t *transaction: pending descriptor
+     *  @param [out]  None
+     *  @return None
+     */
+    void I2CEngine_Cancel(E_I2CBusId id, I2C_TRANSACTION_t *transaction);
+
+    /** @brief Do a transaction and wait for it done, the calling task is blocked
+     * without polling. A transaction not done in time is removed from the bus
+     * and the bus is recovered
+     *  @param [in]  E_I2CBusId id: bus
+     *              uint16_t address: I2C address
+     *              void *writeBuffer: data to write, NULL if none
+     *              size_t writeSize: size of data to write
+     *              size_t readSize: size of data to read
+     *              uint32_t maxWait: maximum time (in ms) wait for transaction done
+     *  @param [out]  void *readBuffer: storage of read data, NULL if none
+     *  @return E_I2CTransactionStatus status of the transaction
+     */
+    E_I2CTransactionStatus I2CEngine_Transfer(E_I2CBusId id, uint16_t address,
+            void *writeBuffer, size_t writeSize,
+            void *readBuffer, size_t readSize,
+            uint32_t maxWait);
+
+    /** @brief Recover a bus waiting for recovery after a refused or timed out
+     * transaction, and start its waiting transactions again. Wait if another
+     * task is recovering the bus. Called from task context only
+     *  @param [in]  E_I2CBusId id: bus
+     *  @param [out]  None
+     *  @return None
+     */
+    void I2CEngine_Recover(E_I2CBusId id);
+
+    /** @brief Get statistics of a bus
+     *  @param [in]  E_I2CBusId id: bus
+     *  @param [out]  I2C_BUS_STAT_t *stat: storage of statistics
+     *  @return None
+     */
+    void I2CEngine_GetStatistics(E_I2CBusId id, I2C_BUS_STAT_t *stat);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _I2C_ENGINE_H */
+
+/* *****************************************************************************
+ End of File
+ */
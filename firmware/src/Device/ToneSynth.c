@@ -0,0 +1,347 @@
+/* ************************************************************************** */
+/** @file [ToneSynth.c]
+ *  @brief {synthesizer of alarm burst pulses (frequency, harmonics, envelope,
+ * level) and player of sample streams. Samples are generated on the fly into
+ * 2 small I2S buffers used in ping-pong: while the driver sends one buffer, the other one is waiting in
+ * the driver queue, and a buffer is filled again from the I2S driver event
+ * handler as soon as it is sent. Samples are 16 bit mono, same format as the
+ * PCM alarm sounds used before}
+ */
+/* ************************************************************************** */
+
+
+/* This section lists the other files that are included in this file.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "system_config.h"
+#include "system_definitions.h"
+
+#include "ToneSynth.h"
+
+
+/** @brief sample rate of I2S (Hz) */
+#define TONE_SYNTH_SAMPLE_RATE          (DRV_I2S_BAUD_RATE)
+
+/** @brief number of I2S buffers used in ping-pong */
+#define TONE_SYNTH_BUFFER_NUM           (2)
+
+/** @brief number of entries of sine table, index is the 8 MSB of phase */
+#define TONE_SYNTH_SINE_TABLE_SIZE      (256)
+
+/** @brief max rise/fall time of envelope (ms), keeps envelope computation in 32 bit */
+#define TONE_SYNTH_MAX_RAMP_MS          (2000)
+
+/** @brief full scale of Q15 values */
+#define TONE_SYNTH_Q15_ONE              (32767)
+
+/** @brief Pulse or stream prepared in task context, used by the filler */
+typedef struct
+{
+    TONE_STREAM_FNC stream;     /**<function giving the samples of a stream, NULL for a pulse */
+    uintptr_t context;          /**<context given to stream */
+    TONE_STREAM_STATE_t state;  /**<state of stream */
+    uint32_t phaseStep;         /**<phase increment per sample of fundamental */
+    uint8_t harmonicCount;      /**<number of harmonics below Nyquist frequency */
+    int16_t weight[TONE_SYNTH_MAX_HARMONIC]; /**<amplitude of each harmonic (Q15) */
+    uint32_t totalSamples;      /**<pulse duration (samples) */
+    uint32_t riseSamples;       /**<rise time of envelope (samples) */
+    uint32_t fallSamples;       /**<fall time of envelope (samples) */
+} TONE_VOICE_t;
+
+/** @brief one period of sine (Q15), computed at start up */
+static int16_t s_sineTable[TONE_SYNTH_SINE_TABLE_SIZE];
+
+/** @brief I2S buffers, read by DMA */
+static int16_t __attribute__((coherent, aligned(16))) s_toneBuffer[TONE_SYNTH_BUFFER_NUM][TONE_SYNTH_BUFFER_SAMPLES];
+
+/** @brief driver buffers of s_toneBuffer, invalid if buffer is not in driver */
+static DRV_I2S_BUFFER_HANDLE s_toneBufferHandle[TONE_SYNTH_BUFFER_NUM];
+
+/** @brief handle of I2S driver */
+static DRV_HANDLE s_toneHandle = DRV_HANDLE_INVALID;
+
+/** @brief pulse playing */
+static TONE_VOICE_t s_toneVoice;
+
+/** @brief pulse waiting to replace the pulse playing at next buffer */
+static TONE_VOICE_t s_tonePendingVoice;
+
+/** @brief true if s_tonePendingVoice is waiting */
+static volatile bool s_isTonePending = false;
+
+/** @brief true if at least 1 buffer is in driver */
+static volatile bool s_isToneActive = false;
+
+/** @brief phase of fundamental, 2^32 is one period */
+static uint32_t s_tonePhase = 0;
+
+/** @brief index of next sample in the pulse */
+static uint32_t s_tonePosition = 0;
+
+
+/** @brief Convert pulse parameters to a voice ready to be generated
+ *  @param [in]  const TONE_PARAM_t *tone: parameters of pulse
+ *  @param [out]  TONE_VOICE_t *voice: prepared voice
+ *  @return None
+ *  @retval true voice is ready
+ *  @retval false invalid parameter
+ */
+static bool ToneSynth_Prepare(const TONE_PARAM_t *tone, TONE_VOICE_t *voice)
+{
+    uint8_t k;
+
+    if ((tone == NULL) || (tone->frequency == 0) || (tone->durationMs == 0)
+            || (tone->harmonicCount == 0) || (tone->harmonicCount > TONE_SYNTH_MAX_HARMONIC)
+            || ((uint32_t)tone->riseMs + tone->fallMs > tone->durationMs)
+            || (tone->riseMs > TONE_SYNTH_MAX_RAMP_MS) || (tone->fallMs > TONE_SYNTH_MAX_RAMP_MS)
+            || ((uint32_t)tone->level * tone->harmonicCount > TONE_SYNTH_Q15_ONE))
+        return false;
+
+    memset(voice, 0, sizeof(TONE_VOICE_t));
+
+    //drop harmonics above Nyquist frequency, they would alias
+    for (k = 1; k <= tone->harmonicCount; k++)
+    {
+        if ((uint32_t)tone->frequency * k >= TONE_SYNTH_SAMPLE_RATE / 2)
+            break;
+    }
+    voice->harmonicCount = k - 1;
+    if (voice->harmonicCount == 0)
+        return false;
+
+    //harmonics have the same amplitude, their sum never clips
+    for (k = 1; k <= voice->harmonicCount; k++)
+        voice->weight[k - 1] = (int16_t)tone->level;
+
+    voice->phaseStep = (uint32_t)(((uint64_t)tone->frequency << 32) / TONE_SYNTH_SAMPLE_RATE);
+    voice->totalSamples = (uint32_t)tone->durationMs * TONE_SYNTH_SAMPLE_RATE / 1000;
+    voice->riseSamples = (uint32_t)tone->riseMs * TONE_SYNTH_SAMPLE_RATE / 1000;
+    voice->fallSamples = (uint32_t)tone->fallMs * TONE_SYNTH_SAMPLE_RATE / 1000;
+    return true;
+}
+
+/** @brief Generate next samples of the pulse or stream playing into a buffer.
+ * Called from task when synthesizer is idle, else from I2S event handler only
+ *  @param [in]  uint8_t index: index of buffer in s_toneBuffer
+ *  @param [out]  None
+ *  @return uint16_t number of samples generated, 0 at end of pulse
+ */
+static uint16_t ToneSynth_Fill(uint8_t index)
+{
+    int16_t *buffer = s_toneBuffer[index];
+    TONE_VOICE_t *voice = &s_toneVoice;
+    uint16_t n;
+    uint8_t k;
+
+    if (voice->stream != NULL)
+        return voice->stream(buffer, TONE_SYNTH_BUFFER_SAMPLES, &voice->state, voice->context);
+
+    for (n = 0; (n < TONE_SYNTH_BUFFER_SAMPLES) && (s_tonePosition < voice->totalSamples); n++)
+    {
+        int32_t sample = 0;
+        int32_t envelope = TONE_SYNTH_Q15_ONE;
+        uint32_t remain = voice->totalSamples - s_tonePosition;
+
+        //harmonic k has k times the phase of fundamental, wrap is free
+        for (k = 0; k < voice->harmonicCount; k++)
+            sample += (int32_t)s_sineTable[(s_tonePhase * (k + 1)) >> 24] * voice->weight[k];
+        sample >>= 15;
+
+        //linear rise and fall, avoid click at start and end of pulse
+        if (s_tonePosition < voice->riseSamples)
+            envelope = (int32_t)(s_tonePosition * TONE_SYNTH_Q15_ONE / voice->riseSamples);
+        else if (remain <= voice->fallSamples)
+            envelope = (int32_t)(remain * TONE_SYNTH_Q15_ONE / voice->fallSamples);
+
+        buffer[n] = (int16_t)((sample * envelope) >> 15);
+        s_tonePhase += voice->phaseStep;
+        s_tonePosition++;
+    }
+    return n;
+}
+
+/** @brief Give a filled buffer to the driver
+ * Must be called with I2S interrupt masked (critical section or I2S event handler)
+ *  @param [in]  uint8_t index: index of buffer in s_toneBuffer
+ *              uint16_t count: number of samples in buffer
+ *  @param [out]  None
+ *  @return None
+ *  @retval true buffer is queued
+ *  @retval false driver refused the buffer
+ */
+static bool ToneSynth_Queue(uint8_t index, uint16_t count)
+{
+    DRV_I2S_BufferAddWrite(s_toneHandle, &s_toneBufferHandle[index],
+            s_toneBuffer[index], count * sizeof(int16_t));
+    return (s_toneBufferHandle[index] != DRV_I2S_BUFFER_HANDLE_INVALID);
+}
+
+/** @brief Prepare the synthesizer for an opened I2S driver
+ * This function should be called 1 time at start up, by _i2s_TLV320Init
+ *  @param [in]  DRV_HANDLE handle: handle of the opened I2S driver
+ *  @param [out]  None
+ *  @return None
+ */
+void ToneSynth_Initialize(DRV_HANDLE handle)
+{
+    uint16_t i;
+
+    for (i = 0; i < TONE_SYNTH_SINE_TABLE_SIZE; i++)
+        s_sineTable[i] = (int16_t)(TONE_SYNTH_Q15_ONE * sinf(2 * M_PI * i / TONE_SYNTH_SINE_TABLE_SIZE));
+
+    for (i = 0; i < TONE_SYNTH_BUFFER_NUM; i++)
+        s_toneBufferHandle[i] = DRV_I2S_BUFFER_HANDLE_INVALID;
+
+    s_isTonePending = false;
+    s_isToneActive = false;
+    s_toneHandle = handle;
+}
+
+/** @brief Start a prepared pulse or stream. If one is playing, the new one
+ * replaces it from the next buffer
+ *  @param [in]  const TONE_VOICE_t *voice: pulse or stream
+ *  @param [out]  None
+ *  @return None
+ *  @retval true voice is started
+ *  @retval false driver refused the buffers
+ */
+static bool ToneSynth_Start(const TONE_VOICE_t *voice)
+{
+    uint16_t count[TONE_SYNTH_BUFFER_NUM];
+    bool result = false;
+    uint8_t i;
+
+    taskENTER_CRITICAL();
+    if (s_isToneActive == true)
+    {
+        //event handler takes it at next buffer
+        s_tonePendingVoice = *voice;
+        s_isTonePending = true;
+        taskEXIT_CRITICAL();
+        return true;
+    }
+    taskEXIT_CRITICAL();
+
+    //synthesizer is idle, event handler does not touch the buffers
+    s_toneVoice = *voice;
+    s_tonePhase = 0;
+    s_tonePosition = 0;
+    s_isTonePending = false;
+    for (i = 0; i < TONE_SYNTH_BUFFER_NUM; i++)
+        count[i] = ToneSynth_Fill(i);
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < TONE_SYNTH_BUFFER_NUM; i++)
+    {
+        if ((count[i] == 0) || (ToneSynth_Queue(i, count[i]) == false))
+            break;
+        result = true;
+    }
+    s_isToneActive = result;
+    taskEXIT_CRITICAL();
+    return result;
+}
+
+/** @brief Start a pulse. If a pulse is playing, the new one replaces it
+ * from the next buffer
+ *  @param [in]  const TONE_PARAM_t *tone: parameters of pulse
+ *  @param [out]  None
+ *  @return None
+ *  @retval true pulse is started
+ *  @retval false invalid parameter or driver refused the buffers
+ */
+bool ToneSynth_Play(const TONE_PARAM_t *tone)
+{
+    TONE_VOICE_t voice;
+
+    if (s_toneHandle == DRV_HANDLE_INVALID)
+        return false;
+    if (ToneSynth_Prepare(tone, &voice) == false)
+        return false;
+    return ToneSynth_Start(&voice);
+}
+
+/** @brief Start a stream of samples (voice prompt, ...). If a pulse or a
+ * stream is playing, the new one replaces it from the next buffer
+ *  @param [in]  TONE_STREAM_FNC stream: function giving the samples
+ *              uintptr_t context: context given to stream
+ *  @param [out]  None
+ *  @return None
+ *  @retval true stream is started
+ *  @retval false invalid parameter or driver refused the buffers
+ */
+bool ToneSynth_PlayStream(TONE_STREAM_FNC stream, uintptr_t context)
+{
+    TONE_VOICE_t voice;
+
+    if ((s_toneHandle == DRV_HANDLE_INVALID) || (stream == NULL))
+        return false;
+
+    memset(&voice, 0, sizeof(TONE_VOICE_t));
+    voice.stream = stream;
+    voice.context = context;
+    return ToneSynth_Start(&voice);
+}
+
+/** @brief Give the next samples to the driver when a buffer is sent.
+ * This function is called from the I2S buffer event handler (in ISR)
+ *  @param [in]  DRV_I2S_BUFFER_HANDLE bufferHandle: buffer which is sent
+ *  @param [out]  None
+ *  @return None
+ */
+void ToneSynth_BufferComplete(DRV_I2S_BUFFER_HANDLE bufferHandle)
+{
+    uint16_t count;
+    uint8_t index;
+    uint8_t i;
+
+    if (bufferHandle == DRV_I2S_BUFFER_HANDLE_INVALID)
+        return;
+    for (index = 0; index < TONE_SYNTH_BUFFER_NUM; index++)
+    {
+        if (bufferHandle == s_toneBufferHandle[index])
+            break;
+    }
+    if (index == TONE_SYNTH_BUFFER_NUM)
+        return;
+    s_toneBufferHandle[index] = DRV_I2S_BUFFER_HANDLE_INVALID;
+
+    if (s_isTonePending == true)
+    {
+        s_toneVoice = s_tonePendingVoice;
+        s_tonePhase = 0;
+        s_tonePosition = 0;
+        s_isTonePending = false;
+    }
+
+    //the other buffer is playing now, queue the free ones behind it in order
+    for (i = 0; i < TONE_SYNTH_BUFFER_NUM; i++)
+    {
+        uint8_t next = (index + i) % TONE_SYNTH_BUFFER_NUM;
+        if (s_toneBufferHandle[next] != DRV_I2S_BUFFER_HANDLE_INVALID)
+            continue;
+        count = ToneSynth_Fill(next);
+        if ((count == 0) || (ToneSynth_Queue(next, count) == false))
+            break;
+    }
+
+    for (i = 0; i < TONE_SYNTH_BUFFER_NUM; i++)
+    {
+        if (s_toneBufferHandle[i] != DRV_I2S_BUFFER_HANDLE_INVALID)
+            return;
+    }
+    s_isToneActive = false;
+}
+
+/* *****************************************************************************
+ End of File
+ */
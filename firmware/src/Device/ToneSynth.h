@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/** @file [ToneSynth.h]
+ *  @brief {synthesizer of alarm burst pulses (frequency, harmonics, envelope,
+ * level) and player of sample streams. Samples are generated on the fly into
+ * 2 small I2S buffers used in ping-pong, the next buffer is filled from the
+ * I2S driver event handler}
+ */
+/* ************************************************************************** */
+
+
+#ifndef _TONE_SYNTH_H    /* Guard against multiple inclusion */
+#define _TONE_SYNTH_H
+
+
+/* This section lists the other files that are included in this file.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "system_config.h"
+#include "system_definitions.h"
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief number of 16 bit samples in each I2S buffer (5.8 ms at 44.1 kHz) */
+#define TONE_SYNTH_BUFFER_SAMPLES       (256)
+
+/** @brief max number of harmonics of a pulse, fundamental included */
+#define TONE_SYNTH_MAX_HARMONIC         (8)
+
+/** @brief Parameters of a burst pulse */
+typedef struct
+{
+    uint16_t frequency;         /**<fundamental frequency (Hz) */
+    uint8_t harmonicCount;      /**<number of harmonics (1: pure sine), all with the same amplitude */
+    uint16_t durationMs;        /**<pulse duration (ms), envelope included */
+    uint16_t riseMs;            /**<rise time of envelope (ms) */
+    uint16_t fallMs;            /**<fall time of envelope (ms) */
+    uint16_t level;             /**<amplitude of each harmonic, 32767 is full scale,
+                                     harmonicCount * level must not exceed 32767 */
+} TONE_PARAM_t;
+
+/** @brief State of a stream, owned by the synthesizer and cleared when the
+ * stream starts */
+typedef struct
+{
+    uint32_t position;          /**<index of next sample */
+    int32_t value[2];           /**<free for the stream function */
+} TONE_STREAM_STATE_t;
+
+/** @brief Function giving the next samples of a stream (16 bit mono at I2S
+ * sample rate). It is called from I2S event handler (in ISR) or from the task
+ * starting the stream, and returns the number of samples written, 0 at end */
+typedef uint16_t (*TONE_STREAM_FNC)(int16_t *buffer, uint16_t count,
+        TONE_STREAM_STATE_t *state, uintptr_t context);
+
+
+    /** @brief Prepare the synthesizer for an opened I2S driver
+     * This function should be called 1 time at start up, by _i2s_TLV320Init
+     *  @param [in]  DRV_HANDLE handle: handle of the opened I2S driver
+     *  @param [out]  None
+     *  @return None
+     */
+    void ToneSynth_Initialize(DRV_HANDLE handle);
+
+    /** @brief Start a pulse. If a pulse is playing, the new one replaces it
+     * from the next buffer
+     *  @param [in]  const TONE_PARAM_t *tone: parameters of pulse
+     *  @param [out]  None
+     *  @return None
+     *  @retval true pulse is started
+     *  @retval false invalid parameter or driver refused the buffers
+     */
+    bool ToneSynth_Play(const TONE_PARAM_t *tone);
+
+    /** @brief Start a stream of samples (voice prompt, ...). If a pulse or a
+     * stream is playing, the new one replaces it from the next buffer
+     *  @param [in]  TONE_STREAM_FNC stream: function giving the samples
+     *              uintptr_t context: context given to stream
+     *  @param [out]  None
+     *  @return None
+     *  @retval true stream is started
+     *  @retval false invalid parameter or driver refused the buffers
+     */
+    bool ToneSynth_PlayStream(TONE_STREAM_FNC stream, uintptr_t context);
+
+    /** @brief Give the next samples to the driver when a buffer is sent.
+     * This function is called from the I2S buffer event handler (in ISR)
+     *  @param [in]  DRV_I2S_BUFFER_HANDLE bufferHandle: buffer which is sent
+     *  @param [out]  None
+     *  @return None
+     */
+    void ToneSynth_BufferComplete(DRV_I2S_BUFFER_HANDLE bufferHandle);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TONE_SYNTH_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -19,6 +19,7 @@
 #include <stdint.h>
 #include "system/common/sys_common.h"
 #include "system_definitions.h"
+#include "UART_Ring.h"
 
 
 /* Provide C++ Compatibility */
@@ -27,8 +28,8 @@ extern "C" {
 #endif
 
     /** @brief Initialize UART1, use to communicate with SPO2 sensor. This function 
-     * open UART2 as none blocking, read/write enable and attached a buffer to store
-     * receive data from UART receiver
+     * open UART2 as none blocking, read/write enable and attached ring buffers to store
+     * data to send and data received
      * This function should be called 1 time at start up
      *  @param [in]  None   
      *  @param [out]  None
@@ -38,7 +39,7 @@ extern "C" {
 
     /** @brief Send a packet of data through UART1
      * The data to send will not immediately put on UART1 port, it will store on Uart1TxBuffer
-     * queue. Data on that Uart1TxBuffer queue will be put serially first in first out
+     * ring. Data on that ring will be put serially first in first out
      *  @param [in]  void *txData: pointer to data packet need to be sent
      *               uint16_t len: size of data packet 
      *  @param [out]  None
@@ -50,11 +51,11 @@ extern "C" {
     bool Uart1_Send(uint8_t* txData, uint16_t len);
 
     /** @brief Read UART1 receive buffer and store on external buffer
-     * After reading out, the UART1 Uart1RxBuffer will empty
+     * Bytes not fitting in external buffer stay on Uart1RxBuffer for next reading
      *  @param [in]  uint8_t *rxBuffer: pointer to external buffer to store receive data
      *               uint16_t len: length of external buffer
      *  @param [out]  None
-     *  @return int16_t     (>0)number of byte successful read
+     *  @return int16_t     (>=0)number of byte successful read
      *                      (-1) if error occur
      */
     int16_t Uart1_ReadReceiveBuffer(uint8_t* rxBuffer, int16_t len);
@@ -62,11 +63,17 @@ extern "C" {
     /** @brief Query how may byte available on UART1 Receiver buffer
      *  @param [in]     None
      *  @param [out]    None
-     *  @return         size_t      (>0) number of byte available
-     *                              (DRV_USART_BUFFER_HANDLE_INVALID) can not get size
+     *  @return         size_t      number of byte available
      */
     size_t Uart1_GetReceiveBufferSize();
 
+    /** @brief Get overrun counters and high-water marks of UART1 ring buffers
+     *  @param [in]     None
+     *  @param [out]    UART_RING_STAT_t *stat: storage of statistics
+     *  @return         None
+     */
+    void Uart1_GetStatistics(UART_RING_STAT_t *stat);
+
     /* Provide C++ Compatibility */
 #ifdef __cplusplus
 }
@@ -19,6 +19,7 @@
 #include <stdint.h>
 #include "system/common/sys_common.h"
 #include "system_definitions.h"
+#include "UART_Ring.h"
 
 
 /* Provide C++ Compatibility */
@@ -27,8 +28,8 @@ extern "C" {
 #endif
 
     /** @brief Initialize UART2, use to communicate with SPO2 sensor. This function 
-     * open UART2 as none blocking, read/write enable and attached a buffer to store
-     * receive data from UART receiver
+     * open UART2 as none blocking, read/write enable and attached ring buffers to store
+     * data to send and data received
      * This function should be called 1 time at start up
      *  @param [in]  None   
      *  @param [out]  None
@@ -38,23 +39,23 @@ extern "C" {
 
     /** @brief Send a packet of data through UART2
      * The data to send will not immediately put on UART2 port, it will store on Uart2TxBuffer
-     * queue. Data on that Uart2TxBuffer queue will be put serially first in first out
+     * ring. Data on that ring will be put serially first in first out
      *  @param [in]  void *txData: pointer to data packet need to be sent
      *               uint16_t len: size of data packet 
      *  @param [out]  None
      *  @return None
      *  @retval true prepare for sending OK
-     *  @retval false some error happen, may be the size of packet data too large compare
-     * with Uart2TxBuffer or can not put the data on queue
+     *  @retval false some error happen, may be not enough free space on Uart2TxBuffer
+     * or can not put the data on queue
      */
     bool Uart2_Send(uint8_t* txData, uint16_t len);
 
     /** @brief Read UART2 receive buffer and store on external buffer
-     * After reading out, the UART2 Uart2RxBuffer will empty
+     * Bytes not fitting in external buffer stay on Uart2RxBuffer for next reading
      *  @param [in]  uint8_t *rxBuffer: pointer to external buffer to store receive data
      *               uint16_t len: length of external buffer
      *  @param [out]  None
-     *  @return int16_t     (>0)number of byte successful read
+     *  @return int16_t     (>=0)number of byte successful read
      *                      (-1) if error occur
      */
     int16_t Uart2_ReadReceiveBuffer(uint8_t* rxBuffer, int16_t len);
@@ -62,11 +63,17 @@ extern "C" {
     /** @brief Query how may byte available on UART2 Receiver buffer
      *  @param [in]     None
      *  @param [out]    None
-     *  @return         size_t      (>0) number of byte available
-     *                              (DRV_USART_BUFFER_HANDLE_INVALID) can not get size
+     *  @return         size_t      number of byte available
      */
     size_t Uart2_GetReceiveBufferSize();
 
+    /** @brief Get overrun counters and high-water marks of UART2 ring buffers
+     *  @param [in]     None
+     *  @param [out]    UART_RING_STAT_t *stat: storage of statistics
+     *  @return         None
+     */
+    void Uart2_GetStatistics(UART_RING_STAT_t *stat);
+
     /* Provide C++ Compatibility */
 #ifdef __cplusplus
 }
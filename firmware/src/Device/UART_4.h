@@ -19,6 +19,7 @@
 #include <stdint.h>
 #include "system/common/sys_common.h"
 #include "system_definitions.h"
+#include "UART_Ring.h"
 
 
 /* Provide C++ Compatibility */
@@ -27,8 +28,8 @@ extern "C" {
 #endif
 
     /** @brief Initialize UART4, use to communicate with SPO2 sensor. This function 
-     * open UART4 as none blocking, read/write enable and attached a buffer to store
-     * receive data from UART receiver
+     * open UART4 as none blocking, read/write enable and attached ring buffers to store
+     * data to send and data received
      * This function should be called 1 time at start up
      *  @param [in]  None   
      *  @param [out]  None
@@ -44,17 +45,17 @@ extern "C" {
      *  @param [out]  None
      *  @return None
      *  @retval true prepare for sending OK
-     *  @retval false some error happen, may be the size of packet data too large compare
-     * with Uart4TxBuffer or can not put the data on queue
+     *  @retval false some error happen, may be not enough free space on Uart4TxBuffer
+     * or can not put the data on queue
      */
     bool Uart4_Send(uint8_t* txData, uint16_t len);
 
     /** @brief Read UART4 receive buffer and store on external buffer
-     * After reading out, the UART4 Uart4RxBuffer will empty
+     * Bytes not fitting in external buffer stay on Uart4RxBuffer for next reading
      *  @param [in]  uint8_t *rxBuffer: pointer to external buffer to store receive data
      *               uint16_t len: length of external buffer
      *  @param [out]  None
-     *  @return int16_t     (>0)number of byte successful read
+     *  @return int16_t     (>=0)number of byte successful read
      *                      (-1) if error occur
      */
     int16_t Uart4_ReadReceiveBuffer(uint8_t* rxBuffer, int16_t len);
@@ -62,11 +63,17 @@ extern "C" {
     /** @brief Query how may byte available on UART4 Receiver buffer
      *  @param [in]     None
      *  @param [out]    None
-     *  @return         size_t      (>0) number of byte available
-     *                              (DRV_USART_BUFFER_HANDLE_INVALID) can not get size
+     *  @return         size_t      number of byte available
      */
     size_t Uart4_GetReceiveBufferSize();
 
+    /** @brief Get overrun counters and high-water marks of UART4 ring buffers
+     *  @param [in]     None
+     *  @param [out]    UART_RING_STAT_t *stat: storage of statistics
+     *  @return         None
+     */
+    void Uart4_GetStatistics(UART_RING_STAT_t *stat);
+
     /* Provide C++ Compatibility */
 #ifdef __cplusplus
 }
@@ -19,6 +19,7 @@
 #include <stdint.h>
 #include "system/common/sys_common.h"
 #include "system_definitions.h"
+#include "UART_Ring.h"
 
 
 /* Provide C++ Compatibility */
@@ -27,8 +28,8 @@ extern "C" {
 #endif
 
     /** @brief Initialize UART6, use to communicate with PC application. This function 
-     * open UART6 as none blocking, read/write enable and attached a buffer to store
-     * receive data from UART receiver
+     * open UART6 as none blocking, read/write enable and attached ring buffers to store
+     * data to send and data received
      * This function should be called 1 time at start up
      *  @param [in]  None   
      *  @param [out]  None
@@ -38,19 +39,19 @@ extern "C" {
 
     /** @brief Send a packet of data through UART6
      * The data to send will not immediately put on UART6 port, it will store on Uart6TxBuffer
-     * queue. Data on that Uart6TxBuffer queue will be put serially first in first out
+     * ring. Data on that ring will be put serially first in first out
      *  @param [in]  void *txData: pointer to data packet need to be sent
      *               uint16_t len: size of data packet 
      *  @param [out]  None
      *  @return None
      *  @retval true prepare for sending OK
-     *  @retval false some error happen, may be the size of packet data too large compare
-     * with Uart6TxBuffer or can not put the data on queue
+     *  @retval false some error happen, may be not enough free space on Uart6TxBuffer
+     * or can not put the data on queue
      */
     bool Uart6_Send(uint8_t* txData, uint16_t len);
 
     /** @brief Read UART6 receive buffer and store on external buffer
-     * After reading out, the UART6 Uart6RxBuffer will empty
+     * Bytes not fitting in external buffer stay on Uart6RxBuffer for next reading
      *  @param [in]  uint8_t *rxBuffer: pointer to external buffer to store receive data
      *               uint16_t len: length of external buffer
      *  @param [out]  None
@@ -62,11 +63,17 @@ extern "C" {
     /** @brief Query how may byte available on UART6 Receiver buffer
      *  @param [in]     None
      *  @param [out]    None
-     *  @return         size_t      (>0) number of byte available
-     *                              (DRV_USART_BUFFER_HANDLE_INVALID) can not get size
+     *  @return         size_t      number of byte available
      */
     size_t Uart6_GetReceiveBufferSize();
 
+    /** @brief Get overrun counters and high-water marks of UART6 ring buffers
+     *  @param [in]     None
+     *  @param [out]    UART_RING_STAT_t *stat: storage of statistics
+     *  @return         None
+     */
+    void Uart6_GetStatistics(UART_RING_STAT_t *stat);
+
     /* Provide C++ Compatibility */
 #ifdef __cplusplus
 }
@@ -0,0 +1,361 @@
+/* ************************************************************************** */
+/** @file [UART_Ring.c]
+ *  @brief {single producer / single consumer ring buffers between the UART
+ * driver and the tasks using UART_1, UART_2, UART_4 and UART_6.
+ * RX: the driver receives into a chunk of 32 bytes. Read moves the bytes
+ * already received from the chunk to RX ring. When the chunk is full, the
+ * event handler moves the rest and queues the other chunk before the driver
+ * removes the full one, so the driver queue is never empty.
+ * TX: the driver gets the contiguous bytes from TX ring tail, the next part is
+ * given from the event handler when it is sent. Send refuses a packet which
+ * does not fit in free space instead of overwriting bytes not sent yet.
+ * Driver buffers are never added in a critical section: outside interrupt the
+ * driver takes its mutex}
+ */
+/* ************************************************************************** */
+
+
+/* This section lists the other files that are included in this file.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "system_config.h"
+#include "system_definitions.h"
+
+#include "UART_Ring.h"
+
+
+/** @brief take the bytes at TX tail for the driver if transmitter is idle.
+ * Must be called with UART interrupts masked (critical section or UART interrupt)
+ *  @param [in]  UART_RING_t *port: port state
+ *  @param [out]  uint16_t *index: position of bytes in TX ring
+ *  @return uint16_t number of bytes taken, 0 if transmitter is busy or nothing to send
+ */
+static uint16_t UartRing_TakeTransmit(UART_RING_t *port, uint16_t *index)
+{
+    uint16_t count = port->txHead - port->txTail;
+    uint16_t len;
+
+    if ((port->txInFlight != 0) || (count == 0))
+        return 0;
+
+    //driver buffer must be contiguous, the part after wrap is sent next
+    *index = port->txTail & port->txMask;
+    len = port->txMask + 1 - *index;
+    if (len > count)
+        len = count;
+
+    port->txInFlight = len;
+    return len;
+}
+
+/** @brief give the bytes taken by UartRing_TakeTransmit to the driver.
+ * The port is the only client of its driver so the driver never blocks here
+ *  @param [in]  UART_RING_t *port: port state
+ *              uint16_t index: position of bytes in TX ring
+ *              uint16_t len: number of bytes
+ *  @param [out]  None
+ *  @return None
+ *  @retval true bytes are queued
+ *  @retval false driver refused the buffer
+ */
+static bool UartRing_Transmit(UART_RING_t *port, uint16_t index, uint16_t len)
+{
+    DRV_USART_BufferAddWrite(port->handle, &port->txBufferHandle, &port->txBuffer[index], len);
+    if (port->txBufferHandle != DRV_USART_BUFFER_HANDLE_INVALID)
+        return true;
+
+    //nothing in flight, event handler does not move TX indexes until next Send
+    //drop pending bytes, next Send will try again
+    port->txTail = port->txHead;
+    port->txInFlight = 0;
+    return false;
+}
+
+/** @brief queue a receive chunk on the driver and make it the active one.
+ * Called from event handler, or from a task while receiver is stopped
+ *  @param [in]  UART_RING_t *port: port state
+ *              uint8_t index: index of chunk in rxChunk
+ *  @param [out]  None
+ *  @return None
+ *  @retval true chunk is queued
+ *  @retval false driver refused the chunk, receiver is stopped
+ */
+static bool UartRing_AttachReceiveChunk(UART_RING_t *port, uint8_t index)
+{
+    //driver stores the handle before a byte can complete the chunk
+    port->rxChunkRead = 0;
+    port->rxActive = index;
+    DRV_USART_BufferAddRead(port->handle, &port->rxBufferHandle[index], &port->rxChunk[index][0], UART_RING_RX_CHUNK_SIZE);
+    if (port->rxBufferHandle[index] != DRV_USART_BUFFER_HANDLE_INVALID)
+        return true;
+
+    port->rxActive = UART_RING_RX_CHUNK_NONE;
+    return false;
+}
+
+/** @brief move bytes of active chunk to RX ring.
+ * Must be called with UART interrupts masked (critical section or UART interrupt)
+ *  @param [in]  UART_RING_t *port: port state
+ *              uint8_t count: number of bytes received in active chunk
+ *  @param [out]  None
+ *  @return None
+ */
+static void UartRing_CollectReceiveChunk(UART_RING_t *port, uint8_t count)
+{
+    const uint8_t *chunk = &port->rxChunk[port->rxActive][0];
+    uint16_t used = port->rxHead - port->rxTail;
+
+    for (; port->rxChunkRead < count; port->rxChunkRead++)
+    {
+        if (used > port->rxMask)
+        {
+            port->stat.rxOverrunCount++;
+            continue;
+        }
+        port->rxBuffer[port->rxHead & port->rxMask] = chunk[port->rxChunkRead];
+        port->rxHead++;
+        used++;
+    }
+    if (used > port->stat.rxHighWater)
+        port->stat.rxHighWater = used;
+}
+
+/** @brief get number of bytes received in active chunk.
+ * Must be called with UART interrupts masked (critical section or UART interrupt).
+ * The driver only reads its buffer object here, it does not take its mutex
+ *  @param [in]  UART_RING_t *port: port state
+ *  @param [out]  None
+ *  @return uint8_t number of bytes
+ */
+static uint8_t UartRing_GetReceiveChunkCount(UART_RING_t *port)
+{
+    size_t count = DRV_USART_BufferCompletedBytesGet(port->rxBufferHandle[port->rxActive]);
+
+    //handle of a chunk already removed by the driver is invalid
+    if (count > UART_RING_RX_CHUNK_SIZE)
+        return port->rxChunkRead;
+    return (uint8_t) count;
+}
+
+/** @brief move bytes received so far to RX ring, and restart receiver if it
+ * is stopped
+ *  @param [in]  UART_RING_t *port: port state
+ *  @param [out]  None
+ *  @return None
+ */
+static void UartRing_UpdateReceive(UART_RING_t *port)
+{
+    bool isStopped;
+
+    taskENTER_CRITICAL();
+    isStopped = (port->rxActive == UART_RING_RX_CHUNK_NONE);
+    if (!isStopped)
+        UartRing_CollectReceiveChunk(port, UartRing_GetReceiveChunkCount(port));
+    taskEXIT_CRITICAL();
+
+    //no chunk is queued, event handler does not run for RX of this port
+    if (isStopped)
+        UartRing_AttachReceiveChunk(port, 0);
+}
+
+/** @brief Callback from DRV_USART_TasksTransmit/TasksReceive/TasksError when a
+ * buffer is done. This function is called in ISR, should not put any debug here
+ *  @param [in]  DRV_USART_BUFFER_EVENT event: status of the buffer (complete, error, ...)
+ *              DRV_USART_BUFFER_HANDLE bufferHandle: the buffer
+ *              uintptr_t context: port state
+ *  @param [out]  None
+ *  @return None
+ */
+static void UartRing_EventHandler(DRV_USART_BUFFER_EVENT event,
+        DRV_USART_BUFFER_HANDLE bufferHandle,
+        uintptr_t context)
+{
+    UART_RING_t *port = (UART_RING_t*) context;
+    uint16_t index;
+    uint16_t len;
+    uint8_t i;
+
+    if (port == NULL)
+        return;
+
+    //transmitter
+    if ((port->txInFlight != 0) && (bufferHandle == port->txBufferHandle))
+    {
+        port->txTail += port->txInFlight;
+        port->txInFlight = 0;
+        port->txBufferHandle = DRV_USART_BUFFER_HANDLE_INVALID;
+        len = UartRing_TakeTransmit(port, &index);
+        if (len != 0)
+            UartRing_Transmit(port, index, len);
+        return;
+    }
+
+    //receiver, only the active chunk is queued
+    i = port->rxActive;
+    if ((i == UART_RING_RX_CHUNK_NONE) || (bufferHandle != port->rxBufferHandle[i]))
+        return;
+
+    if (event == DRV_USART_BUFFER_EVENT_COMPLETE)
+    {
+        UartRing_CollectReceiveChunk(port, UART_RING_RX_CHUNK_SIZE);
+        //driver removes this chunk after return, the other one is queued
+        //behind it now. If it is refused, next Read restarts the receiver
+        UartRing_AttachReceiveChunk(port, i ^ 1);
+    }
+    else
+    {
+        //keep bytes before the error. TasksError does not tell the driver
+        //it is in interrupt, so the receiver is restarted by next Read
+        UartRing_CollectReceiveChunk(port, UartRing_GetReceiveChunkCount(port));
+        port->rxActive = UART_RING_RX_CHUNK_NONE;
+        port->stat.rxErrorCount++;
+    }
+}
+
+/** @brief Attach ring buffers to an opened USART driver and start receiving
+ * This function should be called 1 time at start up, by Uartx_Initialize
+ *  @param [in]  UART_RING_t *port: port state
+ *              DRV_HANDLE handle: handle of the opened driver
+ *              uint8_t *txBuffer: TX ring storage
+ *              uint16_t txSize: size of TX ring, power of 2
+ *              uint8_t *rxBuffer: RX ring storage
+ *              uint16_t rxSize: size of RX ring, power of 2
+ *  @param [out]  None
+ *  @return None
+ *  @retval true port is ready
+ *  @retval false invalid parameter or driver refused receive buffer
+ */
+bool UartRing_Initialize(UART_RING_t *port, DRV_HANDLE handle,
+        uint8_t *txBuffer, uint16_t txSize,
+        uint8_t *rxBuffer, uint16_t rxSize)
+{
+    if ((port == NULL) || (handle == DRV_HANDLE_INVALID))
+        return false;
+    //size must be power of 2 and fit 16 bits free running indexes
+    if ((txSize == 0) || ((txSize & (txSize - 1)) != 0) || (txSize > 0x8000)
+            || (rxSize == 0) || ((rxSize & (rxSize - 1)) != 0) || (rxSize > 0x8000))
+        return false;
+
+    memset(port, 0, sizeof(UART_RING_t));
+    port->handle = handle;
+    port->txBuffer = txBuffer;
+    port->txMask = txSize - 1;
+    port->txBufferHandle = DRV_USART_BUFFER_HANDLE_INVALID;
+    port->rxBuffer = rxBuffer;
+    port->rxMask = rxSize - 1;
+
+    port->rxActive = UART_RING_RX_CHUNK_NONE;
+
+    DRV_USART_BufferEventHandlerSet(handle, UartRing_EventHandler, (uintptr_t) port);
+    return UartRing_AttachReceiveChunk(port, 0);
+}
+
+/** @brief Copy a packet to TX ring and start sending if the transmitter is idle
+ *  @param [in]  UART_RING_t *port: port state
+ *              const uint8_t *data: packet
+ *              uint16_t len: size of packet
+ *  @param [out]  None
+ *  @return None
+ *  @retval true packet is queued
+ *  @retval false not enough free space in TX ring (packet is not queued)
+ * or driver refused the buffer
+ */
+bool UartRing_Send(UART_RING_t *port, const uint8_t *data, uint16_t len)
+{
+    uint16_t size = port->txMask + 1;
+    uint16_t count = port->txHead - port->txTail;
+    uint16_t index = port->txHead & port->txMask;
+    uint16_t first;
+    uint16_t txIndex;
+
+    if (len == 0)
+        return false;
+    if (len > size - count)
+    {
+        port->stat.txOverrunCount++;
+        return false;
+    }
+
+    //copy before moving head, event handler only reads up to head
+    first = size - index;
+    if (first > len)
+        first = len;
+    memcpy(&port->txBuffer[index], data, first);
+    memcpy(&port->txBuffer[0], data + first, len - first);
+    port->txHead += len;
+
+    count += len;
+    if (count > port->stat.txHighWater)
+        port->stat.txHighWater = count;
+
+    taskENTER_CRITICAL();
+    len = UartRing_TakeTransmit(port, &txIndex);
+    taskEXIT_CRITICAL();
+    if (len == 0)
+        return true;
+    return UartRing_Transmit(port, txIndex, len);
+}
+
+/** @brief Take received bytes out of RX ring
+ *  @param [in]  UART_RING_t *port: port state
+ *              uint16_t len: size of storage
+ *  @param [out]  uint8_t *data: storage of received bytes
+ *  @return uint16_t number of bytes read
+ */
+uint16_t UartRing_Read(UART_RING_t *port, uint8_t *data, uint16_t len)
+{
+    uint16_t count;
+    uint16_t index = port->rxTail & port->rxMask;
+    uint16_t first;
+
+    UartRing_UpdateReceive(port);
+    count = port->rxHead - port->rxTail;
+    if (len > count)
+        len = count;
+
+    first = port->rxMask + 1 - index;
+    if (first > len)
+        first = len;
+    memcpy(data, &port->rxBuffer[index], first);
+    memcpy(data + first, &port->rxBuffer[0], len - first);
+
+    //move tail after copy, receiver only writes up to tail
+    port->rxTail += len;
+    return len;
+}
+
+/** @brief Get number of bytes waiting in RX ring
+ *  @param [in]  UART_RING_t *port: port state
+ *  @param [out]  None
+ *  @return uint16_t number of bytes
+ */
+uint16_t UartRing_GetReceiveCount(UART_RING_t *port)
+{
+    UartRing_UpdateReceive(port);
+    return (uint16_t)(port->rxHead - port->rxTail);
+}
+
+/** @brief Get statistics of a port
+ *  @param [in]  UART_RING_t *port: port state
+ *  @param [out]  UART_RING_STAT_t *stat: storage of statistics
+ *  @return None
+ */
+void UartRing_GetStatistics(UART_RING_t *port, UART_RING_STAT_t *stat)
+{
+    taskENTER_CRITICAL();
+    *stat = port->stat;
+    taskEXIT_CRITICAL();
+}
+
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/** @file [UART_Ring.h]
+ *  @brief {single producer / single consumer ring buffers between the UART
+ * driver and the tasks using UART_1, UART_2, UART_4 and UART_6. Receiver is
+ * never stopped and transmitter never overwrites data not sent yet}
+ */
+/* ************************************************************************** */
+
+
+#ifndef _UART_RING_H    /* Guard against multiple inclusion */
+#define _UART_RING_H
+
+
+/* This section lists the other files that are included in this file.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "system_config.h"
+#include "system_definitions.h"
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief number of receive chunks. One is queued on the driver, the other
+ * one is queued from the completion of the first, before the driver removes
+ * it, so DRV_USART_RCV_QUEUE_SIZE_IDXn must be 2 at least */
+#define UART_RING_RX_CHUNK_NUM          (2)
+
+/** @brief size of a receive chunk. Bytes of the chunk being received are
+ * moved to RX ring by Read, they do not wait for the chunk to be full */
+#define UART_RING_RX_CHUNK_SIZE         (32)
+
+/** @brief value of rxActive when no chunk is queued on driver */
+#define UART_RING_RX_CHUNK_NONE         (0xFF)
+
+/** @brief Statistics of a UART port */
+typedef struct
+{
+    uint32_t rxOverrunCount;    /**<received bytes dropped because RX ring is full */
+    uint32_t txOverrunCount;    /**<packets refused because TX ring is full */
+    uint32_t rxErrorCount;      /**<receive errors reported by driver */
+    uint16_t rxHighWater;       /**<max number of bytes waiting in RX ring */
+    uint16_t txHighWater;       /**<max number of bytes waiting in TX ring */
+} UART_RING_STAT_t;
+
+/** @brief State of a UART port. Storage belongs to UART_x.c, members are only
+ * used by UART_Ring.c.
+ * One task writes (Send) and one task reads (Read) a port, the driver event
+ * handler is the other side of both rings */
+typedef struct
+{
+    DRV_HANDLE handle;                  /**<handle of Harmony USART driver */
+    uint8_t *txBuffer;                  /**<TX ring storage */
+    uint16_t txMask;                    /**<TX ring size - 1, size is power of 2 */
+    volatile uint16_t txHead;           /**<TX write index, moved by Send */
+    volatile uint16_t txTail;           /**<TX read index, moved by event handler */
+    volatile uint16_t txInFlight;       /**<bytes taken for driver from txTail, 0 if idle */
+    DRV_USART_BUFFER_HANDLE txBufferHandle; /**<driver buffer of bytes in flight */
+    uint8_t *rxBuffer;                  /**<RX ring storage */
+    uint16_t rxMask;                    /**<RX ring size - 1, size is power of 2 */
+    volatile uint16_t rxHead;           /**<RX write index, moved with UART interrupts masked */
+    volatile uint16_t rxTail;           /**<RX read index, moved by Read */
+    uint8_t rxChunk[UART_RING_RX_CHUNK_NUM][UART_RING_RX_CHUNK_SIZE]; /**<receive buffers of driver */
+    DRV_USART_BUFFER_HANDLE rxBufferHandle[UART_RING_RX_CHUNK_NUM]; /**<driver buffers of rxChunk */
+    volatile uint8_t rxActive;          /**<chunk queued on driver, UART_RING_RX_CHUNK_NONE if receiver is stopped */
+    uint8_t rxChunkRead;                /**<bytes of active chunk already moved to RX ring */
+    UART_RING_STAT_t stat;              /**<statistics */
+} UART_RING_t;
+
+
+    /** @brief Attach ring buffers to an opened USART driver and start receiving
+     * This function should be called 1 time at start up, by Uartx_Initialize
+     *  @param [in]  UART_RING_t *port: port state
+     *              DRV_HANDLE handle: handle of the opened driver
+     *              uint8_t *txBuffer: TX ring storage
+     *              uint16_t txSize: size of TX ring, power of 2
+     *              uint8_t *rxBuffer: RX ring storage
+     *              uint16_t rxSize: size of RX ring, power of 2
+     *  @param [out]  None
+     *  @return None
+     *  @retval true port is ready
+     *  @retval false invalid parameter or driver refused receive buffer
+     */
+    bool UartRing_Initialize(UART_RING_t *port, DRV_HANDLE handle,
+            uint8_t *txBuffer, uint16_t txSize,
+            uint8_t *rxBuffer, uint16_t rxSize);
+
+    /** @brief Copy a packet to TX ring and start sending if the transmitter is idle
+     *  @param [in]  UART_RING_t *port: port state
+     *              const uint8_t *data: packet
+     *              uint16_t len: size of packet
+     *  @param [out]  None
+     *  @return None
+     *  @retval true packet is queued
+     *  @retval false not enough free space in TX ring (packet is not queued)
+     * or driver refused the buffer
+     */
+    bool UartRing_Send(UART_RING_t *port, const uint8_t *data, uint16_t len);
+
+    /** @brief Take received bytes out of RX ring
+     *  @param [in]  UART_RING_t *port: port state
+     *              uint16_t len: size of storage
+     *  @param [out]  uint8_t *data: storage of received bytes
+     *  @return uint16_t number of bytes read
+     */
+    uint16_t UartRing_Read(UART_RING_t *port, uint8_t *data, uint16_t len);
+
+    /** @brief Get number of bytes waiting in RX ring
+     *  @param [in]  UART_RING_t *port: port state
+     *  @param [out]  None
+     *  @return uint16_t number of bytes
+     */
+    uint16_t UartRing_GetReceiveCount(UART_RING_t *port);
+
+    /** @brief Get statistics of a port
+     *  @param [in]  UART_RING_t *port: port state
+     *  @param [out]  UART_RING_STAT_t *stat: storage of statistics
+     *  @return None
+     */
+    void UartRing_GetStatistics(UART_RING_t *port, UART_RING_STAT_t *stat);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _UART_RING_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/** @file [VoicePrompt.c]
+ *  @brief {voice prompts stored as IMA-ADPCM (4 bit per sample) in program
+ * flash, decoded while playing by small chunks into the I2S buffers of the
+ * tone synthesizer. Only the decoder state is kept in RAM}
+ */
+/* ************************************************************************** */
+
+
+/* This section lists the other files that are included in this file.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "system_config.h"
+#include "system_definitions.h"
+
+#include "ToneSynth.h"
+#include "ImaAdpcm.h"
+#include "VoicePrompt.h"
+
+
+/** @brief table of voice prompts, index is E_VoicePromptId */
+static const VOICE_PROMPT_t * const s_voicePromptTable[eNumberOfVoicePrompt] =
+{
+    &g_voicePromptStart,
+    &g_voicePromptSync,
+};
+
+
+/** @brief Decode the next samples of a prompt, stream function of the tone
+ * synthesizer. This function is called in ISR, should not put any debug here
+ *  @param [in]  uint16_t count: size of buffer
+ *              uintptr_t context: prompt
+ *  @param [out]  int16_t *buffer: decoded samples
+ *              TONE_STREAM_STATE_t *state: position, predictor and step index
+ *  @return uint16_t number of samples decoded, 0 at end of prompt
+ */
+static uint16_t VoicePrompt_Stream(int16_t *buffer, uint16_t count,
+        TONE_STREAM_STATE_t *state, uintptr_t context)
+{
+    const VOICE_PROMPT_t *prompt = (const VOICE_PROMPT_t*) context;
+    IMA_ADPCM_STATE_t adpcm;
+    uint32_t remain = prompt->sampleCount - state->position;
+
+    if (count > remain)
+        count = remain;
+
+    adpcm.predictor = state->value[0];
+    adpcm.index = state->value[1];
+    imaAdpcm_Decode(&adpcm, prompt->data, state->position, buffer, count);
+    state->value[0] = adpcm.predictor;
+    state->value[1] = adpcm.index;
+    state->position += count;
+    return count;
+}
+
+/** @brief Play a voice prompt. If a sound is playing, the prompt replaces
+ * it from the next I2S buffer
+ *  @param [in]  E_VoicePromptId id: voice prompt
+ *  @param [out]  None
+ *  @return None
+ *  @retval true prompt is started
+ *  @retval false invalid prompt or audio not ready
+ */
+bool VoicePrompt_Play(E_VoicePromptId id)
+{
+    const VOICE_PROMPT_t *prompt;
+
+    if (id >= eNumberOfVoicePrompt)
+        return false;
+    prompt = s_voicePromptTable[id];
+
+    //no resampling, prompt must be encoded at I2S sample rate
+    if (prompt->sampleRate != DRV_I2S_BAUD_RATE)
+    {
+        SYS_PRINT("Voice prompt %d: sample rate %d not supported\n", id, prompt->sampleRate);
+        return false;
+    }
+    //stream state starts from 0 = ADPCM initial state
+    return ToneSynth_PlayStream(VoicePrompt_Stream, (uintptr_t) prompt);
+}
+
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/** @file [VoicePrompt.h]
+ *  @brief {voice prompts stored as IMA-ADPCM (4 bit per sample) in program
+ * flash, decoded while playing by small chunks into the I2S buffers of the
+ * tone synthesizer. Prompt data files are made by tools/VoiceAdpcmEncoder}
+ */
+/* ************************************************************************** */
+
+
+#ifndef _VOICE_PROMPT_H    /* Guard against multiple inclusion */
+#define _VOICE_PROMPT_H
+
+
+/* This section lists the other files that are included in this file.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief List of voice prompts */
+typedef enum
+{
+    eVoicePromptStart,
+    eVoicePromptSync,
+    eNumberOfVoicePrompt
+} E_VoicePromptId;
+
+/** @brief Descriptor of a voice prompt. Codes start from predictor 0 and step
+ * index 0, low nibble of a byte is the first code */
+typedef struct
+{
+    const uint8_t *data;        /**<IMA-ADPCM codes */
+    uint32_t sampleCount;       /**<number of samples */
+    uint32_t sampleRate;        /**<sample rate (Hz), must be the I2S sample rate */
+} VOICE_PROMPT_t;
+
+/** @brief voice prompts, in ptbl_voice_*_adpcm.c */
+extern const VOICE_PROMPT_t g_voicePromptStart;
+extern const VOICE_PROMPT_t g_voicePromptSync;
+
+
+    /** @brief Play a voice prompt. If a sound is playing, the prompt replaces
+     * it from the next I2S buffer
+     *  @param [in]  E_VoicePromptId id: voice prompt
+     *  @param [out]  None
+     *  @return None
+     *  @retval true prompt is started
+     *  @retval false invalid prompt or audio not ready
+     */
+    bool VoicePrompt_Play(E_VoicePromptId id);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VOICE_PROMPT_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,5192 @@
+/* Generated by tools/VoiceAdpcmEncoder from ptbl_voice_start.c
+   IMA-ADPCM, 124378 samples at 44100 Hz, 62189 bytes (PCM 248756 bytes) */
+
+#include "VoicePrompt.h"
+
+static const uint8_t s_voicePromptStartData[62189] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77,
+	0x09, 0x08, 0x18, 0x81, 0x2A, 0x11, 0x8B, 0x7A, 0x0B, 0xA2, 0x1C, 0x03,
+	0x2E, 0x82, 0x3A, 0xA9, 0xB0, 0x16, 0x29, 0xC9, 0x18, 0xA1, 0x33, 0xBB,
+	0xA0, 0x3B, 0x4B, 0x29, 0x3B, 0xB9, 0xE6, 0x21, 0x18, 0x99, 0xD3, 0x12,
+	0x8B, 0xC1, 0xA3, 0x39, 0x5C, 0x99, 0xB1, 0x21, 0x48, 0xC3, 0x93, 0x4A,
+	0xB0, 0x2E, 0x91, 0xB4, 0x92, 0x0C, 0xA4, 0x90, 0xE0, 0x81, 0x08, 0xB9,
+	0xC4, 0x11, 0xB3, 0xF3, 0x19, 0x41, 0xB9, 0x10, 0x23, 0x1F, 0x10, 0x1B,
+	0xA1, 0x8B, 0x09, 0xA2, 0x0B, 0xAB, 0x7B, 0x08, 0x0B, 0x4A, 0xD1, 0x02,
+	0x11, 0x9A, 0x22, 0x1A, 0x3B, 0x10, 0x39, 0x11, 0x33, 0xBC, 0xB9, 0x3C,
+	0x09, 0xB4, 0x0A, 0x20, 0x2B, 0x2B, 0x21, 0x1F, 0x89, 0x09, 0x70, 0xC8,
+	0x88, 0x90, 0x03, 0x6A, 0x1B, 0x88, 0xA1, 0x85, 0x0A, 0x98, 0x11, 0x98,
+	0x03, 0xBB, 0x97, 0x31, 0x28, 0x1A, 0x3B, 0x0F, 0x83, 0xA1, 0x31, 0xDA,
+	0xC3, 0x08, 0x89, 0x19, 0xE6, 0x11, 0x0A, 0x3A, 0x83, 0x1B, 0x3B, 0xA4,
+	0x41, 0x1A, 0x1B, 0x93, 0x97, 0xB1, 0x14, 0xC9, 0x98, 0x13, 0x84, 0x1D,
+	0xA0, 0x28, 0x3A, 0x90, 0xA1, 0x00, 0x3D, 0xF2, 0x10, 0x89, 0x40, 0x0C,
+	0x92, 0xA8, 0x32, 0xB1, 0x27, 0x0B, 0x0E, 0x92, 0x90, 0x92, 0xA9, 0x6C,
+	0x18, 0x00, 0x5B, 0x1A, 0xA2, 0xE1, 0x02, 0x98, 0xD3, 0x92, 0x92, 0xA3,
+	0xB1, 0x4A, 0x10, 0x9A, 0xB3, 0x60, 0x2B, 0x3B, 0x82, 0xB5, 0x31, 0x19,
+	0x59, 0xB1, 0x39, 0xA3, 0xE0, 0xB4, 0x81, 0x10, 0x21, 0x8F, 0x18, 0xBA,
+	0x85, 0xB1, 0xA3, 0x93, 0x9B, 0xC4, 0xC3, 0x23, 0x1B, 0x96, 0x0C, 0x04,
+	0xA2, 0x02, 0x5B, 0xA9, 0x00, 0xF5, 0x10, 0x1A, 0x80, 0x90, 0xC8, 0x93,
+	0xC9, 0x29, 0x19, 0x9A, 0x7B, 0x81, 0x29, 0x3B, 0x00, 0xB5, 0x23, 0x4A,
+	0x2A, 0x90, 0x21, 0x5D, 0x9A, 0xA8, 0x23, 0x8F, 0x91, 0x89, 0xB1, 0xE1,
+	0x94, 0x91, 0x20, 0x90, 0x12, 0x1B, 0xB3, 0x7B, 0x19, 0x91, 0x20, 0x19,
+	0x2F, 0xB0, 0xBA, 0x03, 0x4B, 0x03, 0x4F, 0x1A, 0x2B, 0x90, 0x85, 0xB0,
+	0xC4, 0xA1, 0x10, 0x4B, 0x2C, 0x8B, 0x90, 0xA1, 0xA5, 0x02, 0x09, 0xD3,
+	0x3A, 0x1F, 0x8A, 0x32, 0x1A, 0x11, 0x1E, 0x19, 0xB0, 0x63, 0xB8, 0x08,
+	0x01, 0x18, 0xB9, 0xB5, 0x19, 0xA2, 0x7A, 0x9A, 0xA8, 0x6A, 0xC0, 0x13,
+	0x0A, 0xA0, 0x71, 0x2C, 0x99, 0x28, 0x00, 0x89, 0xB3, 0x4C, 0x80, 0x3A,
+	0x9A, 0x51, 0x19, 0x4A, 0x2B, 0x1B, 0x51, 0xCB, 0x03, 0xF0, 0x01, 0x90,
+	0x3A, 0x91, 0x0A, 0xB3, 0x17, 0xDB, 0x12, 0xA2, 0x31, 0xD9, 0x82, 0x11,
+	0xC9, 0x95, 0xB8, 0x1A, 0x30, 0x90, 0x31, 0x7B, 0xA0, 0x13, 0x09, 0x0B,
+	0x2F, 0x9A, 0xA5, 0x02, 0x6A, 0x9A, 0x29, 0x39, 0xAA, 0xB2, 0x14, 0xBA,
+	0x97, 0x00, 0x98, 0xB3, 0xB7, 0x12, 0x3B, 0x2A, 0x7A, 0x3A, 0x0D, 0xB1,
+	0x02, 0x00, 0x0C, 0x94, 0xA2, 0x3B, 0x13, 0x1F, 0x01, 0x20, 0xB9, 0x13,
+	0xB9, 0x50, 0x3B, 0x30, 0x2F, 0x3B, 0x5B, 0xC2, 0x88, 0x89, 0x32, 0xC0,
+	0x30, 0xA0, 0xD1, 0x2B, 0x82, 0xA9, 0xC1, 0xE3, 0x12, 0x3A, 0x4B, 0xE9,
+	0x83, 0x38, 0xA1, 0x86, 0x00, 0x2A, 0x1A, 0x10, 0x95, 0x1A, 0x3F, 0x90,
+	0x90, 0x80, 0x20, 0xD0, 0x83, 0x25, 0x8A, 0x2A, 0xA6, 0x20, 0x09, 0xAA,
+	0x39, 0xB1, 0xA3, 0xA7, 0x88, 0x00, 0x01, 0x3C, 0x4A, 0x2C, 0x01, 0x0B,
+	0x3B, 0x31, 0x0B, 0x7B, 0x90, 0x80, 0xE0, 0x92, 0x10, 0x4A, 0x0B, 0xE1,
+	0xA3, 0x01, 0xD5, 0x02, 0x28, 0x98, 0xB4, 0xA2, 0xA1, 0x91, 0x39, 0xC6,
+	0x19, 0x89, 0x39, 0xD9, 0x94, 0xB0, 0x95, 0x82, 0x92, 0x98, 0x90, 0xC9,
+	0xC1, 0x31, 0x2D, 0x22, 0x4C, 0x0A, 0x1B, 0x09, 0x97, 0x6A, 0xAA, 0xB3,
+	0x91, 0x29, 0xA9, 0xB2, 0x01, 0x87, 0xA9, 0xA2, 0xC3, 0x32, 0x1D, 0x91,
+	0x81, 0xFB, 0x11, 0x91, 0x49, 0x1E, 0xA1, 0x99, 0x38, 0x69, 0x1F, 0x00,
+	0x90, 0x00, 0x80, 0x98, 0x09, 0x90, 0x29, 0xF3, 0xB1, 0x20, 0x4E, 0x8A,
+	0xA1, 0x18, 0x12, 0x19, 0xAB, 0x7C, 0x80, 0x99, 0x19, 0xBA, 0x82, 0x5B,
+	0xD1, 0x93, 0x0C, 0x12, 0x3B, 0x04, 0xC9, 0x90, 0x10, 0x0F, 0x01, 0x19,
+	0x93, 0x3C, 0x08, 0xBB, 0x07, 0x89, 0x80, 0x98, 0x86, 0xAA, 0xC4, 0x93,
+	0x19, 0xA9, 0x5B, 0x3A, 0xF1, 0x90, 0x91, 0x8A, 0x19, 0xA3, 0xAC, 0x50,
+	0x81, 0x22, 0x09, 0xBB, 0xF3, 0xB4, 0x03, 0x2A, 0x49, 0xC0, 0x93, 0xA1,
+	0xD0, 0x05, 0xA1, 0x0A, 0x50, 0x9B, 0xA8, 0xA6, 0x92, 0x89, 0xA0, 0x48,
+	0x9B, 0xB7, 0x91, 0xA2, 0x98, 0x85, 0x5A, 0x0A, 0x11, 0xB8, 0x03, 0xAB,
+	0x95, 0x19, 0xF3, 0x91, 0x39, 0x0B, 0xB0, 0x85, 0xB3, 0x90, 0x4C, 0x0B,
+	0x78, 0x1A, 0x1A, 0xA1, 0x32, 0x39, 0x33, 0x8F, 0x09, 0xA1, 0x02, 0x11,
+	0x2D, 0x89, 0xB3, 0xA7, 0xB3, 0x30, 0x0F, 0x00, 0xA0, 0xA0, 0x71, 0x1B,
+	0x19, 0x20, 0xAA, 0xA5, 0x01, 0x10, 0x09, 0x7A, 0x88, 0x2D, 0x19, 0xA0,
+	0x23, 0x9B, 0xC1, 0x50, 0xBA, 0x41, 0x38, 0x1B, 0x1A, 0x95, 0x28, 0x7B,
+	0x18, 0x3A, 0x88, 0xB3, 0xE6, 0x93, 0x20, 0xB8, 0x11, 0xBA, 0x5E, 0x18,
+	0x90, 0x18, 0xC0, 0x92, 0x3B, 0xC2, 0x90, 0xC0, 0x13, 0x2B, 0x53, 0x3B,
+	0xBA, 0x97, 0x22, 0x2A, 0x3B, 0x0F, 0x91, 0x92, 0x39, 0x88, 0x2B, 0x2E,
+	0xB3, 0xA1, 0xD4, 0x81, 0x19, 0x21, 0xDB, 0x30, 0x3C, 0xAB, 0xA4, 0xD2,
+	0xA4, 0x02, 0xA3, 0x3A, 0x1D, 0x08, 0x18, 0xB4, 0x21, 0x01, 0x0E, 0x18,
+	0x6B, 0x9A, 0x29, 0xC2, 0xA0, 0x01, 0xA9, 0x99, 0x93, 0xC1, 0x69, 0x1F,
+	0x82, 0x99, 0x93, 0x89, 0x7B, 0x98, 0x92, 0x2B, 0xB2, 0x91, 0x03, 0xAD,
+	0x39, 0x39, 0x9D, 0x85, 0x91, 0x1B, 0xA0, 0xA7, 0x90, 0x92, 0x92, 0xFA,
+	0x00, 0x19, 0x82, 0xC1, 0x19, 0x3A, 0x32, 0x1E, 0x4A, 0x8B, 0x50, 0x2A,
+	0x2A, 0xC1, 0xA3, 0x20, 0x5F, 0x88, 0x0A, 0x88, 0x97, 0x1B, 0x4B, 0x88,
+	0x90, 0xB2, 0x20, 0x19, 0xD9, 0xA3, 0x24, 0xAA, 0xB4, 0xA1, 0x79, 0x3C,
+	0x0A, 0xB1, 0x01, 0xE0, 0xC3, 0x19, 0x08, 0xD8, 0x01, 0x90, 0x40, 0x91,
+	0x81, 0x20, 0x99, 0x20, 0xBA, 0xF3, 0x19, 0xA1, 0x92, 0xC1, 0x10, 0x50,
+	0x5C, 0x8A, 0x10, 0x2A, 0xC2, 0xA5, 0x80, 0x02, 0x2D, 0x19, 0x29, 0x3A,
+	0xA9, 0x29, 0xD5, 0x90, 0x91, 0x02, 0xD9, 0x22, 0x28, 0x5F, 0x19, 0x2A,
+	0x1A, 0x39, 0x30, 0x9B, 0x94, 0x48, 0xB1, 0x79, 0x98, 0x30, 0xD9, 0x89,
+	0x81, 0x3A, 0xA3, 0x93, 0x7A, 0xA0, 0xA3, 0x1B, 0x4A, 0x9A, 0x23, 0x0A,
+	0x1A, 0x1D, 0xB2, 0xC3, 0x23, 0x22, 0x7B, 0xB1, 0x42, 0x1A, 0x02, 0xB6,
+	0x90, 0x95, 0x21, 0x11, 0x84, 0x13, 0x17, 0x02, 0x15, 0x44, 0x31, 0x12,
+	0x36, 0x73, 0x77, 0x92, 0x99, 0xFB, 0x8C, 0x22, 0x80, 0x11, 0xD9, 0x1B,
+	0x25, 0x80, 0x10, 0xEC, 0x0B, 0x22, 0x81, 0x10, 0xFB, 0x8A, 0x12, 0x08,
+	0x12, 0xD9, 0x39, 0x23, 0x89, 0x81, 0xCC, 0x09, 0x91, 0x8A, 0x41, 0x22,
+	0x34, 0xA0, 0xBD, 0x09, 0x73, 0x22, 0x98, 0xA9, 0x19, 0x45, 0x92, 0xAC,
+	0xBB, 0x1B, 0x57, 0x12, 0x08, 0x99, 0x8B, 0x22, 0x98, 0x09, 0xD9, 0x1C,
+	0x66, 0x04, 0x99, 0x98, 0xBE, 0x29, 0x12, 0x10, 0x91, 0xBD, 0x51, 0x03,
+	0x89, 0xA8, 0xBE, 0x38, 0x15, 0x00, 0xA8, 0xCB, 0x18, 0x92, 0x1A, 0x82,
+	0x0A, 0x65, 0x82, 0x8A, 0x89, 0xB8, 0x89, 0xD9, 0x9B, 0x74, 0x03, 0x80,
+	0xA9, 0xAC, 0x48, 0x23, 0x88, 0xA9, 0xAA, 0x73, 0x03, 0xCA, 0xB9, 0xBB,
+	0x70, 0x14, 0x00, 0x81, 0xAA, 0x18, 0xC0, 0x0B, 0x02, 0xAC, 0x40, 0x04,
+	0x08, 0x12, 0xFA, 0x8A, 0x80, 0x28, 0x35, 0x81, 0x8A, 0xA8, 0xAD, 0x88,
+	0x01, 0x09, 0x24, 0x01, 0x64, 0x03, 0x9A, 0xB9, 0xCF, 0x18, 0x14, 0x11,
+	0x02, 0xC9, 0x09, 0x24, 0x80, 0x24, 0x00, 0x71, 0x36, 0x72, 0x24, 0x10,
+	0x21, 0xB0, 0x39, 0x06, 0x88, 0x80, 0xDB, 0x29, 0x04, 0xA9, 0xB9, 0xEF,
+	0x09, 0x81, 0x80, 0xA0, 0xCB, 0x89, 0xA0, 0x9A, 0xEB, 0xAD, 0x09, 0x12,
+	0x11, 0x80, 0xFF, 0xAB, 0xBA, 0x9A, 0x88, 0xDB, 0x9C, 0x88, 0x51, 0x26,
+	0x98, 0xBA, 0xBB, 0x78, 0x14, 0x81, 0xA9, 0xBB, 0x68, 0x24, 0x00, 0xA8,
+	0xAA, 0x73, 0x24, 0x01, 0x90, 0xAB, 0x30, 0x24, 0x21, 0x80, 0x19, 0x63,
+	0x23, 0x21, 0x80, 0x31, 0x25, 0x98, 0x88, 0xDB, 0x09, 0x91, 0xBC, 0x89,
+	0x28, 0x67, 0x92, 0xA9, 0xB9, 0xAC, 0x20, 0xE8, 0xBB, 0xDA, 0x8B, 0x32,
+	0xB0, 0x9A, 0xEA, 0x0B, 0x43, 0x90, 0xAA, 0xDC, 0x8B, 0x00, 0x99, 0x80,
+	0xAB, 0x50, 0x34, 0x51, 0x14, 0x89, 0x11, 0xB9, 0x3A, 0x84, 0x49, 0x37,
+	0x22, 0x63, 0x03, 0x08, 0x12, 0x89, 0x30, 0x03, 0x38, 0x24, 0x00, 0x31,
+	0xA2, 0x70, 0x23, 0x13, 0x81, 0xEA, 0xAB, 0xBE, 0xCC, 0xCB, 0xBA, 0x99,
+	0x98, 0xC9, 0xAD, 0xBA, 0xBD, 0xBA, 0xBC, 0xAE, 0xAA, 0xBA, 0xAC, 0xBA,
+	0xAD, 0x8A, 0xCA, 0x09, 0xA9, 0xBB, 0xC9, 0xBF, 0x99, 0xAB, 0x31, 0x32,
+	0x57, 0x13, 0x21, 0x82, 0x29, 0x21, 0x34, 0x32, 0x34, 0x65, 0x34, 0x24,
+	0x80, 0x00, 0x08, 0x73, 0x24, 0x10, 0x01, 0x88, 0x32, 0x25, 0x80, 0x88,
+	0x08, 0x73, 0x24, 0x80, 0xA8, 0xBB, 0x8A, 0x81, 0x9A, 0xA8, 0xBD, 0x99,
+	0xC8, 0xCC, 0xCA, 0xBB, 0xAD, 0xA9, 0x8A, 0x88, 0xEA, 0xCC, 0xAB, 0x9B,
+	0x00, 0x81, 0xCA, 0x9B, 0x89, 0x11, 0xA1, 0xBF, 0x9A, 0x70, 0x25, 0x31,
+	0x24, 0x88, 0x31, 0x02, 0x30, 0x24, 0x10, 0x45, 0x02, 0x31, 0x26, 0x80,
+	0x32, 0x81, 0x62, 0x23, 0x20, 0xB1, 0xBD, 0x08, 0x90, 0x90, 0x89, 0xEA,
+	0x8B, 0x98, 0xED, 0xAC, 0xBC, 0xBB, 0xBB, 0xCB, 0xBD, 0xBB, 0xBD, 0xAB,
+	0xA9, 0xCA, 0xBA, 0xCD, 0xBA, 0xAB, 0xBA, 0xBD, 0xBA, 0xAC, 0x19, 0x21,
+	0x10, 0x47, 0x01, 0x11, 0x13, 0xAA, 0x52, 0x11, 0x62, 0x23, 0x41, 0x47,
+	0x11, 0x32, 0x22, 0x21, 0x44, 0x22, 0x12, 0x02, 0x21, 0x35, 0x22, 0x24,
+	0x33, 0x33, 0x37, 0x11, 0x02, 0x98, 0xA8, 0xAA, 0xAC, 0xA9, 0x9B, 0xC9,
+	0x9C, 0xBA, 0xAD, 0xCB, 0xBC, 0xBD, 0xBC, 0xAC, 0xAA, 0xCC, 0xAB, 0xAA,
+	0xBB, 0x18, 0x11, 0x00, 0x32, 0xE1, 0x9B, 0xFB, 0x9C, 0x80, 0x9A, 0x30,
+	0x23, 0x73, 0x34, 0x11, 0x31, 0x21, 0x52, 0x14, 0x80, 0x01, 0x98, 0x38,
+	0x35, 0x10, 0x35, 0x43, 0x34, 0x12, 0x91, 0xBA, 0xAE, 0xCA, 0xAD, 0x98,
+	0xBA, 0x9A, 0xDA, 0xAD, 0x88, 0xAA, 0xCC, 0xDC, 0xAB, 0xA9, 0xBB, 0xCB,
+	0xCE, 0x89, 0x99, 0x18, 0xB0, 0xBD, 0x09, 0xB8, 0x1B, 0x91, 0xBD, 0x62,
+	0x02, 0x20, 0x13, 0x8B, 0x55, 0x01, 0x40, 0x22, 0x21, 0x47, 0x12, 0x21,
+	0x31, 0x32, 0x36, 0x13, 0x23, 0x32, 0x52, 0x43, 0x12, 0x11, 0x21, 0x25,
+	0x33, 0x24, 0x01, 0x18, 0x01, 0x88, 0xA8, 0xBC, 0xAA, 0xCB, 0xBB, 0xBD,
+	0xCE, 0x99, 0xDA, 0xAB, 0xCA, 0xBC, 0x08, 0x91, 0x9A, 0xA0, 0xCF, 0xAB,
+	0xB9, 0xAC, 0x88, 0xB9, 0x28, 0x04, 0x9A, 0x43, 0xA8, 0x09, 0x24, 0x01,
+	0x35, 0x00, 0x00, 0x81, 0x2A, 0x77, 0x13, 0x30, 0x04, 0x88, 0x11, 0xC8,
+	0xAB, 0xDB, 0xAB, 0x08, 0x80, 0xA0, 0xDB, 0xCE, 0xAA, 0xBB, 0xCC, 0xD9,
+	0xBC, 0x99, 0xEB, 0x9B, 0xE9, 0xAC, 0x88, 0xBA, 0x08, 0xB9, 0x9D, 0x80,
+	0xAC, 0x10, 0xA8, 0x29, 0x27, 0x09, 0x32, 0xC0, 0x49, 0x04, 0x89, 0x54,
+	0x81, 0x51, 0x14, 0x21, 0x22, 0x22, 0x43, 0x24, 0x32, 0x14, 0x32, 0x33,
+	0x34, 0x33, 0x14, 0x43, 0x23, 0x34, 0x14, 0x81, 0x12, 0xA9, 0x39, 0xC3,
+	0x8E, 0x02, 0xBC, 0x18, 0xD0, 0x9C, 0x90, 0xBD, 0x19, 0x00, 0xAA, 0xAB,
+	0xDE, 0xAA, 0xBB, 0xCA, 0xAB, 0xAB, 0x20, 0x22, 0xA0, 0xAE, 0x80, 0x1A,
+	0x26, 0xBA, 0x09, 0xD0, 0x4A, 0x05, 0x9A, 0x42, 0x11, 0x52, 0x24, 0x98,
+	0x01, 0xD9, 0x8B, 0xA0, 0xAB, 0x20, 0xFA, 0x0B, 0xB0, 0x9C, 0x00, 0xEF,
+	0x0A, 0xB8, 0xAC, 0xA9, 0xDC, 0xBA, 0xAA, 0xCB, 0x9A, 0xBA, 0x9B, 0x80,
+	0xDE, 0x89, 0xA0, 0x9A, 0x41, 0xA1, 0x38, 0x03, 0x8B, 0x36, 0xA0, 0x71,
+	0x14, 0x08, 0x54, 0x12, 0x41, 0x22, 0x10, 0x34, 0x33, 0x45, 0x12, 0x11,
+	0x43, 0x23, 0x32, 0x23, 0x22, 0x54, 0x23, 0x32, 0x13, 0x99, 0x31, 0x91,
+	0x0B, 0x13, 0xFB, 0x1B, 0xC8, 0x9D, 0x88, 0xA8, 0x70, 0xA3, 0xBF, 0x98,
+	0xDA, 0x9B, 0xB9, 0xAE, 0x09, 0x08, 0x21, 0x81, 0xBD, 0x10, 0x90, 0x88,
+	0xD9, 0xAC, 0x09, 0x08, 0x43, 0xA8, 0x29, 0x47, 0x01, 0x21, 0x01, 0x98,
+	0x9A, 0xCC, 0xBA, 0x8A, 0x20, 0x03, 0xDA, 0x99, 0x00, 0x90, 0xEE, 0xCD,
+	0xAB, 0xA9, 0xDA, 0xBB, 0xCC, 0x9C, 0x80, 0xCB, 0xAB, 0xD9, 0xAC, 0x08,
+	0xB9, 0x9C, 0xA8, 0x8B, 0x54, 0x82, 0x18, 0x80, 0xAB, 0x63, 0x81, 0x42,
+	0x90, 0x29, 0x57, 0x11, 0x42, 0x02, 0x38, 0x44, 0x13, 0x43, 0x82, 0x28,
+	0x33, 0x42, 0x44, 0x12, 0x22, 0x43, 0x32, 0x24, 0x01, 0x80, 0x98, 0x8A,
+	0x32, 0x88, 0xA0, 0xCC, 0x09, 0x73, 0x24, 0x14, 0xD9, 0xCB, 0xAA, 0xBB,
+	0xBC, 0xDC, 0x9A, 0x89, 0x20, 0x23, 0xC9, 0x9C, 0x00, 0x98, 0x80, 0xEC,
+	0xBB, 0x88, 0x29, 0x24, 0x80, 0x48, 0x34, 0x11, 0x22, 0xA8, 0xCA, 0xCD,
+	0xAA, 0x80, 0x99, 0x22, 0xB0, 0xAC, 0x41, 0xC0, 0xCB, 0xEE, 0xAC, 0x98,
+	0xCB, 0xAA, 0xDC, 0x9A, 0xA8, 0xAB, 0xA0, 0xBE, 0x89, 0xC9, 0xAC, 0x99,
+	0x8A, 0x42, 0x03, 0x88, 0x08, 0xCA, 0x58, 0x04, 0x08, 0x23, 0x22, 0x66,
+	0x11, 0x32, 0x23, 0x41, 0x45, 0x32, 0x23, 0x14, 0x12, 0x30, 0x34, 0x32,
+	0x26, 0x12, 0x43, 0x22, 0x33, 0x02, 0x88, 0x90, 0x28, 0x11, 0x32, 0xD1,
+	0xBC, 0x08, 0x74, 0x26, 0xA0, 0xA9, 0xCE, 0x0A, 0x90, 0xAB, 0xCA, 0xAC,
+	0x28, 0x14, 0x98, 0xAB, 0xAD, 0x48, 0x03, 0xBA, 0xCA, 0xAE, 0x38, 0x02,
+	0x20, 0x03, 0x0A, 0x37, 0x80, 0x18, 0xB8, 0xAC, 0x9A, 0x9A, 0x31, 0x23,
+	0xBA, 0xCB, 0xBE, 0x41, 0x82, 0xCF, 0xBD, 0x9A, 0xA9, 0xBD, 0xBA, 0xBD,
+	0x10, 0xA0, 0xAB, 0xFB, 0x9E, 0x09, 0xA8, 0x8A, 0x88, 0x41, 0x34, 0x90,
+	0xA9, 0xBC, 0x1A, 0x34, 0x81, 0x88, 0x48, 0x46, 0x33, 0x33, 0x12, 0x31,
+	0x37, 0x43, 0x14, 0x00, 0x18, 0x13, 0x40, 0x45, 0x21, 0x32, 0x32, 0x31,
+	0x16, 0x98, 0x88, 0xAA, 0x1A, 0x24, 0x21, 0x14, 0x19, 0x57, 0x02, 0xA9,
+	0xBA, 0xAE, 0x8A, 0xA8, 0xBA, 0xBD, 0x99, 0x40, 0x03, 0xA8, 0xCB, 0x9A,
+	0x9A, 0x99, 0xCD, 0xBD, 0x09, 0x10, 0x42, 0x21, 0x52, 0x82, 0x98, 0x01,
+	0xC9, 0x99, 0xFB, 0xAB, 0x08, 0x23, 0x45, 0x81, 0xAC, 0x08, 0xA0, 0xBA,
+	0xEE, 0xAC, 0xAA, 0xBB, 0x99, 0xDA, 0x9C, 0x98, 0xAB, 0x88, 0xDD, 0x9B,
+	0xB9, 0x9B, 0x54, 0x02, 0x18, 0xB9, 0xAC, 0x31, 0xA1, 0x48, 0xB1, 0x2C,
+	0x57, 0x12, 0x11, 0x82, 0x31, 0x26, 0x33, 0x24, 0x00, 0x20, 0x32, 0x34,
+	0x35, 0x32, 0x44, 0x12, 0x32, 0x23, 0x88, 0x90, 0xAD, 0x20, 0x22, 0x24,
+	0x04, 0x2B, 0x77, 0x03, 0x88, 0xDA, 0x9D, 0x18, 0x98, 0x09, 0xD9, 0x9B,
+	0x42, 0x82, 0x08, 0xDA, 0xBB, 0x21, 0xB0, 0x9A, 0xFA, 0x8C, 0x21, 0x12,
+	0x42, 0x83, 0x8A, 0x90, 0x89, 0x21, 0xF9, 0xAD, 0x99, 0x08, 0x35, 0x03,
+	0xC9, 0xAA, 0xA9, 0x08, 0xE9, 0xCE, 0xAB, 0x99, 0x8A, 0xA9, 0xCC, 0x9C,
+	0x90, 0x89, 0x88, 0x9A, 0x38, 0x05, 0xAB, 0xBB, 0xCC, 0x29, 0x93, 0x1A,
+	0x37, 0x01, 0x74, 0x02, 0x09, 0x22, 0x08, 0x55, 0x12, 0x20, 0x23, 0x21,
+	0x45, 0x13, 0x30, 0x25, 0x30, 0x34, 0x11, 0x10, 0x91, 0x0A, 0x24, 0x10,
+	0x22, 0x01, 0x21, 0x54, 0x47, 0x21, 0x00, 0xE9, 0xAC, 0x88, 0xAA, 0x08,
+	0xD9, 0x8B, 0x53, 0x81, 0x80, 0xFC, 0xAB, 0x10, 0x88, 0x00, 0xDA, 0x8A,
+	0x12, 0x20, 0x25, 0x99, 0x10, 0x81, 0x0A, 0x90, 0xCF, 0x9B, 0x9B, 0x08,
+	0x34, 0x12, 0xA0, 0xCE, 0x9B, 0xA9, 0xCC, 0xBD, 0xBC, 0x99, 0x00, 0x90,
+	0xBE, 0xBB, 0xA9, 0x20, 0x24, 0x88, 0x10, 0xB0, 0xAE, 0xA9, 0xBD, 0x38,
+	0x12, 0x72, 0x25, 0x12, 0x22, 0x91, 0x8A, 0x31, 0x36, 0x53, 0x13, 0x10,
+	0x34, 0x24, 0x42, 0x24, 0x31, 0x43, 0x23, 0x13, 0x90, 0xBA, 0x09, 0x01,
+	0x73, 0x26, 0x91, 0x20, 0x33, 0x47, 0x02, 0xB9, 0xCC, 0xAC, 0x19, 0x81,
+	0x98, 0xBA, 0x29, 0x55, 0x12, 0xBA, 0xCC, 0xCB, 0x09, 0x81, 0xAA, 0xA9,
+	0x8A, 0x54, 0x33, 0x21, 0x03, 0xCB, 0xAB, 0x9A, 0xBA, 0xBE, 0xDC, 0x8A,
+	0x10, 0x33, 0x14, 0xEC, 0xAA, 0xBA, 0x9B, 0xB8, 0xFF, 0x99, 0xA8, 0x8A,
+	0x02, 0xCA, 0x28, 0x01, 0x28, 0x25, 0xDB, 0x8A, 0xCB, 0x0A, 0x32, 0x00,
+	0x25, 0x00, 0x73, 0x23, 0x10, 0x01, 0xBA, 0x51, 0x24, 0x21, 0x13, 0x00,
+	0x65, 0x23, 0x33, 0x14, 0x00, 0x22, 0x12, 0x00, 0xA0, 0x9C, 0x30, 0x62,
+	0x34, 0x23, 0x12, 0x75, 0x02, 0x88, 0xBA, 0xBF, 0x8A, 0x88, 0x18, 0x82,
+	0x89, 0x31, 0x16, 0x99, 0xDA, 0xCC, 0x8A, 0x98, 0x89, 0x90, 0xAB, 0x33,
+	0x43, 0x45, 0x22, 0x98, 0xB9, 0xAE, 0x99, 0x99, 0xCA, 0x8A, 0x10, 0x42,
+	0x24, 0xF9, 0xBB, 0xDB, 0xBB, 0xAC, 0xCB, 0x8C, 0x99, 0xCB, 0x9A, 0xC9,
+	0x29, 0x25, 0x88, 0x80, 0xEB, 0x0A, 0xA8, 0xAD, 0x00, 0x00, 0x64, 0x14,
+	0x00, 0x01, 0x88, 0x20, 0x04, 0x18, 0x24, 0x22, 0x45, 0x11, 0x42, 0x22,
+	0x42, 0x25, 0x02, 0x12, 0x00, 0x80, 0x80, 0x11, 0x10, 0x44, 0x34, 0x21,
+	0x73, 0x14, 0x98, 0x42, 0xD8, 0x9D, 0x98, 0xAC, 0x30, 0x91, 0x28, 0x12,
+	0xB9, 0x09, 0xE8, 0xCC, 0xAA, 0xA9, 0x21, 0xB8, 0x19, 0xB1, 0x3C, 0x67,
+	0x80, 0x10, 0xA9, 0x8A, 0xB8, 0xBC, 0x0A, 0x88, 0x88, 0x21, 0xFA, 0xAD,
+	0xCA, 0xBE, 0x9B, 0xAA, 0xB8, 0xAE, 0xA9, 0x89, 0x42, 0x03, 0x89, 0xD9,
+	0xAD, 0x20, 0xA0, 0xDB, 0x8A, 0x28, 0x46, 0x23, 0x91, 0x88, 0x20, 0x53,
+	0x13, 0x99, 0x08, 0x71, 0x24, 0x23, 0x34, 0x11, 0x52, 0x14, 0x22, 0x81,
+	0x89, 0x8A, 0x20, 0x44, 0x24, 0x22, 0x10, 0x21, 0x35, 0x35, 0x82, 0xEC,
+	0xBB, 0x99, 0x08, 0x31, 0x91, 0x18, 0x22, 0x81, 0xB0, 0xFF, 0x9F, 0x89,
+	0x00, 0x01, 0x88, 0x99, 0x89, 0x41, 0x23, 0x80, 0xC9, 0xAC, 0x99, 0x8B,
+	0x80, 0xB9, 0x9B, 0x98, 0x52, 0xF8, 0xDE, 0xBC, 0xAA, 0xCA, 0x89, 0xB9,
+	0x9D, 0x30, 0x01, 0x62, 0x92, 0xBC, 0x00, 0xBC, 0x09, 0xB1, 0x0C, 0x34,
+	0x31, 0x55, 0x92, 0x19, 0x02, 0x8A, 0x63, 0x91, 0x09, 0x15, 0x00, 0x45,
+	0x12, 0x21, 0x23, 0x12, 0x33, 0x90, 0xA9, 0x8C, 0x42, 0x22, 0x44, 0x14,
+	0x31, 0x03, 0x21, 0x90, 0x52, 0x93, 0xDF, 0xBB, 0xAC, 0x28, 0x26, 0x10,
+	0x81, 0xBA, 0x9B, 0xA9, 0xBD, 0xBC, 0x9A, 0x42, 0x13, 0x81, 0xB8, 0xAE,
+	0x32, 0x02, 0x32, 0xE1, 0xAE, 0xA8, 0x9A, 0x11, 0x00, 0x98, 0xEA, 0xCC,
+	0xCB, 0xBC, 0xBD, 0xBB, 0xBB, 0x09, 0x24, 0x22, 0x13, 0xE9, 0x9B, 0xC9,
+	0x9A, 0xAA, 0xAC, 0x40, 0x25, 0x44, 0x02, 0x98, 0x19, 0x33, 0x35, 0x12,
+	0xB9, 0x0B, 0x37, 0x43, 0x43, 0x21, 0x33, 0x36, 0x14, 0x90, 0x99, 0x99,
+	0x38, 0x35, 0x21, 0x42, 0x80, 0x11, 0x32, 0x92, 0xAC, 0x64, 0xA2, 0xAC,
+	0xD9, 0xBD, 0x28, 0x03, 0x41, 0x04, 0xCB, 0x9A, 0xB9, 0xAD, 0x99, 0x8A,
+	0x43, 0x02, 0x31, 0xC0, 0x9E, 0x10, 0x89, 0x32, 0xC0, 0x9C, 0xB8, 0xAD,
+	0x28, 0x81, 0x99, 0xFA, 0xCB, 0xBB, 0xDC, 0xBB, 0xBC, 0x19, 0x44, 0x13,
+	0x01, 0xC9, 0x9C, 0x98, 0x9A, 0x88, 0xBB, 0x60, 0x24, 0x24, 0x01, 0x90,
+	0x18, 0x21, 0x33, 0x23, 0xB8, 0x2A, 0x67, 0x21, 0x36, 0x13, 0x52, 0x02,
+	0x00, 0x81, 0xC9, 0x0A, 0x20, 0x44, 0x44, 0x12, 0x00, 0x00, 0xB9, 0x19,
+	0x90, 0x50, 0x15, 0xD9, 0xAC, 0x9A, 0x31, 0x26, 0x02, 0xAA, 0xBB, 0xAA,
+	0xAA, 0xFD, 0x8A, 0x18, 0x53, 0x14, 0xA8, 0xAA, 0xBB, 0x19, 0x81, 0x88,
+	0xCA, 0xBC, 0x8C, 0x89, 0xB8, 0xCE, 0xDA, 0xAB, 0x99, 0xC9, 0xBC, 0x9A,
+	0x89, 0x64, 0x12, 0x98, 0xA9, 0xDB, 0x8A, 0xB8, 0x8B, 0x63, 0x34, 0x34,
+	0x01, 0x00, 0xA8, 0x09, 0x01, 0x2A, 0x77, 0x13, 0x20, 0x01, 0x09, 0x64,
+	0x12, 0x10, 0x01, 0x08, 0x21, 0xA9, 0x89, 0x10, 0x76, 0x23, 0x11, 0xA0,
+	0xBC, 0x10, 0xD8, 0x8A, 0x91, 0xAC, 0x31, 0x00, 0x73, 0x04, 0xDB, 0xBA,
+	0xBC, 0x18, 0x02, 0xA9, 0x00, 0x88, 0x73, 0x04, 0xB9, 0xBB, 0x9A, 0x22,
+	0x01, 0xFB, 0xAB, 0x99, 0x20, 0x82, 0xCD, 0xBD, 0xCB, 0x9C, 0xB8, 0x9B,
+	0x31, 0x03, 0x62, 0x14, 0xB9, 0x9C, 0xBA, 0xAD, 0x28, 0x81, 0x31, 0x47,
+	0x12, 0x11, 0xA0, 0x9A, 0x08, 0x21, 0x24, 0x11, 0x39, 0x67, 0x32, 0x23,
+	0x24, 0x01, 0x20, 0xA0, 0x09, 0x99, 0x21, 0x66, 0x33, 0x43, 0x33, 0xC8,
+	0xAB, 0xBA, 0x0A, 0x44, 0x13, 0xA9, 0xCD, 0x1A, 0x32, 0x25, 0xA0, 0xCE,
+	0xBA, 0x99, 0x89, 0x89, 0x89, 0x19, 0x74, 0x02, 0xBA, 0xCD, 0xAA, 0x08,
+	0x01, 0x90, 0xA9, 0xBD, 0xAB, 0xA9, 0xBD, 0xBA, 0xFA, 0xAD, 0x99, 0x18,
+	0x41, 0x12, 0x10, 0x01, 0x99, 0x11, 0xFB, 0xAF, 0x88, 0x41, 0x35, 0x12,
+	0x88, 0x88, 0x08, 0x62, 0x81, 0x89, 0x80, 0x29, 0x57, 0x02, 0x00, 0x11,
+	0x11, 0x34, 0x81, 0xAA, 0xDB, 0x1A, 0x55, 0x22, 0x11, 0x81, 0xAB, 0x10,
+	0x11, 0x01, 0xFA, 0xAD, 0x08, 0x42, 0x33, 0x80, 0xA9, 0xDD, 0x89, 0xB8,
+	0xAD, 0xA9, 0x8A, 0x43, 0x23, 0xA9, 0xCA, 0xBB, 0xAC, 0x90, 0xAA, 0xFB,
+	0xBB, 0x89, 0xA8, 0x8A, 0xF9, 0x9D, 0xB8, 0xBC, 0x89, 0xC9, 0x2A, 0x14,
+	0x52, 0x23, 0xB9, 0x8A, 0xEB, 0x9A, 0x01, 0x62, 0x34, 0x22, 0x00, 0x00,
+	0x22, 0x21, 0x22, 0xB1, 0x2B, 0x77, 0x12, 0x01, 0x32, 0x63, 0x54, 0x81,
+	0x88, 0xA8, 0x9A, 0x32, 0x23, 0x44, 0x33, 0x12, 0xB0, 0x9D, 0x21, 0x01,
+	0xEB, 0xAB, 0x31, 0x45, 0x03, 0xBA, 0xAB, 0x90, 0x9B, 0xFC, 0xCC, 0x9B,
+	0x20, 0x02, 0xA8, 0xBC, 0x89, 0xA8, 0xAE, 0xB9, 0xAD, 0x98, 0xBB, 0xCB,
+	0xBC, 0x29, 0x82, 0xEB, 0xDB, 0xAB, 0x09, 0x10, 0x01, 0x20, 0x27, 0xA9,
+	0x90, 0xBB, 0x28, 0x33, 0x67, 0x11, 0x31, 0x92, 0x9B, 0x31, 0x33, 0x77,
+	0x02, 0x90, 0x09, 0x22, 0x12, 0x53, 0x03, 0x41, 0x23, 0x01, 0x90, 0x28,
+	0x24, 0x73, 0x44, 0x91, 0x89, 0xB9, 0x0B, 0x42, 0x25, 0xB0, 0x0A, 0xB0,
+	0x69, 0x26, 0xC9, 0x9A, 0xA9, 0x09, 0x81, 0xB9, 0xCD, 0x8A, 0x10, 0x12,
+	0xFB, 0xBC, 0xAB, 0x1A, 0x81, 0xCB, 0xCB, 0xBE, 0x09, 0x13, 0xA8, 0xCD,
+	0xAB, 0x99, 0x52, 0x82, 0x8A, 0x11, 0x99, 0x63, 0xA2, 0xBF, 0x19, 0x42,
+	0x34, 0x83, 0xAA, 0x08, 0x00, 0x73, 0x02, 0x09, 0x23, 0x10, 0x43, 0x82,
+	0x38, 0x35, 0x33, 0x35, 0x01, 0x01, 0xEA, 0x1A, 0x64, 0x24, 0x11, 0xB9,
+	0x8B, 0x21, 0x20, 0x91, 0xBE, 0x3A, 0x37, 0x03, 0xB9, 0xBD, 0x89, 0x21,
+	0x91, 0xAB, 0xCB, 0x8B, 0x11, 0x99, 0xEB, 0xAC, 0x99, 0xBC, 0xAA, 0xCA,
+	0xCC, 0xBE, 0x9A, 0x31, 0x16, 0xD9, 0xAC, 0x89, 0x32, 0x13, 0xCA, 0xAA,
+	0x40, 0x16, 0xA0, 0xA9, 0xCC, 0x38, 0x34, 0x81, 0x99, 0xAA, 0x31, 0x23,
+	0x01, 0xA8, 0xA9, 0x60, 0x26, 0x11, 0x22, 0x81, 0x72, 0x23, 0x32, 0x02,
+	0xCB, 0x89, 0x51, 0x45, 0x02, 0x88, 0x88, 0x21, 0x33, 0xC8, 0x9B, 0x09,
+	0x30, 0x67, 0xB0, 0x9A, 0x10, 0x00, 0xB0, 0xDF, 0x0A, 0x12, 0x80, 0x98,
+	0xCB, 0x0A, 0x12, 0x80, 0xEA, 0xAE, 0x28, 0x01, 0xC9, 0xBC, 0x1A, 0x26,
+	0xB0, 0xBD, 0x89, 0x38, 0x35, 0xC8, 0x9B, 0x22, 0x18, 0x11, 0xFC, 0x9C,
+	0x20, 0x12, 0xA9, 0x9B, 0x28, 0x01, 0x88, 0x91, 0xBD, 0x09, 0x03, 0x40,
+	0x02, 0x28, 0x46, 0x12, 0x62, 0x23, 0x03, 0x08, 0x9A, 0x65, 0x34, 0x01,
+	0x08, 0x08, 0x73, 0x13, 0x88, 0x80, 0x99, 0x71, 0x14, 0xB9, 0xAC, 0x18,
+	0x33, 0x90, 0xCB, 0x9C, 0x21, 0x23, 0xA9, 0x90, 0xBD, 0x0C, 0x23, 0xA8,
+	0xBA, 0x9A, 0x30, 0x96, 0xAD, 0x38, 0xB2, 0x9F, 0x80, 0x9A, 0x18, 0xA8,
+	0x89, 0xCE, 0xAB, 0x90, 0xAC, 0xCA, 0xCE, 0x0B, 0x01, 0xAA, 0xAA, 0x9A,
+	0xAB, 0xDA, 0x8B, 0xAA, 0xDB, 0x18, 0xA0, 0xA9, 0x71, 0x24, 0x12, 0x28,
+	0x40, 0x44, 0x11, 0x88, 0x20, 0x56, 0x14, 0x00, 0x08, 0x10, 0x55, 0x11,
+	0x18, 0x00, 0x21, 0x36, 0x82, 0x9A, 0x10, 0x63, 0x12, 0xAA, 0x19, 0x30,
+	0x65, 0x01, 0x0A, 0x21, 0x20, 0x34, 0x82, 0x00, 0x24, 0x42, 0x23, 0xBB,
+	0x9A, 0x21, 0xFB, 0x9D, 0xA8, 0x9B, 0x99, 0xFB, 0x9A, 0xC9, 0xAB, 0xCD,
+	0xBC, 0xAB, 0xBB, 0xBC, 0xCB, 0xBC, 0x9B, 0x98, 0xCC, 0xBB, 0x9C, 0x99,
+	0xBA, 0x9B, 0xAA, 0x10, 0x34, 0x10, 0xB0, 0x1A, 0x56, 0x24, 0x01, 0x42,
+	0x32, 0x46, 0x12, 0x21, 0x34, 0x32, 0x44, 0x22, 0x24, 0x11, 0x42, 0x23,
+	0x12, 0x34, 0x12, 0x22, 0x32, 0x13, 0x52, 0x01, 0x50, 0x24, 0x10, 0x43,
+	0x80, 0x60, 0x04, 0x19, 0x24, 0xA8, 0x10, 0xCB, 0x10, 0xA2, 0xBC, 0x8A,
+	0xFB, 0xAC, 0x90, 0xEB, 0xAB, 0xBA, 0xAD, 0xCA, 0x9D, 0xA9, 0xAC, 0x9A,
+	0xDA, 0x9B, 0xAA, 0xBB, 0xCD, 0xAB, 0x99, 0xCB, 0x9A, 0xAB, 0x9A, 0x8A,
+	0x43, 0x04, 0x62, 0x22, 0x34, 0x14, 0x00, 0x11, 0x22, 0x52, 0x34, 0x32,
+	0x35, 0x14, 0x42, 0x23, 0x20, 0x35, 0x22, 0x21, 0x23, 0x18, 0x64, 0x14,
+	0x10, 0x30, 0x14, 0x00, 0x11, 0x12, 0x32, 0x80, 0x64, 0x91, 0x41, 0x25,
+	0x18, 0x10, 0x00, 0x32, 0x83, 0xAF, 0xDA, 0xAB, 0x8A, 0xDB, 0xBD, 0xCA,
+	0xAA, 0x08, 0xA9, 0xAA, 0xEB, 0x8B, 0xC8, 0xBE, 0xCB, 0xBB, 0xBB, 0xCD,
+	0x99, 0xBA, 0xBC, 0x8A, 0x98, 0xAC, 0x09, 0x98, 0xAA, 0x89, 0x35, 0x12,
+	0x62, 0x34, 0x21, 0x43, 0x11, 0x21, 0x43, 0x44, 0x25, 0x33, 0x24, 0x32,
+	0x34, 0x34, 0x22, 0x52, 0x21, 0x10, 0x32, 0x34, 0x82, 0x41, 0x34, 0x42,
+	0x22, 0x33, 0x13, 0x88, 0x71, 0x13, 0x08, 0x42, 0x13, 0x10, 0x01, 0x9B,
+	0xA9, 0xBF, 0xAA, 0xFB, 0xBC, 0xA9, 0xDD, 0xAB, 0xBA, 0xAD, 0xAA, 0xAB,
+	0xCB, 0xAE, 0x89, 0xBA, 0xAD, 0x99, 0xCB, 0xBC, 0xAA, 0xBA, 0xAE, 0x88,
+	0x98, 0xAA, 0x9A, 0x10, 0xE9, 0x09, 0x02, 0x29, 0x55, 0x42, 0x23, 0x01,
+	0x73, 0x12, 0x22, 0x33, 0x03, 0x11, 0x42, 0x35, 0x11, 0x51, 0x34, 0x22,
+	0x33, 0x44, 0x22, 0x11, 0x34, 0x32, 0x32, 0x27, 0x22, 0x41, 0x23, 0x32,
+	0x52, 0x34, 0x37, 0x33, 0x53, 0x23, 0x21, 0x01, 0xCB, 0xDB, 0xBC, 0xBC,
+	0xCB, 0xCB, 0xB9, 0xBB, 0x9A, 0xA0, 0xCC, 0x09, 0xBA, 0xAC, 0xCC, 0xBB,
+	0xDA, 0xAC, 0x98, 0xDB, 0x9A, 0x9A, 0xAA, 0x99, 0x99, 0x88, 0x10, 0x29,
+	0x73, 0x91, 0x52, 0x02, 0x19, 0x63, 0x03, 0x42, 0x24, 0x32, 0x35, 0x32,
+	0x26, 0x12, 0x43, 0x24, 0x21, 0x42, 0x13, 0x12, 0x13, 0x22, 0x13, 0x20,
+	0xB3, 0x9E, 0x10, 0x80, 0x11, 0x99, 0x20, 0xA4, 0x2D, 0x06, 0xBC, 0x10,
+	0xFA, 0x9B, 0xCA, 0xBC, 0xCD, 0xAA, 0xAA, 0xCA, 0x9B, 0x9A, 0xEB, 0x09,
+	0x81, 0xCB, 0x10, 0xA9, 0xAA, 0xD9, 0x8A, 0xE9, 0x9D, 0x80, 0x99, 0x09,
+	0x98, 0x8C, 0x20, 0x54, 0x32, 0x22, 0x33, 0x44, 0x43, 0x22, 0x33, 0x20,
+	0x53, 0x22, 0x44, 0x34, 0x31, 0x35, 0x33, 0x24, 0x24, 0x21, 0x23, 0x42,
+	0x42, 0x12, 0x10, 0x12, 0x29, 0x24, 0x18, 0x37, 0xB8, 0x40, 0x93, 0x0A,
+	0x05, 0x88, 0x11, 0xA9, 0x10, 0xEF, 0x99, 0xD8, 0xBB, 0xC9, 0xAE, 0x9A,
+	0xA9, 0xBB, 0xBB, 0x98, 0xFB, 0x8C, 0x98, 0xAC, 0x8A, 0xBA, 0xCB, 0xDB,
+	0xB9, 0xBC, 0x9B, 0x99, 0xAA, 0x99, 0x98, 0xA8, 0x71, 0x17, 0x10, 0x41,
+	0x21, 0x32, 0x02, 0x32, 0x03, 0x38, 0x47, 0x11, 0x43, 0x21, 0x53, 0x22,
+	0x30, 0x34, 0x10, 0x51, 0x43, 0x83, 0x10, 0x10, 0x82, 0x40, 0x14, 0x80,
+	0x98, 0x43, 0xB2, 0x40, 0x43, 0xAA, 0x73, 0x01, 0x00, 0xCA, 0xBA, 0xBE,
+	0xBC, 0x99, 0xBF, 0xAB, 0xBB, 0x9E, 0x99, 0xAA, 0xAA, 0xA9, 0x9A, 0x9C,
+	0x81, 0xF1, 0x8C, 0x90, 0xEA, 0x99, 0xA9, 0xCA, 0x0A, 0x80, 0x08, 0x18,
+	0x49, 0x27, 0x01, 0x62, 0x02, 0x30, 0x34, 0x32, 0x45, 0x11, 0x22, 0x02,
+	0x22, 0x23, 0x42, 0x45, 0x00, 0x62, 0x22, 0x08, 0x21, 0x02, 0x28, 0x11,
+	0x00, 0xA8, 0x52, 0x32, 0x42, 0x01, 0x0A, 0x98, 0xBA, 0x1E, 0xEA, 0x8B,
+	0x18, 0xB9, 0x8B, 0xDC, 0xD9, 0xAB, 0xBB, 0xBF, 0xBB, 0xBC, 0xA8, 0xBE,
+	0xAC, 0xCA, 0xCB, 0xBB, 0xBA, 0xCC, 0xAD, 0x90, 0xCA, 0x9B, 0x90, 0xEB,
+	0x89, 0x88, 0x98, 0x08, 0x81, 0x14, 0x00, 0x73, 0x04, 0x18, 0x34, 0x13,
+	0x53, 0x33, 0x34, 0x24, 0x23, 0x25, 0x12, 0x53, 0x12, 0x31, 0x25, 0x80,
+	0x33, 0x04, 0x10, 0x23, 0x10, 0x23, 0x32, 0x44, 0x03, 0xA9, 0x32, 0xF8,
+	0x8A, 0x90, 0x8B, 0xA1, 0xFF, 0xAB, 0xDB, 0xCB, 0xBA, 0xDB, 0xBA, 0xAC,
+	0x9A, 0xCA, 0x9B, 0x08, 0xBB, 0x09, 0xC9, 0xAC, 0x90, 0xBC, 0x8B, 0xBD,
+	0xBC, 0xBB, 0xCB, 0xAB, 0x8B, 0x11, 0x08, 0x41, 0x37, 0x13, 0x35, 0x14,
+	0x34, 0x22, 0x44, 0x24, 0x30, 0x25, 0x21, 0x24, 0x02, 0x31, 0x33, 0x42,
+	0x24, 0x31, 0x24, 0x12, 0x34, 0x83, 0x11, 0x23, 0x89, 0x23, 0xD9, 0x18,
+	0x86, 0x89, 0x12, 0x8B, 0x09, 0x43, 0x31, 0x12, 0xEA, 0x9A, 0xFA, 0x9D,
+	0xAA, 0xFB, 0xAA, 0xBB, 0xAC, 0xCB, 0x9C, 0xCC, 0xAA, 0xAA, 0xBD, 0x98,
+	0xCA, 0xBB, 0x98, 0xBB, 0xBC, 0xCC, 0xAB, 0xAD, 0x9A, 0xA9, 0x9A, 0x98,
+	0x30, 0x37, 0x01, 0x73, 0x01, 0x21, 0x25, 0x32, 0x32, 0x41, 0x35, 0x22,
+	0x42, 0x23, 0x31, 0x72, 0x22, 0x23, 0x11, 0x32, 0x33, 0x28, 0x27, 0xA8,
+	0x41, 0x82, 0x00, 0x13, 0x89, 0x20, 0x88, 0x40, 0xF9, 0x0B, 0xA1, 0xCE,
+	0x98, 0x98, 0xDC, 0xB9, 0xAC, 0xCD, 0xAA, 0xA9, 0xBC, 0x9A, 0x99, 0xCD,
+	0x0A, 0xA8, 0xBD, 0x80, 0xA9, 0xAB, 0xCC, 0x9A, 0xEA, 0x8B, 0x90, 0xBB,
+	0x1A, 0x91, 0x9B, 0x24, 0x21, 0x42, 0x44, 0x36, 0x11, 0x53, 0x25, 0x20,
+	0x43, 0x23, 0x32, 0x44, 0x12, 0x21, 0x33, 0x34, 0x43, 0x42, 0x23, 0x13,
+	0x32, 0x14, 0x11, 0x52, 0x81, 0x31, 0x81, 0x09, 0x22, 0x2A, 0x99, 0xCD,
+	0x9A, 0xCB, 0x9C, 0xC9, 0xCC, 0xB9, 0x99, 0xBE, 0xBD, 0xB9, 0xAE, 0xA9,
+	0xB9, 0xCA, 0xBD, 0x9A, 0xDB, 0x8B, 0x90, 0xBE, 0x99, 0xC9, 0x9B, 0xA9,
+	0x9B, 0xCA, 0x8B, 0x99, 0xD9, 0x8A, 0x91, 0x9A, 0x30, 0x12, 0x45, 0x41,
+	0x55, 0x23, 0x52, 0x33, 0x43, 0x34, 0x22, 0x33, 0x22, 0x44, 0x13, 0x42,
+	0x13, 0x32, 0x15, 0x28, 0x34, 0x98, 0x51, 0x83, 0x18, 0x23, 0xA9, 0x10,
+	0x30, 0x34, 0xE9, 0x99, 0xBB, 0xAF, 0xAA, 0xBA, 0xCA, 0xBD, 0xBD, 0xBB,
+	0xAB, 0xB9, 0xDB, 0xBB, 0xA9, 0xB9, 0xBE, 0xCB, 0xBC, 0xCB, 0xBB, 0xAC,
+	0xCD, 0xAB, 0xA9, 0xAD, 0x80, 0x88, 0xA9, 0xAA, 0x01, 0x91, 0x0B, 0x47,
+	0x91, 0x38, 0x27, 0x21, 0x34, 0x43, 0x43, 0x11, 0x45, 0x02, 0x30, 0x25,
+	0x28, 0x43, 0x13, 0x20, 0x24, 0x00, 0x08, 0x02, 0x21, 0xA3, 0x58, 0x14,
+	0x9B, 0x36, 0x93, 0x2A, 0x21, 0x00, 0xD8, 0x09, 0x03, 0xAE, 0x00, 0xE9,
+	0xAB, 0xAB, 0xCC, 0xCA, 0xCB, 0x9C, 0xAA, 0xAD, 0xAB, 0xAB, 0xCB, 0x9C,
+	0x88, 0xCA, 0x9C, 0x9A, 0xEB, 0xAA, 0xBC, 0xAB, 0xBB, 0x0A, 0xC9, 0xBC,
+	0x90, 0x1A, 0x14, 0x92, 0x09, 0x55, 0x12, 0x55, 0x13, 0x21, 0x53, 0x21,
+	0x37, 0x01, 0x21, 0x03, 0x30, 0x27, 0x01, 0x32, 0x98, 0x50, 0x14, 0x00,
+	0x13, 0x99, 0x18, 0x80, 0x31, 0xC2, 0x9F, 0x01, 0x9A, 0x09, 0xC0, 0x9E,
+	0x98, 0x99, 0x98, 0xC9, 0x8A, 0xFB, 0x09, 0x92, 0xAB, 0x00, 0xAF, 0xAA,
+	0xCA, 0xA8, 0xEE, 0x89, 0xA8, 0xBB, 0x00, 0xCB, 0x9A, 0xA9, 0x09, 0xB8,
+	0x9D, 0x10, 0xEB, 0x29, 0x83, 0x8D, 0x22, 0x88, 0x42, 0x03, 0x55, 0x81,
+	0x50, 0x24, 0x20, 0x36, 0x02, 0x41, 0x13, 0x22, 0x25, 0x10, 0x23, 0x81,
+	0x52, 0x04, 0x08, 0x12, 0x00, 0x33, 0x81, 0x32, 0xC8, 0x49, 0x23, 0x9B,
+	0x11, 0xDA, 0x40, 0x91, 0x8B, 0xF8, 0xAF, 0x98, 0xBA, 0xAB, 0xBD, 0xAA,
+	0xEB, 0xAA, 0xBA, 0xBB, 0xA9, 0xDD, 0x09, 0xC9, 0x99, 0xB8, 0xBC, 0xCB,
+	0xAD, 0xAA, 0xCD, 0x9B, 0xA9, 0xBD, 0x88, 0x99, 0x18, 0x18, 0x12, 0x04,
+	0x08, 0x73, 0x12, 0x22, 0x24, 0x01, 0x31, 0x55, 0x32, 0x43, 0x21, 0x33,
+	0x45, 0x33, 0x33, 0x43, 0x33, 0x22, 0x44, 0x33, 0x98, 0x11, 0x91, 0x18,
+	0x12, 0xB1, 0xFB, 0x8B, 0x26, 0x80, 0x18, 0xB8, 0xAC, 0x40, 0x01, 0xCA,
+	0x9A, 0xEC, 0xAA, 0xAA, 0xFA, 0xBB, 0xAC, 0xC9, 0xBC, 0xA9, 0xDC, 0x89,
+	0x90, 0x9A, 0x08, 0xCA, 0x90, 0xDA, 0x88, 0xB9, 0x9D, 0x91, 0xBA, 0x08,
+	0x90, 0x50, 0x99, 0x20, 0x17, 0x10, 0x25, 0x22, 0x31, 0x36, 0x32, 0x45,
+	0x23, 0x53, 0x22, 0x32, 0x23, 0x15, 0x41, 0x24, 0x10, 0x32, 0x12, 0x53,
+	0x21, 0x42, 0x02, 0x11, 0x12, 0x13, 0x28, 0x14, 0xCA, 0x88, 0xAB, 0xDC,
+	0x99, 0x8C, 0xD9, 0x30, 0xC2, 0x9F, 0x98, 0x99, 0xAE, 0x98, 0xC9, 0xAE,
+	0x98, 0xA9, 0xAC, 0xAB, 0xDB, 0x9C, 0x99, 0xBA, 0xBC, 0xA9, 0xB9, 0x9B,
+	0x09, 0xEA, 0x9B, 0xBB, 0xBE, 0x89, 0x98, 0xAB, 0x88, 0x50, 0x04, 0x88,
+	0x46, 0x00, 0x40, 0x24, 0x01, 0x32, 0x33, 0x36, 0x33, 0x63, 0x01, 0x31,
+	0x24, 0x12, 0x12, 0x22, 0x32, 0x73, 0x15, 0x20, 0x00, 0x33, 0x82, 0x10,
+	0x42, 0xBA, 0xAB, 0xD9, 0xBD, 0xAC, 0x8A, 0x8A, 0x81, 0x46, 0x21, 0x13,
+	0x12, 0x18, 0xF8, 0xBD, 0xCC, 0xBA, 0xBB, 0xAD, 0x0A, 0xA0, 0x9C, 0x18,
+	0x81, 0x1A, 0x3A, 0xA3, 0xCF, 0x8C, 0x90, 0xDB, 0x8A, 0x90, 0xC9, 0x3A,
+	0x13, 0x00, 0x34, 0x70, 0x15, 0x42, 0x11, 0x22, 0x23, 0x41, 0x01, 0x53,
+	0x82, 0x28, 0x26, 0x11, 0x30, 0x25, 0x02, 0x18, 0x01, 0x82, 0x9C, 0x8A,
+	0xF9, 0xAC, 0x18, 0xA2, 0x0B, 0x16, 0x8A, 0x31, 0x33, 0x21, 0xCC, 0xDA,
+	0x80, 0xAF, 0x91, 0xA9, 0x9F, 0x12, 0xBA, 0x2B, 0xB2, 0x9A, 0x9F, 0x90,
+	0x89, 0xBC, 0x40, 0xC8, 0x8A, 0x01, 0x8C, 0xCA, 0x89, 0xAD, 0x10, 0x24,
+	0xBA, 0x89, 0x34, 0x9D, 0x31, 0x14, 0xBB, 0x50, 0x04, 0x89, 0x20, 0x15,
+	0x0A, 0x02, 0x83, 0x98, 0x3C, 0x37, 0xA1, 0x28, 0x04, 0x4A, 0x26, 0x22,
+	0x00, 0x32, 0x26, 0x80, 0x43, 0xA0, 0x88, 0x00, 0xA1, 0x8E, 0xAA, 0xC8,
+	0x8F, 0x82, 0xA9, 0x4A, 0x90, 0x10, 0x13, 0x9F, 0x94, 0x9C, 0x00, 0xDA,
+	0x0A, 0x04, 0xAC, 0x10, 0xCB, 0x81, 0x2A, 0xA2, 0xBA, 0xDF, 0x03, 0x89,
+	0x99, 0x08, 0x99, 0xAB, 0x51, 0x16, 0x8A, 0x80, 0x72, 0x21, 0x13, 0x8A,
+	0x16, 0x28, 0xA3, 0x0B, 0x94, 0xBF, 0x38, 0x91, 0x0B, 0xA3, 0x4A, 0x04,
+	0x18, 0x64, 0xA1, 0x8B, 0x13, 0xAA, 0x0B, 0x92, 0xDF, 0x11, 0x99, 0x20,
+	0xA1, 0x73, 0xA0, 0x38, 0x24, 0x89, 0x01, 0x28, 0xCA, 0x20, 0xA0, 0xAC,
+	0x00, 0x28, 0x53, 0xDB, 0x11, 0x98, 0x4A, 0xC4, 0x40, 0xA8, 0x08, 0x43,
+	0x01, 0x94, 0x8F, 0x02, 0xAA, 0x28, 0xC1, 0x9C, 0xBA, 0x38, 0xA8, 0xF0,
+	0x49, 0x8A, 0x90, 0x23, 0xAF, 0x31, 0xE9, 0x30, 0x12, 0x88, 0x34, 0xBB,
+	0x71, 0xE8, 0x19, 0xB1, 0x8A, 0x88, 0xCB, 0x11, 0xB0, 0x20, 0x10, 0x32,
+	0x23, 0x28, 0x37, 0x8B, 0xCF, 0x84, 0x8D, 0xC1, 0x10, 0x98, 0x19, 0x08,
+	0xB2, 0x58, 0x40, 0xA1, 0xA0, 0x79, 0x92, 0x01, 0xA9, 0x89, 0xAB, 0x21,
+	0xD0, 0x88, 0x37, 0x0E, 0x92, 0x01, 0x49, 0x09, 0x94, 0x48, 0x9B, 0x06,
+	0x08, 0x08, 0x03, 0x3A, 0x94, 0x38, 0x15, 0x10, 0x80, 0x84, 0x1C, 0x16,
+	0xBB, 0x34, 0xC9, 0x31, 0xA2, 0x48, 0xA2, 0x92, 0x1A, 0xB9, 0x29, 0xB3,
+	0xFF, 0x80, 0xBA, 0x50, 0xB0, 0x2B, 0x82, 0xBA, 0x30, 0xCC, 0x21, 0x90,
+	0x0F, 0x84, 0x8F, 0x00, 0x8A, 0x08, 0xAC, 0xB0, 0x4B, 0x01, 0x41, 0x12,
+	0x68, 0xA2, 0x60, 0x81, 0x89, 0x91, 0x8A, 0xB0, 0xEC, 0x2A, 0xC1, 0x1A,
+	0x13, 0xEA, 0x0A, 0x01, 0x0A, 0x92, 0x0D, 0x23, 0x9A, 0x33, 0x00, 0xF9,
+	0x88, 0x08, 0x99, 0x43, 0xB0, 0x78, 0x13, 0x0B, 0x37, 0x09, 0xB8, 0xA9,
+	0xAD, 0x88, 0xBB, 0x26, 0x8F, 0x03, 0x22, 0x19, 0x14, 0x00, 0x28, 0x04,
+	0x2A, 0x15, 0x0A, 0x87, 0x1A, 0x34, 0xD0, 0x10, 0x90, 0xAA, 0x81, 0x4A,
+	0x98, 0xC0, 0x68, 0xA8, 0x52, 0x91, 0xBB, 0x99, 0xD0, 0x8B, 0xC8, 0x99,
+	0x88, 0x28, 0x16, 0x01, 0x25, 0x11, 0x30, 0x01, 0x11, 0xCD, 0xBD, 0x98,
+	0xBD, 0x81, 0xAB, 0x8A, 0x91, 0xAA, 0x43, 0x80, 0x28, 0xD0, 0x90, 0xAB,
+	0x33, 0x15, 0x2A, 0x26, 0x00, 0x47, 0x09, 0x81, 0x23, 0xAB, 0xBA, 0xFB,
+	0xAC, 0xCA, 0x99, 0x18, 0x88, 0x62, 0x82, 0x30, 0x05, 0x31, 0x90, 0x3A,
+	0x15, 0x9A, 0x8A, 0x43, 0x88, 0x11, 0x17, 0x08, 0x00, 0xA1, 0x62, 0x21,
+	0x88, 0x91, 0x02, 0x24, 0x40, 0x90, 0x39, 0x61, 0x34, 0x10, 0xD1, 0x1A,
+	0x0C, 0x88, 0x16, 0xC8, 0x1B, 0xA1, 0x2D, 0x95, 0x09, 0x41, 0x80, 0x9A,
+	0xC8, 0xBE, 0xC9, 0x9D, 0xB8, 0x9A, 0x8A, 0x12, 0x30, 0x71, 0x27, 0x22,
+	0x34, 0x15, 0x20, 0x88, 0xDB, 0xCA, 0xBD, 0xAB, 0xAB, 0x9B, 0x10, 0x10,
+	0x63, 0x33, 0x32, 0x44, 0x00, 0x20, 0x91, 0x9A, 0x80, 0x98, 0x18, 0x12,
+	0x61, 0x25, 0x21, 0x01, 0xA0, 0xBB, 0x09, 0xCF, 0x19, 0xA9, 0x99, 0x89,
+	0xAD, 0x10, 0xA0, 0x8B, 0x40, 0xA0, 0x51, 0x92, 0x73, 0x01, 0x28, 0x03,
+	0x00, 0xB0, 0x09, 0x78, 0x05, 0x8A, 0x31, 0x9F, 0xC0, 0xBB, 0xDC, 0x9A,
+	0xBC, 0x12, 0x8E, 0x12, 0x8A, 0x21, 0x12, 0x03, 0x78, 0xD0, 0x12, 0x90,
+	0x19, 0x29, 0xA1, 0x08, 0x32, 0xAA, 0x41, 0xF8, 0x19, 0x2A, 0x1E, 0x12,
+	0x11, 0x01, 0x73, 0x90, 0x25, 0x81, 0x39, 0x91, 0x19, 0x05, 0x24, 0x51,
+	0x13, 0x11, 0x22, 0xBA, 0xBE, 0xEC, 0xAC, 0x9C, 0x99, 0x10, 0x01, 0x31,
+	0x42, 0x43, 0x32, 0x43, 0x03, 0x89, 0x18, 0x99, 0x83, 0xFF, 0x88, 0xA9,
+	0x89, 0x01, 0x0A, 0x91, 0x98, 0x49, 0x31, 0x14, 0x62, 0x12, 0xB9, 0xA0,
+	0xB8, 0xAD, 0xFB, 0x09, 0x8A, 0x99, 0x58, 0x80, 0xAA, 0xC1, 0x2C, 0xB1,
+	0xBB, 0x90, 0xA8, 0xEF, 0x08, 0xB8, 0x89, 0xCA, 0x1B, 0xD9, 0x9A, 0x10,
+	0x99, 0x40, 0x11, 0x33, 0x64, 0x89, 0x39, 0x83, 0x17, 0x01, 0x18, 0x0A,
+	0x0D, 0x0A, 0xB9, 0x1B, 0x08, 0xB9, 0x31, 0x16, 0x37, 0x02, 0x33, 0x17,
+	0x13, 0x34, 0x13, 0x02, 0x03, 0xAA, 0x84, 0x91, 0xA9, 0x40, 0x03, 0x48,
+	0x32, 0x14, 0x34, 0x5A, 0x60, 0x39, 0x89, 0x85, 0x08, 0x81, 0x92, 0x01,
+	0x14, 0x8B, 0x29, 0xA2, 0xAC, 0x2A, 0xAF, 0x10, 0xDB, 0xA8, 0x03, 0x11,
+	0x08, 0x17, 0x0D, 0xC9, 0xDA, 0x99, 0xCB, 0xAB, 0xAC, 0xB9, 0xB9, 0xAD,
+	0x8C, 0x9C, 0x1B, 0x80, 0xA9, 0x01, 0x3A, 0xE1, 0xC8, 0xCA, 0x0B, 0x99,
+	0xDD, 0xC0, 0xC9, 0x99, 0x1A, 0x2A, 0x3B, 0x11, 0x90, 0xA3, 0x91, 0x73,
+	0x3C, 0xB0, 0xA0, 0x19, 0x11, 0x16, 0x13, 0x82, 0xDC, 0x22, 0x49, 0x39,
+	0x12, 0x26, 0x35, 0x34, 0x34, 0x12, 0x15, 0x13, 0x28, 0xB3, 0xB0, 0x00,
+	0x3B, 0xCB, 0xA2, 0x94, 0xB1, 0x27, 0x34, 0x57, 0x43, 0x22, 0x23, 0x01,
+	0x81, 0x90, 0x09, 0xBB, 0xCE, 0x09, 0x9A, 0xB1, 0xAA, 0x32, 0x84, 0x80,
+	0x73, 0xAA, 0xAB, 0x41, 0xAB, 0x0B, 0x92, 0x24, 0x0F, 0xEA, 0xA1, 0xA8,
+	0x9B, 0xAA, 0xB8, 0x90, 0x6B, 0x11, 0x21, 0xC1, 0xD2, 0x91, 0xDB, 0xC9,
+	0x1C, 0xAB, 0xCC, 0x80, 0x8C, 0xA9, 0xAC, 0xA9, 0x19, 0x2B, 0xBB, 0x27,
+	0x00, 0x93, 0x17, 0x00, 0x01, 0x08, 0x9B, 0xB2, 0x95, 0xEA, 0x1C, 0xB0,
+	0x28, 0xD9, 0x33, 0xD2, 0x28, 0x31, 0xD1, 0x00, 0x03, 0x3A, 0x04, 0x3F,
+	0x81, 0x28, 0x18, 0x39, 0x8F, 0x38, 0x99, 0x1A, 0xA0, 0x89, 0x6E, 0x88,
+	0x02, 0x92, 0x32, 0x32, 0x2A, 0x0B, 0x1B, 0x5D, 0x39, 0x28, 0x03, 0x64,
+	0x2A, 0x01, 0x92, 0x10, 0x55, 0xB0, 0xB0, 0x21, 0x2B, 0xBF, 0x50, 0x1A,
+	0x9B, 0x83, 0xB3, 0x0B, 0x7B, 0x90, 0x99, 0x42, 0x0A, 0x2D, 0x2A, 0x29,
+	0x18, 0x29, 0x79, 0xB8, 0x1A, 0x09, 0xBD, 0xB9, 0xBE, 0x9C, 0xB9, 0xD2,
+	0x81, 0xA9, 0xBB, 0xB2, 0x14, 0xAC, 0xD4, 0x92, 0x83, 0x18, 0xF4, 0x82,
+	0x90, 0x84, 0x3B, 0x92, 0x4A, 0x1A, 0x0F, 0x20, 0x0A, 0x20, 0xE9, 0x98,
+	0xA5, 0x92, 0x39, 0x5C, 0x2A, 0x18, 0x30, 0x11, 0x0A, 0x02, 0x73, 0x99,
+	0x10, 0xA6, 0x19, 0xB8, 0x91, 0x4D, 0x99, 0x01, 0x2B, 0x22, 0x71, 0xA9,
+	0x22, 0xAB, 0x20, 0xCA, 0xF3, 0x8B, 0x1A, 0x84, 0x34, 0x89, 0x3B, 0x21,
+	0x60, 0xC0, 0x89, 0x08, 0xB1, 0x61, 0x02, 0x51, 0x49, 0x1B, 0x29, 0x8D,
+	0xC8, 0x18, 0x1F, 0x88, 0x11, 0x41, 0x38, 0x91, 0x32, 0x30, 0x33, 0x8C,
+	0x02, 0x8F, 0x32, 0x11, 0x2B, 0xAB, 0xF1, 0x20, 0x8E, 0x81, 0x21, 0x4C,
+	0x3A, 0x29, 0x03, 0xA3, 0x53, 0x40, 0x8D, 0x09, 0x00, 0x1F, 0x98, 0x09,
+	0x12, 0x98, 0x3A, 0xB4, 0x82, 0xB0, 0x01, 0x0A, 0x5F, 0x9B, 0x09, 0x8A,
+	0x1A, 0x89, 0x04, 0x0C, 0x8D, 0x5B, 0x8B, 0xA0, 0xA9, 0x8C, 0x92, 0xA3,
+	0xF3, 0xB1, 0x24, 0x2C, 0x0A, 0x00, 0x80, 0x4D, 0x19, 0xCB, 0x23, 0x3A,
+	0x0B, 0xD4, 0x30, 0x43, 0x10, 0x73, 0x08, 0x18, 0x3C, 0x29, 0xA8, 0x30,
+	0x31, 0x51, 0x53, 0x69, 0x08, 0x23, 0x48, 0x8A, 0x21, 0x9A, 0x13, 0x0F,
+	0x1A, 0x19, 0x5A, 0xA8, 0xA3, 0xC0, 0x2D, 0x9F, 0x09, 0xC0, 0x21, 0x99,
+	0x09, 0x81, 0x94, 0x08, 0x1A, 0x50, 0x0D, 0x90, 0x18, 0x96, 0x9C, 0xA1,
+	0xD3, 0x90, 0x13, 0xBB, 0x99, 0xC9, 0x03, 0x20, 0x9B, 0xAF, 0x30, 0x3B,
+	0xB3, 0xD2, 0xDB, 0x92, 0x50, 0x91, 0x5A, 0x5B, 0x0A, 0xA3, 0x03, 0x01,
+	0x01, 0x0D, 0x02, 0x2D, 0x1D, 0x90, 0xA9, 0x92, 0x19, 0x6D, 0x39, 0x0A,
+	0x93, 0x58, 0x38, 0x03, 0x73, 0x9A, 0x80, 0x09, 0xE2, 0x81, 0xC9, 0x00,
+	0x1D, 0x80, 0xBA, 0x89, 0x2D, 0x9C, 0x01, 0x3B, 0xAD, 0x08, 0x32, 0xAB,
+	0x95, 0x1A, 0xD1, 0x12, 0xD9, 0x10, 0x51, 0x4A, 0x00, 0x95, 0x92, 0x00,
+	0x4A, 0x91, 0xBB, 0x94, 0x1D, 0x89, 0x83, 0x20, 0x6B, 0x3E, 0x10, 0x91,
+	0x32, 0x86, 0x09, 0x93, 0x29, 0x2D, 0x89, 0x22, 0x5D, 0xA8, 0x92, 0x29,
+	0x00, 0x31, 0x0C, 0x90, 0x1D, 0xB8, 0xB8, 0xD7, 0x03, 0xB8, 0x12, 0x93,
+	0x14, 0x18, 0x18, 0x3A, 0x07, 0x01, 0x81, 0xB9, 0x79, 0x0B, 0x22, 0xC0,
+	0xA0, 0xA0, 0x19, 0x9F, 0xA1, 0x0A, 0x3C, 0x1B, 0x3E, 0x49, 0xD2, 0x11,
+	0x1D, 0x91, 0x91, 0xB1, 0xB3, 0x38, 0x1B, 0x22, 0xB3, 0x22, 0x1A, 0x1C,
+	0x32, 0xFA, 0x10, 0x0A, 0x91, 0x22, 0x03, 0xC3, 0xD2, 0x11, 0xD3, 0x02,
+	0x85, 0x31, 0x3A, 0x63, 0x40, 0x3A, 0x6B, 0x0A, 0xAA, 0xA1, 0x2A, 0x3F,
+	0x1B, 0xD0, 0xA1, 0x11, 0xA1, 0x01, 0xB5, 0x98, 0x39, 0xB3, 0x31, 0xA5,
+	0x34, 0x3A, 0x99, 0x30, 0x39, 0x3B, 0x2F, 0x0B, 0x3A, 0xF1, 0xA1, 0x80,
+	0xBA, 0x31, 0x2D, 0xB4, 0x80, 0x00, 0x2A, 0x09, 0x4E, 0xB8, 0x92, 0x08,
+	0x58, 0x39, 0x29, 0x7A, 0xA0, 0xB8, 0x92, 0xF3, 0x94, 0x29, 0x3B, 0x90,
+	0x81, 0x53, 0xE8, 0x80, 0x3B, 0x19, 0x0C, 0x0C, 0x20, 0xA3, 0x06, 0x28,
+	0x81, 0xC3, 0x91, 0x8B, 0x3F, 0xE1, 0xA2, 0xA0, 0x0B, 0xC8, 0x98, 0x90,
+	0xB0, 0xF9, 0x01, 0x29, 0xD2, 0x85, 0x10, 0x09, 0x31, 0x3E, 0xA1, 0x21,
+	0x1A, 0x3A, 0x9B, 0x9E, 0xB2, 0xC9, 0x90, 0xB3, 0x79, 0x69, 0xA9, 0x92,
+	0xB2, 0x91, 0x20, 0x09, 0x9B, 0x2F, 0x3A, 0x10, 0x51, 0x18, 0x2D, 0x01,
+	0x4A, 0xC0, 0x49, 0xC0, 0x01, 0x2B, 0x93, 0x88, 0xF1, 0x09, 0x80, 0x9B,
+	0x6A, 0xA9, 0xA0, 0x2A, 0x19, 0x30, 0x1D, 0x2B, 0x02, 0x2D, 0xB1, 0x79,
+	0x3A, 0x0B, 0x99, 0xA1, 0x6E, 0x89, 0x81, 0x9D, 0xA2, 0x30, 0x8A, 0x92,
+	0xB4, 0xB2, 0x48, 0x3A, 0x31, 0xB3, 0xA1, 0xB2, 0xB9, 0x95, 0x12, 0x7B,
+	0xA8, 0x41, 0x80, 0x38, 0x20, 0xE8, 0x43, 0x2C, 0x2A, 0x0D, 0x91, 0x01,
+	0x21, 0x92, 0x36, 0x20, 0x92, 0x23, 0xA7, 0x09, 0x39, 0xF0, 0x01, 0x1B,
+	0x81, 0x7B, 0x88, 0xC0, 0x01, 0x88, 0x90, 0x5B, 0x1C, 0x00, 0x99, 0x28,
+	0x19, 0x4D, 0x1B, 0x1B, 0x9C, 0xA5, 0xB0, 0x94, 0xA0, 0xA2, 0xBB, 0x3D,
+	0xB0, 0x0F, 0x81, 0x19, 0x2F, 0x39, 0xA0, 0x11, 0x11, 0x89, 0x93, 0x2D,
+	0xC1, 0x10, 0xC0, 0xA4, 0x99, 0x41, 0x02, 0x48, 0x92, 0x53, 0x41, 0x89,
+	0x50, 0x28, 0xA2, 0xB5, 0x79, 0x19, 0xD2, 0x00, 0xA1, 0xA2, 0x13, 0x29,
+	0x01, 0x94, 0xA3, 0x27, 0x11, 0x1B, 0x81, 0x5C, 0x2A, 0xB2, 0xA5, 0x2C,
+	0x90, 0x94, 0xAB, 0x2B, 0xB4, 0x2A, 0x6A, 0xB0, 0xE1, 0xA2, 0x93, 0x98,
+	0xE9, 0x29, 0x1B, 0xB0, 0x23, 0x1F, 0x94, 0xAA, 0x40, 0x1B, 0x18, 0xD9,
+	0x03, 0x5B, 0x19, 0x18, 0x29, 0x24, 0x9B, 0x91, 0x2F, 0x2B, 0xBB, 0x39,
+	0x3E, 0xA8, 0x10, 0xA0, 0x63, 0xA8, 0x24, 0x0B, 0xAB, 0xA0, 0xD3, 0x95,
+	0x91, 0x21, 0x39, 0x69, 0xDA, 0x22, 0x98, 0x01, 0x03, 0x9B, 0x3D, 0x81,
+	0xB1, 0x3D, 0x12, 0xF4, 0x90, 0xB0, 0xA4, 0xD3, 0x81, 0xC1, 0xA2, 0x38,
+	0x1A, 0xB8, 0x7A, 0x09, 0x98, 0x0A, 0x87, 0xAA, 0xA0, 0x5B, 0x0B, 0xBA,
+	0x07, 0x9A, 0x29, 0x82, 0x89, 0x8B, 0x10, 0x0C, 0x03, 0x85, 0xA3, 0xD2,
+	0x40, 0x38, 0xE3, 0x12, 0x19, 0x1A, 0x9A, 0xFA, 0xA0, 0x3A, 0xA5, 0xA9,
+	0x32, 0x2B, 0x12, 0x72, 0x90, 0x10, 0xA0, 0xBB, 0x9F, 0xA1, 0xA2, 0x70,
+	0x0C, 0x21, 0x99, 0x80, 0x86, 0x11, 0x02, 0x8B, 0x24, 0xE1, 0x59, 0x98,
+	0x18, 0xBB, 0x00, 0xE3, 0x90, 0x1A, 0x09, 0x2B, 0xAB, 0x87, 0x00, 0xA2,
+	0xA3, 0x42, 0x9B, 0x09, 0xB3, 0xB3, 0x17, 0xC1, 0x99, 0x90, 0x8B, 0x7C,
+	0x89, 0x08, 0x08, 0x20, 0x89, 0x58, 0xB1, 0xA1, 0x23, 0x42, 0x19, 0x13,
+	0x91, 0x01, 0x9B, 0x32, 0x97, 0x09, 0x09, 0x2A, 0x3A, 0x1E, 0x59, 0x80,
+	0x01, 0x93, 0x0A, 0xC1, 0x11, 0xB6, 0x98, 0x30, 0x00, 0x4B, 0x5A, 0x3A,
+	0xE0, 0x11, 0x9A, 0xC5, 0xA1, 0x11, 0x09, 0x92, 0x99, 0x33, 0xBC, 0x94,
+	0x39, 0x0F, 0x00, 0xC4, 0x19, 0x99, 0xA4, 0x08, 0xB5, 0x82, 0x19, 0x70,
+	0x91, 0x89, 0x1A, 0x03, 0x90, 0x2A, 0x33, 0xB3, 0x3B, 0x7A, 0xC1, 0xA3,
+	0x89, 0x49, 0x2B, 0x91, 0xC4, 0x03, 0x19, 0x1C, 0x61, 0x0B, 0x01, 0xF1,
+	0x03, 0x00, 0x89, 0x82, 0xE1, 0x85, 0x3A, 0x19, 0x9A, 0xA1, 0x1D, 0x11,
+	0x1D, 0x8A, 0x90, 0xA2, 0x84, 0xCA, 0x97, 0x10, 0x3B, 0xC2, 0x00, 0x10,
+	0xA1, 0xA5, 0xA9, 0x80, 0x91, 0x9A, 0xBC, 0x30, 0xF1, 0x39, 0xC8, 0x98,
+	0x10, 0x90, 0xF8, 0x01, 0x21, 0x9B, 0x79, 0xB0, 0xA9, 0x90, 0xC2, 0x13,
+	0xB2, 0x2C, 0x33, 0x51, 0x03, 0xC1, 0x87, 0xA2, 0x50, 0x2B, 0x18, 0x9B,
+	0x05, 0x1B, 0x4A, 0x1A, 0x41, 0x0D, 0x08, 0x20, 0x0D, 0x81, 0xB0, 0x21,
+	0x7B, 0x29, 0x20, 0xC2, 0x99, 0xA3, 0x80, 0x91, 0x1D, 0x1E, 0xD1, 0xA3,
+	0x09, 0x4B, 0x00, 0x92, 0xAD, 0x92, 0x10, 0x8C, 0xC2, 0x08, 0xBB, 0x07,
+	0x98, 0x09, 0xA9, 0xD2, 0x81, 0xEA, 0x80, 0x09, 0xB3, 0xD2, 0x10, 0x95,
+	0x59, 0xA9, 0x09, 0x0C, 0x89, 0x18, 0x39, 0x2A, 0x0C, 0xD4, 0x09, 0x51,
+	0x2A, 0x0D, 0x10, 0x20, 0x28, 0x1F, 0x80, 0x19, 0x1A, 0xB2, 0x86, 0xB0,
+	0xB3, 0xA2, 0x30, 0x7A, 0x29, 0x99, 0x69, 0x80, 0x59, 0x19, 0xA8, 0xB3,
+	0x93, 0xB4, 0x22, 0xA4, 0xA4, 0xB2, 0x87, 0x29, 0x29, 0xD1, 0x8B, 0xB4,
+	0x93, 0xA8, 0x94, 0x7A, 0x09, 0x0A, 0x92, 0xBB, 0x72, 0x2A, 0x9C, 0x90,
+	0x98, 0x39, 0x48, 0x9D, 0x03, 0x91, 0x03, 0x79, 0x9D, 0x12, 0xA0, 0x11,
+	0x11, 0x2F, 0x99, 0x3A, 0x0B, 0x93, 0x39, 0x13, 0xB9, 0x42, 0x4D, 0x01,
+	0xA8, 0x02, 0x9B, 0x0B, 0x73, 0x08, 0x90, 0x11, 0x4B, 0x91, 0xF3, 0x94,
+	0x49, 0x99, 0x13, 0x21, 0x18, 0xC3, 0x3B, 0xC3, 0x80, 0x1E, 0xA0, 0x31,
+	0xB0, 0xA1, 0x33, 0x0C, 0xE2, 0x81, 0x29, 0xB9, 0x53, 0x10, 0x9A, 0x4B,
+	0x4D, 0x3A, 0x2B, 0x9D, 0x90, 0x38, 0x98, 0x91, 0xD3, 0x30, 0x0F, 0x81,
+	0x3A, 0xC3, 0x92, 0x40, 0xA0, 0x60, 0x0C, 0x01, 0xB1, 0x85, 0x99, 0x90,
+	0x9B, 0xC5, 0x20, 0x29, 0x1D, 0x93, 0x28, 0x3C, 0x99, 0x02, 0x0F, 0xA0,
+	0xB0, 0xA4, 0x09, 0x2A, 0x3B, 0x33, 0x35, 0x90, 0xB1, 0x95, 0x32, 0xB9,
+	0x4A, 0x3B, 0xA7, 0x21, 0x19, 0xAB, 0x03, 0xD9, 0xA5, 0x22, 0x1B, 0x3C,
+	0x19, 0x9B, 0x9C, 0x84, 0x12, 0xDD, 0x38, 0x0B, 0x19, 0x0E, 0x01, 0xF8,
+	0x82, 0x12, 0x0D, 0xA0, 0x90, 0x89, 0x20, 0x85, 0xEA, 0x10, 0xA8, 0x61,
+	0xA0, 0x91, 0xB2, 0x29, 0x90, 0x8B, 0xE3, 0x1A, 0x90, 0x71, 0x1C, 0x8B,
+	0x81, 0x0A, 0x0C, 0xB3, 0x81, 0x63, 0xAB, 0x1F, 0x93, 0x00, 0x92, 0x11,
+	0xAA, 0x91, 0x13, 0x27, 0x0B, 0x18, 0x28, 0x79, 0xB9, 0x22, 0x9B, 0x93,
+	0x13, 0x96, 0x2B, 0xA8, 0xD4, 0xB1, 0x80, 0x1D, 0x04, 0x3A, 0xC0, 0x40,
+	0x1F, 0x28, 0x3A, 0x1A, 0x89, 0x93, 0x00, 0x1E, 0x99, 0x84, 0x9A, 0xD9,
+	0x84, 0x05, 0xB9, 0xBB, 0xA4, 0x83, 0x31, 0x9E, 0x00, 0x3A, 0x9A, 0xC1,
+	0x13, 0x0D, 0xA1, 0x01, 0xB2, 0x33, 0x31, 0x33, 0xC5, 0x31, 0x0B, 0xC3,
+	0xD4, 0x90, 0xA3, 0x80, 0xA2, 0xA6, 0xC1, 0xA5, 0x82, 0x80, 0x91, 0x59,
+	0x3A, 0x0C, 0xA3, 0x83, 0x09, 0x3B, 0xA3, 0x21, 0x2E, 0xB9, 0xAB, 0x71,
+	0x33, 0x08, 0x0C, 0x20, 0xB5, 0x00, 0x70, 0x31, 0xBB, 0xF8, 0x82, 0x10,
+	0x39, 0x1B, 0xB1, 0xB7, 0x49, 0x0A, 0x98, 0x83, 0xB1, 0xC1, 0x6B, 0x29,
+	0x99, 0xA4, 0x08, 0xD3, 0x99, 0x04, 0xAB, 0xA4, 0x98, 0x3B, 0x0D, 0xA2,
+	0x14, 0xA0, 0x4C, 0xB1, 0x92, 0x6A, 0xA8, 0x30, 0x83, 0x91, 0x30, 0x99,
+	0x51, 0x11, 0xD0, 0xA1, 0x85, 0x08, 0x19, 0x02, 0xD1, 0x40, 0x00, 0x12,
+	0x3F, 0x3A, 0x81, 0x10, 0xF1, 0x99, 0x39, 0x19, 0x19, 0xA0, 0xB5, 0xA8,
+	0x38, 0x9C, 0xB1, 0xA7, 0x2A, 0xB2, 0x7A, 0x0B, 0x01, 0x91, 0x91, 0xA9,
+	0x41, 0xA2, 0x51, 0x5B, 0x3D, 0x09, 0x18, 0x09, 0x29, 0x5A, 0xAA, 0xB6,
+	0x98, 0x80, 0x5A, 0x3B, 0x88, 0x4C, 0x10, 0xD2, 0x08, 0x30, 0xCB, 0x24,
+	0xE0, 0x11, 0x99, 0x29, 0x28, 0x9B, 0xC4, 0x12, 0x3A, 0x91, 0x7A, 0x19,
+	0x09, 0xC0, 0x81, 0x90, 0x70, 0x09, 0x8A, 0xB3, 0x28, 0x9B, 0x3A, 0x3C,
+	0x7B, 0x1B, 0x5A, 0x9A, 0x20, 0xB9, 0xF3, 0x92, 0xD1, 0x10, 0x89, 0x91,
+	0x32, 0x2B, 0xF0, 0x90, 0x1A, 0xA2, 0x08, 0xBA, 0xA5, 0x0F, 0xA3, 0x83,
+	0x9A, 0x50, 0xC1, 0xA0, 0x09, 0xD2, 0x03, 0x9B, 0xB5, 0xA8, 0x23, 0x1C,
+	0x39, 0xB1, 0xA3, 0x1B, 0x1D, 0x71, 0xC1, 0x9A, 0x21, 0x23, 0x44, 0x01,
+	0x0A, 0x5A, 0x08, 0x39, 0x2B, 0x9F, 0x80, 0x81, 0xA8, 0xA5, 0xA3, 0x99,
+	0xB4, 0x09, 0xB1, 0x32, 0xA1, 0xAF, 0x31, 0xB0, 0x12, 0xC5, 0x10, 0x92,
+	0x2A, 0xF2, 0x82, 0xB0, 0xA3, 0xB6, 0xC2, 0x90, 0x02, 0x19, 0x9E, 0x2B,
+	0xB1, 0x6B, 0x22, 0xAB, 0xD8, 0x28, 0x0A, 0xF1, 0x03, 0x8B, 0x20, 0x7B,
+	0x2B, 0x2D, 0x98, 0x01, 0x91, 0xC4, 0x00, 0xD2, 0x01, 0x90, 0x90, 0x23,
+	0x80, 0xB8, 0x3B, 0xD3, 0xB3, 0x4A, 0x39, 0x7C, 0xA1, 0x08, 0x91, 0x10,
+	0x89, 0x40, 0xA0, 0x6C, 0x39, 0xFE, 0x7F, 0xF7, 0x40, 0xA9, 0x10, 0x90,
+	0x90, 0x20, 0xA0, 0x29, 0x90, 0x08, 0x80, 0x00, 0x09, 0x81, 0x89, 0x02,
+	0x98, 0x28, 0xA1, 0x38, 0xB9, 0x16, 0x99, 0x4A, 0x92, 0x3A, 0xBC, 0xA4,
+	0x11, 0x5B, 0xF0, 0x58, 0x02, 0x01, 0x51, 0x77, 0x62, 0x15, 0xD9, 0xAB,
+	0x99, 0x88, 0x22, 0x02, 0xA9, 0x18, 0x12, 0x53, 0xC8, 0xAD, 0x31, 0x12,
+	0x98, 0x08, 0x08, 0x48, 0x43, 0x77, 0xC2, 0x8B, 0x12, 0xC8, 0x9A, 0x54,
+	0x93, 0xAC, 0x8A, 0x00, 0x99, 0x53, 0x81, 0x20, 0xB8, 0x2A, 0x47, 0x12,
+	0xA9, 0xAC, 0xCB, 0x9A, 0x98, 0x71, 0xB1, 0x68, 0x04, 0xBA, 0x89, 0xA8,
+	0x70, 0x33, 0x82, 0x80, 0x99, 0x99, 0xAA, 0x09, 0xF8, 0x0B, 0xB1, 0xAD,
+	0x53, 0x90, 0x09, 0x11, 0xA0, 0xDA, 0x1D, 0x27, 0x99, 0x29, 0x81, 0x99,
+	0x08, 0xBA, 0x31, 0xB8, 0x11, 0x1B, 0x34, 0x37, 0xBD, 0x30, 0x08, 0x12,
+	0xD8, 0xAD, 0x00, 0x11, 0x35, 0x81, 0xBA, 0xBB, 0x9C, 0x53, 0xC0, 0x8C,
+	0x53, 0x92, 0xBA, 0x89, 0xCA, 0x1A, 0x34, 0x01, 0xB8, 0xBF, 0x19, 0x21,
+	0x14, 0xB8, 0x9D, 0x31, 0x22, 0xDA, 0x90, 0x38, 0x34, 0x13, 0xA9, 0xDB,
+	0xBC, 0x41, 0x34, 0x82, 0xCD, 0x1B, 0x25, 0xA8, 0x09, 0x21, 0x88, 0x11,
+	0x01, 0xB8, 0x9C, 0x8A, 0x67, 0x83, 0xCB, 0x9A, 0x20, 0x13, 0xA0, 0x19,
+	0x83, 0xBE, 0x39, 0x02, 0x09, 0xA1, 0x39, 0x47, 0xD0, 0xAC, 0x18, 0x43,
+	0x24, 0x9C, 0x01, 0x99, 0x00, 0x28, 0x13, 0x9A, 0x1A, 0x36, 0x90, 0xDC,
+	0x1A, 0x43, 0x92, 0xBC, 0x99, 0x20, 0x01, 0x13, 0xD0, 0xCE, 0x9A, 0x51,
+	0x04, 0xC9, 0x9A, 0x28, 0x34, 0xA8, 0x8A, 0x88, 0x51, 0xB0, 0x0A, 0xCA,
+	0x49, 0x24, 0x11, 0xE9, 0xBB, 0x8A, 0x45, 0x81, 0x21, 0xC9, 0x42, 0xB8,
+	0x31, 0xC9, 0x40, 0x12, 0x72, 0x82, 0x08, 0x98, 0x62, 0x02, 0x80, 0xA9,
+	0x71, 0x12, 0x30, 0x01, 0x01, 0x08, 0x33, 0x36, 0xA8, 0x49, 0x45, 0x82,
+	0x00, 0xB0, 0xBB, 0x0B, 0x35, 0xB9, 0xA9, 0xFF, 0xA9, 0x89, 0xDB, 0xBD,
+	0xAA, 0xAA, 0x9C, 0x01, 0xC9, 0xAB, 0x80, 0xCC, 0xCB, 0x8C, 0x91, 0x9C,
+	0x10, 0x88, 0x52, 0x92, 0xCD, 0x8A, 0x42, 0x11, 0x41, 0x27, 0x98, 0x42,
+	0x02, 0x18, 0x03, 0x20, 0x35, 0x21, 0x04, 0x20, 0x45, 0x01, 0x30, 0x25,
+	0x90, 0x30, 0x24, 0x80, 0x42, 0xA1, 0x09, 0x62, 0x13, 0xB8, 0x9B, 0xA9,
+	0xAD, 0x02, 0xCC, 0xAB, 0xA9, 0xEB, 0xCB, 0xCB, 0xAC, 0x89, 0x01, 0xBC,
+	0xCA, 0xCC, 0xBB, 0xAB, 0x88, 0xA9, 0xFA, 0xBF, 0x0A, 0x90, 0x09, 0x99,
+	0xA9, 0xCB, 0x18, 0xA0, 0xAC, 0x72, 0x24, 0x18, 0x11, 0xA8, 0x49, 0x37,
+	0x13, 0x01, 0x53, 0x91, 0x48, 0x25, 0x10, 0x33, 0x00, 0xA1, 0x1D, 0x57,
+	0x80, 0x31, 0x80, 0x38, 0xA1, 0x99, 0xCA, 0x59, 0x14, 0x10, 0x91, 0xCD,
+	0x08, 0x00, 0x98, 0xBA, 0x0A, 0x81, 0x90, 0xFC, 0xAB, 0x88, 0x08, 0x81,
+	0xBD, 0xBB, 0x8A, 0x01, 0xCA, 0xC9, 0xAF, 0xD0, 0x1C, 0xC8, 0x9B, 0x60,
+	0xB1, 0x8B, 0xA8, 0x8D, 0x08, 0xAA, 0x28, 0x12, 0x01, 0xCA, 0x50, 0xA2,
+	0x9A, 0x55, 0x25, 0x00, 0x81, 0x99, 0x73, 0x21, 0x24, 0xA8, 0x11, 0x80,
+	0x32, 0x31, 0x26, 0x28, 0x16, 0x8A, 0x03, 0x8A, 0x35, 0x41, 0x04, 0xBC,
+	0x99, 0x1A, 0x02, 0x40, 0x05, 0xCB, 0xAB, 0x89, 0x08, 0x88, 0xC9, 0x08,
+	0xBA, 0x90, 0xDF, 0x89, 0x88, 0x41, 0xA1, 0xBD, 0x9C, 0x10, 0x12, 0x98,
+	0xDA, 0xAD, 0xAA, 0xBC, 0x08, 0x23, 0xC8, 0xBF, 0xB9, 0x9B, 0x10, 0x02,
+	0x98, 0xAF, 0x22, 0x01, 0x18, 0xA1, 0x70, 0x14, 0x11, 0x12, 0x88, 0x25,
+	0x61, 0x34, 0x23, 0x00, 0x98, 0x11, 0x43, 0x73, 0x15, 0x88, 0x08, 0x22,
+	0x01, 0xA8, 0x32, 0x33, 0x35, 0xB2, 0xEF, 0x89, 0x10, 0x21, 0x82, 0xBA,
+	0xCC, 0x9A, 0x29, 0xA1, 0x1B, 0x93, 0xAE, 0x9A, 0xB9, 0x9E, 0x11, 0xBA,
+	0x9B, 0x90, 0xAB, 0xCE, 0x09, 0x33, 0xFC, 0xCA, 0xBC, 0x89, 0x21, 0x91,
+	0xDE, 0xAC, 0x20, 0x12, 0x80, 0xBA, 0x9D, 0x19, 0x54, 0x81, 0x0A, 0x52,
+	0x22, 0x80, 0x10, 0xB9, 0x72, 0x42, 0x02, 0x31, 0x14, 0x00, 0xCA, 0x49,
+	0x02, 0x73, 0x82, 0x8A, 0x22, 0x10, 0x92, 0x9A, 0x10, 0x71, 0x14, 0xCC,
+	0x9B, 0x81, 0x40, 0x02, 0x98, 0xCD, 0x9A, 0x80, 0x09, 0x21, 0x81, 0xBA,
+	0xBE, 0x9B, 0x89, 0x33, 0xC8, 0xAC, 0x91, 0x9A, 0x90, 0xEB, 0x99, 0xBB,
+	0xFA, 0xBE, 0x9A, 0x08, 0x11, 0xA8, 0xEF, 0x8C, 0x80, 0x18, 0x84, 0xAA,
+	0xA8, 0x48, 0x25, 0x98, 0x20, 0x82, 0x0B, 0x17, 0x88, 0x45, 0x82, 0x21,
+	0x98, 0x40, 0x83, 0x48, 0x82, 0x18, 0x56, 0x90, 0x00, 0x88, 0x41, 0x12,
+	0x11, 0xDC, 0x39, 0x12, 0x00, 0xD9, 0xAA, 0x89, 0x41, 0x92, 0x9E, 0x90,
+	0xBA, 0x09, 0xD8, 0x18, 0x90, 0x21, 0xFB, 0x8B, 0xA8, 0x89, 0x90, 0x08,
+	0x9A, 0x23, 0xFC, 0xBB, 0x08, 0xA9, 0xEB, 0xCD, 0x99, 0x8B, 0x14, 0xBF,
+	0x10, 0xEC, 0x18, 0xA0, 0x08, 0x09, 0x25, 0x98, 0x30, 0x03, 0x8A, 0x43,
+	0x81, 0x78, 0x17, 0x8A, 0x11, 0x20, 0x82, 0x58, 0x15, 0x9B, 0x33, 0x99,
+	0x13, 0x09, 0x47, 0xC9, 0x38, 0xA2, 0x8B, 0x23, 0xBA, 0x63, 0x82, 0xA8,
+	0xAF, 0x88, 0x98, 0x52, 0xA0, 0x99, 0xBA, 0x80, 0x9C, 0x31, 0xA2, 0x39,
+	0xA3, 0xAF, 0x9A, 0x88, 0x19, 0x12, 0xA9, 0xCE, 0x8A, 0x90, 0x38, 0xB1,
+	0xBE, 0xBD, 0x9C, 0x88, 0xEA, 0x9E, 0x42, 0xC8, 0x8A, 0x99, 0x99, 0x08,
+	0x55, 0xA0, 0x30, 0x82, 0xAC, 0x20, 0x22, 0x33, 0x45, 0x13, 0xBC, 0x73,
+	0x93, 0x40, 0x83, 0x18, 0xB9, 0x60, 0x82, 0x19, 0x14, 0x20, 0x91, 0x10,
+	0xA0, 0xAE, 0x38, 0x22, 0x43, 0xF9, 0x8B, 0xBA, 0x2A, 0x13, 0x19, 0xF2,
+	0x9C, 0x99, 0x08, 0x01, 0x10, 0xA1, 0xAB, 0x99, 0xCD, 0x8A, 0x52, 0x13,
+	0xB0, 0xAC, 0xCC, 0x19, 0x11, 0x99, 0xF9, 0xCD, 0x9A, 0x88, 0xCA, 0xAC,
+	0xBC, 0x28, 0x13, 0x19, 0xF8, 0x0D, 0x02, 0x28, 0x16, 0x9A, 0x20, 0x13,
+	0x41, 0x22, 0xA0, 0x20, 0x49, 0x67, 0x00, 0x20, 0xA0, 0x29, 0x11, 0x12,
+	0x80, 0x28, 0x11, 0x46, 0x13, 0xCB, 0xA8, 0x09, 0x28, 0x24, 0xA2, 0xDF,
+	0x80, 0x98, 0x89, 0x01, 0x98, 0xBC, 0x8A, 0xCA, 0x21, 0x11, 0x13, 0xA2,
+	0xEF, 0xA9, 0x00, 0x08, 0x21, 0x11, 0xD9, 0x09, 0xC0, 0xCB, 0xAB, 0x99,
+	0xC9, 0x9E, 0x80, 0xDC, 0xBB, 0xAA, 0xA0, 0xEF, 0x09, 0x08, 0x32, 0x00,
+	0x08, 0xC9, 0x58, 0x93, 0x09, 0x33, 0x20, 0x47, 0x11, 0x24, 0x99, 0x44,
+	0xA8, 0x60, 0x04, 0x20, 0xB1, 0x0C, 0x83, 0x28, 0x06, 0x8A, 0x22, 0xA9,
+	0x31, 0xF9, 0x19, 0x82, 0x31, 0xD8, 0xAD, 0x98, 0x0A, 0x25, 0x08, 0x90,
+	0xBD, 0x89, 0x89, 0x21, 0x21, 0x13, 0xC9, 0xBC, 0xA9, 0x19, 0x98, 0x52,
+	0xA1, 0x19, 0xC1, 0xAE, 0xCB, 0x1A, 0x81, 0xDC, 0x9C, 0x9A, 0xA8, 0x9B,
+	0xF8, 0xBF, 0x08, 0x80, 0x31, 0xC8, 0x30, 0xA1, 0x50, 0xC1, 0x59, 0x03,
+	0x20, 0x14, 0x20, 0x32, 0x32, 0x25, 0x9C, 0x65, 0x01, 0x19, 0xB0, 0x38,
+	0x02, 0x41, 0xA3, 0x0C, 0x13, 0x98, 0x80, 0xCB, 0x18, 0x35, 0x21, 0xFB,
+	0xAA, 0xAC, 0x09, 0x32, 0x13, 0xC8, 0xBC, 0xBC, 0x0A, 0x31, 0x23, 0x01,
+	0xBC, 0x99, 0xAA, 0x29, 0xC0, 0x28, 0x9D, 0x33, 0xFD, 0xAB, 0x99, 0x31,
+	0x91, 0xDD, 0xEB, 0xAB, 0x10, 0xFA, 0x0A, 0xD9, 0x9B, 0xA0, 0x3A, 0x06,
+	0x9A, 0x10, 0xBB, 0x72, 0x91, 0x29, 0x14, 0x31, 0x26, 0x80, 0x21, 0x09,
+	0x36, 0x12, 0x45, 0x91, 0x89, 0xB8, 0x50, 0x13, 0x38, 0x91, 0x8C, 0x12,
+	0x08, 0x21, 0xCC, 0x09, 0x80, 0x30, 0xFB, 0x0D, 0xA9, 0x19, 0x01, 0x80,
+	0xB8, 0xAF, 0x80, 0x89, 0x33, 0xA8, 0xAB, 0xAC, 0x09, 0x23, 0x31, 0xA3,
+	0xCD, 0x9A, 0xAA, 0xDA, 0x0B, 0x21, 0x23, 0xFE, 0xBE, 0xBC, 0x28, 0xA1,
+	0xDC, 0xAD, 0x09, 0x99, 0x20, 0xC9, 0x19, 0x10, 0x43, 0xD8, 0x41, 0x03,
+	0x30, 0x46, 0x90, 0x09, 0x82, 0x71, 0x23, 0x22, 0x02, 0x99, 0x32, 0x02,
+	0x31, 0xB2, 0x78, 0xA2, 0x38, 0x27, 0x99, 0x91, 0xAB, 0xBB, 0x4A, 0x27,
+	0x98, 0x99, 0xBE, 0x9A, 0x80, 0x10, 0x00, 0x22, 0xFB, 0x9A, 0xAA, 0x28,
+	0x36, 0x82, 0xAA, 0xAA, 0x98, 0x19, 0x25, 0xC8, 0x28, 0xDA, 0xBB, 0x9C,
+	0x98, 0xA9, 0xAA, 0xFF, 0x9C, 0xA8, 0xAE, 0x98, 0xBC, 0x31, 0x81, 0x23,
+	0xDE, 0x28, 0x98, 0x50, 0x82, 0x1A, 0x15, 0x89, 0x32, 0x98, 0x64, 0x12,
+	0x32, 0xC9, 0x58, 0x02, 0x28, 0x03, 0x0B, 0x22, 0x18, 0x03, 0xCF, 0x32,
+	0x00, 0x43, 0xE9, 0x9A, 0x99, 0x28, 0x01, 0x18, 0xE8, 0xAC, 0x00, 0x98,
+	0x22, 0x02, 0xB0, 0xBF, 0x88, 0x80, 0x62, 0x01, 0xB9, 0x18, 0x90, 0x99,
+	0xAD, 0x18, 0x22, 0x16, 0xEA, 0xAB, 0x8A, 0x10, 0x99, 0xFA, 0xAE, 0x18,
+	0xA8, 0x9B, 0xE8, 0xAC, 0x90, 0x8D, 0x11, 0x89, 0x26, 0x98, 0x98, 0x8A,
+	0x72, 0x23, 0x31, 0xB1, 0x1A, 0x27, 0x20, 0x23, 0x09, 0x44, 0x11, 0x04,
+	0x99, 0x01, 0xAA, 0x61, 0x21, 0x81, 0x22, 0xCA, 0xAA, 0x38, 0x83, 0xAE,
+	0x11, 0x99, 0x82, 0xDF, 0xAA, 0x8A, 0x31, 0x31, 0x93, 0xBF, 0xAB, 0x8A,
+	0x42, 0x22, 0x23, 0xCA, 0x0B, 0x91, 0x9A, 0xBC, 0x61, 0x13, 0x99, 0xEB,
+	0x8C, 0x00, 0xA8, 0xDA, 0xCE, 0x8A, 0xA8, 0xDB, 0xBB, 0xBA, 0xBD, 0x09,
+	0x81, 0x00, 0x29, 0x17, 0x89, 0x21, 0xC9, 0x50, 0x13, 0x63, 0x13, 0x31,
+	0x24, 0x54, 0x82, 0x18, 0x22, 0x12, 0x20, 0x44, 0x10, 0x32, 0x88, 0xB2,
+	0x8F, 0x24, 0x90, 0x01, 0xDB, 0x99, 0x18, 0x20, 0xC3, 0xAE, 0xDA, 0x9C,
+	0x11, 0x10, 0x12, 0x82, 0xCA, 0xCB, 0xAA, 0x0A, 0x33, 0x25, 0x88, 0x08,
+	0x01, 0xED, 0x99, 0xDA, 0x28, 0x03, 0x21, 0xDA, 0x0A, 0xD8, 0xBB, 0xEB,
+	0xBC, 0x51, 0xB0, 0xBB, 0xCD, 0x18, 0xF9, 0x39, 0xC0, 0x1A, 0x13, 0x21,
+	0xA2, 0x39, 0x91, 0x39, 0x25, 0x72, 0x13, 0x21, 0x80, 0x41, 0x26, 0x01,
+	0x18, 0xA1, 0x2A, 0x27, 0x01, 0x90, 0x08, 0x01, 0xC9, 0x50, 0xA0, 0x9B,
+	0x22, 0x8B, 0x44, 0x91, 0xCC, 0xBF, 0x18, 0x80, 0x31, 0x91, 0x9A, 0x80,
+	0xEA, 0xBB, 0x19, 0x43, 0x35, 0x22, 0xD8, 0x9C, 0x88, 0x90, 0x18, 0x01,
+	0xCB, 0x0A, 0x18, 0x03, 0xEB, 0xDD, 0xBC, 0xAA, 0x09, 0xF8, 0x8B, 0xB0,
+	0xAE, 0x80, 0x80, 0x99, 0x9A, 0x40, 0x24, 0x52, 0x92, 0x9D, 0x12, 0x32,
+	0x44, 0x13, 0x00, 0x20, 0x47, 0x11, 0x21, 0x03, 0xAA, 0x1A, 0x15, 0x21,
+	0x24, 0x01, 0xB8, 0x0C, 0x05, 0xBB, 0x88, 0xB9, 0x51, 0x23, 0xB1, 0xBF,
+	0xCC, 0x9A, 0x18, 0x25, 0x88, 0x10, 0xAA, 0xC9, 0x8B, 0x81, 0x1A, 0x37,
+	0x01, 0x90, 0xA9, 0xBE, 0x89, 0x43, 0x81, 0xA9, 0xCA, 0x8D, 0x11, 0x80,
+	0xEC, 0x9B, 0xCA, 0x0B, 0x91, 0xAE, 0xB8, 0x9C, 0xFA, 0x8C, 0x02, 0x0A,
+	0x03, 0x28, 0x03, 0x8B, 0x44, 0x08, 0x36, 0x32, 0x83, 0xAB, 0x74, 0x23,
+	0x20, 0x25, 0x80, 0x10, 0xA9, 0x21, 0x8C, 0x77, 0x90, 0x08, 0x98, 0x29,
+	0x91, 0x1A, 0xC1, 0x2B, 0x25, 0x99, 0xA8, 0xAE, 0x00, 0x88, 0x10, 0xB9,
+	0x48, 0x92, 0x09, 0xFB, 0x09, 0x00, 0x40, 0xA2, 0x1C, 0x82, 0x18, 0x90,
+	0xBC, 0xA0, 0x8E, 0x82, 0x8A, 0x53, 0xC1, 0xBC, 0xBE, 0xBB, 0x18, 0xF1,
+	0xBB, 0xB9, 0x9E, 0x11, 0x08, 0xB1, 0x9E, 0x21, 0x01, 0x32, 0x92, 0x8D,
+	0x25, 0x23, 0x02, 0x00, 0x34, 0x73, 0x05, 0x10, 0x03, 0x29, 0x83, 0x8D,
+	0x24, 0x28, 0x25, 0xBB, 0x20, 0x88, 0x72, 0xC1, 0x8A, 0xA8, 0x29, 0x35,
+	0x99, 0xB0, 0xBF, 0x00, 0x88, 0x31, 0x80, 0x88, 0xA9, 0xBC, 0x8B, 0x10,
+	0x34, 0x13, 0xA9, 0xAA, 0x00, 0xEE, 0x9A, 0x28, 0x34, 0x01, 0xFA, 0xAC,
+	0x09, 0x12, 0xA9, 0xDB, 0xCD, 0x0A, 0x90, 0xCE, 0x1A, 0x91, 0x9C, 0xA8,
+	0x9A, 0xC0, 0x6A, 0x84, 0x28, 0x02, 0x9A, 0x11, 0x61, 0x14, 0x30, 0x03,
+	0x08, 0x55, 0x91, 0x39, 0x24, 0x31, 0xB9, 0x51, 0x03, 0x48, 0xD2, 0x9C,
+	0x18, 0x44, 0x81, 0xAB, 0xA8, 0x1A, 0x35, 0x90, 0xBC, 0xDA, 0x1A, 0x01,
+	0x52, 0x90, 0x0A, 0xB8, 0x9E, 0x98, 0x21, 0x11, 0x35, 0x91, 0x9C, 0x88,
+	0xBA, 0xAB, 0x38, 0x37, 0x02, 0xA8, 0xEF, 0x08, 0x81, 0x98, 0xB8, 0xBE,
+	0x09, 0x02, 0xCA, 0xCC, 0xAC, 0x08, 0x20, 0x01, 0xDA, 0x8A, 0x80, 0x53,
+	0x02, 0x89, 0x01, 0x31, 0x13, 0x77, 0x23, 0x81, 0x80, 0x11, 0x40, 0x45,
+	0x11, 0x99, 0x08, 0x34, 0x89, 0x93, 0x1B, 0x52, 0x25, 0x98, 0xEB, 0x99,
+	0x28, 0x32, 0x82, 0xDD, 0x9A, 0x98, 0x18, 0x21, 0x91, 0xA9, 0x98, 0xCA,
+	0xCC, 0x30, 0x91, 0x61, 0x80, 0x99, 0x99, 0xB8, 0xBF, 0x09, 0x42, 0x23,
+	0x80, 0xDD, 0xAA, 0x20, 0xC8, 0x8B, 0xA0, 0xBF, 0x88, 0xB9, 0xBF, 0x1A,
+	0xB1, 0xAE, 0x98, 0x8A, 0x89, 0x72, 0x83, 0x89, 0x81, 0xBA, 0x79, 0x15,
+	0x21, 0x24, 0x90, 0x80, 0x1A, 0x16, 0x29, 0x57, 0x90, 0x80, 0x89, 0x01,
+	0x88, 0x63, 0xB0, 0x38, 0x92, 0x9A, 0x08, 0x28, 0x17, 0x98, 0xDA, 0x9D,
+	0x20, 0x00, 0x31, 0x98, 0xA8, 0xAD, 0xC9, 0xBB, 0x72, 0x02, 0x12, 0x99,
+	0xBA, 0xAA, 0x38, 0x91, 0x68, 0x03, 0x99, 0xA8, 0xAC, 0xA0, 0x9B, 0xF9,
+	0x9F, 0x90, 0x09, 0x91, 0xBC, 0xEA, 0xAC, 0xA9, 0x9B, 0x24, 0x01, 0x91,
+	0xBC, 0x9A, 0x32, 0x54, 0x91, 0x29, 0x23, 0x00, 0x73, 0x42, 0x15, 0x22,
+	0x90, 0x30, 0x32, 0x41, 0x05, 0x71, 0x84, 0x10, 0xB8, 0x8C, 0x22, 0x10,
+	0x32, 0xB9, 0x40, 0xA8, 0x52, 0xFA, 0x8B, 0xB9, 0x28, 0x14, 0x10, 0x91,
+	0x9C, 0xC8, 0x9B, 0x98, 0x00, 0x45, 0x81, 0x81, 0x9A, 0xA8, 0xDF, 0x89,
+	0x19, 0x34, 0x81, 0xB9, 0xBB, 0x0A, 0xD0, 0xAC, 0x9A, 0xA9, 0xAA, 0x8A,
+	0xF8, 0xFF, 0x08, 0xB9, 0x09, 0xA9, 0x18, 0xA8, 0x72, 0xB1, 0x18, 0x90,
+	0x18, 0x12, 0x57, 0x81, 0x28, 0x92, 0x69, 0x33, 0x01, 0x10, 0x90, 0x63,
+	0x30, 0x03, 0x08, 0x38, 0x14, 0x00, 0x8A, 0x95, 0x9B, 0x28, 0x46, 0x24,
+	0xCB, 0xDB, 0x9C, 0x22, 0x11, 0x11, 0xCA, 0x29, 0xB2, 0xBD, 0xBB, 0x39,
+	0x25, 0x21, 0xA2, 0xAB, 0xA8, 0xDC, 0xAB, 0x0A, 0x43, 0x11, 0x11, 0xA0,
+	0xBB, 0xFC, 0xAF, 0xA9, 0x89, 0x42, 0x90, 0xFB, 0x9A, 0xCA, 0x9B, 0x99,
+	0x18, 0xB3, 0x1E, 0xC1, 0x39, 0x82, 0x8A, 0xB1, 0x1D, 0x47, 0x13, 0x01,
+	0x18, 0x02, 0x29, 0x25, 0x45, 0x01, 0x08, 0x12, 0x30, 0x37, 0x91, 0x09,
+	0xC8, 0x30, 0x01, 0x11, 0x80, 0x72, 0x85, 0xBA, 0xCA, 0xAC, 0x20, 0x43,
+	0x12, 0xA9, 0xBA, 0xAD, 0x8A, 0x88, 0x41, 0x23, 0x01, 0xEA, 0x9B, 0x98,
+	0x0A, 0xA9, 0xC9, 0x48, 0xB0, 0x9A, 0x8B, 0x24, 0xD8, 0xEC, 0xAE, 0x89,
+	0x10, 0x33, 0xE9, 0xAB, 0xB8, 0x8B, 0xF8, 0x8C, 0x90, 0x1A, 0xA0, 0x8D,
+	0x83, 0x3A, 0x04, 0xAA, 0x00, 0x6B, 0x27, 0x11, 0x12, 0x99, 0x80, 0x38,
+	0x77, 0x12, 0x00, 0xA0, 0x8A, 0x23, 0x30, 0x17, 0x99, 0x00, 0x89, 0x43,
+	0x98, 0x31, 0xBA, 0x31, 0xC8, 0x99, 0xBC, 0x38, 0x26, 0x20, 0xD9, 0xBC,
+	0xAA, 0x19, 0x17, 0x18, 0xB8, 0x9C, 0x10, 0x00, 0x81, 0xBF, 0x99, 0x28,
+	0x33, 0x81, 0xDA, 0xBD, 0x8B, 0x80, 0x9A, 0xCB, 0x9D, 0x42, 0xA1, 0xDD,
+	0xCB, 0xCB, 0x0A, 0x81, 0x40, 0x93, 0xAC, 0xBA, 0xAE, 0x22, 0x20, 0x05,
+	0x00, 0x00, 0x21, 0x12, 0x20, 0x57, 0x13, 0x99, 0x32, 0x11, 0x67, 0x81,
+	0x00, 0xA8, 0x58, 0x81, 0x20, 0x81, 0x18, 0x12, 0x09, 0x03, 0x9A, 0xB8,
+	0xCE, 0x19, 0x91, 0x73, 0xA0, 0xA8, 0xAB, 0xAA, 0xDC, 0x30, 0x02, 0x01,
+	0xDB, 0x09, 0xB8, 0x9D, 0xC8, 0x2A, 0x02, 0x12, 0x20, 0xF9, 0x89, 0xCC,
+	0x88, 0x99, 0x18, 0xC0, 0x8C, 0x18, 0x93, 0xCD, 0xFF, 0x9B, 0x28, 0x12,
+	0x80, 0xAB, 0xF9, 0x8A, 0x80, 0x10, 0x00, 0x40, 0x14, 0x08, 0xB9, 0x1B,
+	0x24, 0x56, 0x03, 0x08, 0x01, 0x40, 0x24, 0x31, 0x00, 0x02, 0x08, 0x98,
+	0x73, 0x36, 0x82, 0xD9, 0x9B, 0x63, 0x22, 0x98, 0xBD, 0x08, 0x42, 0x13,
+	0xB9, 0xAB, 0x9C, 0x20, 0x00, 0x00, 0x90, 0xBC, 0xB9, 0x0B, 0x03, 0xEB,
+	0xAA, 0x9A, 0x10, 0x98, 0x08, 0xCF, 0x08, 0xA9, 0x19, 0xDC, 0xAA, 0xAD,
+	0x99, 0x61, 0xA1, 0xCF, 0x9B, 0x99, 0x00, 0x99, 0xCA, 0x28, 0xEB, 0x20,
+	0x88, 0x31, 0xC2, 0x0C, 0xC8, 0x40, 0x26, 0x22, 0x91, 0x1A, 0x21, 0x13,
+	0x72, 0x06, 0x28, 0x00, 0x30, 0x04, 0x19, 0x93, 0x2C, 0x37, 0x00, 0xB0,
+	0x1D, 0x34, 0x83, 0xBB, 0xCE, 0x28, 0x32, 0x13, 0xB1, 0xAC, 0xBA, 0xAB,
+	0x28, 0x63, 0x13, 0xD9, 0xCA, 0x1A, 0x01, 0x98, 0xAA, 0x09, 0x43, 0xB8,
+	0xAB, 0x9D, 0x31, 0xA1, 0xBD, 0xCC, 0x8A, 0x00, 0x40, 0x83, 0xDC, 0x9B,
+	0xED, 0x9C, 0x00, 0x20, 0x25, 0xC8, 0xBA, 0xBE, 0x18, 0x28, 0x15, 0x10,
+	0x81, 0xBB, 0x08, 0x9A, 0x55, 0x90, 0x32, 0x12, 0x63, 0x02, 0x99, 0x08,
+	0x08, 0x57, 0x90, 0x31, 0xB0, 0x40, 0xA0, 0x48, 0x82, 0x41, 0xA2, 0xAA,
+	0xAA, 0x38, 0x27, 0x21, 0xB0, 0x9D, 0xBB, 0x88, 0x38, 0x14, 0x30, 0xD8,
+	0x99, 0xAE, 0x88, 0x99, 0x30, 0x81, 0x30, 0xEB, 0x9A, 0xCA, 0x8B, 0xA1,
+	0x1B, 0xF8, 0x9E, 0x89, 0x9B, 0x50, 0xA0, 0xAF, 0x9A, 0xDC, 0x19, 0x01,
+	0x30, 0x84, 0xAE, 0xA8, 0x9D, 0x10, 0x22, 0x43, 0x82, 0x98, 0xAE, 0x18,
+	0x01, 0x52, 0x13, 0x30, 0x25, 0x91, 0x19, 0xB9, 0x20, 0x57, 0x22, 0x31,
+	0xB1, 0x9F, 0x01, 0x18, 0x35, 0xA9, 0x18, 0xA0, 0x3A, 0x85, 0x0B, 0x91,
+	0x9C, 0x11, 0xA9, 0x21, 0xEA, 0x88, 0xAB, 0x19, 0xB0, 0x9A, 0x19, 0x82,
+	0x00, 0xDF, 0x99, 0x19, 0x03, 0x8D, 0xA8, 0x0B, 0x53, 0xB8, 0x28, 0xD9,
+	0xDA, 0xAC, 0x8B, 0x61, 0x02, 0xCE, 0xAA, 0x9C, 0x22, 0xB8, 0x9A, 0xF9,
+	0x89, 0x98, 0x98, 0x00, 0x2A, 0x02, 0x17, 0x1A, 0xD8, 0x99, 0x32, 0x73,
+	0x16, 0x01, 0x80, 0x98, 0x21, 0x00, 0x63, 0x11, 0x43, 0x23, 0xA9, 0x10,
+	0xBB, 0x76, 0x82, 0x08, 0x00, 0xAA, 0x53, 0x92, 0x18, 0x91, 0x10, 0x81,
+	0xCF, 0x08, 0x28, 0x14, 0x89, 0xAA, 0xCA, 0xAB, 0xBB, 0x8A, 0x45, 0x82,
+	0xDB, 0xAC, 0x09, 0x00, 0xD9, 0xAA, 0x89, 0x00, 0xFA, 0xAC, 0x08, 0xA8,
+	0x18, 0xFC, 0x9E, 0x00, 0x00, 0x13, 0xDA, 0x8A, 0xA9, 0x88, 0x01, 0x10,
+	0x52, 0x12, 0x80, 0xDB, 0x8B, 0x65, 0x12, 0x11, 0x12, 0x01, 0x11, 0xA9,
+	0x74, 0x07, 0x00, 0x81, 0x8A, 0x32, 0x89, 0x25, 0x09, 0x44, 0xA1, 0x9B,
+	0xCA, 0x48, 0x14, 0x11, 0x80, 0xA9, 0xAA, 0x9B, 0xAA, 0x18, 0x62, 0x91,
+	0x80, 0xFC, 0x9A, 0xBB, 0x28, 0x13, 0x21, 0xB1, 0x9E, 0xA9, 0x1A, 0x80,
+	0xA9, 0x28, 0xCC, 0x20, 0xE9, 0xBB, 0xCB, 0x0D, 0x91, 0xAE, 0xEA, 0x9D,
+	0x18, 0x81, 0x20, 0xFA, 0x9A, 0x89, 0x99, 0x12, 0x88, 0x72, 0x82, 0x08,
+	0xD9, 0x8C, 0x12, 0x51, 0x24, 0x81, 0x88, 0x20, 0x42, 0x01, 0x80, 0x32,
+	0x54, 0x13, 0x31, 0x92, 0x19, 0x02, 0x60, 0x46, 0x01, 0x88, 0xAA, 0x52,
+	0x12, 0x81, 0x18, 0x10, 0xC0, 0xBF, 0x9A, 0x51, 0x13, 0x02, 0xDA, 0xBD,
+	0x9B, 0x00, 0x42, 0x81, 0x90, 0xBC, 0x89, 0xC9, 0x9C, 0x08, 0x10, 0xA1,
+	0xBE, 0xBB, 0xBC, 0x18, 0xC1, 0x8B, 0xFA, 0xDF, 0x10, 0x00, 0x11, 0xB8,
+	0xAC, 0x99, 0x00, 0x10, 0x81, 0x88, 0x40, 0x14, 0x99, 0x22, 0xFA, 0x40,
+	0x25, 0x30, 0x13, 0x99, 0x23, 0x08, 0x57, 0x01, 0x10, 0x92, 0x28, 0x32,
+	0x62, 0x26, 0x92, 0xCB, 0x8A, 0x18, 0x35, 0x23, 0x88, 0x11, 0xA8, 0xCE,
+	0xBA, 0x0B, 0x54, 0x12, 0x10, 0xA8, 0xCE, 0x9B, 0x09, 0x32, 0x14, 0xA9,
+	0x89, 0x89, 0x80, 0xCA, 0xAC, 0x08, 0x31, 0x02, 0xC0, 0xBE, 0xAA, 0x99,
+	0xB0, 0xCD, 0xBC, 0xAA, 0xA9, 0x89, 0x48, 0x82, 0xBC, 0xCF, 0xBB, 0x18,
+	0x11, 0x23, 0x00, 0x08, 0x90, 0xFB, 0x9C, 0x21, 0x52, 0x26, 0x21, 0x14,
+	0xC9, 0x19, 0x11, 0x54, 0x23, 0x10, 0x02, 0x11, 0x83, 0x0C, 0x47, 0x11,
+	0x32, 0xB8, 0x2A, 0x16, 0x08, 0x12, 0x38, 0x16, 0xB8, 0xAC, 0x9B, 0x30,
+	0x12, 0x01, 0x1A, 0xF8, 0xDC, 0xAB, 0x00, 0x10, 0x03, 0x9A, 0xAA, 0xCA,
+	0xBD, 0xAA, 0x38, 0xA3, 0xCC, 0xBD, 0xAB, 0x99, 0x99, 0x18, 0xFC, 0x9F,
+	0xA9, 0x8A, 0x21, 0xA8, 0x29, 0x81, 0xCD, 0x9B, 0xAB, 0x1A, 0x42, 0x12,
+	0x44, 0x92, 0x8B, 0xFA, 0x39, 0x37, 0x10, 0x32, 0xA9, 0x40, 0x05, 0x20,
+	0x26, 0xA9, 0x31, 0x82, 0x40, 0x82, 0x29, 0x47, 0x21, 0x98, 0x99, 0xBA,
+	0x29, 0x47, 0x43, 0x03, 0xEC, 0xAA, 0x18, 0x42, 0x13, 0xAA, 0xAA, 0x99,
+	0x89, 0x88, 0x99, 0x11, 0x01, 0x0A, 0x83, 0xFF, 0xAA, 0x09, 0x53, 0x82,
+	0xCB, 0xBC, 0x8A, 0x01, 0x00, 0x98, 0xEB, 0xBC, 0xBC, 0x2A, 0x02, 0x18,
+	0xE0, 0x9B, 0x89, 0xFA, 0x1A, 0x11, 0x11, 0x33, 0xC8, 0x9A, 0xAA, 0x41,
+	0x54, 0x02, 0x32, 0x14, 0x12, 0x82, 0x18, 0x75, 0x16, 0x98, 0x09, 0x80,
+	0x72, 0x13, 0x89, 0x32, 0xA0, 0x89, 0xA8, 0x78, 0x25, 0x98, 0x00, 0x81,
+	0x10, 0xC9, 0xAD, 0x28, 0x33, 0x81, 0x08, 0xD9, 0x9C, 0xB8, 0x8D, 0x11,
+	0xA0, 0xAA, 0x28, 0x22, 0xB1, 0xDE, 0x9C, 0x99, 0x98, 0x89, 0x88, 0xCD,
+	0x9A, 0x09, 0xB0, 0xFF, 0xAB, 0x0A, 0x53, 0x01, 0xA9, 0xBB, 0xAA, 0x9A,
+	0xAA, 0x08, 0x36, 0x01, 0xA9, 0x5A, 0x03, 0xBB, 0x38, 0x35, 0x73, 0x05,
+	0x80, 0x21, 0x01, 0x21, 0x23, 0x47, 0x81, 0x38, 0x02, 0x40, 0x24, 0x18,
+	0x43, 0xA8, 0x20, 0x91, 0x7A, 0x24, 0x80, 0x44, 0x91, 0xDB, 0xAC, 0x19,
+	0x45, 0x02, 0x98, 0xDB, 0x8A, 0x00, 0x0A, 0x12, 0xB8, 0x09, 0xA8, 0x88,
+	0xD9, 0xBE, 0x88, 0x08, 0x83, 0xDE, 0x8A, 0x89, 0x88, 0x80, 0xB9, 0xDD,
+	0xCB, 0xA9, 0x18, 0x23, 0xB1, 0xAC, 0xA9, 0xEC, 0x9B, 0x98, 0x41, 0x23,
+	0x82, 0xBA, 0x30, 0x81, 0x19, 0x16, 0x62, 0x36, 0x82, 0x38, 0x14, 0x18,
+	0x12, 0x20, 0x64, 0x14, 0x08, 0x10, 0x44, 0x22, 0x81, 0x8A, 0x20, 0x13,
+	0x49, 0x25, 0x54, 0x23, 0xEA, 0x9B, 0x8A, 0x20, 0x14, 0x11, 0x12, 0xD9,
+	0xAD, 0xA9, 0x19, 0x91, 0xB9, 0x89, 0x21, 0x91, 0xBE, 0xAB, 0xBA, 0xAD,
+	0xCA, 0x8B, 0x98, 0xFB, 0x8D, 0x00, 0x98, 0xED, 0x9B, 0x9A, 0x09, 0x31,
+	0x99, 0x30, 0xF8, 0xAE, 0x88, 0x89, 0x12, 0x98, 0x08, 0x44, 0x00, 0x88,
+	0xAA, 0x99, 0x72, 0x24, 0x62, 0x33, 0x89, 0x21, 0xC8, 0x48, 0x12, 0x51,
+	0x35, 0x80, 0x12, 0x89, 0x31, 0x93, 0x7A, 0x05, 0x18, 0x81, 0x10, 0x73,
+	0x91, 0xAB, 0xCB, 0x20, 0x35, 0x01, 0x88, 0xCA, 0xAB, 0x9A, 0x88, 0x80,
+	0xA8, 0x9C, 0x52, 0x84, 0xEB, 0xCB, 0x0B, 0x11, 0x98, 0xB9, 0xBB, 0xCB,
+	0xCC, 0x8A, 0xA0, 0xCF, 0xCC, 0x8A, 0x41, 0x82, 0x89, 0xD9, 0x9B, 0x90,
+	0xAA, 0x18, 0x81, 0x4A, 0x16, 0x18, 0x13, 0xFB, 0x8D, 0x11, 0x30, 0x44,
+	0x82, 0x10, 0x82, 0x9A, 0x41, 0x01, 0x41, 0x22, 0x47, 0x24, 0xA0, 0x9A,
+	0x8B, 0x62, 0x23, 0x01, 0x01, 0x08, 0x11, 0x00, 0x23, 0xBF, 0x9B, 0x19,
+	0x64, 0x25, 0xA9, 0x99, 0xCB, 0x09, 0x80, 0x8C, 0x22, 0x98, 0x22, 0x81,
+	0xDD, 0xAC, 0xAA, 0x20, 0x03, 0xB9, 0xBD, 0xCB, 0x9A, 0x88, 0xA9, 0xCE,
+	0xDC, 0x9B, 0x00, 0x32, 0x02, 0xD9, 0xAC, 0x98, 0xBA, 0x9A, 0x01, 0x38,
+	0x47, 0x00, 0x00, 0xCA, 0x9B, 0x20, 0x61, 0x26, 0x81, 0x00, 0x19, 0x22,
+	0x42, 0x43, 0x13, 0x19, 0x24, 0x0A, 0x67, 0x81, 0x10, 0x02, 0x8B, 0x03,
+	0xAD, 0x73, 0x22, 0x20, 0x92, 0xAE, 0x01, 0x89, 0x20, 0x14, 0x19, 0xB2,
+	0x9E, 0x89, 0x80, 0x08, 0xA8, 0x0B, 0x04, 0xCB, 0xAA, 0xBB, 0x50, 0xA1,
+	0xAB, 0xEB, 0xBD, 0xA9, 0xAB, 0x1A, 0x22, 0xA9, 0xFD, 0xBF, 0x99, 0x88,
+	0x21, 0x82, 0xCB, 0xAA, 0x9B, 0x88, 0x99, 0x88, 0x62, 0xA8, 0x01, 0x28,
+	0x06, 0x19, 0xB8, 0x48, 0x67, 0x82, 0x00, 0x21, 0x84, 0x08, 0xA1, 0x09,
+	0x56, 0x14, 0x01, 0x22, 0xA0, 0x1A, 0x91, 0x43, 0x62, 0x92, 0x68, 0x14,
+	0x89, 0x80, 0xDB, 0x39, 0x84, 0x20, 0x01, 0x90, 0x80, 0xEA, 0x09, 0x81,
+	0xAB, 0xAA, 0x9B, 0x36, 0xB9, 0x90, 0xAC, 0x99, 0xDC, 0xBC, 0x9A, 0xBA,
+	0xCB, 0x9A, 0x09, 0xA1, 0xDF, 0xCA, 0x9D, 0x18, 0x90, 0x1A, 0x93, 0xBD,
+	0x8B, 0xB0, 0x1D, 0xC2, 0x0C, 0x22, 0x03, 0x51, 0xA2, 0x9F, 0x11, 0x81,
+	0x51, 0x23, 0x00, 0x03, 0x19, 0x43, 0x22, 0x41, 0x95, 0x2B, 0x16, 0x10,
+	0x42, 0x91, 0x58, 0x82, 0x2A, 0x17, 0x9A, 0x51, 0x82, 0x89, 0x82, 0x9D,
+	0x32, 0x81, 0x21, 0xC2, 0x9C, 0x80, 0x9A, 0x32, 0xDA, 0xAB, 0x99, 0x28,
+	0x04, 0xCB, 0xB8, 0x9F, 0x11, 0xA0, 0x9D, 0x90, 0xBD, 0x89, 0x99, 0xCA,
+	0x98, 0xCF, 0xAA, 0xBB, 0xAB, 0x33, 0x98, 0x80, 0xFF, 0x99, 0x88, 0xA9,
+	0x00, 0x98, 0x00, 0x10, 0x53, 0x14, 0xA8, 0x00, 0xBB, 0x50, 0x27, 0x00,
+	0x63, 0x03, 0x08, 0x11, 0xAC, 0x64, 0x91, 0x18, 0x34, 0x80, 0x43, 0xA9,
+	0x38, 0x06, 0x99, 0x43, 0x11, 0x33, 0xA3, 0x9F, 0x21, 0x11, 0x01, 0x80,
+	0x10, 0x00, 0xA8, 0x9D, 0x62, 0xA1, 0xBE, 0xA9, 0x20, 0x13, 0xCB, 0xAC,
+	0x10, 0xD9, 0xBB, 0x9B, 0x80, 0xB9, 0xEE, 0x8A, 0x21, 0xD9, 0x99, 0xDB,
+	0x9B, 0xB8, 0xAD, 0x31, 0x92, 0x9C, 0xE8, 0x9B, 0x32, 0xF9, 0x8B, 0x12,
+	0x08, 0x23, 0xCA, 0x38, 0x85, 0x0A, 0x44, 0x81, 0x40, 0x91, 0x0B, 0x46,
+	0x01, 0x32, 0x91, 0x8A, 0x45, 0x90, 0x30, 0x25, 0x00, 0x22, 0x00, 0x22,
+	0x13, 0x00, 0x36, 0x11, 0xB9, 0x29, 0x80, 0x42, 0x45, 0x81, 0x39, 0xC3,
+	0x8D, 0x00, 0xA8, 0x1C, 0xE2, 0x8D, 0x10, 0x90, 0x0B, 0x17, 0xBD, 0x98,
+	0xAB, 0x51, 0xB3, 0xBF, 0x80, 0x09, 0x31, 0xD9, 0xAC, 0xA9, 0xAB, 0x10,
+	0x01, 0x20, 0xD0, 0xBD, 0x8A, 0x80, 0x90, 0xBC, 0x9D, 0x31, 0x01, 0x23,
+	0x92, 0x8F, 0x02, 0x99, 0x74, 0x90, 0x0B, 0x45, 0x11, 0x34, 0xB1, 0x8C,
+	0x12, 0x08, 0x53, 0x02, 0x2A, 0x05, 0x8A, 0x62, 0x12, 0x09, 0x11, 0x08,
+	0x34, 0xA2, 0x8B, 0x02, 0x41, 0x27, 0x01, 0x08, 0xB0, 0xAE, 0x08, 0x10,
+	0x82, 0xFB, 0x9C, 0x00, 0x01, 0x82, 0x9A, 0x18, 0xB0, 0x9C, 0x90, 0xBC,
+	0xCB, 0xBF, 0xAB, 0x88, 0xAA, 0xEE, 0xAC, 0x99, 0x00, 0x32, 0xB0, 0xAC,
+	0xDB, 0xAA, 0x20, 0xA0, 0x99, 0xA0, 0xBA, 0x60, 0xA2, 0x9E, 0x12, 0xA0,
+	0x58, 0x04, 0x88, 0x42, 0x11, 0x73, 0x04, 0x00, 0x21, 0x91, 0x38, 0x14,
+	0x22, 0x32, 0x27, 0x21, 0x12, 0x01, 0x0A, 0x27, 0x21, 0x02, 0xA1, 0x9E,
+	0x63, 0x13, 0x12, 0x00, 0xBA, 0x08, 0x98, 0x1A, 0x46, 0xA8, 0x8A, 0x98,
+	0x88, 0x10, 0xFB, 0x2A, 0x36, 0x80, 0x98, 0xCC, 0x8A, 0xE9, 0xBD, 0x9B,
+	0x80, 0x90, 0xEB, 0xAB, 0xAA, 0x88, 0x80, 0xC8, 0xAA, 0xAF, 0xA9, 0x88,
+	0x88, 0xB9, 0xBC, 0x89, 0x53, 0x90, 0x38, 0x90, 0xA8, 0x9A, 0xCC, 0x52,
+	0x43, 0x44, 0x11, 0x25, 0x12, 0x08, 0x24, 0x09, 0x22, 0x21, 0x70, 0x15,
+	0x20, 0x12, 0x21, 0x20, 0x67, 0x13, 0xA9, 0x00, 0x99, 0x50, 0x35, 0x10,
+	0x31, 0x91, 0x88, 0xC9, 0x9A, 0x53, 0xB8, 0x2A, 0x13, 0x80, 0x10, 0xDB,
+	0x28, 0x37, 0xB1, 0xBC, 0xCA, 0xAB, 0x08, 0xDB, 0x0A, 0x98, 0xCA, 0xFB,
+	0xBF, 0xAB, 0x9B, 0x29, 0x36, 0xA0, 0xCB, 0x99, 0x88, 0xBA, 0xBB, 0xB9,
+	0xBF, 0x09, 0x10, 0x32, 0x32, 0x08, 0x80, 0x30, 0x27, 0xC8, 0x0B, 0x35,
+	0x23, 0x11, 0x43, 0x57, 0x01, 0x08, 0x88, 0x31, 0x02, 0x11, 0x13, 0x75,
+	0x33, 0x11, 0x00, 0xB9, 0x19, 0x01, 0x01, 0x23, 0x08, 0x74, 0x33, 0x33,
+	0xB3, 0x8E, 0x80, 0x98, 0x8B, 0xA1, 0x3A, 0x99, 0x77, 0x14, 0x98, 0xBB,
+	0xBC, 0x8A, 0x98, 0xBA, 0xCE, 0x8A, 0x00, 0xD8, 0xAA, 0xDE, 0xAB, 0x19,
+	0x01, 0x21, 0xE0, 0xAC, 0x08, 0x9B, 0x88, 0xAB, 0x88, 0x10, 0xC9, 0x72,
+	0x83, 0x9C, 0x21, 0x88, 0x72, 0x91, 0xBB, 0x19, 0x33, 0x62, 0x23, 0x33,
+	0x13, 0xE9, 0x0B, 0x22, 0x33, 0x04, 0x00, 0x46, 0x34, 0x91, 0xA9, 0x78,
+	0x12, 0x10, 0x02, 0xAA, 0x30, 0x22, 0x71, 0x45, 0x80, 0x98, 0xAA, 0x31,
+	0x13, 0xCB, 0x89, 0x89, 0x72, 0x12, 0x89, 0x10, 0xD8, 0x9C, 0xA9, 0x9A,
+	0xDD, 0x9C, 0x30, 0x83, 0xDC, 0xDB, 0xAB, 0x31, 0x13, 0xAA, 0xBA, 0xBB,
+	0xCC, 0x9B, 0x10, 0x11, 0xCA, 0x1A, 0x42, 0x55, 0x91, 0xBD, 0x0A, 0x43,
+	0x81, 0x89, 0x98, 0x19, 0x46, 0x13, 0x12, 0x80, 0xF8, 0x0B, 0x43, 0x33,
+	0xA8, 0xA9, 0x51, 0x33, 0x23, 0x81, 0x20, 0x46, 0xA0, 0x1A, 0x32, 0x25,
+	0x21, 0x42, 0x33, 0x12, 0xCB, 0x29, 0x45, 0x14, 0xEB, 0x8A, 0x12, 0x12,
+	0xB9, 0x0B, 0x44, 0x81, 0xBA, 0xCC, 0x99, 0xB8, 0xDF, 0x0A, 0x22, 0x81,
+	0xFB, 0xBC, 0x0A, 0x81, 0x09, 0xB1, 0xBB, 0x21, 0xEB, 0xAA, 0x08, 0xC8,
+	0x1B, 0x92, 0x1B, 0x57, 0xB8, 0x8B, 0x00, 0x31, 0x53, 0xE9, 0x0A, 0x11,
+	0x19, 0x27, 0x98, 0x41, 0x03, 0x9A, 0x11, 0x90, 0x2B, 0x35, 0x18, 0x36,
+	0x92, 0x39, 0x37, 0x11, 0x80, 0x99, 0x8D, 0x35, 0x80, 0x21, 0x03, 0x30,
+	0x24, 0x10, 0x22, 0xA3, 0xDD, 0x9A, 0x32, 0x02, 0xA9, 0xAD, 0x73, 0x14,
+	0x98, 0x99, 0xDA, 0xBB, 0xDC, 0x8B, 0x33, 0xA8, 0xFB, 0xAD, 0x09, 0x14,
+	0xA9, 0x80, 0xAC, 0x10, 0xB9, 0xAC, 0x10, 0x80, 0xAA, 0x89, 0x20, 0x21,
+	0xFB, 0x0F, 0x01, 0x41, 0xD8, 0x8C, 0x10, 0x21, 0x11, 0xB0, 0x2B, 0x36,
+	0x88, 0x20, 0x14, 0x99, 0x82, 0xCA, 0x73, 0x04, 0x88, 0x20, 0x25, 0x32,
+	0xB2, 0x8B, 0x41, 0x24, 0x32, 0x84, 0x18, 0x81, 0x0A, 0x33, 0x57, 0x00,
+	0x99, 0x0B, 0x13, 0x00, 0xA8, 0x9D, 0x54, 0x23, 0x91, 0xAA, 0xCB, 0xF9,
+	0xAC, 0x18, 0x00, 0xAA, 0xEF, 0x9B, 0x10, 0x12, 0x88, 0xA8, 0xAC, 0x10,
+	0xD9, 0x9B, 0x8A, 0x00, 0xAB, 0xCB, 0x38, 0x13, 0xDF, 0x19, 0x01, 0x43,
+	0xD1, 0xAD, 0x19, 0x21, 0x90, 0x09, 0x21, 0x44, 0x83, 0xAA, 0x30, 0x52,
+	0x14, 0x99, 0x20, 0x81, 0x81, 0x2B, 0x77, 0x16, 0x80, 0x98, 0x19, 0x43,
+	0x22, 0x00, 0x88, 0x98, 0x20, 0x02, 0x21, 0x25, 0x00, 0x11, 0x81, 0x53,
+	0xE1, 0x9C, 0x22, 0x52, 0x14, 0x90, 0xBB, 0xAA, 0x99, 0x08, 0x12, 0xFA,
+	0xDF, 0xAC, 0x88, 0x20, 0x91, 0xC8, 0xAE, 0x10, 0x98, 0xA9, 0x99, 0x99,
+	0xAA, 0x88, 0xA9, 0x89, 0xB2, 0xEF, 0x19, 0x33, 0xC0, 0xAD, 0xA9, 0x0A,
+	0x23, 0x90, 0x9B, 0x65, 0x02, 0x18, 0x13, 0x10, 0x12, 0x89, 0x00, 0x34,
+	0x71, 0x34, 0x33, 0x53, 0x04, 0xA9, 0x61, 0x13, 0x32, 0x24, 0xC9, 0x18,
+	0x02, 0x58, 0x26, 0x01, 0x18, 0x02, 0x29, 0x04, 0xA9, 0x31, 0x12, 0x62,
+	0x03, 0xA9, 0x22, 0x90, 0xAC, 0x18, 0xCB, 0xAA, 0xFF, 0xAE, 0x99, 0x9C,
+	0x10, 0x80, 0x9A, 0x98, 0xCD, 0x19, 0x81, 0xAB, 0x99, 0xD9, 0xAC, 0x9A,
+	0x8B, 0xA9, 0xDC, 0x88, 0x11, 0x22, 0x92, 0xCF, 0x88, 0x00, 0x80, 0x89,
+	0x00, 0x01, 0xAA, 0x60, 0x80, 0x47, 0x14, 0xB8, 0x40, 0x02, 0x20, 0x13,
+	0x52, 0x13, 0x90, 0x38, 0x27, 0x54, 0x23, 0x91, 0x18, 0x14, 0x89, 0x32,
+	0x12, 0x38, 0x12, 0xC9, 0x49, 0x25, 0x03, 0x29, 0x37, 0x22, 0xA0, 0x99,
+	0xA0, 0x09, 0xA1, 0xDB, 0xBD, 0xCA, 0xBF, 0xAA, 0xA8, 0xEB, 0x08, 0xC9,
+	0x19, 0xA8, 0xBF, 0x89, 0x98, 0x99, 0x98, 0xBE, 0xAA, 0xC8, 0x8A, 0xB0,
+	0xAC, 0x31, 0xE9, 0x1A, 0x91, 0xBF, 0x10, 0xB1, 0x2B, 0x14, 0xAA, 0x20,
+	0x93, 0x69, 0x35, 0x11, 0x02, 0x98, 0x20, 0x26, 0x10, 0x54, 0x33, 0x12,
+	0x88, 0x52, 0x14, 0x63, 0x33, 0x98, 0x38, 0x04, 0x89, 0x53, 0x12, 0x31,
+	0x02, 0x38, 0x34, 0x31, 0x44, 0x00, 0x51, 0x14, 0xB9, 0xB9, 0xA9, 0xDB,
+	0x18, 0xC0, 0x9C, 0xFC, 0x9B, 0xAB, 0x10, 0x01, 0xDA, 0xAB, 0xBB, 0xCA,
+	0xBB, 0x9B, 0xDD, 0x9B, 0xCB, 0xBC, 0x0A, 0xB8, 0x8D, 0x89, 0x88, 0x99,
+	0xD9, 0x9D, 0x12, 0xBA, 0x11, 0xA2, 0xAC, 0x20, 0x09, 0x37, 0x34, 0x98,
+	0x20, 0x63, 0x24, 0x18, 0x63, 0x12, 0x24, 0x81, 0x09, 0x54, 0x82, 0x20,
+	0x26, 0x08, 0x22, 0xB0, 0x5A, 0x16, 0x80, 0x11, 0x10, 0x30, 0x14, 0x89,
+	0x44, 0x13, 0x10, 0x11, 0x29, 0x35, 0xC0, 0x8B, 0x08, 0xEA, 0x9B, 0xBA,
+	0xCD, 0xBC, 0xCB, 0x9B, 0x31, 0xA2, 0xBF, 0x8B, 0x81, 0x8A, 0x98, 0xBC,
+	0x99, 0xFC, 0xAC, 0xA9, 0x88, 0x91, 0xCE, 0x19, 0x14, 0xA9, 0x89, 0xA9,
+	0x30, 0x84, 0xEB, 0x09, 0x80, 0xA0, 0x9A, 0x61, 0x35, 0x81, 0x09, 0x08,
+	0x72, 0x03, 0xA9, 0x61, 0x03, 0x10, 0x81, 0x39, 0x47, 0x11, 0x31, 0x22,
+	0x21, 0x23, 0x99, 0x73, 0x04, 0x80, 0x01, 0x08, 0x43, 0x81, 0x21, 0x42,
+	0x23, 0x10, 0x11, 0x01, 0xD8, 0xAD, 0xA8, 0x9B, 0x98, 0xFF, 0xAB, 0xA9,
+	0xAD, 0x11, 0xA1, 0xAC, 0xA9, 0xCE, 0x19, 0x90, 0xBC, 0x0A, 0xCA, 0x9B,
+	0xBA, 0xBB, 0xC8, 0xBD, 0x19, 0xB8, 0x0C, 0x81, 0xBF, 0x28, 0xA2, 0x9C,
+	0xA0, 0x9C, 0x33, 0xA0, 0x50, 0x23, 0x50, 0x14, 0x09, 0x55, 0x81, 0x08,
+	0x22, 0x01, 0x46, 0x81, 0x09, 0x52, 0x12, 0x43, 0x81, 0x30, 0x13, 0x00,
+	0x72, 0x22, 0x11, 0x83, 0x8B, 0x74, 0x12, 0x21, 0x00, 0x31, 0x35, 0x00,
+	0x81, 0x09, 0x41, 0xB9, 0xBC, 0x9C, 0xA8, 0xFC, 0xAC, 0xAA, 0x9B, 0xA9,
+	0x9A, 0xEA, 0x89, 0x91, 0xBC, 0x89, 0x98, 0xFB, 0xCB, 0xBB, 0xEA, 0x99,
+	0xB9, 0xBC, 0x8A, 0x99, 0xAA, 0xA8, 0xAB, 0x10, 0xDA, 0xAD, 0xA0, 0x8B,
+	0x02, 0xAF, 0x50, 0x14, 0x00, 0x32, 0x81, 0x71, 0x23, 0x00, 0x51, 0x12,
+	0x31, 0x34, 0x41, 0x26, 0x01, 0x53, 0x12, 0x43, 0x04, 0x08, 0x32, 0x82,
+	0x30, 0x83, 0x21, 0x53, 0x00, 0x70, 0x13, 0x31, 0x15, 0x81, 0x62, 0x92,
+	0x99, 0x00, 0xBA, 0xB9, 0xBB, 0xDF, 0xAB, 0xCA, 0xAB, 0x19, 0x92, 0xAB,
+	0xCA, 0xAD, 0x9C, 0x90, 0xEC, 0x9A, 0xCA, 0xCB, 0x9A, 0xBB, 0x9A, 0xCD,
+	0x89, 0x81, 0x89, 0x99, 0xC8, 0x8C, 0x08, 0x88, 0x98, 0xBB, 0xC9, 0x0A,
+	0x71, 0x17, 0x21, 0x18, 0x11, 0x42, 0x22, 0x00, 0x34, 0x41, 0x26, 0x90,
+	0x40, 0x15, 0x21, 0x63, 0x02, 0x10, 0x21, 0x80, 0x21, 0x14, 0x01, 0x08,
+	0x38, 0x35, 0x52, 0x33, 0x22, 0x35, 0x34, 0x23, 0x91, 0x40, 0xA2, 0xAB,
+	0x90, 0xCF, 0x09, 0xD9, 0xBD, 0x9A, 0xB9, 0x89, 0xA0, 0xAE, 0x99, 0xA9,
+	0xAB, 0x9B, 0x90, 0xBE, 0xBF, 0xAC, 0xB9, 0xBA, 0xCB, 0xBC, 0x9A, 0xBA,
+	0xA9, 0xAD, 0x88, 0x91, 0xBB, 0x98, 0x30, 0x10, 0xA8, 0xEF, 0x39, 0x24,
+	0x90, 0x32, 0x21, 0x53, 0x21, 0x56, 0x11, 0x42, 0x82, 0x11, 0x46, 0x13,
+	0x22, 0x22, 0x44, 0x22, 0x23, 0x23, 0x82, 0x53, 0x04, 0x19, 0x35, 0x91,
+	0x18, 0x14, 0x38, 0x35, 0x21, 0x32, 0x11, 0x34, 0x81, 0xAD, 0x21, 0xDC,
+	0x8B, 0x98, 0xEC, 0xBB, 0xCB, 0xAC, 0x18, 0xB1, 0xBE, 0x8A, 0xA8, 0xBB,
+	0x99, 0xDE, 0x8A, 0xB9, 0xCC, 0xAA, 0x9A, 0xBA, 0xBD, 0x1A, 0x81, 0xCA,
+	0x9A, 0xAA, 0x68, 0x23, 0xCA, 0x29, 0x12, 0xA9, 0x9A, 0x42, 0x44, 0x23,
+	0xB8, 0x4A, 0x57, 0x81, 0x00, 0x21, 0x26, 0x13, 0x10, 0x42, 0x32, 0x24,
+	0x01, 0x40, 0x35, 0x82, 0x09, 0x43, 0x12, 0x12, 0x11, 0x20, 0x56, 0x02,
+	0x18, 0x52, 0x14, 0x11, 0x21, 0x33, 0x13, 0x91, 0xAA, 0x90, 0xEA, 0xC8,
+	0xCD, 0xBC, 0xA9, 0xBF, 0x89, 0x92, 0xBC, 0x89, 0xBA, 0x8C, 0x01, 0xCC,
+	0xAA, 0xCA, 0xCC, 0x99, 0xBC, 0x9A, 0xDB, 0x9B, 0x08, 0xCA, 0x09, 0xA9,
+	0xAA, 0x42, 0x90, 0x98, 0x01, 0xBD, 0xDB, 0x21, 0x83, 0x0A, 0x17, 0x18,
+	0x63, 0x02, 0x41, 0x24, 0x23, 0x32, 0x34, 0x24, 0x54, 0x02, 0x32, 0x26,
+	0x81, 0x32, 0x81, 0x61, 0x23, 0x88, 0x30, 0x84, 0x01, 0x12, 0x30, 0x34,
+	0x24, 0x31, 0x25, 0x32, 0x03, 0x89, 0x11, 0x10, 0xD8, 0xBE, 0x0B, 0xE1,
+	0x9C, 0xBA, 0xCF, 0x09, 0xA8, 0xBB, 0x9A, 0xEC, 0x9B, 0x88, 0xCB, 0x99,
+	0xB8, 0xBD, 0xAA, 0xB9, 0xBA, 0xC9, 0x9C, 0xAA, 0xAB, 0x80, 0xFB, 0x0B,
+	0x02, 0x90, 0x89, 0x9A, 0xA8, 0x1B, 0x47, 0x21, 0x46, 0x14, 0x80, 0x42,
+	0x03, 0x40, 0x23, 0x90, 0x58, 0x24, 0x18, 0x53, 0x43, 0x22, 0x33, 0x23,
+	0x42, 0x11, 0x33, 0x12, 0x80, 0x71, 0xA2, 0x40, 0x33, 0x22, 0x74, 0x23,
+	0x38, 0x44, 0x11, 0x11, 0x13, 0x01, 0x11, 0xCA, 0xCD, 0xAC, 0x98, 0xDC,
+	0xAB, 0xBC, 0x9C, 0x80, 0xBB, 0x0B, 0xC9, 0xAD, 0x00, 0xB8, 0x8B, 0xC8,
+	0xBF, 0xAA, 0xCA, 0xBB, 0xDB, 0xBB, 0x9B, 0xA8, 0x8B, 0x01, 0xC8, 0x2A,
+	0x23, 0x40, 0x81, 0x9A, 0xEC, 0x89, 0x22, 0x20, 0x34, 0x11, 0x47, 0x14,
+	0x31, 0x35, 0x23, 0x20, 0x45, 0x12, 0x53, 0x12, 0x11, 0x52, 0x24, 0x11,
+	0x03, 0x11, 0x20, 0x24, 0x11, 0x10, 0x53, 0x10, 0x36, 0x90, 0x42, 0x24,
+	0x00, 0x37, 0x80, 0x30, 0x82, 0x9D, 0x40, 0xC8, 0xAB, 0xCB, 0xAA, 0xA9,
+	0xBE, 0xBD, 0x0A, 0x00, 0xEB, 0x8A, 0xA0, 0xBC, 0x08, 0x98, 0xBD, 0x1A,
+	0xD8, 0xAC, 0x0A, 0x80, 0xFB, 0x9B, 0x10, 0xA8, 0x99, 0x99, 0xCA, 0x2B,
+	0x45, 0x80, 0x08, 0xB0, 0x48, 0x24, 0x18, 0x35, 0x03, 0x8A, 0x72, 0x13,
+	0x18, 0x23, 0x28, 0x55, 0x11, 0x45, 0x02, 0x1A, 0x36, 0x82, 0x10, 0x22,
+	0xAA, 0x41, 0x82, 0x20, 0x24, 0x88, 0x24, 0x98, 0x64, 0x12, 0x30, 0x23,
+	0x30, 0x47, 0x88, 0x09, 0x81, 0x98, 0x80, 0xDE, 0x18, 0xE8, 0x9B, 0x90,
+	0xBF, 0x18, 0xA2, 0x9D, 0x08, 0xA9, 0x99, 0x99, 0x98, 0xAD, 0x89, 0xFB,
+	0x8A, 0x99, 0xA9, 0xCB, 0x0A, 0xA8, 0x8A, 0x80, 0xCA, 0x39, 0x15, 0xAA,
+	0x08, 0x61, 0xA0, 0x9B, 0x61, 0x03, 0x39, 0x27, 0x00, 0x21, 0x36, 0x99,
+	0x33, 0x24, 0x13, 0x43, 0x34, 0x25, 0x12, 0x33, 0x12, 0x52, 0x24, 0x90,
+	0x30, 0x03, 0x89, 0x20, 0x09, 0x25, 0x60, 0x44, 0x80, 0x61, 0x12, 0x20,
+	0x53, 0x82, 0x10, 0x91, 0x8A, 0xB8, 0xBA, 0xDE, 0x9C, 0xAB, 0xBB, 0xAF,
+	0xBB, 0xAA, 0xAA, 0xB8, 0xBF, 0xA8, 0x9A, 0xCA, 0x89, 0xA8, 0xAC, 0x99,
+	0xDC, 0x9A, 0xA8, 0xAB, 0xBC, 0x29, 0xB8, 0x0C, 0xD8, 0x1A, 0x98, 0x61,
+	0x33, 0xB0, 0x19, 0xD0, 0x28, 0x50, 0x26, 0x01, 0x11, 0x23, 0x54, 0x32,
+	0x44, 0x02, 0x39, 0x65, 0x01, 0x11, 0x00, 0x01, 0x21, 0x25, 0x90, 0x28,
+	0x82, 0x0A, 0x43, 0x24, 0x31, 0x22, 0x31, 0x54, 0x34, 0x22, 0x33, 0x39,
+	0x47, 0x10, 0x10, 0xC0, 0xB9, 0x88, 0xCD, 0xAB, 0xAA, 0xBE, 0xCC, 0xBC,
+	0x9C, 0x88, 0x98, 0xA9, 0xAE, 0x8A, 0xA8, 0x9A, 0x08, 0xA8, 0x9E, 0xBB,
+	0xEB, 0x2A, 0xA1, 0xAD, 0x09, 0xAA, 0x40, 0xB3, 0x0F, 0x02, 0x88, 0x53,
+	0x98, 0x20, 0x83, 0x20, 0x90, 0x46, 0x11, 0x32, 0x82, 0x30, 0x67, 0x01,
+	0x21, 0x80, 0x31, 0x44, 0x23, 0x00, 0x44, 0x22, 0x80, 0x20, 0x81, 0x59,
+	0x13, 0xFB, 0x39, 0x02, 0x9B, 0x11, 0x09, 0x65, 0x83, 0x08, 0x81, 0x61,
+	0x24, 0x12, 0x01, 0x10, 0x98, 0xEA, 0xDB, 0xBC, 0xAC, 0xCA, 0xCB, 0xBB,
+	0xAA, 0x8A, 0x80, 0x90, 0xDB, 0x9A, 0xCA, 0x8C, 0x00, 0x09, 0xCB, 0xBC,
+	0x9F, 0x08, 0x98, 0x9A, 0xB8, 0x8C, 0x25, 0x91, 0x62, 0x81, 0x39, 0x27,
+	0xA0, 0x08, 0xA0, 0x99, 0x62, 0x23, 0x10, 0x23, 0xC8, 0x58, 0x36, 0x32,
+	0x12, 0x80, 0x41, 0x43, 0x43, 0x82, 0x8A, 0x02, 0x8A, 0x10, 0x32, 0x80,
+	0x11, 0xA2, 0x92, 0xDE, 0x99, 0xBD, 0x2B, 0x47, 0xA1, 0x20, 0xA2, 0x0A,
+	0x55, 0x13, 0x81, 0x80, 0x79, 0x27, 0x9A, 0xAC, 0xBB, 0xAB, 0xDB, 0xBD,
+	0x9A, 0x99, 0x9A, 0x90, 0xA9, 0xB9, 0x9C, 0x28, 0x01, 0x11, 0xF9, 0xBC,
+	0x89, 0x11, 0x83, 0x32, 0xF8, 0x5A, 0x25, 0x81, 0x10, 0x80, 0x61, 0x02,
+	0x41, 0x91, 0x98, 0x41, 0x11, 0x45, 0x13, 0x90, 0x9B, 0x74, 0x22, 0x33,
+	0x83, 0x9A, 0x30, 0x23, 0x35, 0x23, 0xC9, 0x0A, 0x03, 0xAD, 0x90, 0xAC,
+	0x88, 0x90, 0x98, 0xED, 0x9C, 0x99, 0x38, 0x33, 0x02, 0xDA, 0x8A, 0x45,
+	0x13, 0x31, 0x12, 0xBA, 0x99, 0xFB, 0xDE, 0x9C, 0x99, 0xCC, 0x89, 0xFB,
+	0x9B, 0x88, 0x8B, 0x32, 0xCA, 0x8B, 0x80, 0x31, 0x44, 0x00, 0x99, 0x28,
+	0x63, 0x14, 0x80, 0x89, 0x11, 0x52, 0x53, 0x11, 0xB8, 0x2A, 0x83, 0x71,
+	0x16, 0xA8, 0x08, 0x00, 0x62, 0x02, 0x00, 0x00, 0x11, 0x32, 0x25, 0x11,
+	0x24, 0x31, 0x93, 0x53, 0x01, 0x32, 0x00, 0x24, 0x51, 0xC0, 0xAC, 0x8A,
+	0x00, 0x90, 0xBD, 0xDF, 0x9A, 0x09, 0x81, 0x99, 0x99, 0x0A, 0xA8, 0x38,
+	0x05, 0x99, 0x82, 0xBC, 0xAD, 0xBA, 0xCD, 0xBD, 0xBF, 0x99, 0xBA, 0xAE,
+	0xAA, 0xCB, 0x19, 0xA0, 0xAB, 0xB9, 0x0A, 0x74, 0x22, 0x00, 0x21, 0x42,
+	0x33, 0x34, 0x04, 0x30, 0x34, 0x81, 0x30, 0x05, 0x08, 0x21, 0x98, 0x75,
+	0x93, 0x19, 0x01, 0x00, 0x55, 0x81, 0x00, 0x88, 0x31, 0x11, 0x31, 0x37,
+	0x01, 0x01, 0x9A, 0x40, 0x37, 0x02, 0x81, 0xA8, 0x89, 0x13, 0xBB, 0x20,
+	0xBB, 0xFB, 0xBF, 0xAB, 0x09, 0x88, 0xDB, 0x1A, 0x80, 0x89, 0x32, 0xCB,
+	0x72, 0x07, 0xA8, 0x99, 0xC9, 0xDC, 0xBB, 0xBA, 0xBD, 0xDB, 0xCD, 0x8A,
+	0x99, 0x89, 0x98, 0xAA, 0x20, 0x24, 0x24, 0x34, 0x21, 0x25, 0x33, 0x32,
+	0x15, 0x18, 0x81, 0x18, 0x15, 0x00, 0x02, 0xEB, 0x50, 0x14, 0x20, 0x03,
+	0x0A, 0x24, 0x18, 0x34, 0xA1, 0x29, 0xF9, 0x09, 0x90, 0x10, 0x00, 0x98,
+	0x73, 0x02, 0x01, 0x0A, 0x44, 0x54, 0x11, 0x04, 0xCB, 0x19, 0x00, 0x21,
+	0x13, 0xDD, 0x9A, 0xBB, 0x19, 0x82, 0xDC, 0xA9, 0x9A, 0x21, 0xAA, 0xB9,
+	0xCD, 0x29, 0x92, 0xAD, 0xFB, 0xAC, 0xBA, 0xBD, 0x9A, 0xEC, 0xBA, 0xBA,
+	0xAB, 0x08, 0xA9, 0x20, 0x32, 0x46, 0x43, 0x14, 0x42, 0x44, 0x21, 0x12,
+	0x01, 0x28, 0x82, 0x28, 0x82, 0xAA, 0x00, 0xAA, 0x62, 0x51, 0x15, 0x98,
+	0x28, 0x02, 0x60, 0x04, 0x9B, 0xA8, 0x89, 0xAA, 0x88, 0x89, 0x32, 0x25,
+	0xEC, 0x28, 0x32, 0x45, 0x33, 0x90, 0x08, 0x11, 0x01, 0x00, 0xA1, 0x9E,
+	0xC8, 0xBE, 0x8A, 0xA0, 0x9B, 0x99, 0x89, 0x73, 0x14, 0xB8, 0x19, 0x26,
+	0x21, 0x92, 0xDE, 0xBB, 0xDD, 0xAA, 0xC9, 0xAD, 0xCB, 0xCB, 0x9A, 0x8A,
+	0x80, 0xA9, 0x20, 0x52, 0x44, 0x23, 0x33, 0x35, 0x33, 0x42, 0x02, 0x10,
+	0x81, 0x10, 0x91, 0x19, 0x03, 0xAF, 0x42, 0x21, 0x45, 0x01, 0x10, 0x28,
+	0x23, 0x00, 0xDA, 0x8B, 0x09, 0xEB, 0xBD, 0x9C, 0x98, 0x28, 0x33, 0x82,
+	0xB8, 0x41, 0x51, 0x47, 0x33, 0x82, 0xA8, 0x9A, 0x32, 0x12, 0xC1, 0xCD,
+	0xAA, 0xAA, 0x9A, 0xCA, 0xAC, 0x21, 0x82, 0x71, 0x02, 0x99, 0x08, 0x21,
+	0x33, 0xF8, 0xBF, 0xBD, 0xAB, 0xCA, 0xCC, 0xEB, 0xAB, 0x98, 0xA9, 0x08,
+	0x99, 0x38, 0x36, 0x53, 0x33, 0x33, 0x34, 0x35, 0x11, 0x22, 0x01, 0x89,
+	0x08, 0xAA, 0x18, 0x91, 0xBD, 0x38, 0x34, 0x45, 0x02, 0x08, 0x42, 0x14,
+	0x98, 0xCB, 0xBB, 0x09, 0xE8, 0xBE, 0x9A, 0x89, 0x20, 0x13, 0x99, 0x22,
+	0x51, 0x45, 0x35, 0x21, 0x81, 0x9B, 0x00, 0x43, 0x82, 0xDC, 0xAB, 0x9A,
+	0x18, 0x90, 0xAC, 0x9A, 0x11, 0x64, 0x81, 0x08, 0xA9, 0xA8, 0x28, 0xD0,
+	0xDF, 0xCA, 0xAC, 0x9A, 0xCB, 0xCB, 0xCC, 0xAB, 0xAA, 0xCB, 0x19, 0x98,
+	0x39, 0x16, 0x20, 0x36, 0x23, 0x45, 0x12, 0x32, 0x23, 0x11, 0x12, 0x80,
+	0x10, 0x02, 0xAC, 0x02, 0xAD, 0x31, 0xB8, 0x71, 0x82, 0x08, 0x92, 0xAF,
+	0x11, 0xAA, 0x01, 0xEC, 0x99, 0xC9, 0x09, 0x80, 0x30, 0x03, 0xAA, 0x43,
+	0x18, 0x77, 0x12, 0x01, 0x80, 0x11, 0x00, 0x22, 0x89, 0x98, 0xAB, 0x9D,
+	0xD9, 0x9C, 0x99, 0x9B, 0x81, 0x1B, 0x05, 0xCB, 0x88, 0xDA, 0x19, 0xB0,
+	0xCF, 0xFB, 0x9C, 0x99, 0xBB, 0xCB, 0xBF, 0xAB, 0xA9, 0x89, 0x80, 0x8A,
+	0x42, 0x33, 0x56, 0x43, 0x33, 0x24, 0x33, 0x32, 0x22, 0x23, 0x90, 0x9A,
+	0x98, 0x99, 0xEA, 0xBB, 0xBA, 0x29, 0x44, 0x22, 0x03, 0xAA, 0x31, 0xDA,
+	0x19, 0xB1, 0xDF, 0xBB, 0xBC, 0xCA, 0x8A, 0x11, 0x21, 0x12, 0x09, 0x72,
+	0x24, 0x65, 0x12, 0x10, 0x11, 0x19, 0x00, 0x08, 0x14, 0xC9, 0xBB, 0xCD,
+	0x8A, 0xA8, 0x9A, 0xC9, 0x09, 0x13, 0x99, 0x9A, 0x10, 0x52, 0x83, 0x0A,
+	0xFB, 0xEF, 0xBA, 0xBA, 0xBC, 0xEB, 0xBC, 0xCB, 0xAA, 0x98, 0x89, 0x01,
+	0x31, 0x27, 0x43, 0x35, 0x33, 0x34, 0x23, 0x33, 0x23, 0x80, 0xA8, 0x8A,
+	0x88, 0x9A, 0xEE, 0xAA, 0x89, 0x00, 0x32, 0x22, 0x21, 0x10, 0xB1, 0x58,
+	0xA1, 0xBD, 0xCD, 0xAB, 0xA9, 0xDC, 0xAC, 0x08, 0x23, 0x24, 0x88, 0x20,
+	0x62, 0x36, 0x03, 0x21, 0x12, 0x18, 0x90, 0x19, 0x01, 0xCB, 0xBF, 0xAB,
+	0xAA, 0xA9, 0xB9, 0xBD, 0x28, 0x34, 0x00, 0x90, 0x9B, 0x22, 0x20, 0xD8,
+	0xDF, 0xCE, 0xBB, 0xBA, 0xCC, 0xBA, 0xCF, 0x9A, 0x89, 0x08, 0x00, 0x08,
+	0x33, 0x44, 0x46, 0x23, 0x32, 0x33, 0x33, 0x23, 0x22, 0x81, 0xCB, 0xAB,
+	0x99, 0xB9, 0xAD, 0xBC, 0xBC, 0x28, 0x25, 0x23, 0x80, 0x99, 0x08, 0x32,
+	0xA8, 0xFD, 0xAD, 0x99, 0x99, 0xBB, 0xBB, 0x19, 0x53, 0x53, 0x23, 0x10,
+	0x45, 0x43, 0x34, 0x22, 0x11, 0x98, 0x99, 0x20, 0x00, 0xD8, 0xBF, 0xAB,
+	0xAB, 0x00, 0xA9, 0x9C, 0x88, 0x30, 0x33, 0x11, 0xD0, 0xAC, 0xA8, 0xBB,
+	0xFE, 0xBE, 0xCB, 0xBC, 0xAB, 0xEA, 0xAC, 0x99, 0xAA, 0x11, 0x00, 0x34,
+	0x33, 0x57, 0x23, 0x43, 0x13, 0x32, 0x22, 0x22, 0x02, 0xA8, 0xCA, 0xAC,
+	0xAA, 0x9A, 0xC9, 0xAC, 0x99, 0x28, 0x43, 0x12, 0x00, 0xBA, 0x29, 0xA2,
+	0xBC, 0xFF, 0x9B, 0xA9, 0x9A, 0x98, 0xBB, 0x32, 0x53, 0x37, 0x01, 0x52,
+	0x22, 0x44, 0x21, 0x32, 0x81, 0x0A, 0xA8, 0x0A, 0x80, 0xCD, 0xCD, 0xBB,
+	0x99, 0x99, 0xB9, 0x9C, 0x08, 0x00, 0x22, 0x82, 0x08, 0x91, 0x29, 0x02,
+	0xEF, 0xDC, 0xCC, 0x9A, 0xB9, 0xBB, 0xDE, 0xAC, 0xAA, 0x8A, 0x11, 0x00,
+	0x10, 0x52, 0x54, 0x35, 0x33, 0x43, 0x22, 0x42, 0x12, 0x12, 0x90, 0xA9,
+	0xBB, 0x9A, 0xCA, 0xCD, 0xBC, 0x9A, 0x19, 0x32, 0x90, 0xAA, 0x9A, 0x63,
+	0x22, 0x12, 0xDA, 0xBB, 0x9A, 0x09, 0xCB, 0xBC, 0x19, 0x33, 0x47, 0x02,
+	0x19, 0x54, 0x53, 0x34, 0x02, 0x80, 0x88, 0x11, 0x32, 0x92, 0xED, 0xDB,
+	0xAA, 0x08, 0x98, 0xBB, 0xAC, 0x89, 0x31, 0x14, 0x80, 0x98, 0x39, 0x14,
+	0x80, 0xFC, 0xCF, 0xAB, 0xAA, 0xBC, 0xBD, 0xAC, 0xAB, 0x09, 0x00, 0x31,
+	0x34, 0x37, 0x25, 0x24, 0x24, 0x22, 0x12, 0x32, 0x00, 0x01, 0xEA, 0x9A,
+	0xCA, 0x8A, 0xCA, 0xAB, 0x99, 0x09, 0x12, 0x31, 0x14, 0x01, 0x31, 0x13,
+	0x10, 0xF8, 0xBE, 0xBA, 0xAB, 0x99, 0xCC, 0xAB, 0x18, 0x45, 0x43, 0x22,
+	0x31, 0x36, 0x53, 0x34, 0x00, 0x00, 0x98, 0x09, 0x98, 0xA8, 0xDE, 0xCB,
+	0xAB, 0x99, 0x88, 0xAA, 0xAA, 0x1A, 0x63, 0x12, 0x01, 0x00, 0x18, 0x12,
+	0xA8, 0xDF, 0xCD, 0xBB, 0xBA, 0xCB, 0xCD, 0xAC, 0xAA, 0x18, 0x10, 0x33,
+	0x33, 0x65, 0x34, 0x52, 0x33, 0x32, 0x23, 0x01, 0x22, 0x90, 0xBA, 0xFB,
+	0xBB, 0xAA, 0xBB, 0xBC, 0xDB, 0x8A, 0x21, 0x32, 0x12, 0x82, 0x9A, 0x31,
+	0x32, 0x81, 0xEF, 0xBB, 0xBC, 0x8A, 0x90, 0x89, 0x89, 0x73, 0x35, 0x34,
+	0x23, 0x23, 0x54, 0x43, 0x32, 0x00, 0x99, 0xB9, 0x9B, 0xA9, 0xBE, 0xCD,
+	0xBC, 0xAA, 0x8A, 0x88, 0xA9, 0xAA, 0x30, 0x63, 0x23, 0x82, 0x00, 0x31,
+	0x25, 0x88, 0xDD, 0xBC, 0xDB, 0xAA, 0xCA, 0xCD, 0xBA, 0xAD, 0x09, 0x00,
+	0x31, 0x12, 0x40, 0x37, 0x53, 0x43, 0x22, 0x21, 0x22, 0x12, 0x01, 0xA8,
+	0xEB, 0xAB, 0xB9, 0xBB, 0xCC, 0xBC, 0xA9, 0x08, 0x22, 0x13, 0x80, 0x40,
+	0x02, 0x73, 0x12, 0xA9, 0xCB, 0xAC, 0x09, 0xB9, 0xB9, 0xBB, 0x40, 0x47,
+	0x42, 0x22, 0x31, 0x53, 0x35, 0x22, 0x13, 0xA8, 0x9A, 0xBB, 0x89, 0xD9,
+	0xCF, 0xBB, 0xBB, 0x8A, 0x98, 0xBA, 0xAB, 0x21, 0x43, 0x53, 0x02, 0x11,
+	0x10, 0x01, 0x88, 0xFD, 0xCF, 0x9A, 0xCC, 0x9A, 0xDB, 0x9A, 0x99, 0x19,
+	0x22, 0x42, 0x46, 0x23, 0x44, 0x33, 0x33, 0x33, 0x21, 0x12, 0x80, 0xBA,
+	0xCE, 0xBB, 0xAC, 0xBB, 0xAC, 0xAB, 0x8A, 0x18, 0x32, 0x12, 0x34, 0x23,
+	0x34, 0x22, 0x80, 0xDB, 0xDC, 0xBB, 0xCA, 0xAA, 0xB9, 0x9B, 0x53, 0x44,
+	0x45, 0x21, 0x42, 0x43, 0x43, 0x22, 0x11, 0x90, 0x9A, 0xCB, 0xBB, 0xDC,
+	0xDB, 0xCB, 0xAB, 0x99, 0x99, 0x99, 0x00, 0x31, 0x54, 0x33, 0x33, 0x22,
+	0x43, 0x12, 0x91, 0xFB, 0xCD, 0xCB, 0xBA, 0xDB, 0xBC, 0xAC, 0x99, 0x08,
+	0x21, 0x22, 0x44, 0x54, 0x43, 0x43, 0x32, 0x22, 0x22, 0x01, 0x81, 0xB9,
+	0xBC, 0xBE, 0xBB, 0xBB, 0xBC, 0xAA, 0xBB, 0x18, 0x43, 0x43, 0x23, 0x32,
+	0x34, 0x42, 0x03, 0xA9, 0xCD, 0xBA, 0xBD, 0xBA, 0xBA, 0xAA, 0x09, 0x72,
+	0x43, 0x44, 0x32, 0x43, 0x43, 0x34, 0x12, 0x11, 0x98, 0xBB, 0xDB, 0xCB,
+	0xDB, 0xCB, 0xAC, 0xAB, 0x9A, 0x88, 0x89, 0x21, 0x32, 0x55, 0x22, 0x23,
+	0x22, 0x22, 0x02, 0xB0, 0xCE, 0xCD, 0xCB, 0xBB, 0xCC, 0xCB, 0xBA, 0x89,
+	0x08, 0x31, 0x24, 0x54, 0x35, 0x33, 0x35, 0x22, 0x33, 0x21, 0x01, 0x90,
+	0xAA, 0xCD, 0xBC, 0xBB, 0xAC, 0xBA, 0xBB, 0x9A, 0x08, 0x43, 0x33, 0x43,
+	0x32, 0x35, 0x23, 0x02, 0xB9, 0xBD, 0xBC, 0xDB, 0xCB, 0xA9, 0x9A, 0x28,
+	0x32, 0x56, 0x43, 0x33, 0x34, 0x34, 0x34, 0x12, 0x01, 0x98, 0xDA, 0xCB,
+	0xCB, 0xDB, 0xAA, 0xBC, 0xAB, 0xAA, 0x88, 0x00, 0x21, 0x44, 0x43, 0x24,
+	0x22, 0x22, 0x22, 0x01, 0xDA, 0xCC, 0xBC, 0xBD, 0xBC, 0xCC, 0xAB, 0xAA,
+	0x89, 0x00, 0x41, 0x43, 0x45, 0x34, 0x43, 0x33, 0x33, 0x14, 0x12, 0x00,
+	0xA9, 0xBB, 0xDC, 0xAC, 0xBB, 0xAC, 0xAA, 0xAB, 0x88, 0x20, 0x43, 0x32,
+	0x33, 0x44, 0x25, 0x01, 0x81, 0xAB, 0xBA, 0xCC, 0xDB, 0xAC, 0x9A, 0x89,
+	0x11, 0x42, 0x44, 0x44, 0x42, 0x23, 0x43, 0x33, 0x11, 0x01, 0x98, 0xCB,
+	0xDD, 0xBB, 0xBC, 0xBA, 0xCB, 0xBB, 0xAB, 0x09, 0x21, 0x43, 0x34, 0x34,
+	0x34, 0x33, 0x23, 0x22, 0xB0, 0xDD, 0xCC, 0xAC, 0xCB, 0xCC, 0xAC, 0xAA,
+	0x09, 0x10, 0x20, 0x31, 0x65, 0x34, 0x43, 0x32, 0x42, 0x22, 0x21, 0x01,
+	0xA9, 0xCA, 0xCB, 0xBC, 0xAC, 0xBB, 0xBB, 0xCB, 0x89, 0x10, 0x43, 0x23,
+	0x22, 0x34, 0x35, 0x33, 0x80, 0xAA, 0xCB, 0xCA, 0xDB, 0xCC, 0xAB, 0x8A,
+	0x11, 0x31, 0x44, 0x43, 0x44, 0x43, 0x43, 0x32, 0x22, 0x00, 0x90, 0xAA,
+	0xFB, 0xBC, 0xBC, 0xCB, 0xAA, 0xBA, 0xBB, 0x9A, 0x10, 0x43, 0x44, 0x32,
+	0x24, 0x33, 0x34, 0x22, 0x02, 0xC9, 0xCC, 0xBC, 0xCC, 0xBA, 0xDD, 0xAB,
+	0xA9, 0x88, 0x11, 0x11, 0x33, 0x56, 0x34, 0x24, 0x23, 0x33, 0x22, 0x22,
+	0x81, 0xA9, 0xCD, 0xBB, 0xBD, 0xBB, 0xBB, 0xBC, 0xBA, 0x0A, 0x21, 0x45,
+	0x22, 0x22, 0x42, 0x53, 0x12, 0x80, 0xB9, 0xAA, 0xBC, 0xCC, 0xCC, 0xAA,
+	0x9A, 0x18, 0x32, 0x45, 0x33, 0x34, 0x35, 0x34, 0x43, 0x11, 0x00, 0x98,
+	0x9A, 0xCA, 0xCD, 0xCC, 0xBA, 0x9A, 0xAA, 0xA9, 0x9A, 0x88, 0x43, 0x35,
+	0x33, 0x43, 0x22, 0x23, 0x33, 0x01, 0xEB, 0xCD, 0xBC, 0xCB, 0xBA, 0xCD,
+	0xAB, 0xAA, 0x18, 0x22, 0x34, 0x34, 0x35, 0x45, 0x33, 0x33, 0x33, 0x21,
+	0x11, 0x98, 0xC9, 0xBD, 0xBD, 0xCB, 0xAA, 0xBA, 0xBA, 0xAB, 0x89, 0x42,
+	0x35, 0x23, 0x23, 0x42, 0x33, 0x23, 0x81, 0xCB, 0xCC, 0xBC, 0xCB, 0xBB,
+	0xAC, 0x9B, 0x28, 0x63, 0x44, 0x24, 0x23, 0x53, 0x33, 0x24, 0x12, 0x81,
+	0xA9, 0xAB, 0xDC, 0xBD, 0xBC, 0xBB, 0xBA, 0xAB, 0xBA, 0x9A, 0x20, 0x34,
+	0x45, 0x34, 0x33, 0x22, 0x32, 0x23, 0x01, 0xD9, 0xCE, 0xCB, 0xBB, 0xBC,
+	0xBE, 0xBA, 0x9A, 0x10, 0x21, 0x34, 0x44, 0x44, 0x43, 0x33, 0x24, 0x23,
+	0x12, 0x00, 0x99, 0xCA, 0xDB, 0xBC, 0xCB, 0xAB, 0xBA, 0xBB, 0xAA, 0x08,
+	0x43, 0x35, 0x33, 0x43, 0x33, 0x43, 0x12, 0x80, 0xBA, 0xCD, 0xBB, 0xBD,
+	0xBB, 0xCB, 0xAA, 0x18, 0x53, 0x34, 0x36, 0x32, 0x35, 0x33, 0x24, 0x02,
+	0x01, 0xA9, 0xAA, 0xDC, 0xCC, 0xCB, 0xAC, 0x9A, 0x9A, 0x99, 0x8A, 0x18,
+	0x42, 0x34, 0x34, 0x33, 0x24, 0x22, 0x12, 0x80, 0xDA, 0xCD, 0xDB, 0xAB,
+	0xDB, 0xAC, 0xAB, 0x8B, 0x20, 0x42, 0x24, 0x43, 0x54, 0x33, 0x34, 0x23,
+	0x23, 0x02, 0x81, 0xA9, 0xCC, 0xDB, 0xCB, 0xBB, 0xBB, 0xBB, 0xBB, 0xAB,
+	0x10, 0x44, 0x25, 0x33, 0x22, 0x43, 0x33, 0x13, 0x91, 0xCA, 0xCD, 0xBB,
+	0xDB, 0xAB, 0xAB, 0x8B, 0x10, 0x44, 0x34, 0x44, 0x44, 0x33, 0x43, 0x23,
+	0x11, 0x80, 0xA8, 0xBB, 0xBD, 0xCD, 0xBD, 0xBB, 0xAB, 0xAA, 0x9A, 0x89,
+	0x08, 0x44, 0x43, 0x43, 0x42, 0x23, 0x23, 0x12, 0x90, 0xDA, 0xCC, 0xBC,
+	0xBC, 0xBC, 0xDB, 0xBB, 0x8A, 0x18, 0x43, 0x34, 0x43, 0x44, 0x34, 0x43,
+	0x23, 0x22, 0x11, 0x00, 0xA8, 0xDB, 0xBC, 0xAD, 0xAC, 0xBA, 0xAA, 0xBA,
+	0x9A, 0x18, 0x42, 0x35, 0x33, 0x32, 0x43, 0x43, 0x12, 0x01, 0xBA, 0xCD,
+	0xBB, 0xBC, 0xCB, 0xBB, 0xAA, 0x08, 0x63, 0x43, 0x34, 0x53, 0x34, 0x33,
+	0x25, 0x11, 0x00, 0x99, 0xA9, 0xBC, 0xCC, 0xCC, 0xBB, 0xAC, 0x9A, 0x99,
+	0x89, 0x09, 0x41, 0x43, 0x34, 0x33, 0x33, 0x33, 0x33, 0x81, 0xD9, 0xCD,
+	0xCC, 0xAC, 0xCB, 0xBA, 0xBC, 0x9B, 0x08, 0x41, 0x35, 0x32, 0x35, 0x63,
+	0x33, 0x33, 0x33, 0x12, 0x00, 0x99, 0xDA, 0xCC, 0xBB, 0xBD, 0xBB, 0xBA,
+	0xAB, 0xAB, 0x88, 0x31, 0x55, 0x43, 0x12, 0x22, 0x23, 0x33, 0x12, 0xA8,
+	0xCE, 0xBB, 0xBC, 0xBC, 0xBA, 0xAB, 0x8A, 0x30, 0x45, 0x45, 0x33, 0x34,
+	0x34, 0x43, 0x23, 0x02, 0x90, 0xA9, 0xBB, 0xDD, 0xCC, 0xBB, 0xAB, 0xAC,
+	0xAA, 0xA9, 0x08, 0x21, 0x42, 0x53, 0x34, 0x33, 0x22, 0x22, 0x11, 0x90,
+	0xEB, 0xDD, 0xBB, 0xBC, 0xCB, 0xCB, 0xAB, 0xAA, 0x21, 0x34, 0x36, 0x33,
+	0x44, 0x24, 0x44, 0x12, 0x12, 0x01, 0x08, 0x99, 0xBB, 0xCD, 0xCB, 0xBB,
+	0xBB, 0xBB, 0xBB, 0x9A, 0x08, 0x42, 0x36, 0x34, 0x22, 0x21, 0x33, 0x43,
+	0x01, 0xCA, 0xCC, 0xBB, 0xCB, 0xCB, 0xBA, 0xAA, 0x08, 0x31, 0x46, 0x33,
+	0x45, 0x43, 0x24, 0x33, 0x22, 0x00, 0x00, 0x99, 0xCB, 0xBE, 0xBC, 0xBD,
+	0xAB, 0xAA, 0xAA, 0x9A, 0x89, 0x20, 0x45, 0x43, 0x22, 0x32, 0x24, 0x22,
+	0x01, 0xBA, 0xCD, 0xCB, 0xCB, 0xBC, 0xBD, 0xCA, 0xBA, 0x9A, 0x00, 0x53,
+	0x35, 0x33, 0x34, 0x34, 0x35, 0x33, 0x23, 0x02, 0x00, 0xA8, 0xEB, 0xBC,
+	0xCB, 0xCB, 0xBA, 0xBA, 0xBB, 0x9A, 0x89, 0x32, 0x45, 0x34, 0x23, 0x22,
+	0x32, 0x32, 0x22, 0xC8, 0xEC, 0xBB, 0xBB, 0xBD, 0xAB, 0xAB, 0x09, 0x41,
+	0x43, 0x35, 0x53, 0x34, 0x43, 0x43, 0x43, 0x01, 0x80, 0x98, 0x89, 0xCA,
+	0xCC, 0xCC, 0xAA, 0xAA, 0xAB, 0x9B, 0x99, 0x10, 0x32, 0x25, 0x33, 0x35,
+	0x23, 0x22, 0x22, 0x92, 0xDD, 0xDB, 0xBB, 0xAB, 0xBC, 0xBE, 0xAC, 0xAA,
+	0x9B, 0x08, 0x31, 0x67, 0x23, 0x32, 0x13, 0x63, 0x33, 0x33, 0x13, 0x08,
+	0x90, 0xCB, 0xEB, 0xAC, 0xAB, 0xBB, 0xCB, 0xBA, 0x9B, 0x8A, 0x18, 0x32,
+	0x47, 0x33, 0x21, 0x00, 0x20, 0x22, 0x02, 0xEA, 0xCD, 0xAA, 0xBA, 0xBB,
+	0xCB, 0x89, 0x20, 0x35, 0x43, 0x44, 0x33, 0x35, 0x43, 0x43, 0x12, 0x00,
+	0x98, 0xAA, 0x09, 0xB0, 0xDF, 0xBB, 0xAC, 0x88, 0x89, 0xA8, 0xAC, 0x10,
+	0x32, 0x13, 0x21, 0x22, 0x80, 0x10, 0xA0, 0xBA, 0xFF, 0xCC, 0xAA, 0x09,
+	0x90, 0xEB, 0xBC, 0x9B, 0x10, 0xA9, 0x89, 0x0A, 0x77, 0x16, 0x11, 0x80,
+	0x21, 0x24, 0x43, 0x01, 0x08, 0x00, 0x99, 0xAA, 0xBB, 0xBC, 0xAD, 0xCB,
+	0xAB, 0xAA, 0xA9, 0xBB, 0x0A, 0x55, 0x33, 0x01, 0xBA, 0x0B, 0x54, 0x23,
+	0xC8, 0xAD, 0xAA, 0x9A, 0x98, 0xCB, 0x89, 0x20, 0x35, 0x52, 0x34, 0x33,
+	0x26, 0x43, 0x43, 0x23, 0x02, 0x98, 0x9A, 0x08, 0xB8, 0xDE, 0xCB, 0xAB,
+	0x9A, 0x88, 0xBA, 0xBA, 0x0A, 0x34, 0x42, 0x15, 0x88, 0x90, 0x18, 0x11,
+	0xBA, 0xED, 0xBD, 0x99, 0x98, 0x90, 0xCB, 0x9C, 0x89, 0x21, 0x91, 0xDD,
+	0xCB, 0xAC, 0x08, 0x30, 0x77, 0x00, 0x18, 0x88, 0x61, 0x23, 0x33, 0x91,
+	0x28, 0x22, 0x22, 0xD8, 0xAB, 0xAB, 0x19, 0xE8, 0xCC, 0xBB, 0xAB, 0xAA,
+	0x28, 0x21, 0x80, 0xCC, 0xBA, 0x40, 0x36, 0x11, 0xBA, 0x8C, 0x00, 0x10,
+	0xC8, 0xAE, 0x08, 0x32, 0x15, 0x80, 0x01, 0x41, 0x46, 0x33, 0x24, 0x12,
+	0x00, 0x11, 0x22, 0x02, 0xC9, 0xBE, 0xCB, 0xBB, 0xBB, 0xBE, 0xAC, 0x9B,
+	0x89, 0x10, 0x22, 0x20, 0x56, 0x12, 0x31, 0x24, 0x31, 0x12, 0x08, 0xD9,
+	0xAB, 0xC9, 0xCD, 0xBB, 0x9A, 0xAA, 0xCB, 0xCA, 0x9B, 0x18, 0xD9, 0xBB,
+	0xBC, 0x0A, 0x20, 0x77, 0x03, 0x20, 0x91, 0x50, 0x25, 0x43, 0x81, 0x09,
+	0x13, 0x01, 0x91, 0xBB, 0xBC, 0x0A, 0xA2, 0xBE, 0xCB, 0xAB, 0xBB, 0x2A,
+	0x24, 0x02, 0xCB, 0xBC, 0x1B, 0x37, 0x81, 0xDA, 0x9B, 0x00, 0x98, 0xB8,
+	0xAF, 0x89, 0x31, 0x24, 0x10, 0x23, 0x32, 0x47, 0x34, 0x25, 0x12, 0x01,
+	0x00, 0x21, 0x13, 0xA8, 0xCC, 0xBC, 0xBB, 0xAC, 0xBC, 0xBD, 0xAB, 0x99,
+	0x88, 0xA8, 0xCA, 0x8A, 0x73, 0x24, 0x10, 0x81, 0x89, 0x43, 0x47, 0x02,
+	0x08, 0x98, 0x18, 0x42, 0x44, 0x91, 0x9A, 0x88, 0x19, 0x01, 0xC8, 0xCF,
+	0x9A, 0x99, 0xBB, 0xDD, 0xCB, 0xCB, 0xAA, 0xAA, 0xAA, 0x51, 0x03, 0x19,
+	0x03, 0x71, 0x27, 0x22, 0x12, 0x28, 0x34, 0x11, 0x91, 0x89, 0x80, 0x10,
+	0xB1, 0xBF, 0xAB, 0x89, 0xA9, 0x0B, 0x22, 0x33, 0xC9, 0xDB, 0x9B, 0x45,
+	0x81, 0xFA, 0xAC, 0x90, 0xB9, 0xBA, 0xAF, 0x8A, 0x10, 0x00, 0x99, 0x10,
+	0x63, 0x44, 0x33, 0x34, 0x33, 0x24, 0x23, 0x21, 0x33, 0x01, 0xB9, 0xCC,
+	0xDB, 0xAB, 0xBC, 0xCC, 0xAA, 0x89, 0x98, 0xAA, 0x9A, 0x89, 0x62, 0x23,
+	0x00, 0x90, 0x98, 0xB9, 0x9D, 0xBA, 0xBC, 0xCB, 0xBD, 0x99, 0x28, 0x66,
+	0x14, 0x18, 0x35, 0x43, 0x26, 0x01, 0x11, 0x18, 0x34, 0x00, 0xB9, 0xAD,
+	0x8A, 0x89, 0xEA, 0xBC, 0xBB, 0xAA, 0xAB, 0xAC, 0xBA, 0xBC, 0xCA, 0xAC,
+	0x99, 0x98, 0xEF, 0x9A, 0x9A, 0x41, 0x23, 0x82, 0x8A, 0x53, 0x46, 0x33,
+	0x32, 0x22, 0x42, 0x25, 0x12, 0x88, 0x08, 0x80, 0x88, 0xA8, 0xCE, 0xCB,
+	0xAB, 0xAB, 0x09, 0x90, 0xDA, 0xBC, 0x0A, 0x10, 0x23, 0xB8, 0xBE, 0x89,
+	0x12, 0xCA, 0xDD, 0xAA, 0x88, 0x11, 0x90, 0xAA, 0x28, 0x55, 0x44, 0x34,
+	0x24, 0x23, 0x32, 0x34, 0x43, 0x23, 0x00, 0x99, 0x99, 0xB9, 0xDE, 0xCB,
+	0xAC, 0x9A, 0xA9, 0xCA, 0xBB, 0x9B, 0x08, 0x11, 0x12, 0x08, 0x10, 0x22,
+	0x22, 0x22, 0x93, 0xEB, 0xAC, 0x89, 0x89, 0x89, 0xA9, 0x72, 0x77, 0x24,
+	0x21, 0x21, 0x52, 0x43, 0x33, 0x11, 0x00, 0x00, 0x80, 0xCA, 0xCD, 0xCB,
+	0xBB, 0xCB, 0xBC, 0xCB, 0xAA, 0xAA, 0x99, 0x00, 0x11, 0x11, 0x21, 0x63,
+	0x35, 0x33, 0x01, 0x80, 0x01, 0x12, 0x90, 0xDB, 0x5A, 0x27, 0x99, 0x21,
+	0x89, 0x67, 0x22, 0x24, 0x89, 0x31, 0x81, 0x33, 0x82, 0xA0, 0xDF, 0x89,
+	0xBB, 0xAC, 0xAC, 0xBC, 0xAC, 0x9A, 0xBB, 0xCB, 0xBB, 0xBB, 0x1A, 0x31,
+	0x56, 0x03, 0x20, 0x22, 0x72, 0x26, 0x12, 0x02, 0x00, 0x33, 0x22, 0x81,
+	0x99, 0x20, 0x42, 0x12, 0xEA, 0xAA, 0x09, 0x21, 0x10, 0x23, 0xC9, 0xDE,
+	0xAA, 0x99, 0x88, 0xEB, 0xBD, 0xAD, 0x89, 0xBA, 0xCB, 0xAC, 0x08, 0x01,
+	0x01, 0xA8, 0x28, 0x65, 0x53, 0x22, 0x32, 0x22, 0x33, 0x43, 0x33, 0x23,
+	0x02, 0x81, 0x98, 0x99, 0xDB, 0xCC, 0xAB, 0x89, 0x98, 0xEA, 0xCC, 0xAA,
+	0x08, 0x11, 0xA8, 0xCD, 0xBB, 0xAA, 0xC9, 0xCB, 0xCB, 0xAA, 0xAA, 0xBB,
+	0xBC, 0x8A, 0x31, 0x44, 0x55, 0x33, 0x32, 0x43, 0x44, 0x34, 0x24, 0x22,
+	0x10, 0x20, 0x12, 0x91, 0xBA, 0xCB, 0xBB, 0xCA, 0xDD, 0xBB, 0xAB, 0x99,
+	0xA9, 0x9A, 0xAA, 0xAA, 0x9A, 0xA9, 0x18, 0xA0, 0xFD, 0xBD, 0xBB, 0xAA,
+	0xCB, 0xBC, 0x9B, 0x18, 0x33, 0x12, 0x52, 0x75, 0x34, 0x25, 0x12, 0x23,
+	0x33, 0x34, 0x22, 0x02, 0x10, 0x80, 0xC9, 0xCC, 0xBA, 0xBC, 0xBC, 0xAC,
+	0xAA, 0xBB, 0xBA, 0xAD, 0x8A, 0x18, 0x90, 0xCB, 0xAB, 0x09, 0x90, 0xCB,
+	0xBD, 0xAB, 0x99, 0x98, 0xAD, 0x29, 0x46, 0x34, 0x43, 0x44, 0x33, 0x44,
+	0x33, 0x43, 0x33, 0x23, 0x12, 0x10, 0x02, 0xA8, 0xCC, 0xBC, 0xAC, 0xBB,
+	0xBD, 0xAD, 0x9B, 0x88, 0x98, 0xAA, 0xBC, 0xAA, 0x88, 0x90, 0xCB, 0xDB,
+	0xCB, 0xBC, 0xAD, 0xBA, 0x9A, 0x0A, 0x71, 0x77, 0xA8, 0x20, 0x98, 0x73,
+	0x03, 0x32, 0xA8, 0x61, 0x13, 0x11, 0x00, 0x88, 0x9B, 0xB9, 0xCF, 0xBD,
+	0xAC, 0xCA, 0xBB, 0x8A, 0x00, 0xB9, 0x9A, 0x9A, 0x74, 0x26, 0x12, 0x80,
+	0x31, 0x25, 0x11, 0x90, 0x89, 0x10, 0x01, 0xDA, 0xBD, 0x9A, 0x80, 0x88,
+	0x11, 0x32, 0x23, 0x32, 0x46, 0x55, 0x23, 0x82, 0x88, 0x10, 0x02, 0xEB,
+	0xDC, 0xAA, 0x99, 0xBA, 0xBE, 0xAC, 0x8A, 0x00, 0x08, 0x80, 0x21, 0x35,
+	0x43, 0x33, 0x35, 0x24, 0x12, 0x11, 0x00, 0x88, 0xA9, 0xBD, 0x9B, 0x99,
+	0xCC, 0xAD, 0x8B, 0x20, 0x34, 0x23, 0x11, 0x63, 0x44, 0x22, 0x10, 0x18,
+	0x10, 0xA0, 0xFC, 0xBC, 0xBA, 0xBA, 0xCB, 0xBC, 0xAB, 0xAB, 0x99, 0x09,
+	0x42, 0x45, 0x23, 0x33, 0x53, 0x34, 0x24, 0x12, 0x10, 0x21, 0x81, 0xDB,
+	0xCB, 0x9A, 0x89, 0xC9, 0xCB, 0x9B, 0x21, 0x33, 0x43, 0x63, 0x43, 0x24,
+	0x22, 0x00, 0x10, 0x81, 0xC9, 0xCD, 0xCB, 0xCC, 0xBB, 0xBB, 0xBB, 0x9A,
+	0xAA, 0xAB, 0x18, 0x55, 0x43, 0x33, 0x25, 0x43, 0x33, 0x13, 0x01, 0x10,
+	0x11, 0xA8, 0xCD, 0xBC, 0xAC, 0xA9, 0x98, 0x8A, 0x08, 0x21, 0x42, 0x54,
+	0x34, 0x24, 0x23, 0x22, 0x23, 0x81, 0xDA, 0xCC, 0xAB, 0xCB, 0xDC, 0xCB,
+	0xBB, 0xAA, 0x99, 0x99, 0x08, 0x32, 0x45, 0x33, 0x43, 0x44, 0x43, 0x23,
+	0x11, 0x01, 0x80, 0x99, 0xCB, 0xCB, 0xCB, 0xCA, 0xBB, 0xAB, 0x18, 0x12,
+	0x34, 0x45, 0x53, 0x33, 0x43, 0x22, 0x33, 0x32, 0x91, 0xEB, 0xCB, 0xBC,
+	0xBC, 0xCC, 0xBB, 0xBB, 0xBB, 0xBB, 0x9A, 0x09, 0x52, 0x34, 0x35, 0x33,
+	0x44, 0x32, 0x43, 0x23, 0x12, 0x80, 0xBA, 0xBB, 0xBD, 0xCC, 0xBC, 0xBB,
+	0xBA, 0xA9, 0xA9, 0x08, 0x63, 0x54, 0x33, 0x43, 0x23, 0x33, 0x33, 0x33,
+	0x80, 0xDA, 0xCD, 0xBC, 0xBC, 0xBB, 0xCC, 0xAA, 0xAA, 0x98, 0x10, 0x42,
+	0x53, 0x53, 0x53, 0x22, 0x23, 0x32, 0x12, 0x02, 0x90, 0xBA, 0xCE, 0xCA,
+	0xCA, 0xAA, 0xAA, 0xAA, 0x9A, 0x19, 0x32, 0x55, 0x33, 0x34, 0x43, 0x33,
+	0x33, 0x11, 0x90, 0xBB, 0xDD, 0xCB, 0xDB, 0xAC, 0xBB, 0x9B, 0xBA, 0x98,
+	0x98, 0x31, 0x55, 0x34, 0x34, 0x33, 0x33, 0x33, 0x24, 0x12, 0xA0, 0xDA,
+	0xBC, 0xCC, 0xCB, 0xCA, 0xBB, 0xAA, 0x89, 0x88, 0x10, 0x32, 0x45, 0x35,
+	0x34, 0x23, 0x32, 0x22, 0x00, 0x88, 0x99, 0xBE, 0xAE, 0xCB, 0xBB, 0xAA,
+	0xBA, 0xAB, 0x09, 0x43, 0x32, 0x36, 0x42, 0x42, 0x34, 0x13, 0x22, 0x10,
+	0x10, 0x99, 0x09, 0xCC, 0xBC, 0xAA, 0xA9, 0xBA, 0x32, 0x00, 0x32, 0x46,
+	0x22, 0x43, 0x15, 0x22, 0x91, 0x98, 0x99, 0xB9, 0x9F, 0x9C, 0xBA, 0xAA,
+	0xCB, 0xAA, 0x8B, 0x22, 0x8B, 0xB0, 0x46, 0x24, 0x98, 0x19, 0x90, 0x22,
+	0x06, 0xCC, 0xBF, 0x19, 0xA9, 0xDB, 0xC9, 0x89, 0x88, 0x12, 0xA8, 0x8E,
+	0x22, 0x50, 0x43, 0x44, 0x12, 0x90, 0x11, 0x33, 0x16, 0x03, 0xAA, 0xAD,
+	0x00, 0x19, 0xBE, 0x9C, 0xBB, 0x99, 0x80, 0xB9, 0x9C, 0x1B, 0x53, 0x25,
+	0x34, 0x14, 0x22, 0x37, 0x33, 0x24, 0x01, 0x08, 0x08, 0x00, 0xCA, 0xCF,
+	0xBB, 0xBB, 0xAD, 0xBB, 0xFB, 0xA9, 0x98, 0x00, 0x11, 0x22, 0x43, 0x63,
+	0x34, 0x24, 0x14, 0x11, 0x01, 0x80, 0x80, 0xBA, 0xDC, 0xCB, 0xBB, 0x9B,
+	0xB9, 0xBA, 0x98, 0x41, 0x66, 0x67, 0x91, 0x29, 0x14, 0x48, 0x15, 0x99,
+	0x98, 0x1B, 0x92, 0xCF, 0xBB, 0xBB, 0x19, 0x93, 0xCF, 0xAA, 0x19, 0x43,
+	0x12, 0x90, 0x0B, 0x47, 0x22, 0x90, 0x89, 0x30, 0x34, 0x81, 0xDD, 0x9B,
+	0x11, 0x01, 0xB9, 0x9C, 0x80, 0x21, 0x15, 0x89, 0x63, 0x33, 0x23, 0x21,
+	0x33, 0x01, 0x32, 0x24, 0x98, 0xD9, 0xDF, 0xAA, 0x89, 0x98, 0xCC, 0xAB,
+	0x89, 0x10, 0xA0, 0xBB, 0x58, 0x47, 0x01, 0x98, 0x88, 0x41, 0x23, 0xA0,
+	0xDB, 0x89, 0x00, 0xDA, 0xCB, 0x9A, 0x28, 0x02, 0xB9, 0x8B, 0x73, 0x34,
+	0x23, 0x33, 0x34, 0x34, 0x22, 0x10, 0x32, 0x13, 0xDA, 0xAC, 0xBB, 0xDC,
+	0xBB, 0xAC, 0x99, 0x88, 0xCA, 0xAC, 0x30, 0x44, 0x22, 0x11, 0x32, 0x35,
+	0x23, 0x98, 0x8A, 0x32, 0xC1, 0xDE, 0xBC, 0x9C, 0x89, 0x98, 0xCA, 0x9A,
+	0x19, 0x11, 0x21, 0x53, 0x53, 0x44, 0x22, 0x01, 0x20, 0x11, 0x13, 0x00,
+	0xD9, 0xBC, 0xBA, 0xCB, 0xAB, 0x99, 0x8A, 0x00, 0x21, 0x12, 0x74, 0x36,
+	0x24, 0x12, 0x02, 0x08, 0x12, 0x02, 0xB8, 0xBF, 0xAC, 0xBA, 0xDB, 0xCC,
+	0xAB, 0x99, 0x90, 0xA9, 0xBA, 0x28, 0x75, 0x32, 0x12, 0x22, 0x42, 0x31,
+	0x01, 0x00, 0x08, 0x99, 0xDF, 0xDB, 0xAA, 0x99, 0xA9, 0xAA, 0xAB, 0x00,
+	0x34, 0x23, 0x64, 0x44, 0x34, 0x24, 0x21, 0x10, 0x21, 0x12, 0x12, 0xB9,
+	0xBE, 0xCC, 0xBA, 0xBB, 0xCB, 0xAB, 0xBB, 0x9A, 0x0A, 0x00, 0x22, 0x65,
+	0x24, 0x13, 0x23, 0x22, 0x23, 0x31, 0x23, 0x08, 0x9E, 0xDC, 0xCB, 0x9B,
+	0x99, 0xBA, 0xDB, 0xBA, 0x99, 0x01, 0x33, 0x00, 0x34, 0x27, 0x32, 0x21,
+	0x01, 0xB0, 0x53, 0x33, 0xAB, 0xBB, 0xAF, 0x9A, 0x43, 0x05, 0xA1, 0xA8,
+	0x33, 0x70, 0x43, 0x22, 0x11, 0x30, 0x92, 0x11, 0xD3, 0xCD, 0xAB, 0xAB,
+	0xAC, 0xCA, 0xCC, 0xCB, 0x99, 0x80, 0xBA, 0xA8, 0xA8, 0x01, 0x43, 0x30,
+	0x56, 0x95, 0x31, 0x80, 0x52, 0x83, 0x1A, 0xA9, 0x99, 0x03, 0x27, 0xAC,
+	0x2B, 0x8B, 0x90, 0x52, 0x01, 0x29, 0x73, 0x12, 0x24, 0x02, 0x01, 0x01,
+	0x36, 0x12, 0xB0, 0xBD, 0xCB, 0xB9, 0x89, 0xCC, 0xBC, 0xAD, 0xBA, 0x9B,
+	0x00, 0x88, 0x01, 0x09, 0x36, 0x54, 0x13, 0x12, 0x41, 0x31, 0x14, 0xB0,
+	0xBD, 0xBA, 0x88, 0xA0, 0xCC, 0xAE, 0xA9, 0x10, 0x31, 0x15, 0x32, 0x33,
+	0x46, 0x32, 0x25, 0x01, 0x81, 0x21, 0x01, 0xBB, 0xFB, 0xFB, 0xAA, 0xAA,
+	0xAA, 0xBC, 0xBB, 0xBB, 0x0A, 0x33, 0x31, 0x93, 0x27, 0x64, 0x42, 0x22,
+	0x12, 0x11, 0x32, 0x11, 0x80, 0xBB, 0x9F, 0x98, 0x09, 0x0A, 0x0A, 0xA8,
+	0x11, 0x63, 0x71, 0x22, 0x98, 0x90, 0xB1, 0xA2, 0xFA, 0xFB, 0xAA, 0xB9,
+	0xAA, 0xAB, 0xAC, 0x99, 0x12, 0x16, 0x31, 0x53, 0x33, 0x33, 0x37, 0x23,
+	0x40, 0x01, 0x89, 0x08, 0x90, 0xCE, 0x9C, 0x8D, 0x9A, 0x89, 0x9A, 0xAA,
+	0x89, 0x53, 0x42, 0x21, 0x63, 0x31, 0x43, 0x23, 0x11, 0x29, 0xB9, 0xD0,
+	0xDB, 0xBC, 0xDB, 0xAA, 0xAC, 0xAA, 0x9A, 0xA9, 0x10, 0x72, 0x41, 0x43,
+	0x31, 0x32, 0x44, 0x22, 0x00, 0x90, 0x98, 0x1B, 0xB8, 0xCF, 0xAB, 0xAA,
+	0x9A, 0x99, 0x82, 0x14, 0x25, 0x26, 0x22, 0x42, 0x14, 0x03, 0x83, 0x91,
+	0xDA, 0xFA, 0xB9, 0xCB, 0xBB, 0xAC, 0xBC, 0xAB, 0x99, 0x10, 0x21, 0x30,
+	0x46, 0x34, 0x44, 0x12, 0x01, 0x12, 0x43, 0x82, 0x99, 0xCB, 0xBB, 0xAC,
+	0x98, 0xDA, 0xAA, 0xB0, 0x21, 0x31, 0x37, 0x13, 0x43, 0x27, 0x32, 0x13,
+	0x99, 0xB8, 0x09, 0xB1, 0xFC, 0xAF, 0xAB, 0xAB, 0xBA, 0xAC, 0x9B, 0x89,
+	0x90, 0x02, 0x25, 0x36, 0x25, 0x23, 0x33, 0x24, 0x33, 0x02, 0x80, 0x00,
+	0xBA, 0xBC, 0xCF, 0xAB, 0xAA, 0xAA, 0x09, 0x1C, 0x21, 0x91, 0x81, 0x05,
+	0x63, 0x22, 0x21, 0x08, 0x90, 0xDA, 0xAD, 0x9B, 0xB8, 0xA8, 0xAF, 0x9A,
+	0x9B, 0x2A, 0x51, 0x41, 0x24, 0x15, 0x01, 0x30, 0x42, 0x11, 0x92, 0xA8,
+	0xAA, 0x1B, 0xD0, 0xBF, 0xAC, 0x08, 0x00, 0x29, 0xAA, 0x1B, 0x36, 0x64,
+	0x01, 0x20, 0x12, 0x00, 0x24, 0x9A, 0x9C, 0x9C, 0xB8, 0xAF, 0xAA, 0x9A,
+	0x9F, 0x88, 0x90, 0x92, 0x33, 0x01, 0x69, 0x43, 0x33, 0x23, 0x61, 0x32,
+	0x01, 0xA8, 0x80, 0x4B, 0x39, 0xAD, 0x8F, 0xAB, 0x09, 0xB8, 0x9A, 0xB9,
+	0x19, 0x24, 0x15, 0x13, 0x49, 0x73, 0x21, 0x23, 0x93, 0xC0, 0xE9, 0x99,
+	0x19, 0xCB, 0xEA, 0xBA, 0x8A, 0x99, 0x09, 0x02, 0x51, 0x22, 0x15, 0x12,
+	0x43, 0x04, 0x81, 0x71, 0x00, 0x08, 0xB0, 0xBB, 0x4A, 0x29, 0xB5, 0xC9,
+	0x98, 0x11, 0x42, 0x50, 0xB1, 0x00, 0x34, 0x21, 0xA9, 0xBA, 0xB9, 0x02,
+	0xBF, 0xF0, 0x8A, 0xCA, 0xAA, 0x9B, 0x49, 0xC0, 0xA8, 0x51, 0x93, 0x05,
+	0x13, 0x18, 0x5C, 0x22, 0x21, 0x58, 0x01, 0x91, 0x80, 0x83, 0xE8, 0x99,
+	0xD2, 0xCB, 0xBA, 0x98, 0x2A, 0x30, 0x22, 0x32, 0x27, 0x17, 0x12, 0x11,
+	0x33, 0x14, 0x08, 0xDA, 0x9E, 0x8A, 0xA9, 0xAA, 0xE8, 0xA8, 0xAC, 0xAA,
+	0x18, 0x43, 0x21, 0x0C, 0x41, 0x53, 0x22, 0x98, 0x09, 0x9A, 0x95, 0xCD,
+	0xFB, 0x99, 0xA8, 0x9A, 0xAA, 0xC8, 0xC0, 0x18, 0x03, 0x41, 0x44, 0x10,
+	0x10, 0x44, 0x24, 0x22, 0x21, 0xAA, 0x09, 0x19, 0xCA, 0xBB, 0xB9, 0xBA,
+	0x1B, 0x99, 0xC5, 0x0A, 0x23, 0x56, 0x53, 0x10, 0xC1, 0x88, 0x98, 0x9A,
+	0xAE, 0xAA, 0xBE, 0xBB, 0xBA, 0xB0, 0x11, 0x42, 0x44, 0x26, 0x15, 0x12,
+	0x12, 0x24, 0x14, 0x20, 0x80, 0x9A, 0xD9, 0xBB, 0xAC, 0xCC, 0xC9, 0xAB,
+	0xCB, 0x9A, 0x09, 0x08, 0x88, 0x2A, 0x46, 0x23, 0x53, 0x12, 0x31, 0x16,
+	0x02, 0x18, 0x09, 0x88, 0x39, 0x1A, 0x21, 0xBA, 0x31, 0x0D, 0xB9, 0x24,
+	0xA4, 0x1C, 0x0A, 0x7B, 0x28, 0x0A, 0x9D, 0xEB, 0x08, 0x88, 0xEB, 0xCB,
+	0x9C, 0x9A, 0x8A, 0x8A, 0xBC, 0xA9, 0x30, 0x78, 0x33, 0x22, 0x33, 0x37,
+	0x16, 0x13, 0x01, 0x18, 0x42, 0x51, 0x01, 0x98, 0xC9, 0x09, 0x00, 0x89,
+	0x9D, 0x9B, 0xA0, 0xAA, 0xCB, 0xBB, 0x0B, 0xBB, 0xC9, 0xC9, 0xE0, 0x92,
+	0xEB, 0x88, 0x11, 0x01, 0xB8, 0x2A, 0x51, 0x71, 0x14, 0x18, 0x70, 0x33,
+	0x42, 0x12, 0x00, 0x92, 0x09, 0x90, 0xA8, 0xC8, 0xFB, 0xAF, 0x99, 0x90,
+	0xB8, 0xCA, 0x9A, 0x00, 0x31, 0x0C, 0xAA, 0xA8, 0x39, 0xAD, 0x2B, 0x9B,
+	0xDF, 0xB9, 0x09, 0x19, 0x2B, 0x9C, 0x88, 0x73, 0x16, 0x31, 0x20, 0x31,
+	0x44, 0x34, 0x10, 0x10, 0x18, 0x00, 0x0A, 0xA0, 0x9A, 0xCD, 0xB0, 0xC1,
+	0xB0, 0xC8, 0x0B, 0x0B, 0x8C, 0xB1, 0xDC, 0xAF, 0x99, 0x99, 0xB8, 0xA8,
+	0xF9, 0x8C, 0x99, 0x11, 0x19, 0x34, 0x72, 0x41, 0x32, 0x04, 0x13, 0x35,
+	0x23, 0x25, 0x21, 0x10, 0x98, 0x8A, 0x85, 0xDA, 0xA8, 0xCA, 0xAA, 0xFB,
+	0xAA, 0x9A, 0x98, 0xBB, 0x9B, 0xBC, 0x0A, 0x09, 0x29, 0x42, 0x31, 0x53,
+	0x04, 0x30, 0x72, 0x01, 0x10, 0x53, 0x12, 0x30, 0xC1, 0x02, 0x37, 0x24,
+	0x00, 0x01, 0x41, 0x52, 0x00, 0x11, 0x82, 0xAB, 0xDB, 0xBA, 0xBD, 0xFB,
+	0xAA, 0x9B, 0x9A, 0xDA, 0xBA, 0x9B, 0x38, 0x83, 0x24, 0xA2, 0xA9, 0x11,
+	0x57, 0x22, 0x91, 0x90, 0x1B, 0x02, 0x35, 0xCB, 0xAA, 0x63, 0x41, 0x50,
+	0x08, 0x88, 0x10, 0x36, 0x33, 0x92, 0xC0, 0xD9, 0x90, 0x08, 0xCA, 0xBD,
+	0x9A, 0x9B, 0xCB, 0xCB, 0xAC, 0x89, 0x0B, 0xB3, 0x14, 0xB2, 0xAC, 0x31,
+	0x72, 0x43, 0x12, 0xB1, 0x23, 0x42, 0x24, 0x28, 0x93, 0x0A, 0x12, 0x2A,
+	0x1D, 0x0C, 0xBB, 0x4A, 0x7C, 0x02, 0x9A, 0x9D, 0x81, 0x40, 0x10, 0x9A,
+	0xB9, 0x9F, 0x09, 0x3B, 0x99, 0xE2, 0x98, 0x4B, 0x10, 0xB3, 0x8C, 0x12,
+	0x92, 0x06, 0x98, 0xD2, 0x58, 0x01, 0x02, 0x7A, 0x11, 0x00, 0xB1, 0x90,
+	0x02, 0x62, 0xA8, 0xCA, 0x92, 0x19, 0x98, 0x9C, 0x2F, 0x09, 0xA1, 0x99,
+	0x9D, 0x0C, 0x4A, 0x32, 0x08, 0x4B, 0x0B, 0xB0, 0x27, 0xD2, 0x18, 0x30,
+	0x12, 0x13, 0x02, 0xBB, 0x91, 0x27, 0xA2, 0x80, 0x3D, 0x9F, 0x8B, 0x9A,
+	0x89, 0x93, 0x0D, 0x9C, 0x1A, 0xA1, 0xFB, 0xBF, 0x71, 0x15, 0x88, 0x10,
+	0x08, 0x43, 0x82, 0x99, 0xC8, 0xAE, 0x18, 0x90, 0xCB, 0x9A, 0x11, 0x09,
+	0x39, 0x25, 0x44, 0x91, 0x18, 0x35, 0x81, 0x89, 0x90, 0xF8, 0x9A, 0xAA,
+	0x09, 0xB8, 0xBA, 0x20, 0x39, 0x23, 0x77, 0x84, 0x20, 0x11, 0x11, 0x80,
+	0xD8, 0x99, 0xC9, 0xCA, 0x89, 0xA8, 0xA9, 0xB9, 0x88, 0x61, 0x04, 0x91,
+	0x30, 0x11, 0x35, 0x9A, 0x39, 0x9A, 0xBE, 0x9E, 0x10, 0x10, 0x19, 0xAB,
+	0x03, 0x56, 0x18, 0x01, 0xA3, 0x12, 0xB9, 0x91, 0x9F, 0x3B, 0xB0, 0xD1,
+	0x20, 0x21, 0x81, 0xF9, 0x01, 0x34, 0x31, 0xA5, 0x9B, 0xAB, 0xCF, 0x28,
+	0x15, 0x9A, 0x98, 0xDC, 0x30, 0xA1, 0x9A, 0x94, 0xBA, 0x08, 0x45, 0xA3,
+	0x03, 0x00, 0x8E, 0x28, 0x03, 0x01, 0xF1, 0x9B, 0x13, 0xC1, 0x89, 0x13,
+	0x31, 0x29, 0xE2, 0x63, 0x03, 0x08, 0x0C, 0x99, 0x8A, 0x9B, 0xFD, 0x89,
+	0xA9, 0xCA, 0xA8, 0x10, 0x38, 0xA9, 0x54, 0x10, 0x24, 0x21, 0x29, 0x10,
+	0x42, 0x2A, 0xF1, 0xB8, 0xC9, 0x10, 0x80, 0x12, 0x42, 0x07, 0x20, 0x33,
+	0x24, 0x94, 0x00, 0x92, 0xBB, 0xFB, 0xAB, 0xAC, 0xCD, 0x9A, 0x99, 0x19,
+	0x0A, 0x10, 0x34, 0x35, 0x83, 0x83, 0x14, 0x96, 0x82, 0x80, 0xBA, 0xAC,
+	0x9C, 0xBA, 0x38, 0xBA, 0x9F, 0x3B, 0x62, 0x31, 0x31, 0x03, 0x63, 0x12,
+	0x14, 0x0A, 0xB1, 0xAA, 0xCB, 0xA9, 0xF0, 0x8C, 0x8C, 0x8C, 0x98, 0x0C,
+	0x89, 0x10, 0x50, 0x30, 0x10, 0x01, 0x10, 0x06, 0x25, 0x91, 0xB9, 0x90,
+	0x0D, 0x9B, 0xB3, 0xB0, 0x8F, 0x00, 0xA1, 0x08, 0x79, 0x32, 0x35, 0x14,
+	0x00, 0x13, 0x22, 0x12, 0x3A, 0xEA, 0xE9, 0xAA, 0xDA, 0x9C, 0x99, 0x0B,
+	0xAB, 0x3A, 0x29, 0x32, 0x17, 0x43, 0x50, 0x34, 0x11, 0x02, 0x2A, 0x81,
+	0x00, 0xAF, 0xD0, 0xBB, 0xD8, 0x99, 0xA9, 0x0A, 0x38, 0x79, 0x20, 0x13,
+	0x41, 0x22, 0x32, 0x33, 0x51, 0x18, 0x2B, 0x1B, 0xBD, 0xBD, 0xAC, 0xB9,
+	0xBC, 0x99, 0xB1, 0xA0, 0x33, 0x73, 0x84, 0x16, 0x22, 0x14, 0x48, 0x20,
+	0x09, 0x9A, 0x9C, 0xDB, 0xC9, 0xBA, 0x0D, 0x8C, 0x99, 0x8A, 0x00, 0x31,
+	0x49, 0x52, 0x03, 0x06, 0x31, 0x32, 0x11, 0x81, 0x23, 0x59, 0xB8, 0x1E,
+	0x0A, 0x9B, 0xD0, 0xE3, 0x08, 0x0A, 0x13, 0x24, 0x38, 0x17, 0x11, 0x19,
+	0x21, 0x19, 0x0A, 0xF8, 0xFB, 0x99, 0xAA, 0xBB, 0xAA, 0x9C, 0xAB, 0xB1,
+	0x48, 0x41, 0x33, 0x16, 0x15, 0x32, 0x21, 0x12, 0x21, 0x24, 0x99, 0xB1,
+	0xFB, 0xAC, 0x89, 0x80, 0x0D, 0xB8, 0x91, 0x31, 0x11, 0x61, 0x98, 0x52,
+	0x22, 0x85, 0xA9, 0xD8, 0x01, 0x1B, 0xAD, 0xBA, 0xAC, 0x8D, 0x8B, 0x9B,
+	0x0B, 0xAB, 0x39, 0x13, 0x47, 0x03, 0x03, 0x52, 0x43, 0x34, 0x08, 0x11,
+	0xB4, 0xB1, 0x89, 0xAB, 0xBF, 0xAB, 0x99, 0x9E, 0x99, 0x08, 0x1A, 0x69,
+	0x73, 0x30, 0x11, 0x33, 0x28, 0x31, 0xA3, 0xE1, 0x8E, 0xB9, 0xB8, 0xAB,
+	0xCB, 0xC9, 0x90, 0x92, 0x11, 0x87, 0x03, 0x63, 0x32, 0x00, 0x21, 0x29,
+	0x20, 0xC0, 0xB0, 0x9E, 0xDB, 0xB9, 0xCC, 0xB0, 0x2C, 0x08, 0xB2, 0x92,
+	0x52, 0x50, 0x32, 0x13, 0x11, 0x82, 0x23, 0x8A, 0xD0, 0xDB, 0xC9, 0xAA,
+	0x9F, 0x99, 0x8C, 0x09, 0xA0, 0x30, 0x18, 0x2A, 0x37, 0x22, 0x16, 0x42,
+	0x20, 0x08, 0x32, 0x83, 0x08, 0x9D, 0x8C, 0x08, 0x2D, 0x9A, 0xCA, 0x90,
+	0x10, 0xA5, 0x23, 0xD1, 0x91, 0x90, 0x15, 0xA9, 0x93, 0xDD, 0x01, 0x1D,
+	0xA8, 0x8A, 0xC0, 0xD1, 0x98, 0x21, 0x58, 0x39, 0x01, 0x05, 0x22, 0x35,
+	0xA1, 0x31, 0x94, 0x51, 0x00, 0x19, 0x19, 0xCA, 0xD4, 0xA2, 0x00, 0x19,
+	0x9A, 0x9B, 0x70, 0xB8, 0xC8, 0x99, 0xB8, 0xF2, 0xA9, 0xC1, 0x9A, 0x90,
+	0x59, 0x1D, 0x39, 0x93, 0x99, 0x39, 0x17, 0x23, 0x30, 0xB9, 0x13, 0x36,
+	0x41, 0xAA, 0x9A, 0xA0, 0xA7, 0x92, 0xA1, 0xB2, 0xB8, 0x7B, 0x18, 0x29,
+	0x90, 0x72, 0x00, 0x21, 0x40, 0x1C, 0xF1, 0x91, 0xA0, 0x02, 0x8D, 0x8B,
+	0x8C, 0xA0, 0x80, 0x1A, 0x8C, 0x13, 0x7A, 0x22, 0x30, 0x30, 0x52, 0x5A,
+	0x01, 0x59, 0x09, 0xAB, 0x10, 0xA1, 0x09, 0xF9, 0x91, 0x3B, 0x28, 0x0A,
+	0x70, 0x5A, 0x90, 0x83, 0xA0, 0xDA, 0x0A, 0x3C, 0x9E, 0xB0, 0xE9, 0xA0,
+	0x9B, 0x2A, 0x2B, 0x83, 0xA5, 0x93, 0x96, 0x12, 0x33, 0x70, 0x81, 0x41,
+	0x19, 0x11, 0xA2, 0x89, 0xBA, 0x08, 0x10, 0x3D, 0xCB, 0xBC, 0xC2, 0x11,
+	0x83, 0xAA, 0xDB, 0xBB, 0x5B, 0x1C, 0xC1, 0xC9, 0x0C, 0x8A, 0xA9, 0x29,
+	0xC0, 0x1A, 0x71, 0x11, 0x31, 0x05, 0x10, 0x32, 0x87, 0x31, 0x90, 0x32,
+	0xB8, 0xB5, 0xB2, 0xC3, 0x91, 0xAD, 0x39, 0x2E, 0x98, 0x1A, 0x8B, 0xBB,
+	0x60, 0x99, 0x11, 0xBB, 0x9D, 0x01, 0x85, 0xE9, 0xC1, 0x08, 0x08, 0xBB,
+	0x52, 0xAC, 0xB1, 0x23, 0x11, 0x83, 0x4B, 0x35, 0x72, 0x20, 0x92, 0x91,
+	0x95, 0x09, 0x91, 0x10, 0xAB, 0xF8, 0xC9, 0x98, 0x09, 0x90, 0xBB, 0xDA,
+	0xC0, 0x09, 0x72, 0x19, 0x49, 0x0A, 0x03, 0x38, 0xD6, 0x98, 0x00, 0x84,
+	0x01, 0x10, 0x12, 0x33, 0x06, 0x42, 0x0A, 0x91, 0x84, 0x30, 0x2A, 0xFA,
+	0x9B, 0xB1, 0x0D, 0x9D, 0x1A, 0xCB, 0x90, 0xA4, 0x38, 0x5A, 0x3A, 0x21,
+	0x18, 0x73, 0x91, 0x80, 0x02, 0xE3, 0x91, 0xB9, 0xD4, 0x00, 0x0A, 0x1A,
+	0x19, 0x16, 0x38, 0x21, 0x15, 0x25, 0x30, 0x3A, 0x92, 0x73, 0x29, 0x88,
+	0xBB, 0xB9, 0x1D, 0x8D, 0xBB, 0xCB, 0x9C, 0x80, 0xA9, 0xC5, 0x20, 0x3A,
+	0x22, 0x30, 0x71, 0x20, 0x29, 0x40, 0x0A, 0x12, 0x91, 0xF0, 0x98, 0xB1,
+	0x91, 0xA9, 0x05, 0x63, 0x12, 0x53, 0x4A, 0x38, 0x20, 0x13, 0x4A, 0x2C,
+	0xB8, 0xFB, 0xC0, 0xB9, 0xA0, 0x0A, 0xE8, 0xA9, 0x08, 0x01, 0x58, 0x80,
+	0x51, 0x12, 0x63, 0x00, 0x28, 0x01, 0x43, 0x3B, 0x2A, 0xE1, 0x80, 0xBB,
+	0xD2, 0x9A, 0x8C, 0xB1, 0x0C, 0x99, 0x58, 0x90, 0xA9, 0x94, 0x84, 0x50,
+	0xB2, 0x33, 0x20, 0xA6, 0xC2, 0x41, 0x38, 0x0B, 0x90, 0xD6, 0x81, 0x39,
+	0x1A, 0x9A, 0xB1, 0x33, 0x1D, 0x1E, 0x0D, 0x11, 0x90, 0x10, 0xBD, 0xB1,
+	0x19, 0xD0, 0xF1, 0x80, 0x81, 0xE2, 0x81, 0x82, 0x49, 0x11, 0x04, 0x00,
+	0x01, 0x59, 0x19, 0x29, 0x48, 0x9A, 0xEA, 0xD3, 0x98, 0x1B, 0x19, 0xAA,
+	0x1C, 0xB0, 0x86, 0xC8, 0x22, 0x21, 0x41, 0x4A, 0x0A, 0x12, 0x21, 0xE1,
+	0x49, 0xD0, 0x00, 0x0B, 0x8A, 0xC1, 0x01, 0xAB, 0x80, 0xC2, 0x30, 0xB9,
+	0x17, 0xE0, 0x02, 0x10, 0x91, 0x90, 0xF3, 0x39, 0x99, 0xB2, 0x91, 0xB1,
+	0x59, 0xAB, 0xA8, 0x92, 0xA7, 0x83, 0x99, 0x02, 0x58, 0x59, 0x19, 0xBA,
+	0x21, 0xFB, 0x01, 0x1C, 0x9A, 0xB1, 0x13, 0xB0, 0xB7, 0x29, 0x0D, 0x13,
+	0x10, 0xE0, 0x83, 0xB1, 0x11, 0x11, 0x3B, 0xBA, 0xE4, 0x03, 0xB1, 0x8B,
+	0xC4, 0xB3, 0x94, 0x60, 0x1B, 0x08, 0x81, 0xB3, 0x71, 0x81, 0x19, 0x30,
+	0x83, 0x1C, 0xD8, 0x30, 0x21, 0xBB, 0xC3, 0xE0, 0xB0, 0xC2, 0xC1, 0x10,
+	0x39, 0xE8, 0x90, 0x11, 0x3A, 0x0E, 0xA8, 0x05, 0x00, 0x19, 0x69, 0xA3,
+	0x32, 0x31, 0xA1, 0x53, 0x24, 0xC9, 0x00, 0x2C, 0xB2, 0x30, 0xF3, 0x3B,
+	0x1A, 0x2E, 0x8B, 0x99, 0xB3, 0x90, 0xB2, 0x95, 0x79, 0x08, 0x82, 0xA3,
+	0x85, 0x11, 0x90, 0xA2, 0x12, 0xBE, 0x99, 0x0E, 0x98, 0x8F, 0x80, 0x89,
+	0x18, 0xB3, 0x13, 0x21, 0x7A, 0x85, 0x13, 0x12, 0x20, 0x93, 0x04, 0xA5,
+	0x80, 0x9B, 0x2A, 0xBB, 0x8F, 0xBA, 0x9A, 0x12, 0x69, 0x9A, 0x93, 0x2C,
+	0x33, 0x1D, 0x8D, 0x22, 0x2B, 0x08, 0xE1, 0x09, 0xD3, 0xA9, 0x38, 0x28,
+	0x39, 0x21, 0x85, 0x50, 0x30, 0xB6, 0x12, 0xB1, 0x51, 0x4B, 0x1B, 0xB0,
+	0x99, 0xD8, 0x3A, 0x8C, 0xFA, 0x40, 0xB8, 0x29, 0x11, 0x98, 0x19, 0x31,
+	0x7C, 0x28, 0xB3, 0xB8, 0xA6, 0x08, 0x19, 0x0A, 0xB3, 0x1B, 0xAF, 0x09,
+	0xC2, 0xA3, 0xB4, 0x14, 0x00, 0x03, 0xB1, 0x17, 0xA4, 0x3A, 0x99, 0x2E,
+	0x89, 0xC1, 0xB1, 0x0A, 0xBB, 0xAF, 0xC3, 0x90, 0x28, 0x5B, 0x98, 0x31,
+	0x18, 0x69, 0x04, 0x12, 0x93, 0x93, 0x0D, 0x11, 0xF0, 0x1A, 0xB1, 0xF2,
+	0xA1, 0x8A, 0x4B, 0xBA, 0x20, 0xC1, 0x23, 0x20, 0x11, 0x42, 0xB4, 0x32,
+	0x3A, 0x1C, 0x2F, 0xC1, 0x99, 0x0C, 0xB8, 0xC8, 0xC9, 0x09, 0x18, 0x2D,
+	0x3A, 0x34, 0x50, 0x21, 0x32, 0x33, 0x71, 0x92, 0x49, 0xB9, 0x10, 0xC0,
+	0xA8, 0x8F, 0x38, 0xDA, 0xC2, 0xC9, 0x59, 0x94, 0x1C, 0x81, 0x09, 0x43,
+	0xD1, 0x10, 0xA0, 0x01, 0x18, 0xAB, 0x02, 0xBB, 0x88, 0x8F, 0x81, 0xB2,
+	0x2C, 0x3B, 0x40, 0x31, 0x42, 0x01, 0x06, 0x21, 0x12, 0x85, 0xA8, 0xD3,
+	0x90, 0x1A, 0x1B, 0x72, 0xFC, 0x1C, 0x02, 0xA9, 0x31, 0xB2, 0x9A, 0x09,
+	0x1A, 0x52, 0xDA, 0x98, 0x12, 0x04, 0x0B, 0x21, 0x7A, 0x00, 0xB9, 0x43,
+	0x98, 0x21, 0xA9, 0x73, 0x13, 0x1A, 0x85, 0x01, 0x23, 0xB0, 0xBB, 0x91,
+	0xD3, 0x08, 0xB9, 0x32, 0x19, 0x9E, 0x5B, 0x91, 0xB8, 0x9B, 0x0A, 0x9B,
+	0xCF, 0x92, 0x00, 0x01, 0x3C, 0x01, 0x2A, 0xA3, 0x7B, 0xB2, 0x59, 0xA8,
+	0x00, 0x73, 0x90, 0x2B, 0x18, 0x53, 0x12, 0x0B, 0x23, 0x30, 0xB9, 0x6B,
+	0xE3, 0x01, 0x0C, 0xA9, 0x14, 0xDA, 0x98, 0xA8, 0x08, 0x10, 0xDA, 0x12,
+	0xBD, 0x13, 0x1A, 0x6B, 0xA1, 0x2A, 0x12, 0x05, 0x08, 0xA1, 0x2E, 0xA2,
+	0x21, 0x94, 0xFF, 0x15, 0x89, 0x10, 0x1C, 0x48, 0xB2, 0x8C, 0x00, 0x89,
+	0x21, 0xE1, 0x10, 0x92, 0x90, 0x83, 0x19, 0x42, 0xC0, 0x99, 0x09, 0x41,
+	0xC8, 0xB9, 0x21, 0x12, 0x1C, 0xA3, 0x2D, 0xB8, 0x82, 0xBB, 0x6B, 0x2A,
+	0x5C, 0x99, 0x13, 0x20, 0x8A, 0x49, 0x38, 0xF9, 0x2A, 0xAA, 0xA5, 0xB1,
+	0x09, 0x1A, 0xC6, 0x11, 0x9F, 0x92, 0xA0, 0xB8, 0x30, 0x3A, 0x11, 0xF0,
+	0x32, 0x02, 0x11, 0x90, 0x1A, 0x73, 0x9A, 0xB1, 0xD5, 0x18, 0x00, 0x1B,
+	0x8C, 0x03, 0x92, 0x41, 0x9E, 0x80, 0x83, 0xA1, 0xD9, 0x20, 0x91, 0x30,
+	0xBF, 0xB3, 0x10, 0x1B, 0x99, 0x95, 0x82, 0xEB, 0x4A, 0x10, 0x2C, 0x3C,
+	0x94, 0x02, 0xCA, 0x31, 0x0C, 0x4B, 0x3C, 0x9B, 0x60, 0x0A, 0x20, 0xBA,
+	0xB9, 0x47, 0xDC, 0x28, 0xB8, 0x28, 0x99, 0x0D, 0x25, 0x99, 0x14, 0x19,
+	0x38, 0x80, 0x8E, 0x31, 0x9C, 0x01, 0xAA, 0x5A, 0xB8, 0xC2, 0x00, 0xB1,
+	0x54, 0x19, 0x20, 0x0A, 0x51, 0x88, 0x80, 0x88, 0xCB, 0x22, 0xFA, 0x0B,
+	0xB8, 0xAB, 0x01, 0x3C, 0x3D, 0x30, 0x5A, 0x30, 0x0D, 0xCC, 0x34, 0x38,
+	0x24, 0x30, 0x72, 0x36, 0x03, 0x71, 0x77, 0x17, 0x81, 0x89, 0x98, 0xA9,
+	0xBF, 0x8A, 0x83, 0x8C, 0x43, 0x01, 0x43, 0xA1, 0x8E, 0x14, 0xBA, 0x99,
+	0xBA, 0x2B, 0x16, 0x89, 0x11, 0x88, 0x62, 0x82, 0x0B, 0x80, 0xAA, 0x18,
+	0x80, 0x10, 0xB2, 0x0F, 0x14, 0x21, 0x91, 0x88, 0x9E, 0xA8, 0x8C, 0x32,
+	0xD1, 0x0C, 0x11, 0x11, 0x25, 0xBB, 0x29, 0x82, 0x9D, 0x90, 0x39, 0x77,
+	0x90, 0x8A, 0x08, 0x11, 0x28, 0xD4, 0x0F, 0x84, 0xAB, 0x22, 0xC9, 0x19,
+	0xB1, 0x8F, 0x33, 0x08, 0x22, 0xA1, 0x78, 0x15, 0xC9, 0x20, 0xDA, 0x18,
+	0x91, 0x0B, 0x12, 0xAD, 0x62, 0x91, 0x18, 0x81, 0xAB, 0x01, 0x99, 0x18,
+	0xEA, 0x3A, 0x15, 0x08, 0x02, 0x00, 0x00, 0xAA, 0x01, 0xCF, 0x99, 0x09,
+	0x81, 0xA8, 0x1B, 0x45, 0x01, 0x90, 0x19, 0xD8, 0x0A, 0x13, 0xB9, 0xA9,
+	0x2D, 0x67, 0xB8, 0x28, 0xA1, 0x1A, 0xB1, 0x9E, 0xA8, 0x19, 0x15, 0xBB,
+	0x3A, 0x26, 0x90, 0x19, 0xB9, 0x0E, 0x33, 0xD9, 0x1B, 0xB8, 0x78, 0x14,
+	0x88, 0x98, 0x88, 0x40, 0x12, 0xFB, 0x8B, 0x22, 0xD1, 0x2A, 0x83, 0x89,
+	0x00, 0x03, 0x42, 0xA2, 0xDF, 0x31, 0xB8, 0x48, 0x94, 0x9B, 0x83, 0x1A,
+	0x35, 0x91, 0x88, 0xC8, 0x0D, 0x24, 0xA1, 0xBC, 0x88, 0x42, 0x17, 0xB9,
+	0x09, 0x10, 0x30, 0x92, 0xBD, 0x28, 0x00, 0x68, 0x04, 0xAB, 0x89, 0x21,
+	0x54, 0xC1, 0xAD, 0x31, 0xA1, 0x31, 0xC0, 0x8E, 0x23, 0x89, 0x33, 0xC9,
+	0x28, 0xA1, 0x99, 0x50, 0x84, 0xDE, 0x09, 0x43, 0x83, 0xBC, 0x0A, 0x53,
+	0x12, 0xDA, 0x89, 0x11, 0x82, 0x90, 0xEA, 0x19, 0x23, 0x08, 0xA1, 0xCB,
+	0x3B, 0x67, 0x90, 0x09, 0xA0, 0x19, 0x14, 0xCB, 0x09, 0x89, 0x30, 0x35,
+	0x93, 0xAE, 0x10, 0x8A, 0x34, 0xD8, 0x0B, 0x80, 0x48, 0x02, 0xBA, 0x9A,
+	0x61, 0x33, 0x91, 0xCB, 0x1C, 0x03, 0x8D, 0x24, 0xC9, 0x0A, 0x12, 0x01,
+	0x28, 0xC1, 0x9D, 0x13, 0x9A, 0x36, 0xCA, 0x8C, 0x12, 0x88, 0x43, 0x91,
+	0x89, 0x19, 0x65, 0xA1, 0xAF, 0x10, 0x89, 0x21, 0xB0, 0x1B, 0x37, 0x99,
+	0x22, 0xFA, 0x19, 0x04, 0x98, 0x20, 0x98, 0x44, 0xC9, 0x19, 0x80, 0x38,
+	0xC1, 0xAF, 0x11, 0x80, 0x43, 0xA1, 0x89, 0x82, 0xDA, 0xBB, 0xA8, 0x5B,
+	0x05, 0x88, 0x31, 0x92, 0xAB, 0x40, 0x13, 0xDA, 0x0C, 0x24, 0x02, 0xDB,
+	0x29, 0x02, 0x98, 0xA8, 0x3B, 0x47, 0xA0, 0x90, 0xDD, 0x28, 0x82, 0x09,
+	0x08, 0x34, 0x82, 0xCA, 0xB9, 0xBF, 0x42, 0xDB, 0x38, 0xA0, 0x99, 0x11,
+	0x31, 0x02, 0x80, 0x09, 0x66, 0xB1, 0xBE, 0x18, 0x11, 0x13, 0xC9, 0x18,
+	0x55, 0x02, 0x9A, 0x11, 0x20, 0x11, 0xFB, 0x9E, 0x10, 0xB9, 0xBA, 0x1A,
+	0x67, 0x01, 0xA9, 0x0A, 0x21, 0xA2, 0xCE, 0x09, 0x11, 0x08, 0x32, 0x12,
+	0x20, 0x08, 0x00, 0xCB, 0xAA, 0x2B, 0x02, 0x89, 0xDC, 0x70, 0x24, 0x32,
+	0x82, 0xED, 0x8B, 0x01, 0xA9, 0x99, 0x31, 0x23, 0x23, 0x48, 0x37, 0x01,
+	0x90, 0xDD, 0x9A, 0x08, 0x90, 0xAC, 0xBB, 0x50, 0x04, 0x88, 0x20, 0x43,
+	0x12, 0xE9, 0x9C, 0x22, 0x01, 0xA1, 0xCD, 0x1A, 0x33, 0xB9, 0x40, 0x36,
+	0x12, 0xA9, 0x89, 0x08, 0xEA, 0x0A, 0x01, 0x33, 0xA2, 0xBF, 0x18, 0x18,
+	0x23, 0xA8, 0x8B, 0x47, 0xB0, 0xBD, 0x1A, 0x34, 0xA1, 0xBA, 0xBA, 0x9A,
+	0xA9, 0x01, 0x0E, 0x16, 0x72, 0x05, 0x08, 0x80, 0x9A, 0x89, 0x21, 0x88,
+	0x14, 0xAD, 0x08, 0x20, 0xD0, 0xAB, 0xDA, 0x38, 0xB1, 0x89, 0x98, 0x57,
+	0x00, 0xA1, 0x9B, 0x90, 0x70, 0x84, 0x08, 0x18, 0x01, 0xCC, 0x8A, 0x89,
+	0x51, 0x90, 0x18, 0x00, 0xC9, 0x8A, 0x19, 0x67, 0x00, 0xC8, 0x89, 0x12,
+	0x04, 0xEB, 0x09, 0x52, 0x04, 0xA8, 0x8A, 0x88, 0xA8, 0xAB, 0xCB, 0x29,
+	0x21, 0x47, 0x33, 0x13, 0xC9, 0xCA, 0x1A, 0xB2, 0xBF, 0xBB, 0x38, 0x15,
+	0x12, 0x20, 0x37, 0x81, 0xBA, 0x9C, 0x01, 0x18, 0xD9, 0x2A, 0x01, 0x31,
+	0xD9, 0x0A, 0x08, 0x35, 0xB9, 0x90, 0x3B, 0x57, 0x11, 0xB9, 0xBC, 0x18,
+	0x53, 0x92, 0xBC, 0x98, 0x1A, 0x23, 0x43, 0x23, 0x63, 0xA1, 0xAB, 0xBE,
+	0x12, 0xBB, 0x42, 0x10, 0xA3, 0xAF, 0x11, 0x62, 0xB1, 0x89, 0x0A, 0x35,
+	0xA8, 0xCB, 0x30, 0x04, 0x88, 0xDB, 0x48, 0x26, 0xA0, 0x0A, 0x53, 0x23,
+	0xDA, 0x9C, 0x88, 0x99, 0x9A, 0x89, 0x8A, 0x90, 0x0B, 0x14, 0x29, 0x23,
+	0x67, 0x13, 0x90, 0xA9, 0x9A, 0xC8, 0xBC, 0xCA, 0x8B, 0x12, 0x35, 0x22,
+	0x11, 0x88, 0x65, 0xA0, 0xA8, 0xCD, 0xBA, 0xCD, 0x89, 0x31, 0x53, 0x23,
+	0x12, 0x98, 0xA8, 0x29, 0x83, 0xCD, 0xAA, 0x9B, 0xC8, 0x9D, 0xAA, 0x52,
+	0x22, 0x37, 0x98, 0xA8, 0x09, 0x21, 0xA8, 0xBA, 0x8C, 0x12, 0x42, 0x22,
+	0x32, 0x12, 0x77, 0x06, 0x80, 0xA8, 0x10, 0xCA, 0xA9, 0x9C, 0x12, 0x72,
+	0x13, 0x10, 0xA9, 0x89, 0x8A, 0x04, 0x8B, 0xA0, 0x32, 0xC0, 0x2A, 0xFA,
+	0x30, 0x72, 0x15, 0x88, 0x90, 0x30, 0x82, 0x80, 0xBD, 0x88, 0x18, 0x63,
+	0x34, 0xA2, 0xCC, 0x8A, 0x23, 0xA9, 0xCC, 0x99, 0x9A, 0xA8, 0x0C, 0x44,
+	0x34, 0x82, 0x88, 0x00, 0x81, 0xBB, 0x9B, 0x72, 0x02, 0xEE, 0x9B, 0x20,
+	0x03, 0xCA, 0x99, 0x88, 0x00, 0x11, 0xD9, 0x8B, 0x32, 0xB0, 0x1C, 0x57,
+	0x81, 0xB9, 0x89, 0xA9, 0xB9, 0xFF, 0x9B, 0x09, 0x01, 0x98, 0x38, 0x44,
+	0x23, 0x81, 0xBB, 0x2A, 0x91, 0xCE, 0x9C, 0x11, 0xB9, 0xAD, 0x09, 0x54,
+	0x03, 0x98, 0x08, 0x11, 0xA1, 0x9D, 0xC9, 0x09, 0x9A, 0x91, 0x0D, 0x36,
+	0x99, 0x88, 0x58, 0x27, 0x10, 0x91, 0x9A, 0xB0, 0x29, 0x34, 0x73, 0x15,
+	0x21, 0x81, 0x80, 0xAB, 0x30, 0xA1, 0xCD, 0xCE, 0x09, 0x01, 0x02, 0x19,
+	0x33, 0x32, 0x73, 0x45, 0x22, 0x91, 0xCA, 0xCB, 0x89, 0x00, 0x89, 0x89,
+	0x11, 0x53, 0x13, 0x18, 0x00, 0x24, 0xCE, 0x9A, 0x1A, 0x24, 0x33, 0xD0,
+	0x8B, 0x31, 0x25, 0x80, 0x99, 0xAB, 0xA0, 0xAF, 0xBB, 0x09, 0x90, 0xCB,
+	0x2A, 0x55, 0x23, 0x80, 0x99, 0x8A, 0xA0, 0x9B, 0x34, 0x24, 0xFA, 0xBF,
+	0x9A, 0x00, 0x11, 0x88, 0x19, 0x24, 0x81, 0xBC, 0x89, 0xB9, 0xDC, 0x89,
+	0x21, 0x80, 0x28, 0x01, 0xD0, 0xDD, 0xAB, 0xBB, 0xCB, 0x09, 0x80, 0xEB,
+	0x9D, 0x62, 0x23, 0x82, 0xCA, 0x9A, 0x09, 0x34, 0xB8, 0xBB, 0xCC, 0xAA,
+	0xBB, 0x89, 0x11, 0x14, 0x61, 0x83, 0x19, 0x89, 0x77, 0x22, 0x02, 0x10,
+	0x53, 0x32, 0x81, 0xC8, 0xAB, 0x8B, 0x45, 0x01, 0xA0, 0x9B, 0x88, 0x88,
+	0xA1, 0x8D, 0x11, 0x71, 0x94, 0x1B, 0x22, 0x67, 0x81, 0x08, 0x11, 0x22,
+	0x33, 0x36, 0xA0, 0xDB, 0x9C, 0x88, 0x8A, 0x98, 0xAB, 0x80, 0x88, 0x89,
+	0x76, 0x12, 0x21, 0x33, 0x02, 0x89, 0x11, 0xF9, 0xBC, 0x89, 0x88, 0xCB,
+	0x99, 0x09, 0x22, 0xC9, 0x09, 0x00, 0x81, 0xCA, 0xBD, 0x99, 0x0B, 0x64,
+	0x25, 0x12, 0x12, 0x11, 0xA8, 0xBC, 0x18, 0xA1, 0xBE, 0xDB, 0xBB, 0xFB,
+	0xBC, 0x8A, 0x90, 0x89, 0xB0, 0x39, 0x47, 0x24, 0x81, 0x08, 0x98, 0xCB,
+	0xBB, 0xBB, 0x9B, 0xFB, 0xAC, 0x9B, 0x08, 0xAB, 0x30, 0x14, 0x81, 0xCD,
+	0xBC, 0xAC, 0x50, 0x24, 0x22, 0x32, 0x02, 0x99, 0xDC, 0x09, 0x32, 0x53,
+	0x83, 0xCB, 0xCD, 0x19, 0x91, 0x8A, 0x10, 0x35, 0x13, 0x32, 0x45, 0x23,
+	0x51, 0x27, 0x12, 0x98, 0xAA, 0x9A, 0x18, 0x80, 0xDC, 0xDB, 0x09, 0x08,
+	0x80, 0x30, 0x25, 0x91, 0x29, 0x46, 0x34, 0x11, 0x21, 0x52, 0x23, 0x03,
+	0xC9, 0xCC, 0xCD, 0x9A, 0x00, 0x01, 0x00, 0xB8, 0xAC, 0x10, 0x11, 0x38,
+	0x43, 0x16, 0x10, 0x11, 0x13, 0x89, 0x88, 0x81, 0xA9, 0xEA, 0x29, 0xFA,
+	0xDF, 0x99, 0x80, 0x00, 0x00, 0xA0, 0x20, 0x51, 0x22, 0x00, 0x20, 0x21,
+	0x44, 0x88, 0x98, 0xB9, 0xEF, 0x8A, 0x18, 0xB9, 0xCD, 0x9B, 0x9A, 0x09,
+	0x80, 0x89, 0x42, 0x44, 0x44, 0x12, 0x02, 0x80, 0xCC, 0xAC, 0x9B, 0xCB,
+	0xAB, 0x8A, 0x98, 0x72, 0x92, 0x8A, 0x08, 0x11, 0xDA, 0x30, 0x05, 0xB9,
+	0x18, 0x80, 0x41, 0x82, 0x1A, 0x53, 0x16, 0xBB, 0x39, 0x46, 0x03, 0x00,
+	0xAA, 0x30, 0x22, 0x63, 0x01, 0x57, 0x88, 0x33, 0xA9, 0xBC, 0x89, 0x00,
+	0xBB, 0x53, 0x31, 0xC8, 0x48, 0x91, 0x99, 0xB8, 0x7A, 0x82, 0x71, 0x43,
+	0x33, 0x89, 0x31, 0x03, 0xA8, 0xAD, 0xA9, 0xDF, 0x88, 0x08, 0x80, 0x98,
+	0x08, 0x41, 0x13, 0x28, 0x11, 0x34, 0x80, 0xA8, 0xAD, 0x89, 0xB8, 0xBE,
+	0x19, 0x16, 0xA8, 0xCB, 0x99, 0xBB, 0xDB, 0x29, 0x23, 0x98, 0x41, 0x45,
+	0x14, 0x20, 0xA1, 0x99, 0x9B, 0x80, 0xEA, 0xAC, 0xCA, 0x9C, 0x89, 0x88,
+	0xDA, 0xDD, 0xAB, 0x89, 0x08, 0x11, 0x11, 0x41, 0x57, 0x22, 0x90, 0xBA,
+	0x99, 0xBA, 0xDD, 0xAB, 0x99, 0xCD, 0xAC, 0x10, 0x21, 0x52, 0x13, 0x08,
+	0x20, 0x02, 0xEA, 0xAB, 0x19, 0x81, 0x01, 0x00, 0x72, 0x24, 0x33, 0x33,
+	0x11, 0x23, 0x28, 0x02, 0x13, 0xFF, 0x2A, 0x32, 0x12, 0xA8, 0x73, 0x02,
+	0xA9, 0xBF, 0x18, 0x02, 0xBB, 0x40, 0x03, 0x38, 0x37, 0x10, 0x00, 0x42,
+	0xA1, 0x08, 0x20, 0x00, 0x84, 0x8A, 0xCC, 0x65, 0x11, 0x11, 0xC0, 0xBE,
+	0xAA, 0x9A, 0x18, 0x43, 0x32, 0x12, 0x90, 0x10, 0x01, 0xB2, 0xAF, 0xAA,
+	0xA9, 0x48, 0x03, 0x90, 0x0A, 0xA0, 0x58, 0x04, 0xCE, 0xBB, 0xCC, 0x8A,
+	0x40, 0x13, 0x33, 0x90, 0x28, 0x57, 0x12, 0xA8, 0xAC, 0xBB, 0x09, 0x81,
+	0xBA, 0xAA, 0x98, 0xEE, 0x89, 0xA9, 0x89, 0xA9, 0xDD, 0x9B, 0x42, 0x81,
+	0x31, 0x37, 0x00, 0x32, 0xB0, 0xDF, 0xAA, 0xBA, 0x9B, 0xB9, 0xAB, 0x09,
+	0x00, 0x49, 0x67, 0x80, 0x88, 0x11, 0xA0, 0x09, 0x90, 0x1A, 0x33, 0x45,
+	0x54, 0x24, 0x20, 0x24, 0xB8, 0x19, 0x42, 0xA2, 0x0B, 0x45, 0xC0, 0xAD,
+	0x89, 0x98, 0x99, 0x99, 0x32, 0x01, 0x70, 0x16, 0x01, 0x98, 0x99, 0x30,
+	0x63, 0x22, 0x91, 0x9A, 0x11, 0x73, 0x13, 0xCA, 0x9A, 0x99, 0xAB, 0x21,
+	0xB8, 0xBF, 0xAB, 0x39, 0x47, 0x24, 0x01, 0x91, 0xA9, 0x8A, 0xB9, 0xAA,
+	0x29, 0xA3, 0x2B, 0xB1, 0xCF, 0xBB, 0xCB, 0x9C, 0x52, 0x03, 0xA9, 0x19,
+	0xA1, 0x60, 0x35, 0x11, 0x31, 0x12, 0x98, 0xDA, 0xAC, 0xBC, 0xAA, 0x18,
+	0x23, 0xFA, 0xBE, 0x9A, 0x09, 0x12, 0xA8, 0xAC, 0x30, 0x90, 0xAB, 0xAA,
+	0x10, 0xB9, 0x71, 0x52, 0x47, 0x91, 0xAE, 0x10, 0xA1, 0xCD, 0x8A, 0x00,
+	0xA8, 0xBD, 0xAB, 0xA9, 0x88, 0x41, 0x15, 0x20, 0x23, 0x90, 0x1A, 0x47,
+	0x24, 0x11, 0x01, 0x74, 0x14, 0x80, 0x80, 0x00, 0xC8, 0x0A, 0x90, 0xBA,
+	0xCE, 0x8A, 0x00, 0x11, 0x8A, 0x08, 0x98, 0x52, 0x53, 0x13, 0x28, 0x15,
+	0x21, 0x22, 0x12, 0x02, 0xAA, 0xAA, 0x74, 0xA2, 0xCB, 0xAA, 0xBB, 0x8C,
+	0x02, 0x00, 0x80, 0x28, 0x25, 0x21, 0xA2, 0x39, 0xC0, 0x7A, 0x67, 0x22,
+	0xA8, 0xBB, 0xCB, 0xAB, 0xAB, 0x31, 0x33, 0xDA, 0x8A, 0x01, 0xCC, 0xAA,
+	0x51, 0x34, 0x36, 0x23, 0x81, 0xAA, 0x9A, 0xA9, 0x9A, 0x20, 0xC2, 0xCF,
+	0xAC, 0x99, 0xAA, 0x09, 0x10, 0x43, 0x80, 0x08, 0x12, 0xB0, 0xCF, 0x9A,
+	0x9B, 0x63, 0x91, 0xA9, 0x09, 0xB8, 0xAF, 0x30, 0xB2, 0xAF, 0xA8, 0xBE,
+	0xCC, 0x9B, 0xB9, 0x38, 0x37, 0x22, 0x90, 0x88, 0xBB, 0xA9, 0x1A, 0x46,
+	0x53, 0x24, 0x32, 0x13, 0x20, 0x32, 0x30, 0x34, 0x81, 0xB8, 0xCF, 0xAC,
+	0xCB, 0xA9, 0x9A, 0x21, 0x98, 0x11, 0x00, 0xB8, 0x2C, 0x07, 0x38, 0x45,
+	0x63, 0x14, 0x10, 0x80, 0x10, 0xBA, 0x8B, 0x81, 0xBA, 0xBC, 0x19, 0xC9,
+	0xA9, 0x8B, 0x31, 0x41, 0x15, 0x10, 0xDA, 0x2B, 0x72, 0x25, 0x00, 0x08,
+	0xBA, 0xCA, 0x9C, 0x81, 0xBB, 0xDD, 0x0A, 0x11, 0x11, 0x21, 0x11, 0x01,
+	0x42, 0x34, 0x13, 0xC9, 0x0B, 0x34, 0x22, 0x44, 0x23, 0xDA, 0xAB, 0xBA,
+	0xCA, 0xCD, 0xBB, 0x99, 0x8A, 0x11, 0x12, 0xF9, 0x9D, 0x99, 0x08, 0xA9,
+	0x0A, 0xA8, 0xBC, 0x1C, 0x27, 0x81, 0x88, 0x30, 0x04, 0x08, 0x01, 0xFB,
+	0xDF, 0xBA, 0xA9, 0x8A, 0x99, 0x21, 0x32, 0x12, 0xC9, 0xEC, 0xDC, 0x99,
+	0x08, 0x10, 0x73, 0x34, 0x34, 0x44, 0x12, 0x01, 0x81, 0xB9, 0x9C, 0xAA,
+	0x9A, 0x88, 0x8A, 0x99, 0xAA, 0xBE, 0x49, 0xA1, 0xAC, 0xAA, 0x99, 0x10,
+	0x76, 0x23, 0x53, 0x12, 0x22, 0x13, 0x88, 0xCB, 0x99, 0xCB, 0x99, 0xBB,
+	0xBB, 0x8B, 0x24, 0xA8, 0x10, 0x10, 0xB3, 0xCF, 0xA9, 0xBB, 0x51, 0x46,
+	0x22, 0x21, 0x01, 0x21, 0x81, 0xC9, 0xBF, 0x99, 0x9A, 0xBA, 0x8A, 0x10,
+	0x76, 0x32, 0x22, 0xC9, 0xCB, 0xBC, 0x09, 0x20, 0x33, 0x22, 0x13, 0x52,
+	0x12, 0x01, 0xEA, 0xAA, 0x9A, 0xA9, 0xBD, 0xA9, 0xAC, 0x88, 0x21, 0x81,
+	0xFB, 0xBE, 0xBC, 0x99, 0x38, 0x26, 0x81, 0x18, 0x22, 0xB9, 0xAD, 0x50,
+	0x24, 0x89, 0x98, 0x8A, 0xFB, 0xAF, 0xA8, 0x9A, 0xA8, 0x18, 0x90, 0xAA,
+	0xDC, 0x89, 0xBA, 0x2A, 0x64, 0x37, 0x34, 0x35, 0x13, 0x01, 0x99, 0x99,
+	0xCA, 0x09, 0xA9, 0xBB, 0x19, 0x81, 0xFC, 0x8B, 0x98, 0x08, 0x80, 0x08,
+	0xBA, 0x8A, 0x28, 0x77, 0x23, 0x33, 0x25, 0x01, 0x01, 0x90, 0xA9, 0xDB,
+	0x99, 0x9A, 0x80, 0x20, 0x92, 0xDB, 0x9A, 0x89, 0xFB, 0x19, 0x82, 0x99,
+	0x9A, 0x62, 0x34, 0x54, 0x33, 0x22, 0xB8, 0xCC, 0xDB, 0xAC, 0xA9, 0x10,
+	0x00, 0x73, 0x01, 0x99, 0x00, 0x01, 0x99, 0x08, 0x28, 0xB0, 0x9A, 0x50,
+	0x26, 0x33, 0x45, 0x02, 0xA9, 0x99, 0xFB, 0xAC, 0x9B, 0x88, 0x98, 0xA9,
+	0x99, 0xA9, 0xBC, 0xCD, 0xAC, 0x9B, 0x99, 0x50, 0x26, 0x21, 0x12, 0xB9,
+	0xAE, 0x88, 0xB8, 0x19, 0x11, 0xFB, 0xCF, 0x89, 0x88, 0x18, 0x01, 0x98,
+	0x9A, 0x62, 0x23, 0x63, 0x23, 0x43, 0x44, 0x13, 0x20, 0x12, 0x89, 0xBD,
+	0x09, 0xC9, 0x0B, 0x91, 0x9A, 0xDA, 0xAB, 0xEB, 0x9B, 0x80, 0x0B, 0x80,
+	0x72, 0x43, 0x53, 0x23, 0x22, 0x12, 0x12, 0x9A, 0xB8, 0x8A, 0xB9, 0x8A,
+	0xCC, 0x39, 0x01, 0x02, 0x9A, 0xF9, 0xAF, 0x09, 0x31, 0x32, 0x12, 0x99,
+	0xC9, 0x0D, 0x33, 0xA0, 0xEF, 0x8A, 0x81, 0x19, 0x13, 0xA8, 0xCE, 0x1A,
+	0x11, 0x42, 0x24, 0x02, 0x88, 0x10, 0x33, 0x04, 0x19, 0x80, 0x0B, 0x21,
+	0x01, 0xF9, 0xAF, 0xEB, 0x9A, 0x00, 0x89, 0x89, 0xBA, 0xCE, 0x19, 0xA0,
+	0xCB, 0xBA, 0xBA, 0x19, 0x46, 0x01, 0x00, 0xB8, 0xAF, 0x28, 0xB8, 0x9B,
+	0xB9, 0xFF, 0xAB, 0x08, 0x88, 0x20, 0x11, 0x18, 0x92, 0x8C, 0x51, 0x53,
+	0x54, 0x43, 0x33, 0x42, 0x24, 0x00, 0x08, 0x80, 0xA9, 0xDC, 0x9B, 0x81,
+	0xBA, 0xBA, 0x89, 0xEA, 0x0A, 0x91, 0xAD, 0x89, 0x31, 0x34, 0x24, 0x45,
+	0x22, 0x24, 0x20, 0x44, 0x90, 0x89, 0x8A, 0x80, 0x99, 0xA9, 0xDB, 0x2B,
+	0x84, 0xA9, 0xCE, 0x48, 0x14, 0x21, 0x80, 0x98, 0xDD, 0x89, 0x89, 0x89,
+	0x10, 0x98, 0x38, 0x26, 0xA1, 0xCD, 0x99, 0x09, 0x22, 0x00, 0x20, 0x32,
+	0x37, 0x11, 0x34, 0x02, 0x12, 0xEA, 0xAB, 0x9A, 0x21, 0xA0, 0x8B, 0x83,
+	0xFE, 0xAC, 0x9A, 0xA8, 0xBC, 0xA9, 0xBB, 0x19, 0x81, 0x08, 0xD9, 0xDF,
+	0x09, 0x82, 0xA9, 0x99, 0xF9, 0xBB, 0xD9, 0xAB, 0x08, 0x09, 0x22, 0x88,
+	0xB9, 0x2C, 0x46, 0x32, 0x54, 0x24, 0x21, 0x45, 0x33, 0x42, 0x11, 0x11,
+	0x0A, 0x82, 0xCF, 0xAA, 0x8A, 0x21, 0x21, 0xA1, 0xBD, 0xBC, 0xBA, 0xAB,
+	0x28, 0x43, 0x42, 0x24, 0x81, 0x11, 0x10, 0x55, 0x34, 0x32, 0x82, 0x8A,
+	0x33, 0x01, 0xB8, 0x8C, 0x01, 0x09, 0x63, 0x35, 0xC9, 0xCA, 0xAC, 0x99,
+	0xAA, 0xDD, 0xAB, 0x1A, 0x34, 0x11, 0x81, 0xB9, 0xAB, 0xCE, 0x08, 0x20,
+	0x44, 0x22, 0x53, 0x11, 0x98, 0x99, 0x09, 0x52, 0x92, 0xEB, 0x1A, 0x01,
+	0xA9, 0xAB, 0x48, 0x03, 0x88, 0xEC, 0xCB, 0xBB, 0xBB, 0xAC, 0xBB, 0x29,
+	0x14, 0xFA, 0x8F, 0x98, 0xCB, 0x28, 0x23, 0x22, 0xEC, 0x0A, 0xDB, 0xBC,
+	0xBA, 0x09, 0x20, 0x25, 0x33, 0x14, 0x31, 0x25, 0x00, 0x20, 0x47, 0x13,
+	0x11, 0x20, 0x15, 0x98, 0xA8, 0x89, 0xBA, 0x9D, 0x98, 0xCC, 0x8A, 0x91,
+	0xAB, 0x8A, 0x42, 0xA0, 0x9D, 0x21, 0x21, 0x04, 0xAA, 0x65, 0x24, 0x23,
+	0x10, 0x23, 0x10, 0xC0, 0xAD, 0x18, 0x54, 0x13, 0x01, 0x09, 0x12, 0x98,
+	0xFC, 0xAA, 0xCA, 0x9B, 0x11, 0x11, 0x81, 0xBA, 0xAE, 0x89, 0xB9, 0xDD,
+	0x8A, 0x10, 0x41, 0x33, 0x21, 0x43, 0x33, 0x81, 0x20, 0x21, 0x84, 0xCC,
+	0x08, 0x99, 0x28, 0x36, 0x11, 0xB8, 0xCF, 0xCC, 0x9B, 0x98, 0xAA, 0x9A,
+	0xBA, 0xCC, 0x39, 0x27, 0x08, 0xB2, 0xEF, 0x18, 0xC9, 0x8A, 0x98, 0x88,
+	0xA9, 0x09, 0xA8, 0x28, 0x27, 0x99, 0x52, 0x43, 0x23, 0x63, 0x12, 0x10,
+	0x23, 0x10, 0x47, 0x22, 0x80, 0xCB, 0x9A, 0x99, 0x11, 0xA9, 0xAD, 0x98,
+	0x8A, 0xC9, 0xAC, 0xCC, 0x9B, 0x31, 0x34, 0x33, 0x81, 0x41, 0x21, 0x15,
+	0x99, 0x8A, 0x73, 0x33, 0x15, 0x12, 0x21, 0x34, 0x13, 0x11, 0xA0, 0xFF,
+	0x9B, 0x9A, 0x20, 0x32, 0x91, 0xAA, 0x80, 0xE8, 0xCD, 0xBB, 0x9A, 0x30,
+	0x33, 0x02, 0x12, 0x01, 0x00, 0x44, 0x81, 0x81, 0x8A, 0x21, 0x46, 0x01,
+	0x98, 0x19, 0x26, 0x00, 0xEB, 0xAB, 0xAE, 0x88, 0xAA, 0x9A, 0x30, 0x01,
+	0x81, 0xDC, 0x09, 0xFA, 0xBF, 0xAA, 0xA9, 0xA9, 0xA8, 0xBE, 0xAA, 0xAB,
+	0xBA, 0x1A, 0x45, 0x25, 0x44, 0x24, 0x00, 0x21, 0x81, 0x53, 0x24, 0x12,
+	0x12, 0x21, 0x14, 0xCA, 0x18, 0xA0, 0x0A, 0xB2, 0xCF, 0x99, 0xB9, 0xBD,
+	0x89, 0x89, 0x81, 0x9A, 0x81, 0x9C, 0x52, 0x82, 0x2B, 0x37, 0x00, 0x53,
+	0x23, 0x33, 0x15, 0x21, 0x10, 0x63, 0x13, 0xA8, 0x9C, 0xBA, 0x38, 0x17,
+	0xB0, 0xBB, 0xDB, 0x9A, 0xA8, 0xBD, 0xBC, 0x09, 0x21, 0x91, 0x99, 0xCA,
+	0x9A, 0x41, 0x82, 0x1A, 0x12, 0x73, 0x25, 0x12, 0x98, 0x8A, 0x23, 0x51,
+	0x24, 0x01, 0xA9, 0x0A, 0x89, 0xF9, 0xAE, 0x89, 0xA8, 0xCF, 0xBA, 0xAA,
+	0x09, 0x34, 0xFB, 0x19, 0xC8, 0xAD, 0xAA, 0x9B, 0x09, 0x10, 0x98, 0x10,
+	0x63, 0x24, 0x31, 0x14, 0x11, 0x51, 0x57, 0x82, 0x28, 0x81, 0x40, 0x24,
+	0xA8, 0xAA, 0x89, 0x30, 0x04, 0x8A, 0x82, 0x9D, 0x81, 0xCE, 0x9A, 0xA9,
+	0x8C, 0x21, 0x80, 0x32, 0xC9, 0x28, 0x82, 0x08, 0x44, 0x12, 0x55, 0xA0,
+	0x70, 0x14, 0x00, 0x98, 0xAA, 0x29, 0x34, 0x80, 0xA9, 0x28, 0x16, 0xEA,
+	0x9A, 0xAA, 0x8B, 0x01, 0xA8, 0x30, 0xE8, 0xAB, 0x8A, 0x88, 0x99, 0xEA,
+	0x19, 0x23, 0x08, 0x00, 0x50, 0x25, 0x21, 0x23, 0x10, 0xB8, 0xDA, 0x1B,
+	0x36, 0xC0, 0xBB, 0x89, 0x8A, 0xB1, 0xFF, 0xBA, 0xAD, 0x00, 0x89, 0x10,
+	0xEA, 0xAC, 0xBB, 0x9A, 0x98, 0x8B, 0x88, 0x11, 0xC0, 0x0D, 0x12, 0x75,
+	0x14, 0x11, 0x23, 0x32, 0x44, 0x11, 0x32, 0x03, 0x52, 0x11, 0x31, 0x26,
+	0xA8, 0xA9, 0x08, 0x01, 0xC9, 0xBC, 0xCB, 0x1C, 0x33, 0xF9, 0xAC, 0xBA,
+	0x9C, 0x31, 0x13, 0x33, 0x12, 0x21, 0x99, 0x28, 0x77, 0x01, 0x08, 0x80,
+	0x18, 0x46, 0x83, 0x9A, 0x21, 0x01, 0xA9, 0xDD, 0xBB, 0x19, 0x22, 0x12,
+	0xB8, 0xCB, 0xBE, 0x9A, 0x99, 0x88, 0x18, 0x23, 0x62, 0xA3, 0xBD, 0xBB,
+	0x0B, 0x23, 0xA0, 0xBB, 0xA9, 0x19, 0x45, 0xE0, 0xBE, 0xAB, 0x42, 0x03,
+	0xCB, 0x08, 0xF9, 0x1B, 0xA4, 0xBF, 0xA9, 0xBC, 0x9B, 0x20, 0x02, 0x00,
+	0x98, 0x88, 0x20, 0x47, 0xA9, 0x40, 0x83, 0x71, 0x37, 0x81, 0x80, 0x01,
+	0x08, 0x24, 0x81, 0x89, 0x08, 0x37, 0x01, 0x08, 0x9A, 0xAA, 0x40, 0xC0,
+	0x8C, 0x80, 0x80, 0x01, 0xA0, 0xDC, 0x8B, 0x08, 0x53, 0x12, 0x04, 0xBB,
+	0x52, 0x24, 0xB0, 0xAA, 0xCD, 0x71, 0x14, 0x00, 0x98, 0xBB, 0x09, 0x22,
+	0x00, 0xB0, 0xAE, 0x01, 0x11, 0xB0, 0xCC, 0xAD, 0x19, 0x01, 0x33, 0xB1,
+	0x9B, 0xFA, 0x8B, 0x01, 0xAB, 0x89, 0x02, 0x9C, 0xB8, 0xDF, 0x18, 0x88,
+	0xBA, 0x18, 0x90, 0xCB, 0x09, 0x83, 0x28, 0xF8, 0xFF, 0x8D, 0x88, 0x98,
+	0x98, 0x89, 0x12, 0xA8, 0x8C, 0x11, 0x39, 0x67, 0x00, 0x18, 0x31, 0x23,
+	0x42, 0x27, 0x90, 0x09, 0x21, 0x10, 0x44, 0x81, 0x8B, 0x32, 0x98, 0x51,
+	0xB2, 0xAF, 0x98, 0x89, 0x10, 0xA8, 0x08, 0x12, 0x21, 0x82, 0xCD, 0x40,
+	0x03, 0x99, 0x66, 0x02, 0x98, 0xBC, 0x19, 0x52, 0x35, 0x91, 0xBB, 0x88,
+	0xAA, 0x08, 0x00, 0xCA, 0x9C, 0x80, 0x41, 0x82, 0xDC, 0xBC, 0x9C, 0x01,
+	0x10, 0x44, 0x90, 0xDA, 0xAA, 0x9A, 0x28, 0x22, 0x10, 0x01, 0xCA, 0xB9,
+	0x9C, 0xB9, 0xDD, 0x9C, 0x31, 0x91, 0x28, 0xEA, 0x1A, 0xFB, 0xBE, 0x99,
+	0x08, 0xB8, 0xAB, 0xBA, 0x5B, 0x27, 0xA0, 0x9A, 0x99, 0x41, 0x12, 0x21,
+	0x52, 0x25, 0x32, 0x15, 0x01, 0x22, 0x82, 0x10, 0x64, 0x13, 0x18, 0xA0,
+	0x49, 0x36, 0x82, 0xFB, 0x0A, 0x00, 0x28, 0x92, 0xAE, 0x19, 0x33, 0x24,
+	0x01, 0xD9, 0xBD, 0x10, 0x11, 0x21, 0xA0, 0x09, 0x41, 0x46, 0x81, 0xB9,
+	0xCE, 0x09, 0x21, 0x31, 0x02, 0xA8, 0x0A, 0x11, 0xEB, 0xAC, 0x99, 0x28,
+	0x15, 0x80, 0x98, 0x99, 0xCA, 0xAE, 0x98, 0x9A, 0x31, 0x12, 0x81, 0xA9,
+	0xEC, 0x9C, 0x00, 0xEC, 0x8B, 0x01, 0x18, 0xB0, 0x59, 0xB3, 0xAF, 0xCA,
+	0x9C, 0x99, 0x20, 0x90, 0x38, 0xB1, 0x0C, 0x90, 0x9C, 0x13, 0x9A, 0x71,
+	0x54, 0x34, 0x34, 0x81, 0xAA, 0x9B, 0x53, 0x25, 0x21, 0x21, 0x00, 0x53,
+	0x82, 0xAC, 0xA0, 0x0B, 0x14, 0x10, 0x04, 0x81, 0xDA, 0x28, 0x90, 0x39,
+	0xB1, 0x0D, 0x47, 0x81, 0x99, 0xBC, 0x8A, 0x42, 0x34, 0x04, 0xA9, 0xFB,
+	0x8B, 0x00, 0x31, 0x91, 0x89, 0x08, 0x52, 0x02, 0xDC, 0xAA, 0x9A, 0x31,
+	0x24, 0x22, 0xB8, 0xBD, 0xCA, 0x8A, 0x98, 0x18, 0x00, 0x09, 0xB0, 0xDF,
+	0xBB, 0x99, 0xC9, 0x9D, 0x18, 0xC8, 0x9D, 0x33, 0xFB, 0x29, 0xF9, 0x1B,
+	0x90, 0x99, 0xAB, 0x21, 0x88, 0x55, 0xA1, 0x08, 0xC8, 0x0B, 0x13, 0x61,
+	0x35, 0x12, 0x11, 0x33, 0x14, 0xB9, 0x8C, 0x11, 0x72, 0x25, 0x01, 0x80,
+	0x18, 0xA8, 0xA9, 0xBA, 0x30, 0x10, 0x77, 0x11, 0x88, 0x9A, 0x98, 0x18,
+	0x02, 0xEB, 0x0A, 0x20, 0x44, 0x13, 0xB9, 0xAC, 0xDA, 0xAC, 0x10, 0x32,
+	0x12, 0xA8, 0xBB, 0x40, 0x14, 0xC0, 0xBC, 0x9A, 0x41, 0x34, 0x14, 0x81,
+	0xC9, 0xDC, 0x9A, 0x88, 0x10, 0x10, 0x80, 0xBA, 0xBC, 0xBD, 0x9C, 0xEA,
+	0xAB, 0xA9, 0x2A, 0x26, 0xA0, 0xCA, 0xAE, 0x18, 0x98, 0x98, 0xFC, 0x89,
+	0x81, 0x11, 0xBA, 0x8A, 0x89, 0x52, 0x82, 0x99, 0x55, 0x32, 0x34, 0x91,
+	0x1A, 0x33, 0x65, 0x24, 0x00, 0x88, 0x20, 0x34, 0x32, 0x02, 0x9B, 0xB0,
+	0x5A, 0x36, 0x33, 0x90, 0xBC, 0x9C, 0x62, 0x83, 0xC9, 0xAA, 0x89, 0x31,
+	0x24, 0x81, 0xDA, 0x9A, 0xCB, 0x09, 0xA0, 0x09, 0x81, 0x71, 0x03, 0xBA,
+	0xDC, 0x8A, 0x12, 0x89, 0x33, 0x91, 0x32, 0x82, 0xFA, 0xBF, 0x89, 0x99,
+	0x48, 0x13, 0x89, 0xB9, 0xCC, 0xCC, 0xCB, 0xAA, 0x09, 0x21, 0xA1, 0xCF,
+	0xCB, 0xAA, 0xAA, 0x89, 0x98, 0x09, 0x01, 0xEB, 0xCC, 0x8A, 0x22, 0x43,
+	0x13, 0x09, 0x38, 0x77, 0x13, 0x22, 0x98, 0x29, 0x36, 0x01, 0x43, 0x81,
+	0x51, 0x23, 0xA9, 0x8A, 0x52, 0x24, 0x23, 0xC8, 0x2A, 0x43, 0x43, 0xA1,
+	0x9B, 0xC9, 0x9C, 0x32, 0x33, 0x26, 0xB0, 0xBE, 0x9A, 0xA8, 0x89, 0x90,
+	0x9A, 0x33, 0xC9, 0xAA, 0xBC, 0xC9, 0xBD, 0x88, 0x10, 0x34, 0x22, 0x81,
+	0xDA, 0xEB, 0xCB, 0x08, 0x11, 0x31, 0xC1, 0x9D, 0x10, 0xD8, 0xAD, 0xDB,
+	0x8A, 0x81, 0xCA, 0x9B, 0xA9, 0xAC, 0x99, 0x99, 0xBC, 0x19, 0xFA, 0x0D,
+	0x98, 0x19, 0x81, 0x4A, 0x15, 0xDA, 0x29, 0x73, 0x33, 0x98, 0x08, 0x89,
+	0x57, 0x02, 0x99, 0x10, 0x31, 0x25, 0x11, 0x00, 0x20, 0x03, 0x0A, 0x37,
+	0x22, 0x02, 0xB8, 0x8A, 0x21, 0x25, 0xB0, 0x28, 0x82, 0xB8, 0xCF, 0x9B,
+	0x9A, 0x90, 0xCA, 0x18, 0xA0, 0xAC, 0xEB, 0xBC, 0xB9, 0xAB, 0x89, 0x54,
+	0x04, 0xB8, 0xBD, 0x8A, 0x80, 0x10, 0x98, 0x1A, 0x23, 0xD8, 0x9B, 0xFA,
+	0xAC, 0x9A, 0x09, 0x32, 0xA2, 0xFF, 0x9E, 0x00, 0x08, 0x00, 0xC9, 0x8A,
+	0x23, 0x90, 0xFB, 0xAB, 0xA9, 0x38, 0x15, 0x19, 0x92, 0xBE, 0x08, 0x32,
+	0x23, 0xB9, 0x71, 0x85, 0x40, 0x03, 0x8A, 0x22, 0x22, 0x13, 0x40, 0x26,
+	0x02, 0x54, 0x81, 0x38, 0x23, 0xA9, 0x09, 0x64, 0x12, 0x63, 0x92, 0x9C,
+	0x01, 0xB9, 0x30, 0x82, 0xAB, 0x0A, 0xA8, 0x4A, 0x07, 0xEC, 0x9A, 0x88,
+	0x08, 0x00, 0x88, 0x99, 0x88, 0xFA, 0xAB, 0xA8, 0x0A, 0x13, 0x98, 0x9A,
+	0xA8, 0xFF, 0x89, 0x90, 0xB9, 0xAB, 0x40, 0x26, 0xC8, 0xBF, 0x8A, 0x31,
+	0x33, 0xB0, 0xCE, 0x89, 0x31, 0x01, 0x99, 0xCA, 0x9C, 0x20, 0x13, 0x01,
+	0x88, 0xDB, 0x1B, 0x35, 0x02, 0x20, 0x11, 0x64, 0x23, 0xA0, 0xAA, 0x71,
+	0x26, 0x21, 0x90, 0x9A, 0x72, 0x33, 0x83, 0x9C, 0x08, 0x29, 0x46, 0x01,
+	0x00, 0x98, 0x9A, 0x0A, 0x22, 0x21, 0x21, 0xF1, 0x0C, 0x01, 0x9A, 0x9A,
+	0x88, 0xA9, 0xAC, 0xB9, 0x1C, 0x25, 0xB1, 0xAF, 0x9A, 0x99, 0x30, 0xA3,
+	0xAE, 0x98, 0xAB, 0x8B, 0xD9, 0xCD, 0xAB, 0x89, 0x30, 0x03, 0xFC, 0xBD,
+	0x89, 0x10, 0x10, 0x90, 0xCB, 0x8A, 0x00, 0x8A, 0x22, 0xD8, 0x0A, 0xFB,
+	0x8D, 0x32, 0x02, 0x89, 0x91, 0xAA, 0x61, 0x34, 0x01, 0x19, 0x46, 0x91,
+	0x89, 0x21, 0x41, 0x57, 0x03, 0x9A, 0x31, 0x13, 0x18, 0x53, 0x81, 0x61,
+	0x13, 0x90, 0x49, 0x15, 0xB9, 0x08, 0x00, 0x40, 0x35, 0xC9, 0x1A, 0x13,
+	0xCC, 0x09, 0x9A, 0x19, 0x14, 0xDA, 0x1A, 0x91, 0xAC, 0x99, 0xCA, 0x8B,
+	0x02, 0xEB, 0x8A, 0x80, 0xBD, 0x99, 0xDA, 0xAC, 0x08, 0x99, 0x19, 0x35,
+	0xFA, 0x9C, 0x88, 0x28, 0x02, 0xCA, 0xBC, 0x30, 0x34, 0xA1, 0xBD, 0xBB,
+	0x8B, 0x53, 0x12, 0x91, 0x8B, 0x91, 0x0D, 0x92, 0xAE, 0x72, 0x23, 0x80,
+	0x88, 0x08, 0x80, 0x73, 0x05, 0x19, 0x23, 0x90, 0x40, 0x44, 0x34, 0xB9,
+	0x0A, 0x80, 0x73, 0x17, 0x99, 0x08, 0x01, 0x88, 0x41, 0x92, 0x9B, 0x43,
+	0xDA, 0x28, 0x02, 0x9A, 0x88, 0xA9, 0x1A, 0x83, 0xCF, 0x29, 0x91, 0xAA,
+	0x99, 0xA9, 0xBB, 0xA0, 0xDF, 0x89, 0x80, 0xCA, 0x99, 0xBA, 0xAB, 0x98,
+	0xED, 0x8B, 0x52, 0x92, 0xAC, 0xCC, 0x8B, 0x32, 0x43, 0xC1, 0xBC, 0x9A,
+	0x21, 0x24, 0xA8, 0xBC, 0xAB, 0x38, 0x26, 0x80, 0x98, 0xAC, 0x80, 0x38,
+	0x47, 0x98, 0xAA, 0x38, 0x36, 0x23, 0xA8, 0x20, 0x11, 0x61, 0x24, 0x00,
+	0x63, 0x23, 0xA8, 0x09, 0x21, 0x30, 0x67, 0x02, 0x98, 0x08, 0x9A, 0x61,
+	0x23, 0xA0, 0x08, 0x01, 0x88, 0x01, 0xBE, 0x30, 0x92, 0x9C, 0x42, 0xB1,
+	0x9D, 0x00, 0xFB, 0x9A, 0x99, 0x88, 0x99, 0xCB, 0xBB, 0x0A, 0xA8, 0xFC,
+	0xAC, 0xBC, 0x39, 0x93, 0xBC, 0x88, 0xDC, 0x0A, 0x24, 0xC9, 0xAB, 0x09,
+	0x43, 0x02, 0xFC, 0x8A, 0x33, 0x80, 0x90, 0xAC, 0x19, 0x35, 0x91, 0xCB,
+	0x8B, 0x33, 0x63, 0x83, 0xBA, 0x08, 0x30, 0x47, 0x23, 0xDB, 0x1A, 0x35,
+	0x02, 0x31, 0x93, 0x0A, 0x32, 0xB1, 0x6A, 0x45, 0x81, 0x18, 0x81, 0xAA,
+	0x71, 0x33, 0x81, 0xBA, 0xD9, 0x1A, 0x25, 0x01, 0x80, 0xA9, 0x48, 0x82,
+	0xBC, 0x9C, 0x80, 0x62, 0xC0, 0x0A, 0x80, 0xAC, 0x30, 0xF0, 0xAE, 0x21,
+	0x80, 0xB9, 0x9C, 0x30, 0x05, 0xBD, 0x9A, 0xA9, 0x28, 0x24, 0x81, 0xBE,
+	0x28, 0x13, 0xDB, 0xCB, 0x89, 0x28, 0x47, 0x81, 0x98, 0xCB, 0x09, 0x34,
+	0xA2, 0xCD, 0x09, 0x42, 0x22, 0x81, 0xDA, 0x8A, 0x00, 0x11, 0x81, 0xA9,
+	0x49, 0x47, 0x01, 0xC8, 0x9B, 0x31, 0x26, 0xA0, 0x09, 0x11, 0x38, 0x37,
+	0xA9, 0x8A, 0xA9, 0x50, 0x14, 0x99, 0x30, 0x04, 0xA9, 0x19, 0x31, 0xC0,
+	0xAE, 0x52, 0x03, 0xAB, 0x10, 0x90, 0xB9, 0x8A, 0x42, 0xB0, 0xCC, 0x1A,
+	0x35, 0xE9, 0xBE, 0x20, 0x04, 0xAA, 0x0A, 0x88, 0xAB, 0x30, 0x92, 0xEC,
+	0xBB, 0x30, 0x45, 0x92, 0xBF, 0x29, 0x13, 0x98, 0x9A, 0x08, 0x88, 0x73,
+	0x04, 0xB9, 0xCC, 0x09, 0x23, 0x02, 0x38, 0xA2, 0xBD, 0x50, 0x04, 0xBA,
+	0x29, 0xA8, 0x58, 0x02, 0x09, 0x43, 0x01, 0x1A, 0x84, 0x8D, 0x93, 0x9D,
+	0x65, 0x82, 0x99, 0x18, 0x90, 0x0C, 0x55, 0xA1, 0xAC, 0x21, 0x01, 0x80,
+	0x08, 0x09, 0x10, 0x84, 0x8A, 0xB1, 0xAF, 0x63, 0x01, 0x98, 0xC9, 0x0A,
+	0x33, 0xC1, 0x1A, 0xC0, 0xAC, 0x50, 0x93, 0x9A, 0xA0, 0xCF, 0x50, 0x04,
+	0xB9, 0x9A, 0x08, 0x21, 0x91, 0x01, 0xF9, 0x8B, 0x61, 0x04, 0xCB, 0x0A,
+	0x21, 0x12, 0x91, 0xAE, 0x11, 0xA8, 0x2A, 0x37, 0xA0, 0x9C, 0x00, 0xA9,
+	0x30, 0x16, 0x98, 0xCA, 0x28, 0x14, 0xB8, 0x1A, 0x11, 0x32, 0x82, 0x20,
+	0xD4, 0x9E, 0x31, 0x26, 0xB8, 0xAB, 0x30, 0x44, 0x81, 0x9A, 0x89, 0x14,
+	0xBB, 0xA8, 0x38, 0x47, 0x04, 0xBB, 0xDB, 0x08, 0x41, 0x93, 0xAC, 0x21,
+	0x34, 0xC1, 0xBE, 0x9B, 0x51, 0x35, 0xA1, 0xCC, 0x0A, 0x11, 0x33, 0x91,
+	0xBF, 0x30, 0xA2, 0x19, 0x81, 0xCC, 0x38, 0x17, 0xA9, 0x88, 0xA0, 0x18,
+	0x24, 0xC1, 0x09, 0xAA, 0x62, 0xA2, 0x9D, 0x10, 0x20, 0x26, 0xD9, 0x89,
+	0x80, 0x21, 0x93, 0xBD, 0x38, 0x11, 0x31, 0x81, 0xBD, 0x19, 0x31, 0x12,
+	0xC9, 0x09, 0x43, 0x24, 0xFA, 0x8C, 0x33, 0xB8, 0x9C, 0x41, 0x34, 0xA9,
+	0xDA, 0x9C, 0x53, 0x90, 0x28, 0x02, 0xAD, 0x31, 0xA8, 0x88, 0xA0, 0x68,
+	0x06, 0xBC, 0x09, 0x42, 0x14, 0xCA, 0x9A, 0x88, 0x63, 0x91, 0x89, 0x88,
+	0x99, 0x22, 0x02, 0xFB, 0x1D, 0x34, 0xB8, 0x19, 0xB8, 0x0D, 0x35, 0x90,
+	0x88, 0xFB, 0x29, 0x32, 0x13, 0xCD, 0x0A, 0x14, 0x08, 0xA0, 0x0A, 0x24,
+	0xA9, 0x58, 0x92, 0xBD, 0x18, 0x22, 0x04, 0xA9, 0xAD, 0x32, 0x81, 0x9A,
+	0x62, 0xB0, 0x9C, 0x02, 0x08, 0x25, 0xCB, 0x28, 0x84, 0x9C, 0x01, 0x28,
+	0xC0, 0x1C, 0x26, 0xB8, 0xBB, 0x1B, 0x67, 0xA1, 0x9A, 0x89, 0x30, 0x13,
+	0xA0, 0xBA, 0x89, 0x80, 0x67, 0x92, 0xAE, 0x10, 0x01, 0x02, 0xBB, 0x21,
+	0xB8, 0x40, 0x91, 0x9C, 0x01, 0x48, 0x16, 0xAA, 0xE9, 0x1C, 0x44, 0x90,
+	0x9B, 0x31, 0x90, 0x9B, 0x12, 0x80, 0x33, 0x0A, 0x15, 0xFF, 0x18, 0x10,
+	0x33, 0xD8, 0x8B, 0x82, 0x2A, 0x84, 0x9A, 0x32, 0xF9, 0x3C, 0x15, 0xB9,
+	0x9A, 0x62, 0xA1, 0x1C, 0x02, 0xAA, 0x28, 0x81, 0x30, 0x91, 0xAA, 0x8C,
+	0xB1, 0x6A, 0x16, 0x90, 0xEA, 0x8B, 0x45, 0x81, 0x99, 0x0A, 0x11, 0xB8,
+	0x39, 0x15, 0xCA, 0x0A, 0x62, 0xA1, 0x8D, 0x13, 0x8A, 0xA0, 0x8C, 0x46,
+	0xA0, 0x9C, 0x31, 0x92, 0xA9, 0x89, 0x42, 0xE9, 0x40, 0x81, 0x89, 0xBB,
+	0x70, 0x14, 0xBB, 0x0B, 0x34, 0x00, 0xB8, 0x9E, 0x32, 0xB1, 0x4A, 0x93,
+	0x9E, 0x11, 0x89, 0x21, 0xA3, 0x9F, 0x43, 0xA1, 0xAA, 0xBA, 0x58, 0x27,
+	0xC8, 0x0A, 0x02, 0x8A, 0x43, 0xA8, 0xAB, 0x10, 0x8A, 0x57, 0xB1, 0x9D,
+	0x21, 0x02, 0x99, 0xC9, 0x29, 0x17, 0x89, 0x01, 0xFB, 0x29, 0x15, 0xA8,
+	0x88, 0xDA, 0x50, 0x03, 0xBA, 0x8A, 0x20, 0x24, 0xA0, 0xBB, 0x28, 0x80,
+	0x61, 0x92, 0xBB, 0x9D, 0x44, 0x23, 0xF8, 0x9C, 0x41, 0x82, 0x99, 0x98,
+	0x08, 0x13, 0xBA, 0x73, 0xE2, 0x8B, 0x24, 0x90, 0x9A, 0x08, 0x30, 0x13,
+	0xEC, 0x38, 0x91, 0x09, 0xA2, 0x2A, 0x84, 0xAF, 0x52, 0xA2, 0xAA, 0x1A,
+	0x34, 0xA1, 0xAC, 0x20, 0xA1, 0x20, 0x83, 0x8B, 0xD0, 0x29, 0x04, 0x8A,
+	0x90, 0xCB, 0x74, 0xC3, 0x0C, 0x02, 0x99, 0x33, 0xCA, 0x38, 0xC8, 0x40,
+	0xA1, 0x0B, 0x63, 0xE9, 0x38, 0xB3, 0x0C, 0x13, 0x9A, 0x01, 0xD8, 0x39,
+	0x13, 0x90, 0xEB, 0x4A, 0x06, 0xAB, 0x31, 0xA1, 0x9A, 0x80, 0x71, 0xA4,
+	0x9E, 0x11, 0x11, 0x92, 0xBD, 0x20, 0x22, 0x81, 0xBD, 0x61, 0xC9, 0x49,
+	0x14, 0xBB, 0x19, 0x88, 0x63, 0xA1, 0x8E, 0x11, 0x09, 0x11, 0xB0, 0x2A,
+	0xD2, 0x2B, 0x17, 0xA9, 0x29, 0xA0, 0x29, 0x26, 0xBC, 0x39, 0x82, 0x99,
+	0x19, 0x14, 0xC8, 0x0B, 0x25, 0xB9, 0x29, 0x01, 0x28, 0xF9, 0x38, 0x83,
+	0x8B, 0xA2, 0xAE, 0x61, 0x03, 0xBA, 0xAC, 0x44, 0x98, 0x11, 0xA8, 0xAD,
+	0x43, 0x00, 0x98, 0x8B, 0x25, 0xEA, 0x29, 0x04, 0x89, 0x98, 0x28, 0x33,
+	0xE9, 0xAB, 0x61, 0x84, 0x9D, 0x31, 0xA8, 0x0B, 0x16, 0x99, 0x98, 0x00,
+	0x01, 0x99, 0x63, 0xD8, 0x2A, 0x92, 0x38, 0xA3, 0x8E, 0x91, 0x0A, 0x26,
+	0xB9, 0x39, 0xB0, 0x29, 0x23, 0xBD, 0x22, 0xBB, 0x75, 0x81, 0xBC, 0x29,
+	0x84, 0x29, 0x84, 0xCD, 0x20, 0x21, 0x90, 0x90, 0xAF, 0x31, 0x13, 0x99,
+	0xCA, 0x88, 0x73, 0x90, 0x0A, 0x92, 0xBB, 0x64, 0x90, 0x88, 0xDB, 0x50,
+	0x13, 0xCB, 0x0A, 0x42, 0x91, 0x09, 0xA9, 0x1C, 0x07, 0x99, 0x31, 0xEA,
+	0x28, 0x02, 0x98, 0x09, 0xC0, 0x3A, 0x37, 0xEB, 0x39, 0x93, 0x9A, 0x31,
+	0xA0, 0x8A, 0x81, 0x19, 0x13, 0xE9, 0x48, 0x93, 0xAD, 0x42, 0xD9, 0x48,
+	0xA2, 0x8D, 0x33, 0xA9, 0x19, 0x11, 0xCB, 0x42, 0xA0, 0x29, 0xC3, 0x9F,
+	0x35, 0xB0, 0x8C, 0x22, 0xB1, 0x1C, 0x03, 0xA9, 0x18, 0x12, 0xB9, 0x69,
+	0xC2, 0x0D, 0x05, 0x8A, 0x82, 0x9C, 0x44, 0xB0, 0x0C, 0x21, 0x80, 0xA9,
+	0x58, 0xB2, 0x0E, 0x34, 0xEB, 0x39, 0x94, 0x8A, 0x81, 0x20, 0xC2, 0x8D,
+	0x15, 0xA9, 0x28, 0xA2, 0x0B, 0x24, 0xDA, 0x20, 0x81, 0x08, 0xC9, 0x39,
+	0x13, 0xA9, 0x09, 0x32, 0xE3, 0x9F, 0x44, 0xC9, 0x30, 0xB8, 0x2B, 0x16,
+	0x9A, 0x08, 0x00, 0x08, 0xA8, 0x5A, 0x04, 0xBC, 0x28, 0x15, 0xB9, 0x8A,
+	0x13, 0x12, 0xFA, 0x29, 0x13, 0xDB, 0x21, 0x99, 0x53, 0xF9, 0x39, 0x83,
+	0xBB, 0x31, 0x10, 0x02, 0xCF, 0x39, 0x16, 0xBA, 0x29, 0x82, 0x19, 0x92,
+	0x9B, 0x08, 0x33, 0x82, 0xAF, 0x21, 0xA8, 0x29, 0x37, 0xEB, 0x89, 0x42,
+	0x82, 0xAD, 0x23, 0xAC, 0x43, 0xA9, 0x50, 0xC0, 0x8B, 0x43, 0x93, 0xAC,
+	0x80, 0x81, 0x42, 0xC0, 0x0D, 0x23, 0xB0, 0x8C, 0x54, 0xD9, 0x19, 0x13,
+	0x9A, 0x11, 0xBA, 0x42, 0xB2, 0x8C, 0x20, 0x83, 0x9D, 0x31, 0x91, 0x99,
+	0xAB, 0x45, 0x81, 0x9C, 0xB9, 0x72, 0xB6, 0x9C, 0x53, 0xA0, 0x0A, 0x08,
+	0x11, 0x88, 0xA9, 0x68, 0x84, 0xAE, 0x40, 0x92, 0x8A, 0x80, 0x08, 0x14,
+	0xDB, 0x58, 0x91, 0x0B, 0x81, 0x18, 0x14, 0xEC, 0x48, 0x83, 0xBC, 0x31,
+	0x82, 0x9B, 0x01, 0x80, 0x00, 0x92, 0x8F, 0x15, 0xD9, 0x18, 0x12, 0x98,
+	0x89, 0x18, 0x12, 0xC1, 0x8D, 0x52, 0xB8, 0x1A, 0x14, 0xA8, 0x98, 0x0A,
+	0x54, 0xC0, 0x2C, 0x04, 0xBB, 0x40, 0x93, 0x9B, 0x11, 0xB9, 0x41, 0x92,
+	0xEA, 0x48, 0xA3, 0x8C, 0x14, 0x9C, 0x10, 0x03, 0x0A, 0xC2, 0x8F, 0x34,
+	0xB9, 0x89, 0x33, 0xC8, 0x39, 0xC1, 0x28, 0xB9, 0x71, 0x91, 0x9B, 0x81,
+	0x41, 0xA0, 0x98, 0xB9, 0x69, 0x14, 0x89, 0xBD, 0x42, 0x81, 0xAB, 0x34,
+	0xFB, 0x48, 0x82, 0x8A, 0xA8, 0x49, 0x04, 0xBD, 0x41, 0x81, 0x99, 0x81,
+	0x19, 0xC0, 0x71, 0xA8, 0x28, 0xA8, 0x09, 0x32, 0x25, 0xFC, 0x19, 0x13,
+	0x89, 0x98, 0x29, 0xA4, 0x8E, 0x25, 0xCA, 0x38, 0xB3, 0x0D, 0x13, 0x88,
+	0xBA, 0x41, 0x99, 0x30, 0xB2, 0x8D, 0x13, 0x8D, 0x14, 0x9A, 0x01, 0xAA,
+	0x42, 0x81, 0x0A, 0xE9, 0x3A, 0x15, 0x88, 0xAA, 0x90, 0x50, 0x10, 0xF3,
+	0x8B, 0x33, 0xD0, 0x50, 0xC8, 0x2A, 0x14, 0xBB, 0x34, 0xFA, 0x49, 0x93,
+	0xAB, 0x42, 0xC8, 0x29, 0x03, 0xAA, 0x28, 0x88, 0x33, 0xFA, 0x1A, 0x14,
+	0x8B, 0x03, 0xBE, 0x34, 0xA0, 0x89, 0x90, 0x10, 0xA1, 0x59, 0x95, 0xAD,
+	0x31, 0x01, 0xA1, 0xAF, 0x53, 0xC0, 0x19, 0x13, 0xBA, 0x0A, 0x43, 0x80,
+	0xD0, 0x8C, 0x34, 0xA0, 0x0B, 0x80, 0x33, 0xF1, 0x0D, 0x43, 0xC0, 0x0B,
+	0x31, 0x93, 0xAE, 0x21, 0x03, 0xBB, 0x10, 0x88, 0x24, 0xDA, 0x1A, 0x27,
+	0xCA, 0x19, 0x12, 0x98, 0xA8, 0x50, 0x90, 0x89, 0x80, 0x51, 0xC0, 0x8B,
+	0x33, 0x80, 0xC1, 0x9F, 0x44, 0xA0, 0x8B, 0x21, 0xA0, 0x40, 0xFA, 0x31,
+	0xB1, 0x0B, 0x22, 0x01, 0xFB, 0x49, 0x83, 0x8A, 0xA1, 0x8E, 0x36, 0xB9,
+	0x0C, 0x14, 0xA9, 0x28, 0x81, 0x88, 0x9B, 0x25, 0xB9, 0x5A, 0xB4, 0x0F,
+	0x14, 0xA9, 0x1A, 0x03, 0x88, 0xB9, 0x70, 0xA1, 0x1C, 0x83, 0x8B, 0x23,
+	0xCC, 0x20, 0x25, 0xDC, 0x49, 0x02, 0xAA, 0x20, 0x99, 0x11, 0x91, 0x10,
+	0xBA, 0x29, 0x11, 0x29, 0x07, 0xBF, 0x41, 0x01, 0xA8, 0x1A, 0xA0, 0x59,
+	0x93, 0x9A, 0x01, 0x8A, 0xC1, 0x78, 0xB5, 0x0C, 0x22, 0xB9, 0x32, 0xE8,
+	0x2A, 0x16, 0xAC, 0x30, 0xB2, 0x2A, 0xA4, 0x0D, 0x14, 0xBA, 0x51, 0xA9,
+	0x28, 0xA0, 0x49, 0x93, 0x9E, 0x11, 0x11, 0x91, 0xBB, 0x32, 0xD9, 0x50,
+	0xB2, 0x2C, 0x96, 0xAC, 0x62, 0xB1, 0x0B, 0x13, 0xA9, 0x00, 0x89, 0x36,
+	0xEA, 0x09, 0x13, 0x98, 0x80, 0x0A, 0x14, 0x8D, 0x23, 0xEB, 0x50, 0xC1,
+	0x2B, 0x05, 0xAB, 0x32, 0xC8, 0x49, 0x91, 0x0C, 0x22, 0xCA, 0x50, 0xA1,
+	0x8B, 0x41, 0x90, 0x9A, 0x20, 0x82, 0x0A, 0x81, 0x9B, 0x71, 0xD1, 0x3A,
+	0x85, 0x8D, 0x22, 0xC9, 0x48, 0xB1, 0x39, 0xA2, 0x8F, 0x24, 0xBA, 0x38,
+	0x03, 0xBD, 0x41, 0x91, 0x99, 0x10, 0xA1, 0x0A, 0x25, 0xD9, 0x19, 0x84,
+	0x8C, 0x33, 0xA8, 0xBB, 0x29, 0x46, 0xB8, 0x1A, 0xA3, 0x9B, 0x34, 0x88,
+	0xC0, 0x0D, 0x25, 0x98, 0x8B, 0x80, 0x2A, 0x37, 0xE9, 0x19, 0x83, 0x8E,
+	0x33, 0xC0, 0x8B, 0x22, 0x88, 0x05, 0xBD, 0x41, 0x91, 0x8A, 0x04, 0x9D,
+	0x22, 0x88, 0x0A, 0x25, 0xEC, 0x38, 0x83, 0x8A, 0xA0, 0x09, 0x53, 0xA0,
+	0x9B, 0x10, 0x04, 0xCA, 0x40, 0x92, 0xBC, 0x50, 0x04, 0xCB, 0x18, 0x23,
+	0xD9, 0x3A, 0x03, 0xA9, 0x0E, 0x24, 0x98, 0xBA, 0x39, 0x26, 0xB8, 0xAC,
+	0x51, 0x03, 0xBD, 0x40, 0x81, 0x8A, 0x08, 0x21, 0x92, 0xBF, 0x52, 0x91,
+	0x9A, 0x10, 0x90, 0x30, 0xD1, 0x0D, 0x44, 0xC8, 0x0B, 0x15, 0xB9, 0x20,
+	0xA1, 0x19, 0x11, 0xB9, 0x58, 0xB3, 0x8F, 0x23, 0x98, 0xB9, 0x61, 0xB8,
+	0x39, 0x84, 0xBD, 0x44, 0xD9, 0x40, 0xB1, 0x0B, 0x33, 0xC9, 0x30, 0xD0,
+	0x1A, 0x33, 0xC8, 0x0B, 0x33, 0xA9, 0x01, 0xCA, 0x61, 0xA3, 0x9F, 0x42,
+	0xA0, 0x0B, 0x01, 0x30, 0xB0, 0xAF, 0x54, 0xB0, 0x8A, 0x21, 0x10, 0xC0,
+	0x1A, 0x22, 0xA8, 0xAB, 0x72, 0xA4, 0x9E, 0x31, 0x81, 0xA9, 0x80, 0x1A,
+	0x27, 0xCA, 0x09, 0x14, 0xA8, 0x8A, 0x43, 0xB8, 0xA9, 0x58, 0x04, 0xDB,
+	0x39, 0x15, 0xBB, 0x20, 0x81, 0x99, 0x21, 0x9B, 0x23, 0xAA, 0x8A, 0x14,
+	0x80, 0x9A, 0x10, 0xA3, 0x79, 0xFA, 0x79, 0x91, 0x89, 0x99, 0x40, 0x04,
+	0xDA, 0x1B, 0x35, 0xD8, 0x2A, 0x84, 0xAB, 0x51, 0xA0, 0x18, 0x90, 0x9B,
+	0x45, 0xA8, 0xAA, 0x41, 0x90, 0x18, 0xC0, 0x59, 0xB3, 0x0D, 0x15, 0xCB,
+	0x20, 0x03, 0xDB, 0x41, 0xA8, 0x18, 0x01, 0x9B, 0x42, 0xD9, 0x59, 0x92,
+	0x9B, 0x28, 0x13, 0xC8, 0x2C, 0x05, 0xEA, 0x40, 0xA2, 0x9B, 0x33, 0xCB,
+	0x53, 0xD8, 0x39, 0xA2, 0x0C, 0x15, 0xCA, 0x10, 0x02, 0x99, 0x28, 0x91,
+	0x9D, 0x52, 0xB0, 0x28, 0xC9, 0x50, 0xA0, 0x28, 0xC1, 0x8D, 0x35, 0xC8,
+	0x2A, 0x93, 0x8A, 0x02, 0x99, 0x30, 0xB0, 0x8E, 0x35, 0xB8, 0x0C, 0x12,
+	0x08, 0x98, 0x98, 0x49, 0x14, 0xBD, 0x38, 0x03, 0xA9, 0x99, 0x45, 0xE9,
+	0x28, 0x82, 0x8A, 0x81, 0x08, 0x89, 0x13, 0xD9, 0x2B, 0x37, 0xFB, 0x38,
+	0x03, 0xDC, 0x40, 0x92, 0x9C, 0x32, 0xB0, 0x0B, 0x15, 0xAB, 0x23, 0xCA,
+	0x40, 0xA1, 0x8B, 0x15, 0xC8, 0x18, 0x82, 0x09, 0x80, 0x80, 0xC8, 0x4B,
+	0x17, 0xCB, 0x48, 0x91, 0x8A, 0x43, 0xCA, 0x10, 0x88, 0x82, 0x38, 0xD0,
+	0x8E, 0x53, 0xB0, 0x1A, 0x00, 0x10, 0xAA, 0x31, 0x01, 0xA9, 0xAD, 0x72,
+	0x03, 0xCE, 0x38, 0x04, 0xAB, 0x02, 0x99, 0x40, 0xA4, 0x8E, 0x22, 0xB9,
+	0x39, 0x36, 0xFA, 0x2C, 0x23, 0xA8, 0x9A, 0x21, 0x88, 0x89, 0x42, 0x91,
+	0xCE, 0x49, 0x24, 0xD8, 0x0B, 0x33, 0xAA, 0x21, 0xA0, 0x9D, 0x34, 0xBA,
+	0x62, 0xD0, 0x0B, 0x25, 0xA9, 0x10, 0xBB, 0x71, 0x92, 0xBA, 0x38, 0x82,
+	0x99, 0x50, 0xC1, 0x0B, 0x03, 0x88, 0x32, 0xF8, 0x8C, 0x24, 0x80, 0xA9,
+	0x0A, 0x33, 0xA8, 0x1A, 0x04, 0xBD, 0x10, 0x44, 0xB1, 0xAC, 0x18, 0x42,
+	0x04, 0xFC, 0x39, 0x13, 0xCA, 0x29, 0x93, 0x0C, 0x24, 0xAC, 0x22, 0xB9,
+	0x30, 0xA3, 0x8C, 0x01, 0x9A, 0x55, 0xB2, 0xAF, 0x31, 0x22, 0xC9, 0x8B,
+	0x32, 0x99, 0x42, 0xA8, 0x99, 0x9C, 0x48, 0x37, 0xD8, 0xAB, 0x42, 0x02,
+	0x99, 0xAB, 0x42, 0x90, 0x0A, 0x33, 0xD8, 0x9D, 0x63, 0xA1, 0x8B, 0x01,
+	0x09, 0x34, 0xFB, 0x38, 0x83, 0x9D, 0x20, 0x02, 0xAC, 0x42, 0xCA, 0x40,
+	0xB3, 0x8F, 0x23, 0xB0, 0x0A, 0x11, 0x80, 0x01, 0xDB, 0x50, 0x81, 0xBB,
+	0x40, 0x92, 0xA9, 0x29, 0x27, 0xDB, 0x28, 0x80, 0x41, 0xE8, 0x09, 0x13,
+	0x19, 0xB0, 0x0D, 0x24, 0xC9, 0x29, 0x02, 0x89, 0x11, 0xCC, 0x68, 0x83,
+	0xCC, 0x40, 0xA2, 0x9B, 0x51, 0x91, 0xAB, 0x68, 0x92, 0x8C, 0x22, 0xA8,
+	0x1A, 0x21, 0x91, 0xBA, 0x28, 0x92, 0x29, 0x42, 0xF3, 0x8D, 0x20, 0x33,
+	0xF1, 0x8D, 0x33, 0xC8, 0x19, 0x14, 0xDA, 0x28, 0x82, 0x88, 0xA0, 0x0B,
+	0x26, 0x90, 0x9D, 0x32, 0xBA, 0x32, 0xA9, 0x89, 0x61, 0x93, 0xBE, 0x62,
+	0xB1, 0x0C, 0x24, 0xBA, 0x18, 0x28, 0x03, 0xDB, 0x39, 0xA0, 0x38, 0x04,
+	0x8D, 0x83, 0x9F, 0x63, 0xB0, 0x0B, 0x22, 0xA9, 0x39, 0x05, 0xBC, 0x40,
+	0xA2, 0x0A, 0x12, 0x98, 0xAC, 0x48, 0x17, 0xBB, 0x20, 0x99, 0x63, 0xB8,
+	0x0D, 0x24, 0x99, 0x98, 0x9B, 0x37, 0xC8, 0x1A, 0x03, 0x9A, 0x11, 0xC9,
+	0x71, 0xB1, 0x0D, 0x23, 0xC8, 0x10, 0xA0, 0x8B, 0x45, 0xC0, 0x2B, 0x03,
+	0xBB, 0x71, 0xB1, 0x0A, 0x12, 0x8B, 0x12, 0xB9, 0x58, 0x84, 0xDC, 0x48,
+	0x84, 0x9B, 0x00, 0x08, 0x04, 0xCA, 0x40, 0xB2, 0x0D, 0x22, 0xA8, 0x28,
+	0xB1, 0x1D, 0x14, 0x99, 0x89, 0x19, 0x16, 0xC9, 0x1A, 0x04, 0xA9, 0x11,
+	0xA0, 0x28, 0xA1, 0x0D, 0x12, 0x90, 0x62, 0xFA, 0x5B, 0x14, 0xBC, 0x48,
+	0x02, 0x9B, 0x08, 0x10, 0x01, 0x90, 0xCB, 0x38, 0x04, 0x8A, 0x16, 0xDD,
+	0x40, 0x91, 0x1A, 0x03, 0xBE, 0x50, 0x82, 0x99, 0x98, 0x29, 0x12, 0x90,
+	0xA9, 0x08, 0xA0, 0x58, 0x26, 0xFA, 0x1A, 0x14, 0x9A, 0x10, 0xA8, 0x08,
+	0x40, 0xB1, 0x19, 0x92, 0x0A, 0xB8, 0x6B, 0x16, 0xD9, 0x19, 0x12, 0xAB,
+	0x30, 0x25, 0xDA, 0x9B, 0x52, 0x05, 0xBC, 0x39, 0x14, 0xAB, 0x20, 0x12,
+	0xCD, 0x38, 0x13, 0x99, 0x93, 0xCF, 0x42, 0xA2, 0x0B, 0x01, 0x98, 0x09,
+	0x24, 0xD8, 0x1A, 0x92, 0x29, 0x17, 0xAE, 0x41, 0x91, 0xAB, 0x31, 0x02,
+	0xBA, 0x8C, 0x54, 0xB0, 0x9B, 0x34, 0xC1, 0x8C, 0x33, 0xA1, 0x9C, 0x10,
+	0x21, 0x84, 0xAF, 0x42, 0xC1, 0x9B, 0x35, 0xB0, 0x9B, 0x31, 0x13, 0xEA,
+	0x19, 0x22, 0xAA, 0x18, 0x81, 0x51, 0xF8, 0x2A, 0x05, 0x9C, 0x21, 0x90,
+	0x0A, 0x14, 0xBC, 0x41, 0xB0, 0x48, 0x91, 0xAD, 0x42, 0x91, 0xA9, 0x11,
+	0x81, 0xAA, 0x31, 0xA8, 0x1A, 0x15, 0x0A, 0xE9, 0x48, 0x06, 0xBC, 0x40,
+	0x91, 0x09, 0xB0, 0x59, 0x05, 0xEA, 0x19, 0x14, 0x98, 0xA9, 0x1A, 0x26,
+	0xA8, 0x0A, 0x00, 0x20, 0xD8, 0x4A, 0x85, 0xAE, 0x51, 0x81, 0xAA, 0x80,
+	0x21, 0xA2, 0x8D, 0x22, 0xA0, 0x0B, 0x33, 0x92, 0xCC, 0x0B, 0x45, 0xB0,
+	0x1A, 0x82, 0x89, 0x99, 0x42, 0x83, 0xBF, 0x28, 0x24, 0x01, 0xFC, 0x28,
+	0x03, 0x9A, 0x10, 0xBB, 0x51, 0x92, 0x8A, 0x01, 0x08, 0xA8, 0x1B, 0x85,
+	0x0D, 0x33, 0xDA, 0x49, 0x06, 0xAD, 0x30, 0x92, 0x9A, 0x52, 0xC9, 0x30,
+	0xA8, 0x11, 0xAA, 0x89, 0x63, 0xA1, 0x9A, 0x1A, 0x25, 0xD1, 0x8D, 0x34,
+	0xE0, 0x2A, 0x85, 0xAA, 0x20, 0x01, 0x09, 0xC9, 0x2B, 0x47, 0xB8, 0x8B,
+	0x11, 0x22, 0xCA, 0x38, 0xA1, 0x8C, 0x23, 0x10, 0xB8, 0x8C, 0x32, 0x28,
+	0xD2, 0x9D, 0x63, 0xC0, 0x3B, 0x05, 0x9D, 0x12, 0x90, 0x88, 0x80, 0x20,
+	0x84, 0xBE, 0x50, 0xA2, 0x0C, 0x03, 0x99, 0x80, 0x09, 0x34, 0xD0, 0x8D,
+	0x33, 0x88, 0xA8, 0x0A, 0x34, 0xF8, 0x0C, 0x53, 0xA2, 0xAF, 0x41, 0x82,
+	0xAB, 0x20, 0x80, 0x08, 0x01, 0xBB, 0x42, 0x00, 0xD0, 0x1D, 0x17, 0xCA,
+	0x18, 0x12, 0x88, 0xA9, 0x18, 0x14, 0xB9, 0x09, 0x11, 0x00, 0x99, 0x33,
+	0xCB, 0xB8, 0x7B, 0x16, 0xA8, 0xAD, 0x28, 0x34, 0x99, 0x99, 0x29, 0xA1,
+	0x2D, 0x07, 0xAB, 0x11, 0x81, 0x29, 0x05, 0xEB, 0x2A, 0x15, 0xB9, 0x29,
+	0xA2, 0x0D, 0x43, 0xA0, 0x99, 0x90, 0x40, 0xC2, 0x0F, 0x33, 0xC0, 0x0A,
+	0x00, 0x10, 0x82, 0xBA, 0x8B, 0x74, 0xB1, 0x0C, 0x03, 0x09, 0x81, 0x9B,
+	0x34, 0xB0, 0xCF, 0x63, 0xA0, 0x19, 0x80, 0x9A, 0x22, 0x12, 0xE9, 0x8D,
+	0x43, 0x90, 0x88, 0xA9, 0x38, 0x04, 0xBA, 0x0B, 0x46, 0xA0, 0x0D, 0x12,
+	0x88, 0x90, 0x9E, 0x72, 0x91, 0x9C, 0x12, 0x98, 0x21, 0x81, 0xBB, 0x0A,
+	0x11, 0x43, 0x93, 0xCF, 0x30, 0x13, 0xD9, 0x89, 0x20, 0x81, 0x89, 0x42,
+	0xA2, 0xEF, 0x30, 0x03, 0xCA, 0x08, 0x10, 0x11, 0xA9, 0x31, 0xC2, 0xAF,
+	0x41, 0x14, 0xCB, 0x0A, 0x23, 0x02, 0x9A, 0xC9, 0x29, 0x04, 0x89, 0x02,
+	0xBA, 0x0A, 0x51, 0x36, 0xF9, 0x0D, 0x32, 0x00, 0xA9, 0x9D, 0x31, 0x14,
+	0xAA, 0x88, 0xBA, 0x70, 0x03, 0xA9, 0x9A, 0x19, 0x25, 0xA0, 0x8A, 0x14,
+	0xDC, 0x39, 0x34, 0xA0, 0xAE, 0x18, 0x43, 0xA1, 0x9E, 0x31, 0x91, 0x9B,
+	0x42, 0x91, 0xAA, 0xAA, 0x73, 0x83, 0xEB, 0x29, 0x23, 0xB9, 0x19, 0x80,
+	0x00, 0x89, 0x39, 0x27, 0xD9, 0x8B, 0x51, 0x03, 0xBB, 0x9C, 0x30, 0x37,
+	0xD8, 0x8C, 0x32, 0xA1, 0x8A, 0x11, 0x90, 0x0A, 0x08, 0x34, 0x92, 0xCF,
+	0x38, 0x24, 0xB8, 0xAE, 0x30, 0x24, 0xA0, 0xBC, 0x29, 0x15, 0x99, 0x01,
+	0xA9, 0x19, 0x81, 0x41, 0x83, 0xFC, 0x8A, 0x52, 0x14, 0xDB, 0x0A, 0x22,
+	0x02, 0xBA, 0x1A, 0x23, 0xB9, 0x38, 0x84, 0x8A, 0x91, 0xAB, 0x1A, 0x37,
+	0xB9, 0x3B, 0xB3, 0x6A, 0x16, 0xDC, 0x39, 0x93, 0x9A, 0x33, 0x80, 0xBA,
+	0xBA, 0x4C, 0x17, 0xBB, 0x31, 0x91, 0x8B, 0x20, 0x14, 0xBB, 0x48, 0xEA,
+	0x60, 0xB2, 0x8D, 0x34, 0xB0, 0x8A, 0x18, 0x22, 0xC8, 0xAA, 0x41, 0x81,
+	0x09, 0x37, 0xE8, 0x9C, 0x31, 0x12, 0xB0, 0x9C, 0x38, 0x22, 0x93, 0xFB,
+	0x8B, 0x53, 0x91, 0x29, 0xB1, 0x9E, 0x10, 0x22, 0x12, 0xE8, 0xAD, 0x52,
+	0x83, 0xAB, 0x0A, 0x20, 0x31, 0x92, 0xBE, 0x28, 0x01, 0x71, 0x82, 0xCD,
+	0x19, 0x12, 0x13, 0xC9, 0x8C, 0x34, 0xB8, 0x8B, 0x34, 0xC8, 0x8A, 0x31,
+	0x25, 0xD9, 0x9C, 0x30, 0x25, 0xB9, 0x9A, 0x10, 0x22, 0xA9, 0x48, 0x92,
+	0xAF, 0x20, 0x22, 0x00, 0xEB, 0x8A, 0x45, 0xA1, 0xAB, 0x20, 0xB8, 0x60,
+	0x82, 0x9C, 0x18, 0x12, 0x20, 0xF9, 0x0B, 0x43, 0x81, 0xA9, 0xA8, 0x38,
+	0x06, 0xAB, 0x28, 0x93, 0xBB, 0x71, 0x07, 0xDB, 0x18, 0x11, 0x22, 0xD9,
+	0x9C, 0x28, 0x43, 0x13, 0xEA, 0xAB, 0x21, 0x22, 0x12, 0xFB, 0x0B, 0x43,
+	0x01, 0x98, 0xBA, 0x8B, 0x31, 0x25, 0x81, 0x9C, 0x08, 0x10, 0x82, 0x09,
+	0xB2, 0xDF, 0x41, 0x14, 0xCA, 0x8B, 0x33, 0x03, 0xDA, 0x9A, 0x22, 0x11,
+	0x91, 0x0B, 0x02, 0xDC, 0x1A, 0x02, 0x72, 0xA3, 0x8D, 0x33, 0xEA, 0x8A,
+	0x00, 0x43, 0x92, 0xAA, 0x00, 0xB9, 0x8A, 0x66, 0x91, 0xBD, 0x0A, 0x45,
+	0x03, 0xDA, 0x89, 0x10, 0x01, 0x08, 0x99, 0x89, 0x00, 0x61, 0x15, 0xB8,
+	0xBF, 0x38, 0x25, 0x98, 0xB9, 0x9B, 0x64, 0x81, 0x9A, 0x88, 0x08, 0x22,
+	0x91, 0xAB, 0xAA, 0x49, 0x67, 0x91, 0xCB, 0x0A, 0x33, 0x02, 0xA8, 0xAA,
+	0xBB, 0x71, 0x24, 0xB0, 0x9B, 0x9A, 0x41, 0x15, 0xCA, 0x8A, 0x32, 0x23,
+	0xC9, 0xAC, 0x01, 0x18, 0x33, 0xC1, 0xAB, 0x98, 0x60, 0x15, 0xD9, 0x0A,
+	0xA1, 0x09, 0x33, 0xD8, 0x19, 0x24, 0x12, 0xF9, 0xAB, 0x08, 0x00, 0x72,
+	0x03, 0xEB, 0x09, 0x22, 0x13, 0xC9, 0xBD, 0x28, 0x24, 0x12, 0xB8, 0x9D,
+	0x20, 0x22, 0x22, 0xC1, 0xBF, 0x29, 0x44, 0x02, 0xDB, 0x0A, 0x41, 0x02,
+	0x98, 0xA8, 0x9A, 0x20, 0x33, 0x91, 0xAD, 0x29, 0x26, 0x02, 0xCB, 0xAB,
+	0x21, 0x00, 0x01, 0x88, 0x08, 0x51, 0x13, 0xF9, 0x9C, 0x80, 0x8A, 0x32,
+	0xA8, 0xBC, 0x19, 0x81, 0x52, 0xB3, 0xFF, 0x8E, 0x21, 0x82, 0x99, 0x80,
+	0x99, 0x99, 0x28, 0x16, 0xCB, 0x8A, 0x43, 0x33, 0xE0, 0xBD, 0x30, 0x25,
+	0xA1, 0xBC, 0x19, 0x43, 0x24, 0xA8, 0xAD, 0x0A, 0x42, 0x24, 0x90, 0xA9,
+	0x9A, 0x62, 0x14, 0xBA, 0x0A, 0x32, 0x43, 0x82, 0xCC, 0x19, 0x24, 0x80,
+	0x08, 0xA8, 0x8B, 0x63, 0x23, 0x90, 0xCD, 0x19, 0x33, 0xA0, 0xBB, 0x8C,
+	0x44, 0x92, 0xBA, 0x88, 0xBB, 0xB0, 0xAF, 0x50, 0xB2, 0x9D, 0x90, 0x9A,
+	0x80, 0xDA, 0xAB, 0x09, 0x98, 0x09, 0x14, 0xBC, 0xDA, 0xCC, 0xAC, 0x60,
+	0x02, 0x99, 0x88, 0x08, 0x23, 0xDB, 0x99, 0x09, 0x09, 0x55, 0x25, 0x81,
+	0xBB, 0x09, 0x51, 0x36, 0x90, 0x09, 0x10, 0x52, 0x82, 0x88, 0x63, 0x13,
+	0xA9, 0x9A, 0x52, 0x03, 0x00, 0x22, 0x53, 0xB2, 0xAF, 0x41, 0x02, 0x99,
+	0x10, 0x18, 0x81, 0xCD, 0x89, 0x22, 0x13, 0xDB, 0x9B, 0xB9, 0xAF, 0x18,
+	0x23, 0xD0, 0xBD, 0x0A, 0x80, 0xAB, 0xCB, 0xBA, 0x8B, 0x01, 0xEE, 0x9C,
+	0x41, 0x82, 0x11, 0xFB, 0xAD, 0x19, 0x21, 0x11, 0x02, 0xA9, 0xBA, 0x08,
+	0x98, 0x19, 0x34, 0x18, 0x37, 0x81, 0x0A, 0x63, 0x12, 0x10, 0x11, 0xA8,
+	0x58, 0x47, 0x12, 0x20, 0x81, 0xBA, 0x29, 0x46, 0x12, 0x18, 0x52, 0x12,
+	0xAA, 0x18, 0x21, 0x12, 0x13, 0xA9, 0x38, 0x24, 0x80, 0x99, 0xDF, 0x0A,
+	0x91, 0xBC, 0x20, 0xF0, 0x9C, 0x22, 0xC9, 0xAC, 0xBD, 0x89, 0x21, 0x80,
+	0xFB, 0xAD, 0x88, 0x10, 0xB9, 0x9A, 0xDA, 0xAC, 0x38, 0x14, 0xDA, 0xBB,
+	0x9A, 0x20, 0x34, 0x04, 0xFA, 0x8B, 0x80, 0x30, 0x23, 0xB9, 0x1B, 0x45,
+	0x44, 0x02, 0xAA, 0x1A, 0x21, 0x33, 0x65, 0x02, 0x89, 0x51, 0x22, 0x22,
+	0xB9, 0x28, 0x63, 0x44, 0x21, 0x80, 0xAC, 0x41, 0x44, 0x91, 0xAC, 0x8A,
+	0x62, 0x13, 0x01, 0xCC, 0x9B, 0x20, 0x02, 0xAA, 0x10, 0x00, 0x98, 0xBD,
+	0xCB, 0x0A, 0x81, 0xCA, 0xA9, 0xBC, 0x88, 0xBA, 0xCD, 0xA9, 0xCE, 0x8B,
+	0x80, 0xB8, 0xCE, 0x19, 0x01, 0x11, 0xC1, 0xAF, 0x0A, 0x10, 0x00, 0x10,
+	0x11, 0x88, 0xAB, 0x91, 0x1B, 0x47, 0xA9, 0x74, 0x03, 0xA9, 0x38, 0x15,
+	0x80, 0x88, 0x89, 0x73, 0x35, 0x01, 0x88, 0x99, 0x50, 0x25, 0x98, 0xA9,
+	0x39, 0x46, 0x11, 0x88, 0x9A, 0x18, 0x33, 0xD9, 0x8A, 0x30, 0x36, 0x01,
+	0xB9, 0xCE, 0x8A, 0x21, 0x22, 0xA0, 0xAC, 0xA9, 0x99, 0x18, 0xB8, 0xCF,
+	0x89, 0x88, 0x00, 0xEA, 0xAC, 0xBB, 0x89, 0x21, 0xD8, 0xAE, 0xBA, 0x19,
+	0x34, 0x02, 0xEA, 0xBB, 0x9B, 0x40, 0x14, 0x99, 0x08, 0x80, 0x88, 0x28,
+	0x33, 0x84, 0x10, 0x74, 0x82, 0x10, 0x33, 0x45, 0x23, 0xB0, 0xAC, 0x75,
+	0x14, 0x89, 0x10, 0x91, 0x28, 0x35, 0x92, 0xAB, 0x34, 0x02, 0x30, 0x13,
+	0xBC, 0x61, 0x24, 0xA8, 0xBD, 0x28, 0x43, 0x24, 0xE9, 0xAB, 0x28, 0x12,
+	0xA0, 0xCC, 0xAB, 0x31, 0x03, 0xCA, 0x9A, 0xEA, 0x9C, 0x11, 0xB9, 0x08,
+	0xB8, 0xAD, 0xAA, 0xBB, 0x80, 0xDF, 0x89, 0x98, 0xAC, 0x42, 0x81, 0x9C,
+	0x99, 0x99, 0x31, 0xA3, 0xBF, 0x30, 0x24, 0x80, 0xAA, 0x3B, 0x57, 0x90,
+	0x20, 0x02, 0x18, 0x23, 0x02, 0x31, 0x10, 0x71, 0x47, 0x01, 0x88, 0x08,
+	0x00, 0x52, 0x15, 0x10, 0x23, 0xC8, 0x8C, 0x62, 0x32, 0x80, 0x9A, 0x88,
+	0x08, 0x30, 0x33, 0xB0, 0x8C, 0x11, 0xF9, 0x9D, 0x80, 0x9A, 0x10, 0xB0,
+	0xCC, 0xAC, 0x20, 0xA0, 0xCF, 0x09, 0x99, 0x89, 0x90, 0xCC, 0xBE, 0x89,
+	0x42, 0xA1, 0xCE, 0x9B, 0x30, 0x33, 0xA1, 0xBE, 0x9B, 0x22, 0x01, 0xA9,
+	0x9A, 0x00, 0x42, 0x25, 0x90, 0x9C, 0x18, 0x33, 0x33, 0x31, 0x54, 0x25,
+	0x12, 0x00, 0x32, 0xC9, 0x29, 0x77, 0x24, 0x01, 0xA8, 0x9B, 0x53, 0x23,
+	0x80, 0xBA, 0x78, 0x25, 0x80, 0x89, 0x9A, 0x28, 0x22, 0x81, 0xB9, 0x8B,
+	0x44, 0x82, 0xDA, 0xAD, 0x8A, 0x10, 0x33, 0xF9, 0x9C, 0x12, 0xB8, 0xAA,
+	0xB9, 0x9B, 0x08, 0x03, 0xFA, 0xAD, 0xBB, 0xAA, 0xCA, 0x9C, 0x43, 0xD0,
+	0xBC, 0xBB, 0x39, 0x35, 0x82, 0xEA, 0xBC, 0x89, 0x43, 0x23, 0x90, 0xBA,
+	0x9C, 0x32, 0xA2, 0xAC, 0x72, 0x43, 0x81, 0x9A, 0x18, 0x22, 0x01, 0x53,
+	0x01, 0x31, 0x54, 0x14, 0x09, 0x10, 0x42, 0x32, 0x53, 0x04, 0xCC, 0x48,
+	0x25, 0x81, 0x88, 0xA8, 0x19, 0x45, 0xA2, 0xAB, 0x20, 0x89, 0x53, 0xB0,
+	0xAB, 0x89, 0xA0, 0x0C, 0x92, 0xCE, 0x08, 0x02, 0xBC, 0xAB, 0xFB, 0x8A,
+	0x52, 0x13, 0xD9, 0xBC, 0xAC, 0x20, 0x92, 0xAC, 0x30, 0x81, 0xBB, 0xDB,
+	0xBE, 0x19, 0x13, 0x12, 0xC9, 0xBD, 0x38, 0x34, 0x98, 0xCC, 0xAB, 0x30,
+	0x36, 0x82, 0xAB, 0x09, 0x21, 0x24, 0x00, 0x12, 0xA9, 0x49, 0x57, 0x01,
+	0x8A, 0x52, 0x11, 0x89, 0x41, 0x02, 0x65, 0x82, 0xBA, 0xAA, 0x72, 0x24,
+	0x91, 0x99, 0x08, 0x10, 0x12, 0xA0, 0xCB, 0x29, 0x36, 0x02, 0xA9, 0xBB,
+	0xCC, 0x08, 0x43, 0xB0, 0xBC, 0x28, 0x13, 0xA0, 0xCE, 0xAD, 0x88, 0x18,
+	0x21, 0x91, 0xDB, 0xCB, 0xBC, 0x18, 0x83, 0xCC, 0xCA, 0xAB, 0x99, 0x28,
+	0x37, 0xB1, 0xAF, 0xAA, 0x21, 0x14, 0xB9, 0x0B, 0x52, 0x03, 0x98, 0xDA,
+	0x8C, 0x22, 0x14, 0x90, 0xBA, 0x70, 0x25, 0x90, 0x9A, 0xB9, 0x39, 0x57,
+	0x81, 0x88, 0x80, 0x20, 0x53, 0x82, 0xCC, 0x09, 0x42, 0x24, 0x02, 0xDB,
+	0x19, 0x11, 0x22, 0x14, 0xC9, 0xAD, 0x30, 0x23, 0x02, 0xA9, 0xAA, 0x9A,
+	0x11, 0xEA, 0x1A, 0x34, 0xD9, 0x89, 0xA0, 0x9C, 0x31, 0xE9, 0x9C, 0x90,
+	0x8A, 0x31, 0xD9, 0xAC, 0x99, 0x18, 0x91, 0xFF, 0x8B, 0x41, 0x12, 0xA8,
+	0xCA, 0x9C, 0x62, 0x02, 0xCA, 0x89, 0x08, 0x42, 0x82, 0xA9, 0x99, 0xA9,
+	0x30, 0x26, 0x81, 0xCC, 0x48, 0x25, 0x91, 0xBA, 0xAB, 0x71, 0x33, 0x92,
+	0x89, 0x01, 0x00, 0x11, 0x82, 0xBD, 0x72, 0x14, 0x08, 0x11, 0xCA, 0x2A,
+	0x25, 0xB8, 0x8B, 0x10, 0x22, 0x36, 0xB0, 0x8D, 0x80, 0xAA, 0x30, 0x82,
+	0x99, 0x90, 0x09, 0xA0, 0xCE, 0x8C, 0x20, 0x91, 0x19, 0xC2, 0xEF, 0x18,
+	0x13, 0xCB, 0xBC, 0x1A, 0x22, 0x90, 0xA8, 0xCD, 0x98, 0x89, 0x21, 0x85,
+	0xDF, 0x28, 0x13, 0xAA, 0x08, 0xCA, 0x58, 0x84, 0xBA, 0x80, 0xA9, 0x71,
+	0x93, 0x8A, 0x31, 0x90, 0x39, 0xB2, 0x9D, 0x52, 0x14, 0x01, 0xB8, 0x1B,
+	0x47, 0x82, 0x89, 0x99, 0x28, 0x44, 0x02, 0x09, 0xA0, 0x78, 0x35, 0xA0,
+	0xBD, 0x19, 0x33, 0x33, 0x82, 0xCA, 0xAA, 0x21, 0x11, 0xD9, 0xAC, 0x18,
+	0x01, 0x31, 0x93, 0xEF, 0x08, 0x88, 0x00, 0xB8, 0xAE, 0x48, 0x13, 0xC9,
+	0x9C, 0x88, 0xBC, 0x18, 0xA1, 0x18, 0xE9, 0x0A, 0x13, 0xA8, 0x9C, 0x43,
+	0xEA, 0x9A, 0x41, 0x15, 0xBA, 0x9A, 0x09, 0x35, 0xC0, 0x8B, 0x01, 0x99,
+	0x65, 0xA1, 0x98, 0x09, 0x34, 0xD9, 0x28, 0x23, 0x81, 0x10, 0x28, 0x05,
+	0xAD, 0x41, 0x13, 0x41, 0x04, 0x8A, 0x81, 0x1A, 0x35, 0xBA, 0x28, 0xD0,
+	0x49, 0x37, 0x88, 0xBA, 0x8B, 0x42, 0x22, 0x82, 0xBF, 0x40, 0x81, 0x18,
+	0xD9, 0x9A, 0x01, 0x19, 0x17, 0xC9, 0x19, 0xB8, 0x58, 0xB2, 0x9F, 0x00,
+	0x08, 0x34, 0xFA, 0x8B, 0x11, 0x01, 0x11, 0xC9, 0xBE, 0x20, 0x21, 0x34,
+	0xF8, 0x9C, 0x42, 0xB1, 0x1A, 0x12, 0xBB, 0x09, 0x35, 0x82, 0xBD, 0x18,
+	0x24, 0xA0, 0xAA, 0x0A, 0x43, 0x00, 0x01, 0x10, 0x04, 0xEB, 0x28, 0x04,
+	0xB8, 0x29, 0x45, 0x12, 0xDA, 0x1A, 0x34, 0x91, 0xC9, 0x9B, 0x72, 0x02,
+	0x19, 0xA1, 0xAB, 0x20, 0x14, 0x99, 0x99, 0xB9, 0x71, 0x37, 0xEB, 0x89,
+	0x10, 0x23, 0xA0, 0xBD, 0x38, 0x15, 0x9A, 0x10, 0xD9, 0xAC, 0x21, 0x44,
+	0x91, 0xDC, 0x1A, 0x22, 0x98, 0xA9, 0x89, 0x22, 0x12, 0x99, 0xCA, 0x0A,
+	0xB8, 0x78, 0x17, 0xBA, 0x9A, 0x30, 0x45, 0xB1, 0xBF, 0x20, 0x12, 0x08,
+	0x00, 0xA9, 0x58, 0xA2, 0x8B, 0x52, 0xC0, 0x2A, 0x04, 0x18, 0x03, 0xCC,
+	0x50, 0xA2, 0x1B, 0x23, 0xCC, 0x38, 0x02, 0x01, 0xA8, 0x09, 0x34, 0xCA,
+	0x80, 0x19, 0x35, 0x12, 0xE9, 0x8B, 0x26, 0xFB, 0x30, 0x94, 0xAC, 0x10,
+	0x21, 0x13, 0xDE, 0x19, 0x23, 0x80, 0xBA, 0x28, 0xB0, 0x1B, 0x14, 0x20,
+	0xC4, 0xAF, 0x20, 0x83, 0xAB, 0x09, 0x53, 0xA2, 0xCF, 0x40, 0x03, 0xBB,
+	0x99, 0x20, 0x34, 0xA0, 0xAC, 0x21, 0xD8, 0x49, 0x03, 0xBB, 0x30, 0x93,
+	0x8C, 0x14, 0x08, 0xA0, 0xAC, 0x35, 0xE8, 0x9B, 0x72, 0x14, 0xB9, 0x8B,
+	0x00, 0x41, 0x82, 0xBA, 0x38, 0x83, 0xAA, 0x40, 0x15, 0xC9, 0x8C, 0x33,
+	0xA2, 0xAE, 0x50, 0x14, 0xE9, 0x8A, 0x42, 0x82, 0xBA, 0x0A, 0x33, 0x82,
+	0xBC, 0x09, 0x03, 0x0A, 0x55, 0x91, 0xCC, 0x9D, 0x63, 0x02, 0xBB, 0x9C,
+	0x40, 0x24, 0xB8, 0xAA, 0xA9, 0x51, 0x12, 0x00, 0xDA, 0x9C, 0x41, 0x24,
+	0xB0, 0xBD, 0x28, 0x13, 0x80, 0x90, 0xAA, 0x88, 0x19, 0x67, 0xB0, 0xAB,
+	0x39, 0x44, 0x91, 0xBB, 0x18, 0x20, 0x02, 0xBB, 0x73, 0xE2, 0x0B, 0x24,
+	0xA0, 0xA8, 0x19, 0x34, 0xB0, 0x0B, 0x01, 0x28, 0x92, 0x9C, 0x32, 0xDB,
+	0x72, 0xD2, 0x1A, 0x15, 0xCB, 0x28, 0x04, 0xB9, 0x09, 0x11, 0x23, 0xE8,
+	0xAE, 0x52, 0xA2, 0x0A, 0x82, 0xBA, 0x51, 0xA1, 0x9B, 0x02, 0x10, 0xA1,
+	0xAD, 0x62, 0x82, 0xCD, 0x39, 0x25, 0xD8, 0x9B, 0x32, 0x34, 0xD9, 0x8B,
+	0x22, 0xA8, 0x30, 0x84, 0xBA, 0xAA, 0x4A, 0x27, 0xA8, 0x9C, 0x41, 0x92,
+	0x9B, 0x01, 0x98, 0x50, 0x03, 0xBC, 0x8B, 0x50, 0x37, 0xEA, 0x1A, 0x03,
+	0x99, 0x10, 0x01, 0xA0, 0x9E, 0x51, 0x02, 0xC9, 0x8B, 0x52, 0x03, 0xBC,
+	0x09, 0x43, 0x80, 0xBB, 0x41, 0xA2, 0x9E, 0x31, 0x02, 0x98, 0xBC, 0x50,
+	0x02, 0xBA, 0x1A, 0x23, 0x00, 0xC8, 0xAF, 0x73, 0x83, 0xBE, 0x20, 0x04,
+	0x9A, 0x88, 0x00, 0x11, 0xA8, 0x0A, 0x14, 0xC8, 0xA9, 0x49, 0x27, 0xBA,
+	0x8A, 0x28, 0x24, 0xB0, 0x0B, 0x94, 0x9B, 0x21, 0x31, 0x16, 0xEC, 0x29,
+	0x14, 0xBA, 0x18, 0x05, 0xAB, 0x00, 0x00, 0x24, 0xD9, 0x8B, 0x24, 0x99,
+	0x42, 0xF9, 0x29, 0x06, 0xBB, 0x31, 0x90, 0x28, 0xC0, 0x0C, 0x53, 0x90,
+	0x9A, 0x00, 0x01, 0x98, 0x89, 0x29, 0x16, 0xDB, 0x60, 0xA1, 0x0B, 0x03,
+	0x9B, 0x52, 0xD8, 0x2B, 0x13, 0x08, 0x10, 0x98, 0xEB, 0x1A, 0x25, 0x08,
+	0xC9, 0x0A, 0x26, 0xAA, 0x01, 0xDB, 0x38, 0x27, 0xCA, 0x8A, 0x43, 0xA1,
+	0x8A, 0x21, 0xA8, 0xBA, 0x40, 0x25, 0xB0, 0x8E, 0x12, 0x99, 0x8A, 0x73,
+	0xA1, 0x9A, 0x99, 0x41, 0x14, 0xA1, 0xAC, 0x08, 0x89, 0x75, 0xB1, 0x0C,
+	0x01, 0x9A, 0x43, 0xA2, 0x9E, 0x31, 0x91, 0x0B, 0x02, 0xBC, 0x71, 0x81,
+	0x89, 0x98, 0x08, 0x00, 0x14, 0xB9, 0x1C, 0x15, 0xEB, 0x60, 0xA1, 0x8D,
+	0x42, 0xA0, 0x0A, 0x80, 0x00, 0x01, 0x81, 0xBC, 0x38, 0x05, 0x99, 0x81,
+	0xBB, 0x9C, 0x67, 0x81, 0xBA, 0x88, 0x99, 0x46, 0xB1, 0x9C, 0x21, 0x81,
+	0x08, 0x92, 0x8C, 0x82, 0xAE, 0x54, 0xA1, 0xAA, 0x00, 0x21, 0x13, 0xEC,
+	0x0A, 0x43, 0xA1, 0xAB, 0x42, 0x91, 0x0A, 0x90, 0x1B, 0x34, 0xFA, 0x39,
+	0x16, 0xDA, 0x28, 0xA1, 0x19, 0x05, 0xCB, 0x38, 0x13, 0xA0, 0xBB, 0x0C,
+	0x45, 0x91, 0xAA, 0xAC, 0x72, 0x84, 0xAB, 0x28, 0x01, 0xA9, 0x19, 0x23,
+	0xB0, 0xAD, 0x40, 0x26, 0xC9, 0x9C, 0x42, 0x83, 0xDB, 0x19, 0x33, 0xC1,
+	0x9B, 0x44, 0xC0, 0x0B, 0x11, 0x31, 0xC1, 0x8D, 0x21, 0x22, 0xF9, 0x8B,
+	0x34, 0x90, 0x9A, 0x10, 0x08, 0x10, 0x08, 0x14, 0xDF, 0x18, 0x43, 0xC0,
+	0x8B, 0x43, 0xA1, 0xBC, 0x51, 0x82, 0xA9, 0x9A, 0x51, 0x03, 0xBC, 0x29,
+	0x15, 0xB8, 0xAC, 0x53, 0x01, 0xB9, 0x9A, 0x40, 0x25, 0xC9, 0x0B, 0x02,
+	0x08, 0x00, 0x11, 0xB0, 0xCD, 0x48, 0x34, 0xE0, 0x9A, 0x00, 0x43, 0xA3,
+	0xAF, 0x38, 0x23, 0xB9, 0x9D, 0x41, 0x01, 0xAA, 0x18, 0x05, 0xDB, 0x39,
+	0x24, 0xA0, 0xBD, 0x49, 0x25, 0xC8, 0x9B, 0x32, 0x01, 0x88, 0x99, 0x19,
+	0x82, 0x8C, 0x33, 0xB0, 0x09, 0xBC, 0x70, 0x07, 0xAC, 0x38, 0x12, 0xA9,
+	0x8B, 0x51, 0x81, 0xDB, 0x30, 0x84, 0xCB, 0x29, 0x15, 0x98, 0xA0, 0x8B,
+	0x42, 0x12, 0xDA, 0x0C, 0x24, 0x90, 0x9A, 0x20, 0x22, 0xFA, 0x8A, 0x63,
+	0xC1, 0x0A, 0x12, 0xA8, 0x11, 0xDA, 0x39, 0x25, 0xC9, 0x8B, 0x54, 0xA1,
+	0x9D, 0x40, 0x82, 0xBB, 0x20, 0x31, 0xB1, 0xAE, 0x41, 0x03, 0xCB, 0x18,
+	0x00, 0x22, 0xE9, 0x1A, 0x26, 0xCA, 0x3A, 0x04, 0xCB, 0x30, 0x80, 0x10,
+	0x98, 0xCB, 0x61, 0x82, 0x9D, 0x21, 0x92, 0x9B, 0x10, 0x23, 0xBA, 0x0A,
+	0x41, 0xA3, 0xDF, 0x42, 0x91, 0x0B, 0x81, 0x1A, 0x25, 0xB9, 0x9C, 0x38,
+	0x15, 0x99, 0xAB, 0x20, 0x26, 0xF9, 0x1A, 0x13, 0x90, 0x99, 0x42, 0xA4,
+	0xCE, 0x30, 0x03, 0x99, 0xC9, 0x39, 0x06, 0x99, 0x91, 0x8B, 0x24, 0xC9,
+	0x61, 0xB0, 0x8C, 0x43, 0x98, 0x18, 0xB8, 0x1B, 0x06, 0x9A, 0x35, 0xEA,
+	0x08, 0x10, 0x21, 0xB8, 0xAE, 0x52, 0x82, 0xB9, 0x09, 0x11, 0x89, 0x32,
+	0xA9, 0x8C, 0x41, 0x80, 0x80, 0xCB, 0x63, 0xE8, 0x28, 0x84, 0xCB, 0x40,
+	0x92, 0x0A, 0x81, 0x99, 0x08, 0x42, 0x90, 0xCE, 0x50, 0x02, 0xB8, 0x8C,
+	0x41, 0x83, 0xBB, 0x9A, 0x70, 0x04, 0xBC, 0x31, 0xA2, 0x0C, 0x13, 0xAA,
+	0x18, 0x80, 0x23, 0xFA, 0x2A, 0x05, 0x9B, 0x14, 0xBC, 0x61, 0x92, 0xAE,
+	0x51, 0x82, 0xBB, 0x3A, 0x25, 0xB9, 0x8C, 0x32, 0x03, 0xDB, 0x1B, 0x34,
+	0xA0, 0xAC, 0x31, 0x82, 0x09, 0xC9, 0x58, 0x93, 0x9F, 0x33, 0xB8, 0x8B,
+	0x33, 0x83, 0xBD, 0x38, 0x82, 0x00, 0xF8, 0x2A, 0x24, 0xC8, 0x2B, 0x12,
+	0xC0, 0x0B, 0x26, 0xB9, 0x08, 0x89, 0x64, 0xB8, 0x0C, 0x22, 0xB8, 0x48,
+	0xA1, 0x19, 0xA1, 0x9C, 0x65, 0xB1, 0x9E, 0x22, 0x82, 0x9A, 0x88, 0x21,
+	0x90, 0x09, 0x98, 0x3A, 0x27, 0xCD, 0x50, 0x91, 0x9B, 0x32, 0xC1, 0x0B,
+	0x53, 0xC0, 0x0B, 0x24, 0xA9, 0x10, 0x98, 0x09, 0x12, 0x9A, 0x02, 0x3B,
+	0xA6, 0x9F, 0x34, 0xC8, 0x89, 0x08, 0x34, 0x92, 0xEF, 0x30, 0x04, 0xDA,
+	0x29, 0x12, 0xA8, 0x09, 0x91, 0x38, 0x02, 0xCD, 0x50, 0x81, 0xBB, 0x40,
+	0x83, 0xA9, 0x99, 0x1A, 0x27, 0x90, 0xDA, 0x30, 0x92, 0x8B, 0x12, 0x92,
+	0xAF, 0x51, 0x83, 0xAF, 0x41, 0xA0, 0x29, 0x91, 0x0A, 0x13, 0xCC, 0x41,
+	0xA1, 0x09, 0x11, 0xAB, 0x21, 0xA8, 0x73, 0xB3, 0xBF, 0x58, 0x03, 0xA8,
+	0xAA, 0x09, 0x44, 0xA1, 0x8A, 0xA9, 0x41, 0x92, 0x8A, 0x27, 0xDD, 0x38,
+	0x23, 0xDA, 0x29, 0xA3, 0x0C, 0x24, 0xBA, 0x29, 0x83, 0x9C, 0x35, 0xC9,
+	0x0A, 0x13, 0x89, 0x98, 0x18, 0x02, 0xA8, 0x9A, 0x64, 0xC9, 0x18, 0x91,
+	0x38, 0x04, 0xDE, 0x50, 0x92, 0xAC, 0x40, 0x82, 0xA9, 0x19, 0x01, 0x21,
+	0xC9, 0x8B, 0x52, 0x93, 0xAD, 0x21, 0x00, 0xC8, 0x39, 0x34, 0xE8, 0x8E,
+	0x24, 0x98, 0x99, 0x18, 0x21, 0x24, 0xCF, 0x28, 0x03, 0xA8, 0x1A, 0x03,
+	0xAA, 0x89, 0x52, 0x03, 0xFC, 0x39, 0x03, 0xB9, 0x39, 0xD1, 0x39, 0x87,
+	0xAB, 0x38, 0x82, 0x18, 0xC9, 0x3A, 0x13, 0xA9, 0x18, 0x98, 0xCA, 0x74,
+	0x91, 0xAB, 0x99, 0x73, 0x94, 0xAD, 0x32, 0xA0, 0x2B, 0x82, 0x18, 0xB0,
+	0xBD, 0x71, 0x86, 0xBB, 0x10, 0x22, 0x80, 0xCB, 0x4A, 0x05, 0xA9, 0x0A,
+	0x53, 0xB0, 0xAD, 0x61, 0x92, 0x9A, 0x88, 0x20, 0x15, 0xDC, 0x30, 0x92,
+	0x8B, 0x20, 0x91, 0x08, 0xA0, 0x8D, 0x36, 0xD8, 0x0A, 0x33, 0xB9, 0x3A,
+	0x93, 0x0D, 0x04, 0xBC, 0x62, 0xA0, 0x0A, 0x14, 0xCA, 0x28, 0x02, 0x98,
+	0x89, 0x08, 0x31, 0xE0, 0x39, 0x92, 0x8D, 0x62, 0xD8, 0x1A, 0x15, 0xB9,
+	0x2A, 0x14, 0xA9, 0x8A, 0x38, 0x25, 0xEC, 0x48, 0x92, 0x9A, 0x00, 0x10,
+	0x93, 0xBD, 0x51, 0x83, 0xAC, 0x21, 0x80, 0xA9, 0x20, 0x92, 0xAA, 0x68,
+	0xB3, 0x8F, 0x33, 0xB8, 0x2A, 0xA0, 0x30, 0x93, 0xAD, 0x42, 0xB1, 0xAC,
+	0x54, 0xB1, 0x1B, 0xA1, 0x0E, 0x37, 0xE8, 0x0A, 0x04, 0x99, 0x31, 0xD9,
+	0x3A, 0x04, 0xBB, 0x52, 0xB1, 0x8D, 0x42, 0x90, 0xA9, 0x09, 0x24, 0xA0,
+	0xAB, 0x33, 0x91, 0x9D, 0x53, 0xC0, 0x8B, 0x33, 0x81, 0xC9, 0x8A, 0x21,
+	0x35, 0xD9, 0x8B, 0x33, 0x89, 0x00, 0xAB, 0x32, 0xE8, 0x4B, 0x17, 0xC8,
+	0xAB, 0x73, 0x81, 0xA9, 0x99, 0x30, 0x05, 0x9B, 0x80, 0x99, 0x31, 0x26,
+	0xFA, 0x09, 0x21, 0x81, 0x9A, 0x11, 0xB1, 0x8E, 0x15, 0x88, 0xB8, 0x19,
+	0x18, 0x26, 0xA0, 0xBE, 0x42, 0xA2, 0x0A, 0xA1, 0x1B, 0x17, 0xC9, 0x30,
+	0x90, 0x09, 0x88, 0x99, 0x71, 0xA2, 0x8D, 0x23, 0xB8, 0x89, 0x02, 0x88,
+	0x13, 0xBF, 0x51, 0x02, 0xCC, 0x28, 0x15, 0xCB, 0x20, 0x82, 0x0A, 0xA8,
+	0x19, 0x64, 0xC1, 0x8C, 0x22, 0xAA, 0x61, 0xA1, 0x8D, 0x13, 0x99, 0x21,
+	0xB0, 0x9C, 0x35, 0x99, 0x88, 0x90, 0x38, 0x94, 0xCC, 0x38, 0x04, 0x8B,
+	0x10, 0x88, 0x91, 0x8F, 0x34, 0xC0, 0x8C, 0x12, 0x10, 0x83, 0xAF, 0x31,
+	0x81, 0x89, 0xD9, 0x48, 0x82, 0x09, 0x92, 0xBD, 0x62, 0xA1, 0x1B, 0x04,
+	0xAC, 0x20, 0x13, 0x81, 0xDF, 0x31, 0x91, 0x89, 0x02, 0xDA, 0x39, 0x17,
+	0xAA, 0x0A, 0x23, 0xA0, 0xAB, 0x42, 0x11, 0xF0, 0x0C, 0x35, 0xC9, 0x1B,
+	0x23, 0xA8, 0x10, 0xBD, 0x73, 0xB2, 0x8C, 0x21, 0x91, 0x99, 0x09, 0x34,
+	0xD0, 0x0B, 0x23, 0x90, 0x8B, 0x10, 0x84, 0x8E, 0x13, 0xCB, 0x54, 0xD8,
+	0x19, 0x01, 0x00, 0x89, 0x20, 0xD0, 0x1C, 0x35, 0xC9, 0x1B, 0x84, 0x09,
+	0x03, 0xCB, 0x18, 0x23, 0x9A, 0x01, 0xAB, 0x10, 0x33, 0xD1, 0x9D, 0x72,
+	0xB1, 0x1B, 0x82, 0x49, 0xA3, 0xCF, 0x61, 0x91, 0x9B, 0x32, 0xA8, 0x89,
+	0x01, 0x0A, 0x45, 0xF9, 0x1A, 0x15, 0xB9, 0x39, 0x92, 0x8A, 0x01, 0x99,
+	0x51, 0xB1, 0x0C, 0x81, 0x42, 0xD8, 0x19, 0x00, 0x81, 0x18, 0x88, 0xD0,
+	0x38, 0x84, 0xAA, 0x90, 0x1F, 0x17, 0xCA, 0x38, 0xA3, 0x0D, 0x04, 0xBA,
+	0x51, 0xA1, 0x8C, 0x33, 0xC8, 0x0B, 0x35, 0xC9, 0x29, 0xB2, 0x1C, 0x05,
+	0x9A, 0x21, 0xDA, 0x41, 0x92, 0xAD, 0x43, 0xB0, 0x8A, 0x03, 0x09, 0x01,
+	0xA1, 0x9D, 0x73, 0xB2, 0x9E, 0x22, 0x91, 0x09, 0x99, 0x42, 0xC0, 0x3B,
+	0x05, 0xBB, 0x30, 0xA1, 0x01, 0xA9, 0x59, 0x85, 0xDC, 0x48, 0x83, 0xAB,
+	0x41, 0xC0, 0x28, 0xA1, 0x2B, 0x15, 0xCB, 0x19, 0x33, 0xC8, 0x08, 0x88,
+	0x13, 0xCB, 0x38, 0x27, 0xDC, 0x18, 0x22, 0xA2, 0x9D, 0x30, 0x02, 0xCC,
+	0x49, 0x15, 0xBB, 0x1A, 0x23, 0x13, 0xCF, 0x29, 0x24, 0xB8, 0x8C, 0x32,
+	0x82, 0xAE, 0x32, 0xA1, 0x8C, 0x01, 0x30, 0x94, 0xCD, 0x38, 0x24, 0xD9,
+	0x1A, 0x12, 0x88, 0x88, 0x0A, 0x34, 0xFB, 0x4A, 0x04, 0xBA, 0x09, 0x41,
+	0x82, 0xBC, 0x20, 0x22, 0xB9, 0x8B, 0x26, 0xB8, 0x0C, 0x24, 0x99, 0x9A,
+	0x31, 0x12, 0xFB, 0x2A, 0x25, 0xB9, 0x9A, 0x42, 0x81, 0xCA, 0x2A, 0x35,
+	0xC0, 0x9B, 0x11, 0x13, 0xCA, 0x68, 0xA2, 0x9E, 0x51, 0x92, 0x9B, 0x99,
+	0x42, 0x02, 0xB9, 0x9C, 0x53, 0xA1, 0x2A, 0xA8, 0x08, 0x0B, 0x57, 0xBA,
+	0x29, 0x92, 0x0B, 0x35, 0xA8, 0xDB, 0x29, 0x63, 0xA0, 0xAA, 0x28, 0x13,
+	0x91, 0x8F, 0x82, 0x2B, 0x26, 0xEB, 0x39, 0x83, 0x9C, 0x42, 0xB8, 0x1A,
+	0x92, 0x3A, 0x27, 0xBD, 0x40, 0x90, 0x1A, 0x04, 0xAD, 0x41, 0xA1, 0x1A,
+	0x03, 0xAE, 0x51, 0xB1, 0x1A, 0x83, 0x9D, 0x24, 0xC8, 0x29, 0x04, 0xAD,
+	0x22, 0xA1, 0x19, 0x92, 0x9D, 0x53, 0xA1, 0x9C, 0x11, 0x81, 0x28, 0xC8,
+	0x0A, 0x26, 0xB9, 0x0C, 0x43, 0xA0, 0xAC, 0x43, 0x91, 0x8A, 0xB8, 0x79,
+	0x85, 0xAC, 0x31, 0x90, 0x09, 0x01, 0xBB, 0x62, 0x91, 0x8B, 0x13, 0xCD,
+	0x61, 0xA2, 0x8C, 0x31, 0xA9, 0x30, 0x92, 0x9F, 0x22, 0xA0, 0x0B, 0x33,
+	0xB1, 0xAB, 0x19, 0x63, 0x93, 0xCE, 0x40, 0x92, 0x9A, 0x00, 0x00, 0x22,
+	0xD0, 0x9D, 0x72, 0x91, 0x9C, 0x32, 0xB0, 0x2B, 0x03, 0x99, 0x81, 0xBD,
+	0x72, 0xA3, 0x8D, 0x11, 0x88, 0x00, 0x80, 0x98, 0x18, 0x88, 0x35, 0xE9,
+	0x0B, 0x32, 0x30, 0xE2, 0x9F, 0x42, 0x92, 0xBC, 0x31, 0x03, 0xDA, 0x2A,
+	0x34, 0xE8, 0x1B, 0x14, 0xA8, 0x19, 0x91, 0x99, 0x42, 0x80, 0xAB, 0x18,
+	0x33, 0xEA, 0x48, 0x93, 0xAF, 0x41, 0xA2, 0x8C, 0x24, 0xCA, 0x38, 0x82,
+	0xBB, 0x42, 0x81, 0xCA, 0x48, 0x00, 0x90, 0xAA, 0x30, 0x04, 0xBC, 0x21,
+	0x22, 0xC1, 0x9C, 0x99, 0x75, 0xA3, 0xBF, 0x51, 0x82, 0xBB, 0x30, 0x93,
+	0xAA, 0x81, 0x29, 0x27, 0xC9, 0x0B, 0x31, 0x01, 0xB9, 0x9F, 0x63, 0x91,
+	0x9D, 0x31, 0x92, 0xCB, 0x20, 0x22, 0xA1, 0xAD, 0x30, 0x14, 0xCA, 0x18,
+	0x82, 0x9B, 0x42, 0xB1, 0x0A, 0x80, 0x20, 0x94, 0xAF, 0x51, 0x92, 0xBB,
+	0x21, 0x21, 0xA1, 0xAC, 0x33, 0xBC, 0x42, 0xA3, 0x1A, 0xF8, 0x3C, 0x06,
+	0xAA, 0x10, 0xA8, 0x60, 0x82, 0xBD, 0x61, 0xA1, 0x9B, 0x31, 0x01, 0x99,
+	0x89, 0x11, 0x12, 0xBC, 0x20, 0x42, 0xF9, 0x0A, 0x14, 0x89, 0x13, 0xFD,
+	0x29, 0x16, 0xA9, 0x89, 0x00, 0x30, 0x02, 0xBC, 0x00, 0xA8, 0x62, 0x03,
+	0xDE, 0x39, 0x24, 0xBA, 0x88, 0x00, 0x32, 0xE9, 0x1A, 0x16, 0xBB, 0x30,
+	0x02, 0x98, 0xBA, 0x09, 0x73, 0x03, 0xCD, 0x19, 0x23, 0x02, 0xEB, 0x8A,
+	0x42, 0x81, 0x09, 0xA9, 0x8B, 0x55, 0xA1, 0x9A, 0x00, 0xA8, 0x71, 0x82,
+	0xAC, 0x18, 0x82, 0x09, 0x14, 0xCC, 0x28, 0x23, 0xC8, 0x2A, 0x85, 0xAB,
+	0x08, 0x32, 0x22, 0xED, 0x08, 0x21, 0x32, 0xF9, 0x9C, 0x72, 0x91, 0xAA,
+	0x28, 0x23, 0xB8, 0x8C, 0x11, 0x10, 0x03, 0xEC, 0x0A, 0x44, 0xA1, 0xAB,
+	0x49, 0x04, 0xAA, 0x1A, 0x14, 0xA9, 0x08, 0x10, 0x93, 0x9F, 0x31, 0xA2,
+	0xAC, 0x42, 0x03, 0xDE, 0x58, 0x03, 0xBC, 0x19, 0x43, 0x91, 0xBD, 0x38,
+	0x24, 0xB0, 0xBC, 0x42, 0x82, 0xAA, 0x0A, 0x53, 0xA1, 0x9D, 0x32, 0x92,
+	0xBC, 0x38, 0x23, 0x98, 0xFB, 0x29, 0x34, 0xC1, 0x9D, 0x41, 0xA2, 0x9B,
+	0x12, 0x88, 0x11, 0xA8, 0x20, 0xA1, 0xAE, 0x31, 0x82, 0x41, 0xFB, 0x29,
+	0x02, 0x28, 0xF1, 0x9C, 0x53, 0x92, 0xAA, 0xAB, 0x72, 0x85, 0xBA, 0x19,
+	0x12, 0x80, 0x89, 0x01, 0x80, 0xBA, 0x18, 0x73, 0xA3, 0xCF, 0x31, 0x03,
+	0xB9, 0x0B, 0x00, 0x33, 0x02, 0xED, 0x18, 0x12, 0x88, 0x81, 0xDB, 0x48,
+	0x94, 0x8B, 0x02, 0xBD, 0x73, 0xB4, 0x8C, 0x23, 0xB9, 0x29, 0x84, 0xA9,
+	0x9A, 0x52, 0x04, 0xB9, 0xAE, 0x52, 0x92, 0x9C, 0x23, 0xB8, 0x1A, 0x33,
+	0x01, 0xC9, 0xBF, 0x50, 0x04, 0xC9, 0x19, 0x11, 0x08, 0x80, 0xB9, 0x29,
+	0x15, 0xB8, 0x09, 0x12, 0x98, 0x80, 0x81, 0xCA, 0x18, 0x22, 0x21, 0xA4,
+	0x0B, 0xDF, 0x62, 0xA2, 0xBA, 0x9A, 0x73, 0x02, 0xAB, 0x88, 0x10, 0x82,
+	0x20, 0x00, 0xF8, 0x9F, 0x35, 0xB1, 0xAB, 0x22, 0x98, 0x2A, 0x16, 0xCA,
+	0x1A, 0x05, 0x9A, 0x41, 0xA0, 0x8A, 0xA0, 0x49, 0x16, 0xC9, 0x09, 0x81,
+	0x32, 0xB8, 0x9D, 0x20, 0x53, 0xC9, 0x8A, 0x53, 0xB0, 0xAC, 0x63, 0x03,
+	0xCD, 0x19, 0x42, 0x82, 0xDC, 0x18, 0x33, 0xC9, 0x8A, 0x32, 0x82, 0xDB,
+	0x19, 0x34, 0xA1, 0xBE, 0x38, 0x26, 0xB9, 0x8B, 0x32, 0x80, 0xA8, 0x8A,
+	0x34, 0xD8, 0x2A, 0x24, 0xCB, 0x19, 0x33, 0xC9, 0x18, 0xB8, 0x79, 0x84,
+	0xCB, 0x31, 0xB1, 0x19, 0xA2, 0x0C, 0x26, 0xE9, 0x2A, 0x14, 0xA9, 0x8A,
+	0x31, 0x23, 0xFA, 0x8B, 0x42, 0x03, 0xEB, 0x0A, 0x25, 0xA1, 0xBC, 0x41,
+	0x03, 0xBB, 0x89, 0x41, 0x14, 0xFA, 0x0A, 0x24, 0xA0, 0x9B, 0x28, 0x43,
+	0xB1, 0xAE, 0x31, 0x04, 0xC9, 0x0A, 0x32, 0x91, 0xD9, 0x1A, 0x26, 0xB0,
+	0x9C, 0x42, 0xA1, 0x8A, 0x11, 0x99, 0x28, 0xA2, 0x29, 0xC0, 0x28, 0x15,
+	0xDC, 0x28, 0x04, 0x99, 0x88, 0x11, 0xA8, 0x0B, 0x43, 0xA8, 0x29, 0xE8,
+	0x29, 0x84, 0x30, 0x93, 0xEF, 0x20, 0x82, 0x89, 0x80, 0x21, 0xDA, 0x29,
+	0x16, 0xBA, 0x0A, 0x43, 0x90, 0xAA, 0x42, 0xC0, 0x1B, 0x04, 0x9D, 0x34,
+	0xE9, 0x29, 0x02, 0x19, 0xA1, 0x8E, 0x43, 0xB0, 0xAB, 0x32, 0x23, 0xFA,
+	0x0C, 0x44, 0xA0, 0x9C, 0x20, 0x23, 0xC9, 0x9A, 0x20, 0x62, 0xC2, 0x8C,
+	0x31, 0xA0, 0x8A, 0x01, 0x40, 0x93, 0xCE, 0x18, 0x34, 0xA0, 0xCB, 0x29,
+	0x34, 0xA0, 0xBE, 0x30, 0x16, 0xA9, 0x0A, 0x81, 0x8A, 0x13, 0x80, 0x41,
+	0xE0, 0x8C, 0x31, 0x22, 0xC0, 0xAD, 0x42, 0x01, 0xCA, 0x29, 0x33, 0xE8,
+	0x1C, 0x43, 0xC8, 0x8A, 0x22, 0x00, 0xA0, 0x0B, 0x23, 0xC1, 0x9B, 0x51,
+	0x16, 0xEB, 0x89, 0x43, 0x01, 0xDA, 0x0B, 0x44, 0x90, 0x9A, 0x88, 0x41,
+	0xA1, 0x9D, 0x51, 0x91, 0xAA, 0x18, 0x23, 0x90, 0xBA, 0x9C, 0x62, 0x03,
+	0xB9, 0x0C, 0x00, 0x42, 0xD8, 0x1A, 0x14, 0x99, 0x10, 0xD8, 0x29, 0x82,
+	0x49, 0xB2, 0xBD, 0x62, 0x90, 0x09, 0x08, 0x11, 0x01, 0xE9, 0x0A, 0x10,
+	0x34, 0xB9, 0x32, 0x90, 0xEF, 0x19, 0x21, 0x24, 0xCA, 0x8A, 0x01, 0x51,
+	0xB0, 0x0B, 0x02, 0x32, 0xF9, 0x8C, 0x43, 0x91, 0x09, 0xC9, 0x28, 0xA3,
+	0x9E, 0x45, 0xA0, 0xBB, 0x50, 0x12, 0xA8, 0xAA, 0x8D, 0x64, 0x91, 0xBA,
+	0x80, 0x21, 0x33, 0xE8, 0x8B, 0x02, 0x89, 0x23, 0x01, 0x80, 0xBD, 0xAA,
+	0x60, 0x25, 0xDA, 0x09, 0x11, 0x08, 0x11, 0xDA, 0x38, 0x05, 0xAB, 0x98,
+	0x89, 0x73, 0x84, 0xCB, 0x29, 0x23, 0xA9, 0x81, 0xAB, 0x22, 0x91, 0x40,
+	0x06, 0xED, 0x18, 0x10, 0x12, 0x98, 0xBC, 0x20, 0x33, 0x90, 0xA9, 0x98,
+	0xCB, 0x72, 0x01, 0x28, 0xF1, 0x8F, 0x33, 0x91, 0x9B, 0xAA, 0x51, 0x33,
+	0xAA, 0xAB, 0x51, 0x81, 0xA9, 0x88, 0x52, 0xB2, 0xAF, 0x61, 0x82, 0xAC,
+	0x09, 0x31, 0x13, 0xEA, 0x0A, 0x21, 0x11, 0x91, 0xBD, 0x38, 0x15, 0xBA,
+	0x38, 0x90, 0x20, 0xC8, 0x2B, 0x27, 0xBA, 0x0A, 0x90, 0x32, 0x92, 0xAA,
+	0x29, 0x12, 0x33, 0xCF, 0x10, 0x89, 0x99, 0x77, 0xA1, 0x9A, 0x18, 0x82,
+	0x89, 0x0B, 0x35, 0xB1, 0xBF, 0x41, 0x12, 0x08, 0xD8, 0x8B, 0x24, 0xC8,
+	0x38, 0x92, 0x9B, 0x11, 0x99, 0x56, 0xA0, 0xBF, 0x40, 0x13, 0xCA, 0x28,
+	0x01, 0x99, 0x81, 0x0A, 0x31, 0xE0, 0x0B, 0x42, 0x92, 0x99, 0xA8, 0x19,
+	0x57, 0xD9, 0x0A, 0x22, 0x90, 0x01, 0xDB, 0x50, 0x83, 0xAC, 0x10, 0xA8,
+	0x48, 0x84, 0xBB, 0x51, 0xA0, 0x0B, 0x92, 0x3A, 0x07, 0xBA, 0x48, 0x93,
+	0xAD, 0x38, 0x12, 0x81, 0x1B, 0xF8, 0x2C, 0x23, 0xC8, 0x38, 0x81, 0x9C,
+	0x98, 0x29, 0x03, 0xA1, 0x39, 0x14, 0xB8, 0x9D, 0x12, 0x88, 0x59, 0x37,
+	0xF9, 0x0B, 0x13, 0x31, 0x90, 0xCF, 0x38, 0x04, 0x88, 0x99, 0x99, 0x32,
+	0xB2, 0x2B, 0x86, 0xAC, 0x18, 0x24, 0x02, 0xA9, 0xCB, 0x09, 0x53, 0x03,
+	0xC8, 0xAA, 0x18, 0x54, 0x91, 0xBC, 0x19, 0x33, 0x98, 0x39, 0x07, 0xBB,
+	0x40, 0x01, 0x01, 0x8C, 0xB0, 0x30, 0xA0, 0x8C, 0x45, 0xC8, 0x89, 0xD9,
+	0x29, 0x26, 0xE8, 0x8B, 0x12, 0xAA, 0x43, 0xE8, 0x8A, 0x12, 0x00, 0x10,
+	0x91, 0x89, 0xED, 0x18, 0x24, 0x91, 0xBD, 0x09, 0x45, 0x81, 0xBB, 0x19,
+	0x34, 0x82, 0x9C, 0x88, 0x18, 0x02, 0x40, 0x80, 0x41, 0xE0, 0x9D, 0x42,
+	0x22, 0xB1, 0xAF, 0x48, 0x13, 0x98, 0x99, 0x19, 0x25, 0xB8, 0x9A, 0x21,
+	0x11, 0x99, 0x48, 0x27, 0xEA, 0x89, 0x10, 0x32, 0xA1, 0x9E, 0x10, 0x12,
+	0x81, 0xAC, 0x09, 0x89, 0x21, 0xE0, 0xAC, 0x22, 0x81, 0xA8, 0x18, 0xB8,
+	0xFF, 0x89, 0x11, 0xA9, 0x19, 0x43, 0x80, 0xDC, 0x99, 0x08, 0x12, 0x8A,
+	0x23, 0xBA, 0x89, 0x33, 0x42, 0x86, 0xBF, 0x1A, 0x14, 0x00, 0x21, 0x00,
+	0x41, 0x25, 0xBA, 0x01, 0xB9, 0x19, 0x46, 0x34, 0x91, 0x99, 0x10, 0x46,
+	0x91, 0x89, 0x89, 0x60, 0x36, 0x90, 0x88, 0x90, 0xAB, 0x70, 0x14, 0x00,
+	0xCA, 0x8B, 0x63, 0x92, 0x99, 0x99, 0x9A, 0x20, 0xA2, 0xAB, 0x00, 0x20,
+	0xD9, 0xCC, 0x89, 0x31, 0xB0, 0xCF, 0xAC, 0x08, 0xAB, 0x42, 0x13, 0xC0,
+	0xFF, 0x8A, 0x32, 0x03, 0xDB, 0x9A, 0x10, 0x01, 0x88, 0xAA, 0x30, 0x34,
+	0xD8, 0x09, 0x13, 0xA8, 0x1A, 0x45, 0x23, 0xA0, 0xDE, 0x39, 0x34, 0x82,
+	0xAA, 0x8B, 0x44, 0x12, 0x10, 0xA8, 0x1C, 0x35, 0x03, 0xA9, 0x89, 0x52,
+	0x37, 0x03, 0xBC, 0x9B, 0x42, 0x44, 0x82, 0xA9, 0x99, 0x9A, 0x98, 0x41,
+	0x24, 0xA1, 0xCF, 0x09, 0x22, 0xA0, 0x9D, 0x18, 0x12, 0xA0, 0xAE, 0x28,
+	0x22, 0xBA, 0x89, 0xA8, 0xCA, 0xCF, 0x8A, 0x52, 0x91, 0xBA, 0xCD, 0x8B,
+	0x62, 0x01, 0xA9, 0xBA, 0x0A, 0x43, 0x13, 0xC8, 0xBD, 0x09, 0x42, 0x24,
+	0x98, 0x28, 0x81, 0x0B, 0x35, 0xB1, 0x0B, 0x00, 0x70, 0x26, 0x90, 0x9A,
+	0x8A, 0x51, 0x43, 0x91, 0x9B, 0x21, 0x24, 0x08, 0x11, 0x20, 0x53, 0x92,
+	0x19, 0xD8, 0x9C, 0x52, 0x44, 0x22, 0x90, 0xDC, 0xBB, 0x48, 0x33, 0x80,
+	0x98, 0xBA, 0x09, 0xB9, 0x88, 0x91, 0xDC, 0x9B, 0x11, 0x20, 0x01, 0xDA,
+	0xAC, 0x09, 0xC8, 0xBF, 0xBD, 0x0A, 0x22, 0xF9, 0x9C, 0x88, 0xCB, 0x9B,
+	0x18, 0x45, 0x92, 0xCB, 0x99, 0x08, 0x01, 0x18, 0x11, 0x33, 0x67, 0x90,
+	0x9A, 0x10, 0x21, 0x24, 0x80, 0x10, 0x88, 0x91, 0x50, 0x35, 0x13, 0x90,
+	0xDC, 0x28, 0x43, 0x52, 0x24, 0x91, 0x98, 0x89, 0x98, 0x71, 0x35, 0x82,
+	0xB9, 0xBD, 0x28, 0x36, 0x22, 0x90, 0xBA, 0xBC, 0xAA, 0x28, 0x47, 0x02,
+	0xAA, 0xBB, 0x9A, 0x08, 0x81, 0x09, 0x01, 0xA9, 0xCC, 0xA9, 0x08, 0x21,
+	0xC9, 0x19, 0xFB, 0xBF, 0x8B, 0x18, 0x01, 0xA0, 0xEF, 0x9C, 0x88, 0x98,
+	0x88, 0x00, 0x01, 0x20, 0xCA, 0xBA, 0xBF, 0x50, 0x24, 0x11, 0x80, 0x8B,
+	0x20, 0x01, 0x73, 0x07, 0x98, 0x99, 0x09, 0x32, 0x33, 0xA0, 0xA9, 0x8A,
+	0x32, 0x14, 0x18, 0x46, 0x12, 0x18, 0x73, 0x02, 0xDA, 0x8B, 0x73, 0x15,
+	0x98, 0xBA, 0x0B, 0x52, 0x53, 0x01, 0xBA, 0xAC, 0x9A, 0x42, 0x25, 0x80,
+	0xAA, 0xAA, 0x8A, 0x32, 0x91, 0xAA, 0x9A, 0x31, 0x23, 0xEB, 0xBB, 0xBD,
+	0x40, 0x04, 0xBA, 0xCC, 0xAD, 0x08, 0x01, 0x21, 0xFA, 0xBF, 0xA8, 0x8A,
+	0x31, 0x01, 0x10, 0xA0, 0xAE, 0x08, 0x89, 0x31, 0x35, 0x31, 0x23, 0x82,
+	0xAC, 0x98, 0x70, 0x25, 0x21, 0xBA, 0x18, 0x11, 0x10, 0x24, 0x10, 0x13,
+	0xB9, 0xCF, 0x19, 0x44, 0x23, 0x12, 0x01, 0x31, 0xB2, 0xDF, 0x31, 0x35,
+	0x13, 0xEA, 0x9B, 0x20, 0x44, 0x33, 0x90, 0xCC, 0xCB, 0x09, 0x43, 0x33,
+	0x80, 0xDB, 0x9C, 0x08, 0x80, 0x18, 0x00, 0x99, 0x09, 0x11, 0xB8, 0xAE,
+	0x32, 0x25, 0x90, 0xCB, 0xCD, 0xAB, 0x28, 0x34, 0xB8, 0xCF, 0xDB, 0x8A,
+	0x00, 0x88, 0x00, 0x81, 0x89, 0x98, 0x9A, 0x09, 0x71, 0x34, 0x91, 0x9A,
+	0x32, 0x23, 0x53, 0x45, 0x01, 0x99, 0xAA, 0x08, 0x10, 0x45, 0x31, 0x82,
+	0x88, 0x89, 0x92, 0x48, 0x34, 0x35, 0x01, 0x64, 0x12, 0x90, 0x09, 0x40,
+	0x37, 0x33, 0xD8, 0xBD, 0x0A, 0x45, 0x33, 0x01, 0xC9, 0xBC, 0x8B, 0x21,
+	0x35, 0x12, 0xC9, 0xDB, 0x89, 0x11, 0x11, 0x81, 0xA8, 0x9C, 0x08, 0x01,
+	0x88, 0x20, 0x52, 0x03, 0xD9, 0xCD, 0x9A, 0x89, 0x80, 0x80, 0xFB, 0xBF,
+	0xAC, 0x99, 0x00, 0x10, 0x98, 0xA9, 0x88, 0xA9, 0x52, 0x23, 0x88, 0x30,
+	0x81, 0x61, 0x24, 0x98, 0x38, 0x45, 0x25, 0x02, 0xB8, 0xCB, 0x0A, 0x20,
+	0x26, 0x13, 0xB8, 0x08, 0xA8, 0x58, 0x47, 0x02, 0xA9, 0x89, 0x33, 0x33,
+	0xA2, 0x39, 0x67, 0x22, 0x81, 0xFB, 0x9A, 0x11, 0x34, 0x34, 0x82, 0xCB,
+	0xAC, 0x89, 0x31, 0x43, 0x01, 0xCC, 0xAB, 0x08, 0x32, 0x03, 0x08, 0x91,
+	0xAA, 0xAA, 0x10, 0x55, 0x02, 0xAB, 0x52, 0x03, 0xDD, 0xBB, 0xCB, 0x8B,
+	0x00, 0xFA, 0xCB, 0xDB, 0xBB, 0x09, 0x00, 0x00, 0x12, 0x02, 0x88, 0xDC,
+	0x9A, 0x21, 0x52, 0x43, 0x82, 0xAB, 0x12, 0xFB, 0x2A, 0x15, 0x90, 0x08,
+	0xA0, 0xAC, 0x09, 0x11, 0x32, 0x52, 0x34, 0x01, 0x30, 0x82, 0xC0, 0x78,
+	0x45, 0x12, 0x18, 0x91, 0x19, 0x54, 0x22, 0x11, 0xBA, 0x09, 0x11, 0x46,
+	0x15, 0x91, 0x99, 0x99, 0x31, 0x24, 0x22, 0x08, 0xCA, 0x8A, 0x31, 0x64,
+	0x43, 0x91, 0x9A, 0x41, 0x23, 0x62, 0x81, 0x99, 0x31, 0x98, 0x09, 0xA0,
+	0xDE, 0xCB, 0x9A, 0xA8, 0xDD, 0xAB, 0xB9, 0xEB, 0xAA, 0xBA, 0xBC, 0x98,
+	0xCA, 0xAB, 0x20, 0xEA, 0x8B, 0x01, 0xEB, 0xAC, 0x10, 0xA0, 0xBC, 0xBB,
+	0xAA, 0xDB, 0x09, 0x90, 0xAA, 0x38, 0x92, 0x1D, 0x67, 0x90, 0x19, 0x44,
+	0x11, 0x89, 0x31, 0x14, 0x02, 0x32, 0x34, 0x22, 0x35, 0x32, 0x63, 0x13,
+	0x10, 0x42, 0x33, 0x82, 0x41, 0x33, 0x32, 0x01, 0x41, 0x15, 0x52, 0x34,
+	0x81, 0x28, 0x32, 0x21, 0x35, 0x22, 0x42, 0x21, 0x31, 0x21, 0x53, 0xEA,
+	0x0B, 0x33, 0xA2, 0xBF, 0x9A, 0xEB, 0x9A, 0x89, 0xCA, 0xDB, 0x89, 0xDC,
+	0xAD, 0x9A, 0xA8, 0xBD, 0x8A, 0xB9, 0xBC, 0xAA, 0xA9, 0xBB, 0xBE, 0x0A,
+	0xB1, 0xDF, 0x8A, 0xA9, 0x8A, 0xA8, 0xAA, 0x89, 0xBB, 0x29, 0x80, 0x39,
+	0x37, 0x98, 0x71, 0x13, 0x18, 0x53, 0x24, 0x11, 0x41, 0x35, 0x01, 0x38,
+	0x45, 0x12, 0x21, 0x34, 0x32, 0x13, 0x22, 0x42, 0x33, 0x34, 0x23, 0x52,
+	0x24, 0x32, 0x43, 0x21, 0x74, 0x12, 0x98, 0x42, 0x81, 0x10, 0x22, 0x22,
+	0x23, 0x99, 0x48, 0x04, 0x01, 0x91, 0xAE, 0x30, 0xB1, 0xAD, 0xB8, 0xDD,
+	0x9B, 0x08, 0xDA, 0xBD, 0xAC, 0xBD, 0xAC, 0x99, 0xCC, 0xAA, 0x99, 0xCB,
+	0x9A, 0xA8, 0xCB, 0xBB, 0xA8, 0xDC, 0xBC, 0x8A, 0xDA, 0xBB, 0x99, 0xAA,
+	0x9A, 0x80, 0x28, 0x82, 0x38, 0x27, 0x11, 0x36, 0x82, 0x29, 0x37, 0x02,
+	0x31, 0x23, 0x45, 0x83, 0x20, 0x27, 0x12, 0x31, 0x34, 0x12, 0x22, 0x33,
+	0x26, 0x00, 0x61, 0x13, 0x80, 0x44, 0x11, 0x00, 0x34, 0x32, 0x91, 0x38,
+	0x27, 0x00, 0x30, 0x16, 0xA9, 0x28, 0x32, 0x10, 0x90, 0x30, 0x14, 0x9B,
+	0x10, 0x21, 0xEA, 0xAC, 0xAB, 0xCA, 0xBB, 0xBF, 0x9E, 0xCA, 0xCC, 0xBB,
+	0xAA, 0xBB, 0xCC, 0xAC, 0x9A, 0xA9, 0xBC, 0x8A, 0xEB, 0x9B, 0xA9, 0xCC,
+	0xAA, 0xBA, 0xBA, 0xCB, 0x9A, 0x99, 0xDB, 0x20, 0x04, 0x9A, 0x32, 0x14,
+	0x23, 0x00, 0x44, 0x24, 0x22, 0x45, 0x22, 0x42, 0x23, 0x43, 0x45, 0x11,
+	0x22, 0x34, 0x34, 0x12, 0x32, 0x34, 0x02, 0x74, 0x13, 0x88, 0x31, 0x33,
+	0x11, 0x43, 0x35, 0x93, 0x9A, 0x73, 0x12, 0x18, 0x22, 0x02, 0x21, 0x23,
+	0x23, 0x46, 0x03, 0x98, 0x89, 0x20, 0xA1, 0xAF, 0x80, 0xBA, 0xCC, 0xBA,
+	0xDC, 0xCA, 0xCB, 0xCD, 0xAB, 0xB9, 0xBC, 0xAC, 0xAA, 0xBC, 0x9A, 0xA9,
+	0xBB, 0xB9, 0xBF, 0x8A, 0xCC, 0x9B, 0xCA, 0xBB, 0xA9, 0xAC, 0x09, 0xA1,
+	0x9B, 0x53, 0xA1, 0x29, 0x34, 0x11, 0x15, 0x10, 0x42, 0x32, 0x44, 0x14,
+	0x51, 0x25, 0x81, 0x52, 0x24, 0x21, 0x11, 0x53, 0x23, 0x00, 0x32, 0x24,
+	0x80, 0x53, 0x13, 0x31, 0x32, 0x15, 0x43, 0x32, 0x34, 0x12, 0x32, 0x23,
+	0x30, 0x47, 0x01, 0x21, 0x12, 0x43, 0x23, 0x33, 0x34, 0xA1, 0x3A, 0x03,
+	0xBD, 0xBC, 0xBD, 0xAA, 0xC9, 0xAE, 0xDB, 0xCC, 0xBA, 0xCB, 0xCC, 0x9B,
+	0x9A, 0xFB, 0xAA, 0x89, 0xA9, 0x9A, 0xAA, 0xDB, 0xAA, 0xB9, 0xCD, 0xAA,
+	0xBA, 0xCD, 0x8A, 0x81, 0xCB, 0x09, 0x21, 0x98, 0x00, 0x11, 0x22, 0x63,
+	0x23, 0x00, 0x73, 0x14, 0x10, 0x63, 0x13, 0x01, 0x62, 0x33, 0x13, 0x31,
+	0x36, 0x22, 0x22, 0x33, 0x10, 0x35, 0x11, 0x51, 0x34, 0x82, 0x30, 0x43,
+	0x44, 0x32, 0x23, 0x12, 0x12, 0x13, 0x32, 0x77, 0x81, 0x18, 0x22, 0x02,
+	0x11, 0x22, 0x25, 0xA9, 0x9B, 0x32, 0xE9, 0x9A, 0xEA, 0x9A, 0xA0, 0xCC,
+	0xA9, 0xEB, 0xCC, 0xCB, 0x9A, 0xCA, 0xBC, 0x99, 0xCA, 0x9C, 0x88, 0xC8,
+	0x8A, 0xB9, 0xDB, 0xAA, 0xBB, 0xCB, 0xBD, 0xAA, 0xAA, 0xAA, 0x99, 0x99,
+	0x08, 0x10, 0x62, 0x23, 0x40, 0x15, 0x00, 0x33, 0x32, 0x47, 0x01, 0x30,
+	0x44, 0x02, 0x43, 0x35, 0x22, 0x12, 0x33, 0x35, 0x33, 0x43, 0x21, 0x31,
+	0x23, 0x43, 0x37, 0x02, 0x20, 0x34, 0x53, 0x12, 0x42, 0x22, 0x80, 0x32,
+	0x24, 0x52, 0x13, 0x01, 0x52, 0x23, 0x42, 0x22, 0x09, 0x20, 0xB8, 0x09,
+	0xA9, 0x0A, 0xF9, 0xBF, 0x89, 0xC9, 0xCB, 0xC9, 0xDC, 0xDB, 0xBB, 0xBA,
+	0xEB, 0xBB, 0x9A, 0xAC, 0xAB, 0x80, 0xC9, 0xAB, 0xA9, 0xDC, 0xBB, 0xBC,
+	0xCB, 0xBB, 0xAC, 0xAB, 0xAB, 0x10, 0x80, 0x3A, 0x43, 0x33, 0x43, 0x44,
+	0x02, 0x00, 0x33, 0x27, 0x01, 0x44, 0x23, 0x31, 0x44, 0x43, 0x34, 0x22,
+	0x24, 0x42, 0x42, 0x24, 0x00, 0x21, 0x13, 0x11, 0x54, 0x22, 0x11, 0x52,
+	0x33, 0x53, 0x33, 0x32, 0x11, 0x40, 0x22, 0x31, 0x33, 0x34, 0x43, 0x02,
+	0x70, 0x34, 0x02, 0x08, 0x02, 0x00, 0x90, 0x0B, 0x80, 0xEF, 0x9A, 0x90,
+	0xAD, 0xAC, 0xBC, 0xBD, 0xDB, 0xCB, 0xAB, 0xC9, 0xBC, 0x9A, 0xA9, 0xAB,
+	0x8A, 0xCA, 0xBC, 0xBA, 0xBC, 0xCC, 0xCB, 0xBB, 0xBC, 0x89, 0x9A, 0xBB,
+	0x09, 0x12, 0x31, 0x23, 0x46, 0x81, 0x28, 0x35, 0x81, 0x48, 0x33, 0x18,
+	0x65, 0x12, 0x42, 0x24, 0x42, 0x22, 0x43, 0x24, 0x33, 0x23, 0x33, 0x32,
+	0x43, 0x43, 0x11, 0x54, 0x23, 0x21, 0x63, 0x22, 0x43, 0x33, 0x33, 0x12,
+	0x41, 0x33, 0x02, 0x64, 0x12, 0x01, 0x32, 0x23, 0x36, 0x81, 0x18, 0x02,
+	0x10, 0x92, 0xBC, 0x3A, 0xF9, 0xAF, 0x88, 0xDA, 0xAC, 0xBB, 0xCC, 0xBC,
+	0xCB, 0xBA, 0xCC, 0xAA, 0xB9, 0xBB, 0x9A, 0xBA, 0xBC, 0xAA, 0xCB, 0xCC,
+	0xBC, 0xBB, 0xCD, 0x9B, 0xB9, 0xAB, 0x0A, 0x98, 0x28, 0x43, 0x02, 0x52,
+	0x24, 0x22, 0x02, 0x18, 0x25, 0x11, 0x73, 0x12, 0x32, 0x34, 0x44, 0x34,
+	0x33, 0x43, 0x34, 0x32, 0x43, 0x23, 0x22, 0x14, 0x21, 0x12, 0x62, 0x35,
+	0x02, 0x31, 0x36, 0x11, 0x52, 0x23, 0x12, 0x08, 0x42, 0x22, 0x11, 0x34,
+	0x03, 0x08, 0x46, 0x22, 0x13, 0x88, 0x21, 0x98, 0x08, 0xB0, 0xBD, 0xCC,
+	0xCB, 0xCC, 0xA9, 0xEB, 0xAC, 0xCB, 0xBC, 0xAD, 0xAA, 0xBC, 0x9D, 0x9A,
+	0xAB, 0x9A, 0xB8, 0xAC, 0x9A, 0xCB, 0xBB, 0xCC, 0xCA, 0xCA, 0xAD, 0x89,
+	0xA9, 0x9A, 0x80, 0x00, 0x20, 0x22, 0x35, 0x44, 0x02, 0x11, 0x11, 0x43,
+	0x12, 0x31, 0x17, 0x81, 0x54, 0x23, 0x43, 0x24, 0x23, 0x53, 0x22, 0x43,
+	0x23, 0x10, 0x32, 0x83, 0x50, 0x43, 0x33, 0x33, 0x43, 0x54, 0x32, 0x33,
+	0x43, 0x33, 0x82, 0x30, 0x27, 0x11, 0x11, 0x22, 0x23, 0x53, 0x21, 0x45,
+	0x03, 0x09, 0x01, 0x01, 0x89, 0xC9, 0xDA, 0xAB, 0xFA, 0xBC, 0xAA, 0xCB,
+	0xCD, 0xCB, 0xBB, 0xBC, 0xBC, 0xAC, 0xCB, 0xBA, 0xAA, 0xAA, 0x9B, 0xBA,
+	0xBD, 0xAB, 0xDA, 0xAD, 0xBA, 0xCC, 0x9C, 0x8A, 0xBA, 0x89, 0x08, 0x08,
+	0x22, 0x44, 0x33, 0x33, 0x33, 0x14, 0x11, 0x53, 0x10, 0x42, 0x22, 0x36,
+	0x24, 0x54, 0x24, 0x12, 0x43, 0x33, 0x42, 0x33, 0x12, 0x33, 0x31, 0x20,
+	0x53, 0x43, 0x23, 0x33, 0x55, 0x14, 0x32, 0x43, 0x23, 0x12, 0x11, 0x34,
+	0x23, 0x20, 0x33, 0x14, 0x30, 0x37, 0x33, 0x13, 0x80, 0x11, 0x38, 0x33,
+	0xF8, 0xCC, 0xBA, 0xC9, 0xBC, 0xAC, 0xDB, 0xBD, 0xDB, 0xCB, 0xCA, 0xBA,
+	0xBC, 0xAB, 0xCA, 0x9C, 0x9A, 0x99, 0x9A, 0x99, 0xEA, 0xAB, 0xDB, 0xBA,
+	0xDB, 0xAC, 0xAA, 0xAB, 0xAB, 0x08, 0x00, 0x21, 0x34, 0x45, 0x12, 0x42,
+	0x22, 0x11, 0x21, 0x12, 0x32, 0x05, 0x32, 0x46, 0x33, 0x45, 0x32, 0x43,
+	0x34, 0x32, 0x43, 0x43, 0x22, 0x01, 0x32, 0x14, 0x10, 0x33, 0x25, 0x41,
+	0x33, 0x43, 0x24, 0x53, 0x32, 0x12, 0x51, 0x33, 0x81, 0x42, 0x24, 0x81,
+	0x21, 0x32, 0x24, 0x89, 0x30, 0x12, 0x9B, 0x11, 0xEB, 0xBB, 0x9A, 0xFC,
+	0xBC, 0xDB, 0xEB, 0xCB, 0xCA, 0xDB, 0xBB, 0xCA, 0xBB, 0xAC, 0xB9, 0xBB,
+	0x9A, 0xBA, 0xA9, 0x98, 0xAD, 0xAD, 0xCC, 0xCB, 0xBA, 0xAC, 0xCB, 0xAB,
+	0xAA, 0x99, 0x31, 0x33, 0x31, 0x37, 0x13, 0x32, 0x35, 0x12, 0x13, 0x02,
+	0x33, 0x32, 0x72, 0x26, 0x11, 0x34, 0x24, 0x34, 0x43, 0x33, 0x43, 0x23,
+	0x25, 0x12, 0x32, 0x14, 0x18, 0x44, 0x01, 0x10, 0x22, 0x24, 0x33, 0x53,
+	0x53, 0x01, 0x41, 0x43, 0x22, 0x32, 0x24, 0x21, 0x20, 0x12, 0x83, 0x9A,
+	0x28, 0xFA, 0x9C, 0x02, 0xA8, 0xBA, 0x89, 0xB9, 0xCF, 0xCC, 0xCB, 0xCD,
+	0xCB, 0xCB, 0xBB, 0xCC, 0xBB, 0xAB, 0xBA, 0xBA, 0x88, 0xAA, 0xA9, 0xB1,
+	0xAF, 0xB9, 0xCD, 0xBB, 0xBD, 0xBB, 0xAC, 0x9C, 0x89, 0x8A, 0x08, 0x24,
+	0x32, 0x25, 0x32, 0x25, 0x11, 0x33, 0x12, 0x08, 0x32, 0x11, 0x34, 0x43,
+	0x74, 0x33, 0x22, 0x36, 0x33, 0x44, 0x33, 0x33, 0x33, 0x13, 0x53, 0x01,
+	0x22, 0x23, 0xB9, 0x52, 0x34, 0x31, 0x63, 0x33, 0x25, 0x32, 0x63, 0x23,
+	0x21, 0x32, 0x12, 0x10, 0x11, 0x80, 0x90, 0x88, 0x9A, 0x12, 0x52, 0x91,
+	0x10, 0xA3, 0xAF, 0xFB, 0xCC, 0xCC, 0xFB, 0xBB, 0xCA, 0xCB, 0xCB, 0xBB,
+	0xCB, 0xBA, 0xAA, 0x89, 0xB9, 0x9A, 0x10, 0xD9, 0xAC, 0xAA, 0xFB, 0xBD,
+	0xBB, 0xBB, 0xBD, 0x8A, 0x9A, 0x99, 0x30, 0x44, 0x21, 0x63, 0x22, 0x01,
+	0x42, 0x23, 0x98, 0x10, 0x13, 0x80, 0x48, 0x55, 0x12, 0x41, 0x44, 0x24,
+	0x33, 0x53, 0x33, 0x23, 0x42, 0x12, 0x12, 0x11, 0x01, 0x80, 0x22, 0x31,
+	0x46, 0x34, 0x34, 0x33, 0x43, 0x53, 0x34, 0x12, 0x20, 0x03, 0x10, 0x71,
+	0x37, 0x00, 0x88, 0x98, 0x18, 0x90, 0xA9, 0x9A, 0xAB, 0xA8, 0xBF, 0xDC,
+	0xBC, 0xCC, 0xBC, 0xBC, 0xBB, 0xCC, 0xBC, 0xAA, 0xBC, 0x08, 0x11, 0x11,
+	0x11, 0x44, 0x12, 0x32, 0x03, 0xA9, 0xBC, 0xCA, 0xCE, 0x8A, 0x98, 0x8A,
+	0x01, 0x10, 0x46, 0x32, 0x02, 0x08, 0x12, 0x41, 0x83, 0xFB, 0x9A, 0xAC,
+	0x08, 0xA8, 0x30, 0x88, 0x62, 0x14, 0x42, 0x37, 0x34, 0x12, 0x02, 0x88,
+	0x41, 0x82, 0x31, 0xA3, 0x1C, 0x90, 0x09, 0x80, 0x20, 0x81, 0x1C, 0x95,
+	0x9E, 0xB0, 0xBE, 0x09, 0x48, 0x27, 0x10, 0x22, 0x81, 0x73, 0x24, 0x23,
+	0x98, 0x88, 0xDB, 0x9A, 0x99, 0xA9, 0xED, 0xAB, 0xDB, 0xBB, 0xEB, 0xBD,
+	0x9A, 0xAC, 0x09, 0xB9, 0x0A, 0x42, 0x24, 0x63, 0x24, 0x21, 0x24, 0x12,
+	0x10, 0x88, 0x09, 0xA0, 0x8A, 0x88, 0xA0, 0x10, 0xFB, 0x0C, 0x98, 0x88,
+	0xC9, 0xFB, 0xAD, 0x88, 0xBA, 0x89, 0x98, 0x20, 0x13, 0x52, 0x13, 0x73,
+	0x25, 0x32, 0x33, 0x45, 0x12, 0x08, 0x99, 0x20, 0x42, 0x12, 0x11, 0xC9,
+	0xAB, 0x31, 0x93, 0xBB, 0xFA, 0xCF, 0xAB, 0xAA, 0xBB, 0x8A, 0x18, 0x31,
+	0x46, 0x12, 0x32, 0x23, 0x33, 0x24, 0x03, 0xCE, 0x99, 0xDB, 0x9A, 0x88,
+	0x99, 0xAA, 0xBA, 0xCF, 0xDB, 0xCD, 0x99, 0xBA, 0xAB, 0x9B, 0xAA, 0x70,
+	0x35, 0x32, 0x34, 0x21, 0x33, 0x43, 0x23, 0xA8, 0x99, 0xFB, 0x09, 0x90,
+	0x18, 0x90, 0x08, 0xA9, 0x11, 0xFB, 0xBB, 0xDD, 0xAA, 0x90, 0x8A, 0xB8,
+	0x9C, 0x23, 0x73, 0x25, 0x22, 0x11, 0x32, 0x34, 0x22, 0x44, 0x11, 0x01,
+	0xBA, 0x21, 0x9A, 0x65, 0x01, 0x00, 0xB8, 0xBB, 0xDB, 0xAC, 0xCB, 0x9B,
+	0xEC, 0x8A, 0xA8, 0x19, 0x23, 0x43, 0x22, 0x32, 0x13, 0x10, 0x13, 0x8A,
+	0x82, 0x0B, 0xFC, 0x8B, 0xEA, 0x89, 0x00, 0xE9, 0xAA, 0xEF, 0xAA, 0xBD,
+	0x88, 0xCA, 0x98, 0x9D, 0x80, 0x20, 0x46, 0x12, 0x33, 0x22, 0x31, 0x12,
+	0x31, 0x90, 0x19, 0xFA, 0x8C, 0x88, 0x29, 0x23, 0x00, 0xC9, 0x9C, 0xD9,
+	0xAD, 0xB9, 0xBB, 0x80, 0xAA, 0x80, 0x8A, 0x77, 0x21, 0x24, 0x81, 0x11,
+	0x10, 0x23, 0x20, 0x22, 0x62, 0x33, 0x81, 0x89, 0x11, 0x52, 0x13, 0x99,
+	0xB8, 0xFF, 0xAB, 0x9A, 0xA9, 0x8B, 0xB1, 0xAF, 0x90, 0x9A, 0x33, 0x63,
+	0x03, 0x08, 0x81, 0x28, 0x33, 0x01, 0x32, 0x84, 0xB9, 0xCF, 0x99, 0xAB,
+	0x88, 0xCD, 0x9B, 0xDB, 0xCC, 0xBC, 0xBB, 0xBB, 0xDC, 0xBC, 0x89, 0x09,
+	0x31, 0x65, 0x23, 0x54, 0x13, 0x20, 0x01, 0x00, 0x91, 0x00, 0xB9, 0xAC,
+	0xCC, 0x19, 0x02, 0x20, 0xB2, 0x8E, 0xD9, 0xBB, 0xDA, 0x9B, 0x98, 0x08,
+	0x21, 0x32, 0x35, 0x44, 0x34, 0x33, 0x24, 0x81, 0x20, 0x90, 0x31, 0x56,
+	0x22, 0x90, 0x88, 0x00, 0x11, 0x11, 0xD8, 0xBF, 0xBA, 0xBC, 0x28, 0xA8,
+	0xCA, 0x9A, 0xA8, 0x2A, 0xA2, 0x2B, 0x36, 0x23, 0x41, 0x14, 0x00, 0x10,
+	0x53, 0x01, 0x12, 0xFC, 0xBB, 0xAA, 0x88, 0xB9, 0xAC, 0xD9, 0xBC, 0xDD,
+	0x9A, 0xFB, 0xAB, 0xBA, 0xBB, 0x80, 0xC9, 0x48, 0x37, 0x53, 0x35, 0x01,
+	0x00, 0x08, 0x10, 0x11, 0xA8, 0xAE, 0x9A, 0x09, 0x22, 0x21, 0x82, 0xBE,
+	0xAA, 0xCC, 0xAB, 0xAC, 0xBB, 0x18, 0x32, 0x43, 0x35, 0x33, 0x44, 0x43,
+	0x12, 0x80, 0x99, 0x18, 0x42, 0x36, 0x11, 0x32, 0x12, 0xC9, 0x58, 0x92,
+	0xCC, 0xC9, 0xAA, 0x88, 0xB9, 0x9C, 0x21, 0x81, 0x99, 0x01, 0xFB, 0xAA,
+	0x9B, 0x31, 0x36, 0x83, 0x08, 0x42, 0x25, 0x33, 0x91, 0xCB, 0xCA, 0xAC,
+	0xBC, 0x19, 0xA8, 0x99, 0xDA, 0x28, 0xFB, 0xBD, 0xBE, 0x9C, 0xA9, 0xCB,
+	0x8A, 0x9A, 0x62, 0x35, 0x43, 0x24, 0x12, 0x10, 0x01, 0x02, 0x99, 0xEA,
+	0x8C, 0x00, 0x99, 0x11, 0x99, 0x21, 0xBC, 0xB8, 0xCF, 0x99, 0xAD, 0x88,
+	0x00, 0x12, 0x21, 0x44, 0x42, 0x24, 0x01, 0x11, 0x80, 0x8A, 0x22, 0x11,
+	0x22, 0x72, 0x25, 0x31, 0x91, 0x8C, 0x81, 0x98, 0xDB, 0xAA, 0xEC, 0x9A,
+	0x08, 0x31, 0x01, 0xFB, 0x9B, 0x00, 0x80, 0x99, 0x20, 0x12, 0x73, 0x81,
+	0x44, 0x01, 0x12, 0x88, 0x81, 0xB9, 0xDF, 0x9A, 0x09, 0x98, 0x08, 0xEB,
+	0x09, 0xDC, 0xA9, 0xCE, 0xAA, 0x8A, 0xC9, 0x9C, 0x08, 0x51, 0x36, 0x32,
+	0x43, 0x02, 0x10, 0x18, 0x02, 0xB9, 0xCC, 0x8B, 0xA0, 0x8A, 0x11, 0x31,
+	0xA1, 0xEB, 0xAF, 0xAA, 0xAC, 0x98, 0x89, 0x80, 0x31, 0x44, 0x35, 0x34,
+	0x33, 0x11, 0x08, 0x80, 0xCB, 0x38, 0x33, 0x24, 0x42, 0x35, 0x42, 0xA1,
+	0x9D, 0x00, 0xB8, 0xAF, 0x88, 0x89, 0x98, 0x08, 0x32, 0x83, 0xED, 0xAA,
+	0x00, 0xB8, 0x9B, 0x18, 0x42, 0x22, 0x25, 0x10, 0x36, 0x02, 0x08, 0x14,
+	0xBC, 0xA0, 0xAD, 0xA9, 0x30, 0xF0, 0xAC, 0xCA, 0xBC, 0x29, 0xFC, 0x8E,
+	0x98, 0xA9, 0x19, 0x01, 0x41, 0x36, 0x11, 0x24, 0x23, 0x90, 0x20, 0x80,
+	0x89, 0xCA, 0x9C, 0xA8, 0x29, 0xA2, 0x2B, 0xE3, 0x9F, 0x98, 0xA9, 0xBC,
+	0x80, 0xBA, 0x3A, 0x35, 0x21, 0x37, 0x21, 0x33, 0x31, 0x81, 0x10, 0xCA,
+	0x41, 0x80, 0x13, 0x49, 0x37, 0x21, 0xC9, 0x09, 0xDA, 0x9A, 0x89, 0x00,
+	0x11, 0xCD, 0x0A, 0x43, 0xA1, 0x08, 0xCA, 0x89, 0xDB, 0xAA, 0x19, 0x83,
+	0x0B, 0x44, 0x63, 0x03, 0x01, 0x10, 0x32, 0x03, 0xFB, 0xAB, 0xAA, 0xAA,
+	0x9A, 0x90, 0xFD, 0xCE, 0xCB, 0xAA, 0xBC, 0xA9, 0xAF, 0x20, 0x10, 0x53,
+	0x43, 0x22, 0x42, 0x23, 0x01, 0x01, 0xAA, 0x80, 0xBA, 0x10, 0xCA, 0x8A,
+	0xDC, 0x0C, 0x80, 0xBB, 0xCD, 0x9B, 0xBA, 0x0A, 0x90, 0x60, 0x05, 0x38,
+	0x26, 0x32, 0x04, 0x00, 0x82, 0x08, 0x81, 0x09, 0x81, 0x08, 0x47, 0x33,
+	0x91, 0xAD, 0x99, 0xA9, 0xB9, 0x9B, 0x31, 0xA1, 0x28, 0x13, 0x15, 0xEE,
+	0x99, 0x09, 0x91, 0xAF, 0x8A, 0x09, 0x31, 0x12, 0x32, 0x35, 0x22, 0xB9,
+	0x72, 0xB1, 0x09, 0xCA, 0xA9, 0x9B, 0xB0, 0x9D, 0xC9, 0x9B, 0xFD, 0xDC,
+	0xBD, 0x8A, 0x9A, 0x28, 0x90, 0x30, 0x54, 0x34, 0x53, 0x24, 0x00, 0x31,
+	0x91, 0x00, 0xCA, 0xBA, 0x8C, 0x11, 0x88, 0xC9, 0xAC, 0x99, 0x88, 0x99,
+	0xCE, 0xBA, 0x9B, 0x08, 0x54, 0x23, 0x42, 0x22, 0x43, 0x21, 0x22, 0x20,
+	0x16, 0x00, 0x99, 0x08, 0x42, 0x34, 0x91, 0xCB, 0x98, 0xAD, 0x89, 0x20,
+	0x01, 0xCB, 0xAD, 0x28, 0x91, 0x9A, 0x21, 0xC9, 0xAA, 0xEF, 0x8A, 0x89,
+	0x89, 0x11, 0x28, 0x14, 0x61, 0x14, 0x31, 0x82, 0x20, 0xC0, 0x99, 0x9B,
+	0x90, 0xDF, 0x99, 0xD8, 0xCF, 0xA9, 0xBD, 0x99, 0xAB, 0x08, 0x21, 0x01,
+	0x74, 0x24, 0x31, 0x24, 0x11, 0x11, 0x80, 0x90, 0x0A, 0xB2, 0x8C, 0xB8,
+	0xA8, 0x9F, 0x90, 0x98, 0xBC, 0xC8, 0xAF, 0x09, 0x8A, 0x80, 0x21, 0x12,
+	0x74, 0x23, 0x23, 0x21, 0x82, 0x30, 0x14, 0x80, 0xDA, 0x09, 0x54, 0x23,
+	0x93, 0xCC, 0xB9, 0x0A, 0x03, 0x1A, 0xA1, 0x08, 0xEE, 0x28, 0x00, 0x88,
+	0xAA, 0x00, 0x00, 0xB9, 0xBD, 0x19, 0x82, 0x8A, 0x99, 0x28, 0x30, 0x17,
+	0x44, 0x13, 0x90, 0xCC, 0x88, 0x28, 0x35, 0xB0, 0xAC, 0xFD, 0xBC, 0xCB,
+	0xCF, 0x8B, 0x98, 0x09, 0x80, 0x28, 0x52, 0x44, 0x42, 0x23, 0x12, 0x11,
+	0x11, 0x00, 0x80, 0xBD, 0xA9, 0x8A, 0x91, 0x9E, 0x88, 0x81, 0xAB, 0xBD,
+	0xCC, 0x9C, 0xA8, 0xAC, 0x21, 0x43, 0x43, 0x54, 0x01, 0x32, 0x81, 0x52,
+	0x81, 0x88, 0xA9, 0x08, 0x42, 0x26, 0xB8, 0x8A, 0x9A, 0x20, 0xA8, 0x00,
+	0x00, 0xE9, 0xAC, 0x88, 0xB9, 0x9B, 0x18, 0x56, 0x90, 0xCA, 0xBB, 0xAA,
+	0x20, 0x81, 0x00, 0x9A, 0x51, 0x47, 0x01, 0x33, 0xB9, 0xDB, 0x0A, 0x98,
+	0x41, 0xA1, 0x0A, 0xFA, 0xFF, 0xBA, 0xBC, 0xA9, 0x99, 0x89, 0x19, 0x33,
+	0x65, 0x14, 0x31, 0x13, 0x32, 0x11, 0x01, 0x11, 0xA1, 0x0C, 0x89, 0xD9,
+	0xAD, 0x20, 0x02, 0xD9, 0xCB, 0xAD, 0xA8, 0xBB, 0xAA, 0x8A, 0x31, 0x56,
+	0x24, 0x23, 0x11, 0x21, 0x35, 0x01, 0x00, 0x90, 0x0B, 0x46, 0x23, 0x91,
+	0xBE, 0x8A, 0x10, 0xA0, 0x39, 0x93, 0x89, 0xFB, 0x8B, 0x02, 0xB9, 0x9C,
+	0x50, 0x83, 0xA9, 0xCB, 0x09, 0xA1, 0xAD, 0x89, 0x98, 0x80, 0x40, 0x35,
+	0x12, 0xD9, 0x09, 0x99, 0xB2, 0x0E, 0x24, 0x21, 0xB0, 0xFF, 0x9D, 0xCA,
+	0xAD, 0xA8, 0x99, 0x80, 0x08, 0x30, 0x54, 0x25, 0x31, 0x25, 0x11, 0x02,
+	0xAB, 0x80, 0x18, 0xA1, 0x9D, 0x11, 0x99, 0x30, 0x02, 0x88, 0xFF, 0x9B,
+	0xCB, 0x89, 0xBA, 0x28, 0x32, 0x46, 0x11, 0x21, 0x23, 0x63, 0x11, 0x31,
+	0xB9, 0x19, 0x22, 0x35, 0x98, 0x89, 0xCB, 0x19, 0x81, 0xBB, 0x9C, 0x00,
+	0xFA, 0x9C, 0x90, 0x11, 0xA8, 0x60, 0x24, 0x90, 0xAB, 0xAA, 0xBB, 0xBB,
+	0xDB, 0x19, 0x92, 0xCB, 0x9A, 0x54, 0x82, 0xBA, 0x8D, 0xD9, 0x39, 0x43,
+	0xA1, 0x8B, 0xFC, 0x1C, 0xFD, 0x9B, 0x08, 0xB9, 0x8B, 0xA8, 0x38, 0x73,
+	0x33, 0x62, 0x03, 0x28, 0x13, 0x32, 0x02, 0x09, 0xCC, 0x2A, 0x83, 0x19,
+	0x16, 0xAA, 0xDB, 0x88, 0xEA, 0x9B, 0xB8, 0xBC, 0x8A, 0x11, 0x42, 0x24,
+	0x53, 0x25, 0x23, 0x02, 0x11, 0x80, 0x38, 0x36, 0x02, 0xC8, 0xBB, 0x0B,
+	0x22, 0x01, 0x21, 0x10, 0xFD, 0x8B, 0xAA, 0x10, 0xBC, 0x00, 0x29, 0x04,
+	0xA9, 0x11, 0x38, 0x86, 0xAD, 0xDB, 0x9B, 0x99, 0x41, 0x12, 0x80, 0xDA,
+	0xDA, 0x9C, 0x01, 0x18, 0xA0, 0x8D, 0xB1, 0xBF, 0x98, 0xFF, 0x89, 0x90,
+	0x99, 0x08, 0x89, 0x33, 0x52, 0x24, 0x35, 0x02, 0x29, 0xB0, 0x50, 0xA1,
+	0x89, 0x28, 0x25, 0x00, 0x21, 0xB9, 0x89, 0xCD, 0xCC, 0x9A, 0xDA, 0x8C,
+	0x80, 0x31, 0x02, 0x31, 0x42, 0x46, 0x11, 0x32, 0x90, 0x18, 0x08, 0x38,
+	0x36, 0x02, 0xBA, 0x48, 0x13, 0x9A, 0xA8, 0xCF, 0x98, 0xBE, 0x18, 0x11,
+	0x81, 0x18, 0x23, 0x53, 0xA1, 0xAE, 0x20, 0xB8, 0x9A, 0xBB, 0x08, 0x89,
+	0xE9, 0x59, 0xA3, 0xCB, 0xBC, 0xB9, 0x0A, 0xA0, 0x1B, 0x90, 0xD0, 0x8C,
+	0x38, 0x37, 0xFF, 0x8A, 0x89, 0xB2, 0x8E, 0xB1, 0x29, 0x92, 0x72, 0x13,
+	0x20, 0x90, 0x41, 0x12, 0x11, 0xC9, 0x1B, 0x82, 0x61, 0x81, 0x20, 0xFB,
+	0x88, 0x88, 0xA1, 0xBB, 0xCA, 0x1A, 0x80, 0x30, 0x14, 0x02, 0x3A, 0x77,
+	0x13, 0x22, 0x81, 0x10, 0x31, 0x25, 0x89, 0xC8, 0x9D, 0x12, 0x11, 0x23,
+	0x90, 0xCE, 0x9B, 0x98, 0x09, 0xA8, 0x8B, 0x31, 0x34, 0x22, 0x12, 0x9A,
+	0xB0, 0x1C, 0xA2, 0xDE, 0xBA, 0x19, 0x81, 0xB8, 0xDD, 0xBB, 0xDC, 0x8B,
+	0xA9, 0x21, 0xFB, 0xBB, 0xCB, 0x2A, 0xB6, 0xBF, 0x90, 0x8A, 0x9A, 0x08,
+	0x9B, 0x23, 0x48, 0x77, 0x12, 0x01, 0x18, 0x21, 0x23, 0x80, 0xEB, 0x0A,
+	0xC8, 0x48, 0x12, 0x02, 0x8A, 0x22, 0x90, 0xAA, 0xEF, 0x0A, 0xA0, 0x8C,
+	0x02, 0x0A, 0x13, 0x75, 0x12, 0x21, 0x98, 0x48, 0x13, 0x21, 0xB8, 0x8A,
+	0xE9, 0x18, 0x11, 0x36, 0xA0, 0xAB, 0xA9, 0xA8, 0xAC, 0x98, 0x9B, 0x42,
+	0x43, 0x43, 0x34, 0x02, 0x08, 0xB9, 0xBD, 0xCD, 0x8B, 0x11, 0x33, 0x00,
+	0x98, 0xAF, 0xBA, 0xBF, 0xBA, 0xAA, 0xDC, 0x9A, 0xBB, 0x38, 0xF8, 0x2B,
+	0x05, 0x19, 0xA2, 0x0A, 0xB9, 0x11, 0x8C, 0x67, 0x80, 0x10, 0x98, 0x42,
+	0x02, 0x83, 0x1B, 0x85, 0x8B, 0x88, 0x52, 0xD8, 0x18, 0x80, 0x10, 0xEA,
+	0xBA, 0x38, 0x11, 0x99, 0x09, 0xA8, 0x65, 0x88, 0x64, 0x12, 0x10, 0x01,
+	0x22, 0x12, 0x00, 0x09, 0x34, 0xA0, 0x39, 0x37, 0xA8, 0xCC, 0xAA, 0x8A,
+	0xCA, 0xAA, 0xBA, 0x18, 0x65, 0x12, 0x22, 0x82, 0xCB, 0x20, 0x22, 0xB0,
+	0xAC, 0xCB, 0x89, 0xA9, 0xEB, 0xCC, 0x9A, 0xBC, 0xBC, 0x9A, 0x81, 0xBD,
+	0x99, 0x88, 0x40, 0xB4, 0xFF, 0x8A, 0x00, 0x90, 0x8B, 0xA9, 0x50, 0xA1,
+	0x72, 0x83, 0x11, 0x99, 0x42, 0x12, 0x03, 0xBF, 0x28, 0x08, 0x81, 0x38,
+	0x27, 0x18, 0x01, 0x18, 0x04, 0xBC, 0xA0, 0x8E, 0x80, 0x0A, 0x92, 0x10,
+	0x33, 0x41, 0x27, 0x21, 0x11, 0x24, 0xA1, 0x2A, 0x03, 0x1B, 0x27, 0x11,
+	0x81, 0xD9, 0x8C, 0x02, 0x28, 0xE8, 0xAA, 0xAB, 0x08, 0x08, 0x64, 0x12,
+	0x12, 0x21, 0x25, 0xA9, 0x99, 0xBC, 0x88, 0x9A, 0xA2, 0xBB, 0xCF, 0xAA,
+	0xCA, 0xA9, 0xBF, 0xCB, 0xBD, 0xAB, 0x8B, 0x21, 0xFB, 0x0A, 0x90, 0x38,
+	0x82, 0x10, 0xC9, 0x90, 0x1E, 0x27, 0x08, 0x83, 0x19, 0x14, 0x41, 0xB1,
+	0x0B, 0x80, 0x20, 0xB9, 0x65, 0xB9, 0x30, 0x33, 0x24, 0x13, 0xBB, 0x28,
+	0x04, 0x9A, 0xF8, 0x2C, 0x24, 0x88, 0x89, 0x43, 0x52, 0x46, 0x01, 0x99,
+	0x99, 0x08, 0x73, 0x23, 0xB1, 0xAC, 0x89, 0x41, 0x02, 0x00, 0xDA, 0xAA,
+	0x10, 0x12, 0xA9, 0x88, 0xAB, 0x52, 0x11, 0xEB, 0x09, 0x20, 0x36, 0x11,
+	0xB8, 0xAE, 0xBA, 0x8A, 0xD9, 0xBC, 0xCC, 0xAA, 0xBB, 0x99, 0xCD, 0x38,
+	0xA4, 0xBD, 0xAB, 0x31, 0xA9, 0x27, 0xDB, 0x80, 0x8C, 0x02, 0x38, 0xB3,
+	0x58, 0x82, 0x41, 0x11, 0x01, 0x09, 0x10, 0x24, 0xBD, 0x30, 0xCA, 0x32,
+	0x55, 0x13, 0x11, 0x08, 0x23, 0x8C, 0x02, 0xB9, 0xAF, 0x51, 0xA0, 0x20,
+	0x22, 0x44, 0x12, 0x21, 0x23, 0xDA, 0x18, 0x21, 0x04, 0xCC, 0xAA, 0x10,
+	0x11, 0x42, 0x24, 0x10, 0x00, 0x00, 0xA9, 0xED, 0x9B, 0x31, 0x13, 0x80,
+	0xCB, 0x39, 0x26, 0x12, 0x10, 0xFA, 0x9C, 0xBC, 0x8A, 0xC9, 0xBB, 0xA9,
+	0xDA, 0x9A, 0xBC, 0xCA, 0xAC, 0x81, 0xBD, 0x9B, 0xA9, 0x89, 0xA8, 0x48,
+	0x83, 0x10, 0xB9, 0x91, 0xFF, 0x31, 0x22, 0x32, 0xA2, 0x0D, 0x16, 0x0A,
+	0x90, 0x30, 0xEA, 0x88, 0x0A, 0x37, 0x01, 0x21, 0x53, 0x22, 0x22, 0x88,
+	0x14, 0xDA, 0x48, 0x81, 0x21, 0xA3, 0x4A, 0x15, 0x63, 0x13, 0x91, 0xBC,
+	0x29, 0x11, 0x99, 0x8A, 0xA1, 0x1B, 0xC0, 0x71, 0x12, 0x08, 0x09, 0x33,
+	0xB8, 0xEC, 0xAA, 0xA9, 0x71, 0xA1, 0x29, 0xA2, 0x58, 0xB3, 0xAA, 0xFA,
+	0xAA, 0xCB, 0xAA, 0x9B, 0x01, 0xDF, 0x10, 0xB0, 0x8A, 0x98, 0xFB, 0x1A,
+	0xA1, 0x1C, 0x06, 0xBB, 0x22, 0x09, 0xE9, 0x2A, 0xA1, 0x9D, 0x21, 0xA9,
+	0x18, 0x22, 0x98, 0x73, 0x92, 0x9C, 0x33, 0xA9, 0x18, 0xB3, 0x9F, 0x31,
+	0x16, 0x10, 0x17, 0x89, 0x33, 0x98, 0x33, 0x20, 0x98, 0x21, 0x11, 0x12,
+	0x1A, 0x77, 0x10, 0x10, 0x80, 0xB0, 0x9D, 0x98, 0xAD, 0x18, 0x9B, 0x37,
+	0x9B, 0x37, 0x88, 0x12, 0x80, 0x9A, 0x12, 0x81, 0xDA, 0x73, 0xB8, 0x2A,
+	0x03, 0xB1, 0x8F, 0x83, 0x09, 0xA1, 0x8D, 0xE9, 0x0C, 0x93, 0x8C, 0xB0,
+	0x09, 0x38, 0xB4, 0x5B, 0xC1, 0x49, 0xA1, 0x8B, 0x34, 0xFA, 0x3C, 0xB2,
+	0x38, 0xC8, 0x0B, 0x23, 0xB9, 0x9B, 0x90, 0x2B, 0x05, 0x89, 0x56, 0xA0,
+	0x18, 0x91, 0x1D, 0x17, 0x9C, 0x12, 0xB8, 0x41, 0x82, 0x0B, 0xB0, 0x3B,
+	0x17, 0x98, 0x3A, 0x94, 0x0E, 0x04, 0x99, 0x40, 0xC1, 0x18, 0x20, 0x82,
+	0x09, 0x38, 0xA5, 0x1C, 0x34, 0xC0, 0x9B, 0x12, 0x1B, 0x27, 0x9A, 0x88,
+	0xBA, 0x09, 0x27, 0xCB, 0x22, 0xDA, 0x72, 0xA0, 0x2A, 0x91, 0x9A, 0x32,
+	0xAA, 0x84, 0xAD, 0x11, 0xE2, 0x1C, 0x83, 0xBA, 0x52, 0xDB, 0x52, 0xB0,
+	0x28, 0xA0, 0x19, 0xA4, 0x0E, 0x14, 0xAA, 0x62, 0xB8, 0x39, 0xA0, 0x0B,
+	0x23, 0xCE, 0x31, 0xB0, 0x5A, 0xA2, 0x0C, 0x23, 0x8B, 0x22, 0xA8, 0x30,
+	0x81, 0xA0, 0x20, 0x95, 0x0F, 0x84, 0x1A, 0x11, 0xCA, 0x30, 0xC1, 0x8C,
+	0x14, 0x10, 0xF8, 0x3B, 0x85, 0x10, 0x9B, 0x15, 0xAB, 0x20, 0x92, 0x1D,
+	0x94, 0x8B, 0x01, 0x35, 0xEB, 0x11, 0x09, 0xB8, 0x53, 0xD9, 0x28, 0xA8,
+	0x11, 0x09, 0x80, 0x4A, 0xB1, 0x42, 0xDB, 0x19, 0x96, 0x1C, 0xA2, 0x00,
+	0x8E, 0x23, 0xA9, 0x48, 0xC1, 0x58, 0xC0, 0x29, 0x00, 0x03, 0x9F, 0x14,
+	0xB9, 0x59, 0xB1, 0x1B, 0x26, 0xCC, 0x41, 0xB8, 0x39, 0xA3, 0x0A, 0x28,
+	0x84, 0x8F, 0x84, 0x1B, 0x93, 0x1B, 0x13, 0xCC, 0x51, 0xB8, 0x28, 0x84,
+	0x9C, 0x52, 0xC1, 0x1C, 0x13, 0xAB, 0x11, 0xA8, 0x20, 0x90, 0x88, 0x30,
+	0xF3, 0x1C, 0x04, 0x8B, 0x94, 0x1B, 0x83, 0x08, 0x8B, 0xB8, 0x57, 0xB9,
+	0x19, 0x03, 0x89, 0x12, 0xBD, 0x50, 0xA1, 0x0B, 0x01, 0x51, 0xE2, 0x0D,
+	0x16, 0xBB, 0x52, 0xB8, 0x29, 0x81, 0x89, 0x18, 0x94, 0x8D, 0x13, 0x8B,
+	0x83, 0x0B, 0x02, 0x99, 0x33, 0xBE, 0x34, 0xE8, 0x58, 0xB0, 0x19, 0x11,
+	0xA8, 0x28, 0xDA, 0x42, 0xBA, 0x32, 0xCD, 0x44, 0xD8, 0x49, 0xA2, 0x9A,
+	0x23, 0xBB, 0x43, 0xA1, 0x8E, 0x15, 0xBA, 0x23, 0xAB, 0x43, 0xCB, 0x43,
+	0xBB, 0x40, 0xB0, 0x38, 0xC2, 0x09, 0x48, 0xC1, 0x29, 0xC9, 0x54, 0xDA,
+	0x41, 0xB8, 0x39, 0x94, 0x8D, 0x14, 0x9B, 0x12, 0x9A, 0x33, 0xBD, 0x52,
+	0xC8, 0x4A, 0xA4, 0x0D, 0x23, 0xAC, 0x31, 0xD1, 0x39, 0xB3, 0x0D, 0x14,
+	0xBA, 0x31, 0xB0, 0x3A, 0x94, 0x0C, 0x04, 0xAB, 0x42, 0xB8, 0x49, 0xA1,
+	0x0C, 0x05, 0xAC, 0x24, 0xB9, 0x30, 0xB8, 0x30, 0xA0, 0x39, 0xD0, 0x2A,
+	0x16, 0xCB, 0x41, 0xB8, 0x39, 0x92, 0x8B, 0x53, 0xD9, 0x29, 0x82, 0x09,
+	0xA9, 0x32, 0xC9, 0x41, 0xA9, 0x23, 0x80, 0xDC, 0x51, 0xA8, 0x04, 0x8E,
+	0x05, 0xBC, 0x44, 0xC8, 0x29, 0x93, 0x8D, 0x23, 0xAA, 0x18, 0x94, 0x0C,
+	0x13, 0xA9, 0x00, 0x18, 0x1A, 0x86, 0x0D, 0x82, 0x1A, 0x91, 0x09, 0x01,
+	0xB9, 0x71, 0xD9, 0x41, 0xB8, 0x11, 0x9A, 0x12, 0x91, 0x1C, 0x94, 0x2D,
+	0x94, 0x8D, 0x15, 0xAB, 0x04, 0x9B, 0x23, 0xB9, 0x60, 0xC9, 0x30, 0x90,
+	0x09, 0xB1, 0x30, 0x99, 0x13, 0xFA, 0x70, 0xC1, 0x3A, 0x82, 0xAA, 0x42,
+	0xD8, 0x3A, 0x85, 0xAC, 0x24, 0xC9, 0x48, 0xB1, 0x09, 0x11, 0x98, 0x10,
+	0x98, 0x20, 0xC1, 0x2A, 0xA3, 0x1C, 0x05, 0xAD, 0x34, 0xBA, 0x3A, 0x04,
+	0x9C, 0x11, 0x98, 0x1A, 0x96, 0x3B, 0xE2, 0x38, 0xB2, 0x4C, 0xD2, 0x30,
+	0x9B, 0x14, 0xCA, 0x31, 0xA1, 0x8D, 0x17, 0xAC, 0x42, 0xB8, 0x3A, 0xA3,
+	0x0B, 0x31, 0xF0, 0x48, 0xB0, 0x38, 0xB0, 0x48, 0xC8, 0x58, 0xB0, 0x4A,
+	0xB3, 0x2B, 0xA3, 0x89, 0x31, 0xB1, 0x0F, 0x93, 0x3A, 0xA0, 0x09, 0x17,
+	0x9E, 0x14, 0xC9, 0x50, 0xA8, 0x28, 0xB0, 0x40, 0xAB, 0x14, 0xAA, 0x32,
+	0xBA, 0x24, 0xAC, 0x43, 0xAC, 0x13, 0x8A, 0x82, 0x1A, 0x92, 0x80, 0x8E,
+	0x06, 0x0C, 0x03, 0x9D, 0x42, 0xB9, 0x91, 0x69, 0xC0, 0x30, 0xB0, 0x2C,
+	0x86, 0x9B, 0x33, 0xC8, 0x8A, 0x25, 0xDB, 0x32, 0xD0, 0x4A, 0xA3, 0x0D,
+	0x04, 0x9B, 0x13, 0xAA, 0x30, 0xC1, 0x3A, 0xA3, 0x2D, 0x93, 0x0C, 0x12,
+	0xD8, 0x59, 0xB2, 0x1D, 0x05, 0xBB, 0x34, 0xBA, 0x30, 0xA1, 0x0A, 0x42,
+	0xFA, 0x68, 0xC0, 0x38, 0xB0, 0x39, 0x93, 0x9C, 0x32, 0xD0, 0x39, 0xB1,
+	0x20, 0x09, 0x80, 0xC0, 0x7A, 0xD3, 0x4A, 0xC1, 0x38, 0xC1, 0x3A, 0x95,
+	0x0D, 0x03, 0x9B, 0x22, 0x98, 0x8A, 0x43, 0xEA, 0x58, 0xC2, 0x2B, 0x95,
+	0x8B, 0x05, 0x8A, 0x18, 0x00, 0xA8, 0x49, 0xB3, 0x0D, 0x14, 0xBB, 0x52,
+	0xA8, 0x09, 0x02, 0x8A, 0x20, 0xA0, 0x4A, 0xC3, 0x2D, 0x84, 0x9C, 0x33,
+	0xDA, 0x40, 0xA1, 0x8C, 0x25, 0xBC, 0x51, 0xB0, 0x29, 0x01, 0xA9, 0x21,
+	0xA1, 0x0C, 0x04, 0x8C, 0x04, 0xAB, 0x25, 0xBB, 0x51, 0xB8, 0x38, 0xA1,
+	0x2A, 0x80, 0x90, 0x1A, 0x84, 0x1B, 0xD2, 0x70, 0xC8, 0x30, 0xA0, 0x2C,
+	0x83, 0x9C, 0x52, 0xBA, 0x41, 0xB0, 0x19, 0x82, 0xA9, 0x58, 0xC0, 0x48,
+	0xA0, 0xA0, 0x60, 0xD0, 0x59, 0xB0, 0x20, 0x8A, 0x11, 0x00, 0xBC, 0x73,
+	0xC8, 0x3A, 0x86, 0x8E, 0x23, 0xAB, 0x31, 0xA8, 0x19, 0x02, 0xB9, 0x48,
+	0xC1, 0x3B, 0xA6, 0x2C, 0x95, 0x8C, 0x15, 0xCB, 0x43, 0xCA, 0x31, 0xA9,
+	0x11, 0x88, 0x90, 0x20, 0xA9, 0x38, 0x98, 0x2A, 0x85, 0x9B, 0x42, 0xAA,
+	0x05, 0x8B, 0x81, 0x20, 0xDA, 0x52, 0xC9, 0x48, 0xA2, 0x99, 0x1A, 0x06,
+	0xCA, 0x60, 0xC1, 0x2A, 0x03, 0x9D, 0x13, 0x89, 0xA8, 0x51, 0xC0, 0x59,
+	0xB0, 0x4A, 0xB2, 0x3A, 0x92, 0x0C, 0x22, 0xDB, 0x42, 0xB8, 0x19, 0x18,
+	0xB3, 0x7B, 0xB1, 0x2A, 0x01, 0x8A, 0x51, 0xF9, 0x60, 0xC9, 0x41, 0xC8,
+	0x38, 0xB2, 0x1C, 0x04, 0xBB, 0x44, 0xCA, 0x31, 0xA9, 0x20, 0xB0, 0x48,
+	0xC0, 0x49, 0xB2, 0x2C, 0x94, 0x1C, 0x94, 0x1C, 0x83, 0x0D, 0x03, 0x8C,
+	0x04, 0xAA, 0x31, 0xC0, 0x39, 0x81, 0xAA, 0x52, 0xC8, 0x38, 0x91, 0x0D,
+	0x05, 0x9C, 0x33, 0xCC, 0x52, 0xC9, 0x30, 0xB1, 0x2A, 0x94, 0x0C, 0x04,
+	0xAB, 0x23, 0xC8, 0x18, 0x02, 0xAA, 0x31, 0xE0, 0x38, 0x88, 0x91, 0x19,
+	0x28, 0xB4, 0x1F, 0x85, 0x9C, 0x14, 0x8C, 0x12, 0x9B, 0x13, 0x8B, 0x31,
+	0xC9, 0x58, 0xD1, 0x38, 0xC1, 0x5A, 0xC2, 0x29, 0x92, 0x8B, 0x24, 0xCB,
+	0x31, 0xD9, 0x22, 0xB9, 0x12, 0x89, 0x82, 0x3B, 0xA3, 0x89, 0x32, 0xF8,
+	0x6A, 0xB8, 0x58, 0xD1, 0x28, 0xA0, 0x18, 0x02, 0xAA, 0x14, 0x0E, 0x84,
+	0x8C, 0x23, 0xBA, 0x59, 0xB2, 0x3A, 0x00, 0xC8, 0x3B, 0x07, 0xAC, 0x33,
+	0xB9, 0x58, 0xC2, 0x3C, 0xA3, 0x0C, 0x12, 0xA9, 0x40, 0xD9, 0x32, 0x9C,
+	0x04, 0x0B, 0x01, 0x01, 0x9C, 0x24, 0xAC, 0x12, 0x88, 0x99, 0x42, 0x9D,
+	0x23, 0xBA, 0x50, 0xA0, 0x89, 0x62, 0xE9, 0x49, 0xB3, 0x1C, 0x02, 0xA8,
+	0x39, 0x83, 0xAC, 0x68, 0xB4, 0x1E, 0x93, 0x0A, 0x11, 0xA9, 0x40, 0xD2,
+	0x4B, 0xA3, 0x0B, 0x01, 0xA0, 0x5A, 0xA3, 0x0C, 0x23, 0xD9, 0x3A, 0x97,
+	0x0C, 0x83, 0x1B, 0x81, 0x09, 0x21, 0xBA, 0x61, 0xE1, 0x4A, 0xA4, 0x0E,
+	0x04, 0x9B, 0x23, 0xC9, 0x48, 0xC1, 0x39, 0xB2, 0x2C, 0x95, 0x0C, 0x84,
+	0x8A, 0x02, 0x9A, 0x22, 0xAA, 0x22, 0xC8, 0x4A, 0xA4, 0x1D, 0x84, 0x8B,
+	0x31, 0xC9, 0x48, 0xA1, 0x1B, 0x04, 0xBB, 0x62, 0xC0, 0x3A, 0xA5, 0x1A,
+	0x80, 0x82, 0x8C, 0x13, 0xAA, 0x83, 0x1A, 0x95, 0x1C, 0x94, 0x8D, 0x14,
+	0xBB, 0x25, 0xDB, 0x52, 0xB9, 0x40, 0xC0, 0x39, 0xA1, 0x19, 0x82, 0x8A,
+	0x10, 0xA1, 0x4B, 0xA5, 0x2C, 0x93, 0x8B, 0x23, 0xAC, 0x23, 0x9A, 0x29,
+	0xA7, 0x2D, 0x96, 0x1D, 0x82, 0x0A, 0x02, 0x8B, 0x21, 0xE1, 0x49, 0xC2,
+	0x5B, 0xB2, 0x2C, 0x95, 0x0C, 0x13, 0xBB, 0x52, 0xB8, 0x49, 0xB1, 0x3B,
+	0x94, 0x0C, 0x04, 0x8C, 0x23, 0xBC, 0x52, 0xC8, 0x38, 0xB2, 0x1C, 0x04,
+	0xBA, 0x42, 0xC8, 0x38, 0xB0, 0x38, 0xB1, 0x2B, 0x87, 0xAB, 0x25, 0xBB,
+	0x42, 0xB8, 0x39, 0x91, 0x0A, 0x02, 0xAB, 0x63, 0xCA, 0x23, 0xAC, 0x25,
+	0xBB, 0x52, 0xB8, 0x3A, 0xA4, 0x0C, 0x14, 0xAC, 0x34, 0xEB, 0x51, 0xB8,
+	0x49, 0xA2, 0x0C, 0x13, 0x9C, 0x22, 0xB9, 0x40, 0xB1, 0x1B, 0x86, 0x9B,
+	0x14, 0xAA, 0x22, 0xAA, 0x50, 0xC1, 0x1A, 0x05, 0x8D, 0x03, 0x99, 0x80,
+	0x10, 0xB0, 0x29, 0x03, 0xBB, 0x72, 0xD0, 0x59, 0xB1, 0x2A, 0x92, 0x0A,
+	0x01, 0xA0, 0x79, 0xD1, 0x38, 0xC0, 0x31, 0xBB, 0x33, 0x9A, 0x9A, 0x26,
+	0xBD, 0x25, 0x9B, 0x21, 0xA9, 0x30, 0xD0, 0x21, 0x90, 0x9C, 0x27, 0xAD,
+	0x33, 0xCB, 0x32, 0x9A, 0x00, 0x31, 0xCD, 0x53, 0xCA, 0x22, 0x99, 0x90,
+	0x22, 0xCA, 0x52, 0xC9, 0x30, 0xB1, 0x0B, 0x26, 0xBD, 0x62, 0xB9, 0x40,
+	0x98, 0x08, 0x00, 0x98, 0x81, 0x09, 0x11, 0xC0, 0x2A, 0x06, 0x9C, 0x14,
+	0x8B, 0x01, 0x81, 0x0C, 0x82, 0x1A, 0x91, 0x2C, 0x86, 0x0D, 0x02, 0xAA,
+	0x14, 0xBA, 0x61, 0xD1, 0x3B, 0x86, 0x8D, 0x14, 0xCB, 0x42, 0xB8, 0x29,
+	0x84, 0x8D, 0x23, 0xDA, 0x40, 0xB1, 0x3B, 0x94, 0x8C, 0x14, 0xAB, 0x32,
+	0xC8, 0x39, 0x92, 0x8C, 0x15, 0x9C, 0x22, 0xAA, 0x22, 0xB9, 0x58, 0xC1,
+	0x4A, 0xA2, 0x2C, 0xA4, 0x1D, 0x84, 0x8B, 0x13, 0xBA, 0x41, 0xB0, 0x4A,
+	0xB3, 0x1D, 0x03, 0x9C, 0x33, 0xCB, 0x58, 0xB2, 0x1E, 0x85, 0x9B, 0x33,
+	0xCA, 0x30, 0xA0, 0x1A, 0x03, 0x8C, 0x22, 0x9A, 0x10, 0x98, 0x22, 0xAF,
+	0x24, 0xB9, 0x5A, 0xB3, 0x1C, 0x13, 0xDA, 0x30, 0xB2, 0x1F, 0x04, 0x9C,
+	0x32, 0xC9, 0x48, 0xA1, 0x1C, 0x04, 0x9C, 0x23, 0xBB, 0x43, 0xBA, 0x42,
+	0xB9, 0x29, 0x84, 0x9C, 0x33, 0x9C, 0x12, 0xA8, 0x5B, 0xC3, 0x2C, 0x84,
+	0x0D, 0x04, 0x9C, 0x33, 0xCB, 0x22, 0x99, 0x10, 0x98, 0x00, 0x80, 0x89,
+	0x83, 0x1D, 0xA4, 0x4B, 0xC3, 0x2A, 0x12, 0xF8, 0x69, 0xC0, 0x38, 0xA1,
+	0x1B, 0x03, 0x0B, 0x11, 0xCA, 0x16, 0x8E, 0x04, 0x9B, 0x33, 0xDB, 0x31,
+	0xA0, 0x0A, 0x23, 0xCB, 0x30, 0xA2, 0x0F, 0x13, 0xCA, 0x58, 0x92, 0x8E,
+	0x23, 0xBA, 0x68, 0xB1, 0x2B, 0x84, 0x9B, 0x33, 0xAA, 0x88, 0x15, 0xBC,
+	0x34, 0xCA, 0x30, 0x90, 0x0A, 0x01, 0xA1, 0x09, 0x38, 0xD3, 0x2A, 0x21,
+	0xE0, 0x4B, 0xA6, 0x1D, 0x03, 0xAB, 0x42, 0xC0, 0x3A, 0xB4, 0x2D, 0x95,
+	0x0C, 0x84, 0x0B, 0x22, 0xBA, 0x38, 0x82, 0xAD, 0x35, 0xEA, 0x40, 0xC1,
+	0x2A, 0x83, 0x9C, 0x42, 0xB8, 0x3A, 0x84, 0x9D, 0x33, 0xE9, 0x30, 0xB1,
+	0x2B, 0x04, 0x9D, 0x42, 0xC9, 0x38, 0xB3, 0x1E, 0x04, 0xAB, 0x32, 0xB8,
+	0x1A, 0x05, 0x9B, 0x21, 0xC0, 0x20, 0x90, 0x98, 0x31, 0xD8, 0x39, 0xB3,
+	0x2C, 0xA3, 0x2A, 0x80, 0x91, 0x1C, 0xA5, 0x3C, 0xB1, 0x13, 0x0F, 0x95,
+	0x1C, 0x84, 0x8C, 0x05, 0x9C, 0x14, 0xAA, 0x30, 0xC3, 0x0C, 0x14, 0xAB,
+	0x31, 0xB1, 0x1D, 0x85, 0x0C, 0x03, 0xBA, 0x43, 0xC9, 0x28, 0x93, 0x0D,
+	0x13, 0xCA, 0x40, 0xB0, 0x08, 0x28, 0xB3, 0x1E, 0x85, 0x0C, 0x03, 0x9C,
+	0x23, 0xC8, 0x3A, 0x95, 0x8C, 0x14, 0xD9, 0x48, 0xA2, 0x8C, 0x05, 0xAA,
+	0x32, 0xC9, 0x30, 0xA0, 0x2A, 0x81, 0x99, 0x22, 0xB8, 0x49, 0xB0, 0x48,
+	0xB9, 0x33, 0xAB, 0x82, 0x6A, 0xE1, 0x59, 0xC1, 0x4A, 0xA2, 0x0B, 0x24,
+	0xFB, 0x60, 0xB0, 0x3A, 0xA4, 0x0B, 0x13, 0x8C, 0x01, 0x88, 0x18, 0xB2,
+	0x3D, 0xA7, 0x1C, 0x04, 0xBB, 0x53, 0xB9, 0x49, 0xB3, 0x1D, 0x03, 0xAB,
+	0x33, 0xC9, 0x39, 0xA3, 0x0C, 0x22, 0xB0, 0x1E, 0x84, 0x8B, 0x03, 0x90,
+	0x0B, 0x06, 0x8B, 0x01, 0x08, 0x9A, 0x26, 0xAC, 0x10, 0x03, 0xAD, 0x42,
+	0xD2, 0x3B, 0x85, 0x9C, 0x33, 0xDA, 0x30, 0xB1, 0x0A, 0x33, 0xF8, 0x39,
+	0xB3, 0x8C, 0x34, 0xFB, 0x41, 0xB8, 0x39, 0x92, 0x9B, 0x34, 0xEA, 0x30,
+	0xB1, 0x1B, 0x06, 0xAB, 0x33, 0xD9, 0x38, 0x93, 0x8F, 0x14, 0xBB, 0x33,
+	0xB9, 0x39, 0x82, 0x8B, 0x18, 0x86, 0x8E, 0x14, 0xBB, 0x34, 0xCA, 0x30,
+	0xA0, 0x09, 0x02, 0xB1, 0x2D, 0x95, 0x8B, 0x42, 0xD9, 0x40, 0xB0, 0x3A,
+	0x93, 0x8C, 0x22, 0xC8, 0x49, 0xA2, 0x0C, 0x32, 0xCB, 0x33, 0xAB, 0x13,
+	0x9D, 0x06, 0xAC, 0x34, 0xDA, 0x31, 0xB0, 0x19, 0x12, 0xEA, 0x31, 0xC8,
+	0x38, 0xA2, 0x8B, 0x14, 0xAA, 0x20, 0x91, 0xB8, 0x61, 0xC9, 0x43, 0xAD,
+	0x24, 0xAB, 0x21, 0x00, 0xE8, 0x40, 0xB0, 0x4A, 0xB2, 0x2C, 0xA5, 0x1B,
+	0x84, 0x8C, 0x23, 0xC9, 0x48, 0xA1, 0x1A, 0x13, 0xAD, 0x23, 0xC9, 0x48,
+	0xB2, 0x1D, 0x22, 0xDA, 0x51, 0xB9, 0x21, 0xA8, 0x38, 0xA2, 0x0C, 0x03,
+	0xAB, 0x11, 0x25, 0xBF, 0x35, 0xCB, 0x30, 0xA3, 0x8F, 0x14, 0xBB, 0x53,
+	0xC9, 0x38, 0xA3, 0x8D, 0x24, 0xCB, 0x41, 0xB0, 0x3B, 0x85, 0x9C, 0x14,
+	0xBA, 0x31, 0xB1, 0x2A, 0x83, 0xAB, 0x51, 0xC0, 0x29, 0x83, 0x8D, 0x22,
+	0xC8, 0x28, 0x82, 0xAB, 0x42, 0xD0, 0x49, 0xA1, 0x0A, 0x22, 0xC8, 0x19,
+	0x84, 0x9B, 0x61, 0xB8, 0x39, 0x83, 0xBB, 0x38, 0x87, 0x0E, 0x84, 0x8C,
+	0x84, 0x0A, 0x82, 0x8A, 0x85, 0x1C, 0x94, 0x1E, 0x84, 0x9B, 0x42, 0xE8,
+	0x38, 0xB2, 0x1B, 0x05, 0xAB, 0x42, 0xC8, 0x28, 0x82, 0x9C, 0x24, 0xDA,
+	0x40, 0xA0, 0x09, 0x02, 0xC8, 0x48, 0xA1, 0x1C, 0x04, 0xBA, 0x51, 0xB1,
+	0x1D, 0x14, 0xCB, 0x51, 0xC0, 0x39, 0xA2, 0x0B, 0x04, 0xAA, 0x31, 0xA8,
+	0x09, 0x22, 0xCA, 0x40, 0xB1, 0x2C, 0x85, 0x8C, 0x13, 0xBA, 0x41, 0x98,
+	0x1B, 0x06, 0x9C, 0x32, 0xB8, 0x2A, 0x03, 0xBC, 0x53, 0xD9, 0x40, 0xD0,
+	0x38, 0x91, 0x1B, 0x83, 0x8A, 0x08, 0x13, 0xBD, 0x71, 0xC0, 0x18, 0x82,
+	0x9A, 0x32, 0xC9, 0x39, 0x84, 0xCC, 0x73, 0xD8, 0x28, 0x93, 0x8C, 0x32,
+	0xBA, 0x38, 0xA1, 0x1A, 0x12, 0xB9, 0x11, 0x09, 0xB3, 0x3A, 0xB1, 0x6A,
+	0xA8, 0xB4, 0x7B, 0xE2, 0x48, 0xB8, 0x21, 0x9B, 0x05, 0x8D, 0x05, 0x8C,
+	0x23, 0xCB, 0x41, 0xC0, 0x49, 0xA1, 0x2B, 0x12, 0xAB, 0x48, 0x91, 0xAA,
+	0x54, 0xFA, 0x31, 0xD0, 0x38, 0xB1, 0x29, 0x81, 0x9A, 0x14, 0x0D, 0x93,
+	0x2D, 0xA4, 0x1C, 0x84, 0x9B, 0x42, 0xC9, 0x48, 0xB2, 0x1C, 0x95, 0x0A,
+	0x83, 0x8C, 0x13, 0xAA, 0x22, 0xA8, 0x89, 0x16, 0xAC, 0x52, 0xD8, 0x49,
+	0xB2, 0x1B, 0x85, 0x8B, 0x02, 0x80, 0x89, 0x12, 0xB8, 0x4A, 0xA4, 0x1B,
+	0x80, 0x95, 0x0E, 0x13, 0xBB, 0x42, 0x90, 0x8D, 0x16, 0xBB, 0x51, 0xC1,
+	0x2A, 0x12, 0xCA, 0x40, 0xB0, 0x19, 0x12, 0xC9, 0x59, 0xA4, 0x8D, 0x24,
+	0xDA, 0x40, 0xB0, 0x3A, 0x84, 0x8C, 0x21, 0x98, 0x0A, 0x04, 0xBB, 0x61,
+	0xB1, 0x2C, 0x84, 0x9B, 0x32, 0xD8, 0x18, 0x02, 0xB9, 0x48, 0xA2, 0x1B,
+	0x03, 0xAC, 0x63, 0xC9, 0x30, 0xB8, 0x21, 0xB9, 0x50, 0xA8, 0x10, 0x91,
+	0x3B, 0xB4, 0x2C, 0x90, 0x23, 0xBF, 0x45, 0xAC, 0x33, 0xBB, 0x32, 0xA9,
+	0xA8, 0x44, 0xCC, 0x63, 0xD9, 0x40, 0xB0, 0x4A, 0xB2, 0x1A, 0x12, 0xBA,
+	0x48, 0x82, 0x9D, 0x43, 0xD9, 0x30, 0xB2, 0x1D, 0x84, 0x8B, 0x21, 0x98,
+	0x89, 0x22, 0xD8, 0x5A, 0xB3, 0x0D, 0x23, 0xBA, 0x20, 0x82, 0xCB, 0x70,
+	0xD2, 0x3B, 0x85, 0x8D, 0x14, 0xAB, 0x22, 0x99, 0x08, 0x83, 0x9B, 0x12,
+	0x90, 0x89, 0x14, 0xAD, 0x44, 0xDA, 0x40, 0xB0, 0x4A, 0xB2, 0x1A, 0x13,
+	0xBB, 0x50, 0xB1, 0x2B, 0x14, 0xEB, 0x50, 0xB1, 0x1C, 0x05, 0x9C, 0x23,
+	0xAA, 0x18, 0x84, 0xAB, 0x34, 0xEB, 0x41, 0xB8, 0x38, 0x80, 0x8A, 0x21,
+	0xA8, 0x1A, 0x06, 0x9D, 0x22, 0xB8, 0x30, 0x90, 0x19, 0x00, 0x91, 0x8F,
+	0x87, 0x8C, 0x85, 0x8B, 0x15, 0xAC, 0x42, 0xB8, 0x38, 0xA0, 0x29, 0x90,
+	0x18, 0xB8, 0x62, 0xD8, 0x38, 0xB2, 0x1C, 0x03, 0xAA, 0x40, 0xB2, 0x1D,
+	0x86, 0x8C, 0x22, 0xAA, 0x10, 0x12, 0xDB, 0x42, 0xC9, 0x31, 0xC9, 0x30,
+	0xB1, 0x4A, 0xB1, 0x3A, 0x86, 0x8E, 0x14, 0xBB, 0x51, 0xB0, 0x2A, 0x12,
+	0xD9, 0x58, 0xB1, 0x3B, 0xA5, 0x8A, 0x12, 0xA8, 0x39, 0x82, 0xBA, 0x78,
+	0xE2, 0x39, 0xB3, 0x1D, 0x83, 0x0B, 0x93, 0x3B, 0xD3, 0x39, 0xC3, 0x3C,
+	0xA3, 0x1E, 0x84, 0x8C, 0x13, 0xAA, 0x22, 0xBA, 0x53, 0xAC, 0x53, 0xDA,
+	0x41, 0xB9, 0x50, 0xB8, 0x49, 0x91, 0x0B, 0x04, 0xAA, 0x22, 0xA0, 0x8B,
+	0x25, 0xEA, 0x40, 0xB0, 0x2A, 0x04, 0x9C, 0x32, 0xD0, 0x4B, 0x93, 0x9C,
+	0x43, 0xD9, 0x38, 0xA2, 0x0A, 0x21, 0xA9, 0x29, 0x03, 0x9F, 0x14, 0xA9,
+	0x19, 0x85, 0x9C, 0x52, 0xB9, 0x38, 0xA2, 0x0A, 0x22, 0xDB, 0x31, 0xB1,
+	0x1E, 0x85, 0x0B, 0x84, 0x8C, 0x02, 0x10, 0xCA, 0x70, 0xB0, 0x3A, 0x94,
+	0x8D, 0x13, 0x9A, 0x00, 0x01, 0x89, 0x82, 0x98, 0x20, 0xDB, 0x63, 0xD0,
+	0x3A, 0xA5, 0x1B, 0x02, 0x0A, 0x89, 0x53, 0xEB, 0x32, 0xB9, 0x03, 0x0D,
+	0x13, 0x9D, 0x33, 0xDB, 0x41, 0xC0, 0x2A, 0x83, 0x0B, 0x03, 0x9C, 0x14,
+	0xBB, 0x24, 0x99, 0x1A, 0x04, 0xBA, 0x78, 0xC1, 0x28, 0xA0, 0x18, 0xB2,
+	0x69, 0xC1, 0x4B, 0x94, 0x8D, 0x05, 0xAB, 0x43, 0xC9, 0x49, 0xA2, 0x0B,
+	0x13, 0xC9, 0x30, 0xB1, 0x09, 0x12, 0xC0, 0x09, 0x43, 0xFA, 0x40, 0xD0,
+	0x30, 0xC0, 0x29, 0xA3, 0x1B, 0xB3, 0x5A, 0xB1, 0x39, 0x92, 0x9C, 0x34,
+	0xCA, 0x39, 0x95, 0x0E, 0x02, 0x98, 0x19, 0xA3, 0x29, 0x80, 0x80, 0x28,
+	0x9C, 0x17, 0x8F, 0x13, 0x9C, 0x21, 0xA1, 0x0D, 0x14, 0xBA, 0x50, 0xB0,
+	0x09, 0x53, 0xDA, 0x30, 0xB1, 0x19, 0xA1, 0x12, 0xBB, 0x73, 0xD9, 0x30,
+	0xB2, 0x1B, 0x82, 0x10, 0xDA, 0x70, 0xD1, 0x28, 0xC2, 0x29, 0x92, 0x8A,
+	0x22, 0xBB, 0x33, 0xAB, 0x20, 0x13, 0xFC, 0x50, 0xC3, 0x1D, 0x23, 0xAD,
+	0x32, 0x9A, 0x00, 0x19, 0x91, 0x08, 0x83, 0x8F, 0x15, 0xAC, 0x32, 0x99,
+	0x08, 0x80, 0x82, 0x9F, 0x16, 0xAB, 0x23, 0xA9, 0x1A, 0x14, 0xBA, 0x40,
+	0xA1, 0xAA, 0x36, 0xDC, 0x43, 0xCB, 0x42, 0xAA, 0x21, 0x99, 0x02, 0x0B,
+	0x03, 0xDA, 0x68, 0xC2, 0x3B, 0xA4, 0x89, 0x31, 0xE8, 0x49, 0x91, 0x8B,
+	0x13, 0x8A, 0x90, 0x32, 0xD0, 0x2B, 0x17, 0xFA, 0x48, 0xA1, 0x1B, 0x23,
+	0xDB, 0x51, 0xA8, 0x2A, 0x83, 0x9B, 0x30, 0xB2, 0x9C, 0x64, 0xD9, 0x48,
+	0xA2, 0x0B, 0x03, 0x99, 0x9A, 0x35, 0xFB, 0x40, 0xC1, 0x2A, 0x85, 0x9B,
+	0x13, 0xA8, 0x19, 0x11, 0xAB, 0x32, 0xB0, 0x0B, 0x17, 0xAB, 0x23, 0x9B,
+	0x31, 0xD8, 0x38, 0xA4, 0x8F, 0x14, 0x9A, 0x28, 0x93, 0x8E, 0x13, 0xB9,
+	0x49, 0x95, 0x8E, 0x24, 0xCB, 0x31, 0xB0, 0x2A, 0x03, 0xAC, 0x34, 0xCA,
+	0x10, 0x82, 0xBA, 0x53, 0xCA, 0x32, 0xAB, 0x22, 0x08, 0xAB, 0x26, 0xAC,
+	0x33, 0xC9, 0x29, 0x22, 0xFA, 0x4A, 0x95, 0x8C, 0x13, 0xB9, 0x39, 0x85,
+	0x9D, 0x34, 0xCB, 0x31, 0xB0, 0x2A, 0x83, 0x8C, 0x12, 0x89, 0x99, 0x16,
+	0xAC, 0x24, 0x9C, 0x12, 0x9A, 0x11, 0x00, 0xA9, 0x61, 0xF0, 0x48, 0xB1,
+	0x2B, 0x95, 0x8B, 0x15, 0xAC, 0x53, 0xC9, 0x28, 0x93, 0x9C, 0x42, 0xC8,
+	0x18, 0x83, 0x8D, 0x23, 0xCA, 0x30, 0xB2, 0x2A, 0x98, 0x84, 0x8D, 0x05,
+	0x9C, 0x24, 0xBB, 0x42, 0xB9, 0x11, 0x88, 0x81, 0x0B, 0x06, 0x9B, 0x31,
+	0xD3, 0x2C, 0x93, 0x1C, 0x11, 0xBA, 0x40, 0xA1, 0x2A, 0x91, 0x42, 0xAF,
+	0x25, 0xDB, 0x41, 0xC0, 0x29, 0x93, 0x9A, 0x31, 0xA1, 0x9C, 0x43, 0xC9,
+	0x39, 0x83, 0x9F, 0x53, 0xC9, 0x38, 0xA2, 0x8C, 0x15, 0xBB, 0x42, 0xA8,
+	0x88, 0x21, 0xB0, 0x2B, 0x06, 0xBC, 0x53, 0xC8, 0x39, 0xA3, 0x1C, 0x82,
+	0x98, 0x09, 0x05, 0xAC, 0x25, 0xBB, 0x32, 0xA9, 0x11, 0x0D, 0x85, 0x0C,
+	0x13, 0xAC, 0x43, 0xC9, 0x48, 0xB0, 0x18, 0xA2, 0x19, 0x01, 0x0C, 0x84,
+	0x2B, 0x90, 0x11, 0xAB, 0x71, 0xD8, 0x38, 0xD3, 0x19, 0x02, 0xBB, 0x52,
+	0xC1, 0x29, 0xA3, 0x8D, 0x24, 0xAB, 0x12, 0x1A, 0xD2, 0x4A, 0x92, 0x99,
+	0x20, 0x01, 0xBD, 0x73, 0xC8, 0x18, 0x02, 0xCA, 0x61, 0xA8, 0x18, 0x01,
+	0xAC, 0x24, 0xB9, 0x5B, 0xA5, 0x0D, 0x15, 0xAC, 0x43, 0xCA, 0x30, 0xA1,
+	0x0A, 0x03, 0x9B, 0x21, 0xA2, 0x0D, 0x32, 0xEB, 0x42, 0xC9, 0x11, 0xA1,
+	0x08, 0x20, 0xB9, 0x28, 0x04, 0x9F, 0x32, 0xC8, 0x39, 0xB3, 0x1B, 0x23,
+	0xDB, 0x48, 0xA3, 0x8F, 0x05, 0x8B, 0x12, 0x8A, 0x82, 0x1A, 0xB3, 0x2E,
+	0xA4, 0x3C, 0xD3, 0x39, 0xB0, 0x30, 0xB0, 0x4B, 0x94, 0x8B, 0x04, 0xAB,
+	0x41, 0xB4, 0x8F, 0x06, 0xAA, 0x31, 0xB1, 0x0C, 0x06, 0xAA, 0x21, 0xB0,
+	0x29, 0x94, 0x1C, 0x92, 0x4B, 0xC3, 0x3B, 0xA5, 0x1D, 0x84, 0x9B, 0x23,
+	0xB9, 0x39, 0x94, 0x9B, 0x62, 0xC8, 0x4A, 0x93, 0x8E, 0x33, 0xBC, 0x41,
+	0x98, 0x08, 0x18, 0x92, 0x8E, 0x15, 0xCB, 0x42, 0xA9, 0x28, 0x92, 0x9B,
+	0x43, 0xC8, 0x3A, 0x03, 0xAD, 0x43, 0xDA, 0x31, 0xB8, 0x39, 0xB3, 0x2B,
+	0x95, 0x1A, 0xB1, 0x50, 0xD8, 0x40, 0xC8, 0x38, 0xB4, 0x0C, 0x04, 0xAA,
+	0x31, 0xC2, 0x2C, 0x04, 0x9D, 0x32, 0xD8, 0x39, 0x82, 0x9C, 0x33, 0xA9,
+	0x9A, 0x45, 0xEB, 0x41, 0xB0, 0x3B, 0x95, 0x8B, 0x22, 0x98, 0x89, 0x30,
+	0xE0, 0x39, 0x94, 0x8E, 0x04, 0xA9, 0x20, 0xA1, 0x19, 0x81, 0x89, 0x03,
+	0x8B, 0x91, 0x61, 0xDA, 0x42, 0xE8, 0x48, 0xB0, 0x39, 0x91, 0x0A, 0x02,
+	0x8A, 0x12, 0x9A, 0x32, 0xDD, 0x63, 0xBA, 0x50, 0xB0, 0x19, 0x02, 0xC9,
+	0x40, 0xA2, 0x8D, 0x14, 0xBA, 0x22, 0xA1, 0x0D, 0x05, 0xAA, 0x12, 0x89,
+	0x92, 0x1A, 0x03, 0xCC, 0x71, 0xD0, 0x38, 0xA2, 0x8C, 0x14, 0xAB, 0x32,
+	0xB8, 0x3A, 0x95, 0x0D, 0x13, 0xB9, 0x49, 0xB3, 0x0C, 0x24, 0xCB, 0x30,
+	0xB3, 0x8D, 0x24, 0xAD, 0x05, 0x8B, 0x84, 0x1A, 0xC2, 0x48, 0xC1, 0x2A,
+	0x03, 0xAC, 0x32, 0xD0, 0x18, 0x22, 0xFB, 0x41, 0xB8, 0x3A, 0x05, 0xAD,
+	0x42, 0xB0, 0x2B, 0x84, 0x9B, 0x33, 0xA9, 0x8A, 0x25, 0xEB, 0x41, 0xB0,
+	0x1A, 0x14, 0xDB, 0x60, 0xA0, 0x1A, 0x13, 0xDB, 0x50, 0xB0, 0x29, 0x92,
+	0x89, 0x11, 0x88, 0x8B, 0x15, 0xBB, 0x25, 0xBB, 0x71, 0xC0, 0x28, 0xA1,
+	0x2A, 0x02, 0xAC, 0x42, 0xA8, 0x1C, 0x06, 0xBB, 0x63, 0xD0, 0x29, 0x83,
+	0xAC, 0x43, 0xC9, 0x20, 0x91, 0x9A, 0x14, 0xA9, 0x29, 0x93, 0x8D, 0x24,
+	0xAC, 0x42, 0xB8, 0x2A, 0x13, 0xAD, 0x42, 0xC1, 0x1C, 0x05, 0xBB, 0x53,
+	0xC9, 0x30, 0xA1, 0x0B, 0x14, 0xAB, 0x50, 0xB0, 0x2A, 0x84, 0xBA, 0x61,
+	0xA0, 0x1C, 0x85, 0x9B, 0x14, 0xB9, 0x48, 0xA2, 0x0E, 0x14, 0xBB, 0x52,
+	0xB8, 0x29, 0x03, 0x9E, 0x32, 0xB9, 0x49, 0xA2, 0x1B, 0x03, 0xCA, 0x40,
+	0xB2, 0x1D, 0x04, 0xAB, 0x42, 0xB8, 0x19, 0x03, 0x9C, 0x22, 0x90, 0x0E,
+	0x85, 0x0C, 0x84, 0x9A, 0x41, 0xB9, 0x58, 0xC1, 0x3A, 0x82, 0xAA, 0x51,
+	0xB9, 0x30, 0x98, 0x80, 0x49, 0xE3, 0x1B, 0x16, 0xDB, 0x32, 0xC0, 0x18,
+	0x01, 0x9A, 0x11, 0x80, 0xAB, 0x54, 0xC9, 0x59, 0xC2, 0x2C, 0x84, 0x9B,
+	0x42, 0xC8, 0x39, 0xA4, 0x1C, 0x02, 0x9A, 0x30, 0xB2, 0x0F, 0x14, 0xCB,
+	0x42, 0xC8, 0x28, 0x93, 0x8D, 0x23, 0xCA, 0x30, 0xA0, 0x19, 0x83, 0x8C,
+	0x22, 0xB9, 0x48, 0xA0, 0x0A, 0x33, 0xF0, 0x4B, 0x94, 0x0D, 0x13, 0xCB,
+	0x51, 0xA0, 0x0C, 0x25, 0xBC, 0x42, 0xC0, 0x29, 0x02, 0x9C, 0x22, 0xB0,
+	0x2B, 0x05, 0xAC, 0x43, 0xC9, 0x49, 0x92, 0x8C, 0x23, 0xBA, 0x48, 0xA1,
+	0x2B, 0x13, 0xAD, 0x42, 0xC0, 0x3A, 0xA4, 0x1C, 0x83, 0x8B, 0x12, 0xA9,
+	0x20, 0x82, 0x8E, 0x04, 0x8A, 0x39, 0xB4, 0x1D, 0x04, 0x9C, 0x22, 0xA0,
+	0x9A, 0x51, 0xC2, 0x1C, 0x86, 0x9B, 0x24, 0xDA, 0x41, 0xB8, 0x18, 0x82,
+	0x99, 0x18, 0x84, 0xAC, 0x44, 0xEA, 0x50, 0xC0, 0x28, 0x91, 0x1A, 0x81,
+	0x19, 0xB0, 0x60, 0xC8, 0x38, 0xA2, 0x1C, 0x83, 0x0B, 0xA3, 0x2D, 0x94,
+	0x8B, 0x05, 0xAA, 0x22, 0x08, 0xBA, 0x51, 0xB1, 0x1E, 0x86, 0x9B, 0x14,
+	0xAA, 0x22, 0xA9, 0x10, 0xA0, 0x30, 0xDA, 0x43, 0xBC, 0x35, 0xDB, 0x31,
+	0xD1, 0x28, 0x90, 0x88, 0x01, 0x09, 0x83, 0x8F, 0x04, 0x8C, 0x14, 0xBB,
+	0x24, 0xAB, 0x22, 0xA0, 0x18, 0x8B, 0x24, 0xBC, 0x72, 0xE8, 0x30, 0xB1,
+	0x1A, 0x03, 0x9B, 0x11, 0x20, 0xEB, 0x43, 0xDA, 0x40, 0xC1, 0x3A, 0xA3,
+	0x1C, 0x82, 0x18, 0xBA, 0x63, 0xC9, 0x39, 0x84, 0xAC, 0x43, 0xC8, 0x29,
+	0x02, 0xBA, 0x31, 0x91, 0xBC, 0x73, 0xE1, 0x49, 0xB2, 0x1B, 0x04, 0x9B,
+	0x11, 0x10, 0xAA, 0x30, 0xC3, 0x0E, 0x06, 0x9C, 0x14, 0x9B, 0x13, 0x9B,
+	0x23, 0xBC, 0x62, 0xC8, 0x59, 0xB1, 0x1A, 0x04, 0x9B, 0x21, 0x80, 0x9B,
+	0x51, 0xD0, 0x5A, 0xA2, 0x1C, 0x12, 0xAA, 0x12, 0x09, 0xC1, 0x4B, 0x95,
+	0x8D, 0x05, 0x9B, 0x23, 0xBA, 0x31, 0xB0, 0x18, 0x19, 0xA3, 0x0E, 0x14,
+	0xAC, 0x52, 0xB8, 0x3A, 0xA3, 0x99, 0x31, 0xD0, 0x4A, 0xA2, 0x0A, 0x02,
+	0x8A, 0x95, 0x2D, 0xA3, 0x1D, 0x84, 0x8B, 0x21, 0xB8, 0x13, 0x8F, 0x06,
+	0x9C, 0x32, 0xD8, 0x48, 0xC1, 0x29, 0xA2, 0x1A, 0x93, 0x3B, 0xB2, 0x0D,
+	0x17, 0x9D, 0x23, 0xAB, 0x32, 0xBA, 0x30, 0xB1, 0x3B, 0xA6, 0x3C, 0xB1,
+	0x48, 0xC8, 0x31, 0xB8, 0x08, 0x22, 0xC9, 0x09, 0x73, 0xFA, 0x41, 0xC8,
+	0x38, 0xA2, 0x8C, 0x14, 0xB9, 0x30, 0xA0, 0x0A, 0x34, 0xF9, 0x4A, 0xA3,
+	0x0C, 0x32, 0xCA, 0x39, 0x83, 0xCA, 0x58, 0xA3, 0x9E, 0x44, 0xDA, 0x48,
+	0xA2, 0x0C, 0x13, 0xAA, 0x38, 0xA2, 0x8B, 0x52, 0xD0, 0x2A, 0x84, 0xAA,
+	0x22, 0x99, 0x00, 0x00, 0x88, 0x09, 0x22, 0xE9, 0x38, 0x90, 0x98, 0x58,
+	0xB2, 0x8E, 0x25, 0xEA, 0x31, 0xA0, 0x0A, 0x22, 0xCA, 0x28, 0x85, 0x9C,
+	0x23, 0xB8, 0x2B, 0x86, 0x9A, 0x01, 0x02, 0xCB, 0x51, 0xD2, 0x3C, 0x95,
+	0x8C, 0x33, 0xCB, 0x20, 0x92, 0xAA, 0x72, 0xD8, 0x38, 0x92, 0x8D, 0x33,
+	0xCB, 0x30, 0xA2, 0x8C, 0x15, 0x9C, 0x22, 0x9A, 0x11, 0x0A, 0x92, 0x09,
+	0x01, 0x1A, 0xB3, 0x8E, 0x16, 0xAC, 0x24, 0x9B, 0x11, 0xA1, 0x1C, 0x04,
+	0xA9, 0x09, 0x43, 0xEB, 0x51, 0xB0, 0x1D, 0x06, 0xAB, 0x32, 0xC0, 0x19,
+	0x12, 0xBB, 0x70, 0xA1, 0x0D, 0x14, 0xCA, 0x31, 0xB0, 0x2A, 0x83, 0xA9,
+	0x38, 0xB4, 0x1D, 0x23, 0xCC, 0x41, 0xB0, 0x3A, 0x94, 0x8C, 0x13, 0xAA,
+	0x21, 0x09, 0xB1, 0x79, 0xC0, 0x3A, 0x84, 0x9C, 0x23, 0xCB, 0x53, 0xBA,
+	0x30, 0xB2, 0x2C, 0x92, 0x88, 0x29, 0x83, 0xAD, 0x42, 0xB1, 0x0E, 0x06,
+	0x9B, 0x31, 0xC0, 0x08, 0x21, 0xB8, 0x1B, 0x35, 0xFB, 0x58, 0xB1, 0x1A,
+	0x83, 0x99, 0x00, 0x01, 0x99, 0x38, 0xA3, 0x9F, 0x34, 0xDB, 0x40, 0xB1,
+	0x2B, 0x03, 0xAB, 0x51, 0xC0, 0x28, 0xA0, 0x03, 0x8F, 0x86, 0x9A, 0x32,
+	0xD9, 0x48, 0xB2, 0x0C, 0x14, 0xAA, 0x20, 0xA1, 0x8A, 0x24, 0xDA, 0x40,
+	0xB1, 0x0C, 0x06, 0x9B, 0x23, 0xCA, 0x31, 0xA0, 0x1B, 0x23, 0xCC, 0x31,
+	0x08, 0xBB, 0x57, 0xDB, 0x41, 0xA0, 0x0A, 0x04, 0xAB, 0x42, 0xB8, 0x19,
+	0x13, 0xFA, 0x30, 0xB2, 0x1B, 0x82, 0x00, 0x89, 0x30, 0xF9, 0x70, 0xB8,
+	0x29, 0x83, 0x0C, 0x02, 0x8A, 0x82, 0x1B, 0x95, 0x1C, 0x02, 0xD9, 0x60,
+	0xC0, 0x38, 0xA0, 0x08, 0x80, 0xA2, 0x3A, 0xB3, 0x9E, 0x27, 0xDB, 0x42,
+	0xC8, 0x38, 0x90, 0x08, 0x88, 0x11, 0xCA, 0x60, 0xB0, 0x09, 0x14, 0xAC,
+	0x53, 0xBA, 0x30, 0x91, 0x8D, 0x24, 0xCB, 0x51, 0xB8, 0x39, 0xB3, 0x2C,
+	0x92, 0x80, 0x89, 0x41, 0xF0, 0x49, 0xA2, 0x1D, 0x13, 0xBC, 0x62, 0xA9,
+	0x18, 0x02, 0xAB, 0x32, 0x89, 0xA8, 0x52, 0xCA, 0x21, 0x92, 0x9E, 0x14,
+	0xB8, 0x18, 0x22, 0xCB, 0x91, 0x72, 0xF0, 0x40, 0xC8, 0x38, 0x91, 0x8B,
+	0x23, 0x9A, 0x88, 0x31, 0xF9, 0x60, 0xC0, 0x29, 0x02, 0xBA, 0x41, 0x98,
+	0xB8, 0x62, 0xC8, 0x28, 0x92, 0x9A, 0x32, 0xE8, 0x38, 0xC3, 0x1B, 0x12,
+	0xA9, 0x38, 0xB2, 0x0B, 0x34, 0xEA, 0x48, 0xA1, 0x0C, 0x05, 0x9B, 0x84,
+	0x1A, 0xA1, 0x38, 0xC3, 0x2D, 0x84, 0xAC, 0x52, 0xA8, 0x8A, 0x25, 0xCA,
+	0x49, 0x94, 0x9D, 0x43, 0xC9, 0x38, 0xA2, 0x8B, 0x41, 0xC1, 0x0C, 0x25,
+	0xCB, 0x31, 0xB1, 0x0B, 0x25, 0xDB, 0x40, 0xA1, 0x0B, 0x14, 0xBA, 0x40,
+	0xA1, 0x8A, 0x42, 0xD9, 0x38, 0x92, 0x9B, 0x23, 0xB8, 0x2B, 0x06, 0xAA,
+	0x50, 0xC8, 0x48, 0xA1, 0x0B, 0x15, 0xAC, 0x32, 0xC8, 0x38, 0xA1, 0x8B,
+	0x24, 0xAA, 0x10, 0x11, 0xDC, 0x73, 0xB9, 0x49, 0x91, 0x1B, 0x13, 0xBC,
+	0x51, 0x90, 0x8C, 0x15, 0xB9, 0x29, 0x05, 0xAD, 0x34, 0xCA, 0x38, 0x92,
+	0x0C, 0x11, 0xA1, 0x0B, 0x24, 0xBC, 0x52, 0xB0, 0x1B, 0x04, 0xAA, 0x32,
+	0xBA, 0x51, 0xC0, 0x3A, 0xA1, 0x30, 0xBB, 0x23, 0xA0, 0x7B, 0xE8, 0x40,
+	0x91, 0x9C, 0x33, 0xE8, 0x49, 0x82, 0xBC, 0x72, 0xC0, 0x29, 0x02, 0xAB,
+	0x41, 0xB1, 0x0C, 0x15, 0xBA, 0x30, 0x91, 0x8C, 0x43, 0xB9, 0x1A, 0x23,
+	0xEA, 0x58, 0xC3, 0x0B, 0x14, 0xC9, 0x38, 0xA4, 0x0D, 0x13, 0xBA, 0x48,
+	0x93, 0x8F, 0x23, 0xBA, 0x48, 0xA2, 0x9B, 0x33, 0xC0, 0x1B, 0x07, 0xAB,
+	0x41, 0xA1, 0x8B, 0x15, 0xBB, 0x33, 0x99, 0x88, 0x10, 0x89, 0x83, 0x3B,
+	0xF8, 0x61, 0xB8, 0x18, 0x80, 0x80, 0x20, 0xF9, 0x58, 0x90, 0x99, 0x21,
+	0x91, 0x0F, 0x05, 0x9C, 0x42, 0xB9, 0x39, 0x94, 0x9C, 0x15, 0xCA, 0x50,
+	0xA0, 0x2A, 0x93, 0x9C, 0x43, 0xB9, 0x39, 0x82, 0xAA, 0x58, 0xC3, 0x0E,
+	0x05, 0xBA, 0x42, 0xC0, 0x29, 0x82, 0xAA, 0x42, 0xB8, 0x19, 0x12, 0xC8,
+	0x4A, 0x94, 0x8D, 0x13, 0x9A, 0x82, 0x89, 0x22, 0xCB, 0x43, 0xCB, 0x31,
+	0xA9, 0x84, 0x8B, 0x16, 0xAD, 0x43, 0xB8, 0x2B, 0x86, 0x9B, 0x22, 0x88,
+	0x88, 0x98, 0x39, 0x85, 0x89, 0x9A, 0x22, 0x89, 0x80, 0x23, 0xDD, 0x41,
+	0xA9, 0xA3, 0x7B, 0xD3, 0x1C, 0x87, 0x9B, 0x34, 0xDA, 0x38, 0x92, 0x9B,
+	0x32, 0xE0, 0x4A, 0xA3, 0x8C, 0x33, 0xCA, 0x28, 0x83, 0x8F, 0x33, 0xEA,
+	0x38, 0xA3, 0x9C, 0x43, 0xD8, 0x39, 0xA3, 0x0D, 0x13, 0xBA, 0x30, 0xA3,
+	0x8E, 0x33, 0xBB, 0x48, 0xA2, 0x8C, 0x15, 0xBA, 0x48, 0xA3, 0x0E, 0x22,
+	0xC8, 0x39, 0xA4, 0x9C, 0x24, 0xB9, 0x4A, 0x94, 0x8C, 0x23, 0xC9, 0x39,
+	0x83, 0x8F, 0x22, 0xC8, 0x28, 0x92, 0x9A, 0x22, 0xB1, 0x0C, 0x33, 0xCA,
+	0x39, 0x84, 0xAD, 0x44, 0xD9, 0x28, 0x82, 0x9B, 0x32, 0xD1, 0x2B, 0x13,
+	0xBA, 0x38, 0x82, 0xBB, 0x70, 0xD3, 0x2C, 0x04, 0xAC, 0x52, 0xB8, 0x2A,
+	0x04, 0xAB, 0x32, 0xB9, 0x38, 0xA3, 0x9D, 0x53, 0xD8, 0x28, 0xA2, 0x1C,
+	0x04, 0xAB, 0x50, 0xA1, 0x1A, 0x80, 0x11, 0xCB, 0x63, 0xC9, 0x20, 0xA3,
+	0x9C, 0x33, 0xB9, 0x18, 0x04, 0xCC, 0x52, 0xE0, 0x38, 0xB1, 0x29, 0xB2,
+	0x2B, 0x87, 0x9C, 0x24, 0xDA, 0x31, 0xC1, 0x2A, 0x94, 0x0B, 0x12, 0xB9,
+	0x21, 0x99, 0x14, 0x9D, 0x12, 0x98, 0x28, 0xA1, 0x89, 0x01, 0x20, 0xF2,
+	0x2A, 0x05, 0xAF, 0x35, 0xCB, 0x30, 0xB2, 0x1C, 0x23, 0xCB, 0x30, 0xA2,
+	0x0B, 0x14, 0x8D, 0x83, 0x0A, 0x81, 0x80, 0x88, 0x38, 0xE1, 0x2A, 0xA3,
+	0x58, 0xDA, 0x22, 0xB9, 0x52, 0xE8, 0x48, 0xC1, 0x29, 0xA2, 0x39, 0x98,
+	0xB1, 0x7B, 0xC3, 0x29, 0xD1, 0x30, 0xA8, 0x10, 0xB0, 0x48, 0x91, 0xAD,
+	0x45, 0xD9, 0x38, 0xB2, 0x1C, 0x14, 0xAC, 0x22, 0x80, 0xAB, 0x51, 0xB1,
+	0x2B, 0x96, 0x8B, 0x13, 0xC0, 0x5B, 0xB3, 0x1C, 0x33, 0xCD, 0x42, 0x98,
+	0x8B, 0x15, 0x8C, 0x02, 0x99, 0x21, 0x9A, 0x20, 0xA8, 0x40, 0xB0, 0x1B,
+	0x03, 0x0D, 0x96, 0x2C, 0x94, 0x0C, 0x11, 0xC2, 0x2C, 0x84, 0xB9, 0x58,
+	0xA1, 0x0B, 0x34, 0xCC, 0x31, 0xA0, 0x89, 0x23, 0xB9, 0xAA, 0x73, 0xA0,
+	0x0C, 0x24, 0xDC, 0x52, 0xC0, 0x2A, 0x85, 0x9B, 0x23, 0xCB, 0x51, 0xB0,
+	0x2A, 0x12, 0xCA, 0x31, 0xA0, 0x1B, 0x05, 0xBB, 0x51, 0xB0, 0x39, 0xB1,
+	0x0A, 0x35, 0xFB, 0x20, 0x82, 0x9C, 0x32, 0xE0, 0x39, 0xB3, 0x1C, 0x04,
+	0xBB, 0x72, 0xC8, 0x48, 0xB1, 0x1A, 0x03, 0x9B, 0x21, 0xC1, 0x19, 0x82,
+	0x0A, 0x02, 0xA9, 0x22, 0x9C, 0x14, 0x8E, 0x14, 0xAC, 0x52, 0xC8, 0x49,
+	0xA2, 0x1D, 0x03, 0xAB, 0x32, 0xA0, 0x0C, 0x13, 0xB9, 0x5A, 0xA3, 0x8E,
+	0x33, 0xE9, 0x3A, 0x04, 0x9C, 0x22, 0xA9, 0x18, 0x02, 0xBA, 0x70, 0xC0,
+	0x38, 0xB1, 0x08, 0x31, 0xE8, 0x29, 0x04, 0xBC, 0x42, 0xA8, 0x18, 0x20,
+	0xEA, 0x41, 0xA0, 0x8B, 0x42, 0xF3, 0x2B, 0x86, 0x8C, 0x22, 0xB9, 0x48,
+	0xC2, 0x2A, 0x92, 0x19, 0x81, 0x9B, 0x34, 0xCB, 0x11, 0x13, 0xAF, 0x24,
+	0xBA, 0x30, 0x91, 0x09, 0x09, 0x93, 0x99, 0x4A, 0x83, 0xFA, 0x7A, 0xF3,
+	0x28, 0x81, 0x8B, 0x12, 0xA0, 0x3A, 0xE3, 0x49, 0xB2, 0x0A, 0x30, 0x88,
+	0x8C, 0x44, 0xEB, 0x30, 0x91, 0x2B, 0x82, 0xBA, 0x70, 0xB1, 0x3A, 0xB1,
+	0x20, 0x88, 0x93, 0x8F, 0x13, 0x98, 0x99, 0x49, 0xB5, 0x2C, 0x84, 0xBB,
+	0x63, 0xB1, 0x0E, 0x14, 0xAA, 0x18, 0x13, 0xDC, 0x52, 0xB8, 0x39, 0x93,
+	0x9E, 0x33, 0xC9, 0x20, 0xA1, 0x8B, 0x45, 0xDA, 0x20, 0xB3, 0x0D, 0x05,
+	0xAA, 0x31, 0xC1, 0x1A, 0x22, 0xBB, 0x50, 0xA1, 0x0B, 0x32, 0xC8, 0x1A,
+	0x04, 0xBA, 0x62, 0xC8, 0x28, 0x80, 0xA1, 0x39, 0xE2, 0x39, 0x91, 0x81,
+	0x0D, 0x03, 0x9A, 0x00, 0x13, 0xBD, 0x73, 0xC8, 0x4A, 0x92, 0x8A, 0x12,
+	0x99, 0x38, 0xD8, 0x20, 0x08, 0x02, 0xAF, 0x43, 0xC9, 0x40, 0xB1, 0x2D,
+	0x81, 0x80, 0x19, 0xE2, 0x59, 0xC1, 0x29, 0x92, 0x08, 0x0B, 0x06, 0xBB,
+	0x52, 0xA1, 0x8E, 0x25, 0xAC, 0x31, 0xC1, 0x0A, 0x15, 0xCA, 0x30, 0xA2,
+	0x0C, 0x22, 0xC9, 0x39, 0x94, 0x9C, 0x33, 0xC9, 0x39, 0x82, 0x9A, 0x18,
+	0x93, 0x1B, 0x81, 0x9B, 0x47, 0xBA, 0x29, 0x95, 0x8B, 0x23, 0xDA, 0x11,
+	0x11, 0xBB, 0x25, 0xDB, 0x50, 0xA0, 0x2A, 0xA1, 0x3B, 0x97, 0x0D, 0x42,
+	0xD9, 0x38, 0xA3, 0x0F, 0x03, 0x9A, 0x38, 0x81, 0x9D, 0x14, 0xA9, 0x29,
+	0x14, 0xAD, 0x41, 0xB1, 0x0A, 0x23, 0xBC, 0x61, 0x90, 0x8C, 0x33, 0xCA,
+	0x28, 0x82, 0x8A, 0x12, 0xCA, 0x30, 0x80, 0x80, 0xC8, 0x78, 0xA0, 0x2B,
+	0x14, 0xAD, 0x31, 0xB4, 0x9C, 0x26, 0xCA, 0x30, 0xA2, 0x0C, 0x13, 0xBB,
+	0x50, 0x81, 0xC9, 0x4A, 0x04, 0xBB, 0x40, 0xA2, 0x8D, 0x15, 0xAB, 0x31,
+	0xA3, 0x8E, 0x22, 0xA9, 0x29, 0x13, 0xEB, 0x48, 0x92, 0x8C, 0x32, 0xE1,
+	0x1A, 0x14, 0xBB, 0x41, 0xB2, 0x0D, 0x23, 0xAA, 0x29, 0x92, 0x0B, 0x83,
+	0x2A, 0x19, 0xB1, 0x78, 0xA9, 0x49, 0xE4, 0x2A, 0x32, 0xE8, 0x3B, 0x97,
+	0x0B, 0x13, 0xC9, 0x38, 0x92, 0x9C, 0x62, 0xB9, 0x39, 0x82, 0x9B, 0x13,
+	0x88, 0xBA, 0x33, 0x12, 0xBF, 0x62, 0xC1, 0x2A, 0x03, 0xBC, 0x52, 0xA0,
+	0x8A, 0x32, 0xA8, 0xBA, 0x45, 0xB9, 0x19, 0x42, 0xF0, 0x4B, 0x83, 0xCA,
+	0x69, 0xB2, 0x1C, 0x22, 0xB0, 0x1E, 0x13, 0xC9, 0x39, 0x03, 0xCC, 0x51,
+	0xB0, 0x2A, 0x03, 0xC9, 0x29, 0x05, 0xCB, 0x41, 0x91, 0x8C, 0x42, 0xD9,
+	0x38, 0x82, 0xCB, 0x42, 0x98, 0x8A, 0x32, 0xC8, 0x2B, 0x06, 0xBA, 0x50,
+	0xA1, 0x0B, 0x13, 0xB9, 0x2B, 0x17, 0xBB, 0x60, 0xA1, 0x8C, 0x23, 0xC9,
+	0x31, 0xB0, 0x0A, 0x42, 0xB9, 0x18, 0x81, 0x2A, 0x10, 0xCC, 0x25, 0xE9,
+	0x21, 0xB0, 0x4B, 0xA3, 0x2C, 0x84, 0x9D, 0x42, 0xB9, 0x30, 0xA1, 0x0E,
+	0x13, 0x98, 0x8B, 0x53, 0xD9, 0x39, 0x03, 0xDA, 0x39, 0x94, 0x8C, 0x52,
+	0xE0, 0x2A, 0x04, 0xAB, 0x31, 0xA1, 0x8C, 0x33, 0xAB, 0x30, 0xB2, 0x8F,
+	0x23, 0xB9, 0x38, 0x90, 0x3A, 0xB4, 0x1E, 0x03, 0x9B, 0x40, 0xC2, 0x1B,
+	0x04, 0xBB, 0x73, 0xC0, 0x08, 0x11, 0xA9, 0x80, 0x11, 0xC1, 0x3E, 0x95,
+	0x9C, 0x53, 0xC8, 0x2A, 0x13, 0xCB, 0x50, 0xA1, 0x0B, 0x23, 0xC8, 0x1A,
+	0x14, 0xC8, 0x1A, 0x14, 0xCA, 0x48, 0xB2, 0x0B, 0x24, 0xB0, 0x0D, 0x22,
+	0x98, 0x98, 0x00, 0x22, 0xFA, 0x59, 0xA1, 0x2B, 0x93, 0x8D, 0x32, 0xA4,
+	0x9F, 0x32, 0x90, 0x8B, 0x03, 0x99, 0x03, 0xA8, 0x39, 0xF3, 0x38, 0xC1,
+	0x18, 0x30, 0xF9, 0x1B, 0x15, 0xB9, 0x58, 0x90, 0x8A, 0x21, 0x83, 0x8D,
+	0x28, 0x84, 0xBA, 0x31, 0x00, 0xF2, 0x3B, 0x87, 0xAB, 0x52, 0xB0, 0x0B,
+	0x24, 0x99, 0x88, 0x09, 0x14, 0xC0, 0x0A, 0x05, 0xAB, 0x43, 0xAB, 0x41,
+	0xA3, 0x9E, 0x53, 0xB9, 0x29, 0x22, 0xF9, 0x28, 0x12, 0xBC, 0x40, 0xB1,
+	0x1B, 0x14, 0xF8, 0x39, 0x04, 0xAD, 0x31, 0x93, 0x8D, 0x02, 0x90, 0x29,
+	0x03, 0xCC, 0x40, 0x81, 0x9A, 0x20, 0x11, 0xCB, 0x20, 0xB0, 0x30, 0x22,
+	0xF0, 0x2F, 0x12, 0xB8, 0x2A, 0x92, 0xAA, 0x70, 0xA2, 0x0B, 0x22, 0xF9,
+	0x38, 0x04, 0xAB, 0x20, 0x1A, 0x80, 0x22, 0xAA, 0xBC, 0x44, 0x95, 0x9E,
+	0x51, 0xB1, 0x0C, 0x14, 0xC9, 0x39, 0x12, 0xAB, 0x39, 0x02, 0xAA, 0x2A,
+	0x26, 0xCB, 0x2B, 0x17, 0xBB, 0x21, 0x93, 0x9B, 0x00, 0x30, 0x82, 0x0F,
+	0x21, 0xCA, 0x58, 0x93, 0x8E, 0x38, 0xB2, 0x9A, 0x64, 0xCA, 0x11, 0xA1,
+	0x88, 0x10, 0xA2, 0xB9, 0x31, 0x16, 0xFB, 0x28, 0x03, 0xCA, 0x51, 0xA2,
+	0x9E, 0x31, 0x80, 0x9A, 0x11, 0xAA, 0x11, 0x14, 0xB9, 0x8C, 0x32, 0x85,
+	0xBD, 0x24, 0x99, 0x1A, 0x13, 0xE2, 0x29, 0x00, 0xAC, 0x30, 0x93, 0x99,
+	0xAA, 0x7A, 0x93, 0xB0, 0xA9, 0x33, 0xCD, 0x01, 0x03, 0x97, 0x9D, 0x41,
+	0xB1, 0x8A, 0x84, 0x88, 0x18, 0xD3, 0xB2, 0x48, 0xB0, 0x30, 0xE1, 0x00,
+	0xC2, 0x8A, 0x34, 0x9B, 0xA9, 0xD3, 0x24, 0xD0, 0x39, 0x23, 0xBF, 0x40,
+	0x81, 0xAB, 0x34, 0xBA, 0x39, 0x84, 0x8C, 0x00, 0x20, 0xA8, 0x9C, 0x26,
+	0xBB, 0x28, 0x02, 0xBC, 0x61, 0xB1, 0x9C, 0x53, 0xBA, 0x31, 0x03, 0x0F,
+	0x21, 0xA8, 0x30, 0xAA, 0xA9, 0x54, 0xA8, 0x1C, 0x03, 0xA0, 0xC3, 0x0A,
+	0x70, 0xA8, 0xB8, 0x05, 0xC0, 0x12, 0xB8, 0x30, 0x93, 0xBB, 0x72, 0x9A,
+	0x51, 0xD1, 0x1D, 0x33, 0xC9, 0x89, 0x13, 0xA1, 0x11, 0xB0, 0x38, 0x97,
+	0xA0, 0x2C, 0x01, 0xB0, 0xA9, 0x3B, 0x25, 0xA0, 0x8F, 0x23, 0x10, 0x9B,
+	0x8F, 0x33, 0xD2, 0xBA, 0x02, 0x34, 0xB0, 0x9E, 0x31, 0x32, 0x98, 0xC9,
+	0x3E, 0x14, 0x9A, 0xAB, 0x12, 0x35, 0xCB, 0x8A, 0x71, 0x02, 0xDB, 0x28,
+	0x21, 0xB3, 0xAD, 0x20, 0x40, 0x01, 0xFB, 0x00, 0x23, 0xA8, 0xD8, 0x49,
+	0x32, 0xA9, 0xBB, 0x23, 0x86, 0xA0, 0xAD, 0x51, 0x02, 0xBB, 0x99, 0x21,
+	0x17, 0xCA, 0x19, 0x12, 0x19, 0x9A, 0x9B, 0x16, 0x83, 0xEB, 0x19, 0x33,
+	0x10, 0x9E, 0x19, 0x94, 0x32, 0xAB, 0x2C, 0x12, 0xA4, 0xCA, 0x28, 0x03,
+	0x08, 0xE5, 0x89, 0x23, 0xD1, 0x88, 0xD8, 0x31, 0x91, 0x8C, 0x82, 0x10,
+	0x21, 0xB8, 0x9B, 0x31, 0xF0, 0x09, 0x10, 0x99, 0xB3, 0xB2, 0x09, 0xA0,
+	0x55, 0x19, 0x0F, 0x11, 0x81, 0x2B, 0x89, 0x3B, 0x10, 0x3A, 0x2B, 0x9F,
+	0x84, 0x10, 0x9B, 0xF4, 0x09, 0x94, 0x8A, 0x82, 0x19, 0x81, 0x91, 0x0B,
+	0x21, 0x2A, 0x3F, 0x4B, 0xA9, 0x8B, 0xA2, 0x87, 0x3A, 0xA2, 0x8E, 0x03,
+	0x09, 0x91, 0xEC, 0x82, 0x01, 0x3C, 0x29, 0xA8, 0xB0, 0x14, 0x2C, 0x42,
+	0xAB, 0xE0, 0x20, 0x28, 0x0C, 0x93, 0xA9, 0x53, 0x5B, 0x20, 0x90, 0x8E,
+	0x02, 0x91, 0x3B, 0x11, 0x3D, 0x1F, 0x98, 0x19, 0x28, 0x00, 0xC1, 0x39,
+	0x02, 0x79, 0xC2, 0x91, 0x11, 0xC2, 0x29, 0x21, 0x58, 0x8D, 0xB3, 0xAB,
+	0x33, 0x82, 0x8D, 0x33, 0x9F, 0xC0, 0x04, 0x19, 0x2C, 0x0A, 0x9A, 0x07,
+	0xA1, 0x10, 0x18, 0xA0, 0x97, 0x09, 0x29, 0xA3, 0xDB, 0x34, 0x98, 0x0B,
+	0x68, 0x09, 0x99, 0xB4, 0xA1, 0xA1, 0x39, 0x1E, 0x21, 0x01, 0xAD, 0x86,
+	0x09, 0x4A, 0xB4, 0x03, 0x80, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const VOICE_PROMPT_t g_voicePromptStart = { s_voicePromptStartData, 124378, 44100 };
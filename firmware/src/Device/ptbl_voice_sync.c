@@ -1,13419 +0,0 @@
-/* C:\Users\ThaoHa\Desktop\Portable\Spec\audio data 20170324\ptbl_voice_sync.wav (3/21/2017 12:14:04 PM)
-   StartOffset: 00000000, EndOffset: 000274B9, Length: 000274BA */
-//#include "AudioDataSize.h"
-
-const unsigned char audioVoiceSync[160954] = {
-	0x52, 0x49, 0x46, 0x46, 0xB2, 0x74, 0x02, 0x00, 0x57, 0x41, 0x56, 0x45,
-	0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-	0x44, 0xAC, 0x00, 0x00, 0x88, 0x58, 0x01, 0x00, 0x02, 0x00, 0x10, 0x00,
-	0x64, 0x61, 0x74, 0x61, 0x72, 0x74, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xEB, 0xFF, 0xF3, 0xFF,
-	0xF7, 0xFF, 0xF8, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xF8, 0xFF, 0x04, 0x00,
-	0x08, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0A, 0x00, 0xF7, 0xFF, 0xFB, 0xFF,
-	0xFC, 0xFF, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x00,
-	0x0E, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x0A, 0x00,
-	0x0E, 0x00, 0x08, 0x00, 0x14, 0x00, 0x18, 0x00, 0x1E, 0x00, 0x12, 0x00,
-	0x13, 0x00, 0x12, 0x00, 0x15, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0F, 0x00,
-	0x17, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x12, 0x00, 0x12, 0x00, 0x18, 0x00,
-	0x19, 0x00, 0x17, 0x00, 0x1A, 0x00, 0x1D, 0x00, 0x18, 0x00, 0x19, 0x00,
-	0x1E, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x1D, 0x00, 0x23, 0x00,
-	0x29, 0x00, 0x1E, 0x00, 0x27, 0x00, 0x2E, 0x00, 0x39, 0x00, 0x35, 0x00,
-	0x3A, 0x00, 0x3C, 0x00, 0x3B, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x2C, 0x00,
-	0x3B, 0x00, 0x3F, 0x00, 0x48, 0x00, 0x3F, 0x00, 0x49, 0x00, 0x43, 0x00,
-	0x40, 0x00, 0x3C, 0x00, 0x49, 0x00, 0x40, 0x00, 0x41, 0x00, 0x2B, 0x00,
-	0x44, 0x00, 0x36, 0x00, 0x38, 0x00, 0x3A, 0x00, 0x32, 0x00, 0x3B, 0x00,
-	0x30, 0x00, 0x33, 0x00, 0x3C, 0x00, 0x33, 0x00, 0x2B, 0x00, 0x36, 0x00,
-	0x38, 0x00, 0x2D, 0x00, 0x36, 0x00, 0x31, 0x00, 0x32, 0x00, 0x2C, 0x00,
-	0x23, 0x00, 0x1A, 0x00, 0x27, 0x00, 0x22, 0x00, 0x1E, 0x00, 0x24, 0x00,
-	0x22, 0x00, 0x24, 0x00, 0x1D, 0x00, 0x29, 0x00, 0x27, 0x00, 0x2B, 0x00,
-	0x31, 0x00, 0x27, 0x00, 0x32, 0x00, 0x22, 0x00, 0x2B, 0x00, 0x31, 0x00,
-	0x29, 0x00, 0x3E, 0x00, 0x32, 0x00, 0x3A, 0x00, 0x38, 0x00, 0x3B, 0x00,
-	0x38, 0x00, 0x2B, 0x00, 0x3B, 0x00, 0x3A, 0x00, 0x2E, 0x00, 0x38, 0x00,
-	0x3C, 0x00, 0x31, 0x00, 0x32, 0x00, 0x38, 0x00, 0x38, 0x00, 0x32, 0x00,
-	0x33, 0x00, 0x2B, 0x00, 0x30, 0x00, 0x32, 0x00, 0x24, 0x00, 0x31, 0x00,
-	0x28, 0x00, 0x29, 0x00, 0x27, 0x00, 0x12, 0x00, 0x1C, 0x00, 0x24, 0x00,
-	0x1C, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x14, 0x00,
-	0x0E, 0x00, 0x14, 0x00, 0x1C, 0x00, 0x15, 0x00, 0x14, 0x00, 0x19, 0x00,
-	0x15, 0x00, 0x15, 0x00, 0x14, 0x00, 0x17, 0x00, 0x19, 0x00, 0x1F, 0x00,
-	0x17, 0x00, 0x1E, 0x00, 0x1A, 0x00, 0x19, 0x00, 0x23, 0x00, 0x21, 0x00,
-	0x1A, 0x00, 0x28, 0x00, 0x1F, 0x00, 0x28, 0x00, 0x28, 0x00, 0x29, 0x00,
-	0x18, 0x00, 0x17, 0x00, 0x1E, 0x00, 0x10, 0x00, 0x10, 0x00, 0x1C, 0x00,
-	0x0E, 0x00, 0x18, 0x00, 0x1D, 0x00, 0x1A, 0x00, 0x1A, 0x00, 0x06, 0x00,
-	0x09, 0x00, 0xFC, 0xFF, 0x10, 0x00, 0xFF, 0xFF, 0x09, 0x00, 0xFD, 0xFF,
-	0x03, 0x00, 0x04, 0x00, 0xFC, 0xFF, 0x09, 0x00, 0x09, 0x00, 0x06, 0x00,
-	0x05, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x05, 0x00, 0x06, 0x00,
-	0xFD, 0xFF, 0x04, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x10, 0x00,
-	0x18, 0x00, 0x1C, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x10, 0x00, 0x0E, 0x00,
-	0x15, 0x00, 0x14, 0x00, 0x0D, 0x00, 0x10, 0x00, 0x0B, 0x00, 0x12, 0x00,
-	0x17, 0x00, 0x18, 0x00, 0x10, 0x00, 0x14, 0x00, 0x1E, 0x00, 0x1A, 0x00,
-	0x14, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x10, 0x00, 0x12, 0x00,
-	0x0F, 0x00, 0x12, 0x00, 0x09, 0x00, 0x0B, 0x00, 0x0A, 0x00, 0x10, 0x00,
-	0x13, 0x00, 0x0D, 0x00, 0x09, 0x00, 0x06, 0x00, 0x04, 0x00, 0x05, 0x00,
-	0xFC, 0xFF, 0x0D, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x0E, 0x00, 0x01, 0x00,
-	0x06, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x08, 0x00, 0x03, 0x00, 0x0A, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x08, 0x00,
-	0x06, 0x00, 0x01, 0x00, 0xFD, 0xFF, 0x01, 0x00, 0x08, 0x00, 0x0A, 0x00,
-	0x0A, 0x00, 0x03, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFA, 0xFF, 0xF0, 0xFF,
-	0xF8, 0xFF, 0x00, 0x00, 0xF2, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0x05, 0x00,
-	0xFA, 0xFF, 0x00, 0x00, 0xFD, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0x05, 0x00,
-	0xFB, 0xFF, 0x06, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFA, 0xFF, 0xF6, 0xFF, 0x03, 0x00, 0x03, 0x00, 0xFC, 0xFF, 0xF3, 0xFF,
-	0x04, 0x00, 0x04, 0x00, 0xFF, 0xFF, 0x04, 0x00, 0x09, 0x00, 0xFA, 0xFF,
-	0xFD, 0xFF, 0xFD, 0xFF, 0xFC, 0xFF, 0xF5, 0xFF, 0xED, 0xFF, 0xF3, 0xFF,
-	0xF5, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xF6, 0xFF, 0xF2, 0xFF,
-	0xEC, 0xFF, 0xFC, 0xFF, 0xF5, 0xFF, 0xF2, 0xFF, 0xF0, 0xFF, 0xED, 0xFF,
-	0xF2, 0xFF, 0xE8, 0xFF, 0xED, 0xFF, 0xEC, 0xFF, 0xE6, 0xFF, 0xF3, 0xFF,
-	0xEC, 0xFF, 0xED, 0xFF, 0xF3, 0xFF, 0xED, 0xFF, 0xF7, 0xFF, 0xF1, 0xFF,
-	0xF6, 0xFF, 0xED, 0xFF, 0xF2, 0xFF, 0xF1, 0xFF, 0xF7, 0xFF, 0xF3, 0xFF,
-	0xFA, 0xFF, 0xF1, 0xFF, 0xF5, 0xFF, 0xF7, 0xFF, 0xF0, 0xFF, 0xEC, 0xFF,
-	0xFB, 0xFF, 0xFD, 0xFF, 0xEE, 0xFF, 0xE9, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF,
-	0xE9, 0xFF, 0xF0, 0xFF, 0xF3, 0xFF, 0xF2, 0xFF, 0xFA, 0xFF, 0xF6, 0xFF,
-	0x06, 0x00, 0xF0, 0xFF, 0xF7, 0xFF, 0xF6, 0xFF, 0xE8, 0xFF, 0xEE, 0xFF,
-	0xE8, 0xFF, 0xE7, 0xFF, 0xE8, 0xFF, 0xE9, 0xFF, 0xE7, 0xFF, 0xEB, 0xFF,
-	0xED, 0xFF, 0xF2, 0xFF, 0xE3, 0xFF, 0xED, 0xFF, 0xF3, 0xFF, 0xF2, 0xFF,
-	0xF6, 0xFF, 0xF5, 0xFF, 0xF0, 0xFF, 0xF6, 0xFF, 0xF7, 0xFF, 0xEC, 0xFF,
-	0xF3, 0xFF, 0xF3, 0xFF, 0xEE, 0xFF, 0xFC, 0xFF, 0x08, 0x00, 0xF1, 0xFF,
-	0xF8, 0xFF, 0x03, 0x00, 0x06, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0D, 0x00,
-	0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0xFD, 0xFF, 0x03, 0x00, 0xFB, 0xFF,
-	0x09, 0x00, 0x06, 0x00, 0x03, 0x00, 0xF6, 0xFF, 0xF5, 0xFF, 0xF1, 0xFF,
-	0xF8, 0xFF, 0xFA, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0xF3, 0xFF, 0xFA, 0xFF,
-	0xFF, 0xFF, 0xFC, 0xFF, 0xFA, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0xFA, 0xFF,
-	0x00, 0x00, 0xF2, 0xFF, 0xFC, 0xFF, 0xF6, 0xFF, 0xF5, 0xFF, 0xFA, 0xFF,
-	0xF3, 0xFF, 0xF3, 0xFF, 0xF7, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-	0x0B, 0x00, 0x04, 0x00, 0x04, 0x00, 0x09, 0x00, 0x09, 0x00, 0x10, 0x00,
-	0x0E, 0x00, 0x15, 0x00, 0x10, 0x00, 0x0A, 0x00, 0x0F, 0x00, 0x17, 0x00,
-	0x18, 0x00, 0x06, 0x00, 0x13, 0x00, 0x0E, 0x00, 0x0B, 0x00, 0x0E, 0x00,
-	0x0E, 0x00, 0x0F, 0x00, 0x06, 0x00, 0x01, 0x00, 0x17, 0x00, 0x06, 0x00,
-	0x0A, 0x00, 0x0B, 0x00, 0x10, 0x00, 0x0E, 0x00, 0x15, 0x00, 0x00, 0x00,
-	0x0E, 0x00, 0x09, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x12, 0x00,
-	0x18, 0x00, 0x13, 0x00, 0x18, 0x00, 0x1E, 0x00, 0x14, 0x00, 0x14, 0x00,
-	0x15, 0x00, 0x1E, 0x00, 0x12, 0x00, 0x1A, 0x00, 0x17, 0x00, 0x1A, 0x00,
-	0x19, 0x00, 0x12, 0x00, 0x14, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x19, 0x00,
-	0x1D, 0x00, 0x0A, 0x00, 0x14, 0x00, 0x14, 0x00, 0x15, 0x00, 0x0E, 0x00,
-	0x0F, 0x00, 0x04, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-	0x08, 0x00, 0x13, 0x00, 0x06, 0x00, 0x10, 0x00, 0x09, 0x00, 0x18, 0x00,
-	0x15, 0x00, 0x13, 0x00, 0x17, 0x00, 0x18, 0x00, 0x1E, 0x00, 0x17, 0x00,
-	0x1A, 0x00, 0x1E, 0x00, 0x24, 0x00, 0x2B, 0x00, 0x24, 0x00, 0x22, 0x00,
-	0x27, 0x00, 0x27, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x39, 0x00,
-	0x35, 0x00, 0x35, 0x00, 0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x3A, 0x00,
-	0x2B, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x31, 0x00, 0x37, 0x00, 0x3C, 0x00,
-	0x41, 0x00, 0x45, 0x00, 0x3F, 0x00, 0x3B, 0x00, 0x36, 0x00, 0x37, 0x00,
-	0x3B, 0x00, 0x44, 0x00, 0x40, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x37, 0x00,
-	0x37, 0x00, 0x48, 0x00, 0x3B, 0x00, 0x48, 0x00, 0x46, 0x00, 0x49, 0x00,
-	0x43, 0x00, 0x41, 0x00, 0x4A, 0x00, 0x3A, 0x00, 0x3F, 0x00, 0x3C, 0x00,
-	0x3A, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x2D, 0x00,
-	0x2F, 0x00, 0x34, 0x00, 0x2C, 0x00, 0x2F, 0x00, 0x3B, 0x00, 0x30, 0x00,
-	0x2D, 0x00, 0x28, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x30, 0x00,
-	0x39, 0x00, 0x3B, 0x00, 0x3A, 0x00, 0x43, 0x00, 0x3B, 0x00, 0x39, 0x00,
-	0x3E, 0x00, 0x3C, 0x00, 0x3A, 0x00, 0x43, 0x00, 0x3B, 0x00, 0x3C, 0x00,
-	0x32, 0x00, 0x37, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x44, 0x00, 0x40, 0x00,
-	0x3C, 0x00, 0x3E, 0x00, 0x3B, 0x00, 0x32, 0x00, 0x39, 0x00, 0x3A, 0x00,
-	0x35, 0x00, 0x3B, 0x00, 0x32, 0x00, 0x35, 0x00, 0x3C, 0x00, 0x31, 0x00,
-	0x36, 0x00, 0x32, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x39, 0x00, 0x2A, 0x00,
-	0x2B, 0x00, 0x2B, 0x00, 0x17, 0x00, 0x32, 0x00, 0x2F, 0x00, 0x2C, 0x00,
-	0x23, 0x00, 0x23, 0x00, 0x22, 0x00, 0x2B, 0x00, 0x23, 0x00, 0x23, 0x00,
-	0x23, 0x00, 0x1A, 0x00, 0x13, 0x00, 0x0F, 0x00, 0x22, 0x00, 0x18, 0x00,
-	0x1E, 0x00, 0x1D, 0x00, 0x14, 0x00, 0x25, 0x00, 0x14, 0x00, 0x22, 0x00,
-	0x1C, 0x00, 0x25, 0x00, 0x25, 0x00, 0x27, 0x00, 0x18, 0x00, 0x1E, 0x00,
-	0x26, 0x00, 0x1E, 0x00, 0x1A, 0x00, 0x26, 0x00, 0x18, 0x00, 0x19, 0x00,
-	0x0B, 0x00, 0x13, 0x00, 0x12, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x10, 0x00,
-	0x12, 0x00, 0x14, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0F, 0x00, 0x0A, 0x00,
-	0x00, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0xFD, 0xFF,
-	0x01, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x04, 0x00, 0xFC, 0xFF, 0x00, 0x00,
-	0xF8, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0x08, 0x00, 0xFD, 0xFF, 0x00, 0x00,
-	0xFC, 0xFF, 0xFD, 0xFF, 0x01, 0x00, 0x06, 0x00, 0x01, 0x00, 0x04, 0x00,
-	0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0xF7, 0xFF, 0x01, 0x00, 0x09, 0x00,
-	0x0B, 0x00, 0x0A, 0x00, 0x05, 0x00, 0x01, 0x00, 0xF2, 0xFF, 0x04, 0x00,
-	0xFF, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xFD, 0xFF, 0x06, 0x00, 0x04, 0x00,
-	0xFB, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xF8, 0xFF, 0xF2, 0xFF,
-	0xF6, 0xFF, 0xF0, 0xFF, 0xE7, 0xFF, 0xF7, 0xFF, 0xF0, 0xFF, 0xEE, 0xFF,
-	0xDD, 0xFF, 0xE6, 0xFF, 0xDE, 0xFF, 0xE4, 0xFF, 0xE7, 0xFF, 0xDE, 0xFF,
-	0xDE, 0xFF, 0xD8, 0xFF, 0xD1, 0xFF, 0xD9, 0xFF, 0xD0, 0xFF, 0xD8, 0xFF,
-	0xCF, 0xFF, 0xD6, 0xFF, 0xD8, 0xFF, 0xDA, 0xFF, 0xD8, 0xFF, 0xD5, 0xFF,
-	0xD0, 0xFF, 0xD4, 0xFF, 0xD6, 0xFF, 0xD6, 0xFF, 0xD8, 0xFF, 0xD0, 0xFF,
-	0xDF, 0xFF, 0xE4, 0xFF, 0xDC, 0xFF, 0xE6, 0xFF, 0xDF, 0xFF, 0xE2, 0xFF,
-	0xDC, 0xFF, 0xE7, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xDC, 0xFF, 0xDA, 0xFF,
-	0xDC, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xE6, 0xFF, 0xEB, 0xFF, 0xDE, 0xFF,
-	0xDA, 0xFF, 0xDE, 0xFF, 0xD5, 0xFF, 0xC6, 0xFF, 0xD1, 0xFF, 0xCE, 0xFF,
-	0xC4, 0xFF, 0xC9, 0xFF, 0xCA, 0xFF, 0xC9, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF,
-	0xCA, 0xFF, 0xCA, 0xFF, 0xDE, 0xFF, 0xD0, 0xFF, 0xD5, 0xFF, 0xCF, 0xFF,
-	0xD4, 0xFF, 0xCF, 0xFF, 0xC2, 0xFF, 0xCC, 0xFF, 0xCF, 0xFF, 0xCF, 0xFF,
-	0xCA, 0xFF, 0xD8, 0xFF, 0xC5, 0xFF, 0xCC, 0xFF, 0xC6, 0xFF, 0xC5, 0xFF,
-	0xD3, 0xFF, 0xC7, 0xFF, 0xCA, 0xFF, 0xC0, 0xFF, 0xCB, 0xFF, 0xBF, 0xFF,
-	0xBC, 0xFF, 0xCE, 0xFF, 0xC2, 0xFF, 0xC1, 0xFF, 0xCA, 0xFF, 0xC1, 0xFF,
-	0xCE, 0xFF, 0xC7, 0xFF, 0xCC, 0xFF, 0xC1, 0xFF, 0xC2, 0xFF, 0xBB, 0xFF,
-	0xC7, 0xFF, 0xC1, 0xFF, 0xBF, 0xFF, 0xB8, 0xFF, 0xB6, 0xFF, 0xBA, 0xFF,
-	0xBC, 0xFF, 0xC0, 0xFF, 0xBD, 0xFF, 0xC4, 0xFF, 0xBA, 0xFF, 0xBF, 0xFF,
-	0xBA, 0xFF, 0xBD, 0xFF, 0xC1, 0xFF, 0xC6, 0xFF, 0xC1, 0xFF, 0xC2, 0xFF,
-	0xC4, 0xFF, 0xC1, 0xFF, 0xC4, 0xFF, 0xBC, 0xFF, 0xBB, 0xFF, 0xB6, 0xFF,
-	0xC2, 0xFF, 0xCC, 0xFF, 0xC0, 0xFF, 0xCA, 0xFF, 0xCE, 0xFF, 0xC7, 0xFF,
-	0xC6, 0xFF, 0xC6, 0xFF, 0xCA, 0xFF, 0xCA, 0xFF, 0xC5, 0xFF, 0xC6, 0xFF,
-	0xCA, 0xFF, 0xC6, 0xFF, 0xD0, 0xFF, 0xCF, 0xFF, 0xDE, 0xFF, 0xD1, 0xFF,
-	0xCC, 0xFF, 0xD3, 0xFF, 0xD1, 0xFF, 0xCE, 0xFF, 0xD0, 0xFF, 0xDE, 0xFF,
-	0xD5, 0xFF, 0xD1, 0xFF, 0xE6, 0xFF, 0xE4, 0xFF, 0xE1, 0xFF, 0xDC, 0xFF,
-	0xE6, 0xFF, 0xE1, 0xFF, 0xDC, 0xFF, 0xDC, 0xFF, 0xDD, 0xFF, 0xE3, 0xFF,
-	0xE1, 0xFF, 0xCE, 0xFF, 0xD7, 0xFF, 0xE2, 0xFF, 0xDC, 0xFF, 0xE4, 0xFF,
-	0xE2, 0xFF, 0xD9, 0xFF, 0xE6, 0xFF, 0xE7, 0xFF, 0xD9, 0xFF, 0xE1, 0xFF,
-	0xD3, 0xFF, 0xD5, 0xFF, 0xD4, 0xFF, 0xDE, 0xFF, 0xD9, 0xFF, 0xDE, 0xFF,
-	0xDA, 0xFF, 0xE6, 0xFF, 0xDD, 0xFF, 0xEC, 0xFF, 0xE4, 0xFF, 0xEC, 0xFF,
-	0xDF, 0xFF, 0xE9, 0xFF, 0xE8, 0xFF, 0xD9, 0xFF, 0xE1, 0xFF, 0xDC, 0xFF,
-	0xDF, 0xFF, 0xE8, 0xFF, 0xE3, 0xFF, 0xD9, 0xFF, 0xE1, 0xFF, 0xDD, 0xFF,
-	0xD5, 0xFF, 0xDF, 0xFF, 0xCF, 0xFF, 0xD4, 0xFF, 0xDC, 0xFF, 0xDC, 0xFF,
-	0xD8, 0xFF, 0xD1, 0xFF, 0xDC, 0xFF, 0xD8, 0xFF, 0xD8, 0xFF, 0xD9, 0xFF,
-	0xD8, 0xFF, 0xDD, 0xFF, 0xDC, 0xFF, 0xD1, 0xFF, 0xD7, 0xFF, 0xDC, 0xFF,
-	0xDA, 0xFF, 0xD4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDA, 0xFF, 0xE2, 0xFF,
-	0xEE, 0xFF, 0xE2, 0xFF, 0xE9, 0xFF, 0xE3, 0xFF, 0xE6, 0xFF, 0xDD, 0xFF,
-	0xE2, 0xFF, 0xE9, 0xFF, 0xF0, 0xFF, 0xF2, 0xFF, 0xEC, 0xFF, 0xF0, 0xFF,
-	0xE9, 0xFF, 0xE8, 0xFF, 0xF3, 0xFF, 0xE9, 0xFF, 0xF2, 0xFF, 0xFA, 0xFF,
-	0xF1, 0xFF, 0xF1, 0xFF, 0xF2, 0xFF, 0x00, 0x00, 0xF6, 0xFF, 0xFC, 0xFF,
-	0xF7, 0xFF, 0xF8, 0xFF, 0xF2, 0xFF, 0xEC, 0xFF, 0xFD, 0xFF, 0xFA, 0xFF,
-	0xFA, 0xFF, 0x05, 0x00, 0xFA, 0xFF, 0xF5, 0xFF, 0xF3, 0xFF, 0xF5, 0xFF,
-	0xF2, 0xFF, 0xF0, 0xFF, 0xF6, 0xFF, 0xF8, 0xFF, 0xF6, 0xFF, 0xF3, 0xFF,
-	0x00, 0x00, 0xF5, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xF5, 0xFF,
-	0xFB, 0xFF, 0xFA, 0xFF, 0xED, 0xFF, 0xF6, 0xFF, 0xFB, 0xFF, 0xED, 0xFF,
-	0xF5, 0xFF, 0x05, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00,
-	0x00, 0x00, 0x01, 0x00, 0xFA, 0xFF, 0xFD, 0xFF, 0x0A, 0x00, 0x08, 0x00,
-	0x14, 0x00, 0x0F, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x0A, 0x00, 0x01, 0x00,
-	0x0A, 0x00, 0x0E, 0x00, 0x13, 0x00, 0x06, 0x00, 0x14, 0x00, 0x17, 0x00,
-	0x15, 0x00, 0x1D, 0x00, 0x13, 0x00, 0x1C, 0x00, 0x24, 0x00, 0x1E, 0x00,
-	0x24, 0x00, 0x1A, 0x00, 0x1D, 0x00, 0x21, 0x00, 0x23, 0x00, 0x1E, 0x00,
-	0x1C, 0x00, 0x22, 0x00, 0x12, 0x00, 0x27, 0x00, 0x17, 0x00, 0x27, 0x00,
-	0x1C, 0x00, 0x21, 0x00, 0x17, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x15, 0x00,
-	0x22, 0x00, 0x22, 0x00, 0x28, 0x00, 0x1C, 0x00, 0x28, 0x00, 0x27, 0x00,
-	0x32, 0x00, 0x1E, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x31, 0x00,
-	0x2E, 0x00, 0x28, 0x00, 0x33, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x2D, 0x00,
-	0x31, 0x00, 0x2D, 0x00, 0x32, 0x00, 0x31, 0x00, 0x32, 0x00, 0x2C, 0x00,
-	0x32, 0x00, 0x2E, 0x00, 0x33, 0x00, 0x35, 0x00, 0x31, 0x00, 0x32, 0x00,
-	0x3B, 0x00, 0x3C, 0x00, 0x35, 0x00, 0x28, 0x00, 0x27, 0x00, 0x28, 0x00,
-	0x2D, 0x00, 0x28, 0x00, 0x2E, 0x00, 0x24, 0x00, 0x23, 0x00, 0x2B, 0x00,
-	0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x28, 0x00, 0x2D, 0x00, 0x36, 0x00,
-	0x32, 0x00, 0x3A, 0x00, 0x36, 0x00, 0x43, 0x00, 0x3B, 0x00, 0x3F, 0x00,
-	0x43, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x45, 0x00, 0x45, 0x00,
-	0x3C, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3C, 0x00,
-	0x3E, 0x00, 0x3F, 0x00, 0x3A, 0x00, 0x3C, 0x00, 0x36, 0x00, 0x2D, 0x00,
-	0x32, 0x00, 0x35, 0x00, 0x30, 0x00, 0x31, 0x00, 0x3C, 0x00, 0x38, 0x00,
-	0x3C, 0x00, 0x36, 0x00, 0x40, 0x00, 0x44, 0x00, 0x49, 0x00, 0x40, 0x00,
-	0x4A, 0x00, 0x45, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x4A, 0x00, 0x46, 0x00,
-	0x41, 0x00, 0x41, 0x00, 0x48, 0x00, 0x43, 0x00, 0x43, 0x00, 0x46, 0x00,
-	0x4B, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x46, 0x00, 0x44, 0x00, 0x45, 0x00,
-	0x48, 0x00, 0x40, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x38, 0x00, 0x36, 0x00,
-	0x3B, 0x00, 0x32, 0x00, 0x30, 0x00, 0x32, 0x00, 0x30, 0x00, 0x36, 0x00,
-	0x40, 0x00, 0x3A, 0x00, 0x36, 0x00, 0x26, 0x00, 0x2C, 0x00, 0x2C, 0x00,
-	0x24, 0x00, 0x32, 0x00, 0x28, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2C, 0x00,
-	0x26, 0x00, 0x23, 0x00, 0x22, 0x00, 0x17, 0x00, 0x21, 0x00, 0x18, 0x00,
-	0x12, 0x00, 0x24, 0x00, 0x18, 0x00, 0x23, 0x00, 0x18, 0x00, 0x27, 0x00,
-	0x14, 0x00, 0x1C, 0x00, 0x17, 0x00, 0x17, 0x00, 0x10, 0x00, 0x1C, 0x00,
-	0x19, 0x00, 0x1A, 0x00, 0x18, 0x00, 0x17, 0x00, 0x18, 0x00, 0x14, 0x00,
-	0x1D, 0x00, 0x21, 0x00, 0x24, 0x00, 0x1D, 0x00, 0x1F, 0x00, 0x22, 0x00,
-	0x1C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x21, 0x00, 0x1E, 0x00, 0x1F, 0x00,
-	0x1F, 0x00, 0x21, 0x00, 0x1F, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x13, 0x00,
-	0x1A, 0x00, 0x17, 0x00, 0x21, 0x00, 0x21, 0x00, 0x18, 0x00, 0x0E, 0x00,
-	0x12, 0x00, 0x12, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0D, 0x00, 0x0D, 0x00,
-	0x0D, 0x00, 0x12, 0x00, 0x17, 0x00, 0x0D, 0x00, 0x09, 0x00, 0x08, 0x00,
-	0x06, 0x00, 0x14, 0x00, 0x12, 0x00, 0x0D, 0x00, 0x08, 0x00, 0x03, 0x00,
-	0x06, 0x00, 0x04, 0x00, 0xF8, 0xFF, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00,
-	0x08, 0x00, 0xFF, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0xFA, 0xFF, 0xFC, 0xFF,
-	0x01, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0xF2, 0xFF,
-	0xF1, 0xFF, 0xF5, 0xFF, 0xEC, 0xFF, 0xEC, 0xFF, 0xF8, 0xFF, 0xF5, 0xFF,
-	0xEE, 0xFF, 0xE4, 0xFF, 0xE6, 0xFF, 0xE7, 0xFF, 0xDC, 0xFF, 0xED, 0xFF,
-	0xED, 0xFF, 0xEE, 0xFF, 0xE3, 0xFF, 0xE8, 0xFF, 0xF8, 0xFF, 0xEE, 0xFF,
-	0xF0, 0xFF, 0xE6, 0xFF, 0xF0, 0xFF, 0xE4, 0xFF, 0xE9, 0xFF, 0xE6, 0xFF,
-	0xE2, 0xFF, 0xD5, 0xFF, 0xE8, 0xFF, 0xDF, 0xFF, 0xE2, 0xFF, 0xDE, 0xFF,
-	0xDC, 0xFF, 0xE3, 0xFF, 0xEB, 0xFF, 0xE6, 0xFF, 0xE8, 0xFF, 0xEB, 0xFF,
-	0xDC, 0xFF, 0xE8, 0xFF, 0xDF, 0xFF, 0xE4, 0xFF, 0xE2, 0xFF, 0xE8, 0xFF,
-	0xF3, 0xFF, 0xDC, 0xFF, 0xE2, 0xFF, 0xE2, 0xFF, 0xF6, 0xFF, 0xF6, 0xFF,
-	0xE8, 0xFF, 0xE9, 0xFF, 0xE3, 0xFF, 0xDE, 0xFF, 0xE6, 0xFF, 0xDD, 0xFF,
-	0xE2, 0xFF, 0xE3, 0xFF, 0xDE, 0xFF, 0xD8, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF,
-	0xDC, 0xFF, 0xDA, 0xFF, 0xCE, 0xFF, 0xCB, 0xFF, 0xC7, 0xFF, 0xD4, 0xFF,
-	0xDE, 0xFF, 0xE2, 0xFF, 0xD2, 0xFF, 0xCE, 0xFF, 0xCA, 0xFF, 0xDD, 0xFF,
-	0xDD, 0xFF, 0xCE, 0xFF, 0xD8, 0xFF, 0xCA, 0xFF, 0xCF, 0xFF, 0xD2, 0xFF,
-	0xD7, 0xFF, 0xDF, 0xFF, 0xDC, 0xFF, 0xD8, 0xFF, 0xCF, 0xFF, 0xCF, 0xFF,
-	0xC9, 0xFF, 0xCF, 0xFF, 0xD7, 0xFF, 0xE2, 0xFF, 0xD9, 0xFF, 0xD4, 0xFF,
-	0xD8, 0xFF, 0xD3, 0xFF, 0xD7, 0xFF, 0xD8, 0xFF, 0xD9, 0xFF, 0xD5, 0xFF,
-	0xDD, 0xFF, 0xE7, 0xFF, 0xEB, 0xFF, 0xE3, 0xFF, 0xD7, 0xFF, 0xDC, 0xFF,
-	0xD8, 0xFF, 0xD5, 0xFF, 0xE2, 0xFF, 0xE6, 0xFF, 0xEC, 0xFF, 0xED, 0xFF,
-	0xE3, 0xFF, 0xE1, 0xFF, 0xD8, 0xFF, 0xCE, 0xFF, 0xD5, 0xFF, 0xD8, 0xFF,
-	0xE6, 0xFF, 0xE9, 0xFF, 0xE6, 0xFF, 0xE3, 0xFF, 0xDF, 0xFF, 0xE6, 0xFF,
-	0xE3, 0xFF, 0xE2, 0xFF, 0xE6, 0xFF, 0xDC, 0xFF, 0xD5, 0xFF, 0xDF, 0xFF,
-	0xD7, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xEE, 0xFF, 0xF1, 0xFF, 0xEE, 0xFF,
-	0xE6, 0xFF, 0xDF, 0xFF, 0xE7, 0xFF, 0xEB, 0xFF, 0xED, 0xFF, 0x00, 0x00,
-	0x03, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00,
-	0x06, 0x00, 0x1D, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x1D, 0x00, 0x21, 0x00,
-	0x30, 0x00, 0x44, 0x00, 0x6C, 0x00, 0x97, 0x00, 0xCE, 0x00, 0xF4, 0x00,
-	0x46, 0x02, 0x8B, 0x07, 0xA2, 0x0E, 0x99, 0x11, 0xB6, 0x0E, 0x18, 0x08,
-	0xFB, 0x00, 0x92, 0xFB, 0xD0, 0xF8, 0xDF, 0xF9, 0x08, 0xFE, 0x30, 0x03,
-	0xA9, 0x07, 0xB6, 0x0A, 0xC5, 0x09, 0xDF, 0x04, 0x9F, 0xFF, 0x71, 0xFC,
-	0x76, 0xFC, 0x96, 0xFF, 0xA8, 0x02, 0xD0, 0x04, 0x36, 0x06, 0xFB, 0x05,
-	0x21, 0x04, 0xCF, 0x01, 0x15, 0x00, 0x06, 0x00, 0xA6, 0x01, 0xE3, 0x03,
-	0x03, 0x05, 0xFD, 0x04, 0x43, 0x04, 0x78, 0x03, 0xB5, 0x02, 0x37, 0x02,
-	0xCF, 0x01, 0x43, 0x03, 0xE1, 0x07, 0x85, 0x0C, 0xC1, 0x0E, 0x56, 0x10,
-	0xAF, 0x11, 0xB8, 0x12, 0xCE, 0x12, 0xAD, 0x0F, 0x70, 0x0A, 0x83, 0x05,
-	0xAC, 0x02, 0xBC, 0x02, 0x5F, 0x04, 0xA6, 0x05, 0x5F, 0x05, 0x03, 0x04,
-	0x8F, 0x02, 0x23, 0x01, 0x81, 0xFF, 0x17, 0xFF, 0x75, 0x00, 0x03, 0x03,
-	0xD7, 0x04, 0x8D, 0x04, 0xE9, 0x01, 0xCA, 0xFF, 0xE6, 0xFF, 0x76, 0x00,
-	0xC4, 0xFF, 0xA6, 0xFE, 0xE8, 0xFD, 0x70, 0xFE, 0x26, 0x00, 0xDB, 0x00,
-	0x5B, 0xFF, 0x9E, 0xFD, 0x63, 0xFD, 0xAE, 0xFD, 0xB4, 0xFC, 0xDF, 0xFA,
-	0xD3, 0xFA, 0x4F, 0xFD, 0xBB, 0xFF, 0x6D, 0x00, 0xA7, 0xFF, 0x7E, 0xFE,
-	0xD4, 0xFD, 0xB0, 0xFD, 0xAE, 0xFD, 0x34, 0xFE, 0x26, 0xFF, 0xE2, 0xFF,
-	0xE3, 0xFF, 0xD8, 0xFE, 0xEE, 0xFC, 0x08, 0xFB, 0xED, 0xF9, 0x5B, 0xFA,
-	0x09, 0xFB, 0x6C, 0xFA, 0x56, 0xF9, 0x38, 0xF9, 0x46, 0xF9, 0xCD, 0xF8,
-	0xDC, 0xF8, 0xC0, 0xF9, 0x4E, 0xFA, 0xBE, 0xF9, 0xC9, 0xF8, 0x7B, 0xF8,
-	0x52, 0xF9, 0xC5, 0xFA, 0xA6, 0xFC, 0x9E, 0xFE, 0xCF, 0xFF, 0x6A, 0xFF,
-	0xA5, 0xFD, 0xB6, 0xFB, 0x39, 0xFB, 0x14, 0xFC, 0x12, 0xFD, 0xA4, 0xFD,
-	0x7C, 0xFD, 0xCD, 0xFC, 0x64, 0xFC, 0x1F, 0xFC, 0xCA, 0xFA, 0x01, 0xFA,
-	0x3F, 0xFB, 0x18, 0xFC, 0xDB, 0xFB, 0xD4, 0xFB, 0xFA, 0xFC, 0xA7, 0xFF,
-	0xF8, 0x00, 0x73, 0x00, 0xFA, 0xFF, 0xB0, 0xFE, 0x12, 0xFD, 0x51, 0xFC,
-	0x6C, 0xFC, 0xB4, 0xFD, 0xC2, 0xFF, 0xB0, 0x00, 0xA3, 0xFF, 0x0A, 0xFE,
-	0xC5, 0xFD, 0x41, 0xFE, 0xD3, 0xFD, 0xB7, 0xFC, 0x94, 0xFC, 0x27, 0xFD,
-	0xC7, 0xFD, 0x07, 0xFE, 0x27, 0xFE, 0x6B, 0xFE, 0x57, 0xFE, 0xC6, 0xFD,
-	0x0E, 0xFD, 0x69, 0xFC, 0xAB, 0xFC, 0x49, 0xFE, 0x1C, 0x00, 0xB6, 0x00,
-	0x7E, 0xFF, 0xDB, 0xFD, 0x9C, 0xFD, 0xAF, 0xFE, 0x4F, 0x00, 0xA1, 0x02,
-	0xE1, 0x03, 0x18, 0x02, 0x55, 0xFF, 0x9A, 0xFD, 0x97, 0xFC, 0x9C, 0xFC,
-	0x09, 0xFE, 0x77, 0xFF, 0xFB, 0xFF, 0x3E, 0xFF, 0x35, 0xFD, 0xCA, 0xFA,
-	0xAF, 0xFA, 0x00, 0xFD, 0x2A, 0xFF, 0x30, 0xFF, 0x50, 0xFE, 0x13, 0xFE,
-	0x27, 0xFE, 0x35, 0xFE, 0x66, 0xFE, 0xBE, 0xFE, 0x60, 0xFF, 0x3E, 0xFF,
-	0xB2, 0xFD, 0xE0, 0xFB, 0x6B, 0xFB, 0xBD, 0xFC, 0xA6, 0xFE, 0x8A, 0xFF,
-	0xCC, 0xFE, 0xEB, 0xFC, 0x58, 0xFB, 0x04, 0xFB, 0x5D, 0xFB, 0xA3, 0xFB,
-	0x02, 0xFC, 0xD8, 0xFC, 0x75, 0xFD, 0x75, 0xFD, 0x74, 0xFD, 0xC7, 0xFD,
-	0x13, 0xFE, 0x61, 0xFE, 0xF5, 0xFE, 0x63, 0xFF, 0xC7, 0xFF, 0x18, 0x00,
-	0x1C, 0x00, 0x15, 0x00, 0x0E, 0x00, 0x5C, 0xFF, 0x10, 0xFE, 0x6E, 0xFD,
-	0xA8, 0xFD, 0xE5, 0xFD, 0x0B, 0xFE, 0x38, 0xFE, 0x6E, 0xFE, 0x95, 0xFE,
-	0xF4, 0xFE, 0x5F, 0xFF, 0x96, 0xFF, 0xAD, 0xFF, 0x03, 0x00, 0x45, 0x00,
-	0x58, 0x00, 0xBF, 0x00, 0x8D, 0x01, 0x75, 0x02, 0x27, 0x03, 0x8C, 0x03,
-	0x4D, 0x03, 0xA2, 0x02, 0x39, 0x02, 0xFF, 0x01, 0xDC, 0x01, 0x37, 0x02,
-	0xDE, 0x02, 0xF8, 0x02, 0x94, 0x02, 0x4D, 0x02, 0x16, 0x02, 0x88, 0x01,
-	0x38, 0x01, 0xA3, 0x01, 0x70, 0x02, 0x23, 0x03, 0x9C, 0x03, 0xB4, 0x03,
-	0xD8, 0x03, 0x4A, 0x04, 0xBB, 0x04, 0x8A, 0x04, 0x0B, 0x04, 0xF3, 0x03,
-	0x17, 0x04, 0xF4, 0x03, 0x96, 0x03, 0x35, 0x03, 0x41, 0x03, 0xA4, 0x03,
-	0xB5, 0x03, 0x3A, 0x03, 0x8D, 0x02, 0x0E, 0x02, 0x9F, 0x01, 0x36, 0x01,
-	0x4F, 0x01, 0xAC, 0x01, 0x26, 0x02, 0x88, 0x02, 0x96, 0x02, 0x25, 0x02,
-	0x7A, 0x01, 0x19, 0x01, 0x3D, 0x01, 0xDC, 0x01, 0x91, 0x02, 0xFD, 0x02,
-	0xDF, 0x02, 0x8B, 0x02, 0x25, 0x02, 0x8A, 0x01, 0xA4, 0x00, 0x12, 0x00,
-	0xF5, 0xFF, 0xFD, 0xFF, 0xE3, 0xFF, 0x9D, 0xFF, 0x25, 0xFF, 0xD3, 0xFE,
-	0xB5, 0xFE, 0x69, 0xFE, 0xCD, 0xFD, 0x30, 0xFD, 0xF7, 0xFC, 0x0E, 0xFD,
-	0x2A, 0xFD, 0x32, 0xFD, 0x25, 0xFD, 0x48, 0xFD, 0x9A, 0xFD, 0x97, 0xFD,
-	0xDC, 0xFC, 0xDD, 0xFB, 0x5E, 0xFB, 0x5F, 0xFB, 0x84, 0xFB, 0x83, 0xFB,
-	0x63, 0xFB, 0x1F, 0xFB, 0xDF, 0xFA, 0x4E, 0xFA, 0x71, 0xF9, 0x95, 0xF8,
-	0x05, 0xF8, 0xC6, 0xF7, 0xB3, 0xF7, 0xB1, 0xF7, 0xAA, 0xF7, 0xC1, 0xF7,
-	0x74, 0xF7, 0xF6, 0xF6, 0x96, 0xF6, 0x57, 0xF6, 0x04, 0xF6, 0x96, 0xF5,
-	0x21, 0xF5, 0x12, 0xF5, 0x21, 0xF5, 0x27, 0xF5, 0xEB, 0xF4, 0x9A, 0xF4,
-	0x28, 0xF4, 0x8B, 0xF3, 0xDD, 0xF2, 0x16, 0xF2, 0xBB, 0xF1, 0xB6, 0xF1,
-	0xBA, 0xF1, 0x61, 0xF1, 0x13, 0xF1, 0x12, 0xF1, 0xFA, 0xF0, 0x4B, 0xF0,
-	0x4B, 0xEF, 0xB2, 0xEE, 0xB9, 0xEE, 0xD4, 0xEE, 0xD0, 0xEE, 0xB7, 0xEE,
-	0xCB, 0xEE, 0xDD, 0xEE, 0xB6, 0xEE, 0xF5, 0xED, 0x0F, 0xED, 0xD1, 0xEC,
-	0x29, 0xED, 0x28, 0xED, 0xCE, 0xEC, 0xDD, 0xEC, 0xC8, 0xED, 0xAB, 0xEF,
-	0xBB, 0xF1, 0x3E, 0xF3, 0xDA, 0xF4, 0xD5, 0xF6, 0xED, 0xF8, 0x6E, 0xFA,
-	0x01, 0xFB, 0x83, 0xFB, 0xCE, 0xFC, 0x3B, 0xFE, 0x70, 0xFE, 0x9C, 0xFD,
-	0x6A, 0xFD, 0x6B, 0xFE, 0x47, 0xFF, 0xFD, 0xFE, 0x92, 0xFE, 0x73, 0xFF,
-	0x26, 0x01, 0xF6, 0x01, 0x31, 0x02, 0xF3, 0x02, 0x83, 0x04, 0x22, 0x06,
-	0xD8, 0x06, 0xF3, 0x06, 0x93, 0x07, 0x0C, 0x09, 0xAF, 0x0A, 0xBE, 0x0B,
-	0xA7, 0x0C, 0xEB, 0x0D, 0x45, 0x0F, 0x45, 0x10, 0xCE, 0x10, 0x4E, 0x11,
-	0xCE, 0x11, 0x1C, 0x12, 0xBF, 0x11, 0x0D, 0x11, 0x35, 0x10, 0x5C, 0x0F,
-	0xCA, 0x0E, 0x7A, 0x0E, 0x2E, 0x0E, 0xF0, 0x0D, 0x0F, 0x0E, 0x3F, 0x0E,
-	0x55, 0x0E, 0x8B, 0x0E, 0x2C, 0x0F, 0xF2, 0x0F, 0x56, 0x10, 0x49, 0x10,
-	0x54, 0x10, 0x97, 0x10, 0x70, 0x10, 0xBB, 0x0F, 0xB6, 0x0E, 0xC9, 0x0D,
-	0xD7, 0x0C, 0xE3, 0x0B, 0x08, 0x0B, 0xFD, 0x09, 0xCF, 0x08, 0xDA, 0x07,
-	0xCF, 0x06, 0x76, 0x05, 0xFB, 0x03, 0xD2, 0x02, 0x0F, 0x02, 0x2A, 0x01,
-	0x19, 0x00, 0x46, 0xFF, 0xEE, 0xFE, 0xDD, 0xFE, 0x82, 0xFE, 0x36, 0xFE,
-	0x06, 0xFE, 0x1A, 0xFE, 0x44, 0xFE, 0x1E, 0xFE, 0x82, 0xFD, 0x23, 0xFD,
-	0x48, 0xFD, 0x53, 0xFD, 0xBF, 0xFC, 0x9F, 0xFB, 0xAA, 0xFA, 0xD2, 0xF9,
-	0xFB, 0xF8, 0x3F, 0xF8, 0xB6, 0xF7, 0x84, 0xF7, 0x58, 0xF7, 0x06, 0xF7,
-	0xFC, 0xF6, 0x7E, 0xF7, 0xFF, 0xF7, 0x68, 0xF8, 0xF1, 0xF8, 0xB0, 0xF9,
-	0xC8, 0xFA, 0xED, 0xFB, 0xE6, 0xFC, 0x8E, 0xFD, 0x27, 0xFE, 0xDF, 0xFE,
-	0xD4, 0xFF, 0xCD, 0x00, 0x30, 0x01, 0x50, 0x01, 0x0B, 0x02, 0xB4, 0x03,
-	0xCE, 0x05, 0x98, 0x07, 0x1E, 0x09, 0xD2, 0x0A, 0x4D, 0x0C, 0x77, 0x0C,
-	0x7A, 0x0B, 0x22, 0x0B, 0x19, 0x0C, 0xFC, 0x0C, 0xD7, 0x0C, 0x1C, 0x0D,
-	0xFA, 0x0E, 0x84, 0x11, 0x12, 0x13, 0xB5, 0x12, 0x4F, 0x12, 0x69, 0x13,
-	0x0F, 0x15, 0x8F, 0x15, 0x30, 0x15, 0x94, 0x15, 0x0F, 0x17, 0xA8, 0x18,
-	0x15, 0x19, 0x9C, 0x18, 0xFA, 0x17, 0x56, 0x17, 0x94, 0x16, 0xAB, 0x15,
-	0xA1, 0x14, 0x3A, 0x14, 0x71, 0x14, 0x60, 0x14, 0xA1, 0x13, 0x87, 0x12,
-	0x43, 0x11, 0xF4, 0x0F, 0x7B, 0x0E, 0xA0, 0x0C, 0x01, 0x0B, 0x9B, 0x0A,
-	0xC0, 0x0A, 0xB3, 0x0A, 0x4D, 0x0A, 0xB1, 0x09, 0x1D, 0x09, 0x3C, 0x08,
-	0x1F, 0x07, 0xDC, 0x05, 0x92, 0x04, 0x93, 0x03, 0xEC, 0x02, 0x62, 0x02,
-	0xAB, 0x01, 0x93, 0x00, 0x39, 0xFF, 0xE7, 0xFD, 0x76, 0xFC, 0xF9, 0xFA,
-	0x6D, 0xF9, 0x29, 0xF8, 0x92, 0xF7, 0x2E, 0xF7, 0xBE, 0xF6, 0x6F, 0xF6,
-	0x23, 0xF6, 0x9B, 0xF5, 0xC5, 0xF4, 0xE4, 0xF3, 0x0F, 0xF3, 0x66, 0xF2,
-	0xFB, 0xF1, 0xD5, 0xF1, 0x1A, 0xF2, 0x5E, 0xF2, 0x53, 0xF2, 0xD7, 0xF1,
-	0x19, 0xF1, 0x3F, 0xF0, 0x05, 0xEF, 0xA9, 0xED, 0xC0, 0xEC, 0x30, 0xEC,
-	0xA6, 0xEB, 0xDE, 0xEA, 0x27, 0xEA, 0xAD, 0xE9, 0x07, 0xE9, 0x0C, 0xE8,
-	0xE0, 0xE6, 0x2F, 0xE6, 0x9F, 0xE5, 0xA3, 0xE4, 0x73, 0xE3, 0xD3, 0xE2,
-	0x06, 0xE3, 0xC6, 0xE3, 0x47, 0xE4, 0x63, 0xE4, 0x4B, 0xE4, 0x54, 0xE4,
-	0x4E, 0xE4, 0x15, 0xE4, 0xC5, 0xE3, 0x69, 0xE3, 0x5F, 0xE3, 0x4E, 0xE3,
-	0x2C, 0xE3, 0x0A, 0xE3, 0xB1, 0xE2, 0x12, 0xE2, 0x64, 0xE1, 0x80, 0xE0,
-	0x7D, 0xDF, 0x62, 0xDE, 0xBF, 0xDD, 0xF8, 0xDD, 0x12, 0xDF, 0x93, 0xE1,
-	0x1D, 0xE6, 0x6D, 0xEC, 0xBD, 0xF1, 0x70, 0xF4, 0x04, 0xF6, 0xE0, 0xF8,
-	0xBD, 0xFC, 0x02, 0xFE, 0x12, 0xFC, 0x12, 0xFB, 0xD4, 0xFD, 0xE2, 0x01,
-	0x83, 0x03, 0xB4, 0x02, 0x0C, 0x02, 0x8D, 0x03, 0x0E, 0x05, 0xE2, 0x03,
-	0xCA, 0x01, 0xEB, 0x01, 0x4A, 0x04, 0x73, 0x06, 0x25, 0x07, 0x30, 0x08,
-	0xDE, 0x0A, 0x09, 0x0D, 0x93, 0x0C, 0x22, 0x0B, 0x81, 0x0B, 0x14, 0x0E,
-	0x82, 0x11, 0xDF, 0x13, 0x91, 0x15, 0x8D, 0x18, 0x80, 0x1C, 0x29, 0x1F,
-	0x9D, 0x1E, 0x94, 0x1B, 0x80, 0x18, 0x1F, 0x17, 0x6C, 0x16, 0x9F, 0x14,
-	0x05, 0x13, 0xAF, 0x12, 0xE1, 0x12, 0x80, 0x12, 0x40, 0x11, 0xB2, 0x0F,
-	0xAB, 0x0E, 0x27, 0x0E, 0xA6, 0x0D, 0x61, 0x0D, 0x58, 0x0E, 0x37, 0x10,
-	0x8D, 0x11, 0x78, 0x11, 0xA4, 0x10, 0x06, 0x10, 0x5A, 0x0F, 0xDA, 0x0D,
-	0xC1, 0x0B, 0x21, 0x0A, 0xA4, 0x09, 0xDD, 0x09, 0xC3, 0x09, 0xF5, 0x08,
-	0x8F, 0x07, 0x8A, 0x05, 0x2A, 0x03, 0x76, 0x00, 0x7D, 0xFD, 0xD8, 0xFA,
-	0xC8, 0xF8, 0x73, 0xF7, 0xCA, 0xF6, 0xD4, 0xF6, 0xFB, 0xF6, 0xE9, 0xF6,
-	0x7C, 0xF6, 0x36, 0xF6, 0x45, 0xF6, 0x8C, 0xF6, 0xF7, 0xF6, 0x93, 0xF7,
-	0x92, 0xF8, 0x98, 0xF9, 0x34, 0xFA, 0x47, 0xFA, 0xD8, 0xF9, 0x28, 0xF9,
-	0x27, 0xF8, 0xF3, 0xF6, 0x47, 0xF6, 0x60, 0xF6, 0x8A, 0xF6, 0x4F, 0xF6,
-	0xF9, 0xF5, 0x7F, 0xF6, 0xBB, 0xF7, 0x4F, 0xF8, 0xA3, 0xF7, 0x35, 0xF7,
-	0xFE, 0xF7, 0x7F, 0xF9, 0xE0, 0xFA, 0x12, 0xFC, 0x9F, 0xFD, 0xEE, 0xFF,
-	0x6A, 0x02, 0x6A, 0x04, 0x16, 0x06, 0x89, 0x07, 0x12, 0x09, 0xBC, 0x0A,
-	0x38, 0x0C, 0x7A, 0x0D, 0xAB, 0x0E, 0xAC, 0x0F, 0x2A, 0x10, 0x63, 0x10,
-	0x6C, 0x10, 0x4D, 0x10, 0x20, 0x10, 0x20, 0x10, 0x05, 0x10, 0x1B, 0x10,
-	0xDD, 0x10, 0x6B, 0x12, 0x5D, 0x14, 0x1C, 0x16, 0xB6, 0x17, 0x6B, 0x19,
-	0xC8, 0x1A, 0xDF, 0x1B, 0x42, 0x1D, 0xC5, 0x1E, 0x74, 0x1F, 0x3C, 0x1F,
-	0x76, 0x1F, 0x8D, 0x20, 0x34, 0x21, 0x36, 0x20, 0xA4, 0x1E, 0xDD, 0x1D,
-	0xB3, 0x1D, 0xBB, 0x1C, 0x5F, 0x1A, 0xD9, 0x17, 0x5D, 0x16, 0xA1, 0x15,
-	0x22, 0x14, 0xE4, 0x11, 0x14, 0x10, 0x46, 0x0F, 0x45, 0x0E, 0xAC, 0x0C,
-	0x30, 0x0B, 0xB6, 0x0A, 0xE8, 0x0A, 0x9E, 0x0A, 0xFB, 0x09, 0x4C, 0x09,
-	0x11, 0x09, 0x0A, 0x09, 0x6D, 0x08, 0xB3, 0x06, 0xC4, 0x04, 0x6B, 0x03,
-	0x71, 0x02, 0xF1, 0x00, 0x02, 0xFF, 0x59, 0xFD, 0x87, 0xFC, 0xDF, 0xFB,
-	0xAA, 0xFA, 0x51, 0xF9, 0x9D, 0xF8, 0x71, 0xF8, 0x0E, 0xF8, 0x4C, 0xF7,
-	0x99, 0xF6, 0x63, 0xF6, 0xBF, 0xF6, 0xF1, 0xF6, 0xF4, 0xF6, 0x16, 0xF7,
-	0xBE, 0xF7, 0x73, 0xF8, 0xA0, 0xF8, 0x85, 0xF8, 0x9C, 0xF8, 0x20, 0xF9,
-	0xA6, 0xF9, 0x95, 0xF9, 0x36, 0xF9, 0xDC, 0xF8, 0x9D, 0xF8, 0x1D, 0xF8,
-	0x09, 0xF7, 0xE3, 0xF5, 0x37, 0xF5, 0xC6, 0xF4, 0x0B, 0xF4, 0xFD, 0xF2,
-	0x55, 0xF2, 0x11, 0xF2, 0xB5, 0xF1, 0xEB, 0xF0, 0x00, 0xF0, 0x4F, 0xEF,
-	0xAC, 0xEE, 0xB1, 0xED, 0x5C, 0xEC, 0x06, 0xEB, 0x9C, 0xE9, 0xDA, 0xE7,
-	0xF4, 0xE5, 0xB7, 0xE4, 0x27, 0xE4, 0xD9, 0xE3, 0x46, 0xE3, 0xA5, 0xE2,
-	0xD9, 0xE1, 0xBF, 0xE0, 0xAB, 0xDF, 0x11, 0xDF, 0x89, 0xDE, 0x37, 0xDD,
-	0x3B, 0xDB, 0xD0, 0xD9, 0x5B, 0xD9, 0xEE, 0xD8, 0x8E, 0xD7, 0x00, 0xD6,
-	0xB0, 0xD5, 0x1D, 0xD6, 0x19, 0xD6, 0xE2, 0xD5, 0x09, 0xD7, 0xC9, 0xD9,
-	0x09, 0xDD, 0x67, 0xE0, 0x41, 0xE4, 0x81, 0xE8, 0xBF, 0xEB, 0x82, 0xED,
-	0xED, 0xEE, 0xE6, 0xF0, 0xFE, 0xF2, 0x8B, 0xF4, 0xB2, 0xF5, 0x30, 0xF7,
-	0x6F, 0xF9, 0x84, 0xFB, 0xAD, 0xFC, 0x8B, 0xFD, 0xB8, 0xFE, 0xE2, 0xFF,
-	0x7B, 0x00, 0xDE, 0x00, 0x14, 0x02, 0x5C, 0x04, 0x38, 0x06, 0x1A, 0x07,
-	0xEA, 0x07, 0xB3, 0x09, 0xE8, 0x0B, 0x6E, 0x0D, 0x18, 0x0E, 0x7D, 0x0F,
-	0x7B, 0x12, 0xC6, 0x15, 0x35, 0x18, 0xF8, 0x19, 0x31, 0x1C, 0xF6, 0x1E,
-	0x9E, 0x20, 0x0C, 0x20, 0xA1, 0x1E, 0x00, 0x1E, 0xC7, 0x1D, 0xCC, 0x1C,
-	0x1C, 0x1B, 0x3E, 0x1A, 0x63, 0x1A, 0x4D, 0x1A, 0x30, 0x19, 0xD4, 0x17,
-	0x18, 0x17, 0xB2, 0x16, 0xEF, 0x15, 0xB5, 0x14, 0xDC, 0x13, 0xA6, 0x13,
-	0x66, 0x13, 0xC3, 0x12, 0xDD, 0x11, 0x17, 0x11, 0x5D, 0x10, 0x68, 0x0F,
-	0x43, 0x0E, 0x0E, 0x0D, 0x0A, 0x0C, 0x5F, 0x0B, 0x9D, 0x0A, 0x8B, 0x09,
-	0x1C, 0x08, 0x84, 0x06, 0x9B, 0x04, 0x6B, 0x02, 0x09, 0x00, 0xA3, 0xFD,
-	0x13, 0xFB, 0x7F, 0xF8, 0x48, 0xF6, 0x9A, 0xF4, 0x77, 0xF3, 0x93, 0xF2,
-	0xA6, 0xF1, 0xBD, 0xF0, 0x54, 0xF0, 0x14, 0xF0, 0x80, 0xEF, 0x26, 0xEF,
-	0x75, 0xEF, 0x11, 0xF0, 0x23, 0xF0, 0xC8, 0xEF, 0xE9, 0xEF, 0xB3, 0xF0,
-	0x45, 0xF1, 0x2E, 0xF1, 0x32, 0xF1, 0x06, 0xF2, 0x0D, 0xF3, 0x7A, 0xF3,
-	0xB8, 0xF3, 0x70, 0xF4, 0x94, 0xF5, 0x46, 0xF6, 0x6A, 0xF6, 0xC7, 0xF6,
-	0xBC, 0xF7, 0x99, 0xF8, 0x17, 0xF9, 0xA8, 0xF9, 0xF8, 0xFA, 0xEA, 0xFC,
-	0xA5, 0xFE, 0x0D, 0x00, 0xAF, 0x01, 0x36, 0x04, 0x14, 0x07, 0x57, 0x09,
-	0x05, 0x0B, 0xE7, 0x0C, 0x10, 0x0F, 0x0C, 0x11, 0x78, 0x12, 0x7D, 0x13,
-	0x8D, 0x14, 0xBC, 0x15, 0xC9, 0x16, 0x6D, 0x17, 0xE0, 0x17, 0x93, 0x18,
-	0xAE, 0x19, 0xD8, 0x1A, 0xFA, 0x1B, 0x8F, 0x1D, 0x2F, 0x1F, 0x36, 0x20,
-	0xE8, 0x20, 0x44, 0x22, 0xF4, 0x23, 0x2D, 0x24, 0xE7, 0x22, 0x2F, 0x22,
-	0x1E, 0x23, 0x0D, 0x24, 0x4A, 0x23, 0x13, 0x22, 0x3D, 0x22, 0x20, 0x23,
-	0xCA, 0x22, 0x1F, 0x21, 0x9B, 0x1F, 0xE2, 0x1E, 0x72, 0x1D, 0xEA, 0x1A,
-	0x5B, 0x18, 0xAC, 0x16, 0x18, 0x15, 0x80, 0x12, 0x34, 0x0F, 0xB8, 0x0C,
-	0x4B, 0x0B, 0xAB, 0x09, 0x43, 0x07, 0xD4, 0x04, 0x98, 0x03, 0x37, 0x03,
-	0x93, 0x02, 0x5A, 0x01, 0xF5, 0xFF, 0xD1, 0xFE, 0xE0, 0xFD, 0xBA, 0xFC,
-	0x67, 0xFB, 0x2D, 0xFA, 0x34, 0xF9, 0x95, 0xF8, 0xEA, 0xF7, 0x61, 0xF7,
-	0x7B, 0xF7, 0xC5, 0xF7, 0x63, 0xF7, 0x2F, 0xF6, 0x59, 0xF5, 0x57, 0xF5,
-	0x32, 0xF5, 0x23, 0xF4, 0xD1, 0xF2, 0x6C, 0xF2, 0xA0, 0xF2, 0x8E, 0xF2,
-	0xFF, 0xF1, 0xB6, 0xF1, 0x0E, 0xF2, 0x85, 0xF2, 0xC1, 0xF2, 0xEB, 0xF2,
-	0x4A, 0xF3, 0xDD, 0xF3, 0x57, 0xF4, 0x99, 0xF4, 0xDB, 0xF4, 0x23, 0xF5,
-	0xF7, 0xF4, 0x7C, 0xF4, 0xE4, 0xF3, 0x40, 0xF3, 0xA4, 0xF2, 0x09, 0xF2,
-	0x60, 0xF1, 0x87, 0xF0, 0x70, 0xEF, 0x6D, 0xEE, 0x69, 0xED, 0x0B, 0xEC,
-	0xEF, 0xE9, 0x3B, 0xE7, 0x6D, 0xE4, 0x07, 0xE2, 0x70, 0xE0, 0x81, 0xDF,
-	0x8B, 0xDE, 0xCF, 0xDD, 0xA8, 0xDD, 0xD2, 0xDD, 0x6E, 0xDD, 0x4F, 0xDC,
-	0x09, 0xDB, 0x61, 0xDA, 0xDF, 0xD9, 0xD3, 0xD8, 0x4B, 0xD7, 0x38, 0xD6,
-	0x2E, 0xD6, 0x7F, 0xD6, 0x4B, 0xD6, 0x9B, 0xD5, 0xAA, 0xD5, 0xCC, 0xD6,
-	0x72, 0xD8, 0xE2, 0xDA, 0xB0, 0xDE, 0x48, 0xE3, 0x92, 0xE7, 0xDF, 0xEA,
-	0x77, 0xED, 0x13, 0xF0, 0x11, 0xF2, 0xB5, 0xF2, 0x7E, 0xF2, 0x36, 0xF3,
-	0x9D, 0xF5, 0x8C, 0xF8, 0x82, 0xFA, 0x36, 0xFC, 0xAF, 0xFE, 0xE8, 0x01,
-	0x6B, 0x04, 0x0B, 0x05, 0x6F, 0x04, 0x45, 0x04, 0x8D, 0x05, 0x8A, 0x07,
-	0x08, 0x09, 0xFF, 0x09, 0x4C, 0x0B, 0xD4, 0x0C, 0xEA, 0x0D, 0xA1, 0x0E,
-	0xD1, 0x0F, 0xAF, 0x11, 0xB7, 0x13, 0x92, 0x15, 0xB3, 0x17, 0xAB, 0x1A,
-	0x13, 0x1E, 0x49, 0x20, 0x74, 0x20, 0xC4, 0x1F, 0x6C, 0x1F, 0xFB, 0x1E,
-	0x45, 0x1D, 0x0F, 0x1B, 0x04, 0x1A, 0x55, 0x1A, 0x6D, 0x1A, 0xE7, 0x19,
-	0x65, 0x19, 0x24, 0x19, 0x5A, 0x18, 0xCF, 0x16, 0x27, 0x15, 0xCB, 0x13,
-	0x5E, 0x12, 0xC4, 0x10, 0x22, 0x0F, 0xDA, 0x0D, 0x5A, 0x0D, 0x01, 0x0D,
-	0xE9, 0x0B, 0x1D, 0x0A, 0x63, 0x08, 0x89, 0x07, 0x03, 0x07, 0x50, 0x06,
-	0x7B, 0x05, 0xB3, 0x04, 0xE6, 0x03, 0x0C, 0x03, 0xF7, 0x01, 0x46, 0x00,
-	0xD9, 0xFD, 0x74, 0xFB, 0x48, 0xF9, 0xFA, 0xF6, 0xBD, 0xF4, 0x58, 0xF3,
-	0x8D, 0xF2, 0xEC, 0xF1, 0x7A, 0xF1, 0x48, 0xF1, 0xF8, 0xF0, 0x61, 0xF0,
-	0xCE, 0xEF, 0x46, 0xEF, 0xF3, 0xEE, 0xAF, 0xEE, 0xA2, 0xEE, 0xD9, 0xEE,
-	0x3E, 0xEF, 0x06, 0xF0, 0x1F, 0xF1, 0x80, 0xF2, 0x82, 0xF3, 0x5C, 0xF4,
-	0x23, 0xF5, 0x05, 0xF6, 0x58, 0xF7, 0xE9, 0xF8, 0x55, 0xFA, 0x5B, 0xFB,
-	0x54, 0xFC, 0x49, 0xFD, 0x0B, 0xFE, 0x9B, 0xFE, 0x42, 0xFF, 0xDD, 0xFF,
-	0x65, 0x00, 0x72, 0x01, 0x42, 0x03, 0x2C, 0x05, 0x0E, 0x07, 0x2D, 0x09,
-	0xA1, 0x0B, 0x2E, 0x0E, 0x1B, 0x10, 0x88, 0x11, 0xC3, 0x12, 0xF0, 0x13,
-	0x08, 0x15, 0x69, 0x16, 0xFF, 0x17, 0xA4, 0x19, 0x24, 0x1B, 0x69, 0x1C,
-	0xE5, 0x1D, 0x6D, 0x20, 0xE6, 0x23, 0x58, 0x27, 0x6C, 0x29, 0xB9, 0x29,
-	0x4B, 0x29, 0x64, 0x29, 0x9C, 0x29, 0x7F, 0x28, 0x8A, 0x25, 0xCD, 0x22,
-	0x7D, 0x22, 0x69, 0x23, 0xB8, 0x22, 0x4E, 0x20, 0x94, 0x1E, 0x22, 0x1E,
-	0x4C, 0x1D, 0xD6, 0x1A, 0x2F, 0x18, 0x58, 0x16, 0x81, 0x14, 0x1B, 0x12,
-	0x10, 0x10, 0xE5, 0x0E, 0xCB, 0x0D, 0x96, 0x0B, 0x91, 0x08, 0x74, 0x06,
-	0xC7, 0x05, 0xAE, 0x05, 0x19, 0x05, 0x23, 0x04, 0x87, 0x03, 0x88, 0x03,
-	0x50, 0x03, 0x4D, 0x02, 0x36, 0x00, 0x57, 0xFD, 0x4A, 0xFA, 0xE2, 0xF7,
-	0x4B, 0xF6, 0x39, 0xF5, 0x8C, 0xF4, 0x26, 0xF4, 0xFF, 0xF3, 0xED, 0xF3,
-	0xE6, 0xF3, 0xDB, 0xF3, 0x6B, 0xF3, 0x73, 0xF2, 0xAF, 0xF1, 0xBC, 0xF1,
-	0x23, 0xF2, 0x48, 0xF2, 0x24, 0xF2, 0x39, 0xF2, 0xC6, 0xF2, 0xAD, 0xF3,
-	0x62, 0xF4, 0xA0, 0xF4, 0xB9, 0xF4, 0xF7, 0xF4, 0x83, 0xF5, 0x4B, 0xF6,
-	0xFC, 0xF6, 0x53, 0xF7, 0x25, 0xF7, 0xCD, 0xF6, 0x6C, 0xF6, 0x99, 0xF5,
-	0x45, 0xF4, 0xFC, 0xF2, 0x11, 0xF2, 0x31, 0xF1, 0x50, 0xF0, 0x1A, 0xF0,
-	0x9D, 0xF0, 0xC4, 0xF0, 0x7E, 0xEF, 0xBC, 0xED, 0x78, 0xEC, 0x9A, 0xEB,
-	0xCE, 0xE9, 0x31, 0xE7, 0xC0, 0xE4, 0x76, 0xE3, 0xC0, 0xE2, 0xAE, 0xE1,
-	0x09, 0xE0, 0xD3, 0xDE, 0x6D, 0xDE, 0x07, 0xDE, 0x0A, 0xDD, 0x60, 0xDB,
-	0xB1, 0xD9, 0x79, 0xD8, 0x43, 0xD7, 0xD2, 0xD5, 0x1B, 0xD4, 0xE3, 0xD2,
-	0x52, 0xD2, 0xA2, 0xD1, 0x8E, 0xD0, 0xC8, 0xD0, 0x65, 0xD3, 0x94, 0xD7,
-	0x54, 0xDC, 0xD3, 0xE0, 0xE0, 0xE4, 0x44, 0xE9, 0xB9, 0xED, 0xC9, 0xF0,
-	0xDD, 0xF1, 0x21, 0xF2, 0x84, 0xF3, 0x21, 0xF6, 0x3C, 0xF8, 0xA1, 0xF9,
-	0x04, 0xFC, 0x30, 0xFF, 0xED, 0x01, 0x9B, 0x03, 0x73, 0x04, 0x09, 0x05,
-	0x6E, 0x05, 0xC0, 0x05, 0x63, 0x06, 0x20, 0x07, 0x13, 0x08, 0xE0, 0x09,
-	0x40, 0x0B, 0x29, 0x0B, 0xAD, 0x0A, 0xC0, 0x0B, 0x06, 0x0E, 0x2F, 0x0F,
-	0x5B, 0x10, 0x55, 0x13, 0x1F, 0x17, 0xFD, 0x1A, 0x92, 0x1E, 0x1A, 0x21,
-	0x03, 0x22, 0x16, 0x22, 0xF5, 0x21, 0x43, 0x21, 0xFC, 0x1F, 0xBC, 0x1E,
-	0x2A, 0x1E, 0xC3, 0x1D, 0x55, 0x1D, 0x2B, 0x1D, 0xE3, 0x1C, 0x91, 0x1B,
-	0x83, 0x19, 0xBC, 0x17, 0xBE, 0x15, 0x19, 0x13, 0xA7, 0x10, 0xD0, 0x0E,
-	0x26, 0x0D, 0xA8, 0x0B, 0xAA, 0x0A, 0x9A, 0x09, 0xF2, 0x07, 0x45, 0x06,
-	0x09, 0x05, 0x1C, 0x04, 0x7E, 0x03, 0x2B, 0x03, 0x55, 0x03, 0x90, 0x03,
-	0xA3, 0x03, 0x36, 0x03, 0x5A, 0x02, 0x28, 0x01, 0x69, 0xFF, 0x14, 0xFD,
-	0x73, 0xFA, 0x02, 0xF8, 0x69, 0xF6, 0x5B, 0xF5, 0x21, 0xF4, 0xD6, 0xF2,
-	0x0F, 0xF2, 0xAA, 0xF1, 0x2C, 0xF1, 0x1E, 0xF0, 0xAC, 0xEE, 0x98, 0xED,
-	0x4F, 0xED, 0x19, 0xED, 0x79, 0xEC, 0x4F, 0xEC, 0x48, 0xED, 0x09, 0xEF,
-	0x5A, 0xF0, 0xE2, 0xF0, 0xC9, 0xF1, 0xAC, 0xF3, 0x94, 0xF5, 0xE5, 0xF6,
-	0x46, 0xF8, 0x65, 0xFA, 0xB0, 0xFC, 0x91, 0xFE, 0x0B, 0x00, 0x46, 0x01,
-	0x3F, 0x02, 0xE8, 0x02, 0x5D, 0x03, 0xDD, 0x03, 0xB3, 0x04, 0x81, 0x05,
-	0x61, 0x06, 0xD7, 0x07, 0x3E, 0x0A, 0xBA, 0x0C, 0x6A, 0x0E, 0x44, 0x0F,
-	0x8C, 0x10, 0x53, 0x12, 0x82, 0x13, 0xB5, 0x13, 0x37, 0x14, 0xEA, 0x15,
-	0x14, 0x18, 0xD9, 0x19, 0xAA, 0x1C, 0xA5, 0x21, 0xF8, 0x26, 0xBB, 0x29,
-	0xB3, 0x29, 0xD0, 0x29, 0x6E, 0x2B, 0x16, 0x2C, 0xEA, 0x29, 0x67, 0x27,
-	0xB4, 0x27, 0xB3, 0x29, 0xA6, 0x29, 0x4A, 0x27, 0x58, 0x25, 0xB7, 0x24,
-	0x20, 0x23, 0x5D, 0x1F, 0x9D, 0x1B, 0x8A, 0x19, 0xBF, 0x17, 0x2B, 0x15,
-	0xD4, 0x12, 0xDF, 0x11, 0x3A, 0x11, 0x1F, 0x0F, 0x81, 0x0B, 0x2E, 0x08,
-	0x28, 0x06, 0x06, 0x05, 0xEB, 0x03, 0xF4, 0x02, 0xDC, 0x02, 0xAD, 0x03,
-	0xB8, 0x04, 0xCC, 0x04, 0xDA, 0x03, 0x22, 0x02, 0xC9, 0xFF, 0x07, 0xFD,
-	0x97, 0xFA, 0x01, 0xF9, 0x5C, 0xF8, 0xE0, 0xF7, 0x21, 0xF7, 0x35, 0xF6,
-	0x8E, 0xF5, 0xE3, 0xF4, 0x88, 0xF3, 0x69, 0xF1, 0xA4, 0xEF, 0xE1, 0xEE,
-	0xBE, 0xEE, 0x63, 0xEE, 0x0E, 0xEE, 0x3A, 0xEE, 0xFE, 0xEE, 0xE4, 0xEF,
-	0x71, 0xF0, 0x75, 0xF0, 0xE1, 0xEF, 0x99, 0xEF, 0x1C, 0xF0, 0x3E, 0xF1,
-	0x92, 0xF2, 0xD0, 0xF3, 0x26, 0xF5, 0x4E, 0xF6, 0xB5, 0xF6, 0x4C, 0xF6,
-	0x4D, 0xF5, 0x12, 0xF4, 0x91, 0xF2, 0xCD, 0xF0, 0x9E, 0xEF, 0x75, 0xEF,
-	0x8A, 0xEF, 0xC9, 0xEE, 0x39, 0xED, 0x90, 0xEB, 0x93, 0xE9, 0xCF, 0xE6,
-	0x83, 0xE3, 0xDE, 0xE0, 0x06, 0xDF, 0x69, 0xDD, 0xD6, 0xDB, 0x10, 0xDB,
-	0xF9, 0xDA, 0x95, 0xDA, 0xB1, 0xD9, 0xCB, 0xD8, 0x31, 0xD8, 0xC9, 0xD6,
-	0x87, 0xD4, 0x9B, 0xD2, 0x0C, 0xD2, 0x5C, 0xD2, 0x19, 0xD2, 0x8E, 0xD1,
-	0x00, 0xD2, 0xBC, 0xD3, 0xE6, 0xD5, 0x10, 0xD9, 0x17, 0xDE, 0xA9, 0xE3,
-	0x80, 0xE7, 0x62, 0xEA, 0xAE, 0xEE, 0x7F, 0xF3, 0x67, 0xF5, 0xCE, 0xF4,
-	0xB4, 0xF5, 0x2D, 0xF9, 0xF8, 0xFB, 0x84, 0xFC, 0xA7, 0xFD, 0x31, 0x01,
-	0xDC, 0x04, 0x32, 0x06, 0x14, 0x06, 0xB8, 0x06, 0x08, 0x08, 0x64, 0x08,
-	0x9E, 0x07, 0xE5, 0x07, 0x3E, 0x0A, 0x76, 0x0C, 0xD4, 0x0B, 0x0F, 0x0A,
-	0xBD, 0x0A, 0x12, 0x0D, 0x21, 0x0E, 0x08, 0x0E, 0x96, 0x0F, 0x2D, 0x13,
-	0x2A, 0x17, 0x8E, 0x1A, 0x69, 0x1D, 0xD5, 0x1F, 0x31, 0x21, 0xFB, 0x20,
-	0xE0, 0x1F, 0xE8, 0x1E, 0xB1, 0x1E, 0x98, 0x1E, 0xE9, 0x1D, 0x1B, 0x1D,
-	0x43, 0x1D, 0xE6, 0x1D, 0x3A, 0x1D, 0xD2, 0x1A, 0x10, 0x18, 0x4E, 0x16,
-	0x9E, 0x14, 0xD8, 0x11, 0xCA, 0x0E, 0x9D, 0x0C, 0x4A, 0x0B, 0xBD, 0x09,
-	0x0D, 0x08, 0x17, 0x06, 0x1D, 0x04, 0x29, 0x02, 0x67, 0x00, 0x81, 0xFF,
-	0x82, 0xFF, 0xE4, 0xFF, 0x06, 0x00, 0x28, 0x00, 0x19, 0x00, 0xCE, 0xFF,
-	0x3F, 0xFF, 0x43, 0xFE, 0xF2, 0xFC, 0x18, 0xFB, 0x2A, 0xF9, 0xF7, 0xF7,
-	0xD9, 0xF7, 0xA2, 0xF7, 0x86, 0xF6, 0x21, 0xF5, 0xB6, 0xF4, 0xB4, 0xF4,
-	0xD2, 0xF3, 0x11, 0xF2, 0xBC, 0xF0, 0x8B, 0xF0, 0x6A, 0xF0, 0xB8, 0xEF,
-	0x22, 0xEF, 0x63, 0xEF, 0x43, 0xF0, 0x05, 0xF1, 0xA0, 0xF1, 0xBB, 0xF2,
-	0x5D, 0xF4, 0xD0, 0xF5, 0x36, 0xF7, 0x09, 0xF9, 0x41, 0xFB, 0xA9, 0xFD,
-	0xDF, 0xFF, 0xA1, 0x01, 0xFB, 0x02, 0x72, 0x04, 0x19, 0x06, 0x83, 0x07,
-	0x43, 0x08, 0xAD, 0x08, 0x86, 0x09, 0xDD, 0x0A, 0x56, 0x0C, 0xD7, 0x0D,
-	0xAF, 0x0F, 0x91, 0x11, 0xF6, 0x12, 0x99, 0x13, 0xFB, 0x13, 0xA4, 0x14,
-	0x3F, 0x15, 0x0E, 0x15, 0x31, 0x15, 0x59, 0x17, 0x75, 0x1B, 0x1A, 0x1F,
-	0x0B, 0x21, 0x4F, 0x22, 0x87, 0x24, 0x7B, 0x26, 0x74, 0x26, 0x13, 0x25,
-	0xD8, 0x24, 0x4D, 0x26, 0x19, 0x28, 0xD3, 0x28, 0xF3, 0x28, 0x77, 0x29,
-	0xBF, 0x29, 0x64, 0x28, 0xA3, 0x25, 0x01, 0x23, 0xB8, 0x20, 0x10, 0x1E,
-	0x13, 0x1B, 0xB7, 0x18, 0xAC, 0x17, 0xD1, 0x16, 0xBA, 0x14, 0x83, 0x11,
-	0x63, 0x0E, 0x73, 0x0B, 0x57, 0x08, 0x55, 0x05, 0xFC, 0x02, 0xA8, 0x01,
-	0xF1, 0x00, 0x95, 0x00, 0x7F, 0x00, 0x32, 0x00, 0xF1, 0xFE, 0x0C, 0xFD,
-	0x2C, 0xFB, 0xC8, 0xF9, 0xAD, 0xF8, 0xEC, 0xF7, 0xB7, 0xF7, 0xE6, 0xF7,
-	0x24, 0xF8, 0x63, 0xF8, 0x53, 0xF8, 0x7D, 0xF7, 0xD6, 0xF5, 0x30, 0xF4,
-	0x03, 0xF3, 0x01, 0xF2, 0xDD, 0xF0, 0xFB, 0xEF, 0xCC, 0xEF, 0x52, 0xF0,
-	0x18, 0xF1, 0x45, 0xF1, 0x89, 0xF0, 0xA2, 0xEF, 0xBF, 0xEE, 0xCA, 0xED,
-	0xD4, 0xEC, 0xB6, 0xEC, 0x65, 0xED, 0x5D, 0xEE, 0x13, 0xEF, 0xD3, 0xEF,
-	0x67, 0xF0, 0x7B, 0xF0, 0xE5, 0xEF, 0x00, 0xEF, 0xE1, 0xED, 0x3B, 0xED,
-	0x32, 0xED, 0x5D, 0xED, 0xD0, 0xEC, 0xA5, 0xEB, 0x65, 0xEA, 0x58, 0xE9,
-	0x9C, 0xE7, 0xD0, 0xE4, 0x9C, 0xE1, 0xD8, 0xDE, 0xF6, 0xDC, 0xB5, 0xDB,
-	0x63, 0xDA, 0x1B, 0xD9, 0x14, 0xD8, 0x3D, 0xD7, 0x35, 0xD6, 0xE5, 0xD4,
-	0x3D, 0xD3, 0xB6, 0xD0, 0x22, 0xCE, 0xC3, 0xCC, 0xB4, 0xCC, 0xD1, 0xCC,
-	0x2C, 0xCD, 0x45, 0xCF, 0x4F, 0xD4, 0xC4, 0xDA, 0xA0, 0xE0, 0x88, 0xE5,
-	0x46, 0xEA, 0x26, 0xEF, 0x94, 0xF3, 0x37, 0xF6, 0xBE, 0xF7, 0x3A, 0xFA,
-	0xAE, 0xFD, 0x95, 0x00, 0xE0, 0x02, 0xCB, 0x05, 0x4E, 0x09, 0x0D, 0x0C,
-	0xEA, 0x0C, 0xC4, 0x0C, 0x7A, 0x0C, 0x25, 0x0C, 0xBE, 0x0B, 0x68, 0x0B,
-	0xD3, 0x0A, 0xE9, 0x0A, 0x94, 0x0B, 0xC9, 0x0B, 0xAC, 0x0A, 0x38, 0x09,
-	0x0A, 0x08, 0x8F, 0x07, 0x14, 0x08, 0xCC, 0x09, 0x2C, 0x0C, 0xC7, 0x0F,
-	0x28, 0x14, 0xA9, 0x18, 0xE1, 0x1B, 0x8E, 0x1D, 0xF5, 0x1D, 0xC2, 0x1D,
-	0x1A, 0x1D, 0x11, 0x1D, 0xBD, 0x1D, 0x58, 0x1E, 0xA8, 0x1E, 0x99, 0x1F,
-	0x3F, 0x20, 0xD8, 0x1F, 0x3A, 0x1E, 0xDE, 0x1B, 0xB3, 0x18, 0x33, 0x15,
-	0x9F, 0x11, 0x12, 0x0E, 0xDF, 0x0A, 0x54, 0x08, 0xF5, 0x05, 0x66, 0x03,
-	0x68, 0x00, 0xA0, 0xFD, 0x1F, 0xFB, 0xAF, 0xF8, 0xA3, 0xF6, 0x72, 0xF5,
-	0x75, 0xF5, 0x8D, 0xF6, 0x16, 0xF8, 0xE9, 0xF8, 0x51, 0xF9, 0xCE, 0xF9,
-	0x60, 0xFA, 0x17, 0xFA, 0x2A, 0xF9, 0x26, 0xF8, 0x4D, 0xF8, 0x48, 0xF9,
-	0x5A, 0xFA, 0x15, 0xFB, 0x79, 0xFB, 0xAE, 0xFB, 0xCF, 0xFB, 0x7E, 0xFB,
-	0x44, 0xFA, 0x96, 0xF8, 0x22, 0xF7, 0xFA, 0xF5, 0xFB, 0xF4, 0x05, 0xF4,
-	0x68, 0xF3, 0x85, 0xF3, 0xFE, 0xF3, 0x22, 0xF4, 0xD6, 0xF3, 0x0B, 0xF4,
-	0x20, 0xF5, 0xA1, 0xF6, 0xE5, 0xF7, 0x53, 0xF9, 0xD2, 0xFB, 0x51, 0xFF,
-	0x60, 0x02, 0x7E, 0x04, 0x5E, 0x06, 0x8D, 0x08, 0x82, 0x0A, 0x34, 0x0C,
-	0x7E, 0x0D, 0xDB, 0x0E, 0x9D, 0x10, 0xF0, 0x12, 0x30, 0x15, 0xD0, 0x16,
-	0x07, 0x18, 0x2B, 0x19, 0xB6, 0x19, 0x0F, 0x19, 0x13, 0x18, 0xBD, 0x17,
-	0x04, 0x18, 0xA1, 0x18, 0x31, 0x19, 0xD4, 0x19, 0x55, 0x1B, 0xB0, 0x1D,
-	0x5D, 0x1F, 0x5D, 0x1F, 0xE2, 0x1E, 0x7A, 0x1F, 0xEB, 0x20, 0xB4, 0x21,
-	0xE8, 0x21, 0xD6, 0x22, 0xCB, 0x24, 0x4C, 0x26, 0x70, 0x26, 0xAC, 0x25,
-	0xED, 0x24, 0xD5, 0x23, 0xC9, 0x21, 0x51, 0x1F, 0xA5, 0x1D, 0xE6, 0x1C,
-	0xB2, 0x1B, 0x4F, 0x19, 0xD5, 0x16, 0x0D, 0x15, 0xA8, 0x12, 0xAC, 0x0E,
-	0x24, 0x0A, 0xA3, 0x06, 0x30, 0x04, 0xA2, 0x01, 0x2C, 0xFF, 0x83, 0xFD,
-	0xA4, 0xFC, 0xB9, 0xFB, 0x39, 0xFA, 0xAE, 0xF8, 0x80, 0xF7, 0x79, 0xF6,
-	0x48, 0xF5, 0x04, 0xF4, 0x87, 0xF3, 0x6E, 0xF4, 0x76, 0xF5, 0xCF, 0xF5,
-	0xC0, 0xF5, 0x0E, 0xF6, 0x78, 0xF6, 0x40, 0xF6, 0x3A, 0xF5, 0x36, 0xF4,
-	0xF5, 0xF3, 0x51, 0xF4, 0x94, 0xF4, 0x59, 0xF4, 0xF6, 0xF3, 0xA0, 0xF3,
-	0x0A, 0xF3, 0x8E, 0xF1, 0x87, 0xEF, 0xB5, 0xED, 0x42, 0xEC, 0x07, 0xEB,
-	0xEE, 0xE9, 0x57, 0xE9, 0xFD, 0xE8, 0x65, 0xE8, 0x8B, 0xE7, 0xC6, 0xE6,
-	0xC5, 0xE5, 0x79, 0xE4, 0x1E, 0xE3, 0x1A, 0xE2, 0xE3, 0xE0, 0x68, 0xDF,
-	0x5A, 0xDE, 0xFD, 0xDD, 0x92, 0xDD, 0x55, 0xDC, 0xD0, 0xDA, 0xDD, 0xD9,
-	0x3F, 0xD9, 0x1E, 0xD8, 0x85, 0xD6, 0x50, 0xD5, 0xD0, 0xD4, 0x3B, 0xD4,
-	0x13, 0xD3, 0x7E, 0xD1, 0x01, 0xD0, 0x15, 0xCF, 0x63, 0xCE, 0xC2, 0xCD,
-	0x75, 0xCD, 0x64, 0xCE, 0x1A, 0xD2, 0x08, 0xD8, 0xEE, 0xDD, 0xCE, 0xE2,
-	0x5A, 0xE7, 0x63, 0xEC, 0x7F, 0xF1, 0xE1, 0xF4, 0x99, 0xF6, 0x66, 0xF9,
-	0x88, 0xFD, 0x44, 0x01, 0x6A, 0x04, 0x1A, 0x08, 0xFD, 0x0C, 0xAF, 0x11,
-	0xED, 0x13, 0x9C, 0x14, 0xA4, 0x15, 0x95, 0x16, 0xEA, 0x15, 0x9A, 0x14,
-	0x06, 0x14, 0x83, 0x14, 0x29, 0x15, 0x83, 0x14, 0x67, 0x12, 0x48, 0x10,
-	0xBE, 0x0E, 0x77, 0x0D, 0x25, 0x0C, 0x43, 0x0B, 0xFA, 0x0B, 0x46, 0x0E,
-	0xDA, 0x10, 0x35, 0x13, 0xB5, 0x15, 0x5F, 0x17, 0x59, 0x17, 0x74, 0x16,
-	0xB2, 0x15, 0xF8, 0x15, 0xE7, 0x16, 0x7E, 0x17, 0xD9, 0x17, 0x62, 0x19,
-	0x9A, 0x1B, 0xCB, 0x1C, 0x18, 0x1C, 0x67, 0x1A, 0xCB, 0x18, 0xB1, 0x16,
-	0x31, 0x13, 0x49, 0x0F, 0x80, 0x0C, 0x33, 0x0A, 0x67, 0x07, 0x49, 0x04,
-	0x4E, 0x01, 0x57, 0xFE, 0xF9, 0xFA, 0x15, 0xF7, 0x5B, 0xF3, 0xC0, 0xF0,
-	0xA2, 0xEF, 0x5B, 0xEF, 0xED, 0xEE, 0x6B, 0xEE, 0x5D, 0xEE, 0xED, 0xEE,
-	0x5E, 0xEF, 0x36, 0xEF, 0x78, 0xEE, 0x01, 0xEE, 0xEC, 0xEE, 0x2E, 0xF1,
-	0x4E, 0xF3, 0x3C, 0xF5, 0x99, 0xF7, 0x4F, 0xFA, 0x60, 0xFC, 0x81, 0xFD,
-	0x1B, 0xFE, 0xB3, 0xFE, 0xD5, 0xFE, 0x3F, 0xFE, 0xE2, 0xFD, 0x11, 0xFE,
-	0x5B, 0xFE, 0xC2, 0xFE, 0x06, 0xFF, 0xEB, 0xFE, 0xCD, 0xFE, 0x9D, 0xFE,
-	0x29, 0xFE, 0xF6, 0xFD, 0x0D, 0xFE, 0x7F, 0xFE, 0x85, 0xFF, 0x5B, 0x01,
-	0x6B, 0x03, 0xE4, 0x04, 0xAF, 0x05, 0xE3, 0x06, 0x19, 0x09, 0xEC, 0x0A,
-	0xDB, 0x0B, 0x41, 0x0D, 0x21, 0x10, 0xD1, 0x13, 0x57, 0x17, 0x81, 0x1A,
-	0x8D, 0x1D, 0x88, 0x20, 0xE0, 0x22, 0xFF, 0x23, 0x35, 0x24, 0x74, 0x24,
-	0xBE, 0x24, 0x8A, 0x24, 0x26, 0x24, 0x89, 0x24, 0xD8, 0x25, 0xD3, 0x26,
-	0xC4, 0x26, 0x19, 0x26, 0x07, 0x25, 0x48, 0x23, 0xF2, 0x20, 0xAA, 0x1E,
-	0x0A, 0x1D, 0xEA, 0x1B, 0xC6, 0x1A, 0xC0, 0x19, 0xEB, 0x18, 0x09, 0x18,
-	0x83, 0x16, 0x87, 0x14, 0xD6, 0x12, 0xBA, 0x11, 0xD9, 0x10, 0xDB, 0x0F,
-	0x72, 0x0F, 0xB6, 0x0F, 0xEA, 0x0F, 0x8D, 0x0F, 0x85, 0x0E, 0xE8, 0x0C,
-	0xCE, 0x0A, 0x8A, 0x08, 0xAD, 0x06, 0x21, 0x05, 0xCA, 0x03, 0xD0, 0x02,
-	0x52, 0x02, 0xD1, 0x01, 0xDA, 0x00, 0x4B, 0xFF, 0x62, 0xFD, 0x1C, 0xFB,
-	0x57, 0xF8, 0xB0, 0xF5, 0xBB, 0xF3, 0xD3, 0xF2, 0x67, 0xF2, 0xFF, 0xF1,
-	0x76, 0xF1, 0x44, 0xF1, 0xFE, 0xF0, 0x58, 0xF0, 0x65, 0xEF, 0xB7, 0xEE,
-	0x8B, 0xEE, 0x8E, 0xEE, 0xEB, 0xEE, 0x7C, 0xEF, 0x0A, 0xF0, 0x8E, 0xF0,
-	0xF6, 0xF0, 0xFC, 0xF0, 0x59, 0xF0, 0x74, 0xEF, 0x9E, 0xEE, 0xEB, 0xED,
-	0x17, 0xED, 0x4B, 0xEC, 0xCD, 0xEB, 0x74, 0xEB, 0xCC, 0xEA, 0x70, 0xE9,
-	0x96, 0xE7, 0x6F, 0xE5, 0xDC, 0xE2, 0x56, 0xDF, 0x04, 0xDB, 0x93, 0xD7,
-	0x34, 0xD6, 0xC4, 0xD5, 0x6D, 0xD4, 0x10, 0xD2, 0x8E, 0xD0, 0xF4, 0xCF,
-	0x80, 0xCE, 0xA1, 0xCB, 0x3C, 0xC9, 0x59, 0xC8, 0x0B, 0xC8, 0x38, 0xC7,
-	0xB8, 0xC6, 0x3E, 0xC8, 0xE7, 0xCA, 0xDC, 0xCC, 0x04, 0xCF, 0x77, 0xD3,
-	0x26, 0xDA, 0x77, 0xE0, 0xD8, 0xE4, 0x5C, 0xE9, 0x32, 0xF0, 0x5A, 0xF7,
-	0x9F, 0xFB, 0x04, 0xFE, 0x9E, 0x01, 0x4D, 0x06, 0xA8, 0x09, 0x69, 0x0B,
-	0xE4, 0x0D, 0x62, 0x12, 0x44, 0x16, 0xA7, 0x17, 0x2F, 0x18, 0xE6, 0x19,
-	0x05, 0x1B, 0x6E, 0x19, 0x76, 0x16, 0x20, 0x15, 0x5A, 0x15, 0x92, 0x14,
-	0x4E, 0x12, 0x82, 0x10, 0xF4, 0x0F, 0x63, 0x0F, 0xE7, 0x0D, 0xE9, 0x0C,
-	0x53, 0x0D, 0x91, 0x0E, 0xDC, 0x0F, 0x8A, 0x11, 0xDF, 0x13, 0x08, 0x16,
-	0xFF, 0x16, 0x52, 0x17, 0x97, 0x17, 0x2D, 0x18, 0xA3, 0x18, 0x2C, 0x19,
-	0x91, 0x19, 0x1C, 0x1A, 0xC2, 0x1A, 0x62, 0x1B, 0xD6, 0x1B, 0x53, 0x1B,
-	0x6F, 0x19, 0xFE, 0x16, 0xC4, 0x14, 0xFA, 0x11, 0x2D, 0x0E, 0x0F, 0x0A,
-	0x8D, 0x06, 0x6A, 0x03, 0xDB, 0xFF, 0x48, 0xFC, 0x28, 0xF9, 0x15, 0xF6,
-	0xC1, 0xF2, 0xDA, 0xEF, 0xDA, 0xED, 0x95, 0xEC, 0x97, 0xEB, 0xD0, 0xEA,
-	0x16, 0xEA, 0xE3, 0xE9, 0x13, 0xEA, 0x36, 0xEA, 0x49, 0xEA, 0xBF, 0xEA,
-	0x0A, 0xEC, 0xF9, 0xED, 0xF6, 0xEF, 0x14, 0xF2, 0x5E, 0xF4, 0x87, 0xF6,
-	0xA4, 0xF8, 0xB9, 0xFA, 0x9F, 0xFC, 0xFC, 0xFD, 0xEC, 0xFE, 0xAE, 0xFF,
-	0x0E, 0x00, 0x39, 0x00, 0x87, 0x00, 0xC4, 0x00, 0xA9, 0x00, 0x7B, 0x00,
-	0xE0, 0x00, 0x5E, 0x01, 0x56, 0x01, 0x32, 0x01, 0x77, 0x01, 0x02, 0x02,
-	0x60, 0x02, 0xB1, 0x02, 0x7F, 0x03, 0xAD, 0x04, 0x06, 0x06, 0x14, 0x07,
-	0x50, 0x08, 0x2E, 0x0A, 0x79, 0x0C, 0x90, 0x0E, 0x4D, 0x10, 0x69, 0x12,
-	0x01, 0x15, 0x3B, 0x17, 0x04, 0x19, 0xFE, 0x1A, 0x19, 0x1D, 0x9E, 0x1E,
-	0xC6, 0x1F, 0x89, 0x21, 0x35, 0x24, 0x98, 0x26, 0xCF, 0x27, 0xB2, 0x28,
-	0x00, 0x2A, 0xA6, 0x2B, 0x2E, 0x2C, 0x3C, 0x2B, 0x12, 0x2A, 0x8D, 0x29,
-	0x00, 0x29, 0x66, 0x27, 0xA2, 0x25, 0xB1, 0x24, 0x1B, 0x24, 0x74, 0x22,
-	0x35, 0x20, 0x4D, 0x1E, 0x7D, 0x1C, 0xF1, 0x19, 0xCE, 0x16, 0x02, 0x14,
-	0x47, 0x12, 0xCA, 0x10, 0x86, 0x0E, 0xF1, 0x0B, 0x0E, 0x0A, 0xC8, 0x08,
-	0x0D, 0x07, 0xED, 0x04, 0x52, 0x03, 0x81, 0x02, 0xAF, 0x01, 0xA5, 0x00,
-	0x3A, 0x00, 0x21, 0x00, 0x9B, 0xFF, 0x76, 0xFE, 0x49, 0xFD, 0x56, 0xFC,
-	0x6D, 0xFB, 0x52, 0xFA, 0x12, 0xF9, 0x0F, 0xF8, 0x91, 0xF7, 0x69, 0xF7,
-	0x14, 0xF7, 0x64, 0xF6, 0xB3, 0xF5, 0xC5, 0xF4, 0x61, 0xF3, 0xAB, 0xF1,
-	0x01, 0xF0, 0xA1, 0xEE, 0x89, 0xED, 0xC4, 0xEC, 0x38, 0xEC, 0xAA, 0xEB,
-	0xF8, 0xEA, 0x26, 0xEA, 0x0C, 0xE9, 0x8C, 0xE7, 0x16, 0xE6, 0xCC, 0xE4,
-	0xAC, 0xE3, 0x46, 0xE2, 0xFD, 0xE0, 0x08, 0xE0, 0x2D, 0xDF, 0xAD, 0xDD,
-	0x3B, 0xDB, 0x66, 0xD8, 0xB3, 0xD5, 0x35, 0xD3, 0x01, 0xD1, 0x5E, 0xCF,
-	0x2C, 0xCE, 0xBF, 0xCC, 0xE1, 0xCA, 0x74, 0xC9, 0xE2, 0xC8, 0xB9, 0xC7,
-	0x22, 0xC5, 0x6E, 0xC2, 0x63, 0xC1, 0x90, 0xC1, 0x70, 0xC1, 0x94, 0xC1,
-	0xE6, 0xC3, 0x54, 0xC8, 0x6E, 0xCD, 0x09, 0xD3, 0x3C, 0xD9, 0xA3, 0xDF,
-	0x14, 0xE5, 0x5D, 0xEA, 0x13, 0xF0, 0xBB, 0xF5, 0x6D, 0xFA, 0xC9, 0xFE,
-	0x12, 0x04, 0xF0, 0x09, 0xE8, 0x0E, 0xA6, 0x12, 0x5A, 0x17, 0x47, 0x1C,
-	0x48, 0x1F, 0x18, 0x20, 0x09, 0x21, 0xE1, 0x22, 0xB3, 0x23, 0x36, 0x22,
-	0x8F, 0x20, 0x81, 0x20, 0x81, 0x20, 0x99, 0x1E, 0x39, 0x1B, 0x5E, 0x18,
-	0x87, 0x16, 0x7E, 0x14, 0x1C, 0x12, 0xDB, 0x10, 0x49, 0x11, 0xF5, 0x11,
-	0x2F, 0x12, 0xEF, 0x12, 0x09, 0x14, 0x1D, 0x14, 0xDF, 0x12, 0x93, 0x11,
-	0x7C, 0x11, 0xF5, 0x11, 0x2F, 0x12, 0xC9, 0x12, 0x1E, 0x14, 0xEC, 0x15,
-	0x66, 0x17, 0xCD, 0x17, 0x59, 0x17, 0xB8, 0x16, 0x79, 0x15, 0x15, 0x13,
-	0x03, 0x10, 0x76, 0x0D, 0x82, 0x0B, 0x0C, 0x09, 0xDB, 0x05, 0xA4, 0x02,
-	0xAF, 0xFF, 0x49, 0xFC, 0x59, 0xF8, 0x24, 0xF4, 0x4A, 0xF0, 0x6D, 0xED,
-	0x85, 0xEB, 0xCE, 0xE9, 0xC3, 0xE7, 0x68, 0xE6, 0x9E, 0xE5, 0xB7, 0xE4,
-	0x71, 0xE3, 0x72, 0xE2, 0x2D, 0xE2, 0x8E, 0xE2, 0xAA, 0xE3, 0xA5, 0xE5,
-	0x5C, 0xE8, 0x7F, 0xEB, 0xEF, 0xEE, 0xF5, 0xF1, 0xAA, 0xF4, 0x8A, 0xF7,
-	0x34, 0xFA, 0x06, 0xFC, 0x83, 0xFD, 0x96, 0xFF, 0x4A, 0x02, 0x7B, 0x04,
-	0x0A, 0x06, 0xF3, 0x07, 0xF2, 0x09, 0x0E, 0x0B, 0x6A, 0x0B, 0x7F, 0x0B,
-	0x7D, 0x0B, 0x65, 0x0B, 0x22, 0x0B, 0x0F, 0x0B, 0x4E, 0x0B, 0xC7, 0x0B,
-	0xEA, 0x0B, 0x8C, 0x0B, 0x71, 0x0B, 0xF9, 0x0B, 0xBC, 0x0C, 0x71, 0x0D,
-	0xD1, 0x0E, 0x0A, 0x11, 0x89, 0x13, 0xC6, 0x15, 0x1A, 0x18, 0xA2, 0x1A,
-	0xD5, 0x1C, 0x9D, 0x1E, 0x04, 0x20, 0x8F, 0x21, 0x80, 0x23, 0x95, 0x25,
-	0x68, 0x27, 0x00, 0x29, 0xBC, 0x2A, 0x4D, 0x2C, 0xAF, 0x2C, 0xAD, 0x2B,
-	0x73, 0x2A, 0x76, 0x29, 0x0E, 0x28, 0xC2, 0x25, 0x36, 0x23, 0x4D, 0x21,
-	0xC2, 0x1F, 0x99, 0x1D, 0xB4, 0x1A, 0xF6, 0x17, 0x8D, 0x15, 0xC2, 0x12,
-	0xB3, 0x0F, 0x1B, 0x0D, 0x47, 0x0B, 0xC1, 0x09, 0x2E, 0x08, 0xCE, 0x06,
-	0xAC, 0x05, 0xBC, 0x04, 0xBC, 0x03, 0xCD, 0x02, 0x10, 0x02, 0xB9, 0x01,
-	0x82, 0x01, 0x55, 0x01, 0xA0, 0x01, 0x4A, 0x02, 0xA6, 0x02, 0xB5, 0x02,
-	0xBB, 0x02, 0x78, 0x02, 0x77, 0x01, 0x3F, 0x00, 0x1A, 0xFF, 0x26, 0xFE,
-	0xE5, 0xFC, 0xBD, 0xFB, 0xA3, 0xFA, 0x83, 0xF9, 0x19, 0xF8, 0xB7, 0xF6,
-	0x10, 0xF5, 0x29, 0xF3, 0xFC, 0xF0, 0xC3, 0xEE, 0xBB, 0xEC, 0xF3, 0xEA,
-	0x83, 0xE9, 0x38, 0xE8, 0x0D, 0xE7, 0x2B, 0xE6, 0x33, 0xE5, 0xAF, 0xE3,
-	0xF7, 0xE1, 0xA2, 0xE0, 0xDA, 0xDF, 0x0C, 0xDF, 0x3E, 0xDE, 0x4E, 0xDD,
-	0x54, 0xDC, 0x08, 0xDB, 0xAB, 0xD9, 0xF9, 0xD7, 0xC4, 0xD5, 0x71, 0xD3,
-	0x64, 0xD1, 0x6A, 0xCF, 0x63, 0xCD, 0x74, 0xCB, 0xE3, 0xC9, 0xB0, 0xC8,
-	0x05, 0xC7, 0x0B, 0xC5, 0x80, 0xC3, 0x75, 0xC2, 0xDD, 0xC1, 0x5B, 0xC1,
-	0x85, 0xC1, 0xB3, 0xC3, 0x6D, 0xC8, 0x27, 0xCE, 0x57, 0xD3, 0x82, 0xD8,
-	0x2E, 0xDE, 0x2E, 0xE4, 0x58, 0xE9, 0x95, 0xED, 0x35, 0xF2, 0xB8, 0xF7,
-	0x7E, 0xFD, 0xA1, 0x03, 0xF8, 0x09, 0x3A, 0x10, 0x3B, 0x16, 0x6A, 0x1B,
-	0xC6, 0x1E, 0x4E, 0x21, 0x95, 0x23, 0xCB, 0x24, 0x0F, 0x25, 0x50, 0x25,
-	0xEB, 0x25, 0x5E, 0x26, 0x05, 0x26, 0x95, 0x24, 0xBA, 0x22, 0x2E, 0x20,
-	0xF7, 0x1C, 0x1B, 0x1A, 0x89, 0x17, 0x9C, 0x15, 0xAD, 0x14, 0x21, 0x14,
-	0x93, 0x13, 0x86, 0x13, 0x63, 0x13, 0x01, 0x12, 0xA9, 0x0F, 0xBA, 0x0D,
-	0x0E, 0x0D, 0x1C, 0x0D, 0x31, 0x0D, 0xBA, 0x0D, 0x72, 0x0F, 0xA6, 0x11,
-	0x46, 0x13, 0x07, 0x14, 0xE8, 0x13, 0x7C, 0x13, 0xC8, 0x12, 0x42, 0x11,
-	0x3C, 0x0F, 0xBA, 0x0D, 0xC0, 0x0C, 0x41, 0x0B, 0xFF, 0x08, 0xAB, 0x06,
-	0x9F, 0x04, 0xD5, 0x01, 0xDE, 0xFD, 0xB9, 0xF9, 0x3B, 0xF6, 0x1C, 0xF3,
-	0x33, 0xF0, 0xC2, 0xED, 0x6E, 0xEB, 0x42, 0xE9, 0x80, 0xE7, 0xD9, 0xE5,
-	0xFA, 0xE3, 0x13, 0xE2, 0xFD, 0xE0, 0xBB, 0xE0, 0xDD, 0xE0, 0x0C, 0xE2,
-	0x77, 0xE4, 0x28, 0xE7, 0xC5, 0xE9, 0x93, 0xEC, 0xA6, 0xEF, 0xA9, 0xF2,
-	0x89, 0xF5, 0x3F, 0xF8, 0xB3, 0xFA, 0x2D, 0xFD, 0x55, 0x00, 0xD2, 0x03,
-	0xB6, 0x06, 0x4B, 0x09, 0x25, 0x0C, 0xC1, 0x0E, 0x00, 0x10, 0xA7, 0x10,
-	0x49, 0x11, 0xAC, 0x11, 0xAC, 0x11, 0xAE, 0x11, 0xC6, 0x11, 0x0E, 0x12,
-	0x0A, 0x12, 0x86, 0x11, 0xCC, 0x10, 0x4D, 0x10, 0x11, 0x10, 0xBE, 0x0F,
-	0x17, 0x0F, 0xBA, 0x0E, 0x66, 0x0F, 0x59, 0x10, 0x63, 0x11, 0x5D, 0x13,
-	0xFB, 0x15, 0x2E, 0x18, 0x27, 0x1A, 0x34, 0x1D, 0x8A, 0x21, 0x51, 0x25,
-	0x86, 0x27, 0x22, 0x29, 0x4F, 0x2B, 0x37, 0x2D, 0x1A, 0x2E, 0x13, 0x2E,
-	0x60, 0x2E, 0x3D, 0x2F, 0x72, 0x2F, 0x39, 0x2E, 0xC9, 0x2C, 0xC7, 0x2B,
-	0x0D, 0x2A, 0xB0, 0x26, 0xD6, 0x22, 0x6D, 0x1F, 0xDF, 0x1B, 0x58, 0x17,
-	0xA5, 0x12, 0xB6, 0x0E, 0x58, 0x0B, 0xB8, 0x07, 0xC8, 0x03, 0x66, 0x00,
-	0xEF, 0xFD, 0xED, 0xFB, 0x0F, 0xFA, 0xBB, 0xF8, 0x41, 0xF8, 0x03, 0xF8,
-	0x97, 0xF7, 0x69, 0xF7, 0x04, 0xF8, 0xA0, 0xF8, 0xD3, 0xF8, 0xE2, 0xF8,
-	0x7F, 0xF9, 0xCC, 0xFA, 0x1C, 0xFC, 0x29, 0xFD, 0xF8, 0xFD, 0xC5, 0xFE,
-	0x58, 0xFF, 0x26, 0xFF, 0x41, 0xFE, 0x2C, 0xFD, 0xEB, 0xFB, 0x3B, 0xFA,
-	0xC9, 0xF7, 0xF2, 0xF4, 0x03, 0xF2, 0x3C, 0xEF, 0x73, 0xEC, 0x61, 0xE9,
-	0x2F, 0xE6, 0xE2, 0xE2, 0x97, 0xDF, 0x3D, 0xDC, 0xD4, 0xD8, 0x72, 0xD5,
-	0x3A, 0xD2, 0xFF, 0xCE, 0xB4, 0xCB, 0x43, 0xC8, 0x06, 0xC5, 0xC8, 0xC2,
-	0x5E, 0xC1, 0xF4, 0xBF, 0x24, 0xBE, 0x7D, 0xBC, 0xCA, 0xBB, 0xF6, 0xBB,
-	0xFE, 0xBB, 0x99, 0xBB, 0xA5, 0xBB, 0xF0, 0xBC, 0xE5, 0xBE, 0xF7, 0xC0,
-	0x89, 0xC3, 0xF3, 0xC7, 0x59, 0xCE, 0x36, 0xD5, 0x4C, 0xDB, 0xDD, 0xE0,
-	0xF4, 0xE6, 0x67, 0xED, 0x0A, 0xF3, 0x7C, 0xF7, 0x02, 0xFC, 0x0F, 0x01,
-	0x0F, 0x06, 0xC1, 0x0A, 0x29, 0x0F, 0xB8, 0x13, 0x67, 0x18, 0x2F, 0x1C,
-	0x45, 0x1E, 0xAE, 0x1F, 0x12, 0x21, 0xA0, 0x21, 0x32, 0x21, 0xEA, 0x20,
-	0x0E, 0x21, 0xA3, 0x20, 0x4B, 0x1F, 0xF3, 0x1D, 0x20, 0x1D, 0xDC, 0x1B,
-	0xC1, 0x19, 0x8A, 0x17, 0x19, 0x16, 0xF4, 0x15, 0x46, 0x16, 0xED, 0x15,
-	0xC3, 0x15, 0xE7, 0x16, 0xD2, 0x17, 0xBE, 0x16, 0xC1, 0x14, 0x1F, 0x14,
-	0x69, 0x14, 0xD3, 0x13, 0xAD, 0x12, 0xA4, 0x12, 0xC2, 0x13, 0x9A, 0x14,
-	0x8E, 0x14, 0xFC, 0x13, 0x2E, 0x13, 0x34, 0x12, 0x07, 0x10, 0xAB, 0x0C,
-	0x36, 0x09, 0xE7, 0x06, 0xAB, 0x04, 0xC6, 0x01, 0xE7, 0xFE, 0xAC, 0xFC,
-	0x2B, 0xFA, 0xE6, 0xF6, 0xB3, 0xF3, 0xD5, 0xF0, 0xE8, 0xED, 0x10, 0xEB,
-	0xDA, 0xE8, 0x37, 0xE7, 0xD9, 0xE5, 0xF2, 0xE4, 0x3B, 0xE4, 0x86, 0xE3,
-	0x28, 0xE3, 0x1C, 0xE3, 0x57, 0xE3, 0xCB, 0xE3, 0x3B, 0xE5, 0x76, 0xE7,
-	0xA9, 0xE9, 0xFD, 0xEB, 0xF7, 0xEE, 0x1C, 0xF2, 0xA2, 0xF4, 0xE7, 0xF6,
-	0x52, 0xF9, 0xB8, 0xFB, 0xB7, 0xFD, 0xA3, 0xFF, 0xDE, 0x01, 0x2A, 0x04,
-	0xA5, 0x06, 0x29, 0x09, 0x52, 0x0B, 0xE5, 0x0C, 0x21, 0x0E, 0x18, 0x0F,
-	0x69, 0x0F, 0xA9, 0x0F, 0xD3, 0x0F, 0xAD, 0x0F, 0xEB, 0x0F, 0x48, 0x11,
-	0xF3, 0x12, 0xEB, 0x13, 0x11, 0x15, 0xD4, 0x16, 0xFA, 0x17, 0xD9, 0x17,
-	0xCB, 0x17, 0xCC, 0x18, 0xFE, 0x19, 0xF0, 0x1A, 0x4D, 0x1C, 0x89, 0x1E,
-	0x50, 0x21, 0xD0, 0x23, 0x6D, 0x25, 0x88, 0x26, 0xA0, 0x27, 0xE9, 0x27,
-	0x00, 0x27, 0x27, 0x26, 0x89, 0x26, 0x48, 0x27, 0x08, 0x27, 0x3C, 0x26,
-	0xE6, 0x25, 0xF3, 0x24, 0x5F, 0x22, 0x13, 0x1F, 0x35, 0x1C, 0x8B, 0x19,
-	0xC0, 0x16, 0x1D, 0x14, 0xE9, 0x11, 0x2C, 0x10, 0x7E, 0x0E, 0x4B, 0x0C,
-	0x8E, 0x09, 0xFF, 0x06, 0x97, 0x04, 0x22, 0x02, 0xE2, 0xFF, 0xC4, 0xFE,
-	0xCC, 0xFE, 0x15, 0xFF, 0x51, 0xFF, 0xB7, 0xFF, 0x2E, 0x00, 0x55, 0x00,
-	0xEE, 0xFF, 0x6B, 0xFF, 0xF2, 0xFE, 0xC1, 0xFE, 0xE5, 0xFE, 0x38, 0xFF,
-	0xBB, 0xFF, 0x68, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x8D, 0xFE, 0xEE, 0xFC,
-	0x0F, 0xFB, 0xE2, 0xF8, 0x89, 0xF6, 0x7C, 0xF4, 0x90, 0xF2, 0x7A, 0xF0,
-	0x21, 0xEE, 0xC9, 0xEB, 0x20, 0xE9, 0xF3, 0xE5, 0x88, 0xE2, 0x45, 0xDF,
-	0x44, 0xDC, 0xB8, 0xD9, 0x80, 0xD7, 0x6B, 0xD5, 0x7E, 0xD3, 0x41, 0xD1,
-	0x59, 0xCE, 0x34, 0xCB, 0x7F, 0xC8, 0x5E, 0xC6, 0xF6, 0xC3, 0x2A, 0xC1,
-	0xE0, 0xBE, 0x10, 0xBE, 0x02, 0xBE, 0x97, 0xBD, 0xD6, 0xBC, 0xAC, 0xBC,
-	0x69, 0xBD, 0x2F, 0xBE, 0xDD, 0xBE, 0x73, 0xC0, 0x60, 0xC4, 0x47, 0xCA,
-	0x1E, 0xD0, 0x40, 0xD5, 0x25, 0xDB, 0xE9, 0xE1, 0xDB, 0xE7, 0x45, 0xEC,
-	0xC2, 0xF0, 0x67, 0xF6, 0x74, 0xFC, 0x06, 0x02, 0x86, 0x07, 0xAC, 0x0D,
-	0x27, 0x14, 0x17, 0x1A, 0x64, 0x1E, 0x3D, 0x21, 0xDF, 0x23, 0x00, 0x26,
-	0xB5, 0x26, 0xD3, 0x26, 0xB3, 0x27, 0x8E, 0x28, 0xEA, 0x27, 0x8F, 0x26,
-	0xB8, 0x25, 0xC3, 0x24, 0xCF, 0x22, 0x2E, 0x20, 0x8F, 0x1D, 0x87, 0x1B,
-	0x28, 0x1A, 0xD6, 0x18, 0x52, 0x17, 0x4A, 0x16, 0xE3, 0x15, 0x6C, 0x14,
-	0xF0, 0x11, 0x32, 0x10, 0x65, 0x0F, 0x63, 0x0E, 0x16, 0x0D, 0x95, 0x0C,
-	0x16, 0x0D, 0xE2, 0x0D, 0x65, 0x0E, 0x9F, 0x0E, 0xAA, 0x0E, 0xB3, 0x0E,
-	0x2F, 0x0E, 0x99, 0x0C, 0x57, 0x0A, 0x94, 0x08, 0x08, 0x07, 0x33, 0x05,
-	0x4E, 0x03, 0xA3, 0x01, 0x05, 0x00, 0x1C, 0xFE, 0xDB, 0xFB, 0x1A, 0xF9,
-	0x4F, 0xF6, 0x67, 0xF3, 0x59, 0xF0, 0x51, 0xED, 0xAE, 0xEA, 0x9D, 0xE8,
-	0x13, 0xE7, 0xAF, 0xE5, 0x4D, 0xE4, 0xFF, 0xE2, 0x0B, 0xE2, 0xB6, 0xE1,
-	0x9E, 0xE1, 0x0D, 0xE2, 0x22, 0xE3, 0xAA, 0xE4, 0x9D, 0xE6, 0x40, 0xE9,
-	0x39, 0xEC, 0x3E, 0xEF, 0x3F, 0xF2, 0x1C, 0xF5, 0xC3, 0xF7, 0x7C, 0xFA,
-	0x85, 0xFD, 0xD3, 0x00, 0x30, 0x04, 0xD6, 0x07, 0x8A, 0x0B, 0xEE, 0x0E,
-	0xA9, 0x11, 0xC9, 0x13, 0x4D, 0x15, 0x48, 0x16, 0xBE, 0x16, 0x15, 0x17,
-	0xB6, 0x17, 0xB3, 0x18, 0x76, 0x19, 0xC4, 0x19, 0x15, 0x1A, 0x02, 0x1B,
-	0xEB, 0x1B, 0x09, 0x1C, 0x76, 0x1B, 0xF4, 0x1A, 0xCA, 0x1A, 0x9B, 0x1A,
-	0x8B, 0x1A, 0x05, 0x1B, 0x34, 0x1C, 0xC3, 0x1D, 0x6A, 0x1F, 0xFA, 0x20,
-	0xA6, 0x22, 0x2B, 0x24, 0xB9, 0x24, 0x6C, 0x24, 0x37, 0x24, 0xBE, 0x24,
-	0x46, 0x25, 0x67, 0x25, 0x5E, 0x25, 0x77, 0x25, 0x47, 0x25, 0x35, 0x24,
-	0x72, 0x22, 0x3D, 0x20, 0x00, 0x1E, 0xDD, 0x1B, 0x7C, 0x19, 0x15, 0x17,
-	0x02, 0x15, 0x1A, 0x13, 0x96, 0x10, 0x7C, 0x0D, 0xA2, 0x0A, 0xF3, 0x07,
-	0xDB, 0x04, 0xBD, 0x01, 0xA2, 0xFF, 0x61, 0xFE, 0xC8, 0xFD, 0x6C, 0xFD,
-	0x0C, 0xFD, 0xA2, 0xFC, 0x26, 0xFC, 0x8C, 0xFB, 0x88, 0xFA, 0xBE, 0xF9,
-	0x9F, 0xF9, 0xAD, 0xF9, 0x93, 0xF9, 0xE8, 0xF9, 0xC2, 0xFA, 0x6F, 0xFB,
-	0x3B, 0xFB, 0x90, 0xFA, 0xA1, 0xF9, 0x57, 0xF8, 0xCC, 0xF6, 0xFC, 0xF4,
-	0xDF, 0xF2, 0xB0, 0xF0, 0x7E, 0xEE, 0xC6, 0xEB, 0x87, 0xE8, 0x40, 0xE5,
-	0xFF, 0xE1, 0x3E, 0xDE, 0x2B, 0xDA, 0x2D, 0xD6, 0x4E, 0xD2, 0xE0, 0xCD,
-	0x4A, 0xC9, 0x62, 0xC5, 0xE7, 0xC1, 0x30, 0xBE, 0x13, 0xBA, 0x4D, 0xB6,
-	0x2B, 0xB3, 0xF8, 0xB0, 0x7F, 0xAF, 0x9E, 0xAE, 0xE0, 0xAE, 0x2E, 0xB0,
-	0xF5, 0xB1, 0x7D, 0xB4, 0x5F, 0xB8, 0x13, 0xBE, 0xC3, 0xC4, 0x1D, 0xCB,
-	0x84, 0xD1, 0x82, 0xD8, 0xB7, 0xDF, 0xA0, 0xE6, 0xAD, 0xED, 0x0E, 0xF5,
-	0x7F, 0xFC, 0x89, 0x03, 0xCA, 0x0A, 0x95, 0x12, 0xDA, 0x19, 0xA7, 0x1F,
-	0x8E, 0x24, 0x3B, 0x28, 0xF7, 0x2A, 0xCC, 0x2C, 0x84, 0x2D, 0xF5, 0x2D,
-	0xBC, 0x2E, 0x30, 0x2F, 0x3C, 0x2E, 0x34, 0x2C, 0x62, 0x2A, 0x76, 0x28,
-	0x37, 0x25, 0x80, 0x21, 0xB9, 0x1E, 0x4A, 0x1C, 0xA6, 0x19, 0x87, 0x17,
-	0x08, 0x16, 0xC6, 0x14, 0x80, 0x13, 0xDE, 0x11, 0x8B, 0x0F, 0x5B, 0x0D,
-	0x6F, 0x0C, 0x52, 0x0C, 0x7B, 0x0C, 0x63, 0x0D, 0xF1, 0x0E, 0x16, 0x10,
-	0xCA, 0x10, 0x92, 0x11, 0xF9, 0x11, 0x59, 0x11, 0x4C, 0x10, 0x50, 0x0F,
-	0x50, 0x0E, 0x20, 0x0D, 0x26, 0x0C, 0x0F, 0x0B, 0x3F, 0x09, 0x26, 0x07,
-	0x8A, 0x04, 0xE5, 0x00, 0x02, 0xFD, 0x7A, 0xF9, 0x01, 0xF6, 0x19, 0xF2,
-	0x4C, 0xEE, 0x17, 0xEB, 0xFF, 0xE7, 0x9F, 0xE4, 0x7D, 0xE1, 0x02, 0xDF,
-	0xE8, 0xDC, 0x0C, 0xDB, 0x75, 0xD9, 0x90, 0xD8, 0xA3, 0xD8, 0xAD, 0xD9,
-	0x61, 0xDB, 0x2D, 0xDD, 0x31, 0xDF, 0xAF, 0xE1, 0x78, 0xE4, 0x7A, 0xE7,
-	0xF3, 0xEA, 0xE9, 0xEE, 0xDA, 0xF2, 0xFB, 0xF6, 0x35, 0xFB, 0x81, 0xFF,
-	0xCE, 0x03, 0x2F, 0x08, 0x67, 0x0C, 0xD3, 0x0F, 0x6D, 0x12, 0xD0, 0x14,
-	0x1F, 0x17, 0xE1, 0x18, 0xE5, 0x19, 0xAE, 0x1A, 0x7A, 0x1B, 0x16, 0x1C,
-	0x33, 0x1C, 0xC6, 0x1B, 0x19, 0x1B, 0x50, 0x1A, 0x5D, 0x19, 0x29, 0x18,
-	0xCE, 0x16, 0xD4, 0x15, 0x44, 0x15, 0x13, 0x15, 0xBC, 0x15, 0x75, 0x17,
-	0x8C, 0x19, 0x27, 0x1B, 0x66, 0x1C, 0x71, 0x1D, 0x56, 0x1E, 0x5D, 0x1F,
-	0xE5, 0x20, 0xFC, 0x22, 0x80, 0x25, 0x3B, 0x28, 0xD0, 0x2A, 0xED, 0x2C,
-	0x81, 0x2E, 0x3A, 0x2F, 0xC9, 0x2E, 0x9B, 0x2D, 0x48, 0x2C, 0x11, 0x2B,
-	0x5F, 0x29, 0x56, 0x27, 0x45, 0x25, 0xD2, 0x22, 0xCC, 0x1F, 0x07, 0x1C,
-	0x7F, 0x17, 0x9F, 0x12, 0xDE, 0x0D, 0x4B, 0x09, 0xF4, 0x04, 0x4E, 0x01,
-	0x7B, 0xFE, 0x1D, 0xFC, 0x82, 0xF9, 0xF5, 0xF6, 0xAD, 0xF4, 0x7B, 0xF2,
-	0x55, 0xF0, 0xB2, 0xEE, 0xE5, 0xED, 0x04, 0xEE, 0x12, 0xEF, 0x76, 0xF0,
-	0xF5, 0xF1, 0x5B, 0xF3, 0xB9, 0xF4, 0xC7, 0xF5, 0x59, 0xF6, 0xB0, 0xF6,
-	0xD0, 0xF6, 0xA1, 0xF6, 0x30, 0xF6, 0xC2, 0xF5, 0x37, 0xF5, 0x53, 0xF4,
-	0xA4, 0xF2, 0x2F, 0xF0, 0x01, 0xED, 0xFA, 0xE8, 0x62, 0xE4, 0x5A, 0xDF,
-	0xEA, 0xD9, 0xE0, 0xD3, 0xB8, 0xCD, 0xCD, 0xC7, 0x19, 0xC2, 0xB4, 0xBC,
-	0x7D, 0xB7, 0xA0, 0xB2, 0x57, 0xAE, 0xAC, 0xAA, 0xD8, 0xA7, 0x9D, 0xA5,
-	0xA5, 0xA4, 0x7F, 0xA5, 0x88, 0xA7, 0x99, 0xAA, 0x9F, 0xAF, 0x63, 0xB6,
-	0x81, 0xBD, 0x9A, 0xC4, 0xFC, 0xCB, 0x05, 0xD4, 0x89, 0xDC, 0x0F, 0xE5,
-	0x97, 0xED, 0x55, 0xF6, 0x4D, 0x00, 0x2B, 0x0B, 0xFD, 0x14, 0x54, 0x1D,
-	0x5F, 0x25, 0x86, 0x2C, 0x39, 0x31, 0xEF, 0x33, 0x15, 0x36, 0x08, 0x38,
-	0x37, 0x39, 0xBE, 0x39, 0x88, 0x39, 0xD2, 0x38, 0x50, 0x37, 0x8A, 0x34,
-	0x01, 0x30, 0xDB, 0x2A, 0x2D, 0x26, 0x89, 0x21, 0xB7, 0x1C, 0x6A, 0x18,
-	0x2C, 0x15, 0x43, 0x12, 0x3C, 0x0F, 0x78, 0x0C, 0xD3, 0x09, 0x02, 0x07,
-	0x72, 0x04, 0xC6, 0x02, 0x38, 0x02, 0xD2, 0x02, 0x6C, 0x04, 0x9A, 0x06,
-	0x16, 0x09, 0x8D, 0x0B, 0xD8, 0x0D, 0x4F, 0x0F, 0xDF, 0x0F, 0x75, 0x10,
-	0x20, 0x11, 0x6D, 0x11, 0xB8, 0x11, 0x2E, 0x12, 0x9B, 0x12, 0x2E, 0x12,
-	0xCF, 0x10, 0x86, 0x0E, 0x67, 0x0B, 0xB3, 0x07, 0x97, 0x03, 0xFE, 0xFE,
-	0x16, 0xFA, 0x98, 0xF5, 0x4F, 0xF1, 0xA4, 0xEC, 0xD3, 0xE7, 0x67, 0xE3,
-	0x2D, 0xDF, 0xF6, 0xDA, 0x26, 0xD7, 0x12, 0xD4, 0x7B, 0xD1, 0xF2, 0xCF,
-	0x7D, 0xCF, 0xBA, 0xCF, 0xAA, 0xD0, 0x95, 0xD2, 0x26, 0xD5, 0xDE, 0xD7,
-	0xD1, 0xDA, 0x81, 0xDE, 0xE9, 0xE2, 0xAB, 0xE7, 0xCB, 0xEC, 0x4A, 0xF2,
-	0x4C, 0xF8, 0x9D, 0xFE, 0xAB, 0x04, 0xFE, 0x09, 0xE4, 0x0E, 0xC3, 0x13,
-	0x08, 0x18, 0x3B, 0x1B, 0xBD, 0x1D, 0x05, 0x20, 0x1F, 0x22, 0xEC, 0x23,
-	0x5D, 0x25, 0x83, 0x26, 0x1F, 0x27, 0x27, 0x27, 0x4B, 0x26, 0x98, 0x24,
-	0xB7, 0x22, 0xEE, 0x20, 0xDF, 0x1E, 0xAC, 0x1C, 0x0B, 0x1B, 0x72, 0x1A,
-	0x5D, 0x1A, 0x77, 0x1A, 0x25, 0x1A, 0x90, 0x19, 0x34, 0x19, 0xF5, 0x18,
-	0x58, 0x18, 0xD2, 0x17, 0x48, 0x18, 0x80, 0x19, 0xD8, 0x1A, 0x6E, 0x1C,
-	0x5B, 0x1E, 0xD3, 0x1F, 0xD4, 0x20, 0x58, 0x21, 0x74, 0x21, 0x2D, 0x21,
-	0xF4, 0x20, 0xAE, 0x20, 0x2F, 0x20, 0xC2, 0x1F, 0x7C, 0x1F, 0x7D, 0x1E,
-	0x7A, 0x1C, 0x0B, 0x1A, 0x20, 0x17, 0xB9, 0x13, 0x44, 0x10, 0x5C, 0x0D,
-	0xBE, 0x0A, 0x27, 0x08, 0xB9, 0x05, 0x56, 0x03, 0xF8, 0x00, 0x6D, 0xFE,
-	0x87, 0xFB, 0x49, 0xF8, 0x58, 0xF5, 0x6D, 0xF3, 0x13, 0xF2, 0x0E, 0xF1,
-	0xB6, 0xF0, 0xF5, 0xF0, 0x23, 0xF1, 0xDE, 0xF0, 0x65, 0xF0, 0xD1, 0xEF,
-	0x01, 0xEF, 0xF4, 0xED, 0xD1, 0xEC, 0xE5, 0xEB, 0x29, 0xEB, 0x7D, 0xEA,
-	0x7C, 0xE9, 0x0E, 0xE8, 0x07, 0xE6, 0x6B, 0xE3, 0x1B, 0xE0, 0x66, 0xDC,
-	0x50, 0xD8, 0xAF, 0xD3, 0x91, 0xCE, 0xE4, 0xC9, 0xEC, 0xC5, 0xDA, 0xC1,
-	0xB1, 0xBD, 0x2C, 0xBA, 0x8B, 0xB7, 0x61, 0xB5, 0x25, 0xB3, 0x98, 0xB1,
-	0xA1, 0xB1, 0xED, 0xB2, 0x06, 0xB5, 0x13, 0xB8, 0x5E, 0xBC, 0x80, 0xC1,
-	0xFA, 0xC6, 0xE2, 0xCC, 0x42, 0xD3, 0x2D, 0xDA, 0x5B, 0xE1, 0xAB, 0xE8,
-	0x71, 0xF0, 0x23, 0xF9, 0xF3, 0x01, 0x37, 0x0A, 0x62, 0x12, 0xAA, 0x1A,
-	0xCE, 0x21, 0x08, 0x27, 0x42, 0x2B, 0xF4, 0x2E, 0xAD, 0x31, 0x7E, 0x33,
-	0xFB, 0x34, 0x29, 0x36, 0xFF, 0x36, 0x60, 0x37, 0xA9, 0x36, 0x8C, 0x34,
-	0xEE, 0x31, 0x34, 0x2F, 0x84, 0x2B, 0x09, 0x27, 0x2A, 0x23, 0xD5, 0x1F,
-	0x37, 0x1C, 0x99, 0x18, 0xAC, 0x15, 0x09, 0x13, 0x2D, 0x10, 0x5B, 0x0D,
-	0xD1, 0x0A, 0xCF, 0x08, 0x87, 0x07, 0xB8, 0x06, 0x43, 0x06, 0x88, 0x06,
-	0x69, 0x07, 0x11, 0x08, 0x2F, 0x08, 0x78, 0x08, 0xCF, 0x08, 0x8B, 0x08,
-	0xFC, 0x07, 0x06, 0x08, 0xA5, 0x08, 0xE2, 0x08, 0xB7, 0x08, 0x85, 0x08,
-	0xFA, 0x07, 0x8B, 0x06, 0x35, 0x04, 0x78, 0x01, 0x6B, 0xFE, 0x33, 0xFB,
-	0xD1, 0xF7, 0x7D, 0xF4, 0x65, 0xF1, 0x9C, 0xEE, 0xAD, 0xEB, 0x9A, 0xE8,
-	0x9D, 0xE5, 0xDC, 0xE2, 0x26, 0xE0, 0x7E, 0xDD, 0x76, 0xDB, 0x10, 0xDA,
-	0x3C, 0xD9, 0x1F, 0xD9, 0xCA, 0xD9, 0xD2, 0xDA, 0x2F, 0xDC, 0x0A, 0xDE,
-	0x4F, 0xE0, 0xE8, 0xE2, 0x12, 0xE6, 0xB2, 0xE9, 0xB0, 0xED, 0x2B, 0xF2,
-	0xFE, 0xF6, 0xB7, 0xFB, 0x24, 0x00, 0x8C, 0x04, 0xC8, 0x08, 0x73, 0x0C,
-	0x98, 0x0F, 0xD5, 0x12, 0x7D, 0x16, 0xBD, 0x19, 0x3D, 0x1C, 0x42, 0x1E,
-	0x3F, 0x20, 0x19, 0x22, 0x1B, 0x23, 0x27, 0x23, 0xB7, 0x22, 0x2D, 0x22,
-	0x3A, 0x21, 0xED, 0x1F, 0xC4, 0x1E, 0x6F, 0x1E, 0x98, 0x1E, 0x8F, 0x1E,
-	0xB8, 0x1E, 0x51, 0x1F, 0xD0, 0x1F, 0x73, 0x1F, 0x4B, 0x1E, 0x11, 0x1D,
-	0x24, 0x1C, 0x93, 0x1B, 0x85, 0x1B, 0xEC, 0x1B, 0xC1, 0x1C, 0x0F, 0x1E,
-	0x1D, 0x1F, 0xAC, 0x1F, 0xE8, 0x1F, 0xE7, 0x1F, 0x4F, 0x1F, 0x2F, 0x1E,
-	0x25, 0x1D, 0x67, 0x1C, 0x9E, 0x1B, 0x92, 0x1A, 0x65, 0x19, 0x26, 0x18,
-	0x9A, 0x16, 0x97, 0x14, 0x10, 0x12, 0x68, 0x0F, 0x2F, 0x0D, 0x26, 0x0B,
-	0x1B, 0x09, 0x31, 0x07, 0x61, 0x05, 0x59, 0x03, 0xBC, 0x00, 0xDB, 0xFD,
-	0x1A, 0xFB, 0x88, 0xF8, 0x35, 0xF6, 0x20, 0xF4, 0x9C, 0xF2, 0xC4, 0xF1,
-	0x21, 0xF1, 0x63, 0xF0, 0x3D, 0xEF, 0xD9, 0xED, 0x29, 0xEC, 0xF6, 0xE9,
-	0x71, 0xE7, 0x11, 0xE5, 0xC6, 0xE2, 0x81, 0xE0, 0x16, 0xDE, 0x90, 0xDB,
-	0x16, 0xD9, 0xB9, 0xD6, 0x03, 0xD4, 0x19, 0xD0, 0xEB, 0xCA, 0xDB, 0xC5,
-	0xD8, 0xC1, 0x7A, 0xBE, 0x27, 0xBB, 0x85, 0xB8, 0x42, 0xB7, 0xA4, 0xB6,
-	0x79, 0xB5, 0x7A, 0xB4, 0xAC, 0xB4, 0x43, 0xB6, 0x67, 0xB8, 0xDC, 0xBA,
-	0xAB, 0xBE, 0x30, 0xC4, 0x62, 0xCA, 0x28, 0xD0, 0x38, 0xD6, 0x70, 0xDD,
-	0x9E, 0xE4, 0x84, 0xEA, 0x91, 0xF0, 0x62, 0xF8, 0x95, 0x00, 0x2B, 0x08,
-	0xD8, 0x0F, 0xCE, 0x17, 0xEF, 0x1E, 0x98, 0x24, 0xC7, 0x28, 0x36, 0x2C,
-	0x29, 0x2F, 0x5C, 0x31, 0x66, 0x32, 0xF6, 0x32, 0x24, 0x34, 0x7B, 0x35,
-	0x51, 0x35, 0xF9, 0x33, 0x7F, 0x32, 0x7F, 0x30, 0x4C, 0x2D, 0xAB, 0x29,
-	0x64, 0x26, 0x35, 0x23, 0x38, 0x20, 0x51, 0x1D, 0x3C, 0x1A, 0x87, 0x17,
-	0x70, 0x15, 0x52, 0x13, 0xED, 0x10, 0x20, 0x0F, 0x28, 0x0E, 0x23, 0x0D,
-	0xEB, 0x0B, 0x85, 0x0B, 0xFE, 0x0B, 0x42, 0x0C, 0x22, 0x0C, 0xFE, 0x0B,
-	0xC7, 0x0B, 0x5C, 0x0B, 0xC5, 0x0A, 0x01, 0x0A, 0x83, 0x09, 0x19, 0x09,
-	0x6D, 0x08, 0x65, 0x07, 0x55, 0x06, 0x35, 0x05, 0x43, 0x03, 0x75, 0x00,
-	0x63, 0xFD, 0x20, 0xFA, 0x5F, 0xF6, 0x78, 0xF2, 0x19, 0xEF, 0x0C, 0xEC,
-	0xE3, 0xE8, 0xF5, 0xE5, 0x7C, 0xE3, 0x31, 0xE1, 0xCB, 0xDE, 0x66, 0xDC,
-	0x63, 0xDA, 0xC6, 0xD8, 0x8A, 0xD7, 0xDB, 0xD6, 0xF0, 0xD6, 0xF9, 0xD7,
-	0xC5, 0xD9, 0xF1, 0xDB, 0x6E, 0xDE, 0x48, 0xE1, 0x53, 0xE4, 0xB2, 0xE7,
-	0x66, 0xEB, 0x88, 0xEF, 0xD9, 0xF3, 0x31, 0xF8, 0xE2, 0xFC, 0x97, 0x01,
-	0xC8, 0x05, 0xB2, 0x09, 0x97, 0x0D, 0x29, 0x11, 0x36, 0x14, 0xED, 0x16,
-	0xF8, 0x19, 0x42, 0x1D, 0x8F, 0x20, 0x79, 0x23, 0xD7, 0x25, 0xBB, 0x27,
-	0x29, 0x29, 0x80, 0x29, 0x9A, 0x28, 0x33, 0x27, 0xF8, 0x25, 0x3F, 0x25,
-	0x02, 0x25, 0xC7, 0x24, 0xC2, 0x24, 0xD1, 0x24, 0xA4, 0x24, 0x90, 0x23,
-	0x92, 0x21, 0x12, 0x1F, 0xAD, 0x1C, 0xA9, 0x1A, 0xBE, 0x18, 0x1B, 0x17,
-	0x37, 0x16, 0xD8, 0x15, 0x9C, 0x15, 0xDE, 0x14, 0xE8, 0x13, 0x04, 0x13,
-	0x10, 0x12, 0xE5, 0x10, 0xE0, 0x0F, 0x52, 0x0F, 0x48, 0x0F, 0x74, 0x0F,
-	0x4B, 0x0F, 0xE7, 0x0E, 0x3F, 0x0E, 0x64, 0x0D, 0x57, 0x0C, 0x4D, 0x0B,
-	0x70, 0x0A, 0xDF, 0x09, 0xBC, 0x09, 0x80, 0x09, 0x15, 0x09, 0x6E, 0x08,
-	0x4B, 0x07, 0x75, 0x05, 0x29, 0x03, 0xD2, 0x00, 0x4B, 0xFE, 0xB5, 0xFB,
-	0x61, 0xF9, 0x92, 0xF7, 0xBF, 0xF5, 0x8D, 0xF3, 0x25, 0xF1, 0x72, 0xEE,
-	0x20, 0xEB, 0x2B, 0xE7, 0xC2, 0xE2, 0x47, 0xDE, 0xDB, 0xD9, 0x4C, 0xD5,
-	0x90, 0xD0, 0x7E, 0xCC, 0xEC, 0xC8, 0xCE, 0xC4, 0xF0, 0xBF, 0x85, 0xBB,
-	0xDA, 0xB7, 0x81, 0xB4, 0x89, 0xB1, 0xEA, 0xAF, 0xB4, 0xAF, 0xE9, 0xAF,
-	0x9A, 0xB0, 0x1F, 0xB2, 0x83, 0xB4, 0xCD, 0xB7, 0x89, 0xBB, 0x8D, 0xBF,
-	0x69, 0xC4, 0x2F, 0xCA, 0x9C, 0xD0, 0x8A, 0xD7, 0x50, 0xDF, 0x3B, 0xE7,
-	0xAE, 0xEE, 0x4E, 0xF6, 0x3B, 0xFE, 0x61, 0x05, 0x86, 0x0B, 0xD9, 0x11,
-	0x2C, 0x18, 0x62, 0x1D, 0xB1, 0x21, 0xB6, 0x25, 0x29, 0x29, 0x9A, 0x2B,
-	0x76, 0x2D, 0xA2, 0x2E, 0x04, 0x2F, 0xCD, 0x2E, 0x16, 0x2E, 0xC5, 0x2C,
-	0xEE, 0x2A, 0xF4, 0x28, 0x87, 0x26, 0xD4, 0x23, 0x4C, 0x21, 0xCD, 0x1E,
-	0xFA, 0x1B, 0x8C, 0x19, 0x9D, 0x17, 0x99, 0x15, 0x60, 0x13, 0xD1, 0x11,
-	0xE4, 0x10, 0x34, 0x10, 0x18, 0x10, 0x68, 0x10, 0xAB, 0x10, 0xF6, 0x10,
-	0x82, 0x11, 0x4A, 0x12, 0xB0, 0x12, 0x28, 0x13, 0x17, 0x14, 0xF1, 0x14,
-	0x58, 0x15, 0x7D, 0x15, 0xB5, 0x15, 0xD2, 0x15, 0x34, 0x15, 0x99, 0x13,
-	0x86, 0x11, 0x83, 0x0F, 0x11, 0x0D, 0xEE, 0x09, 0x97, 0x06, 0x90, 0x03,
-	0x3A, 0x00, 0x2C, 0xFC, 0xEB, 0xF7, 0xE9, 0xF3, 0xCB, 0xEF, 0x80, 0xEB,
-	0x62, 0xE7, 0xAA, 0xE3, 0x75, 0xE0, 0x96, 0xDD, 0x43, 0xDB, 0x8A, 0xD9,
-	0x4B, 0xD8, 0x59, 0xD7, 0xC3, 0xD6, 0xD4, 0xD6, 0x9D, 0xD7, 0x25, 0xD9,
-	0x4C, 0xDB, 0x32, 0xDE, 0xAB, 0xE1, 0x6A, 0xE5, 0x8D, 0xE9, 0xE1, 0xED,
-	0x22, 0xF2, 0x42, 0xF6, 0xA8, 0xFA, 0x1E, 0xFF, 0x6C, 0x03, 0x68, 0x07,
-	0xA6, 0x0B, 0x20, 0x10, 0x6F, 0x14, 0xF8, 0x17, 0xC5, 0x1A, 0x2B, 0x1D,
-	0x4A, 0x1F, 0x06, 0x21, 0x1C, 0x22, 0xD6, 0x22, 0xBA, 0x23, 0x35, 0x24,
-	0xA6, 0x23, 0x66, 0x22, 0x68, 0x21, 0xAA, 0x20, 0xEA, 0x1F, 0x3E, 0x1F,
-	0x7E, 0x1E, 0xC7, 0x1D, 0x01, 0x1D, 0xBB, 0x1B, 0xDB, 0x19, 0x0A, 0x18,
-	0x8A, 0x16, 0xE8, 0x14, 0x5E, 0x13, 0x6E, 0x12, 0x2B, 0x12, 0x2F, 0x12,
-	0x38, 0x12, 0x64, 0x12, 0x6C, 0x12, 0x31, 0x12, 0xAD, 0x11, 0x12, 0x11,
-	0xB2, 0x10, 0x6B, 0x10, 0x49, 0x10, 0x35, 0x10, 0x6E, 0x10, 0xB8, 0x10,
-	0xC2, 0x10, 0x8C, 0x10, 0x1F, 0x10, 0x6F, 0x0F, 0xC5, 0x0E, 0xEC, 0x0D,
-	0x1D, 0x0D, 0x39, 0x0C, 0x35, 0x0B, 0xE3, 0x09, 0x39, 0x08, 0x6B, 0x06,
-	0x56, 0x04, 0x40, 0x02, 0x24, 0x00, 0xF6, 0xFD, 0xB6, 0xFB, 0x68, 0xF9,
-	0x03, 0xF7, 0x70, 0xF4, 0x70, 0xF1, 0x41, 0xEE, 0xFF, 0xEA, 0x71, 0xE7,
-	0x3F, 0xE3, 0xDB, 0xDE, 0x79, 0xDA, 0x12, 0xD6, 0xBE, 0xD1, 0x66, 0xCD,
-	0xFC, 0xC8, 0x9F, 0xC4, 0x6C, 0xC0, 0x8F, 0xBC, 0x7D, 0xB9, 0x6C, 0xB7,
-	0xD7, 0xB5, 0x51, 0xB4, 0x52, 0xB3, 0x92, 0xB3, 0x8C, 0xB4, 0x91, 0xB5,
-	0x6C, 0xB7, 0xFC, 0xBA, 0x7D, 0xBF, 0x21, 0xC4, 0x06, 0xC9, 0xBE, 0xCE,
-	0x8F, 0xD5, 0x65, 0xDC, 0x45, 0xE2, 0x87, 0xE8, 0x66, 0xF0, 0x93, 0xF8,
-	0xF8, 0xFE, 0xE5, 0x04, 0x27, 0x0C, 0x50, 0x13, 0x54, 0x18, 0xB6, 0x1B,
-	0x55, 0x1F, 0x48, 0x23, 0x7C, 0x26, 0x69, 0x28, 0x14, 0x2A, 0x23, 0x2C,
-	0x95, 0x2D, 0xC7, 0x2C, 0xDE, 0x2A, 0x8F, 0x29, 0x9A, 0x28, 0x35, 0x26,
-	0xC3, 0x22, 0x47, 0x20, 0xEC, 0x1E, 0x0D, 0x1D, 0x6B, 0x1A, 0xDA, 0x17,
-	0x0C, 0x16, 0x3F, 0x14, 0xAF, 0x11, 0x2F, 0x0F, 0x2A, 0x0E, 0x19, 0x0E,
-	0xB6, 0x0D, 0xEE, 0x0C, 0x12, 0x0D, 0x32, 0x0E, 0xC4, 0x0E, 0x6C, 0x0E,
-	0x7B, 0x0E, 0x94, 0x0F, 0x85, 0x10, 0xDC, 0x10, 0x24, 0x11, 0xE7, 0x11,
-	0x8A, 0x12, 0x5A, 0x12, 0x87, 0x11, 0x96, 0x10, 0x8A, 0x0F, 0xE0, 0x0D,
-	0x8F, 0x0B, 0x2B, 0x09, 0x05, 0x07, 0xA3, 0x04, 0x91, 0x01, 0x30, 0xFE,
-	0xF1, 0xFA, 0x72, 0xF7, 0xDF, 0xF3, 0x5A, 0xF0, 0xE3, 0xEC, 0x80, 0xE9,
-	0x75, 0xE6, 0xDD, 0xE3, 0xA2, 0xE1, 0xD2, 0xDF, 0x9C, 0xDE, 0xF1, 0xDD,
-	0xBB, 0xDD, 0xFC, 0xDD, 0xCA, 0xDE, 0x33, 0xE0, 0x2A, 0xE2, 0x84, 0xE4,
-	0x37, 0xE7, 0x6F, 0xEA, 0x27, 0xEE, 0x0E, 0xF2, 0xDE, 0xF5, 0x0A, 0xFA,
-	0xA4, 0xFE, 0x5B, 0x03, 0x7C, 0x07, 0x28, 0x0B, 0xE2, 0x0E, 0x89, 0x12,
-	0xF5, 0x15, 0xED, 0x18, 0x9B, 0x1B, 0x4E, 0x1E, 0x9B, 0x20, 0x58, 0x22,
-	0xDC, 0x23, 0x5C, 0x25, 0xC2, 0x26, 0xAB, 0x27, 0xEA, 0x27, 0xC6, 0x27,
-	0xF9, 0x26, 0x76, 0x25, 0xE3, 0x23, 0xBC, 0x22, 0xA6, 0x21, 0x23, 0x20,
-	0x9F, 0x1E, 0x50, 0x1D, 0x0E, 0x1C, 0x6C, 0x1A, 0x4A, 0x18, 0x3A, 0x16,
-	0x70, 0x14, 0x67, 0x12, 0x2A, 0x10, 0x50, 0x0E, 0x28, 0x0D, 0x21, 0x0C,
-	0xDE, 0x0A, 0xD8, 0x09, 0x63, 0x09, 0xFB, 0x08, 0x54, 0x08, 0xA2, 0x07,
-	0x5E, 0x07, 0x57, 0x07, 0x10, 0x07, 0xAE, 0x06, 0xAC, 0x06, 0xCF, 0x06,
-	0xA5, 0x06, 0x5E, 0x06, 0x3D, 0x06, 0x17, 0x06, 0xCD, 0x05, 0x50, 0x05,
-	0xB1, 0x04, 0x0D, 0x04, 0x4E, 0x03, 0xDD, 0x01, 0x22, 0x00, 0x7A, 0xFE,
-	0x93, 0xFC, 0x32, 0xFA, 0x70, 0xF7, 0x91, 0xF4, 0x4D, 0xF1, 0x78, 0xED,
-	0x54, 0xE9, 0x18, 0xE5, 0xF0, 0xE0, 0x8F, 0xDC, 0xD7, 0xD7, 0xD4, 0xD2,
-	0x5F, 0xCD, 0x6D, 0xC7, 0x8C, 0xC1, 0xE7, 0xBC, 0xD1, 0xB9, 0x81, 0xB7,
-	0x4B, 0xB5, 0x7F, 0xB3, 0xE7, 0xB2, 0x21, 0xB3, 0x66, 0xB3, 0xD8, 0xB3,
-	0x96, 0xB5, 0xFF, 0xB8, 0xF3, 0xBC, 0xF4, 0xC0, 0x36, 0xC6, 0xA1, 0xCD,
-	0x91, 0xD5, 0x4B, 0xDC, 0x37, 0xE2, 0x4F, 0xE9, 0x8E, 0xF1, 0x33, 0xF9,
-	0xB7, 0xFF, 0xB0, 0x06, 0xCD, 0x0E, 0x95, 0x16, 0x2B, 0x1C, 0x8D, 0x20,
-	0xF1, 0x24, 0xA9, 0x28, 0x9D, 0x2A, 0x6D, 0x2B, 0xBD, 0x2C, 0x82, 0x2E,
-	0x3A, 0x2F, 0x64, 0x2E, 0x14, 0x2D, 0xF3, 0x2B, 0xE7, 0x29, 0x0A, 0x26,
-	0x8D, 0x21, 0xED, 0x1D, 0xF3, 0x1A, 0x78, 0x17, 0xE8, 0x13, 0x4E, 0x11,
-	0x5E, 0x0F, 0xFB, 0x0C, 0x6B, 0x0A, 0x88, 0x08, 0x9E, 0x07, 0xEB, 0x06,
-	0xF4, 0x05, 0x35, 0x05, 0xBC, 0x05, 0xEF, 0x06, 0xE9, 0x07, 0xD5, 0x08,
-	0x72, 0x0A, 0x60, 0x0C, 0xD5, 0x0D, 0xE5, 0x0E, 0x25, 0x10, 0x8F, 0x11,
-	0x96, 0x12, 0x00, 0x13, 0x09, 0x13, 0x00, 0x13, 0xA9, 0x12, 0x77, 0x11,
-	0x76, 0x0F, 0x44, 0x0D, 0xE2, 0x0A, 0xC9, 0x07, 0x38, 0x04, 0x95, 0x00,
-	0xDF, 0xFC, 0x20, 0xF9, 0x21, 0xF5, 0x5B, 0xF1, 0xA3, 0xED, 0x0F, 0xEA,
-	0xA4, 0xE6, 0x60, 0xE3, 0x55, 0xE0, 0xBC, 0xDD, 0xC7, 0xDB, 0x6B, 0xDA,
-	0xEC, 0xD9, 0x33, 0xDA, 0x4D, 0xDB, 0x29, 0xDD, 0x84, 0xDF, 0x12, 0xE2,
-	0x15, 0xE5, 0xC5, 0xE8, 0x28, 0xED, 0xCF, 0xF1, 0xDF, 0xF6, 0x79, 0xFC,
-	0x8D, 0x02, 0x7D, 0x08, 0xF6, 0x0D, 0xFD, 0x12, 0xEB, 0x17, 0xAD, 0x1C,
-	0xC7, 0x20, 0x74, 0x24, 0xEC, 0x27, 0x4D, 0x2B, 0xD1, 0x2D, 0x71, 0x2F,
-	0x6E, 0x30, 0x49, 0x31, 0x83, 0x31, 0x2F, 0x30, 0x99, 0x2D, 0xB3, 0x2A,
-	0x5C, 0x28, 0xEA, 0x25, 0xF7, 0x22, 0xC6, 0x1F, 0xA4, 0x1C, 0x78, 0x19,
-	0xB6, 0x15, 0x6F, 0x11, 0x6D, 0x0D, 0x32, 0x0A, 0x10, 0x07, 0xFD, 0x03,
-	0x7D, 0x01, 0x41, 0x00, 0xA8, 0xFF, 0x02, 0xFF, 0x4F, 0xFE, 0x38, 0xFE,
-	0xA5, 0xFE, 0x02, 0xFF, 0x6F, 0xFF, 0x65, 0x00, 0x33, 0x02, 0x5A, 0x04,
-	0x44, 0x06, 0x34, 0x08, 0x78, 0x0A, 0x78, 0x0C, 0xC3, 0x0D, 0x5B, 0x0E,
-	0xE7, 0x0E, 0x85, 0x0F, 0xD4, 0x0F, 0x8B, 0x0F, 0x19, 0x0F, 0x94, 0x0E,
-	0x6E, 0x0D, 0x58, 0x0B, 0x67, 0x08, 0x06, 0x05, 0x51, 0x01, 0x30, 0xFD,
-	0x9B, 0xF8, 0x09, 0xF4, 0x9F, 0xEF, 0xDB, 0xEA, 0x7C, 0xE5, 0xBC, 0xDF,
-	0x29, 0xDA, 0x7C, 0xD4, 0x8D, 0xCE, 0x70, 0xC8, 0xA7, 0xC2, 0x68, 0xBD,
-	0xE2, 0xB8, 0xB7, 0xB5, 0xFC, 0xB3, 0x31, 0xB3, 0x39, 0xB2, 0x89, 0xB1,
-	0x25, 0xB2, 0xB3, 0xB3, 0x5B, 0xB5, 0x6C, 0xB7, 0x3F, 0xBB, 0xE1, 0xC0,
-	0xCA, 0xC6, 0x4A, 0xCC, 0xF7, 0xD2, 0x5F, 0xDB, 0x94, 0xE3, 0xEC, 0xE9,
-	0xF0, 0xEF, 0x7D, 0xF7, 0x47, 0xFF, 0x67, 0x05, 0xBE, 0x0A, 0x3D, 0x11,
-	0x6E, 0x18, 0xC1, 0x1D, 0x66, 0x20, 0xB0, 0x22, 0xB8, 0x25, 0xA6, 0x27,
-	0x43, 0x27, 0x8B, 0x26, 0x40, 0x27, 0xC9, 0x27, 0x40, 0x26, 0xC5, 0x23,
-	0x28, 0x22, 0xB2, 0x20, 0x6C, 0x1D, 0xE1, 0x18, 0x20, 0x15, 0xC4, 0x12,
-	0x64, 0x10, 0x73, 0x0D, 0x69, 0x0B, 0xB7, 0x0A, 0xF6, 0x09, 0x62, 0x08,
-	0x52, 0x07, 0x6A, 0x07, 0x9D, 0x07, 0x75, 0x07, 0x94, 0x07, 0xA7, 0x08,
-	0x43, 0x0A, 0xBF, 0x0B, 0x4D, 0x0D, 0x5C, 0x0F, 0x6E, 0x11, 0xD8, 0x12,
-	0x99, 0x13, 0x92, 0x14, 0x7B, 0x15, 0x95, 0x15, 0x3D, 0x15, 0xFD, 0x14,
-	0x57, 0x14, 0xF3, 0x12, 0x0E, 0x11, 0x0D, 0x0F, 0xBA, 0x0C, 0xB6, 0x09,
-	0x0D, 0x06, 0x2F, 0x02, 0x61, 0xFE, 0x81, 0xFA, 0x5F, 0xF6, 0x94, 0xF2,
-	0x57, 0xEF, 0xFE, 0xEB, 0x56, 0xE8, 0xFB, 0xE4, 0x5B, 0xE2, 0xF9, 0xDF,
-	0xB7, 0xDD, 0x17, 0xDC, 0xAA, 0xDB, 0x04, 0xDC, 0xC7, 0xDC, 0x17, 0xDE,
-	0x68, 0xE0, 0x7A, 0xE3, 0xC8, 0xE6, 0x45, 0xEA, 0x3D, 0xEE, 0xB9, 0xF2,
-	0x2A, 0xF7, 0x87, 0xFB, 0x6C, 0x00, 0xFD, 0x05, 0x6F, 0x0B, 0x5C, 0x10,
-	0xF5, 0x14, 0xA4, 0x19, 0x38, 0x1E, 0xF8, 0x21, 0xCD, 0x24, 0x72, 0x27,
-	0x3A, 0x2A, 0x8F, 0x2C, 0x03, 0x2E, 0xE3, 0x2E, 0x80, 0x2F, 0xEC, 0x2E,
-	0xFD, 0x2C, 0xA7, 0x2A, 0x8E, 0x28, 0x52, 0x26, 0x52, 0x23, 0x40, 0x20,
-	0xCC, 0x1D, 0xA7, 0x1B, 0x9F, 0x18, 0xEA, 0x14, 0x9E, 0x11, 0x91, 0x0E,
-	0xD2, 0x0A, 0xEA, 0x06, 0x38, 0x04, 0xD3, 0x02, 0x76, 0x01, 0x49, 0x00,
-	0xE2, 0xFF, 0x53, 0x00, 0xA0, 0x00, 0x76, 0x00, 0x82, 0x00, 0x3F, 0x01,
-	0x85, 0x02, 0x95, 0x03, 0xA1, 0x04, 0x72, 0x06, 0x92, 0x08, 0x34, 0x0A,
-	0x41, 0x0B, 0x5C, 0x0C, 0x60, 0x0D, 0xD3, 0x0D, 0xA0, 0x0D, 0x4A, 0x0D,
-	0x09, 0x0D, 0x46, 0x0C, 0xAA, 0x0A, 0x7F, 0x08, 0x1A, 0x06, 0x26, 0x03,
-	0x5D, 0xFF, 0xF2, 0xFA, 0x5E, 0xF6, 0x98, 0xF1, 0x66, 0xEC, 0xD5, 0xE6,
-	0x31, 0xE1, 0x7C, 0xDB, 0x96, 0xD5, 0xB2, 0xCF, 0xF9, 0xC9, 0x40, 0xC4,
-	0x44, 0xBE, 0xEF, 0xB8, 0x7F, 0xB5, 0x8A, 0xB3, 0x81, 0xB1, 0x85, 0xAF,
-	0x58, 0xAF, 0x12, 0xB1, 0xD9, 0xB2, 0xF2, 0xB3, 0x54, 0xB6, 0x21, 0xBB,
-	0xB8, 0xC0, 0x3D, 0xC5, 0x3A, 0xCA, 0xBF, 0xD1, 0xAE, 0xDA, 0x21, 0xE2,
-	0x6F, 0xE8, 0x66, 0xF0, 0xC5, 0xF9, 0x87, 0x01, 0x51, 0x07, 0x94, 0x0D,
-	0xBA, 0x14, 0xEA, 0x1A, 0xD1, 0x1E, 0x28, 0x22, 0x26, 0x26, 0x74, 0x29,
-	0x98, 0x2A, 0xBF, 0x2A, 0x77, 0x2B, 0xD0, 0x2B, 0x4B, 0x2A, 0xD8, 0x27,
-	0x32, 0x26, 0x8E, 0x24, 0x7F, 0x21, 0xC2, 0x1D, 0xB0, 0x1A, 0xC3, 0x17,
-	0x68, 0x14, 0xBE, 0x10, 0xE2, 0x0D, 0xFD, 0x0B, 0x23, 0x0A, 0x21, 0x08,
-	0xFF, 0x06, 0xFC, 0x06, 0x3A, 0x07, 0x27, 0x07, 0x8E, 0x07, 0x7D, 0x08,
-	0x6E, 0x09, 0x70, 0x0A, 0xDC, 0x0B, 0xBC, 0x0D, 0xBE, 0x0F, 0xCE, 0x11,
-	0x97, 0x13, 0x57, 0x15, 0xCB, 0x16, 0x9A, 0x17, 0xD1, 0x17, 0xD4, 0x17,
-	0x59, 0x17, 0x27, 0x16, 0x91, 0x14, 0xED, 0x12, 0xB8, 0x10, 0xE3, 0x0D,
-	0x9B, 0x0A, 0x2E, 0x07, 0x78, 0x03, 0x3B, 0xFF, 0xCC, 0xFA, 0x6A, 0xF6,
-	0x2B, 0xF2, 0xF1, 0xED, 0xAF, 0xE9, 0xC7, 0xE5, 0x96, 0xE2, 0x9F, 0xDF,
-	0xD0, 0xDC, 0x9F, 0xDA, 0x6A, 0xD9, 0x86, 0xD8, 0x12, 0xD8, 0xA7, 0xD8,
-	0x98, 0xDA, 0x70, 0xDD, 0x79, 0xE0, 0xB9, 0xE3, 0x92, 0xE7, 0xED, 0xEB,
-	0x53, 0xF0, 0xBF, 0xF4, 0xDE, 0xF9, 0x94, 0xFF, 0x35, 0x05, 0xE2, 0x0A,
-	0x64, 0x11, 0x6E, 0x18, 0x1B, 0x1E, 0xE5, 0x21, 0xE6, 0x24, 0x02, 0x28,
-	0x03, 0x2B, 0x3C, 0x2D, 0x90, 0x2E, 0x92, 0x2F, 0x61, 0x30, 0x9B, 0x30,
-	0x25, 0x30, 0x59, 0x2F, 0xCD, 0x2D, 0xDB, 0x2A, 0xDF, 0x26, 0xAB, 0x22,
-	0x92, 0x1E, 0x88, 0x1A, 0xC4, 0x16, 0x31, 0x13, 0x9E, 0x0F, 0xFB, 0x0B,
-	0x90, 0x08, 0x7B, 0x05, 0x98, 0x02, 0xE9, 0xFF, 0xB5, 0xFD, 0x27, 0xFC,
-	0x3B, 0xFB, 0xC4, 0xFA, 0xD2, 0xFA, 0x7C, 0xFB, 0xA1, 0xFC, 0xDC, 0xFD,
-	0x2E, 0xFF, 0xEB, 0x00, 0xF7, 0x02, 0x0C, 0x05, 0x19, 0x07, 0x64, 0x09,
-	0xB0, 0x0B, 0xB3, 0x0D, 0x45, 0x0F, 0x82, 0x10, 0x2E, 0x11, 0x2B, 0x11,
-	0x62, 0x10, 0xFF, 0x0E, 0x0B, 0x0D, 0xC6, 0x0A, 0x02, 0x08, 0xC8, 0x04,
-	0x1C, 0x01, 0xCC, 0xFC, 0x85, 0xF7, 0x43, 0xF1, 0x50, 0xEA, 0x48, 0xE3,
-	0x5A, 0xDC, 0x44, 0xD5, 0x11, 0xCE, 0x1D, 0xC7, 0xF9, 0xC0, 0xB5, 0xBB,
-	0x25, 0xB7, 0x64, 0xB3, 0x69, 0xB0, 0x26, 0xAE, 0x73, 0xAC, 0x6C, 0xAB,
-	0x72, 0xAB, 0xE7, 0xAC, 0xEE, 0xAF, 0x10, 0xB4, 0xC4, 0xB8, 0x3F, 0xBE,
-	0xEE, 0xC4, 0x41, 0xCC, 0xB1, 0xD3, 0x71, 0xDB, 0x08, 0xE4, 0xD0, 0xEC,
-	0x07, 0xF5, 0x0B, 0xFD, 0x7D, 0x05, 0xE7, 0x0D, 0xC1, 0x14, 0x5C, 0x1A,
-	0xB1, 0x1F, 0xF6, 0x24, 0xB0, 0x28, 0xDF, 0x2A, 0xEB, 0x2C, 0x27, 0x2F,
-	0x15, 0x30, 0x3B, 0x2F, 0xDE, 0x2D, 0xAE, 0x2C, 0x8F, 0x2A, 0xC2, 0x26,
-	0x3A, 0x22, 0x60, 0x1E, 0xD0, 0x1A, 0x91, 0x16, 0x0F, 0x12, 0xAE, 0x0E,
-	0x42, 0x0C, 0x98, 0x09, 0xC0, 0x06, 0xAB, 0x04, 0x5C, 0x03, 0x2A, 0x02,
-	0x10, 0x01, 0xA7, 0x00, 0x36, 0x01, 0x76, 0x02, 0x03, 0x04, 0xD9, 0x05,
-	0x40, 0x08, 0x17, 0x0B, 0xF5, 0x0D, 0x78, 0x10, 0xD2, 0x12, 0x1B, 0x15,
-	0x2A, 0x17, 0xEF, 0x18, 0x1B, 0x1A, 0x0B, 0x1B, 0xBC, 0x1B, 0xE7, 0x1B,
-	0x16, 0x1B, 0x73, 0x19, 0x98, 0x17, 0x4B, 0x15, 0x5A, 0x12, 0xD5, 0x0E,
-	0x18, 0x0B, 0x1D, 0x07, 0xD6, 0x02, 0x2D, 0xFE, 0x4A, 0xF9, 0x87, 0xF4,
-	0xCC, 0xEF, 0x00, 0xEB, 0x77, 0xE6, 0x8B, 0xE2, 0x4E, 0xDF, 0xC2, 0xDC,
-	0x0E, 0xDB, 0x08, 0xDA, 0xA9, 0xD9, 0x04, 0xDA, 0xE7, 0xDA, 0xFE, 0xDB,
-	0x7B, 0xDD, 0xD8, 0xDF, 0x13, 0xE3, 0xC6, 0xE6, 0xE3, 0xEA, 0xE0, 0xEF,
-	0x7B, 0xF5, 0xF9, 0xFA, 0x4A, 0x00, 0xF7, 0x05, 0x2C, 0x0C, 0xF8, 0x11,
-	0xCF, 0x16, 0x7A, 0x1B, 0x4E, 0x20, 0x58, 0x24, 0x81, 0x27, 0x35, 0x2A,
-	0xA6, 0x2C, 0x71, 0x2E, 0x41, 0x2F, 0x73, 0x2F, 0x29, 0x2F, 0xDB, 0x2D,
-	0xBF, 0x2B, 0x86, 0x29, 0x2F, 0x27, 0x24, 0x24, 0x4E, 0x20, 0x33, 0x1C,
-	0x1D, 0x18, 0xD0, 0x13, 0x3E, 0x0F, 0x21, 0x0B, 0xA3, 0x07, 0x5A, 0x04,
-	0xF7, 0x00, 0xFD, 0xFD, 0x01, 0xFC, 0xA2, 0xFA, 0x48, 0xF9, 0x3D, 0xF8,
-	0xDE, 0xF7, 0x14, 0xF8, 0x51, 0xF8, 0xC2, 0xF8, 0xF3, 0xF9, 0xDA, 0xFB,
-	0xCB, 0xFD, 0xAE, 0xFF, 0xCC, 0x01, 0x01, 0x04, 0x00, 0x06, 0x6F, 0x07,
-	0x62, 0x08, 0x2E, 0x09, 0xAD, 0x09, 0x73, 0x09, 0x87, 0x08, 0x58, 0x07,
-	0xF7, 0x05, 0x9B, 0x03, 0x2D, 0x00, 0x15, 0xFC, 0xC1, 0xF7, 0xDF, 0xF2,
-	0x2C, 0xED, 0x29, 0xE7, 0xED, 0xE0, 0x6C, 0xDA, 0x11, 0xD4, 0x61, 0xCE,
-	0x81, 0xC9, 0xDC, 0xC4, 0x11, 0xC0, 0xFB, 0xBB, 0x15, 0xB9, 0xA4, 0xB6,
-	0x26, 0xB4, 0xE2, 0xB2, 0x04, 0xB4, 0x6E, 0xB6, 0x8B, 0xB8, 0x2C, 0xBB,
-	0xCB, 0xBF, 0xF9, 0xC5, 0xD9, 0xCB, 0x4C, 0xD1, 0x32, 0xD8, 0xA3, 0xE0,
-	0xA7, 0xE8, 0x5F, 0xEF, 0xA5, 0xF6, 0x59, 0xFF, 0xCE, 0x07, 0x67, 0x0E,
-	0x1B, 0x14, 0x42, 0x1A, 0xF0, 0x1F, 0xED, 0x23, 0xA4, 0x26, 0x6A, 0x29,
-	0xED, 0x2B, 0x15, 0x2D, 0xF6, 0x2C, 0x77, 0x2C, 0x91, 0x2B, 0x88, 0x29,
-	0x67, 0x26, 0x44, 0x23, 0xFD, 0x1F, 0x11, 0x1C, 0xFA, 0x17, 0x5A, 0x14,
-	0x04, 0x11, 0x70, 0x0D, 0xEF, 0x09, 0x2B, 0x07, 0xEE, 0x04, 0xBB, 0x02,
-	0xDC, 0x00, 0xE7, 0xFF, 0xC0, 0xFF, 0xA7, 0xFF, 0xCA, 0xFF, 0xF9, 0x00,
-	0x21, 0x03, 0x75, 0x05, 0x67, 0x07, 0xA5, 0x09, 0x6E, 0x0C, 0x03, 0x0F,
-	0x08, 0x11, 0xE7, 0x12, 0x18, 0x15, 0x43, 0x17, 0x9F, 0x18, 0x20, 0x19,
-	0x88, 0x19, 0xD1, 0x19, 0x3D, 0x19, 0xA2, 0x17, 0x8C, 0x15, 0x6A, 0x13,
-	0xF5, 0x10, 0x75, 0x0D, 0x68, 0x09, 0xAC, 0x05, 0x02, 0x02, 0xCA, 0xFD,
-	0x16, 0xF9, 0xD5, 0xF4, 0x11, 0xF1, 0x44, 0xED, 0x7B, 0xE9, 0x7A, 0xE6,
-	0x6D, 0xE4, 0xBA, 0xE2, 0x87, 0xE1, 0x0F, 0xE1, 0x4E, 0xE1, 0xEC, 0xE1,
-	0xCA, 0xE2, 0x6E, 0xE4, 0xF6, 0xE6, 0x21, 0xEA, 0x01, 0xEE, 0xEB, 0xF2,
-	0x6B, 0xF8, 0x9B, 0xFD, 0xA3, 0x02, 0x1F, 0x08, 0x98, 0x0D, 0x78, 0x12,
-	0x31, 0x17, 0x28, 0x1C, 0xAD, 0x20, 0xB3, 0x23, 0x0D, 0x26, 0x32, 0x29,
-	0x8D, 0x2C, 0x25, 0x2E, 0xF4, 0x2D, 0xBE, 0x2D, 0x9D, 0x2D, 0xE2, 0x2B,
-	0x63, 0x28, 0x2B, 0x25, 0xE7, 0x22, 0xD3, 0x1F, 0x1C, 0x1B, 0x32, 0x16,
-	0x97, 0x12, 0x21, 0x0F, 0x57, 0x0A, 0x5B, 0x05, 0xC4, 0x01, 0x19, 0xFF,
-	0xC2, 0xFB, 0x28, 0xF8, 0xFF, 0xF5, 0x69, 0xF5, 0xAC, 0xF4, 0x80, 0xF3,
-	0x53, 0xF3, 0x8D, 0xF4, 0x06, 0xF6, 0xCC, 0xF6, 0xD9, 0xF7, 0x21, 0xFA,
-	0xD3, 0xFC, 0xDB, 0xFE, 0xB1, 0x00, 0x15, 0x03, 0x8C, 0x05, 0xF6, 0x06,
-	0x41, 0x07, 0x5C, 0x07, 0x9E, 0x07, 0x1C, 0x07, 0x9E, 0x05, 0xDD, 0x03,
-	0xC2, 0x01, 0xA8, 0xFE, 0x50, 0xFA, 0x66, 0xF5, 0x63, 0xF0, 0xFC, 0xEA,
-	0xED, 0xE4, 0x7E, 0xDE, 0x4B, 0xD8, 0x6A, 0xD2, 0xBB, 0xCC, 0xAB, 0xC7,
-	0x61, 0xC3, 0x72, 0xBF, 0xFE, 0xBB, 0xF7, 0xB8, 0xAA, 0xB6, 0x55, 0xB5,
-	0x1A, 0xB5, 0x4E, 0xB6, 0xCB, 0xB8, 0x54, 0xBC, 0x93, 0xC0, 0x6B, 0xC5,
-	0x3B, 0xCB, 0xB2, 0xD1, 0x83, 0xD8, 0x82, 0xDF, 0x07, 0xE7, 0x39, 0xEF,
-	0x60, 0xF7, 0xDC, 0xFE, 0xC5, 0x05, 0xF3, 0x0C, 0x2F, 0x14, 0x94, 0x1A,
-	0xAE, 0x1F, 0x25, 0x24, 0x7C, 0x28, 0xE3, 0x2B, 0x9C, 0x2D, 0x2D, 0x2E,
-	0x67, 0x2E, 0x4E, 0x2E, 0xCB, 0x2C, 0x42, 0x2A, 0xD2, 0x27, 0xA6, 0x25,
-	0x9B, 0x22, 0x42, 0x1E, 0xD3, 0x19, 0x12, 0x16, 0xA3, 0x12, 0x9B, 0x0E,
-	0x8B, 0x0A, 0x56, 0x07, 0xCF, 0x04, 0xAD, 0x02, 0xD3, 0x00, 0xBD, 0xFF,
-	0x85, 0xFF, 0x71, 0xFF, 0x2F, 0xFF, 0xBD, 0xFF, 0x78, 0x01, 0xE5, 0x03,
-	0x31, 0x06, 0x4E, 0x08, 0xE1, 0x0A, 0x9D, 0x0D, 0xCE, 0x0F, 0x99, 0x11,
-	0x79, 0x13, 0x7A, 0x15, 0x09, 0x17, 0xDE, 0x17, 0x51, 0x18, 0x9E, 0x18,
-	0x2A, 0x18, 0xCC, 0x16, 0xD1, 0x14, 0x8B, 0x12, 0xCE, 0x0F, 0x67, 0x0C,
-	0x95, 0x08, 0xA7, 0x04, 0xC2, 0x00, 0x99, 0xFC, 0x33, 0xF8, 0x17, 0xF4,
-	0x45, 0xF0, 0xAE, 0xEC, 0x54, 0xE9, 0x6C, 0xE6, 0x38, 0xE4, 0xA1, 0xE2,
-	0xB7, 0xE1, 0x47, 0xE1, 0x53, 0xE1, 0x0B, 0xE2, 0xCB, 0xE3, 0x42, 0xE6,
-	0xFB, 0xE8, 0x60, 0xEC, 0x78, 0xF0, 0xD8, 0xF4, 0x6D, 0xF9, 0xAC, 0xFE,
-	0xB9, 0x04, 0xB2, 0x0A, 0x9D, 0x0F, 0xEA, 0x13, 0xED, 0x18, 0x1C, 0x1E,
-	0x4D, 0x22, 0xAA, 0x25, 0x22, 0x29, 0x2F, 0x2C, 0x65, 0x2D, 0x46, 0x2D,
-	0x79, 0x2D, 0x10, 0x2E, 0x78, 0x2D, 0x4E, 0x2B, 0xC8, 0x28, 0xA4, 0x26,
-	0xBB, 0x23, 0x8E, 0x1F, 0x48, 0x1B, 0xBD, 0x17, 0x0E, 0x14, 0x70, 0x0F,
-	0xA7, 0x0A, 0x06, 0x07, 0x4E, 0x04, 0x4B, 0x01, 0xF0, 0xFD, 0xB3, 0xFB,
-	0x8A, 0xFA, 0x8B, 0xF9, 0x28, 0xF8, 0x5A, 0xF7, 0xD1, 0xF7, 0xB5, 0xF8,
-	0x38, 0xF9, 0x0B, 0xFA, 0xB3, 0xFB, 0xCA, 0xFD, 0x65, 0xFF, 0x71, 0x00,
-	0xB0, 0x01, 0x41, 0x03, 0x3F, 0x04, 0x6A, 0x04, 0x58, 0x04, 0x35, 0x04,
-	0x53, 0x03, 0x10, 0x01, 0x18, 0xFE, 0xFD, 0xFA, 0x60, 0xF7, 0xEC, 0xF2,
-	0x12, 0xEE, 0x50, 0xE9, 0x65, 0xE4, 0xA6, 0xDE, 0x85, 0xD8, 0x07, 0xD3,
-	0x66, 0xCE, 0x83, 0xC9, 0x23, 0xC4, 0x7E, 0xBF, 0x38, 0xBC, 0x5F, 0xB9,
-	0x89, 0xB6, 0x18, 0xB5, 0xA4, 0xB5, 0x52, 0xB7, 0xF6, 0xB8, 0x11, 0xBB,
-	0x6F, 0xBE, 0x02, 0xC3, 0xE6, 0xC7, 0xFF, 0xCC, 0xA7, 0xD2, 0x7F, 0xD9,
-	0x15, 0xE1, 0x94, 0xE8, 0xFD, 0xEF, 0x99, 0xF7, 0x2D, 0xFF, 0xF8, 0x05,
-	0xB6, 0x0B, 0x5C, 0x11, 0x41, 0x17, 0x53, 0x1C, 0x24, 0x20, 0x33, 0x23,
-	0xD5, 0x25, 0xF0, 0x27, 0x2C, 0x29, 0x2A, 0x29, 0x3E, 0x28, 0x05, 0x27,
-	0x6D, 0x25, 0x27, 0x23, 0x1F, 0x20, 0x25, 0x1D, 0xA0, 0x1A, 0xF2, 0x17,
-	0xA9, 0x14, 0x5C, 0x11, 0xC2, 0x0E, 0x9F, 0x0C, 0x2A, 0x0A, 0x88, 0x07,
-	0xDF, 0x05, 0x7F, 0x05, 0x6B, 0x05, 0xE8, 0x04, 0x25, 0x05, 0xDB, 0x06,
-	0xFD, 0x08, 0x91, 0x0A, 0xFF, 0x0B, 0x2F, 0x0E, 0x92, 0x10, 0x0D, 0x12,
-	0xF8, 0x12, 0x5B, 0x14, 0x84, 0x16, 0x49, 0x18, 0x11, 0x19, 0x8F, 0x19,
-	0x1A, 0x1A, 0xEC, 0x19, 0x5A, 0x18, 0x03, 0x16, 0xE2, 0x13, 0xBE, 0x11,
-	0xA8, 0x0E, 0xE3, 0x0A, 0x43, 0x07, 0xF7, 0x03, 0x3F, 0x00, 0xD7, 0xFB,
-	0x83, 0xF7, 0xCA, 0xF3, 0x57, 0xF0, 0xC0, 0xEC, 0x6A, 0xE9, 0xC9, 0xE6,
-	0x1E, 0xE5, 0x05, 0xE4, 0x0D, 0xE3, 0xCB, 0xE2, 0x9D, 0xE3, 0x6D, 0xE5,
-	0x58, 0xE7, 0x76, 0xE9, 0x3F, 0xEC, 0xDB, 0xEF, 0x77, 0xF3, 0x03, 0xF7,
-	0x84, 0xFB, 0x02, 0x01, 0x29, 0x06, 0x2E, 0x0A, 0xF2, 0x0D, 0x23, 0x12,
-	0x26, 0x16, 0x3F, 0x19, 0x1A, 0x1C, 0xC9, 0x1F, 0x3B, 0x23, 0xAD, 0x24,
-	0x62, 0x24, 0x30, 0x24, 0x74, 0x24, 0xC6, 0x23, 0x7E, 0x21, 0x59, 0x1F,
-	0x26, 0x1E, 0x5B, 0x1C, 0x29, 0x19, 0xE5, 0x15, 0xF1, 0x13, 0xDB, 0x11,
-	0x5D, 0x0E, 0x73, 0x0A, 0xAE, 0x07, 0xC0, 0x05, 0x4B, 0x03, 0xAF, 0x00,
-	0x77, 0xFF, 0x9E, 0xFF, 0x9D, 0xFF, 0x0D, 0xFF, 0x00, 0xFF, 0x01, 0x00,
-	0xFD, 0x00, 0x1D, 0x01, 0x70, 0x01, 0xE2, 0x02, 0xC0, 0x04, 0xE3, 0x05,
-	0x68, 0x06, 0x45, 0x07, 0x60, 0x08, 0xB3, 0x08, 0x20, 0x08, 0x60, 0x07,
-	0xBD, 0x06, 0x2A, 0x05, 0x47, 0x02, 0xB1, 0xFE, 0x1E, 0xFB, 0x2B, 0xF7,
-	0x87, 0xF2, 0x8D, 0xED, 0xD8, 0xE8, 0x14, 0xE4, 0xAA, 0xDE, 0xFC, 0xD8,
-	0xCC, 0xD3, 0x58, 0xCF, 0x23, 0xCB, 0xEB, 0xC6, 0x4D, 0xC3, 0xAF, 0xC0,
-	0x7E, 0xBE, 0x3E, 0xBC, 0xD2, 0xBA, 0x46, 0xBB, 0x2D, 0xBD, 0x31, 0xBF,
-	0x48, 0xC1, 0xA2, 0xC4, 0x62, 0xC9, 0x48, 0xCE, 0xE1, 0xD2, 0x39, 0xD8,
-	0xBC, 0xDE, 0x41, 0xE5, 0xBB, 0xEA, 0xF6, 0xEF, 0x40, 0xF6, 0xDF, 0xFC,
-	0x73, 0x02, 0x0D, 0x07, 0x0F, 0x0C, 0x33, 0x11, 0x0E, 0x15, 0x77, 0x17,
-	0xB8, 0x19, 0x1D, 0x1C, 0x60, 0x1D, 0x65, 0x1D, 0x3A, 0x1D, 0x0D, 0x1D,
-	0x00, 0x1C, 0x2E, 0x1A, 0x5F, 0x18, 0xC2, 0x16, 0xBE, 0x14, 0x69, 0x12,
-	0x8E, 0x10, 0x37, 0x0F, 0x96, 0x0D, 0x8E, 0x0B, 0xA6, 0x09, 0x70, 0x08,
-	0x94, 0x07, 0xAC, 0x06, 0x71, 0x06, 0x11, 0x07, 0xF7, 0x07, 0xB9, 0x08,
-	0xEB, 0x09, 0xC8, 0x0B, 0x02, 0x0E, 0xDD, 0x0F, 0x5A, 0x11, 0xD3, 0x12,
-	0x30, 0x14, 0x3F, 0x15, 0xD4, 0x15, 0x3E, 0x16, 0xF2, 0x16, 0xAB, 0x17,
-	0x9F, 0x17, 0xE7, 0x16, 0xFB, 0x15, 0xFD, 0x14, 0x30, 0x13, 0x5B, 0x10,
-	0x7A, 0x0D, 0xE9, 0x0A, 0x0C, 0x08, 0x8D, 0x04, 0x16, 0x01, 0x2E, 0xFE,
-	0xB5, 0xFB, 0xF8, 0xF8, 0x3E, 0xF6, 0xEC, 0xF3, 0xFC, 0xF1, 0x37, 0xF0,
-	0x88, 0xEE, 0x57, 0xED, 0xDA, 0xEC, 0xCB, 0xEC, 0x31, 0xED, 0x2F, 0xEE,
-	0xC3, 0xEF, 0xA9, 0xF1, 0xB2, 0xF3, 0xF4, 0xF5, 0xCE, 0xF8, 0x34, 0xFC,
-	0x1A, 0x00, 0xF9, 0x03, 0x7F, 0x07, 0x12, 0x0B, 0x04, 0x0F, 0x8D, 0x12,
-	0xEA, 0x14, 0xAC, 0x16, 0x03, 0x19, 0xF1, 0x1B, 0xC6, 0x1D, 0x47, 0x1E,
-	0xE9, 0x1E, 0x2C, 0x20, 0x69, 0x20, 0xF6, 0x1E, 0x60, 0x1D, 0x90, 0x1C,
-	0x40, 0x1B, 0x52, 0x18, 0x1C, 0x15, 0xF9, 0x12, 0x1D, 0x11, 0x58, 0x0E,
-	0x4D, 0x0B, 0x50, 0x09, 0xFE, 0x07, 0x38, 0x06, 0xFE, 0x03, 0x4D, 0x02,
-	0x94, 0x01, 0xE8, 0x00, 0xD8, 0xFF, 0x56, 0xFF, 0xC1, 0xFF, 0x61, 0x00,
-	0xAE, 0x00, 0x06, 0x01, 0xF5, 0x01, 0x33, 0x03, 0x09, 0x04, 0x74, 0x04,
-	0xD7, 0x04, 0x21, 0x05, 0xE8, 0x04, 0x4A, 0x04, 0x9E, 0x03, 0xD6, 0x02,
-	0x9B, 0x01, 0xAE, 0xFF, 0x17, 0xFD, 0x09, 0xFA, 0x68, 0xF6, 0x4B, 0xF2,
-	0x0E, 0xEE, 0xC9, 0xE9, 0x77, 0xE5, 0x32, 0xE1, 0x12, 0xDD, 0x22, 0xD9,
-	0x0E, 0xD5, 0xFC, 0xD0, 0x45, 0xCD, 0x2F, 0xCA, 0x8D, 0xC7, 0x83, 0xC5,
-	0x35, 0xC4, 0xB1, 0xC3, 0xF9, 0xC3, 0x3B, 0xC5, 0x6D, 0xC7, 0x08, 0xCA,
-	0xC0, 0xCC, 0xEA, 0xCF, 0x8E, 0xD3, 0xA1, 0xD7, 0xFC, 0xDB, 0xF9, 0xE0,
-	0x84, 0xE6, 0x44, 0xEC, 0x8E, 0xF1, 0xB8, 0xF6, 0x23, 0xFC, 0x26, 0x01,
-	0x2C, 0x05, 0xDA, 0x08, 0xA3, 0x0C, 0x00, 0x10, 0x3A, 0x12, 0xCF, 0x13,
-	0x43, 0x15, 0x62, 0x16, 0xD2, 0x16, 0xD9, 0x16, 0xEB, 0x16, 0xBF, 0x16,
-	0xFA, 0x15, 0xD2, 0x14, 0x7B, 0x13, 0xA3, 0x11, 0x75, 0x0F, 0x96, 0x0D,
-	0x6F, 0x0C, 0xBB, 0x0B, 0x0F, 0x0B, 0x67, 0x0A, 0x01, 0x0A, 0xDD, 0x09,
-	0xDF, 0x09, 0x25, 0x0A, 0xC1, 0x0A, 0xA2, 0x0B, 0x7A, 0x0C, 0x6A, 0x0D,
-	0xD8, 0x0E, 0x60, 0x10, 0xCA, 0x11, 0x40, 0x13, 0x8F, 0x14, 0x57, 0x15,
-	0x9A, 0x15, 0xEB, 0x15, 0x3D, 0x16, 0x29, 0x16, 0x95, 0x15, 0x00, 0x15,
-	0x44, 0x14, 0xCA, 0x12, 0xA7, 0x10, 0x49, 0x0E, 0xCB, 0x0B, 0x09, 0x09,
-	0xFB, 0x05, 0xFC, 0x02, 0x5B, 0x00, 0xEF, 0xFD, 0x7E, 0xFB, 0x12, 0xF9,
-	0x0A, 0xF7, 0x4F, 0xF5, 0xA0, 0xF3, 0x44, 0xF2, 0x5F, 0xF1, 0xFC, 0xF0,
-	0x01, 0xF1, 0x84, 0xF1, 0x6C, 0xF2, 0xA1, 0xF3, 0x62, 0xF5, 0xD4, 0xF7,
-	0x71, 0xFA, 0xE7, 0xFC, 0x53, 0xFF, 0xED, 0x01, 0xC1, 0x04, 0xBC, 0x07,
-	0xD4, 0x0A, 0xE0, 0x0D, 0x7A, 0x10, 0x4F, 0x12, 0x76, 0x13, 0x63, 0x14,
-	0xC4, 0x15, 0x8D, 0x17, 0x05, 0x19, 0x61, 0x19, 0xDF, 0x18, 0x2E, 0x18,
-	0x2F, 0x17, 0xBA, 0x15, 0xFE, 0x13, 0xE6, 0x12, 0xC1, 0x11, 0x04, 0x10,
-	0xFB, 0x0D, 0xA0, 0x0C, 0xCA, 0x0B, 0x9D, 0x0A, 0x0D, 0x09, 0xEB, 0x07,
-	0x72, 0x07, 0xA6, 0x06, 0x86, 0x05, 0xE6, 0x04, 0x2E, 0x05, 0x7D, 0x05,
-	0x7D, 0x05, 0xD7, 0x05, 0xEE, 0x06, 0x08, 0x08, 0x6C, 0x08, 0x8B, 0x08,
-	0x08, 0x09, 0x8D, 0x09, 0xA1, 0x09, 0x3F, 0x09, 0xC8, 0x08, 0x49, 0x08,
-	0x47, 0x07, 0xD5, 0x05, 0x3E, 0x04, 0xA1, 0x02, 0xAF, 0x00, 0x1B, 0xFE,
-	0xE4, 0xFA, 0x11, 0xF7, 0xB5, 0xF2, 0x5A, 0xEE, 0x1C, 0xEA, 0xEA, 0xE5,
-	0xF5, 0xE1, 0x2D, 0xDE, 0x99, 0xDA, 0x23, 0xD7, 0xCE, 0xD3, 0xCE, 0xD0,
-	0x17, 0xCE, 0xEA, 0xCB, 0x25, 0xCA, 0xDA, 0xC8, 0x24, 0xC8, 0x33, 0xC8,
-	0xF5, 0xC8, 0xCA, 0xCA, 0xB5, 0xCD, 0xE7, 0xD0, 0x80, 0xD3, 0x15, 0xD6,
-	0xA4, 0xD9, 0xBF, 0xDD, 0x5E, 0xE1, 0xCD, 0xE4, 0x41, 0xE9, 0x83, 0xEE,
-	0xFB, 0xF2, 0x45, 0xF6, 0x23, 0xFA, 0xE2, 0xFE, 0x89, 0x02, 0x15, 0x04,
-	0x65, 0x05, 0x0D, 0x08, 0xD7, 0x0A, 0xB1, 0x0B, 0x93, 0x0B, 0x9B, 0x0C,
-	0x62, 0x0E, 0xC1, 0x0E, 0x4B, 0x0D, 0xA0, 0x0C, 0xBE, 0x0D, 0x78, 0x0E,
-	0x12, 0x0D, 0x7A, 0x0B, 0xC8, 0x0B, 0xC8, 0x0C, 0x33, 0x0C, 0xED, 0x0A,
-	0x5A, 0x0B, 0x39, 0x0D, 0xD9, 0x0D, 0x05, 0x0D, 0x88, 0x0D, 0x15, 0x10,
-	0xE8, 0x11, 0xA8, 0x11, 0x53, 0x11, 0xE0, 0x12, 0xC8, 0x14, 0xDB, 0x14,
-	0x49, 0x14, 0x07, 0x15, 0x60, 0x16, 0x24, 0x16, 0x5B, 0x14, 0x51, 0x13,
-	0x5C, 0x13, 0x7E, 0x12, 0x12, 0x10, 0xEC, 0x0D, 0xE2, 0x0C, 0x87, 0x0B,
-	0xD1, 0x08, 0xB1, 0x05, 0x79, 0x03, 0x9B, 0x01, 0x10, 0xFF, 0x4B, 0xFC,
-	0x76, 0xFA, 0x73, 0xF9, 0x37, 0xF8, 0xBB, 0xF6, 0xAE, 0xF5, 0x3D, 0xF5,
-	0xE1, 0xF4, 0xB1, 0xF4, 0x04, 0xF5, 0xCB, 0xF5, 0x90, 0xF6, 0x39, 0xF7,
-	0x42, 0xF8, 0xD4, 0xF9, 0x91, 0xFB, 0x0C, 0xFD, 0x9D, 0xFE, 0xAA, 0x00,
-	0xB4, 0x02, 0x47, 0x04, 0xE8, 0x05, 0x39, 0x08, 0x1D, 0x0B, 0xED, 0x0D,
-	0x0B, 0x10, 0xBF, 0x10, 0xA3, 0x10, 0xC6, 0x10, 0x6F, 0x11, 0x0E, 0x12,
-	0x8F, 0x12, 0x31, 0x13, 0xBF, 0x13, 0xCD, 0x13, 0x6B, 0x13, 0xF0, 0x12,
-	0x84, 0x12, 0x16, 0x12, 0x3A, 0x11, 0x0E, 0x10, 0x14, 0x0F, 0x5B, 0x0E,
-	0x7D, 0x0D, 0xAE, 0x0C, 0x50, 0x0C, 0x52, 0x0C, 0x33, 0x0C, 0xE7, 0x0B,
-	0xBA, 0x0B, 0x9D, 0x0B, 0x44, 0x0B, 0xC3, 0x0A, 0x79, 0x0A, 0xA0, 0x0A,
-	0xD7, 0x0A, 0xAB, 0x0A, 0x4F, 0x0A, 0x12, 0x0A, 0xF5, 0x09, 0xBA, 0x09,
-	0x32, 0x09, 0x8C, 0x08, 0xC7, 0x07, 0x8C, 0x06, 0x7D, 0x04, 0x26, 0x02,
-	0x4A, 0x00, 0x95, 0xFE, 0x61, 0xFC, 0xC2, 0xF9, 0xF2, 0xF6, 0xC8, 0xF3,
-	0xFA, 0xEF, 0xD4, 0xEB, 0xE9, 0xE7, 0x93, 0xE4, 0xA7, 0xE1, 0xB2, 0xDE,
-	0xAB, 0xDB, 0xDA, 0xD8, 0x5E, 0xD6, 0x21, 0xD4, 0x21, 0xD2, 0x45, 0xD0,
-	0x8B, 0xCE, 0x9A, 0xCD, 0x3F, 0xCD, 0x31, 0xCD, 0xD0, 0xCD, 0xC0, 0xCF,
-	0xB9, 0xD2, 0x58, 0xD5, 0x70, 0xD7, 0x1F, 0xDA, 0x97, 0xDD, 0xCB, 0xE0,
-	0x4E, 0xE3, 0x26, 0xE6, 0xDD, 0xE9, 0xFB, 0xED, 0x9F, 0xF1, 0x0E, 0xF5,
-	0xA7, 0xF8, 0x11, 0xFC, 0x9D, 0xFE, 0xE6, 0x00, 0x61, 0x03, 0x78, 0x05,
-	0xB0, 0x06, 0xA8, 0x07, 0xCA, 0x08, 0x9B, 0x09, 0xEB, 0x09, 0x70, 0x0A,
-	0x3C, 0x0B, 0x97, 0x0B, 0x3A, 0x0B, 0x26, 0x0B, 0xC0, 0x0B, 0xE3, 0x0B,
-	0x39, 0x0B, 0x27, 0x0B, 0x52, 0x0C, 0x58, 0x0D, 0x2B, 0x0D, 0xF2, 0x0C,
-	0x0C, 0x0E, 0x58, 0x0F, 0x6F, 0x0F, 0x5D, 0x0F, 0xEA, 0x10, 0x0E, 0x13,
-	0xA4, 0x13, 0x55, 0x13, 0x4E, 0x14, 0x3A, 0x16, 0xAB, 0x16, 0x72, 0x15,
-	0xE2, 0x14, 0x79, 0x15, 0x19, 0x15, 0xDF, 0x12, 0xF1, 0x10, 0xBE, 0x10,
-	0x7B, 0x10, 0x98, 0x0E, 0x40, 0x0C, 0x1E, 0x0B, 0x36, 0x0A, 0xB8, 0x07,
-	0x20, 0x04, 0x4A, 0x01, 0xBF, 0xFF, 0xF2, 0xFD, 0x61, 0xFB, 0x60, 0xF9,
-	0xFD, 0xF8, 0xEF, 0xF8, 0x0D, 0xF8, 0x0D, 0xF7, 0x37, 0xF7, 0xF5, 0xF7,
-	0xD0, 0xF7, 0x30, 0xF7, 0x9E, 0xF7, 0x45, 0xF9, 0xFC, 0xFA, 0x35, 0xFC,
-	0xCB, 0xFD, 0x7A, 0x00, 0x3E, 0x03, 0xF9, 0x04, 0x36, 0x06, 0x8B, 0x07,
-	0xEE, 0x08, 0xF2, 0x09, 0xF8, 0x0A, 0x47, 0x0C, 0xBA, 0x0D, 0xC5, 0x0E,
-	0x41, 0x0F, 0x6A, 0x0F, 0xE2, 0x0F, 0xC8, 0x10, 0x48, 0x11, 0x92, 0x10,
-	0x4B, 0x0F, 0x8F, 0x0E, 0x13, 0x0E, 0x2F, 0x0D, 0xEF, 0x0B, 0x97, 0x0B,
-	0x10, 0x0C, 0x1F, 0x0C, 0x65, 0x0B, 0xFE, 0x0A, 0x5A, 0x0B, 0x8E, 0x0B,
-	0x1F, 0x0B, 0xB1, 0x0A, 0xF8, 0x0A, 0x97, 0x0B, 0xA9, 0x0B, 0x82, 0x0B,
-	0x10, 0x0C, 0x11, 0x0D, 0x9F, 0x0D, 0x87, 0x0D, 0xBC, 0x0D, 0x35, 0x0E,
-	0x03, 0x0E, 0x04, 0x0D, 0x2A, 0x0C, 0xAA, 0x0B, 0xED, 0x0A, 0x95, 0x09,
-	0xEA, 0x07, 0x4E, 0x06, 0xA5, 0x04, 0x7A, 0x02, 0x06, 0x00, 0xD4, 0xFD,
-	0xDC, 0xFB, 0x70, 0xF9, 0x57, 0xF6, 0x07, 0xF3, 0xB8, 0xEF, 0x18, 0xEC,
-	0x2F, 0xE8, 0x9A, 0xE4, 0xAE, 0xE1, 0x19, 0xDF, 0xD8, 0xDC, 0x40, 0xDB,
-	0x1B, 0xDA, 0x2F, 0xD9, 0x0F, 0xD8, 0x04, 0xD7, 0xEE, 0xD5, 0xDC, 0xD4,
-	0x12, 0xD4, 0xEE, 0xD3, 0x5C, 0xD4, 0x53, 0xD5, 0x32, 0xD7, 0xE5, 0xD9,
-	0x8F, 0xDC, 0xB7, 0xDE, 0xE6, 0xE0, 0x9E, 0xE3, 0x88, 0xE6, 0xAA, 0xE8,
-	0x63, 0xEA, 0xF0, 0xEC, 0x70, 0xF0, 0x52, 0xF3, 0x04, 0xF5, 0x79, 0xF7,
-	0x1C, 0xFB, 0xBA, 0xFD, 0x5E, 0xFE, 0x6E, 0xFF, 0xAA, 0x02, 0x71, 0x05,
-	0xA1, 0x05, 0x00, 0x05, 0x95, 0x06, 0x16, 0x09, 0xA7, 0x09, 0xDF, 0x08,
-	0xB4, 0x09, 0x2E, 0x0C, 0x7C, 0x0D, 0x96, 0x0C, 0x88, 0x0C, 0xCC, 0x0E,
-	0xE0, 0x10, 0xBB, 0x10, 0xF7, 0x0F, 0x11, 0x11, 0x05, 0x13, 0x09, 0x13,
-	0x83, 0x11, 0xA1, 0x11, 0x57, 0x13, 0xD1, 0x13, 0x5F, 0x12, 0x93, 0x11,
-	0xA6, 0x12, 0x8B, 0x13, 0x90, 0x12, 0xFB, 0x10, 0xAB, 0x10, 0xBE, 0x10,
-	0x19, 0x0F, 0x86, 0x0C, 0x10, 0x0B, 0xCB, 0x0A, 0xCE, 0x09, 0xD9, 0x07,
-	0x81, 0x06, 0x4F, 0x06, 0x21, 0x06, 0x04, 0x05, 0x4C, 0x03, 0x0D, 0x02,
-	0x52, 0x01, 0x50, 0x00, 0x00, 0xFF, 0x38, 0xFE, 0x1D, 0xFE, 0x20, 0xFE,
-	0xEA, 0xFD, 0xBD, 0xFD, 0xF0, 0xFD, 0x94, 0xFE, 0xF3, 0xFE, 0xA4, 0xFE,
-	0x10, 0xFE, 0x12, 0xFE, 0xAF, 0xFE, 0xE4, 0xFE, 0x0F, 0xFF, 0x86, 0xFF,
-	0x5E, 0x00, 0xCD, 0x01, 0x93, 0x04, 0xE7, 0x07, 0x41, 0x0A, 0x2A, 0x0B,
-	0x2A, 0x0B, 0x18, 0x0B, 0xDB, 0x0A, 0xE1, 0x0A, 0xC0, 0x0B, 0x91, 0x0D,
-	0xB3, 0x0F, 0x88, 0x11, 0x3F, 0x13, 0xFB, 0x14, 0x18, 0x16, 0xFA, 0x15,
-	0xFB, 0x14, 0xA0, 0x13, 0xED, 0x11, 0x30, 0x10, 0xE3, 0x0E, 0x85, 0x0E,
-	0xE2, 0x0E, 0x1C, 0x0F, 0xE2, 0x0E, 0xD7, 0x0E, 0xB2, 0x0E, 0x9A, 0x0D,
-	0x81, 0x0B, 0x58, 0x09, 0xDB, 0x07, 0xC5, 0x06, 0xAE, 0x05, 0x23, 0x05,
-	0x6B, 0x05, 0xF4, 0x05, 0x21, 0x06, 0xF1, 0x05, 0xE3, 0x05, 0xC8, 0x05,
-	0x25, 0x05, 0xDA, 0x03, 0x90, 0x02, 0x9C, 0x01, 0xC4, 0x00, 0x12, 0x00,
-	0xBF, 0xFF, 0x91, 0xFF, 0x27, 0xFF, 0xE2, 0xFD, 0xC4, 0xFB, 0x03, 0xF9,
-	0xF0, 0xF5, 0x22, 0xF3, 0x84, 0xF0, 0xBD, 0xED, 0xCF, 0xEA, 0xD4, 0xE7,
-	0x28, 0xE5, 0x98, 0xE2, 0x47, 0xE0, 0x2D, 0xDE, 0x00, 0xDC, 0xA0, 0xD9,
-	0x86, 0xD7, 0xFB, 0xD5, 0x11, 0xD5, 0xBE, 0xD4, 0xF5, 0xD4, 0xC8, 0xD5,
-	0xEA, 0xD6, 0xFC, 0xD7, 0x35, 0xD9, 0xCB, 0xDA, 0xAB, 0xDC, 0x22, 0xDF,
-	0xE4, 0xE1, 0xE8, 0xE4, 0x33, 0xE8, 0xD5, 0xEB, 0x8E, 0xEF, 0xBD, 0xF2,
-	0x1B, 0xF5, 0xF4, 0xF6, 0x2B, 0xF9, 0xD1, 0xFB, 0x5C, 0xFE, 0x53, 0x00,
-	0x04, 0x02, 0xCB, 0x03, 0x64, 0x05, 0xFD, 0x05, 0x46, 0x06, 0x49, 0x07,
-	0x42, 0x08, 0xDE, 0x07, 0xD0, 0x06, 0xD7, 0x06, 0x84, 0x07, 0xB8, 0x07,
-	0xA1, 0x07, 0x1B, 0x08, 0x1E, 0x09, 0xEB, 0x09, 0xF8, 0x09, 0x17, 0x0A,
-	0x39, 0x0B, 0xC6, 0x0C, 0x5F, 0x0D, 0x23, 0x0D, 0xAA, 0x0D, 0x52, 0x0F,
-	0xB5, 0x10, 0x51, 0x11, 0x07, 0x12, 0x11, 0x13, 0xA4, 0x13, 0x56, 0x13,
-	0xDE, 0x12, 0xBB, 0x12, 0x4F, 0x12, 0x07, 0x11, 0x82, 0x0F, 0xA5, 0x0E,
-	0x3C, 0x0E, 0x83, 0x0D, 0x05, 0x0C, 0x30, 0x0A, 0x6D, 0x08, 0xB1, 0x06,
-	0xA2, 0x04, 0xAA, 0x02, 0xA3, 0x01, 0xAE, 0x00, 0x42, 0xFF, 0x9F, 0xFD,
-	0xBE, 0xFC, 0xB5, 0xFC, 0xEC, 0xFC, 0xE0, 0xFC, 0xA3, 0xFC, 0xB4, 0xFC,
-	0x18, 0xFD, 0x3F, 0xFD, 0x4B, 0xFD, 0xF7, 0xFD, 0x91, 0xFF, 0x11, 0x01,
-	0xE2, 0x01, 0xD6, 0x02, 0x62, 0x04, 0xE5, 0x05, 0xBC, 0x06, 0xF4, 0x06,
-	0x20, 0x07, 0xE0, 0x07, 0xF3, 0x08, 0xE5, 0x09, 0xBB, 0x0A, 0x7E, 0x0B,
-	0xA2, 0x0B, 0xA7, 0x0B, 0x08, 0x0C, 0xDD, 0x0C, 0x7C, 0x0D, 0x44, 0x0D,
-	0xBE, 0x0C, 0x55, 0x0C, 0xA6, 0x0B, 0xDE, 0x0A, 0x90, 0x0A, 0x3F, 0x0B,
-	0xF1, 0x0B, 0x05, 0x0C, 0xFE, 0x0B, 0x19, 0x0C, 0x2E, 0x0C, 0x24, 0x0C,
-	0x33, 0x0C, 0x3B, 0x0C, 0x18, 0x0C, 0xE7, 0x0B, 0xE2, 0x0B, 0x3E, 0x0C,
-	0x7E, 0x0C, 0x61, 0x0C, 0x23, 0x0C, 0xF6, 0x0B, 0xD0, 0x0B, 0x39, 0x0B,
-	0x52, 0x0A, 0x5D, 0x09, 0x85, 0x08, 0x65, 0x07, 0x0C, 0x06, 0xD4, 0x04,
-	0xB0, 0x03, 0x56, 0x02, 0x85, 0x00, 0xAF, 0xFE, 0x27, 0xFD, 0xD3, 0xFB,
-	0xA4, 0xFA, 0x3F, 0xF9, 0x8C, 0xF7, 0x83, 0xF5, 0x1B, 0xF3, 0x32, 0xF0,
-	0x63, 0xED, 0xF9, 0xEA, 0xA0, 0xE8, 0x2C, 0xE6, 0xFD, 0xE3, 0x36, 0xE2,
-	0xD3, 0xE0, 0x1A, 0xE0, 0xE9, 0xDF, 0x57, 0xDF, 0x0D, 0xDE, 0xA1, 0xDC,
-	0x96, 0xDB, 0xAC, 0xDA, 0x11, 0xDA, 0x67, 0xDA, 0x95, 0xDB, 0xF6, 0xDC,
-	0x67, 0xDE, 0xA3, 0xE0, 0x53, 0xE3, 0x8B, 0xE5, 0xFE, 0xE6, 0x70, 0xE8,
-	0x74, 0xEA, 0x65, 0xEC, 0x7C, 0xED, 0x59, 0xEE, 0x10, 0xF0, 0x6F, 0xF2,
-	0x41, 0xF4, 0xEF, 0xF5, 0x76, 0xF8, 0x76, 0xFB, 0x88, 0xFD, 0x28, 0xFE,
-	0x64, 0xFE, 0x30, 0xFF, 0x01, 0x00, 0x27, 0x00, 0x96, 0x00, 0x7D, 0x02,
-	0x87, 0x04, 0x29, 0x05, 0x67, 0x05, 0xE1, 0x06, 0xBF, 0x08, 0x67, 0x09,
-	0xB4, 0x09, 0xA0, 0x0A, 0xBC, 0x0B, 0x49, 0x0C, 0xA7, 0x0C, 0x9B, 0x0D,
-	0x00, 0x0F, 0x2F, 0x10, 0x7C, 0x10, 0x80, 0x10, 0x39, 0x11, 0xF3, 0x11,
-	0xCC, 0x11, 0x36, 0x11, 0x1A, 0x11, 0x26, 0x11, 0xDF, 0x10, 0x66, 0x10,
-	0xDD, 0x0F, 0x2A, 0x0F, 0x4E, 0x0E, 0x2D, 0x0D, 0xE3, 0x0B, 0xC2, 0x0A,
-	0x9C, 0x09, 0x95, 0x08, 0x7C, 0x07, 0x52, 0x06, 0x60, 0x05, 0xE5, 0x04,
-	0x5E, 0x04, 0xCE, 0x03, 0x76, 0x03, 0xE2, 0x02, 0x08, 0x02, 0x99, 0x01,
-	0x64, 0x01, 0x01, 0x01, 0xF3, 0x00, 0x92, 0x01, 0x15, 0x02, 0x61, 0x02,
-	0x17, 0x03, 0xFE, 0x03, 0x43, 0x04, 0x1F, 0x04, 0x27, 0x04, 0x65, 0x04,
-	0xAB, 0x04, 0x09, 0x05, 0x75, 0x05, 0x7A, 0x06, 0x35, 0x08, 0xB5, 0x09,
-	0x65, 0x0A, 0x96, 0x0A, 0x67, 0x0A, 0x06, 0x0A, 0x8D, 0x09, 0xAA, 0x09,
-	0x38, 0x0A, 0xAD, 0x0A, 0xBD, 0x0A, 0xBD, 0x0A, 0xFA, 0x0A, 0x5D, 0x0B,
-	0x89, 0x0B, 0xA3, 0x0B, 0xD2, 0x0B, 0xD4, 0x0B, 0x60, 0x0B, 0x0E, 0x0B,
-	0xC9, 0x0A, 0xA8, 0x0A, 0xA9, 0x0A, 0x8F, 0x0A, 0x48, 0x0A, 0x1B, 0x0A,
-	0xFE, 0x09, 0xA5, 0x09, 0x14, 0x09, 0x7A, 0x08, 0xF2, 0x07, 0x8C, 0x07,
-	0x3D, 0x07, 0xD3, 0x06, 0x2B, 0x06, 0x8E, 0x05, 0x0E, 0x05, 0x6D, 0x04,
-	0xCC, 0x03, 0x35, 0x03, 0x75, 0x02, 0x73, 0x01, 0x4E, 0x00, 0x30, 0xFF,
-	0x36, 0xFE, 0x73, 0xFD, 0x73, 0xFC, 0x38, 0xFB, 0x05, 0xFA, 0x8E, 0xF8,
-	0x90, 0xF6, 0x45, 0xF4, 0x3A, 0xF2, 0x20, 0xF0, 0x9E, 0xED, 0xF0, 0xEA,
-	0x66, 0xE8, 0x5E, 0xE6, 0xA7, 0xE4, 0x66, 0xE3, 0xF5, 0xE2, 0x21, 0xE3,
-	0x18, 0xE3, 0x54, 0xE2, 0x7A, 0xE1, 0x0B, 0xE1, 0xA2, 0xE0, 0x3C, 0xE0,
-	0x94, 0xE0, 0xE5, 0xE1, 0x64, 0xE3, 0xD7, 0xE4, 0xC0, 0xE6, 0x0D, 0xE9,
-	0xAB, 0xEA, 0x7C, 0xEB, 0xC3, 0xEC, 0x11, 0xEF, 0xC2, 0xF0, 0xEC, 0xF0,
-	0xA5, 0xF1, 0x09, 0xF4, 0x3A, 0xF6, 0x73, 0xF6, 0xB9, 0xF6, 0xCF, 0xF8,
-	0xF9, 0xFA, 0xF9, 0xFA, 0xDA, 0xF9, 0x2F, 0xFA, 0xBD, 0xFB, 0xBF, 0xFC,
-	0xEF, 0xFC, 0x8C, 0xFD, 0x3D, 0xFF, 0x03, 0x01, 0xDE, 0x01, 0x52, 0x02,
-	0x9F, 0x03, 0x10, 0x05, 0x49, 0x05, 0xD4, 0x04, 0x9D, 0x05, 0xB9, 0x07,
-	0xFA, 0x08, 0x42, 0x09, 0x86, 0x0A, 0xD4, 0x0C, 0xDB, 0x0D, 0xEE, 0x0C,
-	0xEA, 0x0B, 0x29, 0x0C, 0x94, 0x0C, 0xEF, 0x0B, 0x0C, 0x0B, 0x5D, 0x0B,
-	0x56, 0x0C, 0x8B, 0x0C, 0xB9, 0x0B, 0x32, 0x0B, 0x6A, 0x0B, 0x01, 0x0B,
-	0x7B, 0x09, 0x77, 0x08, 0x79, 0x08, 0x77, 0x08, 0xE6, 0x07, 0x79, 0x07,
-	0xF5, 0x07, 0x92, 0x08, 0xA8, 0x08, 0x6F, 0x08, 0x81, 0x08, 0xB3, 0x08,
-	0x95, 0x08, 0xE3, 0x07, 0x53, 0x07, 0x60, 0x07, 0x6D, 0x07, 0x1E, 0x07,
-	0x9F, 0x06, 0x90, 0x06, 0x92, 0x06, 0x1C, 0x06, 0x84, 0x05, 0xB5, 0x05,
-	0x22, 0x06, 0x34, 0x06, 0x3C, 0x06, 0x42, 0x06, 0x47, 0x06, 0x74, 0x06,
-	0x8D, 0x06, 0x4E, 0x06, 0x49, 0x06, 0x7D, 0x06, 0x88, 0x06, 0xA5, 0x06,
-	0x34, 0x07, 0x76, 0x08, 0xC7, 0x09, 0xF1, 0x0A, 0x04, 0x0C, 0x8E, 0x0C,
-	0x40, 0x0C, 0x5C, 0x0B, 0xD9, 0x0A, 0xF0, 0x0A, 0x16, 0x0B, 0xD1, 0x0A,
-	0x36, 0x0B, 0x97, 0x0C, 0xC8, 0x0D, 0xF3, 0x0D, 0x88, 0x0D, 0x61, 0x0D,
-	0xFB, 0x0C, 0xB7, 0x0B, 0x24, 0x0A, 0x26, 0x09, 0x99, 0x08, 0xE3, 0x07,
-	0x4E, 0x07, 0x55, 0x07, 0xB3, 0x07, 0xAF, 0x07, 0x13, 0x07, 0x68, 0x06,
-	0xC7, 0x05, 0xD2, 0x04, 0x77, 0x03, 0x40, 0x02, 0x85, 0x01, 0x09, 0x01,
-	0x40, 0x00, 0x4F, 0xFF, 0xA6, 0xFE, 0xFA, 0xFD, 0xEB, 0xFC, 0xB0, 0xFB,
-	0x6D, 0xFA, 0x31, 0xF9, 0x84, 0xF7, 0x94, 0xF5, 0xFD, 0xF3, 0x9A, 0xF2,
-	0x0C, 0xF1, 0xFF, 0xEE, 0x81, 0xEC, 0xD5, 0xE9, 0x74, 0xE7, 0xED, 0xE5,
-	0x6D, 0xE5, 0x3A, 0xE5, 0x0D, 0xE5, 0x56, 0xE5, 0x12, 0xE6, 0x3A, 0xE6,
-	0xB1, 0xE5, 0x36, 0xE5, 0x27, 0xE5, 0x4C, 0xE5, 0x64, 0xE5, 0xEE, 0xE5,
-	0x93, 0xE7, 0xF0, 0xE9, 0x25, 0xEC, 0xE2, 0xED, 0x68, 0xEF, 0xBB, 0xF0,
-	0x62, 0xF1, 0x78, 0xF1, 0x9F, 0xF1, 0x0F, 0xF2, 0x50, 0xF2, 0x7D, 0xF2,
-	0x3F, 0xF3, 0xD6, 0xF4, 0xB3, 0xF6, 0x3E, 0xF8, 0x80, 0xF9, 0x44, 0xFA,
-	0xB6, 0xFA, 0x66, 0xFB, 0x16, 0xFC, 0xB4, 0xFC, 0xC2, 0xFD, 0x4F, 0xFF,
-	0xD1, 0x00, 0x50, 0x02, 0x47, 0x04, 0x66, 0x06, 0xE4, 0x07, 0xAD, 0x08,
-	0x4E, 0x09, 0x6D, 0x0A, 0x7A, 0x0B, 0x9A, 0x0B, 0x34, 0x0B, 0xA6, 0x0B,
-	0xFE, 0x0C, 0xA5, 0x0D, 0x07, 0x0D, 0x7E, 0x0C, 0x67, 0x0C, 0xB8, 0x0B,
-	0x51, 0x0A, 0x36, 0x09, 0x33, 0x09, 0xD7, 0x09, 0x00, 0x0A, 0x84, 0x09,
-	0x2E, 0x09, 0x1F, 0x09, 0x66, 0x08, 0xEC, 0x06, 0x28, 0x06, 0x71, 0x06,
-	0xE6, 0x06, 0xCA, 0x06, 0xD9, 0x06, 0xFA, 0x07, 0xD0, 0x09, 0x85, 0x0A,
-	0xE9, 0x09, 0xD8, 0x09, 0x5A, 0x0A, 0xC2, 0x09, 0x48, 0x08, 0x8D, 0x07,
-	0xD3, 0x07, 0x3B, 0x08, 0x3E, 0x08, 0x4D, 0x08, 0xB3, 0x08, 0xC7, 0x08,
-	0xD9, 0x07, 0x94, 0x06, 0xBF, 0x05, 0x07, 0x05, 0xE2, 0x03, 0x06, 0x03,
-	0xF7, 0x02, 0x5B, 0x03, 0xE1, 0x03, 0x88, 0x04, 0x48, 0x05, 0x04, 0x06,
-	0x5B, 0x06, 0x33, 0x06, 0x97, 0x05, 0x1C, 0x05, 0xEF, 0x04, 0xF0, 0x04,
-	0x66, 0x05, 0x86, 0x06, 0xDF, 0x07, 0xB2, 0x08, 0x2D, 0x09, 0xA9, 0x09,
-	0x02, 0x0A, 0x33, 0x0A, 0x30, 0x0A, 0x34, 0x0A, 0x61, 0x0A, 0xBC, 0x0A,
-	0x06, 0x0B, 0x73, 0x0B, 0xE9, 0x0B, 0x15, 0x0C, 0x0F, 0x0C, 0x46, 0x0C,
-	0x39, 0x0C, 0xB9, 0x0B, 0x30, 0x0B, 0x1A, 0x0B, 0xFE, 0x0A, 0x91, 0x0A,
-	0xE6, 0x09, 0x1E, 0x09, 0x80, 0x08, 0xA9, 0x07, 0x5C, 0x06, 0x2F, 0x05,
-	0x5B, 0x04, 0x88, 0x03, 0xB9, 0x02, 0xE7, 0x01, 0xFA, 0x00, 0xCA, 0xFF,
-	0x3C, 0xFE, 0x91, 0xFC, 0xEC, 0xFA, 0x76, 0xF9, 0xAE, 0xF7, 0x7F, 0xF5,
-	0x25, 0xF3, 0x4A, 0xF1, 0x8F, 0xEF, 0x91, 0xED, 0x4A, 0xEB, 0x14, 0xE9,
-	0x7F, 0xE7, 0xA1, 0xE6, 0x5D, 0xE6, 0x73, 0xE6, 0x98, 0xE6, 0x91, 0xE6,
-	0xB8, 0xE6, 0xD1, 0xE6, 0xE0, 0xE6, 0xE7, 0xE6, 0x31, 0xE7, 0xE7, 0xE7,
-	0xD5, 0xE8, 0xCD, 0xE9, 0xF2, 0xEA, 0x6A, 0xEC, 0x03, 0xEE, 0x3E, 0xEF,
-	0xDC, 0xEF, 0x1D, 0xF0, 0x8B, 0xF0, 0x99, 0xF0, 0x1A, 0xF0, 0xD3, 0xEF,
-	0x13, 0xF0, 0x66, 0xF0, 0xDB, 0xF0, 0xDA, 0xF1, 0x8E, 0xF3, 0x33, 0xF5,
-	0x3A, 0xF6, 0x1E, 0xF7, 0xFB, 0xF7, 0x4F, 0xF8, 0x45, 0xF8, 0xC7, 0xF8,
-	0x45, 0xFA, 0xBE, 0xFB, 0xE8, 0xFC, 0x43, 0xFE, 0x57, 0x00, 0x7E, 0x02,
-	0xF2, 0x03, 0x66, 0x04, 0xC2, 0x04, 0xCB, 0x05, 0x75, 0x06, 0x7D, 0x06,
-	0xD3, 0x06, 0xBE, 0x07, 0x57, 0x08, 0x9C, 0x08, 0x2A, 0x09, 0xAA, 0x09,
-	0xBA, 0x09, 0x61, 0x09, 0x2C, 0x09, 0xFA, 0x08, 0x8D, 0x08, 0xCB, 0x07,
-	0x69, 0x07, 0xDA, 0x07, 0x8D, 0x08, 0xA2, 0x08, 0x63, 0x08, 0x7B, 0x08,
-	0x09, 0x09, 0x86, 0x09, 0x59, 0x09, 0x36, 0x09, 0xC0, 0x09, 0x76, 0x0A,
-	0xC7, 0x0A, 0x6A, 0x0B, 0x0C, 0x0C, 0xD3, 0x0B, 0x16, 0x0B, 0xC3, 0x0A,
-	0xB5, 0x0A, 0x4F, 0x0A, 0xEC, 0x09, 0xDF, 0x09, 0x0D, 0x0A, 0x0D, 0x0A,
-	0xC0, 0x09, 0x3F, 0x09, 0xCE, 0x08, 0x4F, 0x08, 0x65, 0x07, 0x4C, 0x06,
-	0x99, 0x05, 0x4C, 0x05, 0x3D, 0x05, 0x82, 0x05, 0x0F, 0x06, 0xBD, 0x06,
-	0x6D, 0x07, 0xEF, 0x07, 0x4E, 0x08, 0x67, 0x08, 0x18, 0x08, 0xA3, 0x07,
-	0x52, 0x07, 0xF4, 0x06, 0x8B, 0x06, 0xA8, 0x06, 0x4B, 0x07, 0xAA, 0x07,
-	0xA3, 0x07, 0x9D, 0x07, 0x77, 0x07, 0x0D, 0x07, 0xC6, 0x06, 0x60, 0x06,
-	0x05, 0x06, 0x06, 0x06, 0x48, 0x06, 0x60, 0x06, 0xB4, 0x06, 0x3D, 0x07,
-	0x83, 0x07, 0xA2, 0x07, 0xEC, 0x07, 0x53, 0x08, 0x8F, 0x08, 0xA2, 0x08,
-	0x95, 0x08, 0x93, 0x08, 0x8F, 0x08, 0x42, 0x08, 0xDD, 0x07, 0xB7, 0x07,
-	0x7D, 0x07, 0xB2, 0x06, 0xB2, 0x05, 0xBA, 0x04, 0xAB, 0x03, 0x61, 0x02,
-	0xF0, 0x00, 0x4F, 0xFF, 0xB7, 0xFD, 0x39, 0xFC, 0xD0, 0xFA, 0x62, 0xF9,
-	0xD4, 0xF7, 0xF9, 0xF5, 0x1F, 0xF4, 0xBB, 0xF2, 0x74, 0xF1, 0xBD, 0xEF,
-	0xD3, 0xED, 0x48, 0xEC, 0x72, 0xEB, 0x71, 0xEB, 0x55, 0xEC, 0x7B, 0xED,
-	0x3E, 0xEE, 0x3F, 0xEE, 0xB5, 0xED, 0x52, 0xED, 0x4C, 0xED, 0x16, 0xED,
-	0x89, 0xEC, 0x1C, 0xEC, 0x35, 0xEC, 0xE8, 0xEC, 0xE6, 0xED, 0xE7, 0xEE,
-	0xA2, 0xEF, 0x39, 0xF0, 0x6F, 0xF0, 0xF8, 0xEF, 0xFF, 0xEE, 0x1E, 0xEE,
-	0x41, 0xED, 0x8D, 0xEC, 0x7F, 0xEC, 0x44, 0xED, 0x97, 0xEE, 0x4E, 0xF0,
-	0x29, 0xF2, 0xE8, 0xF3, 0x2C, 0xF5, 0x9A, 0xF5, 0xB0, 0xF5, 0x35, 0xF6,
-	0x4E, 0xF7, 0x65, 0xF8, 0x9B, 0xF9, 0x64, 0xFB, 0xA8, 0xFD, 0xCA, 0xFF,
-	0xB5, 0x01, 0xFF, 0x02, 0x69, 0x03, 0x40, 0x03, 0x56, 0x03, 0xFA, 0x03,
-	0x98, 0x04, 0x8D, 0x04, 0x4C, 0x04, 0x04, 0x05, 0x6C, 0x06, 0x20, 0x07,
-	0x0A, 0x07, 0x1B, 0x07, 0x8F, 0x07, 0x71, 0x07, 0xCC, 0x06, 0x40, 0x06,
-	0x2C, 0x06, 0x33, 0x06, 0x5D, 0x06, 0xAA, 0x06, 0xAD, 0x07, 0xEB, 0x08,
-	0x79, 0x09, 0x70, 0x09, 0xAD, 0x09, 0x3B, 0x0A, 0x3E, 0x0A, 0xCF, 0x09,
-	0xBA, 0x09, 0x4A, 0x0A, 0xCE, 0x0A, 0x73, 0x0A, 0x0D, 0x0A, 0x3A, 0x0A,
-	0x91, 0x0A, 0x21, 0x0A, 0x84, 0x09, 0x92, 0x09, 0x49, 0x09, 0x1B, 0x08,
-	0x53, 0x07, 0xAF, 0x07, 0x59, 0x08, 0x4E, 0x08, 0x1D, 0x08, 0x5C, 0x08,
-	0xE9, 0x08, 0xEC, 0x08, 0x3C, 0x08, 0x07, 0x08, 0x93, 0x08, 0x05, 0x09,
-	0xF6, 0x08, 0xFE, 0x08, 0x62, 0x09, 0xD2, 0x09, 0x0F, 0x0A, 0x12, 0x0A,
-	0xE1, 0x09, 0x43, 0x09, 0x92, 0x08, 0x3A, 0x08, 0x25, 0x08, 0xE2, 0x07,
-	0x2B, 0x07, 0x70, 0x06, 0x2C, 0x06, 0x61, 0x06, 0x85, 0x06, 0x9C, 0x06,
-	0xD8, 0x06, 0xEA, 0x06, 0xCD, 0x06, 0xDD, 0x06, 0x00, 0x07, 0x2A, 0x07,
-	0x88, 0x07, 0x18, 0x08, 0xEA, 0x08, 0x81, 0x09, 0xB3, 0x09, 0x8D, 0x09,
-	0x9F, 0x09, 0xD1, 0x09, 0xAF, 0x09, 0x2E, 0x09, 0xA9, 0x08, 0x3D, 0x08,
-	0xC2, 0x07, 0x1F, 0x07, 0x3E, 0x06, 0x26, 0x05, 0xF9, 0x03, 0x0C, 0x03,
-	0x64, 0x02, 0xC3, 0x01, 0xE6, 0x00, 0xB8, 0xFF, 0x97, 0xFE, 0xAA, 0xFD,
-	0xA5, 0xFC, 0x8A, 0xFB, 0xCC, 0xFA, 0x3B, 0xFA, 0x97, 0xF9, 0xB0, 0xF8,
-	0x7E, 0xF7, 0x40, 0xF6, 0x08, 0xF5, 0x96, 0xF3, 0xBD, 0xF1, 0xC7, 0xEF,
-	0x6F, 0xEE, 0x2E, 0xEE, 0x14, 0xEF, 0x36, 0xF0, 0x69, 0xF0, 0x83, 0xEF,
-	0xB0, 0xEE, 0x63, 0xEE, 0x18, 0xEE, 0x33, 0xED, 0x58, 0xEC, 0x19, 0xEC,
-	0x44, 0xEC, 0xB9, 0xEC, 0xED, 0xED, 0xD4, 0xEF, 0x84, 0xF1, 0x60, 0xF2,
-	0xD2, 0xF2, 0xE8, 0xF2, 0x78, 0xF2, 0x6A, 0xF1, 0x3C, 0xF0, 0xB7, 0xEF,
-	0xFA, 0xEF, 0x99, 0xF0, 0x3C, 0xF1, 0x18, 0xF2, 0x4F, 0xF3, 0x3B, 0xF4,
-	0x3C, 0xF4, 0xC7, 0xF3, 0x5B, 0xF3, 0xEB, 0xF2, 0xB4, 0xF2, 0x3D, 0xF3,
-	0x96, 0xF4, 0x67, 0xF6, 0x4E, 0xF8, 0xEE, 0xF9, 0xB3, 0xFB, 0x94, 0xFD,
-	0xD0, 0xFE, 0x42, 0xFF, 0x98, 0xFF, 0x79, 0x00, 0x3D, 0x01, 0x90, 0x01,
-	0x3D, 0x02, 0xB2, 0x03, 0x1A, 0x05, 0x24, 0x06, 0xEF, 0x06, 0x23, 0x07,
-	0xC4, 0x06, 0x61, 0x06, 0x18, 0x06, 0xD0, 0x05, 0x6E, 0x05, 0x43, 0x05,
-	0xAC, 0x05, 0x32, 0x06, 0x30, 0x06, 0x1D, 0x06, 0x1E, 0x06, 0x41, 0x06,
-	0xBE, 0x06, 0x52, 0x07, 0xC6, 0x07, 0x28, 0x08, 0x8C, 0x08, 0xBB, 0x08,
-	0xEE, 0x08, 0x5B, 0x09, 0xDD, 0x09, 0x20, 0x0A, 0x38, 0x0A, 0x29, 0x0A,
-	0xCC, 0x09, 0x58, 0x09, 0x93, 0x09, 0x4D, 0x0A, 0x81, 0x0A, 0x65, 0x0A,
-	0x73, 0x0A, 0x43, 0x0A, 0x9C, 0x09, 0x18, 0x09, 0xC5, 0x08, 0x89, 0x08,
-	0x4A, 0x08, 0x24, 0x08, 0x0A, 0x08, 0x1C, 0x08, 0xBA, 0x08, 0x9B, 0x09,
-	0x14, 0x0A, 0x2A, 0x0A, 0x24, 0x0A, 0xEC, 0x09, 0x5E, 0x09, 0xB3, 0x08,
-	0x19, 0x08, 0x5D, 0x07, 0x64, 0x06, 0xC3, 0x05, 0x09, 0x06, 0x9C, 0x06,
-	0xAD, 0x06, 0x9C, 0x06, 0x77, 0x06, 0x29, 0x06, 0x7B, 0x05, 0xBC, 0x04,
-	0x16, 0x04, 0xC9, 0x03, 0x98, 0x03, 0x66, 0x03, 0xD1, 0x03, 0xD2, 0x04,
-	0xEE, 0x05, 0xAE, 0x06, 0x72, 0x07, 0x05, 0x08, 0xF9, 0x07, 0x7F, 0x07,
-	0xFF, 0x06, 0xA9, 0x06, 0x63, 0x06, 0x0C, 0x06, 0xF9, 0x05, 0x2C, 0x06,
-	0x4D, 0x06, 0x3D, 0x06, 0xCE, 0x05, 0xF7, 0x04, 0x00, 0x04, 0xBE, 0x02,
-	0x43, 0x01, 0xE2, 0xFF, 0xB9, 0xFE, 0xB0, 0xFD, 0xC3, 0xFC, 0x1E, 0xFC,
-	0xB4, 0xFB, 0x1F, 0xFB, 0x39, 0xFA, 0x04, 0xF9, 0x98, 0xF7, 0x26, 0xF6,
-	0xA8, 0xF4, 0x39, 0xF3, 0x2E, 0xF2, 0x18, 0xF2, 0xC5, 0xF2, 0x96, 0xF3,
-	0xD9, 0xF3, 0x8D, 0xF3, 0x37, 0xF3, 0x2C, 0xF3, 0x00, 0xF3, 0x74, 0xF2,
-	0xD6, 0xF1, 0x7D, 0xF1, 0x1D, 0xF1, 0xC8, 0xF0, 0xFD, 0xF0, 0xB6, 0xF1,
-	0x31, 0xF2, 0x78, 0xF2, 0xDC, 0xF2, 0x25, 0xF3, 0xBF, 0xF2, 0x2A, 0xF2,
-	0xBD, 0xF1, 0x82, 0xF1, 0x3E, 0xF1, 0xFF, 0xF0, 0x42, 0xF1, 0x41, 0xF2,
-	0x7D, 0xF3, 0x5E, 0xF4, 0x63, 0xF4, 0xEF, 0xF3, 0x9C, 0xF3, 0x9A, 0xF3,
-	0xA6, 0xF3, 0xA6, 0xF3, 0xE3, 0xF3, 0x6D, 0xF4, 0xF8, 0xF4, 0xAE, 0xF5,
-	0x8B, 0xF6, 0x26, 0xF7, 0xB7, 0xF7, 0x8D, 0xF8, 0x4E, 0xF9, 0x9B, 0xF9,
-	0xDA, 0xF9, 0x5E, 0xFA, 0x29, 0xFB, 0x06, 0xFC, 0xEE, 0xFC, 0xF0, 0xFD,
-	0x09, 0xFF, 0xE6, 0xFF, 0x14, 0x01, 0x82, 0x02, 0x65, 0x03, 0x7B, 0x03,
-	0x77, 0x03, 0xD2, 0x03, 0xB5, 0x04, 0xA8, 0x05, 0xB9, 0x05, 0x68, 0x05,
-	0x19, 0x05, 0x38, 0x05, 0x6D, 0x05, 0x5F, 0x05, 0x50, 0x05, 0x5A, 0x05,
-	0xA3, 0x05, 0x37, 0x06, 0xB3, 0x06, 0xC6, 0x06, 0xC0, 0x06, 0xD6, 0x06,
-	0xF6, 0x06, 0x32, 0x07, 0xA6, 0x07, 0x0F, 0x08, 0x9F, 0x08, 0x03, 0x09,
-	0x21, 0x09, 0x57, 0x09, 0x65, 0x09, 0xEF, 0x08, 0xAB, 0x08, 0xC4, 0x08,
-	0xA3, 0x08, 0x77, 0x08, 0x44, 0x08, 0x33, 0x08, 0x69, 0x08, 0xC7, 0x08,
-	0xF6, 0x08, 0x0B, 0x09, 0x05, 0x09, 0xF8, 0x08, 0xF9, 0x08, 0x15, 0x09,
-	0x39, 0x09, 0x33, 0x09, 0xFF, 0x08, 0xCA, 0x08, 0x92, 0x08, 0x4F, 0x08,
-	0x00, 0x08, 0xC0, 0x07, 0xAA, 0x07, 0xB4, 0x07, 0x7F, 0x07, 0x30, 0x07,
-	0xC8, 0x06, 0x2E, 0x06, 0x5B, 0x05, 0x9A, 0x04, 0x11, 0x04, 0xF0, 0x03,
-	0xF7, 0x03, 0xE5, 0x03, 0xC7, 0x03, 0x93, 0x03, 0x5E, 0x03, 0x37, 0x03,
-	0x22, 0x03, 0x2B, 0x03, 0x15, 0x03, 0xAB, 0x02, 0x12, 0x02, 0x7B, 0x01,
-	0x72, 0x01, 0x31, 0x02, 0x1A, 0x03, 0x77, 0x03, 0xEE, 0x02, 0x17, 0x02,
-	0x68, 0x01, 0x14, 0x01, 0xE1, 0x00, 0xC9, 0x00, 0xD7, 0x00, 0xCB, 0x00,
-	0xE4, 0xFF, 0x36, 0xFE, 0x60, 0xFC, 0xDB, 0xFB, 0x38, 0xFC, 0x67, 0xFC,
-	0xC3, 0xFB, 0x50, 0xFA, 0xC7, 0xF8, 0xFB, 0xF7, 0x05, 0xF8, 0x0E, 0xF8,
-	0x3A, 0xF7, 0xF8, 0xF5, 0xBC, 0xF5, 0xEC, 0xF6, 0x09, 0xF8, 0xB7, 0xF7,
-	0xD7, 0xF6, 0x18, 0xF7, 0x1D, 0xF8, 0x65, 0xF8, 0x77, 0xF7, 0xCC, 0xF5,
-	0xD8, 0xF4, 0x46, 0xF5, 0x0F, 0xF6, 0x24, 0xF6, 0x5A, 0xF5, 0xE3, 0xF4,
-	0x2D, 0xF6, 0xD9, 0xF7, 0xAA, 0xF7, 0x74, 0xF6, 0x52, 0xF6, 0x25, 0xF7,
-	0xC6, 0xF7, 0x5B, 0xF7, 0x34, 0xF6, 0xBD, 0xF5, 0x90, 0xF6, 0xB2, 0xF7,
-	0x0A, 0xF8, 0xD4, 0xF7, 0x46, 0xF8, 0x06, 0xF9, 0xFD, 0xF8, 0x8E, 0xF8,
-	0xA3, 0xF8, 0x62, 0xF8, 0x09, 0xF7, 0x09, 0xF6, 0xC9, 0xF6, 0x8B, 0xF8,
-	0x12, 0xFA, 0x06, 0xFB, 0x3D, 0xFB, 0xEE, 0xF9, 0x0F, 0xF8, 0xF9, 0xF7,
-	0x2B, 0xF9, 0xC6, 0xF9, 0xD9, 0xF9, 0x81, 0xFA, 0x26, 0xFC, 0xAF, 0xFD,
-	0x16, 0xFE, 0x56, 0xFD, 0x76, 0xFC, 0xE2, 0xFC, 0xD5, 0xFD, 0xEF, 0xFE,
-	0x93, 0x00, 0x29, 0x02, 0x52, 0x02, 0x72, 0x01, 0xDA, 0x00, 0xC6, 0x00,
-	0xBF, 0x00, 0x41, 0x00, 0x9E, 0xFF, 0x7D, 0xFF, 0x28, 0x00, 0x4C, 0x01,
-	0xDB, 0x01, 0x02, 0x02, 0xCD, 0x01, 0x17, 0x01, 0x54, 0x00, 0x6E, 0x00,
-	0xDE, 0x00, 0xC2, 0x00, 0xC4, 0x00, 0x04, 0x02, 0x82, 0x03, 0xCB, 0x02,
-	0x4F, 0x01, 0x7C, 0x01, 0xB6, 0x01, 0x6E, 0x00, 0xE6, 0xFF, 0x93, 0x00,
-	0x3A, 0x00, 0x64, 0xFF, 0xED, 0xFF, 0x0A, 0x01, 0x62, 0x01, 0x65, 0x00,
-	0xAF, 0xFE, 0xD2, 0xFD, 0x37, 0xFE, 0xD3, 0xFE, 0xFB, 0xFF, 0x73, 0x02,
-	0xA9, 0x04, 0xE4, 0x03, 0x68, 0x01, 0xCE, 0x00, 0xEC, 0x01, 0x94, 0x02,
-	0x2C, 0x03, 0x3D, 0x04, 0xBF, 0x04, 0x65, 0x04, 0x0E, 0x04, 0x70, 0x03,
-	0x4A, 0x01, 0x19, 0x00, 0x11, 0x02, 0x97, 0x02, 0xDE, 0x00, 0xF2, 0x01,
-	0x25, 0x05, 0xEE, 0x05, 0xAA, 0x03, 0x77, 0x01, 0xC3, 0x00, 0x07, 0x02,
-	0x7E, 0x05, 0x80, 0x08, 0xF2, 0x06, 0xCC, 0x02, 0x63, 0x01, 0x32, 0x03,
-	0xD1, 0x04, 0x0B, 0x05, 0x87, 0x06, 0x9D, 0x08, 0x28, 0x06, 0x90, 0x01,
-	0x12, 0x01, 0x79, 0x02, 0xA6, 0x03, 0x8E, 0x07, 0x68, 0x0A, 0x46, 0x06,
-	0x68, 0x00, 0xBC, 0xFF, 0x4F, 0x03, 0x54, 0x06, 0x10, 0x06, 0xEE, 0x05,
-	0x41, 0x07, 0x1E, 0x06, 0x6E, 0x03, 0xED, 0x02, 0x92, 0x02, 0xBC, 0x00,
-	0xFF, 0x00, 0x1D, 0x04, 0x81, 0x05, 0x83, 0x04, 0x1E, 0x03, 0x51, 0x02,
-	0xF3, 0x02, 0x98, 0x03, 0x37, 0x00, 0x3B, 0xFE, 0x2C, 0x02, 0x4C, 0x04,
-	0xC9, 0x02, 0x9B, 0x02, 0xEA, 0x02, 0xBE, 0x02, 0x4F, 0x02, 0xFF, 0x00,
-	0x22, 0x00, 0x37, 0x01, 0x24, 0x03, 0x89, 0x04, 0x89, 0x04, 0x98, 0x03,
-	0x2A, 0x02, 0x8D, 0x00, 0xEA, 0x00, 0x62, 0x02, 0x9A, 0x02, 0x05, 0x03,
-	0xC9, 0x03, 0xCC, 0x02, 0x98, 0x01, 0x6A, 0x01, 0x6A, 0x01, 0x6D, 0x01,
-	0xCA, 0x01, 0xE5, 0x02, 0x4F, 0x03, 0xEE, 0x01, 0x6A, 0x01, 0x32, 0x02,
-	0xFB, 0x01, 0xD4, 0x01, 0xC8, 0x02, 0x35, 0x02, 0x9B, 0x00, 0x4A, 0x01,
-	0x6D, 0x02, 0xCE, 0x01, 0x67, 0x01, 0xF7, 0x01, 0x75, 0x02, 0x48, 0x02,
-	0xC2, 0x01, 0x8E, 0x01, 0xDB, 0x01, 0xA5, 0x02, 0xFD, 0x02, 0x98, 0x02,
-	0x71, 0x02, 0x54, 0x02, 0x67, 0x02, 0xEE, 0x02, 0xF1, 0x02, 0x66, 0x02,
-	0xA7, 0x02, 0x6E, 0x03, 0x69, 0x03, 0xF4, 0x02, 0x6F, 0x02, 0x58, 0x02,
-	0xE0, 0x02, 0x73, 0x03, 0x85, 0x03, 0x35, 0x03, 0xFF, 0x02, 0xEA, 0x02,
-	0x79, 0x02, 0xFC, 0x01, 0x09, 0x02, 0xA6, 0x02, 0x07, 0x03, 0xF4, 0x02,
-	0x4D, 0x02, 0x66, 0x01, 0xE5, 0x00, 0xE1, 0x00, 0x66, 0x01, 0xD4, 0x01,
-	0xCB, 0x01, 0xCC, 0x01, 0xB1, 0x01, 0x2D, 0x01, 0xD1, 0x00, 0xC9, 0x00,
-	0xF3, 0x00, 0x21, 0x01, 0x3C, 0x01, 0x49, 0x01, 0x5C, 0x01, 0x74, 0x01,
-	0x68, 0x01, 0x59, 0x01, 0x6A, 0x01, 0x7E, 0x01, 0x7A, 0x01, 0x77, 0x01,
-	0x6B, 0x01, 0x7A, 0x01, 0x95, 0x01, 0x94, 0x01, 0xB3, 0x01, 0xCD, 0x01,
-	0xB3, 0x01, 0x64, 0x01, 0xF6, 0x00, 0xC9, 0x00, 0x07, 0x01, 0x66, 0x01,
-	0x9F, 0x01, 0x9F, 0x01, 0x70, 0x01, 0x2B, 0x01, 0xB3, 0x00, 0x7B, 0x00,
-	0x92, 0x00, 0xE6, 0x00, 0x1F, 0x01, 0x2C, 0x01, 0x2C, 0x01, 0x1C, 0x01,
-	0x22, 0x01, 0x20, 0x01, 0x21, 0x01, 0x0E, 0x01, 0x21, 0x01, 0x1D, 0x01,
-	0x0D, 0x01, 0x04, 0x01, 0x30, 0x01, 0x52, 0x01, 0x26, 0x01, 0x02, 0x01,
-	0x09, 0x01, 0x18, 0x01, 0x0C, 0x01, 0x18, 0x01, 0x31, 0x01, 0x2F, 0x01,
-	0x17, 0x01, 0xFD, 0x00, 0x12, 0x01, 0x0E, 0x01, 0x0E, 0x01, 0xE5, 0x00,
-	0xBD, 0x00, 0xA1, 0x00, 0xA8, 0x00, 0xD1, 0x00, 0xBE, 0x00, 0x9E, 0x00,
-	0x75, 0x00, 0x34, 0x00, 0xE6, 0xFF, 0xD3, 0xFF, 0xFD, 0xFF, 0x17, 0x00,
-	0x0A, 0x00, 0xD3, 0xFF, 0x91, 0xFF, 0x7F, 0xFF, 0x5A, 0xFF, 0x5F, 0xFF,
-	0x51, 0xFF, 0x2E, 0xFF, 0x2E, 0xFF, 0x84, 0xFF, 0xD9, 0xFF, 0xD9, 0xFF,
-	0xB2, 0xFF, 0x80, 0xFF, 0x89, 0xFF, 0xB5, 0xFF, 0xFC, 0xFF, 0x31, 0x00,
-	0x63, 0x00, 0x9C, 0x00, 0xB5, 0x00, 0x99, 0x00, 0x79, 0x00, 0x94, 0x00,
-	0xCC, 0x00, 0xF1, 0x00, 0xFD, 0x00, 0x13, 0x01, 0x20, 0x01, 0x30, 0x01,
-	0x2E, 0x01, 0x2F, 0x01, 0xF5, 0x00, 0xC4, 0x00, 0xC1, 0x00, 0xDD, 0x00,
-	0xFB, 0x00, 0x05, 0x01, 0xF6, 0x00, 0xC7, 0x00, 0x9E, 0x00, 0x88, 0x00,
-	0xB6, 0x00, 0xE8, 0x00, 0x04, 0x01, 0xFE, 0x00, 0xE6, 0x00, 0xB1, 0x00,
-	0x84, 0x00, 0xA5, 0x00, 0xE3, 0x00, 0xF7, 0x00, 0xF6, 0x00, 0x00, 0x01,
-	0x0A, 0x01, 0xFA, 0x00, 0x08, 0x01, 0x0C, 0x01, 0xEB, 0x00, 0xCF, 0x00,
-	0xD9, 0x00, 0xF0, 0x00, 0x0F, 0x01, 0x27, 0x01, 0x1C, 0x01, 0xF7, 0x00,
-	0xBB, 0x00, 0xAB, 0x00, 0xCC, 0x00, 0x02, 0x01, 0xF7, 0x00, 0xB9, 0x00,
-	0x90, 0x00, 0x5C, 0x00, 0x23, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x17, 0x00,
-	0x10, 0x00, 0x05, 0x00, 0xED, 0xFF, 0xC6, 0xFF, 0xA8, 0xFF, 0x8B, 0xFF,
-	0x7F, 0xFF, 0x64, 0xFF, 0x58, 0xFF, 0x6E, 0xFF, 0x90, 0xFF, 0x90, 0xFF,
-	0x78, 0xFF, 0x62, 0xFF, 0x6C, 0xFF, 0x7A, 0xFF, 0x9E, 0xFF, 0x91, 0xFF,
-	0x89, 0xFF, 0x93, 0xFF, 0x89, 0xFF, 0x87, 0xFF, 0x95, 0xFF, 0xAD, 0xFF,
-	0xBC, 0xFF, 0xCD, 0xFF, 0xD5, 0xFF, 0xC6, 0xFF, 0xB2, 0xFF, 0xDA, 0xFF,
-	0xF0, 0xFF, 0x04, 0x00, 0xEB, 0xFF, 0xDE, 0xFF, 0xE6, 0xFF, 0xD8, 0xFF,
-	0xCB, 0xFF, 0xC6, 0xFF, 0xCA, 0xFF, 0xCB, 0xFF, 0xC4, 0xFF, 0xB7, 0xFF,
-	0xAC, 0xFF, 0x9E, 0xFF, 0x81, 0xFF, 0x71, 0xFF, 0x5D, 0xFF, 0x53, 0xFF,
-	0x49, 0xFF, 0x56, 0xFF, 0x4A, 0xFF, 0x55, 0xFF, 0x4B, 0xFF, 0x30, 0xFF,
-	0x11, 0xFF, 0x1A, 0xFF, 0x3A, 0xFF, 0x50, 0xFF, 0x46, 0xFF, 0x5D, 0xFF,
-	0x63, 0xFF, 0x63, 0xFF, 0x73, 0xFF, 0x93, 0xFF, 0xB0, 0xFF, 0xB5, 0xFF,
-	0xA2, 0xFF, 0x9C, 0xFF, 0xB8, 0xFF, 0xE3, 0xFF, 0x08, 0x00, 0x14, 0x00,
-	0xFC, 0xFF, 0xD0, 0xFF, 0xA3, 0xFF, 0x9E, 0xFF, 0xB6, 0xFF, 0xD8, 0xFF,
-	0xD0, 0xFF, 0xB8, 0xFF, 0x9E, 0xFF, 0x73, 0xFF, 0x56, 0xFF, 0x3F, 0xFF,
-	0x3D, 0xFF, 0x1A, 0xFF, 0xFD, 0xFE, 0xD3, 0xFE, 0xC5, 0xFE, 0xC6, 0xFE,
-	0xB5, 0xFE, 0xAC, 0xFE, 0x9D, 0xFE, 0x91, 0xFE, 0x74, 0xFE, 0x67, 0xFE,
-	0x5B, 0xFE, 0x60, 0xFE, 0x76, 0xFE, 0x82, 0xFE, 0x8F, 0xFE, 0x9E, 0xFE,
-	0xAC, 0xFE, 0xD4, 0xFE, 0xE8, 0xFE, 0x06, 0xFF, 0x2D, 0xFF, 0x71, 0xFF,
-	0xAB, 0xFF, 0xD5, 0xFF, 0xDD, 0xFF, 0xF0, 0xFF, 0x0E, 0x00, 0x40, 0x00,
-	0x83, 0x00, 0xA4, 0x00, 0xBF, 0x00, 0xCE, 0x00, 0xD2, 0x00, 0xE1, 0x00,
-	0xEC, 0x00, 0x01, 0x01, 0x05, 0x01, 0xFF, 0x00, 0xEB, 0x00, 0xD3, 0x00,
-	0xC9, 0x00, 0xCF, 0x00, 0xC9, 0x00, 0xC1, 0x00, 0xCB, 0x00, 0xB7, 0x00,
-	0xA4, 0x00, 0x8D, 0x00, 0x7E, 0x00, 0x76, 0x00, 0x59, 0x00, 0x52, 0x00,
-	0x68, 0x00, 0x76, 0x00, 0x6E, 0x00, 0x5F, 0x00, 0x46, 0x00, 0x57, 0x00,
-	0x57, 0x00, 0x5D, 0x00, 0x62, 0x00, 0x68, 0x00, 0x71, 0x00, 0x72, 0x00,
-	0x61, 0x00, 0x44, 0x00, 0x3F, 0x00, 0x54, 0x00, 0x50, 0x00, 0x50, 0x00,
-	0x31, 0x00, 0x24, 0x00, 0x1C, 0x00, 0x13, 0x00, 0xF2, 0xFF, 0xC0, 0xFF,
-	0xA9, 0xFF, 0x89, 0xFF, 0x6D, 0xFF, 0x55, 0xFF, 0x41, 0xFF, 0x2C, 0xFF,
-	0x1D, 0xFF, 0xF8, 0xFE, 0xEB, 0xFE, 0xC0, 0xFE, 0xC2, 0xFE, 0xDA, 0xFE,
-	0xD9, 0xFE, 0xDA, 0xFE, 0xCF, 0xFE, 0xC0, 0xFE, 0xCC, 0xFE, 0xE0, 0xFE,
-	0x13, 0xFF, 0x31, 0xFF, 0x66, 0xFF, 0x95, 0xFF, 0xB8, 0xFF, 0xCD, 0xFF,
-	0xDF, 0xFF, 0x04, 0x00, 0x32, 0x00, 0x64, 0x00, 0x93, 0x00, 0x9D, 0x00,
-	0xA3, 0x00, 0xB2, 0x00, 0xD0, 0x00, 0x08, 0x01, 0x15, 0x01, 0x12, 0x01,
-	0x1B, 0x01, 0x1C, 0x01, 0x0B, 0x01, 0xDF, 0x00, 0xB9, 0x00, 0xBB, 0x00,
-	0xC1, 0x00, 0xA4, 0x00, 0x8D, 0x00, 0x76, 0x00, 0x4E, 0x00, 0x35, 0x00,
-	0x2B, 0x00, 0x1F, 0x00, 0x06, 0x00, 0xF3, 0xFF, 0xEC, 0xFF, 0xD8, 0xFF,
-	0xD7, 0xFF, 0xDE, 0xFF, 0xF3, 0xFF, 0xFA, 0xFF, 0x0E, 0x00, 0x14, 0x00,
-	0x08, 0x00, 0x1A, 0x00, 0x46, 0x00, 0x5C, 0x00, 0x71, 0x00, 0x7B, 0x00,
-	0x8A, 0x00, 0xA3, 0x00, 0xB9, 0x00, 0xBB, 0x00, 0xCA, 0x00, 0xC8, 0x00,
-	0xC6, 0x00, 0xBB, 0x00, 0xBC, 0x00, 0xB4, 0x00, 0xA2, 0x00, 0x9C, 0x00,
-	0x7C, 0x00, 0x6D, 0x00, 0x41, 0x00, 0x1D, 0x00, 0x0A, 0x00, 0xEB, 0xFF,
-	0xCA, 0xFF, 0xA2, 0xFF, 0x75, 0xFF, 0x4F, 0xFF, 0x29, 0xFF, 0x28, 0xFF,
-	0x16, 0xFF, 0xFA, 0xFE, 0xD5, 0xFE, 0xB6, 0xFE, 0xA8, 0xFE, 0xB2, 0xFE,
-	0xA3, 0xFE, 0x98, 0xFE, 0x98, 0xFE, 0xA4, 0xFE, 0xCA, 0xFE, 0xF4, 0xFE,
-	0x06, 0xFF, 0x18, 0xFF, 0x35, 0xFF, 0x51, 0xFF, 0x77, 0xFF, 0x95, 0xFF,
-	0xB8, 0xFF, 0xEB, 0xFF, 0x0A, 0x00, 0x30, 0x00, 0x5C, 0x00, 0x70, 0x00,
-	0x8B, 0x00, 0x97, 0x00, 0xA1, 0x00, 0xAD, 0x00, 0xBB, 0x00, 0xC1, 0x00,
-	0xC0, 0x00, 0x9D, 0x00, 0x7C, 0x00, 0x68, 0x00, 0x7B, 0x00, 0x89, 0x00,
-	0x7F, 0x00, 0x6B, 0x00, 0x52, 0x00, 0x43, 0x00, 0x35, 0x00, 0x27, 0x00,
-	0x26, 0x00, 0x18, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x0D, 0x00, 0x0A, 0x00,
-	0x0A, 0x00, 0x14, 0x00, 0x27, 0x00, 0x4A, 0x00, 0x55, 0x00, 0x6B, 0x00,
-	0x71, 0x00, 0x7B, 0x00, 0x93, 0x00, 0xAB, 0x00, 0xC5, 0x00, 0xCD, 0x00,
-	0xDB, 0x00, 0xD1, 0x00, 0xCF, 0x00, 0xCF, 0x00, 0xD8, 0x00, 0xC3, 0x00,
-	0xB0, 0x00, 0x92, 0x00, 0x88, 0x00, 0x77, 0x00, 0x59, 0x00, 0x32, 0x00,
-	0x06, 0x00, 0xED, 0xFF, 0xD3, 0xFF, 0xBD, 0xFF, 0x98, 0xFF, 0x7D, 0xFF,
-	0x4F, 0xFF, 0x3B, 0xFF, 0x34, 0xFF, 0x15, 0xFF, 0x11, 0xFF, 0x02, 0xFF,
-	0xF6, 0xFE, 0xEC, 0xFE, 0xED, 0xFE, 0xF9, 0xFE, 0x0C, 0xFF, 0x16, 0xFF,
-	0x33, 0xFF, 0x47, 0xFF, 0x56, 0xFF, 0x67, 0xFF, 0x6A, 0xFF, 0x99, 0xFF,
-	0xC0, 0xFF, 0xF1, 0xFF, 0x18, 0x00, 0x28, 0x00, 0x3B, 0x00, 0x43, 0x00,
-	0x5A, 0x00, 0x7E, 0x00, 0x99, 0x00, 0xA3, 0x00, 0x9B, 0x00, 0x9C, 0x00,
-	0xAD, 0x00, 0xBB, 0x00, 0xB2, 0x00, 0xB7, 0x00, 0x97, 0x00, 0x89, 0x00,
-	0x79, 0x00, 0x66, 0x00, 0x66, 0x00, 0x60, 0x00, 0x40, 0x00, 0x2C, 0x00,
-	0x0B, 0x00, 0x1C, 0x00, 0x04, 0x00, 0xF0, 0xFF, 0xDE, 0xFF, 0xC6, 0xFF,
-	0xC9, 0xFF, 0xC7, 0xFF, 0xBA, 0xFF, 0xB5, 0xFF, 0xB6, 0xFF, 0xB3, 0xFF,
-	0xBB, 0xFF, 0xC4, 0xFF, 0xD5, 0xFF, 0xDD, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF,
-	0x0A, 0x00, 0x24, 0x00, 0x26, 0x00, 0x32, 0x00, 0x39, 0x00, 0x3B, 0x00,
-	0x40, 0x00, 0x4D, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x55, 0x00, 0x4B, 0x00,
-	0x46, 0x00, 0x3A, 0x00, 0x28, 0x00, 0x12, 0x00, 0xF2, 0xFF, 0xDD, 0xFF,
-	0xC4, 0xFF, 0xB1, 0xFF, 0xA0, 0xFF, 0x93, 0xFF, 0x7D, 0xFF, 0x76, 0xFF,
-	0x73, 0xFF, 0x67, 0xFF, 0x69, 0xFF, 0x6A, 0xFF, 0x65, 0xFF, 0x6D, 0xFF,
-	0x7E, 0xFF, 0x91, 0xFF, 0x91, 0xFF, 0x9F, 0xFF, 0xB1, 0xFF, 0xC2, 0xFF,
-	0xDF, 0xFF, 0xE9, 0xFF, 0x03, 0x00, 0x0A, 0x00, 0x24, 0x00, 0x3A, 0x00,
-	0x45, 0x00, 0x59, 0x00, 0x57, 0x00, 0x5C, 0x00, 0x48, 0x00, 0x46, 0x00,
-	0x49, 0x00, 0x4E, 0x00, 0x49, 0x00, 0x43, 0x00, 0x35, 0x00, 0x2B, 0x00,
-	0x1F, 0x00, 0x13, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xEE, 0xFF,
-	0xD4, 0xFF, 0xB7, 0xFF, 0xA2, 0xFF, 0x98, 0xFF, 0xA3, 0xFF, 0xA3, 0xFF,
-	0x91, 0xFF, 0x9A, 0xFF, 0x93, 0xFF, 0x9F, 0xFF, 0x94, 0xFF, 0x83, 0xFF,
-	0x72, 0xFF, 0x64, 0xFF, 0x69, 0xFF, 0x79, 0xFF, 0x83, 0xFF, 0x8E, 0xFF,
-	0x9B, 0xFF, 0x9D, 0xFF, 0xB0, 0xFF, 0xC0, 0xFF, 0xD6, 0xFF, 0xE4, 0xFF,
-	0xDE, 0xFF, 0xEC, 0xFF, 0xE2, 0xFF, 0xF8, 0xFF, 0x09, 0x00, 0x19, 0x00,
-	0x0E, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0D, 0x00, 0x0F, 0x00,
-	0x10, 0x00, 0xFD, 0xFF, 0xE2, 0xFF, 0xD6, 0xFF, 0xBB, 0xFF, 0xA9, 0xFF,
-	0x96, 0xFF, 0x88, 0xFF, 0x6C, 0xFF, 0x60, 0xFF, 0x55, 0xFF, 0x60, 0xFF,
-	0x5E, 0xFF, 0x5E, 0xFF, 0x51, 0xFF, 0x5F, 0xFF, 0x67, 0xFF, 0x79, 0xFF,
-	0x8C, 0xFF, 0x9D, 0xFF, 0xBA, 0xFF, 0xD3, 0xFF, 0xF0, 0xFF, 0x17, 0x00,
-	0x2A, 0x00, 0x4E, 0x00, 0x6C, 0x00, 0x83, 0x00, 0x9C, 0x00, 0xA7, 0x00,
-	0xBF, 0x00, 0xCB, 0x00, 0xD5, 0x00, 0xE2, 0x00, 0xD0, 0x00, 0xE0, 0x00,
-	0xD0, 0x00, 0xDB, 0x00, 0xCE, 0x00, 0xC4, 0x00, 0x98, 0x00, 0x6D, 0x00,
-	0x57, 0x00, 0x35, 0x00, 0x24, 0x00, 0xFF, 0xFF, 0xEC, 0xFF, 0xE3, 0xFF,
-	0xC0, 0xFF, 0xA0, 0xFF, 0x90, 0xFF, 0x86, 0xFF, 0x7D, 0xFF, 0x6C, 0xFF,
-	0x57, 0xFF, 0x4B, 0xFF, 0x3A, 0xFF, 0x46, 0xFF, 0x4B, 0xFF, 0x63, 0xFF,
-	0x6C, 0xFF, 0x72, 0xFF, 0x71, 0xFF, 0x7E, 0xFF, 0x8A, 0xFF, 0x87, 0xFF,
-	0x93, 0xFF, 0xA3, 0xFF, 0xA3, 0xFF, 0xBA, 0xFF, 0xD8, 0xFF, 0xC7, 0xFF,
-	0xD4, 0xFF, 0xE2, 0xFF, 0xFB, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF3, 0xFF,
-	0xF8, 0xFF, 0x03, 0x00, 0x15, 0x00, 0x10, 0x00, 0x17, 0x00, 0x18, 0x00,
-	0x1C, 0x00, 0x17, 0x00, 0x2D, 0x00, 0x2C, 0x00, 0x34, 0x00, 0x49, 0x00,
-	0x52, 0x00, 0x62, 0x00, 0x71, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x79, 0x00,
-	0x8D, 0x00, 0x97, 0x00, 0x92, 0x00, 0xA1, 0x00, 0xB9, 0x00, 0xCD, 0x00,
-	0xD8, 0x00, 0xDE, 0x00, 0xF4, 0x00, 0x05, 0x01, 0x0F, 0x01, 0x11, 0x01,
-	0x14, 0x01, 0x1C, 0x01, 0x24, 0x01, 0x25, 0x01, 0x1A, 0x01, 0x14, 0x01,
-	0x0C, 0x01, 0xFC, 0x00, 0x02, 0x01, 0xF3, 0x00, 0xE5, 0x00, 0xC9, 0x00,
-	0xBF, 0x00, 0xAF, 0x00, 0x9B, 0x00, 0x92, 0x00, 0x89, 0x00, 0x89, 0x00,
-	0x6C, 0x00, 0x5D, 0x00, 0x52, 0x00, 0x46, 0x00, 0x54, 0x00, 0x48, 0x00,
-	0x3A, 0x00, 0x39, 0x00, 0x39, 0x00, 0x44, 0x00, 0x4A, 0x00, 0x4F, 0x00,
-	0x51, 0x00, 0x4F, 0x00, 0x44, 0x00, 0x40, 0x00, 0x3B, 0x00, 0x40, 0x00,
-	0x43, 0x00, 0x25, 0x00, 0x26, 0x00, 0x15, 0x00, 0x0B, 0x00, 0xEE, 0xFF,
-	0xE8, 0xFF, 0xDB, 0xFF, 0xCB, 0xFF, 0xB7, 0xFF, 0x9B, 0xFF, 0x81, 0xFF,
-	0x66, 0xFF, 0x56, 0xFF, 0x52, 0xFF, 0x34, 0xFF, 0x24, 0xFF, 0x1C, 0xFF,
-	0x05, 0xFF, 0x0C, 0xFF, 0x07, 0xFF, 0x20, 0xFF, 0x2F, 0xFF, 0x41, 0xFF,
-	0x69, 0xFF, 0x73, 0xFF, 0x9B, 0xFF, 0xAC, 0xFF, 0xC4, 0xFF, 0xE8, 0xFF,
-	0x10, 0x00, 0x26, 0x00, 0x65, 0x00, 0x7F, 0x00, 0x9C, 0x00, 0xC4, 0x00,
-	0xDA, 0x00, 0xEE, 0x00, 0xE8, 0x00, 0xF0, 0x00, 0xEE, 0x00, 0xF4, 0x00,
-	0xFC, 0x00, 0xFD, 0x00, 0xF7, 0x00, 0xEA, 0x00, 0xD6, 0x00, 0xC8, 0x00,
-	0xB4, 0x00, 0xAE, 0x00, 0xA0, 0x00, 0x7E, 0x00, 0x63, 0x00, 0x51, 0x00,
-	0x3F, 0x00, 0x36, 0x00, 0x37, 0x00, 0x30, 0x00, 0x28, 0x00, 0x19, 0x00,
-	0x1A, 0x00, 0x1E, 0x00, 0x27, 0x00, 0x36, 0x00, 0x48, 0x00, 0x49, 0x00,
-	0x4C, 0x00, 0x54, 0x00, 0x6B, 0x00, 0x76, 0x00, 0x79, 0x00, 0x83, 0x00,
-	0x7F, 0x00, 0x8D, 0x00, 0x90, 0x00, 0x90, 0x00, 0xAB, 0x00, 0xA5, 0x00,
-	0x9C, 0x00, 0x91, 0x00, 0x82, 0x00, 0x7A, 0x00, 0x80, 0x00, 0x75, 0x00,
-	0x6B, 0x00, 0x62, 0x00, 0x60, 0x00, 0x51, 0x00, 0x3F, 0x00, 0x40, 0x00,
-	0x3F, 0x00, 0x3F, 0x00, 0x2D, 0x00, 0x18, 0x00, 0x06, 0x00, 0x14, 0x00,
-	0xFB, 0xFF, 0x0B, 0x00, 0x05, 0x00, 0x0A, 0x00, 0x14, 0x00, 0x23, 0x00,
-	0x31, 0x00, 0x36, 0x00, 0x32, 0x00, 0x2F, 0x00, 0x3A, 0x00, 0x43, 0x00,
-	0x53, 0x00, 0x76, 0x00, 0x8E, 0x00, 0xA0, 0x00, 0xD0, 0x00, 0xE4, 0x00,
-	0x03, 0x01, 0x0C, 0x01, 0x21, 0x01, 0x20, 0x01, 0x34, 0x01, 0x47, 0x01,
-	0x46, 0x01, 0x50, 0x01, 0x4F, 0x01, 0x3C, 0x01, 0x2F, 0x01, 0x34, 0x01,
-	0x17, 0x01, 0x06, 0x01, 0xEE, 0x00, 0xC9, 0x00, 0xB1, 0x00, 0x91, 0x00,
-	0x6B, 0x00, 0x4C, 0x00, 0x30, 0x00, 0x0F, 0x00, 0xFA, 0xFF, 0xD6, 0xFF,
-	0xBA, 0xFF, 0xA5, 0xFF, 0x9D, 0xFF, 0x9A, 0xFF, 0x91, 0xFF, 0x96, 0xFF,
-	0x99, 0xFF, 0x9B, 0xFF, 0xA8, 0xFF, 0xC7, 0xFF, 0xE1, 0xFF, 0xEE, 0xFF,
-	0x0E, 0x00, 0x26, 0x00, 0x3E, 0x00, 0x4A, 0x00, 0x6B, 0x00, 0x96, 0x00,
-	0xA6, 0x00, 0xBD, 0x00, 0xC4, 0x00, 0xB6, 0x00, 0xA9, 0x00, 0xB6, 0x00,
-	0xAF, 0x00, 0xB4, 0x00, 0xA7, 0x00, 0x9C, 0x00, 0x76, 0x00, 0x61, 0x00,
-	0x3F, 0x00, 0x24, 0x00, 0xFA, 0xFF, 0xDA, 0xFF, 0xA9, 0xFF, 0x91, 0xFF,
-	0x77, 0xFF, 0x55, 0xFF, 0x4D, 0xFF, 0x34, 0xFF, 0x2D, 0xFF, 0x26, 0xFF,
-	0x1C, 0xFF, 0x15, 0xFF, 0x1A, 0xFF, 0x23, 0xFF, 0x3C, 0xFF, 0x4B, 0xFF,
-	0x56, 0xFF, 0x7E, 0xFF, 0xA4, 0xFF, 0xC0, 0xFF, 0xCA, 0xFF, 0xED, 0xFF,
-	0x05, 0x00, 0x2C, 0x00, 0x35, 0x00, 0x63, 0x00, 0x72, 0x00, 0x84, 0x00,
-	0x9F, 0x00, 0xB1, 0x00, 0xC2, 0x00, 0xDD, 0x00, 0xD8, 0x00, 0xCD, 0x00,
-	0xC8, 0x00, 0xC2, 0x00, 0xB3, 0x00, 0xA4, 0x00, 0x8E, 0x00, 0x75, 0x00,
-	0x5C, 0x00, 0x4D, 0x00, 0x3C, 0x00, 0x26, 0x00, 0x00, 0x00, 0xCA, 0xFF,
-	0xB6, 0xFF, 0x9F, 0xFF, 0x98, 0xFF, 0x8A, 0xFF, 0x6F, 0xFF, 0x5A, 0xFF,
-	0x52, 0xFF, 0x47, 0xFF, 0x4F, 0xFF, 0x5A, 0xFF, 0x5E, 0xFF, 0x5E, 0xFF,
-	0x74, 0xFF, 0x77, 0xFF, 0x90, 0xFF, 0xA3, 0xFF, 0xC4, 0xFF, 0xCF, 0xFF,
-	0xEC, 0xFF, 0xFB, 0xFF, 0x0B, 0x00, 0x24, 0x00, 0x41, 0x00, 0x5D, 0x00,
-	0x65, 0x00, 0x67, 0x00, 0x82, 0x00, 0x79, 0x00, 0x7F, 0x00, 0x7F, 0x00,
-	0x7A, 0x00, 0x71, 0x00, 0x70, 0x00, 0x54, 0x00, 0x53, 0x00, 0x50, 0x00,
-	0x4D, 0x00, 0x40, 0x00, 0x3B, 0x00, 0x30, 0x00, 0x23, 0x00, 0x21, 0x00,
-	0x1A, 0x00, 0x18, 0x00, 0x0A, 0x00, 0x14, 0x00, 0x24, 0x00, 0x23, 0x00,
-	0x23, 0x00, 0x3B, 0x00, 0x49, 0x00, 0x54, 0x00, 0x65, 0x00, 0x7C, 0x00,
-	0x87, 0x00, 0x89, 0x00, 0x8E, 0x00, 0x93, 0x00, 0xA2, 0x00, 0xA8, 0x00,
-	0xBB, 0x00, 0xC2, 0x00, 0xB5, 0x00, 0xAD, 0x00, 0xA2, 0x00, 0xB5, 0x00,
-	0xB0, 0x00, 0xB3, 0x00, 0xAA, 0x00, 0x97, 0x00, 0x8C, 0x00, 0x83, 0x00,
-	0x63, 0x00, 0x63, 0x00, 0x57, 0x00, 0x3F, 0x00, 0x23, 0x00, 0x0D, 0x00,
-	0xF6, 0xFF, 0xDE, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xCB, 0xFF, 0xC5, 0xFF,
-	0xAC, 0xFF, 0x98, 0xFF, 0x8E, 0xFF, 0x93, 0xFF, 0x7D, 0xFF, 0x78, 0xFF,
-	0x86, 0xFF, 0x84, 0xFF, 0x72, 0xFF, 0x71, 0xFF, 0x6C, 0xFF, 0x6C, 0xFF,
-	0x63, 0xFF, 0x60, 0xFF, 0x59, 0xFF, 0x50, 0xFF, 0x47, 0xFF, 0x55, 0xFF,
-	0x5A, 0xFF, 0x59, 0xFF, 0x59, 0xFF, 0x47, 0xFF, 0x49, 0xFF, 0x49, 0xFF,
-	0x4C, 0xFF, 0x4E, 0xFF, 0x55, 0xFF, 0x59, 0xFF, 0x53, 0xFF, 0x4A, 0xFF,
-	0x4F, 0xFF, 0x55, 0xFF, 0x64, 0xFF, 0x69, 0xFF, 0x67, 0xFF, 0x67, 0xFF,
-	0x77, 0xFF, 0x77, 0xFF, 0x85, 0xFF, 0x93, 0xFF, 0x95, 0xFF, 0xA2, 0xFF,
-	0x95, 0xFF, 0xA6, 0xFF, 0xB3, 0xFF, 0xC2, 0xFF, 0xBB, 0xFF, 0xC1, 0xFF,
-	0xCA, 0xFF, 0xCF, 0xFF, 0xDA, 0xFF, 0xD7, 0xFF, 0xE3, 0xFF, 0xDE, 0xFF,
-	0xE8, 0xFF, 0xE9, 0xFF, 0xE7, 0xFF, 0xFC, 0xFF, 0x03, 0x00, 0x0F, 0x00,
-	0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0xF2, 0xFF, 0xE7, 0xFF, 0xD2, 0xFF,
-	0xCE, 0xFF, 0xC2, 0xFF, 0xBC, 0xFF, 0x9F, 0xFF, 0x99, 0xFF, 0x8E, 0xFF,
-	0x80, 0xFF, 0x77, 0xFF, 0x65, 0xFF, 0x49, 0xFF, 0x3B, 0xFF, 0x34, 0xFF,
-	0x24, 0xFF, 0x23, 0xFF, 0x1E, 0xFF, 0x1B, 0xFF, 0x1F, 0xFF, 0x20, 0xFF,
-	0x3A, 0xFF, 0x40, 0xFF, 0x3C, 0xFF, 0x47, 0xFF, 0x42, 0xFF, 0x55, 0xFF,
-	0x65, 0xFF, 0x73, 0xFF, 0x85, 0xFF, 0x8B, 0xFF, 0xA2, 0xFF, 0xB6, 0xFF,
-	0xB6, 0xFF, 0xBD, 0xFF, 0xCA, 0xFF, 0xD7, 0xFF, 0xE6, 0xFF, 0xE9, 0xFF,
-	0x00, 0x00, 0x15, 0x00, 0x27, 0x00, 0x3A, 0x00, 0x37, 0x00, 0x3E, 0x00,
-	0x40, 0x00, 0x52, 0x00, 0x54, 0x00, 0x66, 0x00, 0x6F, 0x00, 0x64, 0x00,
-	0x72, 0x00, 0x71, 0x00, 0x81, 0x00, 0x6B, 0x00, 0x81, 0x00, 0x83, 0x00,
-	0xA0, 0x00, 0xA5, 0x00, 0xA1, 0x00, 0xAF, 0x00, 0xA3, 0x00, 0xAB, 0x00,
-	0xB4, 0x00, 0xB5, 0x00, 0xBB, 0x00, 0xC3, 0x00, 0xBF, 0x00, 0xB5, 0x00,
-	0xB2, 0x00, 0xA8, 0x00, 0xA2, 0x00, 0x9E, 0x00, 0x94, 0x00, 0x83, 0x00,
-	0x89, 0x00, 0x79, 0x00, 0x85, 0x00, 0x80, 0x00, 0x74, 0x00, 0x58, 0x00,
-	0x53, 0x00, 0x59, 0x00, 0x55, 0x00, 0x49, 0x00, 0x4A, 0x00, 0x37, 0x00,
-	0x37, 0x00, 0x35, 0x00, 0x2B, 0x00, 0x23, 0x00, 0x0E, 0x00, 0x01, 0x00,
-	0xEE, 0xFF, 0xE2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xCE, 0xFF, 0xBF, 0xFF,
-	0xB1, 0xFF, 0x9C, 0xFF, 0x8E, 0xFF, 0x7D, 0xFF, 0x73, 0xFF, 0x64, 0xFF,
-	0x5D, 0xFF, 0x5E, 0xFF, 0x5D, 0xFF, 0x4B, 0xFF, 0x4C, 0xFF, 0x1B, 0xFF,
-	0x99, 0xFE, 0x9B, 0xFE, 0xA4, 0xFF, 0x35, 0x00, 0xCA, 0xFF, 0x49, 0xFF,
-	0x31, 0xFF, 0x24, 0xFF, 0x3C, 0xFF, 0x69, 0xFF, 0x67, 0xFF, 0x4F, 0xFF,
-	0x8B, 0xFF, 0xC0, 0xFF, 0x7B, 0xFF, 0x2B, 0xFF, 0x3C, 0xFF, 0x80, 0xFF,
-	0xB5, 0xFF, 0x8B, 0xFF, 0x45, 0xFF, 0x29, 0xFF, 0x33, 0xFF, 0x64, 0xFF,
-	0x4E, 0xFF, 0x16, 0xFF, 0x18, 0xFF, 0x4B, 0xFF, 0x50, 0xFF, 0x31, 0xFF,
-	0x0F, 0xFF, 0x19, 0xFF, 0x38, 0xFF, 0x41, 0xFF, 0x37, 0xFF, 0x23, 0xFF,
-	0x27, 0xFF, 0x40, 0xFF, 0x57, 0xFF, 0x3B, 0xFF, 0x32, 0xFF, 0x40, 0xFF,
-	0x67, 0xFF, 0x71, 0xFF, 0x7D, 0xFF, 0x76, 0xFF, 0x8E, 0xFF, 0xA6, 0xFF,
-	0xB8, 0xFF, 0xA9, 0xFF, 0xA1, 0xFF, 0xA8, 0xFF, 0x9E, 0xFF, 0x8B, 0xFF,
-	0x9E, 0xFF, 0xB3, 0xFF, 0xC8, 0xFF, 0xCA, 0xFF, 0xC6, 0xFF, 0xC0, 0xFF,
-	0xB7, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC4, 0xFF, 0xA9, 0xFF, 0xAE, 0xFF,
-	0x94, 0xFF, 0x81, 0xFF, 0x84, 0xFF, 0x77, 0xFF, 0x89, 0xFF, 0x8E, 0xFF,
-	0x87, 0xFF, 0x80, 0xFF, 0x6B, 0xFF, 0x71, 0xFF, 0x75, 0xFF, 0x73, 0xFF,
-	0x7A, 0xFF, 0x73, 0xFF, 0x76, 0xFF, 0x7F, 0xFF, 0x75, 0xFF, 0x87, 0xFF,
-	0x8B, 0xFF, 0x8C, 0xFF, 0x9E, 0xFF, 0x9E, 0xFF, 0xAC, 0xFF, 0xB6, 0xFF,
-	0xB6, 0xFF, 0xCE, 0xFF, 0xDC, 0xFF, 0xDF, 0xFF, 0xEC, 0xFF, 0xF6, 0xFF,
-	0xFC, 0xFF, 0x03, 0x00, 0x0F, 0x00, 0x1A, 0x00, 0x17, 0x00, 0x18, 0x00,
-	0x2B, 0x00, 0x28, 0x00, 0x2E, 0x00, 0x3A, 0x00, 0x3C, 0x00, 0x3E, 0x00,
-	0x4B, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x41, 0x00, 0x43, 0x00, 0x3C, 0x00,
-	0x37, 0x00, 0x41, 0x00, 0x46, 0x00, 0x3A, 0x00, 0x49, 0x00, 0x45, 0x00,
-	0x41, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x57, 0x00, 0x59, 0x00, 0x44, 0x00,
-	0x40, 0x00, 0x36, 0x00, 0x46, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x55, 0x00,
-	0x58, 0x00, 0x50, 0x00, 0x39, 0x00, 0x2B, 0x00, 0x2D, 0x00, 0x22, 0x00,
-	0x21, 0x00, 0x15, 0x00, 0x04, 0x00, 0xF3, 0xFF, 0xEC, 0xFF, 0xD2, 0xFF,
-	0xB6, 0xFF, 0x9F, 0xFF, 0x8E, 0xFF, 0x7C, 0xFF, 0x77, 0xFF, 0x6C, 0xFF,
-	0x4B, 0xFF, 0x46, 0xFF, 0x3A, 0xFF, 0x32, 0xFF, 0x22, 0xFF, 0x0B, 0xFF,
-	0x0C, 0xFF, 0x02, 0xFF, 0xF8, 0xFE, 0xEE, 0xFE, 0xEA, 0xFE, 0xF8, 0xFE,
-	0xFF, 0xFE, 0xF5, 0xFE, 0xF2, 0xFE, 0xFB, 0xFE, 0xFB, 0xFE, 0x0E, 0xFF,
-	0x13, 0xFF, 0x0E, 0xFF, 0x0F, 0xFF, 0x1A, 0xFF, 0x2D, 0xFF, 0x38, 0xFF,
-	0x35, 0xFF, 0x50, 0xFF, 0x51, 0xFF, 0x46, 0xFF, 0x5B, 0xFF, 0x6E, 0xFF,
-	0x73, 0xFF, 0x73, 0xFF, 0x76, 0xFF, 0x8A, 0xFF, 0x87, 0xFF, 0x87, 0xFF,
-	0x91, 0xFF, 0x8B, 0xFF, 0x93, 0xFF, 0x98, 0xFF, 0xA1, 0xFF, 0x90, 0xFF,
-	0x81, 0xFF, 0x81, 0xFF, 0x78, 0xFF, 0x85, 0xFF, 0x76, 0xFF, 0x73, 0xFF,
-	0x63, 0xFF, 0x58, 0xFF, 0x58, 0xFF, 0x51, 0xFF, 0x40, 0xFF, 0x3D, 0xFF,
-	0x33, 0xFF, 0x31, 0xFF, 0x1F, 0xFF, 0x1A, 0xFF, 0x16, 0xFF, 0x1A, 0xFF,
-	0x23, 0xFF, 0x35, 0xFF, 0x1D, 0xFF, 0x27, 0xFF, 0x1F, 0xFF, 0x27, 0xFF,
-	0x42, 0xFF, 0x56, 0xFF, 0x5B, 0xFF, 0x5E, 0xFF, 0x72, 0xFF, 0x82, 0xFF,
-	0x81, 0xFF, 0x94, 0xFF, 0x8B, 0xFF, 0xA4, 0xFF, 0xB0, 0xFF, 0xAD, 0xFF,
-	0xB6, 0xFF, 0xC1, 0xFF, 0xBD, 0xFF, 0xC9, 0xFF, 0xCA, 0xFF, 0xCC, 0xFF,
-	0xCF, 0xFF, 0xCB, 0xFF, 0xB5, 0xFF, 0xC2, 0xFF, 0xC0, 0xFF, 0xC9, 0xFF,
-	0xCA, 0xFF, 0xBD, 0xFF, 0xB5, 0xFF, 0xB8, 0xFF, 0xB8, 0xFF, 0xC6, 0xFF,
-	0xC6, 0xFF, 0xC4, 0xFF, 0xC1, 0xFF, 0xD0, 0xFF, 0xC1, 0xFF, 0xC4, 0xFF,
-	0xC4, 0xFF, 0xC5, 0xFF, 0xCB, 0xFF, 0xD4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF,
-	0xDA, 0xFF, 0xE4, 0xFF, 0xE3, 0xFF, 0xD7, 0xFF, 0xEB, 0xFF, 0xFB, 0xFF,
-	0x00, 0x00, 0x09, 0x00, 0x01, 0x00, 0xF7, 0xFF, 0xFD, 0xFF, 0x01, 0x00,
-	0x0E, 0x00, 0x05, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x17, 0x00, 0x1A, 0x00,
-	0x15, 0x00, 0x0E, 0x00, 0x0B, 0x00, 0x06, 0x00, 0xFF, 0xFF, 0xF6, 0xFF,
-	0xF7, 0xFF, 0xE6, 0xFF, 0xC0, 0xFF, 0xB5, 0xFF, 0xBD, 0xFF, 0xB6, 0xFF,
-	0xA0, 0xFF, 0x9F, 0xFF, 0x9D, 0xFF, 0x8B, 0xFF, 0x7F, 0xFF, 0x85, 0xFF,
-	0x7F, 0xFF, 0x7C, 0xFF, 0x6C, 0xFF, 0x6C, 0xFF, 0x72, 0xFF, 0x74, 0xFF,
-	0x7B, 0xFF, 0x80, 0xFF, 0x7C, 0xFF, 0x78, 0xFF, 0x8A, 0xFF, 0x89, 0xFF,
-	0x90, 0xFF, 0x85, 0xFF, 0x89, 0xFF, 0x8B, 0xFF, 0x8C, 0xFF, 0x93, 0xFF,
-	0x95, 0xFF, 0x9D, 0xFF, 0x89, 0xFF, 0x8E, 0xFF, 0x81, 0xFF, 0x7F, 0xFF,
-	0x77, 0xFF, 0x6D, 0xFF, 0x6A, 0xFF, 0x5F, 0xFF, 0x4F, 0xFF, 0x58, 0xFF,
-	0x53, 0xFF, 0x31, 0xFF, 0x38, 0xFF, 0x39, 0xFF, 0x36, 0xFF, 0x29, 0xFF,
-	0x36, 0xFF, 0x27, 0xFF, 0x2F, 0xFF, 0x28, 0xFF, 0x2A, 0xFF, 0x2F, 0xFF,
-	0x33, 0xFF, 0x39, 0xFF, 0x38, 0xFF, 0x3D, 0xFF, 0x37, 0xFF, 0x3B, 0xFF,
-	0x40, 0xFF, 0x52, 0xFF, 0x4B, 0xFF, 0x52, 0xFF, 0x5D, 0xFF, 0x65, 0xFF,
-	0x79, 0xFF, 0x7E, 0xFF, 0x80, 0xFF, 0x9A, 0xFF, 0x91, 0xFF, 0x9B, 0xFF,
-	0x9F, 0xFF, 0x9B, 0xFF, 0x9B, 0xFF, 0xA4, 0xFF, 0xAA, 0xFF, 0xB0, 0xFF,
-	0xB2, 0xFF, 0xBB, 0xFF, 0xB3, 0xFF, 0xB0, 0xFF, 0xAD, 0xFF, 0xAC, 0xFF,
-	0xB6, 0xFF, 0xB0, 0xFF, 0xAE, 0xFF, 0xA2, 0xFF, 0x9F, 0xFF, 0xA9, 0xFF,
-	0xA3, 0xFF, 0xAA, 0xFF, 0xA3, 0xFF, 0xA2, 0xFF, 0xA4, 0xFF, 0xAA, 0xFF,
-	0xA3, 0xFF, 0xAC, 0xFF, 0xB0, 0xFF, 0xB2, 0xFF, 0xA9, 0xFF, 0xA8, 0xFF,
-	0xAC, 0xFF, 0xC0, 0xFF, 0xC6, 0xFF, 0xCE, 0xFF, 0xDE, 0xFF, 0xC9, 0xFF,
-	0xD3, 0xFF, 0xDC, 0xFF, 0xF6, 0xFF, 0xF2, 0xFF, 0x0A, 0x00, 0x09, 0x00,
-	0x0F, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x0A, 0x00, 0x0E, 0x00, 0x15, 0x00,
-	0x0F, 0x00, 0x1D, 0x00, 0x0D, 0x00, 0x1D, 0x00, 0x21, 0x00, 0x0E, 0x00,
-	0x15, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
-	0xF3, 0xFF, 0xEB, 0xFF, 0xED, 0xFF, 0xFA, 0xFF, 0xF1, 0xFF, 0xFB, 0xFF,
-	0xFA, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFA, 0xFF, 0xFC, 0xFF,
-	0x09, 0x00, 0x13, 0x00, 0x0F, 0x00, 0x21, 0x00, 0x18, 0x00, 0x28, 0x00,
-	0x34, 0x00, 0x30, 0x00, 0x27, 0x00, 0x22, 0x00, 0x1F, 0x00, 0x19, 0x00,
-	0x17, 0x00, 0x1C, 0x00, 0x22, 0x00, 0x15, 0x00, 0x15, 0x00, 0x17, 0x00,
-	0x06, 0x00, 0xFD, 0xFF, 0xFB, 0xFF, 0xF3, 0xFF, 0xE1, 0xFF, 0xD1, 0xFF,
-	0xCE, 0xFF, 0xD1, 0xFF, 0xD8, 0xFF, 0xD8, 0xFF, 0xDF, 0xFF, 0xD3, 0xFF,
-	0xD4, 0xFF, 0xCA, 0xFF, 0xC1, 0xFF, 0xC0, 0xFF, 0xC4, 0xFF, 0xBD, 0xFF,
-	0xBF, 0xFF, 0xC6, 0xFF, 0xBD, 0xFF, 0xD3, 0xFF, 0xC5, 0xFF, 0xC7, 0xFF,
-	0xCC, 0xFF, 0xD5, 0xFF, 0xC5, 0xFF, 0xCF, 0xFF, 0xD5, 0xFF, 0xD1, 0xFF,
-	0xDD, 0xFF, 0xDA, 0xFF, 0xE2, 0xFF, 0xD4, 0xFF, 0xD9, 0xFF, 0xD6, 0xFF,
-	0xCB, 0xFF, 0xCA, 0xFF, 0xBF, 0xFF, 0xC9, 0xFF, 0xC7, 0xFF, 0xBF, 0xFF,
-	0xC5, 0xFF, 0xC9, 0xFF, 0xC7, 0xFF, 0xCB, 0xFF, 0xC9, 0xFF, 0xB7, 0xFF,
-	0xBA, 0xFF, 0xA5, 0xFF, 0xB2, 0xFF, 0xB2, 0xFF, 0xB6, 0xFF, 0xAF, 0xFF,
-	0xC0, 0xFF, 0xB3, 0xFF, 0xB4, 0xFF, 0xAE, 0xFF, 0xA8, 0xFF, 0xA2, 0xFF,
-	0x98, 0xFF, 0x91, 0xFF, 0x8B, 0xFF, 0x85, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF,
-	0x74, 0xFF, 0x79, 0xFF, 0x85, 0xFF, 0x7C, 0xFF, 0x78, 0xFF, 0x7B, 0xFF,
-	0x87, 0xFF, 0x8B, 0xFF, 0x91, 0xFF, 0xA3, 0xFF, 0xA9, 0xFF, 0xB3, 0xFF,
-	0xC1, 0xFF, 0xC7, 0xFF, 0xDF, 0xFF, 0xFA, 0xFF, 0x04, 0x00, 0x1A, 0x00,
-	0x2F, 0x00, 0x3C, 0x00, 0x5E, 0x00, 0x6F, 0x00, 0x7A, 0x00, 0x8A, 0x00,
-	0x9F, 0x00, 0xB1, 0x00, 0xCD, 0x00, 0xC6, 0x00, 0xDE, 0x00, 0xED, 0x00,
-	0xF3, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xEA, 0x00, 0xED, 0x00, 0xF5, 0x00,
-	0xE6, 0x00, 0xD7, 0x00, 0xD3, 0x00, 0xC3, 0x00, 0xB9, 0x00, 0xAC, 0x00,
-	0xA5, 0x00, 0x97, 0x00, 0x8A, 0x00, 0x75, 0x00, 0x68, 0x00, 0x4E, 0x00,
-	0x46, 0x00, 0x3C, 0x00, 0x3B, 0x00, 0x37, 0x00, 0x2A, 0x00, 0x1F, 0x00,
-	0x26, 0x00, 0x22, 0x00, 0x1E, 0x00, 0x1A, 0x00, 0x22, 0x00, 0x28, 0x00,
-	0x26, 0x00, 0x1C, 0x00, 0x22, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x49, 0x00,
-	0x4E, 0x00, 0x4D, 0x00, 0x60, 0x00, 0x57, 0x00, 0x5E, 0x00, 0x65, 0x00,
-	0x66, 0x00, 0x61, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x48, 0x00, 0x3A, 0x00,
-	0x35, 0x00, 0x39, 0x00, 0x2F, 0x00, 0x25, 0x00, 0x1D, 0x00, 0x0A, 0x00,
-	0xF8, 0xFF, 0xDB, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xC6, 0xFF, 0xAC, 0xFF,
-	0xA7, 0xFF, 0x9A, 0xFF, 0x9D, 0xFF, 0x96, 0xFF, 0x98, 0xFF, 0x9E, 0xFF,
-	0xA5, 0xFF, 0x98, 0xFF, 0xB3, 0xFF, 0xAD, 0xFF, 0xB7, 0xFF, 0xBA, 0xFF,
-	0xD0, 0xFF, 0xD1, 0xFF, 0xEB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
-	0x09, 0x00, 0x1E, 0x00, 0x3A, 0x00, 0x35, 0x00, 0x37, 0x00, 0x36, 0x00,
-	0x44, 0x00, 0x32, 0x00, 0x36, 0x00, 0x31, 0x00, 0x32, 0x00, 0x25, 0x00,
-	0x22, 0x00, 0x09, 0x00, 0xF8, 0xFF, 0xF8, 0xFF, 0xEC, 0xFF, 0xDF, 0xFF,
-	0xE8, 0xFF, 0xD9, 0xFF, 0xD8, 0xFF, 0xC1, 0xFF, 0xBF, 0xFF, 0xB3, 0xFF,
-	0x9E, 0xFF, 0x9A, 0xFF, 0x98, 0xFF, 0x98, 0xFF, 0x99, 0xFF, 0x8F, 0xFF,
-	0x94, 0xFF, 0x95, 0xFF, 0x8D, 0xFF, 0x8A, 0xFF, 0x95, 0xFF, 0x8B, 0xFF,
-	0x90, 0xFF, 0x91, 0xFF, 0x98, 0xFF, 0xA2, 0xFF, 0x9B, 0xFF, 0xA4, 0xFF,
-	0xA4, 0xFF, 0xA3, 0xFF, 0xA9, 0xFF, 0xA9, 0xFF, 0xAE, 0xFF, 0xA9, 0xFF,
-	0xB4, 0xFF, 0xB4, 0xFF, 0xB2, 0xFF, 0xB4, 0xFF, 0xB3, 0xFF, 0xB2, 0xFF,
-	0xBC, 0xFF, 0xB1, 0xFF, 0xAC, 0xFF, 0xA0, 0xFF, 0xA5, 0xFF, 0xA4, 0xFF,
-	0xA3, 0xFF, 0xA2, 0xFF, 0x9B, 0xFF, 0x98, 0xFF, 0x99, 0xFF, 0xA0, 0xFF,
-	0xA7, 0xFF, 0x98, 0xFF, 0xA3, 0xFF, 0xA0, 0xFF, 0xA8, 0xFF, 0xAE, 0xFF,
-	0xBA, 0xFF, 0xC6, 0xFF, 0xCE, 0xFF, 0xDE, 0xFF, 0xEC, 0xFF, 0xF6, 0xFF,
-	0x06, 0x00, 0x1A, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x3B, 0x00, 0x44, 0x00,
-	0x40, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x79, 0x00, 0x7D, 0x00, 0x84, 0x00,
-	0x94, 0x00, 0xA2, 0x00, 0xA0, 0x00, 0x91, 0x00, 0x9F, 0x00, 0x9C, 0x00,
-	0xA0, 0x00, 0x96, 0x00, 0x9C, 0x00, 0x91, 0x00, 0x8D, 0x00, 0x83, 0x00,
-	0x79, 0x00, 0x75, 0x00, 0x6C, 0x00, 0x56, 0x00, 0x4F, 0x00, 0x4E, 0x00,
-	0x3C, 0x00, 0x27, 0x00, 0x1C, 0x00, 0x14, 0x00, 0x0A, 0x00, 0x04, 0x00,
-	0xFC, 0xFF, 0xF2, 0xFF, 0xEE, 0xFF, 0xDD, 0xFF, 0xCF, 0xFF, 0xCF, 0xFF,
-	0xCE, 0xFF, 0xBD, 0xFF, 0xBF, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xBA, 0xFF,
-	0xB8, 0xFF, 0xB8, 0xFF, 0xB3, 0xFF, 0xB3, 0xFF, 0xAE, 0xFF, 0x9B, 0xFF,
-	0xA5, 0xFF, 0xAC, 0xFF, 0xA5, 0xFF, 0x93, 0xFF, 0x94, 0xFF, 0x99, 0xFF,
-	0x8F, 0xFF, 0x94, 0xFF, 0x8B, 0xFF, 0x87, 0xFF, 0x74, 0xFF, 0x6F, 0xFF,
-	0x7C, 0xFF, 0x6E, 0xFF, 0x6F, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0x4B, 0xFF,
-	0x43, 0xFF, 0x3B, 0xFF, 0x35, 0xFF, 0x34, 0xFF, 0x3C, 0xFF, 0x36, 0xFF,
-	0x34, 0xFF, 0x39, 0xFF, 0x3D, 0xFF, 0x41, 0xFF, 0x3D, 0xFF, 0x48, 0xFF,
-	0x4D, 0xFF, 0x5A, 0xFF, 0x6A, 0xFF, 0x65, 0xFF, 0x6D, 0xFF, 0x6E, 0xFF,
-	0x80, 0xFF, 0x82, 0xFF, 0x8E, 0xFF, 0x83, 0xFF, 0x8C, 0xFF, 0x8E, 0xFF,
-	0x8F, 0xFF, 0x94, 0xFF, 0x96, 0xFF, 0x98, 0xFF, 0x8E, 0xFF, 0x89, 0xFF,
-	0x89, 0xFF, 0x91, 0xFF, 0x82, 0xFF, 0x8F, 0xFF, 0x82, 0xFF, 0x7E, 0xFF,
-	0x77, 0xFF, 0x7E, 0xFF, 0x72, 0xFF, 0x69, 0xFF, 0x5F, 0xFF, 0x59, 0xFF,
-	0x4B, 0xFF, 0x43, 0xFF, 0x42, 0xFF, 0x3B, 0xFF, 0x3E, 0xFF, 0x39, 0xFF,
-	0x2F, 0xFF, 0x33, 0xFF, 0x2D, 0xFF, 0x20, 0xFF, 0x2D, 0xFF, 0x21, 0xFF,
-	0x33, 0xFF, 0x45, 0xFF, 0x45, 0xFF, 0x48, 0xFF, 0x4C, 0xFF, 0x50, 0xFF,
-	0x67, 0xFF, 0x6D, 0xFF, 0x73, 0xFF, 0x7F, 0xFF, 0x71, 0xFF, 0x7D, 0xFF,
-	0x85, 0xFF, 0x95, 0xFF, 0xA0, 0xFF, 0xAC, 0xFF, 0xA8, 0xFF, 0xB0, 0xFF,
-	0xB8, 0xFF, 0xB7, 0xFF, 0xC6, 0xFF, 0xCE, 0xFF, 0xD7, 0xFF, 0xE4, 0xFF,
-	0xE3, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xE9, 0xFF, 0xED, 0xFF, 0xEC, 0xFF,
-	0xF6, 0xFF, 0xFA, 0xFF, 0xEE, 0xFF, 0xF2, 0xFF, 0xE2, 0xFF, 0xE7, 0xFF,
-	0xEC, 0xFF, 0xE9, 0xFF, 0xF6, 0xFF, 0xEC, 0xFF, 0xE8, 0xFF, 0xE6, 0xFF,
-	0xE6, 0xFF, 0xE3, 0xFF, 0xE4, 0xFF, 0xD8, 0xFF, 0xD9, 0xFF, 0xDA, 0xFF,
-	0xE8, 0xFF, 0xE7, 0xFF, 0xE8, 0xFF, 0xED, 0xFF, 0xF0, 0xFF, 0xF3, 0xFF,
-	0xF3, 0xFF, 0xF3, 0xFF, 0xF1, 0xFF, 0xF6, 0xFF, 0xE7, 0xFF, 0xF6, 0xFF,
-	0x03, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x03, 0x00, 0xFB, 0xFF, 0xFD, 0xFF,
-	0xED, 0xFF, 0xF1, 0xFF, 0xE7, 0xFF, 0xE3, 0xFF, 0xDE, 0xFF, 0xDF, 0xFF,
-	0xD8, 0xFF, 0xC7, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xB3, 0xFF, 0xAE, 0xFF,
-	0xB0, 0xFF, 0xA2, 0xFF, 0x9B, 0xFF, 0x9A, 0xFF, 0x90, 0xFF, 0x8B, 0xFF,
-	0x87, 0xFF, 0x87, 0xFF, 0x86, 0xFF, 0x82, 0xFF, 0x8B, 0xFF, 0x82, 0xFF,
-	0x8E, 0xFF, 0x9A, 0xFF, 0x9A, 0xFF, 0x95, 0xFF, 0xA3, 0xFF, 0xA2, 0xFF,
-	0xA4, 0xFF, 0xA6, 0xFF, 0xA2, 0xFF, 0xAD, 0xFF, 0xAE, 0xFF, 0xAE, 0xFF,
-	0xA9, 0xFF, 0xA6, 0xFF, 0x9E, 0xFF, 0x9A, 0xFF, 0x9C, 0xFF, 0x91, 0xFF,
-	0x87, 0xFF, 0x8B, 0xFF, 0x78, 0xFF, 0x86, 0xFF, 0x71, 0xFF, 0x72, 0xFF,
-	0x6B, 0xFF, 0x65, 0xFF, 0x6C, 0xFF, 0x65, 0xFF, 0x60, 0xFF, 0x6B, 0xFF,
-	0x6B, 0xFF, 0x69, 0xFF, 0x77, 0xFF, 0x6B, 0xFF, 0x6B, 0xFF, 0x71, 0xFF,
-	0x71, 0xFF, 0x6E, 0xFF, 0x8F, 0xFF, 0x8C, 0xFF, 0x93, 0xFF, 0x9D, 0xFF,
-	0x9E, 0xFF, 0xA1, 0xFF, 0xAD, 0xFF, 0xB8, 0xFF, 0xBD, 0xFF, 0xB5, 0xFF,
-	0xAE, 0xFF, 0xB0, 0xFF, 0xA9, 0xFF, 0xB0, 0xFF, 0xAE, 0xFF, 0xA6, 0xFF,
-	0x97, 0xFF, 0x95, 0xFF, 0x87, 0xFF, 0x89, 0xFF, 0x7D, 0xFF, 0x84, 0xFF,
-	0x7B, 0xFF, 0x73, 0xFF, 0x63, 0xFF, 0x5A, 0xFF, 0x5A, 0xFF, 0x5D, 0xFF,
-	0x66, 0xFF, 0x5B, 0xFF, 0x56, 0xFF, 0x59, 0xFF, 0x53, 0xFF, 0x56, 0xFF,
-	0x59, 0xFF, 0x68, 0xFF, 0x71, 0xFF, 0x7A, 0xFF, 0x8F, 0xFF, 0xA3, 0xFF,
-	0xB5, 0xFF, 0xC0, 0xFF, 0xD5, 0xFF, 0xE3, 0xFF, 0xEC, 0xFF, 0xFA, 0xFF,
-	0x01, 0x00, 0x0E, 0x00, 0x27, 0x00, 0x31, 0x00, 0x40, 0x00, 0x45, 0x00,
-	0x4E, 0x00, 0x53, 0x00, 0x57, 0x00, 0x55, 0x00, 0x50, 0x00, 0x45, 0x00,
-	0x43, 0x00, 0x2D, 0x00, 0x37, 0x00, 0x37, 0x00, 0x35, 0x00, 0x2B, 0x00,
-	0x21, 0x00, 0x19, 0x00, 0x14, 0x00, 0x17, 0x00, 0x01, 0x00, 0xFC, 0xFF,
-	0xFA, 0xFF, 0xEE, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0x06, 0x00, 0xF6, 0xFF,
-	0x04, 0x00, 0x10, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x2B, 0x00, 0x35, 0x00,
-	0x3A, 0x00, 0x33, 0x00, 0x43, 0x00, 0x49, 0x00, 0x55, 0x00, 0x66, 0x00,
-	0x6C, 0x00, 0x72, 0x00, 0x68, 0x00, 0x79, 0x00, 0x6B, 0x00, 0x69, 0x00,
-	0x5D, 0x00, 0x5E, 0x00, 0x5A, 0x00, 0x63, 0x00, 0x5E, 0x00, 0x5A, 0x00,
-	0x45, 0x00, 0x2E, 0x00, 0x26, 0x00, 0x1A, 0x00, 0x01, 0x00, 0xF5, 0xFF,
-	0xDC, 0xFF, 0xD4, 0xFF, 0xCE, 0xFF, 0xB2, 0xFF, 0xA2, 0xFF, 0x9D, 0xFF,
-	0x95, 0xFF, 0x87, 0xFF, 0x78, 0xFF, 0x70, 0xFF, 0x6D, 0xFF, 0x61, 0xFF,
-	0x62, 0xFF, 0x6B, 0xFF, 0x73, 0xFF, 0x70, 0xFF, 0x77, 0xFF, 0x7C, 0xFF,
-	0x85, 0xFF, 0x97, 0xFF, 0xA8, 0xFF, 0xB6, 0xFF, 0xBD, 0xFF, 0xCA, 0xFF,
-	0xDD, 0xFF, 0xDA, 0xFF, 0xE9, 0xFF, 0xED, 0xFF, 0xFD, 0xFF, 0x01, 0x00,
-	0x00, 0x00, 0x06, 0x00, 0x0D, 0x00, 0x14, 0x00, 0x06, 0x00, 0x0A, 0x00,
-	0x01, 0x00, 0x13, 0x00, 0xF6, 0xFF, 0x03, 0x00, 0xEE, 0xFF, 0xE4, 0xFF,
-	0xE2, 0xFF, 0xD0, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xC4, 0xFF, 0xC2, 0xFF,
-	0xAC, 0xFF, 0xA8, 0xFF, 0xB0, 0xFF, 0xA7, 0xFF, 0x9F, 0xFF, 0xA6, 0xFF,
-	0xA6, 0xFF, 0xA1, 0xFF, 0x9E, 0xFF, 0xAC, 0xFF, 0xA7, 0xFF, 0xAB, 0xFF,
-	0xAE, 0xFF, 0xB6, 0xFF, 0xB8, 0xFF, 0xCA, 0xFF, 0xC8, 0xFF, 0xDA, 0xFF,
-	0xE2, 0xFF, 0xDA, 0xFF, 0xE4, 0xFF, 0xE4, 0xFF, 0xF0, 0xFF, 0xF1, 0xFF,
-	0xFD, 0xFF, 0xF8, 0xFF, 0xF2, 0xFF, 0xEC, 0xFF, 0xE9, 0xFF, 0xEB, 0xFF,
-	0xF5, 0xFF, 0xE6, 0xFF, 0xE2, 0xFF, 0xD8, 0xFF, 0xC5, 0xFF, 0xC0, 0xFF,
-	0xB2, 0xFF, 0xB0, 0xFF, 0xA7, 0xFF, 0xA4, 0xFF, 0x97, 0xFF, 0x90, 0xFF,
-	0x8B, 0xFF, 0x8E, 0xFF, 0x8A, 0xFF, 0x95, 0xFF, 0x80, 0xFF, 0x93, 0xFF,
-	0x8E, 0xFF, 0x9C, 0xFF, 0x98, 0xFF, 0xA6, 0xFF, 0xA4, 0xFF, 0xAB, 0xFF,
-	0xAD, 0xFF, 0xC0, 0xFF, 0xBD, 0xFF, 0xC6, 0xFF, 0xD5, 0xFF, 0xD7, 0xFF,
-	0xE1, 0xFF, 0xE2, 0xFF, 0xE8, 0xFF, 0xE9, 0xFF, 0xF2, 0xFF, 0xF3, 0xFF,
-	0x01, 0x00, 0x0E, 0x00, 0x12, 0x00, 0x0D, 0x00, 0x10, 0x00, 0x10, 0x00,
-	0x14, 0x00, 0x0F, 0x00, 0x17, 0x00, 0x0D, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0xFC, 0xFF, 0xF6, 0xFF, 0xEE, 0xFF, 0xE8, 0xFF, 0xE4, 0xFF, 0xD8, 0xFF,
-	0xD7, 0xFF, 0xCD, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF, 0xBD, 0xFF, 0xB3, 0xFF,
-	0xBA, 0xFF, 0xBC, 0xFF, 0xB7, 0xFF, 0xB7, 0xFF, 0xB7, 0xFF, 0xB8, 0xFF,
-	0xBB, 0xFF, 0xBC, 0xFF, 0xB2, 0xFF, 0xC1, 0xFF, 0xC4, 0xFF, 0xC4, 0xFF,
-	0xB5, 0xFF, 0xCF, 0xFF, 0xCE, 0xFF, 0xCF, 0xFF, 0xD7, 0xFF, 0xDC, 0xFF,
-	0xE2, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xE4, 0xFF, 0xDF, 0xFF, 0xE6, 0xFF,
-	0xE2, 0xFF, 0xD7, 0xFF, 0xDE, 0xFF, 0xCF, 0xFF, 0xCA, 0xFF, 0xCF, 0xFF,
-	0xBC, 0xFF, 0xC4, 0xFF, 0xBB, 0xFF, 0xB3, 0xFF, 0x9F, 0xFF, 0x94, 0xFF,
-	0x80, 0xFF, 0x77, 0xFF, 0x69, 0xFF, 0x6B, 0xFF, 0x63, 0xFF, 0x5F, 0xFF,
-	0x5D, 0xFF, 0x55, 0xFF, 0x5A, 0xFF, 0x55, 0xFF, 0x4A, 0xFF, 0x59, 0xFF,
-	0x59, 0xFF, 0x63, 0xFF, 0x62, 0xFF, 0x7A, 0xFF, 0x7F, 0xFF, 0x8E, 0xFF,
-	0x9C, 0xFF, 0xA6, 0xFF, 0xA6, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xC6, 0xFF,
-	0xD0, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xEB, 0xFF, 0xE7, 0xFF, 0xE8, 0xFF,
-	0xF3, 0xFF, 0xEB, 0xFF, 0xF5, 0xFF, 0xFC, 0xFF, 0xE8, 0xFF, 0xD7, 0xFF,
-	0xB8, 0xFF, 0xBC, 0xFF, 0xB8, 0xFF, 0xB3, 0xFF, 0xA9, 0xFF, 0x99, 0xFF,
-	0x7F, 0xFF, 0x89, 0xFF, 0x84, 0xFF, 0x7F, 0xFF, 0x81, 0xFF, 0x6A, 0xFF,
-	0x5D, 0xFF, 0x5B, 0xFF, 0x56, 0xFF, 0x5F, 0xFF, 0x63, 0xFF, 0x69, 0xFF,
-	0x6D, 0xFF, 0x81, 0xFF, 0x84, 0xFF, 0x95, 0xFF, 0x9B, 0xFF, 0xA2, 0xFF,
-	0xBD, 0xFF, 0xB3, 0xFF, 0xD0, 0xFF, 0xD9, 0xFF, 0xDE, 0xFF, 0xEB, 0xFF,
-	0xEE, 0xFF, 0x04, 0x00, 0xF7, 0xFF, 0x0A, 0x00, 0x19, 0x00, 0x01, 0x00,
-	0x0A, 0x00, 0x0A, 0x00, 0x12, 0x00, 0x19, 0x00, 0x0D, 0x00, 0x18, 0x00,
-	0x05, 0x00, 0x03, 0x00, 0xFA, 0xFF, 0xFB, 0xFF, 0xF2, 0xFF, 0xFA, 0xFF,
-	0xE8, 0xFF, 0xDA, 0xFF, 0xCA, 0xFF, 0xC4, 0xFF, 0xBD, 0xFF, 0xC0, 0xFF,
-	0xB3, 0xFF, 0xA8, 0xFF, 0xA4, 0xFF, 0x91, 0xFF, 0x91, 0xFF, 0x87, 0xFF,
-	0x8E, 0xFF, 0x89, 0xFF, 0x80, 0xFF, 0x84, 0xFF, 0x80, 0xFF, 0x7B, 0xFF,
-	0x7F, 0xFF, 0x84, 0xFF, 0x87, 0xFF, 0x81, 0xFF, 0x7B, 0xFF, 0x82, 0xFF,
-	0x8B, 0xFF, 0x91, 0xFF, 0x93, 0xFF, 0x94, 0xFF, 0xA7, 0xFF, 0xA8, 0xFF,
-	0x9B, 0xFF, 0xA2, 0xFF, 0x9D, 0xFF, 0xA5, 0xFF, 0xB6, 0xFF, 0x9A, 0xFF,
-	0xB3, 0xFF, 0x9D, 0xFF, 0x95, 0xFF, 0x9D, 0xFF, 0xA4, 0xFF, 0xB2, 0xFF,
-	0xAD, 0xFF, 0xA5, 0xFF, 0x9F, 0xFF, 0xA9, 0xFF, 0xA8, 0xFF, 0xA7, 0xFF,
-	0xAB, 0xFF, 0xB2, 0xFF, 0xB3, 0xFF, 0xB3, 0xFF, 0xC4, 0xFF, 0xD8, 0xFF,
-	0xE8, 0xFF, 0xE2, 0xFF, 0xDC, 0xFF, 0xEE, 0xFF, 0xF3, 0xFF, 0xF8, 0xFF,
-	0xFA, 0xFF, 0x08, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x06, 0x00,
-	0xF6, 0xFF, 0xED, 0xFF, 0xF1, 0xFF, 0xDE, 0xFF, 0xDC, 0xFF, 0xC4, 0xFF,
-	0xCF, 0xFF, 0xC1, 0xFF, 0xB7, 0xFF, 0xAC, 0xFF, 0xA7, 0xFF, 0x9F, 0xFF,
-	0x9F, 0xFF, 0x95, 0xFF, 0x8B, 0xFF, 0x93, 0xFF, 0x8B, 0xFF, 0x91, 0xFF,
-	0x95, 0xFF, 0x8F, 0xFF, 0x93, 0xFF, 0x93, 0xFF, 0xA5, 0xFF, 0xAD, 0xFF,
-	0xB2, 0xFF, 0xA9, 0xFF, 0xBB, 0xFF, 0xBF, 0xFF, 0xCA, 0xFF, 0xD4, 0xFF,
-	0xD9, 0xFF, 0xDE, 0xFF, 0xE1, 0xFF, 0xEB, 0xFF, 0xE7, 0xFF, 0xF7, 0xFF,
-	0xF7, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0x06, 0x00, 0x0F, 0x00,
-	0x0F, 0x00, 0x06, 0x00, 0x04, 0x00, 0x08, 0x00, 0xFA, 0xFF, 0xF5, 0xFF,
-	0x05, 0x00, 0xFD, 0xFF, 0xF3, 0xFF, 0xF0, 0xFF, 0xE2, 0xFF, 0xE3, 0xFF,
-	0xE2, 0xFF, 0xE1, 0xFF, 0xDA, 0xFF, 0xDE, 0xFF, 0xD5, 0xFF, 0xDE, 0xFF,
-	0xD3, 0xFF, 0xCF, 0xFF, 0xD4, 0xFF, 0xD8, 0xFF, 0xCE, 0xFF, 0xD9, 0xFF,
-	0xDA, 0xFF, 0xD8, 0xFF, 0xD9, 0xFF, 0xDA, 0xFF, 0xE7, 0xFF, 0xDE, 0xFF,
-	0xE8, 0xFF, 0xE8, 0xFF, 0xF6, 0xFF, 0xF3, 0xFF, 0xF0, 0xFF, 0xFC, 0xFF,
-	0xFC, 0xFF, 0x00, 0x00, 0xFD, 0xFF, 0x0D, 0x00, 0x04, 0x00, 0x06, 0x00,
-	0x0E, 0x00, 0x10, 0x00, 0x1C, 0x00, 0x0B, 0x00, 0x0D, 0x00, 0x0D, 0x00,
-	0x14, 0x00, 0x14, 0x00, 0x0D, 0x00, 0x08, 0x00, 0x04, 0x00, 0x10, 0x00,
-	0x05, 0x00, 0x04, 0x00, 0x0A, 0x00, 0x08, 0x00, 0x05, 0x00, 0x09, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFA, 0xFF, 0xF0, 0xFF, 0xF1, 0xFF,
-	0xF8, 0xFF, 0xF2, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0xF6, 0xFF, 0xF2, 0xFF,
-	0xF0, 0xFF, 0xFD, 0xFF, 0xF8, 0xFF, 0xEE, 0xFF, 0xF2, 0xFF, 0xE8, 0xFF,
-	0xE1, 0xFF, 0xE2, 0xFF, 0xEB, 0xFF, 0xEB, 0xFF, 0xEC, 0xFF, 0xDA, 0xFF,
-	0xD4, 0xFF, 0xCB, 0xFF, 0xC9, 0xFF, 0xC4, 0xFF, 0xB3, 0xFF, 0xB1, 0xFF,
-	0xAC, 0xFF, 0xAA, 0xFF, 0xA9, 0xFF, 0xAC, 0xFF, 0xB3, 0xFF, 0xBB, 0xFF,
-	0xB1, 0xFF, 0xBA, 0xFF, 0xAD, 0xFF, 0xB4, 0xFF, 0xBD, 0xFF, 0xC5, 0xFF,
-	0xC1, 0xFF, 0xC9, 0xFF, 0xCA, 0xFF, 0xD0, 0xFF, 0xDA, 0xFF, 0xE4, 0xFF,
-	0xE2, 0xFF, 0xE7, 0xFF, 0xD9, 0xFF, 0xD9, 0xFF, 0xE8, 0xFF, 0xE4, 0xFF,
-	0xE6, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xCA, 0xFF, 0xB7, 0xFF, 0xC2, 0xFF,
-	0xB4, 0xFF, 0xAF, 0xFF, 0xA8, 0xFF, 0xA7, 0xFF, 0x99, 0xFF, 0x94, 0xFF,
-	0x98, 0xFF, 0x95, 0xFF, 0x99, 0xFF, 0x8F, 0xFF, 0x95, 0xFF, 0x8F, 0xFF,
-	0x91, 0xFF, 0x94, 0xFF, 0xA4, 0xFF, 0xA7, 0xFF, 0xA2, 0xFF, 0xBD, 0xFF,
-	0xBC, 0xFF, 0xBD, 0xFF, 0xC9, 0xFF, 0xE3, 0xFF, 0xE4, 0xFF, 0xF3, 0xFF,
-	0xF0, 0xFF, 0x0D, 0x00, 0x12, 0x00, 0x13, 0x00, 0x22, 0x00, 0x2F, 0x00,
-	0x2A, 0x00, 0x34, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x3C, 0x00,
-	0x36, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x2A, 0x00, 0x23, 0x00, 0x1C, 0x00,
-	0x14, 0x00, 0x10, 0x00, 0x01, 0x00, 0xF6, 0xFF, 0xF2, 0xFF, 0xF2, 0xFF,
-	0xE4, 0xFF, 0xEE, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xEE, 0xFF, 0xE8, 0xFF,
-	0xE9, 0xFF, 0xE6, 0xFF, 0xE8, 0xFF, 0xF5, 0xFF, 0xE6, 0xFF, 0xF7, 0xFF,
-	0xFB, 0xFF, 0xF2, 0xFF, 0x10, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x10, 0x00,
-	0x14, 0x00, 0x1A, 0x00, 0x1F, 0x00, 0x25, 0x00, 0x35, 0x00, 0x28, 0x00,
-	0x2A, 0x00, 0x28, 0x00, 0x22, 0x00, 0x1F, 0x00, 0x25, 0x00, 0x15, 0x00,
-	0x0E, 0x00, 0x04, 0x00, 0x09, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xDE, 0xFF,
-	0xDE, 0xFF, 0xDB, 0xFF, 0xDD, 0xFF, 0xCF, 0xFF, 0xC7, 0xFF, 0xC6, 0xFF,
-	0xCF, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDB, 0xFF, 0xDA, 0xFF, 0xD9, 0xFF,
-	0xDA, 0xFF, 0xE7, 0xFF, 0xEC, 0xFF, 0xF0, 0xFF, 0x0B, 0x00, 0x00, 0x00,
-	0x09, 0x00, 0x10, 0x00, 0x0E, 0x00, 0x14, 0x00, 0x13, 0x00, 0x23, 0x00,
-	0x1D, 0x00, 0x28, 0x00, 0x2A, 0x00, 0x28, 0x00, 0x25, 0x00, 0x1E, 0x00,
-	0x18, 0x00, 0x10, 0x00, 0x0B, 0x00, 0x05, 0x00, 0x04, 0x00, 0xF8, 0xFF,
-	0xF1, 0xFF, 0xE8, 0xFF, 0xDE, 0xFF, 0xE1, 0xFF, 0xDA, 0xFF, 0xD3, 0xFF,
-	0xCB, 0xFF, 0xC0, 0xFF, 0xB8, 0xFF, 0xBB, 0xFF, 0xB7, 0xFF, 0xB1, 0xFF,
-	0xBB, 0xFF, 0xB3, 0xFF, 0xAE, 0xFF, 0xB6, 0xFF, 0xC0, 0xFF, 0xBC, 0xFF,
-	0xC1, 0xFF, 0xC7, 0xFF, 0xC9, 0xFF, 0xD5, 0xFF, 0xCA, 0xFF, 0xD8, 0xFF,
-	0xD8, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xD4, 0xFF, 0xD9, 0xFF, 0xCF, 0xFF,
-	0xD0, 0xFF, 0xD0, 0xFF, 0xC4, 0xFF, 0xBD, 0xFF, 0xBB, 0xFF, 0xB3, 0xFF,
-	0xBF, 0xFF, 0xB6, 0xFF, 0xAC, 0xFF, 0xA3, 0xFF, 0xAC, 0xFF, 0x9E, 0xFF,
-	0x95, 0xFF, 0x94, 0xFF, 0x91, 0xFF, 0x83, 0xFF, 0x87, 0xFF, 0x7E, 0xFF,
-	0x8A, 0xFF, 0x8F, 0xFF, 0x8C, 0xFF, 0x87, 0xFF, 0x81, 0xFF, 0x8A, 0xFF,
-	0x9F, 0xFF, 0x9D, 0xFF, 0xAA, 0xFF, 0xAE, 0xFF, 0xBC, 0xFF, 0xCA, 0xFF,
-	0xD0, 0xFF, 0xDC, 0xFF, 0xE3, 0xFF, 0xE9, 0xFF, 0xFD, 0xFF, 0x00, 0x00,
-	0x0D, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0D, 0x00, 0x0F, 0x00, 0x1C, 0x00,
-	0x1C, 0x00, 0x1A, 0x00, 0x15, 0x00, 0x14, 0x00, 0x0B, 0x00, 0xFC, 0xFF,
-	0x06, 0x00, 0xFA, 0xFF, 0xF6, 0xFF, 0xF7, 0xFF, 0xEB, 0xFF, 0xE1, 0xFF,
-	0xE4, 0xFF, 0xE2, 0xFF, 0xDE, 0xFF, 0xD4, 0xFF, 0xE2, 0xFF, 0xE7, 0xFF,
-	0xEB, 0xFF, 0xEC, 0xFF, 0xF8, 0xFF, 0x06, 0x00, 0x0B, 0x00, 0x05, 0x00,
-	0xFC, 0xFF, 0x0F, 0x00, 0x1C, 0x00, 0x22, 0x00, 0x1E, 0x00, 0x2C, 0x00,
-	0x39, 0x00, 0x2D, 0x00, 0x36, 0x00, 0x34, 0x00, 0x45, 0x00, 0x36, 0x00,
-	0x2F, 0x00, 0x2F, 0x00, 0x15, 0x00, 0x24, 0x00, 0x0D, 0x00, 0x0A, 0x00,
-	0xFD, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xD4, 0xFF, 0xC6, 0xFF, 0xC2, 0xFF,
-	0xAF, 0xFF, 0xA8, 0xFF, 0x9E, 0xFF, 0x95, 0xFF, 0x8A, 0xFF, 0x86, 0xFF,
-	0x87, 0xFF, 0x86, 0xFF, 0x78, 0xFF, 0x7E, 0xFF, 0x81, 0xFF, 0x7C, 0xFF,
-	0x8B, 0xFF, 0x90, 0xFF, 0x9A, 0xFF, 0xA7, 0xFF, 0xAC, 0xFF, 0xBA, 0xFF,
-	0xCC, 0xFF, 0xCB, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xE3, 0xFF, 0xED, 0xFF,
-	0xF5, 0xFF, 0xED, 0xFF, 0xF6, 0xFF, 0xF5, 0xFF, 0xF2, 0xFF, 0xF0, 0xFF,
-	0xF0, 0xFF, 0xF3, 0xFF, 0xEC, 0xFF, 0xE3, 0xFF, 0xE2, 0xFF, 0xDC, 0xFF,
-	0xD0, 0xFF, 0xD7, 0xFF, 0xC9, 0xFF, 0xC7, 0xFF, 0xBD, 0xFF, 0xB2, 0xFF,
-	0xA5, 0xFF, 0xB6, 0xFF, 0xAD, 0xFF, 0x9E, 0xFF, 0xB5, 0xFF, 0xA7, 0xFF,
-	0xAE, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xCA, 0xFF, 0xD0, 0xFF, 0xD3, 0xFF,
-	0xD7, 0xFF, 0xD8, 0xFF, 0xE7, 0xFF, 0xED, 0xFF, 0xED, 0xFF, 0xF6, 0xFF,
-	0xF1, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0xFF, 0xF5, 0xFF,
-	0xFD, 0xFF, 0xF3, 0xFF, 0xE7, 0xFF, 0xEC, 0xFF, 0xE1, 0xFF, 0xDE, 0xFF,
-	0xD5, 0xFF, 0xCB, 0xFF, 0xCA, 0xFF, 0xC0, 0xFF, 0xB7, 0xFF, 0xA5, 0xFF,
-	0xAB, 0xFF, 0x99, 0xFF, 0x98, 0xFF, 0x8E, 0xFF, 0x7C, 0xFF, 0x7D, 0xFF,
-	0x6D, 0xFF, 0x76, 0xFF, 0x73, 0xFF, 0x6D, 0xFF, 0x7B, 0xFF, 0x86, 0xFF,
-	0x7F, 0xFF, 0x84, 0xFF, 0x82, 0xFF, 0x8E, 0xFF, 0x9B, 0xFF, 0xA0, 0xFF,
-	0xB7, 0xFF, 0xC0, 0xFF, 0xCB, 0xFF, 0xD8, 0xFF, 0xDA, 0xFF, 0xEC, 0xFF,
-	0xE2, 0xFF, 0xE6, 0xFF, 0xF6, 0xFF, 0x00, 0x00, 0xFA, 0xFF, 0xFD, 0xFF,
-	0xFA, 0xFF, 0xF8, 0xFF, 0xF2, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xF5, 0xFF,
-	0xF2, 0xFF, 0xEC, 0xFF, 0xED, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
-	0xEB, 0xFF, 0xEB, 0xFF, 0xE2, 0xFF, 0xEE, 0xFF, 0xF6, 0xFF, 0xF7, 0xFF,
-	0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x06, 0x00, 0x0A, 0x00,
-	0x0E, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x28, 0x00, 0x2E, 0x00, 0x35, 0x00,
-	0x30, 0x00, 0x39, 0x00, 0x30, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x2B, 0x00,
-	0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x39, 0x00, 0x2E, 0x00, 0x2C, 0x00,
-	0x2B, 0x00, 0x22, 0x00, 0x1D, 0x00, 0x19, 0x00, 0x19, 0x00, 0x08, 0x00,
-	0x0D, 0x00, 0x08, 0x00, 0xFD, 0xFF, 0xFC, 0xFF, 0xF2, 0xFF, 0xF8, 0xFF,
-	0xF2, 0xFF, 0xEE, 0xFF, 0xE7, 0xFF, 0xF0, 0xFF, 0xF3, 0xFF, 0xF8, 0xFF,
-	0x03, 0x00, 0xF3, 0xFF, 0xFC, 0xFF, 0xF1, 0xFF, 0x00, 0x00, 0x04, 0x00,
-	0x06, 0x00, 0x09, 0x00, 0x06, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00,
-	0x06, 0x00, 0x0A, 0x00, 0x0E, 0x00, 0x04, 0x00, 0x03, 0x00, 0x0A, 0x00,
-	0xFF, 0xFF, 0x0A, 0x00, 0x06, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF,
-	0xFA, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00,
-	0x01, 0x00, 0x05, 0x00, 0x0D, 0x00, 0x17, 0x00, 0x1C, 0x00, 0x17, 0x00,
-	0x30, 0x00, 0x28, 0x00, 0x31, 0x00, 0x35, 0x00, 0x35, 0x00, 0x40, 0x00,
-	0x41, 0x00, 0x43, 0x00, 0x39, 0x00, 0x43, 0x00, 0x3F, 0x00, 0x40, 0x00,
-	0x3E, 0x00, 0x45, 0x00, 0x40, 0x00, 0x33, 0x00, 0x32, 0x00, 0x1C, 0x00,
-	0x22, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x1E, 0x00, 0x19, 0x00,
-	0x19, 0x00, 0x1A, 0x00, 0x0A, 0x00, 0x10, 0x00, 0x10, 0x00, 0x0E, 0x00,
-	0x13, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x17, 0x00, 0x1C, 0x00,
-	0x12, 0x00, 0x26, 0x00, 0x21, 0x00, 0x24, 0x00, 0x37, 0x00, 0x35, 0x00,
-	0x44, 0x00, 0x41, 0x00, 0x48, 0x00, 0x44, 0x00, 0x4F, 0x00, 0x4E, 0x00,
-	0x5F, 0x00, 0x62, 0x00, 0x5D, 0x00, 0x61, 0x00, 0x5A, 0x00, 0x5D, 0x00,
-	0x64, 0x00, 0x59, 0x00, 0x55, 0x00, 0x4F, 0x00, 0x44, 0x00, 0x3B, 0x00,
-	0x40, 0x00, 0x36, 0x00, 0x35, 0x00, 0x3A, 0x00, 0x32, 0x00, 0x23, 0x00,
-	0x21, 0x00, 0x23, 0x00, 0x1D, 0x00, 0x1D, 0x00, 0x22, 0x00, 0x32, 0x00,
-	0x30, 0x00, 0x3A, 0x00, 0x37, 0x00, 0x40, 0x00, 0x44, 0x00, 0x4A, 0x00,
-	0x59, 0x00, 0x5F, 0x00, 0x69, 0x00, 0x6B, 0x00, 0x6D, 0x00, 0x7F, 0x00,
-	0x86, 0x00, 0x8D, 0x00, 0x93, 0x00, 0x90, 0x00, 0x93, 0x00, 0x93, 0x00,
-	0x97, 0x00, 0x8D, 0x00, 0x8B, 0x00, 0x93, 0x00, 0x84, 0x00, 0x77, 0x00,
-	0x71, 0x00, 0x62, 0x00, 0x64, 0x00, 0x55, 0x00, 0x54, 0x00, 0x50, 0x00,
-	0x48, 0x00, 0x4B, 0x00, 0x43, 0x00, 0x38, 0x00, 0x36, 0x00, 0x30, 0x00,
-	0x29, 0x00, 0x33, 0x00, 0x3B, 0x00, 0x38, 0x00, 0x32, 0x00, 0x49, 0x00,
-	0x4D, 0x00, 0x49, 0x00, 0x4F, 0x00, 0x55, 0x00, 0x5F, 0x00, 0x61, 0x00,
-	0x67, 0x00, 0x6D, 0x00, 0x79, 0x00, 0x7A, 0x00, 0x7F, 0x00, 0x7B, 0x00,
-	0x7B, 0x00, 0x84, 0x00, 0x85, 0x00, 0x80, 0x00, 0x7B, 0x00, 0x83, 0x00,
-	0x86, 0x00, 0x7F, 0x00, 0x6B, 0x00, 0x72, 0x00, 0x63, 0x00, 0x6C, 0x00,
-	0x62, 0x00, 0x64, 0x00, 0x5A, 0x00, 0x49, 0x00, 0x3A, 0x00, 0x3C, 0x00,
-	0x31, 0x00, 0x2C, 0x00, 0x32, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x23, 0x00,
-	0x2C, 0x00, 0x26, 0x00, 0x17, 0x00, 0x26, 0x00, 0x23, 0x00, 0x27, 0x00,
-	0x1E, 0x00, 0x32, 0x00, 0x31, 0x00, 0x38, 0x00, 0x40, 0x00, 0x2D, 0x00,
-	0x36, 0x00, 0x28, 0x00, 0x30, 0x00, 0x35, 0x00, 0x38, 0x00, 0x4B, 0x00,
-	0x52, 0x00, 0x44, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x33, 0x00, 0x3A, 0x00,
-	0x38, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0x37, 0x00, 0x3C, 0x00, 0x3C, 0x00,
-	0x36, 0x00, 0x28, 0x00, 0x28, 0x00, 0x24, 0x00, 0x2E, 0x00, 0x23, 0x00,
-	0x21, 0x00, 0x1A, 0x00, 0x1D, 0x00, 0x2B, 0x00, 0x28, 0x00, 0x21, 0x00,
-	0x2C, 0x00, 0x28, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x3C, 0x00, 0x37, 0x00,
-	0x40, 0x00, 0x3E, 0x00, 0x4A, 0x00, 0x48, 0x00, 0x5C, 0x00, 0x6B, 0x00,
-	0x62, 0x00, 0x5D, 0x00, 0x5A, 0x00, 0x63, 0x00, 0x5A, 0x00, 0x64, 0x00,
-	0x61, 0x00, 0x68, 0x00, 0x64, 0x00, 0x63, 0x00, 0x5F, 0x00, 0x66, 0x00,
-	0x64, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x63, 0x00, 0x59, 0x00, 0x53, 0x00,
-	0x54, 0x00, 0x58, 0x00, 0x54, 0x00, 0x4F, 0x00, 0x50, 0x00, 0x4B, 0x00,
-	0x48, 0x00, 0x45, 0x00, 0x49, 0x00, 0x4B, 0x00, 0x4A, 0x00, 0x4A, 0x00,
-	0x4F, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x50, 0x00, 0x4D, 0x00,
-	0x4A, 0x00, 0x49, 0x00, 0x41, 0x00, 0x3F, 0x00, 0x36, 0x00, 0x3A, 0x00,
-	0x32, 0x00, 0x29, 0x00, 0x27, 0x00, 0x27, 0x00, 0x1E, 0x00, 0x22, 0x00,
-	0x0E, 0x00, 0x13, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x08, 0x00,
-	0x0F, 0x00, 0x0E, 0x00, 0x12, 0x00, 0x1D, 0x00, 0x0A, 0x00, 0x14, 0x00,
-	0x17, 0x00, 0x1D, 0x00, 0x1A, 0x00, 0x1F, 0x00, 0x22, 0x00, 0x31, 0x00,
-	0x1E, 0x00, 0x26, 0x00, 0x29, 0x00, 0x27, 0x00, 0x39, 0x00, 0x2B, 0x00,
-	0x30, 0x00, 0x36, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x4D, 0x00, 0x4A, 0x00,
-	0x45, 0x00, 0x49, 0x00, 0x46, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x52, 0x00,
-	0x53, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4D, 0x00, 0x57, 0x00, 0x55, 0x00,
-	0x50, 0x00, 0x5A, 0x00, 0x54, 0x00, 0x55, 0x00, 0x49, 0x00, 0x46, 0x00,
-	0x3C, 0x00, 0x39, 0x00, 0x35, 0x00, 0x37, 0x00, 0x3C, 0x00, 0x30, 0x00,
-	0x2E, 0x00, 0x34, 0x00, 0x35, 0x00, 0x31, 0x00, 0x2C, 0x00, 0x28, 0x00,
-	0x28, 0x00, 0x28, 0x00, 0x35, 0x00, 0x24, 0x00, 0x27, 0x00, 0x15, 0x00,
-	0x17, 0x00, 0x15, 0x00, 0x1A, 0x00, 0x24, 0x00, 0x23, 0x00, 0x1A, 0x00,
-	0x17, 0x00, 0x10, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x0D, 0x00,
-	0x06, 0x00, 0x0F, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04, 0x00,
-	0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x01, 0x00,
-	0x06, 0x00, 0x0E, 0x00, 0x03, 0x00, 0xF8, 0xFF, 0x09, 0x00, 0x01, 0x00,
-	0x05, 0x00, 0xFD, 0xFF, 0x03, 0x00, 0x0B, 0x00, 0x06, 0x00, 0x0E, 0x00,
-	0x18, 0x00, 0x1A, 0x00, 0x17, 0x00, 0x1A, 0x00, 0x28, 0x00, 0x2B, 0x00,
-	0x29, 0x00, 0x2F, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x31, 0x00, 0x36, 0x00,
-	0x44, 0x00, 0x4D, 0x00, 0x52, 0x00, 0x50, 0x00, 0x5B, 0x00, 0x5B, 0x00,
-	0x61, 0x00, 0x63, 0x00, 0x5E, 0x00, 0x67, 0x00, 0x67, 0x00, 0x6B, 0x00,
-	0x6F, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x6A, 0x00, 0x60, 0x00, 0x5C, 0x00,
-	0x57, 0x00, 0x5C, 0x00, 0x65, 0x00, 0x57, 0x00, 0x58, 0x00, 0x4F, 0x00,
-	0x40, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x53, 0x00, 0x4A, 0x00, 0x4A, 0x00,
-	0x49, 0x00, 0x3F, 0x00, 0x45, 0x00, 0x3B, 0x00, 0x4A, 0x00, 0x37, 0x00,
-	0x43, 0x00, 0x45, 0x00, 0x45, 0x00, 0x43, 0x00, 0x40, 0x00, 0x45, 0x00,
-	0x3B, 0x00, 0x3B, 0x00, 0x3B, 0x00, 0x36, 0x00, 0x3E, 0x00, 0x41, 0x00,
-	0x3F, 0x00, 0x3E, 0x00, 0x3A, 0x00, 0x4B, 0x00, 0x45, 0x00, 0x41, 0x00,
-	0x4A, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4A, 0x00, 0x4D, 0x00, 0x45, 0x00,
-	0x43, 0x00, 0x45, 0x00, 0x4B, 0x00, 0x4D, 0x00, 0x54, 0x00, 0x44, 0x00,
-	0x57, 0x00, 0x46, 0x00, 0x45, 0x00, 0x46, 0x00, 0x3F, 0x00, 0x4B, 0x00,
-	0x40, 0x00, 0x4D, 0x00, 0x40, 0x00, 0x4A, 0x00, 0x4A, 0x00, 0x46, 0x00,
-	0x56, 0x00, 0x53, 0x00, 0x4A, 0x00, 0x45, 0x00, 0x45, 0x00, 0x4D, 0x00,
-	0x53, 0x00, 0x52, 0x00, 0x4A, 0x00, 0x50, 0x00, 0x56, 0x00, 0x51, 0x00,
-	0x4D, 0x00, 0x57, 0x00, 0x57, 0x00, 0x54, 0x00, 0x5C, 0x00, 0x57, 0x00,
-	0x58, 0x00, 0x52, 0x00, 0x65, 0x00, 0x5E, 0x00, 0x54, 0x00, 0x5E, 0x00,
-	0x53, 0x00, 0x54, 0x00, 0x52, 0x00, 0x51, 0x00, 0x45, 0x00, 0x41, 0x00,
-	0x51, 0x00, 0x49, 0x00, 0x46, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x34, 0x00,
-	0x31, 0x00, 0x32, 0x00, 0x2A, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2D, 0x00,
-	0x2F, 0x00, 0x39, 0x00, 0x2D, 0x00, 0x30, 0x00, 0x3C, 0x00, 0x36, 0x00,
-	0x34, 0x00, 0x39, 0x00, 0x39, 0x00, 0x40, 0x00, 0x44, 0x00, 0x49, 0x00,
-	0x53, 0x00, 0x61, 0x00, 0x61, 0x00, 0x66, 0x00, 0x6B, 0x00, 0x67, 0x00,
-	0x66, 0x00, 0x6B, 0x00, 0x70, 0x00, 0x6C, 0x00, 0x6B, 0x00, 0x76, 0x00,
-	0x85, 0x00, 0x78, 0x00, 0x7B, 0x00, 0x7A, 0x00, 0x7E, 0x00, 0x71, 0x00,
-	0x87, 0x00, 0x78, 0x00, 0x7B, 0x00, 0x82, 0x00, 0x78, 0x00, 0x82, 0x00,
-	0x71, 0x00, 0x75, 0x00, 0x7F, 0x00, 0x83, 0x00, 0x88, 0x00, 0x7E, 0x00,
-	0x84, 0x00, 0x7F, 0x00, 0x84, 0x00, 0x89, 0x00, 0x89, 0x00, 0x87, 0x00,
-	0x8D, 0x00, 0x8C, 0x00, 0x8A, 0x00, 0x8D, 0x00, 0x8A, 0x00, 0x87, 0x00,
-	0x82, 0x00, 0x85, 0x00, 0x89, 0x00, 0x80, 0x00, 0x84, 0x00, 0x87, 0x00,
-	0x83, 0x00, 0x76, 0x00, 0x76, 0x00, 0x74, 0x00, 0x7B, 0x00, 0x74, 0x00,
-	0x6D, 0x00, 0x65, 0x00, 0x6F, 0x00, 0x68, 0x00, 0x60, 0x00, 0x5E, 0x00,
-	0x5B, 0x00, 0x58, 0x00, 0x5E, 0x00, 0x5C, 0x00, 0x61, 0x00, 0x59, 0x00,
-	0x5E, 0x00, 0x67, 0x00, 0x54, 0x00, 0x5E, 0x00, 0x5B, 0x00, 0x6A, 0x00,
-	0x4F, 0x00, 0x54, 0x00, 0x4C, 0x00, 0x60, 0x00, 0x54, 0x00, 0x59, 0x00,
-	0x60, 0x00, 0x4C, 0x00, 0x54, 0x00, 0x5E, 0x00, 0x59, 0x00, 0x62, 0x00,
-	0x4E, 0x00, 0x5D, 0x00, 0x56, 0x00, 0x51, 0x00, 0x56, 0x00, 0x5E, 0x00,
-	0x66, 0x00, 0x60, 0x00, 0x67, 0x00, 0x6A, 0x00, 0x61, 0x00, 0x71, 0x00,
-	0x62, 0x00, 0x66, 0x00, 0x6C, 0x00, 0x75, 0x00, 0x6F, 0x00, 0x6E, 0x00,
-	0x73, 0x00, 0x6A, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x61, 0x00,
-	0x6F, 0x00, 0x62, 0x00, 0x65, 0x00, 0x5C, 0x00, 0x56, 0x00, 0x62, 0x00,
-	0x5E, 0x00, 0x53, 0x00, 0x53, 0x00, 0x4F, 0x00, 0x46, 0x00, 0x3E, 0x00,
-	0x39, 0x00, 0x37, 0x00, 0x36, 0x00, 0x3E, 0x00, 0x3B, 0x00, 0x3E, 0x00,
-	0x2B, 0x00, 0x2F, 0x00, 0x27, 0x00, 0x36, 0x00, 0x32, 0x00, 0x2C, 0x00,
-	0x3A, 0x00, 0x3A, 0x00, 0x39, 0x00, 0x35, 0x00, 0x32, 0x00, 0x37, 0x00,
-	0x3C, 0x00, 0x43, 0x00, 0x3B, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3F, 0x00,
-	0x3B, 0x00, 0x3E, 0x00, 0x31, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3B, 0x00,
-	0x3A, 0x00, 0x2F, 0x00, 0x36, 0x00, 0x32, 0x00, 0x32, 0x00, 0x26, 0x00,
-	0x25, 0x00, 0x28, 0x00, 0x1D, 0x00, 0x2C, 0x00, 0x2F, 0x00, 0x39, 0x00,
-	0x36, 0x00, 0x2D, 0x00, 0x2C, 0x00, 0x35, 0x00, 0x36, 0x00, 0x34, 0x00,
-	0x36, 0x00, 0x46, 0x00, 0x40, 0x00, 0x4A, 0x00, 0x4A, 0x00, 0x52, 0x00,
-	0x53, 0x00, 0x58, 0x00, 0x5B, 0x00, 0x5D, 0x00, 0x60, 0x00, 0x5E, 0x00,
-	0x5B, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x75, 0x00, 0x6B, 0x00, 0x6B, 0x00,
-	0x67, 0x00, 0x70, 0x00, 0x71, 0x00, 0x6C, 0x00, 0x62, 0x00, 0x59, 0x00,
-	0x61, 0x00, 0x5C, 0x00, 0x5C, 0x00, 0x56, 0x00, 0x53, 0x00, 0x56, 0x00,
-	0x51, 0x00, 0x40, 0x00, 0x31, 0x00, 0x2F, 0x00, 0x36, 0x00, 0x2B, 0x00,
-	0x3B, 0x00, 0x34, 0x00, 0x23, 0x00, 0x28, 0x00, 0x21, 0x00, 0x1F, 0x00,
-	0x23, 0x00, 0x19, 0x00, 0x22, 0x00, 0x17, 0x00, 0x1A, 0x00, 0x1E, 0x00,
-	0x0F, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0D, 0x00, 0x13, 0x00, 0x05, 0x00,
-	0x0D, 0x00, 0x06, 0x00, 0x15, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00,
-	0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x08, 0x00,
-	0x0E, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x06, 0x00, 0xF8, 0xFF, 0x05, 0x00,
-	0xFB, 0xFF, 0x0F, 0x00, 0x19, 0x00, 0x13, 0x00, 0xFB, 0xFF, 0xF3, 0xFF,
-	0xFF, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0x09, 0x00, 0x01, 0x00, 0xF6, 0xFF,
-	0x0E, 0x00, 0xFB, 0xFF, 0x04, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
-	0x0E, 0x00, 0x05, 0x00, 0x0E, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00,
-	0xFC, 0xFF, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x05, 0x00, 0xF8, 0xFF,
-	0xFB, 0xFF, 0xFC, 0xFF, 0x06, 0x00, 0xFB, 0xFF, 0xF5, 0xFF, 0xF8, 0xFF,
-	0xF5, 0xFF, 0xF7, 0xFF, 0xF5, 0xFF, 0xF7, 0xFF, 0xF2, 0xFF, 0xF2, 0xFF,
-	0xF2, 0xFF, 0xF6, 0xFF, 0x08, 0x00, 0xF5, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF,
-	0xEE, 0xFF, 0xFA, 0xFF, 0xF2, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0xF1, 0xFF,
-	0xF3, 0xFF, 0xF6, 0xFF, 0xF1, 0xFF, 0xEC, 0xFF, 0xF2, 0xFF, 0xF7, 0xFF,
-	0xEE, 0xFF, 0xE8, 0xFF, 0xF2, 0xFF, 0xEC, 0xFF, 0xE7, 0xFF, 0xE1, 0xFF,
-	0xE4, 0xFF, 0xE4, 0xFF, 0xE7, 0xFF, 0xF0, 0xFF, 0xE6, 0xFF, 0xDE, 0xFF,
-	0xE8, 0xFF, 0xE9, 0xFF, 0xEB, 0xFF, 0xED, 0xFF, 0xE7, 0xFF, 0xE4, 0xFF,
-	0xE6, 0xFF, 0xF0, 0xFF, 0xE3, 0xFF, 0xDF, 0xFF, 0xE4, 0xFF, 0xE3, 0xFF,
-	0xEE, 0xFF, 0xF6, 0xFF, 0xFA, 0xFF, 0xF1, 0xFF, 0xF3, 0xFF, 0xF5, 0xFF,
-	0xF5, 0xFF, 0xF8, 0xFF, 0xFA, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0xF7, 0xFF,
-	0xFA, 0xFF, 0x04, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x08, 0x00, 0x12, 0x00,
-	0x0A, 0x00, 0x0F, 0x00, 0x0D, 0x00, 0x08, 0x00, 0x09, 0x00, 0x13, 0x00,
-	0x15, 0x00, 0x15, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x08, 0x00,
-	0x04, 0x00, 0x13, 0x00, 0x0B, 0x00, 0x04, 0x00, 0xFF, 0xFF, 0xFD, 0xFF,
-	0xFA, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0x0A, 0x00, 0x04, 0x00, 0x10, 0x00,
-	0x0E, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0A, 0x00, 0x14, 0x00, 0x12, 0x00,
-	0x14, 0x00, 0x1E, 0x00, 0x26, 0x00, 0x2F, 0x00, 0x29, 0x00, 0x1C, 0x00,
-	0x1E, 0x00, 0x24, 0x00, 0x21, 0x00, 0x1F, 0x00, 0x21, 0x00, 0x18, 0x00,
-	0x15, 0x00, 0x0E, 0x00, 0x08, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xF6, 0xFF,
-	0xEE, 0xFF, 0xF2, 0xFF, 0xE8, 0xFF, 0xEE, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF,
-	0xE1, 0xFF, 0xD0, 0xFF, 0xD8, 0xFF, 0xDF, 0xFF, 0xD7, 0xFF, 0xDA, 0xFF,
-	0xDF, 0xFF, 0xDF, 0xFF, 0xDC, 0xFF, 0xEC, 0xFF, 0xE3, 0xFF, 0xEE, 0xFF,
-	0xE6, 0xFF, 0xE8, 0xFF, 0xFA, 0xFF, 0xF5, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
-	0xFD, 0xFF, 0x06, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0E, 0x00, 0x14, 0x00,
-	0x14, 0x00, 0x18, 0x00, 0x17, 0x00, 0x0B, 0x00, 0x1A, 0x00, 0x19, 0x00,
-	0x21, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x14, 0x00,
-	0x0E, 0x00, 0x06, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x08, 0x00, 0xFD, 0xFF,
-	0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0F, 0x00, 0x0A, 0x00, 0x0B, 0x00,
-	0x0F, 0x00, 0x0B, 0x00, 0x0A, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-	0x17, 0x00, 0x24, 0x00, 0x1F, 0x00, 0x29, 0x00, 0x34, 0x00, 0x30, 0x00,
-	0x3B, 0x00, 0x44, 0x00, 0x3B, 0x00, 0x43, 0x00, 0x43, 0x00, 0x4F, 0x00,
-	0x4A, 0x00, 0x45, 0x00, 0x46, 0x00, 0x3F, 0x00, 0x3A, 0x00, 0x30, 0x00,
-	0x31, 0x00, 0x26, 0x00, 0x30, 0x00, 0x23, 0x00, 0x24, 0x00, 0x1C, 0x00,
-	0x23, 0x00, 0x1A, 0x00, 0x12, 0x00, 0x14, 0x00, 0x22, 0x00, 0x15, 0x00,
-	0x18, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x2B, 0x00, 0x2D, 0x00,
-	0x34, 0x00, 0x36, 0x00, 0x40, 0x00, 0x45, 0x00, 0x3E, 0x00, 0x4D, 0x00,
-	0x3B, 0x00, 0x52, 0x00, 0x4A, 0x00, 0x4A, 0x00, 0x53, 0x00, 0x54, 0x00,
-	0x52, 0x00, 0x5A, 0x00, 0x53, 0x00, 0x53, 0x00, 0x53, 0x00, 0x5F, 0x00,
-	0x53, 0x00, 0x50, 0x00, 0x4A, 0x00, 0x44, 0x00, 0x3F, 0x00, 0x30, 0x00,
-	0x2C, 0x00, 0x27, 0x00, 0x24, 0x00, 0x27, 0x00, 0x24, 0x00, 0x23, 0x00,
-	0x21, 0x00, 0x15, 0x00, 0x17, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0D, 0x00,
-	0x13, 0x00, 0x18, 0x00, 0x1D, 0x00, 0x28, 0x00, 0x26, 0x00, 0x33, 0x00,
-	0x33, 0x00, 0x35, 0x00, 0x3A, 0x00, 0x40, 0x00, 0x3C, 0x00, 0x49, 0x00,
-	0x4E, 0x00, 0x53, 0x00, 0x58, 0x00, 0x5A, 0x00, 0x53, 0x00, 0x54, 0x00,
-	0x55, 0x00, 0x54, 0x00, 0x5A, 0x00, 0x54, 0x00, 0x4E, 0x00, 0x59, 0x00,
-	0x46, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x4F, 0x00, 0x4B, 0x00, 0x53, 0x00,
-	0x39, 0x00, 0x41, 0x00, 0x32, 0x00, 0x31, 0x00, 0x36, 0x00, 0x37, 0x00,
-	0x39, 0x00, 0x35, 0x00, 0x35, 0x00, 0x2D, 0x00, 0x37, 0x00, 0x2D, 0x00,
-	0x31, 0x00, 0x33, 0x00, 0x28, 0x00, 0x35, 0x00, 0x31, 0x00, 0x36, 0x00,
-	0x40, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x32, 0x00, 0x3B, 0x00, 0x37, 0x00,
-	0x3B, 0x00, 0x36, 0x00, 0x36, 0x00, 0x41, 0x00, 0x41, 0x00, 0x45, 0x00,
-	0x40, 0x00, 0x45, 0x00, 0x45, 0x00, 0x39, 0x00, 0x3C, 0x00, 0x35, 0x00,
-	0x32, 0x00, 0x33, 0x00, 0x3E, 0x00, 0x36, 0x00, 0x31, 0x00, 0x2C, 0x00,
-	0x35, 0x00, 0x32, 0x00, 0x2D, 0x00, 0x26, 0x00, 0x2E, 0x00, 0x2E, 0x00,
-	0x31, 0x00, 0x2D, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2C, 0x00, 0x28, 0x00,
-	0x36, 0x00, 0x39, 0x00, 0x36, 0x00, 0x37, 0x00, 0x40, 0x00, 0x36, 0x00,
-	0x3C, 0x00, 0x3B, 0x00, 0x46, 0x00, 0x4E, 0x00, 0x48, 0x00, 0x50, 0x00,
-	0x5C, 0x00, 0x53, 0x00, 0x4D, 0x00, 0x4A, 0x00, 0x50, 0x00, 0x49, 0x00,
-	0x48, 0x00, 0x3F, 0x00, 0x3B, 0x00, 0x46, 0x00, 0x43, 0x00, 0x3F, 0x00,
-	0x2D, 0x00, 0x36, 0x00, 0x32, 0x00, 0x22, 0x00, 0x2B, 0x00, 0x1E, 0x00,
-	0x27, 0x00, 0x18, 0x00, 0x21, 0x00, 0x1C, 0x00, 0x17, 0x00, 0x0E, 0x00,
-	0x0F, 0x00, 0x0A, 0x00, 0x08, 0x00, 0x08, 0x00, 0x1A, 0x00, 0x01, 0x00,
-	0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x05, 0x00, 0x0A, 0x00, 0x14, 0x00,
-	0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x06, 0x00, 0x04, 0x00,
-	0x0A, 0x00, 0x04, 0x00, 0x0A, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x14, 0x00,
-	0x0A, 0x00, 0x19, 0x00, 0x12, 0x00, 0x13, 0x00, 0x17, 0x00, 0x18, 0x00,
-	0x1A, 0x00, 0x24, 0x00, 0x1A, 0x00, 0x29, 0x00, 0x1C, 0x00, 0x1E, 0x00,
-	0x1A, 0x00, 0x1E, 0x00, 0x14, 0x00, 0x1E, 0x00, 0x15, 0x00, 0x14, 0x00,
-	0x15, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF,
-	0xFA, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0xEE, 0xFF, 0xF6, 0xFF, 0xF5, 0xFF,
-	0xF1, 0xFF, 0xE9, 0xFF, 0xE6, 0xFF, 0xE8, 0xFF, 0xE4, 0xFF, 0xE3, 0xFF,
-	0xE3, 0xFF, 0xDF, 0xFF, 0xE1, 0xFF, 0xD8, 0xFF, 0xE7, 0xFF, 0xDC, 0xFF,
-	0xE3, 0xFF, 0xDD, 0xFF, 0xE3, 0xFF, 0xE6, 0xFF, 0xDE, 0xFF, 0xDD, 0xFF,
-	0xDF, 0xFF, 0xDD, 0xFF, 0xD8, 0xFF, 0xDC, 0xFF, 0xDC, 0xFF, 0xE3, 0xFF,
-	0xDA, 0xFF, 0xDD, 0xFF, 0xDA, 0xFF, 0xDC, 0xFF, 0xE2, 0xFF, 0xD5, 0xFF,
-	0xDC, 0xFF, 0xD8, 0xFF, 0xD9, 0xFF, 0xCA, 0xFF, 0xD5, 0xFF, 0xD8, 0xFF,
-	0xD3, 0xFF, 0xD8, 0xFF, 0xDE, 0xFF, 0xDA, 0xFF, 0xD5, 0xFF, 0xDC, 0xFF,
-	0xD7, 0xFF, 0xE1, 0xFF, 0xE6, 0xFF, 0xE6, 0xFF, 0xD5, 0xFF, 0xD5, 0xFF,
-	0xDA, 0xFF, 0xDE, 0xFF, 0xDC, 0xFF, 0xE4, 0xFF, 0xED, 0xFF, 0xE8, 0xFF,
-	0xE3, 0xFF, 0xDE, 0xFF, 0xEB, 0xFF, 0xE1, 0xFF, 0xEE, 0xFF, 0xE2, 0xFF,
-	0xEE, 0xFF, 0xF5, 0xFF, 0xEC, 0xFF, 0xEB, 0xFF, 0xF0, 0xFF, 0xE3, 0xFF,
-	0xE9, 0xFF, 0xEE, 0xFF, 0xE6, 0xFF, 0xDF, 0xFF, 0xE6, 0xFF, 0xE2, 0xFF,
-	0xD8, 0xFF, 0xD8, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDC, 0xFF, 0xDC, 0xFF,
-	0xD8, 0xFF, 0xCB, 0xFF, 0xDE, 0xFF, 0xD5, 0xFF, 0xCE, 0xFF, 0xD3, 0xFF,
-	0xCE, 0xFF, 0xD2, 0xFF, 0xD3, 0xFF, 0xD5, 0xFF, 0xDA, 0xFF, 0xE4, 0xFF,
-	0xE2, 0xFF, 0xE1, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xF5, 0xFF, 0xEC, 0xFF,
-	0xEC, 0xFF, 0xF2, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0xEE, 0xFF, 0xF5, 0xFF,
-	0xED, 0xFF, 0xF2, 0xFF, 0xED, 0xFF, 0xFB, 0xFF, 0xF0, 0xFF, 0xEB, 0xFF,
-	0xF3, 0xFF, 0xF0, 0xFF, 0xF3, 0xFF, 0xE9, 0xFF, 0xE1, 0xFF, 0xEE, 0xFF,
-	0xE8, 0xFF, 0xE6, 0xFF, 0xEC, 0xFF, 0xE3, 0xFF, 0xE2, 0xFF, 0xE2, 0xFF,
-	0xEC, 0xFF, 0xE4, 0xFF, 0xE2, 0xFF, 0xE2, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF,
-	0xE4, 0xFF, 0xE8, 0xFF, 0xF6, 0xFF, 0xE6, 0xFF, 0xF1, 0xFF, 0xF8, 0xFF,
-	0xF6, 0xFF, 0xF2, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0x0B, 0x00,
-	0xFF, 0xFF, 0x05, 0x00, 0x03, 0x00, 0xFA, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF,
-	0x08, 0x00, 0x05, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x12, 0x00,
-	0x03, 0x00, 0xFB, 0xFF, 0x04, 0x00, 0xEC, 0xFF, 0xF1, 0xFF, 0xF6, 0xFF,
-	0xFA, 0xFF, 0xF3, 0xFF, 0xFC, 0xFF, 0xEE, 0xFF, 0xE6, 0xFF, 0xE3, 0xFF,
-	0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE2, 0xFF, 0xD5, 0xFF, 0xCE, 0xFF,
-	0xD2, 0xFF, 0xCA, 0xFF, 0xC4, 0xFF, 0xC5, 0xFF, 0xC4, 0xFF, 0xCA, 0xFF,
-	0xC1, 0xFF, 0xC1, 0xFF, 0xC1, 0xFF, 0xD4, 0xFF, 0xC1, 0xFF, 0xD5, 0xFF,
-	0xCA, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xDA, 0xFF, 0xE9, 0xFF, 0xE7, 0xFF,
-	0xED, 0xFF, 0xE8, 0xFF, 0xF1, 0xFF, 0xE8, 0xFF, 0xE1, 0xFF, 0xE4, 0xFF,
-	0xE6, 0xFF, 0xF2, 0xFF, 0xE2, 0xFF, 0xDC, 0xFF, 0xDD, 0xFF, 0xDF, 0xFF,
-	0xD1, 0xFF, 0xD7, 0xFF, 0xCB, 0xFF, 0xCA, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF,
-	0xD1, 0xFF, 0xC1, 0xFF, 0xD5, 0xFF, 0xD7, 0xFF, 0xD3, 0xFF, 0xDD, 0xFF,
-	0xDF, 0xFF, 0xEE, 0xFF, 0xE8, 0xFF, 0xF5, 0xFF, 0xEC, 0xFF, 0xEE, 0xFF,
-	0xED, 0xFF, 0x08, 0x00, 0x03, 0x00, 0x0D, 0x00, 0x0B, 0x00, 0x04, 0x00,
-	0x0F, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x15, 0x00, 0x1A, 0x00, 0x1C, 0x00,
-	0x1A, 0x00, 0x18, 0x00, 0x1E, 0x00, 0x14, 0x00, 0x24, 0x00, 0x17, 0x00,
-	0x14, 0x00, 0x15, 0x00, 0x15, 0x00, 0x10, 0x00, 0x0E, 0x00, 0x08, 0x00,
-	0x03, 0x00, 0x0A, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x03, 0x00, 0xF8, 0xFF,
-	0x01, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF6, 0xFF, 0xF5, 0xFF, 0xF3, 0xFF,
-	0xFF, 0xFF, 0xED, 0xFF, 0xF2, 0xFF, 0xF3, 0xFF, 0xED, 0xFF, 0xF1, 0xFF,
-	0xFA, 0xFF, 0xFB, 0xFF, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00,
-	0x00, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0F, 0x00, 0x0A, 0x00, 0x17, 0x00,
-	0x10, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x03, 0x00, 0x08, 0x00, 0x12, 0x00,
-	0x12, 0x00, 0x17, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x12, 0x00, 0x12, 0x00,
-	0x10, 0x00, 0x14, 0x00, 0x14, 0x00, 0x22, 0x00, 0x1D, 0x00, 0x14, 0x00,
-	0x1E, 0x00, 0x22, 0x00, 0x1F, 0x00, 0x1D, 0x00, 0x28, 0x00, 0x2F, 0x00,
-	0x3B, 0x00, 0x3F, 0x00, 0x37, 0x00, 0x49, 0x00, 0x43, 0x00, 0x40, 0x00,
-	0x3C, 0x00, 0x45, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x4B, 0x00, 0x4E, 0x00,
-	0x46, 0x00, 0x4B, 0x00, 0x49, 0x00, 0x4D, 0x00, 0x3F, 0x00, 0x36, 0x00,
-	0x3A, 0x00, 0x2F, 0x00, 0x2A, 0x00, 0x27, 0x00, 0x1F, 0x00, 0x19, 0x00,
-	0x0F, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x03, 0x00, 0xF7, 0xFF, 0xFB, 0xFF,
-	0xF6, 0xFF, 0xF2, 0xFF, 0xF1, 0xFF, 0xF0, 0xFF, 0xEC, 0xFF, 0xE9, 0xFF,
-	0xEC, 0xFF, 0xF5, 0xFF, 0xEC, 0xFF, 0xE4, 0xFF, 0xF6, 0xFF, 0xF7, 0xFF,
-	0xF2, 0xFF, 0xFB, 0xFF, 0xFD, 0xFF, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00,
-	0x10, 0x00, 0x08, 0x00, 0x15, 0x00, 0x15, 0x00, 0x1A, 0x00, 0x1C, 0x00,
-	0x19, 0x00, 0x2A, 0x00, 0x24, 0x00, 0x1C, 0x00, 0x1D, 0x00, 0x0E, 0x00,
-	0x1A, 0x00, 0x15, 0x00, 0x17, 0x00, 0x12, 0x00, 0x15, 0x00, 0x0F, 0x00,
-	0x12, 0x00, 0x0D, 0x00, 0x05, 0x00, 0x0D, 0x00, 0xFC, 0xFF, 0x03, 0x00,
-	0xFD, 0xFF, 0x05, 0x00, 0xFA, 0xFF, 0xFA, 0xFF, 0x03, 0x00, 0x03, 0x00,
-	0x04, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x0A, 0x00,
-	0x0F, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x13, 0x00, 0x21, 0x00, 0x1F, 0x00,
-	0x1D, 0x00, 0x27, 0x00, 0x22, 0x00, 0x25, 0x00, 0x1F, 0x00, 0x27, 0x00,
-	0x25, 0x00, 0x25, 0x00, 0x23, 0x00, 0x25, 0x00, 0x22, 0x00, 0x1C, 0x00,
-	0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0B, 0x00, 0x12, 0x00,
-	0x09, 0x00, 0x04, 0x00, 0x0B, 0x00, 0x03, 0x00, 0xFD, 0xFF, 0x06, 0x00,
-	0xFA, 0xFF, 0xF3, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
-	0xFA, 0xFF, 0xFB, 0xFF, 0xE4, 0xFF, 0xEC, 0xFF, 0xE9, 0xFF, 0xEE, 0xFF,
-	0xE9, 0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xE3, 0xFF, 0xED, 0xFF, 0xF2, 0xFF,
-	0xF7, 0xFF, 0xF6, 0xFF, 0xF5, 0xFF, 0xFA, 0xFF, 0xF0, 0xFF, 0xF1, 0xFF,
-	0xF2, 0xFF, 0xF7, 0xFF, 0xFA, 0xFF, 0xFC, 0xFF, 0x03, 0x00, 0xFF, 0xFF,
-	0xFD, 0xFF, 0xED, 0xFF, 0xF1, 0xFF, 0xF1, 0xFF, 0xFC, 0xFF, 0x00, 0x00,
-	0xF2, 0xFF, 0x00, 0x00, 0xF3, 0xFF, 0xF5, 0xFF, 0xEE, 0xFF, 0xFD, 0xFF,
-	0xF3, 0xFF, 0xF6, 0xFF, 0xEE, 0xFF, 0xFB, 0xFF, 0xF6, 0xFF, 0xF0, 0xFF,
-	0xF6, 0xFF, 0xED, 0xFF, 0xF2, 0xFF, 0xF3, 0xFF, 0xED, 0xFF, 0xEC, 0xFF,
-	0xE3, 0xFF, 0xE8, 0xFF, 0xE2, 0xFF, 0xDE, 0xFF, 0xEC, 0xFF, 0xE6, 0xFF,
-	0xE8, 0xFF, 0xE7, 0xFF, 0xDF, 0xFF, 0xE6, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF,
-	0xBA, 0xFF, 0xCB, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xB8, 0xFF, 0xB7, 0xFF,
-	0xB1, 0xFF, 0xB8, 0xFF, 0xAD, 0xFF, 0xA9, 0xFF, 0xA8, 0xFF, 0x96, 0xFF,
-	0xA4, 0xFF, 0x9B, 0xFF, 0x9B, 0xFF, 0x94, 0xFF, 0x9F, 0xFF, 0x9B, 0xFF,
-	0x91, 0xFF, 0x9D, 0xFF, 0x98, 0xFF, 0xA5, 0xFF, 0xA2, 0xFF, 0xA0, 0xFF,
-	0xAC, 0xFF, 0xAA, 0xFF, 0xA4, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAF, 0xFF,
-	0xB7, 0xFF, 0xB6, 0xFF, 0xB7, 0xFF, 0xBD, 0xFF, 0xB3, 0xFF, 0xB1, 0xFF,
-	0xC0, 0xFF, 0xBD, 0xFF, 0xB8, 0xFF, 0xBA, 0xFF, 0xCA, 0xFF, 0xCE, 0xFF,
-	0xC6, 0xFF, 0xC7, 0xFF, 0xBA, 0xFF, 0xC1, 0xFF, 0xC2, 0xFF, 0xC5, 0xFF,
-	0xC6, 0xFF, 0xBD, 0xFF, 0xB3, 0xFF, 0xB6, 0xFF, 0xAD, 0xFF, 0xBB, 0xFF,
-	0xB2, 0xFF, 0xB7, 0xFF, 0xC2, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF,
-	0xBA, 0xFF, 0xBD, 0xFF, 0xC2, 0xFF, 0xC4, 0xFF, 0xC4, 0xFF, 0xC5, 0xFF,
-	0xCA, 0xFF, 0xBF, 0xFF, 0xC1, 0xFF, 0xCC, 0xFF, 0xD4, 0xFF, 0xC1, 0xFF,
-	0xBD, 0xFF, 0xB8, 0xFF, 0xB7, 0xFF, 0xC4, 0xFF, 0xB6, 0xFF, 0xBD, 0xFF,
-	0xB4, 0xFF, 0xBF, 0xFF, 0xB7, 0xFF, 0xBA, 0xFF, 0xB4, 0xFF, 0xAD, 0xFF,
-	0xAD, 0xFF, 0xAA, 0xFF, 0xA7, 0xFF, 0xA5, 0xFF, 0x93, 0xFF, 0x91, 0xFF,
-	0x8D, 0xFF, 0x8A, 0xFF, 0x86, 0xFF, 0x7E, 0xFF, 0x77, 0xFF, 0x80, 0xFF,
-	0x79, 0xFF, 0x69, 0xFF, 0x6A, 0xFF, 0x71, 0xFF, 0x6F, 0xFF, 0x78, 0xFF,
-	0x74, 0xFF, 0x86, 0xFF, 0x71, 0xFF, 0x7D, 0xFF, 0x77, 0xFF, 0x7C, 0xFF,
-	0x85, 0xFF, 0x7E, 0xFF, 0x76, 0xFF, 0x78, 0xFF, 0x81, 0xFF, 0x82, 0xFF,
-	0x82, 0xFF, 0x87, 0xFF, 0x95, 0xFF, 0x85, 0xFF, 0x8C, 0xFF, 0x90, 0xFF,
-	0x93, 0xFF, 0x8C, 0xFF, 0x91, 0xFF, 0x8D, 0xFF, 0x8D, 0xFF, 0x95, 0xFF,
-	0x99, 0xFF, 0x9E, 0xFF, 0xA4, 0xFF, 0xA4, 0xFF, 0x9F, 0xFF, 0xA4, 0xFF,
-	0x91, 0xFF, 0xA3, 0xFF, 0xA3, 0xFF, 0xAD, 0xFF, 0xA9, 0xFF, 0x99, 0xFF,
-	0xA5, 0xFF, 0x9E, 0xFF, 0x99, 0xFF, 0xA2, 0xFF, 0xA2, 0xFF, 0x9D, 0xFF,
-	0xA5, 0xFF, 0x99, 0xFF, 0x9B, 0xFF, 0x9F, 0xFF, 0x96, 0xFF, 0x90, 0xFF,
-	0x93, 0xFF, 0x8F, 0xFF, 0x95, 0xFF, 0x8B, 0xFF, 0x8C, 0xFF, 0x82, 0xFF,
-	0x87, 0xFF, 0x8C, 0xFF, 0x7D, 0xFF, 0x80, 0xFF, 0x8F, 0xFF, 0x7E, 0xFF,
-	0x7E, 0xFF, 0x8B, 0xFF, 0x81, 0xFF, 0x7D, 0xFF, 0x81, 0xFF, 0x88, 0xFF,
-	0x87, 0xFF, 0x85, 0xFF, 0x87, 0xFF, 0x87, 0xFF, 0x88, 0xFF, 0x86, 0xFF,
-	0x87, 0xFF, 0x86, 0xFF, 0x8C, 0xFF, 0x8A, 0xFF, 0x91, 0xFF, 0x82, 0xFF,
-	0x8E, 0xFF, 0x98, 0xFF, 0x91, 0xFF, 0x85, 0xFF, 0x87, 0xFF, 0x93, 0xFF,
-	0x8E, 0xFF, 0x91, 0xFF, 0x9B, 0xFF, 0x9A, 0xFF, 0x96, 0xFF, 0x9D, 0xFF,
-	0xA3, 0xFF, 0xAA, 0xFF, 0xB1, 0xFF, 0xAE, 0xFF, 0xB1, 0xFF, 0xB3, 0xFF,
-	0xB2, 0xFF, 0xB3, 0xFF, 0xB0, 0xFF, 0xB6, 0xFF, 0xB3, 0xFF, 0xBC, 0xFF,
-	0xBF, 0xFF, 0xB7, 0xFF, 0xB8, 0xFF, 0xC0, 0xFF, 0xB7, 0xFF, 0xB2, 0xFF,
-	0xB3, 0xFF, 0xB7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB2, 0xFF, 0xC9, 0xFF,
-	0xBF, 0xFF, 0xC1, 0xFF, 0xCA, 0xFF, 0xC7, 0xFF, 0xC4, 0xFF, 0xBB, 0xFF,
-	0xC0, 0xFF, 0xC6, 0xFF, 0xC7, 0xFF, 0xCE, 0xFF, 0xC7, 0xFF, 0xCB, 0xFF,
-	0xCB, 0xFF, 0xD5, 0xFF, 0xCE, 0xFF, 0xD7, 0xFF, 0xD3, 0xFF, 0xCC, 0xFF,
-	0xD0, 0xFF, 0xCF, 0xFF, 0xCE, 0xFF, 0xCB, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF,
-	0xC5, 0xFF, 0xC4, 0xFF, 0xC9, 0xFF, 0xC1, 0xFF, 0xBB, 0xFF, 0xB7, 0xFF,
-	0xBD, 0xFF, 0xB7, 0xFF, 0xB8, 0xFF, 0xC2, 0xFF, 0xB5, 0xFF, 0x9B, 0xFF,
-	0x7B, 0xFF, 0x8B, 0xFF, 0x0F, 0x00, 0x12, 0x00, 0xA3, 0xFF, 0x80, 0xFF,
-	0xA5, 0xFF, 0xD0, 0xFF, 0xA9, 0xFF, 0x84, 0xFF, 0xAE, 0xFF, 0xEE, 0xFF,
-	0x09, 0x00, 0xD8, 0xFF, 0x9B, 0xFF, 0x9F, 0xFF, 0xC6, 0xFF, 0xE4, 0xFF,
-	0xD1, 0xFF, 0xC2, 0xFF, 0xDC, 0xFF, 0xF1, 0xFF, 0xDD, 0xFF, 0xCB, 0xFF,
-	0xC9, 0xFF, 0xD4, 0xFF, 0xE2, 0xFF, 0xF6, 0xFF, 0xF2, 0xFF, 0xEC, 0xFF,
-	0xF5, 0xFF, 0xE8, 0xFF, 0xF1, 0xFF, 0xEC, 0xFF, 0xEB, 0xFF, 0xF1, 0xFF,
-	0xF3, 0xFF, 0xF8, 0xFF, 0xF3, 0xFF, 0xEC, 0xFF, 0xEC, 0xFF, 0xF5, 0xFF,
-	0xEC, 0xFF, 0xE9, 0xFF, 0xF6, 0xFF, 0xF0, 0xFF, 0xFA, 0xFF, 0xF8, 0xFF,
-	0xF3, 0xFF, 0xF0, 0xFF, 0xED, 0xFF, 0xFA, 0xFF, 0xF6, 0xFF, 0xF7, 0xFF,
-	0xF3, 0xFF, 0xF6, 0xFF, 0xF0, 0xFF, 0xF5, 0xFF, 0xEE, 0xFF, 0xF2, 0xFF,
-	0xF8, 0xFF, 0xF0, 0xFF, 0xF3, 0xFF, 0xF7, 0xFF, 0xFA, 0xFF, 0xF3, 0xFF,
-	0xEC, 0xFF, 0xEC, 0xFF, 0xE7, 0xFF, 0xF2, 0xFF, 0xEE, 0xFF, 0xE3, 0xFF,
-	0xE7, 0xFF, 0xED, 0xFF, 0xED, 0xFF, 0xE7, 0xFF, 0xE4, 0xFF, 0xE4, 0xFF,
-	0xE4, 0xFF, 0xDF, 0xFF, 0xD9, 0xFF, 0xD5, 0xFF, 0xD5, 0xFF, 0xE7, 0xFF,
-	0xE2, 0xFF, 0xE2, 0xFF, 0xE8, 0xFF, 0xEC, 0xFF, 0xE9, 0xFF, 0xE6, 0xFF,
-	0xEC, 0xFF, 0xEE, 0xFF, 0xF6, 0xFF, 0xF7, 0xFF, 0xF0, 0xFF, 0xFA, 0xFF,
-	0x01, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x12, 0x00, 0x17, 0x00, 0x05, 0x00,
-	0x08, 0x00, 0x10, 0x00, 0x0E, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x00,
-	0xFF, 0xFF, 0x10, 0x00, 0x09, 0x00, 0x06, 0x00, 0x06, 0x00, 0x08, 0x00,
-	0x01, 0x00, 0xF8, 0xFF, 0xF2, 0xFF, 0x04, 0x00, 0xFB, 0xFF, 0xFB, 0xFF,
-	0x09, 0x00, 0xFD, 0xFF, 0x04, 0x00, 0x08, 0x00, 0x03, 0x00, 0x05, 0x00,
-	0x00, 0x00, 0xFD, 0xFF, 0x04, 0x00, 0x0A, 0x00, 0x04, 0x00, 0x0D, 0x00,
-	0x10, 0x00, 0x0E, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x09, 0x00,
-	0x01, 0x00, 0x0B, 0x00, 0x19, 0x00, 0x24, 0x00, 0x10, 0x00, 0x0B, 0x00,
-	0x1D, 0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x13, 0x00, 0x10, 0x00,
-	0x0E, 0x00, 0xF6, 0xFF, 0xF2, 0xFF, 0x06, 0x00, 0x05, 0x00, 0xFA, 0xFF,
-	0xF7, 0xFF, 0xFB, 0xFF, 0x0E, 0x00, 0x08, 0x00, 0x05, 0x00, 0x0A, 0x00,
-	0xF6, 0xFF, 0xFA, 0xFF, 0x00, 0x00, 0xFB, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF,
-	0x04, 0x00, 0xF5, 0xFF, 0xFA, 0xFF, 0x03, 0x00, 0xF6, 0xFF, 0xFB, 0xFF,
-	0xFF, 0xFF, 0x01, 0x00, 0xFD, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0xF8, 0xFF,
-	0xF6, 0xFF, 0xFA, 0xFF, 0xFC, 0xFF, 0x03, 0x00, 0x04, 0x00, 0x01, 0x00,
-	0x01, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFD, 0xFF, 0xF6, 0xFF,
-	0xFB, 0xFF, 0xFC, 0xFF, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF6, 0xFF,
-	0xF7, 0xFF, 0xFD, 0xFF, 0xF3, 0xFF, 0xFC, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
-	0xFD, 0xFF, 0xF5, 0xFF, 0xE6, 0xFF, 0xF6, 0xFF, 0xFD, 0xFF, 0xFC, 0xFF,
-	0xFA, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF,
-	0xF0, 0xFF, 0xF0, 0xFF, 0xF1, 0xFF, 0xF3, 0xFF, 0xEE, 0xFF, 0xEB, 0xFF,
-	0xE6, 0xFF, 0xEB, 0xFF, 0xE8, 0xFF, 0xE2, 0xFF, 0xE2, 0xFF, 0xE6, 0xFF,
-	0xEC, 0xFF, 0xDF, 0xFF, 0xE9, 0xFF, 0xEB, 0xFF, 0xE2, 0xFF, 0xDF, 0xFF,
-	0xE3, 0xFF, 0xDE, 0xFF, 0xE2, 0xFF, 0xE7, 0xFF, 0xE1, 0xFF, 0xE6, 0xFF,
-	0xDE, 0xFF, 0xDF, 0xFF, 0xDD, 0xFF, 0xDE, 0xFF, 0xE2, 0xFF, 0xE6, 0xFF,
-	0xDC, 0xFF, 0xDE, 0xFF, 0xEB, 0xFF, 0xE1, 0xFF, 0xD8, 0xFF, 0xDA, 0xFF,
-	0xD8, 0xFF, 0xE2, 0xFF, 0xDA, 0xFF, 0xDF, 0xFF, 0xCF, 0xFF, 0xD9, 0xFF,
-	0xDA, 0xFF, 0xD5, 0xFF, 0xCF, 0xFF, 0xDA, 0xFF, 0xD4, 0xFF, 0xE2, 0xFF,
-	0xDA, 0xFF, 0xD9, 0xFF, 0xDF, 0xFF, 0xD7, 0xFF, 0xDC, 0xFF, 0xE2, 0xFF,
-	0xE2, 0xFF, 0xD9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD7, 0xFF, 0xE1, 0xFF,
-	0xDE, 0xFF, 0xDA, 0xFF, 0xDC, 0xFF, 0xDF, 0xFF, 0xD8, 0xFF, 0xDE, 0xFF,
-	0xD8, 0xFF, 0xDA, 0xFF, 0xE2, 0xFF, 0xD9, 0xFF, 0xDA, 0xFF, 0xD3, 0xFF,
-	0xD8, 0xFF, 0xD2, 0xFF, 0xD0, 0xFF, 0xCA, 0xFF, 0xC9, 0xFF, 0xCA, 0xFF,
-	0xCD, 0xFF, 0xC0, 0xFF, 0xC6, 0xFF, 0xC5, 0xFF, 0xC9, 0xFF, 0xC8, 0xFF,
-	0xB8, 0xFF, 0xC8, 0xFF, 0xC8, 0xFF, 0xC4, 0xFF, 0xC2, 0xFF, 0xC4, 0xFF,
-	0xCB, 0xFF, 0xCF, 0xFF, 0xC1, 0xFF, 0xD0, 0xFF, 0xCD, 0xFF, 0xCB, 0xFF,
-	0xC9, 0xFF, 0xCE, 0xFF, 0xD3, 0xFF, 0xD7, 0xFF, 0xD5, 0xFF, 0xCF, 0xFF,
-	0xC7, 0xFF, 0xCE, 0xFF, 0xD0, 0xFF, 0xBF, 0xFF, 0xC4, 0xFF, 0xBD, 0xFF,
-	0xC6, 0xFF, 0xBB, 0xFF, 0xB8, 0xFF, 0xC0, 0xFF, 0xC5, 0xFF, 0xC9, 0xFF,
-	0xC4, 0xFF, 0xBB, 0xFF, 0xCA, 0xFF, 0xB3, 0xFF, 0xB6, 0xFF, 0xBB, 0xFF,
-	0xBC, 0xFF, 0xBF, 0xFF, 0xB5, 0xFF, 0xBA, 0xFF, 0xAE, 0xFF, 0xB6, 0xFF,
-	0xAC, 0xFF, 0xB1, 0xFF, 0xA9, 0xFF, 0xAC, 0xFF, 0xAC, 0xFF, 0xA6, 0xFF,
-	0xAD, 0xFF, 0xA4, 0xFF, 0xB3, 0xFF, 0xB2, 0xFF, 0xB5, 0xFF, 0xBB, 0xFF,
-	0xB3, 0xFF, 0xC5, 0xFF, 0xC4, 0xFF, 0xBA, 0xFF, 0xB3, 0xFF, 0xC5, 0xFF,
-	0xCD, 0xFF, 0xC9, 0xFF, 0xBC, 0xFF, 0xBF, 0xFF, 0xC6, 0xFF, 0xC9, 0xFF,
-	0xBC, 0xFF, 0xB7, 0xFF, 0xBF, 0xFF, 0xBB, 0xFF, 0xBD, 0xFF, 0xBA, 0xFF,
-	0xBF, 0xFF, 0xB0, 0xFF, 0xAE, 0xFF, 0xB3, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF,
-	0xB7, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xA6, 0xFF, 0xA3, 0xFF, 0x9F, 0xFF,
-	0x91, 0xFF, 0x8F, 0xFF, 0x98, 0xFF, 0xB6, 0xFF, 0xCE, 0xFF, 0xCA, 0x00,
-	0xC5, 0x03, 0xC1, 0x05, 0x95, 0x02, 0x0C, 0xFD, 0xEC, 0xFA, 0xCD, 0xFC,
-	0xEC, 0xFF, 0x87, 0x02, 0xF7, 0x03, 0x1F, 0x03, 0x9D, 0x00, 0x14, 0xFE,
-	0x2A, 0xFC, 0x7C, 0xFB, 0xF6, 0xFC, 0x52, 0x00, 0x29, 0x03, 0x9E, 0x03,
-	0xEA, 0x01, 0x36, 0xFF, 0x22, 0xFD, 0x10, 0xFD, 0x61, 0xFE, 0xB8, 0xFF,
-	0x9B, 0x00, 0x3A, 0x02, 0x16, 0x06, 0x1E, 0x09, 0x1B, 0x06, 0x2E, 0xFF,
-	0x4B, 0xFB, 0x9E, 0xFB, 0x05, 0xFD, 0x9B, 0xFD, 0x71, 0xFE, 0xDD, 0x00,
-	0x34, 0x03, 0x46, 0x03, 0x6A, 0x00, 0x2B, 0xFD, 0x8D, 0xFC, 0x69, 0xFE,
-	0x0A, 0x00, 0x44, 0x00, 0x85, 0x00, 0x16, 0x01, 0x89, 0x00, 0x05, 0xFF,
-	0x09, 0xFE, 0x42, 0xFE, 0x4B, 0xFF, 0x35, 0x00, 0xBE, 0x00, 0xA5, 0x00,
-	0xCC, 0xFF, 0xDD, 0xFE, 0xE7, 0xFE, 0xA6, 0xFF, 0x35, 0x00, 0x8F, 0x00,
-	0xB7, 0x00, 0x6F, 0x00, 0xAE, 0xFF, 0xD6, 0xFE, 0x65, 0xFE, 0x96, 0xFE,
-	0x33, 0xFF, 0x46, 0x00, 0xC3, 0x00, 0x7C, 0x00, 0xE7, 0xFF, 0x89, 0xFF,
-	0x02, 0xFF, 0x70, 0xFE, 0x43, 0xFE, 0x19, 0xFF, 0x66, 0x00, 0xF8, 0x00,
-	0x66, 0x00, 0x8C, 0xFF, 0x0F, 0xFF, 0xD6, 0xFE, 0xEA, 0xFE, 0x4B, 0xFF,
-	0xD9, 0xFF, 0x4B, 0x00, 0x8E, 0x00, 0x44, 0x00, 0x8B, 0xFF, 0x19, 0xFF,
-	0x36, 0xFF, 0x7B, 0xFF, 0xD4, 0xFF, 0x32, 0x00, 0x5D, 0x00, 0x4D, 0x00,
-	0x1D, 0x00, 0xE7, 0xFF, 0xC6, 0xFF, 0x8C, 0xFF, 0x6A, 0xFF, 0x7D, 0xFF,
-	0x0F, 0x00, 0xBD, 0x00, 0xB8, 0x00, 0x1C, 0x00, 0x65, 0xFF, 0x27, 0xFF,
-	0x6D, 0xFF, 0xA3, 0xFF, 0xCA, 0xFF, 0x4A, 0x00, 0xF3, 0x00, 0x05, 0x01,
-	0x5C, 0x00, 0x65, 0xFF, 0x19, 0xFF, 0x8F, 0xFF, 0x43, 0x00, 0x87, 0x00,
-	0x57, 0x00, 0x1A, 0x00, 0x54, 0x00, 0x5C, 0x00, 0xEC, 0xFF, 0x8E, 0xFF,
-	0x89, 0xFF, 0xBF, 0xFF, 0x0F, 0x00, 0x60, 0x00, 0x5C, 0x00, 0x04, 0x00,
-	0xBF, 0xFF, 0xCB, 0xFF, 0x0D, 0x00, 0x37, 0x00, 0x4F, 0x00, 0x8F, 0x00,
-	0xB1, 0x00, 0x63, 0x00, 0xA7, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x7D, 0xFF,
-	0xF2, 0xFF, 0x22, 0x00, 0x35, 0x00, 0x53, 0x00, 0x49, 0x00, 0x0E, 0x00,
-	0xA0, 0xFF, 0x72, 0xFF, 0x77, 0xFF, 0x8E, 0xFF, 0xA3, 0xFF, 0x0A, 0x00,
-	0x72, 0x00, 0x82, 0x00, 0x30, 0x00, 0xA2, 0xFF, 0x45, 0xFF, 0x72, 0xFF,
-	0xD0, 0xFF, 0x3B, 0x00, 0x89, 0x00, 0x57, 0x00, 0xBF, 0xFF, 0x42, 0xFF,
-	0x31, 0xFF, 0x85, 0xFF, 0xE2, 0xFF, 0x44, 0x00, 0x83, 0x00, 0x0E, 0x00,
-	0x4A, 0xFF, 0x40, 0xFF, 0xA4, 0xFF, 0x77, 0xFF, 0x67, 0xFF, 0xFF, 0xFF,
-	0x83, 0x00, 0xA7, 0x00, 0x3B, 0x00, 0x6F, 0xFF, 0xE1, 0xFE, 0xE0, 0xFE,
-	0x47, 0xFF, 0xFB, 0xFF, 0x6D, 0x00, 0x7A, 0x00, 0x12, 0x00, 0x9A, 0xFF,
-	0x9E, 0xFF, 0xD1, 0xFF, 0x98, 0xFF, 0xA4, 0xFF, 0x63, 0x00, 0xD5, 0x00,
-	0x10, 0x00, 0x59, 0xFF, 0x77, 0xFF, 0xD8, 0xFF, 0x88, 0x00, 0x0E, 0x01,
-	0x63, 0x00, 0x94, 0xFF, 0x14, 0x00, 0x4A, 0x00, 0xD5, 0xFE, 0x15, 0xFE,
-	0x71, 0xFF, 0xD0, 0x00, 0xD2, 0x00, 0x40, 0x00, 0x10, 0x00, 0x56, 0x00,
-	0x22, 0x00, 0x6D, 0xFF, 0x2B, 0xFF, 0xB8, 0xFF, 0x98, 0xFF, 0x16, 0xFF,
-	0xF6, 0xFF, 0x87, 0x01, 0x43, 0x01, 0x08, 0xFF, 0x06, 0xFE, 0xA7, 0xFF,
-	0x6D, 0x01, 0x98, 0x00, 0x72, 0xFE, 0xA3, 0xFE, 0x10, 0x01, 0x09, 0x02,
-	0x3F, 0x00, 0x8A, 0xFE, 0xD1, 0xFE, 0x9F, 0xFF, 0xCB, 0xFF, 0xA4, 0xFF,
-	0xC4, 0xFF, 0x5E, 0x00, 0x1E, 0x01, 0x29, 0x01, 0x43, 0x00, 0x1C, 0xFF,
-	0x87, 0xFE, 0xC9, 0xFE, 0xCB, 0xFF, 0xE6, 0x00, 0xC6, 0x00, 0x1E, 0x00,
-	0x17, 0x00, 0xFC, 0xFF, 0x52, 0xFF, 0x12, 0xFF, 0x3D, 0xFF, 0xB8, 0xFF,
-	0xF0, 0x00, 0xA7, 0x01, 0x6F, 0x00, 0x97, 0xFE, 0x07, 0xFE, 0xFD, 0xFE,
-	0x08, 0x00, 0x80, 0x00, 0xDB, 0x00, 0x86, 0x01, 0xE5, 0x01, 0x89, 0x00,
-	0xC1, 0xFD, 0x63, 0xFC, 0x97, 0xFD, 0x04, 0x00, 0x2F, 0x01, 0xD6, 0x00,
-	0x21, 0x01, 0x67, 0x02, 0x38, 0x01, 0x11, 0xFE, 0x5C, 0xFD, 0xD2, 0xFE,
-	0x8F, 0xFF, 0xED, 0xFF, 0xCD, 0x00, 0xB1, 0x01, 0x93, 0x01, 0x8A, 0x00,
-	0x74, 0xFF, 0x7E, 0xFE, 0xC8, 0xFD, 0xDF, 0xFE, 0x67, 0x01, 0x1E, 0x02,
-	0x08, 0x00, 0x53, 0xFE, 0xCF, 0xFE, 0x5D, 0x00, 0xA0, 0x00, 0x85, 0xFF,
-	0x91, 0xFF, 0x8F, 0x00, 0x28, 0x00, 0xCE, 0xFE, 0xDD, 0xFE, 0x3C, 0x00,
-	0xF8, 0x00, 0x97, 0x00, 0xC5, 0xFF, 0xE6, 0xFE, 0xC2, 0xFE, 0xAC, 0xFF,
-	0x30, 0x00, 0xC2, 0xFF, 0x1F, 0x00, 0xEE, 0x00, 0x40, 0x00, 0xFE, 0xFE,
-	0xE0, 0xFE, 0xEB, 0xFE, 0x63, 0xFF, 0x02, 0x01, 0x26, 0x02, 0xA1, 0x00,
-	0x8F, 0xFE, 0x7C, 0xFE, 0x13, 0xFF, 0xC3, 0xFE, 0xEE, 0xFE, 0x3D, 0x01,
-	0x7B, 0x03, 0xAC, 0x02, 0x0F, 0x00, 0x54, 0xFD, 0x3F, 0xFB, 0x54, 0xFC,
-	0x07, 0x01, 0x6D, 0x04, 0xA1, 0x03, 0xC1, 0x01, 0x78, 0x00, 0x4F, 0xFE,
-	0xB1, 0xFC, 0x3D, 0xFD, 0x73, 0xFE, 0x56, 0xFF, 0xF7, 0x00, 0xA1, 0x03,
-	0xFF, 0x03, 0x70, 0x00, 0xD4, 0xFC, 0x03, 0xFD, 0xB1, 0xFF, 0x45, 0x01,
-	0x27, 0x00, 0xD8, 0xFE, 0x38, 0xFF, 0x6C, 0x00, 0x8A, 0x01, 0x2D, 0x01,
-	0x13, 0xFF, 0xA1, 0xFD, 0x68, 0xFE, 0xF1, 0xFF, 0x40, 0x00, 0x09, 0xFF,
-	0xDA, 0xFF, 0x46, 0x03, 0x40, 0x03, 0x83, 0xFE, 0x95, 0xFC, 0xFB, 0xFE,
-	0x70, 0xFF, 0x53, 0xFD, 0xCF, 0xFC, 0x7B, 0x00, 0x8E, 0x04, 0x37, 0x03,
-	0x77, 0xFF, 0xF6, 0xFE, 0x25, 0xFF, 0xE5, 0xFD, 0x44, 0xFD, 0x9A, 0xFE,
-	0xFE, 0x00, 0x67, 0x01, 0x39, 0x00, 0xE1, 0xFF, 0xF2, 0xFF, 0xFE, 0xFE,
-	0x0D, 0xFE, 0x52, 0xFF, 0x38, 0x01, 0x2D, 0x01, 0xFA, 0xFE, 0xC3, 0xFD,
-	0xFF, 0xFF, 0x48, 0x02, 0xCB, 0x00, 0xF1, 0xFD, 0xBC, 0xFC, 0x41, 0xFE,
-	0xB5, 0x01, 0x88, 0x02, 0x9B, 0xFF, 0x59, 0xFE, 0x43, 0x00, 0x16, 0x01,
-	0x16, 0xFF, 0xAE, 0xFC, 0xC3, 0xFD, 0xC0, 0x02, 0x35, 0x05, 0x71, 0x00,
-	0xA9, 0xFA, 0x24, 0xFC, 0x19, 0x01, 0xDE, 0x01, 0x78, 0xFF, 0xCD, 0xFD,
-	0x6C, 0xFE, 0x9C, 0x01, 0x38, 0x04, 0xEF, 0x00, 0x05, 0xFB, 0xA1, 0xFB,
-	0xEA, 0x01, 0x38, 0x04, 0xDB, 0xFF, 0xEA, 0xFB, 0xEC, 0xFD, 0x73, 0x02,
-	0xC1, 0x02, 0x63, 0xFE, 0x7D, 0xFC, 0x0B, 0x01, 0xE3, 0x04, 0xA9, 0x01,
-	0xF1, 0xFC, 0x40, 0xFD, 0x59, 0xFF, 0x9D, 0xFF, 0x0D, 0xFF, 0x41, 0xFF,
-	0xF7, 0xFF, 0x6C, 0x00, 0x9F, 0x01, 0x57, 0x02, 0x92, 0xFF, 0x2E, 0xFC,
-	0x4D, 0xFD, 0xD2, 0x00, 0xFE, 0x01, 0xE8, 0x00, 0x2B, 0xFF, 0xA7, 0xFE,
-	0x9F, 0xFF, 0x10, 0xFF, 0xD2, 0xFD, 0x63, 0x00, 0x47, 0x04, 0xE4, 0x02,
-	0x6D, 0xFE, 0x97, 0xFD, 0x86, 0xFF, 0xF4, 0xFE, 0xAE, 0xFC, 0x92, 0xFD,
-	0x67, 0x01, 0xD9, 0x03, 0x27, 0x03, 0x5B, 0x01, 0x0A, 0x00, 0xF9, 0xFD,
-	0x56, 0xFC, 0xC0, 0xFD, 0xD0, 0xFF, 0x09, 0x00, 0xDE, 0x00, 0x6A, 0x02,
-	0x3C, 0x01, 0xA5, 0xFE, 0x62, 0xFD, 0x51, 0xFD, 0x28, 0xFE, 0x63, 0x00,
-	0x95, 0x02, 0xBD, 0x02, 0x98, 0x00, 0xF0, 0xFE, 0xCF, 0xFF, 0x68, 0x00,
-	0x5B, 0xFF, 0x18, 0xFE, 0x2A, 0xFD, 0x2D, 0xFE, 0x7F, 0x01, 0x43, 0x02,
-	0x3A, 0x00, 0xFD, 0xFF, 0x53, 0x01, 0xF3, 0x00, 0x9B, 0xFE, 0x9F, 0xFC,
-	0xDD, 0xFC, 0xD6, 0xFE, 0xFE, 0x01, 0x2F, 0x03, 0x1A, 0x00, 0xA5, 0xFE,
-	0x51, 0x01, 0xF6, 0x01, 0xD5, 0xFE, 0x33, 0xFD, 0x93, 0xFF, 0x9B, 0x01,
-	0x49, 0x00, 0x7C, 0xFE, 0xC2, 0xFE, 0x97, 0x00, 0x93, 0x02, 0x26, 0x02,
-	0x6F, 0xFE, 0x75, 0xFB, 0x1B, 0xFD, 0xFF, 0x00, 0x03, 0x02, 0x93, 0xFF,
-	0x6C, 0xFE, 0x10, 0x01, 0xE6, 0x03, 0x67, 0x01, 0x3E, 0xFC, 0xC0, 0xFC,
-	0xE0, 0x00, 0x89, 0x01, 0x0E, 0xFF, 0x67, 0xFE, 0x85, 0x00, 0x08, 0x03,
-	0x37, 0x02, 0x75, 0xFE, 0xB9, 0xFB, 0x6D, 0xFC, 0xAC, 0xFF, 0x21, 0x02,
-	0x4B, 0x01, 0x1A, 0x00, 0x1D, 0x02, 0xDE, 0x03, 0xE7, 0x00, 0x5C, 0xFB,
-	0x8F, 0xF9, 0x7D, 0xFD, 0xEC, 0x02, 0x48, 0x04, 0xA2, 0x01, 0xC5, 0x00,
-	0x1E, 0x02, 0x60, 0x00, 0x80, 0xFB, 0xA8, 0xF9, 0x4D, 0xFE, 0xBB, 0x04,
-	0x62, 0x06, 0x81, 0x03, 0x04, 0xFF, 0x0E, 0xFC, 0x27, 0xFC, 0x71, 0xFD,
-	0xE7, 0xFD, 0xBA, 0xFE, 0x00, 0x03, 0x06, 0x08, 0xC9, 0x06, 0x33, 0xFF,
-	0x90, 0xF8, 0x43, 0xF8, 0x2E, 0xFD, 0x2A, 0x01, 0x9A, 0x01, 0xFB, 0x01,
-	0x4A, 0x04, 0x04, 0x04, 0x36, 0xFF, 0x83, 0xFB, 0x9A, 0xFC, 0xD3, 0xFF,
-	0x24, 0x02, 0xF8, 0x02, 0x5C, 0x02, 0x0E, 0x00, 0x87, 0xFE, 0x8D, 0x00,
-	0x23, 0x02, 0x70, 0x00, 0x9E, 0xFF, 0x6D, 0x00, 0xEA, 0x00, 0x0A, 0x02,
-	0x0A, 0x03, 0xC6, 0x01, 0x8E, 0x00, 0xFF, 0x00, 0xC0, 0xFF, 0x58, 0xFC,
-	0x02, 0xFA, 0x21, 0xFB, 0x0C, 0x01, 0x3B, 0x07, 0x9A, 0x07, 0x1C, 0x03,
-	0xFD, 0xFE, 0xA4, 0xFD, 0xBE, 0xFC, 0xDE, 0xFA, 0x4A, 0xFB, 0x0A, 0x00,
-	0x1D, 0x05, 0x43, 0x06, 0x45, 0x04, 0x29, 0x00, 0x68, 0xFB, 0xBD, 0xF9,
-	0x1E, 0xFD, 0x8B, 0x01, 0x39, 0x03, 0xF6, 0x02, 0x70, 0x02, 0x82, 0x02,
-	0x3C, 0x02, 0xAD, 0xFD, 0x28, 0xF7, 0x08, 0xF8, 0xF1, 0x00, 0xC9, 0x07,
-	0xFF, 0x06, 0xBF, 0x02, 0x2C, 0x01, 0xB7, 0x01, 0x53, 0x00, 0x7D, 0xFC,
-	0xC6, 0xF8, 0x0F, 0xF9, 0x0B, 0xFF, 0x9A, 0x05, 0xEE, 0x06, 0xA5, 0x03,
-	0x14, 0x00, 0xC8, 0xFE, 0x62, 0xFE, 0x21, 0xFD, 0xFB, 0xFB, 0x36, 0xFE,
-	0x70, 0x03, 0xA4, 0x05, 0xE4, 0x02, 0xCC, 0xFF, 0x5F, 0xFE, 0xD4, 0xFC,
-	0x6C, 0xFC, 0x2B, 0xFE, 0x8E, 0xFF, 0xDC, 0xFF, 0xB8, 0x02, 0xC8, 0x06,
-	0xDE, 0x05, 0x37, 0xFF, 0x2C, 0xFA, 0x99, 0xFB, 0x1D, 0xFF, 0x3B, 0x00,
-	0x5C, 0x00, 0x76, 0x02, 0x92, 0x05, 0x61, 0x04, 0x43, 0xFE, 0x8A, 0xF9,
-	0xCC, 0xFA, 0x8D, 0x00, 0x79, 0x05, 0xB8, 0x04, 0xD8, 0xFF, 0x8E, 0xFD,
-	0xD1, 0x00, 0x51, 0x03, 0xF6, 0x00, 0xE2, 0xFD, 0xDE, 0xFC, 0x0E, 0xFD,
-	0x51, 0xFF, 0x38, 0x03, 0x45, 0x04, 0x61, 0x01, 0x69, 0xFF, 0xBF, 0x00,
-	0x78, 0x01, 0x09, 0xFE, 0xF0, 0xF9, 0x00, 0xFC, 0xCC, 0x02, 0x9B, 0x06,
-	0xCA, 0x04, 0xBB, 0x00, 0x18, 0xFE, 0xCE, 0xFD, 0xF3, 0xFE, 0x17, 0xFE,
-	0x59, 0xFB, 0x10, 0xFE, 0x4C, 0x06, 0xA7, 0x08, 0xB2, 0x03, 0x11, 0xFF,
-	0x0A, 0xFC, 0xE0, 0xF9, 0xFC, 0xFA, 0x3F, 0xFF, 0xA1, 0x02, 0x0E, 0x02,
-	0xDD, 0x00, 0xF8, 0x03, 0x53, 0x06, 0x48, 0x02, 0x27, 0xFC, 0x66, 0xF9,
-	0x27, 0xFA, 0xAA, 0xFD, 0x4B, 0x00, 0xE3, 0xFE, 0x5A, 0x00, 0xF4, 0x05,
-	0x83, 0x05, 0x59, 0xFE, 0x9B, 0xFA, 0x00, 0xFD, 0x26, 0x00, 0xBB, 0xFF,
-	0x66, 0xFE, 0x89, 0x01, 0x37, 0x05, 0x88, 0x02, 0x17, 0xFD, 0x61, 0xFB,
-	0x6C, 0xFC, 0xF8, 0xFD, 0x04, 0x01, 0xBB, 0x05, 0x9F, 0x08, 0x0A, 0x05,
-	0xBA, 0xFC, 0xFC, 0xF7, 0x78, 0xFA, 0xCB, 0xFE, 0x86, 0xFF, 0x8C, 0xFF,
-	0x22, 0x04, 0xF6, 0x07, 0xC2, 0x03, 0x0E, 0xFD, 0x8B, 0xFC, 0xA8, 0x00,
-	0xD6, 0x02, 0x16, 0x01, 0x60, 0xFD, 0xF2, 0xFC, 0x60, 0x01, 0xC7, 0x04,
-	0xB3, 0x02, 0xE9, 0xFE, 0x08, 0xFE, 0x49, 0x00, 0x21, 0x02, 0x5D, 0x00,
-	0x2A, 0xFD, 0x20, 0xFE, 0xB0, 0x03, 0x33, 0x08, 0xFD, 0x05, 0x71, 0xFE,
-	0x63, 0xFA, 0x14, 0xFE, 0x98, 0x02, 0x0E, 0x02, 0xF5, 0xFF, 0xAA, 0x00,
-	0xCC, 0x02, 0x77, 0x03, 0xCF, 0x00, 0x10, 0xFC, 0xA1, 0xFA, 0xD0, 0xFE,
-	0xE8, 0x03, 0x23, 0x05, 0x0B, 0x03, 0x5B, 0x01, 0xF2, 0x00, 0x28, 0xFE,
-	0x6C, 0xFA, 0xBE, 0xFC, 0xC4, 0x02, 0x0D, 0x05, 0x84, 0x03, 0xF8, 0x01,
-	0xD4, 0x00, 0x91, 0xFF, 0x4A, 0xFF, 0x14, 0x00, 0x7D, 0xFF, 0x73, 0xFE,
-	0x3D, 0xFF, 0x2B, 0x01, 0x5C, 0x02, 0xFF, 0x01, 0xA7, 0x00, 0x36, 0x00,
-	0xF7, 0x00, 0x50, 0x00, 0x78, 0xFE, 0xCF, 0xFE, 0xB9, 0x01, 0x39, 0x03,
-	0xBB, 0x00, 0x2E, 0xFD, 0xC6, 0xFC, 0xDB, 0xFE, 0x84, 0x00, 0x4F, 0x01,
-	0x8A, 0x02, 0x9C, 0x02, 0x77, 0x00, 0xA7, 0xFE, 0xBF, 0xFE, 0x71, 0xFF,
-	0x32, 0xFF, 0xF2, 0xFE, 0x67, 0x01, 0xF9, 0x03, 0x26, 0x01, 0xC8, 0xFC,
-	0x96, 0xFD, 0x37, 0x01, 0x31, 0x02, 0x53, 0x00, 0x8C, 0xFE, 0x8F, 0xFF,
-	0x0D, 0x02, 0x31, 0x02, 0xC0, 0xFF, 0x3C, 0xFD, 0xFA, 0xFB, 0xAF, 0xFC,
-	0xA4, 0x00, 0xFC, 0x04, 0x9C, 0x04, 0xC1, 0x00, 0x8A, 0xFE, 0xFB, 0xFE,
-	0x82, 0xFF, 0xD1, 0xFD, 0x5B, 0xFC, 0x66, 0xFF, 0x02, 0x05, 0xFD, 0x06,
-	0x38, 0x03, 0x1E, 0xFD, 0xC7, 0xF9, 0x06, 0xFC, 0x8D, 0x00, 0xAA, 0x01,
-	0x03, 0x00, 0x3C, 0x00, 0x7E, 0x02, 0x64, 0x04, 0xC0, 0x02, 0xF9, 0xFB,
-	0xC0, 0xF6, 0xB1, 0xF8, 0x6B, 0xFF, 0xBE, 0x05, 0x9B, 0x07, 0x2D, 0x05,
-	0x22, 0x02, 0x49, 0xFF, 0x10, 0xFD, 0x88, 0xFB, 0x17, 0xFA, 0x5B, 0xFC,
-	0xE9, 0x02, 0xF3, 0x05, 0x11, 0x03, 0x98, 0xFF, 0xD1, 0xFD, 0x06, 0xFE,
-	0x5C, 0xFF, 0x97, 0xFF, 0x67, 0x00, 0xA8, 0x01, 0x9F, 0xFF, 0xD0, 0xFD,
-	0xAC, 0x00, 0x1B, 0x03, 0x1A, 0x01, 0xB6, 0xFD, 0x64, 0xFD, 0xAC, 0x00,
-	0xC8, 0x03, 0x0A, 0x02, 0xB8, 0xFC, 0xA0, 0xFA, 0x4C, 0xFD, 0x63, 0x01,
-	0xEB, 0x04, 0x6D, 0x05, 0x94, 0x00, 0xDF, 0xF8, 0xCB, 0xF6, 0x14, 0xFD,
-	0x97, 0x01, 0x26, 0x01, 0xDF, 0x03, 0x84, 0x08, 0x51, 0x06, 0xD6, 0xFD,
-	0x34, 0xF7, 0xAB, 0xF6, 0xE6, 0xFA, 0x00, 0x02, 0xC7, 0x08, 0x9C, 0x09,
-	0x53, 0x02, 0xFA, 0xF8, 0xDF, 0xF6, 0x08, 0xFC, 0xC2, 0xFF, 0x40, 0x00,
-	0x58, 0x02, 0x5E, 0x05, 0x5B, 0x05, 0xB4, 0x00, 0xBA, 0xFB, 0x6F, 0xFC,
-	0xD4, 0xFE, 0x55, 0xFD, 0x0C, 0xFD, 0xA2, 0x01, 0x50, 0x05, 0xD5, 0x03,
-	0x50, 0x00, 0x90, 0xFE, 0x89, 0x00, 0x9F, 0x03, 0xFE, 0x00, 0xCE, 0xFA,
-	0xC4, 0xF9, 0xE5, 0xFC, 0x6D, 0xFE, 0x77, 0xFE, 0xCE, 0x01, 0x42, 0x07,
-	0x04, 0x08, 0x0B, 0x04, 0xF7, 0xFF, 0x1F, 0xFC, 0xA3, 0xF8, 0x63, 0xF9,
-	0xDF, 0xFD, 0xFD, 0x01, 0x69, 0x04, 0x6E, 0x04, 0x7D, 0x02, 0x5C, 0x02,
-	0xC5, 0x02, 0xB6, 0xFF, 0x27, 0xFB, 0x54, 0xFA, 0x7C, 0xFD, 0x96, 0x01,
-	0x12, 0x04, 0x4F, 0x04, 0xB0, 0x03, 0xCC, 0x02, 0xB3, 0xFF, 0x12, 0xFB,
-	0x8E, 0xF8, 0x6A, 0xFA, 0xDC, 0x00, 0x91, 0x08, 0xD8, 0x0A, 0x0B, 0x05,
-	0xFC, 0xFC, 0x74, 0xF9, 0xFC, 0xF9, 0xF6, 0xFA, 0xAD, 0xFD, 0xED, 0x03,
-	0x89, 0x08, 0x52, 0x04, 0x3E, 0xFB, 0xA1, 0xF9, 0xBB, 0x00, 0xC9, 0x05,
-	0x68, 0x03, 0x24, 0xFE, 0x10, 0xFC, 0x2B, 0xFD, 0x6C, 0xFE, 0x13, 0xFF,
-	0xA2, 0x01, 0x8C, 0x05, 0x0F, 0x06, 0x82, 0x02, 0x5B, 0xFE, 0xDB, 0xFB,
-	0x11, 0xFB, 0x83, 0xFB, 0x21, 0xFD, 0x5F, 0x00, 0xBB, 0x05, 0x68, 0x09,
-	0xCB, 0x04, 0x2C, 0xFA, 0x80, 0xF4, 0x85, 0xF8, 0x06, 0xFF, 0x67, 0x02,
-	0x39, 0x04, 0x6B, 0x07, 0x16, 0x0A, 0x09, 0x05, 0x7B, 0xF8, 0xDF, 0xF1,
-	0xB0, 0xF7, 0x4D, 0x01, 0xD4, 0x05, 0xAA, 0x05, 0x53, 0x05, 0x81, 0x04,
-	0xB6, 0x01, 0x3B, 0xFF, 0x3B, 0xFC, 0xAD, 0xF8, 0x15, 0xF9, 0x32, 0xFF,
-	0x04, 0x06, 0x3C, 0x07, 0x6E, 0x02, 0x0C, 0xFF, 0x93, 0x01, 0xDA, 0x02,
-	0x2F, 0xFE, 0x38, 0xFB, 0x92, 0xFD, 0x10, 0xFF, 0xE4, 0xFD, 0x7C, 0xFE,
-	0x01, 0x03, 0x58, 0x08, 0xB5, 0x06, 0xB1, 0xFC, 0xD5, 0xF5, 0x8A, 0xF8,
-	0xC1, 0xFE, 0x14, 0x03, 0x45, 0x04, 0xA2, 0x03, 0x4F, 0x04, 0xDB, 0x03,
-	0x92, 0xFE, 0x90, 0xF9, 0xEE, 0xF8, 0x6E, 0xFA, 0xEF, 0xFE, 0x51, 0x06,
-	0xC8, 0x09, 0x65, 0x05, 0xF8, 0xFD, 0xFE, 0xF9, 0x59, 0xFA, 0x7B, 0xFC,
-	0xA5, 0xFC, 0x86, 0xFB, 0xBA, 0xFD, 0x47, 0x03, 0x38, 0x06, 0x97, 0x03,
-	0x66, 0xFE, 0x6E, 0xFB, 0xE7, 0xFC, 0xCC, 0xFF, 0xB0, 0x01, 0x04, 0x02,
-	0xF2, 0xFF, 0x2B, 0xFE, 0xDC, 0xFE, 0x85, 0x00, 0x05, 0x01, 0xB3, 0xFF,
-	0x9A, 0xFF, 0xF8, 0x01, 0x73, 0x02, 0x59, 0xFD, 0x56, 0xF7, 0x0E, 0xF9,
-	0x8B, 0x01, 0xEC, 0x07, 0x8E, 0x08, 0x97, 0x07, 0x54, 0x06, 0xAD, 0x00,
-	0x68, 0xF6, 0x9B, 0xF0, 0x68, 0xF6, 0xE2, 0x02, 0x0A, 0x0C, 0xEC, 0x0C,
-	0xFE, 0x07, 0x62, 0x02, 0x39, 0xFE, 0xEB, 0xFA, 0x59, 0xF9, 0xDD, 0xFA,
-	0x79, 0xFD, 0x1C, 0x01, 0xA2, 0x04, 0xCB, 0x04, 0x9A, 0x02, 0xA6, 0x01,
-	0x8C, 0x00, 0x00, 0xFE, 0x23, 0xFD, 0x6A, 0x00, 0x17, 0x03, 0x7C, 0xFF,
-	0xE6, 0xFA, 0x7A, 0xFE, 0x38, 0x05, 0x74, 0x03, 0xFE, 0xFB, 0xAA, 0xFB,
-	0xE5, 0x01, 0x3B, 0x03, 0xCF, 0xFE, 0xAA, 0xFE, 0xA7, 0x02, 0x96, 0x02,
-	0xB3, 0x00, 0x82, 0x01, 0x68, 0x00, 0xAF, 0xFC, 0x11, 0xFC, 0x81, 0xFE,
-	0x7B, 0x00, 0xFD, 0x00, 0xCD, 0x00, 0x79, 0x01, 0x8C, 0x02, 0xCA, 0x01,
-	0xF2, 0xFE, 0x15, 0xFC, 0x34, 0xFB, 0x32, 0xFC, 0xB5, 0xFF, 0x67, 0x02,
-	0x46, 0x00, 0x76, 0xFD, 0x2E, 0xFF, 0xA9, 0x03, 0xB6, 0x05, 0xDF, 0x01,
-	0x75, 0xFC, 0x27, 0xFE, 0xD7, 0x02, 0x67, 0x00, 0xFC, 0xFA, 0x41, 0xFC,
-	0x40, 0x03, 0x9C, 0x06, 0x76, 0x02, 0xCF, 0xFD, 0xE7, 0xFC, 0x3D, 0xFC,
-	0xD2, 0xFC, 0xE0, 0x00, 0x67, 0x03, 0xD5, 0x01, 0x9A, 0x01, 0x85, 0x04,
-	0x8F, 0x04, 0xDE, 0xFE, 0x73, 0xFA, 0xC0, 0xFD, 0x05, 0x02, 0xF8, 0xFF,
-	0xD5, 0xFD, 0xB2, 0x02, 0xF5, 0x08, 0x03, 0x08, 0x60, 0x01, 0xE9, 0xFC,
-	0x21, 0xFC, 0x48, 0xFC, 0x36, 0xFE, 0xCD, 0x00, 0x85, 0x00, 0x32, 0xFF,
-	0xDC, 0x00, 0x4C, 0x03, 0x3D, 0x01, 0x8E, 0xFD, 0x17, 0xFF, 0x6B, 0x04,
-	0xAD, 0x05, 0x23, 0x01, 0xC9, 0xFC, 0xA5, 0xFC, 0xC9, 0xFF, 0x3C, 0x01,
-	0xF5, 0xFE, 0x41, 0xFF, 0x6A, 0x03, 0x4E, 0x04, 0x83, 0x01, 0x4F, 0xFF,
-	0xB3, 0xFF, 0xC5, 0x00, 0x28, 0xFE, 0xA2, 0xF8, 0x7D, 0xF8, 0xA5, 0xFE,
-	0x63, 0x03, 0xD1, 0x04, 0x48, 0x07, 0x70, 0x0A, 0xB5, 0x06, 0x96, 0xFA,
-	0x88, 0xF0, 0x58, 0xF2, 0xC4, 0xFD, 0xCE, 0x06, 0xE3, 0x08, 0xDD, 0x07,
-	0xA7, 0x05, 0x91, 0x01, 0x7A, 0xFA, 0x7B, 0xF2, 0x30, 0xF2, 0x80, 0xFD,
-	0x8D, 0x0B, 0x8D, 0x0E, 0x5D, 0x05, 0x31, 0xFC, 0x4C, 0xFB, 0xAA, 0xFD,
-	0x0E, 0xFD, 0xCB, 0xFB, 0x4E, 0xFE, 0x46, 0x03, 0xE0, 0x05, 0x35, 0x04,
-	0x98, 0xFF, 0x27, 0xFC, 0xB6, 0xFD, 0x06, 0x00, 0x42, 0xFD, 0x31, 0xF9,
-	0x5A, 0xF9, 0x92, 0xFD, 0x1E, 0x05, 0xE2, 0x09, 0xCD, 0x05, 0xC2, 0x00,
-	0x2B, 0x02, 0x08, 0x02, 0xAB, 0xFA, 0x2B, 0xF4, 0x3C, 0xF7, 0x9C, 0x00,
-	0xBE, 0x06, 0x44, 0x06, 0xF6, 0x03, 0xE8, 0x02, 0xD4, 0x01, 0x65, 0x00,
-	0x3C, 0xFE, 0x1C, 0xFB, 0x8F, 0xF9, 0x78, 0xFC, 0xFE, 0x00, 0xB7, 0x02,
-	0x6E, 0x01, 0xF2, 0xFF, 0x0E, 0x02, 0xD0, 0x06, 0xE0, 0x05, 0xA1, 0xFE,
-	0xFA, 0xFA, 0x26, 0xFD, 0x2B, 0xFE, 0x75, 0xFD, 0xD3, 0xFE, 0x1E, 0x02,
-	0xB9, 0x05, 0x72, 0x08, 0x8B, 0x08, 0x6C, 0x03, 0x85, 0xFA, 0xF7, 0xF4,
-	0xA8, 0xF7, 0xB8, 0xFE, 0x06, 0x04, 0x61, 0x08, 0x0C, 0x0C, 0xBD, 0x09,
-	0xE7, 0x01, 0xDC, 0xFC, 0x78, 0xFA, 0x55, 0xF5, 0xE4, 0xF3, 0x2C, 0xFD,
-	0xF1, 0x07, 0x2F, 0x0A, 0xB2, 0x05, 0x19, 0x03, 0xF1, 0x04, 0x58, 0x02,
-	0x81, 0xF6, 0xEB, 0xED, 0xF2, 0xF4, 0x8C, 0x04, 0xF6, 0x0C, 0x46, 0x0B,
-	0x2C, 0x07, 0x26, 0x04, 0x88, 0xFF, 0x1B, 0xF9, 0xA3, 0xF6, 0x49, 0xF9,
-	0xC8, 0xFB, 0x1A, 0xFE, 0x54, 0x03, 0xE3, 0x07, 0x42, 0x06, 0x50, 0x01,
-	0x53, 0xFE, 0x50, 0xFB, 0xEB, 0xF7, 0xF3, 0xF7, 0x8B, 0xFA, 0xA3, 0xFC,
-	0x52, 0x00, 0x4B, 0x06, 0x93, 0x08, 0xC7, 0x05, 0x5A, 0x01, 0x84, 0xFC,
-	0x72, 0xF8, 0xC6, 0xF6, 0x3F, 0xF7, 0x72, 0xFA, 0x6C, 0x01, 0x06, 0x09,
-	0x14, 0x0B, 0x52, 0x05, 0xC4, 0xFD, 0x70, 0xFB, 0xED, 0xFA, 0x60, 0xF7,
-	0x37, 0xF6, 0x04, 0xFC, 0xA5, 0x03, 0x47, 0x08, 0x97, 0x08, 0x32, 0x04,
-	0xBD, 0xFD, 0xBD, 0xFA, 0x86, 0xFC, 0xB0, 0xFD, 0xE0, 0xFB, 0x65, 0xFC,
-	0xD5, 0x00, 0x89, 0x03, 0xFC, 0x02, 0x56, 0x01, 0x28, 0x00, 0x6F, 0x00,
-	0x7D, 0x01, 0x53, 0x00, 0x10, 0xFC, 0xFA, 0xF9, 0xDE, 0xFD, 0xA2, 0x02,
-	0x3C, 0x03, 0x40, 0x03, 0x7C, 0x05, 0xC1, 0x05, 0x6B, 0x01, 0x62, 0xFB,
-	0xCE, 0xF8, 0xD1, 0xFA, 0xE0, 0xFE, 0xF9, 0x01, 0xC5, 0x01, 0x16, 0x01,
-	0x98, 0x03, 0x94, 0x04, 0x1A, 0x01, 0x52, 0xFD, 0x14, 0xFB, 0xB5, 0xFA,
-	0x27, 0xFD, 0x83, 0x00, 0xB2, 0x02, 0x27, 0x04, 0xC7, 0x03, 0x66, 0x00,
-	0x69, 0xFD, 0xF5, 0xFC, 0xC7, 0xFB, 0xE3, 0xFA, 0x8D, 0xFE, 0x3F, 0x03,
-	0x68, 0x02, 0x37, 0xFE, 0x6F, 0xFD, 0x90, 0x00, 0x0F, 0x02, 0xA1, 0xFD,
-	0xE7, 0xF8, 0x81, 0xFB, 0x62, 0x01, 0xA7, 0x01, 0xAC, 0xFE, 0xB7, 0xFF,
-	0xCE, 0x02, 0xD0, 0x00, 0x74, 0xFC, 0xE8, 0xFC, 0x41, 0x01, 0x29, 0x03,
-	0x9C, 0x00, 0xC9, 0xFC, 0x83, 0xFB, 0xFE, 0xFC, 0x8A, 0xFE, 0x7E, 0xFD,
-	0x8C, 0xFC, 0xB6, 0xFF, 0xF0, 0x03, 0x47, 0x02, 0x33, 0xFC, 0xC3, 0xFA,
-	0x4F, 0xFF, 0x2B, 0x03, 0x8A, 0x02, 0x3D, 0xFF, 0xC4, 0xFC, 0x3F, 0xFD,
-	0x10, 0x01, 0x86, 0x04, 0x9A, 0x02, 0xC2, 0xFE, 0x78, 0xFD, 0x02, 0xFE,
-	0x07, 0xFF, 0xA7, 0xFE, 0x77, 0xFC, 0xE1, 0xFC, 0x67, 0x00, 0xD5, 0x00,
-	0x9B, 0xFD, 0x60, 0xFD, 0xDE, 0x01, 0x7D, 0x05, 0xA0, 0x05, 0x96, 0x03,
-	0xE6, 0xFF, 0xAF, 0xFA, 0x81, 0xF7, 0x47, 0xFA, 0x37, 0xFF, 0xB8, 0x00,
-	0xCD, 0x00, 0xB3, 0x02, 0x18, 0x04, 0xA3, 0x01, 0x3C, 0xFE, 0x97, 0xFE,
-	0x54, 0x00, 0x10, 0xFF, 0x13, 0xFB, 0xEB, 0xF7, 0xD0, 0xF8, 0xBC, 0xFD,
-	0xDA, 0x04, 0xB2, 0x09, 0xE3, 0x07, 0xE8, 0x01, 0x02, 0xFC, 0x04, 0xF9,
-	0x07, 0xFA, 0x69, 0xFC, 0xF9, 0xFC, 0x26, 0xFE, 0x75, 0x02, 0x23, 0x07,
-	0x95, 0x06, 0x40, 0x00, 0xAC, 0xFA, 0x7A, 0xFB, 0xD5, 0xFF, 0x21, 0x01,
-	0xB6, 0xFD, 0xD9, 0xFB, 0x91, 0xFF, 0xC0, 0x03, 0xDF, 0x01, 0x5C, 0xFD,
-	0x42, 0xFD, 0x2A, 0x00, 0x82, 0x00, 0x61, 0xFE, 0x94, 0xFE, 0x6A, 0x01,
-	0x4C, 0x03, 0x64, 0x02, 0x2B, 0x00, 0x15, 0xFF, 0x4F, 0xFF, 0x15, 0xFF,
-	0xEF, 0xFE, 0x7F, 0x00, 0x1E, 0x01, 0x3A, 0xFE, 0x80, 0xFC, 0x2F, 0xFF,
-	0xDD, 0x01, 0x87, 0x01, 0x40, 0x01, 0x51, 0x02, 0x2F, 0x02, 0xCB, 0xFF,
-	0x7D, 0xFD, 0x13, 0xFD, 0xFB, 0xFD, 0x23, 0xFF, 0x3F, 0x00, 0x4D, 0x01,
-	0x39, 0x02, 0xEA, 0x02, 0x6B, 0x02, 0x28, 0x01, 0xD2, 0x00, 0x57, 0x00,
-	0xF6, 0xFD, 0xBC, 0xFB, 0x9D, 0xFC, 0x7B, 0xFE, 0x94, 0xFE, 0xA5, 0xFF,
-	0x9A, 0x03, 0xF8, 0x06, 0x6E, 0x05, 0x5B, 0x00, 0xB3, 0xFC, 0xCF, 0xFB,
-	0x06, 0xFC, 0xA1, 0xFC, 0x35, 0xFE, 0x8F, 0x00, 0xBB, 0x02, 0xFC, 0x03,
-	0x57, 0x03, 0x1C, 0x01, 0x1A, 0xFE, 0xC9, 0xFA, 0xD4, 0xF9, 0xF7, 0xFC,
-	0x82, 0x00, 0x95, 0x01, 0x7D, 0x02, 0x5C, 0x03, 0x93, 0x00, 0x36, 0xFB,
-	0x15, 0xF9, 0xC4, 0xFB, 0x2B, 0x00, 0x35, 0x04, 0x1D, 0x07, 0xD8, 0x06,
-	0x84, 0x02, 0xCE, 0xFD, 0x32, 0xFC, 0xD3, 0xFB, 0xEF, 0xF9, 0xAB, 0xF8,
-	0xD2, 0xFB, 0x50, 0x02, 0xDB, 0x06, 0x8B, 0x06, 0x09, 0x04, 0xC5, 0x02,
-	0xAD, 0x01, 0xB4, 0xFE, 0x71, 0xFB, 0x4B, 0xFA, 0x36, 0xFB, 0x5B, 0xFC,
-	0xF0, 0xFD, 0x80, 0x01, 0xE6, 0x05, 0x57, 0x08, 0x22, 0x07, 0xCA, 0x02,
-	0xF6, 0xFC, 0xD1, 0xF7, 0x33, 0xF6, 0xCE, 0xF8, 0x85, 0xFD, 0x61, 0x03,
-	0x46, 0x09, 0x11, 0x0B, 0x7C, 0x06, 0xC7, 0xFF, 0x70, 0xFB, 0xFE, 0xF9,
-	0x35, 0xFB, 0xAB, 0xFE, 0xBA, 0x02, 0x7F, 0x05, 0xB3, 0x05, 0x18, 0x03,
-	0x41, 0xFF, 0xF9, 0xFB, 0xF8, 0xFA, 0xAE, 0xFC, 0xBA, 0xFE, 0x26, 0xFF,
-	0xDD, 0xFF, 0xF4, 0x02, 0x0D, 0x06, 0x45, 0x05, 0x8A, 0x01, 0x7B, 0xFE,
-	0x8E, 0xFD, 0x0F, 0xFD, 0x56, 0xFC, 0x68, 0xFD, 0x1F, 0x00, 0xCF, 0x02,
-	0x64, 0x05, 0xFE, 0x06, 0xCD, 0x05, 0xAD, 0x01, 0xC4, 0xFC, 0x5F, 0xFA,
-	0xEB, 0xFA, 0xBE, 0xFB, 0xC9, 0xFC, 0x00, 0x00, 0xBB, 0x04, 0x1D, 0x08,
-	0x9A, 0x07, 0x72, 0x03, 0x32, 0xFF, 0xE5, 0xFB, 0x46, 0xFA, 0x92, 0xFB,
-	0x1C, 0xFF, 0xEE, 0x02, 0x6D, 0x05, 0xFF, 0x05, 0x41, 0x04, 0x32, 0x00,
-	0x0C, 0xFC, 0xE7, 0xFA, 0x87, 0xFC, 0x2E, 0xFE, 0x5A, 0xFF, 0x35, 0x00,
-	0xFB, 0x00, 0x62, 0x01, 0xFB, 0x01, 0xFA, 0x02, 0xE4, 0x02, 0xB5, 0x00,
-	0x1C, 0xFE, 0x51, 0xFC, 0xF3, 0xFB, 0x5B, 0xFD, 0x40, 0xFF, 0xA2, 0x00,
-	0x74, 0x02, 0x17, 0x05, 0x16, 0x06, 0x4A, 0x03, 0x93, 0xFF, 0xEB, 0xFD,
-	0xE1, 0xFC, 0x0B, 0xFB, 0xBB, 0xF9, 0xB9, 0xFA, 0xD2, 0xFE, 0x20, 0x04,
-	0xBE, 0x07, 0x0E, 0x08, 0x9F, 0x05, 0xDB, 0x01, 0x9F, 0xFD, 0x39, 0xFA,
-	0x89, 0xF9, 0xD8, 0xFB, 0xAF, 0xFE, 0xCC, 0x00, 0x13, 0x03, 0xE0, 0x04,
-	0xE9, 0x04, 0xDF, 0x03, 0xAD, 0x02, 0x2A, 0x01, 0xE6, 0xFF, 0x5B, 0xFF,
-	0x59, 0xFE, 0xE3, 0xFC, 0x82, 0xFD, 0xF4, 0x00, 0x49, 0x04, 0x0E, 0x05,
-	0x4A, 0x03, 0x76, 0x01, 0x3B, 0x01, 0xBE, 0x01, 0xB3, 0x01, 0xC9, 0x00,
-	0x0E, 0x00, 0x8B, 0x01, 0xF6, 0x03, 0xB8, 0x03, 0x23, 0x01, 0x02, 0xFF,
-	0xB8, 0xFE, 0x17, 0x00, 0xE1, 0x01, 0xAF, 0x01, 0xA8, 0xFF, 0xE3, 0xFE,
-	0xA4, 0xFF, 0xF6, 0xFF, 0x36, 0xFF, 0xA0, 0xFE, 0xFD, 0xFF, 0x0B, 0x03,
-	0x9C, 0x04, 0x17, 0x02, 0x2A, 0xFE, 0xF5, 0xFC, 0xC5, 0xFE, 0xCF, 0x00,
-	0x23, 0x01, 0x97, 0x00, 0x60, 0x01, 0x0B, 0x03, 0x50, 0x03, 0xFE, 0x00,
-	0xBE, 0xFD, 0x70, 0xFC, 0xBA, 0xFD, 0x67, 0xFF, 0x95, 0xFF, 0xBB, 0xFE,
-	0x31, 0xFF, 0x73, 0x02, 0x0D, 0x06, 0x09, 0x06, 0xC2, 0x02, 0xAB, 0xFF,
-	0x46, 0xFE, 0x4D, 0xFD, 0x5B, 0xFB, 0x36, 0xFA, 0x4C, 0xFC, 0x64, 0x00,
-	0x72, 0x03, 0x46, 0x04, 0x11, 0x04, 0x5A, 0x03, 0xC3, 0x00, 0x4A, 0xFC,
-	0xBB, 0xF8, 0x06, 0xF9, 0xC0, 0xFB, 0x36, 0xFF, 0x21, 0x03, 0xF1, 0x05,
-	0x48, 0x06, 0x67, 0x04, 0x57, 0x01, 0x23, 0xFF, 0x81, 0xFE, 0x54, 0xFD,
-	0xE0, 0xFB, 0xBD, 0xFC, 0x7A, 0xFF, 0x16, 0x01, 0xD8, 0x01, 0x12, 0x03,
-	0x9E, 0x03, 0x4F, 0x02, 0xB5, 0xFF, 0x5C, 0xFC, 0x40, 0xFA, 0xD7, 0xFB,
-	0xD8, 0xFF, 0x0D, 0x03, 0xD1, 0x04, 0x62, 0x05, 0xBC, 0x03, 0x39, 0x00,
-	0x90, 0xFD, 0x78, 0xFC, 0x8D, 0xFB, 0xC8, 0xFB, 0x95, 0xFE, 0x7B, 0x02,
-	0xD1, 0x04, 0x81, 0x04, 0xBA, 0x02, 0xF4, 0x00, 0x68, 0xFF, 0x08, 0xFE,
-	0x88, 0xFC, 0xBF, 0xFB, 0x07, 0xFD, 0x8D, 0x00, 0xCC, 0x03, 0x24, 0x05,
-	0xDA, 0x04, 0xBC, 0x03, 0xF6, 0x01, 0x18, 0x00, 0xDB, 0xFE, 0x76, 0xFE,
-	0xAF, 0xFD, 0x1A, 0xFD, 0xCE, 0xFE, 0x93, 0x01, 0x1A, 0x03, 0xD4, 0x02,
-	0x6A, 0x01, 0xBC, 0xFF, 0x27, 0xFF, 0x27, 0xFF, 0x8C, 0xFE, 0xB1, 0xFD,
-	0xED, 0xFE, 0x51, 0x02, 0x70, 0x04, 0xA4, 0x03, 0x0D, 0x02, 0x96, 0x01,
-	0x39, 0x01, 0xA5, 0xFE, 0x04, 0xFB, 0x0C, 0xF9, 0xDA, 0xF9, 0xA1, 0xFC,
-	0x68, 0xFF, 0xAD, 0x00, 0xCC, 0x01, 0xCC, 0x03, 0x72, 0x05, 0xE6, 0x03,
-	0xA3, 0xFF, 0x92, 0xFC, 0x94, 0xFC, 0x96, 0xFD, 0x5D, 0xFD, 0x91, 0xFD,
-	0x2D, 0x00, 0xCD, 0x03, 0x78, 0x05, 0xAB, 0x04, 0x70, 0x02, 0x46, 0xFF,
-	0x34, 0xFC, 0x43, 0xFA, 0x4C, 0xF9, 0x9C, 0xF9, 0xA8, 0xFB, 0x9A, 0xFE,
-	0xF9, 0x01, 0x32, 0x05, 0xDC, 0x06, 0x02, 0x06, 0xF1, 0x02, 0xF1, 0xFF,
-	0x25, 0xFE, 0x16, 0xFD, 0x8A, 0xFC, 0xEA, 0xFC, 0xAB, 0xFE, 0x97, 0x01,
-	0x4B, 0x04, 0x88, 0x04, 0x94, 0x02, 0x79, 0x00, 0xBF, 0xFE, 0x42, 0xFD,
-	0xA0, 0xFC, 0xC1, 0xFC, 0x9E, 0xFD, 0xE2, 0xFF, 0x9F, 0x03, 0x9B, 0x06,
-	0x0A, 0x07, 0xBE, 0x05, 0xDA, 0x03, 0x90, 0x01, 0x13, 0xFF, 0x3C, 0xFD,
-	0x48, 0xFD, 0x1D, 0xFF, 0xD5, 0x00, 0x2B, 0x02, 0x8F, 0x03, 0x2C, 0x03,
-	0x01, 0x00, 0x7D, 0xFC, 0x0D, 0xFB, 0x7A, 0xFB, 0x80, 0xFC, 0x15, 0xFE,
-	0x6E, 0x00, 0xF6, 0x02, 0x6E, 0x04, 0xE5, 0x03, 0x9B, 0x01, 0x40, 0xFF,
-	0xDF, 0xFD, 0x3D, 0xFD, 0x16, 0xFD, 0xC5, 0xFD, 0x7A, 0xFF, 0x84, 0x01,
-	0xEF, 0x02, 0xF9, 0x02, 0x8E, 0x01, 0x77, 0xFF, 0xB2, 0xFD, 0xFA, 0xFB,
-	0xD7, 0xF9, 0x80, 0xF8, 0xF0, 0xF9, 0x24, 0xFE, 0xF1, 0x02, 0x87, 0x05,
-	0x82, 0x05, 0xA0, 0x04, 0x5F, 0x03, 0xB1, 0x00, 0xAF, 0xFC, 0x2E, 0xFA,
-	0xC4, 0xFA, 0x33, 0xFD, 0xD3, 0xFF, 0xA5, 0x01, 0xE6, 0x02, 0xD3, 0x03,
-	0x5B, 0x03, 0xC1, 0x00, 0x8C, 0xFD, 0xCB, 0xFB, 0x90, 0xFB, 0x6A, 0xFC,
-	0x6C, 0xFE, 0xE3, 0x00, 0xAA, 0x02, 0xE1, 0x03, 0x93, 0x04, 0xB5, 0x03,
-	0x60, 0x01, 0x51, 0xFF, 0x76, 0xFE, 0x7C, 0xFE, 0xDE, 0xFE, 0x10, 0x00,
-	0xBC, 0x01, 0xE5, 0x02, 0x21, 0x03, 0x02, 0x02, 0x62, 0xFF, 0x8D, 0xFC,
-	0x41, 0xFB, 0xB0, 0xFB, 0x08, 0xFD, 0xB5, 0xFE, 0xE3, 0x00, 0x81, 0x03,
-	0x90, 0x05, 0x87, 0x05, 0x9C, 0x03, 0x28, 0x01, 0x28, 0xFF, 0xD2, 0xFD,
-	0x1A, 0xFD, 0x4F, 0xFD, 0x55, 0xFE, 0x04, 0x00, 0xE5, 0x01, 0xC9, 0x03,
-	0xC7, 0x04, 0xC4, 0x03, 0x27, 0x01, 0x6D, 0xFE, 0xBC, 0xFC, 0xEC, 0xFB,
-	0xDC, 0xFB, 0xFC, 0xFC, 0xF3, 0xFE, 0x21, 0x01, 0x55, 0x03, 0xA5, 0x04,
-	0x10, 0x04, 0x19, 0x02, 0xF0, 0xFF, 0x7D, 0xFE, 0xCB, 0xFD, 0xD6, 0xFD,
-	0x79, 0xFE, 0xAE, 0xFF, 0xF4, 0x00, 0xC8, 0x01, 0x40, 0x01, 0x78, 0xFF,
-	0xA0, 0xFD, 0xA7, 0xFC, 0xA9, 0xFC, 0x65, 0xFD, 0x9E, 0xFE, 0xB5, 0xFF,
-	0x52, 0x00, 0x36, 0x00, 0x72, 0xFF, 0xA9, 0xFE, 0x25, 0xFE, 0xE1, 0xFD,
-	0xB2, 0xFD, 0xC6, 0xFD, 0x79, 0xFE, 0xF6, 0xFF, 0x84, 0x01, 0x58, 0x02,
-	0xF1, 0x01, 0xC0, 0x00, 0xA2, 0xFF, 0xA2, 0xFE, 0x9B, 0xFD, 0x6B, 0xFD,
-	0x00, 0xFE, 0x98, 0xFE, 0x38, 0xFF, 0x5A, 0x00, 0x7A, 0x01, 0xC7, 0x01,
-	0x59, 0x01, 0x48, 0x00, 0x8F, 0xFF, 0xB3, 0xFF, 0x39, 0x00, 0x28, 0x00,
-	0xB7, 0xFF, 0xEC, 0xFF, 0xE0, 0x00, 0xE5, 0x01, 0x2E, 0x02, 0xF4, 0x01,
-	0xA6, 0x01, 0x5E, 0x01, 0xA1, 0x00, 0x4F, 0xFF, 0xFD, 0xFD, 0x88, 0xFD,
-	0x1F, 0xFE, 0x62, 0xFF, 0x8B, 0x00, 0xFB, 0x00, 0xCD, 0x00, 0xC9, 0x00,
-	0x05, 0x01, 0xCF, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xB0, 0xFF, 0x70, 0x00,
-	0xF2, 0x00, 0x34, 0x01, 0x34, 0x01, 0xCD, 0x00, 0x14, 0x00, 0x5F, 0xFF,
-	0xD5, 0xFE, 0x75, 0xFE, 0x7C, 0xFE, 0x0A, 0xFF, 0x99, 0xFF, 0x1F, 0x00,
-	0xD6, 0x00, 0x2A, 0x01, 0xB9, 0x00, 0x5D, 0x00, 0x4D, 0x00, 0x43, 0x00,
-	0x57, 0x00, 0x85, 0x00, 0x68, 0x00, 0x35, 0x00, 0x24, 0x00, 0x39, 0x00,
-	0x3C, 0x00, 0xDA, 0xFF, 0x08, 0xFF, 0x01, 0xFE, 0xAA, 0xFD, 0xEE, 0xFD,
-	0xF0, 0xFD, 0x8D, 0xFD, 0x59, 0xFD, 0xD1, 0xFD, 0x8D, 0xFE, 0xFC, 0xFE,
-	0xD2, 0xFE, 0xA4, 0xFE, 0xE9, 0xFE, 0x46, 0xFF, 0x81, 0xFF, 0xB5, 0xFF,
-	0xC6, 0xFF, 0xF1, 0xFF, 0x09, 0x00, 0x28, 0x00, 0x01, 0x00, 0xA0, 0xFF,
-	0x3B, 0xFF, 0xEA, 0xFE, 0x6F, 0xFE, 0xAE, 0xFD, 0x26, 0xFD, 0x4D, 0xFD,
-	0x0E, 0xFE, 0xF7, 0xFE, 0xE4, 0xFF, 0x94, 0x00, 0xB1, 0x00, 0x39, 0x00,
-	0x96, 0xFF, 0x84, 0xFF, 0xCB, 0xFF, 0x27, 0x00, 0x6F, 0x00, 0xA0, 0x00,
-	0xF9, 0x00, 0x2C, 0x01, 0xBA, 0x00, 0xE6, 0xFF, 0x41, 0xFF, 0xDF, 0xFE,
-	0xB3, 0xFE, 0xE8, 0xFE, 0x5D, 0xFF, 0x15, 0x00, 0xA8, 0x00, 0xB9, 0x00,
-	0xB3, 0x00, 0x05, 0x01, 0x46, 0x01, 0x16, 0x01, 0x22, 0x01, 0xF3, 0x00,
-	0x24, 0x00, 0x4F, 0xFF, 0x1A, 0xFF, 0x85, 0xFF, 0x54, 0x00, 0xC2, 0x00,
-	0xBD, 0x00, 0x8D, 0x00, 0x94, 0x00, 0xAC, 0x00, 0x3F, 0x00, 0x33, 0xFF,
-	0x47, 0xFE, 0x22, 0xFE, 0xE0, 0xFE, 0xD4, 0xFF, 0x6A, 0x00, 0xDC, 0x00,
-	0xB2, 0x01, 0x4B, 0x02, 0x05, 0x02, 0xFA, 0x00, 0xA9, 0xFF, 0xA5, 0xFE,
-	0x40, 0xFE, 0x7E, 0xFE, 0x12, 0xFF, 0xB7, 0xFF, 0x6B, 0x00, 0xF0, 0x00,
-	0xDA, 0x00, 0x2C, 0x00, 0x06, 0xFF, 0xEA, 0xFD, 0x6E, 0xFD, 0xC0, 0xFD,
-	0x92, 0xFE, 0xA7, 0xFF, 0x91, 0x00, 0xE5, 0x00, 0x83, 0x00, 0xBD, 0xFF,
-	0x6C, 0xFF, 0x91, 0xFF, 0x7D, 0xFF, 0xDA, 0xFE, 0x8E, 0xFE, 0xD8, 0xFE,
-	0x77, 0xFF, 0xFA, 0xFF, 0x18, 0x00, 0x21, 0x00, 0xFB, 0xFF, 0xBA, 0xFF,
-	0x67, 0xFF, 0x07, 0xFF, 0xAF, 0xFE, 0x74, 0xFE, 0x97, 0xFE, 0x35, 0xFF,
-	0xF6, 0xFF, 0x72, 0x00, 0x9C, 0x00, 0xB5, 0x00, 0xB8, 0x00, 0xB0, 0x00,
-	0xC4, 0x00, 0xDD, 0x00, 0xD2, 0x00, 0xB8, 0x00, 0xB5, 0x00, 0xC7, 0x00,
-	0xB0, 0x00, 0x9B, 0x00, 0x87, 0x00, 0x76, 0x00, 0x28, 0x00, 0xC0, 0xFF,
-	0x4D, 0xFF, 0x20, 0xFF, 0x6E, 0xFF, 0x85, 0x00, 0x85, 0x01, 0x13, 0x02,
-	0x80, 0x02, 0x1B, 0x03, 0x7D, 0x03, 0x02, 0x03, 0xEC, 0x01, 0xF5, 0x00,
-	0x7D, 0x00, 0x63, 0x00, 0x41, 0x00, 0x39, 0x00, 0x85, 0x00, 0xAA, 0x00,
-	0x60, 0x00, 0x03, 0x00, 0x24, 0x00, 0xE0, 0x00, 0xC1, 0x01, 0x44, 0x02,
-	0x0D, 0x02, 0x46, 0x01, 0x52, 0x00, 0x8E, 0xFF, 0x54, 0xFF, 0xCE, 0xFF,
-	0xA9, 0x00, 0x90, 0x01, 0x84, 0x02, 0x28, 0x03, 0x46, 0x03, 0x65, 0x02,
-	0xA0, 0x00, 0xC5, 0xFE, 0xD9, 0xFD, 0x99, 0xFD, 0x60, 0xFD, 0x41, 0xFD,
-	0xAF, 0xFD, 0xC7, 0xFE, 0xEE, 0xFF, 0xC2, 0x00, 0x2B, 0x01, 0x6F, 0x01,
-	0x90, 0x01, 0xB3, 0x01, 0xFF, 0x01, 0x31, 0x02, 0xC8, 0x01, 0xD6, 0x00,
-	0xDD, 0xFF, 0x60, 0xFF, 0x41, 0xFF, 0xC3, 0xFE, 0x16, 0xFE, 0xE4, 0xFD,
-	0x6B, 0xFE, 0xC3, 0xFE, 0x3F, 0xFE, 0x91, 0xFD, 0xD6, 0xFD, 0x9D, 0xFE,
-	0xDF, 0xFE, 0xD4, 0xFE, 0x7B, 0xFF, 0x27, 0x00, 0x14, 0x00, 0x7B, 0xFF,
-	0xF8, 0xFE, 0xB0, 0xFE, 0x5F, 0xFE, 0x29, 0xFE, 0x6D, 0xFE, 0xE6, 0xFE,
-	0x1D, 0xFF, 0x10, 0xFF, 0xEB, 0xFE, 0x9E, 0xFE, 0x10, 0xFE, 0x6B, 0xFD,
-	0x16, 0xFD, 0x51, 0xFD, 0xE0, 0xFD, 0x7A, 0xFE, 0x0E, 0xFF, 0xE6, 0xFF,
-	0x88, 0x00, 0xDB, 0x00, 0xC4, 0x00, 0x5C, 0x00, 0xCB, 0xFF, 0x15, 0xFF,
-	0x5A, 0xFE, 0x9B, 0xFD, 0xD9, 0xFC, 0x41, 0xFC, 0xEE, 0xFB, 0xC4, 0xFB,
-	0x60, 0xFB, 0xE9, 0xFA, 0x9E, 0xFA, 0x7D, 0xFA, 0x69, 0xFA, 0x1A, 0xFA,
-	0x0F, 0xFA, 0x82, 0xFA, 0x21, 0xFB, 0x7B, 0xFB, 0xF5, 0xFB, 0xA6, 0xFC,
-	0x65, 0xFD, 0x81, 0xFD, 0xD4, 0xFC, 0xE5, 0xFB, 0x63, 0xFB, 0x14, 0xFB,
-	0xE5, 0xFA, 0xEE, 0xFA, 0x4A, 0xFB, 0xD1, 0xFB, 0xFD, 0xFB, 0xDB, 0xFB,
-	0xFD, 0xFB, 0xBB, 0xFC, 0x48, 0xFD, 0x52, 0xFD, 0x92, 0xFD, 0x7C, 0xFE,
-	0x8B, 0xFF, 0x08, 0x00, 0x5B, 0x00, 0xD5, 0x00, 0x1B, 0x01, 0xC3, 0x00,
-	0x3F, 0x00, 0x25, 0x00, 0x25, 0x00, 0x0B, 0x00, 0xDA, 0xFF, 0x76, 0xFF,
-	0x2A, 0xFF, 0x16, 0xFF, 0x05, 0xFF, 0x86, 0xFE, 0x00, 0xFE, 0x58, 0xFE,
-	0x5A, 0xFF, 0x74, 0x00, 0x63, 0x01, 0x07, 0x02, 0x49, 0x02, 0x4D, 0x02,
-	0x42, 0x02, 0x22, 0x02, 0xBE, 0x01, 0x73, 0x01, 0x71, 0x01, 0xB6, 0x01,
-	0x1C, 0x02, 0xC6, 0x02, 0x58, 0x03, 0x68, 0x03, 0xF7, 0x02, 0xB8, 0x02,
-	0xCF, 0x02, 0xB6, 0x02, 0x6D, 0x02, 0x9E, 0x02, 0x60, 0x03, 0xFD, 0x03,
-	0x33, 0x04, 0x8E, 0x04, 0x3B, 0x05, 0xDD, 0x05, 0x2B, 0x06, 0xFD, 0x05,
-	0x94, 0x05, 0x1C, 0x05, 0xA8, 0x04, 0x1C, 0x04, 0x92, 0x03, 0x6C, 0x03,
-	0xA5, 0x03, 0x29, 0x04, 0xF2, 0x04, 0x9B, 0x05, 0x2E, 0x06, 0x74, 0x06,
-	0x3B, 0x06, 0x8B, 0x05, 0x9C, 0x04, 0x06, 0x04, 0x19, 0x04, 0x59, 0x04,
-	0xB0, 0x04, 0x94, 0x05, 0x99, 0x06, 0x26, 0x07, 0x2B, 0x07, 0xEA, 0x06,
-	0x85, 0x06, 0xC5, 0x05, 0xDD, 0x04, 0x69, 0x04, 0x34, 0x04, 0xFF, 0x03,
-	0xFA, 0x03, 0x55, 0x04, 0xA2, 0x04, 0x8B, 0x04, 0x39, 0x04, 0x26, 0x04,
-	0x76, 0x04, 0xBF, 0x04, 0xCA, 0x04, 0xDE, 0x04, 0x42, 0x05, 0x16, 0x06,
-	0x04, 0x07, 0x34, 0x07, 0xF5, 0x06, 0xEE, 0x06, 0xD2, 0x06, 0xF2, 0x05,
-	0x9D, 0x04, 0xF8, 0x03, 0x19, 0x04, 0x28, 0x04, 0x5F, 0x04, 0x08, 0x05,
-	0xFD, 0x05, 0x2E, 0x06, 0xC6, 0x05, 0x87, 0x05, 0x4E, 0x05, 0xC9, 0x04,
-	0x2B, 0x04, 0xF3, 0x03, 0x0E, 0x04, 0xE6, 0x03, 0x62, 0x03, 0xA3, 0x02,
-	0xDC, 0x01, 0x02, 0x01, 0xE7, 0xFF, 0x5F, 0xFE, 0x71, 0xFC, 0x92, 0xFA,
-	0xFB, 0xF8, 0x81, 0xF7, 0xAC, 0xF6, 0x17, 0xF7, 0x7C, 0xF8, 0xE2, 0xF9,
-	0xD5, 0xFA, 0x67, 0xFB, 0x6A, 0xFB, 0xBB, 0xFA, 0xAC, 0xF9, 0xD4, 0xF8,
-	0x09, 0xF8, 0x19, 0xF7, 0x41, 0xF6, 0xE3, 0xF5, 0xB6, 0xF5, 0x93, 0xF5,
-	0x74, 0xF5, 0x41, 0xF5, 0xD7, 0xF4, 0x56, 0xF4, 0xFA, 0xF3, 0xA0, 0xF3,
-	0x0C, 0xF3, 0x63, 0xF2, 0x27, 0xF2, 0x28, 0xF2, 0x18, 0xF2, 0x14, 0xF2,
-	0x23, 0xF2, 0x74, 0xF2, 0xAE, 0xF2, 0xE9, 0xF2, 0x2B, 0xF3, 0x3B, 0xF3,
-	0xF7, 0xF2, 0x5E, 0xF2, 0xA7, 0xF1, 0xF7, 0xF0, 0x72, 0xF0, 0x15, 0xF0,
-	0x6E, 0xEF, 0x83, 0xEE, 0xEC, 0xED, 0x2E, 0xEE, 0xE0, 0xEE, 0x95, 0xEF,
-	0x66, 0xF0, 0xD2, 0xF1, 0x86, 0xF3, 0xF6, 0xF4, 0xF0, 0xF5, 0xCA, 0xF6,
-	0x89, 0xF7, 0xCB, 0xF7, 0x80, 0xF7, 0x83, 0xF7, 0x3C, 0xF8, 0x64, 0xF9,
-	0xA7, 0xFA, 0xAE, 0xFB, 0x04, 0xFC, 0xB2, 0xFC, 0x4A, 0xFE, 0x1E, 0xFF,
-	0xBE, 0xFE, 0x63, 0xFE, 0xC9, 0xFE, 0x96, 0xFF, 0x65, 0x00, 0xCC, 0x00,
-	0xDB, 0x00, 0x86, 0x01, 0x5F, 0x03, 0x0B, 0x06, 0x36, 0x08, 0x3E, 0x09,
-	0xFF, 0x09, 0xA9, 0x0A, 0x5C, 0x0A, 0xEA, 0x08, 0x60, 0x07, 0x89, 0x06,
-	0x76, 0x06, 0xDB, 0x06, 0x45, 0x07, 0x8F, 0x07, 0x0A, 0x08, 0xE9, 0x08,
-	0xE4, 0x09, 0x72, 0x0A, 0x01, 0x0B, 0x9F, 0x0B, 0x28, 0x0C, 0x66, 0x0C,
-	0x72, 0x0C, 0x6D, 0x0C, 0x14, 0x0C, 0xB1, 0x0B, 0xC3, 0x0B, 0x68, 0x0C,
-	0xFA, 0x0C, 0x08, 0x0D, 0xDD, 0x0C, 0xD8, 0x0C, 0x7F, 0x0C, 0xC7, 0x0B,
-	0x17, 0x0B, 0xEA, 0x0A, 0x17, 0x0B, 0x6C, 0x0B, 0xB7, 0x0B, 0xE8, 0x0B,
-	0x76, 0x0C, 0x52, 0x0D, 0xFA, 0x0D, 0x37, 0x0E, 0x34, 0x0E, 0x53, 0x0E,
-	0x68, 0x0E, 0x1C, 0x0E, 0xC3, 0x0D, 0xE5, 0x0D, 0x55, 0x0E, 0x42, 0x0E,
-	0xA2, 0x0D, 0x91, 0x0C, 0xA2, 0x0B, 0x00, 0x0B, 0x87, 0x0A, 0x24, 0x0A,
-	0xEE, 0x09, 0x22, 0x0A, 0x3B, 0x0A, 0xFD, 0x09, 0xD6, 0x09, 0x09, 0x0A,
-	0x09, 0x0A, 0x9E, 0x09, 0xA4, 0x09, 0x14, 0x0A, 0x76, 0x0A, 0x57, 0x0A,
-	0xFE, 0x09, 0x00, 0x0A, 0x03, 0x0A, 0xC8, 0x09, 0x8A, 0x09, 0x7D, 0x09,
-	0x59, 0x09, 0xCE, 0x08, 0x12, 0x08, 0x5D, 0x07, 0xF4, 0x06, 0xA0, 0x06,
-	0x70, 0x06, 0x63, 0x06, 0xA3, 0x06, 0x27, 0x07, 0x5B, 0x07, 0x1F, 0x07,
-	0xB3, 0x06, 0x7A, 0x06, 0xE2, 0x05, 0xE9, 0x04, 0xD8, 0x03, 0xD0, 0x02,
-	0xA9, 0x01, 0x7F, 0x00, 0x99, 0xFF, 0xA0, 0xFE, 0x50, 0xFD, 0xCE, 0xFB,
-	0x68, 0xFA, 0x9F, 0xF8, 0x7F, 0xF6, 0xD3, 0xF4, 0x2C, 0xF4, 0x44, 0xF4,
-	0xA4, 0xF4, 0x40, 0xF5, 0x02, 0xF6, 0xCE, 0xF6, 0x36, 0xF7, 0x02, 0xF7,
-	0x64, 0xF6, 0xBD, 0xF5, 0x24, 0xF5, 0x27, 0xF4, 0xAE, 0xF2, 0x62, 0xF1,
-	0x82, 0xF0, 0x97, 0xEF, 0xB1, 0xEE, 0x37, 0xEE, 0x13, 0xEE, 0xB7, 0xED,
-	0x05, 0xED, 0x65, 0xEC, 0xF8, 0xEB, 0x35, 0xEB, 0x49, 0xEA, 0x95, 0xE9,
-	0x56, 0xE9, 0x3B, 0xE9, 0x19, 0xE9, 0x1D, 0xE9, 0x27, 0xE9, 0x17, 0xE9,
-	0x13, 0xE9, 0x65, 0xE9, 0x06, 0xEA, 0xC7, 0xEA, 0x89, 0xEB, 0x2C, 0xEC,
-	0x7F, 0xEC, 0x48, 0xEC, 0xDE, 0xEB, 0xE1, 0xEB, 0x73, 0xEC, 0x24, 0xED,
-	0xB7, 0xED, 0xF7, 0xEE, 0x33, 0xF1, 0xFF, 0xF2, 0xAB, 0xF3, 0x46, 0xF4,
-	0xCD, 0xF5, 0x79, 0xF7, 0x44, 0xF8, 0xF0, 0xF8, 0xA4, 0xFA, 0x58, 0xFC,
-	0xB9, 0xFC, 0x19, 0xFD, 0xAB, 0xFE, 0x4F, 0x00, 0x34, 0x01, 0x0E, 0x02,
-	0x9F, 0x03, 0x07, 0x05, 0x8D, 0x05, 0xD5, 0x05, 0x69, 0x06, 0x97, 0x06,
-	0x63, 0x06, 0xC9, 0x05, 0x12, 0x05, 0xB4, 0x04, 0x6E, 0x05, 0xC7, 0x06,
-	0xB7, 0x07, 0x13, 0x08, 0xBB, 0x08, 0x9D, 0x09, 0x26, 0x0A, 0x79, 0x0A,
-	0xD6, 0x0A, 0x07, 0x0B, 0xCB, 0x0A, 0x33, 0x0A, 0xEF, 0x09, 0x3E, 0x0A,
-	0x35, 0x0B, 0x59, 0x0C, 0x06, 0x0D, 0xFC, 0x0C, 0xB6, 0x0C, 0xA9, 0x0C,
-	0x82, 0x0C, 0x2A, 0x0C, 0xA6, 0x0B, 0x82, 0x0B, 0xD6, 0x0B, 0x11, 0x0C,
-	0xEC, 0x0B, 0xB4, 0x0B, 0xCE, 0x0B, 0xFA, 0x0B, 0xC2, 0x0B, 0x28, 0x0B,
-	0xF6, 0x0A, 0x8C, 0x0B, 0xEC, 0x0B, 0xCE, 0x0B, 0xD1, 0x0B, 0x60, 0x0C,
-	0xA4, 0x0C, 0x7E, 0x0C, 0x88, 0x0C, 0xDB, 0x0C, 0xB0, 0x0C, 0xB9, 0x0B,
-	0xB1, 0x0A, 0x53, 0x0A, 0x64, 0x0A, 0x56, 0x0A, 0x6A, 0x0A, 0x99, 0x0A,
-	0xFF, 0x0A, 0x0F, 0x0B, 0x99, 0x0A, 0x4B, 0x0A, 0x73, 0x0A, 0x76, 0x0A,
-	0xD5, 0x09, 0x4F, 0x09, 0x7A, 0x09, 0xF3, 0x09, 0x33, 0x0A, 0x48, 0x0A,
-	0x7B, 0x0A, 0x95, 0x0A, 0x8F, 0x0A, 0x42, 0x0A, 0xA1, 0x09, 0x1C, 0x09,
-	0x22, 0x09, 0x60, 0x09, 0x56, 0x09, 0x51, 0x09, 0x97, 0x09, 0xD2, 0x09,
-	0xBD, 0x09, 0x95, 0x09, 0x93, 0x09, 0x84, 0x09, 0x74, 0x09, 0x84, 0x09,
-	0x88, 0x09, 0x95, 0x09, 0x7B, 0x09, 0x47, 0x09, 0xDB, 0x08, 0x93, 0x08,
-	0x79, 0x08, 0x14, 0x08, 0x76, 0x07, 0xC7, 0x06, 0x0E, 0x06, 0x47, 0x05,
-	0x54, 0x04, 0x7F, 0x03, 0xC0, 0x02, 0xD8, 0x01, 0x90, 0x00, 0x2E, 0xFF,
-	0xF7, 0xFD, 0xF3, 0xFC, 0xE6, 0xFB, 0xBD, 0xFA, 0xA3, 0xF9, 0xB5, 0xF8,
-	0xE2, 0xF7, 0x28, 0xF7, 0x99, 0xF6, 0x95, 0xF5, 0xBD, 0xF3, 0x14, 0xF1,
-	0x6E, 0xEE, 0x79, 0xEC, 0x52, 0xEB, 0xB5, 0xEA, 0xAF, 0xEA, 0x37, 0xEB,
-	0x1C, 0xEC, 0x3B, 0xED, 0x36, 0xEE, 0x7A, 0xEE, 0x0D, 0xEE, 0x4F, 0xED,
-	0x1E, 0xEC, 0x4D, 0xEA, 0xBE, 0xE8, 0x56, 0xE8, 0x7C, 0xE8, 0x26, 0xE8,
-	0x9F, 0xE7, 0xFD, 0xE7, 0x9D, 0xE8, 0x4C, 0xE8, 0x31, 0xE7, 0x89, 0xE6,
-	0x74, 0xE6, 0x36, 0xE6, 0xD3, 0xE5, 0xF1, 0xE5, 0xEC, 0xE6, 0x32, 0xE8,
-	0x23, 0xE9, 0xCC, 0xE9, 0xAE, 0xEA, 0x06, 0xEC, 0x7C, 0xED, 0x79, 0xEE,
-	0x03, 0xEF, 0xF4, 0xEF, 0xD7, 0xF1, 0xA4, 0xF3, 0x81, 0xF4, 0x2B, 0xF5,
-	0x83, 0xF6, 0x6B, 0xF7, 0x2D, 0xF7, 0xD9, 0xF6, 0x9D, 0xF7, 0xF4, 0xF8,
-	0xE5, 0xF9, 0xEF, 0xFA, 0x0A, 0xFD, 0x85, 0xFF, 0x0A, 0x01, 0xB2, 0x01,
-	0x4C, 0x02, 0x30, 0x03, 0x13, 0x04, 0x18, 0x04, 0x6A, 0x03, 0xF8, 0x03,
-	0x1C, 0x06, 0xED, 0x07, 0xF3, 0x07, 0xAE, 0x07, 0xCC, 0x08, 0xE6, 0x09,
-	0x1B, 0x09, 0x55, 0x07, 0xA8, 0x06, 0xD7, 0x06, 0x3A, 0x06, 0x8D, 0x05,
-	0x8B, 0x06, 0xCB, 0x08, 0x0C, 0x0A, 0x1A, 0x0A, 0xA2, 0x0A, 0x5E, 0x0B,
-	0x7A, 0x0B, 0xF2, 0x0A, 0x24, 0x0A, 0xA8, 0x09, 0xC4, 0x09, 0x32, 0x0A,
-	0x14, 0x0A, 0x3F, 0x0A, 0x7E, 0x0B, 0xF2, 0x0C, 0x09, 0x0D, 0xBF, 0x0B,
-	0x31, 0x0B, 0x52, 0x0B, 0xC3, 0x0A, 0x64, 0x09, 0x94, 0x08, 0xCA, 0x08,
-	0x33, 0x09, 0x62, 0x09, 0xB3, 0x09, 0x45, 0x0A, 0xA6, 0x0A, 0xB2, 0x0A,
-	0x67, 0x0A, 0x12, 0x0A, 0xEC, 0x09, 0x21, 0x0A, 0x45, 0x0A, 0x13, 0x0A,
-	0x19, 0x0A, 0x64, 0x0A, 0x6D, 0x0A, 0xE4, 0x09, 0x63, 0x09, 0x0C, 0x09,
-	0x96, 0x08, 0x00, 0x08, 0xF8, 0x07, 0x78, 0x08, 0x18, 0x09, 0x9C, 0x09,
-	0x04, 0x0A, 0x10, 0x0A, 0x05, 0x0A, 0xBC, 0x09, 0x0D, 0x09, 0x3B, 0x08,
-	0x0A, 0x08, 0x72, 0x08, 0xED, 0x08, 0x35, 0x09, 0xB7, 0x09, 0x96, 0x0A,
-	0x30, 0x0B, 0x14, 0x0B, 0x74, 0x0A, 0xC8, 0x09, 0x50, 0x09, 0xB6, 0x08,
-	0x41, 0x08, 0x3A, 0x08, 0x77, 0x08, 0x9A, 0x08, 0x9D, 0x08, 0xE4, 0x08,
-	0x2D, 0x09, 0x46, 0x09, 0x30, 0x09, 0x0A, 0x09, 0xAB, 0x08, 0x26, 0x08,
-	0xD7, 0x07, 0xE6, 0x07, 0xEC, 0x07, 0xFB, 0x07, 0x27, 0x08, 0x21, 0x08,
-	0x93, 0x07, 0xC0, 0x06, 0xDD, 0x05, 0x02, 0x05, 0x17, 0x04, 0x33, 0x03,
-	0x1D, 0x02, 0xF4, 0x00, 0xA9, 0xFF, 0x5D, 0xFE, 0xF4, 0xFC, 0xA6, 0xFB,
-	0x91, 0xFA, 0xAD, 0xF9, 0xA3, 0xF8, 0x7D, 0xF7, 0x80, 0xF6, 0x9B, 0xF5,
-	0x76, 0xF4, 0x12, 0xF3, 0x6E, 0xF1, 0x78, 0xEF, 0x42, 0xED, 0xDB, 0xEA,
-	0x82, 0xE8, 0xEA, 0xE6, 0x80, 0xE6, 0x0D, 0xE7, 0x0F, 0xE8, 0x38, 0xE9,
-	0x63, 0xEA, 0x91, 0xEB, 0x1E, 0xEC, 0xF4, 0xEB, 0x41, 0xEB, 0x5D, 0xEA,
-	0x71, 0xE9, 0xCD, 0xE8, 0x5C, 0xE8, 0x64, 0xE8, 0x88, 0xE8, 0x84, 0xE8,
-	0x53, 0xE8, 0x13, 0xE8, 0xD9, 0xE7, 0xAD, 0xE7, 0xA4, 0xE7, 0xE3, 0xE7,
-	0x85, 0xE8, 0x5D, 0xE9, 0x57, 0xEA, 0x70, 0xEB, 0x96, 0xEC, 0x7D, 0xED,
-	0x31, 0xEE, 0x9B, 0xEE, 0xE2, 0xEE, 0x7C, 0xEF, 0xF0, 0xF0, 0x21, 0xF3,
-	0x86, 0xF5, 0xFE, 0xF7, 0x9C, 0xFA, 0x96, 0xFC, 0x99, 0xFD, 0xDE, 0xFD,
-	0xE6, 0xFD, 0xE6, 0xFD, 0x8B, 0xFD, 0x08, 0xFD, 0x0C, 0xFD, 0xF4, 0xFD,
-	0xE8, 0xFF, 0x04, 0x02, 0xEA, 0x03, 0x8F, 0x05, 0xD7, 0x06, 0xA4, 0x07,
-	0xF7, 0x07, 0xBE, 0x07, 0x20, 0x07, 0xE5, 0x06, 0xA5, 0x07, 0xF6, 0x08,
-	0x5B, 0x0A, 0xAD, 0x0B, 0xE2, 0x0C, 0x70, 0x0D, 0x40, 0x0D, 0x50, 0x0C,
-	0xDE, 0x0A, 0xA3, 0x09, 0x3B, 0x09, 0x4A, 0x09, 0x30, 0x09, 0x22, 0x09,
-	0x4E, 0x09, 0x76, 0x09, 0x59, 0x09, 0x07, 0x09, 0xAF, 0x08, 0x93, 0x08,
-	0x07, 0x09, 0x64, 0x09, 0x4D, 0x09, 0xC8, 0x09, 0xE3, 0x0A, 0xBC, 0x0B,
-	0xB3, 0x0B, 0x4E, 0x0B, 0x64, 0x0B, 0xCF, 0x0B, 0xF0, 0x0B, 0xDD, 0x0B,
-	0xFA, 0x0B, 0x26, 0x0C, 0xCF, 0x0B, 0x72, 0x0B, 0x93, 0x0B, 0x09, 0x0C,
-	0xFE, 0x0B, 0x22, 0x0B, 0x2F, 0x0A, 0x8C, 0x09, 0x0B, 0x09, 0x7A, 0x08,
-	0x3B, 0x08, 0x93, 0x08, 0x62, 0x09, 0x40, 0x0A, 0xF7, 0x0A, 0xB0, 0x0B,
-	0x19, 0x0C, 0xFD, 0x0B, 0x4D, 0x0B, 0x4D, 0x0A, 0x82, 0x09, 0x3D, 0x09,
-	0x0A, 0x09, 0x16, 0x09, 0x9F, 0x09, 0x72, 0x0A, 0x25, 0x0B, 0x38, 0x0B,
-	0xFE, 0x0A, 0x98, 0x0A, 0x09, 0x0A, 0x59, 0x09, 0xB7, 0x08, 0x5F, 0x08,
-	0x69, 0x08, 0x93, 0x08, 0x9E, 0x08, 0xB3, 0x08, 0x50, 0x09, 0xD9, 0x09,
-	0xF5, 0x09, 0x8F, 0x09, 0x4A, 0x09, 0x43, 0x09, 0x2F, 0x09, 0xE1, 0x08,
-	0x97, 0x08, 0xAD, 0x08, 0xF1, 0x08, 0xF0, 0x08, 0xB5, 0x08, 0x67, 0x08,
-	0x41, 0x08, 0xE0, 0x07, 0x3F, 0x07, 0xB5, 0x06, 0xA4, 0x06, 0xBE, 0x06,
-	0xC4, 0x06, 0x80, 0x06, 0x39, 0x06, 0xF6, 0x05, 0xAB, 0x05, 0xF5, 0x04,
-	0x1C, 0x04, 0x6B, 0x03, 0xBB, 0x02, 0xCC, 0x01, 0x1C, 0x01, 0xBD, 0x00,
-	0x4D, 0x00, 0x5F, 0xFF, 0x3A, 0xFE, 0x07, 0xFD, 0x96, 0xFB, 0xA1, 0xF9,
-	0x9C, 0xF7, 0x09, 0xF6, 0xA6, 0xF4, 0x2D, 0xF3, 0xD7, 0xF1, 0x02, 0xF1,
-	0x3D, 0xF0, 0x10, 0xEF, 0x66, 0xED, 0xAC, 0xEB, 0xDF, 0xE9, 0x18, 0xE8,
-	0xBA, 0xE6, 0x18, 0xE6, 0x22, 0xE6, 0x87, 0xE6, 0x12, 0xE7, 0xE3, 0xE7,
-	0xED, 0xE8, 0x6E, 0xE9, 0x6C, 0xE9, 0x2B, 0xE9, 0x18, 0xE9, 0xCA, 0xE8,
-	0x21, 0xE8, 0xC7, 0xE7, 0x14, 0xE8, 0x61, 0xE8, 0x56, 0xE8, 0x5A, 0xE8,
-	0xA8, 0xE8, 0xDA, 0xE8, 0x53, 0xE8, 0xAD, 0xE7, 0xBC, 0xE7, 0x5D, 0xE8,
-	0x2F, 0xE9, 0x5D, 0xEA, 0x26, 0xEC, 0x2E, 0xEE, 0xB0, 0xEF, 0x81, 0xF0,
-	0x31, 0xF1, 0x1A, 0xF2, 0xF3, 0xF2, 0xA8, 0xF3, 0x9F, 0xF4, 0x9A, 0xF6,
-	0x86, 0xF9, 0x54, 0xFC, 0x5B, 0xFE, 0x51, 0x00, 0x3C, 0x02, 0x0E, 0x03,
-	0xA3, 0x02, 0x59, 0x02, 0xC3, 0x02, 0xC0, 0x02, 0x54, 0x02, 0xD6, 0x02,
-	0x85, 0x04, 0x41, 0x06, 0x61, 0x07, 0x32, 0x08, 0x1B, 0x09, 0x3C, 0x0A,
-	0xBD, 0x0A, 0x40, 0x0A, 0x1D, 0x0A, 0xCB, 0x0A, 0x54, 0x0B, 0xBD, 0x0A,
-	0x4A, 0x0A, 0xE1, 0x0A, 0x8B, 0x0B, 0xE9, 0x0A, 0xB1, 0x09, 0x43, 0x09,
-	0xB7, 0x09, 0xEC, 0x09, 0x40, 0x09, 0x7D, 0x08, 0x74, 0x08, 0xAD, 0x08,
-	0x3A, 0x08, 0x66, 0x07, 0x53, 0x07, 0xCE, 0x07, 0xE0, 0x07, 0x78, 0x07,
-	0x41, 0x07, 0xC0, 0x07, 0x73, 0x08, 0xAA, 0x08, 0x96, 0x08, 0x0B, 0x09,
-	0xEA, 0x09, 0x5A, 0x0A, 0x63, 0x0A, 0x64, 0x0A, 0x91, 0x0A, 0xE7, 0x0A,
-	0x36, 0x0B, 0x59, 0x0B, 0x79, 0x0B, 0xB9, 0x0B, 0xF8, 0x0B, 0xE4, 0x0B,
-	0x9B, 0x0B, 0x5A, 0x0B, 0xF1, 0x0A, 0x62, 0x0A, 0xFA, 0x09, 0xB9, 0x09,
-	0x96, 0x09, 0xA5, 0x09, 0x97, 0x09, 0x5D, 0x09, 0x6F, 0x09, 0xC8, 0x09,
-	0xDC, 0x09, 0xA1, 0x09, 0x5B, 0x09, 0x56, 0x09, 0x86, 0x09, 0xAF, 0x09,
-	0xB3, 0x09, 0xB6, 0x09, 0xD6, 0x09, 0xDA, 0x09, 0x92, 0x09, 0x4C, 0x09,
-	0x34, 0x09, 0x13, 0x09, 0xAA, 0x08, 0x25, 0x08, 0x13, 0x08, 0x5D, 0x08,
-	0x92, 0x08, 0x76, 0x08, 0x54, 0x08, 0x8A, 0x08, 0xF0, 0x08, 0xEF, 0x08,
-	0xCD, 0x08, 0x02, 0x09, 0x61, 0x09, 0x95, 0x09, 0xA0, 0x09, 0x8C, 0x09,
-	0x71, 0x09, 0x01, 0x09, 0x5F, 0x08, 0x16, 0x08, 0x1C, 0x08, 0xE8, 0x07,
-	0x70, 0x07, 0xF6, 0x06, 0xAC, 0x06, 0x54, 0x06, 0xED, 0x05, 0x88, 0x05,
-	0x32, 0x05, 0xA5, 0x04, 0xE0, 0x03, 0x74, 0x03, 0x77, 0x03, 0x75, 0x03,
-	0x19, 0x03, 0xA4, 0x02, 0x2E, 0x02, 0x9F, 0x01, 0xAE, 0x00, 0x7C, 0xFF,
-	0x42, 0xFE, 0x00, 0xFD, 0x7F, 0xFB, 0x1C, 0xFA, 0xCE, 0xF8, 0x87, 0xF7,
-	0x14, 0xF6, 0x5A, 0xF4, 0xC1, 0xF2, 0x67, 0xF1, 0x2B, 0xF0, 0xF7, 0xEE,
-	0xE1, 0xED, 0xE7, 0xEC, 0x97, 0xEB, 0xCF, 0xE9, 0xFE, 0xE7, 0x41, 0xE6,
-	0xB5, 0xE4, 0x91, 0xE3, 0x6D, 0xE3, 0x12, 0xE4, 0x84, 0xE4, 0x9F, 0xE4,
-	0xF4, 0xE4, 0xA5, 0xE5, 0x07, 0xE6, 0xD7, 0xE5, 0xD2, 0xE5, 0x61, 0xE6,
-	0xAD, 0xE6, 0x68, 0xE6, 0x11, 0xE6, 0x50, 0xE6, 0xC0, 0xE6, 0xBD, 0xE6,
-	0x61, 0xE6, 0x7A, 0xE6, 0x74, 0xE7, 0x80, 0xE8, 0x23, 0xE9, 0x89, 0xE9,
-	0x89, 0xEA, 0xE4, 0xEB, 0x0A, 0xED, 0xFD, 0xED, 0x5D, 0xEF, 0x26, 0xF1,
-	0x20, 0xF3, 0xFB, 0xF4, 0xE4, 0xF6, 0x01, 0xF9, 0x20, 0xFB, 0x44, 0xFD,
-	0xCE, 0xFE, 0x04, 0x00, 0x37, 0x01, 0x0C, 0x02, 0x47, 0x02, 0x05, 0x03,
-	0x60, 0x04, 0x81, 0x05, 0xC5, 0x05, 0xEA, 0x05, 0x91, 0x06, 0x14, 0x07,
-	0x14, 0x07, 0x15, 0x07, 0xBF, 0x07, 0xAA, 0x08, 0xB8, 0x08, 0x9B, 0x08,
-	0x92, 0x09, 0xBB, 0x0A, 0xDC, 0x0A, 0xA1, 0x0A, 0x9F, 0x0B, 0xD2, 0x0C,
-	0xC9, 0x0C, 0x53, 0x0C, 0xCF, 0x0C, 0x5C, 0x0D, 0x8D, 0x0C, 0xF5, 0x0A,
-	0x2E, 0x0A, 0x33, 0x0A, 0x72, 0x09, 0xE5, 0x07, 0x12, 0x07, 0x30, 0x07,
-	0xD1, 0x06, 0xBE, 0x05, 0x08, 0x05, 0x13, 0x05, 0xA8, 0x05, 0x0B, 0x06,
-	0x02, 0x06, 0x41, 0x06, 0xF5, 0x06, 0x65, 0x07, 0x4B, 0x07, 0x81, 0x07,
-	0x58, 0x08, 0xFD, 0x08, 0x18, 0x09, 0x47, 0x09, 0x49, 0x0A, 0x60, 0x0B,
-	0xDA, 0x0B, 0x24, 0x0C, 0xAD, 0x0C, 0xD5, 0x0C, 0x34, 0x0C, 0x26, 0x0B,
-	0x61, 0x0A, 0xBC, 0x09, 0xD9, 0x08, 0x3E, 0x08, 0x54, 0x08, 0xD2, 0x08,
-	0x00, 0x09, 0x15, 0x09, 0x8D, 0x09, 0xEA, 0x09, 0xD7, 0x09, 0x89, 0x09,
-	0x90, 0x09, 0xCF, 0x09, 0xC8, 0x09, 0x6A, 0x09, 0xCD, 0x09, 0xFD, 0x0A,
-	0x29, 0x0C, 0xA3, 0x0C, 0xA0, 0x0C, 0xAE, 0x0C, 0x86, 0x0C, 0xA7, 0x0B,
-	0x53, 0x0A, 0x38, 0x09, 0xD3, 0x08, 0x8F, 0x08, 0x35, 0x08, 0x30, 0x08,
-	0x8A, 0x08, 0x81, 0x08, 0x0B, 0x08, 0x7D, 0x07, 0x65, 0x07, 0x53, 0x07,
-	0x14, 0x07, 0x31, 0x07, 0xAA, 0x07, 0x37, 0x08, 0xAA, 0x08, 0x37, 0x09,
-	0x91, 0x09, 0xBC, 0x09, 0xAC, 0x09, 0x6F, 0x09, 0x35, 0x09, 0xD8, 0x08,
-	0x8F, 0x08, 0x7A, 0x08, 0x58, 0x08, 0x0A, 0x08, 0xA1, 0x07, 0x03, 0x07,
-	0x1C, 0x06, 0x35, 0x05, 0x55, 0x04, 0x69, 0x03, 0xAE, 0x02, 0x4C, 0x02,
-	0x25, 0x02, 0xB8, 0x01, 0x42, 0x01, 0xFE, 0x00, 0xCD, 0x00, 0x49, 0x00,
-	0x4B, 0xFF, 0x5D, 0xFE, 0x9F, 0xFD, 0xB9, 0xFC, 0x8C, 0xFB, 0x36, 0xFA,
-	0x0B, 0xF9, 0xE6, 0xF7, 0x52, 0xF6, 0x86, 0xF4, 0x14, 0xF3, 0x26, 0xF2,
-	0x01, 0xF1, 0x2A, 0xEF, 0x67, 0xED, 0xCE, 0xEB, 0xFC, 0xE9, 0xA4, 0xE7,
-	0x62, 0xE5, 0x83, 0xE3, 0x10, 0xE2, 0x2F, 0xE1, 0x0E, 0xE1, 0x47, 0xE1,
-	0x4D, 0xE1, 0x4B, 0xE1, 0xA7, 0xE1, 0x50, 0xE2, 0xBE, 0xE2, 0x10, 0xE3,
-	0x81, 0xE3, 0xC4, 0xE3, 0xB5, 0xE3, 0x31, 0xE4, 0x8E, 0xE5, 0xDA, 0xE6,
-	0x53, 0xE7, 0xBD, 0xE7, 0xA9, 0xE8, 0xA9, 0xE9, 0x5E, 0xEA, 0x26, 0xEB,
-	0x1F, 0xEC, 0xF5, 0xEC, 0x90, 0xED, 0x1E, 0xEE, 0x32, 0xEF, 0x91, 0xF0,
-	0xEC, 0xF1, 0x71, 0xF3, 0x88, 0xF5, 0x46, 0xF8, 0x11, 0xFB, 0x12, 0xFD,
-	0xC8, 0xFE, 0x99, 0x00, 0xD9, 0x01, 0x5B, 0x02, 0x1C, 0x03, 0xA6, 0x04,
-	0x74, 0x06, 0x7B, 0x07, 0x4E, 0x08, 0xCC, 0x09, 0x29, 0x0B, 0xF8, 0x0A,
-	0x46, 0x0A, 0x86, 0x0A, 0x0C, 0x0B, 0xA7, 0x0A, 0x9B, 0x09, 0x69, 0x09,
-	0x39, 0x0A, 0xAD, 0x0A, 0x6D, 0x0A, 0x7C, 0x0A, 0xF9, 0x0A, 0xF3, 0x0A,
-	0xFA, 0x09, 0x21, 0x09, 0x5D, 0x09, 0x41, 0x0A, 0x67, 0x0A, 0xD1, 0x09,
-	0x06, 0x0A, 0xDA, 0x0A, 0xD3, 0x0A, 0x6D, 0x09, 0xFC, 0x07, 0x8F, 0x07,
-	0x68, 0x07, 0x89, 0x06, 0xD9, 0x05, 0x03, 0x06, 0x5E, 0x06, 0x23, 0x06,
-	0xB1, 0x05, 0xD7, 0x05, 0x30, 0x06, 0x17, 0x06, 0xEE, 0x05, 0x41, 0x06,
-	0xB1, 0x06, 0x83, 0x06, 0x47, 0x06, 0xBB, 0x06, 0x7C, 0x07, 0xE1, 0x07,
-	0x0C, 0x08, 0xD0, 0x08, 0x0F, 0x0A, 0x71, 0x0A, 0x24, 0x0A, 0x67, 0x0A,
-	0x8A, 0x0B, 0x4F, 0x0C, 0x3D, 0x0C, 0xCA, 0x0B, 0x73, 0x0B, 0x13, 0x0B,
-	0x7B, 0x0A, 0xE9, 0x09, 0x77, 0x09, 0x16, 0x09, 0xAB, 0x08, 0x88, 0x08,
-	0xBD, 0x08, 0x6B, 0x09, 0x11, 0x0A, 0x41, 0x0A, 0x0C, 0x0A, 0xDA, 0x09,
-	0x7A, 0x09, 0xFA, 0x08, 0xAF, 0x08, 0x12, 0x09, 0xB8, 0x09, 0x00, 0x0A,
-	0x40, 0x0A, 0xDB, 0x0A, 0xAB, 0x0B, 0xE6, 0x0B, 0x9A, 0x0B, 0x3C, 0x0B,
-	0xD6, 0x0A, 0x3C, 0x0A, 0x6E, 0x09, 0xED, 0x08, 0xBD, 0x08, 0xB2, 0x08,
-	0x93, 0x08, 0x73, 0x08, 0x38, 0x08, 0x27, 0x08, 0x2D, 0x08, 0x65, 0x08,
-	0x82, 0x08, 0x51, 0x08, 0x03, 0x08, 0xD6, 0x07, 0xF0, 0x07, 0x24, 0x08,
-	0x43, 0x08, 0x3D, 0x08, 0x1A, 0x08, 0xF5, 0x07, 0xCD, 0x07, 0xBA, 0x07,
-	0xAA, 0x07, 0x96, 0x07, 0x42, 0x07, 0x76, 0x06, 0xA9, 0x05, 0x25, 0x05,
-	0xAA, 0x04, 0xDE, 0x03, 0x0B, 0x03, 0x4B, 0x02, 0xA1, 0x01, 0xB6, 0x00,
-	0xC0, 0xFF, 0xEC, 0xFE, 0x33, 0xFE, 0x6E, 0xFD, 0x7D, 0xFC, 0x7E, 0xFB,
-	0x87, 0xFA, 0xB5, 0xF9, 0xAC, 0xF8, 0x34, 0xF7, 0x8F, 0xF5, 0xE9, 0xF3,
-	0x3F, 0xF2, 0x8C, 0xF0, 0xF5, 0xEE, 0xF1, 0xED, 0x19, 0xED, 0x16, 0xEC,
-	0x91, 0xEA, 0xCE, 0xE8, 0xED, 0xE6, 0xE9, 0xE4, 0xC4, 0xE2, 0xCF, 0xE0,
-	0x99, 0xDF, 0x37, 0xDF, 0x34, 0xDF, 0x62, 0xDF, 0xBB, 0xDF, 0x7E, 0xE0,
-	0x4B, 0xE1, 0xB0, 0xE1, 0xBB, 0xE1, 0xB2, 0xE1, 0xE5, 0xE1, 0xFF, 0xE1,
-	0x0B, 0xE2, 0xBE, 0xE2, 0x26, 0xE4, 0x84, 0xE5, 0x65, 0xE6, 0x1B, 0xE7,
-	0x68, 0xE8, 0x1D, 0xEA, 0x6C, 0xEB, 0x19, 0xEC, 0xFD, 0xEC, 0xA2, 0xEE,
-	0x9A, 0xF0, 0x01, 0xF2, 0x0A, 0xF3, 0xA8, 0xF4, 0xDC, 0xF6, 0xD3, 0xF8,
-	0x7C, 0xFA, 0x48, 0xFC, 0x6D, 0xFE, 0x9B, 0x00, 0x17, 0x02, 0x0B, 0x03,
-	0x95, 0x04, 0x9B, 0x06, 0x17, 0x08, 0xC0, 0x08, 0x10, 0x09, 0xA7, 0x09,
-	0x57, 0x0A, 0xE3, 0x0A, 0x30, 0x0B, 0x37, 0x0B, 0x68, 0x0B, 0x0A, 0x0C,
-	0x6E, 0x0C, 0x74, 0x0C, 0xC9, 0x0C, 0x24, 0x0D, 0xB6, 0x0C, 0xCA, 0x0B,
-	0x0A, 0x0B, 0x58, 0x0A, 0x8C, 0x09, 0x21, 0x09, 0x5F, 0x09, 0x9A, 0x09,
-	0x91, 0x09, 0x95, 0x09, 0xA3, 0x09, 0x2D, 0x09, 0x69, 0x08, 0xE2, 0x07,
-	0x9E, 0x07, 0x06, 0x07, 0x75, 0x06, 0x2E, 0x06, 0x32, 0x06, 0x3B, 0x06,
-	0x28, 0x06, 0xE3, 0x05, 0x42, 0x05, 0xAD, 0x04, 0x99, 0x04, 0xAF, 0x04,
-	0xCA, 0x04, 0x25, 0x05, 0xBA, 0x05, 0xED, 0x05, 0x9A, 0x05, 0x9D, 0x05,
-	0xD4, 0x05, 0xC9, 0x05, 0xAD, 0x05, 0xFD, 0x05, 0x7D, 0x06, 0xD4, 0x06,
-	0x61, 0x07, 0x76, 0x08, 0xAF, 0x09, 0x8E, 0x0A, 0x1B, 0x0B, 0x6F, 0x0B,
-	0x5F, 0x0B, 0xF8, 0x0A, 0x66, 0x0A, 0x17, 0x0A, 0x02, 0x0A, 0xE5, 0x09,
-	0xB0, 0x09, 0xBF, 0x09, 0x13, 0x0A, 0x58, 0x0A, 0x8A, 0x0A, 0x76, 0x0A,
-	0x4D, 0x0A, 0xE1, 0x09, 0x2B, 0x09, 0x6D, 0x08, 0x1E, 0x08, 0x4D, 0x08,
-	0xA3, 0x08, 0x32, 0x09, 0xEA, 0x09, 0x7B, 0x0A, 0xD2, 0x0A, 0xF4, 0x0A,
-	0xB8, 0x0A, 0x3B, 0x0A, 0x9C, 0x09, 0x4E, 0x09, 0x35, 0x09, 0x1C, 0x09,
-	0x31, 0x09, 0x55, 0x09, 0x64, 0x09, 0x55, 0x09, 0x15, 0x09, 0xEB, 0x08,
-	0xEB, 0x08, 0xB7, 0x08, 0x70, 0x08, 0x53, 0x08, 0x69, 0x08, 0x7B, 0x08,
-	0x66, 0x08, 0x99, 0x08, 0xDE, 0x08, 0xFD, 0x08, 0xE8, 0x08, 0xC5, 0x08,
-	0xA4, 0x08, 0x68, 0x08, 0x16, 0x08, 0xCE, 0x07, 0xA9, 0x07, 0x4B, 0x07,
-	0xA3, 0x06, 0xEE, 0x05, 0x5E, 0x05, 0xD3, 0x04, 0x2E, 0x04, 0x5A, 0x03,
-	0x63, 0x02, 0x70, 0x01, 0x8E, 0x00, 0xAE, 0xFF, 0xCA, 0xFE, 0xF7, 0xFD,
-	0x46, 0xFD, 0x8C, 0xFC, 0xA1, 0xFB, 0xA0, 0xFA, 0x8D, 0xF9, 0x66, 0xF8,
-	0x16, 0xF7, 0xD5, 0xF5, 0xA8, 0xF4, 0x6F, 0xF3, 0x26, 0xF2, 0xF2, 0xF0,
-	0xC9, 0xEF, 0x87, 0xEE, 0x25, 0xED, 0xBB, 0xEB, 0x69, 0xEA, 0xEA, 0xE8,
-	0xF5, 0xE6, 0x9D, 0xE4, 0x28, 0xE2, 0xE8, 0xDF, 0x4A, 0xDE, 0x86, 0xDD,
-	0x6A, 0xDD, 0x8A, 0xDD, 0xB3, 0xDD, 0x3B, 0xDE, 0xE0, 0xDE, 0xB8, 0xDE,
-	0x1A, 0xDE, 0x01, 0xDE, 0x40, 0xDE, 0x68, 0xDE, 0x5F, 0xDE, 0x2C, 0xDF,
-	0x13, 0xE1, 0x1D, 0xE3, 0x95, 0xE4, 0x26, 0xE6, 0x59, 0xE8, 0xAE, 0xEA,
-	0x39, 0xEC, 0x56, 0xED, 0xE6, 0xEE, 0x23, 0xF1, 0x25, 0xF3, 0x62, 0xF4,
-	0x67, 0xF5, 0xF1, 0xF6, 0x35, 0xF9, 0x7F, 0xFB, 0xAA, 0xFD, 0xC6, 0xFF,
-	0xAB, 0x01, 0x2A, 0x03, 0x73, 0x04, 0xE8, 0x05, 0x95, 0x07, 0xF1, 0x08,
-	0xE4, 0x09, 0x66, 0x0A, 0xDA, 0x0A, 0x8F, 0x0B, 0x93, 0x0C, 0x9A, 0x0D,
-	0x3D, 0x0E, 0x72, 0x0E, 0x3F, 0x0E, 0x18, 0x0E, 0x55, 0x0E, 0xCD, 0x0E,
-	0xBD, 0x0E, 0xF0, 0x0D, 0x51, 0x0D, 0xFF, 0x0C, 0xF9, 0x0B, 0xC9, 0x0A,
-	0x65, 0x0A, 0x9C, 0x0A, 0x7A, 0x0A, 0x7B, 0x09, 0x99, 0x08, 0x9A, 0x08,
-	0x95, 0x08, 0x7F, 0x07, 0x87, 0x06, 0x72, 0x06, 0x67, 0x06, 0xC8, 0x05,
-	0x1B, 0x05, 0x0F, 0x05, 0x70, 0x05, 0x14, 0x05, 0x03, 0x04, 0x58, 0x03,
-	0x84, 0x03, 0x89, 0x03, 0x29, 0x03, 0x3D, 0x03, 0xD0, 0x03, 0x11, 0x04,
-	0x89, 0x03, 0x6B, 0x03, 0x70, 0x04, 0xD2, 0x05, 0x4A, 0x06, 0x18, 0x06,
-	0x25, 0x06, 0x6A, 0x06, 0x64, 0x06, 0x10, 0x06, 0x36, 0x06, 0x14, 0x07,
-	0xF4, 0x07, 0x99, 0x08, 0xBD, 0x09, 0x53, 0x0B, 0x79, 0x0C, 0xA3, 0x0C,
-	0x08, 0x0C, 0x6D, 0x0B, 0xCB, 0x0A, 0x3D, 0x0A, 0xEC, 0x09, 0x03, 0x0A,
-	0x42, 0x0A, 0xB5, 0x0A, 0x3D, 0x0B, 0x8B, 0x0B, 0xC2, 0x0B, 0xD9, 0x0B,
-	0xE5, 0x0B, 0x7D, 0x0B, 0xAD, 0x0A, 0xE6, 0x09, 0x75, 0x09, 0x6C, 0x09,
-	0xF8, 0x09, 0x65, 0x0A, 0x74, 0x0A, 0x66, 0x0A, 0x73, 0x0A, 0x43, 0x0A,
-	0xD1, 0x09, 0x7A, 0x09, 0xAA, 0x09, 0xB9, 0x09, 0x3C, 0x09, 0xEB, 0x08,
-	0x4B, 0x09, 0xBB, 0x09, 0xBB, 0x09, 0x99, 0x09, 0xA8, 0x09, 0x87, 0x09,
-	0x28, 0x09, 0xB2, 0x08, 0xA1, 0x08, 0xA3, 0x08, 0x8E, 0x08, 0x7E, 0x08,
-	0x92, 0x08, 0xBF, 0x08, 0xAF, 0x08, 0x72, 0x08, 0xEA, 0x07, 0x5D, 0x07,
-	0xC7, 0x06, 0x54, 0x06, 0x1B, 0x06, 0x20, 0x06, 0x2C, 0x06, 0xF9, 0x05,
-	0x95, 0x05, 0x33, 0x05, 0xA9, 0x04, 0x24, 0x04, 0xA0, 0x03, 0x1C, 0x03,
-	0xA5, 0x02, 0xFE, 0x01, 0x33, 0x01, 0x6A, 0x00, 0xB5, 0xFF, 0x40, 0xFF,
-	0xB4, 0xFE, 0xF0, 0xFD, 0xEE, 0xFC, 0x89, 0xFB, 0xF1, 0xF9, 0x67, 0xF8,
-	0xF7, 0xF6, 0x6C, 0xF5, 0xB1, 0xF3, 0x14, 0xF2, 0x6A, 0xF0, 0x85, 0xEE,
-	0xB2, 0xEC, 0x40, 0xEB, 0x05, 0xEA, 0x65, 0xE8, 0x6B, 0xE6, 0x90, 0xE4,
-	0xC9, 0xE2, 0xBC, 0xE0, 0xB2, 0xDE, 0x42, 0xDD, 0xC8, 0xDC, 0xC9, 0xDC,
-	0xBC, 0xDC, 0xA7, 0xDC, 0xB0, 0xDC, 0x03, 0xDD, 0x56, 0xDD, 0x6E, 0xDD,
-	0x73, 0xDD, 0xB8, 0xDD, 0x3E, 0xDE, 0xFD, 0xDE, 0x42, 0xE0, 0xDD, 0xE1,
-	0xAB, 0xE3, 0x3C, 0xE5, 0xF6, 0xE6, 0x16, 0xE9, 0x18, 0xEB, 0xF6, 0xEC,
-	0xE7, 0xEE, 0xB6, 0xF0, 0x1B, 0xF2, 0x8F, 0xF3, 0x92, 0xF5, 0x38, 0xF8,
-	0xB9, 0xFA, 0x13, 0xFD, 0x93, 0xFF, 0xDC, 0x01, 0xF5, 0x03, 0xF2, 0x05,
-	0x7E, 0x07, 0x83, 0x08, 0x90, 0x09, 0xB7, 0x0A, 0x91, 0x0B, 0xDA, 0x0B,
-	0x50, 0x0C, 0x6D, 0x0D, 0x08, 0x0E, 0x16, 0x0E, 0xBA, 0x0E, 0xF5, 0x0F,
-	0x66, 0x10, 0x6A, 0x0F, 0x6F, 0x0E, 0xBA, 0x0E, 0x39, 0x0F, 0x91, 0x0E,
-	0xBA, 0x0D, 0xA6, 0x0D, 0xAB, 0x0D, 0x0A, 0x0D, 0x1E, 0x0C, 0xE3, 0x0B,
-	0x19, 0x0C, 0x77, 0x0B, 0x17, 0x0A, 0x1F, 0x09, 0xBF, 0x08, 0xF7, 0x07,
-	0xCE, 0x06, 0x71, 0x05, 0xAF, 0x04, 0x25, 0x04, 0x67, 0x03, 0xB8, 0x02,
-	0x46, 0x02, 0xBA, 0x01, 0x4C, 0x01, 0x02, 0x01, 0xE0, 0x00, 0xF0, 0x00,
-	0xE0, 0x00, 0xE6, 0x00, 0x60, 0x01, 0x1A, 0x02, 0xA9, 0x02, 0xFF, 0x02,
-	0x2F, 0x03, 0x5D, 0x03, 0x04, 0x04, 0xE7, 0x04, 0xFA, 0x05, 0xF4, 0x06,
-	0xF7, 0x07, 0xA2, 0x08, 0xE7, 0x08, 0xDA, 0x08, 0xC2, 0x08, 0x96, 0x08,
-	0xEC, 0x07, 0xA9, 0x07, 0x3E, 0x08, 0x61, 0x09, 0x32, 0x0A, 0xA5, 0x0A,
-	0xE4, 0x0A, 0xAC, 0x0A, 0xE1, 0x09, 0xF5, 0x08, 0xB7, 0x08, 0x15, 0x09,
-	0x2E, 0x09, 0x20, 0x09, 0x5B, 0x09, 0x0F, 0x0A, 0xB3, 0x0A, 0xD2, 0x0A,
-	0xF2, 0x0A, 0x39, 0x0B, 0x33, 0x0B, 0xB3, 0x0A, 0x65, 0x0A, 0x96, 0x0A,
-	0x33, 0x0B, 0xDA, 0x0B, 0x2D, 0x0C, 0x45, 0x0C, 0x27, 0x0C, 0x90, 0x0B,
-	0xCA, 0x0A, 0x4C, 0x0A, 0x41, 0x0A, 0x49, 0x0A, 0x0B, 0x0A, 0xD0, 0x09,
-	0xE5, 0x09, 0x38, 0x0A, 0x5B, 0x0A, 0x4C, 0x0A, 0x62, 0x0A, 0x64, 0x0A,
-	0x14, 0x0A, 0xBD, 0x09, 0xCD, 0x09, 0xE6, 0x09, 0xCC, 0x09, 0x75, 0x09,
-	0x6C, 0x09, 0xBA, 0x09, 0xD2, 0x09, 0x83, 0x09, 0x22, 0x09, 0x9A, 0x08,
-	0xC1, 0x07, 0xB0, 0x06, 0x0C, 0x06, 0xCF, 0x05, 0xBD, 0x05, 0x3C, 0x05,
-	0xA1, 0x04, 0x0F, 0x04, 0x57, 0x03, 0x77, 0x02, 0xA8, 0x01, 0x1F, 0x01,
-	0xC8, 0x00, 0x26, 0x00, 0x42, 0xFF, 0x8C, 0xFE, 0x09, 0xFE, 0x71, 0xFD,
-	0xC0, 0xFC, 0x1C, 0xFC, 0x7D, 0xFB, 0xB9, 0xFA, 0x65, 0xF9, 0xCC, 0xF7,
-	0x5E, 0xF6, 0x11, 0xF5, 0x96, 0xF3, 0xE7, 0xF1, 0x33, 0xF0, 0x7C, 0xEE,
-	0x86, 0xEC, 0x4A, 0xEA, 0x04, 0xE8, 0xB6, 0xE5, 0x2C, 0xE3, 0x8E, 0xE0,
-	0x04, 0xDE, 0xF5, 0xDB, 0x5D, 0xDA, 0x3E, 0xD9, 0x84, 0xD8, 0xEA, 0xD7,
-	0x9D, 0xD7, 0xAF, 0xD7, 0xF8, 0xD7, 0x65, 0xD8, 0xB6, 0xD8, 0xF9, 0xD8,
-	0x14, 0xD9, 0x68, 0xD9, 0x9F, 0xDA, 0xF9, 0xDC, 0xB1, 0xDF, 0xFD, 0xE1,
-	0x91, 0xE4, 0xBA, 0xE7, 0xB0, 0xEA, 0xB6, 0xEC, 0xAB, 0xEE, 0x5D, 0xF1,
-	0x3B, 0xF4, 0xEE, 0xF5, 0x1A, 0xF7, 0x31, 0xF9, 0xD6, 0xFB, 0xF3, 0xFD,
-	0x9D, 0xFF, 0xA7, 0x01, 0xD9, 0x03, 0x21, 0x05, 0x83, 0x05, 0x4C, 0x06,
-	0xEB, 0x07, 0xA5, 0x09, 0xC0, 0x0A, 0x86, 0x0B, 0x6B, 0x0C, 0x9B, 0x0D,
-	0x86, 0x0E, 0xC8, 0x0E, 0x28, 0x0F, 0xC5, 0x0F, 0xAF, 0x0F, 0x29, 0x0F,
-	0xF8, 0x0E, 0x7E, 0x0F, 0x2B, 0x10, 0x9D, 0x10, 0xCC, 0x10, 0x94, 0x10,
-	0xC9, 0x0F, 0x06, 0x0F, 0xA0, 0x0E, 0xE6, 0x0D, 0xA9, 0x0C, 0x25, 0x0B,
-	0xBA, 0x09, 0xC4, 0x08, 0x05, 0x08, 0x38, 0x07, 0xA8, 0x06, 0x07, 0x06,
-	0xD4, 0x04, 0x37, 0x03, 0x07, 0x02, 0x06, 0x01, 0x10, 0x00, 0xCF, 0xFE,
-	0xCA, 0xFD, 0x57, 0xFD, 0x3D, 0xFD, 0x36, 0xFD, 0x5F, 0xFD, 0xD1, 0xFD,
-	0x47, 0xFE, 0xA8, 0xFE, 0xAB, 0xFE, 0xA2, 0xFE, 0xE4, 0xFE, 0x8B, 0xFF,
-	0x63, 0x00, 0x67, 0x01, 0x91, 0x02, 0xBB, 0x03, 0x94, 0x04, 0x65, 0x05,
-	0x89, 0x06, 0xDF, 0x07, 0x9C, 0x08, 0xD7, 0x08, 0x25, 0x09, 0x8E, 0x09,
-	0x8B, 0x09, 0x54, 0x09, 0x83, 0x09, 0xDD, 0x09, 0x11, 0x0A, 0x08, 0x0A,
-	0x66, 0x0A, 0x30, 0x0B, 0x9A, 0x0B, 0x2A, 0x0B, 0x73, 0x0A, 0x34, 0x0A,
-	0xF1, 0x09, 0x83, 0x09, 0x83, 0x09, 0x1C, 0x0A, 0x9F, 0x0A, 0xD9, 0x0A,
-	0x3C, 0x0B, 0xBC, 0x0B, 0x0C, 0x0C, 0x32, 0x0C, 0x58, 0x0C, 0x2A, 0x0C,
-	0xC2, 0x0B, 0xE3, 0x0B, 0x79, 0x0C, 0xAA, 0x0C, 0x45, 0x0C, 0x28, 0x0C,
-	0x5E, 0x0C, 0x11, 0x0C, 0x1C, 0x0B, 0x90, 0x0A, 0x87, 0x0A, 0x2A, 0x0A,
-	0x7A, 0x09, 0x33, 0x09, 0x5C, 0x09, 0x1F, 0x09, 0xB4, 0x08, 0x84, 0x08,
-	0x78, 0x08, 0x60, 0x08, 0x21, 0x08, 0x0A, 0x08, 0x20, 0x08, 0x30, 0x08,
-	0x3D, 0x08, 0x7A, 0x08, 0xA4, 0x08, 0x84, 0x08, 0x88, 0x08, 0xD8, 0x08,
-	0x10, 0x09, 0xC5, 0x08, 0x3E, 0x08, 0xBC, 0x07, 0x40, 0x07, 0x9C, 0x06,
-	0x0B, 0x06, 0x97, 0x05, 0x27, 0x05, 0x70, 0x04, 0x85, 0x03, 0xBC, 0x02,
-	0xED, 0x01, 0x16, 0x01, 0x49, 0x00, 0x64, 0xFF, 0xAA, 0xFE, 0xE1, 0xFD,
-	0x14, 0xFD, 0x13, 0xFC, 0x01, 0xFB, 0xDC, 0xF9, 0xA6, 0xF8, 0x4B, 0xF7,
-	0xF3, 0xF5, 0x90, 0xF4, 0x34, 0xF3, 0xB3, 0xF1, 0x1B, 0xF0, 0x8A, 0xEE,
-	0xEC, 0xEC, 0x20, 0xEB, 0xFF, 0xE8, 0xAC, 0xE6, 0x3A, 0xE4, 0xB5, 0xE1,
-	0x10, 0xDF, 0x6F, 0xDC, 0x3B, 0xDA, 0xC2, 0xD8, 0xE4, 0xD7, 0x66, 0xD7,
-	0x04, 0xD7, 0x9B, 0xD6, 0x4E, 0xD6, 0x63, 0xD6, 0xCB, 0xD6, 0x22, 0xD7,
-	0x74, 0xD7, 0x85, 0xD8, 0x7A, 0xDA, 0xC7, 0xDC, 0xD7, 0xDE, 0x57, 0xE1,
-	0xA5, 0xE4, 0x04, 0xE8, 0xBC, 0xEA, 0x98, 0xED, 0x02, 0xF1, 0xF9, 0xF3,
-	0xA6, 0xF5, 0x56, 0xF7, 0x0D, 0xFA, 0x18, 0xFD, 0x79, 0xFF, 0x05, 0x01,
-	0x75, 0x02, 0x20, 0x04, 0xE9, 0x05, 0x50, 0x07, 0x75, 0x08, 0xC0, 0x09,
-	0x3F, 0x0B, 0x0D, 0x0C, 0xCC, 0x0B, 0xEB, 0x0B, 0xED, 0x0C, 0xD5, 0x0D,
-	0x66, 0x0D, 0xC4, 0x0C, 0x94, 0x0D, 0x1B, 0x0F, 0x98, 0x0F, 0xA8, 0x0F,
-	0x55, 0x10, 0x75, 0x11, 0xC5, 0x11, 0x50, 0x11, 0xD2, 0x10, 0x00, 0x11,
-	0xB5, 0x10, 0x97, 0x0F, 0x9E, 0x0E, 0x43, 0x0E, 0x0C, 0x0E, 0x0E, 0x0D,
-	0xAE, 0x0B, 0xE7, 0x0A, 0x48, 0x0A, 0xF9, 0x08, 0x2D, 0x07, 0x82, 0x05,
-	0x08, 0x04, 0xAD, 0x02, 0x4F, 0x01, 0x0E, 0x00, 0xEF, 0xFE, 0x9B, 0xFD,
-	0x53, 0xFC, 0xBE, 0xFB, 0x97, 0xFB, 0x5B, 0xFB, 0x49, 0xFB, 0x34, 0xFB,
-	0x4E, 0xFB, 0x62, 0xFB, 0xB2, 0xFB, 0x56, 0xFC, 0x4C, 0xFD, 0xDB, 0xFD,
-	0x09, 0xFE, 0x5F, 0xFE, 0x3A, 0xFF, 0x54, 0x00, 0x82, 0x01, 0xF8, 0x02,
-	0xE4, 0x04, 0xC1, 0x06, 0x01, 0x08, 0x9A, 0x08, 0xD6, 0x08, 0x12, 0x09,
-	0x50, 0x09, 0x88, 0x09, 0xE0, 0x09, 0x65, 0x0A, 0xF1, 0x0A, 0x22, 0x0B,
-	0x2B, 0x0B, 0x31, 0x0B, 0x58, 0x0B, 0x7C, 0x0B, 0x85, 0x0B, 0x32, 0x0B,
-	0xB4, 0x0A, 0x6A, 0x0A, 0x69, 0x0A, 0xDB, 0x0A, 0xA3, 0x0B, 0x5F, 0x0C,
-	0xD1, 0x0C, 0x1E, 0x0D, 0x4E, 0x0D, 0x6D, 0x0D, 0x3D, 0x0D, 0x37, 0x0D,
-	0x7F, 0x0D, 0x99, 0x0D, 0x86, 0x0D, 0xBA, 0x0D, 0x67, 0x0E, 0xEF, 0x0E,
-	0xCD, 0x0E, 0x6C, 0x0E, 0x2C, 0x0E, 0xC1, 0x0D, 0xCB, 0x0C, 0x9A, 0x0B,
-	0xDC, 0x0A, 0x4D, 0x0A, 0x96, 0x09, 0x10, 0x09, 0x07, 0x09, 0x42, 0x09,
-	0x25, 0x09, 0xC0, 0x08, 0x52, 0x08, 0xE2, 0x07, 0x4E, 0x07, 0xD2, 0x06,
-	0xB6, 0x06, 0x2A, 0x07, 0x9B, 0x07, 0xE5, 0x07, 0x0E, 0x08, 0x2B, 0x08,
-	0x49, 0x08, 0x68, 0x08, 0x8D, 0x08, 0x99, 0x08, 0x71, 0x08, 0x22, 0x08,
-	0xAB, 0x07, 0x3D, 0x07, 0xE3, 0x06, 0x67, 0x06, 0xE1, 0x05, 0x47, 0x05,
-	0x70, 0x04, 0x63, 0x03, 0x52, 0x02, 0x3E, 0x01, 0x14, 0x00, 0xD6, 0xFE,
-	0x9D, 0xFD, 0x8D, 0xFC, 0x93, 0xFB, 0x74, 0xFA, 0x0C, 0xF9, 0x8D, 0xF7,
-	0xEA, 0xF5, 0x2B, 0xF4, 0x55, 0xF2, 0x87, 0xF0, 0xDB, 0xEE, 0x3A, 0xED,
-	0x66, 0xEB, 0x8C, 0xE9, 0x7E, 0xE7, 0x85, 0xE5, 0x62, 0xE3, 0xE8, 0xE0,
-	0x3D, 0xDE, 0x72, 0xDB, 0xD8, 0xD8, 0x75, 0xD6, 0xE4, 0xD4, 0x44, 0xD4,
-	0x13, 0xD4, 0xE1, 0xD3, 0xD6, 0xD3, 0x2C, 0xD4, 0x82, 0xD4, 0x59, 0xD4,
-	0x63, 0xD4, 0x8A, 0xD5, 0x83, 0xD7, 0x32, 0xD9, 0x19, 0xDB, 0x45, 0xDE,
-	0x66, 0xE2, 0x3C, 0xE6, 0x4A, 0xE9, 0xF3, 0xEC, 0x29, 0xF1, 0xA8, 0xF4,
-	0xBE, 0xF6, 0xB4, 0xF8, 0xB0, 0xFB, 0xF7, 0xFE, 0x65, 0x01, 0x32, 0x03,
-	0xC6, 0x05, 0x05, 0x09, 0x79, 0x0B, 0x81, 0x0C, 0x36, 0x0D, 0x55, 0x0E,
-	0x26, 0x0F, 0xBE, 0x0E, 0x04, 0x0E, 0x7B, 0x0E, 0x89, 0x0F, 0xBC, 0x0F,
-	0x3E, 0x0F, 0x83, 0x0F, 0x69, 0x10, 0xB9, 0x10, 0x44, 0x10, 0xDD, 0x0F,
-	0x1B, 0x10, 0x56, 0x10, 0x18, 0x10, 0xE7, 0x0F, 0x51, 0x10, 0xC9, 0x10,
-	0xA5, 0x10, 0x3A, 0x10, 0xCB, 0x0F, 0x1F, 0x0F, 0xFE, 0x0D, 0x08, 0x0D,
-	0x47, 0x0C, 0x4D, 0x0B, 0x09, 0x0A, 0xEF, 0x08, 0x10, 0x08, 0x9E, 0x06,
-	0x96, 0x04, 0xD5, 0x02, 0x7A, 0x01, 0xDA, 0xFF, 0xC8, 0xFD, 0x0E, 0xFC,
-	0xF3, 0xFA, 0x20, 0xFA, 0x18, 0xF9, 0x73, 0xF8, 0x63, 0xF8, 0x85, 0xF8,
-	0x77, 0xF8, 0x4B, 0xF8, 0x4F, 0xF8, 0x98, 0xF8, 0x8F, 0xF8, 0x8C, 0xF8,
-	0x09, 0xF9, 0x2C, 0xFA, 0x83, 0xFB, 0xC0, 0xFC, 0x13, 0xFE, 0xB1, 0xFF,
-	0x7A, 0x01, 0xFE, 0x02, 0x2B, 0x04, 0x4B, 0x05, 0x61, 0x06, 0xF4, 0x06,
-	0xDB, 0x06, 0xC7, 0x06, 0x28, 0x07, 0xAB, 0x07, 0x4A, 0x08, 0x69, 0x09,
-	0x23, 0x0B, 0x97, 0x0C, 0x2C, 0x0D, 0x62, 0x0D, 0xB3, 0x0D, 0x82, 0x0D,
-	0xB5, 0x0C, 0xEA, 0x0B, 0x69, 0x0B, 0xF7, 0x0A, 0xD1, 0x0A, 0x54, 0x0B,
-	0x4A, 0x0C, 0x3B, 0x0D, 0x97, 0x0E, 0x3C, 0x10, 0x88, 0x11, 0x8E, 0x11,
-	0xEC, 0x10, 0x59, 0x10, 0xB3, 0x0F, 0xE2, 0x0E, 0x3E, 0x0E, 0x57, 0x0E,
-	0xF2, 0x0E, 0x83, 0x0F, 0xF1, 0x0F, 0x38, 0x10, 0x51, 0x10, 0x02, 0x10,
-	0x43, 0x0F, 0x11, 0x0E, 0xC1, 0x0C, 0x75, 0x0B, 0x37, 0x0A, 0xF4, 0x08,
-	0xE4, 0x07, 0x97, 0x07, 0xB8, 0x07, 0x8D, 0x07, 0x11, 0x07, 0xA3, 0x06,
-	0x72, 0x06, 0x0E, 0x06, 0x8A, 0x05, 0x83, 0x05, 0xEC, 0x05, 0x4E, 0x06,
-	0x63, 0x06, 0x61, 0x06, 0x79, 0x06, 0x6D, 0x06, 0x30, 0x06, 0x12, 0x06,
-	0x65, 0x06, 0xE6, 0x06, 0x3E, 0x07, 0x69, 0x07, 0x6B, 0x07, 0x12, 0x07,
-	0x68, 0x06, 0xB8, 0x05, 0xBB, 0x04, 0x52, 0x03, 0xBA, 0x01, 0x37, 0x00,
-	0xBD, 0xFE, 0x48, 0xFD, 0xF5, 0xFB, 0xF1, 0xFA, 0xF7, 0xF9, 0xC5, 0xF8,
-	0x20, 0xF7, 0x3A, 0xF5, 0xED, 0xF2, 0x38, 0xF0, 0x4E, 0xED, 0xA8, 0xEA,
-	0x7D, 0xE8, 0xAB, 0xE6, 0xD8, 0xE4, 0xBC, 0xE2, 0x8E, 0xE0, 0x55, 0xDE,
-	0xE7, 0xDB, 0x05, 0xD9, 0x14, 0xD6, 0xA8, 0xD3, 0x33, 0xD2, 0x36, 0xD1,
-	0x61, 0xD0, 0x1B, 0xD0, 0xA9, 0xD0, 0x6D, 0xD1, 0xC3, 0xD1, 0x5E, 0xD2,
-	0x0A, 0xD4, 0xF3, 0xD5, 0x38, 0xD7, 0xA9, 0xD8, 0x80, 0xDB, 0x33, 0xDF,
-	0xD4, 0xE2, 0x96, 0xE6, 0xE9, 0xEA, 0x16, 0xEF, 0x1C, 0xF2, 0xE6, 0xF4,
-	0x4A, 0xF8, 0x98, 0xFB, 0x06, 0xFE, 0x9E, 0x00, 0xFF, 0x03, 0x10, 0x07,
-	0xF0, 0x08, 0x8A, 0x0A, 0x89, 0x0C, 0xED, 0x0D, 0x41, 0x0E, 0x86, 0x0E,
-	0x81, 0x0F, 0x24, 0x10, 0xD3, 0x0F, 0x63, 0x0F, 0x0C, 0x10, 0x14, 0x11,
-	0x4A, 0x11, 0x8D, 0x11, 0x72, 0x12, 0xDD, 0x12, 0x17, 0x12, 0x15, 0x11,
-	0xE0, 0x10, 0xCE, 0x10, 0x39, 0x10, 0x03, 0x10, 0xDA, 0x10, 0x8A, 0x11,
-	0x6A, 0x11, 0xFD, 0x10, 0xB1, 0x10, 0x32, 0x10, 0xE8, 0x0E, 0x3A, 0x0D,
-	0x0E, 0x0C, 0xC4, 0x0A, 0xE8, 0x08, 0xDE, 0x06, 0x5B, 0x05, 0x3D, 0x04,
-	0xC9, 0x02, 0x0E, 0x01, 0x7D, 0xFF, 0x14, 0xFE, 0x5C, 0xFC, 0x9A, 0xFA,
-	0x1C, 0xF9, 0x0D, 0xF8, 0x21, 0xF7, 0x40, 0xF6, 0xC6, 0xF5, 0xB7, 0xF5,
-	0xAC, 0xF5, 0xAE, 0xF5, 0xDF, 0xF5, 0x46, 0xF6, 0x05, 0xF7, 0x0E, 0xF8,
-	0x33, 0xF9, 0x41, 0xFA, 0x35, 0xFB, 0x4C, 0xFC, 0x47, 0xFD, 0x47, 0xFE,
-	0x53, 0xFF, 0x64, 0x00, 0x4A, 0x01, 0x16, 0x02, 0x38, 0x03, 0xB2, 0x04,
-	0xD6, 0x05, 0xAA, 0x06, 0xB6, 0x07, 0xCE, 0x08, 0x10, 0x09, 0x8F, 0x08,
-	0x74, 0x08, 0x00, 0x09, 0x1B, 0x09, 0xAC, 0x08, 0xC9, 0x08, 0x12, 0x0A,
-	0xFF, 0x0A, 0xAD, 0x0A, 0x67, 0x0A, 0xFB, 0x0A, 0x66, 0x0B, 0x1F, 0x0B,
-	0x61, 0x0B, 0xB1, 0x0C, 0xD7, 0x0D, 0xFB, 0x0D, 0x58, 0x0E, 0x66, 0x0F,
-	0x16, 0x10, 0xB4, 0x0F, 0xDE, 0x0F, 0x95, 0x11, 0x94, 0x13, 0x82, 0x14,
-	0x57, 0x15, 0xE2, 0x16, 0x16, 0x18, 0xFF, 0x17, 0x30, 0x17, 0xC8, 0x16,
-	0x3A, 0x16, 0x8B, 0x14, 0xA3, 0x12, 0x81, 0x11, 0x1F, 0x11, 0x7B, 0x10,
-	0xA1, 0x0F, 0x03, 0x0F, 0x51, 0x0E, 0xE1, 0x0C, 0xE0, 0x0A, 0x01, 0x09,
-	0x67, 0x07, 0x9B, 0x05, 0xE0, 0x03, 0xD2, 0x02, 0x7D, 0x02, 0x56, 0x02,
-	0x44, 0x02, 0x7A, 0x02, 0x39, 0x03, 0x11, 0x04, 0x9C, 0x04, 0x28, 0x05,
-	0x99, 0x05, 0xD7, 0x05, 0xC6, 0x05, 0xC3, 0x05, 0xF2, 0x05, 0x4C, 0x06,
-	0xCA, 0x06, 0xFD, 0x06, 0x13, 0x07, 0x06, 0x07, 0x82, 0x06, 0x66, 0x05,
-	0x12, 0x04, 0xC5, 0x02, 0x41, 0x01, 0x7D, 0xFF, 0x8B, 0xFD, 0x91, 0xFB,
-	0x34, 0xF9, 0x68, 0xF6, 0x6E, 0xF3, 0x8F, 0xF0, 0x95, 0xED, 0x88, 0xEA,
-	0xA1, 0xE7, 0xE4, 0xE4, 0x4D, 0xE2, 0x6C, 0xDF, 0x37, 0xDC, 0x2F, 0xD9,
-	0x31, 0xD6, 0x0C, 0xD3, 0xE8, 0xCF, 0x46, 0xCD, 0xAA, 0xCB, 0xED, 0xCA,
-	0xF8, 0xCA, 0xF0, 0xCB, 0x87, 0xCD, 0xE2, 0xCE, 0xE6, 0xCF, 0x48, 0xD1,
-	0x3D, 0xD3, 0x37, 0xD5, 0x57, 0xD7, 0x27, 0xDA, 0xFA, 0xDD, 0x3E, 0xE2,
-	0xAE, 0xE6, 0xA7, 0xEB, 0xC7, 0xF0, 0xDD, 0xF4, 0xEA, 0xF7, 0xF9, 0xFA,
-	0x24, 0xFE, 0xEA, 0x00, 0x2A, 0x03, 0x67, 0x05, 0xEC, 0x07, 0x15, 0x0A,
-	0xCE, 0x0B, 0x6C, 0x0D, 0x30, 0x0F, 0x26, 0x10, 0x04, 0x10, 0xF8, 0x0F,
-	0x6A, 0x10, 0x9B, 0x10, 0x32, 0x10, 0x1C, 0x10, 0x9B, 0x10, 0xF6, 0x10,
-	0xB2, 0x10, 0x7D, 0x10, 0xE3, 0x10, 0x33, 0x11, 0x1E, 0x11, 0x2E, 0x11,
-	0xD4, 0x11, 0x30, 0x12, 0x2F, 0x12, 0x58, 0x12, 0xAC, 0x12, 0xCE, 0x12,
-	0x9A, 0x12, 0xF5, 0x11, 0x39, 0x11, 0x23, 0x10, 0xBE, 0x0E, 0x60, 0x0D,
-	0x3F, 0x0C, 0x15, 0x0B, 0xB3, 0x09, 0x02, 0x08, 0x61, 0x06, 0xBC, 0x04,
-	0xBA, 0x02, 0x72, 0x00, 0x2F, 0xFE, 0xF7, 0xFB, 0xE0, 0xF9, 0x02, 0xF8,
-	0xAB, 0xF6, 0xD5, 0xF5, 0x05, 0xF5, 0x50, 0xF4, 0x24, 0xF4, 0x2F, 0xF4,
-	0x37, 0xF4, 0x4D, 0xF4, 0x77, 0xF4, 0x8D, 0xF4, 0xFA, 0xF4, 0xA0, 0xF5,
-	0xBC, 0xF6, 0x48, 0xF8, 0xE9, 0xF9, 0x7F, 0xFB, 0xE6, 0xFC, 0x11, 0xFE,
-	0x55, 0xFF, 0x8B, 0x00, 0x6B, 0x01, 0x12, 0x02, 0xD7, 0x02, 0xC0, 0x03,
-	0x6E, 0x04, 0xE7, 0x04, 0x7D, 0x05, 0x5A, 0x06, 0x03, 0x07, 0x7A, 0x07,
-	0xE8, 0x07, 0x66, 0x08, 0xBE, 0x08, 0xD6, 0x08, 0xFD, 0x08, 0x71, 0x09,
-	0xF0, 0x09, 0x37, 0x0A, 0xDF, 0x0A, 0xA6, 0x0B, 0xF5, 0x0B, 0xC5, 0x0B,
-	0x04, 0x0C, 0xBE, 0x0C, 0x49, 0x0D, 0x35, 0x0D, 0x9F, 0x0D, 0x58, 0x0F,
-	0x81, 0x11, 0x2B, 0x13, 0x56, 0x14, 0x71, 0x15, 0x0D, 0x16, 0xB9, 0x15,
-	0xBA, 0x14, 0xF6, 0x13, 0x4B, 0x13, 0x7B, 0x12, 0xCA, 0x11, 0xE1, 0x11,
-	0x7B, 0x12, 0x3C, 0x13, 0x99, 0x13, 0x9B, 0x13, 0x39, 0x13, 0xDD, 0x11,
-	0xED, 0x0F, 0xBB, 0x0D, 0x95, 0x0B, 0x97, 0x09, 0x47, 0x08, 0xA9, 0x07,
-	0x8E, 0x07, 0xB1, 0x07, 0xDC, 0x07, 0xEB, 0x07, 0xE5, 0x07, 0xBC, 0x07,
-	0x71, 0x07, 0x00, 0x07, 0x57, 0x06, 0xB8, 0x05, 0x4D, 0x05, 0x51, 0x05,
-	0x8E, 0x05, 0x04, 0x06, 0x7C, 0x06, 0xFD, 0x06, 0x9C, 0x07, 0x10, 0x08,
-	0x1A, 0x08, 0xC3, 0x07, 0x5B, 0x07, 0xEA, 0x06, 0x3B, 0x06, 0x4B, 0x05,
-	0x72, 0x04, 0x72, 0x03, 0x1E, 0x02, 0x81, 0x00, 0xD2, 0xFE, 0x3F, 0xFD,
-	0xB7, 0xFB, 0x20, 0xFA, 0x99, 0xF8, 0xF6, 0xF6, 0x0F, 0xF5, 0xED, 0xF2,
-	0x99, 0xF0, 0xB7, 0xED, 0x87, 0xEA, 0x4D, 0xE7, 0x56, 0xE4, 0x70, 0xE1,
-	0x93, 0xDE, 0x59, 0xDB, 0x5B, 0xD8, 0xCD, 0xD5, 0x55, 0xD3, 0xC6, 0xD0,
-	0xD9, 0xCE, 0xBD, 0xCD, 0x01, 0xCD, 0x35, 0xCC, 0xAD, 0xCB, 0xE1, 0xCB,
-	0xDC, 0xCC, 0x5F, 0xCE, 0x2C, 0xD0, 0x58, 0xD2, 0xD1, 0xD4, 0x78, 0xD7,
-	0x7A, 0xDA, 0x3E, 0xDE, 0xB5, 0xE2, 0x54, 0xE7, 0x1E, 0xEC, 0xDA, 0xF0,
-	0x21, 0xF5, 0xE1, 0xF8, 0x5B, 0xFC, 0xD5, 0xFF, 0x33, 0x03, 0xEB, 0x05,
-	0x41, 0x08, 0xDC, 0x0A, 0x3B, 0x0D, 0xF2, 0x0E, 0x3E, 0x10, 0xA4, 0x11,
-	0xAB, 0x12, 0x1D, 0x13, 0x42, 0x13, 0x37, 0x13, 0xA7, 0x12, 0xBD, 0x11,
-	0x24, 0x11, 0xCA, 0x10, 0x62, 0x10, 0x02, 0x10, 0x2F, 0x10, 0x9F, 0x10,
-	0xAA, 0x10, 0x53, 0x10, 0x4E, 0x10, 0x80, 0x10, 0x30, 0x10, 0xCE, 0x0F,
-	0xCC, 0x0F, 0xE8, 0x0F, 0xBA, 0x0F, 0x43, 0x0F, 0x2B, 0x0F, 0x43, 0x0F,
-	0xD3, 0x0E, 0xFC, 0x0D, 0x3A, 0x0D, 0x46, 0x0C, 0xE1, 0x0A, 0x09, 0x09,
-	0x5A, 0x07, 0xB9, 0x05, 0xE3, 0x03, 0xD9, 0x01, 0xF0, 0xFF, 0x18, 0xFE,
-	0x03, 0xFC, 0xDE, 0xF9, 0x00, 0xF8, 0x62, 0xF6, 0xEB, 0xF4, 0xB7, 0xF3,
-	0xFA, 0xF2, 0x84, 0xF2, 0xF6, 0xF1, 0x91, 0xF1, 0x9B, 0xF1, 0xC2, 0xF1,
-	0xEA, 0xF1, 0x59, 0xF2, 0x38, 0xF3, 0x8B, 0xF4, 0xE2, 0xF5, 0x57, 0xF7,
-	0x20, 0xF9, 0x04, 0xFB, 0xC2, 0xFC, 0x63, 0xFE, 0x18, 0x00, 0x8B, 0x01,
-	0xBF, 0x02, 0xB7, 0x03, 0xAB, 0x04, 0x70, 0x05, 0x16, 0x06, 0xF1, 0x06,
-	0xCC, 0x07, 0x69, 0x08, 0xAD, 0x08, 0xF7, 0x08, 0x29, 0x09, 0xF1, 0x08,
-	0x66, 0x08, 0x17, 0x08, 0x41, 0x08, 0x69, 0x08, 0xBC, 0x08, 0x23, 0x09,
-	0x53, 0x09, 0x73, 0x09, 0xED, 0x09, 0x9C, 0x0A, 0xF5, 0x0A, 0x87, 0x0B,
-	0x57, 0x0D, 0xDE, 0x0F, 0xE7, 0x11, 0x2A, 0x13, 0x64, 0x14, 0x6A, 0x15,
-	0x84, 0x15, 0xEE, 0x14, 0xC5, 0x14, 0x0D, 0x15, 0xF9, 0x14, 0xCF, 0x14,
-	0x08, 0x15, 0x71, 0x15, 0x58, 0x15, 0x9E, 0x14, 0xB9, 0x13, 0x68, 0x12,
-	0x39, 0x10, 0xE3, 0x0D, 0x2F, 0x0C, 0xB3, 0x0A, 0x12, 0x09, 0xC4, 0x07,
-	0x22, 0x07, 0xAB, 0x06, 0xA0, 0x05, 0xBC, 0x04, 0x65, 0x04, 0x25, 0x04,
-	0xC9, 0x03, 0xB2, 0x03, 0x22, 0x04, 0xA3, 0x04, 0xDE, 0x04, 0x2C, 0x05,
-	0xCC, 0x05, 0x72, 0x06, 0xD9, 0x06, 0x7F, 0x07, 0x6D, 0x08, 0x37, 0x09,
-	0xCA, 0x09, 0x1B, 0x0A, 0x21, 0x0A, 0xF0, 0x09, 0x78, 0x09, 0xDB, 0x08,
-	0x3B, 0x08, 0x57, 0x07, 0x36, 0x06, 0xED, 0x04, 0x49, 0x03, 0x53, 0x01,
-	0x51, 0xFF, 0x83, 0xFD, 0xD1, 0xFB, 0x12, 0xFA, 0x3A, 0xF8, 0x54, 0xF6,
-	0x77, 0xF4, 0x68, 0xF2, 0x09, 0xF0, 0xAD, 0xED, 0x57, 0xEB, 0xE8, 0xE8,
-	0x7D, 0xE6, 0x42, 0xE4, 0x25, 0xE2, 0x2E, 0xE0, 0x1E, 0xDE, 0xE3, 0xDB,
-	0x64, 0xD9, 0xA0, 0xD6, 0xDA, 0xD3, 0x48, 0xD1, 0x2E, 0xCF, 0xE7, 0xCD,
-	0xD8, 0xCD, 0x74, 0xCE, 0x24, 0xCF, 0x9C, 0xCF, 0x9E, 0xD0, 0x56, 0xD2,
-	0xB1, 0xD3, 0x5D, 0xD4, 0xAC, 0xD5, 0x42, 0xD8, 0xCF, 0xDB, 0x8D, 0xDF,
-	0xF6, 0xE3, 0x1D, 0xE9, 0xF6, 0xED, 0xC0, 0xF1, 0x3C, 0xF5, 0x56, 0xF9,
-	0x87, 0xFD, 0xFC, 0x00, 0x19, 0x04, 0x76, 0x07, 0xB6, 0x0A, 0x90, 0x0D,
-	0xFF, 0x0F, 0x20, 0x12, 0xA0, 0x13, 0x48, 0x14, 0xC4, 0x14, 0x69, 0x15,
-	0x25, 0x16, 0x66, 0x16, 0x48, 0x16, 0x43, 0x16, 0x17, 0x16, 0x62, 0x15,
-	0x58, 0x14, 0x4C, 0x13, 0x27, 0x12, 0x27, 0x11, 0x5B, 0x10, 0xD4, 0x0F,
-	0x81, 0x0F, 0x3A, 0x0F, 0xEF, 0x0E, 0x79, 0x0E, 0x0A, 0x0E, 0xD2, 0x0D,
-	0x78, 0x0D, 0xB8, 0x0C, 0xDF, 0x0B, 0x61, 0x0B, 0xCD, 0x0A, 0xD5, 0x09,
-	0xF6, 0x08, 0x56, 0x08, 0x71, 0x07, 0x53, 0x06, 0x74, 0x05, 0xC5, 0x04,
-	0xB5, 0x03, 0xEB, 0x01, 0xDE, 0xFF, 0x03, 0xFE, 0x32, 0xFC, 0x6B, 0xFA,
-	0xE5, 0xF8, 0xA6, 0xF7, 0x76, 0xF6, 0x66, 0xF5, 0x99, 0xF4, 0x27, 0xF4,
-	0xB6, 0xF3, 0x34, 0xF3, 0xAF, 0xF2, 0x71, 0xF2, 0x6B, 0xF2, 0x9C, 0xF2,
-	0x33, 0xF3, 0x46, 0xF4, 0x98, 0xF5, 0xAE, 0xF6, 0xCF, 0xF7, 0x65, 0xF9,
-	0x2B, 0xFB, 0x9F, 0xFC, 0xED, 0xFD, 0x8B, 0xFF, 0x59, 0x01, 0xF8, 0x02,
-	0x68, 0x04, 0xBB, 0x05, 0xDB, 0x06, 0xD2, 0x07, 0x8D, 0x08, 0x23, 0x09,
-	0x92, 0x09, 0xE7, 0x09, 0x48, 0x0A, 0xDB, 0x0A, 0x63, 0x0B, 0xA7, 0x0B,
-	0xA2, 0x0B, 0x6F, 0x0B, 0x04, 0x0B, 0x46, 0x0A, 0x86, 0x09, 0x0A, 0x09,
-	0xD3, 0x08, 0xC9, 0x08, 0x1F, 0x09, 0xD9, 0x09, 0x95, 0x0A, 0x1B, 0x0B,
-	0x72, 0x0B, 0x88, 0x0B, 0x41, 0x0B, 0x05, 0x0B, 0x64, 0x0B, 0x2D, 0x0C,
-	0xDF, 0x0C, 0xD5, 0x0D, 0x31, 0x0F, 0x1C, 0x11, 0xEB, 0x12, 0xB7, 0x14,
-	0x5B, 0x16, 0x61, 0x17, 0x8F, 0x17, 0x4D, 0x17, 0x26, 0x17, 0x17, 0x17,
-	0xDF, 0x16, 0xDB, 0x16, 0xFD, 0x16, 0x04, 0x17, 0xAD, 0x16, 0xE7, 0x15,
-	0x1C, 0x15, 0x0F, 0x14, 0x68, 0x12, 0x7F, 0x10, 0x96, 0x0E, 0xBD, 0x0C,
-	0xA5, 0x0A, 0x89, 0x08, 0xFB, 0x06, 0xDD, 0x05, 0xB6, 0x04, 0xAC, 0x03,
-	0xDF, 0x02, 0x05, 0x02, 0xF0, 0x00, 0x12, 0x00, 0x94, 0xFF, 0x44, 0xFF,
-	0xE0, 0xFE, 0xA3, 0xFE, 0xB4, 0xFE, 0xE0, 0xFE, 0xBF, 0xFE, 0x8F, 0xFE,
-	0x7E, 0xFE, 0x77, 0xFE, 0x63, 0xFE, 0x67, 0xFE, 0x50, 0xFE, 0x18, 0xFE,
-	0x8A, 0xFD, 0xBB, 0xFC, 0x8D, 0xFB, 0x08, 0xFA, 0x47, 0xF8, 0x5C, 0xF6,
-	0x1A, 0xF4, 0x94, 0xF1, 0xFC, 0xEE, 0x24, 0xEC, 0x1C, 0xE9, 0x19, 0xE6,
-	0xB8, 0xE2, 0xF7, 0xDE, 0xD4, 0xDA, 0x36, 0xD6, 0x7C, 0xD1, 0xF3, 0xCC,
-	0x38, 0xC9, 0xC0, 0xC6, 0xD4, 0xC5, 0xA1, 0xC5, 0x86, 0xC5, 0x9A, 0xC5,
-	0xA1, 0xC6, 0x6E, 0xC8, 0x11, 0xCA, 0xA2, 0xCB, 0x32, 0xCE, 0xBE, 0xD1,
-	0x9E, 0xD5, 0x03, 0xDA, 0x84, 0xDF, 0xF0, 0xE5, 0xEE, 0xEB, 0x99, 0xF1,
-	0xA5, 0xF7, 0xF3, 0xFD, 0xBB, 0x03, 0xA6, 0x08, 0x15, 0x0D, 0xD2, 0x10,
-	0xA7, 0x13, 0xF9, 0x15, 0x88, 0x18, 0xED, 0x1A, 0x28, 0x1C, 0x48, 0x1C,
-	0x48, 0x1C, 0x53, 0x1C, 0xC6, 0x1B, 0xA6, 0x1A, 0x84, 0x19, 0x55, 0x18,
-	0x70, 0x16, 0xEF, 0x13, 0x91, 0x11, 0x9B, 0x0F, 0xC0, 0x0D, 0x05, 0x0C,
-	0xAF, 0x0A, 0xB9, 0x09, 0xE3, 0x08, 0x24, 0x08, 0xB2, 0x07, 0xE3, 0x07,
-	0x7F, 0x08, 0x55, 0x09, 0x42, 0x0A, 0x17, 0x0B, 0x7D, 0x0B, 0x95, 0x0B,
-	0x84, 0x0B, 0x83, 0x0B, 0x84, 0x0B, 0x63, 0x0B, 0x1E, 0x0B, 0x2C, 0x0B,
-	0x3F, 0x0B, 0xB3, 0x0A, 0x9F, 0x09, 0x37, 0x08, 0x25, 0x06, 0x90, 0x03,
-	0xD0, 0x00, 0x5B, 0xFE, 0x05, 0xFC, 0x93, 0xF9, 0x1C, 0xF7, 0x03, 0xF5,
-	0x35, 0xF3, 0xA3, 0xF1, 0x57, 0xF0, 0x2E, 0xEF, 0x20, 0xEE, 0x37, 0xED,
-	0x90, 0xEC, 0x60, 0xEC, 0xCB, 0xEC, 0xB6, 0xED, 0xD0, 0xEE, 0x51, 0xF0,
-	0x34, 0xF2, 0x1C, 0xF4, 0x00, 0xF6, 0x32, 0xF8, 0xEC, 0xFA, 0xA9, 0xFD,
-	0x59, 0x00, 0xF2, 0x02, 0x87, 0x05, 0xBB, 0x07, 0x78, 0x09, 0xE0, 0x0A,
-	0x20, 0x0C, 0x2C, 0x0D, 0x23, 0x0E, 0xE8, 0x0E, 0x5C, 0x0F, 0x8E, 0x0F,
-	0xAE, 0x0F, 0xC3, 0x0F, 0x8F, 0x0F, 0x11, 0x0F, 0x65, 0x0E, 0xB0, 0x0D,
-	0xC1, 0x0C, 0xC9, 0x0B, 0xB5, 0x0A, 0x8D, 0x09, 0xB7, 0x08, 0xAD, 0x08,
-	0xD9, 0x08, 0xEC, 0x08, 0x13, 0x09, 0x95, 0x09, 0x21, 0x0A, 0x93, 0x0A,
-	0x14, 0x0B, 0xCB, 0x0B, 0x9F, 0x0C, 0x3C, 0x0D, 0xED, 0x0D, 0xAC, 0x0E,
-	0x73, 0x0F, 0x29, 0x10, 0xFD, 0x10, 0xAD, 0x11, 0x25, 0x12, 0x71, 0x12,
-	0x8E, 0x12, 0x81, 0x12, 0x07, 0x12, 0x2E, 0x11, 0x4F, 0x10, 0xC5, 0x0F,
-	0x49, 0x0F, 0x90, 0x0E, 0x97, 0x0D, 0xB6, 0x0C, 0xE2, 0x0B, 0x98, 0x0A,
-	0x46, 0x09, 0x64, 0x08, 0xAC, 0x07, 0xC8, 0x06, 0xF1, 0x05, 0x86, 0x05,
-	0x48, 0x05, 0xE9, 0x04, 0xAA, 0x04, 0xD2, 0x04, 0xC6, 0x04, 0x6B, 0x04,
-	0x59, 0x04, 0xAA, 0x04, 0xD8, 0x04, 0xC2, 0x04, 0xEC, 0x04, 0x6E, 0x05,
-	0xAD, 0x05, 0x65, 0x05, 0xE6, 0x04, 0x62, 0x04, 0x9C, 0x03, 0x9B, 0x02,
-	0x8E, 0x01, 0xCA, 0x00, 0xF3, 0xFF, 0xCA, 0xFE, 0x84, 0xFD, 0x2E, 0xFC,
-	0x9F, 0xFA, 0xAC, 0xF8, 0x8E, 0xF6, 0x81, 0xF4, 0x6D, 0xF2, 0x18, 0xF0,
-	0xBA, 0xED, 0x6A, 0xEB, 0x04, 0xE9, 0x4B, 0xE6, 0xBA, 0xE3, 0x50, 0xE1,
-	0x85, 0xDE, 0x55, 0xDB, 0x1B, 0xD8, 0xC7, 0xD4, 0x2A, 0xD1, 0x17, 0xCE,
-	0x51, 0xCC, 0x01, 0xCC, 0x53, 0xCC, 0xAB, 0xCC, 0xFA, 0xCC, 0xD7, 0xCD,
-	0x01, 0xCF, 0xFB, 0xCF, 0xBA, 0xD0, 0x5E, 0xD2, 0x4B, 0xD5, 0xC7, 0xD8,
-	0x5C, 0xDC, 0xA3, 0xE0, 0xDE, 0xE5, 0x35, 0xEB, 0x06, 0xF0, 0xC7, 0xF4,
-	0xB2, 0xF9, 0x1F, 0xFE, 0xE4, 0x01, 0x54, 0x05, 0xB6, 0x08, 0x01, 0x0C,
-	0x66, 0x0F, 0xCE, 0x12, 0x9C, 0x15, 0x31, 0x17, 0xF8, 0x17, 0xC1, 0x18,
-	0x75, 0x19, 0x97, 0x19, 0x57, 0x19, 0x50, 0x19, 0x5E, 0x19, 0xB4, 0x18,
-	0x16, 0x17, 0x72, 0x15, 0x27, 0x14, 0xB7, 0x12, 0xE6, 0x10, 0x9D, 0x0F,
-	0x15, 0x0F, 0x97, 0x0E, 0x95, 0x0D, 0x82, 0x0C, 0xE8, 0x0B, 0x8B, 0x0B,
-	0x32, 0x0B, 0x11, 0x0B, 0xD4, 0x0A, 0x5E, 0x0A, 0xCA, 0x09, 0x4B, 0x09,
-	0xC8, 0x08, 0x42, 0x08, 0xFA, 0x07, 0xD4, 0x07, 0xA6, 0x07, 0x43, 0x07,
-	0x80, 0x06, 0x96, 0x05, 0x98, 0x04, 0x2F, 0x03, 0x63, 0x01, 0xA7, 0xFF,
-	0x38, 0xFE, 0xB3, 0xFC, 0xCE, 0xFA, 0xF7, 0xF8, 0xD4, 0xF7, 0xEF, 0xF6,
-	0xED, 0xF5, 0x0E, 0xF5, 0x67, 0xF4, 0x96, 0xF3, 0x7E, 0xF2, 0x8F, 0xF1,
-	0xFD, 0xF0, 0xF1, 0xF0, 0x66, 0xF1, 0x32, 0xF2, 0x2B, 0xF3, 0x8D, 0xF4,
-	0xF2, 0xF5, 0x49, 0xF7, 0x90, 0xF8, 0xF2, 0xF9, 0x97, 0xFB, 0x51, 0xFD,
-	0x3D, 0xFF, 0x40, 0x01, 0xE7, 0x02, 0x43, 0x04, 0x9D, 0x05, 0xF2, 0x06,
-	0x00, 0x08, 0xF2, 0x08, 0xF5, 0x09, 0x9B, 0x0A, 0xF0, 0x0A, 0x69, 0x0B,
-	0x56, 0x0C, 0x40, 0x0D, 0xD7, 0x0D, 0x79, 0x0E, 0xE4, 0x0E, 0xAC, 0x0E,
-	0x0F, 0x0E, 0x38, 0x0D, 0x9C, 0x0C, 0x37, 0x0C, 0x6C, 0x0C, 0x02, 0x0D,
-	0x68, 0x0D, 0x84, 0x0D, 0x99, 0x0D, 0xD7, 0x0D, 0xD4, 0x0D, 0x6F, 0x0D,
-	0x3F, 0x0D, 0x7C, 0x0D, 0xBE, 0x0D, 0xAA, 0x0D, 0xA3, 0x0D, 0xDF, 0x0D,
-	0x23, 0x0E, 0xFF, 0x0D, 0xC1, 0x0D, 0xE9, 0x0D, 0x3D, 0x0E, 0x3C, 0x0E,
-	0x13, 0x0E, 0x1B, 0x0E, 0x0C, 0x0E, 0xD5, 0x0D, 0xB3, 0x0D, 0xAA, 0x0D,
-	0x48, 0x0D, 0xD3, 0x0C, 0xA9, 0x0C, 0x87, 0x0C, 0x2A, 0x0C, 0x97, 0x0B,
-	0x5E, 0x0B, 0x6D, 0x0B, 0x34, 0x0B, 0x93, 0x0A, 0x19, 0x0A, 0x9F, 0x09,
-	0x26, 0x09, 0x72, 0x08, 0xE5, 0x07, 0xB6, 0x07, 0x69, 0x07, 0xBB, 0x06,
-	0xD6, 0x05, 0x21, 0x05, 0x7E, 0x04, 0xE4, 0x03, 0x64, 0x03, 0x04, 0x03,
-	0x63, 0x02, 0x76, 0x01, 0x7E, 0x00, 0x89, 0xFF, 0x5B, 0xFE, 0x11, 0xFD,
-	0x08, 0xFC, 0x42, 0xFB, 0x5A, 0xFA, 0x61, 0xF9, 0x79, 0xF8, 0x6C, 0xF7,
-	0x22, 0xF6, 0x9F, 0xF4, 0x22, 0xF3, 0x92, 0xF1, 0xF5, 0xEF, 0x40, 0xEE,
-	0x34, 0xEC, 0x0F, 0xEA, 0xE3, 0xE7, 0x88, 0xE5, 0x00, 0xE3, 0x54, 0xE0,
-	0x92, 0xDD, 0x55, 0xDA, 0xBA, 0xD6, 0x69, 0xD3, 0xA8, 0xD0, 0xC0, 0xCE,
-	0x12, 0xCE, 0x47, 0xCE, 0x3A, 0xCE, 0x2D, 0xCE, 0xB6, 0xCE, 0x67, 0xCF,
-	0x79, 0xCF, 0xC7, 0xCF, 0xA0, 0xD1, 0xC9, 0xD4, 0x56, 0xD8, 0x51, 0xDC,
-	0x3F, 0xE1, 0x7E, 0xE6, 0x97, 0xEB, 0xA0, 0xF0, 0xCE, 0xF5, 0xB3, 0xFA,
-	0xF8, 0xFE, 0xDC, 0x02, 0xA1, 0x06, 0xA9, 0x0A, 0xE1, 0x0E, 0xE2, 0x12,
-	0x6F, 0x16, 0x50, 0x19, 0x46, 0x1B, 0x46, 0x1C, 0x21, 0x1D, 0x14, 0x1E,
-	0x41, 0x1E, 0x99, 0x1D, 0xFF, 0x1C, 0xBC, 0x1C, 0xDF, 0x1B, 0xED, 0x19,
-	0xD7, 0x17, 0x08, 0x16, 0xCF, 0x13, 0x5B, 0x11, 0xAA, 0x0F, 0x9A, 0x0E,
-	0x6A, 0x0D, 0xCF, 0x0B, 0x60, 0x0A, 0x66, 0x09, 0x9D, 0x08, 0xD4, 0x07,
-	0x56, 0x07, 0x0F, 0x07, 0xAE, 0x06, 0x2E, 0x06, 0xDF, 0x05, 0xE5, 0x05,
-	0xF1, 0x05, 0xEF, 0x05, 0x0D, 0x06, 0x9F, 0x06, 0xE8, 0x06, 0x9A, 0x06,
-	0x11, 0x06, 0xAE, 0x05, 0xBF, 0x04, 0x3F, 0x03, 0xFB, 0x01, 0xF2, 0x00,
-	0x7A, 0xFF, 0xB1, 0xFD, 0x43, 0xFC, 0x49, 0xFB, 0x34, 0xFA, 0xEF, 0xF8,
-	0xB8, 0xF7, 0x6E, 0xF6, 0xFF, 0xF4, 0x69, 0xF3, 0x0B, 0xF2, 0x21, 0xF1,
-	0xBF, 0xF0, 0xAB, 0xF0, 0xBB, 0xF0, 0x55, 0xF1, 0x70, 0xF2, 0x93, 0xF3,
-	0x89, 0xF4, 0xA6, 0xF5, 0xFD, 0xF6, 0x89, 0xF8, 0x72, 0xFA, 0xAB, 0xFC,
-	0xE8, 0xFE, 0xB9, 0x00, 0xA2, 0x02, 0xAC, 0x04, 0x7D, 0x06, 0x14, 0x08,
-	0xA5, 0x09, 0x0C, 0x0B, 0x23, 0x0C, 0x36, 0x0D, 0x85, 0x0E, 0x9A, 0x0F,
-	0x68, 0x10, 0x0A, 0x11, 0x4B, 0x11, 0x06, 0x11, 0x81, 0x10, 0xDB, 0x0F,
-	0xCB, 0x0E, 0x98, 0x0D, 0xF9, 0x0C, 0x0D, 0x0D, 0x92, 0x0D, 0xF3, 0x0D,
-	0x56, 0x0E, 0x3F, 0x0E, 0x93, 0x0D, 0xA0, 0x0C, 0xFC, 0x0B, 0x8B, 0x0B,
-	0x5C, 0x0B, 0x8E, 0x0B, 0x4D, 0x0C, 0x17, 0x0D, 0xC6, 0x0D, 0x64, 0x0E,
-	0xE2, 0x0E, 0x53, 0x0F, 0x89, 0x0F, 0x94, 0x0F, 0x98, 0x0F, 0xDA, 0x0F,
-	0x25, 0x10, 0x49, 0x10, 0x84, 0x10, 0xCA, 0x10, 0xF9, 0x10, 0xB6, 0x10,
-	0x31, 0x10, 0x72, 0x0F, 0x63, 0x0E, 0x6E, 0x0D, 0xC0, 0x0C, 0x51, 0x0C,
-	0xA6, 0x0B, 0xF5, 0x0A, 0x54, 0x0A, 0x7B, 0x09, 0x41, 0x08, 0x1F, 0x07,
-	0x20, 0x06, 0x41, 0x05, 0x7D, 0x04, 0xED, 0x03, 0x73, 0x03, 0x02, 0x03,
-	0x77, 0x02, 0xFA, 0x01, 0x88, 0x01, 0x3D, 0x01, 0x16, 0x01, 0xCA, 0x00,
-	0x49, 0x00, 0x89, 0xFF, 0xD6, 0xFE, 0x4F, 0xFE, 0xCB, 0xFD, 0x48, 0xFD,
-	0xB9, 0xFC, 0xFA, 0xFB, 0x0C, 0xFB, 0xF4, 0xF9, 0x6A, 0xF8, 0xAF, 0xF6,
-	0xE8, 0xF4, 0xF8, 0xF2, 0xF1, 0xF0, 0xDE, 0xEE, 0x9E, 0xEC, 0x24, 0xEA,
-	0x66, 0xE7, 0x77, 0xE4, 0x5F, 0xE1, 0xE9, 0xDD, 0x1F, 0xDA, 0x4B, 0xD6,
-	0x8F, 0xD2, 0x23, 0xCF, 0xA5, 0xCC, 0x65, 0xCB, 0xFE, 0xCA, 0xDD, 0xCA,
-	0xCA, 0xCA, 0x3F, 0xCB, 0x3F, 0xCC, 0xFE, 0xCC, 0x79, 0xCD, 0x93, 0xCE,
-	0xEE, 0xD0, 0x55, 0xD4, 0x85, 0xD8, 0xC6, 0xDD, 0xB2, 0xE3, 0x9B, 0xE9,
-	0xE3, 0xEE, 0x1D, 0xF4, 0x42, 0xF9, 0xC9, 0xFD, 0x24, 0x02, 0xA4, 0x06,
-	0xF0, 0x0A, 0xC4, 0x0E, 0xB9, 0x12, 0xDD, 0x16, 0x58, 0x1A, 0x63, 0x1C,
-	0x79, 0x1D, 0x59, 0x1E, 0xA9, 0x1E, 0x34, 0x1E, 0x77, 0x1D, 0x04, 0x1D,
-	0x72, 0x1C, 0x59, 0x1B, 0xF9, 0x19, 0x5C, 0x18, 0x61, 0x16, 0xE6, 0x13,
-	0x55, 0x11, 0xFC, 0x0E, 0xE9, 0x0C, 0x54, 0x0B, 0x35, 0x0A, 0x7E, 0x09,
-	0xE2, 0x08, 0x60, 0x08, 0x1D, 0x08, 0xCF, 0x07, 0x73, 0x07, 0xDD, 0x06,
-	0x73, 0x06, 0x6C, 0x06, 0x7F, 0x06, 0x9A, 0x06, 0xF4, 0x06, 0xA8, 0x07,
-	0x28, 0x08, 0x6B, 0x08, 0x85, 0x08, 0x52, 0x08, 0x99, 0x07, 0x5D, 0x06,
-	0xD3, 0x04, 0x3E, 0x03, 0xB6, 0x01, 0x2C, 0x00, 0xBD, 0xFE, 0x4E, 0xFD,
-	0xA7, 0xFB, 0x1F, 0xFA, 0x9D, 0xF8, 0xFE, 0xF6, 0x3B, 0xF5, 0x8D, 0xF3,
-	0xEC, 0xF1, 0x7B, 0xF0, 0x6C, 0xEF, 0xB6, 0xEE, 0x83, 0xEE, 0xAD, 0xEE,
-	0x3A, 0xEF, 0x07, 0xF0, 0x09, 0xF1, 0x3A, 0xF2, 0x95, 0xF3, 0xF7, 0xF4,
-	0x8F, 0xF6, 0x53, 0xF8, 0x50, 0xFA, 0x72, 0xFC, 0xDA, 0xFE, 0x38, 0x01,
-	0x6A, 0x03, 0x78, 0x05, 0x6F, 0x07, 0x0E, 0x09, 0x70, 0x0A, 0xA3, 0x0B,
-	0xA9, 0x0C, 0x93, 0x0D, 0x7F, 0x0E, 0x69, 0x0F, 0xFB, 0x0F, 0x49, 0x10,
-	0x5B, 0x10, 0xEF, 0x0F, 0x11, 0x0F, 0x07, 0x0E, 0x3B, 0x0D, 0x63, 0x0C,
-	0x8F, 0x0B, 0x0B, 0x0B, 0xD7, 0x0A, 0xB2, 0x0A, 0xBB, 0x0A, 0x0B, 0x0B,
-	0x39, 0x0B, 0x22, 0x0B, 0xF5, 0x0A, 0xB8, 0x0A, 0x9D, 0x0A, 0x9E, 0x0A,
-	0xE7, 0x0A, 0xA4, 0x0B, 0xD7, 0x0C, 0x4A, 0x0E, 0xBD, 0x0F, 0xF0, 0x10,
-	0xAB, 0x11, 0x2F, 0x12, 0x66, 0x12, 0x42, 0x12, 0x2C, 0x12, 0x41, 0x12,
-	0x3A, 0x12, 0x24, 0x12, 0x1F, 0x12, 0xF1, 0x11, 0x7E, 0x11, 0xD0, 0x10,
-	0xD1, 0x0F, 0xA5, 0x0E, 0x5B, 0x0D, 0x1A, 0x0C, 0xE1, 0x0A, 0xB2, 0x09,
-	0x6C, 0x08, 0x3E, 0x07, 0x43, 0x06, 0x60, 0x05, 0x56, 0x04, 0x3B, 0x03,
-	0x3B, 0x02, 0x7C, 0x01, 0xDF, 0x00, 0x6D, 0x00, 0x2A, 0x00, 0x24, 0x00,
-	0x19, 0x00, 0xB1, 0xFF, 0x46, 0xFF, 0xF4, 0xFE, 0xB0, 0xFE, 0x61, 0xFE,
-	0x2C, 0xFE, 0x1F, 0xFE, 0x10, 0xFE, 0xAC, 0xFD, 0x20, 0xFD, 0x52, 0xFC,
-	0x3C, 0xFB, 0x0C, 0xFA, 0xEF, 0xF8, 0xB5, 0xF7, 0x30, 0xF6, 0x63, 0xF4,
-	0x56, 0xF2, 0x2E, 0xF0, 0xBA, 0xED, 0xFE, 0xEA, 0x3D, 0xE8, 0x5D, 0xE5,
-	0x26, 0xE2, 0xC4, 0xDE, 0x3B, 0xDB, 0x57, 0xD7, 0x50, 0xD3, 0xC0, 0xCF,
-	0xC6, 0xCC, 0x0F, 0xCB, 0x99, 0xCA, 0x9B, 0xCA, 0x44, 0xCA, 0x30, 0xCA,
-	0xDE, 0xCA, 0xA4, 0xCB, 0x51, 0xCC, 0x8C, 0xCD, 0x1D, 0xD0, 0x5E, 0xD3,
-	0xF7, 0xD6, 0xAC, 0xDB, 0x53, 0xE1, 0x25, 0xE7, 0xD9, 0xEC, 0xD4, 0xF2,
-	0x3A, 0xF8, 0xC0, 0xFC, 0x31, 0x01, 0xBD, 0x05, 0xCC, 0x09, 0xCB, 0x0D,
-	0x27, 0x12, 0x52, 0x16, 0xB8, 0x19, 0x0F, 0x1C, 0x87, 0x1D, 0x6C, 0x1E,
-	0xB8, 0x1E, 0x9B, 0x1E, 0x67, 0x1E, 0x00, 0x1E, 0x41, 0x1D, 0x37, 0x1C,
-	0xA8, 0x1A, 0x9A, 0x18, 0x75, 0x16, 0x1D, 0x14, 0xA2, 0x11, 0x2F, 0x0F,
-	0x3C, 0x0D, 0xF6, 0x0B, 0xF4, 0x0A, 0x94, 0x09, 0x41, 0x08, 0x9C, 0x07,
-	0x72, 0x07, 0x16, 0x07, 0xD1, 0x06, 0xBA, 0x06, 0x7E, 0x06, 0x3A, 0x06,
-	0x16, 0x06, 0x37, 0x06, 0x9A, 0x06, 0x43, 0x07, 0xFF, 0x07, 0x8E, 0x08,
-	0xA5, 0x08, 0x83, 0x08, 0x56, 0x08, 0x9D, 0x07, 0x1F, 0x06, 0x69, 0x04,
-	0x05, 0x03, 0x9F, 0x01, 0x05, 0x00, 0x46, 0xFE, 0xA9, 0xFC, 0x71, 0xFB,
-	0x34, 0xFA, 0xBA, 0xF8, 0xE1, 0xF6, 0x10, 0xF5, 0x31, 0xF3, 0x41, 0xF1,
-	0xA0, 0xEF, 0xB1, 0xEE, 0x67, 0xEE, 0x64, 0xEE, 0xB3, 0xEE, 0x4E, 0xEF,
-	0x03, 0xF0, 0xE6, 0xF0, 0x0A, 0xF2, 0x42, 0xF3, 0x56, 0xF4, 0xF7, 0xF5,
-	0x7A, 0xF8, 0x1F, 0xFB, 0x6C, 0xFD, 0x8A, 0xFF, 0xC4, 0x01, 0x07, 0x04,
-	0x00, 0x06, 0xCB, 0x07, 0x5C, 0x09, 0xE7, 0x0A, 0x6C, 0x0C, 0x8F, 0x0D,
-	0x7B, 0x0E, 0x6B, 0x0F, 0x69, 0x10, 0xFF, 0x10, 0xD1, 0x10, 0x3D, 0x10,
-	0xB5, 0x0F, 0x16, 0x0F, 0x09, 0x0E, 0xFA, 0x0C, 0x4D, 0x0C, 0xCA, 0x0B,
-	0x73, 0x0B, 0x18, 0x0B, 0x9E, 0x0A, 0x55, 0x0A, 0x78, 0x0A, 0xBB, 0x0A,
-	0xCF, 0x0A, 0xB0, 0x0A, 0xAD, 0x0A, 0xFE, 0x0A, 0xBC, 0x0B, 0xC3, 0x0C,
-	0x0D, 0x0E, 0x61, 0x0F, 0x7B, 0x10, 0x67, 0x11, 0x16, 0x12, 0xAF, 0x12,
-	0x64, 0x13, 0xF2, 0x13, 0x10, 0x14, 0x1F, 0x14, 0x6C, 0x14, 0x7F, 0x14,
-	0x27, 0x14, 0xE2, 0x13, 0x70, 0x13, 0x7C, 0x12, 0xF0, 0x10, 0x6D, 0x0F,
-	0x1B, 0x0E, 0xA5, 0x0C, 0x2A, 0x0B, 0xD8, 0x09, 0xC7, 0x08, 0x96, 0x07,
-	0x4B, 0x06, 0x1B, 0x05, 0xCC, 0x03, 0x81, 0x02, 0x6D, 0x01, 0x6C, 0x00,
-	0xA4, 0xFF, 0x20, 0xFF, 0xE0, 0xFE, 0xBC, 0xFE, 0xA5, 0xFE, 0x8D, 0xFE,
-	0x75, 0xFE, 0x6D, 0xFE, 0x7B, 0xFE, 0x75, 0xFE, 0x44, 0xFE, 0x44, 0xFE,
-	0x50, 0xFE, 0x0F, 0xFE, 0x75, 0xFD, 0xDD, 0xFC, 0x71, 0xFC, 0xAE, 0xFB,
-	0x9F, 0xFA, 0x65, 0xF9, 0xF5, 0xF7, 0x25, 0xF6, 0x3E, 0xF4, 0x26, 0xF2,
-	0xD4, 0xEF, 0x43, 0xED, 0x75, 0xEA, 0x41, 0xE7, 0xC5, 0xE3, 0x2C, 0xE0,
-	0x75, 0xDC, 0x88, 0xD8, 0x93, 0xD4, 0x0A, 0xD1, 0x26, 0xCE, 0xF8, 0xCB,
-	0xB2, 0xCA, 0x4B, 0xCA, 0x1A, 0xCA, 0xF8, 0xC9, 0x46, 0xCA, 0x13, 0xCB,
-	0xE2, 0xCB, 0xB3, 0xCC, 0x73, 0xCE, 0x7A, 0xD1, 0x94, 0xD5, 0x66, 0xDA,
-	0xC4, 0xDF, 0x9F, 0xE5, 0x81, 0xEB, 0x2C, 0xF1, 0xA1, 0xF6, 0x97, 0xFB,
-	0x44, 0x00, 0xD8, 0x04, 0x83, 0x09, 0xE1, 0x0D, 0xDB, 0x11, 0x89, 0x15,
-	0x05, 0x19, 0x0C, 0x1C, 0x15, 0x1E, 0x21, 0x1F, 0xB8, 0x1F, 0x0F, 0x20,
-	0xDF, 0x1F, 0x43, 0x1F, 0x5E, 0x1E, 0x63, 0x1D, 0x00, 0x1C, 0xE8, 0x19,
-	0x42, 0x17, 0x98, 0x14, 0x56, 0x12, 0x4B, 0x10, 0x18, 0x0E, 0x32, 0x0C,
-	0xC9, 0x0A, 0xA9, 0x09, 0x9D, 0x08, 0xA2, 0x07, 0x00, 0x07, 0x6A, 0x06,
-	0xE4, 0x05, 0xB9, 0x05, 0xB1, 0x05, 0x88, 0x05, 0x75, 0x05, 0x02, 0x06,
-	0xAC, 0x06, 0xEE, 0x06, 0x58, 0x07, 0x4B, 0x08, 0x0D, 0x09, 0xF5, 0x08,
-	0x60, 0x08, 0xF4, 0x07, 0x24, 0x07, 0xAF, 0x05, 0x25, 0x04, 0xBF, 0x02,
-	0x52, 0x01, 0xBC, 0xFF, 0x54, 0xFE, 0xE0, 0xFC, 0x29, 0xFB, 0x82, 0xF9,
-	0xAD, 0xF7, 0xD0, 0xF5, 0xF2, 0xF3, 0x2B, 0xF2, 0x8C, 0xF0, 0x3F, 0xEF,
-	0x71, 0xEE, 0xE9, 0xED, 0xC4, 0xED, 0x33, 0xEE, 0xE9, 0xEE, 0x9A, 0xEF,
-	0x3D, 0xF0, 0x69, 0xF1, 0x27, 0xF3, 0xCE, 0xF4, 0x96, 0xF6, 0xBD, 0xF8,
-	0x48, 0xFB, 0xAA, 0xFD, 0xC0, 0xFF, 0xFA, 0x01, 0x58, 0x04, 0x5C, 0x06,
-	0x1E, 0x08, 0xF0, 0x09, 0x8B, 0x0B, 0xFD, 0x0C, 0x63, 0x0E, 0xB7, 0x0F,
-	0x99, 0x10, 0x26, 0x11, 0x70, 0x11, 0x86, 0x11, 0x42, 0x11, 0xCA, 0x10,
-	0x6E, 0x10, 0x1D, 0x10, 0xD1, 0x0F, 0x69, 0x0F, 0xBA, 0x0E, 0x03, 0x0E,
-	0xCB, 0x0D, 0x7A, 0x0D, 0x8A, 0x0C, 0xBD, 0x0B, 0x75, 0x0B, 0xE8, 0x0A,
-	0x0D, 0x0A, 0xD4, 0x09, 0x78, 0x0A, 0x13, 0x0B, 0x7E, 0x0B, 0x3D, 0x0C,
-	0x0E, 0x0D, 0x37, 0x0D, 0x3A, 0x0D, 0xBF, 0x0D, 0x30, 0x0E, 0x4D, 0x0E,
-	0xE4, 0x0E, 0xD8, 0x0F, 0x8A, 0x10, 0xD2, 0x10, 0x4C, 0x11, 0xDB, 0x11,
-	0x11, 0x12, 0xD3, 0x11, 0x52, 0x11, 0xB6, 0x10, 0xF5, 0x0F, 0xEB, 0x0E,
-	0xFD, 0x0D, 0x38, 0x0D, 0x91, 0x0C, 0xB1, 0x0B, 0xAE, 0x0A, 0x8F, 0x09,
-	0x75, 0x08, 0x12, 0x07, 0x94, 0x05, 0x86, 0x04, 0x84, 0x03, 0x5A, 0x02,
-	0x6F, 0x01, 0xB5, 0x00, 0xC1, 0xFF, 0x90, 0xFE, 0xB5, 0xFD, 0x33, 0xFD,
-	0x9F, 0xFC, 0x2A, 0xFC, 0xD8, 0xFB, 0x99, 0xFB, 0x2C, 0xFB, 0xA4, 0xFA,
-	0x00, 0xFA, 0x5F, 0xF9, 0xA8, 0xF8, 0xF3, 0xF7, 0x0B, 0xF7, 0x28, 0xF6,
-	0x3C, 0xF5, 0x2B, 0xF4, 0xF4, 0xF2, 0xAD, 0xF1, 0x2A, 0xF0, 0x5F, 0xEE,
-	0x5F, 0xEC, 0x2B, 0xEA, 0x71, 0xE7, 0x31, 0xE4, 0xDD, 0xE0, 0x5D, 0xDD,
-	0xDD, 0xD9, 0x9E, 0xD6, 0xC4, 0xD3, 0x7E, 0xD1, 0xF9, 0xCF, 0x2D, 0xCF,
-	0x6F, 0xCE, 0x97, 0xCD, 0x43, 0xCD, 0xA1, 0xCD, 0xD5, 0xCD, 0xEC, 0xCD,
-	0xBD, 0xCE, 0xAC, 0xD0, 0x9F, 0xD3, 0x53, 0xD7, 0xBC, 0xDB, 0xA5, 0xE0,
-	0xCB, 0xE5, 0xD2, 0xEA, 0xC2, 0xEF, 0xA0, 0xF4, 0x7B, 0xF9, 0x77, 0xFE,
-	0x5F, 0x03, 0xEB, 0x07, 0x2C, 0x0C, 0x56, 0x10, 0x5C, 0x14, 0x08, 0x18,
-	0xAC, 0x1A, 0x5E, 0x1C, 0xFA, 0x1D, 0xC8, 0x1F, 0xDC, 0x20, 0x06, 0x21,
-	0x19, 0x21, 0x28, 0x21, 0x04, 0x20, 0xA7, 0x1D, 0x62, 0x1B, 0x70, 0x19,
-	0xE6, 0x16, 0x41, 0x14, 0x57, 0x12, 0xAE, 0x10, 0xC1, 0x0E, 0xDC, 0x0C,
-	0x6A, 0x0B, 0xCD, 0x09, 0xF5, 0x07, 0x99, 0x06, 0xB7, 0x05, 0x97, 0x04,
-	0x76, 0x03, 0x09, 0x03, 0xF3, 0x02, 0xB8, 0x02, 0xAA, 0x02, 0x15, 0x03,
-	0xB2, 0x03, 0x55, 0x04, 0xCF, 0x04, 0x34, 0x05, 0x6C, 0x05, 0x7B, 0x05,
-	0xFE, 0x04, 0x08, 0x04, 0x29, 0x03, 0x8A, 0x02, 0x96, 0x01, 0x85, 0x00,
-	0xB1, 0xFF, 0xE2, 0xFE, 0xD0, 0xFD, 0x80, 0xFC, 0x50, 0xFB, 0xBF, 0xF9,
-	0xC3, 0xF7, 0xC6, 0xF5, 0x36, 0xF4, 0xC9, 0xF2, 0x85, 0xF1, 0xD6, 0xF0,
-	0x82, 0xF0, 0x31, 0xF0, 0xF9, 0xEF, 0xFA, 0xEF, 0x7E, 0xF0, 0x20, 0xF1,
-	0xD6, 0xF1, 0xD7, 0xF2, 0x4E, 0xF4, 0xFB, 0xF5, 0xD4, 0xF7, 0xC8, 0xF9,
-	0xDD, 0xFB, 0xE3, 0xFD, 0xCA, 0xFF, 0xEB, 0x01, 0x2A, 0x04, 0x59, 0x06,
-	0x63, 0x08, 0x59, 0x0A, 0x1C, 0x0C, 0x86, 0x0D, 0xE1, 0x0E, 0x23, 0x10,
-	0xE5, 0x10, 0x1B, 0x11, 0x25, 0x11, 0x49, 0x11, 0x53, 0x11, 0x2D, 0x11,
-	0x00, 0x11, 0xE1, 0x10, 0xC6, 0x10, 0x8A, 0x10, 0x42, 0x10, 0xC7, 0x0F,
-	0x2D, 0x0F, 0x30, 0x0E, 0xFD, 0x0C, 0x37, 0x0C, 0x77, 0x0C, 0x5D, 0x0D,
-	0x2B, 0x0E, 0x60, 0x0E, 0x49, 0x0E, 0x26, 0x0E, 0x05, 0x0E, 0xDA, 0x0D,
-	0xBF, 0x0D, 0xBB, 0x0D, 0x40, 0x0E, 0xEF, 0x0E, 0x77, 0x0F, 0xFE, 0x0F,
-	0xB6, 0x10, 0x34, 0x11, 0x4C, 0x11, 0x00, 0x11, 0x7D, 0x10, 0xD0, 0x0F,
-	0x21, 0x0F, 0x40, 0x0E, 0x68, 0x0D, 0xD9, 0x0C, 0xB1, 0x0C, 0x5A, 0x0C,
-	0x7B, 0x0B, 0x42, 0x0A, 0x12, 0x09, 0x0E, 0x08, 0xD7, 0x06, 0x90, 0x05,
-	0x8C, 0x04, 0xB4, 0x03, 0xC0, 0x02, 0xD9, 0x01, 0xF7, 0x00, 0x2D, 0x00,
-	0x8B, 0xFF, 0xDF, 0xFE, 0x58, 0xFE, 0xFE, 0xFD, 0xD6, 0xFD, 0xA5, 0xFD,
-	0x14, 0xFD, 0x60, 0xFC, 0xDC, 0xFB, 0x95, 0xFB, 0x56, 0xFB, 0xFA, 0xFA,
-	0x94, 0xFA, 0xD9, 0xF9, 0xF5, 0xF8, 0xE9, 0xF7, 0xCC, 0xF6, 0x9E, 0xF5,
-	0x82, 0xF4, 0x43, 0xF3, 0xAF, 0xF1, 0xC5, 0xEF, 0xAF, 0xED, 0x7F, 0xEB,
-	0xCC, 0xE8, 0xA9, 0xE5, 0x5C, 0xE2, 0x2B, 0xDF, 0xF2, 0xDB, 0x6E, 0xD8,
-	0xDF, 0xD4, 0xFE, 0xD1, 0x37, 0xD0, 0x5F, 0xCF, 0xE9, 0xCE, 0x70, 0xCE,
-	0x03, 0xCE, 0xE9, 0xCD, 0x15, 0xCE, 0x12, 0xCE, 0x32, 0xCE, 0x9F, 0xCF,
-	0x95, 0xD2, 0x50, 0xD6, 0x6E, 0xDA, 0x38, 0xDF, 0x8B, 0xE4, 0xB4, 0xE9,
-	0x84, 0xEE, 0xFC, 0xF2, 0x40, 0xF7, 0xF7, 0xFB, 0x22, 0x01, 0xDA, 0x05,
-	0xEE, 0x09, 0x25, 0x0E, 0xCC, 0x12, 0xD9, 0x16, 0xC6, 0x19, 0xD6, 0x1B,
-	0x69, 0x1D, 0xB6, 0x1E, 0xBE, 0x1F, 0x39, 0x20, 0xF5, 0x1F, 0xD0, 0x1F,
-	0xEF, 0x1F, 0x21, 0x1F, 0xF7, 0x1C, 0xAD, 0x1A, 0xAF, 0x18, 0x3C, 0x16,
-	0x82, 0x13, 0x47, 0x11, 0x95, 0x0F, 0x0D, 0x0E, 0xBB, 0x0C, 0x1E, 0x0B,
-	0x23, 0x09, 0x6D, 0x07, 0x5A, 0x06, 0x47, 0x05, 0x0C, 0x04, 0x2F, 0x03,
-	0xE2, 0x02, 0xEB, 0x02, 0xD4, 0x02, 0xCC, 0x02, 0xF0, 0x02, 0x60, 0x03,
-	0x0C, 0x04, 0x62, 0x04, 0x46, 0x04, 0x4E, 0x04, 0x7A, 0x04, 0x03, 0x04,
-	0x18, 0x03, 0x59, 0x02, 0x08, 0x02, 0x6A, 0x01, 0x98, 0x00, 0x98, 0xFF,
-	0x8F, 0xFE, 0x8A, 0xFD, 0x5F, 0xFC, 0x13, 0xFB, 0x88, 0xF9, 0x03, 0xF8,
-	0xAF, 0xF6, 0x5A, 0xF5, 0xF5, 0xF3, 0xCB, 0xF2, 0x19, 0xF2, 0xD0, 0xF1,
-	0xA9, 0xF1, 0x9E, 0xF1, 0xBC, 0xF1, 0x43, 0xF2, 0xFC, 0xF2, 0x98, 0xF3,
-	0x51, 0xF4, 0xCF, 0xF5, 0x91, 0xF7, 0x4E, 0xF9, 0x0D, 0xFB, 0xEE, 0xFC,
-	0xDB, 0xFE, 0xE7, 0x00, 0xF0, 0x02, 0xD7, 0x04, 0xB2, 0x06, 0xA8, 0x08,
-	0x6D, 0x0A, 0xBB, 0x0B, 0xD8, 0x0C, 0x33, 0x0E, 0x5B, 0x0F, 0xEE, 0x0F,
-	0x5A, 0x10, 0xFE, 0x10, 0x7F, 0x11, 0x91, 0x11, 0xAB, 0x11, 0xA4, 0x11,
-	0x89, 0x11, 0xBA, 0x11, 0xF0, 0x11, 0x64, 0x11, 0x6C, 0x10, 0x99, 0x0F,
-	0x06, 0x0F, 0x37, 0x0E, 0x9A, 0x0D, 0xAE, 0x0D, 0x4D, 0x0E, 0xEE, 0x0E,
-	0x3B, 0x0F, 0x4B, 0x0F, 0x15, 0x0F, 0xB7, 0x0E, 0x11, 0x0E, 0x56, 0x0D,
-	0x09, 0x0D, 0x86, 0x0D, 0x52, 0x0E, 0x02, 0x0F, 0xA3, 0x0F, 0x4F, 0x10,
-	0xBC, 0x10, 0xFA, 0x10, 0xE6, 0x10, 0x44, 0x10, 0x62, 0x0F, 0xC4, 0x0E,
-	0x3E, 0x0E, 0x97, 0x0D, 0x06, 0x0D, 0xEE, 0x0C, 0xCC, 0x0C, 0x30, 0x0C,
-	0x41, 0x0B, 0x38, 0x0A, 0x1B, 0x09, 0xD0, 0x07, 0x76, 0x06, 0x52, 0x05,
-	0x60, 0x04, 0x98, 0x03, 0xBB, 0x02, 0xC9, 0x01, 0xBF, 0x00, 0xD7, 0xFF,
-	0x09, 0xFF, 0x47, 0xFE, 0x8F, 0xFD, 0xFF, 0xFC, 0x93, 0xFC, 0x2B, 0xFC,
-	0xAB, 0xFB, 0x0C, 0xFB, 0x4F, 0xFA, 0xA4, 0xF9, 0xEB, 0xF8, 0xFC, 0xF7,
-	0xF4, 0xF6, 0xF5, 0xF5, 0x35, 0xF5, 0x2C, 0xF4, 0x0D, 0xF3, 0xF8, 0xF1,
-	0xE3, 0xF0, 0x70, 0xEF, 0x88, 0xED, 0x39, 0xEB, 0x8A, 0xE8, 0x83, 0xE5,
-	0x77, 0xE2, 0x63, 0xDF, 0x35, 0xDC, 0x22, 0xD9, 0x56, 0xD6, 0xEA, 0xD3,
-	0xF2, 0xD1, 0xE8, 0xD0, 0x81, 0xD0, 0xFE, 0xCF, 0x92, 0xCF, 0x95, 0xCF,
-	0xBE, 0xCF, 0x76, 0xCF, 0x76, 0xCF, 0xAC, 0xD0, 0x12, 0xD3, 0x2B, 0xD6,
-	0x24, 0xDA, 0xF8, 0xDE, 0x00, 0xE4, 0xFB, 0xE8, 0xD9, 0xED, 0x67, 0xF2,
-	0x81, 0xF6, 0xDD, 0xFA, 0x99, 0xFF, 0xF8, 0x03, 0xE6, 0x07, 0x1C, 0x0C,
-	0x98, 0x10, 0x99, 0x14, 0xD3, 0x17, 0x52, 0x1A, 0x69, 0x1C, 0x17, 0x1E,
-	0x5E, 0x1F, 0xEA, 0x1F, 0xEA, 0x1F, 0x00, 0x20, 0xCF, 0x1F, 0xCD, 0x1E,
-	0xE7, 0x1C, 0xC2, 0x1A, 0xCB, 0x18, 0xCA, 0x16, 0x75, 0x14, 0x2D, 0x12,
-	0x59, 0x10, 0xFD, 0x0E, 0x94, 0x0D, 0xD1, 0x0B, 0xCA, 0x09, 0xF8, 0x07,
-	0x7E, 0x06, 0x0C, 0x05, 0x74, 0x03, 0x51, 0x02, 0xC3, 0x01, 0xDB, 0x01,
-	0xE1, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x95, 0x02, 0x1D, 0x03, 0x39, 0x03,
-	0x0C, 0x03, 0xDB, 0x02, 0xB3, 0x02, 0x5B, 0x02, 0x8E, 0x01, 0xBC, 0x00,
-	0x76, 0x00, 0x4A, 0x00, 0xCA, 0xFF, 0xEF, 0xFE, 0x39, 0xFE, 0x74, 0xFD,
-	0x8A, 0xFC, 0x39, 0xFB, 0xC8, 0xF9, 0x47, 0xF8, 0xEB, 0xF6, 0xA6, 0xF5,
-	0x67, 0xF4, 0x3B, 0xF3, 0x77, 0xF2, 0x54, 0xF2, 0x46, 0xF2, 0x2C, 0xF2,
-	0x4A, 0xF2, 0xC8, 0xF2, 0x96, 0xF3, 0x3C, 0xF4, 0xCD, 0xF4, 0xC5, 0xF5,
-	0x24, 0xF7, 0xBB, 0xF8, 0x59, 0xFA, 0xFC, 0xFB, 0xEC, 0xFD, 0x28, 0x00,
-	0x2C, 0x02, 0xFA, 0x03, 0xD4, 0x05, 0xEB, 0x07, 0xD8, 0x09, 0x50, 0x0B,
-	0x63, 0x0C, 0x67, 0x0D, 0x80, 0x0E, 0x8A, 0x0F, 0x58, 0x10, 0xC3, 0x10,
-	0xBE, 0x10, 0xE3, 0x10, 0xDA, 0x10, 0x55, 0x10, 0xA6, 0x0F, 0x63, 0x0F,
-	0x6F, 0x0F, 0x4C, 0x0F, 0x27, 0x0F, 0x4E, 0x0F, 0x6B, 0x0F, 0x33, 0x0F,
-	0xBF, 0x0E, 0x7A, 0x0E, 0x6B, 0x0E, 0x6D, 0x0E, 0x92, 0x0E, 0x8E, 0x0E,
-	0x94, 0x0E, 0x09, 0x0F, 0xCC, 0x0F, 0x51, 0x10, 0xA6, 0x10, 0x17, 0x11,
-	0x71, 0x11, 0xA8, 0x11, 0xB7, 0x11, 0xB7, 0x11, 0x86, 0x11, 0x63, 0x11,
-	0x0D, 0x11, 0x71, 0x10, 0xA8, 0x0F, 0x1B, 0x0F, 0x84, 0x0E, 0x98, 0x0D,
-	0x9A, 0x0C, 0xF6, 0x0B, 0x58, 0x0B, 0x3E, 0x0A, 0xFE, 0x08, 0xB1, 0x07,
-	0x2B, 0x06, 0xBF, 0x04, 0x6A, 0x03, 0x32, 0x02, 0x1A, 0x01, 0x4A, 0x00,
-	0xA8, 0xFF, 0x0A, 0xFF, 0x6F, 0xFE, 0xDE, 0xFD, 0x4E, 0xFD, 0xC6, 0xFC,
-	0x4D, 0xFC, 0xDC, 0xFB, 0x81, 0xFB, 0x41, 0xFB, 0x0B, 0xFB, 0xB4, 0xFA,
-	0x56, 0xFA, 0x1C, 0xFA, 0xD6, 0xF9, 0x5D, 0xF9, 0xCA, 0xF8, 0x33, 0xF8,
-	0x74, 0xF7, 0x85, 0xF6, 0x58, 0xF5, 0xFC, 0xF3, 0x62, 0xF2, 0x8B, 0xF0,
-	0x5E, 0xEE, 0xEE, 0xEB, 0x47, 0xE9, 0x5B, 0xE6, 0x5E, 0xE3, 0x65, 0xE0,
-	0x58, 0xDD, 0x2C, 0xDA, 0x01, 0xD7, 0x4C, 0xD4, 0x14, 0xD2, 0x90, 0xD0,
-	0x93, 0xCF, 0xBF, 0xCE, 0x12, 0xCE, 0xD8, 0xCD, 0x22, 0xCE, 0x72, 0xCE,
-	0xB8, 0xCE, 0xCA, 0xCF, 0x37, 0xD2, 0x82, 0xD5, 0x60, 0xD9, 0xD8, 0xDD,
-	0xC1, 0xE2, 0x85, 0xE7, 0x09, 0xEC, 0x52, 0xF0, 0x90, 0xF4, 0x11, 0xF9,
-	0x1C, 0xFE, 0x1C, 0x03, 0x90, 0x07, 0xC7, 0x0B, 0x3A, 0x10, 0x85, 0x14,
-	0xCA, 0x17, 0xD2, 0x19, 0x56, 0x1B, 0x00, 0x1D, 0x24, 0x1E, 0xDF, 0x1E,
-	0x33, 0x1F, 0x4D, 0x1F, 0xDD, 0x1E, 0xB9, 0x1D, 0x1B, 0x1C, 0x1E, 0x1A,
-	0xFC, 0x17, 0xCD, 0x15, 0xAC, 0x13, 0x81, 0x11, 0x72, 0x0F, 0xE1, 0x0D,
-	0x81, 0x0C, 0x9C, 0x0A, 0x66, 0x08, 0x6F, 0x06, 0xDC, 0x04, 0xBA, 0x03,
-	0x10, 0x03, 0x74, 0x02, 0x0D, 0x02, 0x08, 0x02, 0x32, 0x02, 0x28, 0x02,
-	0x36, 0x02, 0x6A, 0x02, 0xA4, 0x02, 0xF2, 0x02, 0x5E, 0x03, 0xC0, 0x03,
-	0xCA, 0x03, 0x7F, 0x03, 0x3E, 0x03, 0xC3, 0x02, 0x00, 0x02, 0x78, 0x01,
-	0x29, 0x01, 0x7E, 0x00, 0x7E, 0xFF, 0x84, 0xFE, 0x65, 0xFD, 0x25, 0xFC,
-	0xC5, 0xFA, 0x3C, 0xF9, 0x91, 0xF7, 0x08, 0xF6, 0xD7, 0xF4, 0xF1, 0xF3,
-	0x2F, 0xF3, 0xAF, 0xF2, 0x4B, 0xF2, 0x07, 0xF2, 0x17, 0xF2, 0x80, 0xF2,
-	0xDF, 0xF2, 0x35, 0xF3, 0xDD, 0xF3, 0xEE, 0xF4, 0x42, 0xF6, 0xD9, 0xF7,
-	0xD3, 0xF9, 0xC8, 0xFB, 0xB9, 0xFD, 0xAD, 0xFF, 0xC1, 0x01, 0xBB, 0x03,
-	0xD0, 0x05, 0x23, 0x08, 0x5E, 0x0A, 0x17, 0x0C, 0x99, 0x0D, 0x23, 0x0F,
-	0xAD, 0x10, 0xB9, 0x11, 0x79, 0x12, 0x23, 0x13, 0xE9, 0x13, 0x71, 0x14,
-	0xB9, 0x14, 0xDB, 0x14, 0xD0, 0x14, 0x6C, 0x14, 0xBB, 0x13, 0xCB, 0x12,
-	0xBB, 0x11, 0xCD, 0x10, 0xE9, 0x0F, 0xFB, 0x0E, 0xED, 0x0D, 0xF3, 0x0C,
-	0x76, 0x0C, 0xFB, 0x0B, 0x35, 0x0B, 0x66, 0x0A, 0xCF, 0x09, 0x39, 0x09,
-	0xBF, 0x08, 0x70, 0x08, 0x60, 0x08, 0x8F, 0x08, 0x24, 0x09, 0xCA, 0x09,
-	0x5C, 0x0A, 0xD5, 0x0A, 0x79, 0x0B, 0x04, 0x0C, 0x7A, 0x0C, 0x18, 0x0D,
-	0xB4, 0x0D, 0x14, 0x0E, 0x3F, 0x0E, 0x79, 0x0E, 0x62, 0x0E, 0x32, 0x0E,
-	0x1E, 0x0E, 0x1C, 0x0E, 0xC0, 0x0D, 0x1D, 0x0D, 0x8B, 0x0C, 0xCB, 0x0B,
-	0xBC, 0x0A, 0x88, 0x09, 0x5B, 0x08, 0x02, 0x07, 0x97, 0x05, 0x68, 0x04,
-	0x37, 0x03, 0xE1, 0x01, 0x96, 0x00, 0x60, 0xFF, 0x37, 0xFE, 0x08, 0xFD,
-	0x04, 0xFC, 0x3F, 0xFB, 0x67, 0xFA, 0x87, 0xF9, 0xA2, 0xF8, 0xC3, 0xF7,
-	0x07, 0xF7, 0x67, 0xF6, 0xB0, 0xF5, 0xEC, 0xF4, 0x49, 0xF4, 0xD8, 0xF3,
-	0x55, 0xF3, 0xAE, 0xF2, 0x04, 0xF2, 0x34, 0xF1, 0x0A, 0xF0, 0x95, 0xEE,
-	0xFD, 0xEC, 0x2F, 0xEB, 0x1E, 0xE9, 0xF2, 0xE6, 0xBA, 0xE4, 0x50, 0xE2,
-	0x0E, 0xE0, 0xCF, 0xDD, 0x58, 0xDB, 0xF0, 0xD8, 0xFF, 0xD6, 0xED, 0xD5,
-	0x1A, 0xD5, 0x1D, 0xD4, 0x67, 0xD3, 0x4C, 0xD3, 0x5A, 0xD3, 0x63, 0xD3,
-	0x83, 0xD3, 0x20, 0xD4, 0x9C, 0xD5, 0x02, 0xD8, 0x02, 0xDB, 0x91, 0xDE,
-	0x9B, 0xE2, 0xCB, 0xE6, 0x1A, 0xEB, 0x44, 0xEF, 0x67, 0xF3, 0xC1, 0xF7,
-	0x37, 0xFC, 0x51, 0x00, 0x55, 0x04, 0x62, 0x08, 0x90, 0x0C, 0x70, 0x10,
-	0xFC, 0x13, 0x21, 0x17, 0xA5, 0x19, 0xD3, 0x1B, 0xDE, 0x1D, 0x59, 0x1F,
-	0x0B, 0x20, 0x38, 0x20, 0x10, 0x20, 0x46, 0x1F, 0xDE, 0x1D, 0x62, 0x1C,
-	0xF8, 0x1A, 0x3B, 0x19, 0x69, 0x17, 0xA2, 0x15, 0x92, 0x13, 0x57, 0x11,
-	0x34, 0x0F, 0x30, 0x0D, 0xD1, 0x0A, 0x84, 0x08, 0x7A, 0x06, 0xD4, 0x04,
-	0x58, 0x03, 0xEA, 0x01, 0xB4, 0x00, 0xF7, 0xFF, 0x7B, 0xFF, 0x1A, 0xFF,
-	0xDB, 0xFE, 0xD6, 0xFE, 0x1F, 0xFF, 0x5F, 0xFF, 0x8B, 0xFF, 0xCA, 0xFF,
-	0xF0, 0xFF, 0xE8, 0xFF, 0xD8, 0xFF, 0xCB, 0xFF, 0xB2, 0xFF, 0xDE, 0xFF,
-	0x35, 0x00, 0x3F, 0x00, 0xF2, 0xFF, 0x9B, 0xFF, 0x48, 0xFF, 0xC0, 0xFE,
-	0xD1, 0xFD, 0xA4, 0xFC, 0x84, 0xFB, 0x8F, 0xFA, 0x90, 0xF9, 0x9D, 0xF8,
-	0xB7, 0xF7, 0x11, 0xF7, 0x93, 0xF6, 0x46, 0xF6, 0x12, 0xF6, 0xEB, 0xF5,
-	0xFA, 0xF5, 0x07, 0xF6, 0x1A, 0xF6, 0x52, 0xF6, 0xD7, 0xF6, 0xE0, 0xF7,
-	0x27, 0xF9, 0x8F, 0xFA, 0xF9, 0xFB, 0xA6, 0xFD, 0x83, 0xFF, 0x67, 0x01,
-	0x58, 0x03, 0x4A, 0x05, 0x61, 0x07, 0x81, 0x09, 0x98, 0x0B, 0x68, 0x0D,
-	0x18, 0x0F, 0xB3, 0x10, 0x36, 0x12, 0x71, 0x13, 0x49, 0x14, 0xC9, 0x14,
-	0x21, 0x15, 0x8B, 0x15, 0xD6, 0x15, 0xE0, 0x15, 0xBE, 0x15, 0x90, 0x15,
-	0xF7, 0x14, 0xB6, 0x13, 0x3A, 0x12, 0xCC, 0x10, 0x47, 0x0F, 0xD3, 0x0D,
-	0xA5, 0x0C, 0x02, 0x0C, 0xC3, 0x0B, 0xAF, 0x0B, 0x87, 0x0B, 0x0A, 0x0B,
-	0x37, 0x0A, 0x57, 0x09, 0xA9, 0x08, 0x04, 0x08, 0xD5, 0x07, 0x29, 0x08,
-	0xED, 0x08, 0xFE, 0x09, 0x27, 0x0B, 0x38, 0x0C, 0xF1, 0x0C, 0x79, 0x0D,
-	0xA4, 0x0D, 0x97, 0x0D, 0xAB, 0x0D, 0xDF, 0x0D, 0x04, 0x0E, 0x23, 0x0E,
-	0x63, 0x0E, 0x99, 0x0E, 0x61, 0x0E, 0xDA, 0x0D, 0x24, 0x0D, 0x11, 0x0C,
-	0xB8, 0x0A, 0x71, 0x09, 0x47, 0x08, 0x0A, 0x07, 0xB8, 0x05, 0x75, 0x04,
-	0x12, 0x03, 0x71, 0x01, 0xD4, 0xFF, 0x48, 0xFE, 0xB1, 0xFC, 0x4A, 0xFB,
-	0x1A, 0xFA, 0x20, 0xF9, 0x32, 0xF8, 0x79, 0xF7, 0xD6, 0xF6, 0x05, 0xF6,
-	0x51, 0xF5, 0xB8, 0xF4, 0x3B, 0xF4, 0xAC, 0xF3, 0x17, 0xF3, 0x7B, 0xF2,
-	0xFA, 0xF1, 0x85, 0xF1, 0x02, 0xF1, 0x66, 0xF0, 0x95, 0xEF, 0x7D, 0xEE,
-	0x0B, 0xED, 0x26, 0xEB, 0xEB, 0xE8, 0x8F, 0xE6, 0xFC, 0xE3, 0x5B, 0xE1,
-	0xA8, 0xDE, 0x03, 0xDC, 0xCB, 0xD9, 0x60, 0xD8, 0x9D, 0xD7, 0xAE, 0xD6,
-	0x36, 0xD5, 0xDE, 0xD3, 0x07, 0xD3, 0x75, 0xD2, 0xF6, 0xD1, 0xB1, 0xD1,
-	0x79, 0xD2, 0x45, 0xD4, 0xB3, 0xD6, 0x98, 0xD9, 0x0E, 0xDD, 0x0C, 0xE1,
-	0x40, 0xE5, 0x63, 0xE9, 0x2E, 0xED, 0xDA, 0xF0, 0xF9, 0xF4, 0x98, 0xF9,
-	0x49, 0xFE, 0xDC, 0x02, 0x75, 0x07, 0x28, 0x0C, 0x67, 0x10, 0xDB, 0x13,
-	0x9F, 0x16, 0xFA, 0x18, 0x1D, 0x1B, 0x1B, 0x1D, 0xD5, 0x1E, 0xD1, 0x1F,
-	0x3E, 0x20, 0x38, 0x20, 0xB1, 0x1F, 0x7E, 0x1E, 0x02, 0x1D, 0x3C, 0x1B,
-	0x3B, 0x19, 0x2F, 0x17, 0x1B, 0x15, 0xDC, 0x12, 0x92, 0x10, 0x81, 0x0E,
-	0x5F, 0x0C, 0x13, 0x0A, 0xCA, 0x07, 0xD1, 0x05, 0x0D, 0x04, 0x44, 0x02,
-	0x97, 0x00, 0x5B, 0xFF, 0x6C, 0xFE, 0x0D, 0xFE, 0x18, 0xFE, 0x2C, 0xFE,
-	0x2F, 0xFE, 0x89, 0xFE, 0xFE, 0xFE, 0x29, 0xFF, 0x4C, 0xFF, 0x7D, 0xFF,
-	0x94, 0xFF, 0xA0, 0xFF, 0xD1, 0xFF, 0x2C, 0x00, 0x84, 0x00, 0xE7, 0x00,
-	0x33, 0x01, 0x05, 0x01, 0xAA, 0x00, 0x24, 0x00, 0x6A, 0xFF, 0x57, 0xFE,
-	0x21, 0xFD, 0x0B, 0xFC, 0x27, 0xFB, 0x63, 0xFA, 0xBB, 0xF9, 0x0D, 0xF9,
-	0x49, 0xF8, 0x94, 0xF7, 0xF0, 0xF6, 0x5D, 0xF6, 0x01, 0xF6, 0xF7, 0xF5,
-	0x24, 0xF6, 0x6C, 0xF6, 0x09, 0xF7, 0xB8, 0xF7, 0x9C, 0xF8, 0x8B, 0xF9,
-	0x9C, 0xFA, 0xDB, 0xFB, 0x62, 0xFD, 0x29, 0xFF, 0xF6, 0x00, 0x12, 0x03,
-	0x1A, 0x05, 0x27, 0x07, 0x23, 0x09, 0x02, 0x0B, 0xB6, 0x0C, 0x2C, 0x0E,
-	0x74, 0x0F, 0xB3, 0x10, 0xD2, 0x11, 0xD6, 0x12, 0x73, 0x13, 0xE7, 0x13,
-	0x50, 0x14, 0xAB, 0x14, 0xC6, 0x14, 0x99, 0x14, 0x4A, 0x14, 0xFF, 0x13,
-	0xA7, 0x13, 0xFE, 0x12, 0x21, 0x12, 0x02, 0x11, 0xCC, 0x0F, 0x80, 0x0E,
-	0x24, 0x0D, 0xFA, 0x0B, 0x1E, 0x0B, 0x73, 0x0A, 0x02, 0x0A, 0xC8, 0x09,
-	0x93, 0x09, 0x67, 0x09, 0x64, 0x09, 0x16, 0x09, 0xB7, 0x08, 0x8F, 0x08,
-	0xC3, 0x08, 0x1E, 0x09, 0x85, 0x09, 0x18, 0x0A, 0x99, 0x0A, 0x0F, 0x0B,
-	0x99, 0x0B, 0x19, 0x0C, 0x6D, 0x0C, 0x94, 0x0C, 0xBD, 0x0C, 0xE7, 0x0C,
-	0xF8, 0x0C, 0xCA, 0x0C, 0x7A, 0x0C, 0xEE, 0x0B, 0x16, 0x0B, 0x34, 0x0A,
-	0x30, 0x09, 0x33, 0x08, 0x48, 0x07, 0x51, 0x06, 0x4F, 0x05, 0x42, 0x04,
-	0x2A, 0x03, 0x09, 0x02, 0xAF, 0x00, 0x44, 0xFF, 0xD4, 0xFD, 0x83, 0xFC,
-	0x58, 0xFB, 0x50, 0xFA, 0x85, 0xF9, 0xCB, 0xF8, 0x1A, 0xF8, 0x91, 0xF7,
-	0x05, 0xF7, 0x65, 0xF6, 0xD9, 0xF5, 0x4F, 0xF5, 0xB4, 0xF4, 0xFD, 0xF3,
-	0x74, 0xF3, 0xF8, 0xF2, 0x25, 0xF2, 0x1C, 0xF1, 0xED, 0xEF, 0xB1, 0xEE,
-	0x50, 0xED, 0xB8, 0xEB, 0x0E, 0xEA, 0x16, 0xE8, 0xD7, 0xE5, 0x4B, 0xE3,
-	0xB4, 0xE0, 0x1C, 0xDE, 0x6E, 0xDB, 0x56, 0xD9, 0x12, 0xD8, 0x31, 0xD7,
-	0x53, 0xD6, 0x65, 0xD5, 0xB9, 0xD4, 0x71, 0xD4, 0x4D, 0xD4, 0x16, 0xD4,
-	0x18, 0xD4, 0xD2, 0xD4, 0xC0, 0xD6, 0x6A, 0xD9, 0x40, 0xDC, 0xB0, 0xDF,
-	0xE5, 0xE3, 0x34, 0xE8, 0x38, 0xEC, 0x12, 0xF0, 0x0B, 0xF4, 0x14, 0xF8,
-	0x49, 0xFC, 0xA8, 0x00, 0xDD, 0x04, 0xB3, 0x08, 0x98, 0x0C, 0xB9, 0x10,
-	0x67, 0x14, 0x1B, 0x17, 0x45, 0x19, 0x5A, 0x1B, 0x56, 0x1D, 0xB6, 0x1E,
-	0x52, 0x1F, 0x0E, 0x1F, 0x9B, 0x1E, 0x41, 0x1E, 0x88, 0x1D, 0xD1, 0x1B,
-	0x9A, 0x19, 0xDB, 0x17, 0x62, 0x16, 0x8D, 0x14, 0x61, 0x12, 0x35, 0x10,
-	0x47, 0x0E, 0x50, 0x0C, 0xEE, 0x09, 0x40, 0x07, 0x07, 0x05, 0xC7, 0x03,
-	0x9B, 0x02, 0xEA, 0x00, 0x58, 0xFF, 0xBB, 0xFE, 0xB6, 0xFE, 0x7F, 0xFE,
-	0x4E, 0xFE, 0x44, 0xFE, 0x69, 0xFE, 0xCC, 0xFE, 0x1E, 0xFF, 0x1B, 0xFF,
-	0xE2, 0xFE, 0x16, 0xFF, 0xA4, 0xFF, 0xCD, 0xFF, 0xA6, 0xFF, 0xF0, 0xFF,
-	0x95, 0x00, 0xB9, 0x00, 0x6B, 0x00, 0x21, 0x00, 0xE9, 0xFF, 0x9C, 0xFF,
-	0xFC, 0xFE, 0xD8, 0xFD, 0x73, 0xFC, 0x6E, 0xFB, 0xE2, 0xFA, 0x60, 0xFA,
-	0x7E, 0xF9, 0xFE, 0xF8, 0xDD, 0xF8, 0xDC, 0xF8, 0x9C, 0xF8, 0x16, 0xF8,
-	0xB7, 0xF7, 0xCE, 0xF7, 0x04, 0xF8, 0x11, 0xF8, 0x61, 0xF8, 0x42, 0xF9,
-	0xB3, 0xFA, 0x29, 0xFC, 0x74, 0xFD, 0xE0, 0xFE, 0xCF, 0x00, 0xC7, 0x02,
-	0x7D, 0x04, 0x02, 0x06, 0xA3, 0x07, 0x55, 0x09, 0xF4, 0x0A, 0x65, 0x0C,
-	0xC8, 0x0D, 0x4E, 0x0F, 0xCD, 0x10, 0xEA, 0x11, 0x87, 0x12, 0xEA, 0x12,
-	0x71, 0x13, 0xD8, 0x13, 0xD1, 0x13, 0x94, 0x13, 0x6D, 0x13, 0x01, 0x13,
-	0x5B, 0x12, 0xBD, 0x11, 0x54, 0x11, 0xC1, 0x10, 0xFC, 0x0F, 0x1F, 0x0F,
-	0x11, 0x0E, 0xE3, 0x0C, 0xFA, 0x0B, 0x49, 0x0B, 0xBC, 0x0A, 0xA7, 0x0A,
-	0x0D, 0x0B, 0x8A, 0x0B, 0xB7, 0x0B, 0xAA, 0x0B, 0x79, 0x0B, 0x37, 0x0B,
-	0x35, 0x0B, 0x7F, 0x0B, 0xE0, 0x0B, 0x23, 0x0C, 0xB1, 0x0C, 0x6C, 0x0D,
-	0xD8, 0x0D, 0x2A, 0x0E, 0x57, 0x0E, 0x66, 0x0E, 0x1F, 0x0E, 0xD6, 0x0D,
-	0x6E, 0x0D, 0xF5, 0x0C, 0x74, 0x0C, 0xCD, 0x0B, 0xEF, 0x0A, 0xEC, 0x09,
-	0x11, 0x09, 0x2E, 0x08, 0xF9, 0x06, 0x74, 0x05, 0x18, 0x04, 0xF8, 0x02,
-	0xFC, 0x01, 0xF7, 0x00, 0xC5, 0xFF, 0x72, 0xFE, 0x38, 0xFD, 0xF3, 0xFB,
-	0xAB, 0xFA, 0xAF, 0xF9, 0xF6, 0xF8, 0x71, 0xF8, 0xD8, 0xF7, 0x52, 0xF7,
-	0xF0, 0xF6, 0x83, 0xF6, 0x05, 0xF6, 0x58, 0xF5, 0x87, 0xF4, 0xEA, 0xF3,
-	0x81, 0xF3, 0xF2, 0xF2, 0x3F, 0xF2, 0x4E, 0xF1, 0x25, 0xF0, 0xD3, 0xEE,
-	0x58, 0xED, 0x87, 0xEB, 0x9C, 0xE9, 0x7B, 0xE7, 0x58, 0xE5, 0x16, 0xE3,
-	0x9C, 0xE0, 0xC9, 0xDD, 0x23, 0xDB, 0x1B, 0xD9, 0xAC, 0xD7, 0x97, 0xD6,
-	0x89, 0xD5, 0x5C, 0xD4, 0x6A, 0xD3, 0xF2, 0xD2, 0xE7, 0xD2, 0x1B, 0xD3,
-	0xB7, 0xD3, 0xCB, 0xD4, 0x6E, 0xD6, 0x68, 0xD8, 0xCD, 0xDA, 0x07, 0xDE,
-	0xF1, 0xE1, 0x2D, 0xE6, 0x73, 0xEA, 0x95, 0xEE, 0xDC, 0xF2, 0x8A, 0xF7,
-	0x1F, 0xFC, 0x06, 0x00, 0xC7, 0x03, 0x15, 0x08, 0x82, 0x0C, 0x85, 0x10,
-	0xDE, 0x13, 0xB6, 0x16, 0x1D, 0x19, 0x47, 0x1B, 0x41, 0x1D, 0xB9, 0x1E,
-	0x7E, 0x1F, 0xE5, 0x1F, 0xFE, 0x1F, 0x5D, 0x1F, 0x0F, 0x1E, 0xAF, 0x1C,
-	0x40, 0x1B, 0x74, 0x19, 0x43, 0x17, 0xEE, 0x14, 0xB6, 0x12, 0x84, 0x10,
-	0x15, 0x0E, 0xB3, 0x0B, 0x55, 0x09, 0x31, 0x07, 0x5B, 0x05, 0xA1, 0x03,
-	0xEF, 0x01, 0x2B, 0x00, 0xA7, 0xFE, 0xB7, 0xFD, 0xF0, 0xFC, 0x62, 0xFC,
-	0x52, 0xFC, 0xA1, 0xFC, 0xF2, 0xFC, 0x25, 0xFD, 0x73, 0xFD, 0x01, 0xFE,
-	0x62, 0xFE, 0x79, 0xFE, 0x96, 0xFE, 0x0F, 0xFF, 0xA4, 0xFF, 0x22, 0x00,
-	0x7F, 0x00, 0xA3, 0x00, 0x9C, 0x00, 0x8B, 0x00, 0x5F, 0x00, 0x04, 0x00,
-	0x87, 0xFF, 0xDE, 0xFE, 0xFD, 0xFD, 0xF4, 0xFC, 0xDC, 0xFB, 0x10, 0xFB,
-	0x8A, 0xFA, 0xE4, 0xF9, 0x15, 0xF9, 0x5C, 0xF8, 0x07, 0xF8, 0xBF, 0xF7,
-	0x66, 0xF7, 0x38, 0xF7, 0x49, 0xF7, 0x9C, 0xF7, 0x26, 0xF8, 0xC3, 0xF8,
-	0x90, 0xF9, 0x96, 0xFA, 0xBC, 0xFB, 0xEE, 0xFC, 0x5F, 0xFE, 0xF6, 0xFF,
-	0xB8, 0x01, 0x86, 0x03, 0x0E, 0x05, 0xAE, 0x06, 0x40, 0x08, 0xEB, 0x09,
-	0x5C, 0x0B, 0x6C, 0x0C, 0x46, 0x0D, 0xFB, 0x0D, 0x99, 0x0E, 0x1D, 0x0F,
-	0xAB, 0x0F, 0x16, 0x10, 0x71, 0x10, 0x0D, 0x11, 0xAD, 0x11, 0xCD, 0x11,
-	0xCF, 0x11, 0x09, 0x12, 0x29, 0x12, 0xF3, 0x11, 0xB0, 0x11, 0xB4, 0x11,
-	0xB3, 0x11, 0x9D, 0x11, 0xAE, 0x11, 0x90, 0x11, 0x71, 0x11, 0x95, 0x11,
-	0x06, 0x12, 0x2A, 0x12, 0xD2, 0x11, 0xB4, 0x11, 0xDE, 0x11, 0xD0, 0x11,
-	0x5F, 0x11, 0xFD, 0x10, 0xB0, 0x10, 0x2C, 0x10, 0x92, 0x0F, 0xC8, 0x0E,
-	0x0F, 0x0E, 0x6E, 0x0D, 0xCB, 0x0C, 0x1A, 0x0C, 0x1C, 0x0B, 0x33, 0x0A,
-	0x5B, 0x09, 0x82, 0x08, 0x50, 0x07, 0xFC, 0x05, 0xD5, 0x04, 0xE0, 0x03,
-	0xF1, 0x02, 0xF3, 0x01, 0x0C, 0x01, 0x66, 0x00, 0xE6, 0xFF, 0x51, 0xFF,
-	0xB9, 0xFE, 0x49, 0xFE, 0xEA, 0xFD, 0x9B, 0xFD, 0x41, 0xFD, 0xDD, 0xFC,
-	0x98, 0xFC, 0x81, 0xFC, 0x63, 0xFC, 0x3F, 0xFC, 0x1F, 0xFC, 0x1A, 0xFC,
-	0x07, 0xFC, 0xE5, 0xFB, 0x81, 0xFB, 0xEF, 0xFA, 0x3E, 0xFA, 0x54, 0xF9,
-	0xFF, 0xF7, 0x87, 0xF6, 0x11, 0xF5, 0xA8, 0xF3, 0x1C, 0xF2, 0x32, 0xF0,
-	0x1D, 0xEE, 0xB7, 0xEB, 0xF9, 0xE8, 0x24, 0xE6, 0x02, 0xE3, 0x8C, 0xDF,
-	0x0B, 0xDC, 0xE5, 0xD8, 0xDA, 0xD5, 0x39, 0xD3, 0xA5, 0xD1, 0x35, 0xD1,
-	0xD8, 0xD0, 0x02, 0xD0, 0x3B, 0xCF, 0xED, 0xCE, 0x0F, 0xCF, 0x90, 0xCF,
-	0x6E, 0xD0, 0xF6, 0xD1, 0xBC, 0xD4, 0x8D, 0xD8, 0x7C, 0xDC, 0x2E, 0xE0,
-	0x41, 0xE4, 0xF1, 0xE8, 0x76, 0xED, 0x82, 0xF1, 0x9D, 0xF5, 0x33, 0xFA,
-	0x47, 0xFF, 0x40, 0x04, 0x71, 0x08, 0x0A, 0x0C, 0xAF, 0x0F, 0x54, 0x13,
-	0x3D, 0x16, 0xE9, 0x17, 0x3B, 0x19, 0xFF, 0x1A, 0xCB, 0x1C, 0xC0, 0x1D,
-	0xFE, 0x1D, 0xB1, 0x1D, 0x48, 0x1D, 0x62, 0x1C, 0xC3, 0x1A, 0xA6, 0x18,
-	0x64, 0x16, 0x4B, 0x14, 0x80, 0x12, 0xD6, 0x10, 0x04, 0x0F, 0x07, 0x0D,
-	0x54, 0x0B, 0x8A, 0x09, 0x2C, 0x07, 0x08, 0x05, 0x9F, 0x03, 0xCC, 0x02,
-	0xAD, 0x01, 0x7D, 0x00, 0xA3, 0xFF, 0x3C, 0xFF, 0x1C, 0xFF, 0x33, 0xFF,
-	0x48, 0xFF, 0x4F, 0xFF, 0xA3, 0xFF, 0x4F, 0x00, 0xA5, 0x00, 0xB5, 0x00,
-	0xDA, 0x00, 0x0B, 0x01, 0x09, 0x01, 0xE9, 0x00, 0x02, 0x01, 0x2E, 0x01,
-	0x34, 0x01, 0xE6, 0x00, 0x51, 0x00, 0xB3, 0xFF, 0x2D, 0xFF, 0x9C, 0xFE,
-	0xC0, 0xFD, 0xC9, 0xFC, 0xD0, 0xFB, 0xE4, 0xFA, 0xEC, 0xF9, 0x08, 0xF9,
-	0x43, 0xF8, 0x93, 0xF7, 0x0F, 0xF7, 0xD1, 0xF6, 0x96, 0xF6, 0x5B, 0xF6,
-	0x75, 0xF6, 0xD8, 0xF6, 0x39, 0xF7, 0xCE, 0xF7, 0xB4, 0xF8, 0xCB, 0xF9,
-	0xF0, 0xFA, 0x4B, 0xFC, 0xD4, 0xFD, 0x8E, 0xFF, 0x4A, 0x01, 0x21, 0x03,
-	0x4F, 0x05, 0x8B, 0x07, 0xA7, 0x09, 0x89, 0x0B, 0x2A, 0x0D, 0x8D, 0x0E,
-	0xBE, 0x0F, 0xD9, 0x10, 0xC5, 0x11, 0x8E, 0x12, 0x5E, 0x13, 0x1E, 0x14,
-	0x86, 0x14, 0x7C, 0x14, 0x73, 0x14, 0x4E, 0x14, 0xB2, 0x13, 0xAB, 0x12,
-	0x87, 0x11, 0x68, 0x10, 0x44, 0x0F, 0x11, 0x0E, 0xF4, 0x0C, 0xF2, 0x0B,
-	0x28, 0x0B, 0xA2, 0x0A, 0xD8, 0x09, 0x9D, 0x08, 0x76, 0x07, 0xA8, 0x06,
-	0x21, 0x06, 0x9D, 0x05, 0x6D, 0x05, 0xBE, 0x05, 0x54, 0x06, 0xF5, 0x06,
-	0x7D, 0x07, 0xE9, 0x07, 0x8B, 0x08, 0x5B, 0x09, 0x16, 0x0A, 0xC5, 0x0A,
-	0xA9, 0x0B, 0xE1, 0x0C, 0xE4, 0x0D, 0x7F, 0x0E, 0xD3, 0x0E, 0x12, 0x0F,
-	0x5E, 0x0F, 0x8E, 0x0F, 0x76, 0x0F, 0x07, 0x0F, 0xA8, 0x0E, 0x3F, 0x0E,
-	0x9E, 0x0D, 0x8E, 0x0C, 0x87, 0x0B, 0x68, 0x0A, 0x0E, 0x09, 0x75, 0x07,
-	0x9F, 0x05, 0xEB, 0x03, 0x6A, 0x02, 0xF2, 0x00, 0x66, 0xFF, 0xF3, 0xFD,
-	0xB1, 0xFC, 0xBD, 0xFB, 0x9D, 0xFA, 0x6B, 0xF9, 0x43, 0xF8, 0x6D, 0xF7,
-	0xDB, 0xF6, 0x72, 0xF6, 0xFF, 0xF5, 0xB4, 0xF5, 0x99, 0xF5, 0x85, 0xF5,
-	0x60, 0xF5, 0x56, 0xF5, 0x6E, 0xF5, 0x7A, 0xF5, 0x64, 0xF5, 0x20, 0xF5,
-	0x84, 0xF4, 0xC2, 0xF3, 0xF7, 0xF2, 0xD3, 0xF1, 0x62, 0xF0, 0xBE, 0xEE,
-	0x11, 0xED, 0x2F, 0xEB, 0xF3, 0xE8, 0x71, 0xE6, 0xBE, 0xE3, 0xDE, 0xE0,
-	0x1A, 0xDE, 0xE0, 0xDB, 0x48, 0xDA, 0xFE, 0xD8, 0xA7, 0xD7, 0x62, 0xD6,
-	0x18, 0xD5, 0x24, 0xD4, 0xB9, 0xD3, 0xBC, 0xD3, 0xD2, 0xD3, 0x73, 0xD4,
-	0x13, 0xD6, 0x80, 0xD8, 0x46, 0xDB, 0xC1, 0xDE, 0xAE, 0xE2, 0xA8, 0xE6,
-	0xBC, 0xEA, 0x04, 0xEF, 0x6E, 0xF3, 0xDF, 0xF7, 0x46, 0xFC, 0xA5, 0x00,
-	0xED, 0x04, 0x1A, 0x09, 0x8C, 0x0D, 0x16, 0x12, 0x16, 0x16, 0x2C, 0x19,
-	0xB9, 0x1B, 0xF8, 0x1D, 0xE1, 0x1F, 0x05, 0x21, 0x8B, 0x21, 0x87, 0x21,
-	0xF6, 0x20, 0xF4, 0x1F, 0xA3, 0x1E, 0x2D, 0x1D, 0x5E, 0x1B, 0x1C, 0x19,
-	0x7A, 0x16, 0xF8, 0x13, 0x7D, 0x11, 0xED, 0x0E, 0x13, 0x0C, 0x1F, 0x09,
-	0x2D, 0x06, 0x71, 0x03, 0x56, 0x01, 0x83, 0xFF, 0x91, 0xFD, 0xDB, 0xFB,
-	0xAA, 0xFA, 0xE1, 0xF9, 0x71, 0xF9, 0x80, 0xF9, 0x03, 0xFA, 0x86, 0xFA,
-	0xDB, 0xFA, 0x58, 0xFB, 0x09, 0xFC, 0xCE, 0xFC, 0x8E, 0xFD, 0x32, 0xFE,
-	0xE7, 0xFE, 0xCE, 0xFF, 0x20, 0x01, 0x79, 0x02, 0x62, 0x03, 0xD6, 0x03,
-	0x01, 0x04, 0x12, 0x04, 0x02, 0x04, 0xBF, 0x03, 0x3A, 0x03, 0x7C, 0x02,
-	0x9A, 0x01, 0x8A, 0x00, 0x87, 0xFF, 0x9E, 0xFE, 0xB9, 0xFD, 0xB0, 0xFC,
-	0x92, 0xFB, 0x8D, 0xFA, 0xC2, 0xF9, 0x1F, 0xF9, 0x98, 0xF8, 0xF7, 0xF7,
-	0x45, 0xF7, 0xF1, 0xF6, 0x51, 0xF7, 0xFB, 0xF7, 0xD7, 0xF8, 0xF5, 0xF9,
-	0x7C, 0xFB, 0x32, 0xFD, 0x11, 0xFF, 0x3B, 0x01, 0x76, 0x03, 0x9A, 0x05,
-	0x6D, 0x07, 0x1E, 0x09, 0xEC, 0x0A, 0xF4, 0x0C, 0x07, 0x0F, 0xEE, 0x10,
-	0x99, 0x12, 0x0B, 0x14, 0x54, 0x15, 0x68, 0x16, 0xEA, 0x16, 0xFC, 0x16,
-	0xF3, 0x16, 0xD8, 0x16, 0x88, 0x16, 0x38, 0x16, 0x07, 0x16, 0x82, 0x15,
-	0x6E, 0x14, 0xFD, 0x12, 0x68, 0x11, 0xB6, 0x0F, 0x33, 0x0E, 0xDD, 0x0C,
-	0x83, 0x0B, 0x64, 0x0A, 0xBE, 0x09, 0x4F, 0x09, 0xAA, 0x08, 0xC6, 0x07,
-	0x16, 0x07, 0x92, 0x06, 0x19, 0x06, 0xD0, 0x05, 0xE4, 0x05, 0x46, 0x06,
-	0xE0, 0x06, 0x90, 0x07, 0x3F, 0x08, 0xF9, 0x08, 0xBD, 0x09, 0x4C, 0x0A,
-	0x87, 0x0A, 0xA6, 0x0A, 0x0A, 0x0B, 0x90, 0x0B, 0xFD, 0x0B, 0x27, 0x0C,
-	0x29, 0x0C, 0x04, 0x0C, 0xA8, 0x0B, 0xF0, 0x0A, 0xF8, 0x09, 0xF3, 0x08,
-	0x05, 0x08, 0x1C, 0x07, 0x37, 0x06, 0x17, 0x05, 0xF9, 0x03, 0xB9, 0x02,
-	0x42, 0x01, 0x98, 0xFF, 0xFC, 0xFD, 0xC1, 0xFC, 0xB3, 0xFB, 0xCE, 0xFA,
-	0xDD, 0xF9, 0x10, 0xF9, 0x60, 0xF8, 0xD4, 0xF7, 0x28, 0xF7, 0x6B, 0xF6,
-	0xDD, 0xF5, 0x78, 0xF5, 0x20, 0xF5, 0xA9, 0xF4, 0x64, 0xF4, 0x51, 0xF4,
-	0x34, 0xF4, 0xD3, 0xF3, 0x40, 0xF3, 0x8A, 0xF2, 0x9D, 0xF1, 0x92, 0xF0,
-	0x35, 0xEF, 0xA6, 0xED, 0xF7, 0xEB, 0x32, 0xEA, 0x46, 0xE8, 0x0E, 0xE6,
-	0xE1, 0xE3, 0x92, 0xE1, 0x2C, 0xDF, 0xAF, 0xDC, 0xC8, 0xDA, 0x95, 0xD9,
-	0xD5, 0xD8, 0x14, 0xD8, 0x45, 0xD7, 0x78, 0xD6, 0x0F, 0xD6, 0x11, 0xD6,
-	0x2A, 0xD6, 0x8F, 0xD6, 0xE1, 0xD7, 0x53, 0xDA, 0x1B, 0xDD, 0x17, 0xE0,
-	0xA8, 0xE3, 0xCB, 0xE7, 0x0C, 0xEC, 0xDA, 0xEF, 0x89, 0xF3, 0xA8, 0xF7,
-	0x35, 0xFC, 0xF2, 0x00, 0x20, 0x05, 0xC7, 0x08, 0x74, 0x0C, 0x70, 0x10,
-	0x42, 0x14, 0x46, 0x17, 0x77, 0x19, 0x44, 0x1B, 0x29, 0x1D, 0x74, 0x1E,
-	0xEF, 0x1E, 0x1E, 0x1F, 0x55, 0x1F, 0x0C, 0x1F, 0xD3, 0x1D, 0xF8, 0x1B,
-	0x05, 0x1A, 0x1D, 0x18, 0xD0, 0x15, 0x03, 0x13, 0x0C, 0x10, 0x97, 0x0D,
-	0xF7, 0x0B, 0x30, 0x0A, 0x78, 0x07, 0xA6, 0x04, 0x94, 0x02, 0xC9, 0x00,
-	0xFA, 0xFE, 0x14, 0xFD, 0x7A, 0xFB, 0x70, 0xFA, 0xEF, 0xF9, 0xB0, 0xF9,
-	0xB9, 0xF9, 0x1E, 0xFA, 0xE9, 0xFA, 0x84, 0xFB, 0xC5, 0xFB, 0x1D, 0xFC,
-	0xCD, 0xFC, 0xA8, 0xFD, 0x57, 0xFE, 0xBC, 0xFE, 0x46, 0xFF, 0x6C, 0x00,
-	0xB8, 0x01, 0x79, 0x02, 0x91, 0x02, 0x79, 0x02, 0x88, 0x02, 0x84, 0x02,
-	0x45, 0x02, 0xD4, 0x01, 0x44, 0x01, 0xA3, 0x00, 0xF1, 0xFF, 0xF2, 0xFE,
-	0xC8, 0xFD, 0xED, 0xFC, 0x3E, 0xFC, 0x58, 0xFB, 0x51, 0xFA, 0xAB, 0xF9,
-	0x89, 0xF9, 0x76, 0xF9, 0x4D, 0xF9, 0xE7, 0xF8, 0x98, 0xF8, 0xBA, 0xF8,
-	0x5E, 0xF9, 0x12, 0xFA, 0xF3, 0xFA, 0x49, 0xFC, 0x1B, 0xFE, 0x0A, 0x00,
-	0x2B, 0x02, 0x73, 0x04, 0x9E, 0x06, 0x98, 0x08, 0x49, 0x0A, 0xAE, 0x0B,
-	0xFA, 0x0C, 0xC0, 0x0E, 0x92, 0x10, 0x13, 0x12, 0x64, 0x13, 0xD8, 0x14,
-	0x1B, 0x16, 0xBB, 0x16, 0xDF, 0x16, 0x92, 0x16, 0xF3, 0x15, 0x59, 0x15,
-	0xCB, 0x14, 0xC5, 0x13, 0x9B, 0x12, 0x9B, 0x11, 0x8F, 0x10, 0x3F, 0x0F,
-	0xCD, 0x0D, 0xB9, 0x0C, 0xB2, 0x0B, 0xC1, 0x0A, 0x03, 0x0A, 0x3A, 0x09,
-	0x5F, 0x08, 0xC7, 0x07, 0x50, 0x07, 0xCC, 0x06, 0x45, 0x06, 0x27, 0x06,
-	0x93, 0x06, 0x1F, 0x07, 0xE6, 0x07, 0xDC, 0x08, 0xE1, 0x09, 0x92, 0x0A,
-	0x03, 0x0B, 0x62, 0x0B, 0x81, 0x0B, 0xB1, 0x0B, 0x0C, 0x0C, 0x40, 0x0C,
-	0x6C, 0x0C, 0xC1, 0x0C, 0xEB, 0x0C, 0xAD, 0x0C, 0x44, 0x0C, 0x7C, 0x0B,
-	0x66, 0x0A, 0x29, 0x09, 0xFC, 0x07, 0xA3, 0x06, 0x4F, 0x05, 0x21, 0x04,
-	0xC2, 0x02, 0x61, 0x01, 0xFD, 0xFF, 0x97, 0xFE, 0x14, 0xFD, 0x9C, 0xFB,
-	0x56, 0xFA, 0x6C, 0xF9, 0xC9, 0xF8, 0x48, 0xF8, 0xD6, 0xF7, 0x53, 0xF7,
-	0xC8, 0xF6, 0x4D, 0xF6, 0xE7, 0xF5, 0x85, 0xF5, 0x4F, 0xF5, 0x62, 0xF5,
-	0x86, 0xF5, 0xAF, 0xF5, 0xEA, 0xF5, 0xF5, 0xF5, 0x9D, 0xF5, 0x1C, 0xF5,
-	0x2E, 0xF4, 0xE1, 0xF2, 0x5C, 0xF1, 0xC0, 0xEF, 0xD1, 0xED, 0xB7, 0xEB,
-	0x8A, 0xE9, 0x65, 0xE7, 0x0A, 0xE5, 0x43, 0xE2, 0x59, 0xDF, 0xB2, 0xDC,
-	0xA5, 0xDA, 0x17, 0xD9, 0xC9, 0xD7, 0x7D, 0xD6, 0x28, 0xD5, 0x0E, 0xD4,
-	0x6E, 0xD3, 0x3E, 0xD3, 0x56, 0xD3, 0xF6, 0xD3, 0x57, 0xD5, 0x81, 0xD7,
-	0x6A, 0xDA, 0x07, 0xDE, 0x16, 0xE2, 0x26, 0xE6, 0x22, 0xEA, 0x48, 0xEE,
-	0x84, 0xF2, 0xDA, 0xF6, 0x45, 0xFB, 0xC0, 0xFF, 0x15, 0x04, 0x65, 0x08,
-	0xD5, 0x0C, 0xFA, 0x10, 0xA9, 0x14, 0xD7, 0x17, 0x7C, 0x1A, 0xAE, 0x1C,
-	0x9B, 0x1E, 0x1C, 0x20, 0xCB, 0x20, 0xBA, 0x20, 0x31, 0x20, 0x27, 0x1F,
-	0x78, 0x1D, 0xB8, 0x1B, 0xF6, 0x19, 0xDB, 0x17, 0x98, 0x15, 0x78, 0x13,
-	0x5E, 0x11, 0xE5, 0x0E, 0x25, 0x0C, 0x3B, 0x09, 0x0F, 0x06, 0x32, 0x03,
-	0xCF, 0x00, 0xE9, 0xFE, 0x51, 0xFD, 0xF4, 0xFB, 0xFF, 0xFA, 0x59, 0xFA,
-	0x0F, 0xFA, 0x14, 0xFA, 0x28, 0xFA, 0x41, 0xFA, 0x8E, 0xFA, 0x39, 0xFB,
-	0xF4, 0xFB, 0xBE, 0xFC, 0xC5, 0xFD, 0xB2, 0xFE, 0x7B, 0xFF, 0x3C, 0x00,
-	0x1C, 0x01, 0x02, 0x02, 0xE5, 0x02, 0x81, 0x03, 0xC7, 0x03, 0xCF, 0x03,
-	0xDF, 0x03, 0x92, 0x03, 0xEA, 0x02, 0x1D, 0x02, 0x32, 0x01, 0x19, 0x00,
-	0xF5, 0xFE, 0xF2, 0xFD, 0x06, 0xFD, 0x07, 0xFC, 0x20, 0xFB, 0x10, 0xFA,
-	0x06, 0xF9, 0x4C, 0xF8, 0xD0, 0xF7, 0x58, 0xF7, 0xF8, 0xF6, 0xA4, 0xF6,
-	0xA9, 0xF6, 0x1B, 0xF7, 0xC7, 0xF7, 0x61, 0xF8, 0x44, 0xF9, 0xA3, 0xFA,
-	0x56, 0xFC, 0x62, 0xFE, 0xC0, 0x00, 0x21, 0x03, 0x2F, 0x05, 0xDA, 0x06,
-	0x83, 0x08, 0x22, 0x0A, 0xC9, 0x0B, 0x82, 0x0D, 0x66, 0x0F, 0xF0, 0x10,
-	0x2B, 0x12, 0x82, 0x13, 0xD2, 0x14, 0xAE, 0x15, 0xFC, 0x15, 0x00, 0x16,
-	0xEA, 0x15, 0xDF, 0x15, 0xBC, 0x15, 0x5E, 0x15, 0xE0, 0x14, 0x5B, 0x14,
-	0xC0, 0x13, 0xDD, 0x12, 0xAC, 0x11, 0x5D, 0x10, 0x12, 0x0F, 0xEB, 0x0D,
-	0xE0, 0x0C, 0x25, 0x0C, 0xAE, 0x0B, 0x39, 0x0B, 0xB1, 0x0A, 0x08, 0x0A,
-	0x58, 0x09, 0xC9, 0x08, 0x62, 0x08, 0x07, 0x08, 0xF5, 0x07, 0x23, 0x08,
-	0x68, 0x08, 0xDF, 0x08, 0x15, 0x09, 0x2C, 0x09, 0x36, 0x09, 0x4F, 0x09,
-	0x72, 0x09, 0x78, 0x09, 0x94, 0x09, 0xCB, 0x09, 0xD4, 0x09, 0xBB, 0x09,
-	0x5F, 0x09, 0xD5, 0x08, 0x5F, 0x08, 0xDE, 0x07, 0x20, 0x07, 0x47, 0x06,
-	0x86, 0x05, 0xDA, 0x04, 0x20, 0x04, 0x53, 0x03, 0x6B, 0x02, 0x66, 0x01,
-	0x45, 0x00, 0x36, 0xFF, 0x34, 0xFE, 0x5D, 0xFD, 0xB6, 0xFC, 0x28, 0xFC,
-	0x92, 0xFB, 0xF5, 0xFA, 0x86, 0xFA, 0x20, 0xFA, 0x88, 0xF9, 0xE4, 0xF8,
-	0x56, 0xF8, 0xF8, 0xF7, 0xA6, 0xF7, 0x71, 0xF7, 0x3E, 0xF7, 0xDC, 0xF6,
-	0x61, 0xF6, 0x8F, 0xF5, 0x90, 0xF4, 0x6C, 0xF3, 0x5B, 0xF2, 0x15, 0xF1,
-	0x87, 0xEF, 0xC9, 0xED, 0xF4, 0xEB, 0xF0, 0xE9, 0x9B, 0xE7, 0x33, 0xE5,
-	0xAD, 0xE2, 0x1C, 0xE0, 0x7C, 0xDD, 0x12, 0xDB, 0x40, 0xD9, 0xFF, 0xD7,
-	0x2A, 0xD7, 0x81, 0xD6, 0xFF, 0xD5, 0x80, 0xD5, 0x26, 0xD5, 0xF3, 0xD4,
-	0xE8, 0xD4, 0x5B, 0xD5, 0xE7, 0xD6, 0x97, 0xD9, 0xE1, 0xDC, 0x94, 0xE0,
-	0x4E, 0xE4, 0x43, 0xE8, 0x2C, 0xEC, 0xF8, 0xEF, 0xAD, 0xF3, 0x86, 0xF7,
-	0xD2, 0xFB, 0x76, 0x00, 0xEB, 0x04, 0x40, 0x09, 0x7F, 0x0D, 0x6E, 0x11,
-	0xCD, 0x14, 0x60, 0x17, 0x38, 0x19, 0xEF, 0x1A, 0xA6, 0x1C, 0x06, 0x1E,
-	0xF7, 0x1E, 0x65, 0x1F, 0x42, 0x1F, 0x8E, 0x1E, 0x48, 0x1D, 0x67, 0x1B,
-	0x29, 0x19, 0xAE, 0x16, 0x39, 0x14, 0xFB, 0x11, 0xC3, 0x0F, 0xCD, 0x0D,
-	0xDD, 0x0B, 0x6B, 0x09, 0x8F, 0x06, 0xE2, 0x03, 0x84, 0x01, 0x42, 0xFF,
-	0x7D, 0xFD, 0x2E, 0xFC, 0x17, 0xFB, 0x53, 0xFA, 0x24, 0xFA, 0x0E, 0xFA,
-	0xEF, 0xF9, 0xEF, 0xF9, 0x53, 0xFA, 0xBB, 0xFA, 0x4E, 0xFB, 0x4D, 0xFC,
-	0x31, 0xFD, 0xD0, 0xFD, 0x6F, 0xFE, 0x4F, 0xFF, 0x14, 0x00, 0xCB, 0x00,
-	0x7E, 0x01, 0xFF, 0x01, 0x52, 0x02, 0x94, 0x02, 0xBD, 0x02, 0xAC, 0x02,
-	0x3F, 0x02, 0xA8, 0x01, 0xC1, 0x00, 0xCF, 0xFF, 0xDD, 0xFE, 0xD6, 0xFD,
-	0xC9, 0xFC, 0xCD, 0xFB, 0xDB, 0xFA, 0x09, 0xFA, 0x65, 0xF9, 0xD9, 0xF8,
-	0x64, 0xF8, 0xE3, 0xF7, 0x6E, 0xF7, 0x1D, 0xF7, 0x08, 0xF7, 0x78, 0xF7,
-	0x1A, 0xF8, 0xD2, 0xF8, 0x98, 0xF9, 0xE2, 0xFA, 0x74, 0xFC, 0x4A, 0xFE,
-	0x2E, 0x00, 0x21, 0x02, 0x15, 0x04, 0xE8, 0x05, 0xB7, 0x07, 0x72, 0x09,
-	0x31, 0x0B, 0x18, 0x0D, 0x07, 0x0F, 0xD1, 0x10, 0x5D, 0x12, 0xCA, 0x13,
-	0xE6, 0x14, 0x88, 0x15, 0xCA, 0x15, 0xC6, 0x15, 0xB9, 0x15, 0xF4, 0x15,
-	0x00, 0x16, 0x90, 0x15, 0xAE, 0x14, 0xB0, 0x13, 0x57, 0x12, 0x9E, 0x10,
-	0xD7, 0x0E, 0x3F, 0x0D, 0xFA, 0x0B, 0xBF, 0x0A, 0xC0, 0x09, 0xE5, 0x08,
-	0x2D, 0x08, 0x6B, 0x07, 0xA0, 0x06, 0xBC, 0x05, 0x29, 0x05, 0x2C, 0x05,
-	0x6B, 0x05, 0x97, 0x05, 0xC6, 0x05, 0x4D, 0x06, 0x50, 0x07, 0x86, 0x08,
-	0x91, 0x09, 0x8D, 0x0A, 0x7E, 0x0B, 0x5C, 0x0C, 0xEA, 0x0C, 0x4D, 0x0D,
-	0xB6, 0x0D, 0x3F, 0x0E, 0xA6, 0x0E, 0xB9, 0x0E, 0x79, 0x0E, 0x21, 0x0E,
-	0xA3, 0x0D, 0xF4, 0x0C, 0xC9, 0x0B, 0x79, 0x0A, 0x44, 0x09, 0x2D, 0x08,
-	0xC2, 0x06, 0x09, 0x05, 0x1A, 0x03, 0x75, 0x01, 0xDC, 0xFF, 0x39, 0xFE,
-	0xAA, 0xFC, 0x45, 0xFB, 0x1F, 0xFA, 0x17, 0xF9, 0x14, 0xF8, 0x3B, 0xF7,
-	0xA8, 0xF6, 0x4D, 0xF6, 0x02, 0xF6, 0xB3, 0xF5, 0x9C, 0xF5, 0xB0, 0xF5,
-	0xF5, 0xF5, 0x52, 0xF6, 0xC8, 0xF6, 0x4B, 0xF7, 0xE3, 0xF7, 0x3E, 0xF8,
-	0x43, 0xF8, 0xFB, 0xF7, 0x89, 0xF7, 0xBF, 0xF6, 0xDD, 0xF5, 0xCA, 0xF4,
-	0x77, 0xF3, 0xEA, 0xF1, 0x0C, 0xF0, 0xB9, 0xED, 0xD4, 0xEA, 0x9D, 0xE7,
-	0x38, 0xE4, 0xB9, 0xE0, 0x93, 0xDD, 0x45, 0xDB, 0xA0, 0xD9, 0x06, 0xD8,
-	0x26, 0xD6, 0x3D, 0xD4, 0xB7, 0xD2, 0xD9, 0xD1, 0x4D, 0xD1, 0xC8, 0xD0,
-	0xA3, 0xD0, 0xF6, 0xD1, 0x78, 0xD4, 0x4B, 0xD7, 0x9A, 0xDA, 0x94, 0xDE,
-	0xEF, 0xE2, 0x30, 0xE7, 0x65, 0xEB, 0xD8, 0xEF, 0x56, 0xF4, 0x0C, 0xF9,
-	0x18, 0xFE, 0x2C, 0x03, 0x25, 0x08, 0x56, 0x0D, 0x54, 0x12, 0x63, 0x16,
-	0x3E, 0x19, 0x7B, 0x1B, 0x92, 0x1D, 0x7B, 0x1F, 0xEC, 0x20, 0xB2, 0x21,
-	0xCD, 0x21, 0xA4, 0x21, 0x18, 0x21, 0xC1, 0x1F, 0x9C, 0x1D, 0xC9, 0x1A,
-	0xD8, 0x17, 0xDE, 0x14, 0xEA, 0x11, 0x19, 0x0F, 0x73, 0x0C, 0xD5, 0x09,
-	0xEA, 0x06, 0xEF, 0x03, 0x13, 0x01, 0x6C, 0xFE, 0x4B, 0xFC, 0x3B, 0xFA,
-	0x8D, 0xF8, 0x78, 0xF7, 0xFB, 0xF6, 0xF3, 0xF6, 0x55, 0xF7, 0xE8, 0xF7,
-	0x61, 0xF8, 0xEF, 0xF8, 0xE5, 0xF9, 0x1E, 0xFB, 0x6A, 0xFC, 0xC5, 0xFD,
-	0x20, 0xFF, 0x8C, 0x00, 0xF7, 0x01, 0x58, 0x03, 0x76, 0x04, 0x3A, 0x05,
-	0xB5, 0x05, 0xD8, 0x05, 0xE4, 0x05, 0xCE, 0x05, 0xA8, 0x05, 0x40, 0x05,
-	0x72, 0x04, 0x48, 0x03, 0xE9, 0x01, 0x79, 0x00, 0xE1, 0xFE, 0x38, 0xFD,
-	0x88, 0xFB, 0xFE, 0xF9, 0x91, 0xF8, 0x66, 0xF7, 0x59, 0xF6, 0x56, 0xF5,
-	0x88, 0xF4, 0xD4, 0xF3, 0x7B, 0xF3, 0x5F, 0xF3, 0xAE, 0xF3, 0x54, 0xF4,
-	0x0F, 0xF5, 0x1F, 0xF6, 0x79, 0xF7, 0x2C, 0xF9, 0x3B, 0xFB, 0x8F, 0xFD,
-	0xEE, 0xFF, 0x38, 0x02, 0x8E, 0x04, 0x13, 0x07, 0x8E, 0x09, 0x12, 0x0C,
-	0x50, 0x0E, 0x4B, 0x10, 0x0C, 0x12, 0xB9, 0x13, 0x10, 0x15, 0x25, 0x16,
-	0x0B, 0x17, 0xDF, 0x17, 0x7E, 0x18, 0xF1, 0x18, 0x2F, 0x19, 0x10, 0x19,
-	0x73, 0x18, 0x7B, 0x17, 0x2E, 0x16, 0xAE, 0x14, 0x2A, 0x13, 0xA9, 0x11,
-	0x25, 0x10, 0xBC, 0x0E, 0x82, 0x0D, 0x66, 0x0C, 0x35, 0x0B, 0xED, 0x09,
-	0xBE, 0x08, 0x92, 0x07, 0x75, 0x06, 0x64, 0x05, 0xA7, 0x04, 0x2C, 0x04,
-	0x00, 0x04, 0x24, 0x04, 0x7B, 0x04, 0xE5, 0x04, 0x4C, 0x05, 0xCA, 0x05,
-	0x52, 0x06, 0xC6, 0x06, 0x45, 0x07, 0xCB, 0x07, 0x61, 0x08, 0x06, 0x09,
-	0xA9, 0x09, 0x2E, 0x0A, 0x8E, 0x0A, 0xD0, 0x0A, 0xCD, 0x0A, 0xA6, 0x0A,
-	0x6F, 0x0A, 0x24, 0x0A, 0xC3, 0x09, 0x4C, 0x09, 0xBD, 0x08, 0x0E, 0x08,
-	0x16, 0x07, 0x14, 0x06, 0xE0, 0x04, 0x9A, 0x03, 0x53, 0x02, 0x19, 0x01,
-	0xFB, 0xFF, 0xFA, 0xFE, 0x1E, 0xFE, 0x5E, 0xFD, 0x90, 0xFC, 0xCD, 0xFB,
-	0x05, 0xFB, 0x44, 0xFA, 0x73, 0xF9, 0xC6, 0xF8, 0x59, 0xF8, 0x0C, 0xF8,
-	0xED, 0xF7, 0xF2, 0xF7, 0x04, 0xF8, 0xF4, 0xF7, 0xB0, 0xF7, 0x45, 0xF7,
-	0xD4, 0xF6, 0x3E, 0xF6, 0x8A, 0xF5, 0xB7, 0xF4, 0xD7, 0xF3, 0xBA, 0xF2,
-	0x59, 0xF1, 0xA8, 0xEF, 0xAA, 0xED, 0x8E, 0xEB, 0x5F, 0xE9, 0xFA, 0xE6,
-	0x63, 0xE4, 0xD0, 0xE1, 0x31, 0xDF, 0x93, 0xDC, 0x61, 0xDA, 0x0A, 0xD9,
-	0x46, 0xD8, 0x32, 0xD7, 0xF6, 0xD5, 0x20, 0xD5, 0xEF, 0xD4, 0xEF, 0xD4,
-	0xF0, 0xD4, 0x5B, 0xD5, 0xDC, 0xD6, 0xAB, 0xD9, 0x06, 0xDD, 0x4F, 0xE0,
-	0x98, 0xE3, 0x40, 0xE7, 0x7D, 0xEB, 0xCF, 0xEF, 0xCC, 0xF3, 0xE8, 0xF7,
-	0x7F, 0xFC, 0x45, 0x01, 0xD6, 0x05, 0x1D, 0x0A, 0x36, 0x0E, 0x52, 0x12,
-	0x12, 0x16, 0xBF, 0x18, 0x57, 0x1A, 0xD9, 0x1B, 0xDC, 0x1D, 0x79, 0x1F,
-	0x20, 0x20, 0x1E, 0x20, 0xED, 0x1F, 0x7E, 0x1F, 0x5B, 0x1E, 0x4D, 0x1C,
-	0x8F, 0x19, 0xD1, 0x16, 0x5F, 0x14, 0x11, 0x12, 0x64, 0x0F, 0xE2, 0x0C,
-	0x87, 0x0A, 0xF7, 0x07, 0x09, 0x05, 0x2C, 0x02, 0xC5, 0xFF, 0xE4, 0xFD,
-	0x2F, 0xFC, 0xA1, 0xFA, 0x69, 0xF9, 0x88, 0xF8, 0x56, 0xF8, 0x60, 0xF8,
-	0x49, 0xF8, 0x57, 0xF8, 0xD7, 0xF8, 0xB8, 0xF9, 0xB7, 0xFA, 0xCA, 0xFB,
-	0xCF, 0xFC, 0xCC, 0xFD, 0xFD, 0xFE, 0x12, 0x00, 0x00, 0x01, 0xD6, 0x01,
-	0xA4, 0x02, 0x34, 0x03, 0x77, 0x03, 0x96, 0x03, 0xA1, 0x03, 0x91, 0x03,
-	0x4A, 0x03, 0xAD, 0x02, 0xCB, 0x01, 0xC8, 0x00, 0xCA, 0xFF, 0xA7, 0xFE,
-	0x40, 0xFD, 0xF1, 0xFB, 0xC8, 0xFA, 0xD0, 0xF9, 0x0B, 0xF9, 0x63, 0xF8,
-	0xBC, 0xF7, 0x13, 0xF7, 0x8A, 0xF6, 0x63, 0xF6, 0x73, 0xF6, 0xDD, 0xF6,
-	0x75, 0xF7, 0x3A, 0xF8, 0x2E, 0xF9, 0x84, 0xFA, 0x51, 0xFC, 0x24, 0xFE,
-	0x18, 0x00, 0x33, 0x02, 0x84, 0x04, 0xD5, 0x06, 0x50, 0x09, 0xA8, 0x0B,
-	0xD9, 0x0D, 0xE0, 0x0F, 0xC4, 0x11, 0x5A, 0x13, 0x8E, 0x14, 0x93, 0x15,
-	0x61, 0x16, 0x3E, 0x17, 0x07, 0x18, 0x67, 0x18, 0x5D, 0x18, 0x2E, 0x18,
-	0xCB, 0x17, 0xBE, 0x16, 0x07, 0x15, 0x3E, 0x13, 0x87, 0x11, 0xB5, 0x0F,
-	0xFE, 0x0D, 0x75, 0x0C, 0x2A, 0x0B, 0x2D, 0x0A, 0x5A, 0x09, 0x3E, 0x08,
-	0xAF, 0x06, 0xFF, 0x04, 0xA9, 0x03, 0x99, 0x02, 0xC3, 0x01, 0x53, 0x01,
-	0x72, 0x01, 0x22, 0x02, 0x35, 0x03, 0x1B, 0x04, 0xD8, 0x04, 0xC0, 0x05,
-	0xEF, 0x06, 0xFA, 0x07, 0xE8, 0x08, 0xF5, 0x09, 0x1E, 0x0B, 0x32, 0x0C,
-	0xFE, 0x0C, 0xAF, 0x0D, 0x5C, 0x0E, 0x08, 0x0F, 0x7A, 0x0F, 0x7A, 0x0F,
-	0x1B, 0x0F, 0xBE, 0x0E, 0x66, 0x0E, 0xA6, 0x0D, 0x7F, 0x0C, 0x2D, 0x0B,
-	0xD1, 0x09, 0x58, 0x08, 0xAB, 0x06, 0xC5, 0x04, 0xD0, 0x02, 0xEE, 0x00,
-	0x5B, 0xFF, 0xF9, 0xFD, 0xA3, 0xFC, 0x85, 0xFB, 0x70, 0xFA, 0x4F, 0xF9,
-	0x35, 0xF8, 0x6A, 0xF7, 0xCA, 0xF6, 0x5D, 0xF6, 0x13, 0xF6, 0xDF, 0xF5,
-	0xD5, 0xF5, 0x27, 0xF6, 0xAC, 0xF6, 0x2A, 0xF7, 0x74, 0xF7, 0xE1, 0xF7,
-	0x48, 0xF8, 0x91, 0xF8, 0xB8, 0xF8, 0x70, 0xF8, 0xE7, 0xF7, 0x0D, 0xF7,
-	0x26, 0xF6, 0xEF, 0xF4, 0x7F, 0xF3, 0xC4, 0xF1, 0xC0, 0xEF, 0x87, 0xED,
-	0x1D, 0xEB, 0xA6, 0xE8, 0xD6, 0xE5, 0x92, 0xE2, 0x39, 0xDF, 0x33, 0xDC,
-	0x09, 0xDA, 0x74, 0xD8, 0x2C, 0xD7, 0xA9, 0xD5, 0x2F, 0xD4, 0x2A, 0xD3,
-	0xF9, 0xD2, 0xF0, 0xD2, 0xF9, 0xD2, 0xAB, 0xD3, 0xA1, 0xD5, 0x99, 0xD8,
-	0xE4, 0xDB, 0x85, 0xDF, 0x82, 0xE3, 0xBC, 0xE7, 0xFA, 0xEB, 0x25, 0xF0,
-	0x6C, 0xF4, 0xF0, 0xF8, 0xE2, 0xFD, 0xED, 0x02, 0xC1, 0x07, 0x62, 0x0C,
-	0xD1, 0x10, 0x02, 0x15, 0x6D, 0x18, 0xC1, 0x1A, 0x68, 0x1C, 0xA7, 0x1D,
-	0xE1, 0x1E, 0xDF, 0x1F, 0x44, 0x20, 0x48, 0x20, 0xEE, 0x1F, 0xF9, 0x1E,
-	0x03, 0x1D, 0x79, 0x1A, 0x9A, 0x17, 0x85, 0x14, 0x5F, 0x11, 0x5F, 0x0E,
-	0xA1, 0x0B, 0x04, 0x09, 0x7A, 0x06, 0xF7, 0x03, 0x42, 0x01, 0x8C, 0xFE,
-	0x2E, 0xFC, 0x3B, 0xFA, 0xC5, 0xF8, 0xA8, 0xF7, 0xC8, 0xF6, 0x56, 0xF6,
-	0x80, 0xF6, 0x12, 0xF7, 0xC2, 0xF7, 0x6E, 0xF8, 0x46, 0xF9, 0x3F, 0xFA,
-	0x6F, 0xFB, 0xBB, 0xFC, 0x15, 0xFE, 0x5C, 0xFF, 0xBA, 0x00, 0x18, 0x02,
-	0x34, 0x03, 0x0D, 0x04, 0xBB, 0x04, 0x2E, 0x05, 0x47, 0x05, 0xE8, 0x04,
-	0x8F, 0x04, 0x3C, 0x04, 0xE7, 0x03, 0x24, 0x03, 0x05, 0x02, 0x8E, 0x00,
-	0xFA, 0xFE, 0x81, 0xFD, 0x03, 0xFC, 0x83, 0xFA, 0x1F, 0xF9, 0x06, 0xF8,
-	0x03, 0xF7, 0x2D, 0xF6, 0x8A, 0xF5, 0x02, 0xF5, 0xA9, 0xF4, 0x8D, 0xF4,
-	0xA0, 0xF4, 0x15, 0xF5, 0x04, 0xF6, 0x41, 0xF7, 0x9E, 0xF8, 0x4C, 0xFA,
-	0x3E, 0xFC, 0x3B, 0xFE, 0x4B, 0x00, 0x65, 0x02, 0x75, 0x04, 0x93, 0x06,
-	0xA7, 0x08, 0xBC, 0x0A, 0xDB, 0x0C, 0xCB, 0x0E, 0xB2, 0x10, 0x15, 0x12,
-	0xFD, 0x12, 0xAD, 0x13, 0x30, 0x14, 0x66, 0x14, 0x61, 0x14, 0x2C, 0x14,
-	0xB7, 0x13, 0x0C, 0x13, 0x44, 0x12, 0x4E, 0x11, 0xF0, 0x0F, 0x68, 0x0E,
-	0xDE, 0x0C, 0x90, 0x0B, 0x51, 0x0A, 0x3B, 0x09, 0x3F, 0x08, 0xAC, 0x07,
-	0x7C, 0x07, 0x59, 0x07, 0x15, 0x07, 0x0B, 0x07, 0x68, 0x07, 0xA1, 0x07,
-	0x84, 0x07, 0xA8, 0x07, 0x5D, 0x08, 0x87, 0x09, 0xFA, 0x0A, 0x72, 0x0C,
-	0xA0, 0x0D, 0xD9, 0x0E, 0x2C, 0x10, 0x19, 0x11, 0x80, 0x11, 0xA4, 0x11,
-	0xAB, 0x11, 0xA7, 0x11, 0x82, 0x11, 0x40, 0x11, 0xD1, 0x10, 0x60, 0x10,
-	0xB7, 0x0F, 0x8D, 0x0E, 0xE8, 0x0C, 0x5C, 0x0B, 0xF1, 0x09, 0x53, 0x08,
-	0x65, 0x06, 0x68, 0x04, 0xC6, 0x02, 0x38, 0x01, 0x89, 0xFF, 0xB0, 0xFD,
-	0xEE, 0xFB, 0x75, 0xFA, 0x5E, 0xF9, 0x83, 0xF8, 0xEB, 0xF7, 0xB7, 0xF7,
-	0xD6, 0xF7, 0xDC, 0xF7, 0xED, 0xF7, 0x2E, 0xF8, 0x73, 0xF8, 0xC2, 0xF8,
-	0x31, 0xF9, 0xCF, 0xF9, 0xA7, 0xFA, 0xBD, 0xFB, 0xE1, 0xFC, 0xCC, 0xFD,
-	0x73, 0xFE, 0xE0, 0xFE, 0x0A, 0xFF, 0xD4, 0xFE, 0x5C, 0xFE, 0xA8, 0xFD,
-	0xB8, 0xFC, 0x5A, 0xFB, 0xAE, 0xF9, 0xB9, 0xF7, 0x5A, 0xF5, 0xAE, 0xF2,
-	0xB6, 0xEF, 0x8D, 0xEC, 0x48, 0xE9, 0xB1, 0xE5, 0x05, 0xE2, 0x1D, 0xDE,
-	0x19, 0xDA, 0x74, 0xD6, 0xB2, 0xD3, 0x09, 0xD2, 0xA8, 0xD0, 0x01, 0xCF,
-	0x9A, 0xCD, 0x2C, 0xCD, 0x4E, 0xCD, 0x86, 0xCD, 0xDF, 0xCD, 0x52, 0xCF,
-	0x17, 0xD2, 0xB1, 0xD5, 0x83, 0xD9, 0x55, 0xDD, 0xCB, 0xE1, 0x0A, 0xE7,
-	0x51, 0xEC, 0xF7, 0xF0, 0x91, 0xF5, 0xDC, 0xFA, 0x9D, 0x00, 0x37, 0x06,
-	0xFF, 0x0A, 0x52, 0x0F, 0xBA, 0x13, 0xD2, 0x17, 0xF7, 0x1A, 0xB4, 0x1C,
-	0xCB, 0x1D, 0x24, 0x1F, 0x92, 0x20, 0x2B, 0x21, 0xCB, 0x20, 0x46, 0x20,
-	0xB2, 0x1F, 0xB7, 0x1E, 0x64, 0x1C, 0x0F, 0x19, 0x86, 0x15, 0x6B, 0x12,
-	0x6F, 0x0F, 0x44, 0x0C, 0x2D, 0x09, 0xB8, 0x06, 0x99, 0x04, 0x5A, 0x02,
-	0xCA, 0xFF, 0x44, 0xFD, 0x63, 0xFB, 0x1C, 0xFA, 0x11, 0xF9, 0x05, 0xF8,
-	0x5E, 0xF7, 0x8E, 0xF7, 0x45, 0xF8, 0x15, 0xF9, 0xB9, 0xF9, 0x78, 0xFA,
-	0x98, 0xFB, 0x17, 0xFD, 0x81, 0xFE, 0xC0, 0xFF, 0xE6, 0x00, 0x46, 0x02,
-	0x9A, 0x03, 0x9C, 0x04, 0x30, 0x05, 0xA0, 0x05, 0x12, 0x06, 0x1E, 0x06,
-	0xBE, 0x05, 0x13, 0x05, 0x75, 0x04, 0xD9, 0x03, 0x0F, 0x03, 0xDB, 0x01,
-	0x79, 0x00, 0x0C, 0xFF, 0x94, 0xFD, 0xE0, 0xFB, 0xDA, 0xF9, 0x06, 0xF8,
-	0xC2, 0xF6, 0xD1, 0xF5, 0x08, 0xF5, 0x46, 0xF4, 0xBC, 0xF3, 0x89, 0xF3,
-	0xAC, 0xF3, 0x01, 0xF4, 0x46, 0xF4, 0xF7, 0xF4, 0x0F, 0xF6, 0xA0, 0xF7,
-	0x7B, 0xF9, 0x5B, 0xFB, 0x72, 0xFD, 0xB3, 0xFF, 0xF3, 0x01, 0x3E, 0x04,
-	0x75, 0x06, 0xCD, 0x08, 0x4B, 0x0B, 0x9B, 0x0D, 0xA0, 0x0F, 0x9D, 0x11,
-	0x69, 0x13, 0xE3, 0x14, 0x13, 0x16, 0xD8, 0x16, 0x49, 0x17, 0x69, 0x17,
-	0x55, 0x17, 0x09, 0x17, 0x60, 0x16, 0x9E, 0x15, 0xB7, 0x14, 0x9F, 0x13,
-	0x50, 0x12, 0x88, 0x10, 0x81, 0x0E, 0x8C, 0x0C, 0xA9, 0x0A, 0xF4, 0x08,
-	0x72, 0x07, 0x22, 0x06, 0xE0, 0x04, 0xBF, 0x03, 0xB6, 0x02, 0xE8, 0x01,
-	0x22, 0x01, 0xAC, 0x00, 0x90, 0x00, 0xB7, 0x00, 0x16, 0x01, 0xCC, 0x01,
-	0xB0, 0x02, 0xA2, 0x03, 0x6D, 0x04, 0x36, 0x05, 0x47, 0x06, 0x9F, 0x07,
-	0x14, 0x09, 0x92, 0x0A, 0xCB, 0x0B, 0xFF, 0x0C, 0x1F, 0x0E, 0x13, 0x0F,
-	0xD3, 0x0F, 0x4A, 0x10, 0x94, 0x10, 0xA9, 0x10, 0x7C, 0x10, 0x00, 0x10,
-	0x45, 0x0F, 0x6B, 0x0E, 0xB3, 0x0D, 0xAA, 0x0C, 0x62, 0x0B, 0x14, 0x0A,
-	0xAC, 0x08, 0x1B, 0x07, 0x46, 0x05, 0x75, 0x03, 0xB6, 0x01, 0x41, 0x00,
-	0xDA, 0xFE, 0x6E, 0xFD, 0x0A, 0xFC, 0xEB, 0xFA, 0x12, 0xFA, 0x78, 0xF9,
-	0xF9, 0xF8, 0x9D, 0xF8, 0x8C, 0xF8, 0xD7, 0xF8, 0x25, 0xF9, 0x6C, 0xF9,
-	0xE1, 0xF9, 0x5A, 0xFA, 0xCD, 0xFA, 0x5F, 0xFB, 0xF8, 0xFB, 0xA8, 0xFC,
-	0x41, 0xFD, 0xD0, 0xFD, 0x2C, 0xFE, 0x36, 0xFE, 0x2C, 0xFE, 0x16, 0xFE,
-	0xDF, 0xFD, 0x3E, 0xFD, 0x2A, 0xFC, 0xAB, 0xFA, 0xFA, 0xF8, 0xF4, 0xF6,
-	0x9B, 0xF4, 0xEE, 0xF1, 0x22, 0xEF, 0x4A, 0xEC, 0x7D, 0xE9, 0x91, 0xE6,
-	0x6B, 0xE3, 0x2E, 0xE0, 0xC0, 0xDC, 0x67, 0xD9, 0xB9, 0xD6, 0xDE, 0xD4,
-	0x8C, 0xD3, 0x10, 0xD2, 0x9C, 0xD0, 0x06, 0xD0, 0x68, 0xD0, 0x47, 0xD1,
-	0x1B, 0xD2, 0x53, 0xD3, 0x62, 0xD5, 0x48, 0xD8, 0xB4, 0xDB, 0x4B, 0xDF,
-	0x04, 0xE3, 0x56, 0xE7, 0x39, 0xEC, 0x38, 0xF1, 0x03, 0xF6, 0xF7, 0xFA,
-	0x1E, 0x00, 0x3E, 0x05, 0xBA, 0x09, 0x78, 0x0D, 0xF2, 0x10, 0x82, 0x14,
-	0xF8, 0x17, 0x87, 0x1A, 0xFC, 0x1B, 0x32, 0x1D, 0xA6, 0x1E, 0xE1, 0x1F,
-	0x06, 0x20, 0x5A, 0x1F, 0x4F, 0x1E, 0xF6, 0x1C, 0xFE, 0x1A, 0x66, 0x18,
-	0x6B, 0x15, 0x73, 0x12, 0xB0, 0x0F, 0xFB, 0x0C, 0x3B, 0x0A, 0x90, 0x07,
-	0x25, 0x05, 0xCE, 0x02, 0x46, 0x00, 0x88, 0xFD, 0x49, 0xFB, 0xB8, 0xF9,
-	0xD2, 0xF8, 0x16, 0xF8, 0x66, 0xF7, 0xF6, 0xF6, 0x22, 0xF7, 0xBE, 0xF7,
-	0x6D, 0xF8, 0x20, 0xF9, 0x3A, 0xFA, 0x8E, 0xFB, 0x24, 0xFD, 0xD6, 0xFE,
-	0x61, 0x00, 0xB2, 0x01, 0x08, 0x03, 0x24, 0x04, 0xDB, 0x04, 0x8B, 0x05,
-	0x5E, 0x06, 0x14, 0x07, 0x4E, 0x07, 0x32, 0x07, 0xFB, 0x06, 0xA8, 0x06,
-	0x2F, 0x06, 0x51, 0x05, 0x0C, 0x04, 0x76, 0x02, 0xE7, 0x00, 0x5C, 0xFF,
-	0xD3, 0xFD, 0x1E, 0xFC, 0x88, 0xFA, 0x2B, 0xF9, 0x09, 0xF8, 0x09, 0xF7,
-	0x31, 0xF6, 0x7E, 0xF5, 0x08, 0xF5, 0xBE, 0xF4, 0xB8, 0xF4, 0x16, 0xF5,
-	0xB9, 0xF5, 0x90, 0xF6, 0x8A, 0xF7, 0x94, 0xF8, 0xFA, 0xF9, 0xFE, 0xFB,
-	0x4A, 0xFE, 0x70, 0x00, 0x6E, 0x02, 0xC0, 0x04, 0x12, 0x07, 0x38, 0x09,
-	0x15, 0x0B, 0xED, 0x0C, 0xDC, 0x0E, 0xC5, 0x10, 0x57, 0x12, 0xAD, 0x13,
-	0xDA, 0x14, 0xCB, 0x15, 0x44, 0x16, 0x2A, 0x16, 0xE5, 0x15, 0x96, 0x15,
-	0x54, 0x15, 0xCF, 0x14, 0xDF, 0x13, 0xD5, 0x12, 0xAF, 0x11, 0x58, 0x10,
-	0xAB, 0x0E, 0xC7, 0x0C, 0xED, 0x0A, 0x73, 0x09, 0x75, 0x08, 0xE6, 0x07,
-	0x45, 0x07, 0x9C, 0x06, 0x1F, 0x06, 0xB1, 0x05, 0x18, 0x05, 0x3C, 0x04,
-	0x94, 0x03, 0x7A, 0x03, 0xCF, 0x03, 0x7B, 0x04, 0x7C, 0x05, 0xC1, 0x06,
-	0x2F, 0x08, 0x7D, 0x09, 0x80, 0x0A, 0x35, 0x0B, 0xCA, 0x0B, 0x1B, 0x0C,
-	0x5B, 0x0C, 0x98, 0x0C, 0x04, 0x0D, 0x7E, 0x0D, 0x06, 0x0E, 0x73, 0x0E,
-	0x59, 0x0E, 0xD1, 0x0D, 0x09, 0x0D, 0x21, 0x0C, 0x03, 0x0B, 0xB7, 0x09,
-	0x63, 0x08, 0x1B, 0x07, 0xDD, 0x05, 0x59, 0x04, 0xB4, 0x02, 0xFB, 0x00,
-	0x55, 0xFF, 0xC3, 0xFD, 0x62, 0xFC, 0x30, 0xFB, 0x6D, 0xFA, 0xDB, 0xF9,
-	0x57, 0xF9, 0xE3, 0xF8, 0x90, 0xF8, 0x39, 0xF8, 0x03, 0xF8, 0xBD, 0xF7,
-	0xB9, 0xF7, 0x12, 0xF8, 0xAA, 0xF8, 0x70, 0xF9, 0x72, 0xFA, 0x7C, 0xFB,
-	0x76, 0xFC, 0x20, 0xFD, 0x9A, 0xFD, 0xB5, 0xFD, 0x92, 0xFD, 0x27, 0xFD,
-	0xB1, 0xFC, 0x31, 0xFC, 0x81, 0xFB, 0x94, 0xFA, 0x2F, 0xF9, 0x84, 0xF7,
-	0x83, 0xF5, 0x1B, 0xF3, 0x71, 0xF0, 0x74, 0xED, 0x85, 0xEA, 0x86, 0xE7,
-	0x49, 0xE4, 0xC6, 0xE0, 0x25, 0xDD, 0xC3, 0xD9, 0x08, 0xD7, 0xF3, 0xD4,
-	0x2C, 0xD3, 0x4F, 0xD1, 0x04, 0xD0, 0xBE, 0xCF, 0xF4, 0xCF, 0x0D, 0xD0,
-	0x50, 0xD0, 0x95, 0xD1, 0xD7, 0xD3, 0xCD, 0xD6, 0xE7, 0xD9, 0x3B, 0xDD,
-	0x48, 0xE1, 0x20, 0xE6, 0x14, 0xEB, 0xB1, 0xEF, 0x86, 0xF4, 0xD8, 0xF9,
-	0x3B, 0xFF, 0x42, 0x04, 0xB3, 0x08, 0xEA, 0x0C, 0x0B, 0x11, 0x12, 0x15,
-	0x53, 0x18, 0xBB, 0x1A, 0xA9, 0x1C, 0xAE, 0x1E, 0x1E, 0x20, 0x89, 0x20,
-	0x38, 0x20, 0xA0, 0x1F, 0x0C, 0x1F, 0xDB, 0x1D, 0xB9, 0x1B, 0xCB, 0x18,
-	0x15, 0x16, 0xA6, 0x13, 0xE1, 0x10, 0x8D, 0x0D, 0x44, 0x0A, 0x5F, 0x07,
-	0x93, 0x04, 0xBD, 0x01, 0xEA, 0xFE, 0x86, 0xFC, 0xDC, 0xFA, 0xAD, 0xF9,
-	0x8E, 0xF8, 0x84, 0xF7, 0xCB, 0xF6, 0xA8, 0xF6, 0xDE, 0xF6, 0x13, 0xF7,
-	0x84, 0xF7, 0x86, 0xF8, 0x2D, 0xFA, 0x26, 0xFC, 0xE7, 0xFD, 0x7B, 0xFF,
-	0x1A, 0x01, 0xE8, 0x02, 0x75, 0x04, 0x94, 0x05, 0x73, 0x06, 0x80, 0x07,
-	0x92, 0x08, 0x47, 0x09, 0xAD, 0x09, 0xB3, 0x09, 0x84, 0x09, 0x16, 0x09,
-	0x39, 0x08, 0xDE, 0x06, 0x7B, 0x05, 0x14, 0x04, 0xA2, 0x02, 0xDA, 0x00,
-	0xDE, 0xFE, 0x04, 0xFD, 0x63, 0xFB, 0xBA, 0xF9, 0x0B, 0xF8, 0x6B, 0xF6,
-	0x01, 0xF5, 0x17, 0xF4, 0x8D, 0xF3, 0x18, 0xF3, 0xDA, 0xF2, 0x11, 0xF3,
-	0xAC, 0xF3, 0x7D, 0xF4, 0x52, 0xF5, 0x5E, 0xF6, 0xDF, 0xF7, 0xEA, 0xF9,
-	0x29, 0xFC, 0x2D, 0xFE, 0x35, 0x00, 0xBC, 0x02, 0x60, 0x05, 0x88, 0x07,
-	0x73, 0x09, 0x7A, 0x0B, 0x9F, 0x0D, 0x99, 0x0F, 0x46, 0x11, 0x8A, 0x12,
-	0xAD, 0x13, 0xA7, 0x14, 0x4E, 0x15, 0x69, 0x15, 0x29, 0x15, 0xE6, 0x14,
-	0x74, 0x14, 0xDB, 0x13, 0x12, 0x13, 0x01, 0x12, 0xEB, 0x10, 0xC0, 0x0F,
-	0x75, 0x0E, 0xE7, 0x0C, 0x6A, 0x0B, 0x86, 0x0A, 0x28, 0x0A, 0x8D, 0x09,
-	0xB9, 0x08, 0x11, 0x08, 0x91, 0x07, 0x20, 0x07, 0xA2, 0x06, 0x1F, 0x06,
-	0xEC, 0x05, 0x63, 0x06, 0x2E, 0x07, 0x04, 0x08, 0xDE, 0x08, 0xC8, 0x09,
-	0xBF, 0x0A, 0x83, 0x0B, 0x2E, 0x0C, 0xCD, 0x0C, 0x72, 0x0D, 0xF1, 0x0D,
-	0x6F, 0x0E, 0xE1, 0x0E, 0x3D, 0x0F, 0x78, 0x0F, 0xAC, 0x0F, 0x6E, 0x0F,
-	0xBE, 0x0E, 0x03, 0x0E, 0x41, 0x0D, 0x78, 0x0C, 0x86, 0x0B, 0x78, 0x0A,
-	0x50, 0x09, 0x37, 0x08, 0xEF, 0x06, 0x5F, 0x05, 0xA2, 0x03, 0xE7, 0x01,
-	0x5D, 0x00, 0x1F, 0xFF, 0x0F, 0xFE, 0x59, 0xFD, 0xDC, 0xFC, 0x58, 0xFC,
-	0xC7, 0xFB, 0x2A, 0xFB, 0xA6, 0xFA, 0x67, 0xFA, 0x2E, 0xFA, 0x0B, 0xFA,
-	0x10, 0xFA, 0x7B, 0xFA, 0x0F, 0xFB, 0xBB, 0xFB, 0x5D, 0xFC, 0xC9, 0xFC,
-	0x13, 0xFD, 0x4B, 0xFD, 0x6B, 0xFD, 0x60, 0xFD, 0x20, 0xFD, 0xC2, 0xFC,
-	0x4C, 0xFC, 0xAA, 0xFB, 0xBE, 0xFA, 0x9C, 0xF9, 0x3E, 0xF8, 0x8F, 0xF6,
-	0x6A, 0xF4, 0xE1, 0xF1, 0x35, 0xEF, 0x7F, 0xEC, 0xBF, 0xE9, 0xD1, 0xE6,
-	0xA4, 0xE3, 0x74, 0xE0, 0x65, 0xDD, 0x2C, 0xDA, 0xE2, 0xD6, 0x3D, 0xD4,
-	0x7C, 0xD2, 0x46, 0xD1, 0x24, 0xD0, 0x99, 0xCF, 0xA1, 0xCF, 0xDF, 0xCF,
-	0x48, 0xD0, 0x0C, 0xD1, 0x8D, 0xD2, 0xCB, 0xD4, 0xE8, 0xD7, 0x7E, 0xDB,
-	0x3B, 0xDF, 0x61, 0xE3, 0x27, 0xE8, 0x02, 0xED, 0xAE, 0xF1, 0x67, 0xF6,
-	0x4E, 0xFB, 0x53, 0x00, 0x45, 0x05, 0xD8, 0x09, 0xF6, 0x0D, 0xD0, 0x11,
-	0x89, 0x15, 0xC1, 0x18, 0x14, 0x1B, 0xD5, 0x1C, 0x5F, 0x1E, 0x81, 0x1F,
-	0x11, 0x20, 0x1F, 0x20, 0xC3, 0x1F, 0x0C, 0x1F, 0xAF, 0x1D, 0xD2, 0x1B,
-	0x69, 0x19, 0xEB, 0x16, 0x33, 0x14, 0x52, 0x11, 0x62, 0x0E, 0x9D, 0x0B,
-	0x21, 0x09, 0xAD, 0x06, 0x13, 0x04, 0xA4, 0x01, 0x77, 0xFF, 0xA1, 0xFD,
-	0x55, 0xFC, 0x4B, 0xFB, 0x63, 0xFA, 0xD3, 0xF9, 0xBE, 0xF9, 0xCE, 0xF9,
-	0xF6, 0xF9, 0x92, 0xFA, 0x93, 0xFB, 0xB0, 0xFC, 0xE6, 0xFD, 0x63, 0xFF,
-	0xE4, 0x00, 0x41, 0x02, 0x84, 0x03, 0x94, 0x04, 0x6B, 0x05, 0x22, 0x06,
-	0x04, 0x07, 0xB0, 0x07, 0xEC, 0x07, 0xD3, 0x07, 0x8B, 0x07, 0x01, 0x07,
-	0x45, 0x06, 0x3A, 0x05, 0xFD, 0x03, 0xA8, 0x02, 0x42, 0x01, 0xCB, 0xFF,
-	0x25, 0xFE, 0x68, 0xFC, 0x9C, 0xFA, 0xC5, 0xF8, 0x09, 0xF7, 0x7F, 0xF5,
-	0x69, 0xF4, 0xA8, 0xF3, 0x2C, 0xF3, 0xB8, 0xF2, 0x62, 0xF2, 0x74, 0xF2,
-	0x02, 0xF3, 0xB7, 0xF3, 0x83, 0xF4, 0xA1, 0xF5, 0x2A, 0xF7, 0x13, 0xF9,
-	0x46, 0xFB, 0x82, 0xFD, 0xBF, 0xFF, 0x04, 0x02, 0x3E, 0x04, 0x4B, 0x06,
-	0x5F, 0x08, 0x99, 0x0A, 0xCD, 0x0C, 0xB8, 0x0E, 0x61, 0x10, 0xCD, 0x11,
-	0x12, 0x13, 0xFB, 0x13, 0x92, 0x14, 0xC9, 0x14, 0x85, 0x14, 0x20, 0x14,
-	0xA4, 0x13, 0x07, 0x13, 0x1E, 0x12, 0xEE, 0x10, 0xCA, 0x0F, 0x6F, 0x0E,
-	0xBA, 0x0C, 0xD2, 0x0A, 0xFB, 0x08, 0x42, 0x07, 0xB2, 0x05, 0x0C, 0x04,
-	0xA9, 0x02, 0xA8, 0x01, 0x2C, 0x01, 0x7B, 0x01, 0x43, 0x02, 0xD3, 0x02,
-	0x1E, 0x03, 0xCB, 0x03, 0xF2, 0x04, 0x0E, 0x06, 0xE6, 0x06, 0xF2, 0x07,
-	0xD5, 0x09, 0xFD, 0x0B, 0x34, 0x0E, 0x57, 0x10, 0x67, 0x12, 0x43, 0x14,
-	0xC6, 0x15, 0xEE, 0x16, 0x9E, 0x17, 0x11, 0x18, 0x9B, 0x18, 0xF8, 0x18,
-	0xDA, 0x18, 0x51, 0x18, 0x92, 0x17, 0xC2, 0x16, 0x68, 0x15, 0x4D, 0x13,
-	0xC3, 0x10, 0x79, 0x0E, 0x7F, 0x0C, 0x6B, 0x0A, 0x16, 0x08, 0xB3, 0x05,
-	0x52, 0x03, 0xEB, 0x00, 0x76, 0xFE, 0xFE, 0xFB, 0xBA, 0xF9, 0xD6, 0xF7,
-	0x67, 0xF6, 0x56, 0xF5, 0xAE, 0xF4, 0x8A, 0xF4, 0xB0, 0xF4, 0xE6, 0xF4,
-	0x04, 0xF5, 0x44, 0xF5, 0xE9, 0xF5, 0xE9, 0xF6, 0x19, 0xF8, 0x40, 0xF9,
-	0x79, 0xFA, 0xFE, 0xFB, 0xA5, 0xFD, 0x24, 0xFF, 0x5C, 0x00, 0x49, 0x01,
-	0xF2, 0x01, 0x3E, 0x02, 0x51, 0x02, 0x0E, 0x02, 0x87, 0x01, 0xBE, 0x00,
-	0xA4, 0xFF, 0x18, 0xFE, 0x32, 0xFC, 0xC5, 0xF9, 0x01, 0xF7, 0xC1, 0xF3,
-	0x29, 0xF0, 0x41, 0xEC, 0x4C, 0xE8, 0x83, 0xE4, 0xBA, 0xE0, 0xAE, 0xDC,
-	0x6E, 0xD8, 0x42, 0xD4, 0xA9, 0xD0, 0xD5, 0xCD, 0xBD, 0xCB, 0x02, 0xCA,
-	0x8A, 0xC8, 0xD9, 0xC7, 0x13, 0xC8, 0xD7, 0xC8, 0x8E, 0xC9, 0xB6, 0xCA,
-	0xD8, 0xCC, 0x1F, 0xD0, 0x12, 0xD4, 0x4B, 0xD8, 0xF8, 0xDC, 0x65, 0xE2,
-	0x6E, 0xE8, 0x46, 0xEE, 0xAE, 0xF3, 0xEB, 0xF8, 0x88, 0xFE, 0x34, 0x04,
-	0x2C, 0x09, 0xC6, 0x0D, 0x24, 0x12, 0x9B, 0x16, 0xEC, 0x1A, 0x65, 0x1E,
-	0x88, 0x20, 0xBC, 0x21, 0xD9, 0x22, 0x8D, 0x23, 0x3C, 0x23, 0x3B, 0x22,
-	0x12, 0x21, 0xDD, 0x1F, 0x3B, 0x1E, 0xC7, 0x1B, 0x9F, 0x18, 0x5F, 0x15,
-	0x3E, 0x12, 0xF1, 0x0E, 0x58, 0x0B, 0xE5, 0x07, 0x1D, 0x05, 0xC8, 0x02,
-	0x68, 0x00, 0x0A, 0xFE, 0xD5, 0xFB, 0x35, 0xFA, 0x3A, 0xF9, 0x81, 0xF8,
-	0xAB, 0xF7, 0x17, 0xF7, 0x75, 0xF7, 0xAA, 0xF8, 0xDA, 0xF9, 0x07, 0xFB,
-	0x72, 0xFC, 0x36, 0xFE, 0x14, 0x00, 0xA5, 0x01, 0xF4, 0x02, 0x54, 0x04,
-	0xEB, 0x05, 0x4B, 0x07, 0x42, 0x08, 0xF4, 0x08, 0xA8, 0x09, 0x5D, 0x0A,
-	0x93, 0x0A, 0x05, 0x0A, 0xFF, 0x08, 0xF0, 0x07, 0xD6, 0x06, 0x64, 0x05,
-	0x85, 0x03, 0x60, 0x01, 0x80, 0xFF, 0x98, 0xFD, 0x7C, 0xFB, 0x2B, 0xF9,
-	0xDF, 0xF6, 0xDC, 0xF4, 0x17, 0xF3, 0x73, 0xF1, 0x09, 0xF0, 0xFD, 0xEE,
-	0x8C, 0xEE, 0x5C, 0xEE, 0x5A, 0xEE, 0x95, 0xEE, 0x14, 0xEF, 0x12, 0xF0,
-	0x94, 0xF1, 0x58, 0xF3, 0x37, 0xF5, 0x67, 0xF7, 0x1B, 0xFA, 0x21, 0xFD,
-	0x18, 0x00, 0xEB, 0x02, 0xAE, 0x05, 0x80, 0x08, 0x35, 0x0B, 0xB3, 0x0D,
-	0xE2, 0x0F, 0xDE, 0x11, 0xD7, 0x13, 0x8C, 0x15, 0xAD, 0x16, 0x7A, 0x17,
-	0x08, 0x18, 0x67, 0x18, 0x6C, 0x18, 0xF0, 0x17, 0x2B, 0x17, 0x29, 0x16,
-	0xF5, 0x14, 0x87, 0x13, 0xE7, 0x11, 0x28, 0x10, 0x88, 0x0E, 0xEB, 0x0C,
-	0x49, 0x0B, 0x93, 0x09, 0x10, 0x08, 0xD3, 0x06, 0x9A, 0x05, 0x85, 0x04,
-	0x9A, 0x03, 0x16, 0x03, 0x0C, 0x03, 0x56, 0x03, 0x8B, 0x03, 0xC1, 0x03,
-	0x3D, 0x04, 0x0B, 0x05, 0xFA, 0x05, 0x05, 0x07, 0xFA, 0x07, 0x1E, 0x09,
-	0x74, 0x0A, 0xE9, 0x0B, 0x28, 0x0D, 0x13, 0x0E, 0xFA, 0x0E, 0xC9, 0x0F,
-	0x4F, 0x10, 0x89, 0x10, 0xA5, 0x10, 0xAB, 0x10, 0xB1, 0x10, 0xA6, 0x10,
-	0x2F, 0x10, 0x40, 0x0F, 0x40, 0x0E, 0x42, 0x0D, 0xD1, 0x0B, 0xF9, 0x09,
-	0x26, 0x08, 0xB7, 0x06, 0x63, 0x05, 0x0E, 0x04, 0x6D, 0x02, 0xCF, 0x00,
-	0x6C, 0xFF, 0x4D, 0xFE, 0x05, 0xFD, 0xA6, 0xFB, 0xA2, 0xFA, 0xFD, 0xF9,
-	0x8F, 0xF9, 0x48, 0xF9, 0x28, 0xF9, 0x54, 0xF9, 0xA2, 0xF9, 0x09, 0xFA,
-	0x6A, 0xFA, 0xDB, 0xFA, 0x82, 0xFB, 0x4B, 0xFC, 0x1D, 0xFD, 0xD1, 0xFD,
-	0x86, 0xFE, 0x54, 0xFF, 0x10, 0x00, 0x97, 0x00, 0xCE, 0x00, 0xC0, 0x00,
-	0xAA, 0x00, 0x8D, 0x00, 0x22, 0x00, 0xA2, 0xFF, 0xFE, 0xFE, 0x44, 0xFE,
-	0x3B, 0xFD, 0xF6, 0xFB, 0x59, 0xFA, 0x93, 0xF8, 0x7F, 0xF6, 0x3E, 0xF4,
-	0xFC, 0xF1, 0xA1, 0xEF, 0x58, 0xED, 0xEF, 0xEA, 0x70, 0xE8, 0xD7, 0xE5,
-	0x47, 0xE3, 0xD2, 0xE0, 0x46, 0xDE, 0x80, 0xDB, 0xB6, 0xD8, 0xF5, 0xD5,
-	0xC0, 0xD3, 0x8C, 0xD2, 0x26, 0xD2, 0x13, 0xD2, 0xFE, 0xD1, 0x78, 0xD2,
-	0x86, 0xD3, 0xB8, 0xD4, 0x05, 0xD6, 0xB6, 0xD7, 0x3A, 0xDA, 0x3B, 0xDD,
-	0x80, 0xE0, 0x06, 0xE4, 0xDB, 0xE7, 0x4E, 0xEC, 0xE7, 0xF0, 0x45, 0xF5,
-	0x57, 0xF9, 0xA2, 0xFD, 0x2E, 0x02, 0x9F, 0x06, 0xDB, 0x0A, 0x61, 0x0E,
-	0x82, 0x11, 0xB8, 0x14, 0xCB, 0x17, 0xCE, 0x19, 0xBD, 0x1A, 0x92, 0x1B,
-	0x88, 0x1C, 0x06, 0x1D, 0xD5, 0x1C, 0x75, 0x1C, 0x02, 0x1C, 0x4F, 0x1B,
-	0x0C, 0x1A, 0x0E, 0x18, 0x86, 0x15, 0xE7, 0x12, 0x68, 0x10, 0xC8, 0x0D,
-	0x09, 0x0B, 0x99, 0x08, 0xA2, 0x06, 0x10, 0x05, 0x63, 0x03, 0x80, 0x01,
-	0xCA, 0xFF, 0x90, 0xFE, 0xD7, 0xFD, 0xF3, 0xFC, 0x1C, 0xFC, 0xAC, 0xFB,
-	0xDE, 0xFB, 0x57, 0xFC, 0xEB, 0xFC, 0x8C, 0xFD, 0x3C, 0xFE, 0x4A, 0xFF,
-	0x7C, 0x00, 0x79, 0x01, 0x52, 0x02, 0x65, 0x03, 0x81, 0x04, 0x5F, 0x05,
-	0xF2, 0x05, 0x3C, 0x06, 0x65, 0x06, 0x74, 0x06, 0x34, 0x06, 0x9C, 0x05,
-	0xD0, 0x04, 0x01, 0x04, 0x43, 0x03, 0x57, 0x02, 0x2F, 0x01, 0xCD, 0xFF,
-	0x4F, 0xFE, 0xC6, 0xFC, 0x00, 0xFB, 0x1E, 0xF9, 0x57, 0xF7, 0xE1, 0xF5,
-	0xC8, 0xF4, 0xE6, 0xF3, 0x31, 0xF3, 0x9E, 0xF2, 0x58, 0xF2, 0x47, 0xF2,
-	0x9E, 0xF2, 0x1A, 0xF3, 0xD5, 0xF3, 0xDD, 0xF4, 0x3A, 0xF6, 0xBB, 0xF7,
-	0x80, 0xF9, 0x75, 0xFB, 0x8C, 0xFD, 0xB0, 0xFF, 0xFE, 0x01, 0x52, 0x04,
-	0xAC, 0x06, 0x13, 0x09, 0x83, 0x0B, 0xCD, 0x0D, 0xB2, 0x0F, 0x50, 0x11,
-	0xBD, 0x12, 0x16, 0x14, 0x26, 0x15, 0xED, 0x15, 0x3A, 0x16, 0x53, 0x16,
-	0x58, 0x16, 0x61, 0x16, 0x21, 0x16, 0x80, 0x15, 0xE0, 0x14, 0x54, 0x14,
-	0x7F, 0x13, 0x49, 0x12, 0xC5, 0x10, 0x5D, 0x0F, 0x10, 0x0E, 0x95, 0x0C,
-	0xF9, 0x0A, 0xBE, 0x09, 0x10, 0x09, 0xB1, 0x08, 0x28, 0x08, 0x94, 0x07,
-	0x2A, 0x07, 0x04, 0x07, 0xE4, 0x06, 0xA9, 0x06, 0x65, 0x06, 0x7E, 0x06,
-	0x0B, 0x07, 0xCB, 0x07, 0x80, 0x08, 0x22, 0x09, 0xDB, 0x09, 0x9C, 0x0A,
-	0x3D, 0x0B, 0x97, 0x0B, 0x07, 0x0C, 0xA9, 0x0C, 0x34, 0x0D, 0xA6, 0x0D,
-	0xF0, 0x0D, 0x10, 0x0E, 0x1B, 0x0E, 0xC1, 0x0D, 0x21, 0x0D, 0x04, 0x0C,
-	0xE3, 0x0A, 0xFB, 0x09, 0x3C, 0x09, 0x5D, 0x08, 0x56, 0x07, 0x41, 0x06,
-	0x04, 0x05, 0x9A, 0x03, 0x0F, 0x02, 0x62, 0x00, 0xAC, 0xFE, 0x2C, 0xFD,
-	0x02, 0xFC, 0xFD, 0xFA, 0x34, 0xFA, 0x90, 0xF9, 0xFE, 0xF8, 0x6B, 0xF8,
-	0xDC, 0xF7, 0x80, 0xF7, 0x56, 0xF7, 0x67, 0xF7, 0x9E, 0xF7, 0xE0, 0xF7,
-	0x66, 0xF8, 0x09, 0xF9, 0xCB, 0xF9, 0x7A, 0xFA, 0x03, 0xFB, 0xA1, 0xFB,
-	0x34, 0xFC, 0xBC, 0xFC, 0x34, 0xFD, 0x99, 0xFD, 0x09, 0xFE, 0x60, 0xFE,
-	0x8B, 0xFE, 0x62, 0xFE, 0xFB, 0xFD, 0x43, 0xFD, 0x4F, 0xFC, 0x0E, 0xFB,
-	0xC1, 0xF9, 0x4A, 0xF8, 0xAF, 0xF6, 0xE7, 0xF4, 0xD5, 0xF2, 0x96, 0xF0,
-	0xF1, 0xED, 0x22, 0xEB, 0x1B, 0xE8, 0x11, 0xE5, 0x05, 0xE2, 0xEE, 0xDE,
-	0xDE, 0xDB, 0xFE, 0xD8, 0x8E, 0xD6, 0xEB, 0xD4, 0xBB, 0xD3, 0x94, 0xD2,
-	0x91, 0xD1, 0x5B, 0xD1, 0xD5, 0xD1, 0x96, 0xD2, 0x6F, 0xD3, 0xE3, 0xD4,
-	0x4F, 0xD7, 0x50, 0xDA, 0x7C, 0xDD, 0xD8, 0xE0, 0xB1, 0xE4, 0x36, 0xE9,
-	0x16, 0xEE, 0xC1, 0xF2, 0x31, 0xF7, 0xEE, 0xFB, 0xDE, 0x00, 0xC4, 0x05,
-	0x19, 0x0A, 0xDF, 0x0D, 0x57, 0x11, 0xC1, 0x14, 0xE2, 0x17, 0x3D, 0x1A,
-	0xD6, 0x1B, 0x3D, 0x1D, 0x90, 0x1E, 0x49, 0x1F, 0x3C, 0x1F, 0xB9, 0x1E,
-	0xF1, 0x1D, 0xC7, 0x1C, 0x00, 0x1B, 0xA4, 0x18, 0xE0, 0x15, 0x1F, 0x13,
-	0x91, 0x10, 0xF0, 0x0D, 0x22, 0x0B, 0x5E, 0x08, 0xFD, 0x05, 0xC8, 0x03,
-	0x92, 0x01, 0x54, 0xFF, 0x50, 0xFD, 0xAB, 0xFB, 0x7D, 0xFA, 0xB0, 0xF9,
-	0x2A, 0xF9, 0xE7, 0xF8, 0x13, 0xF9, 0xAF, 0xF9, 0x82, 0xFA, 0x64, 0xFB,
-	0x5C, 0xFC, 0x97, 0xFD, 0x1F, 0xFF, 0x85, 0x00, 0xEA, 0x01, 0x47, 0x03,
-	0xB4, 0x04, 0xF8, 0x05, 0xE8, 0x06, 0x8B, 0x07, 0xFA, 0x07, 0x53, 0x08,
-	0x6B, 0x08, 0x57, 0x08, 0xD7, 0x07, 0x1A, 0x07, 0x6C, 0x06, 0x7C, 0x05,
-	0x3C, 0x04, 0x8C, 0x02, 0xB6, 0x00, 0xD3, 0xFE, 0xF0, 0xFC, 0xFF, 0xFA,
-	0x0D, 0xF9, 0x55, 0xF7, 0xE3, 0xF5, 0xBA, 0xF4, 0xAA, 0xF3, 0xD3, 0xF2,
-	0x2F, 0xF2, 0xF4, 0xF1, 0xFA, 0xF1, 0x0A, 0xF2, 0x4E, 0xF2, 0x11, 0xF3,
-	0x4E, 0xF4, 0xF9, 0xF5, 0xB9, 0xF7, 0xA3, 0xF9, 0xE7, 0xFB, 0x6D, 0xFE,
-	0xFC, 0x00, 0x68, 0x03, 0xC9, 0x05, 0x33, 0x08, 0xA6, 0x0A, 0xE4, 0x0C,
-	0x0A, 0x0F, 0xEF, 0x10, 0x94, 0x12, 0x37, 0x14, 0x9B, 0x15, 0x55, 0x16,
-	0xBE, 0x16, 0x0F, 0x17, 0x14, 0x17, 0xAA, 0x16, 0xF4, 0x15, 0x2F, 0x15,
-	0x3F, 0x14, 0xEF, 0x12, 0x54, 0x11, 0x87, 0x0F, 0xA4, 0x0D, 0xDA, 0x0B,
-	0x07, 0x0A, 0x47, 0x08, 0x80, 0x06, 0x0E, 0x05, 0x12, 0x04, 0xA6, 0x03,
-	0x47, 0x03, 0xD6, 0x02, 0x84, 0x02, 0x27, 0x02, 0x11, 0x02, 0x60, 0x02,
-	0x51, 0x03, 0xD4, 0x04, 0x7F, 0x06, 0x17, 0x08, 0xD8, 0x09, 0x99, 0x0B,
-	0x43, 0x0D, 0x9E, 0x0E, 0xA2, 0x0F, 0x85, 0x10, 0x9C, 0x11, 0xDD, 0x12,
-	0x17, 0x14, 0x0F, 0x15, 0x87, 0x15, 0x89, 0x15, 0x52, 0x15, 0xBB, 0x14,
-	0xB1, 0x13, 0x40, 0x12, 0xC1, 0x10, 0x18, 0x0F, 0x3C, 0x0D, 0x38, 0x0B,
-	0x58, 0x09, 0x57, 0x07, 0x14, 0x05, 0x8F, 0x02, 0x0B, 0x00, 0xB7, 0xFD,
-	0xA1, 0xFB, 0xC6, 0xF9, 0x16, 0xF8, 0xA8, 0xF6, 0x7D, 0xF5, 0x96, 0xF4,
-	0xEF, 0xF3, 0x83, 0xF3, 0x18, 0xF3, 0xFA, 0xF2, 0x4F, 0xF3, 0x0A, 0xF4,
-	0x3A, 0xF5, 0x9B, 0xF6, 0x24, 0xF8, 0xA7, 0xF9, 0x1B, 0xFB, 0x8E, 0xFC,
-	0xF4, 0xFD, 0x46, 0xFF, 0x89, 0x00, 0xA4, 0x01, 0xAC, 0x02, 0xAC, 0x03,
-	0x7F, 0x04, 0x16, 0x05, 0x44, 0x05, 0xF3, 0x04, 0x1E, 0x04, 0x1F, 0x03,
-	0xD8, 0x01, 0x4F, 0x00, 0x78, 0xFE, 0x3A, 0xFC, 0xC9, 0xF9, 0x10, 0xF7,
-	0x32, 0xF4, 0x0F, 0xF1, 0x9F, 0xED, 0xF2, 0xE9, 0x24, 0xE6, 0x5F, 0xE2,
-	0x87, 0xDE, 0xEF, 0xDA, 0xA6, 0xD7, 0x9A, 0xD4, 0xD9, 0xD1, 0xAF, 0xCF,
-	0x44, 0xCE, 0x2E, 0xCD, 0x13, 0xCC, 0x68, 0xCB, 0xB3, 0xCB, 0xC1, 0xCC,
-	0x42, 0xCE, 0x65, 0xD0, 0x72, 0xD3, 0x08, 0xD7, 0xC1, 0xDA, 0x9D, 0xDE,
-	0xB9, 0xE2, 0x3A, 0xE7, 0x13, 0xEC, 0xF2, 0xF0, 0xEC, 0xF5, 0x29, 0xFB,
-	0xB1, 0x00, 0x15, 0x06, 0x01, 0x0B, 0x7A, 0x0F, 0x3F, 0x13, 0x50, 0x16,
-	0x23, 0x19, 0x7A, 0x1B, 0x19, 0x1D, 0x5C, 0x1E, 0x64, 0x1F, 0x03, 0x20,
-	0x07, 0x20, 0xB9, 0x1F, 0xF5, 0x1E, 0x79, 0x1D, 0x23, 0x1B, 0x7E, 0x18,
-	0xDE, 0x15, 0x28, 0x13, 0x70, 0x10, 0x93, 0x0D, 0xC5, 0x0A, 0x24, 0x08,
-	0x7F, 0x05, 0xD8, 0x02, 0x60, 0x00, 0x4C, 0xFE, 0x92, 0xFC, 0x49, 0xFB,
-	0x65, 0xFA, 0x19, 0xFA, 0x07, 0xFA, 0x37, 0xFA, 0x54, 0xFA, 0x96, 0xFA,
-	0x26, 0xFB, 0x29, 0xFC, 0x64, 0xFD, 0xDC, 0xFE, 0x6F, 0x00, 0x44, 0x02,
-	0x19, 0x04, 0xC3, 0x05, 0x36, 0x07, 0x5A, 0x08, 0x2C, 0x09, 0xB7, 0x09,
-	0x1B, 0x0A, 0x45, 0x0A, 0x44, 0x0A, 0x00, 0x0A, 0x84, 0x09, 0xB6, 0x08,
-	0xC3, 0x07, 0x86, 0x06, 0x26, 0x05, 0x74, 0x03, 0x74, 0x01, 0x64, 0xFF,
-	0x53, 0xFD, 0x5D, 0xFB, 0x74, 0xF9, 0x96, 0xF7, 0xF0, 0xF5, 0x7B, 0xF4,
-	0x0F, 0xF3, 0x07, 0xF2, 0x61, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0x0E, 0xF1,
-	0xAA, 0xF1, 0xCD, 0xF2, 0x50, 0xF4, 0xE7, 0xF5, 0x6A, 0xF7, 0x2D, 0xF9,
-	0x56, 0xFB, 0xE2, 0xFD, 0x67, 0x00, 0xF0, 0x02, 0x7D, 0x05, 0x2F, 0x08,
-	0xEB, 0x0A, 0x6E, 0x0D, 0xAC, 0x0F, 0xA4, 0x11, 0x67, 0x13, 0xE3, 0x14,
-	0xF8, 0x15, 0xD3, 0x16, 0x6A, 0x17, 0xA2, 0x17, 0x89, 0x17, 0x2A, 0x17,
-	0x8A, 0x16, 0xBC, 0x15, 0xB1, 0x14, 0x46, 0x13, 0x82, 0x11, 0x9A, 0x0F,
-	0xA3, 0x0D, 0xC0, 0x0B, 0xB5, 0x09, 0xAE, 0x07, 0xAA, 0x05, 0xD9, 0x03,
-	0x37, 0x02, 0x39, 0x01, 0xEA, 0x00, 0xFF, 0x00, 0xD6, 0x00, 0x7E, 0x00,
-	0x7D, 0x00, 0x0B, 0x01, 0xB3, 0x01, 0x39, 0x02, 0xEF, 0x02, 0x48, 0x04,
-	0x3A, 0x06, 0x66, 0x08, 0x7D, 0x0A, 0x57, 0x0C, 0x35, 0x0E, 0xD8, 0x0F,
-	0x1F, 0x11, 0xFF, 0x11, 0xEB, 0x12, 0xE1, 0x13, 0x99, 0x14, 0xC6, 0x14,
-	0x8F, 0x14, 0x47, 0x14, 0x10, 0x14, 0x75, 0x13, 0x1A, 0x12, 0x61, 0x10,
-	0xCE, 0x0E, 0x60, 0x0D, 0xBD, 0x0B, 0x8C, 0x09, 0x0C, 0x07, 0xA8, 0x04,
-	0x6B, 0x02, 0x1F, 0x00, 0xB1, 0xFD, 0x88, 0xFB, 0xDE, 0xF9, 0x8E, 0xF8,
-	0x6B, 0xF7, 0x64, 0xF6, 0xD4, 0xF5, 0x95, 0xF5, 0x62, 0xF5, 0x28, 0xF5,
-	0x1F, 0xF5, 0x8F, 0xF5, 0x73, 0xF6, 0x93, 0xF7, 0xC2, 0xF8, 0x02, 0xFA,
-	0xAD, 0xFB, 0x9B, 0xFD, 0x91, 0xFF, 0x4F, 0x01, 0xBC, 0x02, 0x18, 0x04,
-	0x83, 0x05, 0x8A, 0x06, 0x43, 0x07, 0xCF, 0x07, 0x2D, 0x08, 0x5C, 0x08,
-	0x1D, 0x08, 0xA0, 0x07, 0xF0, 0x06, 0x01, 0x06, 0xD1, 0x04, 0x3D, 0x03,
-	0x68, 0x01, 0x51, 0xFF, 0x29, 0xFD, 0xB4, 0xFA, 0x0D, 0xF8, 0x1A, 0xF5,
-	0x01, 0xF2, 0xEA, 0xEE, 0xD5, 0xEB, 0xB2, 0xE8, 0x93, 0xE5, 0xB0, 0xE2,
-	0xEB, 0xDF, 0x51, 0xDD, 0xCE, 0xDA, 0x42, 0xD8, 0xBB, 0xD5, 0x4F, 0xD3,
-	0x1C, 0xD1, 0x52, 0xCF, 0x5B, 0xCE, 0x35, 0xCE, 0x9B, 0xCE, 0x78, 0xCF,
-	0xE5, 0xD0, 0xCB, 0xD2, 0xCC, 0xD4, 0xEE, 0xD6, 0x79, 0xD9, 0x85, 0xDC,
-	0x9E, 0xDF, 0xFA, 0xE2, 0xCC, 0xE6, 0x53, 0xEB, 0x13, 0xF0, 0x96, 0xF4,
-	0xEB, 0xF8, 0x2F, 0xFD, 0x6E, 0x01, 0x71, 0x05, 0x1F, 0x09, 0xA1, 0x0C,
-	0xE3, 0x0F, 0xD6, 0x12, 0x37, 0x15, 0x33, 0x17, 0xC6, 0x18, 0xE5, 0x19,
-	0xB2, 0x1A, 0xB8, 0x1A, 0x20, 0x1A, 0x8F, 0x19, 0x5D, 0x19, 0xF8, 0x18,
-	0xC9, 0x17, 0x06, 0x16, 0x61, 0x14, 0xD4, 0x12, 0xDD, 0x10, 0x61, 0x0E,
-	0xD1, 0x0B, 0x98, 0x09, 0xA8, 0x07, 0x14, 0x06, 0xB5, 0x04, 0xB0, 0x03,
-	0x04, 0x03, 0x60, 0x02, 0xB5, 0x01, 0x0D, 0x01, 0xA7, 0x00, 0x90, 0x00,
-	0x85, 0x00, 0x8D, 0x00, 0xA6, 0x00, 0x3C, 0x01, 0x4E, 0x02, 0x78, 0x03,
-	0x59, 0x04, 0xF6, 0x04, 0x94, 0x05, 0x31, 0x06, 0xD2, 0x06, 0x2F, 0x07,
-	0x41, 0x07, 0x32, 0x07, 0x2A, 0x07, 0x10, 0x07, 0x9C, 0x06, 0xEE, 0x05,
-	0xF2, 0x04, 0xD2, 0x03, 0x73, 0x02, 0x07, 0x01, 0xBD, 0xFF, 0x7F, 0xFE,
-	0x6B, 0xFD, 0x1A, 0xFC, 0x97, 0xFA, 0xFF, 0xF8, 0x6E, 0xF7, 0x19, 0xF6,
-	0xDF, 0xF4, 0xBB, 0xF3, 0xCD, 0xF2, 0x6F, 0xF2, 0xB4, 0xF2, 0x2C, 0xF3,
-	0x97, 0xF3, 0x17, 0xF4, 0xC8, 0xF4, 0xBF, 0xF5, 0xDD, 0xF6, 0x1D, 0xF8,
-	0x9F, 0xF9, 0x66, 0xFB, 0x66, 0xFD, 0x72, 0xFF, 0xAA, 0x01, 0xD7, 0x03,
-	0xFA, 0x05, 0xEA, 0x07, 0xA5, 0x09, 0x5D, 0x0B, 0x11, 0x0D, 0xAF, 0x0E,
-	0x05, 0x10, 0x14, 0x11, 0xE5, 0x11, 0x95, 0x12, 0xF9, 0x12, 0x11, 0x13,
-	0xFF, 0x12, 0xE7, 0x12, 0xA6, 0x12, 0x33, 0x12, 0x89, 0x11, 0xE5, 0x10,
-	0x11, 0x10, 0xF4, 0x0E, 0xA5, 0x0D, 0x53, 0x0C, 0x22, 0x0B, 0xFF, 0x09,
-	0xE5, 0x08, 0xD0, 0x07, 0xEE, 0x06, 0x4B, 0x06, 0xAE, 0x05, 0x17, 0x05,
-	0xAC, 0x04, 0x73, 0x04, 0x74, 0x04, 0xB0, 0x04, 0x14, 0x05, 0xD2, 0x05,
-	0xDE, 0x06, 0xF7, 0x07, 0xA6, 0x08, 0xF7, 0x08, 0x6C, 0x09, 0x26, 0x0A,
-	0x07, 0x0B, 0xCE, 0x0B, 0x9A, 0x0C, 0x93, 0x0D, 0x8F, 0x0E, 0x6A, 0x0F,
-	0xC1, 0x0F, 0xBC, 0x0F, 0x4E, 0x0F, 0xC4, 0x0E, 0x1A, 0x0E, 0x82, 0x0D,
-	0xD4, 0x0C, 0x0F, 0x0C, 0x36, 0x0B, 0x3F, 0x0A, 0x26, 0x09, 0xD2, 0x07,
-	0x56, 0x06, 0xBC, 0x04, 0x16, 0x03, 0x76, 0x01, 0x03, 0x00, 0xC5, 0xFE,
-	0xB3, 0xFD, 0xBA, 0xFC, 0xBA, 0xFB, 0xB5, 0xFA, 0xDC, 0xF9, 0x35, 0xF9,
-	0xCD, 0xF8, 0x72, 0xF8, 0x4E, 0xF8, 0x78, 0xF8, 0x04, 0xF9, 0xD2, 0xF9,
-	0x91, 0xFA, 0x1B, 0xFB, 0x96, 0xFB, 0x3D, 0xFC, 0xFA, 0xFC, 0xD6, 0xFD,
-	0x9E, 0xFE, 0x8F, 0xFF, 0x93, 0x00, 0x7B, 0x01, 0x40, 0x02, 0xCD, 0x02,
-	0x15, 0x03, 0x1A, 0x03, 0xE6, 0x02, 0x64, 0x02, 0xC5, 0x01, 0x16, 0x01,
-	0x58, 0x00, 0x87, 0xFF, 0x6F, 0xFE, 0xFD, 0xFC, 0x73, 0xFB, 0xD1, 0xF9,
-	0xF0, 0xF7, 0xAA, 0xF5, 0x1D, 0xF3, 0x7C, 0xF0, 0x05, 0xEE, 0x7E, 0xEB,
-	0xD7, 0xE8, 0x18, 0xE6, 0x4C, 0xE3, 0xA2, 0xE0, 0x10, 0xDE, 0x68, 0xDB,
-	0x95, 0xD8, 0xFF, 0xD5, 0xF8, 0xD3, 0x9B, 0xD2, 0xB5, 0xD1, 0x1A, 0xD1,
-	0xB1, 0xD0, 0xFF, 0xD0, 0xDC, 0xD1, 0xF5, 0xD2, 0xFB, 0xD3, 0x6D, 0xD5,
-	0xAE, 0xD7, 0xBA, 0xDA, 0xEC, 0xDD, 0x44, 0xE1, 0x0A, 0xE5, 0x67, 0xE9,
-	0xEF, 0xED, 0x23, 0xF2, 0x31, 0xF6, 0x87, 0xFA, 0x24, 0xFF, 0x78, 0x03,
-	0x3E, 0x07, 0xD1, 0x0A, 0x79, 0x0E, 0xFE, 0x11, 0xF0, 0x14, 0x2D, 0x17,
-	0xBF, 0x18, 0x27, 0x1A, 0x6E, 0x1B, 0x4F, 0x1C, 0x61, 0x1C, 0x23, 0x1C,
-	0xF4, 0x1B, 0x92, 0x1B, 0x89, 0x1A, 0xB0, 0x18, 0xAD, 0x16, 0xD5, 0x14,
-	0xD3, 0x12, 0x4E, 0x10, 0xC6, 0x0D, 0xB3, 0x0B, 0xFD, 0x09, 0x62, 0x08,
-	0x8A, 0x06, 0xC5, 0x04, 0x5C, 0x03, 0x1C, 0x02, 0x03, 0x01, 0x00, 0x00,
-	0x29, 0xFF, 0xBA, 0xFE, 0xD0, 0xFE, 0x1E, 0xFF, 0x56, 0xFF, 0xAA, 0xFF,
-	0x65, 0x00, 0x3A, 0x01, 0xF2, 0x01, 0x89, 0x02, 0x3E, 0x03, 0x37, 0x04,
-	0x21, 0x05, 0xCC, 0x05, 0x2E, 0x06, 0x85, 0x06, 0xBF, 0x06, 0xBF, 0x06,
-	0x68, 0x06, 0xE0, 0x05, 0x25, 0x05, 0x85, 0x04, 0xAE, 0x03, 0xC8, 0x02,
-	0xA8, 0x01, 0x68, 0x00, 0x23, 0xFF, 0xB4, 0xFD, 0x1C, 0xFC, 0x73, 0xFA,
-	0xD7, 0xF8, 0x5C, 0xF7, 0x15, 0xF6, 0xEE, 0xF4, 0x25, 0xF4, 0x93, 0xF3,
-	0x32, 0xF3, 0x20, 0xF3, 0x19, 0xF3, 0x45, 0xF3, 0xA2, 0xF3, 0x69, 0xF4,
-	0x77, 0xF5, 0xB0, 0xF6, 0xFD, 0xF7, 0x9A, 0xF9, 0x85, 0xFB, 0x9C, 0xFD,
-	0xA4, 0xFF, 0xB3, 0x01, 0xC8, 0x03, 0xFA, 0x05, 0x2B, 0x08, 0x3F, 0x0A,
-	0x3C, 0x0C, 0x08, 0x0E, 0x95, 0x0F, 0xF9, 0x10, 0x29, 0x12, 0x24, 0x13,
-	0xC1, 0x13, 0x13, 0x14, 0x1B, 0x14, 0x19, 0x14, 0xDC, 0x13, 0x7F, 0x13,
-	0x11, 0x13, 0x69, 0x12, 0x61, 0x11, 0x34, 0x10, 0xD8, 0x0E, 0x3D, 0x0D,
-	0x76, 0x0B, 0xA6, 0x09, 0x38, 0x08, 0xF6, 0x06, 0xCC, 0x05, 0xBF, 0x04,
-	0xDE, 0x03, 0x1A, 0x03, 0x24, 0x02, 0x39, 0x01, 0x72, 0x00, 0x15, 0x00,
-	0x49, 0x00, 0x38, 0x01, 0xAD, 0x02, 0x42, 0x04, 0xAC, 0x05, 0x16, 0x07,
-	0x9E, 0x08, 0xC8, 0x09, 0xBF, 0x0A, 0xB0, 0x0B, 0xD7, 0x0C, 0x4C, 0x0E,
-	0x05, 0x10, 0xA1, 0x11, 0x1A, 0x13, 0x35, 0x14, 0xDB, 0x14, 0xEC, 0x14,
-	0x6D, 0x14, 0xA3, 0x13, 0xCB, 0x12, 0xFA, 0x11, 0xDA, 0x10, 0x84, 0x0F,
-	0x2D, 0x0E, 0xE1, 0x0C, 0x39, 0x0B, 0xFD, 0x08, 0x4B, 0x06, 0xA9, 0x03,
-	0x5F, 0x01, 0x5E, 0xFF, 0x84, 0xFD, 0xDF, 0xFB, 0x61, 0xFA, 0x12, 0xF9,
-	0xD0, 0xF7, 0x7F, 0xF6, 0x30, 0xF5, 0x1E, 0xF4, 0x8A, 0xF3, 0x67, 0xF3,
-	0xAC, 0xF3, 0x71, 0xF4, 0xB0, 0xF5, 0x28, 0xF7, 0x66, 0xF8, 0x6E, 0xF9,
-	0x8B, 0xFA, 0xB2, 0xFB, 0xF4, 0xFC, 0x20, 0xFE, 0x4F, 0xFF, 0xBC, 0x00,
-	0x5F, 0x02, 0xFF, 0x03, 0x58, 0x05, 0x3E, 0x06, 0xAD, 0x06, 0xBA, 0x06,
-	0xA5, 0x06, 0x3D, 0x06, 0x8C, 0x05, 0xB1, 0x04, 0xD1, 0x03, 0xCD, 0x02,
-	0x7A, 0x01, 0xC0, 0xFF, 0xC3, 0xFD, 0x9E, 0xFB, 0x41, 0xF9, 0xAB, 0xF6,
-	0xE2, 0xF3, 0x0C, 0xF1, 0x7E, 0xEE, 0xEF, 0xEB, 0x21, 0xE9, 0x02, 0xE6,
-	0xE7, 0xE2, 0xEB, 0xDF, 0x42, 0xDD, 0xBD, 0xDA, 0x23, 0xD8, 0xAB, 0xD5,
-	0xC8, 0xD3, 0x93, 0xD2, 0xC8, 0xD1, 0x4B, 0xD1, 0xE6, 0xD0, 0x1A, 0xD1,
-	0x27, 0xD2, 0x96, 0xD3, 0x35, 0xD5, 0x15, 0xD7, 0x95, 0xD9, 0x8E, 0xDC,
-	0x8B, 0xDF, 0xC5, 0xE2, 0x5C, 0xE6, 0x70, 0xEA, 0xC5, 0xEE, 0x3D, 0xF3,
-	0x95, 0xF7, 0xEF, 0xFB, 0x50, 0x00, 0x8F, 0x04, 0x70, 0x08, 0x94, 0x0B,
-	0x5A, 0x0E, 0x16, 0x11, 0xB9, 0x13, 0x26, 0x16, 0xD4, 0x17, 0x1C, 0x19,
-	0x2F, 0x1A, 0xE5, 0x1A, 0x26, 0x1B, 0xFA, 0x1A, 0x52, 0x1A, 0x2E, 0x19,
-	0xB8, 0x17, 0x58, 0x16, 0xC9, 0x14, 0x00, 0x13, 0x16, 0x11, 0x25, 0x0F,
-	0x17, 0x0D, 0xEA, 0x0A, 0xFD, 0x08, 0x57, 0x07, 0xCB, 0x05, 0x56, 0x04,
-	0x18, 0x03, 0x21, 0x02, 0x7F, 0x01, 0x0F, 0x01, 0xB7, 0x00, 0x4D, 0x00,
-	0x03, 0x00, 0x0A, 0x00, 0x8D, 0x00, 0x37, 0x01, 0x00, 0x02, 0xB0, 0x02,
-	0x7C, 0x03, 0x79, 0x04, 0x65, 0x05, 0x1E, 0x06, 0x9D, 0x06, 0xE4, 0x06,
-	0x1D, 0x07, 0x3D, 0x07, 0x45, 0x07, 0x26, 0x07, 0xE4, 0x06, 0x82, 0x06,
-	0xDF, 0x05, 0xE5, 0x04, 0xE8, 0x03, 0xCE, 0x02, 0x8C, 0x01, 0x15, 0x00,
-	0x6C, 0xFE, 0xC7, 0xFC, 0x52, 0xFB, 0xF8, 0xF9, 0x90, 0xF8, 0x31, 0xF7,
-	0xD8, 0xF5, 0xD0, 0xF4, 0x08, 0xF4, 0x68, 0xF3, 0xF3, 0xF2, 0xC8, 0xF2,
-	0xF0, 0xF2, 0x57, 0xF3, 0x00, 0xF4, 0xF6, 0xF4, 0x30, 0xF6, 0x81, 0xF7,
-	0xE5, 0xF8, 0x50, 0xFA, 0xFE, 0xFB, 0xF7, 0xFD, 0x37, 0x00, 0x59, 0x02,
-	0x6A, 0x04, 0x72, 0x06, 0x9D, 0x08, 0xB5, 0x0A, 0x85, 0x0C, 0x08, 0x0E,
-	0x50, 0x0F, 0x77, 0x10, 0x67, 0x11, 0x35, 0x12, 0xD1, 0x12, 0x4B, 0x13,
-	0x80, 0x13, 0x57, 0x13, 0x14, 0x13, 0x99, 0x12, 0x04, 0x12, 0x2A, 0x11,
-	0x1F, 0x10, 0xDD, 0x0E, 0xA1, 0x0D, 0x8D, 0x0C, 0x70, 0x0B, 0x31, 0x0A,
-	0xC7, 0x08, 0x76, 0x07, 0x6A, 0x06, 0x7E, 0x05, 0xAF, 0x04, 0xFB, 0x03,
-	0x82, 0x03, 0x61, 0x03, 0x6C, 0x03, 0x7B, 0x03, 0x96, 0x03, 0xC2, 0x03,
-	0x22, 0x04, 0xB0, 0x04, 0x3E, 0x05, 0xDF, 0x05, 0xD4, 0x06, 0xFC, 0x07,
-	0x24, 0x09, 0x1D, 0x0A, 0xF0, 0x0A, 0x9F, 0x0B, 0x3F, 0x0C, 0xB9, 0x0C,
-	0xE5, 0x0C, 0xF1, 0x0C, 0xDE, 0x0C, 0xE0, 0x0C, 0xC2, 0x0C, 0x65, 0x0C,
-	0xC5, 0x0B, 0x0E, 0x0B, 0x38, 0x0A, 0x15, 0x09, 0xA9, 0x07, 0x4B, 0x06,
-	0x10, 0x05, 0xD1, 0x03, 0x71, 0x02, 0x19, 0x01, 0xB8, 0xFF, 0x8C, 0xFE,
-	0x71, 0xFD, 0x29, 0xFC, 0xED, 0xFA, 0xF5, 0xF9, 0x78, 0xF9, 0x1B, 0xF9,
-	0xEE, 0xF8, 0xDD, 0xF8, 0x0E, 0xF9, 0x6F, 0xF9, 0xEB, 0xF9, 0x6F, 0xFA,
-	0xF8, 0xFA, 0xA5, 0xFB, 0x87, 0xFC, 0x7D, 0xFD, 0x7B, 0xFE, 0x9A, 0xFF,
-	0xE2, 0x00, 0x23, 0x02, 0x30, 0x03, 0x03, 0x04, 0xBC, 0x04, 0x3E, 0x05,
-	0xB5, 0x05, 0xEE, 0x05, 0x02, 0x06, 0xF0, 0x05, 0xD4, 0x05, 0x91, 0x05,
-	0x07, 0x05, 0x3C, 0x04, 0x4E, 0x03, 0x28, 0x02, 0xEC, 0x00, 0x8C, 0xFF,
-	0x25, 0xFE, 0xB3, 0xFC, 0x3C, 0xFB, 0xBD, 0xF9, 0x1B, 0xF8, 0x6E, 0xF6,
-	0xA7, 0xF4, 0xDC, 0xF2, 0x12, 0xF1, 0x2C, 0xEF, 0x6E, 0xED, 0xC6, 0xEB,
-	0x2F, 0xEA, 0xAB, 0xE8, 0x46, 0xE7, 0xB7, 0xE5, 0x0F, 0xE4, 0x38, 0xE2,
-	0x57, 0xE0, 0x84, 0xDE, 0xC6, 0xDC, 0x2E, 0xDB, 0xDB, 0xD9, 0xE0, 0xD8,
-	0x98, 0xD8, 0xAB, 0xD8, 0xD2, 0xD8, 0x75, 0xD9, 0x87, 0xDA, 0x7E, 0xDB,
-	0x57, 0xDC, 0x46, 0xDD, 0xCA, 0xDE, 0xA8, 0xE0, 0xD0, 0xE2, 0x69, 0xE5,
-	0x78, 0xE8, 0xC4, 0xEB, 0x33, 0xEF, 0xB2, 0xF2, 0x2A, 0xF6, 0x81, 0xF9,
-	0xB2, 0xFC, 0xAD, 0xFF, 0xCD, 0x02, 0x02, 0x06, 0x3E, 0x09, 0x28, 0x0C,
-	0xAC, 0x0E, 0xC1, 0x10, 0x78, 0x12, 0x12, 0x14, 0x93, 0x15, 0x83, 0x16,
-	0x0C, 0x17, 0xA0, 0x17, 0x74, 0x18, 0x24, 0x19, 0x16, 0x19, 0x5D, 0x18,
-	0x66, 0x17, 0x2E, 0x16, 0x8E, 0x14, 0xDF, 0x12, 0x72, 0x11, 0x43, 0x10,
-	0x25, 0x0F, 0x0D, 0x0E, 0x01, 0x0D, 0xCA, 0x0B, 0x62, 0x0A, 0xFA, 0x08,
-	0x8A, 0x07, 0xEB, 0x05, 0x80, 0x04, 0xD2, 0x03, 0x73, 0x03, 0xF9, 0x02,
-	0x73, 0x02, 0x13, 0x02, 0xE4, 0x01, 0xC7, 0x01, 0xA5, 0x01, 0x7D, 0x01,
-	0x5E, 0x01, 0x78, 0x01, 0xC2, 0x01, 0xFF, 0x01, 0x08, 0x02, 0x11, 0x02,
-	0xF1, 0x01, 0xA5, 0x01, 0x3D, 0x01, 0xCF, 0x00, 0x97, 0x00, 0x71, 0x00,
-	0x3C, 0x00, 0xED, 0xFF, 0x7C, 0xFF, 0xE3, 0xFE, 0x47, 0xFE, 0x81, 0xFD,
-	0x62, 0xFC, 0x38, 0xFB, 0x51, 0xFA, 0x97, 0xF9, 0xFF, 0xF8, 0x9C, 0xF8,
-	0x4A, 0xF8, 0x21, 0xF8, 0x09, 0xF8, 0x0A, 0xF8, 0x09, 0xF8, 0x21, 0xF8,
-	0x53, 0xF8, 0xA9, 0xF8, 0x15, 0xF9, 0xC7, 0xF9, 0xC6, 0xFA, 0xDF, 0xFB,
-	0x11, 0xFD, 0x72, 0xFE, 0xDE, 0xFF, 0x4E, 0x01, 0xC7, 0x02, 0x52, 0x04,
-	0xC8, 0x05, 0x15, 0x07, 0x59, 0x08, 0xAF, 0x09, 0xF2, 0x0A, 0x28, 0x0C,
-	0x2C, 0x0D, 0x10, 0x0E, 0xB1, 0x0E, 0x41, 0x0F, 0xB8, 0x0F, 0x09, 0x10,
-	0x3E, 0x10, 0x43, 0x10, 0x3F, 0x10, 0xF1, 0x0F, 0x8B, 0x0F, 0xF7, 0x0E,
-	0x20, 0x0E, 0x1A, 0x0D, 0x08, 0x0C, 0xF2, 0x0A, 0xFE, 0x09, 0x0B, 0x09,
-	0x1D, 0x08, 0x38, 0x07, 0x4B, 0x06, 0x72, 0x05, 0xDC, 0x04, 0x6F, 0x04,
-	0xFB, 0x03, 0x86, 0x03, 0x36, 0x03, 0x1B, 0x03, 0x3D, 0x03, 0x8A, 0x03,
-	0xF2, 0x03, 0x5E, 0x04, 0xEE, 0x04, 0xAF, 0x05, 0xB3, 0x06, 0xAF, 0x07,
-	0x72, 0x08, 0x20, 0x09, 0xDA, 0x09, 0x98, 0x0A, 0x3F, 0x0B, 0xCB, 0x0B,
-	0x2E, 0x0C, 0x72, 0x0C, 0x8D, 0x0C, 0x99, 0x0C, 0x8B, 0x0C, 0x55, 0x0C,
-	0xFA, 0x0B, 0x6C, 0x0B, 0xD7, 0x0A, 0xFD, 0x09, 0x05, 0x09, 0xF9, 0x07,
-	0xDC, 0x06, 0x73, 0x05, 0xFB, 0x03, 0x9A, 0x02, 0x41, 0x01, 0x04, 0x00,
-	0xE8, 0xFE, 0xCA, 0xFD, 0xD0, 0xFC, 0xE6, 0xFB, 0x3A, 0xFB, 0xBC, 0xFA,
-	0x40, 0xFA, 0xCB, 0xF9, 0x8B, 0xF9, 0x8A, 0xF9, 0xA7, 0xF9, 0xFD, 0xF9,
-	0x8D, 0xFA, 0x59, 0xFB, 0x1B, 0xFC, 0xF0, 0xFC, 0xEB, 0xFD, 0x15, 0xFF,
-	0x26, 0x00, 0x16, 0x01, 0xFE, 0x01, 0xC6, 0x02, 0x7E, 0x03, 0x39, 0x04,
-	0xDD, 0x04, 0x4A, 0x05, 0x84, 0x05, 0x9C, 0x05, 0x86, 0x05, 0x5A, 0x05,
-	0xE7, 0x04, 0x4D, 0x04, 0x76, 0x03, 0x53, 0x02, 0x26, 0x01, 0xC7, 0xFF,
-	0x4E, 0xFE, 0x9A, 0xFC, 0xB6, 0xFA, 0xD0, 0xF8, 0xC9, 0xF6, 0x9D, 0xF4,
-	0x4C, 0xF2, 0xE9, 0xEF, 0x85, 0xED, 0x1D, 0xEB, 0xEA, 0xE8, 0x7E, 0xE6,
-	0x08, 0xE4, 0xA5, 0xE1, 0x6D, 0xDF, 0x45, 0xDD, 0x10, 0xDB, 0xD3, 0xD8,
-	0xC9, 0xD6, 0x3A, 0xD5, 0x1B, 0xD4, 0x91, 0xD3, 0x52, 0xD3, 0x92, 0xD3,
-	0x8A, 0xD4, 0xE1, 0xD5, 0x5B, 0xD7, 0xED, 0xD8, 0xBD, 0xDA, 0x12, 0xDD,
-	0x89, 0xDF, 0x1D, 0xE2, 0x08, 0xE5, 0x6F, 0xE8, 0x79, 0xEC, 0xCF, 0xF0,
-	0x11, 0xF5, 0x25, 0xF9, 0x3D, 0xFD, 0x52, 0x01, 0x25, 0x05, 0x7F, 0x08,
-	0x69, 0x0B, 0x32, 0x0E, 0xFB, 0x10, 0x9D, 0x13, 0xBA, 0x15, 0x6B, 0x17,
-	0x21, 0x19, 0xA5, 0x1A, 0x7B, 0x1B, 0xA1, 0x1B, 0x98, 0x1B, 0x95, 0x1B,
-	0x43, 0x1B, 0x7A, 0x1A, 0x49, 0x19, 0xFF, 0x17, 0x92, 0x16, 0x1A, 0x15,
-	0x54, 0x13, 0x43, 0x11, 0x12, 0x0F, 0x5E, 0x0D, 0xF7, 0x0B, 0x90, 0x0A,
-	0x1B, 0x09, 0xFE, 0x07, 0xFF, 0x06, 0xF6, 0x05, 0xB8, 0x04, 0x84, 0x03,
-	0x89, 0x02, 0xC1, 0x01, 0x3B, 0x01, 0xD8, 0x00, 0xA6, 0x00, 0xE5, 0x00,
-	0x6E, 0x01, 0x0B, 0x02, 0x3C, 0x02, 0x40, 0x02, 0x54, 0x02, 0x76, 0x02,
-	0x67, 0x02, 0x56, 0x02, 0x34, 0x02, 0x18, 0x02, 0x0E, 0x02, 0x1C, 0x02,
-	0xE6, 0x01, 0x58, 0x01, 0xC9, 0x00, 0x2B, 0x00, 0x6D, 0xFF, 0x87, 0xFE,
-	0xC1, 0xFD, 0xE6, 0xFC, 0x0F, 0xFC, 0x1E, 0xFB, 0x08, 0xFA, 0xE3, 0xF8,
-	0xE2, 0xF7, 0x27, 0xF7, 0x86, 0xF6, 0xCE, 0xF5, 0x67, 0xF5, 0x75, 0xF5,
-	0xB4, 0xF5, 0x08, 0xF6, 0x52, 0xF6, 0xA7, 0xF6, 0x0B, 0xF7, 0x9D, 0xF7,
-	0x5E, 0xF8, 0x31, 0xF9, 0x2F, 0xFA, 0x8E, 0xFB, 0x30, 0xFD, 0xBF, 0xFE,
-	0x6C, 0x00, 0x3D, 0x02, 0xFA, 0x03, 0x7B, 0x05, 0xB8, 0x06, 0x15, 0x08,
-	0x3A, 0x09, 0x7A, 0x0A, 0x94, 0x0B, 0x96, 0x0C, 0x6B, 0x0D, 0x2C, 0x0E,
-	0xF8, 0x0E, 0x7F, 0x0F, 0xC3, 0x0F, 0xD2, 0x0F, 0xC1, 0x0F, 0x92, 0x0F,
-	0x3A, 0x0F, 0xC1, 0x0E, 0x44, 0x0E, 0x9E, 0x0D, 0xE9, 0x0C, 0x13, 0x0C,
-	0x29, 0x0B, 0x2A, 0x0A, 0x5B, 0x09, 0x92, 0x08, 0xC8, 0x07, 0x0A, 0x07,
-	0x5B, 0x06, 0x1F, 0x06, 0xD9, 0x05, 0x79, 0x05, 0x03, 0x05, 0x8A, 0x04,
-	0x57, 0x04, 0x69, 0x04, 0x74, 0x04, 0x9B, 0x04, 0xDA, 0x04, 0x56, 0x05,
-	0xF7, 0x05, 0x8A, 0x06, 0x0E, 0x07, 0x81, 0x07, 0x0A, 0x08, 0xA0, 0x08,
-	0xFD, 0x08, 0x2D, 0x09, 0x58, 0x09, 0x80, 0x09, 0x84, 0x09, 0x4C, 0x09,
-	0x0B, 0x09, 0xD5, 0x08, 0xAA, 0x08, 0x52, 0x08, 0xBF, 0x07, 0x18, 0x07,
-	0x64, 0x06, 0x8E, 0x05, 0x8E, 0x04, 0x6A, 0x03, 0x4D, 0x02, 0x3C, 0x01,
-	0x5B, 0x00, 0x74, 0xFF, 0xA1, 0xFE, 0xD4, 0xFD, 0x30, 0xFD, 0x9F, 0xFC,
-	0x13, 0xFC, 0x94, 0xFB, 0x53, 0xFB, 0x2E, 0xFB, 0x32, 0xFB, 0x37, 0xFB,
-	0x92, 0xFB, 0xF6, 0xFB, 0x8C, 0xFC, 0x0B, 0xFD, 0x97, 0xFD, 0x42, 0xFE,
-	0x04, 0xFF, 0xE4, 0xFF, 0xB5, 0x00, 0x8F, 0x01, 0x61, 0x02, 0x24, 0x03,
-	0xE8, 0x03, 0x72, 0x04, 0xEC, 0x04, 0x48, 0x05, 0x83, 0x05, 0xB4, 0x05,
-	0xC1, 0x05, 0xB4, 0x05, 0x9A, 0x05, 0x3E, 0x05, 0xAE, 0x04, 0x03, 0x04,
-	0x4B, 0x03, 0x66, 0x02, 0x5E, 0x01, 0x57, 0x00, 0x24, 0xFF, 0xF8, 0xFD,
-	0xB7, 0xFC, 0x72, 0xFB, 0x1E, 0xFA, 0xD2, 0xF8, 0x74, 0xF7, 0x0B, 0xF6,
-	0x9A, 0xF4, 0x33, 0xF3, 0xBE, 0xF1, 0x33, 0xF0, 0x9E, 0xEE, 0x0C, 0xED,
-	0x8D, 0xEB, 0x25, 0xEA, 0x9E, 0xE8, 0xEA, 0xE6, 0x15, 0xE5, 0x55, 0xE3,
-	0xCB, 0xE1, 0x39, 0xE0, 0x91, 0xDE, 0xC9, 0xDC, 0x1D, 0xDB, 0xC8, 0xD9,
-	0xEE, 0xD8, 0x97, 0xD8, 0x71, 0xD8, 0xC8, 0xD8, 0xA3, 0xD9, 0xBC, 0xDA,
-	0xE4, 0xDB, 0xF5, 0xDC, 0x30, 0xDE, 0xDA, 0xDF, 0xC8, 0xE1, 0xF2, 0xE3,
-	0xAE, 0xE6, 0x2D, 0xEA, 0x02, 0xEE, 0xDA, 0xF1, 0x88, 0xF5, 0x4D, 0xF9,
-	0x10, 0xFD, 0xB5, 0x00, 0x10, 0x04, 0x1C, 0x07, 0x1D, 0x0A, 0x58, 0x0D,
-	0x7F, 0x10, 0x54, 0x13, 0xB3, 0x15, 0xB9, 0x17, 0x92, 0x19, 0xED, 0x1A,
-	0xBC, 0x1B, 0x32, 0x1C, 0xA3, 0x1C, 0xFE, 0x1C, 0x16, 0x1D, 0x8A, 0x1C,
-	0x9D, 0x1B, 0x60, 0x1A, 0xC4, 0x18, 0xE0, 0x16, 0xAB, 0x14, 0x68, 0x12,
-	0x66, 0x10, 0xEB, 0x0E, 0x5D, 0x0D, 0x9B, 0x0B, 0xBA, 0x09, 0x01, 0x08,
-	0x33, 0x06, 0x43, 0x04, 0x5F, 0x02, 0x98, 0x00, 0x39, 0xFF, 0x44, 0xFE,
-	0xA1, 0xFD, 0x22, 0xFD, 0xC6, 0xFC, 0xCB, 0xFC, 0xE2, 0xFC, 0xDF, 0xFC,
-	0xCA, 0xFC, 0xC0, 0xFC, 0xFB, 0xFC, 0x62, 0xFD, 0xB4, 0xFD, 0xE9, 0xFD,
-	0x2B, 0xFE, 0x98, 0xFE, 0xF5, 0xFE, 0x07, 0xFF, 0xFE, 0xFE, 0xFB, 0xFE,
-	0x0E, 0xFF, 0x09, 0xFF, 0xCA, 0xFE, 0x4E, 0xFE, 0xDE, 0xFD, 0x65, 0xFD,
-	0xB2, 0xFC, 0xDB, 0xFB, 0xE9, 0xFA, 0x04, 0xFA, 0x4B, 0xF9, 0x87, 0xF8,
-	0xE9, 0xF7, 0x54, 0xF7, 0x09, 0xF7, 0x02, 0xF7, 0xEF, 0xF6, 0xD1, 0xF6,
-	0xC7, 0xF6, 0xDF, 0xF6, 0x22, 0xF7, 0x91, 0xF7, 0x28, 0xF8, 0xF0, 0xF8,
-	0xFC, 0xF9, 0x42, 0xFB, 0xD9, 0xFC, 0x91, 0xFE, 0x32, 0x00, 0xCE, 0x01,
-	0x5E, 0x03, 0x02, 0x05, 0x90, 0x06, 0x30, 0x08, 0xC3, 0x09, 0x51, 0x0B,
-	0xCA, 0x0C, 0x3F, 0x0E, 0x97, 0x0F, 0x9B, 0x10, 0x6D, 0x11, 0x02, 0x12,
-	0x74, 0x12, 0xB5, 0x12, 0xEC, 0x12, 0xFE, 0x12, 0xE3, 0x12, 0x7B, 0x12,
-	0xD0, 0x11, 0xDF, 0x10, 0xBA, 0x0F, 0x73, 0x0E, 0x0E, 0x0D, 0x9E, 0x0B,
-	0x30, 0x0A, 0xEC, 0x08, 0xC8, 0x07, 0xB5, 0x06, 0x86, 0x05, 0x2F, 0x04,
-	0xC4, 0x02, 0x64, 0x01, 0x26, 0x00, 0x02, 0xFF, 0xFA, 0xFD, 0x37, 0xFD,
-	0xE1, 0xFC, 0xF8, 0xFC, 0x59, 0xFD, 0xC4, 0xFD, 0x1E, 0xFE, 0x7B, 0xFE,
-	0x02, 0xFF, 0x95, 0xFF, 0x26, 0x00, 0xB4, 0x00, 0xC1, 0x01, 0x93, 0x03,
-	0xBF, 0x05, 0x77, 0x07, 0xA0, 0x08, 0x57, 0x09, 0xF6, 0x09, 0x61, 0x0A,
-	0x6C, 0x0A, 0x6B, 0x0A, 0xB4, 0x0A, 0x72, 0x0B, 0x3A, 0x0C, 0xB0, 0x0C,
-	0xA1, 0x0C, 0x40, 0x0C, 0x84, 0x0B, 0x47, 0x0A, 0xB0, 0x08, 0x09, 0x07,
-	0xF8, 0x05, 0x33, 0x05, 0x75, 0x04, 0x8C, 0x03, 0x5A, 0x02, 0x69, 0x01,
-	0x77, 0x00, 0x4B, 0xFF, 0xBC, 0xFD, 0x75, 0xFC, 0x0E, 0xFC, 0x08, 0xFC,
-	0x53, 0xFC, 0x88, 0xFC, 0xD0, 0xFC, 0x03, 0xFD, 0x29, 0xFD, 0x3C, 0xFD,
-	0x33, 0xFD, 0x80, 0xFD, 0x5E, 0xFE, 0x94, 0xFF, 0xEF, 0x00, 0x4A, 0x02,
-	0xA5, 0x03, 0xCE, 0x04, 0x8A, 0x05, 0xD3, 0x05, 0xCB, 0x05, 0xD1, 0x05,
-	0x30, 0x06, 0xA7, 0x06, 0xE4, 0x06, 0x21, 0x07, 0x26, 0x07, 0x0C, 0x07,
-	0x8F, 0x06, 0x80, 0x05, 0xF9, 0x03, 0x58, 0x02, 0xC9, 0x00, 0x33, 0xFF,
-	0x9D, 0xFD, 0xF5, 0xFB, 0x54, 0xFA, 0x7B, 0xF8, 0x6D, 0xF6, 0x00, 0xF4,
-	0x57, 0xF1, 0xAF, 0xEE, 0x30, 0xEC, 0xBA, 0xE9, 0x4F, 0xE7, 0x25, 0xE5,
-	0x36, 0xE3, 0x38, 0xE1, 0x06, 0xDF, 0x95, 0xDC, 0x1F, 0xDA, 0xFB, 0xD7,
-	0x01, 0xD6, 0x61, 0xD4, 0x32, 0xD3, 0xA5, 0xD2, 0xD5, 0xD2, 0x97, 0xD3,
-	0xB7, 0xD4, 0x21, 0xD6, 0x63, 0xD7, 0xB2, 0xD8, 0x29, 0xDA, 0x10, 0xDC,
-	0xA0, 0xDE, 0x97, 0xE1, 0xE5, 0xE4, 0xBB, 0xE8, 0xE9, 0xEC, 0x75, 0xF1,
-	0xF7, 0xF5, 0x19, 0xFA, 0xDC, 0xFD, 0x6A, 0x01, 0x0F, 0x05, 0xC1, 0x08,
-	0x4E, 0x0C, 0x86, 0x0F, 0xC9, 0x12, 0xC3, 0x15, 0x4A, 0x18, 0x12, 0x1A,
-	0x65, 0x1B, 0x88, 0x1C, 0x38, 0x1D, 0x87, 0x1D, 0xA1, 0x1D, 0xBF, 0x1D,
-	0xD1, 0x1D, 0x6B, 0x1D, 0x6A, 0x1C, 0xB0, 0x1A, 0xA0, 0x18, 0x77, 0x16,
-	0x57, 0x14, 0x04, 0x12, 0xC5, 0x0F, 0xCB, 0x0D, 0x45, 0x0C, 0xF7, 0x0A,
-	0x7D, 0x09, 0xCD, 0x07, 0xFC, 0x05, 0x35, 0x04, 0x46, 0x02, 0x8F, 0x00,
-	0x34, 0xFF, 0x5E, 0xFE, 0xDD, 0xFD, 0xA6, 0xFD, 0xA1, 0xFD, 0xC2, 0xFD,
-	0xE7, 0xFD, 0xEE, 0xFD, 0xDF, 0xFD, 0xB5, 0xFD, 0x8E, 0xFD, 0xEE, 0xFD,
-	0x66, 0xFE, 0xD6, 0xFE, 0x39, 0xFF, 0x76, 0xFF, 0xA1, 0xFF, 0x90, 0xFF,
-	0x6D, 0xFF, 0x07, 0xFF, 0x95, 0xFE, 0x23, 0xFE, 0xE1, 0xFD, 0xA5, 0xFD,
-	0x51, 0xFD, 0xE1, 0xFC, 0x3E, 0xFC, 0x56, 0xFB, 0x39, 0xFA, 0x0D, 0xF9,
-	0xF6, 0xF7, 0x23, 0xF7, 0xAE, 0xF6, 0x67, 0xF6, 0x51, 0xF6, 0x60, 0xF6,
-	0x95, 0xF6, 0xDC, 0xF6, 0x02, 0xF7, 0x1A, 0xF7, 0x44, 0xF7, 0xAD, 0xF7,
-	0x92, 0xF8, 0xD0, 0xF9, 0x2E, 0xFB, 0xBB, 0xFC, 0x6A, 0xFE, 0x22, 0x00,
-	0xCC, 0x01, 0x6D, 0x03, 0x1C, 0x05, 0xB5, 0x06, 0x4B, 0x08, 0xEB, 0x09,
-	0x83, 0x0B, 0x10, 0x0D, 0x75, 0x0E, 0xA2, 0x0F, 0xA6, 0x10, 0x3B, 0x11,
-	0xB5, 0x11, 0x12, 0x12, 0x69, 0x12, 0x9F, 0x12, 0x88, 0x12, 0x4E, 0x12,
-	0xD1, 0x11, 0x27, 0x11, 0x49, 0x10, 0x37, 0x0F, 0xD2, 0x0D, 0x4E, 0x0C,
-	0xEB, 0x0A, 0x8F, 0x09, 0x29, 0x08, 0xE2, 0x06, 0xA7, 0x05, 0x63, 0x04,
-	0x23, 0x03, 0xE5, 0x01, 0xBE, 0x00, 0xCA, 0xFF, 0xF8, 0xFE, 0x4F, 0xFE,
-	0xBD, 0xFD, 0x5E, 0xFD, 0x86, 0xFD, 0x07, 0xFE, 0xA2, 0xFE, 0x25, 0xFF,
-	0xA2, 0xFF, 0x50, 0x00, 0x39, 0x01, 0x26, 0x02, 0xF3, 0x02, 0xD5, 0x03,
-	0xDE, 0x04, 0xED, 0x05, 0x0D, 0x07, 0x08, 0x08, 0xDA, 0x08, 0x7D, 0x09,
-	0x07, 0x0A, 0x5B, 0x0A, 0x7D, 0x0A, 0x88, 0x0A, 0x70, 0x0A, 0x20, 0x0A,
-	0x9B, 0x09, 0xE6, 0x08, 0x1D, 0x08, 0x63, 0x07, 0x91, 0x06, 0x7B, 0x05,
-	0x44, 0x04, 0x17, 0x03, 0x0E, 0x02, 0xF7, 0x00, 0xD3, 0xFF, 0xB8, 0xFE,
-	0xC0, 0xFD, 0xF4, 0xFC, 0x5E, 0xFC, 0xF7, 0xFB, 0xAE, 0xFB, 0x91, 0xFB,
-	0xA4, 0xFB, 0xD7, 0xFB, 0x2A, 0xFC, 0x9F, 0xFC, 0x5C, 0xFD, 0x38, 0xFE,
-	0x2B, 0xFF, 0x2C, 0x00, 0x4B, 0x01, 0x84, 0x02, 0xC8, 0x03, 0xF8, 0x04,
-	0xF4, 0x05, 0x07, 0x07, 0x23, 0x08, 0x22, 0x09, 0x06, 0x0A, 0xA1, 0x0A,
-	0x1B, 0x0B, 0x65, 0x0B, 0x82, 0x0B, 0x74, 0x0B, 0x1D, 0x0B, 0xAD, 0x0A,
-	0x10, 0x0A, 0x4E, 0x09, 0x4E, 0x08, 0x3D, 0x07, 0x02, 0x06, 0xB4, 0x04,
-	0x3F, 0x03, 0xA8, 0x01, 0xFB, 0xFF, 0x49, 0xFE, 0xAB, 0xFC, 0x03, 0xFB,
-	0x65, 0xF9, 0xD7, 0xF7, 0x64, 0xF6, 0xF6, 0xF4, 0xA0, 0xF3, 0x66, 0xF2,
-	0x41, 0xF1, 0x30, 0xF0, 0x39, 0xEF, 0x4F, 0xEE, 0x8F, 0xED, 0xE1, 0xEC,
-	0x37, 0xEC, 0x84, 0xEB, 0xD1, 0xEA, 0x38, 0xEA, 0xA5, 0xE9, 0x15, 0xE9,
-	0x81, 0xE8, 0xDF, 0xE7, 0x1E, 0xE7, 0x57, 0xE6, 0x6A, 0xE5, 0x64, 0xE4,
-	0x2F, 0xE3, 0xDA, 0xE1, 0xB3, 0xE0, 0xBC, 0xDF, 0xE4, 0xDE, 0x13, 0xDE,
-	0xD1, 0xDD, 0x8A, 0xDE, 0xC9, 0xDF, 0xC6, 0xE0, 0x6C, 0xE1, 0x4A, 0xE2,
-	0x8D, 0xE3, 0xF4, 0xE4, 0x5F, 0xE6, 0xE4, 0xE7, 0xE4, 0xE9, 0xC6, 0xEC,
-	0x2F, 0xF0, 0xD1, 0xF3, 0x79, 0xF7, 0x33, 0xFB, 0x01, 0xFF, 0x76, 0x02,
-	0x74, 0x05, 0x3D, 0x08, 0x3C, 0x0B, 0x7F, 0x0E, 0x80, 0x11, 0x10, 0x14,
-	0x79, 0x16, 0xE0, 0x18, 0x20, 0x1B, 0x9D, 0x1C, 0x4B, 0x1D, 0x8E, 0x1D,
-	0x00, 0x1E, 0x73, 0x1E, 0x71, 0x1E, 0xC4, 0x1D, 0xDA, 0x1C, 0xC6, 0x1B,
-	0x1C, 0x1A, 0xC0, 0x17, 0x24, 0x15, 0x7E, 0x12, 0xE1, 0x0F, 0x70, 0x0D,
-	0x1A, 0x0B, 0xDF, 0x08, 0xCF, 0x06, 0xDF, 0x04, 0xDE, 0x02, 0x55, 0x00,
-	0xA9, 0xFD, 0x60, 0xFB, 0x6F, 0xF9, 0xC5, 0xF7, 0x5F, 0xF6, 0x7F, 0xF5,
-	0x1A, 0xF5, 0x37, 0xF5, 0x7D, 0xF5, 0xAD, 0xF5, 0xDC, 0xF5, 0x29, 0xF6,
-	0x83, 0xF6, 0xFC, 0xF6, 0x8B, 0xF7, 0x82, 0xF8, 0xA4, 0xF9, 0xCE, 0xFA,
-	0xFC, 0xFB, 0x08, 0xFD, 0x06, 0xFE, 0xE8, 0xFE, 0xC4, 0xFF, 0x69, 0x00,
-	0xF4, 0x00, 0x68, 0x01, 0xE0, 0x01, 0x5B, 0x02, 0xA2, 0x02, 0x8F, 0x02,
-	0x2D, 0x02, 0xC3, 0x01, 0x2B, 0x01, 0x7A, 0x00, 0xC5, 0xFF, 0x35, 0xFF,
-	0xEB, 0xFE, 0xB6, 0xFE, 0x8C, 0xFE, 0x47, 0xFE, 0xEF, 0xFD, 0x99, 0xFD,
-	0x34, 0xFD, 0xA3, 0xFC, 0x23, 0xFC, 0x1A, 0xFC, 0x7E, 0xFC, 0x38, 0xFD,
-	0x0F, 0xFE, 0xFB, 0xFE, 0xFC, 0xFF, 0x25, 0x01, 0x49, 0x02, 0x2E, 0x03,
-	0x04, 0x04, 0xF2, 0x04, 0x28, 0x06, 0x72, 0x07, 0xC1, 0x08, 0x09, 0x0A,
-	0x53, 0x0B, 0x8D, 0x0C, 0x78, 0x0D, 0x0F, 0x0E, 0x7A, 0x0E, 0xDF, 0x0E,
-	0x45, 0x0F, 0x77, 0x0F, 0x67, 0x0F, 0x30, 0x0F, 0x09, 0x0F, 0xBC, 0x0E,
-	0xF4, 0x0D, 0xDB, 0x0C, 0x81, 0x0B, 0x49, 0x0A, 0x09, 0x09, 0xBC, 0x07,
-	0x76, 0x06, 0x54, 0x05, 0x55, 0x04, 0x44, 0x03, 0x14, 0x02, 0xB9, 0x00,
-	0x5F, 0xFF, 0x22, 0xFE, 0xF4, 0xFC, 0xE6, 0xFB, 0x0A, 0xFB, 0x9C, 0xFA,
-	0xA3, 0xFA, 0xE8, 0xFA, 0x75, 0xFB, 0x3D, 0xFC, 0xFF, 0xFC, 0x94, 0xFD,
-	0x3B, 0xFE, 0x22, 0xFF, 0x43, 0x00, 0x63, 0x01, 0x96, 0x02, 0xE0, 0x03,
-	0x54, 0x05, 0xD6, 0x06, 0x3D, 0x08, 0x4C, 0x09, 0x32, 0x0A, 0xF5, 0x0A,
-	0xAF, 0x0B, 0x54, 0x0C, 0xAE, 0x0C, 0xEF, 0x0C, 0x21, 0x0D, 0x0E, 0x0D,
-	0xA5, 0x0C, 0x02, 0x0C, 0x4D, 0x0B, 0x90, 0x0A, 0xB6, 0x09, 0xAF, 0x08,
-	0xB3, 0x07, 0xDF, 0x06, 0x34, 0x06, 0x86, 0x05, 0x94, 0x04, 0x81, 0x03,
-	0x6A, 0x02, 0x8C, 0x01, 0xB1, 0x00, 0x12, 0x00, 0x99, 0xFF, 0x73, 0xFF,
-	0x84, 0xFF, 0xCC, 0xFF, 0x36, 0x00, 0x8B, 0x00, 0xDD, 0x00, 0x4A, 0x01,
-	0xA4, 0x01, 0x03, 0x02, 0x8B, 0x02, 0x2D, 0x03, 0xF7, 0x03, 0xB2, 0x04,
-	0x59, 0x05, 0xD7, 0x05, 0x57, 0x06, 0xC5, 0x06, 0xFD, 0x06, 0xFB, 0x06,
-	0xD9, 0x06, 0xA0, 0x06, 0x5C, 0x06, 0xE9, 0x05, 0x39, 0x05, 0x48, 0x04,
-	0x23, 0x03, 0xDD, 0x01, 0x6F, 0x00, 0xEC, 0xFE, 0x5D, 0xFD, 0xD8, 0xFB,
-	0x4D, 0xFA, 0xB0, 0xF8, 0x03, 0xF7, 0x3F, 0xF5, 0x60, 0xF3, 0x92, 0xF1,
-	0x92, 0xEF, 0x97, 0xED, 0xB0, 0xEB, 0x0A, 0xEA, 0x84, 0xE8, 0x0E, 0xE7,
-	0xAD, 0xE5, 0x87, 0xE4, 0x61, 0xE3, 0x42, 0xE2, 0x00, 0xE1, 0xCD, 0xDF,
-	0xB0, 0xDE, 0xA4, 0xDD, 0x8F, 0xDC, 0x74, 0xDB, 0xA6, 0xDA, 0x46, 0xDA,
-	0x14, 0xDA, 0x10, 0xDA, 0x68, 0xDA, 0x98, 0xDB, 0x6B, 0xDD, 0x79, 0xDF,
-	0x44, 0xE1, 0x06, 0xE3, 0x16, 0xE5, 0x35, 0xE7, 0x3D, 0xE9, 0x2E, 0xEB,
-	0x92, 0xED, 0x8B, 0xF0, 0xEA, 0xF3, 0x99, 0xF7, 0x74, 0xFB, 0x65, 0xFF,
-	0x30, 0x03, 0x8B, 0x06, 0x67, 0x09, 0xC6, 0x0B, 0x20, 0x0E, 0x75, 0x10,
-	0xA0, 0x12, 0x66, 0x14, 0x02, 0x16, 0xAF, 0x17, 0x48, 0x19, 0x5C, 0x1A,
-	0xC2, 0x1A, 0xD1, 0x1A, 0xC3, 0x1A, 0xA2, 0x1A, 0x27, 0x1A, 0x59, 0x19,
-	0x50, 0x18, 0x33, 0x17, 0xB2, 0x15, 0xC4, 0x13, 0x88, 0x11, 0x4B, 0x0F,
-	0x49, 0x0D, 0x6D, 0x0B, 0xA8, 0x09, 0x08, 0x08, 0x9C, 0x06, 0x7C, 0x05,
-	0x38, 0x04, 0xA2, 0x02, 0xBE, 0x00, 0xF0, 0xFE, 0x83, 0xFD, 0x5C, 0xFC,
-	0x59, 0xFB, 0xAC, 0xFA, 0x6E, 0xFA, 0x9A, 0xFA, 0xE4, 0xFA, 0x3A, 0xFB,
-	0x61, 0xFB, 0x7A, 0xFB, 0x94, 0xFB, 0xB6, 0xFB, 0xCF, 0xFB, 0x08, 0xFC,
-	0x6B, 0xFC, 0xF2, 0xFC, 0x5A, 0xFD, 0x9D, 0xFD, 0xD7, 0xFD, 0x14, 0xFE,
-	0x66, 0xFE, 0x7F, 0xFE, 0x69, 0xFE, 0x51, 0xFE, 0x5B, 0xFE, 0x73, 0xFE,
-	0x6F, 0xFE, 0x0A, 0xFE, 0x63, 0xFD, 0xD0, 0xFC, 0x65, 0xFC, 0x03, 0xFC,
-	0x9D, 0xFB, 0x66, 0xFB, 0x66, 0xFB, 0x99, 0xFB, 0xE8, 0xFB, 0x21, 0xFC,
-	0x55, 0xFC, 0x75, 0xFC, 0x9C, 0xFC, 0xCD, 0xFC, 0xFB, 0xFC, 0x63, 0xFD,
-	0x2C, 0xFE, 0x16, 0xFF, 0x03, 0x00, 0x16, 0x01, 0x45, 0x02, 0xB3, 0x03,
-	0xF9, 0x04, 0x07, 0x06, 0xE8, 0x06, 0xBB, 0x07, 0x9F, 0x08, 0x9A, 0x09,
-	0x6C, 0x0A, 0x2F, 0x0B, 0xE9, 0x0B, 0x8B, 0x0C, 0x0E, 0x0D, 0x70, 0x0D,
-	0xBB, 0x0D, 0xDB, 0x0D, 0xCF, 0x0D, 0xB3, 0x0D, 0x55, 0x0D, 0xFF, 0x0C,
-	0x88, 0x0C, 0xD5, 0x0B, 0xFC, 0x0A, 0xE3, 0x09, 0xC0, 0x08, 0xB7, 0x07,
-	0xC6, 0x06, 0xD0, 0x05, 0xE0, 0x04, 0xF6, 0x03, 0x2E, 0x03, 0x6F, 0x02,
-	0xA9, 0x01, 0xFD, 0x00, 0x35, 0x00, 0x5A, 0xFF, 0xAA, 0xFE, 0x31, 0xFE,
-	0x14, 0xFE, 0x15, 0xFE, 0x28, 0xFE, 0x6A, 0xFE, 0xBE, 0xFE, 0x1B, 0xFF,
-	0xB3, 0xFF, 0x44, 0x00, 0xB1, 0x00, 0x1A, 0x01, 0xAD, 0x01, 0x7F, 0x02,
-	0x64, 0x03, 0x21, 0x04, 0xC6, 0x04, 0x5E, 0x05, 0xE7, 0x05, 0x6B, 0x06,
-	0xD5, 0x06, 0x33, 0x07, 0x8D, 0x07, 0xD6, 0x07, 0x1C, 0x08, 0x5F, 0x08,
-	0x6F, 0x08, 0x54, 0x08, 0x0B, 0x08, 0x93, 0x07, 0xE9, 0x06, 0x5B, 0x06,
-	0xF6, 0x05, 0xAB, 0x05, 0x70, 0x05, 0x15, 0x05, 0xC3, 0x04, 0x87, 0x04,
-	0x4E, 0x04, 0xD9, 0x03, 0x2E, 0x03, 0x91, 0x02, 0x39, 0x02, 0x30, 0x02,
-	0x7E, 0x02, 0xDA, 0x02, 0x35, 0x03, 0x88, 0x03, 0xD9, 0x03, 0x16, 0x04,
-	0x25, 0x04, 0x11, 0x04, 0x22, 0x04, 0x68, 0x04, 0xDD, 0x04, 0x59, 0x05,
-	0xF5, 0x05, 0x65, 0x06, 0xA8, 0x06, 0xA2, 0x06, 0x5F, 0x06, 0xFA, 0x05,
-	0xBB, 0x05, 0x9A, 0x05, 0x65, 0x05, 0x28, 0x05, 0xD4, 0x04, 0x80, 0x04,
-	0x0E, 0x04, 0x55, 0x03, 0x55, 0x02, 0x32, 0x01, 0x28, 0x00, 0x51, 0xFF,
-	0x8B, 0xFE, 0xD5, 0xFD, 0x28, 0xFD, 0x71, 0xFC, 0xA2, 0xFB, 0xB8, 0xFA,
-	0x8D, 0xF9, 0x6B, 0xF8, 0x5E, 0xF7, 0x6C, 0xF6, 0xA3, 0xF5, 0x16, 0xF5,
-	0xB9, 0xF4, 0x4F, 0xF4, 0xF4, 0xF3, 0x60, 0xF3, 0xBB, 0xF2, 0xF9, 0xF1,
-	0x4A, 0xF1, 0xAC, 0xF0, 0x1C, 0xF0, 0xA0, 0xEF, 0x37, 0xEF, 0xF0, 0xEE,
-	0x7E, 0xEE, 0xC1, 0xED, 0xE9, 0xEC, 0x12, 0xEC, 0x2E, 0xEB, 0x38, 0xEA,
-	0x39, 0xE9, 0x46, 0xE8, 0x5A, 0xE7, 0x3C, 0xE6, 0xEE, 0xE4, 0x95, 0xE3,
-	0x1F, 0xE2, 0xBF, 0xE0, 0x91, 0xDF, 0xB7, 0xDE, 0x2A, 0xDE, 0x48, 0xDE,
-	0x70, 0xDF, 0x34, 0xE1, 0xC7, 0xE2, 0xEE, 0xE3, 0x2F, 0xE5, 0xB1, 0xE6,
-	0x47, 0xE8, 0xC5, 0xE9, 0x9F, 0xEB, 0x3D, 0xEE, 0xB3, 0xF1, 0xCE, 0xF5,
-	0x0C, 0xFA, 0x47, 0xFE, 0x41, 0x02, 0xD4, 0x05, 0x05, 0x09, 0xD2, 0x0B,
-	0x62, 0x0E, 0xED, 0x10, 0xCE, 0x13, 0xA8, 0x16, 0x1C, 0x19, 0x03, 0x1B,
-	0xCA, 0x1C, 0x23, 0x1E, 0xC4, 0x1E, 0xA8, 0x1E, 0x02, 0x1E, 0x49, 0x1D,
-	0xA8, 0x1C, 0x16, 0x1C, 0x19, 0x1B, 0x8F, 0x19, 0x96, 0x17, 0x2C, 0x15,
-	0x3B, 0x12, 0x0B, 0x0F, 0xCA, 0x0B, 0xA9, 0x08, 0xF8, 0x05, 0xCC, 0x03,
-	0xE0, 0x01, 0x2B, 0x00, 0x85, 0xFE, 0xBA, 0xFC, 0xA3, 0xFA, 0x4E, 0xF8,
-	0x32, 0xF6, 0xB2, 0xF4, 0xD0, 0xF3, 0x73, 0xF3, 0x7B, 0xF3, 0xF4, 0xF3,
-	0xC0, 0xF4, 0xF2, 0xF5, 0x04, 0xF7, 0xD4, 0xF7, 0x83, 0xF8, 0x4D, 0xF9,
-	0x58, 0xFA, 0xA7, 0xFB, 0x22, 0xFD, 0x9E, 0xFE, 0x10, 0x00, 0x6E, 0x01,
-	0x8D, 0x02, 0x6C, 0x03, 0x1B, 0x04, 0xA2, 0x04, 0x12, 0x05, 0x64, 0x05,
-	0x8C, 0x05, 0x9E, 0x05, 0xB1, 0x05, 0x79, 0x05, 0xE3, 0x04, 0xC7, 0x03,
-	0x72, 0x02, 0x3C, 0x01, 0x34, 0x00, 0x29, 0xFF, 0x35, 0xFE, 0x62, 0xFD,
-	0xDD, 0xFC, 0x85, 0xFC, 0x20, 0xFC, 0x83, 0xFB, 0xBE, 0xFA, 0x16, 0xFA,
-	0xB0, 0xF9, 0x6E, 0xF9, 0x7D, 0xF9, 0xFB, 0xF9, 0xE4, 0xFA, 0xFE, 0xFB,
-	0x31, 0xFD, 0x63, 0xFE, 0x9F, 0xFF, 0xFA, 0x00, 0x52, 0x02, 0x7E, 0x03,
-	0xC2, 0x04, 0x31, 0x06, 0xB7, 0x07, 0x49, 0x09, 0x9E, 0x0A, 0xBD, 0x0B,
-	0xB3, 0x0C, 0x8E, 0x0D, 0x51, 0x0E, 0xCA, 0x0E, 0x30, 0x0F, 0x77, 0x0F,
-	0xA5, 0x0F, 0x9A, 0x0F, 0x44, 0x0F, 0xAD, 0x0E, 0xB6, 0x0D, 0x99, 0x0C,
-	0x37, 0x0B, 0xC9, 0x09, 0x52, 0x08, 0x14, 0x07, 0x06, 0x06, 0xD7, 0x04,
-	0x97, 0x03, 0x55, 0x02, 0x00, 0x01, 0xBA, 0xFF, 0x6D, 0xFE, 0x12, 0xFD,
-	0xE4, 0xFB, 0x08, 0xFB, 0x91, 0xFA, 0x3F, 0xFA, 0x2F, 0xFA, 0x4F, 0xFA,
-	0x90, 0xFA, 0xF6, 0xFA, 0x5D, 0xFB, 0xBA, 0xFB, 0x5F, 0xFC, 0x29, 0xFD,
-	0x07, 0xFE, 0x42, 0xFF, 0xFD, 0x00, 0xD5, 0x02, 0x5F, 0x04, 0x89, 0x05,
-	0xA2, 0x06, 0xAE, 0x07, 0x94, 0x08, 0x3F, 0x09, 0xF2, 0x09, 0xFA, 0x0A,
-	0x45, 0x0C, 0xAE, 0x0D, 0xA9, 0x0E, 0x2B, 0x0F, 0x4A, 0x0F, 0x26, 0x0F,
-	0xAB, 0x0E, 0xD4, 0x0D, 0xEA, 0x0C, 0x44, 0x0C, 0xD2, 0x0B, 0x61, 0x0B,
-	0xB8, 0x0A, 0xFA, 0x09, 0x43, 0x09, 0x47, 0x08, 0xDB, 0x06, 0x69, 0x05,
-	0x45, 0x04, 0x8E, 0x03, 0x03, 0x03, 0x7D, 0x02, 0x00, 0x02, 0x9F, 0x01,
-	0x46, 0x01, 0xFC, 0x00, 0x5E, 0x00, 0xDA, 0xFF, 0x91, 0xFF, 0xA9, 0xFF,
-	0x0D, 0x00, 0x96, 0x00, 0x3E, 0x01, 0xE4, 0x01, 0x79, 0x02, 0xC8, 0x02,
-	0xE0, 0x02, 0xE1, 0x02, 0xEB, 0x02, 0x02, 0x03, 0x37, 0x03, 0x90, 0x03,
-	0xF7, 0x03, 0x44, 0x04, 0x80, 0x04, 0x75, 0x04, 0xF7, 0x03, 0x3D, 0x03,
-	0x83, 0x02, 0xAA, 0x01, 0xDB, 0x00, 0x0A, 0x00, 0x41, 0xFF, 0x83, 0xFE,
-	0xBF, 0xFD, 0xCB, 0xFC, 0x98, 0xFB, 0x40, 0xFA, 0x02, 0xF9, 0xC0, 0xF7,
-	0x7D, 0xF6, 0x47, 0xF5, 0x48, 0xF4, 0x5E, 0xF3, 0x7D, 0xF2, 0x8F, 0xF1,
-	0x8D, 0xF0, 0x8A, 0xEF, 0x8D, 0xEE, 0xC9, 0xED, 0x19, 0xED, 0x7D, 0xEC,
-	0xF0, 0xEB, 0xA2, 0xEB, 0x5C, 0xEB, 0xD0, 0xEA, 0x2A, 0xEA, 0x7A, 0xE9,
-	0xAB, 0xE8, 0xD6, 0xE7, 0x08, 0xE7, 0x5C, 0xE6, 0xA7, 0xE5, 0xD1, 0xE4,
-	0x26, 0xE4, 0x9D, 0xE3, 0xFF, 0xE2, 0x40, 0xE2, 0x9A, 0xE1, 0x7A, 0xE1,
-	0x1E, 0xE2, 0x6F, 0xE3, 0xF7, 0xE4, 0x9A, 0xE6, 0x30, 0xE8, 0xCA, 0xE9,
-	0x4D, 0xEB, 0x86, 0xEC, 0xC0, 0xED, 0x77, 0xEF, 0xE9, 0xF1, 0x04, 0xF5,
-	0x9B, 0xF8, 0x92, 0xFC, 0x89, 0x00, 0x16, 0x04, 0x30, 0x07, 0xB0, 0x09,
-	0xDA, 0x0B, 0xEF, 0x0D, 0x37, 0x10, 0x7F, 0x12, 0xA9, 0x14, 0xA6, 0x16,
-	0xC5, 0x18, 0x9B, 0x1A, 0xA3, 0x1B, 0xD7, 0x1B, 0x95, 0x1B, 0x1A, 0x1B,
-	0x9A, 0x1A, 0xFE, 0x19, 0x50, 0x19, 0x5A, 0x18, 0x27, 0x17, 0x96, 0x15,
-	0x8C, 0x13, 0xFA, 0x10, 0x26, 0x0E, 0x57, 0x0B, 0xCD, 0x08, 0x87, 0x06,
-	0xB2, 0x04, 0x4A, 0x03, 0x00, 0x02, 0x99, 0x00, 0xE4, 0xFE, 0xDA, 0xFC,
-	0xF1, 0xFA, 0x50, 0xF9, 0x0B, 0xF8, 0x06, 0xF7, 0x85, 0xF6, 0x90, 0xF6,
-	0x2C, 0xF7, 0x04, 0xF8, 0xED, 0xF8, 0x8B, 0xF9, 0x14, 0xFA, 0x93, 0xFA,
-	0x27, 0xFB, 0xD6, 0xFB, 0xB0, 0xFC, 0x98, 0xFD, 0xA9, 0xFE, 0xC2, 0xFF,
-	0xCC, 0x00, 0xAA, 0x01, 0x58, 0x02, 0xE4, 0x02, 0x29, 0x03, 0x43, 0x03,
-	0x4D, 0x03, 0x63, 0x03, 0x5D, 0x03, 0x4D, 0x03, 0xED, 0x02, 0x5A, 0x02,
-	0x9F, 0x01, 0xCC, 0x00, 0xD9, 0xFF, 0xDE, 0xFE, 0xE7, 0xFD, 0x36, 0xFD,
-	0xDA, 0xFC, 0x9A, 0xFC, 0x95, 0xFC, 0x70, 0xFC, 0x45, 0xFC, 0xED, 0xFB,
-	0xA4, 0xFB, 0x6A, 0xFB, 0x3E, 0xFB, 0x76, 0xFB, 0x0A, 0xFC, 0x0D, 0xFD,
-	0x2F, 0xFE, 0x7D, 0xFF, 0xDD, 0x00, 0x32, 0x02, 0x57, 0x03, 0x49, 0x04,
-	0x22, 0x05, 0x2C, 0x06, 0x32, 0x07, 0x52, 0x08, 0x91, 0x09, 0xA8, 0x0A,
-	0xB4, 0x0B, 0xAF, 0x0C, 0x74, 0x0D, 0xD7, 0x0D, 0xEA, 0x0D, 0xEE, 0x0D,
-	0xFE, 0x0D, 0xF9, 0x0D, 0xC4, 0x0D, 0x70, 0x0D, 0xF3, 0x0C, 0x40, 0x0C,
-	0x4B, 0x0B, 0x23, 0x0A, 0xCA, 0x08, 0x69, 0x07, 0x4E, 0x06, 0x51, 0x05,
-	0x66, 0x04, 0x85, 0x03, 0xA4, 0x02, 0xD2, 0x01, 0xF6, 0x00, 0xE7, 0xFF,
-	0xC6, 0xFE, 0xDB, 0xFD, 0x1A, 0xFD, 0xA8, 0xFC, 0x62, 0xFC, 0x49, 0xFC,
-	0x89, 0xFC, 0xDE, 0xFC, 0x43, 0xFD, 0x86, 0xFD, 0xC2, 0xFD, 0x33, 0xFE,
-	0xC0, 0xFE, 0x5D, 0xFF, 0x12, 0x00, 0xFE, 0x00, 0x02, 0x02, 0xF7, 0x02,
-	0xBC, 0x03, 0x77, 0x04, 0x10, 0x05, 0x99, 0x05, 0x26, 0x06, 0xB9, 0x06,
-	0x49, 0x07, 0xF0, 0x07, 0xA4, 0x08, 0x56, 0x09, 0x00, 0x0A, 0x54, 0x0A,
-	0x4E, 0x0A, 0xEE, 0x09, 0x7B, 0x09, 0x10, 0x09, 0xAD, 0x08, 0x6B, 0x08,
-	0x38, 0x08, 0x30, 0x08, 0x30, 0x08, 0x28, 0x08, 0xBB, 0x07, 0x12, 0x07,
-	0x54, 0x06, 0x98, 0x05, 0xD6, 0x04, 0x38, 0x04, 0xED, 0x03, 0xB2, 0x03,
-	0x8A, 0x03, 0x49, 0x03, 0xF5, 0x02, 0xAA, 0x02, 0x60, 0x02, 0x12, 0x02,
-	0xD2, 0x01, 0xB3, 0x01, 0xD1, 0x01, 0x11, 0x02, 0x58, 0x02, 0x74, 0x02,
-	0x70, 0x02, 0x53, 0x02, 0x1D, 0x02, 0xFD, 0x01, 0xF3, 0x01, 0x05, 0x02,
-	0x3B, 0x02, 0x9D, 0x02, 0xF0, 0x02, 0x16, 0x03, 0x24, 0x03, 0xEA, 0x02,
-	0x7F, 0x02, 0xEF, 0x01, 0x6C, 0x01, 0xFB, 0x00, 0xAB, 0x00, 0x71, 0x00,
-	0x49, 0x00, 0x04, 0x00, 0xA4, 0xFF, 0x27, 0xFF, 0x95, 0xFE, 0xD6, 0xFD,
-	0x08, 0xFD, 0x1A, 0xFC, 0x5A, 0xFB, 0xB6, 0xFA, 0x18, 0xFA, 0x83, 0xF9,
-	0xEF, 0xF8, 0x4D, 0xF8, 0xA2, 0xF7, 0xEF, 0xF6, 0x60, 0xF6, 0xD0, 0xF5,
-	0x56, 0xF5, 0xE1, 0xF4, 0x87, 0xF4, 0x30, 0xF4, 0xD0, 0xF3, 0x72, 0xF3,
-	0xF3, 0xF2, 0x88, 0xF2, 0x2A, 0xF2, 0xEA, 0xF1, 0xBE, 0xF1, 0x91, 0xF1,
-	0x79, 0xF1, 0x6E, 0xF1, 0x40, 0xF1, 0xCC, 0xF0, 0x4F, 0xF0, 0xE2, 0xEF,
-	0x79, 0xEF, 0xD8, 0xEE, 0x15, 0xEE, 0x42, 0xED, 0xA3, 0xEC, 0x14, 0xEC,
-	0x45, 0xEB, 0x35, 0xEA, 0x23, 0xE9, 0xFE, 0xE7, 0xF6, 0xE6, 0xF6, 0xE5,
-	0x37, 0xE5, 0x4E, 0xE5, 0xC8, 0xE6, 0x15, 0xE9, 0x01, 0xEB, 0x1D, 0xEC,
-	0xE7, 0xEC, 0xE2, 0xED, 0xC3, 0xEE, 0x49, 0xEF, 0x0E, 0xF0, 0xCD, 0xF1,
-	0x05, 0xF5, 0x0C, 0xF9, 0x42, 0xFD, 0x25, 0x01, 0x5F, 0x04, 0x0A, 0x07,
-	0x0E, 0x09, 0x84, 0x0A, 0xC9, 0x0B, 0x6E, 0x0D, 0xA0, 0x0F, 0x1F, 0x12,
-	0x45, 0x14, 0x28, 0x16, 0xE1, 0x17, 0x1C, 0x19, 0x2A, 0x19, 0x1D, 0x18,
-	0xD6, 0x16, 0x0E, 0x16, 0xC8, 0x15, 0xB7, 0x15, 0x43, 0x15, 0x2D, 0x14,
-	0xAD, 0x12, 0xAF, 0x10, 0x27, 0x0E, 0x13, 0x0B, 0xEE, 0x07, 0x3E, 0x05,
-	0x52, 0x03, 0x18, 0x02, 0x54, 0x01, 0x9F, 0x00, 0xBA, 0xFF, 0x71, 0xFE,
-	0x92, 0xFC, 0x65, 0xFA, 0x75, 0xF8, 0x1C, 0xF7, 0x80, 0xF6, 0x4D, 0xF6,
-	0xA3, 0xF6, 0x77, 0xF7, 0xBE, 0xF8, 0x21, 0xFA, 0x33, 0xFB, 0x8D, 0xFB,
-	0x9F, 0xFB, 0xE0, 0xFB, 0x8D, 0xFC, 0x88, 0xFD, 0x99, 0xFE, 0xBC, 0xFF,
-	0xEF, 0x00, 0x05, 0x02, 0xF0, 0x02, 0x75, 0x03, 0xB1, 0x03, 0xAF, 0x03,
-	0x9C, 0x03, 0x97, 0x03, 0xAC, 0x03, 0xDF, 0x03, 0x04, 0x04, 0xE9, 0x03,
-	0x5A, 0x03, 0x51, 0x02, 0x00, 0x01, 0xB8, 0xFF, 0x95, 0xFE, 0x99, 0xFD,
-	0xD9, 0xFC, 0x94, 0xFC, 0xBE, 0xFC, 0xF6, 0xFC, 0x0B, 0xFD, 0xC5, 0xFC,
-	0x0F, 0xFC, 0x46, 0xFB, 0x89, 0xFA, 0x3B, 0xFA, 0x7C, 0xFA, 0x35, 0xFB,
-	0x4F, 0xFC, 0xA0, 0xFD, 0xE4, 0xFE, 0x24, 0x00, 0x48, 0x01, 0x27, 0x02,
-	0xEA, 0x02, 0x92, 0x03, 0x65, 0x04, 0x85, 0x05, 0xE7, 0x06, 0x64, 0x08,
-	0x98, 0x09, 0x7A, 0x0A, 0x1B, 0x0B, 0x93, 0x0B, 0xD3, 0x0B, 0x0C, 0x0C,
-	0x38, 0x0C, 0x83, 0x0C, 0xCE, 0x0C, 0xEF, 0x0C, 0xEB, 0x0C, 0x92, 0x0C,
-	0xB4, 0x0B, 0x6F, 0x0A, 0x04, 0x09, 0xB7, 0x07, 0xB1, 0x06, 0xD2, 0x05,
-	0x1E, 0x05, 0x7C, 0x04, 0xD8, 0x03, 0x22, 0x03, 0x4F, 0x02, 0x48, 0x01,
-	0x1A, 0x00, 0xF0, 0xFE, 0xEE, 0xFD, 0x37, 0xFD, 0xDB, 0xFC, 0xCF, 0xFC,
-	0x11, 0xFD, 0x55, 0xFD, 0x94, 0xFD, 0xCC, 0xFD, 0x14, 0xFE, 0x74, 0xFE,
-	0xE4, 0xFE, 0x44, 0xFF, 0xC0, 0xFF, 0x54, 0x00, 0x21, 0x01, 0xE1, 0x01,
-	0xA0, 0x02, 0x3C, 0x03, 0x14, 0x04, 0x2D, 0x05, 0x4B, 0x06, 0x31, 0x07,
-	0xEC, 0x07, 0x83, 0x08, 0xF8, 0x08, 0x50, 0x09, 0x66, 0x09, 0x6C, 0x09,
-	0xA0, 0x09, 0x35, 0x0A, 0xDF, 0x0A, 0x32, 0x0B, 0x0B, 0x0B, 0xAE, 0x0A,
-	0x5E, 0x0A, 0xEA, 0x09, 0x0E, 0x09, 0x14, 0x08, 0x58, 0x07, 0x03, 0x07,
-	0xC4, 0x06, 0x3F, 0x06, 0x77, 0x05, 0xAE, 0x04, 0xF7, 0x03, 0x39, 0x03,
-	0x4C, 0x02, 0x3B, 0x01, 0x81, 0x00, 0x39, 0x00, 0x1E, 0x00, 0xC7, 0xFF,
-	0x6E, 0xFF, 0x66, 0xFF, 0x66, 0xFF, 0x3F, 0xFF, 0xE0, 0xFE, 0xA8, 0xFE,
-	0xB7, 0xFE, 0x09, 0xFF, 0x71, 0xFF, 0xB7, 0xFF, 0x0E, 0x00, 0xA5, 0x00,
-	0x44, 0x01, 0xB3, 0x01, 0xB3, 0x01, 0xB0, 0x01, 0xEB, 0x01, 0x35, 0x02,
-	0x6E, 0x02, 0x7C, 0x02, 0xB4, 0x02, 0xF4, 0x02, 0x1E, 0x03, 0x0F, 0x03,
-	0xBC, 0x02, 0x43, 0x02, 0xC0, 0x01, 0x31, 0x01, 0xA0, 0x00, 0x09, 0x00,
-	0x89, 0xFF, 0x2C, 0xFF, 0x9C, 0xFE, 0xE0, 0xFD, 0xFD, 0xFC, 0x18, 0xFC,
-	0x38, 0xFB, 0x4F, 0xFA, 0x67, 0xF9, 0x8E, 0xF8, 0xEA, 0xF7, 0x54, 0xF7,
-	0xD5, 0xF6, 0x4F, 0xF6, 0xBF, 0xF5, 0x02, 0xF5, 0x65, 0xF4, 0xDA, 0xF3,
-	0x76, 0xF3, 0x2D, 0xF3, 0xF6, 0xF2, 0xC3, 0xF2, 0x88, 0xF2, 0x5B, 0xF2,
-	0x1D, 0xF2, 0xD5, 0xF1, 0x67, 0xF1, 0xE7, 0xF0, 0x6B, 0xF0, 0x04, 0xF0,
-	0xB1, 0xEF, 0x42, 0xEF, 0xB4, 0xEE, 0xDE, 0xED, 0xE4, 0xEC, 0xD1, 0xEB,
-	0xC7, 0xEA, 0x91, 0xE9, 0x1D, 0xE8, 0xB1, 0xE6, 0x88, 0xE5, 0xB4, 0xE4,
-	0xA2, 0xE4, 0xFD, 0xE5, 0x60, 0xE8, 0x3E, 0xEA, 0xF1, 0xEA, 0x42, 0xEB,
-	0x04, 0xEC, 0xD6, 0xEC, 0x17, 0xED, 0x74, 0xED, 0x02, 0xEF, 0x38, 0xF2,
-	0x83, 0xF6, 0x1F, 0xFB, 0x41, 0xFF, 0x83, 0x02, 0x19, 0x05, 0x40, 0x07,
-	0xE4, 0x08, 0x2F, 0x0A, 0xE4, 0x0B, 0x70, 0x0E, 0x6B, 0x11, 0x00, 0x14,
-	0x3C, 0x16, 0x5E, 0x18, 0xDC, 0x19, 0xF7, 0x19, 0xD9, 0x18, 0x99, 0x17,
-	0x17, 0x17, 0x65, 0x17, 0xE9, 0x17, 0xFC, 0x17, 0x3B, 0x17, 0xBD, 0x15,
-	0xA8, 0x13, 0xDA, 0x10, 0x70, 0x0D, 0xE0, 0x09, 0xEF, 0x06, 0x11, 0x05,
-	0x1A, 0x04, 0x8F, 0x03, 0xE1, 0x02, 0xCF, 0x01, 0x0F, 0x00, 0x99, 0xFD,
-	0xCA, 0xFA, 0x4C, 0xF8, 0x7D, 0xF6, 0x7B, 0xF5, 0x45, 0xF5, 0x9E, 0xF5,
-	0x8D, 0xF6, 0xC5, 0xF7, 0xDF, 0xF8, 0xB4, 0xF9, 0xA3, 0xF9, 0x6D, 0xF9,
-	0x89, 0xF9, 0x56, 0xFA, 0xA4, 0xFB, 0x13, 0xFD, 0x93, 0xFE, 0x00, 0x00,
-	0x44, 0x01, 0x4A, 0x02, 0xF1, 0x02, 0x2C, 0x03, 0x4A, 0x03, 0xAD, 0x03,
-	0x26, 0x04, 0xCA, 0x04, 0x4E, 0x05, 0xA1, 0x05, 0x9E, 0x05, 0x30, 0x05,
-	0x11, 0x04, 0xB4, 0x02, 0x69, 0x01, 0x56, 0x00, 0x79, 0xFF, 0xB0, 0xFE,
-	0x4C, 0xFE, 0x44, 0xFE, 0x79, 0xFE, 0x56, 0xFE, 0x87, 0xFD, 0x6A, 0xFC,
-	0x29, 0xFB, 0x44, 0xFA, 0xDA, 0xF9, 0xC4, 0xF9, 0xFF, 0xF9, 0xA4, 0xFA,
-	0xCA, 0xFB, 0x0C, 0xFD, 0x0A, 0xFE, 0xE4, 0xFE, 0xB1, 0xFF, 0x5B, 0x00,
-	0x10, 0x01, 0xF3, 0x01, 0x18, 0x03, 0xA7, 0x04, 0x44, 0x06, 0xAB, 0x07,
-	0xC6, 0x08, 0x9B, 0x09, 0x5B, 0x0A, 0x1E, 0x0B, 0xB0, 0x0B, 0x3D, 0x0C,
-	0xCA, 0x0C, 0x8C, 0x0D, 0x42, 0x0E, 0xAB, 0x0E, 0x7D, 0x0E, 0xC3, 0x0D,
-	0xB5, 0x0C, 0xA3, 0x0B, 0x81, 0x0A, 0x78, 0x09, 0xA2, 0x08, 0x11, 0x08,
-	0xA2, 0x07, 0x29, 0x07, 0x6F, 0x06, 0x42, 0x05, 0xE4, 0x03, 0x50, 0x02,
-	0xDB, 0x00, 0x73, 0xFF, 0x4B, 0xFE, 0x9A, 0xFD, 0x69, 0xFD, 0x60, 0xFD,
-	0x54, 0xFD, 0x39, 0xFD, 0x20, 0xFD, 0xFA, 0xFC, 0xBE, 0xFC, 0x7C, 0xFC,
-	0x72, 0xFC, 0xBA, 0xFC, 0x5B, 0xFD, 0x1F, 0xFE, 0xCC, 0xFE, 0x61, 0xFF,
-	0xEB, 0xFF, 0x85, 0x00, 0xE2, 0x00, 0x36, 0x01, 0x90, 0x01, 0x2A, 0x02,
-	0xD6, 0x02, 0x81, 0x03, 0xEA, 0x03, 0x20, 0x04, 0x28, 0x04, 0x08, 0x04,
-	0x86, 0x03, 0xF8, 0x02, 0x76, 0x02, 0x1B, 0x02, 0xF1, 0x01, 0x12, 0x02,
-	0xC2, 0x02, 0x18, 0x04, 0x49, 0x05, 0x81, 0x05, 0xEE, 0x04, 0x2F, 0x04,
-	0x8D, 0x03, 0x0F, 0x03, 0x82, 0x02, 0x78, 0x02, 0x45, 0x03, 0xD5, 0x04,
-	0x85, 0x06, 0xAE, 0x07, 0x0D, 0x08, 0xFA, 0x07, 0xC9, 0x07, 0x7F, 0x07,
-	0x12, 0x07, 0xCA, 0x06, 0x2F, 0x07, 0xF4, 0x07, 0x7B, 0x08, 0x81, 0x08,
-	0x46, 0x08, 0x29, 0x08, 0xBF, 0x07, 0xE6, 0x06, 0xF7, 0x05, 0x7B, 0x05,
-	0x98, 0x05, 0xD0, 0x05, 0xC9, 0x05, 0x29, 0x05, 0x27, 0x04, 0x19, 0x03,
-	0xF6, 0x01, 0xBD, 0x00, 0xA7, 0xFF, 0x03, 0xFF, 0x02, 0xFF, 0x4B, 0xFF,
-	0x85, 0xFF, 0x90, 0xFF, 0x5B, 0xFF, 0xF1, 0xFE, 0x38, 0xFE, 0x48, 0xFD,
-	0x75, 0xFC, 0x0A, 0xFC, 0x11, 0xFC, 0x58, 0xFC, 0xBA, 0xFC, 0x20, 0xFD,
-	0xA4, 0xFD, 0x0F, 0xFE, 0x49, 0xFE, 0x1B, 0xFE, 0xB5, 0xFD, 0x51, 0xFD,
-	0x20, 0xFD, 0x12, 0xFD, 0x20, 0xFD, 0x22, 0xFD, 0x21, 0xFD, 0x1C, 0xFD,
-	0xE4, 0xFC, 0x89, 0xFC, 0xFD, 0xFB, 0x62, 0xFB, 0x07, 0xFB, 0xA6, 0xFA,
-	0x46, 0xFA, 0xD4, 0xF9, 0x5F, 0xF9, 0xE0, 0xF8, 0x21, 0xF8, 0x17, 0xF7,
-	0x23, 0xF6, 0x52, 0xF5, 0xBB, 0xF4, 0x79, 0xF4, 0x52, 0xF4, 0x42, 0xF4,
-	0x6F, 0xF4, 0x6E, 0xF4, 0x2B, 0xF4, 0x94, 0xF3, 0xC3, 0xF2, 0x1E, 0xF2,
-	0x98, 0xF1, 0x4B, 0xF1, 0x3A, 0xF1, 0x3E, 0xF1, 0x5A, 0xF1, 0x8B, 0xF1,
-	0x83, 0xF1, 0x07, 0xF1, 0x2C, 0xF0, 0x3E, 0xEF, 0x6E, 0xEE, 0x7C, 0xED,
-	0x30, 0xEC, 0x19, 0xEB, 0x62, 0xEA, 0xFF, 0xE9, 0xA4, 0xE9, 0xF2, 0xE9,
-	0xA7, 0xEB, 0xF0, 0xED, 0x2A, 0xEF, 0x70, 0xEF, 0x9D, 0xEF, 0x2C, 0xF0,
-	0xB2, 0xF0, 0xD1, 0xF0, 0x5B, 0xF1, 0x16, 0xF3, 0x04, 0xF6, 0x9D, 0xF9,
-	0x09, 0xFD, 0xD9, 0xFF, 0xFD, 0x01, 0xCC, 0x03, 0x7F, 0x05, 0xB5, 0x06,
-	0xD4, 0x07, 0x94, 0x09, 0x0A, 0x0C, 0x57, 0x0E, 0xC7, 0x0F, 0xC5, 0x10,
-	0xE9, 0x11, 0xA2, 0x12, 0x5C, 0x12, 0x78, 0x11, 0x1B, 0x11, 0xA6, 0x11,
-	0x76, 0x12, 0x0B, 0x13, 0xB0, 0x12, 0x89, 0x11, 0xCD, 0x0F, 0xA7, 0x0D,
-	0x1C, 0x0B, 0xA6, 0x08, 0x70, 0x06, 0x04, 0x05, 0x7D, 0x04, 0x3C, 0x04,
-	0xD5, 0x03, 0x2F, 0x03, 0x0A, 0x02, 0x6E, 0x00, 0x73, 0xFE, 0x65, 0xFC,
-	0x14, 0xFB, 0x52, 0xFA, 0x35, 0xFA, 0x4E, 0xFA, 0x84, 0xFA, 0x05, 0xFB,
-	0xB2, 0xFB, 0x5F, 0xFC, 0xD5, 0xFC, 0x03, 0xFD, 0x25, 0xFD, 0xB7, 0xFD,
-	0xA7, 0xFE, 0x9B, 0xFF, 0x6B, 0x00, 0xFC, 0x00, 0x81, 0x01, 0xED, 0x01,
-	0x57, 0x02, 0xB6, 0x02, 0xF7, 0x02, 0x55, 0x03, 0xD8, 0x03, 0x51, 0x04,
-	0x9F, 0x04, 0xA1, 0x04, 0x5F, 0x04, 0xD7, 0x03, 0xE4, 0x02, 0xBC, 0x01,
-	0x9D, 0x00, 0xBC, 0xFF, 0x2B, 0xFF, 0xB6, 0xFE, 0x66, 0xFE, 0x44, 0xFE,
-	0x4B, 0xFE, 0x36, 0xFE, 0xE3, 0xFD, 0x31, 0xFD, 0x5E, 0xFC, 0xA2, 0xFB,
-	0x46, 0xFB, 0x4F, 0xFB, 0x94, 0xFB, 0x1A, 0xFC, 0xE6, 0xFC, 0xCA, 0xFD,
-	0xAA, 0xFE, 0x59, 0xFF, 0xFD, 0xFF, 0xC4, 0x00, 0x98, 0x01, 0x7A, 0x02,
-	0x70, 0x03, 0x90, 0x04, 0xB3, 0x05, 0xAB, 0x06, 0x64, 0x07, 0xEA, 0x07,
-	0x50, 0x08, 0xC2, 0x08, 0x2B, 0x09, 0xC5, 0x09, 0x6B, 0x0A, 0x24, 0x0B,
-	0xAC, 0x0B, 0xD3, 0x0B, 0x9C, 0x0B, 0xF3, 0x0A, 0xFC, 0x09, 0xEE, 0x08,
-	0xFB, 0x07, 0x3B, 0x07, 0xB7, 0x06, 0x60, 0x06, 0x10, 0x06, 0xB3, 0x05,
-	0x26, 0x05, 0x68, 0x04, 0x61, 0x03, 0x57, 0x02, 0x6C, 0x01, 0xB1, 0x00,
-	0x22, 0x00, 0xA8, 0xFF, 0x5C, 0xFF, 0x52, 0xFF, 0x69, 0xFF, 0x91, 0xFF,
-	0x93, 0xFF, 0x9A, 0xFF, 0xD3, 0xFF, 0x1C, 0x00, 0x73, 0x00, 0xB1, 0x00,
-	0x1A, 0x01, 0x9D, 0x01, 0x26, 0x02, 0x84, 0x02, 0xDA, 0x02, 0x23, 0x03,
-	0x85, 0x03, 0xD9, 0x03, 0x2F, 0x04, 0x6F, 0x04, 0xB7, 0x04, 0x13, 0x05,
-	0x7B, 0x05, 0x9E, 0x05, 0x66, 0x05, 0x09, 0x05, 0x8D, 0x04, 0x0C, 0x04,
-	0x65, 0x03, 0xD5, 0x02, 0x6F, 0x02, 0x35, 0x02, 0x28, 0x02, 0x2F, 0x02,
-	0x1B, 0x02, 0xD0, 0x01, 0x50, 0x01, 0xBF, 0x00, 0x31, 0x00, 0xC2, 0xFF,
-	0x90, 0xFF, 0xAC, 0xFF, 0xEC, 0xFF, 0x48, 0x00, 0xAA, 0x00, 0xEF, 0x00,
-	0x32, 0x01, 0x8A, 0x01, 0xC0, 0x01, 0x04, 0x02, 0x59, 0x02, 0xD2, 0x02,
-	0x6A, 0x03, 0x04, 0x04, 0x76, 0x04, 0xD5, 0x04, 0x0F, 0x05, 0x4B, 0x05,
-	0x8A, 0x05, 0xA3, 0x05, 0xC4, 0x05, 0xFA, 0x05, 0x5B, 0x06, 0x8A, 0x06,
-	0x8E, 0x06, 0x68, 0x06, 0x26, 0x06, 0xCA, 0x05, 0x4B, 0x05, 0xB8, 0x04,
-	0x46, 0x04, 0xED, 0x03, 0xA9, 0x03, 0x71, 0x03, 0x20, 0x03, 0xF0, 0x02,
-	0x9B, 0x02, 0x43, 0x02, 0xBD, 0x01, 0x1F, 0x01, 0x7F, 0x00, 0xE8, 0xFF,
-	0x7B, 0xFF, 0x23, 0xFF, 0xEE, 0xFE, 0xDC, 0xFE, 0xF4, 0xFE, 0xE9, 0xFE,
-	0xBD, 0xFE, 0x73, 0xFE, 0x37, 0xFE, 0xF6, 0xFD, 0xC9, 0xFD, 0x9D, 0xFD,
-	0x82, 0xFD, 0x84, 0xFD, 0x81, 0xFD, 0x80, 0xFD, 0x53, 0xFD, 0x1B, 0xFD,
-	0xE6, 0xFC, 0xA6, 0xFC, 0x7C, 0xFC, 0x4B, 0xFC, 0x22, 0xFC, 0xF5, 0xFB,
-	0xB7, 0xFB, 0x70, 0xFB, 0x14, 0xFB, 0xA5, 0xFA, 0x2D, 0xFA, 0xAC, 0xF9,
-	0x3C, 0xF9, 0xE4, 0xF8, 0xA9, 0xF8, 0x82, 0xF8, 0x62, 0xF8, 0x46, 0xF8,
-	0x1F, 0xF8, 0xDE, 0xF7, 0x99, 0xF7, 0x50, 0xF7, 0x26, 0xF7, 0x10, 0xF7,
-	0xFB, 0xF6, 0x03, 0xF7, 0x1F, 0xF7, 0x54, 0xF7, 0xA1, 0xF7, 0xE2, 0xF7,
-	0xFD, 0xF7, 0x1F, 0xF8, 0x36, 0xF8, 0x57, 0xF8, 0x72, 0xF8, 0x86, 0xF8,
-	0x88, 0xF8, 0x77, 0xF8, 0x60, 0xF8, 0x3A, 0xF8, 0x03, 0xF8, 0x9F, 0xF7,
-	0x20, 0xF7, 0x7F, 0xF6, 0xD3, 0xF5, 0x04, 0xF5, 0x31, 0xF4, 0x2F, 0xF3,
-	0xEB, 0xF1, 0xAD, 0xF0, 0xA3, 0xEF, 0xAC, 0xEE, 0x9B, 0xED, 0x9C, 0xEC,
-	0xCA, 0xEB, 0x91, 0xEB, 0x4F, 0xEC, 0x9A, 0xED, 0xC0, 0xEE, 0x57, 0xEF,
-	0xCE, 0xEF, 0x8D, 0xF0, 0x53, 0xF1, 0xC4, 0xF1, 0x57, 0xF2, 0xE4, 0xF3,
-	0x77, 0xF6, 0x9D, 0xF9, 0xA2, 0xFC, 0xA9, 0xFF, 0x64, 0x02, 0xAB, 0x04,
-	0x67, 0x06, 0xBC, 0x07, 0xFC, 0x08, 0x84, 0x0A, 0x9E, 0x0C, 0xAF, 0x0E,
-	0x44, 0x10, 0x95, 0x11, 0xF3, 0x12, 0xF2, 0x13, 0x13, 0x14, 0x4F, 0x13,
-	0xA1, 0x12, 0x61, 0x12, 0x63, 0x12, 0x52, 0x12, 0xCE, 0x11, 0xDA, 0x10,
-	0x7C, 0x0F, 0xC6, 0x0D, 0x9D, 0x0B, 0x51, 0x09, 0x12, 0x07, 0x59, 0x05,
-	0x3B, 0x04, 0x4C, 0x03, 0x85, 0x02, 0xD8, 0x01, 0xEE, 0x00, 0xD2, 0xFF,
-	0x5F, 0xFE, 0xD0, 0xFC, 0x8F, 0xFB, 0xDB, 0xFA, 0xA4, 0xFA, 0xB0, 0xFA,
-	0xEA, 0xFA, 0x85, 0xFB, 0x6B, 0xFC, 0x4A, 0xFD, 0x1B, 0xFE, 0x92, 0xFE,
-	0xF1, 0xFE, 0x4F, 0xFF, 0xF1, 0xFF, 0xB1, 0x00, 0x62, 0x01, 0x10, 0x02,
-	0xCF, 0x02, 0x82, 0x03, 0xFC, 0x03, 0x5D, 0x04, 0x79, 0x04, 0x8E, 0x04,
-	0x8E, 0x04, 0x7A, 0x04, 0x67, 0x04, 0x31, 0x04, 0xE2, 0x03, 0x76, 0x03,
-	0xC7, 0x02, 0xDA, 0x01, 0xB0, 0x00, 0xB6, 0xFF, 0xF1, 0xFE, 0x54, 0xFE,
-	0xAE, 0xFD, 0x38, 0xFD, 0x0D, 0xFD, 0xFD, 0xFC, 0xCE, 0xFC, 0x51, 0xFC,
-	0xB7, 0xFB, 0x1D, 0xFB, 0xBC, 0xFA, 0xC1, 0xFA, 0x06, 0xFB, 0x75, 0xFB,
-	0x2C, 0xFC, 0x17, 0xFD, 0x08, 0xFE, 0xD0, 0xFE, 0x82, 0xFF, 0x49, 0x00,
-	0x1B, 0x01, 0xF3, 0x01, 0xC8, 0x02, 0xB3, 0x03, 0xBA, 0x04, 0xD7, 0x05,
-	0xCF, 0x06, 0x74, 0x07, 0x0B, 0x08, 0x8F, 0x08, 0x2D, 0x09, 0xB8, 0x09,
-	0x28, 0x0A, 0x85, 0x0A, 0xE1, 0x0A, 0x22, 0x0B, 0x2D, 0x0B, 0xE7, 0x0A,
-	0x54, 0x0A, 0x95, 0x09, 0xF0, 0x08, 0x48, 0x08, 0xAE, 0x07, 0x2D, 0x07,
-	0xAB, 0x06, 0x3E, 0x06, 0xBF, 0x05, 0x16, 0x05, 0x4A, 0x04, 0x69, 0x03,
-	0x9F, 0x02, 0xC7, 0x01, 0xF4, 0x00, 0x5E, 0x00, 0x03, 0x00, 0xEE, 0xFF,
-	0xE1, 0xFF, 0xBA, 0xFF, 0x99, 0xFF, 0x82, 0xFF, 0x7D, 0xFF, 0x87, 0xFF,
-	0x93, 0xFF, 0xB0, 0xFF, 0xF5, 0xFF, 0x4A, 0x00, 0xCB, 0x00, 0x34, 0x01,
-	0x8E, 0x01, 0xE1, 0x01, 0x2C, 0x02, 0x5B, 0x02, 0x80, 0x02, 0xBE, 0x02,
-	0xFE, 0x02, 0x43, 0x03, 0x7F, 0x03, 0x9B, 0x03, 0xAE, 0x03, 0x91, 0x03,
-	0x4E, 0x03, 0xEF, 0x02, 0x76, 0x02, 0x0A, 0x02, 0xB9, 0x01, 0x8C, 0x01,
-	0x76, 0x01, 0x4C, 0x01, 0x10, 0x01, 0xDE, 0x00, 0x76, 0x00, 0x06, 0x00,
-	0x89, 0xFF, 0x36, 0xFF, 0xF5, 0xFE, 0xE3, 0xFE, 0x0E, 0xFF, 0x56, 0xFF,
-	0xA9, 0xFF, 0xF3, 0xFF, 0x1E, 0x00, 0x27, 0x00, 0x49, 0x00, 0x7F, 0x00,
-	0xD9, 0x00, 0x48, 0x01, 0xCD, 0x01, 0x63, 0x02, 0xFD, 0x02, 0x97, 0x03,
-	0x0B, 0x04, 0x52, 0x04, 0x87, 0x04, 0xB9, 0x04, 0xE5, 0x04, 0x15, 0x05,
-	0x6D, 0x05, 0xB0, 0x05, 0xCB, 0x05, 0xE5, 0x05, 0xC1, 0x05, 0x78, 0x05,
-	0x33, 0x05, 0xDB, 0x04, 0x81, 0x04, 0xFF, 0x03, 0x7D, 0x03, 0x0E, 0x03,
-	0x93, 0x02, 0x0C, 0x02, 0x60, 0x01, 0xB2, 0x00, 0xFC, 0xFF, 0x59, 0xFF,
-	0xB1, 0xFE, 0x0C, 0xFE, 0x73, 0xFD, 0xE8, 0xFC, 0x5E, 0xFC, 0xF0, 0xFB,
-	0x8F, 0xFB, 0x3A, 0xFB, 0xEB, 0xFA, 0x7E, 0xFA, 0x26, 0xFA, 0xF0, 0xF9,
-	0xCC, 0xF9, 0xCC, 0xF9, 0xC3, 0xF9, 0xE1, 0xF9, 0xF4, 0xF9, 0x16, 0xFA,
-	0x30, 0xFA, 0x4C, 0xFA, 0x60, 0xFA, 0x74, 0xFA, 0x8B, 0xFA, 0xAE, 0xFA,
-	0xDC, 0xFA, 0x12, 0xFB, 0x43, 0xFB, 0x52, 0xFB, 0x6F, 0xFB, 0x6F, 0xFB,
-	0x69, 0xFB, 0x5E, 0xFB, 0x3F, 0xFB, 0x26, 0xFB, 0x19, 0xFB, 0x07, 0xFB,
-	0xF0, 0xFA, 0xCC, 0xFA, 0xAA, 0xFA, 0x6D, 0xFA, 0x1A, 0xFA, 0xC1, 0xF9,
-	0x6C, 0xF9, 0x3D, 0xF9, 0x21, 0xF9, 0xFF, 0xF8, 0xE4, 0xF8, 0xBD, 0xF8,
-	0x93, 0xF8, 0x74, 0xF8, 0x42, 0xF8, 0x00, 0xF8, 0xD2, 0xF7, 0xA2, 0xF7,
-	0x9C, 0xF7, 0x79, 0xF7, 0x56, 0xF7, 0x37, 0xF7, 0x0D, 0xF7, 0xD4, 0xF6,
-	0x89, 0xF6, 0x15, 0xF6, 0x8E, 0xF5, 0x0A, 0xF5, 0x7C, 0xF4, 0xC5, 0xF3,
-	0x0A, 0xF3, 0x66, 0xF2, 0xCB, 0xF1, 0x35, 0xF1, 0x9C, 0xF0, 0x11, 0xF0,
-	0x84, 0xEF, 0xFE, 0xEE, 0xBD, 0xEE, 0xF4, 0xEE, 0xDA, 0xEF, 0x37, 0xF1,
-	0x64, 0xF2, 0x33, 0xF3, 0xDD, 0xF3, 0xB7, 0xF4, 0x73, 0xF5, 0x12, 0xF6,
-	0xF2, 0xF6, 0x85, 0xF8, 0xD3, 0xFA, 0x7D, 0xFD, 0x44, 0x00, 0xB1, 0x02,
-	0xB0, 0x04, 0x4A, 0x06, 0x8B, 0x07, 0x86, 0x08, 0x71, 0x09, 0xA6, 0x0A,
-	0x38, 0x0C, 0xEF, 0x0D, 0x3E, 0x0F, 0x46, 0x10, 0x22, 0x11, 0x92, 0x11,
-	0x5E, 0x11, 0xB6, 0x10, 0x0E, 0x10, 0xC4, 0x0F, 0xA3, 0x0F, 0x6A, 0x0F,
-	0xED, 0x0E, 0xF3, 0x0D, 0xAB, 0x0C, 0x11, 0x0B, 0x52, 0x09, 0x7B, 0x07,
-	0xC7, 0x05, 0x6D, 0x04, 0x89, 0x03, 0xEA, 0x02, 0x3D, 0x02, 0x6C, 0x01,
-	0x88, 0x00, 0x6B, 0xFF, 0x25, 0xFE, 0xF3, 0xFC, 0x1F, 0xFC, 0xA0, 0xFB,
-	0x8B, 0xFB, 0xB3, 0xFB, 0xEE, 0xFB, 0x49, 0xFC, 0xD9, 0xFC, 0x85, 0xFD,
-	0x15, 0xFE, 0x86, 0xFE, 0xBF, 0xFE, 0x1F, 0xFF, 0xB1, 0xFF, 0x5F, 0x00,
-	0xFA, 0x00, 0x8F, 0x01, 0x2B, 0x02, 0xBD, 0x02, 0x3E, 0x03, 0x90, 0x03,
-	0xB3, 0x03, 0xC8, 0x03, 0xD5, 0x03, 0xE6, 0x03, 0xDC, 0x03, 0xB9, 0x03,
-	0x79, 0x03, 0x1B, 0x03, 0x7B, 0x02, 0xBE, 0x01, 0xFA, 0x00, 0x54, 0x00,
-	0xD5, 0xFF, 0x70, 0xFF, 0x16, 0xFF, 0xD9, 0xFE, 0xA9, 0xFE, 0x79, 0xFE,
-	0x1C, 0xFE, 0x94, 0xFD, 0x13, 0xFD, 0xAB, 0xFC, 0x80, 0xFC, 0xA7, 0xFC,
-	0xEC, 0xFC, 0x6E, 0xFD, 0x11, 0xFE, 0xBC, 0xFE, 0x59, 0xFF, 0xCE, 0xFF,
-	0x49, 0x00, 0xEA, 0x00, 0xAF, 0x01, 0x74, 0x02, 0x59, 0x03, 0x24, 0x04,
-	0x19, 0x05, 0xE2, 0x05, 0xA2, 0x06, 0x44, 0x07, 0xBE, 0x07, 0x2A, 0x08,
-	0xAC, 0x08, 0x3F, 0x09, 0xD0, 0x09, 0x3C, 0x0A, 0x89, 0x0A, 0xC2, 0x0A,
-	0xAB, 0x0A, 0x60, 0x0A, 0xEA, 0x09, 0x5A, 0x09, 0xCE, 0x08, 0x55, 0x08,
-	0xFB, 0x07, 0xA4, 0x07, 0x48, 0x07, 0xDB, 0x06, 0x4D, 0x06, 0xA1, 0x05,
-	0xCB, 0x04, 0xE0, 0x03, 0x14, 0x03, 0x5A, 0x02, 0xB9, 0x01, 0x2E, 0x01,
-	0xC8, 0x00, 0x83, 0x00, 0x5D, 0x00, 0x0E, 0x00, 0xB1, 0xFF, 0x58, 0xFF,
-	0x1F, 0xFF, 0xFD, 0xFE, 0xE2, 0xFE, 0xDD, 0xFE, 0xF4, 0xFE, 0x1E, 0xFF,
-	0x5D, 0xFF, 0x8F, 0xFF, 0xA9, 0xFF, 0xAC, 0xFF, 0xB2, 0xFF, 0xBC, 0xFF,
-	0xD2, 0xFF, 0x08, 0x00, 0x4A, 0x00, 0x90, 0x00, 0xC3, 0x00, 0xE3, 0x00,
-	0xE0, 0x00, 0xB9, 0x00, 0x85, 0x00, 0x34, 0x00, 0xE8, 0xFF, 0xB0, 0xFF,
-	0x98, 0xFF, 0xAD, 0xFF, 0xDF, 0xFF, 0xE7, 0xFF, 0xF2, 0xFF, 0xD2, 0xFF,
-	0x98, 0xFF, 0x4B, 0xFF, 0x00, 0xFF, 0xC5, 0xFE, 0xB9, 0xFE, 0xED, 0xFE,
-	0x8E, 0xFF, 0x8B, 0x00, 0xA2, 0x01, 0x64, 0x02, 0xB1, 0x02, 0xB7, 0x02,
-	0xD5, 0x02, 0xED, 0x02, 0x0F, 0x03, 0x64, 0x03, 0x17, 0x04, 0x29, 0x05,
-	0x58, 0x06, 0x45, 0x07, 0xC1, 0x07, 0xBC, 0x07, 0x95, 0x07, 0x5D, 0x07,
-	0x18, 0x07, 0xF4, 0x06, 0xFF, 0x06, 0x34, 0x07, 0x58, 0x07, 0x29, 0x07,
-	0xBB, 0x06, 0x3A, 0x06, 0x8E, 0x05, 0xA3, 0x04, 0xA2, 0x03, 0xDE, 0x02,
-	0x54, 0x02, 0x02, 0x02, 0xAA, 0x01, 0x15, 0x01, 0x39, 0x00, 0x53, 0xFF,
-	0x50, 0xFE, 0x72, 0xFD, 0x82, 0xFC, 0xCC, 0xFB, 0x4C, 0xFB, 0x27, 0xFB,
-	0x22, 0xFB, 0x1C, 0xFB, 0x00, 0xFB, 0xC0, 0xFA, 0x71, 0xFA, 0x38, 0xFA,
-	0xFD, 0xF9, 0xDA, 0xF9, 0xD7, 0xF9, 0x01, 0xFA, 0x41, 0xFA, 0x84, 0xFA,
-	0xC0, 0xFA, 0x06, 0xFB, 0x60, 0xFB, 0xA5, 0xFB, 0xAB, 0xFB, 0xB1, 0xFB,
-	0xA6, 0xFB, 0xC3, 0xFB, 0xE4, 0xFB, 0xF6, 0xFB, 0xF5, 0xFB, 0xE9, 0xFB,
-	0xE6, 0xFB, 0xF6, 0xFB, 0xE1, 0xFB, 0xAC, 0xFB, 0x74, 0xFB, 0x72, 0xFB,
-	0x6F, 0xFB, 0x52, 0xFB, 0x23, 0xFB, 0xE4, 0xFA, 0xAA, 0xFA, 0x80, 0xFA,
-	0x46, 0xFA, 0x25, 0xFA, 0x1A, 0xFA, 0x41, 0xFA, 0x85, 0xFA, 0xAC, 0xFA,
-	0xC3, 0xFA, 0xD9, 0xFA, 0xFB, 0xFA, 0x29, 0xFB, 0x2D, 0xFB, 0x37, 0xFB,
-	0x59, 0xFB, 0xB5, 0xFB, 0x31, 0xFC, 0x91, 0xFC, 0xD2, 0xFC, 0x0F, 0xFD,
-	0x51, 0xFD, 0x82, 0xFD, 0x9F, 0xFD, 0xA9, 0xFD, 0xCB, 0xFD, 0x06, 0xFE,
-	0x36, 0xFE, 0x3C, 0xFE, 0x40, 0xFE, 0x18, 0xFE, 0x06, 0xFE, 0xF2, 0xFD,
-	0xD0, 0xFD, 0x93, 0xFD, 0x72, 0xFD, 0x68, 0xFD, 0x62, 0xFD, 0x43, 0xFD,
-	0x0A, 0xFD, 0xC7, 0xFC, 0x79, 0xFC, 0x2B, 0xFC, 0xCC, 0xFB, 0x86, 0xFB,
-	0x3B, 0xFB, 0x19, 0xFB, 0x1E, 0xFB, 0x29, 0xFB, 0x38, 0xFB, 0x35, 0xFB,
-	0x37, 0xFB, 0x24, 0xFB, 0xFC, 0xFA, 0xF8, 0xFA, 0x08, 0xFB, 0x30, 0xFB,
-	0x6F, 0xFB, 0xC1, 0xFB, 0x2B, 0xFC, 0x83, 0xFC, 0xD6, 0xFC, 0x23, 0xFD,
-	0x5A, 0xFD, 0x87, 0xFD, 0xBF, 0xFD, 0x00, 0xFE, 0x52, 0xFE, 0xA2, 0xFE,
-	0x0B, 0xFF, 0x50, 0xFF, 0x95, 0xFF, 0xCA, 0xFF, 0xDF, 0xFF, 0xEC, 0xFF,
-	0xE8, 0xFF, 0xE8, 0xFF, 0x06, 0x00, 0x2D, 0x00, 0x3F, 0x00, 0x60, 0x00,
-	0x7D, 0x00, 0x7E, 0x00, 0x59, 0x00, 0x3A, 0x00, 0xFA, 0xFF, 0xD6, 0xFF,
-	0xCF, 0xFF, 0xC4, 0xFF, 0xCB, 0xFF, 0xE6, 0xFF, 0x03, 0x00, 0x2A, 0x00,
-	0x26, 0x00, 0x03, 0x00, 0xDC, 0xFF, 0xBF, 0xFF, 0xAA, 0xFF, 0x99, 0xFF,
-	0x9B, 0xFF, 0xE3, 0xFF, 0x23, 0x00, 0x6C, 0x00, 0xA7, 0x00, 0xC7, 0x00,
-	0xD2, 0x00, 0xEB, 0x00, 0x0B, 0x01, 0x37, 0x01, 0x89, 0x01, 0xF2, 0x01,
-	0x64, 0x02, 0xBF, 0x02, 0x2A, 0x03, 0x7B, 0x03, 0xB6, 0x03, 0xDE, 0x03,
-	0x13, 0x04, 0x75, 0x04, 0xEC, 0x04, 0x52, 0x05, 0xB8, 0x05, 0x26, 0x06,
-	0x7D, 0x06, 0xB0, 0x06, 0xD7, 0x06, 0xD8, 0x06, 0xF6, 0x06, 0x07, 0x07,
-	0x16, 0x07, 0x29, 0x07, 0x31, 0x07, 0x48, 0x07, 0x49, 0x07, 0x1D, 0x07,
-	0xEC, 0x06, 0xB5, 0x06, 0x8B, 0x06, 0x5E, 0x06, 0x1F, 0x06, 0xD0, 0x05,
-	0x85, 0x05, 0x45, 0x05, 0x13, 0x05, 0xD0, 0x04, 0x78, 0x04, 0x35, 0x04,
-	0x04, 0x04, 0xEC, 0x03, 0xD6, 0x03, 0xAE, 0x03, 0x9B, 0x03, 0x88, 0x03,
-	0x88, 0x03, 0x81, 0x03, 0x80, 0x03, 0x8C, 0x03, 0xA9, 0x03, 0xD5, 0x03,
-	0xE9, 0x03, 0x0E, 0x04, 0x47, 0x04, 0x84, 0x04, 0xBC, 0x04, 0xDA, 0x04,
-	0xFB, 0x04, 0x23, 0x05, 0x47, 0x05, 0x64, 0x05, 0x65, 0x05, 0x66, 0x05,
-	0x78, 0x05, 0x86, 0x05, 0x86, 0x05, 0x6E, 0x05, 0x44, 0x05, 0x04, 0x05,
-	0xB1, 0x04, 0x71, 0x04, 0x12, 0x04, 0xD6, 0x03, 0x77, 0x03, 0x2E, 0x03,
-	0xC7, 0x02, 0x5A, 0x02, 0xDB, 0x01, 0x5D, 0x01, 0xD7, 0x00, 0x57, 0x00,
-	0xF1, 0xFF, 0x95, 0xFF, 0x30, 0xFF, 0xE0, 0xFE, 0x90, 0xFE, 0x41, 0xFE,
-	0xCB, 0xFD, 0x54, 0xFD, 0x00, 0xFD, 0xA3, 0xFC, 0x59, 0xFC, 0x09, 0xFC,
-	0xBF, 0xFB, 0x88, 0xFB, 0x41, 0xFB, 0xF7, 0xFA, 0x91, 0xFA, 0x13, 0xFA,
-	0x82, 0xF9, 0xE7, 0xF8, 0x35, 0xF8, 0x83, 0xF7, 0xBB, 0xF6, 0xFE, 0xF5,
-	0x58, 0xF5, 0xA1, 0xF4, 0xEC, 0xF3, 0x24, 0xF3, 0x49, 0xF2, 0x57, 0xF1,
-	0x51, 0xF0, 0x57, 0xEF, 0x51, 0xEE, 0x64, 0xED, 0x83, 0xEC, 0xBE, 0xEB,
-	0xF8, 0xEA, 0x32, 0xEA, 0x67, 0xE9, 0xA4, 0xE8, 0xE6, 0xE7, 0x2D, 0xE7,
-	0x86, 0xE6, 0xF6, 0xE5, 0x98, 0xE5, 0x9B, 0xE5, 0x0D, 0xE6, 0x02, 0xE7,
-	0x6F, 0xE8, 0x2A, 0xEA, 0x05, 0xEC, 0xB5, 0xED, 0x40, 0xEF, 0xAC, 0xF0,
-	0x3C, 0xF2, 0xDD, 0xF3, 0xC2, 0xF5, 0x37, 0xF8, 0x31, 0xFB, 0x80, 0xFE,
-	0xE1, 0x01, 0xF9, 0x04, 0xA7, 0x07, 0xFF, 0x09, 0x05, 0x0C, 0xDB, 0x0D,
-	0x86, 0x0F, 0x3C, 0x11, 0x0A, 0x13, 0xC2, 0x14, 0x43, 0x16, 0x63, 0x17,
-	0x0C, 0x18, 0x34, 0x18, 0xFB, 0x17, 0x8A, 0x17, 0x00, 0x17, 0x6E, 0x16,
-	0xF7, 0x15, 0x5F, 0x15, 0x7A, 0x14, 0x0D, 0x13, 0x28, 0x11, 0xFC, 0x0E,
-	0xD3, 0x0C, 0x94, 0x0A, 0x78, 0x08, 0xB2, 0x06, 0x3F, 0x05, 0x15, 0x04,
-	0xDF, 0x02, 0x9E, 0x01, 0x3B, 0x00, 0xC4, 0xFE, 0x66, 0xFD, 0x36, 0xFC,
-	0x44, 0xFB, 0x88, 0xFA, 0x12, 0xFA, 0xE2, 0xF9, 0xD8, 0xF9, 0xF5, 0xF9,
-	0x5C, 0xFA, 0xE8, 0xFA, 0x80, 0xFB, 0x20, 0xFC, 0xAB, 0xFC, 0x57, 0xFD,
-	0xF7, 0xFD, 0x7A, 0xFE, 0x0E, 0xFF, 0x71, 0xFF, 0xD0, 0xFF, 0x53, 0x00,
-	0xCC, 0x00, 0x36, 0x01, 0x8C, 0x01, 0xBE, 0x01, 0xE0, 0x01, 0xE6, 0x01,
-	0xBB, 0x01, 0x6C, 0x01, 0x03, 0x01, 0x6B, 0x00, 0xC1, 0xFF, 0x07, 0xFF,
-	0x4B, 0xFE, 0x9F, 0xFD, 0xF7, 0xFC, 0x58, 0xFC, 0xD6, 0xFB, 0x6E, 0xFB,
-	0x34, 0xFB, 0xF3, 0xFA, 0xB6, 0xFA, 0x86, 0xFA, 0x6D, 0xFA, 0x65, 0xFA,
-	0x76, 0xFA, 0xCE, 0xFA, 0x4A, 0xFB, 0xE0, 0xFB, 0x8D, 0xFC, 0x6E, 0xFD,
-	0x7E, 0xFE, 0xA0, 0xFF, 0xDA, 0x00, 0x39, 0x02, 0xA2, 0x03, 0xF2, 0x04,
-	0x30, 0x06, 0x6A, 0x07, 0x78, 0x08, 0x73, 0x09, 0x49, 0x0A, 0x20, 0x0B,
-	0x0B, 0x0C, 0xEC, 0x0C, 0xB8, 0x0D, 0x68, 0x0E, 0xE6, 0x0E, 0x38, 0x0F,
-	0x50, 0x0F, 0x2B, 0x0F, 0xBE, 0x0E, 0x08, 0x0E, 0x44, 0x0D, 0x71, 0x0C,
-	0x98, 0x0B, 0xAC, 0x0A, 0xC5, 0x09, 0xF1, 0x08, 0xFB, 0x07, 0xD9, 0x06,
-	0xAC, 0x05, 0x76, 0x04, 0x48, 0x03, 0x15, 0x02, 0xF9, 0x00, 0xEC, 0xFF,
-	0x06, 0xFF, 0x5D, 0xFE, 0xB6, 0xFD, 0x29, 0xFD, 0xAA, 0xFC, 0x36, 0xFC,
-	0xDE, 0xFB, 0x9F, 0xFB, 0xA3, 0xFB, 0xAD, 0xFB, 0xFB, 0xFB, 0x59, 0xFC,
-	0xDF, 0xFC, 0x2F, 0xFD, 0x8B, 0xFD, 0xC1, 0xFD, 0x0A, 0xFE, 0x60, 0xFE,
-	0xAF, 0xFE, 0x2D, 0xFF, 0xC4, 0xFF, 0x65, 0x00, 0xF7, 0x00, 0x6E, 0x01,
-	0xC4, 0x01, 0xD5, 0x01, 0xD6, 0x01, 0xB8, 0x01, 0x7D, 0x01, 0x3A, 0x01,
-	0x13, 0x01, 0xF2, 0x00, 0xE7, 0x00, 0xBF, 0x00, 0x98, 0x00, 0x4A, 0x00,
-	0xF2, 0xFF, 0x8F, 0xFF, 0x0B, 0xFF, 0x8F, 0xFE, 0x31, 0xFE, 0xF2, 0xFD,
-	0xDA, 0xFD, 0xCB, 0xFD, 0xD2, 0xFD, 0xD4, 0xFD, 0xF0, 0xFD, 0xF4, 0xFD,
-	0x0E, 0xFE, 0x26, 0xFE, 0x5E, 0xFE, 0xD7, 0xFE, 0x63, 0xFF, 0x03, 0x00,
-	0xA6, 0x00, 0x3A, 0x01, 0xC1, 0x01, 0x4F, 0x02, 0xA8, 0x02, 0xFF, 0x02,
-	0x78, 0x03, 0x0C, 0x04, 0x9D, 0x04, 0x22, 0x05, 0xAC, 0x05, 0x1B, 0x06,
-	0x67, 0x06, 0x86, 0x06, 0x5B, 0x06, 0x32, 0x06, 0xFE, 0x05, 0xC2, 0x05,
-	0x82, 0x05, 0x2B, 0x05, 0xD0, 0x04, 0x5E, 0x04, 0xE8, 0x03, 0x44, 0x03,
-	0x88, 0x02, 0xBD, 0x01, 0x0E, 0x01, 0x58, 0x00, 0x95, 0xFF, 0xE1, 0xFE,
-	0x25, 0xFE, 0x75, 0xFD, 0xD9, 0xFC, 0x2E, 0xFC, 0x84, 0xFB, 0xEB, 0xFA,
-	0x7C, 0xFA, 0x22, 0xFA, 0xD9, 0xF9, 0xA3, 0xF9, 0x81, 0xF9, 0x87, 0xF9,
-	0x7F, 0xF9, 0x9F, 0xF9, 0xBE, 0xF9, 0xE3, 0xF9, 0x01, 0xFA, 0x47, 0xFA,
-	0x9F, 0xFA, 0x04, 0xFB, 0x69, 0xFB, 0xF3, 0xFB, 0x7C, 0xFC, 0xF8, 0xFC,
-	0x84, 0xFD, 0xE8, 0xFD, 0x51, 0xFE, 0xB4, 0xFE, 0x1A, 0xFF, 0x74, 0xFF,
-	0xBF, 0xFF, 0xFF, 0xFF, 0x55, 0x00, 0xAB, 0x00, 0xC8, 0x00, 0xD4, 0x00,
-	0xDE, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF9, 0x00, 0xF8, 0x00, 0xEB, 0x00,
-	0xD3, 0x00, 0x94, 0x00, 0x67, 0x00, 0x37, 0x00, 0x05, 0x00, 0xEE, 0xFF,
-	0xF2, 0xFF, 0xF1, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0x9E, 0xFF, 0x89, 0xFF,
-	0x68, 0xFF, 0x47, 0xFF, 0x3D, 0xFF, 0x4A, 0xFF, 0x7F, 0xFF, 0xAE, 0xFF,
-	0xE4, 0xFF, 0xF2, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x12, 0x00,
-	0x1E, 0x00, 0x37, 0x00, 0x6F, 0x00, 0xAD, 0x00, 0xCF, 0x00, 0xCF, 0x00,
-	0xC7, 0x00, 0xB1, 0x00, 0x92, 0x00, 0x72, 0x00, 0x54, 0x00, 0x44, 0x00,
-	0x54, 0x00, 0x54, 0x00, 0x35, 0x00, 0xE8, 0xFF, 0xA3, 0xFF, 0x60, 0xFF,
-	0x14, 0xFF, 0xD0, 0xFE, 0x82, 0xFE, 0x44, 0xFE, 0x1B, 0xFE, 0xEF, 0xFD,
-	0xC6, 0xFD, 0x8E, 0xFD, 0x52, 0xFD, 0x31, 0xFD, 0x21, 0xFD, 0xFB, 0xFC,
-	0xE6, 0xFC, 0xD7, 0xFC, 0xD3, 0xFC, 0xCC, 0xFC, 0xCE, 0xFC, 0xDB, 0xFC,
-	0x0A, 0xFD, 0x39, 0xFD, 0x70, 0xFD, 0xA1, 0xFD, 0xD5, 0xFD, 0x09, 0xFE,
-	0x39, 0xFE, 0x87, 0xFE, 0xAD, 0xFE, 0xD9, 0xFE, 0x15, 0xFF, 0x53, 0xFF,
-	0xA8, 0xFF, 0xF1, 0xFF, 0x15, 0x00, 0x40, 0x00, 0x5E, 0x00, 0x84, 0x00,
-	0xA0, 0x00, 0xAF, 0x00, 0xBE, 0x00, 0xD7, 0x00, 0xE1, 0x00, 0xE0, 0x00,
-	0xE1, 0x00, 0xC8, 0x00, 0xB7, 0x00, 0x8A, 0x00, 0x72, 0x00, 0x64, 0x00,
-	0x59, 0x00, 0x49, 0x00, 0x31, 0x00, 0x0A, 0x00, 0xD4, 0xFF, 0xAD, 0xFF,
-	0x95, 0xFF, 0x7B, 0xFF, 0x5A, 0xFF, 0x46, 0xFF, 0x33, 0xFF, 0x2E, 0xFF,
-	0x28, 0xFF, 0x22, 0xFF, 0x1A, 0xFF, 0x11, 0xFF, 0x0F, 0xFF, 0x25, 0xFF,
-	0x2E, 0xFF, 0x42, 0xFF, 0x44, 0xFF, 0x54, 0xFF, 0x77, 0xFF, 0x8F, 0xFF,
-	0xB0, 0xFF, 0xD4, 0xFF, 0xE4, 0xFF, 0xFB, 0xFF, 0x04, 0x00, 0x0A, 0x00,
-	0x23, 0x00, 0x39, 0x00, 0x3C, 0x00, 0x44, 0x00, 0x43, 0x00, 0x39, 0x00,
-	0x43, 0x00, 0x37, 0x00, 0x39, 0x00, 0x26, 0x00, 0x18, 0x00, 0x05, 0x00,
-	0xDD, 0xFF, 0xC7, 0xFF, 0xA1, 0xFF, 0x87, 0xFF, 0x70, 0xFF, 0x56, 0xFF,
-	0x44, 0xFF, 0x46, 0xFF, 0x4A, 0xFF, 0x3F, 0xFF, 0x40, 0xFF, 0x38, 0xFF,
-	0x16, 0xFF, 0x1A, 0xFF, 0x2C, 0xFF, 0x37, 0xFF, 0x5F, 0xFF, 0x81, 0xFF,
-	0xB3, 0xFF, 0xDE, 0xFF, 0xFB, 0xFF, 0x0E, 0x00, 0x27, 0x00, 0x52, 0x00,
-	0x7F, 0x00, 0xB0, 0x00, 0xED, 0x00, 0x16, 0x01, 0x3A, 0x01, 0x66, 0x01,
-	0x76, 0x01, 0x79, 0x01, 0x81, 0x01, 0x9C, 0x01, 0xAA, 0x01, 0xC3, 0x01,
-	0xC0, 0x01, 0xBB, 0x01, 0xB0, 0x01, 0x85, 0x01, 0x68, 0x01, 0x32, 0x01,
-	0x15, 0x01, 0xED, 0x00, 0xBE, 0x00, 0x8D, 0x00, 0x5A, 0x00, 0x1A, 0x00,
-	0xCD, 0xFF, 0x9D, 0xFF, 0x69, 0xFF, 0x29, 0xFF, 0xF6, 0xFE, 0xB7, 0xFE,
-	0x87, 0xFE, 0x4E, 0xFE, 0x0C, 0xFE, 0xD5, 0xFD, 0xAC, 0xFD, 0x95, 0xFD,
-	0x88, 0xFD, 0x73, 0xFD, 0x6D, 0xFD, 0x6E, 0xFD, 0x6E, 0xFD, 0x6A, 0xFD,
-	0x5A, 0xFD, 0x58, 0xFD, 0x5F, 0xFD, 0x93, 0xFD, 0xBE, 0xFD, 0xEE, 0xFD,
-	0x0E, 0xFE, 0x2D, 0xFE, 0x44, 0xFE, 0x5F, 0xFE, 0x7A, 0xFE, 0x87, 0xFE,
-	0xA5, 0xFE, 0xCE, 0xFE, 0x21, 0xFF, 0x49, 0xFF, 0x7C, 0xFF, 0xA6, 0xFF,
-	0xB8, 0xFF, 0xC6, 0xFF, 0xE4, 0xFF, 0xEC, 0xFF, 0xF1, 0xFF, 0x14, 0x00,
-	0x37, 0x00, 0x4D, 0x00, 0x4F, 0x00, 0x62, 0x00, 0x7C, 0x00, 0x93, 0x00,
-	0x8D, 0x00, 0x95, 0x00, 0x95, 0x00, 0xA2, 0x00, 0xAC, 0x00, 0xA9, 0x00,
-	0xA3, 0x00, 0x9F, 0x00, 0xAC, 0x00, 0xB1, 0x00, 0xC8, 0x00, 0xCD, 0x00,
-	0xCD, 0x00, 0xDE, 0x00, 0xED, 0x00, 0xFC, 0x00, 0xED, 0x00, 0xE7, 0x00,
-	0xF2, 0x00, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x0F, 0x01,
-	0x0F, 0x01, 0x1C, 0x01, 0x1C, 0x01, 0x08, 0x01, 0xF4, 0x00, 0xE1, 0x00,
-	0xC9, 0x00, 0xBB, 0x00, 0xA3, 0x00, 0x8B, 0x00, 0x68, 0x00, 0x53, 0x00,
-	0x28, 0x00, 0x26, 0x00, 0xFC, 0xFF, 0xDD, 0xFF, 0xB8, 0xFF, 0x9C, 0xFF,
-	0x7B, 0xFF, 0x5C, 0xFF, 0x4E, 0xFF, 0x26, 0xFF, 0x04, 0xFF, 0xDD, 0xFE,
-	0xBC, 0xFE, 0xB1, 0xFE, 0xAD, 0xFE, 0xB6, 0xFE, 0xB6, 0xFE, 0xB0, 0xFE,
-	0xB0, 0xFE, 0xB2, 0xFE, 0xB1, 0xFE, 0xAD, 0xFE, 0xC7, 0xFE, 0xD3, 0xFE,
-	0xF5, 0xFE, 0x18, 0xFF, 0x3D, 0xFF, 0x56, 0xFF, 0x73, 0xFF, 0x95, 0xFF,
-	0xBF, 0xFF, 0xE1, 0xFF, 0xFA, 0xFF, 0x1A, 0x00, 0x2D, 0x00, 0x45, 0x00,
-	0x57, 0x00, 0x66, 0x00, 0x79, 0x00, 0x93, 0x00, 0x95, 0x00, 0x84, 0x00,
-	0x79, 0x00, 0x89, 0x00, 0x85, 0x00, 0x79, 0x00, 0x7F, 0x00, 0x70, 0x00,
-	0x79, 0x00, 0x7E, 0x00, 0x6C, 0x00, 0x4A, 0x00, 0x2C, 0x00, 0x15, 0x00,
-	0x12, 0x00, 0x0A, 0x00, 0x0F, 0x00, 0x24, 0x00, 0x33, 0x00, 0x3C, 0x00,
-	0x33, 0x00, 0x32, 0x00, 0x35, 0x00, 0x45, 0x00, 0x4D, 0x00, 0x50, 0x00,
-	0x64, 0x00, 0x7C, 0x00, 0xB2, 0x00, 0xCF, 0x00, 0xE0, 0x00, 0xD7, 0x00,
-	0xE2, 0x00, 0xEF, 0x00, 0x0B, 0x01, 0x05, 0x01, 0x0B, 0x01, 0x1D, 0x01,
-	0x1E, 0x01, 0x19, 0x01, 0xFB, 0x00, 0xDC, 0x00, 0xC8, 0x00, 0xA5, 0x00,
-	0x98, 0x00, 0x7C, 0x00, 0x53, 0x00, 0x28, 0x00, 0xFF, 0xFF, 0xC6, 0xFF,
-	0x98, 0xFF, 0x61, 0xFF, 0x3B, 0xFF, 0x13, 0xFF, 0xEA, 0xFE, 0xBD, 0xFE,
-	0x8B, 0xFE, 0x5F, 0xFE, 0x3D, 0xFE, 0x27, 0xFE, 0x17, 0xFE, 0x0D, 0xFE,
-	0x08, 0xFE, 0x0D, 0xFE, 0x05, 0xFE, 0x10, 0xFE, 0x10, 0xFE, 0x0D, 0xFE,
-	0x19, 0xFE, 0x54, 0xFE, 0x7C, 0xFE, 0xAA, 0xFE, 0xE0, 0xFE, 0x2A, 0xFF,
-	0x6C, 0xFF, 0x9C, 0xFF, 0xCE, 0xFF, 0xFA, 0xFF, 0x32, 0x00, 0x64, 0x00,
-	0x9E, 0x00, 0xC9, 0x00, 0x09, 0x01, 0x20, 0x01, 0x58, 0x01, 0x80, 0x01,
-	0xA7, 0x01, 0xCD, 0x01, 0xD7, 0x01, 0xEA, 0x01, 0xF6, 0x01, 0xF9, 0x01,
-	0xF5, 0x01, 0xEF, 0x01, 0xE1, 0x01, 0xD3, 0x01, 0xB9, 0x01, 0xA5, 0x01,
-	0x95, 0x01, 0x6B, 0x01, 0x59, 0x01, 0x33, 0x01, 0x09, 0x01, 0xEF, 0x00,
-	0xD9, 0x00, 0xC3, 0x00, 0xA0, 0x00, 0x6B, 0x00, 0x52, 0x00, 0x35, 0x00,
-	0x27, 0x00, 0x21, 0x00, 0x10, 0x00, 0x13, 0x00, 0x0B, 0x00, 0x0D, 0x00,
-	0x0A, 0x00, 0xF1, 0xFF, 0xE1, 0xFF, 0xDE, 0xFF, 0xE1, 0xFF, 0xF1, 0xFF,
-	0x05, 0x00, 0x04, 0x00, 0x12, 0x00, 0x17, 0x00, 0x0D, 0x00, 0xFF, 0xFF,
-	0xFB, 0xFF, 0x03, 0x00, 0x14, 0x00, 0x21, 0x00, 0x1F, 0x00, 0x1E, 0x00,
-	0x26, 0x00, 0x0B, 0x00, 0x19, 0x00, 0x04, 0x00, 0xF1, 0xFF, 0xF7, 0xFF,
-	0xF6, 0xFF, 0x09, 0x00, 0xFA, 0xFF, 0xF3, 0xFF, 0xE4, 0xFF, 0xDE, 0xFF,
-	0xDA, 0xFF, 0xBF, 0xFF, 0xBB, 0xFF, 0xC1, 0xFF, 0xBD, 0xFF, 0xB1, 0xFF,
-	0xA9, 0xFF, 0xC0, 0xFF, 0xBF, 0xFF, 0xAD, 0xFF, 0xA7, 0xFF, 0xB5, 0xFF,
-	0xA6, 0xFF, 0xAC, 0xFF, 0xB7, 0xFF, 0xC5, 0xFF, 0xC0, 0xFF, 0xBD, 0xFF,
-	0xCE, 0xFF, 0xDA, 0xFF, 0xED, 0xFF, 0xFA, 0xFF, 0x0D, 0x00, 0x15, 0x00,
-	0x18, 0x00, 0x17, 0x00, 0x13, 0x00, 0x2C, 0x00, 0x34, 0x00, 0x50, 0x00,
-	0x6D, 0x00, 0x72, 0x00, 0x79, 0x00, 0x84, 0x00, 0x91, 0x00, 0xA3, 0x00,
-	0xA7, 0x00, 0xC3, 0x00, 0xDD, 0x00, 0xE4, 0x00, 0xF5, 0x00, 0xFF, 0x00,
-	0xEB, 0x00, 0xE2, 0x00, 0xD1, 0x00, 0xEA, 0x00, 0xF1, 0x00, 0xF5, 0x00,
-	0xEF, 0x00, 0xDC, 0x00, 0xE5, 0x00, 0xD7, 0x00, 0xCD, 0x00, 0xAB, 0x00,
-	0xA0, 0x00, 0x9B, 0x00, 0x80, 0x00, 0x79, 0x00, 0x79, 0x00, 0x79, 0x00,
-	0x66, 0x00, 0x58, 0x00, 0x59, 0x00, 0x4F, 0x00, 0x4E, 0x00, 0x50, 0x00,
-	0x67, 0x00, 0x62, 0x00, 0x6B, 0x00, 0x68, 0x00, 0x8A, 0x00, 0x9C, 0x00,
-	0xAB, 0x00, 0xBF, 0x00, 0xD7, 0x00, 0x01, 0x01, 0x21, 0x01, 0x44, 0x01,
-	0x5C, 0x01, 0x7E, 0x01, 0x9F, 0x01, 0xC5, 0x01, 0xE2, 0x01, 0xE4, 0x01,
-	0xFA, 0x01, 0x14, 0x02, 0x2D, 0x02, 0x50, 0x02, 0x5F, 0x02, 0xAF, 0x02,
-	0x35, 0x03, 0xCA, 0x03, 0x27, 0x04, 0x4B, 0x04, 0x72, 0x04, 0xA8, 0x04,
-	0xC4, 0x04, 0xD9, 0x04, 0x07, 0x05, 0x9B, 0x05, 0x6E, 0x06, 0x30, 0x07,
-	0xCB, 0x07, 0x1F, 0x08, 0x50, 0x08, 0x4E, 0x08, 0x2E, 0x08, 0x0C, 0x08,
-	0xE1, 0x07, 0xEA, 0x07, 0x22, 0x08, 0x3F, 0x08, 0x18, 0x08, 0xB0, 0x07,
-	0x55, 0x07, 0xE5, 0x06, 0x32, 0x06, 0x75, 0x05, 0xC5, 0x04, 0x29, 0x04,
-	0x99, 0x03, 0xD7, 0x02, 0xFD, 0x01, 0x0D, 0x01, 0x21, 0x00, 0x39, 0xFF,
-	0x45, 0xFE, 0x7D, 0xFD, 0xB1, 0xFC, 0x17, 0xFC, 0x95, 0xFB, 0xFC, 0xFA,
-	0x4E, 0xFA, 0xBA, 0xF9, 0x24, 0xF9, 0xB1, 0xF8, 0x32, 0xF8, 0xCA, 0xF7,
-	0x77, 0xF7, 0x43, 0xF7, 0x1C, 0xF7, 0x04, 0xF7, 0xFA, 0xF6, 0x00, 0xF7,
-	0x11, 0xF7, 0x36, 0xF7, 0x5D, 0xF7, 0x57, 0xF7, 0x38, 0xF7, 0x0A, 0xF7,
-	0xD4, 0xF6, 0xA3, 0xF6, 0x89, 0xF6, 0x68, 0xF6, 0x5B, 0xF6, 0x49, 0xF6,
-	0x20, 0xF6, 0xBF, 0xF5, 0x4A, 0xF5, 0xA7, 0xF4, 0x09, 0xF4, 0x4B, 0xF3,
-	0x87, 0xF2, 0xD2, 0xF1, 0x0B, 0xF1, 0x2C, 0xF0, 0x29, 0xEF, 0x18, 0xEE,
-	0x12, 0xED, 0x5A, 0xEC, 0xD1, 0xEB, 0xA4, 0xEB, 0xDA, 0xEB, 0x8D, 0xEC,
-	0xDD, 0xED, 0x69, 0xEF, 0x92, 0xF0, 0x46, 0xF1, 0xE9, 0xF1, 0xB3, 0xF2,
-	0xA4, 0xF3, 0xAF, 0xF4, 0x2E, 0xF6, 0x81, 0xF8, 0x9B, 0xFB, 0x0D, 0xFF,
-	0x3D, 0x02, 0xFA, 0x04, 0x2F, 0x07, 0xFC, 0x08, 0x6E, 0x0A, 0xDE, 0x0B,
-	0x33, 0x0D, 0xA8, 0x0E, 0x5C, 0x10, 0x24, 0x12, 0x9C, 0x13, 0x93, 0x14,
-	0x2E, 0x15, 0x6F, 0x15, 0x4B, 0x15, 0xB8, 0x14, 0x1D, 0x14, 0xA1, 0x13,
-	0x30, 0x13, 0x70, 0x12, 0x4C, 0x11, 0x93, 0x0F, 0x6E, 0x0D, 0x40, 0x0B,
-	0x26, 0x09, 0x33, 0x07, 0x6A, 0x05, 0xC7, 0x03, 0xA4, 0x02, 0x99, 0x01,
-	0x62, 0x00, 0xD8, 0xFE, 0x3D, 0xFD, 0xBA, 0xFB, 0x78, 0xFA, 0x6D, 0xF9,
-	0xA9, 0xF8, 0x0F, 0xF8, 0xB8, 0xF7, 0x9A, 0xF7, 0x99, 0xF7, 0xDA, 0xF7,
-	0x67, 0xF8, 0x39, 0xF9, 0x44, 0xFA, 0x39, 0xFB, 0xEA, 0xFB, 0x79, 0xFC,
-	0xEF, 0xFC, 0x5C, 0xFD, 0xAF, 0xFD, 0x25, 0xFE, 0xC3, 0xFE, 0xAF, 0xFF,
-	0xBF, 0x00, 0xC1, 0x01, 0x63, 0x02, 0xBC, 0x02, 0xCC, 0x02, 0xBD, 0x02,
-	0x7E, 0x02, 0x1A, 0x02, 0x8B, 0x01, 0x10, 0x01, 0x92, 0x00, 0x21, 0x00,
-	0x95, 0xFF, 0x04, 0xFF, 0x71, 0xFE, 0xF7, 0xFD, 0x81, 0xFD, 0x0E, 0xFD,
-	0xA9, 0xFC, 0x3E, 0xFC, 0xE4, 0xFB, 0x7C, 0xFB, 0x22, 0xFB, 0xED, 0xFA,
-	0xFC, 0xFA, 0x42, 0xFB, 0xCC, 0xFB, 0x47, 0xFC, 0xBF, 0xFC, 0x4D, 0xFD,
-	0x15, 0xFE, 0xFE, 0xFE, 0x10, 0x00, 0x42, 0x01, 0xA9, 0x02, 0x0D, 0x04,
-	0x51, 0x05, 0x3B, 0x06, 0xDF, 0x06, 0x58, 0x07, 0xE7, 0x07, 0xA5, 0x08,
-	0xA6, 0x09, 0xBC, 0x0A, 0xF1, 0x0B, 0x03, 0x0D, 0xC4, 0x0D, 0xE8, 0x0D,
-	0xB1, 0x0D, 0x12, 0x0D, 0x5E, 0x0C, 0x9E, 0x0B, 0xEC, 0x0A, 0x62, 0x0A,
-	0xEF, 0x09, 0x8C, 0x09, 0xF1, 0x08, 0x19, 0x08, 0xFF, 0x06, 0xBB, 0x05,
-	0x6D, 0x04, 0x21, 0x03, 0xE2, 0x01, 0xD2, 0x00, 0xDA, 0xFF, 0x0E, 0xFF,
-	0x47, 0xFE, 0x84, 0xFD, 0xBA, 0xFC, 0xFB, 0xFB, 0x68, 0xFB, 0xE3, 0xFA,
-	0x9D, 0xFA, 0x8B, 0xFA, 0xB2, 0xFA, 0xED, 0xFA, 0x4C, 0xFB, 0xA6, 0xFB,
-	0x02, 0xFC, 0x3E, 0xFC, 0x8C, 0xFC, 0xDA, 0xFC, 0x31, 0xFD, 0x95, 0xFD,
-	0x3B, 0xFE, 0x04, 0xFF, 0xED, 0xFF, 0xD3, 0x00, 0x8B, 0x01, 0x16, 0x02,
-	0x6F, 0x02, 0x82, 0x02, 0x74, 0x02, 0x4B, 0x02, 0x21, 0x02, 0x30, 0x02,
-	0x50, 0x02, 0x79, 0x02, 0x8A, 0x02, 0x73, 0x02, 0x3E, 0x02, 0xEB, 0x01,
-	0x7C, 0x01, 0xEB, 0x00, 0x54, 0x00, 0xF1, 0xFF, 0x9D, 0xFF, 0x68, 0xFF,
-	0x35, 0xFF, 0xFD, 0xFE, 0xCD, 0xFE, 0xB1, 0xFE, 0x92, 0xFE, 0x7C, 0xFE,
-	0x76, 0xFE, 0x8B, 0xFE, 0xD4, 0xFE, 0x32, 0xFF, 0xA5, 0xFF, 0x13, 0x00,
-	0x8E, 0x00, 0xF2, 0x00, 0x5A, 0x01, 0xB6, 0x01, 0x1B, 0x02, 0x8A, 0x02,
-	0x22, 0x03, 0xB5, 0x03, 0x68, 0x04, 0xFC, 0x04, 0x8B, 0x05, 0xF3, 0x05,
-	0x34, 0x06, 0x45, 0x06, 0x32, 0x06, 0x29, 0x06, 0x12, 0x06, 0xFE, 0x05,
-	0xE1, 0x05, 0x9D, 0x05, 0x52, 0x05, 0xFC, 0x04, 0x8E, 0x04, 0x03, 0x04,
-	0x4D, 0x03, 0xA8, 0x02, 0xF7, 0x01, 0x4F, 0x01, 0x93, 0x00, 0xBA, 0xFF,
-	0xF4, 0xFE, 0x23, 0xFE, 0x6B, 0xFD, 0xBB, 0xFC, 0x41, 0xFC, 0xC4, 0xFB,
-	0x73, 0xFB, 0x2F, 0xFB, 0xD9, 0xFA, 0x95, 0xFA, 0x34, 0xFA, 0xFC, 0xF9,
-	0xEE, 0xF9, 0xF0, 0xF9, 0x11, 0xFA, 0x4B, 0xFA, 0xAC, 0xFA, 0x0B, 0xFB,
-	0x83, 0xFB, 0xDA, 0xFB, 0x44, 0xFC, 0xBF, 0xFC, 0x47, 0xFD, 0xE2, 0xFD,
-	0x79, 0xFE, 0xF6, 0xFE, 0x81, 0xFF, 0xFA, 0xFF, 0x6F, 0x00, 0xDB, 0x00,
-	0x34, 0x01, 0x9E, 0x01, 0x00, 0x02, 0x43, 0x02, 0x83, 0x02, 0xAA, 0x02,
-	0xCD, 0x02, 0xE8, 0x02, 0xF2, 0x02, 0xFC, 0x02, 0xDE, 0x02, 0xCD, 0x02,
-	0xA6, 0x02, 0x60, 0x02, 0x2C, 0x02, 0xEF, 0x01, 0xBC, 0x01, 0xA0, 0x01,
-	0x7D, 0x01, 0x5F, 0x01, 0x3E, 0x01, 0x0D, 0x01, 0xD3, 0x00, 0x8D, 0x00,
-	0x45, 0x00, 0x06, 0x00, 0xDA, 0xFF, 0xD3, 0xFF, 0xDC, 0xFF, 0x00, 0x00,
-	0x1C, 0x00, 0x1E, 0x00, 0x27, 0x00, 0x13, 0x00, 0xFC, 0xFF, 0x00, 0x00,
-	0x0A, 0x00, 0x2B, 0x00, 0x65, 0x00, 0x96, 0x00, 0xB3, 0x00, 0xC4, 0x00,
-	0xC4, 0x00, 0xAC, 0x00, 0x99, 0x00, 0x88, 0x00, 0x85, 0x00, 0x97, 0x00,
-	0xA2, 0x00, 0xA6, 0x00, 0x91, 0x00, 0x6B, 0x00, 0x30, 0x00, 0xE2, 0xFF,
-	0x93, 0xFF, 0x4A, 0xFF, 0x0E, 0xFF, 0xE2, 0xFE, 0xBA, 0xFE, 0xA6, 0xFE,
-	0x76, 0xFE, 0x40, 0xFE, 0x0D, 0xFE, 0xCF, 0xFD, 0x84, 0xFD, 0x51, 0xFD,
-	0x19, 0xFD, 0x05, 0xFD, 0x03, 0xFD, 0x02, 0xFD, 0x0D, 0xFD, 0x23, 0xFD,
-	0x39, 0xFD, 0x4D, 0xFD, 0x6A, 0xFD, 0x7D, 0xFD, 0x9A, 0xFD, 0xD4, 0xFD,
-	0x19, 0xFE, 0x61, 0xFE, 0xB9, 0xFE, 0x12, 0xFF, 0x63, 0xFF, 0xA5, 0xFF,
-	0xEB, 0xFF, 0x26, 0x00, 0x66, 0x00, 0xBA, 0x00, 0x0C, 0x01, 0x61, 0x01,
-	0xAC, 0x01, 0xFC, 0x01, 0x33, 0x02, 0x53, 0x02, 0x67, 0x02, 0x66, 0x02,
-	0x5A, 0x02, 0x63, 0x02, 0x66, 0x02, 0x67, 0x02, 0x69, 0x02, 0x5A, 0x02,
-	0x4A, 0x02, 0x1B, 0x02, 0xE9, 0x01, 0xA5, 0x01, 0x64, 0x01, 0x26, 0x01,
-	0xE1, 0x00, 0xA0, 0x00, 0x6F, 0x00, 0x2F, 0x00, 0x04, 0x00, 0xCA, 0xFF,
-	0x8F, 0xFF, 0x62, 0xFF, 0x33, 0xFF, 0x11, 0xFF, 0xEB, 0xFE, 0xC9, 0xFE,
-	0xBC, 0xFE, 0xAE, 0xFE, 0xA0, 0xFE, 0xB2, 0xFE, 0xB2, 0xFE, 0xAE, 0xFE,
-	0xD4, 0xFE, 0xE9, 0xFE, 0xFE, 0xFE, 0x11, 0xFF, 0x34, 0xFF, 0x64, 0xFF,
-	0x81, 0xFF, 0x99, 0xFF, 0xB1, 0xFF, 0xCA, 0xFF, 0xE6, 0xFF, 0xF8, 0xFF,
-	0x12, 0x00, 0x1A, 0x00, 0x21, 0x00, 0x34, 0x00, 0x31, 0x00, 0x32, 0x00,
-	0x2F, 0x00, 0x1E, 0x00, 0x12, 0x00, 0x10, 0x00, 0x0A, 0x00, 0xF2, 0xFF,
-	0xDD, 0xFF, 0xC0, 0xFF, 0x9E, 0xFF, 0x85, 0xFF, 0x6C, 0xFF, 0x73, 0xFF,
-	0x5A, 0xFF, 0x51, 0xFF, 0x56, 0xFF, 0x5D, 0xFF, 0x6C, 0xFF, 0x69, 0xFF,
-	0x62, 0xFF, 0x6D, 0xFF, 0x6E, 0xFF, 0x91, 0xFF, 0xB3, 0xFF, 0xCA, 0xFF,
-	0xF6, 0xFF, 0x10, 0x00, 0x3F, 0x00, 0x63, 0x00, 0x93, 0x00, 0xAF, 0x00,
-	0xC5, 0x00, 0xF1, 0x00, 0x16, 0x01, 0x27, 0x01, 0x45, 0x01, 0x70, 0x01,
-	0x74, 0x01, 0x86, 0x01, 0x91, 0x01, 0x90, 0x01, 0x9B, 0x01, 0x90, 0x01,
-	0x82, 0x01, 0x5A, 0x01, 0x53, 0x01, 0x38, 0x01, 0x1E, 0x01, 0x09, 0x01,
-	0xD2, 0x00, 0xB9, 0x00, 0x85, 0x00, 0x4A, 0x00, 0x0F, 0x00, 0xD8, 0xFF,
-	0x9B, 0xFF, 0x95, 0xFF, 0x64, 0xFF, 0x3D, 0xFF, 0x24, 0xFF, 0x01, 0xFF,
-	0xDE, 0xFE, 0xA8, 0xFE, 0x85, 0xFE, 0x6A, 0xFE, 0x54, 0xFE, 0x48, 0xFE,
-	0x4B, 0xFE, 0x5F, 0xFE, 0x70, 0xFE, 0x6F, 0xFE, 0x88, 0xFE, 0x9F, 0xFE,
-	0xAC, 0xFE, 0xB4, 0xFE, 0xCD, 0xFE, 0xE8, 0xFE, 0x0F, 0xFF, 0x34, 0xFF,
-	0x62, 0xFF, 0x87, 0xFF, 0xA1, 0xFF, 0xBF, 0xFF, 0xDC, 0xFF, 0xFC, 0xFF,
-	0x23, 0x00, 0x3B, 0x00, 0x5D, 0x00, 0x79, 0x00, 0x94, 0x00, 0xA6, 0x00,
-	0xBE, 0x00, 0xBE, 0x00, 0xB7, 0x00, 0xC0, 0x00, 0xC4, 0x00, 0xC4, 0x00,
-	0xBF, 0x00, 0xC3, 0x00, 0xC1, 0x00, 0xC3, 0x00, 0xB6, 0x00, 0xB9, 0x00,
-	0xA5, 0x00, 0x95, 0x00, 0x84, 0x00, 0x68, 0x00, 0x5F, 0x00, 0x52, 0x00,
-	0x48, 0x00, 0x48, 0x00, 0x43, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x40, 0x00,
-	0x3C, 0x00, 0x2C, 0x00, 0x17, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x17, 0x00,
-	0x1A, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x29, 0x00, 0x2C, 0x00, 0x30, 0x00,
-	0x1E, 0x00, 0x26, 0x00, 0x18, 0x00, 0x17, 0x00, 0x0D, 0x00, 0xFB, 0xFF,
-	0xFD, 0xFF, 0xE8, 0xFF, 0xD8, 0xFF, 0xC2, 0xFF, 0xA9, 0xFF, 0xA3, 0xFF,
-	0x91, 0xFF, 0x81, 0xFF, 0x62, 0xFF, 0x55, 0xFF, 0x41, 0xFF, 0x32, 0xFF,
-	0x13, 0xFF, 0xF2, 0xFE, 0xD5, 0xFE, 0xCC, 0xFE, 0xC2, 0xFE, 0xBB, 0xFE,
-	0xB1, 0xFE, 0xA7, 0xFE, 0xAD, 0xFE, 0xA0, 0xFE, 0xA2, 0xFE, 0xB7, 0xFE,
-	0xC2, 0xFE, 0xCC, 0xFE, 0xCE, 0xFE, 0xFB, 0xFE, 0x01, 0xFF, 0x16, 0xFF,
-	0x31, 0xFF, 0x4E, 0xFF, 0x6D, 0xFF, 0x8C, 0xFF, 0xB2, 0xFF, 0xE2, 0xFF,
-	0x04, 0x00, 0x23, 0x00, 0x3E, 0x00, 0x4E, 0x00, 0x61, 0x00, 0x67, 0x00,
-	0x7C, 0x00, 0x98, 0x00, 0xAA, 0x00, 0xC5, 0x00, 0xD7, 0x00, 0xEA, 0x00,
-	0xE2, 0x00, 0xDC, 0x00, 0xCB, 0x00, 0xC9, 0x00, 0xBE, 0x00, 0xAA, 0x00,
-	0xA2, 0x00, 0x9F, 0x00, 0x9A, 0x00, 0x83, 0x00, 0x6E, 0x00, 0x4A, 0x00,
-	0x33, 0x00, 0x19, 0x00, 0x0A, 0x00, 0xF7, 0xFF, 0xDF, 0xFF, 0xCE, 0xFF,
-	0xB8, 0xFF, 0xB8, 0xFF, 0xA6, 0xFF, 0xA8, 0xFF, 0x8F, 0xFF, 0x82, 0xFF,
-	0x7B, 0xFF, 0x73, 0xFF, 0x6C, 0xFF, 0x6C, 0xFF, 0x75, 0xFF, 0x87, 0xFF,
-	0x95, 0xFF, 0xA4, 0xFF, 0xAC, 0xFF, 0xA8, 0xFF, 0xA1, 0xFF, 0x9F, 0xFF,
-	0x92, 0xFF, 0xA7, 0xFF, 0xBC, 0xFF, 0xD0, 0xFF, 0xE3, 0xFF, 0xF6, 0xFF,
-	0xF0, 0xFF, 0xEE, 0xFF, 0xDA, 0xFF, 0xDF, 0xFF, 0xCF, 0xFF, 0xCB, 0xFF,
-	0xD0, 0xFF, 0xD9, 0xFF, 0xD8, 0xFF, 0xCB, 0xFF, 0xC5, 0xFF, 0xB0, 0xFF,
-	0x92, 0xFF, 0x94, 0xFF, 0x84, 0xFF, 0x90, 0xFF, 0x82, 0xFF, 0x7B, 0xFF,
-	0x85, 0xFF, 0x84, 0xFF, 0x7A, 0xFF, 0x80, 0xFF, 0x7C, 0xFF, 0x8B, 0xFF,
-	0x94, 0xFF, 0x9F, 0xFF, 0xB2, 0xFF, 0xB8, 0xFF, 0xBA, 0xFF, 0xCD, 0xFF,
-	0xDD, 0xFF, 0xEC, 0xFF, 0x12, 0x00, 0x31, 0x00, 0x52, 0x00, 0x5E, 0x00,
-	0x7B, 0x00, 0x84, 0x00, 0x9D, 0x00, 0xB0, 0x00, 0xBB, 0x00, 0xD0, 0x00,
-	0xF2, 0x00, 0x01, 0x01, 0x0E, 0x01, 0x17, 0x01, 0x14, 0x01, 0x08, 0x01,
-	0x09, 0x01, 0xFF, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFA, 0x00, 0xEA, 0x00,
-	0xEB, 0x00, 0xD8, 0x00, 0xBA, 0x00, 0xA2, 0x00, 0x93, 0x00, 0x7C, 0x00,
-	0x71, 0x00, 0x55, 0x00, 0x3F, 0x00, 0x28, 0x00, 0x22, 0x00, 0x1E, 0x00,
-	0x0F, 0x00, 0x03, 0x00, 0xF6, 0xFF, 0xE6, 0xFF, 0xDE, 0xFF, 0xD4, 0xFF,
-	0xC9, 0xFF, 0xC9, 0xFF, 0xC6, 0xFF, 0xD0, 0xFF, 0xD8, 0xFF, 0xDD, 0xFF,
-	0xDE, 0xFF, 0xE1, 0xFF, 0xE6, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x13, 0x00,
-	0x24, 0x00, 0x30, 0x00, 0x45, 0x00, 0x4A, 0x00, 0x5F, 0x00, 0x5A, 0x00,
-	0x5D, 0x00, 0x69, 0x00, 0x76, 0x00, 0x72, 0x00, 0x79, 0x00, 0x84, 0x00,
-	0x89, 0x00, 0x89, 0x00, 0x8B, 0x00, 0x71, 0x00, 0x68, 0x00, 0x64, 0x00,
-	0x50, 0x00, 0x50, 0x00, 0x41, 0x00, 0x3C, 0x00, 0x3A, 0x00, 0x28, 0x00,
-	0x1E, 0x00, 0x17, 0x00, 0x15, 0x00, 0x19, 0x00, 0x18, 0x00, 0x01, 0x00,
-	0x0D, 0x00, 0x05, 0x00, 0xFC, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xF6, 0xFF,
-	0xFF, 0xFF, 0x0E, 0x00, 0x24, 0x00, 0x28, 0x00, 0x30, 0x00, 0x43, 0x00,
-	0x40, 0x00, 0x4A, 0x00, 0x50, 0x00, 0x5E, 0x00, 0x67, 0x00, 0x7C, 0x00,
-	0x8E, 0x00, 0x92, 0x00, 0x9D, 0x00, 0xAD, 0x00, 0xA6, 0x00, 0xA6, 0x00,
-	0x9A, 0x00, 0x9A, 0x00, 0x9A, 0x00, 0x9A, 0x00, 0xA7, 0x00, 0x94, 0x00,
-	0x7E, 0x00, 0x75, 0x00, 0x63, 0x00, 0x4A, 0x00, 0x36, 0x00, 0x35, 0x00,
-	0x26, 0x00, 0x19, 0x00, 0x09, 0x00, 0xFF, 0xFF, 0xE9, 0xFF, 0xE2, 0xFF,
-	0xDC, 0xFF, 0xC7, 0xFF, 0xC4, 0xFF, 0xC1, 0xFF, 0xB5, 0xFF, 0xBD, 0xFF,
-	0xD4, 0xFF, 0xD9, 0xFF, 0xD8, 0xFF, 0xE8, 0xFF, 0xDE, 0xFF, 0xED, 0xFF,
-	0xE9, 0xFF, 0x06, 0x00, 0x0E, 0x00, 0x24, 0x00, 0x31, 0x00, 0x3B, 0x00,
-	0x58, 0x00, 0x63, 0x00, 0x5D, 0x00, 0x4D, 0x00, 0x50, 0x00, 0x4D, 0x00,
-	0x4A, 0x00, 0x5D, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x3B, 0x00, 0x2C, 0x00,
-	0x15, 0x00, 0xF8, 0xFF, 0xE1, 0xFF, 0xC4, 0xFF, 0xB2, 0xFF, 0xAC, 0xFF,
-	0x99, 0xFF, 0x91, 0xFF, 0x81, 0xFF, 0x71, 0xFF, 0x5D, 0xFF, 0x4F, 0xFF,
-	0x45, 0xFF, 0x3A, 0xFF, 0x3A, 0xFF, 0x40, 0xFF, 0x4B, 0xFF, 0x53, 0xFF,
-	0x5D, 0xFF, 0x72, 0xFF, 0x7F, 0xFF, 0x86, 0xFF, 0x98, 0xFF, 0xA9, 0xFF,
-	0xC7, 0xFF, 0xE9, 0xFF, 0x06, 0x00, 0x23, 0x00, 0x43, 0x00, 0x4E, 0x00,
-	0x72, 0x00, 0x89, 0x00, 0x90, 0x00, 0x9B, 0x00, 0xB2, 0x00, 0xB9, 0x00,
-	0xC4, 0x00, 0xC9, 0x00, 0xBC, 0x00, 0xC4, 0x00, 0xCF, 0x00, 0xBA, 0x00,
-	0xB9, 0x00, 0xA3, 0x00, 0x91, 0x00, 0x76, 0x00, 0x54, 0x00, 0x3B, 0x00,
-	0x1D, 0x00, 0x0A, 0x00, 0xFC, 0xFF, 0xE4, 0xFF, 0xCA, 0xFF, 0xB8, 0xFF,
-	0x98, 0xFF, 0x95, 0xFF, 0x85, 0xFF, 0x7B, 0xFF, 0x6C, 0xFF, 0x6C, 0xFF,
-	0x6F, 0xFF, 0x81, 0xFF, 0x87, 0xFF, 0x8A, 0xFF, 0x9D, 0xFF, 0xB6, 0xFF,
-	0xD5, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x18, 0x00, 0x36, 0x00, 0x53, 0x00,
-	0x7A, 0x00, 0x93, 0x00, 0xB1, 0x00, 0xC9, 0x00, 0xEA, 0x00, 0x02, 0x01,
-	0x0E, 0x01, 0x1D, 0x01, 0x1C, 0x01, 0x16, 0x01, 0x15, 0x01, 0x16, 0x01,
-	0x24, 0x01, 0x17, 0x01, 0x10, 0x01, 0xFF, 0x00, 0xEE, 0x00, 0xCE, 0x00,
-	0xA5, 0x00, 0x76, 0x00, 0x55, 0x00, 0x3C, 0x00, 0x26, 0x00, 0x01, 0x00,
-	0xFC, 0xFF, 0xDC, 0xFF, 0xA5, 0xFF, 0x82, 0xFF, 0x76, 0xFF, 0x4C, 0xFF,
-	0x3C, 0xFF, 0x2D, 0xFF, 0x2E, 0xFF, 0x24, 0xFF, 0x23, 0xFF, 0x1E, 0xFF,
-	0x1C, 0xFF, 0x15, 0xFF, 0x1C, 0xFF, 0x1B, 0xFF, 0x37, 0xFF, 0x4C, 0xFF,
-	0x59, 0xFF, 0x6E, 0xFF, 0x76, 0xFF, 0x91, 0xFF, 0xA9, 0xFF, 0xB3, 0xFF,
-	0xCA, 0xFF, 0xE1, 0xFF, 0xE6, 0xFF, 0xEE, 0xFF, 0xFA, 0xFF, 0x08, 0x00,
-	0x0B, 0x00, 0x18, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x13, 0x00,
-	0x12, 0x00, 0xFB, 0xFF, 0xF3, 0xFF, 0xE2, 0xFF, 0xDA, 0xFF, 0xCB, 0xFF,
-	0xC7, 0xFF, 0xC0, 0xFF, 0xBF, 0xFF, 0xA3, 0xFF, 0x90, 0xFF, 0x94, 0xFF,
-	0x85, 0xFF, 0x7B, 0xFF, 0x7B, 0xFF, 0x7D, 0xFF, 0x81, 0xFF, 0x74, 0xFF,
-	0x76, 0xFF, 0x80, 0xFF, 0x87, 0xFF, 0x8C, 0xFF, 0x93, 0xFF, 0xA0, 0xFF,
-	0xB3, 0xFF, 0xC6, 0xFF, 0xCC, 0xFF, 0xD5, 0xFF, 0xE6, 0xFF, 0xF0, 0xFF,
-	0xF0, 0xFF, 0x00, 0x00, 0x04, 0x00, 0x14, 0x00, 0x14, 0x00, 0x24, 0x00,
-	0x21, 0x00, 0x31, 0x00, 0x32, 0x00, 0x31, 0x00, 0x34, 0x00, 0x32, 0x00,
-	0x2B, 0x00, 0x27, 0x00, 0x23, 0x00, 0x18, 0x00, 0x14, 0x00, 0x08, 0x00,
-	0xFA, 0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xE1, 0xFF, 0xD6, 0xFF, 0xD9, 0xFF,
-	0xC5, 0xFF, 0xD3, 0xFF, 0xBF, 0xFF, 0xBD, 0xFF, 0xBB, 0xFF, 0xB3, 0xFF,
-	0xAE, 0xFF, 0xAD, 0xFF, 0xAC, 0xFF, 0xAF, 0xFF, 0xC1, 0xFF, 0xCC, 0xFF,
-	0xD3, 0xFF, 0xD4, 0xFF, 0xCE, 0xFF, 0xCC, 0xFF, 0xC9, 0xFF, 0xD9, 0xFF,
-	0xCB, 0xFF, 0xD9, 0xFF, 0xE2, 0xFF, 0xEB, 0xFF, 0xE2, 0xFF, 0xDA, 0xFF,
-	0xDE, 0xFF, 0xD4, 0xFF, 0xD8, 0xFF, 0xCA, 0xFF, 0xDF, 0xFF, 0xE1, 0xFF,
-	0xEB, 0xFF, 0xE1, 0xFF, 0xD1, 0xFF, 0xC9, 0xFF, 0xC6, 0xFF, 0xC2, 0xFF,
-	0xB7, 0xFF, 0xB4, 0xFF, 0xBA, 0xFF, 0xC7, 0xFF, 0xCA, 0xFF, 0xCB, 0xFF,
-	0xCE, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF, 0xCF, 0xFF, 0xCA, 0xFF, 0xC7, 0xFF,
-	0xD4, 0xFF, 0xCB, 0xFF, 0xCE, 0xFF, 0xD5, 0xFF, 0xD9, 0xFF, 0xE8, 0xFF,
-	0xF6, 0xFF, 0xF8, 0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xEC, 0xFF, 0xE6, 0xFF,
-	0xDC, 0xFF, 0xD6, 0xFF, 0xD1, 0xFF, 0xD5, 0xFF, 0xDA, 0xFF, 0xD3, 0xFF,
-	0xD9, 0xFF, 0xD3, 0xFF, 0xC0, 0xFF, 0xB7, 0xFF, 0xAD, 0xFF, 0xA2, 0xFF,
-	0xA0, 0xFF, 0xA3, 0xFF, 0xA5, 0xFF, 0x9B, 0xFF, 0x9D, 0xFF, 0xA0, 0xFF,
-	0x9B, 0xFF, 0x9A, 0xFF, 0x9D, 0xFF, 0x95, 0xFF, 0x9E, 0xFF, 0xAA, 0xFF,
-	0xB7, 0xFF, 0xAD, 0xFF, 0xB6, 0xFF, 0xB4, 0xFF, 0xB7, 0xFF, 0xBC, 0xFF,
-	0xC1, 0xFF, 0xE1, 0xFF, 0xE4, 0xFF, 0xF5, 0xFF, 0xF3, 0xFF, 0x01, 0x00,
-	0x0E, 0x00, 0x03, 0x00, 0x12, 0x00, 0x10, 0x00, 0x0B, 0x00, 0x0D, 0x00,
-	0x01, 0x00, 0x05, 0x00, 0xFF, 0xFF, 0x08, 0x00, 0x0D, 0x00, 0x06, 0x00,
-	0x0B, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xF2, 0xFF, 0xE1, 0xFF, 0xD5, 0xFF,
-	0xD4, 0xFF, 0xD4, 0xFF, 0xD1, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xC7, 0xFF,
-	0xC6, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xBA, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF,
-	0xC5, 0xFF, 0xC7, 0xFF, 0xCE, 0xFF, 0xBF, 0xFF, 0xC4, 0xFF, 0xC0, 0xFF,
-	0xC2, 0xFF, 0xD6, 0xFF, 0xC2, 0xFF, 0xD8, 0xFF, 0xE8, 0xFF, 0xEB, 0xFF,
-	0xED, 0xFF, 0xE2, 0xFF, 0xE6, 0xFF, 0xDF, 0xFF, 0xE4, 0xFF, 0xE9, 0xFF,
-	0xEC, 0xFF, 0xE9, 0xFF, 0xF2, 0xFF, 0xF3, 0xFF, 0xEC, 0xFF, 0xEC, 0xFF,
-	0x00, 0x00, 0xFC, 0xFF, 0xF8, 0xFF, 0xEC, 0xFF, 0xEE, 0xFF, 0xF0, 0xFF,
-	0xEC, 0xFF, 0xF1, 0xFF, 0xF7, 0xFF, 0xFA, 0xFF, 0x01, 0x00, 0x14, 0x00,
-	0x14, 0x00, 0x13, 0x00, 0x0F, 0x00, 0x21, 0x00, 0x25, 0x00, 0x2F, 0x00,
-	0x36, 0x00, 0x32, 0x00, 0x3C, 0x00, 0x3B, 0x00, 0x41, 0x00, 0x46, 0x00,
-	0x4C, 0x00, 0x53, 0x00, 0x54, 0x00, 0x5E, 0x00, 0x68, 0x00, 0x6C, 0x00,
-	0x5E, 0x00, 0x52, 0x00, 0x4F, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0x27, 0x00,
-	0x21, 0x00, 0x10, 0x00, 0x19, 0x00, 0x0A, 0x00, 0xFB, 0xFF, 0xE7, 0xFF,
-	0xE2, 0xFF, 0xCA, 0xFF, 0xC2, 0xFF, 0xAD, 0xFF, 0x9F, 0xFF, 0x99, 0xFF,
-	0x98, 0xFF, 0x80, 0xFF, 0x77, 0xFF, 0x76, 0xFF, 0x76, 0xFF, 0x6D, 0xFF,
-	0x76, 0xFF, 0x6A, 0xFF, 0x6F, 0xFF, 0x82, 0xFF, 0x81, 0xFF, 0x94, 0xFF,
-	0x99, 0xFF, 0xA5, 0xFF, 0xB4, 0xFF, 0xBC, 0xFF, 0xB3, 0xFF, 0xCE, 0xFF,
-	0xD8, 0xFF, 0xE8, 0xFF, 0xE6, 0xFF, 0xF2, 0xFF, 0xF5, 0xFF, 0x01, 0x00,
-	0x03, 0x00, 0x0A, 0x00, 0xFF, 0xFF, 0x0D, 0x00, 0x03, 0x00, 0xFA, 0xFF,
-	0xFA, 0xFF, 0xF5, 0xFF, 0xF7, 0xFF, 0xEE, 0xFF, 0xF2, 0xFF, 0xE2, 0xFF,
-	0xDF, 0xFF, 0xCB, 0xFF, 0xC5, 0xFF, 0xC7, 0xFF, 0xBA, 0xFF, 0xB6, 0xFF,
-	0xC0, 0xFF, 0xB2, 0xFF, 0xAD, 0xFF, 0xA8, 0xFF, 0xA3, 0xFF, 0xAF, 0xFF,
-	0xAC, 0xFF, 0xAC, 0xFF, 0xC0, 0xFF, 0xD0, 0xFF, 0xD8, 0xFF, 0xD5, 0xFF,
-	0xD9, 0xFF, 0xEC, 0xFF, 0xF1, 0xFF, 0xEC, 0xFF, 0xEE, 0xFF, 0x08, 0x00,
-	0x0D, 0x00, 0x15, 0x00, 0x21, 0x00, 0x1E, 0x00, 0x32, 0x00, 0x27, 0x00,
-	0x23, 0x00, 0x1C, 0x00, 0x19, 0x00, 0x19, 0x00, 0x06, 0x00, 0x06, 0x00,
-	0x0D, 0x00, 0x08, 0x00, 0xF8, 0xFF, 0xF7, 0xFF, 0xF8, 0xFF, 0xED, 0xFF,
-	0xDF, 0xFF, 0xE2, 0xFF, 0xDE, 0xFF, 0xD8, 0xFF, 0xD8, 0xFF, 0xD3, 0xFF,
-	0xD6, 0xFF, 0xE4, 0xFF, 0xE3, 0xFF, 0xE9, 0xFF, 0xF3, 0xFF, 0xF1, 0xFF,
-	0xF2, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0x13, 0x00, 0x18, 0x00,
-	0x23, 0x00, 0x32, 0x00, 0x32, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00,
-	0x32, 0x00, 0x28, 0x00, 0x2B, 0x00, 0x24, 0x00, 0x24, 0x00, 0x1E, 0x00,
-	0x1C, 0x00, 0x10, 0x00, 0x0D, 0x00, 0xF8, 0xFF, 0xF2, 0xFF, 0xE4, 0xFF,
-	0xCB, 0xFF, 0xB7, 0xFF, 0xAC, 0xFF, 0x99, 0xFF, 0x90, 0xFF, 0x87, 0xFF,
-	0x77, 0xFF, 0x72, 0xFF, 0x61, 0xFF, 0x54, 0xFF, 0x50, 0xFF, 0x42, 0xFF,
-	0x46, 0xFF, 0x3A, 0xFF, 0x3E, 0xFF, 0x38, 0xFF, 0x3C, 0xFF, 0x48, 0xFF,
-	0x47, 0xFF, 0x56, 0xFF, 0x57, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x6C, 0xFF,
-	0x79, 0xFF, 0x85, 0xFF, 0x93, 0xFF, 0x9E, 0xFF, 0xA8, 0xFF, 0xAF, 0xFF,
-	0xC1, 0xFF, 0xC2, 0xFF, 0xC9, 0xFF, 0xCA, 0xFF, 0xC6, 0xFF, 0xCC, 0xFF,
-	0xD4, 0xFF, 0xE7, 0xFF, 0xE8, 0xFF, 0xEE, 0xFF, 0xE6, 0xFF, 0xE2, 0xFF,
-	0xDF, 0xFF, 0xDC, 0xFF, 0xD0, 0xFF, 0xD6, 0xFF, 0xC6, 0xFF, 0xD4, 0xFF,
-	0xD5, 0xFF, 0xD4, 0xFF, 0xCC, 0xFF, 0xCE, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF,
-	0xC1, 0xFF, 0xB5, 0xFF, 0xC0, 0xFF, 0xB7, 0xFF, 0xAD, 0xFF, 0xC1, 0xFF,
-	0xCB, 0xFF, 0xC7, 0xFF, 0xDA, 0xFF, 0xDF, 0xFF, 0xE2, 0xFF, 0xDC, 0xFF,
-	0xE2, 0xFF, 0xE9, 0xFF, 0xDF, 0xFF, 0xD9, 0xFF, 0xDC, 0xFF, 0xE8, 0xFF,
-	0xE2, 0xFF, 0xEC, 0xFF, 0xF5, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD1, 0xFF,
-	0xC6, 0xFF, 0xC1, 0xFF, 0xB6, 0xFF, 0xB8, 0xFF, 0xB0, 0xFF, 0x9D, 0xFF,
-	0x98, 0xFF, 0x7E, 0xFF, 0x74, 0xFF, 0x6F, 0xFF, 0x58, 0xFF, 0x59, 0xFF,
-	0x4F, 0xFF, 0x3E, 0xFF, 0x33, 0xFF, 0x39, 0xFF, 0x29, 0xFF, 0x19, 0xFF,
-	0x12, 0xFF, 0x08, 0xFF, 0xFA, 0xFE, 0xF9, 0xFE, 0xF2, 0xFE, 0xF8, 0xFE,
-	0xF7, 0xFE, 0x01, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xF2, 0xFE, 0xFE, 0xFE,
-	0xFC, 0xFE, 0x0C, 0xFF, 0x12, 0xFF, 0x0B, 0xFF, 0x11, 0xFF, 0x1C, 0xFF,
-	0x1B, 0xFF, 0x2F, 0xFF, 0x38, 0xFF, 0x3E, 0xFF, 0x45, 0xFF, 0x4C, 0xFF,
-	0x50, 0xFF, 0x6F, 0xFF, 0x6A, 0xFF, 0x69, 0xFF, 0x78, 0xFF, 0x82, 0xFF,
-	0x95, 0xFF, 0xA0, 0xFF, 0xA9, 0xFF, 0xBC, 0xFF, 0xB8, 0xFF, 0xBD, 0xFF,
-	0xC9, 0xFF, 0xD1, 0xFF, 0xD5, 0xFF, 0xDC, 0xFF, 0xE3, 0xFF, 0xF0, 0xFF,
-	0xE9, 0xFF, 0xF3, 0xFF, 0xF5, 0xFF, 0xF8, 0xFF, 0x04, 0x00, 0xFA, 0xFF,
-	0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x14, 0x00,
-	0xFC, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xE6, 0xFF, 0xE8, 0xFF, 0xE6, 0xFF,
-	0xE3, 0xFF, 0xD9, 0xFF, 0xD0, 0xFF, 0xCE, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF,
-	0xB6, 0xFF, 0xAC, 0xFF, 0xA3, 0xFF, 0x98, 0xFF, 0x7F, 0xFF, 0x6F, 0xFF,
-	0x7A, 0xFF, 0x69, 0xFF, 0x63, 0xFF, 0x5E, 0xFF, 0x62, 0xFF, 0x53, 0xFF,
-	0x53, 0xFF, 0x54, 0xFF, 0x49, 0xFF, 0x4C, 0xFF, 0x47, 0xFF, 0x4B, 0xFF,
-	0x49, 0xFF, 0x4B, 0xFF, 0x53, 0xFF, 0x5D, 0xFF, 0x62, 0xFF, 0x68, 0xFF,
-	0x71, 0xFF, 0x6A, 0xFF, 0x7A, 0xFF, 0x68, 0xFF, 0x70, 0xFF, 0x73, 0xFF,
-	0x7D, 0xFF, 0x7D, 0xFF, 0x8A, 0xFF, 0x7C, 0xFF, 0x80, 0xFF, 0x87, 0xFF,
-	0x91, 0xFF, 0x81, 0xFF, 0x8A, 0xFF, 0x7B, 0xFF, 0x78, 0xFF, 0x67, 0xFF,
-	0x78, 0xFF, 0x67, 0xFF, 0x58, 0xFF, 0x5B, 0xFF, 0x63, 0xFF, 0x5F, 0xFF,
-	0x54, 0xFF, 0x5D, 0xFF, 0x58, 0xFF, 0x50, 0xFF, 0x51, 0xFF, 0x55, 0xFF,
-	0x58, 0xFF, 0x63, 0xFF, 0x5F, 0xFF, 0x63, 0xFF, 0x71, 0xFF, 0x75, 0xFF,
-	0x82, 0xFF, 0x8B, 0xFF, 0x8C, 0xFF, 0x9C, 0xFF, 0xAB, 0xFF, 0xB6, 0xFF,
-	0xCB, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xEC, 0xFF, 0xF0, 0xFF, 0xF1, 0xFF,
-	0xFB, 0xFF, 0x06, 0x00, 0x12, 0x00, 0x0E, 0x00, 0x1A, 0x00, 0x21, 0x00,
-	0x19, 0x00, 0x1F, 0x00, 0x1A, 0x00, 0x17, 0x00, 0x1A, 0x00, 0x10, 0x00,
-	0x0D, 0x00, 0xFC, 0xFF, 0xF2, 0xFF, 0xE8, 0xFF, 0xDF, 0xFF, 0xE2, 0xFF,
-	0xD4, 0xFF, 0xCE, 0xFF, 0xBD, 0xFF, 0xBA, 0xFF, 0xB3, 0xFF, 0xB3, 0xFF,
-	0xB0, 0xFF, 0xAB, 0xFF, 0xAB, 0xFF, 0xA6, 0xFF, 0xA8, 0xFF, 0xB2, 0xFF,
-	0xB1, 0xFF, 0xAD, 0xFF, 0xB6, 0xFF, 0xC0, 0xFF, 0xBD, 0xFF, 0xC7, 0xFF,
-	0xD2, 0xFF, 0xDA, 0xFF, 0xE3, 0xFF, 0xE4, 0xFF, 0xE1, 0xFF, 0xF2, 0xFF,
-	0xEB, 0xFF, 0xFD, 0xFF, 0xF5, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0xFA, 0xFF,
-	0xF8, 0xFF, 0xFB, 0xFF, 0xF2, 0xFF, 0xE7, 0xFF, 0xD8, 0xFF, 0xD4, 0xFF,
-	0xCB, 0xFF, 0xB0, 0xFF, 0xB3, 0xFF, 0xA4, 0xFF, 0xA6, 0xFF, 0xA3, 0xFF,
-	0x89, 0xFF, 0x90, 0xFF, 0x97, 0xFF, 0x8E, 0xFF, 0x87, 0xFF, 0x7A, 0xFF,
-	0x6C, 0xFF, 0x66, 0xFF, 0x5F, 0xFF, 0x63, 0xFF, 0x7F, 0xFF, 0x78, 0xFF,
-	0x78, 0xFF, 0x84, 0xFF, 0x87, 0xFF, 0x9A, 0xFF, 0x9C, 0xFF, 0xA3, 0xFF,
-	0xAE, 0xFF, 0xB5, 0xFF, 0xC0, 0xFF, 0xD0, 0xFF, 0xE1, 0xFF, 0xE2, 0xFF,
-	0xEE, 0xFF, 0xF8, 0xFF, 0xFD, 0xFF, 0x0D, 0x00, 0x0D, 0x00, 0x17, 0x00,
-	0x24, 0x00, 0x26, 0x00, 0x2B, 0x00, 0x31, 0x00, 0x32, 0x00, 0x32, 0x00,
-	0x2C, 0x00, 0x28, 0x00, 0x21, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x19, 0x00,
-	0x12, 0x00, 0x06, 0x00, 0xFD, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0xF5, 0xFF,
-	0xDA, 0xFF, 0xD3, 0xFF, 0xD8, 0xFF, 0xD0, 0xFF, 0xCD, 0xFF, 0xC6, 0xFF,
-	0xC1, 0xFF, 0xCD, 0xFF, 0xC6, 0xFF, 0xD4, 0xFF, 0xD8, 0xFF, 0xD3, 0xFF,
-	0xD8, 0xFF, 0xE1, 0xFF, 0xE4, 0xFF, 0xE4, 0xFF, 0xFA, 0xFF, 0x05, 0x00,
-	0x0A, 0x00, 0x0F, 0x00, 0x1A, 0x00, 0x15, 0x00, 0x26, 0x00, 0x29, 0x00,
-	0x32, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x27, 0x00, 0x23, 0x00, 0x12, 0x00,
-	0x13, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x00, 0xF0, 0xFF, 0xE6, 0xFF,
-	0xD2, 0xFF, 0xC6, 0xFF, 0xB0, 0xFF, 0xAD, 0xFF, 0xA6, 0xFF, 0x98, 0xFF,
-	0x89, 0xFF, 0x76, 0xFF, 0x71, 0xFF, 0x62, 0xFF, 0x5E, 0xFF, 0x5A, 0xFF,
-	0x54, 0xFF, 0x5C, 0xFF, 0x5D, 0xFF, 0x5F, 0xFF, 0x69, 0xFF, 0x73, 0xFF,
-	0x7B, 0xFF, 0x7F, 0xFF, 0x89, 0xFF, 0x9F, 0xFF, 0xB6, 0xFF, 0xC0, 0xFF,
-	0xD0, 0xFF, 0xF0, 0xFF, 0x03, 0x00, 0x13, 0x00, 0x28, 0x00, 0x3F, 0x00,
-	0x54, 0x00, 0x4A, 0x00, 0x54, 0x00, 0x6E, 0x00, 0x79, 0x00, 0x86, 0x00,
-	0x93, 0x00, 0x92, 0x00, 0x8A, 0x00, 0x85, 0x00, 0x7F, 0x00, 0x7F, 0x00,
-	0x7F, 0x00, 0x77, 0x00, 0x6D, 0x00, 0x62, 0x00, 0x50, 0x00, 0x35, 0x00,
-	0x28, 0x00, 0x17, 0x00, 0x10, 0x00, 0xFD, 0xFF, 0xEB, 0xFF, 0xDC, 0xFF,
-	0xD9, 0xFF, 0xCE, 0xFF, 0xD2, 0xFF, 0xC0, 0xFF, 0xBD, 0xFF, 0xAE, 0xFF,
-	0xC2, 0xFF, 0xBD, 0xFF, 0xC5, 0xFF, 0xD2, 0xFF, 0xDA, 0xFF, 0xEB, 0xFF,
-	0xEB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x1D, 0x00, 0x2D, 0x00,
-	0x3E, 0x00, 0x4D, 0x00, 0x5C, 0x00, 0x6B, 0x00, 0x75, 0x00, 0x7F, 0x00,
-	0x84, 0x00, 0x85, 0x00, 0x8F, 0x00, 0x8D, 0x00, 0x90, 0x00, 0x8B, 0x00,
-	0x93, 0x00, 0x83, 0x00, 0x81, 0x00, 0x6F, 0x00, 0x67, 0x00, 0x59, 0x00,
-	0x3B, 0x00, 0x3A, 0x00, 0x1E, 0x00, 0x14, 0x00, 0x06, 0x00, 0xF0, 0xFF,
-	0xDC, 0xFF, 0xD2, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xA3, 0xFF, 0x8E, 0xFF,
-	0x84, 0xFF, 0x7B, 0xFF, 0x76, 0xFF, 0x75, 0xFF, 0x6C, 0xFF, 0x7A, 0xFF,
-	0x77, 0xFF, 0x7D, 0xFF, 0x8A, 0xFF, 0x90, 0xFF, 0x9D, 0xFF, 0xB0, 0xFF,
-	0xB8, 0xFF, 0xC9, 0xFF, 0xE2, 0xFF, 0xF2, 0xFF, 0xFA, 0xFF, 0x0B, 0x00,
-	0x18, 0x00, 0x1F, 0x00, 0x24, 0x00, 0x40, 0x00, 0x43, 0x00, 0x4E, 0x00,
-	0x50, 0x00, 0x5E, 0x00, 0x64, 0x00, 0x75, 0x00, 0x68, 0x00, 0x67, 0x00,
-	0x64, 0x00, 0x62, 0x00, 0x61, 0x00, 0x5A, 0x00, 0x4E, 0x00, 0x57, 0x00,
-	0x50, 0x00, 0x35, 0x00, 0x2D, 0x00, 0x22, 0x00, 0x12, 0x00, 0x04, 0x00,
-	0xFA, 0xFF, 0xED, 0xFF, 0xE8, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF,
-	0xCE, 0xFF, 0xBB, 0xFF, 0xAD, 0xFF, 0xBA, 0xFF, 0xBD, 0xFF, 0xB8, 0xFF,
-	0xC2, 0xFF, 0xBB, 0xFF, 0xBF, 0xFF, 0xCC, 0xFF, 0xBD, 0xFF, 0xC9, 0xFF,
-	0xD5, 0xFF, 0xDE, 0xFF, 0xE6, 0xFF, 0xE9, 0xFF, 0xEC, 0xFF, 0xF2, 0xFF,
-	0xF0, 0xFF, 0xF7, 0xFF, 0xEE, 0xFF, 0xFA, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF,
-	0x03, 0x00, 0xFA, 0xFF, 0xF3, 0xFF, 0xF7, 0xFF, 0xF6, 0xFF, 0xE8, 0xFF,
-	0xE7, 0xFF, 0xD8, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD8, 0xFF, 0xC6, 0xFF,
-	0xB3, 0xFF, 0xAD, 0xFF, 0xA3, 0xFF, 0x9F, 0xFF, 0x9B, 0xFF, 0x9A, 0xFF,
-	0x96, 0xFF, 0x9F, 0xFF, 0x95, 0xFF, 0x93, 0xFF, 0x95, 0xFF, 0x8B, 0xFF,
-	0x8F, 0xFF, 0x8E, 0xFF, 0x93, 0xFF, 0x9F, 0xFF, 0xA6, 0xFF, 0xA2, 0xFF,
-	0xB8, 0xFF, 0xB5, 0xFF, 0xB7, 0xFF, 0xBF, 0xFF, 0xCE, 0xFF, 0xDA, 0xFF,
-	0xDA, 0xFF, 0xD9, 0xFF, 0xDD, 0xFF, 0xE3, 0xFF, 0xEC, 0xFF, 0xF7, 0xFF,
-	0xF1, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFD, 0xFF, 0x00, 0x00,
-	0x03, 0x00, 0xFA, 0xFF, 0xED, 0xFF, 0xEC, 0xFF, 0xE7, 0xFF, 0xE2, 0xFF,
-	0xD7, 0xFF, 0xCA, 0xFF, 0xC9, 0xFF, 0xBD, 0xFF, 0xA7, 0xFF, 0xA0, 0xFF,
-	0x98, 0xFF, 0x95, 0xFF, 0x90, 0xFF, 0x8C, 0xFF, 0x91, 0xFF, 0x82, 0xFF,
-	0x7B, 0xFF, 0x82, 0xFF, 0x89, 0xFF, 0x81, 0xFF, 0x85, 0xFF, 0x99, 0xFF,
-	0xA3, 0xFF, 0xB0, 0xFF, 0xC6, 0xFF, 0xC9, 0xFF, 0xD5, 0xFF, 0xDF, 0xFF,
-	0xE9, 0xFF, 0xF2, 0xFF, 0xFA, 0xFF, 0x0B, 0x00, 0x19, 0x00, 0x2F, 0x00,
-	0x2C, 0x00, 0x3A, 0x00, 0x39, 0x00, 0x50, 0x00, 0x4D, 0x00, 0x53, 0x00,
-	0x50, 0x00, 0x52, 0x00, 0x48, 0x00, 0x3F, 0x00, 0x41, 0x00, 0x3E, 0x00,
-	0x3F, 0x00, 0x31, 0x00, 0x2B, 0x00, 0x1F, 0x00, 0x12, 0x00, 0x03, 0x00,
-	0xF6, 0xFF, 0xE9, 0xFF, 0xD4, 0xFF, 0xCC, 0xFF, 0xBD, 0xFF, 0xA4, 0xFF,
-	0x9B, 0xFF, 0x93, 0xFF, 0x84, 0xFF, 0x7D, 0xFF, 0x6D, 0xFF, 0x63, 0xFF,
-	0x5A, 0xFF, 0x50, 0xFF, 0x4F, 0xFF, 0x5B, 0xFF, 0x57, 0xFF, 0x65, 0xFF,
-	0x5E, 0xFF, 0x62, 0xFF, 0x6C, 0xFF, 0x71, 0xFF, 0x7E, 0xFF, 0x89, 0xFF,
-	0x8F, 0xFF, 0x8B, 0xFF, 0xA3, 0xFF, 0x9E, 0xFF, 0xA3, 0xFF, 0xBA, 0xFF,
-	0xBB, 0xFF, 0xBC, 0xFF, 0xCB, 0xFF, 0xC7, 0xFF, 0xCE, 0xFF, 0xD8, 0xFF,
-	0xD9, 0xFF, 0xDF, 0xFF, 0xE6, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xE2, 0xFF,
-	0xDD, 0xFF, 0xD9, 0xFF, 0xD8, 0xFF, 0xD5, 0xFF, 0xD6, 0xFF, 0xD8, 0xFF,
-	0xCF, 0xFF, 0xD8, 0xFF, 0xD8, 0xFF, 0xC4, 0xFF, 0xCA, 0xFF, 0xC7, 0xFF,
-	0xD0, 0xFF, 0xCC, 0xFF, 0xC7, 0xFF, 0xD0, 0xFF, 0xD5, 0xFF, 0xDD, 0xFF,
-	0xDC, 0xFF, 0xE2, 0xFF, 0xDC, 0xFF, 0xD9, 0xFF, 0xDD, 0xFF, 0xDF, 0xFF,
-	0xE8, 0xFF, 0xF5, 0xFF, 0xF2, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0xFA, 0xFF,
-	0xFB, 0xFF, 0xF6, 0xFF, 0xFD, 0xFF, 0xFA, 0xFF, 0xFC, 0xFF, 0x00, 0x00,
-	0xFA, 0xFF, 0xF7, 0xFF, 0xEE, 0xFF, 0xF2, 0xFF, 0xE7, 0xFF, 0xDD, 0xFF,
-	0xDD, 0xFF, 0xD5, 0xFF, 0xCA, 0xFF, 0xD0, 0xFF, 0xC4, 0xFF, 0xBD, 0xFF,
-	0xBA, 0xFF, 0xB7, 0xFF, 0xB3, 0xFF, 0xB8, 0xFF, 0xB6, 0xFF, 0xC0, 0xFF,
-	0xB3, 0xFF, 0xBA, 0xFF, 0xB7, 0xFF, 0xB4, 0xFF, 0xBC, 0xFF, 0xBA, 0xFF,
-	0xC2, 0xFF, 0xBC, 0xFF, 0xC1, 0xFF, 0xCE, 0xFF, 0xC7, 0xFF, 0xC6, 0xFF,
-	0xD0, 0xFF, 0xD3, 0xFF, 0xD6, 0xFF, 0xE1, 0xFF, 0xE9, 0xFF, 0xE4, 0xFF,
-	0xE6, 0xFF, 0xD4, 0xFF, 0xE2, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xE7, 0xFF,
-	0xDE, 0xFF, 0xDC, 0xFF, 0xD8, 0xFF, 0xCC, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF,
-	0xC5, 0xFF, 0xC5, 0xFF, 0xC2, 0xFF, 0xB8, 0xFF, 0xB3, 0xFF, 0xB1, 0xFF,
-	0xAF, 0xFF, 0xA7, 0xFF, 0xA8, 0xFF, 0xAC, 0xFF, 0xAC, 0xFF, 0xB2, 0xFF,
-	0xAD, 0xFF, 0xC2, 0xFF, 0xBD, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD0, 0xFF,
-	0xDF, 0xFF, 0xED, 0xFF, 0xF8, 0xFF, 0x13, 0x00, 0x0E, 0x00, 0x30, 0x00,
-	0x22, 0x00, 0x2F, 0x00, 0x45, 0x00, 0x4A, 0x00, 0x5E, 0x00, 0x61, 0x00,
-	0x68, 0x00, 0x7B, 0x00, 0x8F, 0x00, 0x8E, 0x00, 0x93, 0x00, 0x9D, 0x00,
-	0x98, 0x00, 0x95, 0x00, 0x8A, 0x00, 0x85, 0x00, 0x85, 0x00, 0x83, 0x00,
-	0x75, 0x00, 0x6F, 0x00, 0x65, 0x00, 0x59, 0x00, 0x49, 0x00, 0x34, 0x00,
-	0x22, 0x00, 0x21, 0x00, 0x10, 0x00, 0x06, 0x00, 0xF3, 0xFF, 0xE8, 0xFF,
-	0xDD, 0xFF, 0xD5, 0xFF, 0xCB, 0xFF, 0xB8, 0xFF, 0xB3, 0xFF, 0xB6, 0xFF,
-	0xB4, 0xFF, 0xB4, 0xFF, 0xAD, 0xFF, 0xAC, 0xFF, 0xAC, 0xFF, 0xAF, 0xFF,
-	0xA9, 0xFF, 0xAA, 0xFF, 0xB2, 0xFF, 0xB4, 0xFF, 0xC2, 0xFF, 0xD0, 0xFF,
-	0xCF, 0xFF, 0xD9, 0xFF, 0xE4, 0xFF, 0xF1, 0xFF, 0xFA, 0xFF, 0x04, 0x00,
-	0x06, 0x00, 0x0E, 0x00, 0x1A, 0x00, 0x2A, 0x00, 0x30, 0x00, 0x26, 0x00,
-	0x2F, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x39, 0x00, 0x3F, 0x00,
-	0x2B, 0x00, 0x2B, 0x00, 0x1D, 0x00, 0x1A, 0x00, 0x17, 0x00, 0x14, 0x00,
-	0x10, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0xF8, 0xFF, 0xE9, 0xFF,
-	0xEE, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xD5, 0xFF, 0xDF, 0xFF, 0xD6, 0xFF,
-	0xDF, 0xFF, 0xDA, 0xFF, 0xE4, 0xFF, 0xE1, 0xFF, 0xE7, 0xFF, 0xEC, 0xFF,
-	0xF6, 0xFF, 0x01, 0x00, 0x05, 0x00, 0x0D, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-	0x2F, 0x00, 0x28, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x51, 0x00, 0x54, 0x00,
-	0x62, 0x00, 0x66, 0x00, 0x71, 0x00, 0x71, 0x00, 0x79, 0x00, 0x7D, 0x00,
-	0x7F, 0x00, 0x8D, 0x00, 0x83, 0x00, 0x88, 0x00, 0x8D, 0x00, 0x82, 0x00,
-	0x74, 0x00, 0x7B, 0x00, 0x7B, 0x00, 0x75, 0x00, 0x71, 0x00, 0x6E, 0x00,
-	0x65, 0x00, 0x61, 0x00, 0x54, 0x00, 0x58, 0x00, 0x52, 0x00, 0x4D, 0x00,
-	0x44, 0x00, 0x3A, 0x00, 0x32, 0x00, 0x36, 0x00, 0x32, 0x00, 0x30, 0x00,
-	0x32, 0x00, 0x39, 0x00, 0x31, 0x00, 0x2C, 0x00, 0x3B, 0x00, 0x34, 0x00,
-	0x2B, 0x00, 0x2F, 0x00, 0x39, 0x00, 0x2F, 0x00, 0x36, 0x00, 0x39, 0x00,
-	0x34, 0x00, 0x35, 0x00, 0x31, 0x00, 0x22, 0x00, 0x1A, 0x00, 0x21, 0x00,
-	0x10, 0x00, 0x10, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x05, 0x00, 0xF8, 0xFF,
-	0xF0, 0xFF, 0xE8, 0xFF, 0xDB, 0xFF, 0xD0, 0xFF, 0xD1, 0xFF, 0xCE, 0xFF,
-	0xC0, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xB4, 0xFF, 0xB3, 0xFF, 0xA2, 0xFF,
-	0xA8, 0xFF, 0x98, 0xFF, 0x9F, 0xFF, 0xAE, 0xFF, 0xAC, 0xFF, 0xAE, 0xFF,
-	0xB7, 0xFF, 0xAF, 0xFF, 0xC0, 0xFF, 0xBC, 0xFF, 0xC4, 0xFF, 0xD4, 0xFF,
-	0xD9, 0xFF, 0xEC, 0xFF, 0xE6, 0xFF, 0xF8, 0xFF, 0xFA, 0xFF, 0x05, 0x00,
-	0x19, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x28, 0x00, 0x31, 0x00, 0x39, 0x00,
-	0x39, 0x00, 0x3B, 0x00, 0x43, 0x00, 0x46, 0x00, 0x44, 0x00, 0x4D, 0x00,
-	0x4C, 0x00, 0x43, 0x00, 0x30, 0x00, 0x3E, 0x00, 0x36, 0x00, 0x37, 0x00,
-	0x2C, 0x00, 0x2C, 0x00, 0x27, 0x00, 0x21, 0x00, 0x21, 0x00, 0x1C, 0x00,
-	0x10, 0x00, 0x0D, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFB, 0xFF,
-	0xF3, 0xFF, 0xF2, 0xFF, 0xEE, 0xFF, 0xED, 0xFF, 0xF2, 0xFF, 0xE6, 0xFF,
-	0xEC, 0xFF, 0xE1, 0xFF, 0xE2, 0xFF, 0xDF, 0xFF, 0xEC, 0xFF, 0xF2, 0xFF,
-	0xF1, 0xFF, 0xED, 0xFF, 0xF1, 0xFF, 0xF6, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0xFD, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x0A, 0x00, 0x09, 0x00, 0x12, 0x00,
-	0x09, 0x00, 0x18, 0x00, 0x1A, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x04, 0x00,
-	0x0B, 0x00, 0x0D, 0x00, 0x1D, 0x00, 0x17, 0x00, 0x0F, 0x00, 0x0B, 0x00,
-	0x04, 0x00, 0x08, 0x00, 0x04, 0x00, 0x03, 0x00, 0x08, 0x00, 0xFF, 0xFF,
-	0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x04, 0x00, 0x05, 0x00,
-	0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0xFF, 0x04, 0x00, 0x00, 0x00,
-	0x04, 0x00, 0x04, 0x00, 0x03, 0x00, 0x12, 0x00, 0x15, 0x00, 0x0E, 0x00,
-	0x0E, 0x00, 0x18, 0x00, 0x0B, 0x00, 0x12, 0x00, 0x10, 0x00, 0x12, 0x00,
-	0x1E, 0x00, 0x0D, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x06, 0x00,
-	0xFB, 0xFF, 0xDC, 0xFF, 0xE7, 0xFF, 0xEB, 0xFF, 0xE1, 0xFF, 0xE2, 0xFF,
-	0xE3, 0xFF, 0xCE, 0xFF, 0xD5, 0xFF, 0xCB, 0xFF, 0xC0, 0xFF, 0xC1, 0xFF,
-	0xC2, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 0xC2, 0xFF, 0xBB, 0xFF, 0xBC, 0xFF,
-	0xC5, 0xFF, 0xCB, 0xFF, 0xC4, 0xFF, 0xC4, 0xFF, 0xCC, 0xFF, 0xC9, 0xFF,
-	0xCA, 0xFF, 0xD4, 0xFF, 0xD9, 0xFF, 0xD8, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF,
-	0xF3, 0xFF, 0xF6, 0xFF, 0xF5, 0xFF, 0xF0, 0xFF, 0xF8, 0xFF, 0x10, 0x00,
-	0x14, 0x00, 0x12, 0x00, 0x0D, 0x00, 0x1A, 0x00, 0x0E, 0x00, 0x18, 0x00,
-	0x13, 0x00, 0x14, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x12, 0x00, 0x10, 0x00,
-	0x0A, 0x00, 0x06, 0x00, 0x04, 0x00, 0xFF, 0xFF, 0xF7, 0xFF, 0xF1, 0xFF,
-	0xF1, 0xFF, 0xED, 0xFF, 0xE2, 0xFF, 0xDC, 0xFF, 0xDF, 0xFF, 0xD9, 0xFF,
-	0xD1, 0xFF, 0xC7, 0xFF, 0xCB, 0xFF, 0xC7, 0xFF, 0xBA, 0xFF, 0xB5, 0xFF,
-	0xC4, 0xFF, 0xB7, 0xFF, 0xC0, 0xFF, 0xC5, 0xFF, 0xBF, 0xFF, 0xCC, 0xFF,
-	0xC4, 0xFF, 0xD3, 0xFF, 0xC4, 0xFF, 0xDA, 0xFF, 0xDF, 0xFF, 0xE6, 0xFF,
-	0xE7, 0xFF, 0xE6, 0xFF, 0xF0, 0xFF, 0xF8, 0xFF, 0x04, 0x00, 0xFD, 0xFF,
-	0x0E, 0x00, 0x12, 0x00, 0x18, 0x00, 0x22, 0x00, 0x1A, 0x00, 0x28, 0x00,
-	0x36, 0x00, 0x46, 0x00, 0x49, 0x00, 0x53, 0x00, 0x54, 0x00, 0x4D, 0x00,
-	0x63, 0x00, 0x61, 0x00, 0x5C, 0x00, 0x66, 0x00, 0x63, 0x00, 0x68, 0x00,
-	0x5E, 0x00, 0x5D, 0x00, 0x62, 0x00, 0x62, 0x00, 0x53, 0x00, 0x54, 0x00,
-	0x46, 0x00, 0x43, 0x00, 0x3B, 0x00, 0x3B, 0x00, 0x30, 0x00, 0x32, 0x00,
-	0x22, 0x00, 0x29, 0x00, 0x27, 0x00, 0x22, 0x00, 0x1E, 0x00, 0x17, 0x00,
-	0x14, 0x00, 0x18, 0x00, 0x1F, 0x00, 0x19, 0x00, 0x14, 0x00, 0x15, 0x00,
-	0x1D, 0x00, 0x15, 0x00, 0x14, 0x00, 0x15, 0x00, 0x23, 0x00, 0x24, 0x00,
-	0x28, 0x00, 0x26, 0x00, 0x1D, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x36, 0x00,
-	0x3F, 0x00, 0x32, 0x00, 0x35, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3F, 0x00,
-	0x3C, 0x00, 0x3C, 0x00, 0x37, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x30, 0x00,
-	0x36, 0x00, 0x1C, 0x00, 0x2B, 0x00, 0x18, 0x00, 0x1D, 0x00, 0x10, 0x00,
-	0x06, 0x00, 0x05, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-	0xFA, 0xFF, 0xF1, 0xFF, 0xF2, 0xFF, 0xE8, 0xFF, 0xEB, 0xFF, 0xE8, 0xFF,
-	0xEB, 0xFF, 0xFA, 0xFF, 0xF5, 0xFF, 0xF3, 0xFF, 0xFC, 0xFF, 0xF5, 0xFF,
-	0xFC, 0xFF, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x49, 0x53, 0x54, 0x14, 0x00,
-	0x00, 0x00, 0x49, 0x4E, 0x46, 0x4F, 0x49, 0x4E, 0x41, 0x4D, 0x08, 0x00,
-	0x00, 0x00, 0x32, 0x33, 0x36, 0x38, 0x37, 0x32, 0x39, 0x00
-};
@@ -0,0 +1,3361 @@
+/* Generated by tools/VoiceAdpcmEncoder from ptbl_voice_sync.c
+   IMA-ADPCM, 80441 samples at 44100 Hz, 40221 bytes (PCM 160882 bytes) */
+
+#include "VoicePrompt.h"
+
+static const uint8_t s_voicePromptSyncData[40221] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+	0x2B, 0x11, 0x00, 0x7A, 0x91, 0x28, 0x0F, 0x10, 0x00, 0x19, 0xB2, 0x30,
+	0xB0, 0xB3, 0x16, 0xD2, 0x80, 0x01, 0x0B, 0x13, 0xD0, 0x20, 0x90, 0x22,
+	0x0B, 0x73, 0x01, 0x1D, 0xB1, 0x23, 0x93, 0x02, 0xB8, 0xF2, 0x03, 0xB3,
+	0xA4, 0x99, 0xA5, 0xF0, 0xA3, 0x10, 0x2A, 0x0B, 0xB3, 0x4B, 0xD1, 0xA3,
+	0xA0, 0xCB, 0x95, 0x29, 0x08, 0x6B, 0x18, 0xB1, 0xD4, 0x12, 0x6A, 0x2A,
+	0x08, 0xA9, 0x84, 0x2A, 0xB1, 0x20, 0xB0, 0xD1, 0x02, 0x3E, 0x0B, 0xF8,
+	0x11, 0x09, 0x09, 0xA0, 0x3A, 0xB3, 0x39, 0x0A, 0x29, 0x41, 0x3B, 0x9B,
+	0x85, 0x7B, 0x2A, 0x80, 0x8D, 0xC2, 0x30, 0x2C, 0x81, 0xE8, 0xA0, 0xB4,
+	0xB2, 0x01, 0x4A, 0x88, 0xA8, 0x39, 0x00, 0x2D, 0xB2, 0x06, 0x12, 0x29,
+	0x8F, 0x82, 0x1A, 0x3A, 0x02, 0x1C, 0x95, 0xCA, 0x12, 0x19, 0x2A, 0x0E,
+	0x20, 0xB1, 0x9A, 0x1A, 0x6D, 0x09, 0xC1, 0x11, 0x1A, 0x3A, 0x9B, 0x24,
+	0x8A, 0xB9, 0x1B, 0x15, 0xB8, 0xD9, 0xC1, 0x32, 0x1D, 0x40, 0x2B, 0x39,
+	0x3A, 0x4D, 0x1B, 0x80, 0xAA, 0x87, 0xA9, 0x85, 0x19, 0xC1, 0x81, 0xA8,
+	0x2B, 0x30, 0x00, 0xBB, 0x6D, 0x99, 0x88, 0xB1, 0x92, 0x6A, 0x0A, 0xA2,
+	0xA4, 0xC2, 0x92, 0xA3, 0xD3, 0x11, 0xAB, 0x17, 0x9C, 0x01, 0x2A, 0x01,
+	0xA3, 0xC7, 0x82, 0x1B, 0x89, 0x00, 0x29, 0x31, 0x1F, 0x82, 0x91, 0x29,
+	0xF0, 0x01, 0x49, 0xF3, 0x11, 0x00, 0x10, 0x1B, 0xB0, 0xB3, 0x96, 0xC8,
+	0x90, 0x11, 0x00, 0x3C, 0x91, 0x18, 0xB3, 0xF3, 0xA2, 0x18, 0x0A, 0x21,
+	0x20, 0x97, 0x10, 0x20, 0x39, 0xBA, 0x53, 0xF0, 0x92, 0x18, 0x08, 0xAB,
+	0xA7, 0x81, 0x81, 0xF2, 0x92, 0x00, 0x92, 0x92, 0x21, 0x0C, 0x30, 0x3D,
+	0x19, 0xB8, 0x41, 0x2E, 0xD1, 0x82, 0xA0, 0xB0, 0x29, 0x81, 0x69, 0x2C,
+	0x49, 0x09, 0x01, 0xB2, 0x21, 0x53, 0x8B, 0x02, 0x04, 0x68, 0x09, 0x09,
+	0x20, 0x0F, 0x08, 0x12, 0x22, 0xBB, 0x0B, 0x53, 0x99, 0xB0, 0x70, 0x39,
+	0x18, 0x8B, 0xE4, 0x91, 0x10, 0xA8, 0xD1, 0x10, 0x1A, 0xB5, 0x99, 0x81,
+	0x02, 0x15, 0x49, 0x9B, 0x93, 0x59, 0x0B, 0x2C, 0x03, 0xB1, 0x1B, 0xE9,
+	0x02, 0x3A, 0x1C, 0xD3, 0x91, 0x1A, 0xD5, 0x00, 0x4D, 0x88, 0x09, 0x28,
+	0x0A, 0xB8, 0x9A, 0x97, 0x81, 0x5B, 0x3B, 0x29, 0x00, 0x1D, 0xB2, 0x59,
+	0x0B, 0x1C, 0xA0, 0x10, 0x01, 0x1F, 0xA1, 0x3B, 0x4B, 0xE0, 0x11, 0x90,
+	0x1B, 0x2B, 0x58, 0x1B, 0x1A, 0x31, 0x2B, 0x3B, 0xF9, 0x22, 0x80, 0x9A,
+	0x4F, 0x89, 0x19, 0x92, 0x8A, 0xC1, 0xA1, 0xB2, 0x6C, 0x89, 0x1D, 0x19,
+	0xA0, 0xA0, 0x3B, 0x3B, 0x2D, 0x01, 0x99, 0x1B, 0x02, 0xC1, 0x17, 0x2A,
+	0x1A, 0x4A, 0x09, 0x9B, 0x11, 0x40, 0xE2, 0x19, 0xDB, 0x82, 0x1B, 0x80,
+	0x02, 0x9B, 0x97, 0x91, 0x91, 0x2D, 0x01, 0x5A, 0x1D, 0x89, 0xB3, 0xB1,
+	0xC3, 0x68, 0x8A, 0xB2, 0x94, 0xB1, 0xB0, 0xA5, 0xA8, 0x29, 0x20, 0x4B,
+	0x2C, 0x1A, 0x32, 0x0B, 0x91, 0xC1, 0xA8, 0x27, 0x3B, 0xB1, 0x80, 0x92,
+	0x0B, 0xB3, 0x86, 0xB5, 0x29, 0x98, 0x51, 0x9A, 0x86, 0x98, 0x92, 0x89,
+	0x20, 0xF9, 0x21, 0x29, 0xB8, 0x04, 0x2D, 0x0C, 0x38, 0x2A, 0x5A, 0x4A,
+	0x3A, 0x2C, 0xC8, 0x91, 0x21, 0xC9, 0x92, 0x4B, 0x1E, 0x82, 0xA9, 0x93,
+	0x00, 0x39, 0xF1, 0x11, 0xA8, 0x13, 0x4A, 0xB5, 0x91, 0xC1, 0x22, 0x03,
+	0x3B, 0xAB, 0xA7, 0x32, 0x0B, 0x60, 0x1A, 0x09, 0xAA, 0x87, 0x20, 0xAB,
+	0x18, 0x99, 0x13, 0xB9, 0xA7, 0x12, 0x0C, 0x82, 0x2D, 0xC1, 0x42, 0x19,
+	0x09, 0x08, 0x1B, 0x86, 0x93, 0xAA, 0xC3, 0x23, 0xF2, 0x03, 0x28, 0x3B,
+	0xB3, 0xC4, 0x11, 0xA1, 0x39, 0x4F, 0x3B, 0x1A, 0x1B, 0xB1, 0x05, 0xC1,
+	0x84, 0xE3, 0x84, 0x90, 0x98, 0x92, 0x91, 0x91, 0x92, 0xC1, 0xA3, 0x23,
+	0x1B, 0x15, 0xEB, 0x80, 0x91, 0xC2, 0x30, 0x01, 0xD0, 0x41, 0x39, 0x6A,
+	0x1A, 0x92, 0x08, 0x02, 0x1E, 0x00, 0x99, 0x01, 0x1B, 0xFB, 0x01, 0x09,
+	0x94, 0xB1, 0x14, 0xC2, 0x93, 0x1C, 0x94, 0x0A, 0xB3, 0x20, 0xF3, 0x10,
+	0x08, 0xB1, 0x28, 0x8F, 0xB1, 0x18, 0x39, 0xA4, 0xFA, 0x01, 0x4B, 0x0A,
+	0x10, 0x9B, 0xE0, 0xB3, 0x69, 0x2A, 0x4A, 0x1C, 0x09, 0x4A, 0x09, 0x88,
+	0x90, 0x23, 0xD1, 0x11, 0xAB, 0x51, 0x19, 0x18, 0xAA, 0xD0, 0x92, 0x04,
+	0xBC, 0x82, 0x91, 0x9B, 0x30, 0xD3, 0x99, 0x78, 0x98, 0xA9, 0x91, 0x4C,
+	0x90, 0xB2, 0x2A, 0x2B, 0x93, 0xB1, 0xF3, 0x19, 0x0A, 0x94, 0xBA, 0x00,
+	0x5E, 0x80, 0x1A, 0xA4, 0xB0, 0xB3, 0x91, 0xE9, 0x95, 0x90, 0x10, 0xA3,
+	0x11, 0x3F, 0x1A, 0x29, 0xF3, 0x00, 0x03, 0x0B, 0xA9, 0xB3, 0x02, 0xCB,
+	0x8B, 0x87, 0x9B, 0x59, 0x12, 0x8D, 0x59, 0xB8, 0xB2, 0x11, 0x21, 0x99,
+	0x0C, 0x3A, 0x73, 0x9A, 0x91, 0x01, 0xA0, 0x45, 0xB1, 0x2C, 0x99, 0x15,
+	0x01, 0x9B, 0xBC, 0x12, 0x07, 0x98, 0x29, 0x89, 0xD2, 0x3A, 0x7A, 0x10,
+	0x90, 0xAA, 0x13, 0x71, 0xA1, 0x02, 0x06, 0x5B, 0x0B, 0x13, 0x53, 0x46,
+	0x24, 0x77, 0x77, 0xB5, 0xBC, 0x09, 0x33, 0x24, 0xB9, 0xAD, 0x20, 0x22,
+	0x81, 0xBA, 0x8A, 0x43, 0x01, 0x99, 0x9A, 0x48, 0x77, 0x11, 0x10, 0xA8,
+	0xBD, 0x8A, 0x11, 0xA0, 0xA9, 0x9A, 0x53, 0x02, 0xAD, 0x18, 0x99, 0x1A,
+	0x14, 0xCB, 0x08, 0xCA, 0x68, 0x13, 0xA9, 0x89, 0x10, 0x22, 0xC0, 0xBE,
+	0x1A, 0xA1, 0x8A, 0xA0, 0x40, 0x91, 0x8D, 0x62, 0x34, 0x92, 0xBC, 0x29,
+	0x12, 0xA8, 0x89, 0xAE, 0x33, 0x09, 0x74, 0x83, 0xA9, 0x9C, 0x20, 0x25,
+	0xBA, 0x19, 0xC8, 0x28, 0x11, 0x00, 0xB0, 0xBC, 0x71, 0x06, 0xB9, 0x28,
+	0x44, 0xB2, 0xAD, 0x89, 0x32, 0x90, 0xCD, 0x48, 0x02, 0x89, 0x80, 0x10,
+	0x81, 0xCD, 0x28, 0x24, 0xCA, 0x8B, 0x01, 0x30, 0x82, 0x28, 0x11, 0x33,
+	0x23, 0x08, 0xF8, 0xAF, 0x01, 0x00, 0x10, 0x21, 0x01, 0x13, 0x31, 0x57,
+	0x22, 0xB9, 0x8A, 0x29, 0x05, 0x9A, 0xC9, 0x3A, 0x26, 0x02, 0x21, 0x93,
+	0x8C, 0x80, 0xCB, 0x30, 0xE1, 0xAC, 0xAA, 0x20, 0x24, 0xB0, 0xAE, 0x31,
+	0x25, 0x99, 0xCA, 0xAD, 0x08, 0x98, 0xAB, 0xA8, 0xBE, 0x08, 0x00, 0x18,
+	0x02, 0xEF, 0x89, 0x00, 0x98, 0xBA, 0xCD, 0x8A, 0x88, 0x00, 0xCA, 0x9A,
+	0xBA, 0x8C, 0x00, 0xCA, 0xFB, 0xBB, 0x8A, 0xA0, 0x8A, 0xF8, 0xAD, 0x00,
+	0x88, 0x00, 0xD9, 0x9C, 0x01, 0x0A, 0x76, 0x33, 0x53, 0x23, 0x11, 0x42,
+	0xA0, 0x38, 0x82, 0x39, 0x27, 0x10, 0x35, 0x81, 0x42, 0x33, 0x42, 0x33,
+	0x11, 0x12, 0xBA, 0xCC, 0x9A, 0x89, 0x00, 0x11, 0x45, 0x01, 0x28, 0xD9,
+	0xBD, 0xCB, 0xBB, 0xBD, 0xCB, 0xAC, 0xAA, 0xBB, 0x89, 0x99, 0x09, 0x91,
+	0xAC, 0x00, 0xFD, 0xBA, 0xBA, 0x8A, 0x99, 0x38, 0x24, 0x44, 0x35, 0x23,
+	0x42, 0x43, 0x01, 0x73, 0x34, 0x33, 0x84, 0x99, 0x23, 0x08, 0x47, 0x82,
+	0x28, 0x13, 0x19, 0x44, 0x91, 0xA9, 0xBA, 0x9C, 0x81, 0xDB, 0xDB, 0xDB,
+	0x9A, 0x80, 0x98, 0xBA, 0xBC, 0xAD, 0x99, 0xCA, 0xCB, 0xBC, 0xBB, 0x99,
+	0x99, 0xA9, 0xCC, 0xAA, 0x8A, 0x11, 0xB8, 0xCD, 0xCD, 0x9A, 0xA9, 0x9A,
+	0xCB, 0xAC, 0xBA, 0x9D, 0x20, 0x82, 0x80, 0x90, 0xBA, 0x90, 0x99, 0xEC,
+	0xEB, 0xCB, 0x1A, 0x74, 0x47, 0x13, 0x11, 0x13, 0x8A, 0x53, 0x81, 0x29,
+	0xA2, 0x0B, 0x34, 0x21, 0x26, 0xA8, 0x50, 0x24, 0x41, 0x33, 0xC8, 0x9B,
+	0xA9, 0x9A, 0x80, 0xBB, 0x9B, 0x8A, 0x64, 0x02, 0x9A, 0xCA, 0xAE, 0x08,
+	0x98, 0xDB, 0xCC, 0xCB, 0x9A, 0x88, 0x00, 0x89, 0x00, 0x11, 0x24, 0x02,
+	0xAA, 0xBD, 0x0A, 0x90, 0x29, 0x27, 0x9A, 0x63, 0x33, 0x54, 0x24, 0x22,
+	0x33, 0x23, 0x33, 0x01, 0x90, 0x08, 0x19, 0x75, 0x34, 0x42, 0x22, 0x42,
+	0x81, 0x20, 0xB2, 0xAD, 0xA8, 0xCF, 0x99, 0xC9, 0x9A, 0xA9, 0x9B, 0x80,
+	0xA9, 0x09, 0xFA, 0x9D, 0xB9, 0xCB, 0x99, 0xBA, 0x89, 0xA9, 0x8B, 0x11,
+	0x18, 0x44, 0x80, 0x30, 0x83, 0xBB, 0xDA, 0xCF, 0x9A, 0xCA, 0x99, 0xB9,
+	0xAC, 0xCB, 0xBD, 0xCC, 0xBB, 0x89, 0xA9, 0xCA, 0xAB, 0xDA, 0xBD, 0x98,
+	0xCB, 0x19, 0x90, 0x74, 0x25, 0x34, 0x13, 0x22, 0x22, 0x31, 0x34, 0x12,
+	0x22, 0x02, 0x64, 0x12, 0x41, 0x23, 0x31, 0x37, 0x23, 0x43, 0x82, 0x9A,
+	0xA8, 0x9C, 0x80, 0xCA, 0x99, 0xCA, 0x99, 0xA8, 0xBB, 0xDB, 0xDB, 0xAA,
+	0xBA, 0xBE, 0xCC, 0xBC, 0xCB, 0xAB, 0x99, 0x9A, 0x89, 0x8A, 0x20, 0x90,
+	0x50, 0x82, 0x48, 0x14, 0x21, 0x16, 0x10, 0x33, 0x22, 0x66, 0x22, 0x63,
+	0x33, 0x32, 0x43, 0x12, 0x22, 0x12, 0x21, 0x34, 0x53, 0x24, 0x21, 0x05,
+	0xAA, 0x22, 0xC9, 0x20, 0xD9, 0xAB, 0xEC, 0xAB, 0xDA, 0xAC, 0x99, 0xCB,
+	0x89, 0xA8, 0xAA, 0xAA, 0xCB, 0x9A, 0xA9, 0x10, 0xE9, 0x0A, 0xB8, 0x9D,
+	0x00, 0x9A, 0x21, 0x01, 0x42, 0x22, 0x21, 0xC9, 0xBD, 0xBB, 0xDC, 0xBC,
+	0xDB, 0xDD, 0xBB, 0x9A, 0x99, 0x08, 0xB9, 0x9C, 0xB9, 0xAD, 0x08, 0xA8,
+	0x50, 0x64, 0x45, 0x23, 0x22, 0x12, 0x08, 0x44, 0x12, 0x53, 0x02, 0x88,
+	0x32, 0x22, 0x32, 0x23, 0x63, 0x34, 0x63, 0x33, 0x88, 0x98, 0xCB, 0x1A,
+	0x88, 0x99, 0xDA, 0xAC, 0xBB, 0xBC, 0x98, 0xDB, 0x9C, 0x98, 0xAA, 0xAA,
+	0xCC, 0xBE, 0xBB, 0x9C, 0x99, 0x09, 0x99, 0x99, 0x99, 0x18, 0x42, 0x45,
+	0x22, 0x32, 0x45, 0x23, 0x22, 0x22, 0x22, 0x53, 0x36, 0x44, 0x43, 0x22,
+	0x12, 0x32, 0x43, 0x33, 0x73, 0x35, 0x01, 0x08, 0xA0, 0xBD, 0x18, 0xC9,
+	0x8A, 0xD9, 0xBB, 0xCA, 0x9B, 0xCA, 0xAD, 0x88, 0x98, 0x09, 0xB8, 0xDD,
+	0xBB, 0xAA, 0x98, 0x80, 0x08, 0xB9, 0x0B, 0x01, 0x08, 0x73, 0x12, 0x00,
+	0x43, 0x13, 0xA8, 0xDB, 0xBF, 0xAA, 0x9A, 0x02, 0xCE, 0xAA, 0xCD, 0xAB,
+	0xA9, 0xBB, 0x98, 0xDB, 0xAC, 0xBA, 0xAD, 0x98, 0x1B, 0x57, 0x34, 0x24,
+	0x33, 0x00, 0x31, 0x22, 0x44, 0x22, 0x01, 0x01, 0x20, 0x51, 0x82, 0x28,
+	0x16, 0x52, 0x44, 0x22, 0x01, 0x98, 0xA9, 0x98, 0x88, 0xC8, 0xAD, 0xBC,
+	0xAC, 0xAA, 0x9A, 0xAC, 0xAA, 0x99, 0x01, 0x98, 0xDB, 0xCE, 0xCB, 0x9A,
+	0x9A, 0x8A, 0xA9, 0xAC, 0x98, 0x89, 0x73, 0x12, 0x52, 0x23, 0x53, 0x33,
+	0x23, 0x12, 0x11, 0x33, 0x73, 0x35, 0x13, 0x42, 0x01, 0x41, 0x24, 0x65,
+	0x23, 0x80, 0x11, 0xBB, 0x30, 0xD0, 0x8A, 0xEB, 0x9C, 0xB9, 0x8A, 0xB9,
+	0xCD, 0x99, 0x89, 0x18, 0x01, 0xBA, 0xBE, 0xBB, 0x98, 0xA9, 0xA9, 0xDC,
+	0x9B, 0x88, 0x09, 0x32, 0x82, 0x9A, 0x73, 0x43, 0x33, 0x91, 0xDB, 0xCC,
+	0x8A, 0xA0, 0xCC, 0xEB, 0xAC, 0xAA, 0x99, 0x88, 0xA9, 0xB9, 0xBE, 0x19,
+	0x89, 0x50, 0x54, 0x45, 0x22, 0x33, 0x82, 0x40, 0x03, 0x41, 0x14, 0x08,
+	0x02, 0x09, 0x34, 0xB9, 0x51, 0x81, 0x73, 0x33, 0x33, 0x01, 0x9A, 0x88,
+	0xA9, 0x20, 0xFA, 0x9E, 0xBA, 0xAC, 0xA9, 0xAA, 0xAC, 0x9B, 0x18, 0x00,
+	0x98, 0xC9, 0xCC, 0xAC, 0x88, 0xBA, 0x89, 0xFA, 0x8A, 0x98, 0x09, 0x23,
+	0x42, 0x26, 0x43, 0x44, 0x23, 0x22, 0x23, 0x02, 0x52, 0x33, 0x44, 0x12,
+	0x20, 0x81, 0x70, 0x27, 0x11, 0x22, 0x98, 0x28, 0x13, 0x00, 0xC1, 0xBE,
+	0xDB, 0xAB, 0x99, 0xEB, 0xBB, 0xCB, 0x9A, 0x89, 0x88, 0xBA, 0xAD, 0x99,
+	0x08, 0x00, 0xA8, 0xAF, 0xAA, 0xAB, 0x28, 0x02, 0xCA, 0xCB, 0x8B, 0x52,
+	0x22, 0x82, 0xCA, 0x9D, 0x08, 0xD9, 0xCB, 0xEC, 0xAC, 0x9A, 0xA9, 0x99,
+	0xAA, 0xDC, 0x9B, 0x08, 0x40, 0x67, 0x32, 0x32, 0x22, 0x21, 0x33, 0x42,
+	0x24, 0x00, 0x88, 0x89, 0x08, 0x10, 0xCB, 0x9A, 0x51, 0x55, 0x44, 0x02,
+	0x00, 0x09, 0x00, 0x20, 0x80, 0xEB, 0xBC, 0xAD, 0xAB, 0xBA, 0xBC, 0xBA,
+	0xAB, 0x20, 0x13, 0x11, 0x91, 0xCB, 0x40, 0x23, 0x11, 0xA0, 0xDE, 0xAB,
+	0xAB, 0x0A, 0x02, 0x09, 0x56, 0x32, 0x47, 0x23, 0x22, 0x23, 0x22, 0x44,
+	0x23, 0x22, 0x90, 0x9A, 0x21, 0x22, 0x57, 0x82, 0x18, 0x13, 0x20, 0x36,
+	0x98, 0xB9, 0xBE, 0x9B, 0xEA, 0xAB, 0xDC, 0xAC, 0xAA, 0x9A, 0x99, 0xAA,
+	0x9A, 0xBA, 0x29, 0x13, 0x18, 0x92, 0xBE, 0x18, 0x91, 0x9A, 0xFC, 0xAD,
+	0xAB, 0x9A, 0x98, 0xAB, 0xCC, 0xAB, 0xCC, 0x8A, 0xB9, 0xAC, 0xBA, 0xAE,
+	0x98, 0xCB, 0x9C, 0x99, 0x39, 0x77, 0x16, 0x22, 0x22, 0x20, 0x23, 0x33,
+	0x26, 0x82, 0x01, 0x98, 0x08, 0x91, 0xCB, 0xAA, 0x9B, 0x61, 0x43, 0x23,
+	0xA0, 0x19, 0x21, 0x50, 0x24, 0xB9, 0xCC, 0xCD, 0xAA, 0xCB, 0xBA, 0xCC,
+	0xAB, 0x88, 0x98, 0x00, 0x81, 0x99, 0x62, 0x43, 0x43, 0x22, 0x10, 0x90,
+	0x09, 0x01, 0x81, 0x88, 0x9A, 0x30, 0x67, 0x24, 0x21, 0x25, 0x21, 0x46,
+	0x23, 0x24, 0x12, 0x80, 0x00, 0x19, 0x22, 0xA0, 0xEB, 0xCC, 0x9A, 0xA9,
+	0x99, 0xBC, 0x9C, 0xAA, 0x08, 0x80, 0xCC, 0xBD, 0xBB, 0xAB, 0xA8, 0xDA,
+	0xBD, 0xBD, 0x9A, 0x98, 0x88, 0xA8, 0xAA, 0x08, 0x21, 0x23, 0x02, 0xEC,
+	0xBA, 0xBB, 0x9B, 0xFC, 0xCC, 0xCC, 0xAD, 0x89, 0xA9, 0x99, 0xCA, 0x9B,
+	0x98, 0x38, 0x26, 0x73, 0x35, 0x32, 0x44, 0x11, 0x32, 0x11, 0x42, 0x03,
+	0x20, 0x90, 0x9C, 0x90, 0xAB, 0x99, 0xAA, 0x30, 0x44, 0x35, 0x01, 0x10,
+	0x11, 0x11, 0x22, 0xA1, 0xFF, 0xBA, 0xBD, 0xAC, 0xBB, 0xCB, 0xBB, 0x9A,
+	0x99, 0x89, 0x00, 0x18, 0x54, 0x43, 0x24, 0x33, 0x23, 0x22, 0x00, 0x01,
+	0x88, 0x21, 0x90, 0x32, 0x33, 0x67, 0x33, 0x73, 0x43, 0x32, 0x25, 0x32,
+	0x23, 0x42, 0x34, 0x12, 0x42, 0x90, 0x9A, 0xD9, 0xAB, 0xC9, 0xBC, 0xCC,
+	0xAC, 0xAA, 0xCB, 0x9A, 0xBB, 0xAB, 0xB9, 0x88, 0xCA, 0xBB, 0xBC, 0xBC,
+	0x89, 0xB8, 0xDB, 0xDC, 0xBB, 0x9A, 0x9A, 0xBA, 0xDC, 0xBB, 0xDB, 0xAA,
+	0xCA, 0xBE, 0xBC, 0xAA, 0xAA, 0xAC, 0xA8, 0xBE, 0x09, 0x08, 0x65, 0x53,
+	0x43, 0x32, 0x43, 0x32, 0x43, 0x23, 0x43, 0x02, 0x20, 0x90, 0x8A, 0xB0,
+	0xAE, 0xAA, 0x9B, 0x10, 0x28, 0x02, 0xAC, 0x18, 0x20, 0x64, 0x12, 0x99,
+	0xFB, 0xAC, 0xBA, 0xBD, 0xCB, 0xDB, 0xBA, 0x99, 0x9A, 0x99, 0x9A, 0x08,
+	0x53, 0x54, 0x33, 0x43, 0x22, 0x22, 0x25, 0x31, 0x22, 0x80, 0x80, 0x88,
+	0x20, 0x90, 0x28, 0x34, 0x57, 0x24, 0x24, 0x23, 0x32, 0x53, 0x22, 0x33,
+	0xA0, 0xAB, 0xEC, 0xAC, 0xB9, 0xAD, 0xCB, 0xAB, 0x9B, 0xAB, 0x9A, 0xAA,
+	0x9A, 0x88, 0x21, 0x02, 0x98, 0xCF, 0xBB, 0xBC, 0xCB, 0xBC, 0xCC, 0xDB,
+	0xAA, 0xAA, 0xAA, 0xBA, 0xAD, 0x9A, 0xAA, 0xCB, 0xCC, 0xBC, 0xAC, 0xCB,
+	0x9A, 0xBB, 0xBB, 0x99, 0x70, 0x57, 0x32, 0x43, 0x32, 0x33, 0x35, 0x34,
+	0x33, 0x12, 0x02, 0x00, 0x00, 0xB0, 0xDA, 0xBC, 0xAB, 0x89, 0x89, 0xC0,
+	0xBC, 0x09, 0x10, 0x44, 0x13, 0x88, 0xCA, 0xAD, 0xB9, 0xCC, 0xCB, 0xCD,
+	0xAA, 0xAB, 0xAA, 0xAA, 0xBB, 0x8A, 0x30, 0x37, 0x34, 0x34, 0x33, 0x24,
+	0x44, 0x32, 0x32, 0x02, 0x01, 0x08, 0x18, 0x98, 0xAA, 0x98, 0xAB, 0x44,
+	0x55, 0x35, 0x52, 0x25, 0x12, 0x21, 0x81, 0x10, 0xA0, 0xBA, 0xFC, 0xAC,
+	0xCB, 0xAC, 0xAB, 0xAC, 0xA9, 0xA9, 0x08, 0x09, 0x10, 0x00, 0x31, 0x34,
+	0x31, 0x81, 0xBC, 0xCD, 0xCD, 0xCB, 0xBB, 0xBC, 0xBC, 0xAC, 0xCB, 0xCA,
+	0xAA, 0x99, 0xAA, 0x08, 0x88, 0x20, 0x45, 0x73, 0x35, 0x33, 0x44, 0x22,
+	0x32, 0x33, 0x34, 0x33, 0x11, 0x11, 0x09, 0x88, 0xBA, 0xC9, 0xCC, 0x89,
+	0x80, 0x28, 0xB2, 0x9E, 0x91, 0x0B, 0x23, 0xA8, 0xCB, 0xEF, 0xBB, 0xCA,
+	0xAB, 0xCB, 0xBC, 0xCA, 0x9A, 0x99, 0x89, 0x88, 0x10, 0x63, 0x43, 0x44,
+	0x22, 0x33, 0x32, 0x34, 0x34, 0x23, 0x12, 0x10, 0x90, 0x41, 0x15, 0x33,
+	0x83, 0x30, 0x34, 0x74, 0x43, 0x11, 0x02, 0x9A, 0x11, 0xA8, 0xB9, 0xFF,
+	0xAA, 0xAB, 0x9B, 0xBB, 0xAD, 0xCB, 0x9A, 0x08, 0x10, 0x00, 0x99, 0x89,
+	0x10, 0x32, 0xB1, 0xFF, 0xBA, 0xBC, 0xBB, 0xBD, 0xDB, 0xAC, 0xBB, 0xAA,
+	0xBB, 0xCD, 0xAA, 0xBB, 0x9B, 0x88, 0x89, 0x21, 0x52, 0x77, 0x33, 0x43,
+	0x33, 0x52, 0x32, 0x24, 0x24, 0x22, 0x11, 0x80, 0x01, 0x98, 0x99, 0xDB,
+	0xAB, 0xA9, 0x9B, 0xB9, 0xAE, 0xA9, 0x9A, 0x21, 0x01, 0x00, 0xFA, 0xAD,
+	0xBA, 0xAC, 0xBB, 0xCD, 0xBB, 0xBD, 0xAA, 0xAA, 0xA9, 0x8A, 0x18, 0x43,
+	0x45, 0x25, 0x43, 0x32, 0x43, 0x34, 0x43, 0x22, 0x11, 0x00, 0x20, 0x01,
+	0x20, 0x83, 0xA9, 0x88, 0x28, 0x47, 0x34, 0x33, 0x81, 0x18, 0x02, 0x08,
+	0xF8, 0xCD, 0xCB, 0xCB, 0xBA, 0xEB, 0xBA, 0xAC, 0x9B, 0x88, 0x88, 0x99,
+	0x9A, 0x88, 0x18, 0x24, 0xA9, 0xDC, 0xBC, 0xBD, 0xCC, 0xBC, 0xCB, 0xBC,
+	0xCB, 0xAC, 0xAB, 0xAC, 0x9B, 0x99, 0x10, 0x33, 0x57, 0x43, 0x43, 0x33,
+	0x34, 0x24, 0x43, 0x23, 0x13, 0x02, 0x00, 0x01, 0xA9, 0xBA, 0xCD, 0xAA,
+	0xAB, 0x9A, 0xAA, 0xCC, 0x09, 0x10, 0x23, 0x11, 0x91, 0xAC, 0xCB, 0xBB,
+	0xCE, 0xCC, 0xBC, 0xDB, 0xBA, 0xBA, 0xBB, 0xAB, 0x9A, 0x28, 0x34, 0x44,
+	0x44, 0x43, 0x43, 0x43, 0x33, 0x24, 0x22, 0x12, 0x11, 0x10, 0x90, 0x99,
+	0xBA, 0xBC, 0x89, 0x72, 0x33, 0x32, 0x22, 0x45, 0x44, 0x23, 0x12, 0xA8,
+	0xAB, 0xBD, 0xCC, 0xEB, 0xDB, 0xBA, 0xBB, 0xAA, 0xBB, 0xBA, 0xBB, 0x09,
+	0x32, 0x34, 0x33, 0x02, 0x80, 0xAA, 0xEA, 0xED, 0xCC, 0xCC, 0xCB, 0xBB,
+	0xBC, 0xBB, 0xBA, 0x9B, 0x19, 0x42, 0x46, 0x34, 0x34, 0x34, 0x43, 0x53,
+	0x32, 0x32, 0x11, 0x11, 0x00, 0x88, 0xB9, 0xDC, 0xBA, 0xAC, 0xAA, 0xAA,
+	0xBA, 0xAB, 0x08, 0x43, 0x53, 0x22, 0x10, 0x10, 0x00, 0x91, 0xEC, 0xCC,
+	0xCC, 0xBB, 0xCB, 0xAC, 0xAB, 0xBB, 0x9A, 0x88, 0x31, 0x44, 0x53, 0x34,
+	0x44, 0x33, 0x34, 0x33, 0x23, 0x22, 0x22, 0x11, 0x81, 0xB9, 0xBC, 0xBD,
+	0x9A, 0x80, 0x98, 0x89, 0x9A, 0x61, 0x53, 0x33, 0x12, 0x90, 0x88, 0xAA,
+	0xD9, 0xCF, 0xCC, 0xBB, 0xBB, 0xAC, 0xCB, 0xCB, 0xAB, 0xA9, 0x08, 0x80,
+	0xA8, 0xB9, 0xBC, 0xA9, 0xCC, 0xDD, 0xBC, 0xCC, 0xAC, 0xBB, 0xBB, 0xAA,
+	0xAA, 0x10, 0x44, 0x45, 0x34, 0x53, 0x33, 0x35, 0x43, 0x33, 0x23, 0x22,
+	0x12, 0x01, 0x01, 0xA9, 0xBC, 0xCD, 0xBA, 0xBB, 0xBB, 0xCB, 0xAB, 0x9A,
+	0x08, 0x12, 0x00, 0x91, 0x0A, 0x03, 0x98, 0xFB, 0xEF, 0xBA, 0xAC, 0xBB,
+	0xCB, 0xBB, 0xAC, 0xAA, 0x09, 0x20, 0x43, 0x44, 0x44, 0x43, 0x34, 0x33,
+	0x24, 0x23, 0x24, 0x22, 0x12, 0x01, 0x98, 0xB9, 0x9A, 0x00, 0x20, 0xA2,
+	0xCD, 0x9B, 0x18, 0x44, 0x13, 0x81, 0xDA, 0xAB, 0xCB, 0xBC, 0xCD, 0xCC,
+	0xBA, 0xBA, 0xCB, 0xBC, 0xBC, 0xBB, 0x9A, 0x99, 0xBA, 0xCD, 0xBC, 0xBB,
+	0xCC, 0xBA, 0xDC, 0xBC, 0xAB, 0xAB, 0x89, 0x9A, 0x30, 0x34, 0x47, 0x34,
+	0x34, 0x34, 0x42, 0x34, 0x42, 0x32, 0x11, 0x12, 0x00, 0x10, 0x98, 0xA9,
+	0xBD, 0xAC, 0xBB, 0xCB, 0xAA, 0xAB, 0xA9, 0x99, 0x01, 0x88, 0x98, 0xBB,
+	0xAA, 0xDC, 0xDB, 0xCD, 0xBD, 0xBC, 0xBB, 0xAC, 0xAB, 0xBB, 0xBB, 0x9A,
+	0x20, 0x45, 0x34, 0x35, 0x34, 0x44, 0x33, 0x33, 0x34, 0x22, 0x43, 0x33,
+	0x23, 0x11, 0xAA, 0xAA, 0x88, 0x08, 0xC8, 0xCF, 0xAB, 0xBB, 0x89, 0x99,
+	0xAB, 0xCB, 0xAB, 0x00, 0xA8, 0xEB, 0xCB, 0xAA, 0x98, 0xB9, 0xEE, 0xBC,
+	0xBC, 0xBB, 0xCB, 0xDB, 0xBC, 0xBD, 0xAC, 0xAC, 0xBA, 0xAC, 0xAB, 0x9B,
+	0x08, 0x11, 0x44, 0x34, 0x45, 0x43, 0x34, 0x43, 0x33, 0x33, 0x24, 0x32,
+	0x21, 0x11, 0x80, 0x99, 0xBA, 0xCC, 0xBB, 0xAC, 0xAB, 0xBB, 0xA9, 0x00,
+	0x10, 0x31, 0x12, 0x35, 0x01, 0x10, 0xFC, 0xCC, 0xDB, 0xCB, 0xCB, 0xAC,
+	0xAC, 0xBB, 0xBA, 0xAA, 0x99, 0x09, 0x31, 0x45, 0x35, 0x34, 0x34, 0x43,
+	0x33, 0x53, 0x32, 0x12, 0x22, 0x01, 0x01, 0xA8, 0x9A, 0xAA, 0xAA, 0xDA,
+	0xAE, 0xBB, 0x9B, 0x09, 0x00, 0x88, 0xBA, 0x9A, 0x89, 0x22, 0xA0, 0xDD,
+	0xBC, 0xCC, 0xDB, 0xCC, 0xCB, 0xCB, 0xBB, 0xCC, 0xCB, 0xDB, 0xCB, 0xBB,
+	0xBC, 0xCB, 0xBB, 0xAA, 0x99, 0x89, 0x12, 0x73, 0x35, 0x53, 0x43, 0x33,
+	0x35, 0x33, 0x53, 0x12, 0x21, 0x02, 0x21, 0x91, 0x9A, 0xC8, 0xAC, 0xA9,
+	0xCB, 0xAA, 0xCB, 0x09, 0x89, 0x28, 0x81, 0x30, 0x13, 0x40, 0x92, 0xDB,
+	0xFB, 0xBC, 0xCB, 0xCC, 0xCB, 0xBB, 0xCB, 0xBB, 0xAA, 0x99, 0x08, 0x41,
+	0x53, 0x34, 0x35, 0x34, 0x34, 0x24, 0x32, 0x23, 0x33, 0x23, 0x32, 0x22,
+	0x80, 0xDA, 0xAB, 0xCB, 0xCB, 0xCA, 0xBC, 0xBB, 0xAD, 0x9A, 0xAA, 0x99,
+	0xA9, 0x88, 0x99, 0x18, 0x99, 0x99, 0xDA, 0xBC, 0xFC, 0xBC, 0xCC, 0xBC,
+	0xCC, 0xBC, 0xBB, 0xBD, 0xBC, 0xAC, 0x9A, 0xA9, 0x08, 0x00, 0x52, 0x34,
+	0x64, 0x33, 0x42, 0x24, 0x33, 0x34, 0x22, 0x22, 0x01, 0x11, 0x80, 0xA9,
+	0xEA, 0xAC, 0xAB, 0xAC, 0xA9, 0xAA, 0x99, 0x99, 0x21, 0x22, 0x54, 0x12,
+	0x32, 0x12, 0x08, 0xC9, 0xCE, 0xDB, 0xBC, 0xCB, 0xCB, 0xBB, 0xBB, 0xCB,
+	0x9A, 0x08, 0x31, 0x35, 0x44, 0x35, 0x53, 0x33, 0x24, 0x33, 0x33, 0x32,
+	0x23, 0x10, 0xA0, 0xBD, 0xAC, 0xBC, 0xBC, 0xBC, 0xAC, 0xBB, 0x9A, 0x89,
+	0x09, 0x00, 0x21, 0x45, 0x33, 0x34, 0x12, 0x10, 0x91, 0x99, 0xFC, 0xCC,
+	0xDB, 0xBB, 0xBC, 0xBD, 0xCB, 0xBB, 0xBC, 0xAA, 0x89, 0x98, 0x11, 0x32,
+	0x56, 0x43, 0x53, 0x14, 0x32, 0x24, 0x22, 0x24, 0x01, 0x02, 0x80, 0x00,
+	0xAA, 0xA9, 0xCD, 0xAB, 0xBA, 0x8A, 0xA9, 0x89, 0x80, 0x30, 0x35, 0x53,
+	0x14, 0x21, 0x01, 0x89, 0xC9, 0xBD, 0xCD, 0xDB, 0xBB, 0xBC, 0xBA, 0xBC,
+	0xBA, 0xAA, 0x08, 0x21, 0x45, 0x34, 0x44, 0x43, 0x43, 0x33, 0x43, 0x23,
+	0x22, 0x32, 0x11, 0x80, 0xDB, 0xBA, 0xBD, 0xAB, 0xBD, 0xCB, 0xDB, 0x99,
+	0x99, 0x08, 0x00, 0x18, 0x22, 0x52, 0x24, 0x21, 0x11, 0x98, 0xA8, 0xCE,
+	0xEB, 0xDB, 0xCB, 0xCB, 0xCB, 0xBB, 0xBC, 0xCB, 0x99, 0x99, 0x18, 0x11,
+	0x63, 0x24, 0x44, 0x24, 0x33, 0x25, 0x22, 0x24, 0x11, 0x12, 0x00, 0x00,
+	0xA9, 0x9A, 0xCC, 0xBA, 0xDB, 0x9A, 0x9A, 0x89, 0x80, 0x11, 0x22, 0x53,
+	0x34, 0x33, 0x13, 0x00, 0xC9, 0xBD, 0xDC, 0xBC, 0xBC, 0xAD, 0xCB, 0xBA,
+	0xBA, 0xAA, 0x99, 0x08, 0x63, 0x43, 0x53, 0x33, 0x35, 0x34, 0x53, 0x22,
+	0x21, 0x12, 0x10, 0x00, 0x98, 0xD9, 0xCC, 0xBB, 0xBB, 0xBC, 0xBB, 0xBB,
+	0xAB, 0x8A, 0x28, 0x42, 0x52, 0x43, 0x43, 0x33, 0x22, 0x82, 0xBA, 0xCE,
+	0xCC, 0xDB, 0xDB, 0xBC, 0xCB, 0xBB, 0xAC, 0x9A, 0x9A, 0x89, 0x18, 0x53,
+	0x34, 0x45, 0x42, 0x33, 0x34, 0x43, 0x22, 0x32, 0x11, 0x21, 0x80, 0x99,
+	0xCB, 0xBD, 0xCA, 0xBB, 0xB9, 0xBA, 0x99, 0x8A, 0x21, 0x53, 0x44, 0x33,
+	0x43, 0x32, 0x11, 0x01, 0xC9, 0xCC, 0xCC, 0xBC, 0xDB, 0xBB, 0xBC, 0xBB,
+	0xBA, 0x99, 0x08, 0x21, 0x52, 0x35, 0x54, 0x33, 0x34, 0x25, 0x32, 0x32,
+	0x12, 0x22, 0x00, 0x98, 0xAC, 0xBC, 0xBD, 0xCC, 0xBA, 0xBB, 0xBB, 0x9A,
+	0x9A, 0x08, 0x10, 0x62, 0x33, 0x34, 0x33, 0x21, 0x91, 0xCA, 0xDC, 0xDD,
+	0xBB, 0xCD, 0xBB, 0xAC, 0xAB, 0xAC, 0x99, 0x8A, 0x20, 0x32, 0x56, 0x32,
+	0x44, 0x33, 0x34, 0x24, 0x32, 0x22, 0x12, 0x02, 0x80, 0xA9, 0xBC, 0xCC,
+	0xBB, 0xBB, 0xAD, 0xA9, 0x9A, 0x80, 0x20, 0x34, 0x43, 0x25, 0x32, 0x33,
+	0x02, 0x01, 0xD9, 0xBC, 0xDC, 0xBC, 0xCB, 0xCB, 0xBA, 0xBB, 0xAA, 0x89,
+	0x00, 0x32, 0x46, 0x44, 0x34, 0x43, 0x33, 0x43, 0x23, 0x22, 0x13, 0x80,
+	0xA8, 0xBE, 0xCA, 0xCC, 0xAA, 0xBC, 0xAB, 0xCA, 0x89, 0x98, 0x18, 0x12,
+	0x51, 0x33, 0x42, 0x14, 0x00, 0x88, 0xBB, 0xDD, 0xDC, 0xBB, 0xCC, 0xBB,
+	0xBB, 0xBB, 0xBB, 0x9A, 0x18, 0x54, 0x53, 0x34, 0x34, 0x35, 0x33, 0x43,
+	0x33, 0x23, 0x23, 0x01, 0x80, 0xC9, 0xAA, 0xDC, 0xBB, 0xCA, 0xBB, 0xAA,
+	0x9A, 0x88, 0x00, 0x44, 0x33, 0x44, 0x22, 0x33, 0x12, 0x01, 0xC8, 0xBD,
+	0xCD, 0xCB, 0xBC, 0xBB, 0xBC, 0xBA, 0xAA, 0x88, 0x18, 0x53, 0x44, 0x34,
+	0x44, 0x43, 0x23, 0x43, 0x22, 0x22, 0x81, 0x00, 0xB8, 0xAC, 0xDC, 0xBB,
+	0xBC, 0xBC, 0xAA, 0xAB, 0x99, 0x9A, 0x11, 0x11, 0x54, 0x12, 0x32, 0x01,
+	0x80, 0xFB, 0xBD, 0xCC, 0xBC, 0xBC, 0xBC, 0xBA, 0xBC, 0xA9, 0x9A, 0x10,
+	0x22, 0x55, 0x33, 0x35, 0x35, 0x43, 0x23, 0x33, 0x43, 0x12, 0x21, 0x00,
+	0x99, 0xB9, 0xBC, 0xAC, 0xBC, 0xAB, 0xBB, 0x8B, 0x88, 0x40, 0x34, 0x52,
+	0x23, 0x31, 0x34, 0x11, 0x81, 0xCD, 0xCB, 0xDC, 0xBA, 0xBC, 0xAC, 0xBB,
+	0xAB, 0x9A, 0x89, 0x31, 0x44, 0x44, 0x43, 0x44, 0x23, 0x33, 0x33, 0x43,
+	0x13, 0x08, 0x90, 0xBC, 0xB9, 0xCE, 0xA9, 0xDB, 0x9A, 0xBA, 0x09, 0x88,
+	0x28, 0x01, 0x41, 0x24, 0x20, 0x03, 0xB9, 0xEA, 0xCF, 0xBB, 0xCD, 0xBA,
+	0xBC, 0xAC, 0xBA, 0xAA, 0x9A, 0x0A, 0x23, 0x63, 0x35, 0x43, 0x44, 0x22,
+	0x34, 0x22, 0x33, 0x23, 0x21, 0x01, 0x88, 0xB9, 0xBB, 0xBD, 0xBB, 0xDB,
+	0xAA, 0x9A, 0x18, 0x22, 0x54, 0x34, 0x32, 0x32, 0x01, 0x32, 0xB8, 0xBC,
+	0xEF, 0xBB, 0xDB, 0xBB, 0xBB, 0xAC, 0xAB, 0xAA, 0x09, 0x20, 0x35, 0x44,
+	0x44, 0x34, 0x42, 0x33, 0x12, 0x33, 0x03, 0x21, 0xB0, 0xAC, 0xFA, 0xAC,
+	0xC9, 0xAA, 0xB9, 0xBA, 0x99, 0x8A, 0x20, 0x10, 0x53, 0x12, 0x11, 0xB8,
+	0xCB, 0xDE, 0xCC, 0xBD, 0xCB, 0xAC, 0xBB, 0xAC, 0xBB, 0xAA, 0x89, 0x10,
+	0x34, 0x35, 0x44, 0x53, 0x43, 0x32, 0x24, 0x32, 0x32, 0x21, 0x11, 0x80,
+	0x80, 0xA9, 0xDB, 0xCB, 0x99, 0x99, 0x89, 0x00, 0x32, 0x34, 0x45, 0x42,
+	0x12, 0x10, 0x00, 0xAA, 0xFB, 0xCC, 0xDB, 0xBB, 0xCB, 0xBA, 0xBB, 0xBA,
+	0x99, 0x10, 0x33, 0x47, 0x24, 0x43, 0x43, 0x33, 0x14, 0x11, 0x22, 0x03,
+	0x99, 0xCA, 0xAC, 0xCA, 0xBB, 0xAA, 0xAD, 0xA8, 0xAA, 0x01, 0x10, 0x35,
+	0x01, 0x22, 0xA0, 0xBB, 0xDF, 0xCB, 0xDC, 0xDB, 0xBC, 0xCB, 0xBA, 0xBB,
+	0xAC, 0xAB, 0x9A, 0x88, 0x31, 0x37, 0x32, 0x35, 0x24, 0x44, 0x22, 0x33,
+	0x23, 0x21, 0x04, 0x10, 0x02, 0x9A, 0x12, 0xCB, 0x20, 0xC9, 0x51, 0x91,
+	0x70, 0x82, 0x28, 0x03, 0x19, 0x84, 0xAC, 0xA0, 0xBE, 0xA9, 0xBE, 0xAA,
+	0xBC, 0x9A, 0xAA, 0x8A, 0x89, 0x21, 0x22, 0x45, 0x24, 0x34, 0x24, 0x43,
+	0x44, 0x02, 0x80, 0x01, 0x11, 0x01, 0x99, 0xA9, 0xDB, 0xAB, 0xBB, 0x0A,
+	0xA8, 0x98, 0xDA, 0x09, 0x81, 0xBB, 0xB8, 0xCF, 0xFB, 0xCD, 0xAB, 0xBC,
+	0xBD, 0xCC, 0xBB, 0xBA, 0xAC, 0xAB, 0xBA, 0xAA, 0x88, 0x42, 0x27, 0x32,
+	0x44, 0x22, 0x34, 0x24, 0x43, 0x21, 0x22, 0x11, 0x02, 0x01, 0x11, 0x09,
+	0x01, 0x8A, 0x35, 0x88, 0x44, 0x80, 0x46, 0x80, 0x42, 0xA0, 0x19, 0xF8,
+	0x8A, 0xB8, 0xAC, 0xC9, 0xAE, 0xA9, 0xAB, 0x88, 0xA9, 0x20, 0xA8, 0x61,
+	0x23, 0x54, 0x33, 0x21, 0x13, 0x42, 0x32, 0x00, 0x22, 0xB2, 0x9E, 0xB9,
+	0x8C, 0x81, 0xAA, 0x02, 0xAA, 0x42, 0x90, 0x64, 0x82, 0x20, 0xD9, 0xAB,
+	0xEB, 0xBD, 0xDB, 0xAC, 0xCB, 0xBC, 0xBC, 0xBC, 0xAB, 0x9B, 0x9A, 0xA9,
+	0xAA, 0x8A, 0x31, 0x57, 0x23, 0x43, 0x24, 0x32, 0x25, 0x22, 0x25, 0x10,
+	0x24, 0x80, 0x41, 0x90, 0x41, 0x81, 0x48, 0x02, 0x29, 0x84, 0x0B, 0x14,
+	0xAB, 0x23, 0xDB, 0x88, 0xEC, 0x8A, 0xB9, 0x8A, 0xB8, 0xBC, 0xB9, 0xAC,
+	0x80, 0x88, 0x30, 0x91, 0x8B, 0x14, 0x31, 0x57, 0x47, 0x12, 0x88, 0x80,
+	0x31, 0x25, 0x23, 0x02, 0xCA, 0xCB, 0x9A, 0x01, 0x88, 0xC8, 0xCE, 0x9A,
+	0x8A, 0x10, 0x80, 0x88, 0xDA, 0xAC, 0xA9, 0x89, 0xD9, 0xCE, 0xBC, 0xBB,
+	0xBC, 0xAC, 0xAB, 0xCB, 0xAA, 0x89, 0x28, 0x32, 0x53, 0x44, 0x34, 0x44,
+	0x33, 0x22, 0x33, 0x34, 0x22, 0x03, 0x21, 0x92, 0x8B, 0x03, 0x28, 0x26,
+	0x00, 0x54, 0x81, 0x51, 0x13, 0x31, 0x92, 0x99, 0xF9, 0xAB, 0xA9, 0xCD,
+	0xCB, 0xCB, 0x99, 0xBB, 0x0A, 0x80, 0x08, 0x01, 0x40, 0x37, 0x31, 0x34,
+	0x02, 0x30, 0x43, 0x23, 0x00, 0x42, 0x93, 0xAB, 0xCC, 0x39, 0x13, 0x08,
+	0x80, 0x81, 0xA9, 0x68, 0x92, 0xAA, 0xFA, 0xBF, 0xCA, 0xBC, 0xCB, 0xCC,
+	0xBA, 0xBA, 0xCC, 0xCC, 0xBB, 0xCB, 0xAB, 0x9A, 0x88, 0xCB, 0x9A, 0x09,
+	0x53, 0x63, 0x24, 0x12, 0x33, 0x22, 0x44, 0x23, 0x45, 0x02, 0x10, 0x00,
+	0x41, 0x13, 0x30, 0x15, 0x10, 0x22, 0x30, 0x34, 0x01, 0x32, 0xB8, 0x88,
+	0xB9, 0xBD, 0xBE, 0xBD, 0xBB, 0xCB, 0x9B, 0xAA, 0xB9, 0xAC, 0x99, 0x48,
+	0x22, 0x54, 0x81, 0x18, 0x21, 0x73, 0x36, 0x01, 0x89, 0x09, 0x21, 0x80,
+	0x21, 0x01, 0x82, 0xAC, 0x8B, 0x98, 0xAB, 0xEA, 0xBE, 0xAB, 0xBA, 0xBE,
+	0xCA, 0xBB, 0xDC, 0xBC, 0xAB, 0xDB, 0xDB, 0xCC, 0xBB, 0xBC, 0xBC, 0x9A,
+	0x09, 0x98, 0x9A, 0x98, 0x60, 0x43, 0x44, 0x02, 0x52, 0x82, 0x41, 0x03,
+	0x40, 0x03, 0x0A, 0x33, 0x10, 0x36, 0x02, 0x43, 0x80, 0x62, 0x02, 0x62,
+	0x91, 0x89, 0x91, 0x1A, 0x02, 0xAA, 0x90, 0xAF, 0x08, 0x9A, 0x22, 0x90,
+	0x10, 0xD9, 0x8A, 0xA0, 0x8B, 0xD0, 0x1C, 0x02, 0x00, 0x28, 0xA0, 0x38,
+	0x20, 0x77, 0x37, 0x11, 0xA8, 0x89, 0x91, 0x71, 0x83, 0x88, 0xD9, 0xAC,
+	0xA8, 0x89, 0x01, 0xAB, 0xEB, 0xBC, 0xA9, 0xBA, 0xAB, 0xBE, 0xBC, 0xDC,
+	0xAA, 0xCB, 0xCC, 0xAA, 0x88, 0x08, 0x01, 0x99, 0x08, 0x20, 0x57, 0x33,
+	0x22, 0x01, 0x10, 0x00, 0x63, 0x34, 0x22, 0x11, 0x22, 0x44, 0x34, 0x44,
+	0x12, 0x21, 0x02, 0x19, 0x15, 0x99, 0xA8, 0xBD, 0x10, 0x90, 0x89, 0xFB,
+	0x0A, 0x81, 0x40, 0x17, 0x89, 0x91, 0x9C, 0x10, 0x08, 0x01, 0xCC, 0xAA,
+	0xAC, 0x10, 0x31, 0x33, 0x92, 0xAC, 0x09, 0x73, 0x16, 0x11, 0x01, 0x08,
+	0x10, 0x21, 0x13, 0x18, 0xD8, 0x8B, 0xB9, 0xBF, 0xDB, 0xBD, 0xB9, 0xBA,
+	0xCC, 0xCC, 0xAB, 0xCC, 0xAC, 0xBA, 0xBC, 0x9A, 0x88, 0x00, 0x80, 0x00,
+	0x31, 0x44, 0x44, 0x33, 0x02, 0x01, 0x9A, 0x11, 0x63, 0x27, 0x22, 0x11,
+	0x18, 0x35, 0x43, 0x35, 0x12, 0x20, 0x01, 0x21, 0x12, 0x32, 0xA0, 0x99,
+	0xDC, 0x29, 0x03, 0x09, 0x25, 0x98, 0x44, 0x41, 0x82, 0x9C, 0xA8, 0x8A,
+	0x81, 0xDA, 0xBB, 0xCF, 0x9A, 0x00, 0x33, 0x33, 0x12, 0xBB, 0xCB, 0x1C,
+	0x25, 0x88, 0xB9, 0xBA, 0x8C, 0x03, 0x54, 0x02, 0x32, 0x03, 0x88, 0xC8,
+	0x9D, 0xFA, 0xAE, 0xDB, 0xCB, 0xBB, 0xBC, 0xDB, 0xAB, 0xCA, 0xAC, 0x09,
+	0x21, 0x02, 0x9A, 0x90, 0xAA, 0x40, 0x35, 0x23, 0xA1, 0xAE, 0xAB, 0x38,
+	0x47, 0x43, 0x02, 0x00, 0x33, 0x63, 0x34, 0x14, 0x00, 0x18, 0x01, 0x18,
+	0x15, 0x80, 0x01, 0xAB, 0x80, 0x11, 0x47, 0x81, 0x20, 0xA0, 0x38, 0xA2,
+	0x1A, 0xC3, 0x0D, 0xF9, 0x1A, 0x82, 0x08, 0x83, 0x8C, 0x32, 0x08, 0x42,
+	0x82, 0xE9, 0x9C, 0x98, 0xCC, 0x08, 0x00, 0x11, 0x09, 0x11, 0x54, 0x25,
+	0x91, 0x10, 0xB9, 0xBC, 0xDB, 0xCD, 0xBB, 0xBA, 0xEB, 0xBB, 0xCB, 0xAA,
+	0xBA, 0xBE, 0xCB, 0xBD, 0x8A, 0x31, 0xA0, 0x9B, 0xB9, 0x8D, 0x20, 0x65,
+	0x13, 0x00, 0xA9, 0x9C, 0x11, 0x32, 0x25, 0x90, 0x9A, 0x39, 0x57, 0x33,
+	0x43, 0x12, 0x20, 0x12, 0x52, 0x33, 0x12, 0xA9, 0x99, 0x99, 0x33, 0x90,
+	0x10, 0x36, 0x24, 0x12, 0x41, 0x23, 0x81, 0xCC, 0x61, 0x91, 0x80, 0xAD,
+	0x99, 0x99, 0x08, 0x46, 0x02, 0x98, 0xCB, 0xDB, 0xAC, 0x21, 0x80, 0xA8,
+	0xCC, 0x9B, 0x98, 0x72, 0x24, 0x12, 0xA0, 0x9A, 0xA9, 0x18, 0x80, 0xFC,
+	0xDB, 0xBC, 0xBB, 0xAA, 0xA9, 0xDC, 0xCB, 0xCB, 0x0A, 0x21, 0x80, 0x89,
+	0xB8, 0xAB, 0xAA, 0x71, 0x02, 0x12, 0xCA, 0x9A, 0xA9, 0x72, 0x26, 0x98,
+	0x88, 0x00, 0x30, 0x52, 0x33, 0x52, 0x12, 0x21, 0x44, 0x43, 0x24, 0x53,
+	0x02, 0x18, 0x42, 0x90, 0x09, 0x81, 0x08, 0x41, 0x03, 0x18, 0x30, 0x44,
+	0x24, 0x10, 0xC0, 0x09, 0x99, 0x8A, 0x62, 0x01, 0x90, 0x10, 0x82, 0xAC,
+	0xBC, 0xBC, 0x19, 0xCC, 0xDC, 0xBD, 0x8A, 0x08, 0x99, 0x99, 0x09, 0xD9,
+	0xBD, 0x58, 0x24, 0xCB, 0x9A, 0x89, 0x80, 0xEF, 0x9B, 0x01, 0xCA, 0x9C,
+	0x08, 0xCA, 0x38, 0x83, 0x0B, 0x05, 0xEB, 0x1A, 0x82, 0x9A, 0x45, 0xA8,
+	0x28, 0x91, 0x9C, 0x43, 0x80, 0x31, 0xA0, 0x90, 0xCF, 0x51, 0x23, 0xC0,
+	0x8B, 0x13, 0x20, 0x36, 0x90, 0x1A, 0x42, 0x35, 0xA0, 0x89, 0xA0, 0x8A,
+	0x63, 0x02, 0xA9, 0x0C, 0x92, 0x70, 0x94, 0x0C, 0xB0, 0x18, 0xA9, 0x51,
+	0xB1, 0x9E, 0x10, 0x73, 0x82, 0x8C, 0x11, 0x20, 0x80, 0xA8, 0xAE, 0x04,
+	0x2B, 0x07, 0xAA, 0x29, 0x35, 0xE9, 0x18, 0x81, 0x22, 0xFB, 0x18, 0x40,
+	0xC2, 0x9B, 0x33, 0x88, 0x91, 0x8C, 0xA8, 0x50, 0x81, 0x9A, 0x01, 0x9F,
+	0x14, 0x89, 0x00, 0x99, 0x19, 0x24, 0xA0, 0xCB, 0x40, 0x00, 0xB2, 0x8B,
+	0x80, 0x51, 0xD1, 0x29, 0x88, 0xA3, 0x1E, 0xA3, 0x29, 0x92, 0x8A, 0x41,
+	0xA2, 0x89, 0x40, 0xC0, 0x51, 0xA0, 0x8B, 0x43, 0xA0, 0x89, 0xBC, 0x50,
+	0x82, 0xEC, 0x89, 0x22, 0x88, 0xB8, 0x8A, 0x11, 0x01, 0x11, 0x89, 0x11,
+	0x88, 0x29, 0x03, 0x25, 0xFB, 0xAF, 0x32, 0x02, 0xCA, 0x9D, 0x30, 0x02,
+	0x90, 0x80, 0x90, 0x81, 0x99, 0x26, 0xBB, 0x10, 0x29, 0x83, 0xBC, 0x93,
+	0xF0, 0xAC, 0x40, 0xB9, 0xFB, 0x9B, 0x12, 0xC8, 0x9C, 0x09, 0xA9, 0x78,
+	0x84, 0xA9, 0x11, 0x24, 0x33, 0xA1, 0x2A, 0x25, 0x11, 0x11, 0x88, 0xAF,
+	0x18, 0x12, 0xD9, 0xAA, 0x34, 0x82, 0xDA, 0x2B, 0x15, 0x18, 0x90, 0x01,
+	0xAC, 0x21, 0x43, 0xD9, 0x8D, 0x41, 0xC8, 0xAA, 0x9C, 0x00, 0x88, 0xBA,
+	0xBB, 0xC9, 0x39, 0x04, 0xBB, 0x21, 0x97, 0x18, 0x89, 0x41, 0x31, 0xA0,
+	0x7B, 0x22, 0x9B, 0xA1, 0x9A, 0x81, 0xB9, 0xBC, 0xAF, 0x9B, 0x29, 0x2A,
+	0xFA, 0x1C, 0x33, 0x39, 0x81, 0x73, 0x03, 0x8A, 0x54, 0x13, 0xDB, 0x8B,
+	0x32, 0xB8, 0xFB, 0x9A, 0xB8, 0xDA, 0x09, 0x99, 0x99, 0x9C, 0x09, 0x23,
+	0x32, 0x73, 0x43, 0x73, 0x23, 0x10, 0x33, 0x17, 0x01, 0x00, 0x11, 0x80,
+	0xBA, 0x08, 0x99, 0xC2, 0xCB, 0x9A, 0x9D, 0x23, 0xB9, 0x2D, 0x18, 0x11,
+	0x82, 0xFC, 0x28, 0x88, 0x9C, 0x99, 0xCE, 0xAA, 0xBA, 0xB9, 0xDA, 0xD9,
+	0x20, 0x08, 0xA9, 0x31, 0x37, 0x34, 0x13, 0x41, 0x53, 0x03, 0x10, 0x62,
+	0x00, 0x80, 0xB9, 0x0C, 0xB0, 0xAB, 0xAD, 0x99, 0xAB, 0xB9, 0x18, 0x05,
+	0x23, 0x4B, 0x27, 0x02, 0x32, 0x02, 0x83, 0xA9, 0xA0, 0x9D, 0x9F, 0xBD,
+	0xA9, 0xBC, 0xAC, 0x8B, 0xAA, 0xAD, 0x09, 0x99, 0x10, 0x46, 0x11, 0x32,
+	0x34, 0x63, 0x31, 0x13, 0x12, 0x11, 0x12, 0xF8, 0xAA, 0x12, 0xB9, 0xBB,
+	0xBA, 0xC0, 0x89, 0x88, 0x38, 0x67, 0x11, 0x11, 0x33, 0x14, 0xA2, 0x80,
+	0xD2, 0xEB, 0xA8, 0xEB, 0xAB, 0xAA, 0xAC, 0x9D, 0xA8, 0x98, 0x99, 0x28,
+	0x13, 0x26, 0x22, 0x70, 0x43, 0x12, 0x11, 0x42, 0x12, 0x09, 0x22, 0x1A,
+	0x9F, 0xA9, 0x90, 0xBC, 0x2C, 0xBB, 0xCA, 0x80, 0x8A, 0x88, 0x22, 0x15,
+	0x62, 0x41, 0x10, 0x81, 0x21, 0x84, 0xB9, 0xB8, 0xBE, 0x9F, 0xAA, 0x9A,
+	0x8B, 0xA8, 0x80, 0x39, 0x35, 0x30, 0x35, 0x16, 0x03, 0x34, 0x31, 0x08,
+	0x0C, 0x10, 0x99, 0xAC, 0xBB, 0xC9, 0xAB, 0xDF, 0x9A, 0x01, 0x1A, 0x29,
+	0xCA, 0xBB, 0x41, 0x22, 0x13, 0x36, 0x24, 0x39, 0x5A, 0x33, 0xBA, 0x00,
+	0x03, 0xF0, 0x9D, 0x9C, 0x9B, 0x9C, 0x2A, 0x88, 0x3B, 0x52, 0x43, 0x34,
+	0x45, 0x31, 0x23, 0x13, 0x14, 0x21, 0x2B, 0x3B, 0xBB, 0xFF, 0xAA, 0xB9,
+	0x99, 0xCB, 0x99, 0xA9, 0xAB, 0x3B, 0x60, 0x01, 0x20, 0x82, 0x52, 0x58,
+	0xA4, 0x12, 0x94, 0x08, 0x11, 0x94, 0x01, 0x91, 0x86, 0x41, 0x31, 0x12,
+	0x81, 0x25, 0x39, 0x26, 0x02, 0x34, 0x01, 0x20, 0x01, 0xAB, 0xEB, 0xB1,
+	0xEC, 0xA9, 0x9B, 0x89, 0x9F, 0x99, 0x91, 0x8A, 0x20, 0x11, 0x80, 0x9C,
+	0x29, 0xF1, 0xBB, 0xFB, 0x99, 0xBA, 0xAE, 0xAB, 0xC8, 0x9A, 0x1B, 0x59,
+	0x32, 0x16, 0x23, 0x53, 0x23, 0x17, 0x31, 0x11, 0x08, 0x00, 0x00, 0xA8,
+	0xAC, 0x9B, 0xFB, 0x9B, 0x9A, 0x98, 0xB9, 0x10, 0x42, 0x04, 0x20, 0x16,
+	0x20, 0x39, 0x81, 0x87, 0x99, 0xAB, 0xB2, 0xBA, 0xE8, 0x8B, 0x80, 0xBE,
+	0x2B, 0x2E, 0x08, 0x31, 0x13, 0x99, 0x33, 0x76, 0x22, 0x15, 0x12, 0x82,
+	0x32, 0x18, 0xC0, 0x1A, 0xAE, 0xDA, 0xBA, 0xBC, 0xCA, 0xC9, 0xAA, 0x88,
+	0x19, 0x80, 0x72, 0x12, 0x33, 0x23, 0x55, 0x11, 0xA1, 0x29, 0x19, 0x9B,
+	0xAF, 0xBB, 0xBD, 0xAC, 0xB9, 0xA9, 0x89, 0x9A, 0x21, 0x25, 0x72, 0x23,
+	0x41, 0x32, 0x61, 0x11, 0x21, 0x31, 0x98, 0x99, 0xBA, 0xCD, 0x9B, 0xBB,
+	0xDF, 0xA8, 0x90, 0xAA, 0x98, 0x11, 0x80, 0x04, 0x24, 0x15, 0x13, 0x42,
+	0x43, 0x81, 0x94, 0x81, 0xA8, 0xE0, 0x90, 0xA0, 0xA9, 0x8A, 0x99, 0x2C,
+	0x85, 0x50, 0x12, 0x53, 0x01, 0x01, 0x13, 0x15, 0x9B, 0x4A, 0x19, 0xDA,
+	0xAA, 0x0F, 0xB9, 0xAC, 0xBB, 0x09, 0x9A, 0xBD, 0x09, 0x9C, 0x93, 0x8B,
+	0x89, 0x9B, 0xBB, 0x5D, 0x81, 0xD8, 0x80, 0x01, 0x12, 0xBB, 0x32, 0x27,
+	0x09, 0x85, 0x43, 0x30, 0x4C, 0x32, 0x19, 0x12, 0x94, 0x93, 0x04, 0x79,
+	0x31, 0x1B, 0xC9, 0xCB, 0xA9, 0xF9, 0x99, 0x9A, 0xCC, 0x99, 0x8A, 0x98,
+	0x01, 0x07, 0x28, 0x39, 0x33, 0x05, 0x34, 0x10, 0x32, 0x13, 0x37, 0x32,
+	0x18, 0x40, 0x40, 0xA1, 0x03, 0xD4, 0x03, 0x06, 0x18, 0x19, 0x01, 0x21,
+	0xA9, 0xB9, 0x9A, 0xDD, 0xB1, 0x92, 0xFB, 0x1A, 0xB8, 0xC0, 0x90, 0x9A,
+	0x9F, 0xAB, 0xB8, 0xC8, 0xDA, 0xAA, 0xBA, 0x09, 0xD9, 0xF0, 0xBF, 0x67,
+	0x99, 0x88, 0x00, 0x80, 0x11, 0xBA, 0x31, 0xA2, 0x9C, 0x30, 0xCA, 0x30,
+	0xA0, 0x1B, 0x13, 0xB9, 0x50, 0xB2, 0x29, 0x17, 0x80, 0x32, 0xA2, 0x19,
+	0xCA, 0x34, 0x03, 0x98, 0x2A, 0x10, 0x8F, 0xAD, 0xA0, 0x13, 0xA9, 0x1C,
+	0x80, 0xA2, 0x31, 0x6C, 0x00, 0x04, 0x22, 0x60, 0x02, 0x22, 0x21, 0x33,
+	0x19, 0x87, 0x21, 0x10, 0x93, 0xC2, 0xB1, 0x5A, 0xC1, 0x84, 0x89, 0x61,
+	0xC0, 0xA8, 0x53, 0x1A, 0xA1, 0xAD, 0x90, 0xB8, 0xBC, 0xE9, 0xAC, 0xAA,
+	0xA8, 0x8E, 0x99, 0xBA, 0xA0, 0xAA, 0x48, 0xA1, 0x39, 0x70, 0x80, 0x20,
+	0x24, 0x68, 0xA0, 0x24, 0x00, 0x40, 0x88, 0x92, 0x12, 0xD2, 0x8B, 0x4A,
+	0x8C, 0xBB, 0xA0, 0x8D, 0x9A, 0x9D, 0x08, 0x53, 0x1D, 0x19, 0x35, 0x00,
+	0x33, 0x48, 0x59, 0x81, 0x21, 0x38, 0x18, 0x90, 0x2F, 0x18, 0xB0, 0x1A,
+	0x50, 0x88, 0x59, 0x0B, 0x00, 0x31, 0x04, 0x39, 0xE0, 0x35, 0x21, 0xAA,
+	0x11, 0xA5, 0x43, 0x19, 0xAA, 0x99, 0xDB, 0xE0, 0x9F, 0x91, 0x8A, 0xB8,
+	0x1A, 0x89, 0x0D, 0x01, 0x11, 0x99, 0x87, 0xA1, 0x01, 0x20, 0x30, 0x0F,
+	0x8A, 0xAA, 0xB9, 0x2E, 0xF9, 0x80, 0x98, 0xB2, 0x91, 0x10, 0x12, 0x10,
+	0x2A, 0x73, 0x10, 0x33, 0x17, 0x50, 0x19, 0x91, 0x20, 0x11, 0x21, 0x9B,
+	0x09, 0xA5, 0xD8, 0x39, 0x3A, 0x8B, 0x41, 0x4B, 0x11, 0x8C, 0x72, 0x22,
+	0xD4, 0x21, 0x84, 0x84, 0x91, 0x80, 0x11, 0x4A, 0x4B, 0xD1, 0xC1, 0x91,
+	0x29, 0xAB, 0x40, 0x3A, 0x28, 0x99, 0x18, 0x27, 0x69, 0x29, 0x93, 0x9A,
+	0x99, 0x29, 0xE2, 0x00, 0xAD, 0xA8, 0xBD, 0x19, 0x01, 0xC2, 0xB0, 0x9B,
+	0xB2, 0x51, 0x7B, 0x0A, 0x21, 0x2D, 0x91, 0x93, 0xC2, 0x81, 0x0C, 0x2B,
+	0xB8, 0x13, 0x29, 0xF9, 0xD9, 0x82, 0xA1, 0xA5, 0x90, 0xA9, 0xAB, 0xAA,
+	0x0B, 0x1E, 0xA4, 0x09, 0x05, 0x52, 0x21, 0x13, 0x47, 0x21, 0x13, 0x16,
+	0x11, 0x23, 0x84, 0x23, 0x00, 0xB0, 0x21, 0xBD, 0xC8, 0xAA, 0xBA, 0xDC,
+	0xCA, 0xA9, 0x90, 0xAB, 0x92, 0x99, 0x23, 0xD9, 0x32, 0x71, 0x84, 0x93,
+	0x21, 0x90, 0x0F, 0xB9, 0x19, 0xBB, 0xFB, 0xDB, 0x99, 0xC8, 0xA8, 0x90,
+	0x11, 0xC1, 0x86, 0x01, 0x03, 0x25, 0x30, 0x49, 0x85, 0x80, 0xB2, 0x90,
+	0xB0, 0xF8, 0x8A, 0xAA, 0xC2, 0xD0, 0x98, 0x9B, 0x88, 0xB0, 0x02, 0x9B,
+	0xB4, 0x01, 0x63, 0x3A, 0x88, 0x83, 0xB3, 0x07, 0x09, 0x90, 0xB4, 0xDA,
+	0x01, 0x88, 0x9B, 0x31, 0xD5, 0x82, 0x22, 0x34, 0x53, 0x33, 0x45, 0x02,
+	0x23, 0x79, 0x31, 0x10, 0x33, 0xC8, 0x83, 0xB1, 0xB1, 0xC9, 0x9B, 0xFC,
+	0x09, 0xCB, 0x9A, 0x9A, 0xB9, 0xD9, 0x8B, 0xD0, 0x80, 0x88, 0x09, 0x0A,
+	0xFA, 0x11, 0xE9, 0x00, 0x09, 0x8A, 0x9E, 0xB3, 0xC0, 0xD0, 0x99, 0x09,
+	0x91, 0x18, 0x21, 0x5A, 0x41, 0x95, 0x82, 0x04, 0xB3, 0x03, 0x20, 0x01,
+	0x9D, 0x30, 0x3F, 0x9B, 0x19, 0xBB, 0x9D, 0xAC, 0xA0, 0x90, 0x1C, 0xDA,
+	0xB3, 0x36, 0x00, 0x10, 0x17, 0x20, 0x3B, 0x41, 0x22, 0x28, 0x82, 0x25,
+	0x42, 0x18, 0x00, 0x01, 0x14, 0x1D, 0x1C, 0x91, 0xB4, 0x89, 0x90, 0xE0,
+	0x00, 0x04, 0x10, 0x11, 0x80, 0x39, 0x2F, 0x94, 0x28, 0x1B, 0x1E, 0x8B,
+	0x09, 0xFA, 0x0A, 0x99, 0xC0, 0x89, 0x9B, 0x09, 0x99, 0xB4, 0x35, 0xA0,
+	0x86, 0x00, 0x49, 0x80, 0x99, 0xAB, 0xF1, 0x1A, 0x2E, 0x8B, 0x99, 0x91,
+	0x4A, 0x90, 0xA5, 0x28, 0x98, 0x27, 0x21, 0x10, 0x43, 0xA1, 0x0A, 0x3B,
+	0xD8, 0x8D, 0x0C, 0x2B, 0xBA, 0xAD, 0x00, 0xC3, 0x19, 0x1B, 0x72, 0x12,
+	0x36, 0x23, 0x24, 0x31, 0x31, 0x17, 0x02, 0x11, 0x91, 0xB8, 0xF9, 0x01,
+	0xA8, 0x9A, 0x09, 0x8F, 0xA8, 0x11, 0xC2, 0x23, 0x13, 0x34, 0xA1, 0x16,
+	0x42, 0x11, 0x5A, 0x0B, 0x0B, 0x29, 0x99, 0xDF, 0x99, 0xAB, 0x9D, 0xC8,
+	0x8A, 0xA9, 0x9B, 0xB8, 0x30, 0x92, 0x23, 0x74, 0x33, 0x31, 0x85, 0x03,
+	0x04, 0x10, 0x21, 0x1C, 0x6B, 0x1D, 0xAA, 0xB0, 0x0C, 0x91, 0x9C, 0xA2,
+	0x2A, 0x90, 0x59, 0x19, 0x30, 0x71, 0x30, 0xA2, 0x03, 0x04, 0x93, 0xAB,
+	0x19, 0xB7, 0xB9, 0x9E, 0x0B, 0x9A, 0x9C, 0x09, 0x49, 0x3E, 0x39, 0x38,
+	0x29, 0x71, 0x18, 0x03, 0x02, 0x02, 0x03, 0x36, 0xA1, 0x01, 0xA1, 0xC4,
+	0x9B, 0xB9, 0xAC, 0xE9, 0xB0, 0x80, 0x9F, 0x01, 0x09, 0x08, 0x01, 0x5C,
+	0x81, 0x5D, 0x80, 0x11, 0x81, 0x10, 0x2A, 0xC9, 0xD2, 0x19, 0x1D, 0x9A,
+	0xAD, 0x9C, 0x0B, 0x99, 0xA8, 0xA1, 0x5C, 0x20, 0x79, 0x21, 0x12, 0x40,
+	0x02, 0x32, 0x12, 0x09, 0xB4, 0x24, 0xAF, 0x0D, 0x98, 0xA9, 0x1D, 0x98,
+	0xC0, 0x89, 0x29, 0x10, 0x61, 0x30, 0x21, 0x96, 0x14, 0x20, 0x40, 0x3A,
+	0xD3, 0x01, 0x11, 0x3B, 0x8D, 0x09, 0x1A, 0xAD, 0xAB, 0x19, 0xAC, 0xE9,
+	0xA0, 0x81, 0x1A, 0x99, 0x21, 0xB1, 0x3B, 0x26, 0x00, 0x07, 0x2B, 0x29,
+	0xE5, 0xB3, 0x19, 0x31, 0xA9, 0x39, 0x80, 0x31, 0x80, 0x67, 0x92, 0x38,
+	0x01, 0x40, 0xB1, 0x5B, 0xAB, 0xE1, 0xB8, 0xB1, 0xAA, 0xB9, 0xB0, 0x2D,
+	0x2A, 0xA1, 0x82, 0x37, 0xA1, 0x06, 0x22, 0x11, 0x31, 0x69, 0x18, 0x00,
+	0x32, 0xC1, 0x29, 0x9F, 0x94, 0x9A, 0x1B, 0x88, 0x1B, 0x4B, 0x9D, 0x12,
+	0x3C, 0x91, 0x00, 0xA6, 0x83, 0x85, 0x39, 0x20, 0x79, 0x0A, 0x02, 0xD3,
+	0x00, 0x01, 0x9A, 0x6A, 0x0B, 0x92, 0x29, 0x9B, 0x9B, 0x0F, 0x91, 0x31,
+	0xAB, 0x78, 0xB8, 0xB1, 0x1B, 0x03, 0xF1, 0xAB, 0xA8, 0x8E, 0x09, 0x19,
+	0x32, 0x3C, 0x2D, 0x22, 0x39, 0x30, 0x44, 0x29, 0x8D, 0x84, 0xD0, 0xA8,
+	0x2C, 0x9B, 0x99, 0x9C, 0x91, 0xB1, 0xB2, 0x22, 0x27, 0x7A, 0x00, 0x42,
+	0x20, 0x68, 0x00, 0x21, 0x18, 0x93, 0x80, 0x2A, 0xF0, 0xA9, 0x99, 0xCB,
+	0x88, 0x2C, 0x00, 0xB8, 0xA1, 0x71, 0x5B, 0x90, 0x87, 0x80, 0x10, 0x10,
+	0xA3, 0x90, 0x99, 0xE2, 0xA9, 0xB1, 0xFA, 0x89, 0xB0, 0x0A, 0xA2, 0x70,
+	0x80, 0x20, 0x21, 0x97, 0x12, 0x29, 0x48, 0x29, 0x91, 0xB8, 0xBA, 0xBB,
+	0xF9, 0xAA, 0x1B, 0xBB, 0xDB, 0x1A, 0xAA, 0xB5, 0x39, 0xA4, 0x32, 0x70,
+	0x4A, 0x98, 0x00, 0xC2, 0x00, 0xAC, 0xB8, 0xB4, 0xCB, 0xD3, 0x0A, 0xC9,
+	0xB1, 0x14, 0x99, 0x3A, 0x17, 0x12, 0x53, 0x21, 0x12, 0x06, 0x22, 0x98,
+	0x40, 0x88, 0x89, 0xFB, 0xB2, 0x08, 0xBB, 0x90, 0xC9, 0x15, 0x01, 0x53,
+	0x91, 0x6B, 0x12, 0x49, 0xB2, 0x82, 0xB5, 0x89, 0x2F, 0x8B, 0x0A, 0xCC,
+	0x99, 0x9B, 0x9A, 0x8B, 0x80, 0x1D, 0x90, 0x15, 0x32, 0x51, 0x84, 0x21,
+	0x31, 0xA2, 0x03, 0x8A, 0x20, 0xCC, 0xB0, 0x2D, 0x8C, 0xCB, 0x5B, 0xBA,
+	0xA5, 0x21, 0x30, 0x02, 0x11, 0x25, 0x38, 0x4A, 0x81, 0x9B, 0xC4, 0x1B,
+	0x8C, 0xDB, 0xB0, 0xFB, 0xB1, 0xA8, 0x0C, 0x2C, 0x99, 0x24, 0x1A, 0x38,
+	0x14, 0x17, 0x12, 0x31, 0x1A, 0x24, 0x19, 0x89, 0x6B, 0xB0, 0x99, 0x10,
+	0x08, 0x1B, 0x4D, 0x02, 0x40, 0x59, 0x19, 0x31, 0x32, 0x33, 0x5B, 0x4B,
+	0xF0, 0x82, 0x00, 0x9A, 0xB0, 0x9A, 0xF0, 0x90, 0x0B, 0x2B, 0x9B, 0x5B,
+	0x21, 0xD5, 0xB2, 0x04, 0x00, 0x08, 0xB0, 0x12, 0xF2, 0x28, 0x3B, 0xE9,
+	0xB2, 0x02, 0x10, 0x3C, 0x11, 0x53, 0x91, 0x87, 0x02, 0x20, 0x10, 0x3C,
+	0x19, 0x39, 0xFA, 0xE8, 0x80, 0x90, 0x91, 0x08, 0x1D, 0x90, 0xC1, 0x20,
+	0x23, 0x6C, 0x08, 0x84, 0x93, 0x92, 0x83, 0x06, 0x19, 0x1A, 0xC2, 0x99,
+	0xBC, 0xC2, 0x10, 0xEB, 0x08, 0x89, 0x61, 0x28, 0x28, 0x21, 0x15, 0x03,
+	0x70, 0x11, 0x81, 0x00, 0xB1, 0x39, 0xAF, 0xC9, 0xC1, 0x90, 0x09, 0xBA,
+	0xA9, 0x4A, 0x93, 0x7B, 0x93, 0x12, 0x13, 0x32, 0x05, 0xA2, 0x40, 0xA0,
+	0x5A, 0xB1, 0x1F, 0x2C, 0x0A, 0xDA, 0x0A, 0x9B, 0xA2, 0xE4, 0x91, 0x3A,
+	0x19, 0x6A, 0x18, 0xC1, 0xB2, 0x02, 0x61, 0xB1, 0x88, 0x1A, 0x20, 0xA9,
+	0x02, 0xEC, 0x90, 0xB2, 0xA9, 0x71, 0x99, 0x93, 0x93, 0x95, 0x93, 0x85,
+	0x35, 0x9A, 0x38, 0x3B, 0x39, 0x8A, 0x4B, 0xC9, 0x30, 0xAC, 0x20, 0xBB,
+	0xB9, 0xAB, 0x13, 0x00, 0x33, 0x9E, 0x94, 0x09, 0x9B, 0x2C, 0xCB, 0x09,
+	0x2C, 0x0F, 0xB9, 0x82, 0x82, 0x51, 0x1D, 0x11, 0x19, 0x51, 0x1C, 0x91,
+	0xB5, 0x11, 0x82, 0x84, 0x19, 0x09, 0x31, 0x81, 0x1E, 0x93, 0x49, 0x1B,
+	0x8E, 0x8B, 0x09, 0xE2, 0x28, 0x90, 0x9A, 0x08, 0xC7, 0xC1, 0x80, 0x21,
+	0xB8, 0xA9, 0x1C, 0x10, 0x4B, 0x9C, 0x92, 0x29, 0x5B, 0x0B, 0x32, 0xAF,
+	0x94, 0xA0, 0x22, 0x39, 0x04, 0x19, 0x07, 0x18, 0x18, 0x20, 0x26, 0x91,
+	0x84, 0x02, 0x4A, 0x18, 0xE2, 0x93, 0xAB, 0x19, 0xD4, 0xB0, 0x2C, 0x11,
+	0x8A, 0xC8, 0xC2, 0xC5, 0x02, 0x90, 0x18, 0x0B, 0xB0, 0x14, 0x09, 0x7B,
+	0x98, 0x03, 0x90, 0xC2, 0x19, 0x13, 0xF4, 0xB4, 0x08, 0x3A, 0x4B, 0x3B,
+	0x98, 0x96, 0x99, 0x20, 0x92, 0x3B, 0xB3, 0x5B, 0x90, 0xA3, 0xB1, 0x87,
+	0x3A, 0x0C, 0x88, 0x9C, 0xA5, 0xB8, 0xA0, 0x09, 0x0B, 0x01, 0x71, 0x1B,
+	0x94, 0x29, 0x38, 0x21, 0x45, 0x10, 0x91, 0x28, 0xB2, 0x79, 0xB3, 0x00,
+	0xD1, 0xA6, 0x10, 0x3A, 0x0C, 0x12, 0xB1, 0xA2, 0x22, 0x98, 0x03, 0x19,
+	0xB9, 0x1B, 0xD3, 0x11, 0xE9, 0x90, 0xA2, 0xBB, 0xA5, 0x9B, 0x99, 0x03,
+	0xC3, 0x42, 0x1F, 0x38, 0x0E, 0x38, 0x1A, 0xD1, 0x21, 0x29, 0x3C, 0x8A,
+	0x21, 0xB3, 0x13, 0x6C, 0x0B, 0x22, 0x99, 0xC2, 0x02, 0xF8, 0xB3, 0xA1,
+	0x4A, 0xB9, 0x98, 0xBC, 0x8A, 0x58, 0x19, 0x0F, 0x4A, 0x99, 0x03, 0x98,
+	0x19, 0x33, 0x1D, 0x08, 0x3A, 0x0F, 0x01, 0xC0, 0x92, 0xD0, 0x18, 0x4C,
+	0x21, 0xB9, 0x38, 0x91, 0x71, 0x38, 0x28, 0x11, 0x02, 0x92, 0x7B, 0x21,
+	0x0B, 0x39, 0xA0, 0xBE, 0xA3, 0xB0, 0x29, 0xFB, 0x8D, 0xA1, 0x93, 0x1C,
+	0x8A, 0xB1, 0xC3, 0x11, 0x1D, 0xA8, 0xE3, 0xA2, 0xB5, 0x90, 0x01, 0x00,
+	0xA1, 0xA3, 0xB1, 0x2F, 0x6B, 0x92, 0x9D, 0x12, 0x4B, 0xA9, 0xB4, 0x81,
+	0x80, 0xA4, 0x92, 0x3B, 0x0D, 0x3A, 0xD1, 0x81, 0xB3, 0x1B, 0x19, 0x19,
+	0x9B, 0x30, 0xB7, 0x01, 0x4B, 0x4A, 0x0C, 0x00, 0xA9, 0x13, 0xBB, 0xA6,
+	0xA9, 0x01, 0x51, 0xCB, 0x13, 0x10, 0xAB, 0x71, 0x9B, 0x82, 0x43, 0xB1,
+	0x00, 0x10, 0x12, 0xD3, 0x41, 0x01, 0x59, 0x2B, 0xA9, 0x41, 0x81, 0x1C,
+	0xB8, 0x7A, 0x99, 0x8A, 0x39, 0x59, 0x5A, 0xA8, 0x92, 0x03, 0x50, 0x32,
+	0xDA, 0x20, 0x99, 0xC1, 0xB9, 0xDB, 0x8B, 0x1B, 0x2E, 0x0D, 0xD0, 0x11,
+	0x09, 0x01, 0x69, 0x3A, 0x1A, 0x95, 0x38, 0x39, 0x41, 0x1A, 0x10, 0xE0,
+	0x84, 0x92, 0x98, 0x2C, 0xBA, 0x1B, 0xD4, 0xA3, 0x41, 0x0A, 0xA2, 0x70,
+	0x81, 0x4A, 0x39, 0x93, 0x34, 0x3B, 0x50, 0x9A, 0xB0, 0xCA, 0xD0, 0xC3,
+	0xA0, 0xB2, 0x0B, 0xB7, 0x10, 0x01, 0x04, 0x12, 0x33, 0x6C, 0x4C, 0x09,
+	0x01, 0x28, 0x0A, 0x48, 0x9B, 0xAB, 0xFA, 0x98, 0x19, 0x09, 0xD9, 0x80,
+	0xB0, 0x22, 0x73, 0x48, 0x08, 0x21, 0x59, 0x11, 0x11, 0x0B, 0x80, 0xB3,
+	0x5B, 0x1F, 0x00, 0x29, 0x0F, 0x89, 0x81, 0x80, 0xA8, 0xB3, 0x02, 0x4D,
+	0x29, 0xF3, 0x92, 0x81, 0x90, 0x30, 0x20, 0x2A, 0xF0, 0xA0, 0x09, 0xA4,
+	0x9A, 0x93, 0xCA, 0x03, 0xB2, 0x19, 0xB9, 0x17, 0x09, 0xB3, 0x01, 0x25,
+	0x3A, 0xB5, 0x99, 0xB2, 0xD9, 0x49, 0x99, 0x1F, 0xC8, 0xB2, 0xB2, 0x92,
+	0xBA, 0xA0, 0x19, 0xC7, 0x10, 0xB1, 0x32, 0xF9, 0x91, 0x81, 0x91, 0x21,
+	0x38, 0x5D, 0x0A, 0x01, 0x31, 0x6B, 0x1B, 0x19, 0x3C, 0x9A, 0xF1, 0x0A,
+	0x29, 0x29, 0xDB, 0x02, 0xB9, 0x09, 0x0A, 0xB0, 0xD1, 0xA5, 0xA2, 0x12,
+	0x9B, 0x91, 0x1B, 0x41, 0x1C, 0x19, 0xF3, 0x91, 0xD8, 0x03, 0x19, 0x91,
+	0x3A, 0x7A, 0x81, 0x0D, 0x10, 0x39, 0x92, 0xAA, 0xB6, 0xB4, 0x14, 0x0A,
+	0xC1, 0x21, 0xBA, 0xA3, 0x0D, 0x02, 0x09, 0xFB, 0xA4, 0x19, 0x1A, 0x10,
+	0x42, 0x89, 0x09, 0x07, 0x10, 0x23, 0x1F, 0x1A, 0x49, 0x9A, 0x82, 0xB0,
+	0x5B, 0x8A, 0xB2, 0x09, 0xA6, 0x09, 0x00, 0x20, 0xB7, 0x23, 0x98, 0x13,
+	0x61, 0x1B, 0xB9, 0x80, 0x07, 0xC2, 0x31, 0xAC, 0xF3, 0x00, 0x91, 0xB1,
+	0x99, 0x09, 0x18, 0xAD, 0xB1, 0x0A, 0x38, 0x0C, 0x78, 0x5A, 0x2A, 0x10,
+	0x84, 0x91, 0xB2, 0x1A, 0x51, 0x9D, 0x00, 0x1C, 0x8B, 0x81, 0xF1, 0x04,
+	0x29, 0x40, 0x29, 0x1A, 0x78, 0x10, 0x98, 0x82, 0x20, 0x11, 0x89, 0xF3,
+	0xB4, 0x08, 0xA8, 0xA8, 0x3A, 0xD2, 0xC9, 0xB3, 0xD3, 0x88, 0xE4, 0x01,
+	0x09, 0x02, 0x5A, 0x19, 0x19, 0x48, 0x4A, 0x99, 0x9A, 0x51, 0x18, 0x0C,
+	0x02, 0x29, 0x78, 0xA8, 0x13, 0x99, 0x25, 0x23, 0x7B, 0x89, 0x39, 0x13,
+	0x1B, 0x2B, 0x3A, 0xBF, 0xB1, 0x99, 0xBB, 0x8C, 0xAB, 0x1F, 0x9A, 0x90,
+	0x99, 0x51, 0xBB, 0x07, 0x29, 0x21, 0x18, 0xB3, 0x06, 0x01, 0x79, 0x99,
+	0xC0, 0x93, 0x90, 0xA0, 0x91, 0x3C, 0x1E, 0x29, 0x0B, 0x03, 0xA0, 0x2A,
+	0x33, 0xA4, 0x31, 0x07, 0x38, 0x19, 0x4B, 0x09, 0x19, 0xBB, 0x9B, 0xB9,
+	0x2D, 0xBB, 0xB4, 0x4B, 0x9D, 0x01, 0x09, 0x01, 0x9F, 0x18, 0x19, 0xF2,
+	0x12, 0x00, 0x18, 0x8B, 0x20, 0x12, 0x95, 0xF9, 0x81, 0x12, 0x3C, 0x0B,
+	0x5A, 0x1A, 0x4A, 0xA9, 0xB1, 0x02, 0x9B, 0x1D, 0x9A, 0x97, 0x80, 0x2B,
+	0x8F, 0x3C, 0x0B, 0x89, 0x29, 0x9B, 0xF9, 0xA3, 0xA0, 0x93, 0x5B, 0x39,
+	0x88, 0x94, 0x29, 0x28, 0x94, 0x21, 0x8E, 0x84, 0x1A, 0x15, 0x0A, 0x1C,
+	0x01, 0xC1, 0x1B, 0x6B, 0x1A, 0x84, 0x08, 0x1A, 0x02, 0x00, 0xE3, 0x40,
+	0xE2, 0x98, 0x38, 0x2B, 0x3B, 0x1B, 0xBA, 0xA0, 0x9A, 0xAF, 0x99, 0xB9,
+	0x4A, 0xEB, 0x10, 0x28, 0x79, 0x1B, 0x19, 0xA2, 0x0A, 0x13, 0x20, 0xB7,
+	0x12, 0xA0, 0xA2, 0x40, 0x22, 0x13, 0x3B, 0x2F, 0x30, 0xE9, 0x92, 0x39,
+	0x98, 0xD3, 0x10, 0xBA, 0x91, 0xF3, 0xB0, 0x21, 0x1E, 0xC3, 0x20, 0x9A,
+	0x21, 0x90, 0x81, 0x91, 0x90, 0x03, 0xF4, 0x23, 0xBA, 0x40, 0x09, 0x03,
+	0x3A, 0x43, 0x93, 0x12, 0x10, 0x3A, 0x59, 0xB1, 0x31, 0xAD, 0x20, 0x92,
+	0x7E, 0x09, 0x81, 0xA8, 0x11, 0x20, 0x1A, 0x50, 0x3A, 0xB9, 0x91, 0xA9,
+	0x02, 0x9D, 0xB2, 0xBB, 0xB3, 0x61, 0xEC, 0x1C, 0x57, 0x9C, 0x11, 0x99,
+	0x41, 0xB1, 0x0B, 0x22, 0x99, 0x23, 0xAB, 0x28, 0x42, 0x98, 0xB2, 0xA2,
+	0x10, 0x21, 0xBB, 0x51, 0x9B, 0x96, 0x82, 0x99, 0x59, 0x09, 0x19, 0x2B,
+	0x2C, 0xD2, 0x11, 0xC2, 0x0A, 0x7B, 0xB8, 0x11, 0xA0, 0x09, 0xB9, 0xAC,
+	0x70, 0x00, 0x11, 0x99, 0x13, 0x04, 0x6B, 0x32, 0x94, 0xF1, 0x20, 0x89,
+	0x80, 0x5B, 0x8A, 0x00, 0xBA, 0x7A, 0x89, 0xB3, 0x12, 0x1A, 0x9A, 0x34,
+	0x5B, 0x81, 0x0D, 0xA4, 0x3A, 0x25, 0x9D, 0xC4, 0x90, 0x83, 0xD8, 0x38,
+	0xA8, 0x18, 0x95, 0x18, 0x0D, 0x91, 0x80, 0xC3, 0x21, 0x1C, 0x01, 0x89,
+	0xA0, 0x39, 0x42, 0x90, 0xF0, 0x02, 0xA9, 0x02, 0x12, 0xFB, 0x10, 0x3B,
+	0x29, 0xB9, 0x3F, 0x01, 0x49, 0x89, 0xB8, 0x0B, 0x10, 0xAB, 0x3B, 0xBA,
+	0x29, 0xF3, 0x02, 0x9A, 0x91, 0x21, 0x2B, 0x0D, 0x19, 0x31, 0x0E, 0xA4,
+	0x0B, 0x48, 0x2B, 0x2E, 0x90, 0x3A, 0x5A, 0x0A, 0xB1, 0x32, 0xD8, 0x01,
+	0x5B, 0x99, 0x10, 0x3B, 0x1B, 0xB5, 0xB0, 0xB2, 0xBB, 0x1A, 0xF2, 0x91,
+	0x01, 0x3E, 0x90, 0x08, 0x22, 0x3E, 0x88, 0x18, 0x12, 0xA9, 0x3D, 0xF0,
+	0xA1, 0xB2, 0x39, 0x21, 0xCB, 0xD6, 0x10, 0x18, 0x1B, 0x2B, 0x2B, 0x1B,
+	0xC0, 0xC3, 0x86, 0x20, 0x6B, 0xA8, 0x49, 0x92, 0x1B, 0x12, 0x9D, 0x92,
+	0x91, 0xE1, 0x18, 0x38, 0x99, 0xF0, 0x89, 0x8C, 0x72, 0x73, 0x77, 0xF4,
+	0x1F, 0x12, 0x81, 0xAB, 0x9A, 0x62, 0x02, 0xAA, 0x8B, 0x22, 0x32, 0x47,
+	0xFA, 0x0A, 0x00, 0x11, 0x82, 0xCA, 0x28, 0x01, 0x18, 0xA9, 0x09, 0x22,
+	0x81, 0xBB, 0x30, 0x22, 0x90, 0xBE, 0x1A, 0x73, 0x91, 0x99, 0xBA, 0x58,
+	0x24, 0xBA, 0x99, 0x20, 0x23, 0xA2, 0x9F, 0x10, 0x21, 0x81, 0xA9, 0xA9,
+	0x19, 0x57, 0xA8, 0x9C, 0x11, 0x30, 0x05, 0xEB, 0x29, 0x12, 0x98, 0x81,
+	0xAB, 0x28, 0x33, 0xD0, 0x1B, 0x22, 0x41, 0xC1, 0xBF, 0x28, 0x13, 0x01,
+	0xB0, 0x9E, 0x00, 0x41, 0x13, 0xCC, 0x1B, 0x43, 0xA3, 0xAE, 0x28, 0x32,
+	0xD2, 0x8D, 0x82, 0x38, 0x04, 0xEA, 0x0A, 0x41, 0x82, 0xAA, 0x10, 0x0A,
+	0x27, 0xBC, 0x11, 0x24, 0xDB, 0x02, 0xAE, 0x34, 0x98, 0x18, 0xB9, 0x28,
+	0xB8, 0x66, 0xD8, 0x29, 0x93, 0x0D, 0x14, 0xAB, 0x10, 0x80, 0x10, 0x83,
+	0xDB, 0x1A, 0x53, 0xA8, 0x80, 0x8B, 0x20, 0x27, 0xFB, 0x18, 0x02, 0x11,
+	0xC0, 0x9F, 0x31, 0x82, 0x20, 0xFA, 0x19, 0x01, 0x21, 0xA8, 0xAB, 0x4A,
+	0x07, 0xBA, 0x21, 0xB1, 0x20, 0xD8, 0x30, 0x92, 0xBB, 0x48, 0xA2, 0x42,
+	0xEB, 0x08, 0x61, 0xB2, 0x8D, 0x81, 0x50, 0x93, 0xBD, 0x2B, 0x37, 0xA8,
+	0xA9, 0x0A, 0x12, 0x63, 0xD0, 0x0B, 0x22, 0xA9, 0x11, 0x82, 0xAD, 0x31,
+	0xB0, 0x72, 0xF1, 0x29, 0x98, 0x48, 0x93, 0x8C, 0x90, 0x18, 0x13, 0x8A,
+	0xA8, 0x4A, 0x84, 0xAC, 0x44, 0xCA, 0x29, 0x05, 0x9B, 0x12, 0xCB, 0x71,
+	0xC2, 0x0B, 0x04, 0x99, 0x30, 0xB2, 0x8F, 0x14, 0xAA, 0x31, 0xC0, 0x39,
+	0xA4, 0x8C, 0x02, 0x09, 0x01, 0x11, 0xCD, 0x31, 0x91, 0x8A, 0x81, 0x6B,
+	0x95, 0x8C, 0x81, 0x1A, 0x34, 0xA9, 0xB9, 0x2B, 0x05, 0x21, 0xDA, 0x0A,
+	0x41, 0x03, 0xAC, 0x01, 0xB9, 0x2A, 0x37, 0x8B, 0x92, 0xBD, 0x40, 0x15,
+	0x9C, 0x03, 0x9C, 0x32, 0xBA, 0x40, 0x93, 0xAF, 0x41, 0xA0, 0x28, 0xA4,
+	0x0F, 0x02, 0x89, 0x21, 0xC8, 0x1B, 0x33, 0xA8, 0x33, 0xFE, 0x28, 0x13,
+	0x9A, 0x91, 0x9E, 0x34, 0xA1, 0xBB, 0x10, 0x10, 0x46, 0xE8, 0x0B, 0x22,
+	0x00, 0x81, 0xBC, 0x31, 0x02, 0xB8, 0x3A, 0xB2, 0x29, 0x30, 0xC3, 0x1B,
+	0xFC, 0x1C, 0x37, 0xB0, 0x8B, 0x99, 0x50, 0x04, 0xB9, 0x9C, 0x43, 0x81,
+	0x88, 0xE0, 0x0C, 0x35, 0xA8, 0x88, 0xB8, 0x8A, 0x46, 0xA0, 0x89, 0x98,
+	0x18, 0x15, 0xB9, 0xA8, 0x28, 0x02, 0x54, 0xF8, 0x0A, 0x02, 0x10, 0x82,
+	0xBE, 0x41, 0x82, 0x9B, 0x22, 0xBA, 0x09, 0x63, 0xA0, 0x1A, 0xD1, 0x1C,
+	0x17, 0xA8, 0x89, 0x80, 0x3A, 0x17, 0xAA, 0x9A, 0x40, 0x82, 0x39, 0xC1,
+	0x9D, 0x20, 0x92, 0x61, 0xD8, 0x19, 0x81, 0x28, 0xB3, 0x9D, 0x11, 0x52,
+	0xA1, 0x9F, 0x20, 0x80, 0x23, 0xDB, 0x28, 0x81, 0x8B, 0x24, 0xC9, 0x28,
+	0x91, 0x1C, 0x26, 0xD9, 0x2A, 0x82, 0x09, 0x02, 0xEA, 0x39, 0x14, 0x9A,
+	0xB0, 0x2C, 0x16, 0x89, 0x89, 0x08, 0x98, 0x21, 0x82, 0x8B, 0x91, 0x0D,
+	0x26, 0xBC, 0x28, 0x12, 0x02, 0xAD, 0x18, 0x88, 0x36, 0xDC, 0x30, 0xA1,
+	0x1A, 0x84, 0xCA, 0x09, 0x36, 0xC0, 0x0A, 0xA1, 0x39, 0x27, 0xDB, 0x19,
+	0x12, 0x09, 0x12, 0xF9, 0x0C, 0x34, 0x90, 0xA9, 0x99, 0x29, 0x17, 0xA9,
+	0x09, 0x01, 0x10, 0xAA, 0x24, 0xDA, 0x48, 0x92, 0x9E, 0x22, 0x03, 0xDD,
+	0x28, 0x83, 0x41, 0xE9, 0x8A, 0x32, 0x04, 0xCC, 0x28, 0x81, 0x11, 0xB0,
+	0x0B, 0xA2, 0x50, 0x93, 0x9C, 0x32, 0xFB, 0x18, 0x81, 0x53, 0xB0, 0xBA,
+	0x0B, 0x35, 0x01, 0x8A, 0xC1, 0x8D, 0x32, 0x83, 0x98, 0xDC, 0x1A, 0x37,
+	0xB1, 0x9D, 0x00, 0x41, 0xA2, 0x8E, 0x22, 0xA9, 0x19, 0x00, 0x32, 0xB0,
+	0xAD, 0x08, 0x41, 0x25, 0xFB, 0x2B, 0x22, 0x20, 0xB1, 0xCF, 0x32, 0x81,
+	0x80, 0x9A, 0xB9, 0x60, 0x03, 0xAA, 0x11, 0xAC, 0x02, 0x08, 0x45, 0xF8,
+	0x1B, 0x22, 0x80, 0x00, 0xBC, 0x18, 0x73, 0xA1, 0xAB, 0x10, 0x88, 0x52,
+	0xA2, 0xAC, 0x21, 0x01, 0xAA, 0x21, 0x90, 0x58, 0xF0, 0x1D, 0x34, 0x90,
+	0xB8, 0xAF, 0x52, 0x02, 0xA9, 0x9A, 0x08, 0x22, 0x02, 0x9A, 0xB8, 0x59,
+	0xC2, 0x3C, 0x85, 0x8D, 0x03, 0x0A, 0x82, 0x09, 0xC8, 0x28, 0x02, 0x18,
+	0x91, 0xCD, 0x08, 0x25, 0xAA, 0x61, 0xB1, 0x1C, 0xA3, 0x0D, 0x16, 0xAA,
+	0x88, 0x30, 0x92, 0x38, 0xF8, 0x2B, 0x93, 0x5A, 0x84, 0xAC, 0x08, 0x11,
+	0x90, 0x21, 0xCA, 0x61, 0xC1, 0x8A, 0x12, 0x89, 0x05, 0x9A, 0x18, 0xFB,
+	0x48, 0x03, 0x31, 0xFB, 0x0E, 0x23, 0x80, 0xA8, 0xBB, 0x78, 0x04, 0xAA,
+	0x08, 0x88, 0x21, 0x81, 0xAB, 0x11, 0xCA, 0x48, 0x26, 0xAA, 0x00, 0xAE,
+	0x41, 0x83, 0x89, 0x98, 0xA9, 0x29, 0x15, 0x99, 0x52, 0xE8, 0x09, 0x00,
+	0x20, 0x23, 0xE0, 0xAD, 0x31, 0x23, 0x92, 0x9F, 0xA9, 0x58, 0x04, 0x99,
+	0x91, 0xAE, 0x52, 0x92, 0x98, 0xA9, 0x19, 0x11, 0x33, 0xC9, 0xAA, 0x8A,
+	0x23, 0x64, 0xA1, 0xCA, 0x9A, 0x30, 0x46, 0xA0, 0x9C, 0xA0, 0x38, 0x16,
+	0xA0, 0x9B, 0x10, 0x09, 0x14, 0x98, 0x88, 0x91, 0x9E, 0x53, 0x80, 0x82,
+	0xDC, 0x19, 0x32, 0x88, 0x02, 0xBC, 0x8A, 0x43, 0x13, 0xD8, 0x8B, 0x8A,
+	0x55, 0xB8, 0x28, 0xE2, 0x2B, 0x85, 0x09, 0x92, 0x0C, 0x23, 0xBB, 0x2A,
+	0x92, 0x6A, 0x95, 0x8D, 0x22, 0xB0, 0x0A, 0x34, 0xBA, 0x1A, 0x91, 0x0B,
+	0x07, 0x8B, 0x36, 0x98, 0xCC, 0x2A, 0x04, 0x10, 0xA1, 0x0C, 0x92, 0xAD,
+	0x50, 0x25, 0xB9, 0xAB, 0x20, 0x00, 0x35, 0xD8, 0x0B, 0x03, 0x9B, 0x34,
+	0xD9, 0x20, 0x98, 0x38, 0x93, 0x9C, 0x80, 0x20, 0xF1, 0x39, 0x83, 0x18,
+	0xD0, 0x9B, 0x22, 0x22, 0x12, 0xC9, 0x99, 0xCF, 0x21, 0x20, 0x37, 0xE9,
+	0x8A, 0x00, 0x21, 0x12, 0xA9, 0xBD, 0x49, 0x13, 0x11, 0xFC, 0x19, 0x43,
+	0x01, 0xBC, 0x09, 0x8A, 0x73, 0x02, 0x8A, 0xB8, 0x9B, 0x11, 0x62, 0x14,
+	0xC8, 0xBC, 0x29, 0x63, 0x12, 0xDA, 0x8A, 0x20, 0x13, 0xA0, 0xCB, 0x18,
+	0x02, 0x41, 0x83, 0xAE, 0x88, 0x19, 0x43, 0x23, 0xEA, 0xAC, 0x10, 0x30,
+	0x26, 0xB8, 0xAC, 0x19, 0x43, 0x02, 0xD9, 0x9B, 0x12, 0x11, 0x00, 0x21,
+	0xD8, 0xAC, 0x28, 0x23, 0x44, 0xC1, 0x9D, 0xA8, 0x19, 0x55, 0x02, 0xC9,
+	0xAB, 0x28, 0x23, 0x32, 0x98, 0xBA, 0x9B, 0xDA, 0x71, 0x04, 0xA9, 0x18,
+	0x98, 0x39, 0x85, 0xAC, 0x18, 0x83, 0x9C, 0x11, 0x9A, 0x74, 0xA1, 0x9D,
+	0x21, 0x80, 0x21, 0xC0, 0x9D, 0x21, 0x90, 0x60, 0x84, 0xBB, 0x99, 0xAA,
+	0x64, 0x02, 0x90, 0xDB, 0x0B, 0x42, 0x24, 0xA0, 0xAB, 0x99, 0x1A, 0x25,
+	0x11, 0xA1, 0xCE, 0x2A, 0x34, 0x02, 0xDA, 0x9A, 0x09, 0x54, 0x01, 0x9A,
+	0x9A, 0x9A, 0x72, 0x12, 0x90, 0xBA, 0x99, 0x99, 0x54, 0x82, 0xBA, 0x88,
+	0xA9, 0x74, 0x82, 0x8A, 0xD8, 0xAC, 0x31, 0x23, 0x41, 0xA2, 0xBF, 0x00,
+	0x80, 0x34, 0x82, 0xDB, 0xAB, 0x09, 0x53, 0x34, 0x91, 0xDB, 0x99, 0x08,
+	0x52, 0x02, 0xBA, 0xBA, 0x08, 0x61, 0x35, 0x90, 0xBB, 0xBB, 0x48, 0x23,
+	0x93, 0xDF, 0x88, 0x11, 0x33, 0x92, 0xDB, 0x99, 0x18, 0x53, 0x01, 0xCA,
+	0xAB, 0xAC, 0x72, 0x15, 0x90, 0xA8, 0xAC, 0x20, 0x23, 0x11, 0xD8, 0xAB,
+	0x18, 0x43, 0x23, 0xA1, 0xBD, 0x89, 0x21, 0x24, 0xA0, 0xCF, 0x09, 0x22,
+	0x43, 0x83, 0xCB, 0xAB, 0x09, 0x42, 0x34, 0x91, 0xCE, 0x99, 0x10, 0x33,
+	0x24, 0xC8, 0xAB, 0x89, 0x31, 0x33, 0xEA, 0x9C, 0x18, 0x23, 0x82, 0xBA,
+	0x9A, 0x08, 0x74, 0x14, 0xA9, 0xAB, 0x8B, 0x22, 0x62, 0x03, 0xB9, 0x0B,
+	0x82, 0x1A, 0x37, 0x91, 0xA8, 0xFB, 0x9C, 0x41, 0x12, 0x88, 0x91, 0xAB,
+	0x41, 0x12, 0xA8, 0xBD, 0xAA, 0x30, 0x34, 0x15, 0xAA, 0x08, 0x10, 0x99,
+	0x19, 0xE0, 0xBF, 0x1A, 0xA0, 0x39, 0x25, 0x98, 0x31, 0x21, 0x20, 0x20,
+	0xEA, 0xAC, 0xFB, 0x0A, 0x44, 0x23, 0xA0, 0x8B, 0x31, 0x11, 0x23, 0xED,
+	0xAA, 0x18, 0x52, 0x02, 0x10, 0x81, 0x98, 0xCF, 0x18, 0x23, 0x90, 0x00,
+	0xFB, 0x8D, 0x32, 0x12, 0x24, 0xC9, 0xAD, 0x09, 0x22, 0x23, 0xC8, 0xBD,
+	0x1A, 0x53, 0x03, 0xA9, 0x1A, 0xC8, 0x19, 0x24, 0x00, 0xA8, 0xCA, 0x9A,
+	0x70, 0x23, 0x01, 0x08, 0x00, 0x88, 0x08, 0x89, 0x8A, 0xCF, 0xAB, 0x73,
+	0x17, 0x11, 0x91, 0xBC, 0x89, 0x88, 0x11, 0xAA, 0x60, 0x24, 0xB9, 0xAD,
+	0x29, 0x34, 0x24, 0xB8, 0xCF, 0x99, 0x80, 0x30, 0x14, 0x11, 0x00, 0x10,
+	0xDA, 0xAB, 0xA8, 0x8C, 0x12, 0xDA, 0x41, 0x00, 0x33, 0xC8, 0xAA, 0xA9,
+	0x42, 0x92, 0xB8, 0xCE, 0x19, 0x43, 0x53, 0x12, 0xA8, 0xCB, 0xBC, 0xAC,
+	0x99, 0xB9, 0x8A, 0xB8, 0x58, 0x24, 0x53, 0x04, 0xDB, 0x99, 0x88, 0x22,
+	0x91, 0x61, 0x02, 0x51, 0x15, 0x20, 0x90, 0x8A, 0x88, 0xA9, 0x9A, 0xD8,
+	0x2C, 0x37, 0x23, 0x01, 0x98, 0x9A, 0x28, 0x73, 0x02, 0x9A, 0x80, 0x1A,
+	0x37, 0x11, 0x34, 0x81, 0xBB, 0xBC, 0x8C, 0x31, 0x27, 0x12, 0xB9, 0xAE,
+	0x10, 0x41, 0x24, 0x88, 0xBA, 0x9D, 0x89, 0x18, 0x82, 0x8A, 0x32, 0x00,
+	0x75, 0x04, 0x88, 0xC8, 0x9E, 0x00, 0x20, 0x03, 0x99, 0xB9, 0x8C, 0x90,
+	0xCC, 0xBC, 0xDD, 0xBC, 0xAB, 0x1A, 0x53, 0x11, 0xA0, 0xAB, 0xCB, 0x9A,
+	0x89, 0x98, 0xBA, 0xBA, 0xCD, 0x09, 0x88, 0x30, 0x21, 0x03, 0xFB, 0xAE,
+	0x9A, 0xDB, 0x1A, 0x33, 0x74, 0x33, 0x23, 0x02, 0x09, 0x63, 0x33, 0x21,
+	0x17, 0x98, 0x21, 0x12, 0x20, 0x77, 0x02, 0x01, 0xA8, 0x9A, 0x08, 0x11,
+	0x21, 0x14, 0x22, 0x02, 0x00, 0xBA, 0x60, 0x02, 0x09, 0xDA, 0x8C, 0x20,
+	0x11, 0x73, 0x02, 0x00, 0xA0, 0x09, 0x83, 0xDE, 0xAB, 0x9A, 0x19, 0x90,
+	0x19, 0xC0, 0x30, 0x94, 0x8A, 0xB0, 0x8B, 0xFA, 0xAF, 0x9A, 0x88, 0x31,
+	0x91, 0x9C, 0xDD, 0xBC, 0xBC, 0xBA, 0xCD, 0xBB, 0xAE, 0x09, 0x10, 0x12,
+	0x81, 0xAA, 0xDA, 0xBC, 0xBA, 0x9B, 0xA8, 0xBB, 0xCB, 0xBD, 0x88, 0x88,
+	0x80, 0x38, 0x45, 0x24, 0x81, 0x8A, 0x44, 0x62, 0x36, 0x01, 0x43, 0x11,
+	0x34, 0x10, 0x34, 0x22, 0x34, 0x01, 0x02, 0xB8, 0x9B, 0x64, 0x12, 0x31,
+	0x12, 0x01, 0xC8, 0x29, 0x55, 0x01, 0x09, 0x99, 0x8A, 0x11, 0xA8, 0x11,
+	0xFA, 0x49, 0x81, 0x30, 0x92, 0x30, 0xFA, 0x9F, 0x80, 0x00, 0x82, 0x9A,
+	0x81, 0xBC, 0x31, 0x11, 0x11, 0xB8, 0xCF, 0x18, 0x80, 0x22, 0x99, 0x88,
+	0x19, 0x00, 0xD9, 0xAF, 0xB8, 0xCE, 0xCB, 0xCB, 0xBB, 0xBE, 0xBB, 0xBC,
+	0xBB, 0xBB, 0xDA, 0xDE, 0xBB, 0x99, 0x18, 0x22, 0x03, 0xA9, 0xDD, 0x8B,
+	0x90, 0x19, 0x92, 0x9D, 0x88, 0x1A, 0x44, 0x23, 0x63, 0x23, 0x31, 0x46,
+	0x01, 0x13, 0x88, 0x41, 0x32, 0x37, 0x12, 0x11, 0x02, 0x2A, 0x37, 0x88,
+	0x22, 0xD9, 0x09, 0xA9, 0x73, 0x01, 0x11, 0x88, 0x9A, 0x10, 0x08, 0x55,
+	0xA8, 0x09, 0xCA, 0x0A, 0x01, 0x21, 0x02, 0x9A, 0x19, 0xA1, 0x30, 0xF1,
+	0x9C, 0xCB, 0x20, 0x34, 0x02, 0xA8, 0xCE, 0x18, 0x22, 0x62, 0x82, 0xBB,
+	0xBA, 0x8B, 0x02, 0x30, 0x13, 0xA9, 0xCF, 0x0A, 0x00, 0x82, 0xCF, 0xBC,
+	0xBC, 0xDB, 0xAC, 0xAC, 0x9B, 0xCB, 0xAA, 0xDB, 0xBC, 0xBD, 0xAC, 0x18,
+	0x21, 0x32, 0x81, 0xBA, 0xAB, 0x0A, 0x80, 0x99, 0x9A, 0x38, 0x57, 0x53,
+	0x23, 0x22, 0x30, 0x57, 0x34, 0x33, 0x02, 0x08, 0x99, 0x30, 0x37, 0x24,
+	0x12, 0x81, 0x8A, 0x52, 0x33, 0x13, 0xB8, 0xBE, 0x88, 0x80, 0x00, 0x98,
+	0x99, 0x23, 0x48, 0x37, 0xA0, 0x20, 0x91, 0x11, 0xBB, 0x51, 0xF8, 0xBB,
+	0xAA, 0x29, 0x45, 0x32, 0x81, 0xEB, 0x8B, 0x09, 0x43, 0x03, 0xA9, 0xBC,
+	0x9C, 0x18, 0x00, 0x25, 0xB1, 0x89, 0xB8, 0x1B, 0x83, 0xEB, 0xC9, 0xBD,
+	0x08, 0xA0, 0xBB, 0xFB, 0xAE, 0xCA, 0x9A, 0xCA, 0xBC, 0xDD, 0xAB, 0xAB,
+	0xAB, 0xBA, 0xBE, 0xBC, 0x9A, 0x00, 0x22, 0x23, 0x98, 0x98, 0x9C, 0x21,
+	0x88, 0x13, 0xCD, 0x30, 0x46, 0x36, 0x13, 0x21, 0x22, 0x73, 0x35, 0x23,
+	0x13, 0x88, 0x00, 0x19, 0x36, 0x22, 0x32, 0xA1, 0x38, 0xB2, 0x4A, 0xB3,
+	0x9F, 0x01, 0xBA, 0x18, 0xDA, 0x28, 0xA0, 0x39, 0x15, 0x28, 0x16, 0x80,
+	0x11, 0x02, 0x21, 0x92, 0xAB, 0xCE, 0x9A, 0x09, 0xA8, 0x31, 0xB1, 0x8C,
+	0x32, 0x80, 0x03, 0xBF, 0xA9, 0xDE, 0x28, 0x81, 0x19, 0x85, 0x29, 0x23,
+	0x91, 0xF9, 0x9D, 0x90, 0xBB, 0xBA, 0xBC, 0xDB, 0xAD, 0x80, 0xB9, 0xDB,
+	0xCD, 0xBC, 0xBC, 0xBB, 0xBD, 0xAC, 0xAB, 0xAB, 0xCC, 0xBC, 0xBA, 0x10,
+	0x01, 0x30, 0x91, 0x30, 0x91, 0x2B, 0x84, 0x0A, 0x67, 0x11, 0x43, 0x33,
+	0x45, 0x43, 0x43, 0x43, 0x12, 0x12, 0x20, 0x33, 0x00, 0x13, 0x80, 0x44,
+	0x80, 0x44, 0x80, 0x53, 0x98, 0x12, 0xFB, 0x89, 0xD9, 0x09, 0xA9, 0x0A,
+	0x12, 0x18, 0x23, 0x18, 0x26, 0x10, 0x36, 0x11, 0x02, 0xEB, 0xAA, 0xAB,
+	0x20, 0x01, 0x32, 0xB8, 0x20, 0xD0, 0x73, 0x17, 0x08, 0xA8, 0xAD, 0x89,
+	0x09, 0x81, 0xAA, 0x88, 0x1A, 0x53, 0x33, 0x12, 0xA8, 0xCA, 0x9A, 0xC9,
+	0xEC, 0xCC, 0xCA, 0x9A, 0x98, 0x9A, 0xB8, 0xBF, 0xBA, 0xBD, 0xBC, 0xCC,
+	0xAA, 0xDA, 0xBB, 0xEB, 0xAB, 0x9A, 0x08, 0x80, 0x21, 0x01, 0x12, 0x28,
+	0x47, 0x11, 0x32, 0x22, 0x34, 0x22, 0x54, 0x34, 0x54, 0x24, 0x21, 0x02,
+	0x31, 0x14, 0x31, 0x83, 0x09, 0x91, 0x8C, 0x13, 0x09, 0x83, 0xAF, 0x30,
+	0xB1, 0x41, 0xF0, 0x9B, 0xB8, 0x1A, 0x91, 0x1A, 0x81, 0x39, 0x94, 0x4A,
+	0x25, 0x50, 0x15, 0x19, 0x24, 0x98, 0xA9, 0xBA, 0xAB, 0x9B, 0x72, 0x03,
+	0x89, 0xBB, 0x3A, 0x16, 0x32, 0x16, 0xA9, 0xBA, 0xAD, 0x09, 0x89, 0x8A,
+	0x20, 0xA1, 0xAC, 0x31, 0x81, 0xAA, 0xAB, 0xA9, 0xFF, 0xAF, 0xB9, 0xBB,
+	0xDB, 0xAC, 0xBA, 0xBC, 0xBB, 0xCD, 0xCC, 0xBA, 0x9C, 0xA9, 0xDB, 0xCB,
+	0xBB, 0x8A, 0x08, 0x21, 0x12, 0x80, 0x01, 0x40, 0x47, 0x21, 0x43, 0x13,
+	0x53, 0x24, 0x32, 0x35, 0x42, 0x33, 0x23, 0x53, 0x12, 0x01, 0x12, 0x81,
+	0x30, 0x01, 0x21, 0xFA, 0xBA, 0x9B, 0x01, 0x80, 0xB0, 0xAF, 0xA9, 0xAB,
+	0x00, 0xA9, 0xBE, 0x08, 0x21, 0x15, 0x0A, 0x81, 0x38, 0x26, 0x64, 0x24,
+	0x02, 0xA0, 0x9A, 0x88, 0x89, 0x23, 0x92, 0xDA, 0xCE, 0x19, 0x31, 0x34,
+	0x11, 0xBA, 0x9D, 0x98, 0x01, 0x80, 0xAA, 0xB0, 0x9C, 0x01, 0x49, 0x14,
+	0x99, 0xCB, 0xBD, 0xD9, 0xBE, 0xBB, 0xDC, 0xCB, 0xBB, 0xCB, 0xBA, 0xBC,
+	0xBD, 0xBC, 0xBB, 0xAD, 0xBB, 0xAD, 0xCB, 0xCC, 0xCB, 0x99, 0x08, 0x00,
+	0x82, 0x8A, 0x01, 0x48, 0x37, 0x33, 0x35, 0x23, 0x53, 0x23, 0x31, 0x26,
+	0x43, 0x22, 0x31, 0x32, 0x12, 0x21, 0x43, 0x11, 0x89, 0x21, 0xD8, 0x9A,
+	0xCD, 0x09, 0xC0, 0x0B, 0xC8, 0x8B, 0xB0, 0x8B, 0xA2, 0xAF, 0x80, 0x09,
+	0x13, 0x9B, 0x67, 0x00, 0x08, 0x90, 0x40, 0x32, 0x54, 0x03, 0x9A, 0xAA,
+	0x09, 0x21, 0x23, 0x11, 0xB8, 0xDF, 0x89, 0x22, 0x80, 0x90, 0xBB, 0x02,
+	0xAD, 0x42, 0x90, 0x90, 0xCC, 0x08, 0x98, 0x21, 0xB9, 0xDF, 0xBA, 0x09,
+	0x90, 0xAC, 0xCC, 0xBA, 0xDB, 0xBC, 0xAB, 0xDA, 0xDC, 0xCB, 0xBB, 0xCC,
+	0xCA, 0xBA, 0xBA, 0xCC, 0xCA, 0xAA, 0x09, 0x88, 0x10, 0x00, 0x00, 0x42,
+	0x45, 0x34, 0x34, 0x34, 0x33, 0x33, 0x45, 0x24, 0x33, 0x24, 0x12, 0x12,
+	0x02, 0x31, 0x01, 0x52, 0xB1, 0x1B, 0xA1, 0x8C, 0xA8, 0x8E, 0xA0, 0xBD,
+	0xB8, 0xCC, 0x9A, 0xAA, 0xA9, 0x9A, 0x08, 0x08, 0x73, 0x12, 0x01, 0x44,
+	0x25, 0x23, 0x81, 0x98, 0x9B, 0x73, 0x23, 0x80, 0xCC, 0x18, 0x80, 0x41,
+	0x12, 0x10, 0xB8, 0x1A, 0x36, 0x02, 0xD8, 0xAC, 0x08, 0x99, 0x20, 0x81,
+	0x81, 0xBC, 0x10, 0xD9, 0x38, 0xC1, 0xCD, 0xDD, 0x8A, 0xA8, 0xBA, 0xEB,
+	0xAA, 0xB9, 0xBC, 0xAA, 0xBC, 0xCA, 0xCE, 0xBB, 0xDB, 0xBB, 0xBD, 0xBC,
+	0xBC, 0xAC, 0x9A, 0x89, 0x88, 0x01, 0x01, 0x10, 0x75, 0x33, 0x44, 0x23,
+	0x42, 0x23, 0x32, 0x34, 0x42, 0x13, 0x11, 0x43, 0x21, 0x31, 0x03, 0x21,
+	0xA8, 0x39, 0x24, 0x90, 0xBD, 0xBA, 0xDF, 0xAA, 0xA9, 0xA9, 0xCC, 0xAB,
+	0xCA, 0x9A, 0x88, 0x20, 0x12, 0x80, 0x51, 0x44, 0x34, 0x32, 0x44, 0x02,
+	0x10, 0x90, 0x11, 0x81, 0x62, 0x91, 0x8C, 0xA9, 0x48, 0x12, 0x32, 0x12,
+	0x91, 0x1D, 0x14, 0x9A, 0xB2, 0xCF, 0x98, 0xAB, 0x91, 0x9B, 0x98, 0x9A,
+	0x11, 0x40, 0xA2, 0x60, 0xB2, 0xBF, 0xCB, 0xAC, 0xCA, 0xBC, 0xBC, 0xCB,
+	0xBA, 0xBC, 0xBD, 0xDB, 0xBB, 0xBC, 0xBC, 0xBC, 0xCC, 0xCB, 0xCB, 0xAA,
+	0x89, 0x98, 0x08, 0x10, 0x40, 0x55, 0x32, 0x36, 0x32, 0x24, 0x22, 0x43,
+	0x13, 0x22, 0x33, 0x32, 0x23, 0x08, 0x43, 0xA9, 0x73, 0x81, 0x31, 0x91,
+	0x1A, 0xE9, 0x9A, 0xC8, 0xAC, 0xC9, 0xCC, 0xAA, 0xBB, 0xCA, 0xAA, 0x88,
+	0x08, 0x80, 0x32, 0x16, 0x11, 0x63, 0x43, 0x35, 0x12, 0x00, 0x01, 0x11,
+	0x12, 0x08, 0x10, 0xB0, 0xAC, 0x40, 0x45, 0x11, 0x01, 0x09, 0x02, 0x18,
+	0x37, 0xA9, 0xB9, 0xDF, 0xA9, 0xA9, 0x00, 0xA8, 0xAA, 0xAC, 0x28, 0x23,
+	0x02, 0x11, 0x02, 0xEA, 0xBC, 0xDB, 0xDB, 0xCC, 0xCB, 0xBC, 0xBB, 0xCB,
+	0xCC, 0xCB, 0xCB, 0xBB, 0xCB, 0xBC, 0xDB, 0xCB, 0xBB, 0x8A, 0x88, 0x08,
+	0x81, 0x30, 0x37, 0x54, 0x34, 0x43, 0x43, 0x11, 0x43, 0x21, 0x42, 0x12,
+	0x20, 0x80, 0x19, 0x02, 0x09, 0x12, 0xA9, 0x11, 0x99, 0x33, 0xB9, 0xCD,
+	0xBE, 0xCA, 0xCB, 0xDA, 0xBC, 0xBA, 0xAD, 0x9A, 0x9A, 0x08, 0x88, 0x10,
+	0x88, 0x73, 0x43, 0x53, 0x33, 0x32, 0x13, 0x80, 0x21, 0x63, 0x35, 0x01,
+	0x80, 0xBA, 0x9A, 0x39, 0x36, 0x45, 0x02, 0x99, 0xBA, 0x0A, 0x23, 0x22,
+	0xA0, 0xDE, 0xBC, 0xAC, 0x8B, 0x80, 0x9A, 0x99, 0x8B, 0x23, 0x00, 0x80,
+	0x9A, 0x64, 0x12, 0xB0, 0xBF, 0xCD, 0xAD, 0xCB, 0xAA, 0xAA, 0xBD, 0xCD,
+	0xBB, 0xBB, 0xCB, 0xCB, 0xDB, 0xAB, 0x9A, 0x89, 0x11, 0x11, 0x54, 0x31,
+	0x55, 0x33, 0x35, 0x22, 0x43, 0x22, 0x43, 0x21, 0x12, 0x00, 0x11, 0x98,
+	0x22, 0x01, 0x23, 0xBC, 0x89, 0x9A, 0x35, 0x99, 0xAA, 0xEF, 0xAA, 0xBC,
+	0xAB, 0xCB, 0xBB, 0xBD, 0xAA, 0xAA, 0x09, 0x08, 0x10, 0x44, 0x34, 0x42,
+	0x32, 0x43, 0x23, 0x54, 0x22, 0x32, 0x90, 0x28, 0xA0, 0x70, 0x93, 0x18,
+	0x92, 0x71, 0x03, 0x40, 0x81, 0x60, 0x14, 0x32, 0x82, 0x8A, 0xEA, 0xAC,
+	0x98, 0x9A, 0xD9, 0xBC, 0xBB, 0xAC, 0x88, 0x18, 0x22, 0x22, 0x11, 0x08,
+	0x21, 0x14, 0x80, 0xED, 0xBD, 0xDB, 0xBC, 0xEB, 0xBB, 0xBC, 0xBB, 0xBC,
+	0xBC, 0xBC, 0xBB, 0x99, 0x10, 0x23, 0x42, 0x34, 0x44, 0x45, 0x43, 0x33,
+	0x22, 0x33, 0x32, 0x43, 0x22, 0x12, 0x80, 0x01, 0x89, 0x11, 0x98, 0x12,
+	0x08, 0x15, 0x10, 0x11, 0xE9, 0xEB, 0xCC, 0xAA, 0xBC, 0xBC, 0xBC, 0xAD,
+	0xBB, 0x9A, 0x9A, 0x08, 0x08, 0x81, 0x32, 0x56, 0x43, 0x22, 0x33, 0x22,
+	0x32, 0x13, 0x53, 0x22, 0x21, 0x02, 0x31, 0x14, 0x45, 0x91, 0x41, 0x82,
+	0x72, 0x27, 0x12, 0x91, 0xA9, 0xA9, 0x0A, 0x32, 0x81, 0xF9, 0xBE, 0xBC,
+	0x99, 0x08, 0x00, 0x88, 0xA8, 0xBA, 0x0A, 0x31, 0x43, 0x24, 0xA0, 0xBB,
+	0xDE, 0xCA, 0xCC, 0xCB, 0xCA, 0xBA, 0xBC, 0xBD, 0xBD, 0xBB, 0xBC, 0xBB,
+	0xBC, 0x9A, 0x99, 0x08, 0x41, 0x34, 0x35, 0x35, 0x35, 0x34, 0x33, 0x42,
+	0x22, 0x32, 0x22, 0x22, 0x11, 0x08, 0xB9, 0x99, 0x99, 0x20, 0xA0, 0x18,
+	0xBA, 0x18, 0xEA, 0x08, 0xFB, 0xBC, 0xCE, 0xBB, 0xBD, 0xBB, 0xCC, 0xBA,
+	0xAA, 0x99, 0x89, 0x08, 0x11, 0x54, 0x43, 0x34, 0x34, 0x32, 0x23, 0x23,
+	0x31, 0x24, 0x10, 0x80, 0xAB, 0x11, 0x42, 0x01, 0x54, 0x22, 0x77, 0x14,
+	0x11, 0x88, 0x08, 0x88, 0x10, 0xA8, 0xDB, 0xCE, 0x9A, 0xAB, 0x98, 0xAA,
+	0x89, 0x89, 0x22, 0x20, 0x53, 0x31, 0x35, 0x12, 0x90, 0xBB, 0xCD, 0xBD,
+	0xCD, 0xCB, 0xBA, 0xCB, 0xCB, 0xAC, 0xAC, 0xBB, 0xCB, 0xCA, 0xCB, 0xBB,
+	0x9B, 0x18, 0x01, 0x53, 0x12, 0x63, 0x45, 0x53, 0x32, 0x32, 0x24, 0x32,
+	0x33, 0x32, 0x02, 0x11, 0x01, 0x88, 0xA8, 0xDB, 0xAB, 0xAB, 0x89, 0xB9,
+	0x9A, 0xEB, 0xBB, 0xDB, 0xAC, 0xCB, 0xAB, 0xEC, 0xBC, 0xBB, 0xAB, 0xBB,
+	0x9A, 0xA9, 0x9A, 0x18, 0x64, 0x24, 0x53, 0x24, 0x32, 0x34, 0x33, 0x32,
+	0x12, 0x12, 0x31, 0x22, 0x98, 0xFB, 0xAB, 0x88, 0x42, 0x24, 0x11, 0x9A,
+	0x72, 0x42, 0x45, 0x43, 0x13, 0x80, 0x88, 0x88, 0x81, 0xC9, 0xCB, 0xBF,
+	0xCB, 0xAC, 0x9B, 0xAA, 0xA9, 0xBB, 0x99, 0x99, 0x10, 0x89, 0x88, 0x09,
+	0xB8, 0xDF, 0xCD, 0xBC, 0xBD, 0xCC, 0xBB, 0xBD, 0xBC, 0xCC, 0x9A, 0x88,
+	0x80, 0x21, 0x22, 0x73, 0x33, 0x36, 0x24, 0x24, 0x23, 0x23, 0x12, 0x22,
+	0x01, 0x80, 0xA8, 0xAA, 0xDC, 0xAB, 0xBB, 0xAA, 0xA9, 0x09, 0x32, 0x24,
+	0x82, 0x80, 0x90, 0x09, 0xD0, 0xDE, 0xCD, 0xBB, 0xBC, 0xBB, 0xBB, 0xAB,
+	0xAB, 0x99, 0x32, 0x55, 0x34, 0x53, 0x53, 0x32, 0x24, 0x21, 0x21, 0x11,
+	0x01, 0x08, 0x98, 0xAB, 0xCC, 0xCB, 0x0A, 0x00, 0x20, 0x22, 0x53, 0x33,
+	0x34, 0x34, 0x33, 0x13, 0x81, 0xEC, 0xAB, 0xBA, 0xBD, 0xCC, 0xBB, 0xBA,
+	0xAB, 0xA9, 0x19, 0xA8, 0x39, 0x92, 0x72, 0x91, 0xBC, 0xCE, 0xBB, 0xDB,
+	0xBC, 0xBD, 0xAD, 0xAC, 0xAC, 0xCB, 0xBB, 0xDB, 0xAC, 0xAC, 0x89, 0x00,
+	0x10, 0x11, 0x41, 0x45, 0x53, 0x53, 0x32, 0x33, 0x33, 0x33, 0x34, 0x13,
+	0x11, 0x00, 0x88, 0x90, 0xBD, 0xBA, 0xAD, 0x98, 0xBA, 0x99, 0x88, 0xA9,
+	0xBA, 0xBB, 0x8A, 0xBA, 0xDF, 0xEB, 0xCB, 0xBB, 0xBC, 0xAA, 0xBA, 0xB9,
+	0xAC, 0x8A, 0x32, 0x55, 0x33, 0x43, 0x44, 0x43, 0x22, 0x32, 0x22, 0x13,
+	0x21, 0x43, 0x32, 0x91, 0xDB, 0x9A, 0x30, 0x12, 0x10, 0xC0, 0x29, 0x92,
+	0x30, 0xA3, 0x2C, 0x05, 0x0A, 0xB9, 0x8A, 0xDF, 0x89, 0xDB, 0x09, 0xD9,
+	0xAB, 0xDB, 0x8B, 0xCA, 0xAD, 0xAB, 0xAA, 0xCC, 0xBC, 0xCC, 0xAA, 0xBB,
+	0xCB, 0xBD, 0xBC, 0xDB, 0xCB, 0xCB, 0xBC, 0xDB, 0xBB, 0xBB, 0x08, 0x88,
+	0x11, 0x10, 0x75, 0x43, 0x35, 0x33, 0x34, 0x33, 0x43, 0x43, 0x22, 0x02,
+	0x11, 0x88, 0x89, 0xC9, 0xCB, 0xCB, 0xAA, 0xB9, 0xAB, 0xAA, 0x89, 0xA9,
+	0x09, 0x08, 0x40, 0x91, 0xAC, 0xEE, 0xAA, 0xCC, 0x9A, 0xBA, 0xBB, 0xBD,
+	0xAB, 0x09, 0x10, 0x35, 0x33, 0x45, 0x34, 0x25, 0x32, 0x33, 0x33, 0x33,
+	0x43, 0x22, 0x90, 0xB9, 0xBE, 0x89, 0x12, 0x92, 0xEB, 0x9A, 0x08, 0x34,
+	0x23, 0x23, 0x01, 0x20, 0x13, 0x32, 0xC3, 0xCF, 0xBD, 0x9B, 0xBB, 0xEB,
+	0xBC, 0xAB, 0xAB, 0xAA, 0xBA, 0xAB, 0xB8, 0xDD, 0xAB, 0xAB, 0xCC, 0xCC,
+	0xBD, 0xCC, 0xBB, 0xCC, 0xCB, 0xBC, 0xBC, 0xAC, 0x9A, 0x88, 0x00, 0x11,
+	0x21, 0x55, 0x35, 0x35, 0x33, 0x34, 0x32, 0x24, 0x33, 0x13, 0x11, 0x90,
+	0x98, 0xB8, 0xCA, 0xDC, 0xBA, 0xAB, 0x9A, 0x99, 0x88, 0xA9, 0x09, 0x00,
+	0x41, 0x22, 0x90, 0xDE, 0xCC, 0xBA, 0xCB, 0xCB, 0xCA, 0xBA, 0xAC, 0x9A,
+	0x08, 0x31, 0x43, 0x34, 0x35, 0x44, 0x33, 0x34, 0x23, 0x23, 0x22, 0x32,
+	0x11, 0xA0, 0xCC, 0xBA, 0x9C, 0x98, 0x10, 0x81, 0x99, 0x09, 0x72, 0x37,
+	0x43, 0x11, 0x80, 0x08, 0x80, 0x98, 0xCA, 0xBE, 0xAD, 0xBB, 0xBC, 0xBA,
+	0xCB, 0xAB, 0xAA, 0x09, 0xA8, 0xAB, 0xAA, 0x8A, 0xD8, 0xDD, 0xCC, 0xBB,
+	0xBE, 0xCC, 0xCB, 0xBC, 0xCB, 0xBC, 0xBC, 0x9A, 0x88, 0x88, 0x11, 0x21,
+	0x46, 0x44, 0x34, 0x34, 0x33, 0x43, 0x32, 0x43, 0x12, 0x11, 0x80, 0x88,
+	0x99, 0xCB, 0xDB, 0xBB, 0xAB, 0xAA, 0x9B, 0x98, 0x89, 0x98, 0x08, 0x42,
+	0x24, 0x91, 0xD8, 0xBF, 0xCB, 0xCB, 0xAB, 0xBB, 0xCD, 0xBA, 0xAB, 0x88,
+	0x11, 0x32, 0x35, 0x63, 0x35, 0x33, 0x34, 0x33, 0x32, 0x24, 0x21, 0x22,
+	0xA8, 0xAA, 0xBD, 0x9A, 0xA9, 0x9A, 0x11, 0x90, 0x30, 0x57, 0x35, 0x22,
+	0x22, 0x22, 0x00, 0x02, 0xAA, 0xEC, 0xBE, 0xBB, 0xBC, 0xCA, 0xBA, 0xBC,
+	0xAA, 0x9B, 0x89, 0x88, 0x08, 0x80, 0x89, 0xA0, 0xBF, 0xDB, 0xDC, 0xDB,
+	0xBC, 0xBC, 0xBD, 0xBC, 0xBC, 0xBC, 0xAA, 0x89, 0x08, 0x10, 0x11, 0x64,
+	0x44, 0x34, 0x34, 0x33, 0x24, 0x33, 0x33, 0x43, 0x11, 0x00, 0x88, 0x9A,
+	0xDA, 0xCB, 0xBB, 0xBB, 0xBA, 0xAA, 0xA9, 0x89, 0x88, 0x28, 0x14, 0x62,
+	0x82, 0x9A, 0xEC, 0xCB, 0xBB, 0xCB, 0xBC, 0xBC, 0xCB, 0xBA, 0x99, 0x18,
+	0x22, 0x52, 0x35, 0x53, 0x34, 0x33, 0x34, 0x32, 0x33, 0x33, 0x12, 0x01,
+	0xA9, 0xA9, 0xA9, 0xCD, 0x98, 0xAD, 0xA9, 0x8C, 0x32, 0x41, 0x04, 0x20,
+	0x11, 0x63, 0x03, 0x32, 0x90, 0xCB, 0xDC, 0xBB, 0xCA, 0xBC, 0xBC, 0xAD,
+	0xBA, 0xAA, 0xCB, 0xAA, 0x9A, 0x99, 0xBA, 0xCC, 0xBB, 0xBD, 0xBC, 0xBD,
+	0xCC, 0xBC, 0xBD, 0xBD, 0xBB, 0xBB, 0x9A, 0x99, 0x08, 0x00, 0x63, 0x46,
+	0x53, 0x43, 0x33, 0x43, 0x33, 0x43, 0x23, 0x13, 0x21, 0x01, 0x08, 0xDA,
+	0xBB, 0xCC, 0x9A, 0xBB, 0xBA, 0xBB, 0xBA, 0x8C, 0x88, 0x18, 0x32, 0x22,
+	0x01, 0xEC, 0xBA, 0xDB, 0xBA, 0xCC, 0xDA, 0xDB, 0xAA, 0x99, 0x89, 0x08,
+	0x21, 0x42, 0x45, 0x43, 0x43, 0x33, 0x25, 0x33, 0x23, 0x23, 0x02, 0x00,
+	0x88, 0x88, 0x99, 0xB9, 0xDD, 0x9D, 0x20, 0x03, 0x88, 0x98, 0x08, 0x63,
+	0x22, 0x24, 0x90, 0xDB, 0xCB, 0xAB, 0x99, 0xCE, 0xBB, 0xBC, 0xBB, 0xCB,
+	0xBA, 0xAB, 0x9B, 0x99, 0xCC, 0x9A, 0xAA, 0xEA, 0xCC, 0xCB, 0xBB, 0xBE,
+	0xBD, 0xCC, 0xCB, 0xBB, 0xBC, 0x8A, 0x88, 0x09, 0x08, 0x30, 0x67, 0x33,
+	0x35, 0x33, 0x43, 0x24, 0x33, 0x43, 0x12, 0x11, 0x01, 0x88, 0x90, 0xCC,
+	0xBA, 0xAD, 0x9A, 0xAA, 0xBB, 0xBA, 0xBA, 0x08, 0x88, 0x20, 0x14, 0x88,
+	0xB1, 0xAF, 0xA9, 0xBC, 0xCC, 0xCB, 0xDB, 0xBA, 0xBA, 0x8A, 0x88, 0x20,
+	0x33, 0x65, 0x34, 0x34, 0x43, 0x24, 0x33, 0x33, 0x32, 0x23, 0x21, 0x01,
+	0x81, 0x08, 0xD2, 0xBD, 0xBA, 0x0B, 0x43, 0x82, 0xA9, 0xCD, 0x29, 0x34,
+	0x43, 0x11, 0xB8, 0xAE, 0xBA, 0x8A, 0xC9, 0xCD, 0xCB, 0xAC, 0xAA, 0xBB,
+	0xCB, 0xBA, 0xAB, 0xAA, 0xCA, 0xBC, 0xDB, 0xBC, 0xCA, 0xCB, 0xDA, 0xCC,
+	0xDB, 0xCB, 0xBB, 0xBB, 0x9A, 0x89, 0x09, 0x90, 0x40, 0x47, 0x44, 0x24,
+	0x24, 0x32, 0x33, 0x34, 0x33, 0x33, 0x22, 0x11, 0x08, 0xA8, 0xBD, 0xBC,
+	0xBC, 0xAB, 0xBA, 0xBD, 0xAA, 0x9C, 0x09, 0x88, 0x11, 0x02, 0x89, 0x99,
+	0xBD, 0x89, 0xDB, 0xBB, 0xEC, 0xCB, 0xBA, 0xBB, 0x8A, 0x88, 0x30, 0x34,
+	0x52, 0x45, 0x43, 0x53, 0x23, 0x43, 0x23, 0x22, 0x22, 0x12, 0x00, 0xA8,
+	0x9B, 0x90, 0x19, 0xA1, 0x9D, 0x09, 0x81, 0x60, 0x26, 0x21, 0x11, 0x00,
+	0x8A, 0xCC, 0x9E, 0xCB, 0xBB, 0xEA, 0xCB, 0xAC, 0xBB, 0xAB, 0xAA, 0xAB,
+	0xBA, 0xAB, 0x9B, 0xBA, 0xAC, 0xDA, 0xBC, 0xCD, 0xCC, 0xCC, 0xBC, 0xCC,
+	0xBB, 0xBC, 0xAC, 0xAA, 0x98, 0x89, 0x00, 0x21, 0x47, 0x44, 0x43, 0x33,
+	0x43, 0x43, 0x33, 0x43, 0x12, 0x21, 0x10, 0x00, 0x99, 0xCB, 0xBC, 0xBB,
+	0xAC, 0xBB, 0xCC, 0x9A, 0x89, 0x09, 0x08, 0x00, 0x10, 0x12, 0xA0, 0xB9,
+	0xAE, 0xC9, 0xCC, 0xCB, 0xBC, 0xBC, 0xAB, 0x9A, 0x89, 0x10, 0x12, 0x54,
+	0x54, 0x43, 0x24, 0x33, 0x44, 0x32, 0x22, 0x23, 0x11, 0x22, 0x00, 0x98,
+	0xDB, 0xBC, 0xCA, 0xBB, 0xA9, 0xCB, 0xBA, 0x9A, 0x18, 0x44, 0x32, 0x43,
+	0x42, 0x22, 0x11, 0x98, 0x09, 0xEC, 0xCA, 0xBD, 0xCC, 0xBB, 0xCB, 0xBB,
+	0xAC, 0xAB, 0xBB, 0xCB, 0xAB, 0xBB, 0x9C, 0xBB, 0xCC, 0xCD, 0xDB, 0xCB,
+	0xDB, 0xBA, 0xCB, 0x9A, 0xA9, 0x09, 0x08, 0x10, 0x46, 0x45, 0x43, 0x43,
+	0x33, 0x34, 0x33, 0x34, 0x33, 0x22, 0x13, 0x01, 0x98, 0xCB, 0xBB, 0xBD,
+	0xBC, 0xCB, 0xBC, 0xBA, 0xAA, 0x9B, 0x89, 0x09, 0x01, 0x10, 0x81, 0x88,
+	0x18, 0x03, 0xDB, 0xEA, 0xCD, 0xBB, 0xBC, 0xAB, 0x99, 0x89, 0x80, 0x20,
+	0x74, 0x35, 0x53, 0x43, 0x43, 0x33, 0x34, 0x23, 0x33, 0x12, 0x10, 0x01,
+	0x98, 0xFB, 0xBC, 0xBC, 0xAA, 0x88, 0x98, 0xCB, 0xBA, 0x18, 0x54, 0x43,
+	0x12, 0x80, 0x10, 0x00, 0x11, 0xC9, 0xDD, 0xBC, 0xBB, 0xBD, 0xCB, 0xBC,
+	0xBB, 0xBA, 0xAB, 0xBA, 0xBB, 0xBA, 0xBC, 0xBB, 0xDB, 0xDC, 0xDC, 0xBC,
+	0xBC, 0xBC, 0xAA, 0x99, 0xAB, 0x9A, 0x99, 0x73, 0x44, 0x44, 0x33, 0x34,
+	0x53, 0x33, 0x43, 0x33, 0x22, 0x22, 0x12, 0x00, 0xA9, 0xBC, 0xBC, 0xBC,
+	0xBC, 0xCB, 0xBB, 0xBB, 0xBB, 0x9A, 0x00, 0x10, 0x11, 0x10, 0x00, 0x31,
+	0x43, 0xA3, 0xFB, 0xDC, 0xCB, 0xAA, 0xAA, 0xBB, 0xBB, 0x8A, 0x21, 0x45,
+	0x35, 0x63, 0x53, 0x33, 0x25, 0x33, 0x33, 0x33, 0x33, 0x12, 0x21, 0x90,
+	0xA9, 0xEA, 0xCC, 0xDB, 0xAB, 0xAA, 0x99, 0x98, 0xA0, 0x99, 0x31, 0x63,
+	0x32, 0x43, 0x11, 0x11, 0xA0, 0xEB, 0xBE, 0xBC, 0xCB, 0xCB, 0xCB, 0xBC,
+	0xCB, 0xBA, 0xA9, 0x9B, 0xBA, 0xBA, 0xDB, 0xAA, 0xCD, 0xCB, 0xBC, 0xCC,
+	0xBC, 0xCC, 0xBA, 0x99, 0x99, 0x89, 0x88, 0x20, 0x56, 0x34, 0x35, 0x24,
+	0x24, 0x33, 0x24, 0x43, 0x22, 0x22, 0x21, 0x80, 0x88, 0xC9, 0xAC, 0xBA,
+	0xBC, 0xCB, 0xDB, 0xAA, 0xA9, 0x9B, 0x80, 0x88, 0x10, 0x81, 0x08, 0x13,
+	0x29, 0x05, 0xA9, 0xA9, 0xFD, 0xAC, 0x99, 0xAA, 0x08, 0xA9, 0x0A, 0x01,
+	0x72, 0x36, 0x43, 0x35, 0x32, 0x43, 0x33, 0x33, 0x34, 0x01, 0x12, 0x88,
+	0xA9, 0xBB, 0xCB, 0xBD, 0xBD, 0xBB, 0x89, 0x31, 0x00, 0x9A, 0x38, 0x24,
+	0x55, 0x21, 0x00, 0xA9, 0xCB, 0xCC, 0xCC, 0xBB, 0xDC, 0xBB, 0xBA, 0xCC,
+	0xBA, 0xAC, 0x99, 0x9A, 0x9A, 0xBA, 0xBC, 0xAA, 0xDC, 0xBC, 0xCD, 0xCB,
+	0xCB, 0xCB, 0x9C, 0x9A, 0xA9, 0x89, 0x08, 0x31, 0x45, 0x54, 0x53, 0x33,
+	0x34, 0x43, 0x42, 0x32, 0x23, 0x22, 0x12, 0x01, 0x90, 0xBA, 0xBC, 0xCD,
+	0xBA, 0xBC, 0xBB, 0xBB, 0xBC, 0xAA, 0x99, 0x08, 0x01, 0x31, 0x01, 0x30,
+	0x25, 0x02, 0x88, 0xB9, 0xEC, 0xBC, 0xAD, 0xA9, 0xAB, 0x9A, 0x99, 0x20,
+	0x44, 0x54, 0x43, 0x44, 0x33, 0x34, 0x33, 0x24, 0x21, 0x21, 0x11, 0x22,
+	0x03, 0x10, 0x90, 0x0A, 0x98, 0x91, 0x2A, 0x27, 0x8C, 0x81, 0xAD, 0xCB,
+	0xDC, 0xAB, 0xCB, 0xBC, 0xAC, 0xBD, 0xBB, 0xBB, 0xAC, 0xA9, 0xAB, 0xA9,
+	0xAA, 0x9A, 0x99, 0x09, 0xA9, 0xCF, 0xCD, 0xBD, 0xBC, 0xCC, 0xDB, 0xCB,
+	0xBC, 0xAC, 0xBB, 0x89, 0x98, 0x89, 0x18, 0x42, 0x47, 0x43, 0x43, 0x33,
+	0x53, 0x43, 0x22, 0x32, 0x13, 0x21, 0x02, 0x80, 0x98, 0xCC, 0xCB, 0xBA,
+	0xCA, 0xBA, 0xAD, 0x9A, 0xAA, 0x99, 0x80, 0x00, 0x21, 0x01, 0x10, 0x90,
+	0x11, 0xC0, 0xBD, 0xBC, 0xCD, 0xBB, 0xBC, 0xBA, 0x9A, 0x99, 0x21, 0x53,
+	0x36, 0x44, 0x44, 0x42, 0x43, 0x23, 0x23, 0x32, 0x22, 0x22, 0x01, 0x88,
+	0xCC, 0xBC, 0xBC, 0xAC, 0x9A, 0xCB, 0xBB, 0x9A, 0x29, 0x42, 0x32, 0x63,
+	0x32, 0x44, 0x23, 0x01, 0x11, 0xB8, 0xBA, 0xED, 0xBB, 0xCD, 0xBC, 0xBA,
+	0xCB, 0xAA, 0xBB, 0xBB, 0x9A, 0x9A, 0x88, 0x89, 0x01, 0xA9, 0xCF, 0xCC,
+	0xCC, 0xDB, 0xCB, 0xBC, 0xAC, 0xA9, 0xA9, 0x9A, 0x09, 0x28, 0x55, 0x44,
+	0x53, 0x33, 0x53, 0x23, 0x24, 0x43, 0x22, 0x22, 0x11, 0x00, 0xA8, 0xAA,
+	0xCC, 0xCB, 0xCB, 0xBB, 0xAD, 0xAA, 0xAA, 0x9A, 0x88, 0x11, 0x20, 0x22,
+	0x33, 0x53, 0x35, 0x22, 0x80, 0x90, 0xBB, 0xBE, 0xBC, 0xCA, 0xCB, 0x9A,
+	0xAA, 0x9A, 0x41, 0x63, 0x44, 0x53, 0x33, 0x33, 0x34, 0x34, 0x32, 0x22,
+	0x01, 0x08, 0x99, 0xA9, 0xCE, 0xBC, 0xAC, 0xAB, 0x99, 0xBA, 0xAA, 0xA9,
+	0x11, 0x44, 0x33, 0x24, 0x11, 0x32, 0x13, 0x98, 0xEC, 0xBD, 0xCB, 0xCB,
+	0xCB, 0xCC, 0xAB, 0xAA, 0xBA, 0x9A, 0xBB, 0x9B, 0xBA, 0x8A, 0xB9, 0xCE,
+	0xBD, 0xCD, 0xCB, 0xBC, 0xBC, 0xDB, 0x9A, 0x89, 0xA9, 0x08, 0x18, 0x64,
+	0x34, 0x35, 0x34, 0x43, 0x34, 0x32, 0x43, 0x23, 0x22, 0x12, 0x00, 0x80,
+	0xCA, 0xBC, 0xEB, 0xBB, 0xB9, 0xBC, 0xBB, 0xCA, 0xAA, 0x88, 0x18, 0x12,
+	0x11, 0x42, 0x22, 0x52, 0x15, 0x80, 0x80, 0xA8, 0xBA, 0xCC, 0xBC, 0xBA,
+	0xAC, 0x88, 0x98, 0x1A, 0x34, 0x46, 0x45, 0x43, 0x23, 0x33, 0x42, 0x33,
+	0x43, 0x12, 0x80, 0xAA, 0xCA, 0xCB, 0xCB, 0xAC, 0xAB, 0xBA, 0xBA, 0xB9,
+	0x9A, 0x43, 0x54, 0x33, 0x11, 0x01, 0x12, 0x21, 0xB2, 0xFC, 0xCC, 0xCB,
+	0xCB, 0xBB, 0xBC, 0xCB, 0xAB, 0xA9, 0x99, 0xAA, 0xAA, 0x09, 0x11, 0x02,
+	0xCC, 0xCF, 0xCC, 0xDB, 0xBB, 0xCC, 0xBB, 0xAB, 0xAA, 0xAB, 0x89, 0x28,
+	0x65, 0x44, 0x34, 0x43, 0x43, 0x43, 0x32, 0x24, 0x23, 0x22, 0x12, 0x81,
+	0xA8, 0xBB, 0xCC, 0xAC, 0xCB, 0xCB, 0xAC, 0xAB, 0xA9, 0x99, 0x08, 0x08,
+	0x11, 0x23, 0x34, 0x33, 0x34, 0x33, 0x81, 0x90, 0xCD, 0xBC, 0xBC, 0xCB,
+	0xCA, 0xAA, 0x9A, 0x99, 0x28, 0x34, 0x55, 0x44, 0x34, 0x33, 0x33, 0x34,
+	0x24, 0x32, 0x23, 0x00, 0x88, 0x98, 0xAB, 0xCC, 0xBD, 0xBC, 0xAB, 0x99,
+	0xBA, 0xBB, 0xAA, 0x18, 0x52, 0x01, 0x00, 0x01, 0x31, 0x90, 0xCF, 0xBB,
+	0xCE, 0xBA, 0xCB, 0xBC, 0xBC, 0xBB, 0xAB, 0xCA, 0xA9, 0xCB, 0xAA, 0x9A,
+	0xB9, 0xEC, 0xCC, 0xCA, 0xBC, 0xBD, 0xBC, 0xBC, 0xCB, 0xAA, 0x89, 0x89,
+	0x89, 0x00, 0x56, 0x44, 0x43, 0x33, 0x43, 0x34, 0x24, 0x33, 0x23, 0x22,
+	0x21, 0x11, 0x98, 0xDB, 0xBC, 0xAC, 0xBB, 0xBC, 0xCC, 0xAA, 0xAA, 0x99,
+	0x88, 0x08, 0x01, 0x42, 0x22, 0x32, 0x24, 0x23, 0x11, 0x81, 0xDB, 0xBD,
+	0xBC, 0xBC, 0xBB, 0xAA, 0xBA, 0xAA, 0x38, 0x36, 0x64, 0x44, 0x33, 0x34,
+	0x43, 0x33, 0x34, 0x23, 0x13, 0x00, 0x08, 0xA0, 0xCC, 0xDC, 0xBB, 0xBB,
+	0xBA, 0xBA, 0xBB, 0x8B, 0x02, 0x41, 0x47, 0x32, 0x32, 0x12, 0x31, 0x02,
+	0xAA, 0xCC, 0xBF, 0xBB, 0xCD, 0xCB, 0xBA, 0xBB, 0xBB, 0xBA, 0x9A, 0x99,
+	0x08, 0x31, 0x43, 0x15, 0xA0, 0xEA, 0xDB, 0xCC, 0xCC, 0xBC, 0xBD, 0xAB,
+	0xA9, 0xBA, 0x9B, 0x89, 0x38, 0x47, 0x44, 0x43, 0x33, 0x34, 0x34, 0x34,
+	0x33, 0x12, 0x22, 0x11, 0x88, 0xA8, 0xCD, 0xCB, 0xBB, 0xCB, 0xCB, 0xBB,
+	0xBA, 0xAA, 0x88, 0x11, 0x11, 0x53, 0x43, 0x33, 0x34, 0x22, 0x01, 0x80,
+	0xA8, 0xDC, 0xCC, 0xBB, 0xAD, 0xAB, 0xAA, 0xAA, 0x89, 0x31, 0x63, 0x44,
+	0x44, 0x43, 0x33, 0x34, 0x33, 0x33, 0x22, 0x22, 0x12, 0x81, 0xDB, 0xCC,
+	0xCB, 0xBB, 0xBB, 0xDB, 0xBA, 0xBB, 0xAA, 0x08, 0x12, 0x33, 0x43, 0x43,
+	0x43, 0x33, 0x13, 0x90, 0xBA, 0xDC, 0xDB, 0xBD, 0xBD, 0xCB, 0xBA, 0xBA,
+	0xBA, 0xAC, 0xAC, 0x99, 0x08, 0x80, 0xAA, 0xBC, 0xBE, 0xCC, 0xCC, 0xCC,
+	0xBB, 0xAD, 0xAC, 0x9B, 0x99, 0x9A, 0x88, 0x10, 0x74, 0x34, 0x53, 0x43,
+	0x42, 0x42, 0x32, 0x33, 0x23, 0x12, 0x32, 0x00, 0x98, 0xDA, 0xBD, 0xBB,
+	0xBC, 0xCB, 0xBC, 0xBA, 0xAA, 0x9A, 0x08, 0x08, 0x31, 0x53, 0x32, 0x34,
+	0x32, 0x23, 0x01, 0x80, 0xCA, 0xBE, 0xDB, 0xBC, 0xBA, 0xAA, 0xAA, 0x8B,
+	0x20, 0x44, 0x54, 0x35, 0x43, 0x34, 0x34, 0x33, 0x33, 0x22, 0x22, 0x12,
+	0x88, 0xDA, 0xBE, 0xBC, 0xBB, 0xBA, 0xC9, 0xBC, 0xAB, 0x9A, 0x20, 0x34,
+	0x42, 0x34, 0x32, 0x25, 0x22, 0x22, 0x82, 0xA9, 0xD9, 0xCD, 0xCB, 0xCC,
+	0xCA, 0x9A, 0xAA, 0xBA, 0xAA, 0x9A, 0x89, 0x28, 0x32, 0x32, 0x32, 0xB1,
+	0xEE, 0xDB, 0xCC, 0xDB, 0xCB, 0xBC, 0xBC, 0xA9, 0xA9, 0xAA, 0x08, 0x28,
+	0x65, 0x43, 0x34, 0x34, 0x43, 0x43, 0x43, 0x32, 0x12, 0x11, 0x11, 0x00,
+	0x99, 0xEB, 0xCB, 0xBB, 0xAC, 0xBB, 0xBC, 0xAB, 0xAA, 0x99, 0x10, 0x12,
+	0x33, 0x45, 0x33, 0x43, 0x23, 0x12, 0xA0, 0x99, 0xCA, 0xCE, 0xCB, 0xBB,
+	0xBB, 0xBB, 0xAA, 0x89, 0x30, 0x46, 0x44, 0x34, 0x34, 0x34, 0x33, 0x34,
+	0x23, 0x12, 0x01, 0x90, 0xB9, 0xDB, 0xCC, 0xAC, 0xBA, 0x9A, 0x88, 0x09,
+	0x11, 0x19, 0x74, 0x43, 0x33, 0x33, 0x01, 0x08, 0xA8, 0xBA, 0xFC, 0xAD,
+	0xCB, 0xCB, 0xBB, 0xCB, 0xBB, 0xAA, 0x8A, 0x00, 0x00, 0x21, 0x42, 0x54,
+	0x33, 0x13, 0x80, 0xCB, 0xEC, 0xBC, 0xCD, 0xCB, 0xDB, 0xCA, 0xAB, 0xAA,
+	0x99, 0x8A, 0x00, 0x30, 0x56, 0x33, 0x45, 0x33, 0x43, 0x34, 0x32, 0x33,
+	0x13, 0x11, 0x11, 0x98, 0x99, 0xCE, 0xAC, 0xBB, 0xAC, 0xAA, 0xCB, 0x9A,
+	0x99, 0x09, 0x11, 0x12, 0x34, 0x34, 0x42, 0x23, 0x21, 0x81, 0xB9, 0xBB,
+	0xEC, 0xBC, 0xDB, 0xBC, 0xA9, 0xA9, 0x98, 0x10, 0x21, 0x55, 0x34, 0x34,
+	0x34, 0x43, 0x43, 0x32, 0x23, 0x12, 0x81, 0x90, 0xAA, 0xCC, 0xEB, 0xCB,
+	0xBA, 0xAB, 0xBB, 0xAA, 0x9B, 0x08, 0x41, 0x34, 0x43, 0x44, 0x43, 0x33,
+	0x23, 0x13, 0x01, 0xA9, 0xBD, 0xDB, 0xCC, 0xCB, 0xCB, 0xAC, 0xAA, 0xAB,
+	0x9A, 0x99, 0x18, 0x11, 0x22, 0x43, 0x34, 0x33, 0x02, 0x88, 0xFA, 0xDD,
+	0xCC, 0xDB, 0xBB, 0xCC, 0xCA, 0xBB, 0xAA, 0x9A, 0x9A, 0x20, 0x31, 0x46,
+	0x35, 0x53, 0x43, 0x43, 0x33, 0x33, 0x42, 0x22, 0x11, 0x12, 0x90, 0xB9,
+	0xCC, 0xCC, 0xBA, 0xBB, 0xCB, 0xCB, 0xAA, 0x89, 0x99, 0x10, 0x12, 0x53,
+	0x53, 0x22, 0x23, 0x12, 0x23, 0x80, 0xA8, 0xDA, 0xDD, 0xBA, 0xBC, 0xBB,
+	0xAB, 0xAB, 0x99, 0x10, 0x34, 0x35, 0x46, 0x34, 0x42, 0x43, 0x22, 0x33,
+	0x33, 0x22, 0x81, 0x98, 0xA9, 0xDC, 0xCB, 0xCC, 0xAB, 0x9A, 0xA9, 0x99,
+	0xBA, 0x8B, 0x32, 0x47, 0x43, 0x12, 0x02, 0x01, 0x21, 0x23, 0xC8, 0xCC,
+	0xCC, 0xBB, 0xCC, 0xCB, 0xBB, 0xBB, 0xA9, 0xA9, 0x99, 0xA8, 0x20, 0x54,
+	0x34, 0x14, 0x02, 0x99, 0xBA, 0xCC, 0xCE, 0xDB, 0xBC, 0xBC, 0xBC, 0xAC,
+	0xAB, 0xAA, 0x89, 0x80, 0x30, 0x46, 0x34, 0x44, 0x24, 0x43, 0x33, 0x33,
+	0x34, 0x22, 0x21, 0x02, 0x98, 0xA8, 0xCD, 0xBB, 0xBC, 0xAD, 0xAB, 0xAC,
+	0x99, 0x99, 0x89, 0x00, 0x21, 0x54, 0x32, 0x33, 0x24, 0x21, 0x13, 0x01,
+	0xA8, 0xDC, 0xCB, 0xCB, 0xBC, 0xCB, 0xBA, 0xAB, 0x99, 0x08, 0x42, 0x42,
+	0x45, 0x24, 0x53, 0x23, 0x33, 0x43, 0x22, 0x22, 0x01, 0x89, 0xA9, 0xDB,
+	0xCB, 0xDB, 0xAB, 0xA8, 0xAA, 0xA9, 0xAA, 0x39, 0x45, 0x33, 0x25, 0x22,
+	0x22, 0x22, 0x12, 0xA2, 0xCE, 0xBB, 0xDC, 0xBB, 0xCC, 0xBC, 0xBB, 0xAA,
+	0xA9, 0xB9, 0x8A, 0x99, 0x30, 0x54, 0x22, 0x11, 0x81, 0xBA, 0xDC, 0xCD,
+	0xCC, 0xBD, 0xCC, 0xCA, 0xBB, 0xCB, 0xAC, 0x99, 0x89, 0x08, 0x11, 0x62,
+	0x34, 0x35, 0x34, 0x34, 0x43, 0x43, 0x22, 0x23, 0x12, 0x11, 0x81, 0x98,
+	0xCA, 0xBC, 0xCC, 0xBB, 0xBB, 0xBC, 0xBB, 0x9A, 0x9A, 0x80, 0x20, 0x34,
+	0x44, 0x43, 0x22, 0x22, 0x22, 0x81, 0xB9, 0xFB, 0xCB, 0xCB, 0xBC, 0xBC,
+	0xBB, 0xAA, 0x99, 0x88, 0x23, 0x54, 0x44, 0x44, 0x32, 0x24, 0x33, 0x24,
+	0x23, 0x22, 0x01, 0x89, 0xAA, 0xEB, 0xCA, 0xBC, 0xBC, 0xBB, 0xAB, 0x19,
+	0x22, 0x21, 0x36, 0x42, 0x45, 0x43, 0x23, 0x13, 0x02, 0x11, 0xA8, 0xBA,
+	0xCF, 0xBC, 0xCB, 0xBB, 0xAD, 0xCB, 0xAA, 0x9A, 0x89, 0x00, 0x00, 0x32,
+	0x34, 0x44, 0x34, 0x22, 0x01, 0x80, 0xBA, 0xDD, 0xCC, 0xBC, 0xBD, 0xBC,
+	0xCB, 0xCB, 0xAA, 0x9A, 0x89, 0x18, 0x21, 0x73, 0x34, 0x44, 0x43, 0x33,
+	0x53, 0x22, 0x23, 0x33, 0x11, 0x01, 0x98, 0xA9, 0xDB, 0xCC, 0xBB, 0xBC,
+	0xBB, 0xCA, 0xAA, 0x99, 0x89, 0x20, 0x33, 0x35, 0x25, 0x22, 0x33, 0x13,
+	0x22, 0x90, 0xBD, 0xCC, 0xCC, 0xBB, 0xDB, 0xBB, 0xBB, 0xAB, 0x89, 0x00,
+	0x42, 0x45, 0x53, 0x34, 0x34, 0x33, 0x24, 0x33, 0x23, 0x12, 0x11, 0xA0,
+	0xCA, 0xDB, 0xBC, 0xBB, 0xAD, 0xAB, 0xBB, 0x9A, 0x18, 0x10, 0x42, 0x44,
+	0x33, 0x45, 0x22, 0x22, 0x11, 0x80, 0x80, 0xEA, 0xCB, 0xDC, 0xAB, 0xBB,
+	0xDB, 0xAA, 0xCB, 0xA9, 0x98, 0x00, 0x20, 0x21, 0x53, 0x33, 0x53, 0x22,
+	0x81, 0x88, 0xBB, 0xCD, 0xCD, 0xBC, 0xBD, 0xBC, 0xBC, 0xCB, 0xBB, 0xCC,
+	0xBB, 0x9A, 0x09, 0x18, 0x22, 0x44, 0x54, 0x43, 0x34, 0x34, 0x43, 0x43,
+	0x32, 0x22, 0x23, 0x01, 0x11, 0x88, 0x99, 0xEB, 0xBC, 0xCB, 0xAC, 0xAA,
+	0xBA, 0xAA, 0x9A, 0x9A, 0x10, 0x32, 0x62, 0x33, 0x42, 0x33, 0x12, 0x00,
+	0xB9, 0xBE, 0xCA, 0xBD, 0xBC, 0xBD, 0xBB, 0xAA, 0x9A, 0x89, 0x21, 0x44,
+	0x44, 0x44, 0x33, 0x35, 0x33, 0x25, 0x22, 0x22, 0x12, 0x01, 0x08, 0xA9,
+	0xAA, 0xDC, 0xBC, 0xCB, 0xAC, 0x89, 0xA9, 0x89, 0x88, 0x09, 0x43, 0x24,
+	0x43, 0x12, 0x32, 0x33, 0x12, 0xC0, 0xED, 0xBB, 0xBB, 0xBD, 0xCC, 0xCB,
+	0xAC, 0xAA, 0xA9, 0x99, 0x9A, 0x08, 0x11, 0x43, 0x34, 0x32, 0x24, 0x22,
+	0x23, 0x91, 0xFB, 0xCD, 0xBC, 0xBC, 0xBD, 0xBD, 0xBC, 0xCB, 0xCB, 0x9A,
+	0x99, 0x89, 0x10, 0x32, 0x46, 0x34, 0x44, 0x43, 0x42, 0x33, 0x23, 0x33,
+	0x14, 0x12, 0x01, 0x80, 0xA9, 0xCC, 0xBC, 0xCB, 0xBB, 0xCB, 0xBA, 0xBB,
+	0x9A, 0x89, 0x10, 0x33, 0x44, 0x34, 0x43, 0x33, 0x22, 0x11, 0x80, 0xCA,
+	0xCB, 0xDD, 0xCB, 0xCB, 0xAB, 0xAB, 0xAA, 0x99, 0x00, 0x31, 0x56, 0x43,
+	0x53, 0x43, 0x32, 0x24, 0x23, 0x32, 0x12, 0x01, 0x90, 0xBA, 0xEB, 0xCC,
+	0xBB, 0xBC, 0xAB, 0x9A, 0x99, 0x89, 0x18, 0x64, 0x34, 0x43, 0x33, 0x22,
+	0x42, 0x23, 0x82, 0xB8, 0xDC, 0xBC, 0xCC, 0xBB, 0xCC, 0xBB, 0xBB, 0xBB,
+	0xAB, 0x99, 0x89, 0x31, 0x46, 0x43, 0x33, 0x43, 0x32, 0x33, 0x22, 0x90,
+	0xCC, 0xCC, 0xCC, 0xBC, 0xCC, 0xCB, 0xCB, 0xCA, 0xAA, 0xAA, 0x99, 0x89,
+	0x28, 0x43, 0x45, 0x34, 0x43, 0x34, 0x34, 0x43, 0x23, 0x23, 0x22, 0x12,
+	0x01, 0x80, 0xB9, 0xBE, 0xBC, 0xCB, 0xBB, 0xBC, 0xBB, 0xAA, 0x89, 0x08,
+	0x00, 0x32, 0x45, 0x34, 0x24, 0x23, 0x02, 0x01, 0x90, 0xC9, 0xDB, 0xCC,
+	0xDB, 0xAB, 0xCB, 0xAA, 0xAB, 0x99, 0x00, 0x51, 0x53, 0x33, 0x45, 0x33,
+	0x44, 0x32, 0x23, 0x23, 0x12, 0x11, 0x98, 0xBA, 0xDC, 0xBC, 0xBC, 0xBC,
+	0xCB, 0x9A, 0x88, 0x88, 0x28, 0x12, 0x63, 0x45, 0x32, 0x33, 0x22, 0x32,
+	0x02, 0x89, 0xB9, 0xCF, 0xCB, 0xCB, 0xBC, 0xBC, 0xBB, 0xAB, 0xAA, 0x89,
+	0x89, 0x10, 0x44, 0x53, 0x53, 0x43, 0x22, 0x22, 0x11, 0x01, 0x99, 0xCB,
+	0xDC, 0xBC, 0xCC, 0xCB, 0xAC, 0xAC, 0xBB, 0xBB, 0xAC, 0xAC, 0xAA, 0x89,
+	0x10, 0x43, 0x34, 0x54, 0x33, 0x54, 0x33, 0x43, 0x33, 0x33, 0x33, 0x33,
+	0x22, 0x81, 0xA8, 0x88, 0xDC, 0xBB, 0xBD, 0xAD, 0xAA, 0xAA, 0x99, 0x99,
+	0x89, 0x80, 0x30, 0x45, 0x22, 0x21, 0x13, 0x80, 0x88, 0xDB, 0xBE, 0xBD,
+	0xBB, 0xDB, 0xCB, 0xBB, 0xBB, 0x9A, 0x20, 0x31, 0x63, 0x34, 0x35, 0x35,
+	0x34, 0x33, 0x33, 0x34, 0x32, 0x21, 0x01, 0x88, 0xA9, 0xCB, 0xCC, 0xBD,
+	0xBA, 0xAC, 0xAA, 0xAA, 0x99, 0x10, 0x52, 0x35, 0x12, 0x31, 0x25, 0x43,
+	0x33, 0x81, 0xAA, 0xBC, 0xDB, 0xDB, 0xCB, 0xCC, 0xBB, 0xBB, 0xAB, 0xAC,
+	0xAB, 0x99, 0x18, 0x52, 0x23, 0x42, 0x43, 0x43, 0x24, 0x13, 0x01, 0xA9,
+	0xBC, 0xCC, 0xCC, 0xBC, 0xCC, 0xBC, 0xBC, 0xCB, 0xBB, 0xDB, 0xAB, 0x9B,
+	0x99, 0x08, 0x31, 0x43, 0x46, 0x34, 0x34, 0x25, 0x43, 0x32, 0x33, 0x24,
+	0x23, 0x11, 0x02, 0x80, 0x88, 0xDA, 0xCB, 0xCB, 0xBB, 0xBB, 0xBC, 0xAA,
+	0xAB, 0x9A, 0x10, 0x10, 0x34, 0x33, 0x44, 0x33, 0x11, 0x01, 0xCA, 0xBC,
+	0xBD, 0xCC, 0xBC, 0xBC, 0xAC, 0xAB, 0x9A, 0x09, 0x08, 0x41, 0x44, 0x34,
+	0x45, 0x32, 0x34, 0x33, 0x34, 0x22, 0x23, 0x01, 0x80, 0x98, 0xBA, 0xBE,
+	0xBD, 0xBD, 0xBA, 0xAA, 0xAB, 0xBB, 0x9B, 0x50, 0x36, 0x33, 0x25, 0x21,
+	0x43, 0x34, 0x32, 0x01, 0xB9, 0xBB, 0xCD, 0xCB, 0xEB, 0xBC, 0xBA, 0xAB,
+	0xAB, 0xBB, 0xAC, 0x89, 0x30, 0x54, 0x22, 0x33, 0x43, 0x53, 0x43, 0x22,
+	0x00, 0x98, 0xBA, 0xDB, 0xCC, 0xCC, 0xCB, 0xCB, 0xBB, 0xCC, 0xBA, 0xBB,
+	0xBC, 0x9A, 0x99, 0x08, 0x42, 0x43, 0x45, 0x33, 0x35, 0x25, 0x43, 0x23,
+	0x33, 0x32, 0x33, 0x22, 0x11, 0x80, 0xB9, 0xCC, 0xCB, 0xCB, 0xDB, 0xAA,
+	0xAA, 0x9B, 0x99, 0x89, 0x09, 0x31, 0x34, 0x53, 0x23, 0x12, 0x10, 0x88,
+	0xAA, 0xDE, 0xCB, 0xBC, 0xBD, 0xBB, 0xCB, 0xBA, 0x9A, 0x8A, 0x11, 0x53,
+	0x35, 0x34, 0x44, 0x34, 0x33, 0x34, 0x23, 0x23, 0x22, 0x12, 0x91, 0xA8,
+	0xEB, 0xDB, 0xBB, 0xCB, 0xAC, 0xAB, 0xBA, 0x89, 0x80, 0x01, 0x42, 0x43,
+	0x36, 0x24, 0x23, 0x12, 0x81, 0x80, 0xB8, 0xCD, 0xEB, 0xBC, 0xBB, 0xBC,
+	0xAC, 0xBB, 0xAC, 0x99, 0x88, 0x20, 0x32, 0x43, 0x35, 0x44, 0x43, 0x22,
+	0x22, 0x11, 0x08, 0x99, 0xEB, 0xBC, 0xBD, 0xBC, 0xBC, 0xCB, 0xBC, 0xCB,
+	0xBB, 0xBB, 0xDB, 0xBB, 0xAD, 0xBB, 0xBA, 0x08, 0x20, 0x34, 0x32, 0x37,
+	0x35, 0x35, 0x44, 0x32, 0x33, 0x43, 0x24, 0x22, 0x22, 0x21, 0x10, 0x11,
+	0xA0, 0xCB, 0xCC, 0xBA, 0xAA, 0xCB, 0xCB, 0xCB, 0x9B, 0x89, 0x9A, 0x88,
+	0x88, 0x19, 0x21, 0x08, 0xB9, 0xCC, 0x9A, 0xB9, 0xCE, 0xCB, 0xBE, 0xBA,
+	0x9A, 0x89, 0x88, 0x00, 0x31, 0x54, 0x36, 0x44, 0x33, 0x44, 0x32, 0x42,
+	0x32, 0x22, 0x12, 0x02, 0x01, 0xA8, 0xCA, 0xCD, 0xCB, 0xBB, 0xCB, 0xBB,
+	0x9A, 0xBA, 0x99, 0x21, 0x24, 0x45, 0x44, 0x22, 0x32, 0x23, 0x22, 0x00,
+	0xA8, 0xEB, 0xEB, 0xDB, 0xCB, 0xCB, 0xBB, 0xBB, 0xBB, 0xAB, 0xAA, 0x0A,
+	0x30, 0x55, 0x33, 0x45, 0x23, 0x33, 0x42, 0x12, 0x01, 0x98, 0xCB, 0xDD,
+	0xCB, 0xDB, 0xAC, 0xBC, 0xCB, 0xCB, 0xBB, 0xAC, 0xCB, 0xBA, 0xBB, 0x9A,
+	0x18, 0x42, 0x34, 0x44, 0x34, 0x44, 0x34, 0x34, 0x33, 0x24, 0x32, 0x33,
+	0x22, 0x23, 0x01, 0x08, 0xA9, 0xBC, 0xCC, 0xDB, 0xBB, 0xAB, 0xBB, 0xAB,
+	0xAD, 0xAA, 0x9A, 0x18, 0x32, 0x00, 0x10, 0x98, 0x89, 0x08, 0xFB, 0xBD,
+	0xCC, 0xCA, 0xCA, 0xCB, 0xAA, 0xAA, 0x0A, 0x11, 0x22, 0x52, 0x34, 0x55,
+	0x43, 0x34, 0x33, 0x32, 0x43, 0x23, 0x23, 0x22, 0x01, 0x98, 0xC9, 0xCB,
+	0xDB, 0xBC, 0xBB, 0xCB, 0x9A, 0xA9, 0xBA, 0x1A, 0x10, 0x62, 0x34, 0x23,
+	0x34, 0x13, 0x11, 0xA8, 0xBA, 0xEA, 0xCD, 0xCB, 0xBD, 0xBC, 0xBA, 0xBB,
+	0xBA, 0xAB, 0x9A, 0x00, 0x43, 0x35, 0x53, 0x34, 0x34, 0x33, 0x24, 0x12,
+	0x11, 0x80, 0xB9, 0xCD, 0xCC, 0xBC, 0xBC, 0xDB, 0xBB, 0xDB, 0xCA, 0xBA,
+	0xAC, 0xCB, 0xCA, 0xBB, 0xBB, 0xCC, 0xAB, 0x99, 0x00, 0x33, 0x34, 0x54,
+	0x53, 0x44, 0x43, 0x43, 0x33, 0x33, 0x43, 0x43, 0x22, 0x21, 0x01, 0x00,
+	0x90, 0xBA, 0xCD, 0xDB, 0xAA, 0xBA, 0xCB, 0xBB, 0xBC, 0xAA, 0x99, 0x88,
+	0x80, 0x08, 0x11, 0x12, 0x32, 0x03, 0x08, 0x80, 0xFB, 0xBC, 0xCD, 0xBC,
+	0xBA, 0xAB, 0x0A, 0x98, 0x00, 0x52, 0x54, 0x44, 0x44, 0x33, 0x34, 0x33,
+	0x34, 0x43, 0x32, 0x21, 0x01, 0x00, 0xA8, 0xEB, 0xBC, 0xCC, 0xBA, 0xBB,
+	0xCB, 0xBC, 0xBB, 0xAB, 0x09, 0x21, 0x21, 0x34, 0x33, 0x77, 0x33, 0x12,
+	0x11, 0x08, 0x30, 0x13, 0xA0, 0xFC, 0xCB, 0xAA, 0xB9, 0xBB, 0xDB, 0xBC,
+	0x09, 0x10, 0x10, 0x00, 0x28, 0x65, 0x43, 0x23, 0x12, 0x88, 0x12, 0x11,
+	0x80, 0xEC, 0xCD, 0xBB, 0xCB, 0xDB, 0xCB, 0xDB, 0xBA, 0xBB, 0xCA, 0xBB,
+	0xBC, 0xBB, 0x8A, 0x10, 0x53, 0x32, 0x63, 0x34, 0x45, 0x43, 0x33, 0x43,
+	0x32, 0x24, 0x23, 0x23, 0x11, 0x01, 0x00, 0x88, 0xDB, 0xCC, 0xBB, 0xAC,
+	0xAB, 0xBA, 0xAD, 0xCB, 0xA9, 0x88, 0x08, 0x00, 0x88, 0x18, 0x22, 0x22,
+	0x80, 0xC8, 0xCB, 0x9A, 0xCB, 0xDD, 0xBC, 0xAC, 0x99, 0x80, 0x11, 0x00,
+	0x31, 0x57, 0x43, 0x34, 0x43, 0x33, 0x34, 0x33, 0x33, 0x23, 0x12, 0x01,
+	0x98, 0xCB, 0xDD, 0xDB, 0xBB, 0xBB, 0xBC, 0xCB, 0xAB, 0xAA, 0x9A, 0x20,
+	0x33, 0x53, 0x35, 0x42, 0x43, 0x33, 0x33, 0x12, 0x00, 0xA8, 0xCC, 0xAD,
+	0xDB, 0xBC, 0xBA, 0xBC, 0xAB, 0x9A, 0x89, 0x00, 0x32, 0x46, 0x43, 0x34,
+	0x34, 0x32, 0x24, 0x23, 0x11, 0x80, 0xB9, 0xCC, 0xCC, 0xBC, 0xBC, 0xCC,
+	0xBA, 0xCB, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xCB, 0xBB, 0xBB, 0xDB, 0xBC,
+	0xBC, 0xCD, 0xAA, 0xBA, 0x28, 0x35, 0x31, 0x35, 0x34, 0x55, 0x34, 0x34,
+	0x24, 0x23, 0x43, 0x23, 0x33, 0x23, 0x01, 0x10, 0xA8, 0xBA, 0xCF, 0xDB,
+	0xBA, 0xBB, 0xBB, 0xEB, 0xBB, 0xAA, 0xAA, 0x08, 0x00, 0x00, 0x21, 0x52,
+	0x34, 0x43, 0x32, 0x32, 0x21, 0x32, 0x81, 0xBB, 0xCD, 0xBB, 0x9A, 0xA8,
+	0xBB, 0xDC, 0x8B, 0x63, 0x53, 0x43, 0x24, 0x22, 0x44, 0x33, 0x33, 0x23,
+	0x12, 0x12, 0x98, 0xA9, 0xDF, 0xCB, 0xBB, 0xBC, 0xBA, 0xCC, 0xBB, 0xBB,
+	0xAA, 0x10, 0x42, 0x33, 0x44, 0x34, 0x34, 0x35, 0x23, 0x32, 0x22, 0x11,
+	0x80, 0xCA, 0xBC, 0xCC, 0xBB, 0xAB, 0xCD, 0xBA, 0xAB, 0x89, 0x10, 0x22,
+	0x32, 0x33, 0x46, 0x43, 0x23, 0x23, 0x01, 0xA9, 0xDA, 0xCD, 0xBD, 0xBD,
+	0xCB, 0xBB, 0xBD, 0xCB, 0xBB, 0xBC, 0xAB, 0xBB, 0xBB, 0xAD, 0xAB, 0xAC,
+	0x9A, 0x88, 0x61, 0x44, 0x33, 0x35, 0x33, 0x54, 0x43, 0x34, 0x33, 0x33,
+	0x42, 0x22, 0x22, 0x23, 0x00, 0x88, 0xB9, 0xDB, 0xCC, 0xCC, 0xAA, 0xBB,
+	0xAA, 0xCB, 0xAC, 0xAB, 0xAA, 0x08, 0x11, 0x00, 0x00, 0x11, 0x42, 0x13,
+	0x22, 0x12, 0x89, 0x10, 0xF8, 0xBE, 0xAA, 0x9A, 0x28, 0x23, 0x12, 0x22,
+	0x73, 0x47, 0x43, 0x53, 0x23, 0x32, 0x42, 0x22, 0x23, 0x22, 0x11, 0x98,
+	0xBA, 0xCD, 0xCD, 0xBB, 0xBC, 0xBB, 0xBB, 0xAC, 0xDB, 0x9A, 0x88, 0x10,
+	0x22, 0x34, 0x33, 0x64, 0x33, 0x32, 0x33, 0x32, 0x32, 0x32, 0x90, 0xEC,
+	0xBC, 0xAA, 0xB9, 0xAA, 0xEA, 0xBC, 0x8A, 0x32, 0x33, 0x23, 0x91, 0x41,
+	0x37, 0x34, 0x81, 0xC9, 0x99, 0xAA, 0xCB, 0xEC, 0xCC, 0xBB, 0xBA, 0xBB,
+	0xBD, 0xBD, 0xBB, 0xBA, 0x99, 0xBA, 0xBD, 0xBB, 0xAC, 0x9A, 0xDB, 0xBC,
+	0xCC, 0xBB, 0xCB, 0xCC, 0xBB, 0x9C, 0x89, 0x44, 0x33, 0x43, 0x43, 0x44,
+	0x45, 0x43, 0x32, 0x23, 0x23, 0x34, 0x23, 0x22, 0x00, 0xA9, 0x99, 0xDB,
+	0xBD, 0xCD, 0xBB, 0xBB, 0xAA, 0xBB, 0xBD, 0xAB, 0x8A, 0x00, 0x42, 0x22,
+	0x32, 0x63, 0x43, 0x23, 0x23, 0x22, 0x11, 0x00, 0x90, 0xEC, 0xBC, 0xBA,
+	0xAC, 0x99, 0xA9, 0xBB, 0x9A, 0x30, 0x47, 0x24, 0x34, 0x33, 0x34, 0x44,
+	0x22, 0x22, 0x12, 0x01, 0x81, 0xB9, 0xCE, 0xDB, 0xAB, 0xBB, 0xBC, 0xCB,
+	0xCB, 0xAA, 0x99, 0x00, 0x20, 0x12, 0x44, 0x63, 0x44, 0x22, 0x22, 0x22,
+	0x32, 0x35, 0x13, 0x80, 0xBA, 0xAD, 0xA9, 0xCA, 0xCB, 0xCD, 0x9A, 0x99,
+	0x99, 0x99, 0xAB, 0x09, 0x42, 0x34, 0x13, 0x81, 0x10, 0x41, 0x33, 0x82,
+	0xDE, 0xBC, 0xAC, 0xCB, 0xCA, 0xCC, 0xBA, 0xAC, 0xAB, 0xBA, 0xBC, 0xAB,
+	0xBB, 0x9A, 0xBA, 0xBD, 0xCC, 0xAB, 0xCB, 0xAB, 0xCB, 0x9A, 0x64, 0x34,
+	0x43, 0x33, 0x43, 0x46, 0x34, 0x24, 0x23, 0x22, 0x33, 0x43, 0x23, 0x82,
+	0x88, 0xA9, 0xB9, 0xCD, 0xCC, 0xBC, 0xBB, 0xAB, 0xBA, 0xCC, 0xAB, 0xAA,
+	0x09, 0x21, 0x23, 0x22, 0x43, 0x53, 0x43, 0x33, 0x22, 0x01, 0x00, 0x88,
+	0xEA, 0xDB, 0xCB, 0xAB, 0x8A, 0x88, 0xA9, 0x9A, 0x29, 0x66, 0x34, 0x34,
+	0x33, 0x43, 0x33, 0x25, 0x33, 0x12, 0x00, 0x80, 0xA9, 0xEB, 0xCC, 0xBC,
+	0xBB, 0xBB, 0xAC, 0xDB, 0xAB, 0x9B, 0x09, 0x20, 0x12, 0x32, 0x35, 0x45,
+	0x24, 0x23, 0x23, 0x32, 0x43, 0x34, 0x23, 0xA8, 0xCB, 0xAA, 0x89, 0x80,
+	0xDD, 0xBC, 0xAC, 0x99, 0x98, 0xAA, 0xBA, 0x9A, 0x31, 0x14, 0x98, 0xAB,
+	0x18, 0x65, 0x13, 0xB0, 0xDD, 0xBB, 0x9A, 0xA9, 0xCC, 0xDC, 0xCB, 0xBA,
+	0xBA, 0xCB, 0xCB, 0xAA, 0xAB, 0xBA, 0xBA, 0xBD, 0xAA, 0x99, 0x89, 0xFA,
+	0xBB, 0xDB, 0xBD, 0xAB, 0xDC, 0xCB, 0xAB, 0x0B, 0x66, 0x12, 0x11, 0x02,
+	0x42, 0x47, 0x33, 0x33, 0x22, 0x21, 0x34, 0x24, 0x22, 0x98, 0x9B, 0x09,
+	0xC9, 0xDC, 0xBC, 0xAD, 0x9A, 0x89, 0xA9, 0xBC, 0xBB, 0x88, 0x20, 0x34,
+	0x13, 0x18, 0x52, 0x43, 0x33, 0x13, 0x81, 0x80, 0x10, 0x91, 0xED, 0xCC,
+	0xAA, 0x9A, 0x01, 0x90, 0xBC, 0x9B, 0x41, 0x36, 0x34, 0x33, 0x22, 0x53,
+	0x44, 0x22, 0x11, 0x10, 0x10, 0x01, 0xA8, 0xED, 0xCB, 0xAA, 0x9A, 0xAA,
+	0xBC, 0xCC, 0xAA, 0x88, 0x10, 0x11, 0x21, 0x32, 0x34, 0x36, 0x33, 0x45,
+	0x33, 0x22, 0x22, 0x80, 0x41, 0x14, 0xA8, 0xBA, 0xBF, 0x9B, 0xB9, 0xCC,
+	0xBB, 0xDC, 0x99, 0x98, 0x09, 0x88, 0x9A, 0x38, 0x33, 0x73, 0x33, 0x08,
+	0x21, 0x02, 0x33, 0x92, 0xED, 0xCB, 0xCB, 0x9B, 0xCC, 0xBC, 0xCB, 0xCB,
+	0xAA, 0xA9, 0xCB, 0xBA, 0x9A, 0x99, 0x9A, 0xBA, 0xCD, 0xAB, 0xBB, 0xCE,
+	0xBD, 0xDB, 0xCB, 0x9B, 0x48, 0x26, 0x01, 0x21, 0x10, 0x74, 0x35, 0x33,
+	0x22, 0x12, 0x42, 0x24, 0x23, 0x02, 0xAA, 0x09, 0x01, 0xDA, 0xCD, 0xCC,
+	0xAA, 0x98, 0x98, 0xCB, 0xBC, 0x9A, 0x00, 0x21, 0x13, 0x80, 0x38, 0x36,
+	0x24, 0x23, 0x02, 0x10, 0x32, 0x12, 0xB0, 0xDF, 0xAB, 0xBA, 0x09, 0x80,
+	0xCC, 0xAC, 0x89, 0x30, 0x35, 0x24, 0x22, 0x42, 0x44, 0x43, 0x12, 0x22,
+	0x21, 0x32, 0x22, 0xD8, 0xBC, 0xAD, 0xAA, 0x99, 0xDB, 0xCC, 0xBB, 0xAA,
+	0x88, 0x08, 0x89, 0x99, 0x28, 0x45, 0x33, 0x42, 0x21, 0x32, 0x35, 0x12,
+	0x90, 0xDB, 0xAB, 0x19, 0x76, 0x02, 0xA9, 0x9A, 0x8A, 0x74, 0x23, 0x00,
+	0x98, 0x99, 0x32, 0x02, 0x89, 0xFB, 0xAB, 0x10, 0xC8, 0xBD, 0xCC, 0xAA,
+	0x00, 0x81, 0xA8, 0xCC, 0x9B, 0x28, 0x21, 0x24, 0x91, 0xBB, 0x89, 0x00,
+	0x88, 0xEB, 0xBE, 0xAA, 0xCA, 0xBB, 0xDE, 0xBA, 0x9A, 0x88, 0x81, 0xC9,
+	0xAD, 0xAA, 0x80, 0x10, 0xC0, 0xBF, 0xBB, 0xBE, 0x99, 0x19, 0x47, 0x02,
+	0x00, 0x01, 0x61, 0x45, 0x33, 0x22, 0x22, 0x32, 0x35, 0x12, 0x12, 0xA8,
+	0x18, 0x13, 0xD9, 0xDD, 0xCB, 0x9B, 0x89, 0x98, 0xCA, 0xBC, 0x9B, 0x08,
+	0x10, 0x32, 0x11, 0x30, 0x45, 0x13, 0x22, 0x21, 0x31, 0x43, 0x82, 0xCA,
+	0xCF, 0xAB, 0x9A, 0x89, 0x88, 0xD9, 0xCB, 0x09, 0x21, 0x35, 0x24, 0x33,
+	0x44, 0x43, 0x33, 0x23, 0x21, 0x32, 0x44, 0x12, 0xC9, 0xBD, 0xAC, 0x99,
+	0x99, 0xCB, 0xCC, 0xBA, 0xA9, 0x89, 0x10, 0x08, 0x31, 0x23, 0x45, 0x33,
+	0x32, 0x33, 0x24, 0x43, 0x14, 0xBA, 0xCD, 0xAC, 0x9A, 0x08, 0xA9, 0xBD,
+	0xBC, 0x08, 0x32, 0x33, 0x43, 0x32, 0x54, 0x34, 0x33, 0x21, 0x12, 0x31,
+	0x15, 0x90, 0xEB, 0xBC, 0xBB, 0xAA, 0xAB, 0xCC, 0xDC, 0xBB, 0xAA, 0x89,
+	0x80, 0xB9, 0xCB, 0x9A, 0x0A, 0x08, 0xBC, 0xCC, 0xAA, 0xBB, 0xCC, 0xCD,
+	0xCB, 0xBA, 0x99, 0x99, 0xB9, 0xBC, 0x9A, 0x09, 0x42, 0x35, 0x21, 0x21,
+	0x21, 0x98, 0xDA, 0xFC, 0xCC, 0xDB, 0xDB, 0xBC, 0xBA, 0xAC, 0x9A, 0x53,
+	0x23, 0x21, 0x23, 0x72, 0x47, 0x33, 0x23, 0x22, 0x32, 0x44, 0x12, 0x22,
+	0xA0, 0x89, 0x08, 0xCA, 0xDC, 0xBC, 0xAC, 0x9A, 0x99, 0xBA, 0xBC, 0xAB,
+	0x08, 0x30, 0x53, 0x22, 0x11, 0x43, 0x33, 0x34, 0x22, 0x00, 0x80, 0x99,
+	0xBC, 0xCF, 0xBC, 0xAA, 0xAB, 0x88, 0xB9, 0xBC, 0x0B, 0x42, 0x45, 0x24,
+	0x33, 0x43, 0x24, 0x34, 0x14, 0x12, 0x22, 0x21, 0x12, 0xA0, 0xCD, 0xBA,
+	0xAC, 0xAA, 0xCB, 0xCC, 0xBB, 0xBB, 0x8A, 0x88, 0x99, 0x00, 0x10, 0x34,
+	0x27, 0x22, 0x13, 0x21, 0x33, 0x23, 0xA1, 0xCE, 0xAD, 0x9A, 0x99, 0xAA,
+	0xBE, 0xBB, 0x9A, 0x32, 0x35, 0x01, 0x31, 0x46, 0x53, 0x33, 0x23, 0x21,
+	0x21, 0x24, 0x11, 0xCA, 0xCB, 0xCC, 0xAC, 0xCB, 0xBC, 0xAC, 0xCB, 0xBA,
+	0xBA, 0xAA, 0xCA, 0xAA, 0x09, 0x18, 0x11, 0x12, 0x21, 0x32, 0x45, 0x03,
+	0x02, 0x98, 0xBB, 0xBA, 0xFB, 0xDB, 0xCD, 0xAA, 0x99, 0xA9, 0xAA, 0xEB,
+	0xAA, 0xA8, 0xAA, 0xDB, 0xDD, 0xCB, 0xCC, 0xBB, 0xBB, 0xBC, 0xBB, 0x2A,
+	0x67, 0x22, 0x22, 0x22, 0x54, 0x45, 0x24, 0x22, 0x21, 0x21, 0x43, 0x22,
+	0x11, 0xA8, 0x99, 0x98, 0xDA, 0xCD, 0xDB, 0xAA, 0x8A, 0x9A, 0xBB, 0xBC,
+	0xAA, 0x18, 0x20, 0x33, 0x24, 0x21, 0x44, 0x33, 0x24, 0x13, 0x01, 0x00,
+	0x98, 0xCB, 0xBF, 0xAD, 0x9A, 0x99, 0x99, 0xDA, 0xAA, 0x19, 0x51, 0x34,
+	0x23, 0x53, 0x34, 0x43, 0x24, 0x23, 0x22, 0x33, 0x33, 0x13, 0xB8, 0xBE,
+	0xBC, 0xAA, 0xBB, 0xBE, 0xCD, 0xBA, 0xAA, 0x9A, 0x99, 0xAB, 0x9A, 0x09,
+	0x21, 0x33, 0x02, 0x10, 0x72, 0x53, 0x12, 0xA8, 0xDB, 0xAC, 0x08, 0x03,
+	0xA0, 0xDC, 0xAB, 0x28, 0x77, 0x24, 0x81, 0x00, 0x20, 0x73, 0x33, 0x81,
+	0x88, 0x99, 0x10, 0x91, 0xCC, 0xCC, 0xAC, 0x9A, 0xB9, 0xBD, 0xBC, 0xBB,
+	0x99, 0x80, 0xA8, 0xAA, 0x9A, 0x10, 0x34, 0x33, 0x26, 0x00, 0x29, 0x11,
+	0x88, 0x18, 0xEA, 0x8B, 0xA8, 0xCC, 0xAC, 0x9B, 0x39, 0x16, 0x11, 0x32,
+	0x18, 0x73, 0x27, 0x11, 0x12, 0x00, 0x31, 0x02, 0xB0, 0x99, 0xFB, 0x89,
+	0x98, 0xCC, 0xCB, 0xAC, 0x9B, 0x00, 0x81, 0x90, 0x0C, 0x40, 0x44, 0x35,
+	0x32, 0x22, 0x42, 0x43, 0x34, 0x22, 0x10, 0x88, 0x32, 0x31, 0x02, 0xAD,
+	0x9E, 0x98, 0x20, 0x42, 0xB8, 0xBB, 0xAA, 0x70, 0x36, 0x12, 0x10, 0x22,
+	0x37, 0x25, 0x23, 0x21, 0x42, 0x34, 0x34, 0x22, 0x81, 0x11, 0x10, 0x10,
+	0xC0, 0xDB, 0xBA, 0xCC, 0xBB, 0xCB, 0xBC, 0x9A, 0xB8, 0xA8, 0x80, 0x18,
+	0x44, 0x41, 0x34, 0x14, 0x32, 0x22, 0x00, 0x21, 0xB8, 0xDF, 0xAC, 0x9D,
+	0xBB, 0xCC, 0xCB, 0xCB, 0xAA, 0xAB, 0xAB, 0xBD, 0xBB, 0xCA, 0xAA, 0xCA,
+	0xEB, 0xCB, 0xBC, 0xCB, 0xBB, 0xBC, 0xCC, 0xCB, 0xBB, 0xBB, 0xCB, 0xBB,
+	0xCB, 0xBB, 0x89, 0x73, 0x45, 0x43, 0x22, 0x24, 0x34, 0x36, 0x43, 0x22,
+	0x23, 0x22, 0x33, 0x23, 0x02, 0x99, 0xAA, 0xB9, 0xDD, 0xCD, 0xCA, 0xBA,
+	0x9A, 0xBA, 0xBB, 0xAC, 0x9B, 0x99, 0x00, 0x31, 0x33, 0x34, 0x24, 0x23,
+	0x33, 0x24, 0x13, 0x00, 0xC9, 0xCC, 0xBD, 0xCB, 0xAB, 0xAB, 0xA9, 0xA9,
+	0x88, 0x50, 0x44, 0x44, 0x44, 0x43, 0x24, 0x33, 0x32, 0x33, 0x43, 0x33,
+	0x21, 0x90, 0xDA, 0xBC, 0xBC, 0xAC, 0xBC, 0xBC, 0xAC, 0xBB, 0xBB, 0xAA,
+	0xBA, 0xA9, 0x00, 0x42, 0x24, 0x12, 0x33, 0x63, 0x34, 0x33, 0x02, 0x90,
+	0xBA, 0x9A, 0xB8, 0xEB, 0xCC, 0xBC, 0xAA, 0x88, 0x80, 0x01, 0x11, 0x65,
+	0x34, 0x25, 0x32, 0x22, 0x53, 0x33, 0x33, 0x12, 0xA9, 0xBA, 0xDB, 0xCC,
+	0xDB, 0xBC, 0xAC, 0xAC, 0xBB, 0xCA, 0xAB, 0x9B, 0x9A, 0x09, 0x18, 0x21,
+	0x41, 0x35, 0x44, 0x43, 0x23, 0x33, 0x33, 0x33, 0x44, 0x00, 0x10, 0x80,
+	0x90, 0xD9, 0xAB, 0xAB, 0x80, 0xB9, 0x9D, 0xBB, 0x19, 0x37, 0x13, 0x10,
+	0x10, 0x31, 0x57, 0x01, 0x98, 0xAA, 0x9B, 0x82, 0xFB, 0xAE, 0xAB, 0xAC,
+	0xA9, 0xBA, 0xAB, 0xB9, 0x9A, 0x88, 0x28, 0x47, 0x33, 0x34, 0x63, 0x21,
+	0x33, 0x35, 0x21, 0x31, 0x11, 0x21, 0x81, 0xC0, 0xE9, 0x99, 0xA8, 0xCA,
+	0xAD, 0xA9, 0xAA, 0x8A, 0x98, 0xA8, 0x40, 0x41, 0x20, 0x26, 0x34, 0x31,
+	0x10, 0x43, 0x10, 0xA8, 0xA2, 0xD0, 0xBB, 0xBF, 0xAC, 0xAB, 0x0A, 0xA0,
+	0x90, 0x8F, 0x12, 0x35, 0x35, 0x12, 0x42, 0x34, 0x34, 0x32, 0x01, 0x30,
+	0x31, 0x90, 0xFA, 0xEB, 0xA9, 0xCB, 0xCB, 0xAC, 0xBB, 0xCB, 0xCA, 0xBB,
+	0x9A, 0xA9, 0x08, 0x90, 0x89, 0x71, 0x34, 0x23, 0x22, 0x13, 0x54, 0x16,
+	0x22, 0x01, 0x02, 0x30, 0x14, 0x20, 0x23, 0x18, 0x28, 0x92, 0x89, 0x23,
+	0x17, 0x30, 0x24, 0x9B, 0x33, 0x92, 0x23, 0x68, 0xE0, 0xCB, 0xBB, 0xBC,
+	0xAE, 0x8C, 0xBB, 0xBC, 0xBB, 0xE9, 0xBA, 0x9B, 0x18, 0x90, 0x00, 0x98,
+	0x17, 0x34, 0x24, 0x33, 0x26, 0x31, 0x31, 0x21, 0x42, 0xA0, 0x3A, 0xB8,
+	0xB1, 0x22, 0xEE, 0xAB, 0x98, 0x40, 0x21, 0x0A, 0x30, 0x02, 0x46, 0x27,
+	0x80, 0x11, 0x82, 0x20, 0x80, 0xBE, 0xCA, 0xB9, 0xBD, 0xCC, 0xBB, 0xBB,
+	0xDB, 0xBB, 0xAB, 0x99, 0x08, 0x29, 0x90, 0x73, 0x27, 0x53, 0x22, 0x23,
+	0x33, 0x34, 0x14, 0x33, 0x32, 0x11, 0x11, 0x89, 0xBA, 0xAD, 0xFB, 0xB9,
+	0xBB, 0xBA, 0xEC, 0xA9, 0x89, 0x09, 0x88, 0xB8, 0x8B, 0x30, 0x85, 0x03,
+	0xBA, 0x39, 0x35, 0x88, 0xF2, 0xB1, 0x1C, 0x38, 0x9B, 0xAB, 0xF9, 0x19,
+	0xB8, 0x59, 0xB8, 0x39, 0x1B, 0x53, 0x89, 0x25, 0x33, 0x15, 0x00, 0x69,
+	0x41, 0x03, 0x21, 0x32, 0x71, 0x03, 0x12, 0xAB, 0x6B, 0x00, 0xB8, 0xB1,
+	0xFA, 0x89, 0x8C, 0x08, 0xAB, 0xA0, 0x08, 0x86, 0x81, 0x17, 0x12, 0x63,
+	0x32, 0x32, 0x53, 0x02, 0x32, 0x43, 0x71, 0x57, 0x01, 0x11, 0x00, 0x51,
+	0x35, 0x13, 0x00, 0x89, 0x09, 0x02, 0xD9, 0xCB, 0xBE, 0xBB, 0xBC, 0xBD,
+	0xBC, 0xBB, 0xAC, 0xB9, 0xBB, 0xBB, 0xAC, 0x9A, 0x89, 0x08, 0x20, 0x82,
+	0xBA, 0xAD, 0x9A, 0x99, 0xFC, 0xDC, 0xBB, 0xBD, 0xCB, 0xCC, 0xAA, 0x8A,
+	0x31, 0x46, 0x13, 0x31, 0x33, 0x47, 0x35, 0x34, 0x12, 0x22, 0x31, 0x33,
+	0x33, 0x01, 0xA8, 0xAA, 0xC9, 0xED, 0xCB, 0xCB, 0xAA, 0xAA, 0xBA, 0xBC,
+	0xAB, 0x9A, 0x89, 0x18, 0x43, 0x44, 0x12, 0x12, 0x21, 0x63, 0x43, 0x02,
+	0x80, 0xA8, 0xAB, 0xAC, 0xBB, 0xAD, 0xAA, 0xBB, 0xCA, 0x9A, 0x20, 0x36,
+	0x42, 0x45, 0x43, 0x25, 0x23, 0x12, 0x31, 0x34, 0x25, 0x02, 0xA8, 0xBB,
+	0xBB, 0xAB, 0xDC, 0xBD, 0xBC, 0xBB, 0xAC, 0xAA, 0xAB, 0xAB, 0x89, 0x20,
+	0x32, 0x14, 0x33, 0x43, 0x37, 0x35, 0x22, 0x01, 0x88, 0x09, 0x11, 0x90,
+	0xCA, 0xCD, 0xAB, 0x9B, 0xA9, 0x9A, 0x99, 0x18, 0x46, 0x34, 0x33, 0x34,
+	0x43, 0x35, 0x34, 0x32, 0x01, 0x88, 0x98, 0xB9, 0xCC, 0xCC, 0xBD, 0xBB,
+	0xCC, 0xCB, 0xBA, 0xAA, 0xA9, 0xA9, 0xAB, 0x08, 0x31, 0x45, 0x33, 0x44,
+	0x43, 0x24, 0x23, 0x33, 0x42, 0x13, 0x12, 0x02, 0x10, 0x9A, 0xDB, 0xBB,
+	0x9C, 0xAA, 0xCA, 0xBC, 0xAD, 0x8A, 0x20, 0x02, 0xA0, 0x0A, 0x51, 0x35,
+	0x11, 0xA0, 0x9A, 0x28, 0x11, 0xEC, 0xCD, 0xCB, 0xAA, 0x8A, 0xCB, 0xCA,
+	0x9C, 0x8B, 0x88, 0x11, 0x12, 0x23, 0x73, 0x35, 0x53, 0x32, 0x32, 0x53,
+	0x33, 0x43, 0x12, 0x81, 0x08, 0x80, 0x90, 0xDA, 0xDC, 0xAB, 0xBC, 0xCA,
+	0xB9, 0xBB, 0xAB, 0xBB, 0x99, 0x29, 0x88, 0x17, 0x22, 0x63, 0x12, 0x22,
+	0x13, 0x13, 0x31, 0x08, 0xB9, 0x9B, 0xFA, 0xCC, 0xBB, 0x1C, 0x9B, 0x10,
+	0x93, 0x39, 0x78, 0x16, 0x14, 0x24, 0x23, 0x41, 0x13, 0x42, 0x10, 0x01,
+	0x91, 0xFA, 0xA8, 0xAA, 0x9E, 0xBC, 0xCB, 0x8B, 0xBB, 0xBA, 0xEB, 0xAA,
+	0x89, 0x28, 0x82, 0x33, 0x22, 0x35, 0x36, 0x24, 0x32, 0x33, 0x25, 0x32,
+	0x23, 0x83, 0x29, 0x00, 0x19, 0x08, 0x1D, 0xAE, 0xDB, 0x99, 0x0A, 0xA8,
+	0x01, 0xD9, 0x0C, 0x90, 0x91, 0x41, 0x01, 0x1D, 0x0B, 0xDB, 0xD0, 0xBA,
+	0x9D, 0xAA, 0x9D, 0xAA, 0xBD, 0x9B, 0x99, 0xA9, 0xA1, 0x50, 0x22, 0x70,
+	0x22, 0x34, 0x53, 0x53, 0x22, 0x12, 0x02, 0x42, 0x32, 0x32, 0x99, 0x0C,
+	0xCA, 0x89, 0xD9, 0xEB, 0xAA, 0xAA, 0xAB, 0x8B, 0x0C, 0xAC, 0x99, 0x89,
+	0x52, 0x32, 0x92, 0x99, 0x6C, 0x33, 0x24, 0x88, 0x0C, 0x9A, 0x21, 0xB9,
+	0xFA, 0x8D, 0x19, 0x9A, 0x82, 0x1A, 0x49, 0x32, 0x15, 0x50, 0x32, 0x37,
+	0x13, 0x23, 0x33, 0x42, 0x16, 0x11, 0x99, 0xA0, 0x08, 0xC8, 0xC0, 0xBD,
+	0xBA, 0xDA, 0xBA, 0x89, 0xAB, 0xBB, 0xBA, 0x0C, 0x39, 0x23, 0x10, 0x13,
+	0x77, 0x12, 0x03, 0x83, 0x21, 0x93, 0x32, 0x82, 0xF1, 0x8D, 0x8B, 0x9B,
+	0xD0, 0x9A, 0x08, 0xF0, 0x91, 0x99, 0x80, 0x42, 0x05, 0x31, 0x20, 0x31,
+	0x73, 0x12, 0x32, 0x0A, 0x8B, 0x80, 0xD5, 0x9C, 0xCB, 0x8B, 0xAB, 0xBB,
+	0x9D, 0xD9, 0x88, 0x1A, 0x15, 0x28, 0x39, 0x79, 0x31, 0x12, 0x16, 0x99,
+	0x88, 0x38, 0x1D, 0xBA, 0xCC, 0xBB, 0x9B, 0x9B, 0xBC, 0xCB, 0xA9, 0x18,
+	0x33, 0x73, 0x12, 0x24, 0x36, 0x43, 0x13, 0x24, 0x10, 0x13, 0x02, 0x2A,
+	0xE2, 0xB8, 0xEB, 0xAC, 0xAA, 0xBA, 0xBB, 0x8E, 0x8A, 0x8A, 0x31, 0x01,
+	0x54, 0x14, 0x24, 0x33, 0x16, 0x23, 0x23, 0x21, 0x90, 0x08, 0xB3, 0xDA,
+	0xFB, 0xCC, 0x9A, 0xBA, 0xC8, 0xAD, 0xB8, 0x99, 0x90, 0x88, 0x98, 0x81,
+	0x27, 0x21, 0x41, 0x13, 0x33, 0x21, 0x32, 0x41, 0x99, 0x4B, 0xF0, 0xA9,
+	0xB9, 0x99, 0xF0, 0x0B, 0x9A, 0x08, 0xB1, 0x30, 0x22, 0x53, 0x36, 0x11,
+	0x24, 0x38, 0x41, 0x30, 0x48, 0x80, 0x91, 0x9A, 0xDA, 0xC9, 0xAC, 0x9B,
+	0x1B, 0x2F, 0x8C, 0x98, 0x89, 0x18, 0x35, 0x01, 0x8A, 0x69, 0x3B, 0x32,
+	0xBB, 0xC1, 0xE2, 0x05, 0x91, 0xAB, 0x89, 0x9B, 0x52, 0x00, 0x01, 0x08,
+	0xAA, 0x97, 0x20, 0x61, 0x03, 0x2B, 0xAA, 0xBB, 0x2A, 0xC3, 0xB3, 0xCF,
+	0xAA, 0x18, 0xB0, 0x11, 0x8A, 0xD2, 0x53, 0xA3, 0x82, 0x21, 0x72, 0x26,
+	0x28, 0xA2, 0x03, 0x1A, 0x1C, 0x3A, 0xB2, 0xD2, 0x9B, 0xAF, 0x08, 0x09,
+	0xB0, 0xA8, 0xB0, 0x11, 0x15, 0xF3, 0x91, 0x60, 0x3B, 0x13, 0xA0, 0xA1,
+	0x21, 0xA1, 0x05, 0x0B, 0x87, 0xB8, 0x01, 0x29, 0x12, 0x73, 0x01, 0x59,
+	0x21, 0x81, 0x93, 0x23, 0x42, 0x50, 0x13, 0xBD, 0xD9, 0xC9, 0xC9, 0xB2,
+	0xBC, 0xD9, 0xB9, 0x9B, 0xD8, 0x89, 0xA8, 0xB2, 0x61, 0x48, 0x20, 0x23,
+	0x7A, 0x21, 0x10, 0x21, 0x10, 0x4B, 0xAA, 0x98, 0xB0, 0xF1, 0xC9, 0x09,
+	0x9B, 0xC3, 0xA9, 0x49, 0x09, 0x37, 0x81, 0x50, 0x80, 0x50, 0x11, 0x92,
+	0xA5, 0x98, 0x88, 0x0C, 0x91, 0x8C, 0xB0, 0x0C, 0xA9, 0xA0, 0x71, 0x18,
+	0x82, 0x40, 0x19, 0x16, 0x32, 0x18, 0x80, 0xC9, 0xB1, 0xB0, 0xF8, 0xD9,
+	0xB9, 0xBD, 0xBA, 0x9A, 0x9C, 0xBB, 0xC9, 0xC1, 0x91, 0x31, 0x50, 0x10,
+	0x50, 0x23, 0x24, 0x22, 0x05, 0x01, 0x19, 0x73, 0x00, 0x99, 0x88, 0x1C,
+	0x3C, 0x80, 0x1B, 0x0F, 0xA0, 0xA2, 0x6A, 0x81, 0x04, 0x91, 0x11, 0xAB,
+	0x41, 0x3A, 0xF3, 0xB8, 0x9A, 0x1B, 0xFB, 0xD8, 0x89, 0x0C, 0xA9, 0x1A,
+	0xCB, 0x99, 0x8B, 0x2A, 0x38, 0x89, 0x4D, 0x48, 0x91, 0x31, 0x70, 0x12,
+	0x11, 0x71, 0x80, 0x13, 0x24, 0x41, 0x19, 0x22, 0x20, 0x42, 0x3A, 0x10,
+	0xB5, 0x84, 0x19, 0x23, 0x9F, 0xD0, 0x80, 0x99, 0x8A, 0x8C, 0xAA, 0xBB,
+	0xBF, 0xB1, 0x8A, 0xD1, 0x00, 0x1B, 0x19, 0x19, 0x53, 0x21, 0xB3, 0xB7,
+	0x11, 0x83, 0xB5, 0x21, 0xE3, 0xC2, 0xB8, 0xB3, 0x0C, 0x92, 0x2C, 0xB9,
+	0x20, 0x41, 0x19, 0x16, 0x33, 0x50, 0x24, 0x34, 0x03, 0x00, 0x43, 0x93,
+	0x14, 0x2A, 0x9A, 0xD2, 0xE9, 0xAA, 0x09, 0x9C, 0x9C, 0x09, 0x99, 0xA0,
+	0x41, 0xA8, 0x35, 0x39, 0x25, 0x03, 0x79, 0x49, 0x89, 0x92, 0x18, 0xCB,
+	0x9C, 0xFA, 0xB0, 0x91, 0x1D, 0x90, 0xB9, 0x9B, 0x19, 0x87, 0x20, 0x40,
+	0x10, 0x13, 0x43, 0x04, 0x22, 0x51, 0x20, 0x03, 0x21, 0x80, 0x9B, 0xAC,
+	0x1A, 0xFB, 0x2B, 0x9B, 0xAF, 0x90, 0x99, 0x39, 0x59, 0x90, 0x31, 0x01,
+	0x37, 0x11, 0xA3, 0x06, 0x92, 0xA0, 0xE9, 0xA0, 0x1A, 0xAD, 0xAC, 0x9B,
+	0xB9, 0xCC, 0xB9, 0x98, 0x29, 0x10, 0x53, 0x12, 0x73, 0x15, 0x52, 0x21,
+	0x32, 0x93, 0x51, 0x21, 0x02, 0x9A, 0x09, 0xA0, 0xBC, 0xDE, 0xA9, 0xB9,
+	0xBB, 0xA9, 0xD1, 0xB8, 0x94, 0x32, 0x61, 0x48, 0x28, 0x33, 0x34, 0x33,
+	0x22, 0x02, 0x83, 0xA1, 0xE5, 0xC8, 0xB9, 0x8E, 0xAB, 0xCA, 0x9B, 0x9C,
+	0xCA, 0x99, 0x89, 0x3A, 0x18, 0x24, 0x73, 0x21, 0x25, 0x30, 0x12, 0x70,
+	0x10, 0x28, 0x30, 0x8A, 0x88, 0xA8, 0x2C, 0xFA, 0x9A, 0xBB, 0xBA, 0xB9,
+	0x8B, 0xF9, 0x2B, 0x90, 0xA3, 0x51, 0x3C, 0x32, 0x12, 0x21, 0x39, 0x4D,
+	0x19, 0xB3, 0x1B, 0xF9, 0xB9, 0xC1, 0xE2, 0x9B, 0x8A, 0x09, 0x39, 0x8C,
+	0xB0, 0x81, 0x72, 0x92, 0x86, 0x10, 0x33, 0x80, 0x21, 0x53, 0x8A, 0x95,
+	0x11, 0xB1, 0x0E, 0x99, 0xBC, 0xB0, 0x9F, 0x89, 0x99, 0xC1, 0x19, 0xB2,
+	0x71, 0x22, 0x04, 0x22, 0x22, 0x52, 0x53, 0x28, 0x58, 0x08, 0x08, 0xAA,
+	0x91, 0xD0, 0xA9, 0xBC, 0xBB, 0x9F, 0xBA, 0xAA, 0x9B, 0xAC, 0xBA, 0x30,
+	0x59, 0x09, 0x23, 0x35, 0x92, 0x87, 0x41, 0x00, 0x93, 0x22, 0x20, 0x12,
+	0xB8, 0xBB, 0xA9, 0x11, 0x3D, 0xF0, 0x80, 0x92, 0x3A, 0x31, 0x20, 0xBB,
+	0x12, 0x46, 0x39, 0x80, 0xA0, 0x93, 0x31, 0xBB, 0x1D, 0xBC, 0xB0, 0x2D,
+	0xAC, 0x98, 0x19, 0x58, 0x1C, 0x98, 0x83, 0xA3, 0x73, 0x09, 0x13, 0x41,
+	0xA2, 0xF1, 0x12, 0x80, 0x8B, 0xCA, 0x49, 0x8C, 0xB8, 0x8A, 0xB9, 0x30,
+	0x30, 0x7A, 0x21, 0x94, 0x25, 0x62, 0x48, 0x19, 0x13, 0x03, 0x41, 0x84,
+	0x11, 0x89, 0x9A, 0x88, 0x9D, 0xBB, 0xBE, 0x8C, 0xAB, 0x9C, 0x9B, 0xDA,
+	0x19, 0x09, 0x0A, 0x18, 0x0A, 0x04, 0x36, 0x38, 0x53, 0x22, 0x21, 0x54,
+	0xA1, 0x02, 0x08, 0x23, 0x9F, 0x8B, 0x89, 0xD9, 0x00, 0xBC, 0xC1, 0xB0,
+	0xA2, 0xA3, 0x95, 0x12, 0x34, 0x32, 0x07, 0x93, 0x05, 0x04, 0x03, 0x02,
+	0x12, 0x50, 0x1A, 0xC2, 0x1B, 0xA0, 0xA9, 0x9C, 0x1E, 0x9A, 0xBB, 0x1B,
+	0x9A, 0x51, 0xAB, 0x97, 0x1A, 0xB2, 0x12, 0x1A, 0xFA, 0x2B, 0x0D, 0x1A,
+	0xCA, 0xA9, 0xAC, 0x90, 0x1C, 0xAB, 0xF8, 0xB1, 0x31, 0x08, 0xB3, 0x97,
+	0x32, 0x51, 0x49, 0x20, 0x83, 0x86, 0x11, 0x08, 0x02, 0x39, 0xB8, 0x2F,
+	0x89, 0x0A, 0x9A, 0xA8, 0x8D, 0x0D, 0x1A, 0x8A, 0x99, 0xE3, 0xB1, 0x90,
+	0x25, 0x98, 0x21, 0x84, 0x29, 0x6D, 0x28, 0x3A, 0xD1, 0xA0, 0x02, 0x95,
+	0x8A, 0x1A, 0x89, 0xC2, 0x02, 0x0B, 0x13, 0x1D, 0xA0, 0xA4, 0x02, 0x79,
+	0xA1, 0x30, 0x2D, 0x09, 0xD4, 0x18, 0x0A, 0xFB, 0x00, 0x0A, 0xD0, 0x91,
+	0x8A, 0x10, 0x2C, 0x1A, 0x22, 0x0B, 0x93, 0x71, 0x81, 0x04, 0x03, 0xA0,
+	0x73, 0x82, 0x49, 0x3B, 0x0A, 0x1A, 0x91, 0xBA, 0xB9, 0xAE, 0x90, 0x9D,
+	0x90, 0xCB, 0x91, 0x9D, 0xB4, 0x22, 0x5A, 0x4A, 0x5B, 0x11, 0x08, 0x12,
+	0x94, 0x14, 0x21, 0x4A, 0x34, 0x21, 0xA0, 0x07, 0x29, 0x18, 0x8B, 0x01,
+	0x0E, 0x9B, 0x0A, 0x0C, 0x2D, 0x99, 0xA9, 0x29, 0xB3, 0x0B, 0xB5, 0x08,
+	0x07, 0x80, 0x6B, 0x18, 0xB2, 0x11, 0x20, 0x09, 0xDB, 0x18, 0xF3, 0xC0,
+	0xB1, 0x8A, 0x98, 0xB8, 0xC1, 0xC0, 0x91, 0x71, 0x89, 0xA3, 0x32, 0xB1,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const VOICE_PROMPT_t g_voicePromptSync = { s_voicePromptSyncData, 80441, 44100 };
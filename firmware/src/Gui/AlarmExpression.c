@@ -1596,43 +1596,9 @@ void AlarmExpression_FrameUpdateCallback ( uintptr_t context, uint32_t currTick)
     TickType_t xGuiTick = xTaskGetTickCount();
 //    SYS_PRINT("VideoControl_FrameUpdate %d/%d  \n", alarmVideoControl.frameIndex ,alarmVideoControl.frameTotal);   
     
-    unsigned long line;
-    unsigned long frame_add = alarmVideoControl.frameIndex * alarmVideoControl.frameSizeInBytes ;
-//    SYS_PRINT("frame_add %d \n" ,frame_add) ;
-    unsigned long dest_add = 0;
-    unsigned long input_add = 0;
-    for (line = 0 ; line < alarmVideoControl.h; line++)
-    {
-        dest_add = (alarmVideoControl.x + (alarmVideoControl.y + line ) * alarmVideoControl.screenWidth) * alarmVideoControl.bytesPerPixel;
-        input_add = frame_add + line * alarmVideoControl.frameLineInBytes;
-//        SYS_PRINT("line %d dest_add %d input_add %d \n" ,line, dest_add, input_add );
-        // protect overflow
-        if ( dest_add + alarmVideoControl.frameLineInBytes > alarmVideoControl.screenSizeInBytes) 
-        {
-            SYS_PRINT("error line %d dest_add %d input_add %d \n" ,line, dest_add, input_add );
-            break;
-        }
-        if ( input_add + alarmVideoControl.frameLineInBytes > alarmVideoControl.inputSizeInBytes)
-        {
-            SYS_PRINT("error line %d dest_add %d input_add %d \n" ,line, dest_add, input_add );
-            break;
-        }
-        if ( alarmVideoControl.outputBuffer > 0 && alarmVideoControl.outputBuffer1 > 0)
-        {
-            VideoControl_MemCopy(alarmVideoControl.outputBuffer + dest_add, 
-                    alarmVideoControl.inputBuffer + input_add, 
-                    alarmVideoControl.frameLineInBytes);
-            VideoControl_MemCopy(alarmVideoControl.outputBuffer1 + dest_add, 
-                    alarmVideoControl.inputBuffer + input_add, 
-                    alarmVideoControl.frameLineInBytes);    
-        }
-        else
-        {
-            SYS_PRINT("error inputBuffer, outputBuffer");
-        }
-    }
-//    SYS_PRINT("dest_add %d \n" ,dest_add) ;
-//    SYS_PRINT("input_add %d \n" ,input_add) ;
+    // both buffers hold the previous frame, so a delta frame only draws its changed rectangles
+    VideoControl_BlitFrame(&alarmVideoControl, alarmVideoControl.frameIndex, alarmVideoControl.outputBuffer);
+    VideoControl_BlitFrame(&alarmVideoControl, alarmVideoControl.frameIndex, alarmVideoControl.outputBuffer1);
       
     if (alarmVideoControl.frameIndex < alarmVideoControl.frameTotal )
     {
@@ -1696,17 +1662,19 @@ void AlarmExpression_Run(void)
                     //decode frame
                     if (alarmVideoControl.frameReady < alarmVideoControl.frameTotal)            
                     {
-                        uint32_t fileSize = alarmExpressionConfigList[gs_alarmData.id].alarmAnimationData->frameData[alarmVideoControl.frameReady].size;
-                        // W/A init function called before file data loaded, so used the pointer
-                        uint8_t **compressedBufferAddr = (uint8_t **)alarmExpressionConfigList[gs_alarmData.id].alarmAnimationData->frameData[alarmVideoControl.frameReady].data;
-                        TickType_t xGuiTick = xTaskGetTickCount();
-                        VideoControl_DecodeFrame(&alarmVideoControl, alarmVideoControl.frameReady, *compressedBufferAddr, fileSize);
-                        xGuiTick = xTaskGetTickCount() - xGuiTick;
-                        if (xGuiTick > FRAME_RATE_MS )
+                        if (!alarmVideoControl.isDecoding)
+                        {
+                            uint32_t fileSize = alarmExpressionConfigList[gs_alarmData.id].alarmAnimationData->frameData[alarmVideoControl.frameReady].size;
+                            // W/A init function called before file data loaded, so used the pointer
+                            uint8_t **compressedBufferAddr = (uint8_t **)alarmExpressionConfigList[gs_alarmData.id].alarmAnimationData->frameData[alarmVideoControl.frameReady].data;
+                            // frame can not be decoded is skipped by frameReady
+                            VideoControl_DecodeFrameStart(&alarmVideoControl, alarmVideoControl.frameReady, *compressedBufferAddr, fileSize);
+                        }
+                        // decode part of frame, bounded by decode budget of each GUI tick
+                        if (alarmVideoControl.isDecoding)
                         {
-                            SYS_PRINT("VideoControl_DecodeLzma (tick) %d alarmVideoControl.frameReady %d \n",xGuiTick, alarmVideoControl.frameReady);
+                            VideoControl_DecodeFrameStep(&alarmVideoControl);
                         }
-                        alarmVideoControl.frameReady++;
                     }
 
                     if (alarmVideoControl.frameIndex >= alarmVideoControl.frameTotal)
@@ -18,7 +18,6 @@
 
 #include "mm.h"
 #include "System/USBInterface.h"
-#include "../Device/AudioDefine.h"
 
 /** @brief Get tick */
 #define GET_TICKS() __builtin_mfc0(9, 0)
@@ -40,6 +39,14 @@
 #define    FILE_NAME_GRAPHIC_ABELFONT                           "SQI_AbelFont_CRC.bin"
 #define    FILE_NAME_GRAPHIC_BEBASFONT                          "SQI_BebasFont_CRC.bin"
 
+//Bundle of all files in g_fileList, written by tools/AssetPacker. Loaded instead
+//of the single files when it is on SQI Flash
+#define    FILE_NAME_ASSET_BUNDLE                               "SQI_Assets.jfab"
+
+//Manifest of assets copied by differential upgrade, removed when assets on SQI
+//Flash do not match it any more
+#define    FILE_NAME_ASSET_MANIFEST                             "SQI_Manifest.jflo"
+
 #define FONT_IMAGE_TOTAL_FILES 3
 
 // Intro video file define
@@ -84,7 +91,6 @@
 
 /** @brief Total media files in UI */
 #define    NUMBER_FILE_IMAGE_FONT               FONT_IMAGE_TOTAL_FILES \
-                                                + AUDIO_TOTAL_FILE \
                                                 +INTRO_VIDEO_TOTAL_FILES \
                                                 +ALARM_E001_TOTAL_FILES \
                                                 +ALARM_E002_TOTAL_FILES \
@@ -111,10 +117,7 @@ enum
     eImageAssetId,
     eFontAssetId,
     eIntroVideoAssetId,
-    eAlarmVideoAssetId,
-    eAudioLow260msAssetId,
-    eAudioMedium260msAssetId,
-    eAudioHigh210msAssetId
+    eAlarmVideoAssetId
 };
 
 // Storage of image on UI 
@@ -139,179 +142,176 @@ const FILE_ITEM_t g_fileList[NUMBER_FILE_IMAGE_FONT] = {
     {eFontAssetId, FILE_NAME_GRAPHIC_ABELFONT, g_graphicAbelFont, SIZE_GRAPHIC_ABELFONT},
     {eFontAssetId, FILE_NAME_GRAPHIC_BEBASFONT, g_graphicBebasFont, SIZE_GRAPHIC_BEBASFONT},
     // data will contain the index
-    {eIntroVideoAssetId,"I_01", (uint8_t*)0 ,572},
-    {eIntroVideoAssetId,"I_02", (uint8_t*)1 ,427},
-    {eIntroVideoAssetId,"I_03", (uint8_t*)2 ,849},
-    {eIntroVideoAssetId,"I_04", (uint8_t*)3 ,989},
-    {eIntroVideoAssetId,"I_05", (uint8_t*)4 ,1337},
-    {eIntroVideoAssetId,"I_06", (uint8_t*)5 ,1888},
-    {eIntroVideoAssetId,"I_07", (uint8_t*)6 ,1996},
-    {eIntroVideoAssetId,"I_08", (uint8_t*)7 ,570},
-    {eIntroVideoAssetId,"I_09", (uint8_t*)8 ,710},
-    {eIntroVideoAssetId,"I_10", (uint8_t*)9 ,1169},
-    {eIntroVideoAssetId,"I_11", (uint8_t*)10 ,2163},
-    {eIntroVideoAssetId,"I_12", (uint8_t*)11 ,3212},
-    {eIntroVideoAssetId,"I_13", (uint8_t*)12 ,4265},
-    {eIntroVideoAssetId,"I_14", (uint8_t*)13 ,5870},
-    {eIntroVideoAssetId,"I_15", (uint8_t*)14 ,7735},
-    {eIntroVideoAssetId,"I_16", (uint8_t*)15 ,8743},
-    {eIntroVideoAssetId,"I_17", (uint8_t*)16 ,9664},
-    {eIntroVideoAssetId,"I_18", (uint8_t*)17 ,10679},
-    {eIntroVideoAssetId,"I_19", (uint8_t*)18 ,11805},
-    {eIntroVideoAssetId,"I_20", (uint8_t*)19 ,14143},
-    {eIntroVideoAssetId,"I_21", (uint8_t*)20 ,17526},
-    {eIntroVideoAssetId,"I_22", (uint8_t*)21 ,19140},
-    {eIntroVideoAssetId,"I_23", (uint8_t*)22 ,18318},
-    {eIntroVideoAssetId,"I_24", (uint8_t*)23 ,17503},
-    {eIntroVideoAssetId,"I_25", (uint8_t*)24 ,17543},
-    {eIntroVideoAssetId,"I_26", (uint8_t*)25 ,17965},
-    {eIntroVideoAssetId,"I_27", (uint8_t*)26 ,16953},
-    {eIntroVideoAssetId,"I_28", (uint8_t*)27 ,14669},
-    {eIntroVideoAssetId,"I_29", (uint8_t*)28 ,11491},
-    {eIntroVideoAssetId,"I_30", (uint8_t*)29 ,11342},
-    {eIntroVideoAssetId,"I_31", (uint8_t*)30 ,12094},
-    {eIntroVideoAssetId,"I_32", (uint8_t*)31 ,12344},
-    {eIntroVideoAssetId,"I_33", (uint8_t*)32 ,12356},
-    {eIntroVideoAssetId,"I_34", (uint8_t*)33 ,12395},
-    {eIntroVideoAssetId,"I_35", (uint8_t*)34 ,11978},
-    {eIntroVideoAssetId,"I_36", (uint8_t*)35 ,12508},
-    {eIntroVideoAssetId,"I_37", (uint8_t*)36 ,12320},
-    {eIntroVideoAssetId,"I_38", (uint8_t*)37 ,14033},
-    {eIntroVideoAssetId,"I_39", (uint8_t*)38 ,13225},
-    {eIntroVideoAssetId,"I_40", (uint8_t*)39 ,9262},
-    {eIntroVideoAssetId,"I_41", (uint8_t*)40 ,7740},
-    {eIntroVideoAssetId,"I_42", (uint8_t*)41 ,8304},
-    {eIntroVideoAssetId,"I_43", (uint8_t*)42 ,8513},
-    {eIntroVideoAssetId,"I_44", (uint8_t*)43 ,8568},
-    {eIntroVideoAssetId,"I_45", (uint8_t*)44 ,8600},
-    {eIntroVideoAssetId,"I_46", (uint8_t*)45 ,8579},
-    {eIntroVideoAssetId,"I_47", (uint8_t*)46 ,8742},
-    {eIntroVideoAssetId,"I_48", (uint8_t*)47 ,8596},
-    {eIntroVideoAssetId,"I_49", (uint8_t*)48 ,8594},
-    {eIntroVideoAssetId,"I_50", (uint8_t*)49 ,8720},
+    {eIntroVideoAssetId,"I_01", (uint8_t*)0 ,562},
+    {eIntroVideoAssetId,"I_02", (uint8_t*)1 ,91},
+    {eIntroVideoAssetId,"I_03", (uint8_t*)2 ,286},
+    {eIntroVideoAssetId,"I_04", (uint8_t*)3 ,603},
+    {eIntroVideoAssetId,"I_05", (uint8_t*)4 ,906},
+    {eIntroVideoAssetId,"I_06", (uint8_t*)5 ,1417},
+    {eIntroVideoAssetId,"I_07", (uint8_t*)6 ,1484},
+    {eIntroVideoAssetId,"I_08", (uint8_t*)7 ,230},
+    {eIntroVideoAssetId,"I_09", (uint8_t*)8 ,287},
+    {eIntroVideoAssetId,"I_10", (uint8_t*)9 ,692},
+    {eIntroVideoAssetId,"I_11", (uint8_t*)10 ,1566},
+    {eIntroVideoAssetId,"I_12", (uint8_t*)11 ,2417},
+    {eIntroVideoAssetId,"I_13", (uint8_t*)12 ,3451},
+    {eIntroVideoAssetId,"I_14", (uint8_t*)13 ,4909},
+    {eIntroVideoAssetId,"I_15", (uint8_t*)14 ,6402},
+    {eIntroVideoAssetId,"I_16", (uint8_t*)15 ,7366},
+    {eIntroVideoAssetId,"I_17", (uint8_t*)16 ,8338},
+    {eIntroVideoAssetId,"I_18", (uint8_t*)17 ,9300},
+    {eIntroVideoAssetId,"I_19", (uint8_t*)18 ,10258},
+    {eIntroVideoAssetId,"I_20", (uint8_t*)19 ,12613},
+    {eIntroVideoAssetId,"I_21", (uint8_t*)20 ,16043},
+    {eIntroVideoAssetId,"I_22", (uint8_t*)21 ,17499},
+    {eIntroVideoAssetId,"I_23", (uint8_t*)22 ,16766},
+    {eIntroVideoAssetId,"I_24", (uint8_t*)23 ,16014},
+    {eIntroVideoAssetId,"I_25", (uint8_t*)24 ,16235},
+    {eIntroVideoAssetId,"I_26", (uint8_t*)25 ,17706},
+    {eIntroVideoAssetId,"I_27", (uint8_t*)26 ,15688},
+    {eIntroVideoAssetId,"I_28", (uint8_t*)27 ,13271},
+    {eIntroVideoAssetId,"I_29", (uint8_t*)28 ,10418},
+    {eIntroVideoAssetId,"I_30", (uint8_t*)29 ,10073},
+    {eIntroVideoAssetId,"I_31", (uint8_t*)30 ,10626},
+    {eIntroVideoAssetId,"I_32", (uint8_t*)31 ,10968},
+    {eIntroVideoAssetId,"I_33", (uint8_t*)32 ,11005},
+    {eIntroVideoAssetId,"I_34", (uint8_t*)33 ,10881},
+    {eIntroVideoAssetId,"I_35", (uint8_t*)34 ,10358},
+    {eIntroVideoAssetId,"I_36", (uint8_t*)35 ,10513},
+    {eIntroVideoAssetId,"I_37", (uint8_t*)36 ,10224},
+    {eIntroVideoAssetId,"I_38", (uint8_t*)37 ,11270},
+    {eIntroVideoAssetId,"I_39", (uint8_t*)38 ,10111},
+    {eIntroVideoAssetId,"I_40", (uint8_t*)39 ,5435},
+    {eIntroVideoAssetId,"I_41", (uint8_t*)40 ,4141},
+    {eIntroVideoAssetId,"I_42", (uint8_t*)41 ,4352},
+    {eIntroVideoAssetId,"I_43", (uint8_t*)42 ,4535},
+    {eIntroVideoAssetId,"I_44", (uint8_t*)43 ,4602},
+    {eIntroVideoAssetId,"I_45", (uint8_t*)44 ,376},
+    {eIntroVideoAssetId,"I_46", (uint8_t*)45 ,789},
+    {eIntroVideoAssetId,"I_47", (uint8_t*)46 ,1128},
+    {eIntroVideoAssetId,"I_48", (uint8_t*)47 ,516},
+    {eIntroVideoAssetId,"I_49", (uint8_t*)48 ,257},
+    {eIntroVideoAssetId,"I_50", (uint8_t*)49 ,562},
     //
-    {eAlarmVideoAssetId, "A1_01", (uint8_t*)0, 9824},
-    {eAlarmVideoAssetId, "A1_02", (uint8_t*)1, 9822},
-    {eAlarmVideoAssetId, "A1_03", (uint8_t*)2, 9822},
-    {eAlarmVideoAssetId, "A1_04", (uint8_t*)3, 9827},
-    {eAlarmVideoAssetId, "A1_05", (uint8_t*)4, 9822},
-    {eAlarmVideoAssetId, "A1_06", (uint8_t*)5, 9822},
-    {eAlarmVideoAssetId, "A1_07", (uint8_t*)6, 9822},
-    {eAlarmVideoAssetId, "A1_08", (uint8_t*)7, 9822},
-    {eAlarmVideoAssetId, "A1_09", (uint8_t*)8, 9822},
-    {eAlarmVideoAssetId, "A1_10", (uint8_t*)9, 9817},
-    {eAlarmVideoAssetId, "A1_11", (uint8_t*)10, 9817},
-    {eAlarmVideoAssetId, "A1_12", (uint8_t*)11, 9818},
-    {eAlarmVideoAssetId, "A1_13", (uint8_t*)12, 9821},
-    {eAlarmVideoAssetId, "A1_14", (uint8_t*)13, 9821},
-    {eAlarmVideoAssetId, "A1_15", (uint8_t*)14, 9821},
-    {eAlarmVideoAssetId, "A1_16", (uint8_t*)15, 9906},
-    {eAlarmVideoAssetId, "A1_17", (uint8_t*)16, 10479},
-    {eAlarmVideoAssetId, "A1_18", (uint8_t*)17, 11151},
-    {eAlarmVideoAssetId, "A1_19", (uint8_t*)18, 11932},
-    {eAlarmVideoAssetId, "A1_20", (uint8_t*)19, 12758},
-    {eAlarmVideoAssetId, "A1_21", (uint8_t*)20, 13123},
-    {eAlarmVideoAssetId, "A1_22", (uint8_t*)21, 13473},
-    {eAlarmVideoAssetId, "A1_23", (uint8_t*)22, 13653},
-    {eAlarmVideoAssetId, "A1_24", (uint8_t*)23, 13741},
-    {eAlarmVideoAssetId, "A1_25", (uint8_t*)24, 13752},
-    {eAlarmVideoAssetId, "A1_26", (uint8_t*)25, 13746},
-    {eAlarmVideoAssetId, "A1_27", (uint8_t*)26, 13656},
-    {eAlarmVideoAssetId, "A1_28", (uint8_t*)27, 13554},
-    {eAlarmVideoAssetId, "A1_29", (uint8_t*)28, 13465},
-    {eAlarmVideoAssetId, "A1_30", (uint8_t*)29, 13437},
-    {eAlarmVideoAssetId, "A1_31", (uint8_t*)30, 13483},
-    {eAlarmVideoAssetId, "A1_32", (uint8_t*)31, 13464},
-    {eAlarmVideoAssetId, "A1_33", (uint8_t*)32, 13358},
-    {eAlarmVideoAssetId, "A1_34", (uint8_t*)33, 13387},
-    {eAlarmVideoAssetId, "A1_35", (uint8_t*)34, 13422},
-    {eAlarmVideoAssetId, "A1_36", (uint8_t*)35, 13425},
-    {eAlarmVideoAssetId, "A1_37", (uint8_t*)36, 13407},
-    {eAlarmVideoAssetId, "A1_38", (uint8_t*)37, 13422},
-    {eAlarmVideoAssetId, "A1_39", (uint8_t*)38, 13421},
-    {eAlarmVideoAssetId, "A1_40", (uint8_t*)39, 13428},
-    {eAlarmVideoAssetId, "A1_41", (uint8_t*)40, 13428},
-    {eAlarmVideoAssetId, "A1_42", (uint8_t*)41, 13399},
-    {eAlarmVideoAssetId, "A1_43", (uint8_t*)42, 13386},
-    {eAlarmVideoAssetId, "A1_44", (uint8_t*)43, 13409},
-    {eAlarmVideoAssetId, "A1_45", (uint8_t*)44, 13405},
-    {eAlarmVideoAssetId, "A1_46", (uint8_t*)45, 13423},
-    {eAlarmVideoAssetId, "A1_47", (uint8_t*)46, 13404},
-    {eAlarmVideoAssetId, "A1_48", (uint8_t*)47, 13404},
-    {eAlarmVideoAssetId, "A1_49", (uint8_t*)48, 13404},
-    {eAlarmVideoAssetId, "A1_50", (uint8_t*)49, 13423},
-    {eAlarmVideoAssetId, "A1_51", (uint8_t*)50, 13404},
-    {eAlarmVideoAssetId, "A1_52", (uint8_t*)51, 13404},
-    {eAlarmVideoAssetId, "A1_53", (uint8_t*)52, 13404},
-    {eAlarmVideoAssetId, "A1_54", (uint8_t*)53, 13423},
-    {eAlarmVideoAssetId, "A1_55", (uint8_t*)54, 13423},
+    {eAlarmVideoAssetId, "A1_01", (uint8_t*)0, 9730},
+    {eAlarmVideoAssetId, "A1_02", (uint8_t*)1, 115},
+    {eAlarmVideoAssetId, "A1_03", (uint8_t*)2, 24},
+    {eAlarmVideoAssetId, "A1_04", (uint8_t*)3, 100},
+    {eAlarmVideoAssetId, "A1_05", (uint8_t*)4, 60},
+    {eAlarmVideoAssetId, "A1_06", (uint8_t*)5, 24},
+    {eAlarmVideoAssetId, "A1_07", (uint8_t*)6, 24},
+    {eAlarmVideoAssetId, "A1_08", (uint8_t*)7, 24},
+    {eAlarmVideoAssetId, "A1_09", (uint8_t*)8, 24},
+    {eAlarmVideoAssetId, "A1_10", (uint8_t*)9, 124},
+    {eAlarmVideoAssetId, "A1_11", (uint8_t*)10, 128},
+    {eAlarmVideoAssetId, "A1_12", (uint8_t*)11, 128},
+    {eAlarmVideoAssetId, "A1_13", (uint8_t*)12, 133},
+    {eAlarmVideoAssetId, "A1_14", (uint8_t*)13, 24},
+    {eAlarmVideoAssetId, "A1_15", (uint8_t*)14, 24},
+    {eAlarmVideoAssetId, "A1_16", (uint8_t*)15, 1087},
+    {eAlarmVideoAssetId, "A1_17", (uint8_t*)16, 1647},
+    {eAlarmVideoAssetId, "A1_18", (uint8_t*)17, 2363},
+    {eAlarmVideoAssetId, "A1_19", (uint8_t*)18, 3340},
+    {eAlarmVideoAssetId, "A1_20", (uint8_t*)19, 4273},
+    {eAlarmVideoAssetId, "A1_21", (uint8_t*)20, 5100},
+    {eAlarmVideoAssetId, "A1_22", (uint8_t*)21, 6000},
+    {eAlarmVideoAssetId, "A1_23", (uint8_t*)22, 6634},
+    {eAlarmVideoAssetId, "A1_24", (uint8_t*)23, 6150},
+    {eAlarmVideoAssetId, "A1_25", (uint8_t*)24, 5147},
+    {eAlarmVideoAssetId, "A1_26", (uint8_t*)25, 13642},
+    {eAlarmVideoAssetId, "A1_27", (uint8_t*)26, 6557},
+    {eAlarmVideoAssetId, "A1_28", (uint8_t*)27, 6751},
+    {eAlarmVideoAssetId, "A1_29", (uint8_t*)28, 6279},
+    {eAlarmVideoAssetId, "A1_30", (uint8_t*)29, 6373},
+    {eAlarmVideoAssetId, "A1_31", (uint8_t*)30, 6359},
+    {eAlarmVideoAssetId, "A1_32", (uint8_t*)31, 4947},
+    {eAlarmVideoAssetId, "A1_33", (uint8_t*)32, 4820},
+    {eAlarmVideoAssetId, "A1_34", (uint8_t*)33, 4660},
+    {eAlarmVideoAssetId, "A1_35", (uint8_t*)34, 3665},
+    {eAlarmVideoAssetId, "A1_36", (uint8_t*)35, 1088},
+    {eAlarmVideoAssetId, "A1_37", (uint8_t*)36, 1363},
+    {eAlarmVideoAssetId, "A1_38", (uint8_t*)37, 876},
+    {eAlarmVideoAssetId, "A1_39", (uint8_t*)38, 365},
+    {eAlarmVideoAssetId, "A1_40", (uint8_t*)39, 126},
+    {eAlarmVideoAssetId, "A1_41", (uint8_t*)40, 130},
+    {eAlarmVideoAssetId, "A1_42", (uint8_t*)41, 628},
+    {eAlarmVideoAssetId, "A1_43", (uint8_t*)42, 435},
+    {eAlarmVideoAssetId, "A1_44", (uint8_t*)43, 130},
+    {eAlarmVideoAssetId, "A1_45", (uint8_t*)44, 45},
+    {eAlarmVideoAssetId, "A1_46", (uint8_t*)45, 575},
+    {eAlarmVideoAssetId, "A1_47", (uint8_t*)46, 45},
+    {eAlarmVideoAssetId, "A1_48", (uint8_t*)47, 47},
+    {eAlarmVideoAssetId, "A1_49", (uint8_t*)48, 45},
+    {eAlarmVideoAssetId, "A1_50", (uint8_t*)49, 49},
+    {eAlarmVideoAssetId, "A1_51", (uint8_t*)50, 13304},
+    {eAlarmVideoAssetId, "A1_52", (uint8_t*)51, 47},
+    {eAlarmVideoAssetId, "A1_53", (uint8_t*)52, 45},
+    {eAlarmVideoAssetId, "A1_54", (uint8_t*)53, 49},
+    {eAlarmVideoAssetId, "A1_55", (uint8_t*)54, 24},
     //
-    {eAlarmVideoAssetId, "A2_01", (uint8_t*)55, 3267},
-    {eAlarmVideoAssetId, "A2_02", (uint8_t*)56, 3376},
-    {eAlarmVideoAssetId, "A2_03", (uint8_t*)57, 3383},
-    {eAlarmVideoAssetId, "A2_04", (uint8_t*)58, 3443},
-    {eAlarmVideoAssetId, "A2_05", (uint8_t*)59, 3475},
-    {eAlarmVideoAssetId, "A2_06", (uint8_t*)60, 3649},
-    {eAlarmVideoAssetId, "A2_07", (uint8_t*)61, 3769},
-    {eAlarmVideoAssetId, "A2_08", (uint8_t*)62, 3934},
-    {eAlarmVideoAssetId, "A2_09", (uint8_t*)63, 4020},
-    {eAlarmVideoAssetId, "A2_10", (uint8_t*)64, 4270},
-    {eAlarmVideoAssetId, "A2_11", (uint8_t*)65, 4573},
-    {eAlarmVideoAssetId, "A2_12", (uint8_t*)66, 4921},
-    {eAlarmVideoAssetId, "A2_13", (uint8_t*)67, 5343},
-    {eAlarmVideoAssetId, "A2_14", (uint8_t*)68, 5881},
-    {eAlarmVideoAssetId, "A2_15", (uint8_t*)69, 6375},
-    {eAlarmVideoAssetId, "A2_16", (uint8_t*)70, 7003},
-    {eAlarmVideoAssetId, "A2_17", (uint8_t*)71, 7295},
-    {eAlarmVideoAssetId, "A2_18", (uint8_t*)72, 7535},
-    {eAlarmVideoAssetId, "A2_19", (uint8_t*)73, 7640},
-    {eAlarmVideoAssetId, "A2_20", (uint8_t*)74, 7533},
-    {eAlarmVideoAssetId, "A2_21", (uint8_t*)75, 7571},
-    {eAlarmVideoAssetId, "A2_22", (uint8_t*)76, 7552},
-    {eAlarmVideoAssetId, "A2_23", (uint8_t*)77, 7543},
-    {eAlarmVideoAssetId, "A2_24", (uint8_t*)78, 7560},
-    {eAlarmVideoAssetId, "A2_25", (uint8_t*)79, 7585},
-    {eAlarmVideoAssetId, "A2_26", (uint8_t*)80, 7582},
-    {eAlarmVideoAssetId, "A2_27", (uint8_t*)81, 7595},
-    {eAlarmVideoAssetId, "A2_28", (uint8_t*)82, 7617},
-    {eAlarmVideoAssetId, "A2_29", (uint8_t*)83, 7574},
-    {eAlarmVideoAssetId, "A2_30", (uint8_t*)84, 7546},
-    {eAlarmVideoAssetId, "A2_31", (uint8_t*)85, 7518},
-    {eAlarmVideoAssetId, "A2_32", (uint8_t*)86, 6981},
-    {eAlarmVideoAssetId, "A2_33", (uint8_t*)87, 6861},
-    {eAlarmVideoAssetId, "A2_34", (uint8_t*)88, 7419},
-    {eAlarmVideoAssetId, "A2_35", (uint8_t*)89, 9332},
-    {eAlarmVideoAssetId, "A2_36", (uint8_t*)90, 10759},
-    {eAlarmVideoAssetId, "A2_37", (uint8_t*)91, 14578},
-    {eAlarmVideoAssetId, "A2_38", (uint8_t*)92, 16365},
-    {eAlarmVideoAssetId, "A2_39", (uint8_t*)93, 18667},
-    {eAlarmVideoAssetId, "A2_40", (uint8_t*)94, 20366},
-    {eAlarmVideoAssetId, "A2_41", (uint8_t*)95, 22789},
-    {eAlarmVideoAssetId, "A2_42", (uint8_t*)96, 22349},
-    {eAlarmVideoAssetId, "A2_43", (uint8_t*)97, 22547},
-    {eAlarmVideoAssetId, "A2_44", (uint8_t*)98, 22454},
+    {eAlarmVideoAssetId, "A2_01", (uint8_t*)55, 3134},
+    {eAlarmVideoAssetId, "A2_02", (uint8_t*)56, 1759},
+    {eAlarmVideoAssetId, "A2_03", (uint8_t*)57, 1432},
+    {eAlarmVideoAssetId, "A2_04", (uint8_t*)58, 1619},
+    {eAlarmVideoAssetId, "A2_05", (uint8_t*)59, 2000},
+    {eAlarmVideoAssetId, "A2_06", (uint8_t*)60, 2454},
+    {eAlarmVideoAssetId, "A2_07", (uint8_t*)61, 2286},
+    {eAlarmVideoAssetId, "A2_08", (uint8_t*)62, 2385},
+    {eAlarmVideoAssetId, "A2_09", (uint8_t*)63, 2763},
+    {eAlarmVideoAssetId, "A2_10", (uint8_t*)64, 2922},
+    {eAlarmVideoAssetId, "A2_11", (uint8_t*)65, 3374},
+    {eAlarmVideoAssetId, "A2_12", (uint8_t*)66, 3870},
+    {eAlarmVideoAssetId, "A2_13", (uint8_t*)67, 4489},
+    {eAlarmVideoAssetId, "A2_14", (uint8_t*)68, 4921},
+    {eAlarmVideoAssetId, "A2_15", (uint8_t*)69, 5267},
+    {eAlarmVideoAssetId, "A2_16", (uint8_t*)70, 5688},
+    {eAlarmVideoAssetId, "A2_17", (uint8_t*)71, 5927},
+    {eAlarmVideoAssetId, "A2_18", (uint8_t*)72, 5170},
+    {eAlarmVideoAssetId, "A2_19", (uint8_t*)73, 6553},
+    {eAlarmVideoAssetId, "A2_20", (uint8_t*)74, 6526},
+    {eAlarmVideoAssetId, "A2_21", (uint8_t*)75, 2667},
+    {eAlarmVideoAssetId, "A2_22", (uint8_t*)76, 1976},
+    {eAlarmVideoAssetId, "A2_23", (uint8_t*)77, 987},
+    {eAlarmVideoAssetId, "A2_24", (uint8_t*)78, 1118},
+    {eAlarmVideoAssetId, "A2_25", (uint8_t*)79, 1135},
+    {eAlarmVideoAssetId, "A2_26", (uint8_t*)80, 7365},
+    {eAlarmVideoAssetId, "A2_27", (uint8_t*)81, 239},
+    {eAlarmVideoAssetId, "A2_28", (uint8_t*)82, 7030},
+    {eAlarmVideoAssetId, "A2_29", (uint8_t*)83, 7382},
+    {eAlarmVideoAssetId, "A2_30", (uint8_t*)84, 7378},
+    {eAlarmVideoAssetId, "A2_31", (uint8_t*)85, 7354},
+    {eAlarmVideoAssetId, "A2_32", (uint8_t*)86, 6788},
+    {eAlarmVideoAssetId, "A2_33", (uint8_t*)87, 6715},
+    {eAlarmVideoAssetId, "A2_34", (uint8_t*)88, 7280},
+    {eAlarmVideoAssetId, "A2_35", (uint8_t*)89, 9138},
+    {eAlarmVideoAssetId, "A2_36", (uint8_t*)90, 10577},
+    {eAlarmVideoAssetId, "A2_37", (uint8_t*)91, 14363},
+    {eAlarmVideoAssetId, "A2_38", (uint8_t*)92, 16162},
+    {eAlarmVideoAssetId, "A2_39", (uint8_t*)93, 18525},
+    {eAlarmVideoAssetId, "A2_40", (uint8_t*)94, 20258},
+    {eAlarmVideoAssetId, "A2_41", (uint8_t*)95, 22763},
+    {eAlarmVideoAssetId, "A2_42", (uint8_t*)96, 22307},
+    {eAlarmVideoAssetId, "A2_43", (uint8_t*)97, 22513},
+    {eAlarmVideoAssetId, "A2_44", (uint8_t*)98, 12781},
     //
-    {eAlarmVideoAssetId, "A3_01", (uint8_t*)99, 24768},
-    {eAlarmVideoAssetId, "A3_02", (uint8_t*)100, 24888},
-    {eAlarmVideoAssetId, "A3_03", (uint8_t*)101, 24456},
-    {eAlarmVideoAssetId, "A3_04", (uint8_t*)102, 24361},
-    {eAlarmVideoAssetId, "A3_05", (uint8_t*)103, 24349},
-    {eAlarmVideoAssetId, "A3_06", (uint8_t*)104, 24209},
-    {eAlarmVideoAssetId, "A3_07", (uint8_t*)105, 24236},
-    {eAlarmVideoAssetId, "A3_08", (uint8_t*)106, 24737},
-    {eAlarmVideoAssetId, "A3_09", (uint8_t*)107, 24701},
-    {eAlarmVideoAssetId, "A3_10", (uint8_t*)108, 24336},
-    {eAlarmVideoAssetId, "A3_11", (uint8_t*)109, 24176},
-    {eAlarmVideoAssetId, "A3_12", (uint8_t*)110, 24340},
-    {eAlarmVideoAssetId, "A3_13", (uint8_t*)111, 24328},
-    {eAlarmVideoAssetId, "A3_14", (uint8_t*)112, 24604},
-    {eAlarmVideoAssetId, "A3_15", (uint8_t*)113, 24568},
-    {eAlarmVideoAssetId, "A3_16", (uint8_t*)114, 24389},
-    {eAlarmVideoAssetId, "A3_17", (uint8_t*)115, 24132},
-    {eAlarmVideoAssetId, "A3_18", (uint8_t*)116, 24117},
-    {eAudioLow260msAssetId, FILE_SOUND_800HZ_260MS_LOW, (uint8_t *)0, SIZE_SOUND_800HZ_260MS_LOW},
-    {eAudioMedium260msAssetId,  FILE_SOUND_800HZ_260MS_MEDIUM, (uint8_t *)0, SIZE_SOUND_800HZ_260MS_MEDIUM},
-    {eAudioHigh210msAssetId,    FILE_SOUND_800HZ_210MS_HIGH, (uint8_t *)0, SIZE_SOUND_800HZ_210MS_HIGH},
+    {eAlarmVideoAssetId, "A3_01", (uint8_t*)99, 24696},
+    {eAlarmVideoAssetId, "A3_02", (uint8_t*)100, 12259},
+    {eAlarmVideoAssetId, "A3_03", (uint8_t*)101, 20072},
+    {eAlarmVideoAssetId, "A3_04", (uint8_t*)102, 18553},
+    {eAlarmVideoAssetId, "A3_05", (uint8_t*)103, 18216},
+    {eAlarmVideoAssetId, "A3_06", (uint8_t*)104, 15254},
+    {eAlarmVideoAssetId, "A3_07", (uint8_t*)105, 16795},
+    {eAlarmVideoAssetId, "A3_08", (uint8_t*)106, 17893},
+    {eAlarmVideoAssetId, "A3_09", (uint8_t*)107, 14068},
+    {eAlarmVideoAssetId, "A3_10", (uint8_t*)108, 15754},
+    {eAlarmVideoAssetId, "A3_11", (uint8_t*)109, 15390},
+    {eAlarmVideoAssetId, "A3_12", (uint8_t*)110, 15399},
+    {eAlarmVideoAssetId, "A3_13", (uint8_t*)111, 14904},
+    {eAlarmVideoAssetId, "A3_14", (uint8_t*)112, 14348},
+    {eAlarmVideoAssetId, "A3_15", (uint8_t*)113, 10332},
+    {eAlarmVideoAssetId, "A3_16", (uint8_t*)114, 14461},
+    {eAlarmVideoAssetId, "A3_17", (uint8_t*)115, 10345},
+    {eAlarmVideoAssetId, "A3_18", (uint8_t*)116, 8046},
     //
 //    {eAlarmVideoAssetId, "A7_01", (uint8_t*)117, 10495},
 //    {eAlarmVideoAssetId, "A7_02", (uint8_t*)118, 10508},
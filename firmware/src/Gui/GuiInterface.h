@@ -99,6 +99,8 @@ typedef enum {
     eGuiUpdateScreenMessageUpdatingESP32Firmware,// text "Updating ESP32 Firmware"   
     eGuiUpdateScreenMessageUpdateSuccessTurnOffToComplete,// "Update success, turn off device to complete"    
     eGuiUpdateScreenMessageCheckingAsset, // "Checking Assets"
+    eGuiAlarmChangeSetEventId, // alarm change set, data is slot of change set
+    eGuiFlushStorageId, // write pending settings and staged logs, see GUI_FlushStorage
     eNoOfGuiEventId,
 
 
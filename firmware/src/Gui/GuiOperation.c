@@ -26,11 +26,14 @@
 #include "system_definitions.h"
 #endif
 
+#include "semphr.h"
+
 #include "PWM_LCDBacklight.h"
 #include "GT911.h"
 
 #include "GuiInterface.h"
 #include "LogInterface.h"
+#include "LogMgr.h"
 
 #include "AlarmNotificationList.h"
 #include "MainScreen.h"
@@ -46,6 +49,12 @@ QueueHandle_t g_guiQueue;
 /** @brief Declare flag show GUI */
 static bool s_isShowGUI = false;
 
+/** @brief Given by GUI task when eGuiFlushStorageId is done */
+static SemaphoreHandle_t s_guiFlushDone = NULL;
+
+/** @brief Handle of GUI task, to flush at once when it asks for a flush */
+static TaskHandle_t s_guiTaskHandle = NULL;
+
 
 void GUI_Initialize(void)
 {
@@ -60,12 +69,39 @@ void GUI_Initialize(void)
 
     //create GUI queue for GUI task communication with other task
     g_guiQueue = xQueueCreate(GUI_QUEUE_SIZE, sizeof (GUI_EVENT_t));
+    s_guiFlushDone = xSemaphoreCreateBinary();
 
 
     DisplayControl_Initialize();
     return;
 }
 
+/** @brief This operation show the active alarm of alarm notification list
+ *  @param [in] None
+ *  @param [out] None
+ *  @return None
+ */
+static void guiTask_UpdateAlarmDisplay(void)
+{
+    int index = AlarmNotificationList_GetActiveIndex();
+    if (index >=0)
+    {
+        AlarmNotification alarmUpdate;
+        AlarmNotificationList_GetItem(index, &alarmUpdate);
+        DisplayControl_UpdateAlarm(
+                alarmUpdate.alarmId,
+                alarmUpdate.alarmStatus,
+                alarmUpdate.alarmPriority,
+                alarmUpdate.alarmData
+            );            
+    }
+    else
+    {
+        // no active alarm, disable current alarm expression
+        DisplayControl_InactiveCurrentAlarm();
+    }
+}
+
 /** @brief This operation check Gui event from Gui queue and process them
  *  @param [in] None
  *  @param [out] None
@@ -177,24 +213,33 @@ void guiTask_HandleEvent(void)
             DisplayControl_UpdateAlarmInfoButton(alarmNotification.alarmStatus);
             
             // update alarm display
-            int index = AlarmNotificationList_GetActiveIndex();
-            if (index >=0)
+            guiTask_UpdateAlarmDisplay();
+            break;
+        case eGuiAlarmChangeSetEventId:
+        {
+            // all alarms changed in one cycle of alarm task, display is updated once
+            ALARM_CHANGE_SET_t *set = alarmInterface_GetChangeSet(guiEvent.eventData.data);
+            int i;
+            for (i = 0; i < set->count; i++)
             {
-                AlarmNotification alarmUpdate;
-                AlarmNotificationList_GetItem(index, &alarmUpdate);
-                DisplayControl_UpdateAlarm(
-                        alarmUpdate.alarmId,
-                        alarmUpdate.alarmStatus,
-                        alarmUpdate.alarmPriority,
-                        alarmUpdate.alarmData
-                    );            
+                AlarmNotification alarmNotification = {
+                    .alarmId = set->changes[i].id,
+                    .alarmStatus = set->changes[i].status,
+                    .alarmPriority = set->changes[i].priority,
+                };
+                memcpy(alarmNotification.alarmData, set->changes[i].data, sizeof(alarmNotification.alarmData));
+                AlarmNotificationList_UpdateAlarm(alarmNotification);
+                DisplayControl_UpdateAlarmInfoButton(alarmNotification.alarmStatus);
             }
-            else
+            AlarmNotificationList_ProcessAlarmNotificationList();
+            guiTask_UpdateAlarmDisplay();
+            for (i = 0; i < set->count; i++)
             {
-                // no active alarm, disable current alarm expression
-                DisplayControl_InactiveCurrentAlarm();
+                alarmInterface_RecordLatency(set->changes[i].id, set->changes[i].detectTick);
             }
+            set->guiPending = false;
             break;
+        }
         case eGuiChangeToPowerOffScreenId:
             SYS_PRINT("\n\nPower Off Screen");
             DisplayControl_SetState(ePowerOffScreenIsShowingDispState);
@@ -218,6 +263,11 @@ void guiTask_HandleEvent(void)
             LogInterface_WriteDebugLogFile("Stop Operation \n");
             break;
         }
+        case eGuiFlushStorageId:
+            setting_Flush();
+            logMgr_FlushAllLog();
+            xSemaphoreGive(s_guiFlushDone);
+            break;
         case eGuiUpdateScreenMessageUSBNotFound:
             laWidget_SetVisible((laWidget*)btnOK_UpdateScreen, LA_TRUE);
             laWidget_SetVisible((laWidget*)panelMessageBox_UpdateScreen, LA_TRUE);
@@ -366,6 +416,12 @@ void GUI_Task(void)
     //Update log
     logMgr_Task();
 
+    //Write settings changed
+    setting_Task();
+
+    //Write debug log and trace
+    LogInterface_DebugLogTask();
+
 #ifdef JFLO_DEBUG_GUI   
     TickType_t xGuiTick = xTaskGetTickCount();
 #endif      
@@ -386,9 +442,35 @@ void GUI_Task(void)
 
 void GUI_Prepare()
 {
+    s_guiTaskHandle = xTaskGetCurrentTaskHandle();
     PWM_LCDBacklight_Start();
 }
 
+/** @brief Write pending settings and staged logs to SQI flash from GUI task,
+ *  where setting_Task and logMgr_Task write them, and wait for it done.
+ *  Writing them from the calling task would race with GUI task
+ *  @param [in] uint32_t maxWait : maximum time (in ms) wait for GUI task
+ *  @param [out] None
+ *  @return bool : true if written, false if GUI task did not do it in time
+ */
+bool GUI_FlushStorage(uint32_t maxWait)
+{
+    if (xTaskGetCurrentTaskHandle() == s_guiTaskHandle)
+    {
+        setting_Flush();
+        logMgr_FlushAllLog();
+        return true;
+    }
+    if (s_guiFlushDone == NULL)
+        return false;
+
+    //drop a give left by a former call which timed out
+    xSemaphoreTake(s_guiFlushDone, 0);
+    if (guiInterface_SendEvent(eGuiFlushStorageId, 0) == false)
+        return false;
+    return (xSemaphoreTake(s_guiFlushDone, maxWait / portTICK_PERIOD_MS) == pdTRUE);
+}
+
 
 /* *****************************************************************************
  End of File
@@ -22,7 +22,8 @@
 
 /* This section lists the other files that are included in this file.
  */
-
+#include <stdbool.h>
+#include <stdint.h>
 
 
 /* Provide C++ Compatibility */
@@ -36,6 +37,14 @@ void GUI_Task(void) ;
 
 void GUI_Prepare();
 
+/** @brief Write pending settings and staged logs to SQI flash from GUI task,
+ *  where setting_Task and logMgr_Task write them, and wait for it done
+ *  @param [in] uint32_t maxWait : maximum time (in ms) wait for GUI task
+ *  @param [out] None
+ *  @return bool : true if written, false if GUI task did not do it in time
+ */
+bool GUI_FlushStorage(uint32_t maxWait);
+
     /* Provide C++ Compatibility */
 #ifdef __cplusplus
 }
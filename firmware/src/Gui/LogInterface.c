@@ -18,6 +18,7 @@
 #include "DeviceInterface.h"
 #include "FileSystemMgr.h"
 #include "DisplayControl.h"
+#include "Trace.h"
 
 /** @brief Declare queue receive ID data */
 extern QueueHandle_t g_logQueueReceiveEvent;
@@ -157,6 +158,19 @@ const char languageStringList[eNoOfLanguage][3] = {
 
 SYS_FS_HANDLE logFile = SYS_FS_HANDLE_INVALID;
 
+/** @brief Declare trace file */
+static SYS_FS_HANDLE s_traceFile = SYS_FS_HANDLE_INVALID;
+
+/** @brief Declare debug log lines waiting to be written */
+static char s_debugLogStage[DEBUG_LOG_STAGE_SIZE];
+static uint32_t s_debugLogStageLength = 0;
+
+/** @brief Declare buffer to drain trace rings to trace file */
+static uint32_t s_traceDrainBuffer[TRACE_DRAIN_WORDS];
+
+/** @brief Tick of last write of debug log and trace */
+static TickType_t s_debugLogFlushTick = 0;
+
 //extern bool g_isMountUSB = true;
 /** @brief Write log data by logId
  *  @param [in] E_LogId id: log id
@@ -660,6 +674,8 @@ void LogInterface_InitDebugLogFile()
         logFileMutex = xSemaphoreCreateMutex();
     }
     logFile = SYS_FS_FileOpen(DEBUG_LOG_FILE, SYS_FS_FILE_OPEN_APPEND_PLUS);
+    s_traceFile = SYS_FS_FileOpen(TRACE_LOG_FILE, SYS_FS_FILE_OPEN_APPEND_PLUS);
+    s_debugLogStageLength = 0;
 
 #endif    
 }
@@ -670,10 +686,16 @@ void LogInterface_DeInitDebugLogFile()
     if (logFile == SYS_FS_HANDLE_INVALID)
         return; 
     
+    LogInterface_FlushDebugLogFile();
     if(logFileMutex != NULL && xSemaphoreTake( logFileMutex, ( TickType_t ) 20 ) == pdTRUE )
     {
         SYS_FS_FileClose(logFile);
         logFile = SYS_FS_HANDLE_INVALID;
+        if (s_traceFile != SYS_FS_HANDLE_INVALID)
+        {
+            SYS_FS_FileClose(s_traceFile);
+            s_traceFile = SYS_FS_HANDLE_INVALID;
+        }
         xSemaphoreGive( logFileMutex );
     }
     else
@@ -683,6 +705,114 @@ void LogInterface_DeInitDebugLogFile()
 #endif    
 }
 
+#ifdef DEBUG_LOG_TO_FILE
+/** @brief Write debug log lines waiting to be written, logFileMutex is taken
+ *  @param [in] None
+ *  @param [out] None
+ *  @return bool : true if lines were written
+ */
+static bool LogInterface_WriteDebugLogStage(void)
+{
+    uint32_t length = s_debugLogStageLength;
+
+    if (length == 0)
+        return false;
+    s_debugLogStageLength = 0;
+    if (SYS_FS_FileWrite(logFile, (void*)s_debugLogStage, length) != length)
+    {
+        /* Failed to write to the file. */
+        SYS_PRINT("\n Failed to write to the file \n");
+        return false;
+    }
+    return true;
+}
+
+/** @brief Drain trace rings to trace file, logFileMutex is taken. Trace file
+ *  starts again when it reaches TRACE_LOG_MAX_SIZE
+ *  @param [in] None
+ *  @param [out] None
+ *  @return bool : true if records were written
+ */
+static bool LogInterface_WriteTrace(void)
+{
+    uint32_t words, size;
+    bool isWritten = false;
+
+    if (s_traceFile == SYS_FS_HANDLE_INVALID)
+        return false;
+    while ((words = trace_Read(s_traceDrainBuffer, TRACE_DRAIN_WORDS)) > 0)
+    {
+        if (SYS_FS_FileSize(s_traceFile) >= TRACE_LOG_MAX_SIZE)
+        {
+            SYS_FS_FileSeek(s_traceFile, 0, SYS_FS_SEEK_SET);
+            SYS_FS_FileTruncate(s_traceFile);
+        }
+        size = words * sizeof(uint32_t);
+        if (SYS_FS_FileWrite(s_traceFile, (void*)s_traceDrainBuffer, size) != size)
+        {
+            SYS_PRINT("\n Failed to write to the trace file \n");
+            break;
+        }
+        isWritten = true;
+    }
+    return isWritten;
+}
+#endif
+
+/** @brief Write debug log lines and trace records waiting to be written, with
+ *  one sync per file
+ *  @param [in] None
+ *  @param [out] None
+ *  @return None
+ */
+void LogInterface_FlushDebugLogFile()
+{
+#ifdef DEBUG_LOG_TO_FILE
+    if (logFile == SYS_FS_HANDLE_INVALID)
+        return; 
+    if(logFileMutex != NULL && xSemaphoreTake( logFileMutex, ( TickType_t ) 20 ) == pdTRUE )
+    {
+        if (LogInterface_WriteDebugLogStage() && (SYS_FS_FileSync(logFile) != SYS_FS_RES_SUCCESS))
+        {
+            /* Could not flush the contents of the file. Error out. */
+            SYS_PRINT("\n Could not flush the contents of the file. Error out. \n");
+        }
+        if (LogInterface_WriteTrace() && (SYS_FS_FileSync(s_traceFile) != SYS_FS_RES_SUCCESS))
+        {
+            SYS_PRINT("\n Could not flush the trace file \n");
+        }
+        s_debugLogFlushTick = xTaskGetTickCount();
+        xSemaphoreGive( logFileMutex );
+    }
+    else
+    {
+        SYS_PRINT("Error: Failed to take logFileMutex \n");
+    } 
+#endif    
+}
+
+/** @brief Write debug log and trace every DEBUG_LOG_FLUSH_PERIOD_MS, called
+ *  periodically by GUI task
+ *  @param [in] None
+ *  @param [out] None
+ *  @return None
+ */
+void LogInterface_DebugLogTask()
+{
+#ifdef DEBUG_LOG_TO_FILE
+    if (xTaskGetTickCount() - s_debugLogFlushTick >= DEBUG_LOG_FLUSH_PERIOD_MS / portTICK_PERIOD_MS)
+    {
+        LogInterface_FlushDebugLogFile();
+    }
+#endif    
+}
+
+/** @brief Record a line in debug log. Line is stamped with RTC time and
+ *  written with next flush of debug log, or now if there is no room for it
+ *  @param [in] char * str : line
+ *  @param [out] None
+ *  @return None
+ */
 void LogInterface_WriteDebugLogFile(char * str)
 {
 #ifdef DEBUG_LOG_TO_FILE
@@ -692,7 +822,7 @@ void LogInterface_WriteDebugLogFile(char * str)
     {       
         Timestamp time = logMgr_getRtcTime();
         char buff[255];
-        sprintf(buff, "%.2d/%.2d/%.2d %.2d:%.2d:%.2d %s",
+        int length = snprintf(buff, sizeof(buff), "%.2d/%.2d/%.2d %.2d:%.2d:%.2d %s",
                 time.year_2,
                 time.month,
                 time.date,
@@ -701,22 +831,20 @@ void LogInterface_WriteDebugLogFile(char * str)
                 time.second,
                 str
                 );
+        if (length >= (int)sizeof(buff))
+            length = sizeof(buff) - 1;
 
-        if (SYS_FS_FileWrite(logFile, (void*)buff, strlen(buff)) != strlen(buff))
+        if (s_debugLogStageLength + length > DEBUG_LOG_STAGE_SIZE)
         {
-            /* Failed to write to the file. */
-            SYS_PRINT("\n Failed to write to the file \n");
-            SYS_FS_FileClose(logFile);
-            xSemaphoreGive( logFileMutex );
-            return;
+            if (LogInterface_WriteDebugLogStage() && (SYS_FS_FileSync(logFile) != SYS_FS_RES_SUCCESS))
+            {
+                SYS_PRINT("\n Could not flush the contents of the file. Error out. \n");
+            }
         }
-        if (SYS_FS_FileSync(logFile) != SYS_FS_RES_SUCCESS)
+        if (length > 0)
         {
-            /* Could not flush the contents of the file. Error out. */
-            SYS_PRINT("\n Could not flush the contents of the file. Error out. \n");
-            SYS_FS_FileClose(logFile);
-            xSemaphoreGive( logFileMutex );
-            return;
+            memcpy(&s_debugLogStage[s_debugLogStageLength], buff, length);
+            s_debugLogStageLength += length;
         }
         xSemaphoreGive( logFileMutex );
     }
@@ -726,6 +854,43 @@ void LogInterface_WriteDebugLogFile(char * str)
     } 
 #endif    
 }
+
+#ifdef DEBUG_LOG_TO_FILE
+/** @brief Copy a debug file to DebugLog directory of USB, logFileMutex is taken
+ *  @param [in] SYS_FS_HANDLE handle : file on SQI flash
+ *  @param [in] const char *usbFileName : file name on USB
+ *  @param [out] None
+ *  @return None
+ */
+static void LogInterface_ExportFileToUSB(SYS_FS_HANDLE handle, const char *usbFileName)
+{
+    void * data;
+    int32_t fileSize;
+
+    if (handle == SYS_FS_HANDLE_INVALID)
+        return;
+    fileSize = SYS_FS_FileSize(handle);
+    data = (void*)mm_malloc(fileSize);
+    if (data == NULL)
+    {
+        SYS_PRINT("[Debug] Can not allocate %d bytes \n", fileSize);
+        return;
+    }
+    SYS_FS_FileSeek(handle, 0, SYS_FS_SEEK_SET);
+    if (SYS_FS_FileRead(handle, data, fileSize) == fileSize)
+    {
+        USBInterface_SetFileName(usbFileName);
+        USBInterface_Write(data, fileSize);
+        USBInterface_FileSync();
+    }       
+    else
+    {
+        SYS_PRINT("[Debug] Error read debug file %d \n", SYS_FS_Error());
+    }
+    mm_free(data);
+}
+#endif
+
 void LogInterface_ExportDebugLogFileToUSB()
 {
 #ifdef DEBUG_LOG_TO_FILE
@@ -737,25 +902,14 @@ void LogInterface_ExportDebugLogFileToUSB()
         SYS_PRINT("[Debug] Failed to init log dir on USB \n");
         return;
     }
+    LogInterface_FlushDebugLogFile();
     // read data on sqi flash
-    void * data;
     if ( logFileMutex != NULL )
     {
         if( xSemaphoreTake( logFileMutex, ( TickType_t ) 20 ) == pdTRUE )
         {
-            int32_t fileSize = SYS_FS_FileSize(logFile);
-            data = (void*)mm_malloc(fileSize);
-            SYS_FS_FileSeek(logFile, 0, SYS_FS_SEEK_SET);
-            if (SYS_FS_FileRead(logFile, data, fileSize) == fileSize)
-            {
-                USBInterface_SetFileName("DebugLog/debug.log");
-                USBInterface_Write(data, fileSize);
-                USBInterface_FileSync();
-            }       
-            else
-            {
-                SYS_PRINT("[Debug] Error read debug file %d \n", SYS_FS_Error());
-            }
+            LogInterface_ExportFileToUSB(logFile, "DebugLog/"DEBUG_LOG_FILENAME);
+            LogInterface_ExportFileToUSB(s_traceFile, "DebugLog/"TRACE_LOG_FILENAME);
             xSemaphoreGive( logFileMutex );
         }
         else
@@ -776,9 +930,15 @@ void LogInterface_ClearDebugLogFile()
     {
         if( xSemaphoreTake( logFileMutex, ( TickType_t ) 20 ) == pdTRUE )
         {
+            s_debugLogStageLength = 0;
             SYS_FS_FileSeek(logFile, 0, SYS_FS_SEEK_SET);
             SYS_FS_FileTruncate(logFile);
             SYS_PRINT("\n [Debug] Debug log file size : %d \n", SYS_FS_FileSize(logFile));
+            if (s_traceFile != SYS_FS_HANDLE_INVALID)
+            {
+                SYS_FS_FileSeek(s_traceFile, 0, SYS_FS_SEEK_SET);
+                SYS_FS_FileTruncate(s_traceFile);
+            }
             xSemaphoreGive( logFileMutex );
         }
         else
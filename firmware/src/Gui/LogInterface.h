@@ -219,6 +219,20 @@ void LogInterface_TestAlarmEvent();
 #define DEBUG_LOG_TO_FILE
 #define DEBUG_LOG_FILENAME "debug.log"
 #define DEBUG_LOG_FILE SYS_FS_MEDIA_IDX0_MOUNT_NAME_VOLUME_IDX0"/"DEBUG_LOG_FILENAME
+#define TRACE_LOG_FILENAME "trace.bin"
+#define TRACE_LOG_FILE SYS_FS_MEDIA_IDX0_MOUNT_NAME_VOLUME_IDX0"/"TRACE_LOG_FILENAME
+
+/** @brief Define size of trace file before it starts again */
+#define TRACE_LOG_MAX_SIZE                  (256 * 1024)
+
+/** @brief Define size of buffer draining trace rings, in words */
+#define TRACE_DRAIN_WORDS                   (256)
+
+/** @brief Define size of debug log lines waiting to be written */
+#define DEBUG_LOG_STAGE_SIZE                (1024)
+
+/** @brief Define period of debug log and trace writes (ms) */
+#define DEBUG_LOG_FLUSH_PERIOD_MS           (2000)
 
 /* Init debug log file */
 void LogInterface_InitDebugLogFile();
@@ -229,6 +243,12 @@ void LogInterface_DeInitDebugLogFile();
 /* Record debug log */
 void LogInterface_WriteDebugLogFile(char * str);
 
+/* Write debug log and trace waiting to be written */
+void LogInterface_FlushDebugLogFile();
+
+/* Write debug log and trace periodically, called by GUI task */
+void LogInterface_DebugLogTask();
+
 /* Export debug log */
 void LogInterface_ExportDebugLogFileToUSB();
 
@@ -22,6 +22,8 @@
 #include "Gui/memlib.h"
 #include "Gui/mm.h"
 #include "Gui/LogInterface.h"
+#include "Gui/Setting.h"
+#include "Gui/GuiOperation.h"
 #include "7z/7zFile.h"
 #include "GuiDefine.h"
 
@@ -38,6 +40,19 @@ extern SYS_FS_HANDLE g_Spo2DataFile;
 
 extern SYS_FS_HANDLE logFile;
 
+/** @brief Define max time (in ms) wait for GUI task to write settings and logs before backup */
+#define LOG_BACKUP_FLUSH_WAIT_MS            (2000)
+
+/** @brief Declare staging pages of log records waiting to be written to SQI */
+static uint8_t s_eventLogStage[LOG_STAGE_SIZE];
+static uint8_t s_alarmLogStage[LOG_STAGE_SIZE];
+static uint8_t s_spo2LogStage[LOG_STAGE_SIZE];
+
+/** @brief Declare time index of each log type */
+static uint32_t s_eventLogIndex[MAX_EVENT_LOG / LOG_INDEX_STRIDE + 1];
+static uint32_t s_alarmLogIndex[MAX_ALARM_LOG / LOG_INDEX_STRIDE + 1];
+static uint32_t s_spo2LogIndex[MAX_SPO2_LOG / LOG_INDEX_STRIDE + 1];
+
 /** @brief Declare Log Event Object */
 static LogObject_Struct gs_eventLogObj = 
 {
@@ -53,6 +68,11 @@ static LogObject_Struct gs_eventLogObj =
     .fileHandle = &g_eventLogFile,
     .fileName = FILE_EVENTLOG_NAME,
     .usbFileName = "Log/Event.log",
+    
+    .stageBuffer = s_eventLogStage,
+    .stageCount = 0,
+    
+    .indexTime = s_eventLogIndex,
 };
 
 /** @brief Declare Alarm Event Object */
@@ -70,6 +90,11 @@ static LogObject_Struct gs_alarmLogObj =
     .fileHandle = &g_alarmLogFile,
     .fileName = FILE_ALARMLOG_NAME,
     .usbFileName = "Log/Alarm.log",
+    
+    .stageBuffer = s_alarmLogStage,
+    .stageCount = 0,
+    
+    .indexTime = s_alarmLogIndex,
 };
 
 /** @brief Declare Spo2Data Log Object */
@@ -87,6 +112,11 @@ static LogObject_Struct gs_spo2LogObj =
     .fileHandle = &g_Spo2DataFile,
     .fileName = FILE_SPO2DATA_NAME,
     .usbFileName = "Log/SpO2.log",
+    
+    .stageBuffer = s_spo2LogStage,
+    .stageCount = 0,
+    
+    .indexTime = s_spo2LogIndex,
 };
 
 /** @brief Declare queue receive ID data */
@@ -107,6 +137,42 @@ QueueHandle_t g_logQueueForRequest;
 /* Get Log Object of one log type */
 static LogObject_Struct* LogMgr_GetLogObj(E_LogType type);
 
+/* Get ring size of one log type */
+static uint32_t LogMgr_GetMaxLog(E_LogType type);
+
+/* Write staged records of one log object to SQI */
+static void LogMgr_FlushStage(LogObject_Struct* logObj);
+
+/* Decode one record read from log file */
+static void LogMgr_DecodeRecord(const uint8_t* data, Log_Struct *log);
+
+/* Get sortable time key of one record */
+static uint32_t LogMgr_GetRecordTimeKey(const uint8_t* record);
+
+/* Read time index of one log object from log file */
+static void LogMgr_BuildIndex(LogObject_Struct* logObj);
+
+/* Export one chunk of records of running export to USB */
+static void LogMgr_ExportStep(void);
+
+/* Move a timestamp a number of days back */
+static void LogMgr_SubtractDays(Timestamp* time, uint16_t numDay);
+
+/** @brief Declare running export to USB */
+static LogExport_Struct s_logExport = 
+{
+    .isRunning = false,
+};
+
+/** @brief Declare buffer of records read by query during export */
+static Log_Struct s_exportLogs[LOG_EXPORT_READ_RECORDS];
+
+/** @brief Declare buffer of formatted lines waiting to be written to USB */
+static char s_exportWriteBuffer[LOG_EXPORT_WRITE_SIZE + LOG_EXPORT_LINE_MAX];
+
+/** @brief Declare buffer of records read from SQI during query */
+static uint8_t s_queryReadBuffer[LOG_QUERY_READ_RECORDS * LOG_LEN];
+
 E_LogStatus logMgr_GetLogStatus(E_LogType logtype)
 {
     LogObject_Struct* tmp_LogObj;
@@ -126,8 +192,8 @@ void logMgr_HandleEvent(void)
     if (gs_eventLogObj.is_CopingFiletoUSB == true)
         return;
 
-    //wait for queue event
-    if (xQueueReceive(g_logQueueReceiveEvent, &log, 0) == pdPASS ) //wait 0 tick (do not wait)
+    //drain all pending events into staging page
+    while (xQueueReceive(g_logQueueReceiveEvent, &log, 0) == pdPASS ) //wait 0 tick (do not wait)
     {
 //        SYS_PRINT("\n logMgr_HandleEvent-----log.eCode = %d", log.eCode);
         logMgr_WriteLogToSQI(log);
@@ -148,8 +214,8 @@ void logMgr_HandleAlarm(void)
     if (gs_alarmLogObj.is_CopingFiletoUSB == true)
         return;
     
-    //wait for queue event
-    if (xQueueReceive(g_logQueueReceiveAlarm, &log, 0) == pdTRUE) //wait 0 tick (do not wait)
+    //drain all pending alarms into staging page
+    while (xQueueReceive(g_logQueueReceiveAlarm, &log, 0) == pdTRUE) //wait 0 tick (do not wait)
         logMgr_WriteLogToSQI(log);
     
     return;
@@ -166,8 +232,8 @@ void logMgr_HandleSpO2(void)
     if (gs_eventLogObj.is_CopingFiletoUSB == true)
         return;
     
-    //wait for queue event
-    if (xQueueReceive(g_logQueueReceiveSpO2, &log, 0) == pdTRUE) //wait 0 tick (do not wait)
+    //drain all pending spo2 data into staging page
+    while (xQueueReceive(g_logQueueReceiveSpO2, &log, 0) == pdTRUE) //wait 0 tick (do not wait)
         logMgr_WriteLogToSQI(log);
 
     return;
@@ -211,7 +277,10 @@ void logMgr_HandleRequest(void )
             }              
             case eUSBGetSpO2LogRequestId:
             {
-                logMgr_ExportLogFromSQIFlashtoUSB(eSpo2DataLogTypeID);
+                //Export only the days which are kept at start up
+                Timestamp fromTime = logMgr_getRtcTime();
+                LogMgr_SubtractDays(&fromTime, LOG_SPO2_EXPORT_DAYS);
+                logMgr_ExportLogRangeToUSB(eSpo2DataLogTypeID, &fromTime, NULL);
                 break;
             } 
             case eDeleteSettingLogRequestId:
@@ -261,7 +330,22 @@ static LogObject_Struct* LogMgr_GetLogObj(E_LogType type)
         return NULL;
 }
 
-/** @brief Write log to SQI Flash
+/* Get ring size of one log type */
+static uint32_t LogMgr_GetMaxLog(E_LogType type)
+{
+    if (type == eEventLogTypeID)
+        return MAX_EVENT_LOG;
+    else if (type == eAlarmLogTypeID)
+        return MAX_ALARM_LOG;
+    else if (type == eSpo2DataLogTypeID)
+        return MAX_SPO2_LOG;
+    else
+        return 0;
+}
+
+/** @brief Write log to SQI Flash. The record is put into the staging page of its
+ *  log type, the page is written to SQI as one block when it is full or when
+ *  LOG_FLUSH_PERIOD_MS elapsed (see logMgr_Task)
  *  @param [in] Log_Struct log: log write to SQI
  *  @param [out] : None
  *  @return None
@@ -271,6 +355,9 @@ void logMgr_WriteLogToSQI(Log_Struct log)
     LogObject_Struct* tmp_LogObj;
     tmp_LogObj = LogMgr_GetLogObj(log.logType);
     int dataIndex;
+    
+    if (tmp_LogObj == NULL)
+        return;
     long fileSize = file_Size(*tmp_LogObj->fileHandle);
     
     if ( fileSize == -1 )
@@ -332,18 +419,18 @@ void logMgr_WriteLogToSQI(Log_Struct log)
         return;
     }
     
-    //Move file pointer
-    if (tmp_LogObj->s_numLogSaved < max_log)
-    {
-        file_Seek(*tmp_LogObj->fileHandle, fileSize, SYS_FS_SEEK_SET);
-    }
-    else
+    //Update time index
+    if ((tmp_LogObj->s_currentIndex % LOG_INDEX_STRIDE) == 0)
+        tmp_LogObj->indexTime[tmp_LogObj->s_currentIndex / LOG_INDEX_STRIDE] = LogMgr_GetRecordTimeKey(logEvent);
+    
+    //Put record to staging page, it will be written at s_currentIndex
+    if (tmp_LogObj->stageCount == 0)
     {
-        file_Seek(*tmp_LogObj->fileHandle, INFOR_LOG_SIZE + (tmp_LogObj->s_currentIndex * LOG_LEN), SYS_FS_SEEK_SET);
+        tmp_LogObj->stageIndex = tmp_LogObj->s_currentIndex;
+        tmp_LogObj->stageTick = xTaskGetTickCount();
     }
-
-    //Write to file
-    file_Write(logEvent, LOG_LEN, *tmp_LogObj->fileHandle);
+    memcpy(&tmp_LogObj->stageBuffer[tmp_LogObj->stageCount * LOG_LEN], logEvent, LOG_LEN);
+    tmp_LogObj->stageCount++;
 
     //Update information log
     tmp_LogObj->s_numLogSaved++;
@@ -356,23 +443,115 @@ void logMgr_WriteLogToSQI(Log_Struct log)
     if (tmp_LogObj->s_currentIndex >= max_log)
         tmp_LogObj->s_currentIndex = 0;
     
-    logMgr_UpdateInforLog(log.logType);
+    //Write whole page when it is full
+    if (tmp_LogObj->stageCount >= LOG_STAGE_MAX_RECORDS)
+        LogMgr_FlushStage(tmp_LogObj);
         
     return;
 }
 
+/** @brief Write staged records of one log object to SQI, then update information
+ *  log. Records are written before the header so that the header never points
+ *  to a record which is not on flash. Only one file sync is done per flush
+ *  @param [in] LogObject_Struct* logObj: log object
+ *  @param [out] : None
+ *  @return None
+ */
+static void LogMgr_FlushStage(LogObject_Struct* logObj)
+{
+    if (logObj->stageCount == 0)
+        return;
+
+    uint32_t max_log = LogMgr_GetMaxLog(logObj->type);
+    uint32_t firstPart = logObj->stageCount;
+    
+    //Records after the end of ring are written from the begin of ring
+    if (logObj->stageIndex + firstPart > max_log)
+        firstPart = max_log - logObj->stageIndex;
+
+    file_Seek(*logObj->fileHandle, INFOR_LOG_SIZE + (logObj->stageIndex * LOG_LEN), SYS_FS_SEEK_SET);
+    if (SYS_FS_FileWrite(*logObj->fileHandle, logObj->stageBuffer, firstPart * LOG_LEN) == -1)
+    {
+        SYS_PRINT("LogMgr_FlushStage write error %d \n", SYS_FS_Error());
+    }
+    
+    if (firstPart < logObj->stageCount)
+    {
+        file_Seek(*logObj->fileHandle, INFOR_LOG_SIZE, SYS_FS_SEEK_SET);
+        if (SYS_FS_FileWrite(*logObj->fileHandle, &logObj->stageBuffer[firstPart * LOG_LEN], 
+                (logObj->stageCount - firstPart) * LOG_LEN) == -1)
+        {
+            SYS_PRINT("LogMgr_FlushStage write error %d \n", SYS_FS_Error());
+        }
+    }
+    
+    logObj->stageCount = 0;
+    
+    //Update header and sync file
+    logMgr_UpdateInforLog((E_LogType)logObj->type);
+
+    return;
+}
+
+/** @brief Write all staged records of one log type to SQI
+ *  @param [in] type Log Type
+ *  @param [out] : None
+ *  @return None
+ */
+void logMgr_FlushLog(E_LogType type)
+{
+    LogObject_Struct* tmp_LogObj;
+    tmp_LogObj = LogMgr_GetLogObj(type);
+    
+    if (tmp_LogObj == NULL)
+        return;
+    
+    LogMgr_FlushStage(tmp_LogObj);
+    return;
+}
+
+/** @brief Write all staged records of all log types to SQI
+ *  @param [in] None
+ *  @param [out] : None
+ *  @return None
+ */
+void logMgr_FlushAllLog(void)
+{
+    LogMgr_FlushStage(&gs_eventLogObj);
+    LogMgr_FlushStage(&gs_alarmLogObj);
+    LogMgr_FlushStage(&gs_spo2LogObj);
+    return;
+}
+
 /** @brief Act the behavior when Copy file FromSQIFlashtoUSB command was received.
+ *  All records of log type are exported
  *  @param [in] type Log Type that want to clear in file
  *  @param [out] None
  *  @return None
  */
 void logMgr_ExportLogFromSQIFlashtoUSB(E_LogType type)
+{
+    logMgr_ExportLogRangeToUSB(type, NULL, NULL);
+    return;
+}
+
+/** @brief Start export of logs whose time is in [fromTime, toTime] to USB.
+ *  This only starts the export, records are streamed to USB in chunks by
+ *  LogMgr_ExportStep() on each logMgr_Task() call so that GUI is not blocked
+ *  @param [in] E_LogType type: log type
+ *  @param [in] const Timestamp* fromTime: beginning of time range, NULL for no limit
+ *  @param [in] const Timestamp* toTime: end of time range, NULL for no limit
+ *  @param [out] None
+ *  @return None
+ */
+void logMgr_ExportLogRangeToUSB(E_LogType type, const Timestamp* fromTime, const Timestamp* toTime)
 {
     LogObject_Struct* tmp_LogObj;
     tmp_LogObj = LogMgr_GetLogObj(type);
     
-    tmp_LogObj->is_CopingFiletoUSB = true;   
-   
+    if ((tmp_LogObj == NULL) || (s_logExport.isRunning == true))
+        return;
+    
     // Init log dir
     if (USBInterface_CreateDir(SYS_FS_MEDIA_IDX1_MOUNT_NAME_VOLUME_IDX0, "Log") != SYS_FS_RES_SUCCESS)
     {
@@ -380,64 +559,370 @@ void logMgr_ExportLogFromSQIFlashtoUSB(E_LogType type)
         return;
     }    
     
+    tmp_LogObj->is_CopingFiletoUSB = true;   
+    
     USBInterface_SetFileName(tmp_LogObj->usbFileName);
     
+    LogMgr_FlushStage(tmp_LogObj);
+    
     uint16_t numLog, currentIndex;
     numLog = logMgr_GetNumberOfLog(type);
     currentIndex = logMgr_GetCurrentIndex(type);
 
-    char strbuff[255] = "";
-    char strbuffx[255] = LOG_DATA_ERROR_STR;
+    s_logExport.type = type;
+    s_logExport.hasFromTime = (fromTime != NULL);
+    if (fromTime != NULL)
+        s_logExport.fromTime = *fromTime;
+    s_logExport.hasToTime = (toTime != NULL);
+    if (toTime != NULL)
+        s_logExport.toTime = *toTime;
+    memset(&s_logExport.cursor, 0, sizeof(LogQueryCursor_Struct));
+    s_logExport.numLog = numLog;
+    s_logExport.doneLog = 0;
+    s_logExport.bytesWritten = 0;
+    s_logExport.startTick = xTaskGetTickCount();
+    
     // Write index, numlog
-    sprintf(strbuff, "NUMBER OF LOG: %5d\n", numLog);
-    USBInterface_Write(strbuff, strlen(strbuff));
-    sprintf(strbuff, "CURRENT INDEX: %5d\n", currentIndex);
-    USBInterface_Write(strbuff, strlen(strbuff));
+    s_logExport.outLen = sprintf(s_exportWriteBuffer, "NUMBER OF LOG: %5d\n", numLog);
+    s_logExport.outLen += sprintf(&s_exportWriteBuffer[s_logExport.outLen], "CURRENT INDEX: %5d\n", currentIndex);
     
-    int index = 0;
-    for (index = 0 ; index < numLog ; index ++)
+    s_logExport.isRunning = true;
+    return;
+}
+
+/** @brief Export one chunk of records of running export to USB. Records are read
+ *  with logMgr_Query(), formatted to output buffer and output buffer is written
+ *  to USB in LOG_EXPORT_WRITE_SIZE blocks
+ *  @param [in] None
+ *  @param [out] None
+ *  @return None
+ */
+static void LogMgr_ExportStep(void)
+{
+    LogObject_Struct* tmp_LogObj;
+    tmp_LogObj = LogMgr_GetLogObj(s_logExport.type);
+    
+    char strbuffx[LOG_EXPORT_LINE_MAX] = LOG_DATA_ERROR_STR;
+    
+    if (s_logExport.cursor.isDone == false)
     {
-        Log_Struct logData;
-        memset(&logData, 0, sizeof(Log_Struct));
-        logData.eCode = 0xff;
-        logMgr_GetLogAtIndex(type, index, &logData);
-        if (type == eEventLogTypeID)
+        uint16_t numRead = logMgr_Query(s_logExport.type, 
+                (s_logExport.hasFromTime == true) ? &s_logExport.fromTime : NULL,
+                (s_logExport.hasToTime == true) ? &s_logExport.toTime : NULL,
+                &s_logExport.cursor, s_exportLogs, LOG_EXPORT_READ_RECORDS);
+        
+        uint16_t i;
+        for (i = 0; i < numRead; i++)
         {
-            LogInterface_GetEventStringFromID(logData.eCode, strbuffx);
+            Log_Struct* logData = &s_exportLogs[i];
+            if (s_logExport.type == eEventLogTypeID)
+            {
+                LogInterface_GetEventStringFromID(logData->eCode, strbuffx);
+            }
+            else if(s_logExport.type == eAlarmLogTypeID)
+            {
+                LogInterface_GetAlarmStringFromID(logData->eCode, strbuffx);
+            }
+            else
+            {
+                sprintf(strbuffx, "%d", logData->data[0]);
+            }
+            int lineLen = snprintf(&s_exportWriteBuffer[s_logExport.outLen], LOG_EXPORT_LINE_MAX,
+                "%.5d %.2d%.2d/%.2d/%.2d %.2d:%.2d:%.2d %s\n", 
+                s_logExport.doneLog + 1,
+                logData->time.year_1, 
+                logData->time.year_2, 
+                logData->time.month, 
+                logData->time.date,
+                logData->time.hour, 
+                logData->time.minute,
+                logData->time.second,
+                strbuffx
+                );       
+            // A truncated line only holds LOG_EXPORT_LINE_MAX - 1 characters
+            if (lineLen >= LOG_EXPORT_LINE_MAX)
+                lineLen = LOG_EXPORT_LINE_MAX - 1;
+            if (lineLen > 0)
+                s_logExport.outLen += lineLen;
+            s_logExport.doneLog++;
+            
+            // Write full block to USB
+            if (s_logExport.outLen >= LOG_EXPORT_WRITE_SIZE)
+            {
+                USBInterface_Write(s_exportWriteBuffer, LOG_EXPORT_WRITE_SIZE);
+                s_logExport.bytesWritten += LOG_EXPORT_WRITE_SIZE;
+                s_logExport.outLen -= LOG_EXPORT_WRITE_SIZE;
+                memmove(s_exportWriteBuffer, &s_exportWriteBuffer[LOG_EXPORT_WRITE_SIZE], s_logExport.outLen);
+            }
         }
-        else if(type == eAlarmLogTypeID)
+    }
+    
+    if (s_logExport.cursor.isDone == true)
+    {
+        // Write the rest and close file
+        if (s_logExport.outLen > 0)
         {
-            LogInterface_GetAlarmStringFromID(logData.eCode, strbuffx);
+            USBInterface_Write(s_exportWriteBuffer, s_logExport.outLen);
+            s_logExport.bytesWritten += s_logExport.outLen;
+            s_logExport.outLen = 0;
         }
-        else if(type == eSpo2DataLogTypeID)
+        USBInterface_FileSync();
+        
+        // Resume cursor to end of file
+        file_Seek(*tmp_LogObj->fileHandle, 0, SYS_FS_SEEK_END);
+        
+        tmp_LogObj->is_CopingFiletoUSB = false;
+        s_logExport.isRunning = false;
+        
+        uint32_t elapsedMs = (xTaskGetTickCount() - s_logExport.startTick) * portTICK_PERIOD_MS;
+        SYS_PRINT("logMgr_ExportLogFromSQIFlashtoUSB %d: %d logs, %d bytes in %d ms (%d B/s) \n", 
+                (uint8_t)s_logExport.type, s_logExport.doneLog, s_logExport.bytesWritten, elapsedMs,
+                (elapsedMs > 0) ? (s_logExport.bytesWritten * 1000 / elapsedMs) : s_logExport.bytesWritten);
+    }
+    return;
+}
+
+/** @brief Read time index of one log object from log file. One record is read
+ *  for every LOG_INDEX_STRIDE ring index
+ *  @param [in] LogObject_Struct* logObj: log object
+ *  @param [out] None
+ *  @return None
+ */
+static void LogMgr_BuildIndex(LogObject_Struct* logObj)
+{
+    uint8_t record[LOG_LEN];
+    uint32_t index;
+    
+    for (index = 0; index < logObj->s_numLogSaved; index += LOG_INDEX_STRIDE)
+    {
+        logObj->indexTime[index / LOG_INDEX_STRIDE] = 0;
+        file_Seek(*logObj->fileHandle, INFOR_LOG_SIZE + index * LOG_LEN, SYS_FS_SEEK_SET);
+        if (SYS_FS_FileRead(*logObj->fileHandle, record, LOG_LEN) == LOG_LEN)
+            logObj->indexTime[index / LOG_INDEX_STRIDE] = LogMgr_GetRecordTimeKey(record);
+    }
+    return;
+}
+
+/** @brief Get sortable time key of a timestamp
+ *  @param [in] const Timestamp* time: timestamp
+ *  @param [out] None
+ *  @return uint32_t: time key
+ */
+static uint32_t LogMgr_GetTimeKey(const Timestamp* time)
+{
+    uint8_t record[LOG_LEN];
+    record[2] = time->year_2;
+    record[3] = time->month;
+    record[4] = time->date;
+    record[5] = time->hour;
+    record[6] = time->minute;
+    record[7] = time->second;
+    return LogMgr_GetRecordTimeKey(record);
+}
+
+/** @brief Find position from the oldest record where a query should start scanning.
+ *  Entries of time index are in ring order, they are rotated so that the first
+ *  entry is the one at or after the oldest record, then binary searched
+ *  @param [in] LogObject_Struct* logObj: log object
+ *  @param [in] uint32_t fromKey: time key of the beginning of query
+ *  @param [out] None
+ *  @return uint32_t: start position
+ */
+static uint32_t LogMgr_SeekIndex(LogObject_Struct* logObj, uint32_t fromKey)
+{
+    uint32_t max_log = LogMgr_GetMaxLog(logObj->type);
+    uint32_t oldest = (logObj->s_numLogSaved < max_log) ? 0 : logObj->s_currentIndex;
+    uint32_t numEntry = (logObj->s_numLogSaved + LOG_INDEX_STRIDE - 1) / LOG_INDEX_STRIDE;
+    uint32_t firstEntry = ((oldest + LOG_INDEX_STRIDE - 1) / LOG_INDEX_STRIDE) % numEntry;
+    uint32_t position = 0;
+    int32_t low = 0;
+    int32_t high = numEntry - 1;
+    
+    // Find the last entry older than fromKey
+    while (low <= high)
+    {
+        int32_t mid = (low + high) / 2;
+        uint32_t entry = (firstEntry + mid) % numEntry;
+        if (logObj->indexTime[entry] < fromKey)
         {
-            sprintf(strbuffx, "%d", logData.data[0]);
+            position = (entry * LOG_INDEX_STRIDE + max_log - oldest) % max_log;
+            low = mid + 1;
         }
         else
         {
+            high = mid - 1;
+        }
+    }
+    return position;
+}
+
+/** @brief Read one page of logs whose time is in [fromTime, toTime], oldest first.
+ *  The first call seeks with time index, next calls with the same cursor
+ *  continue from the last returned log
+ *  @param [in] E_LogType type: log type
+ *  @param [in] const Timestamp* fromTime: beginning of time range, NULL for no limit
+ *  @param [in] const Timestamp* toTime: end of time range, NULL for no limit
+ *  @param [in] LogQueryCursor_Struct* cursor: query cursor
+ *  @param [in] uint16_t maxLog: size of logs array
+ *  @param [out] Log_Struct* logs: matching logs
+ *  @return uint16_t: number of logs read
+ */
+uint16_t logMgr_Query(E_LogType type, const Timestamp* fromTime, const Timestamp* toTime, 
+        LogQueryCursor_Struct* cursor, Log_Struct* logs, uint16_t maxLog)
+{
+    LogObject_Struct* tmp_LogObj;
+    tmp_LogObj = LogMgr_GetLogObj(type);
+    uint16_t numFound = 0;
+    
+    if ((tmp_LogObj == NULL) || (tmp_LogObj->fileHandle == NULL) || (cursor->isDone == true))
+        return 0;
+    
+    LogMgr_FlushStage(tmp_LogObj);
+    
+    uint32_t max_log = LogMgr_GetMaxLog(type);
+    uint32_t numLog = tmp_LogObj->s_numLogSaved;
+    uint32_t oldest = (numLog < max_log) ? 0 : tmp_LogObj->s_currentIndex;
+    uint32_t fromKey = (fromTime != NULL) ? LogMgr_GetTimeKey(fromTime) : 0;
+    uint32_t toKey = (toTime != NULL) ? LogMgr_GetTimeKey(toTime) : UINT32_MAX;
+    
+    if (numLog == 0)
+    {
+        cursor->isDone = true;
+        return 0;
+    }
+    
+    if (cursor->isStarted == false)
+    {
+        cursor->position = (fromTime != NULL) ? LogMgr_SeekIndex(tmp_LogObj, fromKey) : 0;
+        cursor->isStarted = true;
+    }
+    
+    while ((numFound < maxLog) && (cursor->position < numLog))
+    {
+        // Read contiguous records, stop at the end of ring
+        uint32_t index = (oldest + cursor->position) % max_log;
+        uint32_t numRead = numLog - cursor->position;
+        if (numRead > LOG_QUERY_READ_RECORDS)
+            numRead = LOG_QUERY_READ_RECORDS;
+        if (index + numRead > max_log)
+            numRead = max_log - index;
+        
+        file_Seek(*tmp_LogObj->fileHandle, INFOR_LOG_SIZE + index * LOG_LEN, SYS_FS_SEEK_SET);
+        if (SYS_FS_FileRead(*tmp_LogObj->fileHandle, s_queryReadBuffer, numRead * LOG_LEN) != numRead * LOG_LEN)
+        {
+            SYS_PRINT("SYS_FS_FileRead error %d \n", SYS_FS_Error());
+            cursor->isDone = true;
+            break;
+        }
+        
+        uint32_t i;
+        for (i = 0; (i < numRead) && (numFound < maxLog); i++)
+        {
+            uint32_t key = LogMgr_GetRecordTimeKey(&s_queryReadBuffer[i * LOG_LEN]);
+            if (key > toKey)
+            {
+                cursor->isDone = true;
+                break;
+            }
+            cursor->position++;
+            if (key >= fromKey)
+            {
+                memset(&logs[numFound], 0, sizeof(Log_Struct));
+                LogMgr_DecodeRecord(&s_queryReadBuffer[i * LOG_LEN], &logs[numFound]);
+                numFound++;
+            }
+        }
+        if (cursor->isDone == true)
+            break;
+    }
+    
+    if (cursor->position >= numLog)
+        cursor->isDone = true;
+    
+    // Resume cursor to end of file
+    file_Seek(*tmp_LogObj->fileHandle, 0, SYS_FS_SEEK_END);
+    return numFound;
+}
+
+/** @brief Set query cursor to a position from the oldest record, next query
+ *  continues from this position without searching time index
+ *  @param [in] LogQueryCursor_Struct* cursor: query cursor
+ *  @param [in] uint32_t position: position from the oldest record
+ *  @param [out] None
+ *  @return None
+ */
+void logMgr_SeekQuery(LogQueryCursor_Struct* cursor, uint32_t position)
+{
+    cursor->isStarted = true;
+    cursor->isDone = false;
+    cursor->position = position;
+    return;
+}
+
+/** @brief Move a timestamp a number of days back, month lengths and leap years
+ *  of 2000-2099 are taken into account
+ *  @param [in] Timestamp* time: timestamp
+ *  @param [in] uint16_t numDay: number of days
+ *  @param [out] Timestamp* time: timestamp numDay days before
+ *  @return None
+ */
+static void LogMgr_SubtractDays(Timestamp* time, uint16_t numDay)
+{
+    static const uint8_t s_daysInMonth[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    
+    if ((time->month < 1) || (time->month > 12))
+        return;
+    
+    while (numDay >= time->date)
+    {
+        numDay -= time->date;
+        
+        // Go to the last day of previous month, stop at the begin of century
+        if (time->month > 1)
+        {
+            time->month--;
+        }
+        else if (time->year_2 > 0)
+        {
+            time->month = 12;
+            time->year_2--;
+        }
+        else
+        {
+            time->date = 1;
             return;
         }
-        sprintf(strbuff, "%.5d %.2d%.2d/%.2d/%.2d %.2d:%.2d:%.2d %s\n", 
-            index +1,
-            logData.time.year_1, 
-            logData.time.year_2, 
-            logData.time.month, 
-            logData.time.date,
-            logData.time.hour, 
-            logData.time.minute,
-            logData.time.second,
-            strbuffx
-            );       
-        USBInterface_Write(strbuff, strlen(strbuff));
-    }
-
-    USBInterface_FileSync();
-
-    tmp_LogObj->is_CopingFiletoUSB = false;
-    SYS_PRINT("logMgr_ExportLogFromSQIFlashtoUSB %d \n", (uint8_t)type);
+        time->date = s_daysInMonth[time->month - 1];
+        if ((time->month == 2) && (time->year_2 % 4 == 0))
+            time->date = 29;
+    }
+    time->date -= numDay;
     return;
 }
 
+/** @brief Check an export to USB is in progress
+ *  @param [in] None
+ *  @param [out] None
+ *  @return bool: true if exporting
+ */
+bool logMgr_IsExporting(void)
+{
+    return s_logExport.isRunning;
+}
+
+/** @brief Get progress of running export to USB
+ *  @param [in] None
+ *  @param [out] None
+ *  @return uint8_t: progress in percent
+ */
+uint8_t logMgr_GetExportProgress(void)
+{
+    if ((s_logExport.isRunning == false) || (s_logExport.numLog == 0))
+        return 100;
+    
+    return (uint8_t)(s_logExport.cursor.position * 100 / s_logExport.numLog);
+}
+
 /** @brief Set current index
  *  @param [in] type Log Type that want to clear in file
  *  @param [out] None
@@ -484,45 +969,13 @@ uint16_t logMgr_GetNumberOfLog(E_LogType type)
     return tmp_LogObj->s_numLogSaved;       
 }
 
-/** @brief Get next log
- *  @param [in] type Log Type that want to clear in file
- *  @param [in] int index: index log
- *  @param [in] Log_Struct *log: log data
- *  @param [out] None
+/** @brief Decode one record read from log file
+ *  @param [in] const uint8_t* data: record data
+ *  @param [out] Log_Struct *log: log data
  *  @return None
  */
-void logMgr_GetLogAtIndex(E_LogType type, int index, Log_Struct *log)
+static void LogMgr_DecodeRecord(const uint8_t* data, Log_Struct *log)
 {
-    LogObject_Struct* tmp_LogObj;
-    tmp_LogObj = LogMgr_GetLogObj(type);   
-    
-    if (tmp_LogObj->fileHandle == NULL)
-    {
-        SYS_PRINT("Error: log file handle NULL \n");
-        return;
-    }       
-    uint8_t data[LOG_LEN];
-    tmp_LogObj->fileSize = file_Size(*tmp_LogObj->fileHandle);
-    
-    /*  Check header    */ 
-    int pos = index * LOG_LEN + INFOR_LOG_SIZE;
-    if (pos > tmp_LogObj->fileSize - (LOG_LEN))
-    {
-        SYS_PRINT("E_LogType %d \n", type);
-        SYS_PRINT("fileSize %d \n", tmp_LogObj->fileSize);
-        SYS_PRINT("Error: log id error %d \n", index);
-        return;
-    }
-    // Jump to log location
-    file_Seek(*tmp_LogObj->fileHandle, pos, SYS_FS_SEEK_SET);
-    if (SYS_FS_FileRead(*tmp_LogObj->fileHandle, data, LOG_LEN) != LOG_LEN)
-    {
-        SYS_PRINT("SYS_FS_FileRead error %d \n", SYS_FS_Error());
-        return;
-    }
-    // Resume cursor to end of file
-    file_Seek(*tmp_LogObj->fileHandle, 0, SYS_FS_SEEK_END);
-    
     if (data[0] == HEADER_EVENT_LOG)
     {
         log->logType = eEventLogTypeID;
@@ -569,6 +1022,52 @@ void logMgr_GetLogAtIndex(E_LogType type, int index, Log_Struct *log)
     return;
 }
 
+/** @brief Get next log
+ *  @param [in] type Log Type that want to clear in file
+ *  @param [in] int index: index log
+ *  @param [in] Log_Struct *log: log data
+ *  @param [out] None
+ *  @return None
+ */
+void logMgr_GetLogAtIndex(E_LogType type, int index, Log_Struct *log)
+{
+    LogObject_Struct* tmp_LogObj;
+    tmp_LogObj = LogMgr_GetLogObj(type);   
+    
+    if (tmp_LogObj->fileHandle == NULL)
+    {
+        SYS_PRINT("Error: log file handle NULL \n");
+        return;
+    }       
+    LogMgr_FlushStage(tmp_LogObj);
+    
+    uint8_t data[LOG_LEN];
+    tmp_LogObj->fileSize = file_Size(*tmp_LogObj->fileHandle);
+    
+    /*  Check header    */ 
+    int pos = index * LOG_LEN + INFOR_LOG_SIZE;
+    if (pos > tmp_LogObj->fileSize - (LOG_LEN))
+    {
+        SYS_PRINT("E_LogType %d \n", type);
+        SYS_PRINT("fileSize %d \n", tmp_LogObj->fileSize);
+        SYS_PRINT("Error: log id error %d \n", index);
+        return;
+    }
+    // Jump to log location
+    file_Seek(*tmp_LogObj->fileHandle, pos, SYS_FS_SEEK_SET);
+    if (SYS_FS_FileRead(*tmp_LogObj->fileHandle, data, LOG_LEN) != LOG_LEN)
+    {
+        SYS_PRINT("SYS_FS_FileRead error %d \n", SYS_FS_Error());
+        return;
+    }
+    // Resume cursor to end of file
+    file_Seek(*tmp_LogObj->fileHandle, 0, SYS_FS_SEEK_END);
+    
+    LogMgr_DecodeRecord(data, log);
+    
+    return;
+}
+
 
 /** @brief Update information log
  *  @param [in] type Log Type that want to clear in file
@@ -614,6 +1113,9 @@ void logMgr_ClearLog(E_LogType type)
     if (((type == eEventLogTypeID) || (type == eAlarmLogTypeID) || (type == eSpo2DataLogTypeID))
             && (tmp_LogObj->s_numLogSaved > 0)) 
     {
+        /* Drop staged records */
+        tmp_LogObj->stageCount = 0;
+        
         /* Truncates file */
         file_Truncates(*tmp_LogObj->fileHandle);
 
@@ -655,6 +1157,104 @@ Timestamp logMgr_getRtcTime(void)
     return logTime;
 }
 
+/** @brief Check a record read from log file is a complete record of one log type
+ *  @param [in] uint8_t type header of log type
+ *  @param [in] uint8_t* record: record data
+ *  @param [out] : None
+ *  @return bool: true if record is valid
+ */
+static bool LogMgr_IsValidRecord(uint8_t header, const uint8_t* record)
+{
+    return (record[0] == header)
+            && (record[3] >= 1) && (record[3] <= 12)
+            && (record[4] >= 1) && (record[4] <= 31)
+            && (record[5] < 24) && (record[6] < 60) && (record[7] < 60);
+}
+
+/** @brief Get sortable time key of one record
+ *  @param [in] uint8_t* record: record data
+ *  @param [out] : None
+ *  @return uint32_t: time key
+ */
+static uint32_t LogMgr_GetRecordTimeKey(const uint8_t* record)
+{
+    return ((uint32_t)record[2] << 26) | ((uint32_t)record[3] << 22) | ((uint32_t)record[4] << 17)
+            | ((uint32_t)record[5] << 12) | ((uint32_t)record[6] << 6) | (uint32_t)record[7];
+}
+
+/** @brief Find complete records written to log file after the last information
+ *  log update (power loss during a flush) and move current index after them.
+ *  At most one staging page of records can be written without header update
+ *  @param [in] LogObject_Struct* logObj: log object
+ *  @param [in] long fileSize: size of log file
+ *  @param [out] : None
+ *  @return None
+ */
+static void LogMgr_RecoverUnsyncedLog(LogObject_Struct* logObj, long fileSize)
+{
+    uint32_t max_log = LogMgr_GetMaxLog(logObj->type);
+    uint8_t header;
+    uint8_t prev[LOG_LEN];
+    uint8_t record[LOG_LEN];
+    uint16_t recovered = 0;
+    
+    if (logObj->type == eEventLogTypeID)
+        header = HEADER_EVENT_LOG;
+    else if (logObj->type == eAlarmLogTypeID)
+        header = HEADER_ALARM_LOG;
+    else
+        header = HEADER_SPO2_LOG;
+    
+    if ((max_log == 0) || (logObj->s_currentIndex >= max_log) || (logObj->s_numLogSaved > max_log))
+        return;
+    
+    if (logObj->s_numLogSaved < max_log)
+    {
+        //Ring is not full: every complete record after the saved ones is new
+        uint32_t numInFile = (fileSize - INFOR_LOG_SIZE) / LOG_LEN;
+        if (numInFile > max_log)
+            numInFile = max_log;
+        
+        while ((logObj->s_numLogSaved < numInFile) && (recovered < LOG_STAGE_MAX_RECORDS))
+        {
+            file_Seek(*logObj->fileHandle, INFOR_LOG_SIZE + (logObj->s_numLogSaved * LOG_LEN), SYS_FS_SEEK_SET);
+            if ((SYS_FS_FileRead(*logObj->fileHandle, record, LOG_LEN) != LOG_LEN)
+                    || !LogMgr_IsValidRecord(header, record))
+                break;
+            logObj->s_numLogSaved++;
+            recovered++;
+        }
+        logObj->s_currentIndex = logObj->s_numLogSaved % max_log;
+    }
+    else
+    {
+        //Ring is full: a new record is never older than the record before it
+        uint32_t prevIndex = (logObj->s_currentIndex == 0) ? (max_log - 1) : (logObj->s_currentIndex - 1);
+        file_Seek(*logObj->fileHandle, INFOR_LOG_SIZE + (prevIndex * LOG_LEN), SYS_FS_SEEK_SET);
+        if (SYS_FS_FileRead(*logObj->fileHandle, prev, LOG_LEN) == LOG_LEN)
+        {
+            while (recovered < LOG_STAGE_MAX_RECORDS)
+            {
+                file_Seek(*logObj->fileHandle, INFOR_LOG_SIZE + (logObj->s_currentIndex * LOG_LEN), SYS_FS_SEEK_SET);
+                if ((SYS_FS_FileRead(*logObj->fileHandle, record, LOG_LEN) != LOG_LEN)
+                        || !LogMgr_IsValidRecord(header, record)
+                        || (LogMgr_GetRecordTimeKey(record) < LogMgr_GetRecordTimeKey(prev)))
+                    break;
+                memcpy(prev, record, LOG_LEN);
+                logObj->s_currentIndex = (logObj->s_currentIndex + 1) % max_log;
+                recovered++;
+            }
+        }
+    }
+    
+    if (recovered > 0)
+    {
+        SYS_PRINT("LogMgr recovered %d records of log type %d \n", recovered, logObj->type);
+        logMgr_UpdateInforLog((E_LogType)logObj->type);
+    }
+    return;
+}
+
 /** @brief Write log to SQI Flash
  *  @param [in] Log_Struct log: log write to SQI
  *  @param [out] : None
@@ -687,8 +1287,12 @@ void logMgr_InitOperatingLog(E_LogType type)
         tmp_LogObj->s_numLogSaved = logInfor[0];
         tmp_LogObj->s_currentIndex = logInfor[1];
 
+        //Find records written after the last header update
+        LogMgr_RecoverUnsyncedLog(tmp_LogObj, logFileSize);
     }
 
+    LogMgr_BuildIndex(tmp_LogObj);
+
     tmp_LogObj->status = eReadyLogStatus;
 
     return;
@@ -747,7 +1351,21 @@ void logMgr_Task(void)
         
         logMgr_HandleSpO2();
         
-        logMgr_HandleRequest();
+        //Stream running export, next request is handled as soon as it is
+        //done, so that exports asked together run without a gap
+        if (s_logExport.isRunning == true)
+            LogMgr_ExportStep();
+        if (s_logExport.isRunning == false)
+            logMgr_HandleRequest();
+        
+        //Write staged records which have waited too long
+        TickType_t tick = xTaskGetTickCount();
+        if ((gs_eventLogObj.stageCount > 0) && (tick - gs_eventLogObj.stageTick >= LOG_FLUSH_PERIOD_MS / portTICK_PERIOD_MS))
+            LogMgr_FlushStage(&gs_eventLogObj);
+        if ((gs_alarmLogObj.stageCount > 0) && (tick - gs_alarmLogObj.stageTick >= LOG_FLUSH_PERIOD_MS / portTICK_PERIOD_MS))
+            LogMgr_FlushStage(&gs_alarmLogObj);
+        if ((gs_spo2LogObj.stageCount > 0) && (tick - gs_spo2LogObj.stageTick >= LOG_FLUSH_PERIOD_MS / portTICK_PERIOD_MS))
+            LogMgr_FlushStage(&gs_spo2LogObj);
     }
     
     return;
@@ -764,6 +1382,8 @@ uint16_t logMgr_ReadLastestLog(E_LogType type, uint16_t noOfLog, uint8_t *data)
         SYS_PRINT("Error: log file handle NULL \n");
         return 0;
     }       
+    LogMgr_FlushStage(tmp_LogObj);
+    
     totalLogNumber = tmp_LogObj->s_numLogSaved;
     currentLogIndex = tmp_LogObj->s_currentIndex;
     if ( totalLogNumber == 0)
@@ -908,17 +1528,22 @@ void logMgr_RestoreFileFromUSB(SYS_FS_HANDLE fileHandle, const char* fileName)
 
 void logMgr_BackupToUSB(void)
 {
+    //staged logs and pending settings are written by GUI task, which owns them
+    if (GUI_FlushStorage(LOG_BACKUP_FLUSH_WAIT_MS) == false)
+        SYS_PRINT("logMgr_BackupToUSB settings and logs not flushed \n");
     logMgr_BackupFileToUSB(g_devInfoFile, FILE_DEVICE_INFORMATION);
     logMgr_BackupFileToUSB(g_settingFile, FILE_SETTING_NAME);
     logMgr_BackupFileToUSB(g_eventLogFile, FILE_EVENTLOG_NAME);
     logMgr_BackupFileToUSB(g_alarmLogFile, FILE_ALARMLOG_NAME);
     logMgr_BackupFileToUSB(g_Spo2DataFile, FILE_SPO2DATA_NAME);
 #ifdef DEBUG_LOG_TO_FILE
+    LogInterface_FlushDebugLogFile();
     logMgr_BackupFileToUSB(logFile, DEBUG_LOG_FILENAME);
 #endif    
 }
 void logMgr_RestoreFromUSB(void)
 {
+    //settings changed since backup stay pending and are written after restore
     logMgr_RestoreFileFromUSB(g_devInfoFile, FILE_DEVICE_INFORMATION);
     logMgr_RestoreFileFromUSB(g_settingFile, FILE_SETTING_NAME);
     logMgr_RestoreFileFromUSB(g_eventLogFile, FILE_EVENTLOG_NAME);
@@ -977,6 +1602,7 @@ void logMgr_ReduceLogOver30OlderDay(E_LogType type)
             SYS_PRINT("Log date over 30 days \n");
         }
     }
+    logMgr_FlushLog(type);
     
     if (logDataArray)
         mm_free(logDataArray);     
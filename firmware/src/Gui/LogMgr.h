@@ -50,6 +50,35 @@
 
 /** @brief Define maximum number of year when the log file has not been deleted */
 #define HEADER_SPO2_LOG                      0x22    
+
+/** @brief Define size of RAM staging page used to group log records before writing to SQI */
+#define LOG_STAGE_SIZE                      (512)
+
+/** @brief Define max number of records held in one staging page */
+#define LOG_STAGE_MAX_RECORDS               (LOG_STAGE_SIZE / LOG_LEN)
+
+/** @brief Define max time a staged record can wait before it is flushed to SQI (ms) */
+#define LOG_FLUSH_PERIOD_MS                 (2000)
+
+/** @brief Define number of records read from SQI per export step */
+#define LOG_EXPORT_READ_RECORDS             (64)
+
+/** @brief Define size of block written to USB per write, aligned to FAT cluster */
+#define LOG_EXPORT_WRITE_SIZE               (4096)
+
+/** @brief Define max length of one formatted export line */
+#define LOG_EXPORT_LINE_MAX                 (255)
+
+/** @brief Define number of records between two entries of time index */
+#define LOG_INDEX_STRIDE                    (64)
+
+/** @brief Define number of records read from SQI per query read, same as export step
+ *  so that one export step is one SQI read */
+#define LOG_QUERY_READ_RECORDS              (LOG_EXPORT_READ_RECORDS)
+
+/** @brief Define number of days of SpO2 records exported to USB */
+#define LOG_SPO2_EXPORT_DAYS                (30)
+
 /** @brief Define struct log information */
 typedef struct {
     uint32_t currentIndex; /**< The position of last written log in log file */
@@ -87,8 +116,38 @@ typedef struct {
     char* fileName;
     char* usbFileName;
     uint32_t fileSize;
+    
+    uint8_t* stageBuffer; /**< RAM page holding records not yet written to SQI */
+    uint16_t stageCount; /**< Number of records in stage buffer */
+    uint32_t stageIndex; /**< Ring index of the first staged record */
+    TickType_t stageTick; /**< Tick when the first staged record was queued */
+    
+    uint32_t* indexTime; /**< Time key of record at every LOG_INDEX_STRIDE ring index */
 } LogObject_Struct;
 
+/** @brief Define cursor of a time query, zero it before the first query */
+typedef struct {
+    bool isStarted; /**< First matching record has been searched */
+    bool isDone; /**< No more matching record */
+    uint32_t position; /**< Position from the oldest record of next record to read */
+} LogQueryCursor_Struct;
+
+/** @brief Define struct which manage a running export of one log type to USB */
+typedef struct {
+    bool isRunning; /**< Export is in progress */
+    E_LogType type; /**< Log type being exported */
+    bool hasFromTime; /**< Records older than fromTime are skipped */
+    bool hasToTime; /**< Records newer than toTime are skipped */
+    Timestamp fromTime; /**< Beginning of exported time range */
+    Timestamp toTime; /**< End of exported time range */
+    LogQueryCursor_Struct cursor; /**< Query cursor of next records to export */
+    uint32_t numLog; /**< Number of records in log file when export started */
+    uint32_t doneLog; /**< Number of records exported */
+    uint32_t outLen; /**< Number of bytes waiting in output buffer */
+    uint32_t bytesWritten; /**< Number of bytes written to USB */
+    TickType_t startTick; /**< Tick when export started */
+} LogExport_Struct;
+
 /***/
 E_LogStatus logMgr_GetLogStatus(E_LogType logtype);
 
@@ -119,6 +178,12 @@ void logMgr_GetLogAtIndex(E_LogType type, int index, Log_Struct *log);
 /*Update information log*/
 void logMgr_UpdateInforLog(E_LogType type);
 
+/* Write all staged records of one log type to SQI */
+void logMgr_FlushLog(E_LogType type);
+
+/* Write all staged records of all log types to SQI */
+void logMgr_FlushAllLog(void);
+
 /* Delete all data in one log file */
 void logMgr_ClearLog(E_LogType logType);
 
@@ -149,6 +214,22 @@ void logMgr_WriteDeviceInfoToSQI(void);
 /* Act the behavior when Copy file FromSQIFlashtoUSB command was received. */
 void logMgr_ExportLogFromSQIFlashtoUSB(E_LogType type);
 
+/* Start export of logs whose time is in [fromTime, toTime] to USB */
+void logMgr_ExportLogRangeToUSB(E_LogType type, const Timestamp* fromTime, const Timestamp* toTime);
+
+/* Read one page of logs whose time is in [fromTime, toTime], oldest first */
+uint16_t logMgr_Query(E_LogType type, const Timestamp* fromTime, const Timestamp* toTime, 
+        LogQueryCursor_Struct* cursor, Log_Struct* logs, uint16_t maxLog);
+
+/* Set query cursor to a position from the oldest record */
+void logMgr_SeekQuery(LogQueryCursor_Struct* cursor, uint32_t position);
+
+/* Check an export to USB is in progress */
+bool logMgr_IsExporting(void);
+
+/* Get progress of running export to USB in percent */
+uint8_t logMgr_GetExportProgress(void);
+
 /* Log mangeger initialize*/
 void logMgr_Task(void);
 
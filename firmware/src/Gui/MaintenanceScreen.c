@@ -10,9 +10,41 @@
 #include "DeviceInformation.h"
 #include "Gui/DisplayControl.h"
 #include "Gui/Setting.h"
+#include "Gui/LogMgr.h"
 
 #define VERSION_STR "Current Version: "MAIN_FW_VERSION
 
+/** @brief Export progress shown on btnLogtoUsb, -1 if button shows its text */
+static int s_exportProgressShown = -1;
+
+/** @brief Show progress of log export to USB on btnLogtoUsb while the
+ *  export runs, and the button text again when it is done
+ *  @param [in]  None
+ *  @param [out]  None
+ *  @return None
+ */
+static void MaintenanceScreen_UpdateExport(void)
+{
+    char strbuff[8];
+    laString str;
+    int progress = (logMgr_IsExporting() == true) ? logMgr_GetExportProgress() : -1;
+
+    if (progress == s_exportProgressShown)
+        return;
+    s_exportProgressShown = progress;
+
+    if (progress < 0)
+    {
+        laButtonWidget_SetText(btnLogtoUsb, laString_CreateFromID(string_text_LogtoUSB_MaintenanceScreen));
+        return;
+    }
+    sprintf(strbuff, "%d%%", progress);
+    str = laString_CreateFromCharBuffer(strbuff, &AbelRegular_S20_Bold_Internal);
+    laButtonWidget_SetText(btnLogtoUsb, str);
+    laString_Destroy(&str);
+    return;
+}
+
 /** @brief Be a Periodical function which working for update monitoring figure 
  *  @param [in]  currentTick
  *  @param [in]  isInit
@@ -169,6 +201,8 @@ void MaintenanceScreen_Initialize(void)
     
     MaintenanceScreen_UpdateVersion();
     MaintenanceScreen_UpdateMonitor(0, true);
+    s_exportProgressShown = -1;
+    MaintenanceScreen_UpdateExport();
 }
 
 /** @brief Reinitialize MaintenanceScreen's control and data.
@@ -205,6 +239,8 @@ void MaintenanceScreen_Run(void)
     
     MaintenanceScreen_UpdateMonitor(currentTick, false);
     
+    MaintenanceScreen_UpdateExport();
+    
     return;
 }
 
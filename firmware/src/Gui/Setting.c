@@ -12,6 +12,7 @@
 #include "crc.h"
 #include "peripheral/nvm/plib_nvm.h"
 #include "File.h"
+#include "mm.h"
 #include "GuiInterface.h"
 #include "LogInterface.h"
 #include "MotorTask.h"
@@ -22,15 +23,60 @@ extern SYS_FS_HANDLE g_settingFile;
 /** @brief Define max for setting */
 #define NUM_OF_SETTING			eLastSettingId
 
-/** @brief Define setting data length */
+/** @brief Define setting data length of former single record file */
 #define SETTING_DATA_LENGTH             (NUM_OF_SETTING + 2) 
 
+/** @brief Define first byte of a setting record */
+#define SETTING_RECORD_MAGIC            (0x5A)
+
+/** @brief Define version of setting record */
+#define SETTING_RECORD_VERSION          (1)
+
+/** @brief Define size of record header: magic, version, sequence (4 bytes, LSB first) */
+#define SETTING_RECORD_HEADER_SIZE      (6)
+
+/** @brief Define size of a setting record: header, settings and 2 bytes CRC */
+#define SETTING_RECORD_SIZE             (SETTING_RECORD_HEADER_SIZE + NUM_OF_SETTING + 2)
+
+/** @brief Define size of a slot, one FAT cluster. Where the cluster lies in
+ *  the SQI flash erase sectors depends on the FAT layout, so slots are not
+ *  assumed to be erase sectors */
+#define SETTING_SLOT_SIZE               (4096)
+
+/** @brief Define number of slots in setting file */
+#define SETTING_SLOT_NUM                (2)
+
+/** @brief Define number of records in a slot */
+#define SETTING_RECORDS_PER_SLOT        (SETTING_SLOT_SIZE / SETTING_RECORD_SIZE)
+
+/** @brief Define size of setting file */
+#define SETTING_FILE_SIZE               (SETTING_SLOT_SIZE * SETTING_SLOT_NUM)
+
+/** @brief Define size of block used to fill a new setting file */
+#define SETTING_FILL_BLOCK_SIZE         (256)
+
 /** @brief Declare setting list */
 static SETTING_ITEM_t s_settingList[NUM_OF_SETTING];
 
-/** @brief Declare old setting */
+/** @brief Declare old setting, as in newest record on SQI flash */
 static uint8_t s_oldSettingData[NUM_OF_SETTING];
 
+/** @brief Declare setting waiting to be written */
+static uint8_t s_pendingSettingData[NUM_OF_SETTING];
+
+/** @brief Flag setting is waiting to be written */
+static bool s_isSettingPending = false;
+
+/** @brief Tick of first and last change waiting to be written */
+static TickType_t s_settingFirstChangeTick;
+static TickType_t s_settingLastChangeTick;
+
+/** @brief Flag old setting holds settings of SQI flash */
+static bool s_isOldSettingValid = false;
+
+/** @brief Sequence number of newest record on SQI flash, 0 if none */
+static uint32_t s_settingSequence = 0;
+
 /** @brief Mutext protect for task sync */
 static SemaphoreHandle_t s_SettingDataMutex = NULL;
 
@@ -243,7 +289,76 @@ void setting_SetDefault(void)
     return;
 }
 
-/** @brief Save to flash when check crc sucess
+/** @brief Get offset of a record in setting file. Records go to slots in
+ *  turn, so a record is never written in the file sector of the record
+ *  before it and a write cut short damages the new record only. The record
+ *  before it is not protected from the erase done by the flash driver, as
+ *  both slots can share an erase sector
+ *  @param [in] uint32_t sequence : sequence number of record
+ *  @param [out] None
+ *  @return int32_t : offset in file
+ */
+static int32_t setting_RecordOffset(uint32_t sequence)
+{
+    uint32_t slot = sequence % SETTING_SLOT_NUM;
+    uint32_t index = (sequence / SETTING_SLOT_NUM) % SETTING_RECORDS_PER_SLOT;
+
+    return (int32_t)(slot * SETTING_SLOT_SIZE + index * SETTING_RECORD_SIZE);
+}
+
+/** @brief Check a setting record
+ *  @param [in] const uint8_t *record : record
+ *  @param [out] uint32_t *sequence : sequence number of record
+ *  @return bool : true if record is valid
+ */
+static bool setting_CheckRecord(const uint8_t *record, uint32_t *sequence)
+{
+    if ((record[0] != SETTING_RECORD_MAGIC) || (record[1] != SETTING_RECORD_VERSION))
+        return false;
+    if (crc_CheckNoInit(SETTING_RECORD_SIZE, (int8_t*)record) != 0)
+        return false;
+
+    *sequence = (uint32_t)record[2] | ((uint32_t)record[3] << 8)
+              | ((uint32_t)record[4] << 16) | ((uint32_t)record[5] << 24);
+    return true;
+}
+
+/** @brief Grow setting file to all its slots, so that any record can be
+ *  written by seek. Content already in file is kept
+ *  @param [in] None
+ *  @param [out] None
+ *  @return bool : true if file has all its slots
+ */
+static bool setting_PrepareFile(void)
+{
+    uint8_t fill[SETTING_FILL_BLOCK_SIZE];
+    long fileSize = file_Size(g_settingFile);
+    uint32_t size;
+
+    if (fileSize < 0)
+        return false;
+    if (fileSize >= SETTING_FILE_SIZE)
+        return true;
+
+    memset(fill, 0xFF, sizeof(fill));
+    file_Seek(g_settingFile, fileSize, SYS_FS_SEEK_SET);
+    while (fileSize < SETTING_FILE_SIZE)
+    {
+        size = (SETTING_FILE_SIZE - fileSize > sizeof(fill)) ? sizeof(fill) : (SETTING_FILE_SIZE - fileSize);
+        if (SYS_FS_FileWrite(g_settingFile, fill, size) != size)
+        {
+            SYS_PRINT("\n setting_PrepareFile write error %d \n", SYS_FS_Error());
+            return false;
+        }
+        fileSize += size;
+    }
+    return true;
+}
+
+/** @brief Request to save settings. Settings are copied now and written to
+ *  SQI flash by setting_Task when no change came for SETTING_SAVE_DELAY_MS,
+ *  or SETTING_SAVE_MAX_DELAY_MS after the first change, so that changes of a
+ *  setting screen are coalesced in one write
  *  @param [in] : None
  *  @param [out] : None
  *  @return none
@@ -251,8 +366,7 @@ void setting_SetDefault(void)
 void setting_Save(void)
 {
 //    SYS_PRINT("\n setting_Save \n");
-    uint8_t dataLength = SETTING_DATA_LENGTH; //add 2 bytes for CRC check
-    int8_t setting[dataLength];
+    uint8_t setting[NUM_OF_SETTING];
     //copy data from settings to data array
     int j;
     if(s_SettingDataMutex != NULL && xSemaphoreTake( s_SettingDataMutex, 5) == pdTRUE )
@@ -261,63 +375,207 @@ void setting_Save(void)
         {
             setting[j] = s_settingList[j].data;
         }
+        
+        //Check setting is change or not change
+        if (memcmp(setting, s_oldSettingData, NUM_OF_SETTING) == 0)
+        {
+            //back to setting on SQI flash, nothing to write
+            s_isSettingPending = false;
+        }
+        else if ((s_isSettingPending == false) || (memcmp(setting, s_pendingSettingData, NUM_OF_SETTING) != 0))
+        {
+            memcpy(s_pendingSettingData, setting, NUM_OF_SETTING);
+            s_settingLastChangeTick = xTaskGetTickCount();
+            if (s_isSettingPending == false)
+            {
+                s_settingFirstChangeTick = s_settingLastChangeTick;
+                s_isSettingPending = true;
+            }
+        }
         xSemaphoreGive( s_SettingDataMutex );
     }
     else
     {
         SYS_PRINT("Error: Failed to take s_SettingDataMutex \n");
     }
-    //Check setting is change or not change
-    if (memcmp(setting, s_oldSettingData, NUM_OF_SETTING) == 0)
+    return;
+}
+
+/** @brief Put settings back as waiting to be saved after a failed write,
+ *  unless newer settings are already waiting. They are written again by
+ *  setting_Task after SETTING_SAVE_DELAY_MS
+ *  @param [in] const uint8_t *data : settings of failed record
+ *  @param [out] : None
+ *  @return none
+ */
+static void setting_KeepPending(const uint8_t *data)
+{
+    if(s_SettingDataMutex != NULL && xSemaphoreTake( s_SettingDataMutex, 5) == pdTRUE )
     {
-//        SYS_PRINT("\n setting is not change");
+        if (s_isSettingPending == false)
+        {
+            memcpy(s_pendingSettingData, data, NUM_OF_SETTING);
+            s_settingLastChangeTick = xTaskGetTickCount();
+            s_settingFirstChangeTick = s_settingLastChangeTick;
+            s_isSettingPending = true;
+        }
+        xSemaphoreGive( s_SettingDataMutex );
     }
     else
     {
-//        SYS_PRINT("\n setting is change");
-        //add 2 byte CRC
-        unsigned short temp = crc_CheckNoInit(dataLength - 2, &setting[0]);
+        SYS_PRINT("Error: Failed to take s_SettingDataMutex \n");
+    }
+    return;
+}
 
-        //Check crc
-        setting[dataLength - 2] = (int8_t) (temp & 0xFF);
-        setting[dataLength - 1] = (int8_t) ((temp >> 8)&0xFF);
+/** @brief Write settings waiting to be saved to SQI flash now, as a new
+ *  record after the newest one. Settings are kept waiting if write fails
+ *  @param [in] : None
+ *  @param [out] : None
+ *  @return none
+ */
+void setting_Flush(void)
+{
+    uint8_t record[SETTING_RECORD_SIZE];
+    uint32_t sequence;
+    unsigned short crc;
+    bool isPending = false;
 
-        //save setting to SQI flash
-        file_Seek(g_settingFile, 0, SYS_FS_SEEK_SET);
-        file_Write(setting, dataLength, g_settingFile);
+    if(s_SettingDataMutex != NULL && xSemaphoreTake( s_SettingDataMutex, 5) == pdTRUE )
+    {
+        if (s_isSettingPending == true)
+        {
+            memcpy(&record[SETTING_RECORD_HEADER_SIZE], s_pendingSettingData, NUM_OF_SETTING);
+            s_isSettingPending = false;
+            isPending = true;
+        }
+        xSemaphoreGive( s_SettingDataMutex );
+    }
+    if (isPending == false)
+    {
+        return;
+    }
+    
+    sequence = s_settingSequence + 1;
+    record[0] = SETTING_RECORD_MAGIC;
+    record[1] = SETTING_RECORD_VERSION;
+    record[2] = (uint8_t)(sequence & 0xFF);
+    record[3] = (uint8_t)((sequence >> 8) & 0xFF);
+    record[4] = (uint8_t)((sequence >> 16) & 0xFF);
+    record[5] = (uint8_t)((sequence >> 24) & 0xFF);
+    
+    //add 2 byte CRC
+    crc = crc_CheckNoInit(SETTING_RECORD_SIZE - 2, (int8_t*)record);
+    record[SETTING_RECORD_SIZE - 2] = (uint8_t) (crc & 0xFF);
+    record[SETTING_RECORD_SIZE - 1] = (uint8_t) ((crc >> 8) & 0xFF);
+    
+    //save setting to SQI flash, one sync per record
+    if (setting_PrepareFile() == false)
+    {
+        setting_KeepPending(&record[SETTING_RECORD_HEADER_SIZE]);
+        return;
+    }
+    file_Seek(g_settingFile, setting_RecordOffset(sequence), SYS_FS_SEEK_SET);
+    if ((SYS_FS_FileWrite(g_settingFile, record, SETTING_RECORD_SIZE) != SETTING_RECORD_SIZE)
+        || (SYS_FS_FileSync(g_settingFile) != SYS_FS_RES_SUCCESS))
+    {
+        SYS_PRINT("\n setting_Flush write error %d \n", SYS_FS_Error());
+        setting_KeepPending(&record[SETTING_RECORD_HEADER_SIZE]);
+        return;
+    }
 
-        //Send event to log task
+    //Send event to log task
 //        logInterface_WriteMacineLog(eSettingChangedLogId);
 
-        memcpy(&s_oldSettingData[0], setting, sizeof (s_oldSettingData));
+    s_settingSequence = sequence;
+    memcpy(&s_oldSettingData[0], &record[SETTING_RECORD_HEADER_SIZE], sizeof (s_oldSettingData));
+    s_isOldSettingValid = true;
+    return;
+}
+
+/** @brief Write settings waiting to be saved when the save window elapsed.
+ *  Called periodically by GUI task
+ *  @param [in] : None
+ *  @param [out] : None
+ *  @return none
+ */
+void setting_Task(void)
+{
+    TickType_t tick = xTaskGetTickCount();
+    
+    if ((s_isSettingPending == true)
+        && ((tick - s_settingLastChangeTick >= SETTING_SAVE_DELAY_MS)
+            || (tick - s_settingFirstChangeTick >= SETTING_SAVE_MAX_DELAY_MS)))
+    {
+        setting_Flush();
     }
     return;
 }
 
-/** @brief Restore setting from SQI flash
+/** @brief Load setting from SQI flash at init. Slots are scanned for the
+ *  valid record with the highest sequence number. A file of former firmware
+ *  holds a single record without header, it is used when there is no record
  *  @param [in] None
  *  @param [out] None
- *  @return bool : true if restore success, else if restore failure
+ *  @return bool : true if load success, else if load failure
  */
-bool setting_Restore(void)
+static bool setting_Load(void)
 {
     bool rtn = false; //return value
     int i;
-    int8_t data[SETTING_DATA_LENGTH] = {0}; //buffer to store data read from SQI flash
+    uint32_t slot, index, sequence;
+    uint32_t newestSequence = 0;
+    int32_t offset;
+    long fileSize;
+    uint8_t *data = NULL;
+    uint8_t *buffer; //buffer to store data read from SQI flash
+    
+    fileSize = file_Size(g_settingFile);
+    if (fileSize > SETTING_FILE_SIZE)
+        fileSize = SETTING_FILE_SIZE;
+    buffer = (fileSize > 0) ? (uint8_t*)mm_malloc(fileSize) : NULL;
+    if (buffer == NULL)
+    {
+        SYS_PRINT("\n setting_Load no setting \n");
+        return false;
+    }
     
     //Read data from SQI flash
-    file_Read(data, SETTING_DATA_LENGTH, g_settingFile);
+    file_Read(buffer, fileSize, g_settingFile);
 
-    //check crc for the data has been read
-    unsigned short temp = crc_CheckNoInit(SETTING_DATA_LENGTH, &data[0]);
+    //find newest valid record
+    for (slot = 0; slot < SETTING_SLOT_NUM; slot++)
+    {
+        for (index = 0; index < SETTING_RECORDS_PER_SLOT; index++)
+        {
+            offset = slot * SETTING_SLOT_SIZE + index * SETTING_RECORD_SIZE;
+            if ((offset + SETTING_RECORD_SIZE <= fileSize)
+                && setting_CheckRecord(&buffer[offset], &sequence)
+                && (sequence > newestSequence))
+            {
+                newestSequence = sequence;
+                data = &buffer[offset + SETTING_RECORD_HEADER_SIZE];
+            }
+        }
+    }
+    
+    //file of former firmware
+    if ((data == NULL) && (fileSize >= SETTING_DATA_LENGTH)
+        && (crc_CheckNoInit(SETTING_DATA_LENGTH, (int8_t*)buffer) == 0))
+    {
+        data = buffer;
+    }
 
-    if (temp == 0) //crc good
+    if (data != NULL) //crc good
     {
         //use settings had just restored for application
         for (i = eFirstSettingId; i < eLastSettingId; i++)
         {
             setting_Set((E_SettingId) i, data[i]);
         }
+        s_settingSequence = newestSequence;
+        memcpy(s_oldSettingData, data, sizeof (s_oldSettingData));
+        s_isOldSettingValid = true;
         
         //set flag to indicate restore process is success
         rtn = true;
@@ -325,9 +583,46 @@ bool setting_Restore(void)
     else
     {
         char buff[255];
-        sprintf(buff, "setting_Restore crc failure %d \n", temp);
+        sprintf(buff, "setting_Load no valid record \n");
         LogInterface_WriteDebugLogFile(buff);
-        SYS_PRINT("\n setting_Restore crc failure %d \n", temp);
+        SYS_PRINT("\n setting_Load no valid record \n");
+    }
+    mm_free(buffer);
+    return rtn;
+}
+
+/** @brief Restore setting as saved, dropping changes not requested to be
+ *  saved. SQI flash is only read by setting_Init, settings are restored
+ *  from the copy of the newest record, or from settings waiting to be saved
+ *  @param [in] None
+ *  @param [out] None
+ *  @return bool : true if restore success, else if restore failure
+ */
+bool setting_Restore(void)
+{
+    bool rtn = false;
+    int i;
+
+    setting_Flush();
+
+    if(s_SettingDataMutex != NULL && xSemaphoreTake( s_SettingDataMutex, 5) == pdTRUE )
+    {
+        //settings still waiting when write failed
+        const uint8_t *data = (s_isSettingPending == true) ? s_pendingSettingData
+                : ((s_isOldSettingValid == true) ? s_oldSettingData : NULL);
+        if (data != NULL)
+        {
+            for (i = eFirstSettingId; i < eLastSettingId; i++)
+            {
+                s_settingList[i].data = data[i];
+            }
+            rtn = true;
+        }
+        xSemaphoreGive( s_SettingDataMutex );
+    }
+    else
+    {
+        SYS_PRINT("Error: Failed to take s_SettingDataMutex \n");
     }
     return rtn;
 }
@@ -350,29 +645,19 @@ void setting_Init(void)
         return;
     }
     //read setting from SQI flash
-    bool result = setting_Restore();
+    bool result = setting_Load();
     if (result == false) //data not available or wrong data
     {
         SYS_MESSAGE("\n use default setting \n");
         //use default settings
         setting_SetDefault();
         setting_Save();
+        setting_Flush();
     }
 
     //Set threshold setting
     setting_Threshold();
 
-    //Copy current setting to old setting
-    if(s_SettingDataMutex != NULL && xSemaphoreTake( s_SettingDataMutex, 5) == pdTRUE )
-    {
-        memcpy(s_oldSettingData, s_settingList, sizeof (s_oldSettingData));
-        xSemaphoreGive( s_SettingDataMutex );
-    }
-    else
-    {
-        SYS_PRINT("Error: Failed to take s_SettingDataMutex \n");
-    }
-    
     s_isInit = true;
     return;
 }
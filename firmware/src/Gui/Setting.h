@@ -21,6 +21,12 @@
 
 #define FUNCTION_DISABLE_ALARM
 
+/** @brief Define time without change before settings are written to flash */
+#define SETTING_SAVE_DELAY_MS                           (500 / portTICK_PERIOD_MS)
+
+/** @brief Define maximum time settings wait to be written to flash */
+#define SETTING_SAVE_MAX_DELAY_MS                       (2000 / portTICK_PERIOD_MS)
+
 /** @brief define step for flow setting in child mode */
 #define STEP_FLOW_SETTING_IN_CHILD_MODE                 (1)
 
@@ -286,9 +292,15 @@ void setting_Set(E_SettingId id, uint8_t value);
 //get value of a  setting id
 uint8_t setting_Get(E_SettingId id);
 
-//Save to flash when check crc sucess
+//Request to save settings, written to flash by setting_Task
 void setting_Save(void);
 
+//Write settings waiting to be saved to flash now
+void setting_Flush(void);
+
+//Write settings waiting to be saved when save window elapsed
+void setting_Task(void);
+
 //Get min setting
 uint8_t setting_GetMin(E_SettingId id);
 
@@ -59,16 +59,64 @@ static int16_t s_totalPageNum = -1;
 static int16_t s_currentPageNum = -1;
 static int16_t s_numLog = -1;
 
+// Log file state when data was init, pages are counted from the newest log at that time
+static E_LogType s_logType = eAlarmLogTypeID;
+static uint16_t s_logTotal = 0;
+static uint16_t s_logIndex = 0;
+
 #ifndef UNIT_TEST
 LogItem_Struct s_logListItem[MAX_LOG_IN_PAGE] __attribute__((section(".ddr_data"), space(prog)));
-uint8_t eventDisplayData[MAX_LOG_DISPLAY*LOG_LEN] __attribute__((section(".ddr_data"), space(prog)));
-uint8_t alarmDisplayData[MAX_ALARM_DISPLAY*LOG_LEN] __attribute__((section(".ddr_data"), space(prog)));
 #else
 LogItem_Struct s_logListItem[MAX_LOG_IN_PAGE];
-uint8_t eventDisplayData[MAX_LOG_DISPLAY*LOG_LEN];
-uint8_t alarmDisplayData[MAX_ALARM_DISPLAY*LOG_LEN];
 #endif
 
+static Log_Struct s_pageLogs[MAX_LOG_IN_PAGE];
+
+/** @brief Read logs of current page with logMgr_Query(), newest first. Logs written
+ *  after data was init do not shift pages, logs they pushed out of ring are skipped
+ *  @param [in] uint16_t logInPage: number of logs in one page
+ *  @param [out] None
+ *  @return uint16_t: number of logs read to s_pageLogs
+ */
+static uint16_t SettingScreen_DataLog_ReadPage(uint16_t logInPage)
+{
+    uint32_t maxLog = (s_logType == eAlarmLogTypeID) ? MAX_ALARM_LOG : MAX_EVENT_LOG;
+    uint32_t first = (s_currentPageNum - 1) * logInPage;
+    uint32_t last = first + logInPage;
+    if (last > s_numLog)
+        last = s_numLog;
+    if (first >= last)
+        return 0;
+    
+    uint32_t numNew = (logMgr_GetCurrentIndex(s_logType) + maxLog - s_logIndex) % maxLog;
+    uint32_t numDropped = (s_logTotal + numNew > maxLog) ? (s_logTotal + numNew - maxLog) : 0;
+    
+    // Oldest log of page counted from the oldest log at init
+    uint32_t position = s_logTotal - last;
+    uint16_t numRead = last - first;
+    if (position < numDropped)
+    {
+        if (position + numRead <= numDropped)
+            return 0;
+        numRead -= numDropped - position;
+        position = numDropped;
+    }
+    
+    LogQueryCursor_Struct cursor;
+    logMgr_SeekQuery(&cursor, position - numDropped);
+    numRead = logMgr_Query(s_logType, NULL, NULL, &cursor, s_pageLogs, numRead);
+    
+    // Query returns oldest first
+    uint16_t i;
+    for (i = 0; i < numRead / 2; i++)
+    {
+        Log_Struct tmp = s_pageLogs[i];
+        s_pageLogs[i] = s_pageLogs[numRead - 1 - i];
+        s_pageLogs[numRead - 1 - i] = tmp;
+    }
+    return numRead;
+}
+
 
 void SettingScreen_DataLog_Init()
 {
@@ -199,31 +247,19 @@ void SettingScreen_DataLog_DisplayAlarm()
     laLabelWidget_SetText(SC_DataLogSettingPageNumberLabel, pageStr);
     laString_Destroy(&pageStr);    
     
-    int indexLogNumInPage;
-    int lastIndexLogNumInPage;
-
-    // page 1 : id 0 - 14
-    // page 2 : id 15 - 29
-    // page 3 : id 30 - 35 -> show this first
-    indexLogNumInPage = (s_currentPageNum-1) * MAX_ALARM_IN_PAGE;
-    lastIndexLogNumInPage = (s_currentPageNum) * MAX_ALARM_IN_PAGE - 1 ;
-    if (lastIndexLogNumInPage >= s_numLog)
-        lastIndexLogNumInPage = s_numLog - 1;
+    uint16_t numLogInPage = SettingScreen_DataLog_ReadPage(MAX_ALARM_IN_PAGE);
    
     uint16_t index = 0;
     for (index = 0; index < MAX_ALARM_IN_PAGE; index++)
     {
-        if (indexLogNumInPage <= lastIndexLogNumInPage)
+        if (index < numLogInPage)
         {
 //            SYS_PRINT("\n log index = %d \n", index);
             
             laWidget_SetVisible(s_logListItem[index].indicatorWidget, LA_TRUE);
             laWidget_SetX((laWidget*)s_logListItem[index].nameWidget, ALARM_TITLE_ITEM_POS_X);
             
-            Log_Struct logData;
-            memset(&logData, 0, sizeof(Log_Struct));
-            logData.eCode = 0xff;
-            logMgr_GetLogFromDataArray(eAlarmLogTypeID, indexLogNumInPage, alarmDisplayData, &logData);
+            Log_Struct logData = s_pageLogs[index];
             /*  Number Column */
             char strbuff[255];
             laString str;
@@ -259,7 +295,6 @@ void SettingScreen_DataLog_DisplayAlarm()
             laLabelWidget_SetText(s_logListItem[index].nameWidget, laString_CreateFromID(string_text_Nullstring));
             laLabelWidget_SetText(s_logListItem[index].dataWidget, laString_CreateFromID(string_text_Nullstring));
         }
-        indexLogNumInPage++;
     }    
 }
 
@@ -310,31 +345,19 @@ void SettingScreen_DataLog_DisplayEvent()
     laLabelWidget_SetText(SC_DataLogSettingPageNumberLabel, pageStr);
     laString_Destroy(&pageStr);    
     
-    int indexLogNumInPage;
-    int lastIndexLogNumInPage;
-
-    // page 1 : id 0 - 14
-    // page 2 : id 15 - 29
-    // page 3 : id 30 - 35 -> show this first
-    indexLogNumInPage = (s_currentPageNum-1) * MAX_LOG_IN_PAGE;
-    lastIndexLogNumInPage = (s_currentPageNum) * MAX_LOG_IN_PAGE - 1 ;
-    if (lastIndexLogNumInPage >= s_numLog)
-        lastIndexLogNumInPage = s_numLog - 1;
+    uint16_t numLogInPage = SettingScreen_DataLog_ReadPage(MAX_LOG_IN_PAGE);
    
     uint16_t index = 0;
     for (index = 0; index < MAX_LOG_IN_PAGE; index++)
     {
-        if (indexLogNumInPage <= lastIndexLogNumInPage)
+        if (index < numLogInPage)
         {
 //            SYS_PRINT("\n log index = %d \n", index);
             
             laWidget_SetVisible(s_logListItem[index].indicatorWidget, LA_FALSE);
             laWidget_SetX((laWidget*)s_logListItem[index].nameWidget, EVENT_NAME_ITEM_POS_X);
             
-            Log_Struct logData;
-            memset(&logData, 0, sizeof(Log_Struct));
-            logData.eCode = 0xff;
-            logMgr_GetLogFromDataArray(eAlarmLogTypeID, indexLogNumInPage, eventDisplayData, &logData);
+            Log_Struct logData = s_pageLogs[index];
             /*  Number Column */
             char strbuff[255];
             laString str;
@@ -368,14 +391,16 @@ void SettingScreen_DataLog_DisplayEvent()
             laLabelWidget_SetText(s_logListItem[index].nameWidget, laString_CreateFromID(string_text_Nullstring));
             laLabelWidget_SetText(s_logListItem[index].dataWidget, laString_CreateFromID(string_text_Nullstring));
         }
-        indexLogNumInPage++;
     }    
 }
 
 void SettingScreen_DataLog_InitAlarmData()
 {
     SYS_PRINT("SettingScreen_DataLog_InitAlarmData \n");
-    s_numLog = logMgr_ReadLastestLog(eAlarmLogTypeID, MAX_ALARM_DISPLAY, alarmDisplayData);
+    s_logType = eAlarmLogTypeID;
+    s_logTotal = logMgr_GetNumberOfLog(eAlarmLogTypeID);
+    s_logIndex = logMgr_GetCurrentIndex(eAlarmLogTypeID);
+    s_numLog = (s_logTotal < MAX_ALARM_DISPLAY) ? s_logTotal : MAX_ALARM_DISPLAY;
 
     // Calculate first page
     s_totalPageNum = s_numLog / MAX_ALARM_IN_PAGE;
@@ -416,7 +441,10 @@ void SettingScreen_DataLog_PrevPage()
 void SettingScreen_DataLog_InitEventData()
 {
     SYS_PRINT("SettingScreen_DataLog_InitEventData \n");
-    s_numLog = logMgr_ReadLastestLog(eEventLogTypeID, MAX_LOG_DISPLAY, eventDisplayData);
+    s_logType = eEventLogTypeID;
+    s_logTotal = logMgr_GetNumberOfLog(eEventLogTypeID);
+    s_logIndex = logMgr_GetCurrentIndex(eEventLogTypeID);
+    s_numLog = (s_logTotal < MAX_LOG_DISPLAY) ? s_logTotal : MAX_LOG_DISPLAY;
 
     // Calculate first page
     s_totalPageNum = s_numLog / MAX_LOG_IN_PAGE;
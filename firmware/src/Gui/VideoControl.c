@@ -1,4 +1,5 @@
 #include "VideoControl.h"
+#include "Trace.h"
 
 static void *SzAlloc(ISzAllocPtr p, size_t size) {return (void*)mm_malloc(size); }
 static void SzFree(ISzAllocPtr p, void *address) {mm_free(address); }
@@ -6,6 +7,8 @@ const ISzAlloc g_Alloc = { SzAlloc, SzFree };
 #define IN_BUF_SIZE (1 << 16)
 //#define OUT_BUF_SIZE (1 << 16)
 #define OUT_BUF_SIZE (1 << 18)
+/** @brief Define number of output bytes decoded between two checks of time budget */
+#define VIDEO_DECODE_SLICE_BYTES (4 * 1024)
 
 void VideoControl_DecodeLzma_SingleCall(uint8_t *inputBuffer, uint32_t inputSize, uint8_t *outputBuffer, uint32_t outputSize)
 {
@@ -111,18 +114,6 @@ uint32_t VideoControl_ReadBufferFromFile(uint8_t** buffer, const char* dirPath,
 void VideoControl_InitControl(VideoControl *video_control)
 {
 //    SYS_PRINT("VideoControl_InitControl \n");
-    if ( xVideoControlSemaphore == NULL )
-    {
-        xVideoControlSemaphore = xSemaphoreCreateMutex();
-    }
-    if ( xVideoControlSemaphore != NULL )
-    {
-    }
-    else
-    {
-        SYS_PRINT("Error: xVideoControlSemaphore is NULL \n");
-    }
-
     // Initialize playback settings
     video_control->gfxContext = GFX_ActiveContext();
     video_control->outputBuffer = video_control->gfxContext->layer.layers[0].buffers[0].pb.pixels;
@@ -138,6 +129,18 @@ void VideoControl_InitControl(VideoControl *video_control)
     video_control->frameTotal = video_control->inputSizeInBytes / video_control->frameSizeInBytes;
     video_control->frameReady = 0;
     video_control->inputBuffer = mm_malloc(video_control->inputSizeInBytes);
+    video_control->frameType = mm_malloc(video_control->frameTotal);
+    if (video_control->frameType)
+    {
+        memset(video_control->frameType, eVideoKeyFrame, video_control->frameTotal);
+    }
+    
+    LzmaDec_Construct(&video_control->lzmaDec);
+    video_control->isDecoding = false;
+    if (video_control->decodeBudgetMS == 0)
+    {
+        video_control->decodeBudgetMS = VIDEO_DECODE_BUDGET_MS;
+    }
     
     //Set video frame (base) to RGB565
     GFX_Set(GFXF_LAYER_ACTIVE, 0); 
@@ -176,16 +179,25 @@ void VideoControl_Deinit(VideoControl * video_control)
 {
 //    SYS_PRINT("VideoControl_Deinit \n");
     VideoControl_StopPlayVideo(video_control);
+    video_control->isDecoding = false;
+    // dictionary is the frame slot in inputBuffer, only probability tables are owned by decoder
+    video_control->lzmaDec.dic = NULL;
+    LzmaDec_FreeProbs(&video_control->lzmaDec, &g_Alloc);
     if (video_control->inputBuffer)
     {
         mm_free(video_control->inputBuffer);
         video_control->inputBuffer = 0;
     }
+    if (video_control->frameType)
+    {
+        mm_free(video_control->frameType);
+        video_control->frameType = 0;
+    }
 }
 
 void VideoControl_UpdateFrame (uint8_t *src_add, uint32_t x, uint32_t y , uint32_t w, uint32_t h, uint32_t byte_per_pixel,  uint8_t *dest_add, uint32_t dest_w, uint32_t dest_h)
 {    
-    SYS_PRINT(" %d %d %d %d %d %d %d %d %d \n" ,src_add, x, y, w, h, byte_per_pixel, dest_add, dest_w, dest_h );
+    TRACE(eTraceVideoUpdateFrameId, (uint32_t)src_add, x, y, w, h, byte_per_pixel, (uint32_t)dest_add, dest_w, dest_h);
 	uint32_t line;
     uint32_t screenSizeInBytes = dest_w * dest_h * byte_per_pixel;
     uint32_t frameLineInBytes = w * byte_per_pixel;
@@ -199,12 +211,12 @@ void VideoControl_UpdateFrame (uint8_t *src_add, uint32_t x, uint32_t y , uint32
         src_add_line = line * frameLineInBytes;
         if ( dest_add_line + frameLineInBytes > screenSizeInBytes) 
         {
-            SYS_PRINT("error line %d dest_add_line %d frameLineInBytes %d screenSizeInBytes %d \n" ,line, dest_add_line, frameLineInBytes, screenSizeInBytes );
+            TRACE(eTraceVideoDestLineErrorId, line, dest_add_line, frameLineInBytes, screenSizeInBytes);
             break;
         }
         if ( src_add_line + frameLineInBytes > frameSizeInBytes)
         {
-            SYS_PRINT("error line %d src_add_line %d frameLineInBytes %d frameSizeInBytes %d \n" ,line, src_add_line, frameLineInBytes, frameSizeInBytes );
+            TRACE(eTraceVideoSrcLineErrorId, line, src_add_line, frameLineInBytes, frameSizeInBytes);
             break;
         }
         if ( dest_add > 0 && src_add > 0)
@@ -215,43 +227,312 @@ void VideoControl_UpdateFrame (uint8_t *src_add, uint32_t x, uint32_t y , uint32
         }
         else
         {
-            SYS_PRINT("error inputBuffer, outputBuffer");
+            TRACE(eTraceVideoBufferErrorId);
             return;
         }
     }
 }
 
-void VideoControl_MemCopy(void* dest, const void *src , size_t s )
-{
-    if ( xVideoControlSemaphore != NULL )
+/** @brief Decode one frame into its slot in inputBuffer, blocking until done
+ *  @param [in]  VideoControl *video_control: video
+ *  @param [in]  uint8_t frameIndex: index of frame in inputBuffer
+ *  @param [in]  uint8_t *compressedBuffer: LZMA data of frame
+ *  @param [in]  uint16_t compressedSize: size of LZMA data
+ *  @param [out]  None
+ *  @return None
+ */
+void VideoControl_DecodeFrame(VideoControl *video_control, uint8_t frameIndex, uint8_t *compressedBuffer, uint16_t compressedSize)
+{        
+    if (VideoControl_DecodeFrameStart(video_control, frameIndex, compressedBuffer, compressedSize))
     {
-        if( xSemaphoreTake( xVideoControlSemaphore, ( TickType_t ) 20 ) == pdTRUE )
+        while (VideoControl_DecodeFrameStep(video_control) == eVideoDecodeInProgress)
         {
-            memcpy(dest, src, s);
-            xSemaphoreGive( xVideoControlSemaphore );
         }
-        else
+    }
+}
+
+/** @brief Publish a frame to the playback callback. Frames below frameReady are
+ *  never written again, so the callback reads them without lock
+ *  @param [in]  VideoControl *video_control: video
+ *  @param [in]  unsigned int frameIndex: index of frame
+ *  @param [out]  None
+ *  @return None
+ */
+static void VideoControl_PublishFrame(VideoControl *video_control, unsigned int frameIndex)
+{
+    // make sure frame data is written before the ready index
+    __sync_synchronize();
+    video_control->frameReady = frameIndex + 1;
+}
+
+/** @brief Publish a frame that can not be decoded. It is replaced by an empty
+ *  delta frame, so the previous frame stays on screen
+ *  @param [in]  VideoControl *video_control: video
+ *  @param [in]  unsigned int frameIndex: index of frame
+ *  @param [out]  None
+ *  @return None
+ */
+static void VideoControl_SkipFrame(VideoControl *video_control, unsigned int frameIndex)
+{
+    VideoDeltaHeader header = {.magic = VIDEO_DELTA_MAGIC, .rectCount = 0, .reserved = 0};
+    
+    if (frameIndex > 0 && video_control->inputBuffer != NULL && video_control->frameType != NULL)
+    {
+        memcpy(video_control->inputBuffer + frameIndex * video_control->frameSizeInBytes, &header, sizeof(header));
+        video_control->frameType[frameIndex] = eVideoDeltaFrame;
+    }
+    VideoControl_PublishFrame(video_control, frameIndex);
+}
+
+/** @brief Check a delta frame decoded in inputBuffer, all rectangles must be
+ *  inside the frame and their pixels must fill the rest of the data
+ *  @param [in]  VideoControl *video_control: video
+ *  @param [in]  const uint8_t *data: delta frame
+ *  @param [in]  uint32_t size: size of delta frame
+ *  @param [out]  None
+ *  @return bool: true if delta frame is valid
+ */
+static bool VideoControl_CheckDeltaFrame(VideoControl *video_control, const uint8_t *data, uint32_t size)
+{
+    VideoDeltaHeader header;
+    VideoDeltaRect rect;
+    uint32_t expectSize;
+    int i;
+    
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != VIDEO_DELTA_MAGIC)
+    {
+        return false;
+    }
+    
+    expectSize = sizeof(header) + header.rectCount * sizeof(rect);
+    for (i = 0; i < header.rectCount && expectSize <= size; i++)
+    {
+        memcpy(&rect, data + sizeof(header) + i * sizeof(rect), sizeof(rect));
+        if (rect.x + rect.w > video_control->w || rect.y + rect.h > video_control->h)
         {
-            SYS_PRINT("Error: Failed to take xVideoControlSemaphore \n");
+            return false;
         }
+        expectSize += rect.w * rect.h * video_control->bytesPerPixel;
+    }
+    
+    return (expectSize == size);
+}
+
+/** @brief Start incremental decoding of one frame. Frame is decoded by calling
+ *  VideoControl_DecodeFrameStep until it does not return eVideoDecodeInProgress
+ *  @param [in]  VideoControl *video_control: video
+ *  @param [in]  uint8_t frameIndex: index of frame in inputBuffer
+ *  @param [in]  uint8_t *compressedBuffer: LZMA data of frame
+ *  @param [in]  uint32_t compressedSize: size of LZMA data
+ *  @param [out]  None
+ *  @return bool: true if decoder is ready
+ */
+bool VideoControl_DecodeFrameStart(VideoControl *video_control, uint8_t frameIndex, uint8_t *compressedBuffer, uint32_t compressedSize)
+{
+    UInt64 unpackSize = 0;
+    int i;
+    
+    if (compressedBuffer == NULL || video_control->inputBuffer == NULL || video_control->frameType == NULL
+        || compressedSize < LZMA_PROPS_SIZE + 8)
+    {
+        SYS_PRINT("Error : invalid compressed frame %d \n", frameIndex);
+        VideoControl_SkipFrame(video_control, frameIndex);
+        return false;
+    }
+    
+    /* header: 5 bytes of LZMA properties and 8 bytes of uncompressed size */
+    for (i = 0; i < 8; i++)
+    {
+        unpackSize += (UInt64)compressedBuffer[LZMA_PROPS_SIZE + i] << (i * 8);
+    }
+    //first frame must be a key frame, a smaller frame is a delta frame
+    if (unpackSize == video_control->frameSizeInBytes)
+    {
+        video_control->frameType[frameIndex] = eVideoKeyFrame;
+    }
+    else if (frameIndex > 0 && unpackSize >= sizeof(VideoDeltaHeader) && unpackSize < video_control->frameSizeInBytes)
+    {
+        video_control->frameType[frameIndex] = eVideoDeltaFrame;
     }
     else
     {
-        SYS_PRINT("Error: xVideoControlSemaphore is NULL \n");
+        SYS_PRINT("Error : Unmatch unpackSize %llu \n", unpackSize);
+        VideoControl_SkipFrame(video_control, frameIndex);
+        return false;
+    }
+    
+    //probability tables are allocated at first frame and kept for the whole video
+    if (LzmaDec_AllocateProbs(&video_control->lzmaDec, compressedBuffer, LZMA_PROPS_SIZE, &g_Alloc) != SZ_OK)
+    {
+        SYS_PRINT("Error : LzmaDec_AllocateProbs frame %d \n", frameIndex);
+        VideoControl_SkipFrame(video_control, frameIndex);
+        return false;
     }
+    //decode in place, dictionary is the frame slot in inputBuffer
+    video_control->lzmaDec.dic = video_control->inputBuffer + frameIndex * video_control->frameSizeInBytes;
+    video_control->lzmaDec.dicBufSize = (SizeT)unpackSize;
+    LzmaDec_Init(&video_control->lzmaDec);
+    
+    video_control->decodeSrc = compressedBuffer + LZMA_PROPS_SIZE + 8;
+    video_control->decodeSrcRemain = compressedSize - (LZMA_PROPS_SIZE + 8);
+    video_control->decodeFrameIndex = frameIndex;
+    video_control->isDecoding = true;
+    
+    return true;
 }
 
-void VideoControl_DecodeFrame(VideoControl *video_control, uint8_t frameIndex, uint8_t *compressedBuffer, uint16_t compressedSize)
-{        
+/** @brief Decode next part of the frame started by VideoControl_DecodeFrameStart.
+ *  Decoding stops when the frame is complete or decodeBudgetMS is used up. The
+ *  frame is published with frameReady when it is complete or fails
+ *  @param [in]  VideoControl *video_control: video
+ *  @param [out]  None
+ *  @return VideoDecodeResult
+ */
+VideoDecodeResult VideoControl_DecodeFrameStep(VideoControl *video_control)
+{
+    TickType_t startTick = xTaskGetTickCount();
+    CLzmaDec *dec = &video_control->lzmaDec;
+    SRes res;
+    ELzmaStatus status;
+    SizeT srcLen;
+    SizeT dicPos;
+    SizeT dicLimit;
+    
+    if (!video_control->isDecoding)
+    {
+        return eVideoDecodeError;
+    }
+    
+    do
+    {
+        dicPos = dec->dicPos;
+        dicLimit = dicPos + VIDEO_DECODE_SLICE_BYTES;
+        if (dicLimit > dec->dicBufSize)
+        {
+            dicLimit = dec->dicBufSize;
+        }
+        srcLen = video_control->decodeSrcRemain;
+        
+        res = LzmaDec_DecodeToDic(dec, dicLimit, video_control->decodeSrc, &srcLen, LZMA_FINISH_ANY, &status);
+        
+        video_control->decodeSrc += srcLen;
+        video_control->decodeSrcRemain -= srcLen;
+        
+        if (res != SZ_OK || (dec->dicPos == dicPos && srcLen == 0))
+        {
+            SYS_PRINT("[Gui][Debug] LzmaDec_DecodeToDic res %d frame %d pos %d \n", res, video_control->decodeFrameIndex, dec->dicPos);
+            video_control->isDecoding = false;
+            VideoControl_SkipFrame(video_control, video_control->decodeFrameIndex);
+            return eVideoDecodeError;
+        }
+        
+        if (dec->dicPos >= dec->dicBufSize)
+        {
+            video_control->isDecoding = false;
+            if (video_control->frameType[video_control->decodeFrameIndex] == eVideoDeltaFrame
+                && !VideoControl_CheckDeltaFrame(video_control, dec->dic, dec->dicBufSize))
+            {
+                SYS_PRINT("Error : invalid delta frame %d \n", video_control->decodeFrameIndex);
+                VideoControl_SkipFrame(video_control, video_control->decodeFrameIndex);
+                return eVideoDecodeError;
+            }
+            VideoControl_PublishFrame(video_control, video_control->decodeFrameIndex);
+            return eVideoDecodeDone;
+        }
+    } while (xTaskGetTickCount() - startTick < video_control->decodeBudgetMS);
+    
+    return eVideoDecodeInProgress;
+}
+
+/** @brief Get type of a decoded frame
+ *  @param [in]  VideoControl *video_control: video
+ *  @param [in]  unsigned int frameIndex: index of frame
+ *  @param [out]  None
+ *  @return VideoFrameType
+ */
+VideoFrameType VideoControl_GetFrameType(VideoControl *video_control, unsigned int frameIndex)
+{
+    if (video_control->frameType == NULL || frameIndex >= video_control->frameTotal)
+    {
+        return eVideoKeyFrame;
+    }
+    return (VideoFrameType)video_control->frameType[frameIndex];
+}
+
+/** @brief Draw a decoded frame to a screen buffer at video position. A key
+ *  frame is copied whole, a delta frame only writes its changed rectangles, so
+ *  the buffer must already hold the previous frame
+ *  @param [in]  VideoControl *video_control: video
+ *  @param [in]  unsigned int frameIndex: index of frame
+ *  @param [in]  uint8_t *dest: screen buffer
+ *  @param [out]  None
+ *  @return None
+ */
+void VideoControl_BlitFrame(VideoControl *video_control, unsigned int frameIndex, uint8_t *dest)
+{
     unsigned long frame_add = frameIndex * video_control->frameSizeInBytes;
-    uint8_t *frameBuffer = mm_malloc(video_control->frameSizeInBytes);
-//    TickType_t xGuiTick = xTaskGetTickCount();
-//    SYS_PRINT("VideoControl_DecodeFrame compressedSize %d outputSize %d \n", compressedSize, video_control->frameSizeInBytes);
-    VideoControl_DecodeLzma_SingleCall(compressedBuffer, compressedSize, frameBuffer, video_control->frameSizeInBytes);
-    VideoControl_MemCopy(video_control->inputBuffer+frame_add, frameBuffer, video_control->frameSizeInBytes);
-//    xGuiTick = xTaskGetTickCount() - xGuiTick;
-//    SYS_PRINT("VideoControl_DecodeLzma (tick) %d frameReady %d \n",xGuiTick, frameIndex);    
-    mm_free(frameBuffer);
+    unsigned long screenLineInBytes = video_control->screenWidth * video_control->bytesPerPixel;
+    unsigned long dest_add;
+    const uint8_t *src;
+    VideoDeltaHeader header;
+    VideoDeltaRect rect;
+    unsigned long rectLineInBytes;
+    unsigned int line;
+    int i;
+    
+    if (dest == NULL || video_control->inputBuffer == NULL || frameIndex >= video_control->frameTotal)
+    {
+        SYS_PRINT("error inputBuffer, outputBuffer");
+        return;
+    }
+    src = video_control->inputBuffer + frame_add;
+    
+    if (VideoControl_GetFrameType(video_control, frameIndex) == eVideoKeyFrame)
+    {
+        if (video_control->x == 0 && video_control->frameLineInBytes == screenLineInBytes)
+        {
+            dest_add = video_control->y * screenLineInBytes;
+            if (dest_add + video_control->frameSizeInBytes <= video_control->screenSizeInBytes)
+            {
+                memcpy(dest + dest_add, src, video_control->frameSizeInBytes);
+            }
+            return;
+        }
+        for (line = 0 ; line < video_control->h; line++)
+        {
+            dest_add = (video_control->x + (video_control->y + line) * video_control->screenWidth) * video_control->bytesPerPixel;
+            // protect overflow
+            if (dest_add + video_control->frameLineInBytes > video_control->screenSizeInBytes)
+            {
+                SYS_PRINT("error line %d dest_add %d \n", line, dest_add);
+                break;
+            }
+            memcpy(dest + dest_add, src + line * video_control->frameLineInBytes, video_control->frameLineInBytes);
+        }
+        return;
+    }
+    
+    //delta frame was checked when decoded
+    memcpy(&header, src, sizeof(header));
+    const uint8_t *pixel = src + sizeof(header) + header.rectCount * sizeof(rect);
+    for (i = 0; i < header.rectCount; i++)
+    {
+        memcpy(&rect, src + sizeof(header) + i * sizeof(rect), sizeof(rect));
+        rectLineInBytes = rect.w * video_control->bytesPerPixel;
+        for (line = 0; line < rect.h; line++)
+        {
+            dest_add = (video_control->x + rect.x + (video_control->y + rect.y + line) * video_control->screenWidth) * video_control->bytesPerPixel;
+            // protect overflow
+            if (dest_add + rectLineInBytes > video_control->screenSizeInBytes)
+            {
+                SYS_PRINT("error line %d dest_add %d \n", line, dest_add);
+                return;
+            }
+            memcpy(dest + dest_add, pixel, rectLineInBytes);
+            pixel += rectLineInBytes;
+        }
+    }
 }
 
 /* end of file */
\ No newline at end of file
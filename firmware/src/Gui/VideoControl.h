@@ -7,7 +7,6 @@
 
 #include "Gui/GuiDefine.h"
 
-SemaphoreHandle_t xVideoControlSemaphore = NULL;
 TickType_t xCallbackTick;
 
 typedef enum
@@ -20,6 +19,46 @@ typedef enum
     eNoOfVideoControlState,
 }VideoControlState;
 
+/** @brief Define result of one step of incremental frame decoding */
+typedef enum
+{
+    eVideoDecodeInProgress,
+    eVideoDecodeDone,
+    eVideoDecodeError,
+}VideoDecodeResult;
+
+/** @brief Define default time budget of one decode step (ms) */
+#define VIDEO_DECODE_BUDGET_MS      (5)
+
+/** @brief Define type of frame in inputBuffer */
+typedef enum
+{
+    eVideoKeyFrame,     /**< full frame */
+    eVideoDeltaFrame,   /**< changed rectangles from previous frame */
+}VideoFrameType;
+
+/** @brief Define magic at the beginning of a delta frame ("JDLT") */
+#define VIDEO_DELTA_MAGIC           (0x544C444A)
+
+/** @brief Define header of a delta frame. A frame whose uncompressed size is
+ *  not the full frame size is a delta frame: this header, rectCount
+ *  VideoDeltaRect, then the pixels of each rectangle line by line */
+typedef struct
+{
+    uint32_t magic;
+    uint16_t rectCount;
+    uint16_t reserved;
+} VideoDeltaHeader;
+
+/** @brief Define changed rectangle of a delta frame, in frame coordinates */
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+} VideoDeltaRect;
+
 
 typedef struct
 {
@@ -33,7 +72,7 @@ typedef struct
     unsigned int frameLineInBytes;
     unsigned int frameIndex;
     unsigned int frameTotal;
-    unsigned int frameReady;
+    volatile unsigned int frameReady;
     unsigned int frameRateMS;
 
     
@@ -51,11 +90,20 @@ typedef struct
     uint8_t *outputBuffer1;
     uint8_t *inputBuffer;
     unsigned int inputSizeInBytes;
+    uint8_t *frameType;
     
     unsigned int playbackScreenID;
     SYS_TMR_HANDLE updateFrameTimerHandle;
     SYS_TMR_CALLBACK callback;
     bool isPlaying;
+    
+    // Incremental decoder state
+    CLzmaDec lzmaDec;
+    const uint8_t *decodeSrc;
+    unsigned int decodeSrcRemain;
+    unsigned int decodeFrameIndex;
+    unsigned int decodeBudgetMS;
+    bool isDecoding;
 } VideoControl;
 
 /** @brief Define the alarm animation data */
@@ -88,6 +136,10 @@ void VideoControl_InitControl(VideoControl *video_control);
 void VideoControl_Deinit(VideoControl * video_control);
 void VideoControl_UpdateFrame (uint8_t *src_add, uint32_t x, uint32_t y , uint32_t w, uint32_t h, uint32_t byte_per_pixel,  uint8_t *dest_add, uint32_t dest_w, uint32_t dest_h);
 void VideoControl_DecodeFrame(VideoControl *video_control, uint8_t frameIndex, uint8_t *compressedBuffer, uint16_t compressedSize);
+bool VideoControl_DecodeFrameStart(VideoControl *video_control, uint8_t frameIndex, uint8_t *compressedBuffer, uint32_t compressedSize);
+VideoDecodeResult VideoControl_DecodeFrameStep(VideoControl *video_control);
+VideoFrameType VideoControl_GetFrameType(VideoControl *video_control, unsigned int frameIndex);
+void VideoControl_BlitFrame(VideoControl *video_control, unsigned int frameIndex, uint8_t *dest);
 void VideoControl_StopPlayVideo(VideoControl * video_control);
 void VideoControl_StartPlayVideo(VideoControl * video_control);
 
@@ -115,10 +115,18 @@ void VideoScreen_Run(void) {
             {
                 // Playing video
 //                SYS_PRINT("VideoScreen_Run - ePlayVideoDispState %d  \n", introVideoControl.frameReady);
-                uint8_t *compressedBuffer = introVideoInputData[introVideoControl.frameReady];
-                uint16_t size = g_fileList[introVideoControl.frameReady + INTRO_VIDEO_START_INDEX].fileSize ;
-                VideoControl_DecodeFrame(&introVideoControl, introVideoControl.frameReady, compressedBuffer, size);
-                introVideoControl.frameReady++;
+                if (!introVideoControl.isDecoding)
+                {
+                    uint8_t *compressedBuffer = introVideoInputData[introVideoControl.frameReady];
+                    uint32_t size = g_fileList[introVideoControl.frameReady + INTRO_VIDEO_START_INDEX].fileSize ;
+                    // frame can not be decoded is skipped by frameReady
+                    VideoControl_DecodeFrameStart(&introVideoControl, introVideoControl.frameReady, compressedBuffer, size);
+                }
+                // decode part of frame, bounded by decode budget of each GUI tick
+                if (introVideoControl.isDecoding)
+                {
+                    VideoControl_DecodeFrameStep(&introVideoControl);
+                }
             }
             else
             {
@@ -243,10 +251,14 @@ void VideoScreen_FrameUpdateCallback(uintptr_t context, uint32_t currTick)
 //        SYS_PRINT("\n Error : frame invalid %d %d %d \n", introVideoControl.frameIndex, introVideoControl.frameReady, introVideoControl.frameTotal);
         return;
     }
-    unsigned long frame_add = introVideoControl.frameIndex * introVideoControl.frameSizeInBytes ;
-    VideoControl_MemCopy(GFX_LayerWriteBuffer(GFX_ActiveContext()->layer.active)->pixels,
-                        introVideoControl.inputBuffer + frame_add,
-                        introVideoControl.frameSizeInBytes);
+    uint8_t *writeBuffer = GFX_LayerWriteBuffer(GFX_ActiveContext()->layer.active)->pixels;
+    // write buffer holds the frame before previous one (layer is double buffered),
+    // so previous frame is drawn first when this frame is a delta frame
+    if (VideoControl_GetFrameType(&introVideoControl, introVideoControl.frameIndex) == eVideoDeltaFrame)
+    {
+        VideoControl_BlitFrame(&introVideoControl, introVideoControl.frameIndex - 1, writeBuffer);
+    }
+    VideoControl_BlitFrame(&introVideoControl, introVideoControl.frameIndex, writeBuffer);
 
     GFX_Set(GFXF_LAYER_SWAP, GFX_TRUE);
     if (++introVideoControl.frameIndex >= introVideoControl.frameTotal) 
@@ -26,6 +26,25 @@
  * Segregated lists: partition the block sizes by powers of two 
  * starting from 3 blocks, because it's the minimum size requirement
  *
+ * Slab layer (MM_SLAB_ENABLE): requests up to the biggest slab class are
+ * served from per-class free lists of fixed size objects. Objects are carved
+ * from pages allocated on the heap above and are never returned to it, so
+ * alloc and free are O(1) and small objects do not fragment the heap. The
+ * heap keeps the pages of each class at its high water mark, that is
+ * highwater * size / SLAB_PAGESIZE pages rounded up, and as sizes are
+ * rounded up to a power of two up to half of an object is unused. Check
+ * both with slab statistics (mm_checkheap) before enabling it. An
+ * object has a header word like a heap block, with SLAB_FLAG set and the
+ * class number in the size bits:
+ *
+ *      31                     3  2  1  0
+ *      -----------------------------------
+ *     | c  c  c  c  ... c  c  c  0  1  1
+ *      -----------------------------------
+ *
+ * Define MM_TRACE to print every allocation to console, the log can be
+ * replayed on host by tools/MmTraceReplay.
+ *
  */
 #include <assert.h>
 #include <stdio.h>
@@ -34,7 +53,6 @@
 #include <stdbool.h>
 #include "mm.h"
 #include "memlib.h"
-#include "Gui/DisplayControl.h"
 
 
 
@@ -94,9 +112,48 @@
 /* class no: 0 - NUM_FREELIST-1 */
 #define NUM_FREELIST 10
 
+/* slab layer is optional, build with MM_SLAB_ENABLE=1 to use it */
+#ifndef MM_SLAB_ENABLE
+#define MM_SLAB_ENABLE 0
+#endif
+
+/* header bit marking a slab object */
+#define SLAB_FLAG    0x2
+
+/* number of slab classes */
+#define NUM_SLABCLASS 8
+
+/* size of page carved into slab objects (bytes) */
+#define SLAB_PAGESIZE (16*1024)
+
+/* Given slab object ptr bp, get its class */
+#define SLAB_CLASS(bp) (GET(HDRP(bp)) >> 3)
+
+/* slab class: free list and statistics */
+typedef struct {
+    size_t size;           /* object size (bytes) */
+    void *freelist;        /* first free object */
+    unsigned int inuse;    /* objects allocated */
+    unsigned int highwater;/* max objects allocated at once */
+    unsigned int total;    /* objects carved from pages */
+    unsigned int pages;    /* pages taken from heap */
+} slabclass_t;
+
 /* The only global variable is a pointer to the first block */
 char *heap_listp;
 
+#ifdef MM_TRACE
+/* no trace inside mm_realloc, it is traced as one call */
+static int trace_suspend = 0;
+#endif
+
+#if MM_SLAB_ENABLE
+/* slab classes, sizes are the hot sizes of GUI widgets and small buffers */
+static slabclass_t slabclass[NUM_SLABCLASS] = {
+    {16}, {32}, {64}, {128}, {256}, {512}, {1024}, {2048}
+};
+#endif
+
 /* function prototypes for internal helper routines */
 inline void *extend_heap(size_t words);
 inline void place(void *bp, size_t asize);
@@ -116,6 +173,15 @@ inline int in_heap(const void *p);
 inline void *offset2addr(int offset);
 inline void *next_free_blck(void *bp);
 inline void *prev_free_blck(void *bp);
+static void *heap_malloc(size_t size);
+static void heap_free(void *bp);
+static void *heap_realloc(void *oldptr, size_t size);
+#if MM_SLAB_ENABLE
+static int slab_getclass(size_t size);
+static void *slab_alloc(int class);
+static void slab_free(void *bp);
+static void slab_printstats(void);
+#endif
 
 /*
  * mm_init - Initialize the memory manager
@@ -141,13 +207,65 @@ int mm_init(void)
     /* Extend the empty heap with a free block of CHUNKSIZE bytes */
     if (extend_heap(CHUNKSIZE/WSIZE) == NULL)
         return -1;
+#if MM_SLAB_ENABLE
+    for (i = 0; i < NUM_SLABCLASS; i++) {
+        slabclass[i].freelist = NULL;
+        slabclass[i].inuse = 0;
+        slabclass[i].highwater = 0;
+        slabclass[i].total = 0;
+        slabclass[i].pages = 0;
+    }
+#endif
     return 0;
 }
 
 /*
- * mm_malloc - Allocate a block with at least size bytes of payload
+ * mm_malloc - Allocate a block with at least size bytes of payload,
+ *             from slab if size fits a slab class
  */
 void *mm_malloc(size_t size)
+{
+    void *bp;
+#if MM_SLAB_ENABLE
+    int class = slab_getclass(size);
+    
+    if (class >= 0)
+        bp = slab_alloc(class);
+    else
+        bp = heap_malloc(size);
+#else
+    bp = heap_malloc(size);
+#endif
+#ifdef MM_TRACE
+    if (!trace_suspend)
+        printf("mm a %lx %u\n", (unsigned long)bp, (unsigned int)size);
+#endif
+    return bp;
+}
+
+/*
+ * mm_free - Free a block or a slab object
+ */
+void mm_free(void *bp)
+{
+#ifdef MM_TRACE
+    if (!trace_suspend)
+        printf("mm f %lx\n", (unsigned long)bp);
+#endif
+    if(!bp) return;
+#if MM_SLAB_ENABLE
+    if (GET(HDRP(bp)) & SLAB_FLAG) {
+        slab_free(bp);
+        return;
+    }
+#endif
+    heap_free(bp);
+}
+
+/*
+ * heap_malloc - Allocate a block from segregated lists
+ */
+static void *heap_malloc(size_t size)
 {
 //    static uint32_t TotalMallocSize = 0;
 //    TotalMallocSize += size;
@@ -180,12 +298,11 @@ void *mm_malloc(size_t size)
 }
 
 /*
- * mm_free - Free a block
+ * heap_free - Free a block to segregated lists
  */
-void mm_free(void *bp)
+static void heap_free(void *bp)
 {
 //    dbg_printf("Calling mm_free........");
-    if(!bp) return;
     size_t size = GET_SIZE(HDRP(bp));
     
     PUT(HDRP(bp), PACK(size, 0));
@@ -229,9 +346,26 @@ inline void insert_freenode(void *bp)
 
 
 /*
- * realloc - you may want to look at mm-naive.c
+ * mm_realloc - Change the size of a block
  */
 void *mm_realloc(void *oldptr, size_t size)
+{
+    void *newptr;
+#ifdef MM_TRACE
+    trace_suspend++;
+#endif
+    newptr = heap_realloc(oldptr, size);
+#ifdef MM_TRACE
+    trace_suspend--;
+    printf("mm r %lx %lx %u\n", (unsigned long)oldptr, (unsigned long)newptr, (unsigned int)size);
+#endif
+    return newptr;
+}
+
+/*
+ * heap_realloc - Resize a heap block or a slab object
+ */
+static void *heap_realloc(void *oldptr, size_t size)
 {
 //    dbg_printf("Calling mm_relloc........");
     size_t oldsize;
@@ -248,6 +382,22 @@ void *mm_realloc(void *oldptr, size_t size)
         return mm_malloc(size);
     }
     
+#if MM_SLAB_ENABLE
+    /* slab object: keep it while size fits its class */
+    if (GET(HDRP(oldptr)) & SLAB_FLAG) {
+        oldsize = slabclass[SLAB_CLASS(oldptr)].size;
+        if (size <= oldsize)
+            return oldptr;
+        newptr = mm_malloc(size);
+        if(!newptr) {
+            return 0;
+        }
+        memcpy(newptr, oldptr, oldsize);
+        mm_free(oldptr);
+        return newptr;
+    }
+#endif
+    
     oldsize = GET_SIZE(HDRP(oldptr));
     
     /* If size <= old size or the old block has a free block next to it,
@@ -302,7 +452,8 @@ void *mm_calloc (size_t nmemb, size_t size) {
     void *newptr;
     
     newptr = mm_malloc(bytes);
-    memset(newptr, 0, bytes);
+    if (newptr)
+        memset(newptr, 0, bytes);
     
     return newptr;
 }
@@ -358,7 +509,98 @@ void mm_checkheap(int verbose)
         printfreelist();
     }
     checkfreelist(free_block_count);
+#if MM_SLAB_ENABLE
+    slab_printstats();
+#endif
+}
+
+#if MM_SLAB_ENABLE
+/*
+ * slab_getclass - Get smallest slab class fitting size, -1 if none
+ */
+static int slab_getclass(size_t size)
+{
+    int class;
+    
+    if (size <= 0)
+        return -1;
+    for (class = 0; class < NUM_SLABCLASS; class++) {
+        if (size <= slabclass[class].size)
+            return class;
+    }
+    return -1;
+}
+
+/*
+ * slab_alloc - Pop an object of the class, carve a new page from heap if
+ *              the class has no free object
+ */
+static void *slab_alloc(int class)
+{
+    slabclass_t *sc = &slabclass[class];
+    size_t stride = sc->size + DSIZE;
+    char *page;
+    char *bp;
+    int i, num;
+    
+    if (sc->freelist == NULL) {
+        if ((page = heap_malloc(SLAB_PAGESIZE)) == NULL)
+            return NULL;
+        /* each object: pad | header | payload, payload is 8 bytes aligned */
+        num = SLAB_PAGESIZE / stride;
+        for (i = num - 1; i >= 0; i--) {
+            bp = page + i * stride + DSIZE;
+            PUT(HDRP(bp), PACK(class << 3, SLAB_FLAG | 1));
+            *(void **)bp = sc->freelist;
+            sc->freelist = bp;
+        }
+        sc->total += num;
+        sc->pages++;
+    }
+    
+    bp = sc->freelist;
+    sc->freelist = *(void **)bp;
+    sc->inuse++;
+    if (sc->inuse > sc->highwater)
+        sc->highwater = sc->inuse;
+    return bp;
+}
+
+/*
+ * slab_free - Push an object back to free list of its class
+ */
+static void slab_free(void *bp)
+{
+    slabclass_t *sc = &slabclass[SLAB_CLASS(bp)];
+    
+    *(void **)bp = sc->freelist;
+    sc->freelist = bp;
+    sc->inuse--;
+}
+
+/*
+ * slab_printstats - print occupancy and high-water mark of each slab class
+ *                   and check free object count
+ */
+static void slab_printstats(void)
+{
+    int i;
+    unsigned int free_count;
+    void *bp;
+    
+    printf("Slab: size inuse highwater total pages\n");
+    for (i = 0; i < NUM_SLABCLASS; i++) {
+        free_count = 0;
+        for (bp = slabclass[i].freelist; bp != NULL; bp = *(void **)bp)
+            free_count++;
+        printf("%6u %5u %9u %5u %5u\n", (unsigned int)slabclass[i].size, slabclass[i].inuse,
+               slabclass[i].highwater, slabclass[i].total, slabclass[i].pages);
+        if (free_count + slabclass[i].inuse != slabclass[i].total)
+            printf("Error: slab %u free count not matched: %u vs %u\n",
+                   (unsigned int)slabclass[i].size, free_count, slabclass[i].total - slabclass[i].inuse);
+    }
 }
+#endif
 
 
 /* The remaining routines are internal helper routines */
@@ -677,12 +919,13 @@ inline int aligned(const void *p) {
 }
 
 /*
- * offset2addr - restore the offset to address
+ * offset2addr - restore the offset to address, heap is in kseg so the
+ *               32 bits offset is the address
  */
 inline void *offset2addr(int offset)
 {
     if (offset) {
-        return (void *)((long)offset | 0x80000000);
+        return (void *)(unsigned long)((unsigned int)offset | 0x80000000);
     }
     else {
         return NULL;
@@ -136,7 +136,7 @@ static float s_MotorOperatingFlow = MOTOR_INIT_FLOWRATE;
 /** @brief Kalman Low pass filter support for Motor control task. This filter support 3 input
  * sample for Air Flow, O2 Flow and Total Flow. Each input sample use different 
  * filter's coefficients */
-static KALMAN_LPF_t s_MotorLPF;
+static KALMAN_LPF_DIAG_t s_MotorLPF;
 
 /** @brief Motor task time tick, use as reference to perform a real time task */
 static TickType_t s_MotorTaskWakeTime;
@@ -215,7 +215,7 @@ void MotorTask_Inititalize(void) {
 //    PC_Monitor_Initialize();
     
     //initialize filters
-    KalmanLPF_Initialize(&s_MotorLPF);
+    KalmanLPF_DiagInitialize(&s_MotorLPF, false);
     
     //initialize Flow controller
     FlowController_Initialize();
@@ -695,13 +695,13 @@ bool MotorTask_Operate() {
     //get total flow
     totalFlow = airFlow + o2Flow;
     //bypass filter
-    double zData[Mobs] = {totalFlow, airFlow, o2Flow};
-    KalmanLPF_Step(&s_MotorLPF, zData);
+    float zData[Mobs] = {totalFlow, airFlow, o2Flow};
+    KalmanLPF_DiagStep(&s_MotorLPF, zData);
 
     //update local variables 
-    s_TotalFlow = KalmanLPF_GetX(&s_MotorLPF, 0);
-    s_AirFlow = KalmanLPF_GetX(&s_MotorLPF, 1);
-    s_O2Flow = KalmanLPF_GetX(&s_MotorLPF, 2);
+    s_TotalFlow = KalmanLPF_DiagGetX(&s_MotorLPF, 0);
+    s_AirFlow = KalmanLPF_DiagGetX(&s_MotorLPF, 1);
+    s_O2Flow = KalmanLPF_DiagGetX(&s_MotorLPF, 2);
     
     
     switch (s_MotorOperMode) {
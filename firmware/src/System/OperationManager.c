@@ -16,6 +16,10 @@
 #include "Cradle.h"
 //#include "Audio.h"
 #include "../Gui/PowerOffScreen.h"
+#include "../Gui/GuiOperation.h"
+
+/** @brief Define max time (in ms) wait for GUI task to write settings and logs at power off */
+#define OPERATION_MGR_FLUSH_WAIT_MS     (2000)
 
 static void _SYS_DelayUs(uint16_t microseconds);
 
@@ -139,7 +143,9 @@ void OperationMgr_PowerOffSystem()
     //turn off cradle pump
     cradle_SetWaterSupplyOnOff(eOff);
     //Watchdog_Disable();
-    // Deinit file system
+    // Deinit file system, pending settings and logs are written by GUI task
+    if (GUI_FlushStorage(OPERATION_MGR_FLUSH_WAIT_MS) == false)
+        SYS_PRINT("\nSettings and logs not flushed\n");
     file_CloseFileOnSQIFlash();
     LogInterface_DeInitDebugLogFile();
 
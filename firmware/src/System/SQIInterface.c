@@ -5,11 +5,15 @@
 #include "SQIInterface.h"
 #include "Gui/GuiInterface.h"
 #include "Gui/GuiDefine.h"
+#include "Gui/File.h"
 #include "crc.h"
+#include "AssetBundle.h"
 #include "mm.h"
 
-#define MAX_FILE_DATA_BUFFER      200*1024//(115*1024) // The biggest file --> Video: 100kb + 2bytes CRC
+#define SQI_COPY_CHUNK_SIZE      (32*1024) // Size of each chunk when copying file to SQI flash
 #define MAX_FILE_NAME            (50)
+#define SQI_LOAD_CHUNK_SIZE      (16*1024) // Size of each read when loading asset from SQI flash
+#define SQI_CRC_SIZE             (2)     // CRC16 appended at the end of each asset file
 
 extern bool g_isMountSQI;
 
@@ -19,8 +23,8 @@ SYS_FS_HANDLE graphicBinFile;
 
 SYS_FS_HANDLE s_alarmImageHandle;
 
-__attribute__((section(".ddr_data"), space(prog))) uint8_t clone_buffer[MAX_FILE_DATA_BUFFER];
-__attribute__((section(".ddr_data"), space(prog))) uint8_t check_buffer[MAX_FILE_DATA_BUFFER];
+__attribute__((section(".ddr_data"), space(prog))) uint8_t clone_buffer[SQI_COPY_CHUNK_SIZE];
+__attribute__((section(".ddr_data"), space(prog))) uint8_t check_buffer[SQI_COPY_CHUNK_SIZE];
 
 //uint8_t* clone_buffer;
 //uint8_t* check_buffer;
@@ -65,10 +69,41 @@ void SQIInterface_Mount(void)
     return;
 }
 
-/** @brief Read and check CRC file in SQI flash
- *  @param [in] uint8_t *buffer : buffer data
+/** @brief Read data from current position of a file straight into destination
+ *  buffer. Data is read in SQI_LOAD_CHUNK_SIZE chunks and CRC is updated on the fly
+ *  @param [in] SYS_FS_HANDLE handle : opened file
+ *  @param [in] uint8_t *buffer : destination buffer, at least size bytes
+ *  @param [in] int32_t size : number of bytes to read
+ *  @param [out] unsigned short *crc : running CRC, updated
+ *  @return bool: true if all data is read
+ */
+static bool SQIInterface_ReadChunks(SYS_FS_HANDLE handle, uint8_t *buffer, int32_t size, unsigned short *crc)
+{
+    int32_t remain = size;
+    uint32_t chunkSize;
+
+    while (remain > 0)
+    {
+        chunkSize = (remain > SQI_LOAD_CHUNK_SIZE) ? SQI_LOAD_CHUNK_SIZE : remain;
+        if (SYS_FS_FileRead(handle, buffer, chunkSize) != chunkSize)
+        {
+            SYS_PRINT("\n There was an error while reading the file \n");
+            return false;
+        }
+        *crc = crc_Update(*crc, buffer, chunkSize);
+        buffer += chunkSize;
+        remain -= chunkSize;
+    }
+    return true;
+}
+
+/** @brief Read file in SQI flash straight into destination buffer and check CRC.
+ *  The 2 bytes CRC at the end of file are read last and the file is only
+ *  rejected after the final chunk
+ *  @param [in] uint8_t *buffer : destination buffer, at least fileSize bytes
+ *  @param [in] int32_t fileSize : size of data without CRC
  *  @param [out] None
- *  @return None
+ *  @return bool: true if file is read and CRC is good
  */
 static bool SQIInterface_ReadAndCheckCRC(uint8_t *buffer, int32_t fileSize)
 {
@@ -76,29 +111,32 @@ static bool SQIInterface_ReadAndCheckCRC(uint8_t *buffer, int32_t fileSize)
     bool res = false;
 
     int32_t fileSize_CRC;
+    uint8_t crcBytes[SQI_CRC_SIZE];
+    unsigned short temp = CRC16_START_VAL;
     
     fileSize_CRC = SYS_FS_FileSize(g_sqiHandle);
-    if (fileSize != fileSize_CRC - 2)
+    if (fileSize != fileSize_CRC - SQI_CRC_SIZE)
     {
         SYS_PRINT("\n SQIInterface_ReadAndCheckCRC -  fileSize vs fileSize_CRC = %d %d \n", fileSize, fileSize_CRC);
+        SYS_FS_FileClose(g_sqiHandle);
         return false;
     }
-        
-        
-    if (SYS_FS_FileRead(g_sqiHandle, buffer, fileSize_CRC) == -1)
+    
+    if (SQIInterface_ReadChunks(g_sqiHandle, buffer, fileSize, &temp) == false)
+    {
+        SYS_FS_FileClose(g_sqiHandle);
+        return false;
+    }
+    
+    //read CRC at the end of file
+    if (SYS_FS_FileRead(g_sqiHandle, crcBytes, SQI_CRC_SIZE) != SQI_CRC_SIZE)
     {
-        /* There was an error while reading the file. Close the file
-         * and error out. */
         SYS_PRINT("\n There was an error while reading the file \n");
         SYS_FS_FileClose(g_sqiHandle);
-
         return false;
     }
 
-
-    unsigned short temp;
-
-    temp = crc_crc16ccitt(CRC16_START_VAL, fileSize_CRC, buffer);
+    temp = crc_Update(temp, crcBytes, SQI_CRC_SIZE);
     if (temp == 0)
     {
 //        SYS_PRINT("\n crc image good ");
@@ -127,8 +165,62 @@ static bool SQIInterface_ReadAndCheckCRC(uint8_t *buffer, int32_t fileSize)
     return res;
 }
 
+/** @brief Get destination buffer of file at index in list file. Video frames
+ *  are loaded to a new buffer from mm_malloc, other assets are loaded to their
+ *  fixed buffer
+ *  @param [in] int i : index in list file
+ *  @param [out] uint8_t ***videoSlot : slot of video frame, NULL for other assets
+ *  @return uint8_t*: destination buffer, NULL if no memory
+ */
+static uint8_t* SQIInterface_GetDestination(int i, uint8_t ***videoSlot)
+{
+    *videoSlot = NULL;
+    if (g_fileList[i].id == eIntroVideoAssetId)
+    {
+        *videoSlot = &introVideoInputData[(uint32_t)g_fileList[i].data];
+    }
+    else if (g_fileList[i].id == eAlarmVideoAssetId)
+    {
+        *videoSlot = &alarmVideoInputData[(uint32_t)g_fileList[i].data];
+    }
+    
+    if (*videoSlot == NULL)
+    {
+        return (uint8_t*)g_fileList[i].data;
+    }
+    if (**videoSlot == NULL)
+    {
+        **videoSlot = (uint8_t*)mm_malloc(g_fileList[i].fileSize);
+    }
+    return **videoSlot;
+}
+
+/** @brief Release video frame buffer of a file failed to load
+ *  @param [in] uint8_t **videoSlot : slot of video frame, NULL for other assets
+ *  @param [out] None
+ *  @return None
+ */
+static void SQIInterface_ReleaseDestination(uint8_t **videoSlot)
+{
+    if (videoSlot != NULL)
+    {
+        mm_free(*videoSlot);
+        *videoSlot = NULL;
+    }
+}
+
+/** @brief Check file on SQI flash at index in list file and load it to its
+ *  destination
+ *  @param [in] int i : index in list file
+ *  @param [out] None
+ *  @return int: 0 if success, else GUI update screen message
+ */
 int SQIInterface_CheckFileOnSQIFlashAtIndex(int i)
 {
+    uint8_t* dest;
+    uint8_t** videoSlot;
+    TickType_t startTick;
+    
     g_sqiHandle = SYS_FS_FileOpen(g_fileList[i].fileName, SYS_FS_FILE_OPEN_READ);
 
     if (g_sqiHandle == SYS_FS_HANDLE_INVALID)
@@ -138,45 +230,141 @@ int SQIInterface_CheckFileOnSQIFlashAtIndex(int i)
         LogInterface_WriteDebugLogFile("SQIInterface_CheckFileOnSQIFlash Failed to open %s \n", g_fileList[i].fileName );
         return eGuiUpdateScreenMessageFileNotFound;
     }
-    else
+    
+    //Get destination of file
+    dest = SQIInterface_GetDestination(i, &videoSlot);
+    if (dest == NULL)
     {
-        if (SQIInterface_ReadAndCheckCRC(clone_buffer, g_fileList[i].fileSize) == false)
+        SYS_PRINT("No buffer to load %s \n", g_fileList[i].fileName);
+        SYS_FS_FileClose(g_sqiHandle);
+        return eGuiUpdateScreenMessageFileInvalid;
+    }
+    
+    startTick = xTaskGetTickCount();
+    if (SQIInterface_ReadAndCheckCRC(dest, g_fileList[i].fileSize) == false)
+    {
+        SYS_PRINT("CRC check failed %s \n", g_fileList[i].fileName);
+        LogInterface_WriteDebugLogFile("SQIInterface_CheckFileOnSQIFlash failed CRC at index %d \n", i);
+        SQIInterface_ReleaseDestination(videoSlot);
+        return eGuiUpdateScreenMessageFileInvalid;
+    }
+    SYS_PRINT("Load %s %d bytes in %d ms \n", g_fileList[i].fileName, g_fileList[i].fileSize,
+              (xTaskGetTickCount() - startTick) * portTICK_PERIOD_MS);
+    
+    return 0;
+}
+
+/** @brief Load file at index in list file from its entry in the opened asset
+ *  bundle (g_sqiHandle) and check CRC
+ *  @param [in] int i : index in list file
+ *  @param [in] const ASSET_BUNDLE_ENTRY_t *entry : entry of file in bundle index
+ *  @param [out] None
+ *  @return int: 0 if success, else GUI update screen message
+ */
+static int SQIInterface_LoadBundleEntry(int i, const ASSET_BUNDLE_ENTRY_t *entry)
+{
+    uint8_t* dest;
+    uint8_t** videoSlot;
+    unsigned short crc = CRC16_START_VAL;
+    
+    if (entry->length != (uint32_t)g_fileList[i].fileSize)
+    {
+        SYS_PRINT("Size of %s in bundle %d, expected %d \n", g_fileList[i].fileName, entry->length, g_fileList[i].fileSize);
+        return eGuiUpdateScreenMessageFileInvalid;
+    }
+    
+    dest = SQIInterface_GetDestination(i, &videoSlot);
+    if (dest == NULL)
+    {
+        SYS_PRINT("No buffer to load %s \n", g_fileList[i].fileName);
+        return eGuiUpdateScreenMessageFileInvalid;
+    }
+    
+    if ((SYS_FS_FileSeek(g_sqiHandle, entry->offset, SYS_FS_SEEK_SET) != (int32_t)entry->offset)
+        || (SQIInterface_ReadChunks(g_sqiHandle, dest, entry->length, &crc) == false)
+        || (crc != entry->crc))
+    {
+        char buff[255];
+        snprintf(buff, sizeof(buff), "SQIInterface_CheckFileOnSQIFlash failed CRC at index %d \n", i);
+        SYS_PRINT("CRC check failed %s \n", g_fileList[i].fileName);
+        LogInterface_WriteDebugLogFile(buff);
+        SQIInterface_ReleaseDestination(videoSlot);
+        return eGuiUpdateScreenMessageFileInvalid;
+    }
+    
+    return 0;
+}
+
+/** @brief Load all files in list file from the opened asset bundle
+ *  (g_sqiHandle). The index is read once, then each file is found by name and
+ *  read from its offset, so there is a single file open for all assets.
+ *  Bundle is closed at the end
+ *  @param [in] None
+ *  @param [out] None
+ *  @return int: 0 if success, else GUI update screen message
+ */
+static int SQIInterface_CheckBundleOnSQIFlash(void)
+{
+    ASSET_BUNDLE_HEADER_t header;
+    ASSET_BUNDLE_ENTRY_t *index = NULL;
+    uint32_t indexSize;
+    int i;
+    int entry = -1;
+    int ret = eGuiUpdateScreenMessageFileInvalid;
+    TickType_t startTick = xTaskGetTickCount();
+    
+    if ((SYS_FS_FileRead(g_sqiHandle, &header, sizeof(header)) != sizeof(header))
+        || (assetBundle_CheckHeader(&header) == false))
+    {
+        SYS_PRINT("Invalid header of %s \n", FILE_NAME_ASSET_BUNDLE);
+        SYS_FS_FileClose(g_sqiHandle);
+        return ret;
+    }
+    
+    indexSize = assetBundle_IndexSize(header.entryCount);
+    index = (ASSET_BUNDLE_ENTRY_t*)mm_malloc(indexSize);
+    if ((index == NULL)
+        || (SYS_FS_FileRead(g_sqiHandle, index, indexSize) != indexSize)
+        || (assetBundle_CheckIndex(&header, index, SYS_FS_FileSize(g_sqiHandle)) == false))
+    {
+        SYS_PRINT("Invalid index of %s \n", FILE_NAME_ASSET_BUNDLE);
+        LogInterface_WriteDebugLogFile("SQIInterface_CheckFileOnSQIFlash invalid bundle index \n");
+        mm_free(index);
+        SYS_FS_FileClose(g_sqiHandle);
+        return ret;
+    }
+    
+    for (i = 0; i < NUMBER_FILE_IMAGE_FONT; i++)
+    {
+        entry = assetBundle_Find(index, header.entryCount, g_fileList[i].fileName, entry + 1);
+        if (entry < 0)
         {
-            SYS_PRINT("CRC check failed %s \n", g_fileList[i].fileName);
-            LogInterface_WriteDebugLogFile("SQIInterface_CheckFileOnSQIFlash failed CRC at index %d \n", i);
-            return eGuiUpdateScreenMessageFileInvalid;
+            char buff[255];
+            snprintf(buff, sizeof(buff), "SQIInterface_CheckFileOnSQIFlash %s not found in bundle \n", g_fileList[i].fileName);
+            SYS_PRINT("%s not found in bundle \n", g_fileList[i].fileName);
+            LogInterface_WriteDebugLogFile(buff);
+            ret = eGuiUpdateScreenMessageFileNotFound;
+            break;
         }
-        else
+        
+        ret = SQIInterface_LoadBundleEntry(i, &index[entry]);
+        //double check in case CRC failed at first
+        if (ret == eGuiUpdateScreenMessageFileInvalid)
         {
-            if (g_fileList[i].id == eIntroVideoAssetId)
-            {
-                introVideoInputData[(uint32_t)g_fileList[i].data] = (uint8_t*)mm_malloc(g_fileList[i].fileSize);
-                memcpy(introVideoInputData[(uint32_t)g_fileList[i].data], clone_buffer, g_fileList[i].fileSize);
-            }
-            else if (g_fileList[i].id == eAlarmVideoAssetId)
-            {
-                alarmVideoInputData[(uint32_t)g_fileList[i].data] = (uint8_t*)mm_malloc(g_fileList[i].fileSize);
-                memcpy(alarmVideoInputData[(uint32_t)g_fileList[i].data], clone_buffer, g_fileList[i].fileSize);
-            }
-            else if (g_fileList[i].id == eAudioLow260msAssetId)
-            {
-                memcpy(audioSquareWave260ms_Low, clone_buffer, g_fileList[i].fileSize);
-            }
-            else if (g_fileList[i].id == eAudioMedium260msAssetId)
-            {
-                memcpy(audioSquareWave260ms_Medium, clone_buffer, g_fileList[i].fileSize);
-            }
-            else if (g_fileList[i].id == eAudioHigh210msAssetId)
-            {
-                memcpy(audioSquareWave210ms_High, clone_buffer, g_fileList[i].fileSize);
-            }
-            else
-            {
-                memcpy(g_fileList[i].data, clone_buffer, g_fileList[i].fileSize);
-            }
+            ret = SQIInterface_LoadBundleEntry(i, &index[entry]);
+        }
+        if (ret != 0)
+        {
+            break;
         }
     }
-    return 0;
+    
+    mm_free(index);
+    SYS_FS_FileClose(g_sqiHandle);
+    SYS_PRINT("Load %d assets from %s in %d ms \n", i, FILE_NAME_ASSET_BUNDLE,
+              (xTaskGetTickCount() - startTick) * portTICK_PERIOD_MS);
+    
+    return ret;
 }
 
 /** @brief Does the sqi flash check have the file yet
@@ -191,28 +379,37 @@ void SQIInterface_CheckFileOnSQIFlash(void)
     if (g_isMountSQI == true)
     {
         if (g_sqiHandle == NULL)
-        {            
-            for (i = 0; i < NUMBER_FILE_IMAGE_FONT; i++)
+        {
+            //assets are in one bundle, or in one file each for an older upgrade
+            g_sqiHandle = SYS_FS_FileOpen(FILE_NAME_ASSET_BUNDLE, SYS_FS_FILE_OPEN_READ);
+            if (g_sqiHandle != SYS_FS_HANDLE_INVALID)
             {
-                ret = SQIInterface_CheckFileOnSQIFlashAtIndex(i);
-                
-                //double check in case CRC failed at first
-                if (ret == eGuiUpdateScreenMessageFileInvalid )
-                {                   
+                ret = SQIInterface_CheckBundleOnSQIFlash();
+            }
+            else
+            {
+                for (i = 0; i < NUMBER_FILE_IMAGE_FONT; i++)
+                {
                     ret = SQIInterface_CheckFileOnSQIFlashAtIndex(i);
+                
+                    //double check in case CRC failed at first
                     if (ret == eGuiUpdateScreenMessageFileInvalid )
+                    {                   
+                        ret = SQIInterface_CheckFileOnSQIFlashAtIndex(i);
+                        if (ret == eGuiUpdateScreenMessageFileInvalid )
+                        {
+                            break;
+                        }
+                        break; //FIXME : this to test if double check CRC work
+                    }
+                    else if (ret == eGuiUpdateScreenMessageFileNotFound)
                     {
                         break;
                     }
-                    break; //FIXME : this to test if double check CRC work
-                }
-                else if (ret == eGuiUpdateScreenMessageFileNotFound)
-                {
-                    break;
-                }
-                else
-                {
+                    else
+                    {
                     
+                    }
                 }
             }
             if ( ret == 0 )
@@ -222,6 +419,8 @@ void SQIInterface_CheckFileOnSQIFlash(void)
             else
             {
                 SYS_PRINT("SQIInterface_CheckFileOnSQIFlash failed \n");
+                //assets do not match the manifest any more, next upgrade copies all of them
+                SYS_FS_FileDirectoryRemove(FILE_NAME_ASSET_MANIFEST);
                 uint32_t totalSector, freeSector;
                 if (SYS_FS_DriveSectorGet("mnt/SQIFlash", &totalSector, &freeSector) != SYS_FS_RES_SUCCESS){
                     SYS_PRINT("SYS_FS_DriveSectorGet Failed \n");
@@ -293,6 +492,50 @@ void SQIInterface_CopyFileErrorHandler(SYS_FS_HANDLE fileHandle, FCPY_ERROR_t er
     return;
 }
 
+/**
+ * @brief Check the part of destination file left by an interrupted copy.
+ *        Chunks of destination are compared by CRC with the same chunks of
+ *        source until the first mismatch
+ * @param [in] readFileHandle Handle of source file
+ * @param [in] writeFileHandle Handle of destination file
+ * @param [in] fileSize Size of source file
+ * @return int32_t Offset where copy can be resumed, -1 if read error
+ */
+static int32_t SQIInterface_CopyFileResumeOffset(SYS_FS_HANDLE readFileHandle,
+                                                 SYS_FS_HANDLE writeFileHandle,
+                                                 int32_t fileSize)
+{
+    int32_t offset = 0;
+    int32_t writtenSize = SYS_FS_FileSize(writeFileHandle);
+
+    if (writtenSize > fileSize)
+    {
+        writtenSize = fileSize;
+    }
+
+    while (offset + SQI_COPY_CHUNK_SIZE <= writtenSize)
+    {
+        if ((SYS_FS_FileRead(readFileHandle, clone_buffer, SQI_COPY_CHUNK_SIZE) != SQI_COPY_CHUNK_SIZE)
+            || (SYS_FS_FileRead(writeFileHandle, check_buffer, SQI_COPY_CHUNK_SIZE) != SQI_COPY_CHUNK_SIZE))
+        {
+            return -1;
+        }
+        if (crc_Update(CRC16_START_VAL, clone_buffer, SQI_COPY_CHUNK_SIZE)
+            != crc_Update(CRC16_START_VAL, check_buffer, SQI_COPY_CHUNK_SIZE))
+        {
+            break;
+        }
+        offset += SQI_COPY_CHUNK_SIZE;
+    }
+
+    if (offset != 0)
+    {
+        SYS_PRINT("Resume copy at %d / %d \n", offset, fileSize);
+    }
+
+    return offset;
+}
+
 /**
  * @brief Single file copy from SD-Card to SQI memory
  * @param [in] readFileName Name of file desired to copy
@@ -302,21 +545,23 @@ void SQIInterface_CopyFileErrorHandler(SYS_FS_HANDLE fileHandle, FCPY_ERROR_t er
  * @retval FILECOPY_SUCCESS File is success copied
  * @retval FILECOPY_ERROR   An error occur while copying file, some message will
  *                          be printed to console in error case.
+ * @retval FILECOPY_REQUIRE_RECOVERY Data read back from destination mismatch
  */
 
-/* Note: This function assume the desired file was not existed in destination path
- *       Please check file existed before calling this function.
- *       In case of desired file is already existed, it will be overwritten.
+/* Note: File is copied in SQI_COPY_CHUNK_SIZE chunks, so there is no limit of
+ *       file size. Each chunk is written, read back to check_buffer and
+ *       verified by CRC before the next chunk is read.
+ *       In case of desired file is already existed (ex: copy was interrupted by
+ *       power loss), the chunks already matching source are kept and copy is
+ *       resumed from the first mismatch chunk.
  */
 FILECOPYSTATUS_t SQIInterface_CopyFile(
                                        const char *readFileName, const char* readFilePath,
                                        const char *writeFileName, const char* writeFilePath)
 {
-//    clone_buffer = mm_malloc(MAX_FILE_DATA_BUFFER);
-//    check_buffer = mm_malloc(MAX_FILE_DATA_BUFFER);
-    
-    
-    int writeFileSize, readFileSize, fileSize;
+    int32_t fileSize, offset;
+    uint32_t chunkSize;
+    unsigned short chunkCRC;
     SYS_FS_HANDLE readFileHandle, writeFileHandle;
 
     /// Setting source path
@@ -327,107 +572,114 @@ FILECOPYSTATUS_t SQIInterface_CopyFile(
         return FILECOPY_ERROR;
     }
 
-    /// Open source file and clone data to buffer
+    /// Open source file
     readFileHandle = SYS_FS_FileOpen(readFileName, SYS_FS_FILE_OPEN_READ);
     if (SYS_FS_HANDLE_INVALID == readFileHandle)
     {
-        SYS_PRINT("Open source file and clone data to buffer \n");
+        SYS_PRINT("Open source file \n");
         SQIInterface_CopyFileErrorHandler(readFileHandle, FCPY_SYS_FS_ERROR);
         return FILECOPY_ERROR;
     }
 
     /// Double check file size for ensuring data transfer size mismatch
     fileSize = SYS_FS_FileSize(readFileHandle);
-    if (fileSize > MAX_FILE_DATA_BUFFER)
-    {
-        /// - If buffer prepare for cache data is not enough throw internal error
-        SQIInterface_CopyFileErrorHandler(readFileHandle, FCPY_BUFFER_SIZE_INTERNAL_ERROR);
-        return FILECOPY_ERROR;
-    }
-    else if (fileSize <= 0)
+    if (fileSize <= 0)
     {
         /// - If source file error, print message to console and return error
         SQIInterface_CopyFileErrorHandler(readFileHandle, FCPY_SOURCE_FILE_ERROR);
         return FILECOPY_ERROR;
     }
-    else
-    {
-        /// - If source file contain data, start cloning to buffer
-        readFileSize = SYS_FS_FileRead(readFileHandle,
-                                       clone_buffer, sizeof (clone_buffer));
-        if (fileSize != readFileSize)
-        {
-            SQIInterface_CopyFileErrorHandler(readFileHandle, FCPY_FILE_SIZE_INTERNAL_ERROR);
-            return FILECOPY_ERROR;
-        }
-    }
-    /// Clone data done, close source file
-    SYS_FS_FileClose(readFileHandle);
 
     /*-----------------------------------------------------------------------*/
-    /// Next, open desired file in destination
+    /// Next, open desired file in destination, keep its content if existed
     if (SYS_FS_RES_SUCCESS != SYS_FS_CurrentDriveSet(writeFilePath))
     {
         SYS_PRINT("Next, open desired file in destination \n");
+        SYS_FS_FileClose(readFileHandle);
         SQIInterface_CopyFileErrorHandler(NULL, FCPY_SYS_FS_ERROR);
         return FILECOPY_ERROR;
     }
-    writeFileHandle = SYS_FS_FileOpen(writeFileName, SYS_FS_FILE_OPEN_WRITE);
+    writeFileHandle = SYS_FS_FileOpen(writeFileName, SYS_FS_FILE_OPEN_APPEND_PLUS);
     if (SYS_FS_HANDLE_INVALID == writeFileHandle)
     {
         SYS_PRINT("write desired file in destination \n");
+        SYS_FS_FileClose(readFileHandle);
         SQIInterface_CopyFileErrorHandler(writeFileHandle, FCPY_SYS_FS_ERROR);
         return FILECOPY_ERROR;
     }
-    /// Write data to file, with number of bytes read
-    writeFileSize = SYS_FS_FileWrite(writeFileHandle, clone_buffer, readFileSize);
-    if (writeFileSize <= 0)
+
+    /*-----------------------------------------------------------------------*/
+    /// Find where to resume an interrupted copy
+    file_Seek(writeFileHandle, 0, SYS_FS_SEEK_SET);
+    offset = SQIInterface_CopyFileResumeOffset(readFileHandle, writeFileHandle, fileSize);
+    if (offset < 0)
     {
+        SYS_FS_FileClose(readFileHandle);
         SQIInterface_CopyFileErrorHandler(writeFileHandle, FCPY_FILE_SIZE_INTERNAL_ERROR);
         return FILECOPY_ERROR;
     }
+    file_Seek(readFileHandle, offset, SYS_FS_SEEK_SET);
 
-    /// Sync file
-    if (SYS_FS_RES_SUCCESS != SYS_FS_FileSync(writeFileHandle))
+    /// Copy data chunk by chunk
+    while (offset < fileSize)
     {
-        // Cannot sync file
-        SYS_PRINT("Cannot sync file \n");
-        SQIInterface_CopyFileErrorHandler(writeFileHandle, FCPY_SYS_FS_ERROR);
-        return FILECOPY_ERROR;
-    }
-    /// Close write file
-    SYS_FS_FileClose(writeFileHandle);
+        chunkSize = (fileSize - offset > SQI_COPY_CHUNK_SIZE) ? SQI_COPY_CHUNK_SIZE : (fileSize - offset);
 
-    /*-----------------------------------------------------------------------*/
-    /// Validate data copied
-    /// - Open recent written file
-    readFileHandle = SYS_FS_FileOpen(writeFileName, SYS_FS_FILE_OPEN_READ);
-    if (SYS_FS_HANDLE_INVALID == readFileHandle)
-    {
-        SYS_PRINT("Open recent written file \n");
-        SQIInterface_CopyFileErrorHandler(readFileHandle, FCPY_SYS_FS_ERROR);
-        return FILECOPY_ERROR;
-    }
-    /// - Clone data to check buffer
-    readFileSize = SYS_FS_FileRead(readFileHandle, check_buffer, sizeof (check_buffer));
-    if (readFileSize != writeFileSize)
-    {
-        SQIInterface_CopyFileErrorHandler(readFileHandle, FCPY_FILE_SIZE_INTERNAL_ERROR);
-        return FILECOPY_ERROR;
+        /// - Read chunk from source
+        if (SYS_FS_FileRead(readFileHandle, clone_buffer, chunkSize) != chunkSize)
+        {
+            SYS_FS_FileClose(writeFileHandle);
+            SQIInterface_CopyFileErrorHandler(readFileHandle, FCPY_FILE_SIZE_INTERNAL_ERROR);
+            return FILECOPY_ERROR;
+        }
+        chunkCRC = crc_Update(CRC16_START_VAL, clone_buffer, chunkSize);
+
+        /// - Write chunk to destination and sync it
+        file_Seek(writeFileHandle, offset, SYS_FS_SEEK_SET);
+        if (SYS_FS_FileWrite(writeFileHandle, clone_buffer, chunkSize) != chunkSize)
+        {
+            SYS_FS_FileClose(readFileHandle);
+            SQIInterface_CopyFileErrorHandler(writeFileHandle, FCPY_FILE_SIZE_INTERNAL_ERROR);
+            return FILECOPY_ERROR;
+        }
+        if (SYS_FS_RES_SUCCESS != SYS_FS_FileSync(writeFileHandle))
+        {
+            // Cannot sync file
+            SYS_PRINT("Cannot sync file \n");
+            SYS_FS_FileClose(readFileHandle);
+            SQIInterface_CopyFileErrorHandler(writeFileHandle, FCPY_SYS_FS_ERROR);
+            return FILECOPY_ERROR;
+        }
+
+        /// - Read back chunk written and compare CRC
+        file_Seek(writeFileHandle, offset, SYS_FS_SEEK_SET);
+        if (SYS_FS_FileRead(writeFileHandle, check_buffer, chunkSize) != chunkSize)
+        {
+            SYS_FS_FileClose(readFileHandle);
+            SQIInterface_CopyFileErrorHandler(writeFileHandle, FCPY_FILE_SIZE_INTERNAL_ERROR);
+            return FILECOPY_ERROR;
+        }
+        if (crc_Update(CRC16_START_VAL, check_buffer, chunkSize) != chunkCRC)
+        {
+            /// - If data read write mismatch, a require recovery signal return
+            SYS_FS_FileClose(readFileHandle);
+            SQIInterface_CopyFileErrorHandler(writeFileHandle, FCPY_FILE_DATA_MISMATCH);
+            return FILECOPY_REQUIRE_RECOVERY;
+        }
+
+        offset += chunkSize;
     }
-    /// - Compare data read and written
-    if (memcmp(clone_buffer, check_buffer, readFileSize) != 0)
+
+    /// Cut data left from an older, bigger file
+    if (SYS_FS_FileSize(writeFileHandle) > fileSize)
     {
-        /// - If data read write mismatch, a require recovery signal return
-        SQIInterface_CopyFileErrorHandler(readFileHandle, FCPY_FILE_DATA_MISMATCH);
-        return FILECOPY_REQUIRE_RECOVERY;
+        file_Seek(writeFileHandle, fileSize, SYS_FS_SEEK_SET);
+        SYS_FS_FileTruncate(writeFileHandle);
     }
-    /// - Close file validated
-    SYS_FS_FileClose(readFileHandle);
 
-    
-//    mm_free(clone_buffer);
-//    mm_free(check_buffer);
+    /// Copy done, close files
+    SYS_FS_FileClose(readFileHandle);
+    SYS_FS_FileClose(writeFileHandle);
     
     return FILECOPY_SUCCESS;
 }
@@ -27,6 +27,8 @@
 #include "SystemInterface.h"
 #include "Watchdog.h"
 #include "AlarmTask.h"
+#include "AssetManifest.h"
+#include "crc.h"
 
 /** @brief Define flag upgrade */
 #define UPGRADE_DIRNAME      "Upgrade"
@@ -72,6 +74,33 @@ const char FILE_LIST_OF_UPDATE[] =  "/mnt/USB/Upgrade/update_list.jflo";
 __attribute__((section(".ddr_data"), space(prog))) char listOfUpdateFiles[1024][50] = {[ 0 ... 1023 ] = ""};
 uint16_t noOfUpdateFiles = 0;
 
+/** @brief Define manifest of assets in upgrade package */
+#define FILE_MANIFEST_OF_UPDATE         "/mnt/USB/Upgrade/update_manifest.jflo"
+
+/** @brief Define name of manifest in upgrade package */
+#define FILE_NAME_MANIFEST_OF_UPDATE    "update_manifest.jflo"
+
+/** @brief Define suffix of an asset copied to SQI flash but not committed yet */
+#define UPGRADE_STAGED_SUFFIX           ".new"
+
+/** @brief Define size of read buffer used to check assets copied to SQI flash */
+#define UPGRADE_CHECK_CHUNK_SIZE        (16*1024)
+
+/** @brief Define sector size of SQI flash file system, unit of SYS_FS_DriveSectorGet */
+#define UPGRADE_SQI_SECTOR_SIZE         (512)
+
+/** @brief Define cluster size of SQI flash file system, a file takes a whole number of clusters */
+#define UPGRADE_SQI_CLUSTER_SIZE        (4096)
+
+// manifest of upgrade package and manifest of assets on SQI flash
+__attribute__((section(".ddr_data"), space(prog))) ASSET_MANIFEST_ENTRY_t s_usbManifest[ASSET_MANIFEST_MAX_ENTRY];
+__attribute__((section(".ddr_data"), space(prog))) ASSET_MANIFEST_ENTRY_t s_sqiManifest[ASSET_MANIFEST_MAX_ENTRY];
+static int s_usbManifestCount = 0;
+static int s_sqiManifestCount = 0;
+
+// flag of assets in upgrade package to copy, new or changed
+static bool s_isAssetChanged[ASSET_MANIFEST_MAX_ENTRY];
+
 // Just for test
 uint32_t tick;
 uint32_t UpdateTime;
@@ -133,6 +162,358 @@ void softwareUpgrade_Init()
     return;
 }
 
+/** @brief Read a manifest file
+ *  @param [in] const char *path : manifest path
+ *  @param [out] ASSET_MANIFEST_ENTRY_t *entries : entries of manifest
+ *  @return int: number of entries, -1 if manifest is not found or invalid
+ */
+static int softwareUpgrade_ReadManifest(const char *path, ASSET_MANIFEST_ENTRY_t *entries)
+{
+    SYS_FS_HANDLE fileHandle;
+    int32_t fileSize;
+    char *buffer;
+    int count = -1;
+
+    fileHandle = SYS_FS_FileOpen(path, SYS_FS_FILE_OPEN_READ);
+    if (fileHandle == SYS_FS_HANDLE_INVALID)
+    {
+        return -1;
+    }
+
+    fileSize = SYS_FS_FileSize(fileHandle);
+    buffer = (fileSize > 0) ? (char*)mm_malloc(fileSize + 1) : NULL;
+    if (buffer != NULL)
+    {
+        if (SYS_FS_FileRead(fileHandle, buffer, fileSize) == fileSize)
+        {
+            buffer[fileSize] = '\0';
+            count = assetManifest_Parse(buffer, entries, ASSET_MANIFEST_MAX_ENTRY);
+        }
+        mm_free(buffer);
+    }
+    SYS_FS_FileClose(fileHandle);
+
+    if (count < 0)
+    {
+        SYS_PRINT("Error : invalid manifest %s \n", path);
+    }
+    return count;
+}
+
+/** @brief Check size and CRC-32 of an asset copied to SQI flash against its
+ *  manifest entry
+ *  @param [in] const char *fileName : file on SQI flash
+ *  @param [in] const ASSET_MANIFEST_ENTRY_t *entry : manifest entry
+ *  @param [out] None
+ *  @return bool: true if file matches
+ */
+static bool softwareUpgrade_CheckAsset(const char *fileName, const ASSET_MANIFEST_ENTRY_t *entry)
+{
+    SYS_FS_HANDLE fileHandle;
+    uint8_t *buffer;
+    uint32_t remain = entry->size;
+    uint32_t chunkSize;
+    uint32_t crc = CRC32_START_VAL;
+
+    SYS_FS_CurrentDriveSet(SYS_FS_MEDIA_IDX0_MOUNT_NAME_VOLUME_IDX0);
+    fileHandle = SYS_FS_FileOpen(fileName, SYS_FS_FILE_OPEN_READ);
+    if (fileHandle == SYS_FS_HANDLE_INVALID)
+    {
+        return false;
+    }
+    if ((uint32_t)SYS_FS_FileSize(fileHandle) != entry->size)
+    {
+        SYS_FS_FileClose(fileHandle);
+        return false;
+    }
+
+    buffer = (uint8_t*)mm_malloc(UPGRADE_CHECK_CHUNK_SIZE);
+    while ((buffer != NULL) && (remain > 0))
+    {
+        chunkSize = (remain > UPGRADE_CHECK_CHUNK_SIZE) ? UPGRADE_CHECK_CHUNK_SIZE : remain;
+        if (SYS_FS_FileRead(fileHandle, buffer, chunkSize) != chunkSize)
+        {
+            break;
+        }
+        crc = crc_Crc32Update(crc, buffer, chunkSize);
+        remain -= chunkSize;
+    }
+    mm_free(buffer);
+    SYS_FS_FileClose(fileHandle);
+
+    return (remain == 0) && (crc == entry->crc);
+}
+
+/** @brief Get name of an asset copied to SQI flash but not committed yet
+ *  @param [in] const char *fileName : asset name
+ *  @param [out] char *stagedName : staged name, ASSET_MANIFEST_NAME_SIZE + sizeof(UPGRADE_STAGED_SUFFIX) bytes
+ *  @return None
+ */
+static void softwareUpgrade_StagedName(char *stagedName, const char *fileName)
+{
+    strcpy(stagedName, fileName);
+    strcat(stagedName, UPGRADE_STAGED_SUFFIX);
+}
+
+/** @brief Remove assets left under the staged name by an interrupted upgrade,
+ *  they are never used and may not be in the new package
+ *  @param [in] None
+ *  @param [out] None
+ *  @return None
+ */
+static void softwareUpgrade_RemoveStagedAssets(void)
+{
+    SYS_FS_HANDLE dirHandle;
+    SYS_FS_FSTAT stat;
+    char longFileName[ASSET_MANIFEST_NAME_SIZE + sizeof(UPGRADE_STAGED_SUFFIX)];
+    char fileName[ASSET_MANIFEST_NAME_SIZE + sizeof(UPGRADE_STAGED_SUFFIX)];
+    size_t length;
+    bool isFound = true;
+
+    SYS_FS_CurrentDriveSet(SYS_FS_MEDIA_IDX0_MOUNT_NAME_VOLUME_IDX0);
+    //directory is closed before each remove, so search restarts from first entry
+    while (isFound)
+    {
+        isFound = false;
+        dirHandle = SYS_FS_DirOpen(SYS_FS_MEDIA_IDX0_MOUNT_NAME_VOLUME_IDX0);
+        if (dirHandle == SYS_FS_HANDLE_INVALID)
+        {
+            return;
+        }
+        stat.lfname = longFileName;
+        stat.lfsize = sizeof(longFileName);
+        while ((SYS_FS_DirRead(dirHandle, &stat) == SYS_FS_RES_SUCCESS) && (stat.fname[0] != '\0'))
+        {
+            strncpy(fileName, (longFileName[0] != '\0') ? longFileName : stat.fname, sizeof(fileName) - 1);
+            fileName[sizeof(fileName) - 1] = '\0';
+            length = strlen(fileName);
+            if ((length > strlen(UPGRADE_STAGED_SUFFIX))
+                && (strcmp(&fileName[length - strlen(UPGRADE_STAGED_SUFFIX)], UPGRADE_STAGED_SUFFIX) == 0))
+            {
+                isFound = true;
+                break;
+            }
+            longFileName[0] = '\0';
+        }
+        SYS_FS_DirClose(dirHandle);
+        if (isFound)
+        {
+            SYS_PRINT("Remove %s \n", fileName);
+            if (SYS_FS_FileDirectoryRemove(fileName) != SYS_FS_RES_SUCCESS)
+            {
+                return;
+            }
+        }
+    }
+    return;
+}
+
+/** @brief Compare manifest of upgrade package with manifest of assets on SQI
+ *  flash and flag new and changed assets. Changed assets are staged next to the
+ *  ones in use, so the upgrade falls back to formatting SQI flash and copying
+ *  all assets of the manifest (as with update list) when there is no manifest on
+ *  SQI flash (last upgrade was a full one, or assets failed to load) or when
+ *  free space is not enough to stage changed assets
+ *  @param [in] None
+ *  @param [out] bool *isCopyAll : true if all assets must be copied after format
+ *  @return bool: true if manifest of upgrade package is valid and its assets are on USB
+ */
+static bool softwareUpgrade_GetManifestUpdate(bool *isCopyAll)
+{
+    int i;
+    int j = -1;
+    uint32_t changedBytes = 0;
+    uint32_t skippedBytes = 0;
+    uint32_t stagedBytes = 0;
+    uint32_t totalSector, freeSector;
+
+    *isCopyAll = false;
+
+    guiInterface_SendEvent(eGuiUpdateScreenMessageCheckingAsset, 0);
+
+    s_usbManifestCount = softwareUpgrade_ReadManifest(FILE_MANIFEST_OF_UPDATE, s_usbManifest);
+    if (s_usbManifestCount <= 0)
+    {
+        return false;
+    }
+
+    SYS_FS_CurrentDriveSet(SYS_FS_MEDIA_IDX0_MOUNT_NAME_VOLUME_IDX0);
+    s_sqiManifestCount = softwareUpgrade_ReadManifest(FILE_NAME_ASSET_MANIFEST, s_sqiManifest);
+    if (s_sqiManifestCount < 0)
+    {
+        SYS_PRINT("No manifest on SQI, format and copy all assets \n");
+        s_sqiManifestCount = 0;
+        *isCopyAll = true;
+    }
+
+    for (i = 0; i < s_usbManifestCount; i++)
+    {
+        j = assetManifest_Find(s_sqiManifest, s_sqiManifestCount, s_usbManifest[i].name, j + 1);
+        s_isAssetChanged[i] = (j < 0) || !assetManifest_IsSame(&s_usbManifest[i], &s_sqiManifest[j]);
+        if (s_isAssetChanged[i])
+        {
+            if (USBInterface_Search(UPGRADE_DIR, s_usbManifest[i].name) != SYS_FS_RES_SUCCESS)
+            {
+                SYS_PRINT("Error : File not found [%d] %s \n", i, s_usbManifest[i].name);
+                return false;
+            }
+            changedBytes += s_usbManifest[i].size;
+            stagedBytes += (s_usbManifest[i].size + UPGRADE_SQI_CLUSTER_SIZE - 1) / UPGRADE_SQI_CLUSTER_SIZE * UPGRADE_SQI_CLUSTER_SIZE;
+        }
+        else
+        {
+            skippedBytes += s_usbManifest[i].size;
+        }
+    }
+
+    if (*isCopyAll == false)
+    {
+        //staged assets of an interrupted upgrade take space and are copied again
+        softwareUpgrade_RemoveStagedAssets();
+        //new manifest is staged too
+        stagedBytes += UPGRADE_SQI_CLUSTER_SIZE;
+        if (SYS_FS_DriveSectorGet("mnt/SQIFlash", &totalSector, &freeSector) != SYS_FS_RES_SUCCESS)
+        {
+            SYS_PRINT("SYS_FS_DriveSectorGet Failed \n");
+            *isCopyAll = true;
+        }
+        else if ((uint64_t)freeSector * UPGRADE_SQI_SECTOR_SIZE < stagedBytes)
+        {
+            SYS_PRINT("Free %u bytes, %u bytes to stage, format and copy all assets \n",
+                      freeSector * UPGRADE_SQI_SECTOR_SIZE, stagedBytes);
+            *isCopyAll = true;
+        }
+    }
+
+    if (*isCopyAll == true)
+    {
+        //copy all assets of manifest as the ones of update list
+        for (i = 0; i < s_usbManifestCount; i++)
+        {
+            strcpy(listOfUpdateFiles[i], s_usbManifest[i].name);
+        }
+        noOfUpdateFiles = s_usbManifestCount;
+        s_sqiManifestCount = 0;
+    }
+
+    SYS_PRINT("Assets: %d, copy %u bytes, skip %u bytes \n", s_usbManifestCount, changedBytes, skippedBytes);
+    return true;
+}
+
+/** @brief Copy manifest of upgrade package to SQI flash, under the staged name
+ *  then renamed, so manifest on SQI is either the old one, none or the new one
+ *  @param [in] None
+ *  @param [out] None
+ *  @return bool: true if success
+ */
+static bool softwareUpgrade_CommitManifest(void)
+{
+    char stagedName[ASSET_MANIFEST_NAME_SIZE + sizeof(UPGRADE_STAGED_SUFFIX)];
+    char filePath[255];
+
+    softwareUpgrade_StagedName(stagedName, FILE_NAME_ASSET_MANIFEST);
+    strcpy(filePath, UPGRADE_DIRNAME);
+    strcat(filePath, "/");
+    strcat(filePath, FILE_NAME_MANIFEST_OF_UPDATE);
+    if (FILECOPY_SUCCESS != SQIInterface_CopyFile(filePath, SYS_FS_MEDIA_IDX1_MOUNT_NAME_VOLUME_IDX0,
+                                                  stagedName, SYS_FS_MEDIA_IDX0_MOUNT_NAME_VOLUME_IDX0))
+    {
+        SYS_PRINT("\n Error : copyFailed %s \n", FILE_NAME_MANIFEST_OF_UPDATE);
+        return false;
+    }
+    SYS_FS_CurrentDriveSet(SYS_FS_MEDIA_IDX0_MOUNT_NAME_VOLUME_IDX0);
+    if (SYS_FS_FileDirectoryRenameMove(stagedName, FILE_NAME_ASSET_MANIFEST) != SYS_FS_RES_SUCCESS)
+    {
+        SYS_PRINT("\n Error : rename failed %s %d \n", stagedName, SYS_FS_Error());
+        return false;
+    }
+    return true;
+}
+
+/** @brief Copy new and changed assets to SQI flash and commit them.
+ *  Assets are first copied next to the ones in use under a staged name and
+ *  checked against the manifest, so an interrupted copy leaves the assets in
+ *  use untouched (staged assets left by it are removed by the next upgrade).
+ *  Then manifest on SQI is removed, a bundle of a former upgrade is removed
+ *  (boot loads it before loose assets), staged assets replace the old ones,
+ *  assets no longer in package are removed, and the new manifest is swapped in
+ *  last. So manifest on SQI only exists when it describes the assets on SQI
+ *  @param [in] None
+ *  @param [out] None
+ *  @return bool: true if success
+ */
+static bool softwareUpgrade_CopyChangedAssets(void)
+{
+    char stagedName[ASSET_MANIFEST_NAME_SIZE + sizeof(UPGRADE_STAGED_SUFFIX)];
+    char filePath[255];
+    uint32_t copiedBytes = 0;
+    uint32_t totalBytes = 0;
+    int i;
+
+    for (i = 0; i < s_usbManifestCount; i++)
+    {
+        if (s_isAssetChanged[i])
+        {
+            totalBytes += s_usbManifest[i].size;
+        }
+    }
+
+    //stage new and changed assets
+    for (i = 0; i < s_usbManifestCount; i++)
+    {
+        if (!s_isAssetChanged[i])
+        {
+            continue;
+        }
+        SYS_PRINT("Copying %s \n", s_usbManifest[i].name);
+        strcpy(filePath, UPGRADE_DIRNAME);
+        strcat(filePath, "/");
+        strcat(filePath, s_usbManifest[i].name);
+        softwareUpgrade_StagedName(stagedName, s_usbManifest[i].name);
+
+        if ((FILECOPY_SUCCESS != SQIInterface_CopyFile(filePath, SYS_FS_MEDIA_IDX1_MOUNT_NAME_VOLUME_IDX0,
+                                                       stagedName, SYS_FS_MEDIA_IDX0_MOUNT_NAME_VOLUME_IDX0))
+            || (softwareUpgrade_CheckAsset(stagedName, &s_usbManifest[i]) == false))
+        {
+            SYS_PRINT("\n Error : copyFailed %s \n", s_usbManifest[i].name);
+            return false;
+        }
+        copiedBytes += s_usbManifest[i].size;
+        guiInterface_SendEvent(eGuiUpdateScreenMessageUpdatingAssetsStatus, (long)((uint64_t)copiedBytes * 100 / totalBytes));
+    }
+
+    //commit, from here assets on SQI are not described by a manifest until the new one is in place
+    SYS_FS_CurrentDriveSet(SYS_FS_MEDIA_IDX0_MOUNT_NAME_VOLUME_IDX0);
+    SYS_FS_FileDirectoryRemove(FILE_NAME_ASSET_MANIFEST);
+    SYS_FS_FileDirectoryRemove(FILE_NAME_ASSET_BUNDLE);
+    for (i = 0; i < s_usbManifestCount; i++)
+    {
+        if (!s_isAssetChanged[i])
+        {
+            continue;
+        }
+        softwareUpgrade_StagedName(stagedName, s_usbManifest[i].name);
+        //old asset does not exist for a new one
+        SYS_FS_FileDirectoryRemove(s_usbManifest[i].name);
+        if (SYS_FS_FileDirectoryRenameMove(stagedName, s_usbManifest[i].name) != SYS_FS_RES_SUCCESS)
+        {
+            SYS_PRINT("\n Error : rename failed %s %d \n", stagedName, SYS_FS_Error());
+            return false;
+        }
+    }
+    for (i = 0; i < s_sqiManifestCount; i++)
+    {
+        if (assetManifest_Find(s_usbManifest, s_usbManifestCount, s_sqiManifest[i].name, i) < 0)
+        {
+            SYS_PRINT("Remove %s \n", s_sqiManifest[i].name);
+            SYS_FS_FileDirectoryRemove(s_sqiManifest[i].name);
+        }
+    }
+
+    //new manifest is swapped in last
+    return softwareUpgrade_CommitManifest();
+}
+
 /** @brief The function process software upgrade 
  *  @param [in] None
  *  @param [out] None
@@ -143,6 +524,9 @@ void softwareUpgrade_Process(void)
   
     int i = 0;
     bool copySuccess = true;
+    bool isDifferential;
+    bool hasManifest;
+    bool isCopyAll = false;
     
     TickType_t xGuiTick = xTaskGetTickCount();
     if (!FileSystemMgr_IsUSBMounted())
@@ -152,8 +536,12 @@ void softwareUpgrade_Process(void)
         return;
     }    
    
+    //with a manifest only new and changed assets are copied, else SQI flash is formatted and all assets are copied.
+    //A bundle holds all assets and replaces them, so it wins over a manifest in the same package
+    hasManifest = (USBInterface_Search(UPGRADE_DIR, FILE_NAME_ASSET_BUNDLE) != SYS_FS_RES_SUCCESS)
+                  && (USBInterface_Search(UPGRADE_DIR, FILE_NAME_MANIFEST_OF_UPDATE) == SYS_FS_RES_SUCCESS);
     
-    if(!softwareUpgrade_GetFileUpdate())
+    if(hasManifest ? !softwareUpgrade_GetManifestUpdate(&isCopyAll) : !softwareUpgrade_GetFileUpdate())
     {
         guiInterface_SendEvent(eGuiUpdateScreenMessageFileNotFound, 0);
         SYS_PRINT("Failed to check update files \n");
@@ -161,6 +549,8 @@ void softwareUpgrade_Process(void)
     }
     else
     {
+        isDifferential = hasManifest && !isCopyAll;
+
         /*stop system to update*/
         MOTOR_CTRL_EVENT_t mEvent = {.id = eMotorStopId};
         MotorTask_SendEvent(mEvent);
@@ -175,9 +565,25 @@ void softwareUpgrade_Process(void)
         alarmTask_Suspend();
     
         //guiInterface_SendEvent(eGuiUpdateScreenMessageUpdatingAssets, 0);
-        SYS_PRINT("Number Of Update Files: %d \n", noOfUpdateFiles);
-        if(noOfUpdateFiles > 0)
+        if (isDifferential)
+        {
+            g_isUpgradeCopying = true;
+            g_isUpgradeProcess = true;
+            
+            copySuccess = softwareUpgrade_CopyChangedAssets();
+            
+            xGuiTick = xTaskGetTickCount() - xGuiTick;
+            SYS_PRINT("softwareUpgrade_Process %d\n",xGuiTick); 
+            if (copySuccess == false)
+            {
+                guiInterface_SendEvent(eGuiUpdateScreenMessageUpdateFailed, 0);
+                g_isUpgradeCopying = false;
+                return;
+            }
+        }
+        else if(noOfUpdateFiles > 0)
         {
+            SYS_PRINT("Number Of Update Files: %d \n", noOfUpdateFiles);
             g_isUpgradeCopying = true;
             g_isUpgradeProcess = true;
             
@@ -234,6 +640,16 @@ void softwareUpgrade_Process(void)
             xGuiTick = xTaskGetTickCount() - xGuiTick;
             SYS_PRINT("softwareUpgrade_Process %d\n",xGuiTick); 
             
+            //manifest lets next upgrade copy only new and changed assets
+            if ((copySuccess == true) && (hasManifest == true))
+            {
+                copySuccess = softwareUpgrade_CommitManifest();
+                if (copySuccess == false)
+                {
+                    guiInterface_SendEvent(eGuiUpdateScreenMessageUpdateFailed, 0);
+                }
+            }
+
             if (copySuccess == true)
             {
                 SYS_PRINT("\ncopy assets to SQI success\n");
@@ -577,6 +993,17 @@ bool softwareUpgrade_GetFileUpdate(void)
     SYS_FS_HANDLE fileHandle;
     uint32_t fileSize, readBytes;
     uint8_t *buffer;
+
+    //a bundle holds all assets, update list is not needed
+    if (USBInterface_Search(UPGRADE_DIR, FILE_NAME_ASSET_BUNDLE) == SYS_FS_RES_SUCCESS)
+    {
+        guiInterface_SendEvent(eGuiUpdateScreenMessageCheckingAsset, 0);
+        strcpy(listOfUpdateFiles[0], FILE_NAME_ASSET_BUNDLE);
+        noOfUpdateFiles = 1;
+        SYS_PRINT("[Filename[0]: %s ] \n", listOfUpdateFiles[0]);
+        return true;
+    }
+
     fileHandle = SYS_FS_FileOpen(FILE_LIST_OF_UPDATE,
             (SYS_FS_FILE_OPEN_READ));
 
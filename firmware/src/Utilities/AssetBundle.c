@@ -0,0 +1,92 @@
+/** @file AssetBundle.c
+ *  @brief Format of the GUI asset bundle, shared by System/SQIInterface.c and
+ *  tools/AssetPacker
+ */
+
+#include <string.h>
+
+#include "AssetBundle.h"
+#include "crc.h"
+
+/** @brief Check header of bundle
+ *  @param [in] const ASSET_BUNDLE_HEADER_t *header: header read from bundle
+ *  @param [out] None
+ *  @return bool: true if header is valid
+ */
+bool assetBundle_CheckHeader(const ASSET_BUNDLE_HEADER_t *header)
+{
+    if ((header->magic != ASSET_BUNDLE_MAGIC) || (header->version != ASSET_BUNDLE_VERSION))
+        return false;
+    if ((header->entryCount == 0) || (header->entryCount > ASSET_BUNDLE_MAX_ENTRY))
+        return false;
+    if (header->pageSize != ASSET_BUNDLE_PAGE_SIZE)
+        return false;
+    return true;
+}
+
+/** @brief Get size of index
+ *  @param [in] uint16_t entryCount: number of entries
+ *  @param [out] None
+ *  @return uint32_t: size of index in bytes
+ */
+uint32_t assetBundle_IndexSize(uint16_t entryCount)
+{
+    return (uint32_t)entryCount * sizeof(ASSET_BUNDLE_ENTRY_t);
+}
+
+/** @brief Check index of bundle: CRC of index, names are terminated and
+ *  payloads are aligned and inside the bundle
+ *  @param [in] const ASSET_BUNDLE_HEADER_t *header: valid header
+ *  @param [in] const ASSET_BUNDLE_ENTRY_t *index: index read from bundle
+ *  @param [in] uint32_t bundleSize: size of bundle file
+ *  @param [out] None
+ *  @return bool: true if index is valid
+ */
+bool assetBundle_CheckIndex(const ASSET_BUNDLE_HEADER_t *header, const ASSET_BUNDLE_ENTRY_t *index,
+                            uint32_t bundleSize)
+{
+    int i;
+
+    if (crc_Update(CRC16_START_VAL, index, assetBundle_IndexSize(header->entryCount)) != header->indexCrc)
+        return false;
+
+    for (i = 0; i < header->entryCount; i++)
+    {
+        if (index[i].name[ASSET_BUNDLE_NAME_SIZE - 1] != '\0')
+            return false;
+        if ((index[i].offset % ASSET_BUNDLE_PAGE_SIZE) != 0)
+            return false;
+        if ((index[i].offset > bundleSize) || (index[i].length > bundleSize - index[i].offset))
+            return false;
+    }
+    return true;
+}
+
+/** @brief Find an asset in index by name. Assets are usually loaded in the
+ *  order of the index, so the search starts at hint (entry after the last one
+ *  found) and wraps around
+ *  @param [in] const ASSET_BUNDLE_ENTRY_t *index: index
+ *  @param [in] uint16_t entryCount: number of entries
+ *  @param [in] const char *name: asset name
+ *  @param [in] int hint: first entry searched
+ *  @param [out] None
+ *  @return int: entry index, -1 if not found
+ */
+int assetBundle_Find(const ASSET_BUNDLE_ENTRY_t *index, uint16_t entryCount, const char *name, int hint)
+{
+    int n, i;
+
+    if ((hint < 0) || (hint >= entryCount))
+        hint = 0;
+
+    for (n = 0, i = hint; n < entryCount; n++)
+    {
+        if (strcmp(index[i].name, name) == 0)
+            return i;
+        if (++i == entryCount)
+            i = 0;
+    }
+    return -1;
+}
+
+/* end of file */
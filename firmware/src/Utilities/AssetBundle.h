@@ -0,0 +1,70 @@
+/** @file AssetBundle.h
+ *  @brief Format of the GUI asset bundle: one file holding all images, fonts
+ *  and video frames, written by tools/AssetPacker and loaded by
+ *  System/SQIInterface.c
+ *
+ *  Layout (little endian):
+ *    ASSET_BUNDLE_HEADER_t
+ *    ASSET_BUNDLE_ENTRY_t x entryCount (index)
+ *    padding to a page boundary
+ *    payloads, each one starting on a page boundary
+ */
+
+#ifndef ASSET_BUNDLE_H
+#define	ASSET_BUNDLE_H
+
+#include "stdint.h"
+#include "stdbool.h"
+
+/** @brief Define magic of bundle file ("JFAB") */
+#define ASSET_BUNDLE_MAGIC              (0x4241464A)
+
+/** @brief Define version of bundle format */
+#define ASSET_BUNDLE_VERSION            (1)
+
+/** @brief Define alignment of payloads, size of a SQI flash sector */
+#define ASSET_BUNDLE_PAGE_SIZE          (4096)
+
+/** @brief Define size of asset name, NUL terminated */
+#define ASSET_BUNDLE_NAME_SIZE          (32)
+
+/** @brief Define maximum number of assets in a bundle */
+#define ASSET_BUNDLE_MAX_ENTRY          (1024)
+
+/** @brief Define header of bundle, 16 bytes */
+typedef struct
+{
+    uint32_t magic;         /**<ASSET_BUNDLE_MAGIC */
+    uint16_t version;       /**<ASSET_BUNDLE_VERSION */
+    uint16_t entryCount;    /**<number of entries in index */
+    uint32_t pageSize;      /**<alignment of payloads */
+    uint16_t indexCrc;      /**<crc_Update of index from CRC16_START_VAL */
+    uint16_t reserved;
+} ASSET_BUNDLE_HEADER_t;
+
+/** @brief Define entry of index, 44 bytes */
+typedef struct
+{
+    char name[ASSET_BUNDLE_NAME_SIZE];  /**<asset id, file name in update list */
+    uint32_t offset;                    /**<offset of payload from start of bundle */
+    uint32_t length;                    /**<length of payload, without CRC */
+    uint16_t crc;                       /**<crc_Update of payload from CRC16_START_VAL */
+    uint16_t reserved;
+} ASSET_BUNDLE_ENTRY_t;
+
+//function to check header of bundle
+bool assetBundle_CheckHeader(const ASSET_BUNDLE_HEADER_t *header);
+
+//function to get size of index
+uint32_t assetBundle_IndexSize(uint16_t entryCount);
+
+//function to check index of bundle against header and bundle size
+bool assetBundle_CheckIndex(const ASSET_BUNDLE_HEADER_t *header, const ASSET_BUNDLE_ENTRY_t *index,
+                            uint32_t bundleSize);
+
+//function to find an asset in index by name, search starts at hint
+int assetBundle_Find(const ASSET_BUNDLE_ENTRY_t *index, uint16_t entryCount, const char *name, int hint);
+
+#endif	/* ASSET_BUNDLE_H */
+
+/* end of file */
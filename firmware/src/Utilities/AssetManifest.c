@@ -0,0 +1,125 @@
+/** @file AssetManifest.c
+ *  @brief Manifest of GUI assets for differential upgrade, shared by
+ *  System/SoftwareUpgrade.c and tools/AssetManifest
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "AssetManifest.h"
+
+/** @brief Remove blanks at both ends of a string, in place
+ *  @param [in] char *s: string
+ *  @param [out] None
+ *  @return char*: first non blank character
+ */
+static char* assetManifest_Trim(char *s)
+{
+    char *end = s + strlen(s);
+
+    while (*s == ' ' || *s == '\t')
+        s++;
+    while (end > s && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r'))
+        *--end = '\0';
+    return s;
+}
+
+/** @brief Parse a manifest text. Text is modified
+ *  @param [in] char *text: manifest, NUL terminated
+ *  @param [in] int maxEntry: size of entries
+ *  @param [out] ASSET_MANIFEST_ENTRY_t *entries: parsed entries
+ *  @return int: number of entries, -1 if a line is invalid or too many entries
+ */
+int assetManifest_Parse(char *text, ASSET_MANIFEST_ENTRY_t *entries, int maxEntry)
+{
+    int count = 0;
+    char *line = text;
+
+    while (line != NULL && *line != '\0')
+    {
+        char *next = strchr(line, '\n');
+        char *name, *size, *crc, *end;
+
+        if (next != NULL)
+            *next++ = '\0';
+        line = assetManifest_Trim(line);
+
+        if (*line != '\0' && *line != '#')
+        {
+            name = line;
+            size = strchr(name, ',');
+            crc = (size != NULL) ? strchr(size + 1, ',') : NULL;
+            if (crc == NULL || count == maxEntry)
+                return -1;
+            *size++ = '\0';
+            *crc++ = '\0';
+
+            name = assetManifest_Trim(name);
+            if (*name == '\0' || strlen(name) >= ASSET_MANIFEST_NAME_SIZE)
+                return -1;
+            strcpy(entries[count].name, name);
+
+            entries[count].size = strtoul(size, &end, 10);
+            if (end == size || *assetManifest_Trim(end) != '\0')
+                return -1;
+            entries[count].crc = strtoul(crc, &end, 16);
+            if (end == crc || *assetManifest_Trim(end) != '\0')
+                return -1;
+            count++;
+        }
+        line = next;
+    }
+    return count;
+}
+
+/** @brief Find an asset in manifest by name. Manifests are usually walked in
+ *  the same order, so the search starts at hint and wraps around
+ *  @param [in] const ASSET_MANIFEST_ENTRY_t *entries: manifest
+ *  @param [in] int count: number of entries
+ *  @param [in] const char *name: asset name
+ *  @param [in] int hint: first entry searched
+ *  @param [out] None
+ *  @return int: entry index, -1 if not found
+ */
+int assetManifest_Find(const ASSET_MANIFEST_ENTRY_t *entries, int count, const char *name, int hint)
+{
+    int n, i;
+
+    if ((hint < 0) || (hint >= count))
+        hint = 0;
+
+    for (n = 0, i = hint; n < count; n++)
+    {
+        if (strcmp(entries[i].name, name) == 0)
+            return i;
+        if (++i == count)
+            i = 0;
+    }
+    return -1;
+}
+
+/** @brief Check if an asset is the same in both manifests
+ *  @param [in] const ASSET_MANIFEST_ENTRY_t *a: entry of first manifest
+ *  @param [in] const ASSET_MANIFEST_ENTRY_t *b: entry of second manifest
+ *  @param [out] None
+ *  @return bool: true if name, size and CRC are the same
+ */
+bool assetManifest_IsSame(const ASSET_MANIFEST_ENTRY_t *a, const ASSET_MANIFEST_ENTRY_t *b)
+{
+    return (a->size == b->size) && (a->crc == b->crc) && (strcmp(a->name, b->name) == 0);
+}
+
+/** @brief Format an entry as a manifest line, with new line
+ *  @param [in] size_t size: size of line buffer
+ *  @param [in] const ASSET_MANIFEST_ENTRY_t *entry: entry
+ *  @param [out] char *line: line
+ *  @return int: length of line, as snprintf
+ */
+int assetManifest_FormatEntry(char *line, size_t size, const ASSET_MANIFEST_ENTRY_t *entry)
+{
+    return snprintf(line, size, "%s,%lu,%08lX\n", entry->name,
+                    (unsigned long)entry->size, (unsigned long)entry->crc);
+}
+
+/* end of file */
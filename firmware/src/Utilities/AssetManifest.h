@@ -0,0 +1,48 @@
+/** @file AssetManifest.h
+ *  @brief Manifest of GUI assets for differential upgrade, written by
+ *  tools/AssetManifest and used by System/SoftwareUpgrade.c
+ *
+ *  Text file, one asset per line: name,size,crc32 (size in decimal, CRC-32 of
+ *  the whole file in hexadecimal). Empty lines and lines starting with '#' are
+ *  ignored.
+ */
+
+#ifndef ASSET_MANIFEST_H
+#define	ASSET_MANIFEST_H
+
+#include "stdint.h"
+#include "stdbool.h"
+#include "stddef.h"
+
+/** @brief Define size of asset name, NUL terminated */
+#define ASSET_MANIFEST_NAME_SIZE        (50)
+
+/** @brief Define maximum number of assets in a manifest */
+#define ASSET_MANIFEST_MAX_ENTRY        (1024)
+
+/** @brief Define maximum length of a manifest line, without new line */
+#define ASSET_MANIFEST_LINE_SIZE        (ASSET_MANIFEST_NAME_SIZE + 20)
+
+/** @brief Define entry of manifest */
+typedef struct
+{
+    char name[ASSET_MANIFEST_NAME_SIZE];    /**<file name */
+    uint32_t size;                          /**<file size */
+    uint32_t crc;                           /**<crc_Crc32Update of file from CRC32_START_VAL */
+} ASSET_MANIFEST_ENTRY_t;
+
+//function to parse a manifest text
+int assetManifest_Parse(char *text, ASSET_MANIFEST_ENTRY_t *entries, int maxEntry);
+
+//function to find an asset in manifest by name, search starts at hint
+int assetManifest_Find(const ASSET_MANIFEST_ENTRY_t *entries, int count, const char *name, int hint);
+
+//function to check if an asset is the same in both manifests
+bool assetManifest_IsSame(const ASSET_MANIFEST_ENTRY_t *a, const ASSET_MANIFEST_ENTRY_t *b);
+
+//function to format an entry as a manifest line
+int assetManifest_FormatEntry(char *line, size_t size, const ASSET_MANIFEST_ENTRY_t *entry);
+
+#endif	/* ASSET_MANIFEST_H */
+
+/* end of file */
@@ -0,0 +1,132 @@
+/** @file ImaAdpcm.c
+ *  @brief IMA-ADPCM codec, 4 bit per 16 bit sample. Used by Device/VoicePrompt.c
+ *  to decode voice prompts and by tools/VoiceAdpcmEncoder to encode them
+ */
+
+#include "ImaAdpcm.h"
+
+/** @brief Define number of entries of step table */
+#define IMA_ADPCM_STEP_NUM          (89)
+
+/** @brief Quantizer step sizes */
+static const int16_t s_imaAdpcmStepTab[IMA_ADPCM_STEP_NUM] =
+{
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+/** @brief Step index change by code magnitude */
+static const int8_t s_imaAdpcmIndexTab[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+/** @brief Reset state of encoder/decoder
+ *  @param [in] None
+ *  @param [out] IMA_ADPCM_STATE_t *state: state
+ *  @return None
+ */
+void imaAdpcm_Reset(IMA_ADPCM_STATE_t *state)
+{
+    state->predictor = 0;
+    state->index = 0;
+}
+
+/** @brief Decode a 4 bit code to a sample
+ *  @param [in] uint8_t code: 4 bit code
+ *  @param [out] IMA_ADPCM_STATE_t *state: state, updated
+ *  @return int16_t: decoded sample
+ */
+int16_t imaAdpcm_DecodeSample(IMA_ADPCM_STATE_t *state, uint8_t code)
+{
+    int32_t step = s_imaAdpcmStepTab[state->index];
+    int32_t diff = step >> 3;
+
+    if (code & 4)
+        diff += step;
+    if (code & 2)
+        diff += step >> 1;
+    if (code & 1)
+        diff += step >> 2;
+    if (code & 8)
+        state->predictor -= diff;
+    else
+        state->predictor += diff;
+
+    if (state->predictor > INT16_MAX)
+        state->predictor = INT16_MAX;
+    else if (state->predictor < INT16_MIN)
+        state->predictor = INT16_MIN;
+
+    state->index += s_imaAdpcmIndexTab[code & 7];
+    if (state->index < 0)
+        state->index = 0;
+    else if (state->index >= IMA_ADPCM_STEP_NUM)
+        state->index = IMA_ADPCM_STEP_NUM - 1;
+
+    return (int16_t)state->predictor;
+}
+
+/** @brief Encode a sample to a 4 bit code. State is updated by decoding the
+ *  code, so encoder and decoder stay in step
+ *  @param [in] int16_t sample: sample to encode
+ *  @param [out] IMA_ADPCM_STATE_t *state: state, updated
+ *  @return uint8_t: 4 bit code
+ */
+uint8_t imaAdpcm_EncodeSample(IMA_ADPCM_STATE_t *state, int16_t sample)
+{
+    int32_t step = s_imaAdpcmStepTab[state->index];
+    int32_t diff = (int32_t)sample - state->predictor;
+    uint8_t code = 0;
+
+    if (diff < 0)
+    {
+        code = 8;
+        diff = -diff;
+    }
+    if (diff >= step)
+    {
+        code |= 4;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step)
+    {
+        code |= 2;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step)
+        code |= 1;
+
+    imaAdpcm_DecodeSample(state, code);
+    return code;
+}
+
+/** @brief Decode codes from a nibble position, low nibble of a byte is first
+ *  @param [in] const uint8_t *data: codes
+ *              uint32_t position: index of first code (nibble)
+ *              uint32_t count: number of samples to decode
+ *  @param [out] IMA_ADPCM_STATE_t *state: state at position, updated
+ *               int16_t *samples: decoded samples
+ *  @return None
+ */
+void imaAdpcm_Decode(IMA_ADPCM_STATE_t *state, const uint8_t *data, uint32_t position,
+                     int16_t *samples, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++, position++)
+    {
+        uint8_t code = data[position >> 1];
+        if (position & 1)
+            code >>= 4;
+        samples[i] = imaAdpcm_DecodeSample(state, code & 0x0F);
+    }
+}
+
+/* end of file */
@@ -0,0 +1,34 @@
+/** @file ImaAdpcm.h
+ *  @brief IMA-ADPCM codec, 4 bit per 16 bit sample. Used by Device/VoicePrompt.c
+ *  to decode voice prompts and by tools/VoiceAdpcmEncoder to encode them
+ */
+
+#ifndef IMA_ADPCM_H
+#define	IMA_ADPCM_H
+
+#include "stdint.h"
+#include "stdbool.h"
+
+/** @brief Define state of encoder/decoder, both start from predictor 0 and index 0 */
+typedef struct
+{
+    int32_t predictor;      /**<last decoded sample */
+    int32_t index;          /**<index in step table (0..88) */
+} IMA_ADPCM_STATE_t;
+
+//function to reset state of encoder/decoder
+void imaAdpcm_Reset(IMA_ADPCM_STATE_t *state);
+
+//function to encode a sample to a 4 bit code, state follows the decoder
+uint8_t imaAdpcm_EncodeSample(IMA_ADPCM_STATE_t *state, int16_t sample);
+
+//function to decode a 4 bit code to a sample
+int16_t imaAdpcm_DecodeSample(IMA_ADPCM_STATE_t *state, uint8_t code);
+
+//function to decode codes from nibble position, low nibble of a byte is first
+void imaAdpcm_Decode(IMA_ADPCM_STATE_t *state, const uint8_t *data, uint32_t position,
+                     int16_t *samples, uint32_t count);
+
+#endif	/* IMA_ADPCM_H */
+
+/* end of file */
@@ -7,8 +7,19 @@
  */
 /* ************************************************************************** */
 
+#include <math.h>
 #include <KalmanLPF.h>
 
+/** @brief process noise covariance of each state */
+#define KALMAN_LPF_Q0       (0.0001)
+#define KALMAN_LPF_Q1       (0.0001)
+#define KALMAN_LPF_Q2       (0.0001)
+
+/** @brief measurement noise covariance of each observation */
+#define KALMAN_LPF_R0       (0.0077)
+#define KALMAN_LPF_R1       (0.1)
+#define KALMAN_LPF_R2       (0.1)
+
 /** @brief local functions  */
 extern void ekf_init(void * v, int n, int m);
 extern int ekf_step(void * ekf, double * z);
@@ -26,14 +37,14 @@ void KalmanLPF_Initialize(KALMAN_LPF_t* ekf) {
     ekf_init(ekf, Nsta, Mobs);
 
     // We approximate the process noise using a small constant
-    KalmanLPF_SetQ(ekf, 0, 0, 0.0001); //0.0001
-    KalmanLPF_SetQ(ekf, 1, 1, 0.0001);
-    KalmanLPF_SetQ(ekf, 2, 2, 0.0001);
+    KalmanLPF_SetQ(ekf, 0, 0, KALMAN_LPF_Q0); //0.0001
+    KalmanLPF_SetQ(ekf, 1, 1, KALMAN_LPF_Q1);
+    KalmanLPF_SetQ(ekf, 2, 2, KALMAN_LPF_Q2);
 
     // Same for measurement noise
-    KalmanLPF_SetR(ekf, 0, 0, 0.0077); //0.0077
-    KalmanLPF_SetR(ekf, 1, 1, 0.1); //0.0010
-    KalmanLPF_SetR(ekf, 2, 2, 0.1); //0.0010
+    KalmanLPF_SetR(ekf, 0, 0, KALMAN_LPF_R0); //0.0077
+    KalmanLPF_SetR(ekf, 1, 1, KALMAN_LPF_R1); //0.0010
+    KalmanLPF_SetR(ekf, 2, 2, KALMAN_LPF_R2); //0.0010
 }
 
 /** @brief Runs one step of EKF prediction and update
@@ -132,3 +143,77 @@ void KalmanLPF_CalculateModel(KALMAN_LPF_t* ekf, double fx[Nsta], double F[Nsta]
     H[1][1] = 1; // Baro temperature from previous state
     H[2][2] = 1; // LM35 temperature from previous state
 }
+
+/** @brief Step of one state of the diagonal filter
+ *  @param [in]     KALMAN_LPF_DIAG_t * lpf     pointer to filter 
+ *                  int i       state index
+ *                  float z     observation of state
+ *  @param [out]    None
+ *  @return         None
+ */
+static inline void KalmanLPF_DiagStepState(KALMAN_LPF_DIAG_t* lpf, int i, float z) {
+    if (lpf->isSteadyState == false) {
+        // P_k = P_{k-1} + Q, G_k = P_k / (P_k + R)
+        float Pp = lpf->P[i] + lpf->Q[i];
+        lpf->G[i] = Pp / (Pp + lpf->R[i]);
+        // P_k = (1 - G_k) P_k
+        lpf->P[i] = (1.0f - lpf->G[i]) * Pp;
+    }
+    // x_k = x_{k-1} + G_k (z_k - x_{k-1})
+    lpf->x[i] += lpf->G[i] * (z - lpf->x[i]);
+}
+
+/** @brief Initializes a diagonal Kalman Low pass filter with the same noise
+ * covariances as KalmanLPF_Initialize
+ *  @param [in]     KALMAN_LPF_DIAG_t * lpf     pointer to filter to initialize 
+ *                  bool isSteadyState  true: use the steady state gain from
+ * the first step (no covariance update), false: same output as KalmanLPF_Step
+ *  @param [out]  None
+ *  @return None
+ */
+void KalmanLPF_DiagInitialize(KALMAN_LPF_DIAG_t* lpf, bool isSteadyState) {
+    int i;
+
+    lpf->Q[0] = KALMAN_LPF_Q0;
+    lpf->Q[1] = KALMAN_LPF_Q1;
+    lpf->Q[2] = KALMAN_LPF_Q2;
+    lpf->R[0] = KALMAN_LPF_R0;
+    lpf->R[1] = KALMAN_LPF_R1;
+    lpf->R[2] = KALMAN_LPF_R2;
+    lpf->isSteadyState = isSteadyState;
+
+    for (i = 0; i < Nsta; i++) {
+        lpf->x[i] = 0;
+        // P starts from 0 as in ekf_init
+        lpf->P[i] = 0;
+        lpf->G[i] = 0;
+        if (isSteadyState == true) {
+            // fixed point of P = (1 - G)(P + Q): P + Q = (Q + sqrt(Q^2 + 4QR)) / 2
+            double q = lpf->Q[i];
+            double Pp = (q + sqrt(q * q + 4 * q * lpf->R[i])) / 2;
+            lpf->G[i] = (float) (Pp / (Pp + lpf->R[i]));
+        }
+    }
+}
+
+/** @brief Runs one step of diagonal Kalman prediction and update
+ *  @param [in]     KALMAN_LPF_DIAG_t * lpf     pointer to filter 
+ *                  const float * z     pointer to bundle of Mobs data
+ *  @param [out]  None
+ *  @return None
+ */
+void KalmanLPF_DiagStep(KALMAN_LPF_DIAG_t* lpf, const float * z) {
+    KalmanLPF_DiagStepState(lpf, 0, z[0]);
+    KalmanLPF_DiagStepState(lpf, 1, z[1]);
+    KalmanLPF_DiagStepState(lpf, 2, z[2]);
+}
+
+/** @brief Returns the state element of a diagonal filter at a given index
+ *  @param [in]     KALMAN_LPF_DIAG_t * lpf     pointer to filter 
+ *                  int i       the index (at least 0 and less than Nsta)
+ *  @param [out]    None
+ *  @return         float      state value at index 
+ */
+float KalmanLPF_DiagGetX(KALMAN_LPF_DIAG_t* lpf, int i) {
+    return lpf->x[i];
+}
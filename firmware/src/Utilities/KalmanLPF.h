@@ -57,6 +57,19 @@ extern "C" {
 
     } KALMAN_LPF_t;
 
+    /** @brief structure for a Kalman Low Pass Filter specialized for the model
+     * of KalmanLPF_CalculateModel: identity process and measurement models,
+     * diagonal Q and R. Covariance stays diagonal, so each state is a scalar
+     * filter, computed in single precision */
+    typedef struct {
+        float x[Nsta]; /* state vector */
+        float P[Nsta]; /* diagonal of prediction error covariance */
+        float Q[Nsta]; /* diagonal of process noise covariance */
+        float R[Mobs]; /* diagonal of measurement error covariance */
+        float G[Nsta]; /* diagonal of Kalman gain */
+        bool isSteadyState; /* true: G is the steady state gain, P is not updated */
+    } KALMAN_LPF_DIAG_t;
+
 
     /** @brief Initializes an KALMAN Low pass filter structure
      *  @param [in]     KALMAN_LPF_t * ekf      pointer to EKF structure to initialize 
@@ -83,6 +96,33 @@ extern "C" {
      */
     double KalmanLPF_GetX(KALMAN_LPF_t* ekf, int i);
 
+
+    /** @brief Initializes a diagonal Kalman Low pass filter with the same noise
+     * covariances as KalmanLPF_Initialize
+     *  @param [in]     KALMAN_LPF_DIAG_t * lpf     pointer to filter to initialize 
+     *                  bool isSteadyState  true: use the steady state gain from
+     * the first step (no covariance update), false: same output as KalmanLPF_Step
+     *  @param [out]  None
+     *  @return None
+     */
+    void KalmanLPF_DiagInitialize(KALMAN_LPF_DIAG_t* lpf, bool isSteadyState);
+
+    /** @brief Runs one step of diagonal Kalman prediction and update
+     *  @param [in]     KALMAN_LPF_DIAG_t * lpf     pointer to filter 
+     *                  const float * z     pointer to bundle of Mobs data
+     *  @param [out]  None
+     *  @return None
+     */
+    void KalmanLPF_DiagStep(KALMAN_LPF_DIAG_t* lpf, const float * z);
+
+    /** @brief Returns the state element of a diagonal filter at a given index
+     *  @param [in]     KALMAN_LPF_DIAG_t * lpf     pointer to filter 
+     *                  int i       the index (at least 0 and less than Nsta)
+     *  @param [out]    None
+     *  @return         float      state value at index 
+     */
+    float KalmanLPF_DiagGetX(KALMAN_LPF_DIAG_t* lpf, int i);
+
     /* Provide C++ Compatibility */
 #ifdef __cplusplus
 }
@@ -0,0 +1,161 @@
+/** @file Trace.c
+ *  @brief Binary trace rings, one per task, see Trace.h
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "Trace.h"
+
+/** @brief Keep compiler from moving ring accesses across index update. The
+ *  core is single, so ordering of the compiler is enough */
+#define TRACE_BARRIER()                 __asm__ volatile ("" ::: "memory")
+
+/** @brief Define ring of a task */
+typedef struct
+{
+    TaskHandle_t task;                  /**<task writing the ring, NULL if free */
+    volatile uint32_t head;             /**<next word written, only changed by task */
+    volatile uint32_t tail;             /**<next word read, only changed by reader */
+    volatile uint32_t lostCount;        /**<records lost as ring was full, only changed by task */
+    uint32_t lostReported;              /**<lost records already reported, only used by reader */
+    uint32_t data[TRACE_RING_WORDS];    /**<records */
+} TRACE_RING_t;
+
+/** @brief Declare rings */
+static TRACE_RING_t s_traceRing[TRACE_RING_NUM];
+
+/** @brief Number of records lost as there is no free ring, to check in debugger */
+static volatile uint32_t s_traceNoRingCount = 0;
+
+/** @brief Get ring of current task, a free ring is given on first call
+ *  @param [in] None
+ *  @param [out] None
+ *  @return int : ring index, -1 if no ring is free
+ */
+static int trace_GetRing(void)
+{
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    int i;
+
+    for (i = 0; i < TRACE_RING_NUM; i++)
+    {
+        if (s_traceRing[i].task == task)
+            return i;
+    }
+
+    //first record of this task, only task writing in a ring gives it
+    taskENTER_CRITICAL();
+    for (i = 0; i < TRACE_RING_NUM; i++)
+    {
+        if (s_traceRing[i].task == NULL)
+        {
+            s_traceRing[i].task = task;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return (i < TRACE_RING_NUM) ? i : -1;
+}
+
+/** @brief Write a trace record in ring of current task. Record is lost if
+ *  ring is full, the number of lost records is traced when ring is read
+ *  @param [in] E_TraceId id : id of record
+ *  @param [in] uint32_t argc : number of arguments, at most TRACE_MAX_ARG
+ *  @param [in] const uint32_t *args : arguments
+ *  @param [out] None
+ *  @return None
+ */
+void trace_Write(E_TraceId id, uint32_t argc, const uint32_t *args)
+{
+    TRACE_RING_t *ring;
+    uint32_t head, space, i;
+    int index = trace_GetRing();
+
+    if (index < 0)
+    {
+        s_traceNoRingCount++;
+        return;
+    }
+    ring = &s_traceRing[index];
+    if (argc > TRACE_MAX_ARG)
+        argc = TRACE_MAX_ARG;
+
+    //one word is kept free to tell full ring from empty ring
+    head = ring->head;
+    space = (ring->tail + TRACE_RING_WORDS - head - 1) % TRACE_RING_WORDS;
+    if (space < TRACE_RECORD_HEADER_WORDS + argc)
+    {
+        ring->lostCount++;
+        return;
+    }
+
+    ring->data[head] = TRACE_RECORD_WORD(index, argc, id);
+    head = (head + 1) % TRACE_RING_WORDS;
+    ring->data[head] = xTaskGetTickCount();
+    head = (head + 1) % TRACE_RING_WORDS;
+    for (i = 0; i < argc; i++)
+    {
+        ring->data[head] = args[i];
+        head = (head + 1) % TRACE_RING_WORDS;
+    }
+
+    //record is complete before reader can see it
+    TRACE_BARRIER();
+    ring->head = head;
+    return;
+}
+
+/** @brief Read records of all rings. Only whole records are read, records
+ *  left are read on next call
+ *  @param [in] uint32_t maxWords : size of buffer in words
+ *  @param [out] uint32_t *buffer : records
+ *  @return uint32_t : number of words read
+ */
+uint32_t trace_Read(uint32_t *buffer, uint32_t maxWords)
+{
+    uint32_t count = 0;
+    uint32_t tail, head, length, lost, i;
+    int index;
+
+    for (index = 0; index < TRACE_RING_NUM; index++)
+    {
+        TRACE_RING_t *ring = &s_traceRing[index];
+
+        if (ring->task == NULL)
+            continue;
+
+        head = ring->head;
+        TRACE_BARRIER();
+        tail = ring->tail;
+        while (tail != head)
+        {
+            length = TRACE_RECORD_HEADER_WORDS + TRACE_RECORD_ARGC_OF(ring->data[tail]);
+            if (count + length > maxWords)
+                break;
+            for (i = 0; i < length; i++)
+            {
+                buffer[count++] = ring->data[tail];
+                tail = (tail + 1) % TRACE_RING_WORDS;
+            }
+        }
+
+        //words are copied before task can write them again
+        TRACE_BARRIER();
+        ring->tail = tail;
+
+        //report records lost since last read, they came after records read
+        lost = ring->lostCount - ring->lostReported;
+        if ((lost != 0) && (tail == head) && (count + TRACE_RECORD_HEADER_WORDS + 1 <= maxWords))
+        {
+            buffer[count++] = TRACE_RECORD_WORD(index, 1, eTraceLostId);
+            buffer[count++] = xTaskGetTickCount();
+            buffer[count++] = lost;
+            ring->lostReported += lost;
+        }
+    }
+    return count;
+}
+
+/* end of file */
@@ -0,0 +1,74 @@
+/** @file Trace.h
+ *  @brief Binary trace for hot paths. A call site writes the id of its format
+ *  (Utilities/TraceFormat.h) and raw arguments into the ring of its task,
+ *  without lock and without formatting. The rings are drained by the GUI task
+ *  (LogInterface_DebugLogTask) into the trace file, decoded to text on PC by
+ *  tools/TraceDecoder
+ *
+ *  A record is 2 + argc words of 32 bits: first word is TRACE_RECORD_MARK,
+ *  ring, argc and id (see TRACE_RECORD_WORD), second word is tick count,
+ *  then the arguments. Records of a ring are in order, rings are not merged.
+ *  Each ring has one writer (its task) and one reader (the drain), so trace
+ *  can only be written from task context, not from interrupts.
+ */
+
+#ifndef TRACE_H
+#define	TRACE_H
+
+#include "stdint.h"
+#include "stdbool.h"
+#include "stddef.h"
+
+#include "TraceFormat.h"
+
+/** @brief Define maximum number of arguments of a record */
+#define TRACE_MAX_ARG                   (9)
+
+/** @brief Define number of rings, one per task writing trace */
+#define TRACE_RING_NUM                  (8)
+
+/** @brief Define size of a ring in words */
+#define TRACE_RING_WORDS                (256)
+
+/** @brief Define mark in first word of a record, to check decoding */
+#define TRACE_RECORD_MARK               (0xA5)
+
+/** @brief Define size of record without arguments, in words */
+#define TRACE_RECORD_HEADER_WORDS       (2)
+
+/** @brief Build first word of a record */
+#define TRACE_RECORD_WORD(ring, argc, id)   (((uint32_t)TRACE_RECORD_MARK << 24) | (((uint32_t)(ring) & 0x0F) << 20) \
+                                            | (((uint32_t)(argc) & 0x0F) << 16) | ((uint32_t)(id) & 0xFFFF))
+
+/** @brief Get fields of first word of a record */
+#define TRACE_RECORD_MARK_OF(word)      (((word) >> 24) & 0xFF)
+#define TRACE_RECORD_RING_OF(word)      (((word) >> 20) & 0x0F)
+#define TRACE_RECORD_ARGC_OF(word)      (((word) >> 16) & 0x0F)
+#define TRACE_RECORD_ID_OF(word)        ((word) & 0xFFFF)
+
+/** @brief Define id of trace records */
+#define TRACE_FORMAT(id, format)        id,
+typedef enum
+{
+    TRACE_FORMAT_TABLE
+    eNoOfTraceId
+} E_TraceId;
+#undef TRACE_FORMAT
+
+/** @brief Write a trace record, arguments are converted to 32 bits integers:
+ *  TRACE(eTraceI2CTimeoutId, id + 1);
+ */
+#define TRACE(id, ...)  do { \
+        const uint32_t traceArgs_[] = {0, ##__VA_ARGS__}; \
+        trace_Write((id), sizeof(traceArgs_) / sizeof(uint32_t) - 1, &traceArgs_[1]); \
+    } while (0)
+
+//function to write a trace record in ring of current task
+void trace_Write(E_TraceId id, uint32_t argc, const uint32_t *args);
+
+//function to read records of all rings
+uint32_t trace_Read(uint32_t *buffer, uint32_t maxWords);
+
+#endif	/* TRACE_H */
+
+/* end of file */
@@ -0,0 +1,33 @@
+/** @file TraceFormat.h
+ *  @brief Format table of trace records, shared by Utilities/Trace.c and
+ *  tools/TraceDecoder
+ *
+ *  Each TRACE_FORMAT(id, format) line gives the id of a record and the text
+ *  the decoder prints for it. Firmware only uses the ids, format strings are
+ *  not linked in the firmware. Arguments are stored as 32 bits integers, so
+ *  formats only use %d, %u, %x and %X (at most TRACE_MAX_ARG of them).
+ *  Add new records at the end of the table, so that traces of former firmware
+ *  can still be decoded.
+ */
+
+#ifndef TRACE_FORMAT_H
+#define	TRACE_FORMAT_H
+
+#define TRACE_FORMAT_TABLE \
+    TRACE_FORMAT(eTraceLostId,                  "%u trace records lost") \
+    TRACE_FORMAT(eTraceVideoUpdateFrameId,      "VideoControl_UpdateFrame src %08X x %u y %u w %u h %u bpp %u dest %08X dest_w %u dest_h %u") \
+    TRACE_FORMAT(eTraceVideoDestLineErrorId,    "error line %u dest_add_line %u frameLineInBytes %u screenSizeInBytes %u") \
+    TRACE_FORMAT(eTraceVideoSrcLineErrorId,     "error line %u src_add_line %u frameLineInBytes %u frameSizeInBytes %u") \
+    TRACE_FORMAT(eTraceVideoBufferErrorId,      "error inputBuffer, outputBuffer") \
+    TRACE_FORMAT(eTraceI2CTimeoutId,            "I2C%u timeout >>> recover") \
+    TRACE_FORMAT(eTraceI2CResetId,              "I2C%u error >>> Reset I2C%u") \
+    TRACE_FORMAT(eTraceI2CReportErrorId,        "error at: I2C%u_ReportError") \
+    TRACE_FORMAT(eTraceI2CRefusedId,            "I2C%u: transaction refused") \
+    TRACE_FORMAT(eTraceAlarmChangeId,           "Alarm change: [%d] -- current state: [%d] -- priority: [%d]") \
+    TRACE_FORMAT(eTraceAlarmNoChangeSetId,      "No free alarm change set") \
+    TRACE_FORMAT(eTraceAlarmSendFailedId,       "Can not send alarm change set") \
+    TRACE_FORMAT(eTraceTouchPressLatencyId,     "Touch down %u us after INT (avg %u us, max %u us, %u presses, %u frames, %u lost)")
+
+#endif	/* TRACE_FORMAT_H */
+
+/* end of file */
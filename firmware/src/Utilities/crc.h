@@ -7,10 +7,14 @@
 #define	CRC_H
 
 #include "stdint.h"
+#include "stdbool.h"
 
 /** @brief Define start value */
 #define CRC16_START_VAL        (0x1D0F)
 
+/** @brief Define start value of CRC-32 */
+#define CRC32_START_VAL        (0)
+
 //function to check CRC without initial value
 unsigned short crc_CheckNoInit(long nBytes,int8_t *pData);
 
@@ -20,6 +24,12 @@ unsigned short crc_CheckWithInit(unsigned short initValue, long nBytes,int8_t *p
 //function to check CRC with initial value for image and font
 unsigned short crc_crc16ccitt(unsigned short start, int len, const void *buf);
 
+//function to update a running CRC for image and font with a new block
+unsigned short crc_Update(unsigned short crc, const void *buf, uint32_t len);
+
+//function to update a running CRC-32 with a new block
+uint32_t crc_Crc32Update(uint32_t crc, const void *buf, uint32_t len);
+
 #endif	/* CRC_H */
 
 /* end of file */
\ No newline at end of file
@@ -865,6 +865,10 @@ void btnUpgrade_PressedEvent(laButtonWidget* btn)
 // btnLogtoUsb - PressedEvent
 void btnLogtoUsb_PressedEvent(laButtonWidget* btn)
 {
+    //button shows progress of the running export
+    if (logMgr_IsExporting() == true)
+        return;
+    
     if (FileSystemMgr_IsUSBMounted() == true) {
         logInterface_SendLogRequest(eUSBGetEventLogRequestId);
         logInterface_SendLogRequest(eUSBGetAlarmLogRequestId);
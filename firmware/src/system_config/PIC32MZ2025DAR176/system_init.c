@@ -783,7 +783,7 @@ void SYS_Initialize ( void* data )
     SYS_INT_Initialize();
 
     /*Setup the INT_SOURCE_EXTERNAL_3 and Enable it*/
-    SYS_INT_VectorPrioritySet(INT_VECTOR_INT3, INT_PRIORITY_LEVEL5);
+    SYS_INT_VectorPrioritySet(INT_VECTOR_INT3, INT_PRIORITY_LEVEL1);
     SYS_INT_VectorSubprioritySet(INT_VECTOR_INT3, INT_SUBPRIORITY_LEVEL0);
     SYS_INT_ExternalInterruptTriggerSet(INT_EXTERNAL_INT_SOURCE3,INT_EDGE_TRIGGER_RISING);
     SYS_INT_SourceEnable(INT_SOURCE_EXTERNAL_3);
@@ -0,0 +1,677 @@
+/** @file AlarmReplay.c
+ *  @brief Host tool replaying a trace of alarm monitor snapshots through
+ *  Alarm/AlarmMgr.c faster than real time, to check alarm timing and measure
+ *  the cost of each alarm checker
+ *
+ *  A trace is a binary file: AlarmTraceHeader, then one record per alarm task
+ *  cycle, tick (ms) followed by ALARM_MONITOR_t as seen by the alarm task. The
+ *  struct has no pointer, long or double, so its layout is the same on PIC32
+ *  and on a 32/64 bits host, monitor size in the header is checked anyway.
+ *
+ *  Record a trace on target by building the firmware with ALARM_MONITOR_TRACE
+ *  defined (AlarmMgr.h) and capturing the console, then convert the log with
+ *  -c. Lines without "am " are ignored, so the whole console log can be given.
+ *  With -g a synthetic trace is generated from a seed: power, chamber, breathing
+ *  circuit, SpO2, water tank and failure flags change now and then, flows and
+ *  temperatures move in small steps, updated every 20 ms as by Device task.
+ *
+ *  On replay, alarm task cycles run every <period> ms (50 ms as on target) of
+ *  trace time, each cycle using the last snapshot recorded at or before it.
+ *  Every change sent by alarm task is printed to stdout as
+ *    <tick ms> <E_AlarmId> <status> <priority> <data[0..4]>
+ *  Replay speed, time of alarmMgr_CheckAllAlarm per cycle and calls and time
+ *  of each checker are printed to stderr, the cost of reading the clock is
+ *  subtracted from measured times.
+ *
+ *  Build (from firmware/), once per evaluation:
+ *    gcc -O2 -fgnu89-inline -DUNIT_TEST -DALARM_DEPENDENCY_EVAL=0 -Itools/AlarmReplay/include
+ *        -Isrc/Alarm -Isrc/Device -Isrc/Gui -Isrc/HeaterControl -Isrc/MotorControl -Isrc/System -Isrc/Utilities -Isrc
+ *        tools/AlarmReplay/AlarmReplay.c src/Alarm/AlarmMgr.c src/Alarm/AlarmInterface.c src/Utilities/Trace.c
+ *        -o AlarmReplayAll
+ *    same with -DALARM_DEPENDENCY_EVAL=1 -o AlarmReplayDep
+ *
+ *  Usage:
+ *    AlarmReplay [-p <period ms>] <trace file>
+ *    AlarmReplay -c <console log> <trace file>
+ *    AlarmReplay -g <minutes> <seed> <trace file>
+ *  Check both evaluations give the same timeline:
+ *    ./AlarmReplayAll -g 60 1 t.bin && ./AlarmReplayAll t.bin > all.txt && ./AlarmReplayDep t.bin > dep.txt
+ *    cmp all.txt dep.txt
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "AlarmInterface.h"
+#include "AlarmMgr.h"
+#include "DeviceTask.h"
+#include "GuiInterface.h"
+#include "AlarmEventHandler.h"
+
+/** @brief Define period of Device task update of alarm monitor (ms) */
+#define DEVICE_UPDATE_PERIOD    (20)
+
+/** @brief Define period of alarm task (ms), ALARM_TASK_DELAY of AlarmTask.c */
+#define ALARM_TASK_PERIOD       (50)
+
+/** @brief Define max number of alarm ids wrapped to time checker calls */
+#define MAX_CHECKER             (128)
+
+/** @brief Define magic at the beginning of a trace ("AMTR") */
+#define ALARM_TRACE_MAGIC       (0x52544D41)
+
+/** @brief Define version of trace format */
+#define ALARM_TRACE_VERSION     (1)
+
+/** @brief Define header of a trace */
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t monitorSize;
+} AlarmTraceHeader;
+
+/** @brief Alarm list of AlarmMgr.c, not static in UNIT_TEST build */
+extern ALARM_STAT_t s_alarmList[eNoOfAlarmId];
+
+static TickType_t s_tick = 0;
+static ALARM_MONITOR_t s_monitor;
+static ALARM_MONITOR_t s_lastMonitor;
+static uint32_t s_monitorChanges = ALARM_DEP_ALL;
+static uint32_t s_seed = 1;
+
+static ALARM_CHECK_FNC s_checker[MAX_CHECKER];
+static unsigned long s_checkerCalls[MAX_CHECKER];
+static uint64_t s_checkerNs[MAX_CHECKER];
+static uint64_t s_checkerMaxNs[MAX_CHECKER];
+static unsigned long s_totalCalls = 0;
+static unsigned long s_changes = 0;
+static uint64_t s_clockNs = 0;
+
+TickType_t xTaskGetTickCount(void)
+{
+    return s_tick;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    //trace records of alarm task go to one ring, never drained in replay
+    static int s_task;
+    return &s_task;
+}
+
+uint8_t setting_Get(E_SettingId id)
+{
+    //all alarms enabled, other settings are default
+    return 0;
+}
+
+/* Device task side, same as DeviceTask_UpdateAlarmMonitorStruct publishing changes */
+void DeviceTask_GetAlarmMonitorStruct(ALARM_MONITOR_t *storagePlace)
+{
+    *storagePlace = s_monitor;
+}
+
+void DeviceTask_GetAlarmMonitorChanges(ALARM_MONITOR_t *storagePlace, uint32_t *changes)
+{
+    *storagePlace = s_monitor;
+    *changes = s_monitorChanges;
+    s_monitorChanges = 0;
+}
+
+/** @brief Publish current monitor as Device task does
+ *  @return None
+ */
+static void PublishMonitor(void)
+{
+    s_monitorChanges |= alarmInterface_GetMonitorChanges(&s_lastMonitor, &s_monitor);
+    s_lastMonitor = s_monitor;
+}
+
+/* Consumers of change sets, the set is printed and released at once */
+bool guiInterface_SendEvent(uint8_t id, long data)
+{
+    ALARM_CHANGE_SET_t *set;
+    int i;
+
+    if (id != eGuiAlarmChangeSetEventId)
+        return true;
+    set = alarmInterface_GetChangeSet((uint8_t)data);
+    for (i = 0; i < set->count; i++)
+    {
+        const ALARM_CHANGE_t *c = &set->changes[i];
+        printf("%lu %d %d %d %d %d %d %d %d\n", (unsigned long)s_tick, c->id, c->status, c->priority,
+               c->data[0], c->data[1], c->data[2], c->data[3], c->data[4]);
+        s_changes++;
+    }
+    set->guiPending = false;
+    return true;
+}
+
+bool guiInterface_SendEventAlarm(uint8_t alarmId, uint8_t status, uint8_t priority, uint8_t *data)
+{
+    return true;
+}
+
+bool alarmEvenHandlerInterface_SendEventAlarm(uint8_t alarmId, uint8_t status, uint8_t *data)
+{
+    return true;
+}
+
+bool alarmEvenHandlerInterface_SendEventAlarmChangeSet(uint8_t slot)
+{
+    alarmInterface_GetChangeSet(slot)->devicePending = false;
+    return true;
+}
+
+/** @brief Get time in nanoseconds
+ *  @return uint64_t: monotonic time
+ */
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/** @brief Measure cost of reading the clock, subtracted from measured times
+ *  @return None
+ */
+static void CalibrateClock(void)
+{
+    uint64_t start = NowNs();
+    int i;
+
+    for (i = 0; i < 100000; i++)
+        NowNs();
+    s_clockNs = (NowNs() - start) / 100000;
+}
+
+/** @brief Run a checker, count the call and measure its time
+ *  @param [in] int id: alarm id
+ *  @return None
+ */
+static void TimeChecker(int id)
+{
+    uint64_t t = NowNs();
+
+    s_checker[id]();
+    t = NowNs() - t;
+    t = t > s_clockNs ? t - s_clockNs : 0;
+    s_checkerCalls[id]++;
+    s_checkerNs[id] += t;
+    if (t > s_checkerMaxNs[id])
+        s_checkerMaxNs[id] = t;
+    s_totalCalls++;
+}
+
+#define CHECKER1(n)     static void Checker##n(void) { TimeChecker(n); }
+#define CHECKER10(n)    CHECKER1(n##0) CHECKER1(n##1) CHECKER1(n##2) CHECKER1(n##3) CHECKER1(n##4) \
+                        CHECKER1(n##5) CHECKER1(n##6) CHECKER1(n##7) CHECKER1(n##8) CHECKER1(n##9)
+CHECKER1(0) CHECKER1(1) CHECKER1(2) CHECKER1(3) CHECKER1(4) CHECKER1(5) CHECKER1(6) CHECKER1(7) CHECKER1(8) CHECKER1(9)
+CHECKER10(1) CHECKER10(2) CHECKER10(3) CHECKER10(4) CHECKER10(5) CHECKER10(6) CHECKER10(7) CHECKER10(8) CHECKER10(9)
+CHECKER10(10) CHECKER10(11)
+CHECKER1(120) CHECKER1(121) CHECKER1(122) CHECKER1(123) CHECKER1(124) CHECKER1(125) CHECKER1(126) CHECKER1(127)
+
+#define REF10(n)        Checker##n##0, Checker##n##1, Checker##n##2, Checker##n##3, Checker##n##4, \
+                        Checker##n##5, Checker##n##6, Checker##n##7, Checker##n##8, Checker##n##9
+/** @brief Checker of alarm id i is wrapped by Checker<i> timing its calls */
+static const ALARM_CHECK_FNC s_timingChecker[MAX_CHECKER] = {
+    Checker0, Checker1, Checker2, Checker3, Checker4, Checker5, Checker6, Checker7, Checker8, Checker9,
+    REF10(1), REF10(2), REF10(3), REF10(4), REF10(5), REF10(6), REF10(7), REF10(8), REF10(9),
+    REF10(10), REF10(11),
+    Checker120, Checker121, Checker122, Checker123, Checker124, Checker125, Checker126, Checker127,
+};
+
+/** @brief Get a pseudo random number
+ *  @param [in] uint32_t range: upper bound
+ *  @return uint32_t: number in [0, range)
+ */
+static uint32_t Random(uint32_t range)
+{
+    s_seed = s_seed * 1103515245u + 12345u;
+    return ((s_seed >> 8) & 0xFFFFFF) % range;
+}
+
+/** @brief Step a value towards a target by a fixed quantum, so values stay
+ *  unchanged for a while as on target after filtering
+ *  @param [in] float value: current value
+ *  @param [in] float target: target value
+ *  @param [in] float step: quantum
+ *  @return float: new value
+ */
+static float StepTowards(float value, float target, float step)
+{
+    if (value + step <= target)
+        return value + step;
+    if (value - step >= target)
+        return value - step;
+    return value;
+}
+
+/** @brief Update monitor for one Device task period
+ *  @return None
+ */
+static void UpdateScenario(void)
+{
+    static float targetFlow = 30;
+    static float targetTemp = 37;
+    ALARM_MONITOR_t *m = &s_monitor;
+
+    m->self_check = (s_tick < 8000);
+
+    //rare events, probability per 20 ms
+    if (Random(30000) == 0)
+        m->isACConnected = !m->isACConnected;
+    if (Random(40000) == 0)
+        m->isChamberConnected = !m->isChamberConnected;
+    if (Random(60000) == 0)
+        m->BreathingCircuitType = (E_BreathingCircuitType)Random(4);
+    if (Random(60000) == 0)
+        m->machineMode = (E_TreatmentMode)Random(2);
+    if (Random(20000) == 0)
+        m->waterTankStatus = (E_TankWaterLevel)Random(3);
+    if (Random(50000) == 0)
+        m->isCradleConnected = !m->isCradleConnected;
+    if (Random(80000) == 0)
+        m->O2FlowSensorErr = !m->O2FlowSensorErr;
+    if (Random(80000) == 0)
+        m->BME280SensorErr = !m->BME280SensorErr;
+    if (Random(90000) == 0)
+        m->isRTCModuleFailure = !m->isRTCModuleFailure;
+    if (Random(90000) == 0)
+        m->isLCDTouchModuleFailure = !m->isLCDTouchModuleFailure;
+    if (Random(90000) == 0)
+        m->isSpo2ModuleFailure = !m->isSpo2ModuleFailure;
+    if (Random(90000) == 0)
+        m->isFailureMainUnitBatteryCommunication = !m->isFailureMainUnitBatteryCommunication;
+    if (Random(90000) == 0)
+        m->isSpeakerBrokenOrDisconnected = !m->isSpeakerBrokenOrDisconnected;
+    if (Random(60000) == 0)
+        m->isMainUnitBatteryConnected = !m->isMainUnitBatteryConnected;
+    if (Random(15000) == 0)
+        m->spo2Info_struct.spo2Message = (E_Spo2Signal)Random(7);
+    if (Random(30000) == 0)
+        targetFlow = 10 + 5 * Random(11);
+    if (Random(30000) == 0)
+        targetTemp = 31 + Random(7);
+    if (Random(3000) == 0)
+        m->o2Info_struct.o2Concentration = 18 + Random(12);
+    if (Random(500) == 0)
+        m->spo2Info_struct.spo2Value = 85 + Random(15);
+
+    //battery drains one minute per minute when AC is off
+    if (!m->isACConnected && s_tick % 60000 == 0 && m->batteryRemainingTimeInMin > 0)
+        m->batteryRemainingTimeInMin--;
+    if (m->isACConnected && s_tick % 60000 == 0 && m->batteryRemainingTimeInMin < 120)
+        m->batteryRemainingTimeInMin++;
+
+    //slow analog values, moved every 100 ms by a quantum
+    if (s_tick % 100 == 0)
+    {
+        m->setFlow = targetFlow;
+        m->setTemperature = targetTemp;
+        m->setMouthTemperature = targetTemp;
+        m->currentFlow = StepTowards(m->currentFlow, targetFlow + (float)Random(3) - 1, 0.5);
+        m->currentMouthTemperature = StepTowards(m->currentMouthTemperature, targetTemp, 0.1);
+        m->chamberTemperatureSensorTemp = StepTowards(m->chamberTemperatureSensorTemp, targetTemp + 5, 0.1);
+        m->coilTemperatureSensorTemp = StepTowards(m->coilTemperatureSensorTemp, targetTemp + 20, 0.2);
+        m->breathingCircuitTemperatureSensorTemp = StepTowards(m->breathingCircuitTemperatureSensorTemp, targetTemp, 0.1);
+        m->currentBlowerRotationSpeed = 6000 + 200 * targetFlow / 10 + 50 * Random(3);
+        m->blowerControlValue = targetFlow / 60;
+        m->currentIHPower = StepTowards(m->currentIHPower, 40 + Random(20), 1);
+        m->setTargetPower = 50;
+    }
+    if (s_tick % 5000 == 0)
+    {
+        m->currenAmbientTemperature = 24 + (float)Random(3) * 0.5f;
+        m->currentO2Flow = (float)Random(3);
+        m->xAngleDirection = (float)Random(5);
+        m->yAngleDirection = (float)Random(5);
+    }
+    m->warmingUpStatus = (s_tick < 10 * 60000) ? eWarmingUp : eWarmingUpFinished;
+}
+
+/** @brief Set initial monitor of scenario
+ *  @return None
+ */
+static void InitScenario(void)
+{
+    ALARM_MONITOR_t *m = &s_monitor;
+
+    memset(m, 0, sizeof(ALARM_MONITOR_t));
+    m->BreathingCircuitType = eTypeAdult;
+    m->machineMode = eAdultMode;
+    m->breathingCode = METRAN_CODE;
+    m->isBreathingCircuitConnected = true;
+    m->isACConnected = true;
+    m->isChamberConnected = true;
+    m->isMainUnitBatteryConnected = true;
+    m->isCradleConnected = true;
+    m->isCradleBatteryConnected = true;
+    m->batteryRemainingTimeInMin = 120;
+    m->dateManufactureBreathingCircuit = 20220101;
+    m->dateCurrentBreathingCircuit = 20220601;
+    m->o2Info_struct.o2Concentration = 21;
+    m->o2Info_struct.maxO2RangeSetting = 26;
+    m->o2Info_struct.minO2RangeSetting = 19;
+    m->spo2Info_struct.spo2Connected = true;
+    m->spo2Info_struct.spo2SetLimit = 90;
+    m->spo2Info_struct.spo2Value = 97;
+    m->currenAmbientTemperature = 25;
+    m->currentMouthTemperature = 25;
+    m->currentSensor1Volt = 1.5;
+    m->currentSensor2Volt = 1.5;
+    m->breathingCircuitPowerControl = 100;
+    m->piezoControlFreq = 100;
+    m->piezoControlFreqUpperLimit = 200;
+    m->waterTankStatus = (E_TankWaterLevel)1;
+}
+
+/** @brief Open a trace for writing and write its header
+ *  @param [in] const char *path: trace file
+ *  @return FILE*: trace, NULL if error
+ */
+static FILE* CreateTrace(const char *path)
+{
+    AlarmTraceHeader header = { ALARM_TRACE_MAGIC, ALARM_TRACE_VERSION, sizeof(ALARM_MONITOR_t) };
+    FILE *f = fopen(path, "wb");
+
+    if (f != NULL && fwrite(&header, sizeof(header), 1, f) != 1)
+    {
+        fclose(f);
+        f = NULL;
+    }
+    if (f == NULL)
+        fprintf(stderr, "can not write %s\n", path);
+    return f;
+}
+
+/** @brief Write one record of a trace
+ *  @param [in] FILE *f: trace
+ *  @param [in] uint32_t tick: tick of alarm task cycle
+ *  @param [in] const ALARM_MONITOR_t *monitor: monitor seen by the cycle
+ *  @return None
+ */
+static void WriteRecord(FILE *f, uint32_t tick, const ALARM_MONITOR_t *monitor)
+{
+    fwrite(&tick, sizeof(tick), 1, f);
+    fwrite(monitor, sizeof(ALARM_MONITOR_t), 1, f);
+}
+
+/** @brief Read one record of a trace
+ *  @param [in] FILE *f: trace
+ *  @param [out] uint32_t *tick: tick of alarm task cycle
+ *  @param [out] ALARM_MONITOR_t *monitor: monitor seen by the cycle
+ *  @return bool: false at end of trace
+ */
+static bool ReadRecord(FILE *f, uint32_t *tick, ALARM_MONITOR_t *monitor)
+{
+    return fread(tick, sizeof(*tick), 1, f) == 1 && fread(monitor, sizeof(ALARM_MONITOR_t), 1, f) == 1;
+}
+
+/** @brief Write a synthetic trace, one record per alarm task cycle
+ *  @param [in] long minutes: duration
+ *  @param [in] uint32_t seed: random seed
+ *  @param [in] const char *path: trace file
+ *  @return int: 0 if success
+ */
+static int GenerateTrace(long minutes, uint32_t seed, const char *path)
+{
+    TickType_t end = (TickType_t)(minutes * 60000);
+    FILE *f = CreateTrace(path);
+
+    if (f == NULL)
+        return 1;
+    s_seed = seed;
+    InitScenario();
+    for (s_tick = 0; s_tick < end; s_tick += DEVICE_UPDATE_PERIOD / 2)
+    {
+        if (s_tick % DEVICE_UPDATE_PERIOD == 0)
+            UpdateScenario();
+        if (s_tick % ALARM_TASK_PERIOD == 0)
+            WriteRecord(f, s_tick, &s_monitor);
+    }
+    fclose(f);
+    return 0;
+}
+
+/** @brief Convert a console log of target built with ALARM_MONITOR_TRACE to a
+ *  trace. Lines of a cycle have the same tick, changed bytes are applied to the
+ *  monitor of previous cycle. The log is cut where the target restarted
+ *  @param [in] const char *logPath: console log
+ *  @param [in] const char *path: trace file
+ *  @return int: 0 if success
+ */
+static int ConvertLog(const char *logPath, const char *path)
+{
+    FILE *in = fopen(logPath, "r");
+    FILE *f;
+    ALARM_MONITOR_t monitor;
+    uint8_t *bytes = (uint8_t*)&monitor;
+    char line[512];
+    unsigned long records = 0;
+    unsigned int tick, lastTick = 0, offset, size;
+    bool pending = false;
+    int pos;
+
+    if (in == NULL)
+    {
+        fprintf(stderr, "can not read %s\n", logPath);
+        return 1;
+    }
+    f = CreateTrace(path);
+    if (f == NULL)
+    {
+        fclose(in);
+        return 1;
+    }
+    memset(&monitor, 0, sizeof(monitor));
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        const char *p = strstr(line, "am ");
+        if (p == NULL)
+            continue;
+        if (sscanf(p, "am size %u", &size) == 1)
+        {
+            if (size != sizeof(ALARM_MONITOR_t))
+            {
+                fprintf(stderr, "monitor size %u of target, %u expected\n", size, (unsigned int)sizeof(ALARM_MONITOR_t));
+                break;
+            }
+            if (pending || records != 0)
+            {
+                fprintf(stderr, "target restarted, rest of log ignored\n");
+                break;
+            }
+            continue;
+        }
+        if (sscanf(p, "am %u%n", &tick, &pos) != 1)
+            continue;
+        if (pending && tick != lastTick)
+        {
+            WriteRecord(f, lastTick, &monitor);
+            records++;
+        }
+        pending = true;
+        lastTick = tick;
+        p += pos;
+        if (sscanf(p, " %u %n", &offset, &pos) != 1)
+            continue;
+        for (p += pos; offset < sizeof(monitor) && sscanf(p, "%2hhx", &bytes[offset]) == 1; p += 2)
+            offset++;
+    }
+    if (pending)
+    {
+        WriteRecord(f, lastTick, &monitor);
+        records++;
+    }
+    fclose(in);
+    fclose(f);
+    fprintf(stderr, "%lu records\n", records);
+    return 0;
+}
+
+/** @brief Order alarm ids by total checker time, slowest first
+ *  @return int: comparison result for qsort
+ */
+static int CompareCheckerNs(const void *a, const void *b)
+{
+    uint64_t x = s_checkerNs[*(const int*)a];
+    uint64_t y = s_checkerNs[*(const int*)b];
+    return x < y ? 1 : (x > y ? -1 : 0);
+}
+
+/** @brief Print replay statistics to stderr
+ *  @param [in] unsigned long cycles: number of alarm task cycles
+ *  @param [in] uint64_t checkNs: total time of alarmMgr_CheckAllAlarm
+ *  @param [in] uint64_t checkMaxNs: slowest alarmMgr_CheckAllAlarm
+ *  @param [in] uint64_t wallNs: time of replay
+ *  @param [in] uint32_t period: alarm task period (ms)
+ *  @return None
+ */
+static void PrintStatistics(unsigned long cycles, uint64_t checkNs, uint64_t checkMaxNs, uint64_t wallNs, uint32_t period)
+{
+    int order[MAX_CHECKER];
+    unsigned long all = 0;
+    double traceMs = (double)cycles * period;
+    int i, n = 0;
+
+    for (i = 0; i < MAX_CHECKER; i++)
+    {
+        if (s_checker[i] != NULL)
+        {
+            all++;
+            order[n++] = i;
+        }
+    }
+    qsort(order, n, sizeof(int), CompareCheckerNs);
+
+    fprintf(stderr, "evaluation: %s, period %u ms\n", ALARM_DEPENDENCY_EVAL ? "dependency" : "all checkers", period);
+    fprintf(stderr, "cycles: %lu, alarm changes: %lu\n", cycles, s_changes);
+    fprintf(stderr, "replay: %.1f min in %.2f s, %.0fx real time\n", traceMs / 60000, wallNs / 1e9,
+            wallNs ? traceMs * 1e6 / wallNs : 0);
+    fprintf(stderr, "checker calls: %lu of %lu (%.1f per cycle)\n", s_totalCalls, cycles * all,
+            cycles ? (double)s_totalCalls / cycles : 0);
+    fprintf(stderr, "check all alarm: %.0f ns/cycle, max %llu ns\n", cycles ? (double)checkNs / cycles : 0,
+            (unsigned long long)checkMaxNs);
+    fprintf(stderr, "%8s %10s %10s %8s %8s\n", "alarm", "calls", "total us", "ns/call", "max ns");
+    for (i = 0; i < n; i++)
+    {
+        int id = order[i];
+        fprintf(stderr, "%8d %10lu %10.0f %8.0f %8llu\n", id, s_checkerCalls[id], s_checkerNs[id] / 1e3,
+                s_checkerCalls[id] ? (double)s_checkerNs[id] / s_checkerCalls[id] : 0,
+                (unsigned long long)s_checkerMaxNs[id]);
+    }
+}
+
+/** @brief Replay a trace through alarm manager as fast as possible
+ *  @param [in] const char *path: trace file
+ *  @param [in] uint32_t period: alarm task period (ms)
+ *  @return int: 0 if success
+ */
+static int ReplayTrace(const char *path, uint32_t period)
+{
+    FILE *f = fopen(path, "rb");
+    AlarmTraceHeader header;
+    ALARM_MONITOR_t next;
+    uint32_t nextTick, endTick;
+    bool hasNext;
+    unsigned long cycles = 0;
+    uint64_t checkNs = 0, checkMaxNs = 0, wallNs;
+    int i;
+
+    if (f == NULL || fread(&header, sizeof(header), 1, f) != 1 || header.magic != ALARM_TRACE_MAGIC
+        || header.version != ALARM_TRACE_VERSION)
+    {
+        fprintf(stderr, "%s is not an alarm trace\n", path);
+        return 1;
+    }
+    if (header.monitorSize != sizeof(ALARM_MONITOR_t))
+    {
+        fprintf(stderr, "monitor size %u of trace, %u expected\n", header.monitorSize, (unsigned int)sizeof(ALARM_MONITOR_t));
+        return 1;
+    }
+    //cycles run until tick of last record
+    fseek(f, -(long)(sizeof(uint32_t) + sizeof(ALARM_MONITOR_t)), SEEK_END);
+    hasNext = ReadRecord(f, &endTick, &next);
+    fseek(f, sizeof(header), SEEK_SET);
+    if (!hasNext || !ReadRecord(f, &nextTick, &next))
+    {
+        fprintf(stderr, "%s is empty\n", path);
+        return 1;
+    }
+
+    CalibrateClock();
+    alarmMgr_InitAlarm();
+    for (i = eFirsAlarmId; i < eLastAlarmId && i < MAX_CHECKER; i++)
+    {
+        if (s_alarmList[i].checkAlarmFnc != NULL)
+        {
+            s_checker[i] = s_alarmList[i].checkAlarmFnc;
+            s_alarmList[i].checkAlarmFnc = s_timingChecker[i];
+        }
+    }
+
+    wallNs = NowNs();
+    for (s_tick = nextTick; s_tick <= endTick; s_tick += period)
+    {
+        unsigned long calls = s_totalCalls;
+        uint64_t t;
+
+        //last snapshot recorded at or before this cycle
+        while (hasNext && nextTick <= s_tick)
+        {
+            s_monitor = next;
+            hasNext = ReadRecord(f, &nextTick, &next);
+        }
+        PublishMonitor();
+
+        alarmMgr_UpdateAlarmMonitor();
+        t = NowNs();
+        alarmMgr_CheckAllAlarm();
+        t = NowNs() - t;
+        //remove the cost of timing each checker
+        calls = s_totalCalls - calls;
+        t = t > s_clockNs * (2 * calls + 1) ? t - s_clockNs * (2 * calls + 1) : 0;
+        checkNs += t;
+        if (t > checkMaxNs)
+            checkMaxNs = t;
+        alarmMgr_UpdateAllAlarm();
+        cycles++;
+    }
+    wallNs = NowNs() - wallNs;
+    fclose(f);
+
+    PrintStatistics(cycles, checkNs, checkMaxNs, wallNs, period);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t period = ALARM_TASK_PERIOD;
+
+    if (argc == 5 && strcmp(argv[1], "-g") == 0)
+        return GenerateTrace(atol(argv[2]), (uint32_t)atol(argv[3]), argv[4]);
+    if (argc == 4 && strcmp(argv[1], "-c") == 0)
+        return ConvertLog(argv[2], argv[3]);
+    if (argc == 4 && strcmp(argv[1], "-p") == 0)
+    {
+        period = (uint32_t)atol(argv[2]);
+        argv += 2;
+        argc -= 2;
+    }
+    if (argc != 2 || period == 0)
+    {
+        fprintf(stderr, "usage: %s [-p <period ms>] <trace file>\n"
+                        "       %s -c <console log> <trace file>\n"
+                        "       %s -g <minutes> <seed> <trace file>\n", argv[0], argv[0], argv[0]);
+        return 1;
+    }
+    return ReplayTrace(argv[1], period);
+}
+
+/* end of file */
@@ -0,0 +1,34 @@
+/** @file FreeRTOS.h
+ *  @brief FreeRTOS types and tick used by Alarm/ when built on host by AlarmReplay
+ */
+#ifndef ALARMREPLAY_FREERTOS_H
+#define ALARMREPLAY_FREERTOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef void *QueueHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef void *TaskHandle_t;
+
+#define pdTRUE                  (1)
+#define pdFALSE                 (0)
+#define pdPASS                  (pdTRUE)
+#define pdFAIL                  (pdFALSE)
+#define portTICK_PERIOD_MS      (1)
+
+/** @brief Get simulated tick, 1 tick is 1 ms */
+TickType_t xTaskGetTickCount(void);
+
+/** @brief Get handle of the only task of the replay */
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+/** @brief Replay has one thread, critical sections are empty */
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+#endif
+
+/* end of file */
@@ -0,0 +1,5 @@
+/** @file externaltype.h
+ *  @brief Empty, not needed by alarm manager on host build of AlarmReplay
+ */
+
+/* end of file */
@@ -0,0 +1,6 @@
+/** @file queue.h
+ *  @brief Same as FreeRTOS.h for host build of AlarmReplay
+ */
+#include "FreeRTOS.h"
+
+/* end of file */
@@ -0,0 +1,6 @@
+/** @file semphr.h
+ *  @brief Same as FreeRTOS.h for host build of AlarmReplay
+ */
+#include "FreeRTOS.h"
+
+/* end of file */
@@ -0,0 +1,22 @@
+/** @file system_config.h
+ *  @brief Harmony system configuration replaced for host build of AlarmReplay,
+ *  console output of alarm manager is dropped, except when ALARM_MONITOR_TRACE
+ *  is defined to check the recorder on host
+ */
+#ifndef ALARMREPLAY_SYSTEM_CONFIG_H
+#define ALARMREPLAY_SYSTEM_CONFIG_H
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef ALARM_MONITOR_TRACE
+#define SYS_PRINT(...)          printf(__VA_ARGS__)
+#else
+#define SYS_PRINT(...)          ((void)0)
+#endif
+
+#endif
+
+/* end of file */
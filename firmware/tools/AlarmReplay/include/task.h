@@ -0,0 +1,6 @@
+/** @file task.h
+ *  @brief Same as FreeRTOS.h for host build of AlarmReplay
+ */
+#include "FreeRTOS.h"
+
+/* end of file */
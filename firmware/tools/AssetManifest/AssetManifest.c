@@ -0,0 +1,150 @@
+/** @file AssetManifest.c
+ *  @brief Host tool writing the manifest of a GUI asset upgrade, in the format
+ *  of src/Utilities/AssetManifest.h, from the update list (Upgrade/
+ *  update_list.jflo)
+ *
+ *  With the manifest in Upgrade/ of the USB flash as update_manifest.jflo, the
+ *  upgrade (System/SoftwareUpgrade.c) compares it with the manifest stored on
+ *  SQI flash and only copies new and changed assets, instead of formatting
+ *  SQI flash and copying the whole list. The files of the list are still
+ *  needed on the USB flash. SQI flash is still formatted and all assets copied
+ *  when SQI flash has no manifest (last upgrade was a full one) or not enough
+ *  free space to stage changed assets, the manifest is stored on SQI flash
+ *  after the copy. A bundle (SQI_Assets.jfab, tools/AssetPacker) in the same
+ *  package wins: the manifest is ignored and the bundle replaces all assets.
+ *
+ *  Build (from firmware/):
+ *    gcc -O2 -Isrc/Utilities tools/AssetManifest/AssetManifest.c
+ *        src/Utilities/AssetManifest.c src/Utilities/crc.c -o AssetManifest
+ *
+ *  Usage:
+ *    AssetManifest <update list> <output manifest> [asset directory, default: directory of list]
+ *  Example:
+ *    AssetManifest ../Upgrade/update_list.jflo ../Upgrade/update_manifest.jflo
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "AssetManifest.h"
+#include "crc.h"
+
+/** @brief Define maximum length of a path */
+#define PATH_SIZE               (1024)
+
+/** @brief Define size of read buffer */
+#define READ_CHUNK_SIZE         (32 * 1024)
+
+/** @brief Get size and CRC-32 of a file
+ *  @param [in] const char *path: file path
+ *  @param [out] ASSET_MANIFEST_ENTRY_t *entry: size and crc
+ *  @return int: 0 if success
+ */
+static int HashFile(const char *path, ASSET_MANIFEST_ENTRY_t *entry)
+{
+    static uint8_t buffer[READ_CHUNK_SIZE];
+    FILE *f = fopen(path, "rb");
+    size_t n;
+
+    if (f == NULL)
+        return -1;
+    entry->size = 0;
+    entry->crc = CRC32_START_VAL;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+        entry->crc = crc_Crc32Update(entry->crc, buffer, n);
+        entry->size += n;
+    }
+    fclose(f);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    char dir[PATH_SIZE], path[PATH_SIZE], text[PATH_SIZE];
+    char line[ASSET_MANIFEST_LINE_SIZE + 2];
+    FILE *list, *out;
+    int count = 0;
+    unsigned long totalSize = 0;
+
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <update list> <output manifest> [asset directory]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 3)
+    {
+        snprintf(dir, sizeof(dir), "%s", argv[3]);
+    }
+    else
+    {
+        char *slash;
+        snprintf(dir, sizeof(dir), "%s", argv[1]);
+        slash = strrchr(dir, '/');
+        if (slash != NULL)
+            *slash = '\0';
+        else
+            strcpy(dir, ".");
+    }
+
+    list = fopen(argv[1], "r");
+    if (list == NULL)
+    {
+        fprintf(stderr, "can not read %s\n", argv[1]);
+        return 1;
+    }
+    out = fopen(argv[2], "w");
+    if (out == NULL)
+    {
+        fprintf(stderr, "can not write %s\n", argv[2]);
+        return 1;
+    }
+    fprintf(out, "# Generated by tools/AssetManifest from %s\n", argv[1]);
+
+    while (fgets(text, sizeof(text), list) != NULL)
+    {
+        ASSET_MANIFEST_ENTRY_t entry;
+        char *name = text;
+        char *end = text + strcspn(text, "\r\n");
+
+        *end = '\0';
+        while (*name == ' ' || *name == '\t')
+            name++;
+        while (end > name && (end[-1] == ' ' || end[-1] == '\t'))
+            *--end = '\0';
+        if (*name == '\0')
+            continue;
+        if (strlen(name) >= ASSET_MANIFEST_NAME_SIZE || strchr(name, ',') != NULL)
+        {
+            fprintf(stderr, "%s: invalid name\n", name);
+            return 1;
+        }
+        if (count == ASSET_MANIFEST_MAX_ENTRY)
+        {
+            fprintf(stderr, "more than %d assets\n", ASSET_MANIFEST_MAX_ENTRY);
+            return 1;
+        }
+
+        snprintf(path, sizeof(path), "%s/%s", dir, name);
+        strcpy(entry.name, name);
+        if (HashFile(path, &entry) != 0)
+        {
+            fprintf(stderr, "can not read %s\n", path);
+            return 1;
+        }
+        assetManifest_FormatEntry(line, sizeof(line), &entry);
+        fputs(line, out);
+        totalSize += entry.size;
+        count++;
+    }
+    fclose(list);
+    if (fclose(out) != 0)
+    {
+        fprintf(stderr, "can not write %s\n", argv[2]);
+        return 1;
+    }
+
+    printf("%d assets, %lu bytes\n", count, totalSize);
+    return 0;
+}
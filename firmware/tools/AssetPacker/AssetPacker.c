@@ -0,0 +1,260 @@
+/** @file AssetPacker.c
+ *  @brief Host tool packing the GUI assets of an update list (Upgrade/
+ *  update_list.jflo) into one asset bundle, in the format of
+ *  src/Utilities/AssetBundle.h, loaded by System/SQIInterface.c
+ *
+ *  Each asset file ends with its CRC16 (crc_Update from CRC16_START_VAL, high
+ *  byte first), the tool checks it and stores the data without it: the index
+ *  entry holds length and CRC of the data. Payloads start on page boundaries.
+ *  The bundle is read back and checked with the firmware functions before the
+ *  tool returns.
+ *
+ *  Copy the bundle to Upgrade/ of the USB flash as SQI_Assets.jfab
+ *  (FILE_NAME_ASSET_BUNDLE): the upgrade copies it instead of the files of the
+ *  update list.
+ *
+ *  Build (from firmware/):
+ *    gcc -O2 -Isrc/Utilities tools/AssetPacker/AssetPacker.c
+ *        src/Utilities/AssetBundle.c src/Utilities/crc.c -o AssetPacker
+ *
+ *  Usage:
+ *    AssetPacker <update list> <output bundle> [asset directory, default: directory of list]
+ *  Example:
+ *    AssetPacker ../Upgrade/update_list.jflo SQI_Assets.jfab
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "AssetBundle.h"
+#include "crc.h"
+
+/** @brief Define size of CRC at the end of each asset file */
+#define ASSET_CRC_SIZE          (2)
+
+/** @brief Define maximum length of a path */
+#define PATH_SIZE               (1024)
+
+static ASSET_BUNDLE_ENTRY_t s_index[ASSET_BUNDLE_MAX_ENTRY];
+static uint8_t *s_data[ASSET_BUNDLE_MAX_ENTRY];
+
+/** @brief Read a whole file
+ *  @param [in] const char *path: file path
+ *  @param [out] size_t *size: file size
+ *  @return uint8_t*: file data, NULL if error
+ */
+static uint8_t* ReadFile(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *data;
+    long len;
+
+    if (f == NULL)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc(len > 0 ? len : 1);
+    if (data == NULL || fread(data, 1, len, f) != (size_t)len)
+    {
+        free(data);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+    *size = len;
+    return data;
+}
+
+/** @brief Round up to a page boundary */
+static uint32_t PageAlign(uint32_t offset)
+{
+    return (offset + ASSET_BUNDLE_PAGE_SIZE - 1) / ASSET_BUNDLE_PAGE_SIZE * ASSET_BUNDLE_PAGE_SIZE;
+}
+
+/** @brief Read assets of update list
+ *  @param [in] char *list: update list, NUL terminated, modified
+ *  @param [in] const char *dir: asset directory
+ *  @return int: number of assets, -1 if error
+ */
+static int ReadAssets(char *list, const char *dir)
+{
+    char *name;
+    int count = 0, i;
+
+    for (name = strtok(list, "\r\n"); name != NULL; name = strtok(NULL, "\r\n"))
+    {
+        char path[PATH_SIZE];
+        size_t size;
+        uint8_t *data;
+        char *end = name + strlen(name);
+
+        //skip blanks around name and empty lines
+        while (*name == ' ' || *name == '\t')
+            name++;
+        while (end > name && (end[-1] == ' ' || end[-1] == '\t'))
+            *--end = '\0';
+        if (*name == '\0')
+            continue;
+
+        if (strlen(name) >= ASSET_BUNDLE_NAME_SIZE)
+        {
+            fprintf(stderr, "%s: name longer than %d\n", name, ASSET_BUNDLE_NAME_SIZE - 1);
+            return -1;
+        }
+        for (i = 0; i < count; i++)
+        {
+            if (strcmp(s_index[i].name, name) == 0)
+                break;
+        }
+        if (i < count)
+        {
+            fprintf(stderr, "%s: listed twice\n", name);
+            return -1;
+        }
+        if (count == ASSET_BUNDLE_MAX_ENTRY)
+        {
+            fprintf(stderr, "more than %d assets\n", ASSET_BUNDLE_MAX_ENTRY);
+            return -1;
+        }
+
+        snprintf(path, sizeof(path), "%s/%s", dir, name);
+        data = ReadFile(path, &size);
+        if (data == NULL)
+        {
+            fprintf(stderr, "can not read %s\n", path);
+            return -1;
+        }
+        //CRC over data and CRC bytes is 0
+        if (size < ASSET_CRC_SIZE || crc_Update(CRC16_START_VAL, data, size) != 0)
+        {
+            fprintf(stderr, "%s: bad CRC at end of file\n", path);
+            return -1;
+        }
+
+        memset(&s_index[count], 0, sizeof(ASSET_BUNDLE_ENTRY_t));
+        strcpy(s_index[count].name, name);
+        s_index[count].length = size - ASSET_CRC_SIZE;
+        s_index[count].crc = crc_Update(CRC16_START_VAL, data, s_index[count].length);
+        s_data[count] = data;
+        count++;
+    }
+    return count;
+}
+
+/** @brief Check a bundle image the way the firmware loads it
+ *  @param [in] const uint8_t *bundle: bundle image
+ *  @param [in] size_t size: size of image
+ *  @return int: 0 if success
+ */
+static int CheckBundle(const uint8_t *bundle, size_t size)
+{
+    ASSET_BUNDLE_HEADER_t header;
+    const ASSET_BUNDLE_ENTRY_t *index;
+    int i;
+
+    memcpy(&header, bundle, sizeof(header));
+    if (!assetBundle_CheckHeader(&header)
+        || size < sizeof(header) + assetBundle_IndexSize(header.entryCount))
+        return -1;
+    index = (const ASSET_BUNDLE_ENTRY_t*)(bundle + sizeof(header));
+    if (!assetBundle_CheckIndex(&header, index, size))
+        return -1;
+    for (i = 0; i < header.entryCount; i++)
+    {
+        if (assetBundle_Find(index, header.entryCount, index[i].name, i) != i
+            || crc_Update(CRC16_START_VAL, bundle + index[i].offset, index[i].length) != index[i].crc)
+            return -1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    char dir[PATH_SIZE];
+    char *list;
+    size_t size, dataSize = 0;
+    uint32_t offset;
+    uint8_t *bundle;
+    ASSET_BUNDLE_HEADER_t header;
+    FILE *out;
+    int count, i;
+
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <update list> <output bundle> [asset directory]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 3)
+    {
+        snprintf(dir, sizeof(dir), "%s", argv[3]);
+    }
+    else
+    {
+        char *slash;
+        snprintf(dir, sizeof(dir), "%s", argv[1]);
+        slash = strrchr(dir, '/');
+        if (slash != NULL)
+            *slash = '\0';
+        else
+            strcpy(dir, ".");
+    }
+
+    list = (char*)ReadFile(argv[1], &size);
+    if (list == NULL)
+    {
+        fprintf(stderr, "can not read %s\n", argv[1]);
+        return 1;
+    }
+    list = realloc(list, size + 1);
+    list[size] = '\0';
+    count = ReadAssets(list, dir);
+    if (count <= 0)
+    {
+        fprintf(stderr, "no asset packed\n");
+        return 1;
+    }
+
+    //payloads follow the index, each one on a page boundary
+    offset = PageAlign(sizeof(ASSET_BUNDLE_HEADER_t) + assetBundle_IndexSize(count));
+    for (i = 0; i < count; i++)
+    {
+        s_index[i].offset = offset;
+        offset = PageAlign(offset + s_index[i].length);
+        dataSize += s_index[i].length;
+    }
+    size = s_index[count - 1].offset + s_index[count - 1].length;
+
+    memset(&header, 0, sizeof(header));
+    header.magic = ASSET_BUNDLE_MAGIC;
+    header.version = ASSET_BUNDLE_VERSION;
+    header.entryCount = count;
+    header.pageSize = ASSET_BUNDLE_PAGE_SIZE;
+    header.indexCrc = crc_Update(CRC16_START_VAL, s_index, assetBundle_IndexSize(count));
+
+    bundle = calloc(size, 1);
+    memcpy(bundle, &header, sizeof(header));
+    memcpy(bundle + sizeof(header), s_index, assetBundle_IndexSize(count));
+    for (i = 0; i < count; i++)
+        memcpy(bundle + s_index[i].offset, s_data[i], s_index[i].length);
+
+    if (CheckBundle(bundle, size) != 0)
+    {
+        fprintf(stderr, "bundle check failed\n");
+        return 1;
+    }
+
+    out = fopen(argv[2], "wb");
+    if (out == NULL || fwrite(bundle, 1, size, out) != size || fclose(out) != 0)
+    {
+        fprintf(stderr, "can not write %s\n", argv[2]);
+        return 1;
+    }
+
+    printf("%d assets, %lu bytes of data, bundle %lu bytes (index %lu bytes, padding %lu bytes)\n",
+           count, (unsigned long)dataSize, (unsigned long)size,
+           (unsigned long)assetBundle_IndexSize(count),
+           (unsigned long)(size - dataSize - sizeof(header) - assetBundle_IndexSize(count)));
+    return 0;
+}
@@ -0,0 +1,371 @@
+/** @file CrcBench.c
+ *  @brief Host benchmark and equivalence check of the slice-by-8 CRC16 of
+ *  src/Utilities/crc.c (crc_Update, crc_crc16ccitt and crc_CheckWithInit)
+ *  against a bitwise reference, over the GUI assets of the update list
+ *  (Upgrade/update_list.jflo)
+ *
+ *  For each asset the result of each function is compared with the bitwise
+ *  reference on the whole file, then crc_Update is run over blocks of
+ *  pseudo random size (1 byte to 16 KB) and from unaligned addresses, and
+ *  must give the same result as one call. As each asset ends with its CRC16
+ *  (high byte first), crc_Update over the whole file must also give 0.
+ *
+ *  Then each function is timed over all assets, time is the best of several
+ *  runs. The byte at a time table lookup of the former crc.c is also timed.
+ *
+ *  Build (from firmware/):
+ *    gcc -O2 -Isrc/Utilities tools/CrcBench/CrcBench.c src/Utilities/crc.c -o CrcBench
+ *
+ *  Usage:
+ *    CrcBench <update list> [asset directory, default: directory of list]
+ *  Example:
+ *    CrcBench ../Upgrade/update_list.jflo
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "crc.h"
+
+/** @brief Define maximum length of a path */
+#define PATH_SIZE               (1024)
+
+/** @brief Define maximum number of assets */
+#define MAX_ASSET               (1024)
+
+/** @brief Define size of CRC at end of asset file */
+#define ASSET_CRC_SIZE          (2)
+
+/** @brief Define maximum size of a block of the incremental check */
+#define MAX_BLOCK_SIZE          (16 * 1024)
+
+/** @brief Define number of timed runs, best one is kept */
+#define RUN_NUM                 (5)
+
+/** @brief Define polynomials, as in crc.c */
+#define CRC_CCITT_POLY          (0x1021)
+#define CRC_CCITT_REFLECTED_POLY    (0x8408)
+
+/** @brief Define asset loaded in memory */
+typedef struct
+{
+    char name[PATH_SIZE];
+    uint8_t *data;
+    uint32_t size;
+} ASSET_t;
+
+/** @brief Define function under timing */
+typedef enum
+{
+    eFncBitwise,
+    eFncByteTable,
+    eFncCrc16ccitt,
+    eFncUpdate,
+    eFncCheckWithInit,
+    eNumberOfFnc
+} E_Fnc;
+
+static const char *s_fncName[eNumberOfFnc] = {
+    "bitwise reference", "byte table (former)", "crc_crc16ccitt", "crc_Update", "crc_CheckWithInit"
+};
+
+static ASSET_t s_asset[MAX_ASSET];
+static int s_assetCount = 0;
+
+/** @brief table of the former byte at a time crc_crc16ccitt */
+static unsigned short s_byteTab[256];
+
+/** @brief Bitwise CRC16 CCITT, most significant bit first, as crc_crc16ccitt
+ *  @param [in] unsigned short crc: initial value
+ *  @param [in] const uint8_t *p: data
+ *  @param [in] uint32_t len: size of data
+ *  @param [out] None
+ *  @return unsigned short: crc
+ */
+static unsigned short RefCcitt(unsigned short crc, const uint8_t *p, uint32_t len)
+{
+    int bit;
+
+    while (len-- > 0)
+    {
+        crc ^= (unsigned short)(*p++ << 8);
+        for (bit = 0; bit < 8; bit++)
+            crc = (crc & 0x8000) ? (unsigned short)((crc << 1) ^ CRC_CCITT_POLY) : (unsigned short)(crc << 1);
+    }
+    return crc;
+}
+
+/** @brief Bitwise reflected CRC16 CCITT, as crc_CheckWithInit
+ *  @param [in] unsigned short crc: initial value
+ *  @param [in] const uint8_t *p: data
+ *  @param [in] uint32_t len: size of data
+ *  @param [out] None
+ *  @return unsigned short: crc
+ */
+static unsigned short RefReflected(unsigned short crc, const uint8_t *p, uint32_t len)
+{
+    int bit;
+
+    while (len-- > 0)
+    {
+        crc ^= *p++;
+        for (bit = 0; bit < 8; bit++)
+            crc = (crc & 0x0001) ? (unsigned short)((crc >> 1) ^ CRC_CCITT_REFLECTED_POLY) : (unsigned short)(crc >> 1);
+    }
+    return crc;
+}
+
+/** @brief Byte at a time table lookup of the former crc_crc16ccitt
+ *  @param [in] unsigned short crc: initial value
+ *  @param [in] const uint8_t *p: data
+ *  @param [in] uint32_t len: size of data
+ *  @param [out] None
+ *  @return unsigned short: crc
+ */
+static unsigned short ByteTable(unsigned short crc, const uint8_t *p, uint32_t len)
+{
+    while (len-- > 0)
+        crc = (unsigned short)(crc << 8) ^ s_byteTab[((crc >> 8) ^ *p++) & 0x00FF];
+    return crc;
+}
+
+/** @brief Get time in ns
+ *  @param [in] None
+ *  @param [out] None
+ *  @return uint64_t: monotonic time
+ */
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/** @brief Get a pseudo random number
+ *  @param [in] uint32_t range: numbers are in [0, range)
+ *  @param [out] None
+ *  @return uint32_t: number
+ */
+static uint32_t Random(uint32_t range)
+{
+    static uint32_t s_seed = 1;
+
+    s_seed = s_seed * 1103515245u + 12345u;
+    return (s_seed >> 8) % range;
+}
+
+/** @brief Load assets of the update list
+ *  @param [in] const char *listPath: update list
+ *  @param [in] const char *dir: asset directory
+ *  @param [out] None
+ *  @return int: 0 if success
+ */
+static int LoadAssets(const char *listPath, const char *dir)
+{
+    char line[PATH_SIZE];
+    char path[2 * PATH_SIZE];
+    FILE *list, *f;
+    long size;
+
+    list = fopen(listPath, "r");
+    if (list == NULL)
+    {
+        fprintf(stderr, "can not read %s\n", listPath);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), list) != NULL)
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0')
+            continue;
+        if (s_assetCount >= MAX_ASSET)
+        {
+            fprintf(stderr, "more than %d assets\n", MAX_ASSET);
+            fclose(list);
+            return -1;
+        }
+        snprintf(path, sizeof(path), "%s/%s", dir, line);
+        f = fopen(path, "rb");
+        if (f == NULL)
+        {
+            fprintf(stderr, "can not read %s\n", path);
+            fclose(list);
+            return -1;
+        }
+        fseek(f, 0, SEEK_END);
+        size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        s_asset[s_assetCount].data = (uint8_t*)malloc(size > 0 ? size : 1);
+        if ((s_asset[s_assetCount].data == NULL) || (fread(s_asset[s_assetCount].data, 1, size, f) != (size_t)size))
+        {
+            fprintf(stderr, "can not read %s\n", path);
+            fclose(f);
+            fclose(list);
+            return -1;
+        }
+        fclose(f);
+        strcpy(s_asset[s_assetCount].name, line);
+        s_asset[s_assetCount].size = (uint32_t)size;
+        s_assetCount++;
+    }
+    fclose(list);
+    return 0;
+}
+
+/** @brief Check functions of crc.c against the bitwise reference on an asset
+ *  @param [in] const ASSET_t *asset: asset
+ *  @param [out] None
+ *  @return int: number of mismatches
+ */
+static int CheckAsset(const ASSET_t *asset)
+{
+    static uint8_t s_unaligned[MAX_BLOCK_SIZE + 8];
+    unsigned short ref = RefCcitt(CRC16_START_VAL, asset->data, asset->size);
+    unsigned short refReflected = RefReflected(0xFFFF, asset->data, asset->size);
+    unsigned short crc;
+    uint32_t pos, block, shift;
+    int errors = 0;
+
+    if (crc_crc16ccitt(CRC16_START_VAL, (int)asset->size, asset->data) != ref)
+    {
+        fprintf(stderr, "%s: crc_crc16ccitt differs\n", asset->name);
+        errors++;
+    }
+    if (crc_Update(CRC16_START_VAL, asset->data, asset->size) != ref)
+    {
+        fprintf(stderr, "%s: crc_Update differs\n", asset->name);
+        errors++;
+    }
+    if (crc_CheckWithInit(0xFFFF, (long)asset->size, (int8_t*)asset->data) != refReflected)
+    {
+        fprintf(stderr, "%s: crc_CheckWithInit differs\n", asset->name);
+        errors++;
+    }
+
+    //blocks of random size copied to random alignment, as streamed from SQI/USB
+    crc = CRC16_START_VAL;
+    for (pos = 0; pos < asset->size; pos += block)
+    {
+        block = 1 + Random(MAX_BLOCK_SIZE);
+        if (block > asset->size - pos)
+            block = asset->size - pos;
+        shift = Random(8);
+        memcpy(&s_unaligned[shift], &asset->data[pos], block);
+        crc = crc_Update(crc, &s_unaligned[shift], block);
+    }
+    if (crc != ref)
+    {
+        fprintf(stderr, "%s: crc_Update over blocks differs\n", asset->name);
+        errors++;
+    }
+
+    if ((asset->size < ASSET_CRC_SIZE) || (ref != 0))
+    {
+        fprintf(stderr, "%s: CRC at end of file is wrong\n", asset->name);
+        errors++;
+    }
+    return errors;
+}
+
+/** @brief Run a function over all assets
+ *  @param [in] E_Fnc fnc: function
+ *  @param [out] None
+ *  @return unsigned short: xor of results, keeps the calls
+ */
+static unsigned short RunAll(E_Fnc fnc)
+{
+    unsigned short result = 0;
+    int i;
+
+    for (i = 0; i < s_assetCount; i++)
+    {
+        const ASSET_t *a = &s_asset[i];
+        switch (fnc)
+        {
+            case eFncBitwise:
+                result ^= RefCcitt(CRC16_START_VAL, a->data, a->size);
+                break;
+            case eFncByteTable:
+                result ^= ByteTable(CRC16_START_VAL, a->data, a->size);
+                break;
+            case eFncCrc16ccitt:
+                result ^= crc_crc16ccitt(CRC16_START_VAL, (int)a->size, a->data);
+                break;
+            case eFncUpdate:
+                result ^= crc_Update(CRC16_START_VAL, a->data, a->size);
+                break;
+            case eFncCheckWithInit:
+                result ^= crc_CheckWithInit(0xFFFF, (long)a->size, (int8_t*)a->data);
+                break;
+            default:
+                break;
+        }
+    }
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    char dir[PATH_SIZE];
+    const char *slash;
+    uint64_t totalBytes = 0, best, start, ns, bitwiseNs = 0;
+    volatile unsigned short sink;
+    int errors = 0;
+    int i, run, bit;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <update list> [asset directory]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 2)
+    {
+        snprintf(dir, sizeof(dir), "%s", argv[2]);
+    }
+    else
+    {
+        slash = strrchr(argv[1], '/');
+        snprintf(dir, sizeof(dir), "%.*s", slash ? (int)(slash - argv[1]) : 1, slash ? argv[1] : ".");
+    }
+
+    for (i = 0; i < 256; i++)
+    {
+        unsigned short normal = (unsigned short)(i << 8);
+        for (bit = 0; bit < 8; bit++)
+            normal = (normal & 0x8000) ? (unsigned short)((normal << 1) ^ CRC_CCITT_POLY) : (unsigned short)(normal << 1);
+        s_byteTab[i] = normal;
+    }
+
+    if (LoadAssets(argv[1], dir) != 0)
+        return 1;
+    for (i = 0; i < s_assetCount; i++)
+    {
+        errors += CheckAsset(&s_asset[i]);
+        totalBytes += s_asset[i].size;
+    }
+    printf("%d assets, %llu bytes, %d mismatches\n", s_assetCount, (unsigned long long)totalBytes, errors);
+
+    for (i = 0; i < eNumberOfFnc; i++)
+    {
+        best = UINT64_MAX;
+        for (run = 0; run < RUN_NUM; run++)
+        {
+            start = NowNs();
+            sink = RunAll((E_Fnc)i);
+            ns = NowNs() - start;
+            if (ns < best)
+                best = ns;
+        }
+        if (i == eFncBitwise)
+            bitwiseNs = best;
+        printf("%-20s %8.2f ms %8.1f MB/s %6.1fx\n", s_fncName[i], best / 1e6,
+               totalBytes * 1e3 / (double)best, (double)bitwiseNs / best);
+    }
+    (void)sink;
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,277 @@
+/** @file KalmanBench.c
+ *  @brief Host benchmark of the motor task flow filter: generic double
+ *  precision EKF (KalmanLPF_Step + ekf_step) against the single precision
+ *  diagonal filter (KalmanLPF_DiagStep), exact and steady state gain
+ *
+ *  Flow data is a text file with one motor cycle (10 ms) per line: air flow
+ *  and O2 flow (L/min) separated by space, tab or comma. Other lines are
+ *  ignored, so a console log with the values at the beginning of the line can
+ *  be given. With -g a synthetic recording is generated from a seed: flow
+ *  setting changes every few seconds, sensors have noise and ripple.
+ *
+ *  Each filter is run on the whole recording, time per step is the best of
+ *  several runs. On x86 the time stamp counter is also given as cycles per
+ *  step. Output error of each diagonal filter is given against the EKF, on
+ *  the whole recording and after the first 10 s (steady state gain converges
+ *  faster from the zero initial state).
+ *
+ *  Build (from firmware/):
+ *    gcc -O2 -Isrc/Utilities tools/KalmanBench/KalmanBench.c
+ *        src/Utilities/KalmanLPF.c src/Utilities/ekf.c -lm -o KalmanBench
+ *
+ *  Usage:
+ *    KalmanBench <flow file>
+ *    KalmanBench -g <seconds> <seed>
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAS_TSC 1
+#else
+#define HAS_TSC 0
+#endif
+
+#include "KalmanLPF.h"
+
+/** @brief Define motor task period (ms) */
+#define MOTOR_PERIOD_MS         (10)
+
+/** @brief Define number of steps skipped before steady error is measured (10 s) */
+#define WARMUP_STEPS            (10000 / MOTOR_PERIOD_MS)
+
+/** @brief Define number of timed runs, best one is kept */
+#define RUN_NUM                 (5)
+
+/** @brief Define filter under test */
+typedef enum
+{
+    eFilterEkf,
+    eFilterDiag,
+    eFilterDiagSteady,
+    eNumberOfFilter
+} E_Filter;
+
+static const char *s_filterName[eNumberOfFilter] = { "ekf double", "diag float", "diag steady" };
+
+static float *s_air;
+static float *s_o2;
+static long s_count;
+
+/** @brief output of each filter, 3 states per step */
+static float *s_out[eNumberOfFilter];
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t NowTsc(void)
+{
+#if HAS_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/** @brief Add a step to the recording
+ *  @param [in] float air: air flow
+ *  @param [in] float o2: O2 flow
+ *  @return None
+ */
+static void AddStep(float air, float o2)
+{
+    static long capacity = 0;
+    if (s_count == capacity)
+    {
+        capacity = capacity ? capacity * 2 : 4096;
+        s_air = realloc(s_air, capacity * sizeof(float));
+        s_o2 = realloc(s_o2, capacity * sizeof(float));
+    }
+    s_air[s_count] = air;
+    s_o2[s_count] = o2;
+    s_count++;
+}
+
+/** @brief Load a flow recording
+ *  @param [in] const char *path: text file
+ *  @return int: 0 if success
+ */
+static int LoadFlow(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+
+    if (f == NULL)
+    {
+        fprintf(stderr, "can not read %s\n", path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        float air, o2;
+        char *p;
+        for (p = line; *p; p++)
+        {
+            if (*p == ',')
+                *p = ' ';
+        }
+        if (sscanf(line, "%f %f", &air, &o2) == 2)
+            AddStep(air, o2);
+    }
+    fclose(f);
+    return (s_count > 0) ? 0 : -1;
+}
+
+/** @brief Generate a synthetic flow recording
+ *  @param [in] int seconds: length
+ *  @param [in] unsigned seed: seed of generator
+ *  @return None
+ */
+static void GenerateFlow(int seconds, unsigned seed)
+{
+    long steps = (long)seconds * 1000 / MOTOR_PERIOD_MS;
+    float airSet = 20, o2Set = 5, air = 0, o2 = 0;
+    long i;
+
+    srand(seed);
+    for (i = 0; i < steps; i++)
+    {
+        //new flow setting every 15 s on average
+        if (rand() % (15000 / MOTOR_PERIOD_MS) == 0)
+        {
+            airSet = 5 + rand() % 55;
+            o2Set = rand() % 30;
+        }
+        //blower response, then sensor noise and motor ripple
+        air += (airSet - air) * 0.02f;
+        o2 += (o2Set - o2) * 0.05f;
+        AddStep(air + 0.3f * ((float)rand() / RAND_MAX - 0.5f) + 0.1f * sinf(i * 0.7f),
+                o2 + 0.2f * ((float)rand() / RAND_MAX - 0.5f));
+    }
+}
+
+/** @brief Run a filter on the whole recording
+ *  @param [in] E_Filter filter: filter
+ *  @param [out] float *out: 3 states per step
+ *  @return None
+ */
+static void RunFilter(E_Filter filter, float *out)
+{
+    static KALMAN_LPF_t ekf;
+    static KALMAN_LPF_DIAG_t diag;
+    long i;
+
+    if (filter == eFilterEkf)
+    {
+        memset(&ekf, 0, sizeof(ekf));
+        KalmanLPF_Initialize(&ekf);
+        for (i = 0; i < s_count; i++)
+        {
+            double z[Mobs] = { s_air[i] + s_o2[i], s_air[i], s_o2[i] };
+            KalmanLPF_Step(&ekf, z);
+            out[3 * i] = KalmanLPF_GetX(&ekf, 0);
+            out[3 * i + 1] = KalmanLPF_GetX(&ekf, 1);
+            out[3 * i + 2] = KalmanLPF_GetX(&ekf, 2);
+        }
+    }
+    else
+    {
+        KalmanLPF_DiagInitialize(&diag, filter == eFilterDiagSteady);
+        for (i = 0; i < s_count; i++)
+        {
+            float z[Mobs] = { s_air[i] + s_o2[i], s_air[i], s_o2[i] };
+            KalmanLPF_DiagStep(&diag, z);
+            out[3 * i] = KalmanLPF_DiagGetX(&diag, 0);
+            out[3 * i + 1] = KalmanLPF_DiagGetX(&diag, 1);
+            out[3 * i + 2] = KalmanLPF_DiagGetX(&diag, 2);
+        }
+    }
+}
+
+/** @brief Print error of a filter against the EKF
+ *  @param [in] E_Filter filter: filter
+ *  @param [in] long start: first step compared
+ *  @return None
+ */
+static void PrintError(E_Filter filter, long start)
+{
+    double maxError = 0, sum = 0;
+    long i;
+    int k;
+
+    for (i = start; i < s_count; i++)
+    {
+        for (k = 0; k < Nsta; k++)
+        {
+            double e = fabs((double)s_out[filter][3 * i + k] - s_out[eFilterEkf][3 * i + k]);
+            if (e > maxError)
+                maxError = e;
+            sum += e * e;
+        }
+    }
+    printf("  %-12s from %5.1f s: max error %.6f  rms %.6f L/min\n", s_filterName[filter],
+           start * MOTOR_PERIOD_MS / 1000.0, maxError,
+           (s_count > start) ? sqrt(sum / ((s_count - start) * Nsta)) : 0);
+}
+
+int main(int argc, char **argv)
+{
+    int f, r;
+
+    if (argc == 4 && strcmp(argv[1], "-g") == 0)
+    {
+        GenerateFlow(atoi(argv[2]), (unsigned)atoi(argv[3]));
+    }
+    else if (argc == 2)
+    {
+        if (LoadFlow(argv[1]) != 0)
+            return 1;
+    }
+    else
+    {
+        fprintf(stderr, "usage: %s <flow file> | -g <seconds> <seed>\n", argv[0]);
+        return 1;
+    }
+    if (s_count == 0)
+    {
+        fprintf(stderr, "no flow data\n");
+        return 1;
+    }
+
+    printf("%ld steps (%.1f s of motor task)\n", s_count, s_count * MOTOR_PERIOD_MS / 1000.0);
+    for (f = 0; f < eNumberOfFilter; f++)
+    {
+        uint64_t bestNs = UINT64_MAX, bestTsc = UINT64_MAX;
+        s_out[f] = malloc(sizeof(float) * 3 * s_count);
+        for (r = 0; r < RUN_NUM; r++)
+        {
+            uint64_t ns = NowNs(), tsc = NowTsc();
+            RunFilter(f, s_out[f]);
+            tsc = NowTsc() - tsc;
+            ns = NowNs() - ns;
+            if (ns < bestNs)
+                bestNs = ns;
+            if (tsc < bestTsc)
+                bestTsc = tsc;
+        }
+        printf("  %-12s %8.1f ns/step", s_filterName[f], (double)bestNs / s_count);
+        if (HAS_TSC)
+            printf("  %8.1f cycles/step", (double)bestTsc / s_count);
+        printf("\n");
+    }
+    for (f = eFilterDiag; f < eNumberOfFilter; f++)
+    {
+        PrintError(f, 0);
+        PrintError(f, WARMUP_STEPS);
+    }
+    return 0;
+}
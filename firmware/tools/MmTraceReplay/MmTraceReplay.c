@@ -0,0 +1,385 @@
+/** @file MmTraceReplay.c
+ *  @brief Host tool replaying an allocation trace recorded by Gui/mm.c against
+ *  the allocator, to compare the heap alone with the heap plus slab layer
+ *
+ *  Record a trace by building the firmware with MM_TRACE defined and capturing
+ *  the console. Lines not starting with "mm " are ignored, so the whole console
+ *  log can be given:
+ *    mm a <ptr> <size>          mm_malloc / mm_calloc
+ *    mm f <ptr>                 mm_free
+ *    mm r <old> <new> <size>    mm_realloc
+ *  With -g a synthetic GUI like trace is written to stdout instead.
+ *
+ *  Build (from firmware/), once per allocator:
+ *    gcc -O2 -fgnu89-inline -DMM_SLAB_ENABLE=0 -Isrc/Gui tools/MmTraceReplay/MmTraceReplay.c
+ *        src/Gui/mm.c -o MmTraceReplayHeap
+ *    gcc -O2 -fgnu89-inline -DMM_SLAB_ENABLE=1 -Isrc/Gui tools/MmTraceReplay/MmTraceReplay.c
+ *        src/Gui/mm.c -o MmTraceReplaySlab
+ *
+ *  Usage:
+ *    MmTraceReplay <trace file> [repeat]
+ *    MmTraceReplay -g <operations> [seed] > trace.txt
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <sys/mman.h>
+
+#include "mm.h"
+#include "memlib.h"
+
+/** @brief Define heap size, same as MAX_DDR_HEAP of memlib.c */
+#define MAX_DDR_HEAP            (0x1633FFF)
+
+/** @brief Define heap address on host. mm.c keeps 32 bits pointers with bit 31
+ *  set (kseg on PIC32), so the heap must be mapped below 4GB with bit 31 set */
+#define HOST_HEAP_ADDR          (0xA89CD000UL)
+
+/** @brief Define size of table mapping traced pointers to replayed pointers */
+#define PTR_TABLE_SIZE          (1 << 20)
+
+#ifndef MM_SLAB_ENABLE
+#define MM_SLAB_ENABLE 0
+#endif
+
+/** @brief Define operation of trace */
+typedef struct
+{
+    char op;
+    unsigned long ptr;
+    unsigned long newPtr;
+    unsigned int size;
+} TraceOp;
+
+/** @brief Define entry of pointer table */
+typedef struct
+{
+    unsigned long key;
+    void *ptr;
+    unsigned int size;
+} PtrEntry;
+
+static char *heap;
+static char *mem_brk;
+static char *mem_max_addr;
+
+static PtrEntry *s_ptrTable;
+
+/* memlib.c for host, heap is mapped at the same address as on target */
+void mem_init(void)
+{
+    heap = mmap((void *)HOST_HEAP_ADDR, MAX_DDR_HEAP, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (heap != (char *)HOST_HEAP_ADDR)
+    {
+        fprintf(stderr, "can not map heap at %lx\n", HOST_HEAP_ADDR);
+        exit(1);
+    }
+    mem_max_addr = heap + MAX_DDR_HEAP;
+    mem_brk = heap;
+}
+
+void mem_deinit(void)
+{
+    munmap(heap, MAX_DDR_HEAP);
+}
+
+void mem_reset_brk(void)
+{
+    mem_brk = heap;
+}
+
+void *mem_sbrk(int incr)
+{
+    char *old_brk = mem_brk;
+
+    if ((incr < 0) || ((mem_brk + incr) > mem_max_addr))
+        return (void *)-1;
+    mem_brk += incr;
+    return (void *)old_brk;
+}
+
+void *mem_heap_lo(void)
+{
+    return (void *)heap;
+}
+
+void *mem_heap_hi(void)
+{
+    return (void *)(mem_brk - 1);
+}
+
+size_t mem_heapsize(void)
+{
+    return (size_t)(mem_brk - heap);
+}
+
+size_t mem_pagesize(void)
+{
+    return 4096;
+}
+
+/** @brief Find slot of a traced pointer in pointer table
+ *  @param [in] unsigned long key: traced pointer
+ *  @return PtrEntry*: slot holding key, or empty slot
+ */
+static PtrEntry* PtrTable_Find(unsigned long key)
+{
+    unsigned long i = (key >> 3) & (PTR_TABLE_SIZE - 1);
+
+    while (s_ptrTable[i].key != 0 && s_ptrTable[i].key != key)
+        i = (i + 1) & (PTR_TABLE_SIZE - 1);
+    return &s_ptrTable[i];
+}
+
+/** @brief Remove a traced pointer from pointer table, keep probe chains valid
+ *  @param [in] PtrEntry *e: slot to remove
+ *  @return None
+ */
+static void PtrTable_Remove(PtrEntry *e)
+{
+    unsigned long i = e - s_ptrTable;
+    unsigned long j = i;
+
+    s_ptrTable[i].key = 0;
+    for (;;)
+    {
+        unsigned long home;
+        j = (j + 1) & (PTR_TABLE_SIZE - 1);
+        if (s_ptrTable[j].key == 0)
+            break;
+        home = (s_ptrTable[j].key >> 3) & (PTR_TABLE_SIZE - 1);
+        //move back entries whose home is not between the hole and their slot
+        if ((j > i && (home <= i || home > j)) || (j < i && (home <= i && home > j)))
+        {
+            s_ptrTable[i] = s_ptrTable[j];
+            s_ptrTable[j].key = 0;
+            i = j;
+        }
+    }
+}
+
+/** @brief Load a trace file
+ *  @param [in] const char *path: trace file
+ *  @param [out] size_t *count: number of operations
+ *  @return TraceOp*: operations, NULL if error
+ */
+static TraceOp* LoadTrace(const char *path, size_t *count)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+    size_t cap = 4096, n = 0;
+    TraceOp *ops;
+
+    if (f == NULL)
+        return NULL;
+    ops = malloc(cap * sizeof(TraceOp));
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        TraceOp op = { 0 };
+        const char *p = strstr(line, "mm ");
+        if (p == NULL)
+            continue;
+        if (sscanf(p, "mm a %lx %u", &op.ptr, &op.size) == 2)
+            op.op = 'a';
+        else if (sscanf(p, "mm f %lx", &op.ptr) == 1)
+            op.op = 'f';
+        else if (sscanf(p, "mm r %lx %lx %u", &op.ptr, &op.newPtr, &op.size) == 3)
+            op.op = 'r';
+        else
+            continue;
+        if (n == cap)
+        {
+            cap *= 2;
+            ops = realloc(ops, cap * sizeof(TraceOp));
+        }
+        ops[n++] = op;
+    }
+    fclose(f);
+    *count = n;
+    return ops;
+}
+
+/** @brief Get time in nanoseconds
+ *  @return uint64_t: monotonic time
+ */
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/** @brief Replay trace once on a fresh heap
+ *  @param [in] const TraceOp *ops: operations
+ *  @param [in] size_t count: number of operations
+ *  @param [out] uint64_t *maxNs: slowest operation
+ *  @param [out] size_t *peakLive: peak of requested bytes alive
+ *  @return uint64_t: total time of allocator calls
+ */
+static uint64_t Replay(const TraceOp *ops, size_t count, uint64_t *maxNs, size_t *peakLive)
+{
+    uint64_t total = 0;
+    size_t live = 0;
+    size_t i;
+
+    memset(s_ptrTable, 0, PTR_TABLE_SIZE * sizeof(PtrEntry));
+    mem_reset_brk();
+    if (mm_init() != 0)
+    {
+        fprintf(stderr, "mm_init failed\n");
+        exit(1);
+    }
+    *maxNs = 0;
+    *peakLive = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        const TraceOp *op = &ops[i];
+        PtrEntry *e = NULL;
+        void *p = NULL;
+        uint64_t t;
+
+        if (op->op != 'a' && op->ptr != 0)
+        {
+            e = PtrTable_Find(op->ptr);
+            if (e->key == 0)
+                continue;   //freed pointer not allocated in trace
+            p = e->ptr;
+        }
+
+        t = NowNs();
+        if (op->op == 'a')
+            p = mm_malloc(op->size);
+        else if (op->op == 'f')
+            mm_free(p);
+        else
+            p = mm_realloc(p, op->size);
+        t = NowNs() - t;
+        total += t;
+        if (t > *maxNs)
+            *maxNs = t;
+
+        if (e != NULL)
+        {
+            live -= e->size;
+            PtrTable_Remove(e);
+        }
+        if (op->op == 'f')
+            continue;
+        if (p == NULL && op->size != 0)
+        {
+            fprintf(stderr, "out of memory at operation %zu\n", i);
+            exit(1);
+        }
+        if (p != NULL)
+        {
+            e = PtrTable_Find(op->op == 'a' ? op->ptr : op->newPtr);
+            e->key = op->op == 'a' ? op->ptr : op->newPtr;
+            e->ptr = p;
+            e->size = op->size;
+            live += op->size;
+            if (live > *peakLive)
+                *peakLive = live;
+        }
+    }
+    return total;
+}
+
+/** @brief Write a synthetic trace: widget structs and strings allocated and
+ *  freed while screens change, a few frame buffers reallocated now and then
+ *  @param [in] long count: number of operations
+ *  @param [in] unsigned int seed: random seed
+ *  @return None
+ */
+static void GenerateTrace(long count, unsigned int seed)
+{
+    static const unsigned int hotSizes[] = { 12, 24, 40, 64, 100, 160, 512, 1800, 16000 };
+    static const unsigned int bigSizes[] = { 80000, 261120, 130560 };
+    unsigned long *live = calloc(count, sizeof(unsigned long));
+    unsigned long big[8] = { 0 };
+    unsigned long next = 0x1000;
+    long nLive = 0, i;
+
+    srand(seed);
+    for (i = 0; i < count; i++)
+    {
+        int r = rand() % 100;
+        if (r < 2)
+        {
+            //replace a frame buffer
+            int k = rand() % 8;
+            if (big[k] != 0)
+                printf("mm f %lx\n", big[k]);
+            big[k] = next;
+            printf("mm a %lx %u\n", next, bigSizes[rand() % 3]);
+            next += 0x1000;
+        }
+        else if (nLive > 0 && (r < 50 || nLive > 4000))
+        {
+            long k = rand() % nLive;
+            printf("mm f %lx\n", live[k]);
+            live[k] = live[--nLive];
+        }
+        else
+        {
+            printf("mm a %lx %u\n", next, hotSizes[rand() % 9] + rand() % 8);
+            live[nLive++] = next;
+            next += 0x1000;
+        }
+    }
+    free(live);
+}
+
+int main(int argc, char **argv)
+{
+    TraceOp *ops;
+    size_t count, peakLive = 0;
+    uint64_t total = 0, maxNs = 0, maxAll = 0;
+    int repeat = 1, i;
+
+    if (argc >= 3 && strcmp(argv[1], "-g") == 0)
+    {
+        GenerateTrace(atol(argv[2]), argc > 3 ? (unsigned int)atoi(argv[3]) : 1);
+        return 0;
+    }
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <trace file> [repeat]\n       %s -g <operations> [seed]\n", argv[0], argv[0]);
+        return 1;
+    }
+    if (argc > 2)
+        repeat = atoi(argv[2]);
+
+    ops = LoadTrace(argv[1], &count);
+    if (ops == NULL)
+    {
+        fprintf(stderr, "can not read %s\n", argv[1]);
+        return 1;
+    }
+    s_ptrTable = malloc(PTR_TABLE_SIZE * sizeof(PtrEntry));
+    mem_init();
+
+    for (i = 0; i < repeat; i++)
+    {
+        total += Replay(ops, count, &maxNs, &peakLive);
+        if (maxNs > maxAll)
+            maxAll = maxNs;
+    }
+
+    printf("allocator: %s\n", MM_SLAB_ENABLE ? "heap + slab" : "heap");
+    printf("operations: %zu x %d\n", count, repeat);
+    printf("time: %.1f ns/op, max %llu ns\n", (double)total / (count * repeat), (unsigned long long)maxAll);
+    printf("heap: %zu bytes for %zu bytes peak live\n", mem_heapsize(), peakLive);
+    mm_checkheap(0);
+
+    mem_deinit();
+    free(s_ptrTable);
+    free(ops);
+    return 0;
+}
+
+/* end of file */
@@ -0,0 +1,122 @@
+/** @file TraceDecoder.c
+ *  @brief Host tool printing a trace file (trace.bin, exported to DebugLog/ of
+ *  the USB flash with the debug log) as text, with the format table of
+ *  src/Utilities/TraceFormat.h
+ *
+ *  Each record is printed as: tick (ms), ring (one per task writing trace),
+ *  text. Words not starting a record are skipped and counted, so a damaged
+ *  file still decodes. Decode with the TraceFormat.h of the firmware that
+ *  wrote the trace.
+ *
+ *  Build (from firmware/):
+ *    gcc -O2 -Isrc/Utilities tools/TraceDecoder/TraceDecoder.c -o TraceDecoder
+ *
+ *  Usage:
+ *    TraceDecoder <trace file> [output text, default: stdout]
+ *  Example:
+ *    TraceDecoder /media/usb/DebugLog/trace.bin trace.txt
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "Trace.h"
+
+/** @brief Define format of each record id */
+#define TRACE_FORMAT(id, format)        [id] = format,
+static const char *s_format[eNoOfTraceId] = {
+    TRACE_FORMAT_TABLE
+};
+#undef TRACE_FORMAT
+
+/** @brief Read a little endian word
+ *  @param [in] FILE *f: trace file
+ *  @param [out] uint32_t *word: word read
+ *  @return int: 0 if success, -1 at end of file
+ */
+static int ReadWord(FILE *f, uint32_t *word)
+{
+    uint8_t b[4];
+
+    if (fread(b, 1, sizeof(b), f) != sizeof(b))
+        return -1;
+    *word = (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *in, *out = stdout;
+    uint32_t word, tick, args[TRACE_MAX_ARG];
+    unsigned long records = 0, skipped = 0;
+    unsigned int count, i;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <trace file> [output text]\n", argv[0]);
+        return 1;
+    }
+    in = fopen(argv[1], "rb");
+    if (in == NULL)
+    {
+        fprintf(stderr, "can not read %s\n", argv[1]);
+        return 1;
+    }
+    if (argc > 2)
+    {
+        out = fopen(argv[2], "w");
+        if (out == NULL)
+        {
+            fprintf(stderr, "can not write %s\n", argv[2]);
+            return 1;
+        }
+    }
+
+    while (ReadWord(in, &word) == 0)
+    {
+        unsigned int id = TRACE_RECORD_ID_OF(word);
+
+        count = TRACE_RECORD_ARGC_OF(word);
+        if ((TRACE_RECORD_MARK_OF(word) != TRACE_RECORD_MARK) || (count > TRACE_MAX_ARG))
+        {
+            skipped++;
+            continue;
+        }
+        if (ReadWord(in, &tick) != 0)
+            break;
+        memset(args, 0, sizeof(args));
+        for (i = 0; i < count; i++)
+        {
+            if (ReadWord(in, &args[i]) != 0)
+                break;
+        }
+        if (i < count)
+            break;
+
+        fprintf(out, "%10lu R%u ", (unsigned long)tick, (unsigned int)TRACE_RECORD_RING_OF(word));
+        if ((id < eNoOfTraceId) && (s_format[id] != NULL))
+        {
+            fprintf(out, s_format[id], args[0], args[1], args[2], args[3], args[4],
+                    args[5], args[6], args[7], args[8]);
+        }
+        else
+        {
+            //record of a newer firmware
+            fprintf(out, "unknown id %u:", id);
+            for (i = 0; i < count; i++)
+                fprintf(out, " %08lX", (unsigned long)args[i]);
+        }
+        fputc('\n', out);
+        records++;
+    }
+    fclose(in);
+    if (out != stdout && fclose(out) != 0)
+    {
+        fprintf(stderr, "can not write %s\n", argv[2]);
+        return 1;
+    }
+
+    fprintf(stderr, "%lu records, %lu words skipped\n", records, skipped);
+    return 0;
+}
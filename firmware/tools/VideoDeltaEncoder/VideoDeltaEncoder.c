@@ -0,0 +1,332 @@
+/** @file VideoDeltaEncoder.c
+ *  @brief Host tool converting a sequence of video frames to key frames plus
+ *  delta frames, in the format played by Gui/VideoControl.c
+ *
+ *  Each input is either a raw RGB565 frame (width * height * 2 bytes) or an
+ *  existing frame file from Upgrade/ (LZMA header + data + CRC16). Each output
+ *  file keeps the input file name and has the same layout as the asset files:
+ *  5 bytes LZMA properties, 8 bytes uncompressed size, LZMA data, CRC16.
+ *  A delta frame is VideoDeltaHeader, VideoDeltaRect list, rectangle pixels.
+ *
+ *  Build (from firmware/):
+ *    gcc -O2 -D_7ZIP_ST -Isrc/7z -Isrc/Utilities tools/VideoDeltaEncoder/VideoDeltaEncoder.c
+ *        src/7z/LzmaEnc.c src/7z/LzFind.c src/7z/LzmaDec.c src/Utilities/crc.c -o VideoDeltaEncoder
+ *
+ *  Usage:
+ *    VideoDeltaEncoder <width> <height> <key interval> <output dir> <frame files...>
+ *  width and height are the frame size as stored (VideoControl w and h).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "LzmaEnc.h"
+#include "LzmaDec.h"
+#include "crc.h"
+
+/** @brief Define bytes per pixel of RGB565 */
+#define BYTES_PER_PIXEL         (2)
+
+/** @brief Define size of tile used to find changed area */
+#define TILE_SIZE               (8)
+
+/** @brief Define magic at the beginning of a delta frame ("JDLT"), same as VideoControl.h */
+#define VIDEO_DELTA_MAGIC       (0x544C444A)
+
+/** @brief Define size of LZMA header: properties and uncompressed size */
+#define LZMA_HEADER_SIZE        (LZMA_PROPS_SIZE + 8)
+
+/** @brief Define dictionary size, same as existing frame files */
+#define LZMA_DICT_SIZE          (1 << 20)
+
+/** @brief Define header of a delta frame, same as VideoControl.h */
+typedef struct
+{
+    uint32_t magic;
+    uint16_t rectCount;
+    uint16_t reserved;
+} VideoDeltaHeader;
+
+/** @brief Define changed rectangle of a delta frame, same as VideoControl.h */
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+} VideoDeltaRect;
+
+static void *SzAlloc(ISzAllocPtr p, size_t size) { return malloc(size); }
+static void SzFree(ISzAllocPtr p, void *address) { free(address); }
+static const ISzAlloc g_Alloc = { SzAlloc, SzFree };
+
+static int s_width;
+static int s_height;
+static size_t s_frameSize;
+
+/** @brief Read a whole file
+ *  @param [in] const char *path: file path
+ *  @param [out] size_t *size: file size
+ *  @return uint8_t*: file data, NULL if error
+ */
+static uint8_t* ReadFile(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *data;
+    long len;
+
+    if (f == NULL)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc(len > 0 ? len : 1);
+    if (data == NULL || fread(data, 1, len, f) != (size_t)len)
+    {
+        free(data);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+    *size = len;
+    return data;
+}
+
+/** @brief Load one input frame, raw or LZMA frame file
+ *  @param [in] const char *path: file path
+ *  @param [out] uint8_t *frame: frame of s_frameSize bytes
+ *  @param [out] size_t *fileSize: size of input file
+ *  @return int: 0 if success
+ */
+static int LoadFrame(const char *path, uint8_t *frame, size_t *fileSize)
+{
+    size_t size = 0;
+    uint8_t *data = ReadFile(path, &size);
+    SizeT destLen = s_frameSize;
+    SizeT srcLen;
+    ELzmaStatus status;
+    int res = -1;
+
+    if (data == NULL)
+    {
+        fprintf(stderr, "can not read %s\n", path);
+        return -1;
+    }
+
+    if (size == s_frameSize)
+    {
+        memcpy(frame, data, s_frameSize);
+        res = 0;
+    }
+    else if (size > LZMA_HEADER_SIZE + 2 && crc_crc16ccitt(CRC16_START_VAL, size, data) == 0)
+    {
+        srcLen = size - LZMA_HEADER_SIZE - 2;
+        if (LzmaDecode(frame, &destLen, data + LZMA_HEADER_SIZE, &srcLen, data, LZMA_PROPS_SIZE,
+                       LZMA_FINISH_END, &status, &g_Alloc) == SZ_OK && destLen == s_frameSize)
+            res = 0;
+    }
+
+    if (res != 0)
+        fprintf(stderr, "%s is not a %dx%d frame\n", path, s_width, s_height);
+    *fileSize = size;
+    free(data);
+    return res;
+}
+
+/** @brief Build delta payload of a frame from previous frame. Changed tiles of
+ *  each tile row are merged into horizontal runs, a run is extended down while
+ *  the next tile rows have the same run
+ *  @param [in] const uint8_t *prev: previous frame
+ *  @param [in] const uint8_t *cur: current frame
+ *  @param [out] uint8_t *out: delta payload, at least 2 * s_frameSize bytes
+ *  @return size_t: size of payload
+ */
+static size_t BuildDelta(const uint8_t *prev, const uint8_t *cur, uint8_t *out)
+{
+    int tilesX = (s_width + TILE_SIZE - 1) / TILE_SIZE;
+    int tilesY = (s_height + TILE_SIZE - 1) / TILE_SIZE;
+    uint8_t *dirty = calloc(tilesX * tilesY, 1);
+    VideoDeltaRect *rects = malloc(sizeof(VideoDeltaRect) * tilesX * tilesY);
+    VideoDeltaHeader header = { VIDEO_DELTA_MAGIC, 0, 0 };
+    size_t pos;
+    int tx, ty, x, y, i, end;
+
+    for (y = 0; y < s_height; y++)
+    {
+        for (x = 0; x < s_width; x++)
+        {
+            size_t off = ((size_t)y * s_width + x) * BYTES_PER_PIXEL;
+            if (memcmp(prev + off, cur + off, BYTES_PER_PIXEL) != 0)
+                dirty[(y / TILE_SIZE) * tilesX + x / TILE_SIZE] = 1;
+        }
+    }
+
+    for (ty = 0; ty < tilesY; ty++)
+    {
+        for (tx = 0; tx < tilesX; tx++)
+        {
+            int ny;
+            VideoDeltaRect r;
+            if (!dirty[ty * tilesX + tx])
+                continue;
+            for (end = tx; end < tilesX && dirty[ty * tilesX + end]; end++)
+                ;
+            //extend down while the same run is dirty
+            for (ny = ty + 1; ny < tilesY; ny++)
+            {
+                for (i = tx; i < end && dirty[ny * tilesX + i]; i++)
+                    ;
+                if (i != end)
+                    break;
+            }
+            for (i = ty; i < ny; i++)
+                memset(&dirty[i * tilesX + tx], 0, end - tx);
+
+            r.x = tx * TILE_SIZE;
+            r.y = ty * TILE_SIZE;
+            r.w = (end * TILE_SIZE > s_width ? s_width : end * TILE_SIZE) - r.x;
+            r.h = (ny * TILE_SIZE > s_height ? s_height : ny * TILE_SIZE) - r.y;
+            rects[header.rectCount++] = r;
+            tx = end - 1;
+        }
+    }
+
+    memcpy(out, &header, sizeof(header));
+    pos = sizeof(header);
+    memcpy(out + pos, rects, header.rectCount * sizeof(VideoDeltaRect));
+    pos += header.rectCount * sizeof(VideoDeltaRect);
+    for (i = 0; i < header.rectCount; i++)
+    {
+        for (y = 0; y < rects[i].h; y++)
+        {
+            size_t off = ((size_t)(rects[i].y + y) * s_width + rects[i].x) * BYTES_PER_PIXEL;
+            memcpy(out + pos, cur + off, rects[i].w * BYTES_PER_PIXEL);
+            pos += rects[i].w * BYTES_PER_PIXEL;
+        }
+    }
+
+    free(dirty);
+    free(rects);
+    return pos;
+}
+
+/** @brief Compress a payload and write it as a frame file with CRC
+ *  @param [in] const char *path: output path
+ *  @param [in] const uint8_t *payload: uncompressed frame
+ *  @param [in] size_t size: size of payload
+ *  @return long: size of file without CRC, -1 if error
+ */
+static long WriteFrameFile(const char *path, const uint8_t *payload, size_t size)
+{
+    CLzmaEncProps props;
+    SizeT propsSize = LZMA_PROPS_SIZE;
+    SizeT destLen = size + size / 2 + 1024;
+    uint8_t *out = malloc(LZMA_HEADER_SIZE + destLen + 2);
+    unsigned short crc;
+    size_t total;
+    FILE *f;
+    int i;
+
+    LzmaEncProps_Init(&props);
+    props.level = 9;
+    props.dictSize = LZMA_DICT_SIZE;
+    if (LzmaEncode(out + LZMA_HEADER_SIZE, &destLen, payload, size, &props, out, &propsSize, 0,
+                   NULL, &g_Alloc, &g_Alloc) != SZ_OK)
+    {
+        free(out);
+        return -1;
+    }
+    for (i = 0; i < 8; i++)
+        out[LZMA_PROPS_SIZE + i] = (uint8_t)((uint64_t)size >> (i * 8));
+
+    total = LZMA_HEADER_SIZE + destLen;
+    crc = crc_crc16ccitt(CRC16_START_VAL, total, out);
+    out[total] = crc >> 8;
+    out[total + 1] = crc & 0xFF;
+
+    f = fopen(path, "wb");
+    if (f == NULL || fwrite(out, 1, total + 2, f) != total + 2)
+    {
+        if (f)
+            fclose(f);
+        free(out);
+        return -1;
+    }
+    fclose(f);
+    free(out);
+    return (long)total;
+}
+
+int main(int argc, char **argv)
+{
+    int keyInterval, i;
+    uint8_t *prev, *cur, *delta;
+    long inTotal = 0, outTotal = 0;
+
+    if (argc < 6)
+    {
+        fprintf(stderr, "usage: %s <width> <height> <key interval> <output dir> <frame files...>\n", argv[0]);
+        return 1;
+    }
+    s_width = atoi(argv[1]);
+    s_height = atoi(argv[2]);
+    keyInterval = atoi(argv[3]);
+    s_frameSize = (size_t)s_width * s_height * BYTES_PER_PIXEL;
+    if (s_width <= 0 || s_height <= 0 || keyInterval <= 0)
+    {
+        fprintf(stderr, "invalid size or key interval\n");
+        return 1;
+    }
+
+    prev = malloc(s_frameSize);
+    cur = malloc(s_frameSize);
+    delta = malloc(s_frameSize * 2);
+
+    for (i = 5; i < argc; i++)
+    {
+        const char *name = strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i];
+        char path[1024];
+        int index = i - 5;
+        size_t inSize, deltaSize = s_frameSize;
+        long outSize;
+        const char *type = "key";
+
+        if (LoadFrame(argv[i], cur, &inSize) != 0)
+            return 1;
+
+        //a delta frame must be smaller than a frame, key frame is used when delta is not worth it
+        if (index % keyInterval != 0)
+            deltaSize = BuildDelta(prev, cur, delta);
+
+        snprintf(path, sizeof(path), "%s/%s", argv[4], name);
+        if (deltaSize < s_frameSize * 3 / 4)
+        {
+            outSize = WriteFrameFile(path, delta, deltaSize);
+            type = "delta";
+        }
+        else
+        {
+            outSize = WriteFrameFile(path, cur, s_frameSize);
+        }
+        if (outSize < 0)
+        {
+            fprintf(stderr, "can not write %s\n", path);
+            return 1;
+        }
+
+        //size for g_fileList (without CRC)
+        printf("%s %s %ld -> %ld\n", name, type, (long)inSize - 2, outSize);
+        inTotal += inSize - 2;
+        outTotal += outSize;
+        memcpy(prev, cur, s_frameSize);
+    }
+    printf("total %ld -> %ld\n", inTotal, outTotal);
+
+    free(prev);
+    free(cur);
+    free(delta);
+    return 0;
+}
+
+/* end of file */
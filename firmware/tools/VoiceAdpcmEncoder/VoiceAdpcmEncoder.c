@@ -0,0 +1,249 @@
+/** @file VoiceAdpcmEncoder.c
+ *  @brief Host tool converting a voice prompt WAV to IMA-ADPCM, in the format
+ *  played by Device/VoicePrompt.c, and checking the round trip error
+ *
+ *  The input is either a WAV file (PCM 16 bit mono) or a C file embedding one
+ *  as a byte array (like the former Device/ptbl_voice_*.c). The output is a C
+ *  file defining const VOICE_PROMPT_t g_voicePrompt<name>. The codes are
+ *  decoded again with src/Utilities/ImaAdpcm.c, the same decoder as the
+ *  firmware, and compared with the input. The tool fails if SNR is below the
+ *  minimum.
+ *
+ *  Build (from firmware/):
+ *    gcc -O2 -Isrc/Utilities tools/VoiceAdpcmEncoder/VoiceAdpcmEncoder.c
+ *        src/Utilities/ImaAdpcm.c -lm -o VoiceAdpcmEncoder
+ *
+ *  Usage:
+ *    VoiceAdpcmEncoder <input .wav|.c> <name> <output .c> [min SNR dB, default 20]
+ *  Example:
+ *    VoiceAdpcmEncoder ptbl_voice_start.wav Start src/Device/ptbl_voice_start_adpcm.c
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "ImaAdpcm.h"
+
+/** @brief Define default minimum SNR of round trip (dB) */
+#define DEFAULT_MIN_SNR_DB      (20.0)
+
+/** @brief Define number of bytes per line of output array */
+#define BYTES_PER_LINE          (12)
+
+/** @brief Read a whole file
+ *  @param [in] const char *path: file path
+ *  @param [out] size_t *size: file size
+ *  @return uint8_t*: file data, NULL if error
+ */
+static uint8_t* ReadFile(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *data;
+    long len;
+
+    if (f == NULL)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc(len > 0 ? len : 1);
+    if (data == NULL || fread(data, 1, len, f) != (size_t)len)
+    {
+        free(data);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+    *size = len;
+    return data;
+}
+
+/** @brief Convert a C byte array ({0x52, 0x49, ...}) to bytes, in place
+ *  @param [in] uint8_t *text: C file, NUL terminated
+ *  @param [out] size_t *size: number of bytes
+ *  @return int: 0 if success
+ */
+static int ParseCArray(uint8_t *text, size_t *size)
+{
+    char *p = strchr((char*)text, '{');
+    size_t n = 0;
+
+    if (p == NULL)
+        return -1;
+    p++;
+    while (*p != '\0' && *p != '}')
+    {
+        char *end;
+        unsigned long value;
+        if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+        {
+            value = strtoul(p, &end, 16);
+            if (value > 0xFF)
+                return -1;
+            text[n++] = (uint8_t)value;
+            p = end;
+        }
+        else
+        {
+            p++;
+        }
+    }
+    *size = n;
+    return (*p == '}') ? 0 : -1;
+}
+
+/** @brief Read little endian values */
+static uint32_t Get32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static uint16_t Get16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+/** @brief Find PCM samples in a WAV image
+ *  @param [in] const uint8_t *wav: WAV image
+ *  @param [in] size_t size: size of image
+ *  @param [out] const uint8_t **pcm: first sample
+ *  @param [out] uint32_t *count: number of samples
+ *  @param [out] uint32_t *rate: sample rate
+ *  @return int: 0 if success
+ */
+static int ParseWav(const uint8_t *wav, size_t size, const uint8_t **pcm, uint32_t *count, uint32_t *rate)
+{
+    size_t pos = 12;
+    int hasFormat = 0;
+
+    if (size < 12 || memcmp(wav, "RIFF", 4) != 0 || memcmp(wav + 8, "WAVE", 4) != 0)
+    {
+        fprintf(stderr, "not a WAV file\n");
+        return -1;
+    }
+    while (pos + 8 <= size)
+    {
+        uint32_t len = Get32(wav + pos + 4);
+        const uint8_t *chunk = wav + pos + 8;
+
+        if (len > size - pos - 8)
+            len = size - pos - 8;
+        if (memcmp(wav + pos, "fmt ", 4) == 0 && len >= 16)
+        {
+            if (Get16(chunk) != 1 || Get16(chunk + 2) != 1 || Get16(chunk + 14) != 16)
+            {
+                fprintf(stderr, "only PCM 16 bit mono is supported\n");
+                return -1;
+            }
+            *rate = Get32(chunk + 4);
+            hasFormat = 1;
+        }
+        else if (memcmp(wav + pos, "data", 4) == 0 && hasFormat)
+        {
+            *pcm = chunk;
+            *count = len / 2;
+            return 0;
+        }
+        //chunks are word aligned
+        pos += 8 + len + (len & 1);
+    }
+    fprintf(stderr, "no fmt/data chunk\n");
+    return -1;
+}
+
+int main(int argc, char **argv)
+{
+    size_t size = 0;
+    uint8_t *input;
+    const uint8_t *pcm;
+    uint32_t count, rate, i;
+    size_t codeSize;
+    uint8_t *codes;
+    int16_t *decoded;
+    IMA_ADPCM_STATE_t state;
+    double signal = 0, noise = 0, snr, minSnr = DEFAULT_MIN_SNR_DB;
+    int maxError = 0;
+    const char *inName;
+    FILE *out;
+
+    if (argc < 4)
+    {
+        fprintf(stderr, "usage: %s <input .wav|.c> <name> <output .c> [min SNR dB]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 4)
+        minSnr = atof(argv[4]);
+    inName = strrchr(argv[1], '/') ? strrchr(argv[1], '/') + 1 : argv[1];
+
+    input = ReadFile(argv[1], &size);
+    if (input == NULL)
+    {
+        fprintf(stderr, "can not read %s\n", argv[1]);
+        return 1;
+    }
+    if (size < 4 || memcmp(input, "RIFF", 4) != 0)
+    {
+        //C array, NUL terminate the text then convert in place
+        input = realloc(input, size + 1);
+        input[size] = '\0';
+        if (ParseCArray(input, &size) != 0)
+        {
+            fprintf(stderr, "can not parse byte array in %s\n", argv[1]);
+            return 1;
+        }
+    }
+    if (ParseWav(input, size, &pcm, &count, &rate) != 0)
+        return 1;
+
+    //encode, 2 codes per byte, low nibble first
+    codeSize = (count + 1) / 2;
+    codes = calloc(codeSize ? codeSize : 1, 1);
+    decoded = malloc(sizeof(int16_t) * (count ? count : 1));
+    imaAdpcm_Reset(&state);
+    for (i = 0; i < count; i++)
+    {
+        uint8_t code = imaAdpcm_EncodeSample(&state, (int16_t)Get16(pcm + 2 * i));
+        codes[i >> 1] |= (i & 1) ? (code << 4) : code;
+    }
+
+    //round trip with the firmware decoder
+    imaAdpcm_Reset(&state);
+    imaAdpcm_Decode(&state, codes, 0, decoded, count);
+    for (i = 0; i < count; i++)
+    {
+        int x = (int16_t)Get16(pcm + 2 * i);
+        int e = x - decoded[i];
+        signal += (double)x * x;
+        noise += (double)e * e;
+        if (abs(e) > maxError)
+            maxError = abs(e);
+    }
+    snr = (noise > 0) ? 10 * log10(signal / noise) : 99.0;
+
+    out = fopen(argv[3], "w");
+    if (out == NULL)
+    {
+        fprintf(stderr, "can not write %s\n", argv[3]);
+        return 1;
+    }
+    fprintf(out, "/* Generated by tools/VoiceAdpcmEncoder from %s\n", inName);
+    fprintf(out, "   IMA-ADPCM, %u samples at %u Hz, %lu bytes (PCM %lu bytes) */\n\n",
+            count, rate, (unsigned long)codeSize, (unsigned long)count * 2);
+    fprintf(out, "#include \"VoicePrompt.h\"\n\n");
+    fprintf(out, "static const uint8_t s_voicePrompt%sData[%lu] = {", argv[2], (unsigned long)codeSize);
+    for (i = 0; i < codeSize; i++)
+    {
+        if (i % BYTES_PER_LINE == 0)
+            fprintf(out, "\n\t");
+        fprintf(out, "0x%02X%s", codes[i], (i + 1 < codeSize) ? ((i + 1) % BYTES_PER_LINE ? ", " : ",") : "");
+    }
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "const VOICE_PROMPT_t g_voicePrompt%s = { s_voicePrompt%sData, %u, %u };\n",
+            argv[2], argv[2], count, rate);
+    fclose(out);
+
+    printf("%s: %u samples at %u Hz, %lu -> %lu bytes (%.2fx), SNR %.1f dB, max error %d\n",
+           inName, count, rate, (unsigned long)size, (unsigned long)codeSize,
+           (double)size / (codeSize ? codeSize : 1), snr, maxError);
+    if (snr < minSnr)
+    {
+        fprintf(stderr, "SNR %.1f dB is below %.1f dB\n", snr, minSnr);
+        return 1;
+    }
+    return 0;
+}